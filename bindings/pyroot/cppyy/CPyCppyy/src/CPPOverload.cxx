@@ -571,21 +571,28 @@ static PyObject* mp_call(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
 // otherwise, handle overloading
     uint64_t sighash = HashSignature(args);
 
-// look for known signatures ...
+// look for known signatures, starting with the one of the previous call (common in loops) ...
     auto& dispatchMap = pymeth->fMethodInfo->fDispatchMap;
     PyCallable* memoized_pc = nullptr;
-    for (const auto& p : dispatchMap) {
-        if (p.first == sighash) {
-            memoized_pc = p.second;
-            break;
+    if (pymeth->fMethodInfo->fLastCallable && pymeth->fMethodInfo->fLastSigHash == sighash)
+        memoized_pc = pymeth->fMethodInfo->fLastCallable;
+    else {
+        for (const auto& p : dispatchMap) {
+            if (p.first == sighash) {
+                memoized_pc = p.second;
+                break;
+            }
         }
     }
     if (memoized_pc) {
         PyObject* result = memoized_pc->Call(pymeth->fSelf, args, kwds, &ctxt);
         result = HandleReturn(pymeth, oldSelf, result);
 
-        if (result)
+        if (result) {
+            pymeth->fMethodInfo->fLastSigHash = sighash;
+            pymeth->fMethodInfo->fLastCallable = memoized_pc;
             return result;
+        }
 
     // fall through: python is dynamic, and so, the hashing isn't infallible
         PyErr_Clear();
@@ -621,6 +628,9 @@ static PyObject* mp_call(CPPOverload* pymeth, PyObject* args, PyObject* kwds)
                     }
                 }
 
+                pymeth->fMethodInfo->fLastSigHash = sighash;
+                pymeth->fMethodInfo->fLastCallable = methods[i];
+
             // clear collected errors
                 if (!errors.empty())
                     std::for_each(errors.begin(), errors.end(), Utility::PyError_t::Clear);
@@ -914,6 +924,7 @@ void CPyCppyy::CPPOverload::Set(const std::string& name, std::vector<PyCallable*
     fMethodInfo->fName = name;
     fMethodInfo->fMethods.swap(methods);
     fMethodInfo->fFlags &= ~CallContext::kIsSorted;
+    fMethodInfo->fLastCallable = nullptr;
 
 // special case: all constructors are considered creators by default
     if (name == "__init__")
@@ -943,6 +954,7 @@ void CPyCppyy::CPPOverload::MergeOverload(CPPOverload* meth)
     fMethodInfo->fFlags &= ~CallContext::kIsSorted;
     meth->fMethodInfo->fDispatchMap.clear();
     meth->fMethodInfo->fMethods.clear();
+    meth->fMethodInfo->fLastCallable = nullptr;
 }
 
 //----------------------------------------------------------------------------
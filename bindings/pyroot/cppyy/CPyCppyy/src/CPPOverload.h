@@ -47,6 +47,10 @@ public:
         CPPOverload::Methods_t      fMethods;
         uint64_t                    fFlags;
 
+    // signature and overload of the last successful call, checked before the dispatch map
+        uint64_t                    fLastSigHash{0};
+        PyCallable*                 fLastCallable{nullptr};
+
         int* fRefCount;
 
     private:
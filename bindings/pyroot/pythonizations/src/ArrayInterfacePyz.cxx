@@ -0,0 +1,243 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "CPyCppyy.h"
+#include "CPPInstance.h"
+#include "CPPScope.h"
+#include "PyROOTPythonize.h"
+#include "ROOT/RConfig.hxx"
+#include "TInterpreter.h"
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/// Signature of the jitted functions which return the memory layout of a contiguous container
+using ArrayInfoFunc_t = void (*)(void *obj, void **data, char *kind, std::size_t *itemsize,
+                                 std::vector<std::size_t> *shape, std::vector<std::size_t> *strides);
+
+/// Jitted functions for each class with array interface
+std::map<Cppyy::TCppType_t, ArrayInfoFunc_t> gArrayInfoFuncs;
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Jit the function returning the memory layout of a class
+/// \param[in] cppname Name of the C++ class
+/// \param[in] datamethod Method returning the pointer to the data
+/// \param[in] shapemethods Methods returning the sizes or a container of sizes
+/// \param[in] stridesmethod Method returning a container of strides in units of elements, may be empty
+/// \return Pointer to the jitted function, nullptr in case of failure
+ArrayInfoFunc_t MakeArrayInfoFunc(const std::string &cppname, const std::string &datamethod,
+                                  const std::vector<std::string> &shapemethods, const std::string &stridesmethod)
+{
+   static bool declared = false;
+   if (!declared) {
+      declared = gInterpreter->Declare(R"CODE(
+#include <iterator>
+#include <type_traits>
+#include <vector>
+namespace PyROOT {
+namespace Internal {
+template <typename T>
+char ArrayTypeKind()
+{
+   if (std::is_same<T, bool>::value)
+      return 'b';
+   if (std::is_floating_point<T>::value)
+      return 'f';
+   return std::is_signed<T>::value ? 'i' : 'u';
+}
+inline void AppendArrayShape(std::vector<std::size_t> &v, std::size_t n)
+{
+   v.push_back(n);
+}
+template <typename C>
+auto AppendArrayShape(std::vector<std::size_t> &v, const C &c) -> decltype(std::begin(c), void())
+{
+   v.insert(v.end(), std::begin(c), std::end(c));
+}
+} // namespace Internal
+} // namespace PyROOT
+)CODE");
+      if (!declared)
+         return nullptr;
+   }
+
+   static int counter = 0;
+   const std::string funcname = "ArrayInfo" + std::to_string(counter++);
+
+   std::stringstream code;
+   code << "namespace PyROOT {\nnamespace Internal {\n"
+        << "void " << funcname << "(void *p, void **data, char *kind, std::size_t *itemsize, "
+        << "std::vector<std::size_t> *shape, std::vector<std::size_t> *strides)\n{\n"
+        << "   auto obj = reinterpret_cast<" << cppname << " *>(p);\n"
+        << "   using Elem_t = std::remove_cv_t<std::remove_pointer_t<decltype(obj->" << datamethod << "())>>;\n"
+        << "   *data = (void *)obj->" << datamethod << "();\n"
+        << "   *kind = ArrayTypeKind<Elem_t>();\n"
+        << "   *itemsize = sizeof(Elem_t);\n";
+   for (auto &m : shapemethods)
+      code << "   AppendArrayShape(*shape, obj->" << m << "());\n";
+   if (!stridesmethod.empty())
+      code << "   AppendArrayShape(*strides, obj->" << stridesmethod << "());\n";
+   code << "   (void)strides;\n}\n} // namespace Internal\n} // namespace PyROOT\n";
+
+   if (!gInterpreter->Declare(code.str().c_str()))
+      return nullptr;
+
+   return reinterpret_cast<ArrayInfoFunc_t>(
+      gInterpreter->Calc(("reinterpret_cast<Longptr_t>(&PyROOT::Internal::" + funcname + ")").c_str()));
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Implementation of the __array_interface__ property
+/// \param[in] self Python proxy of the C++ object
+///
+/// The data pointer, shape and type are read with the function jitted for the
+/// class, so that no code is compiled when accessing the property. The returned
+/// dictionary refers directly to the memory of the C++ object, numpy adopts it
+/// without copy: the C++ object must not be resized or deleted while the numpy
+/// array is in use.
+PyObject *ArrayInterface(PyObject *self, PyObject * /* args */)
+{
+   if (!CPyCppyy::CPPInstance_Check(self)) {
+      PyErr_SetString(PyExc_TypeError, "__array_interface__ requires a C++ object");
+      return NULL;
+   }
+   auto pyobj = (CPyCppyy::CPPInstance *)self;
+   auto address = pyobj->GetObject();
+   if (!address) {
+      PyErr_SetString(PyExc_ReferenceError, "__array_interface__ of a null C++ object");
+      return NULL;
+   }
+
+   // the object may be of a class derived from the pythonized one
+   const auto klass = pyobj->ObjectIsA();
+   auto iter = gArrayInfoFuncs.find(klass);
+   ptrdiff_t offset = 0;
+   if (iter == gArrayInfoFuncs.end()) {
+      for (iter = gArrayInfoFuncs.begin(); iter != gArrayInfoFuncs.end(); ++iter)
+         if (Cppyy::IsSubtype(klass, iter->first))
+            break;
+      if (iter == gArrayInfoFuncs.end()) {
+         PyErr_SetString(PyExc_TypeError, "__array_interface__ is not available for this class");
+         return NULL;
+      }
+      offset = Cppyy::GetBaseOffset(klass, iter->first, address, 1 /* up-cast */);
+   }
+
+   void *data = nullptr;
+   char kind = 0;
+   std::size_t itemsize = 0;
+   std::vector<std::size_t> shape, strides;
+   iter->second((char *)address + offset, &data, &kind, &itemsize, &shape, &strides);
+
+#ifdef R__BYTESWAP
+   const char *endianess = "<";
+#else
+   const char *endianess = ">";
+#endif
+   const std::string typestr = (itemsize == 1 ? "|" : endianess) + std::string(1, kind) + std::to_string(itemsize);
+
+   auto pyshape = PyTuple_New(shape.size());
+   for (std::size_t i = 0; i < shape.size(); ++i)
+      PyTuple_SET_ITEM(pyshape, i, PyLong_FromSize_t(shape[i]));
+
+   auto pyinterface = PyDict_New();
+   auto pydata = Py_BuildValue("(KO)", (unsigned long long)data, Py_False);
+   auto pytypestr = CPyCppyy_PyText_FromString(typestr.c_str());
+   auto pyversion = PyInt_FromLong(3);
+   PyDict_SetItemString(pyinterface, "shape", pyshape);
+   PyDict_SetItemString(pyinterface, "typestr", pytypestr);
+   PyDict_SetItemString(pyinterface, "data", pydata);
+   PyDict_SetItemString(pyinterface, "version", pyversion);
+   Py_DECREF(pyshape);
+   Py_DECREF(pytypestr);
+   Py_DECREF(pydata);
+   Py_DECREF(pyversion);
+
+   // strides of the interface are in bytes, the C++ ones in elements
+   if (!strides.empty()) {
+      auto pystrides = PyTuple_New(strides.size());
+      for (std::size_t i = 0; i < strides.size(); ++i)
+         PyTuple_SET_ITEM(pystrides, i, PyLong_FromSize_t(strides[i] * itemsize));
+      PyDict_SetItemString(pyinterface, "strides", pystrides);
+      Py_DECREF(pystrides);
+   }
+
+   return pyinterface;
+}
+
+PyMethodDef gArrayInterfaceDef = {(char *)"__array_interface__", (PyCFunction)ArrayInterface, METH_NOARGS,
+                                  (char *)"Numpy array interface on the memory of the C++ object"};
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Add the __array_interface__ property to a class with contiguous data
+/// \param[in] self Always null, since this is a module function.
+/// \param[in] args [0] Python class to be pythonized.
+///                 [1] Method returning the pointer to the data as Python string.
+///                 [2] Tuple of methods returning the sizes of the dimensions as Python strings.
+///                     A method may also return a container of sizes.
+///                 [3] Optional method returning the strides in units of elements as Python string.
+///
+/// This function installs a property, which gives numpy direct access to the
+/// memory of the C++ object, e.g. for `ROOT::RVec` with `("data", ("size",))`,
+/// for `TH1D` with `("GetArray", ("GetNcells",))`, for `TMatrixD` with
+/// `("GetMatrixArray", ("GetNrows", "GetNcols"))` or for `RTensor` with
+/// `("GetData", ("GetShape",), "GetStrides")`. In contrast to GetDataPointer,
+/// the code accessing the data is compiled once per class and not at every
+/// access of the property.
+PyObject *PyROOT::AddArrayInterfacePyz(PyObject * /* self */, PyObject *args)
+{
+   PyObject *pyclass = nullptr, *pyshapemethods = nullptr;
+   const char *datamethod = nullptr, *stridesmethod = "";
+   if (!PyArg_ParseTuple(args, "OsO!|s", &pyclass, &datamethod, &PyTuple_Type, &pyshapemethods, &stridesmethod))
+      return NULL;
+
+   if (!CPyCppyy::CPPScope_Check(pyclass)) {
+      PyErr_SetString(PyExc_TypeError, "AddArrayInterfacePyz requires a C++ class");
+      return NULL;
+   }
+
+   std::vector<std::string> shapemethods;
+   for (Py_ssize_t i = 0; i < PyTuple_Size(pyshapemethods); ++i) {
+      auto pymethod = PyTuple_GetItem(pyshapemethods, i);
+      if (!CPyCppyy_PyText_Check(pymethod)) {
+         PyErr_SetString(PyExc_TypeError, "AddArrayInterfacePyz requires method names as strings");
+         return NULL;
+      }
+      shapemethods.emplace_back(CPyCppyy_PyText_AsString(pymethod));
+   }
+
+   const auto klass = ((CPyCppyy::CPPScope *)pyclass)->fCppType;
+   if (gArrayInfoFuncs.find(klass) == gArrayInfoFuncs.end()) {
+      auto func = MakeArrayInfoFunc(Cppyy::GetScopedFinalName(klass), datamethod, shapemethods, stridesmethod);
+      if (!func) {
+         PyErr_SetString(PyExc_RuntimeError, "Failed to compile the array interface of the class");
+         return NULL;
+      }
+      gArrayInfoFuncs[klass] = func;
+   }
+
+   auto getter = PyDescr_NewMethod((PyTypeObject *)pyclass, &gArrayInterfaceDef);
+   if (!getter)
+      return NULL;
+   auto property = PyObject_CallFunctionObjArgs((PyObject *)&PyProperty_Type, getter, NULL);
+   Py_DECREF(getter);
+   if (!property)
+      return NULL;
+   const auto res = PyObject_SetAttrString(pyclass, "__array_interface__", property);
+   Py_DECREF(property);
+   if (res)
+      return NULL;
+
+   Py_RETURN_NONE;
+}
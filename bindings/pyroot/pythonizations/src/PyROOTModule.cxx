@@ -67,6 +67,8 @@ static PyMethodDef gPyROOTMethods[] = {
     (char *)"Customize the setting of an item of a TClonesArray"},
    {(char *)"AddPrettyPrintingPyz", (PyCFunction)PyROOT::AddPrettyPrintingPyz, METH_VARARGS,
     (char *)"Add pretty printing pythonization"},
+   {(char *)"AddArrayInterfacePyz", (PyCFunction)PyROOT::AddArrayInterfacePyz, METH_VARARGS,
+    (char *)"Add the numpy array interface to a class with contiguous data"},
    {(char *)"GetEndianess", (PyCFunction)PyROOT::GetEndianess, METH_NOARGS, (char *)"Get endianess of the system"},
    {(char *)"GetDataPointer", (PyCFunction)PyROOT::GetDataPointer, METH_VARARGS,
     (char *)"Get pointer to data of a C++ object"},
@@ -76,6 +78,8 @@ static PyMethodDef gPyROOTMethods[] = {
    {(char *)"AsRTensor", (PyCFunction)PyROOT::AsRTensor, METH_O, (char *)"Get object with array interface as RTensor"},
    {(char *)"MakeNumpyDataFrame", (PyCFunction)PyROOT::MakeNumpyDataFrameImpl, METH_O,
     (char *)"Make RDataFrame from dictionary of numpy arrays"},
+   {(char *)"GetBatchCallbackAddress", (PyCFunction)PyROOT::GetBatchCallbackAddress, METH_NOARGS,
+    (char *)"Get the address of the function passing batches of RDataFrame entries to Python callables"},
 #endif
    {(char *)"InitApplication", (PyCFunction)PyROOT::RPyROOTApplication::InitApplication, METH_VARARGS,
     (char *)"Initialize interactive ROOT use from Python"},
@@ -37,6 +37,8 @@ PyObject *AddSetItemTCAPyz(PyObject *self, PyObject *args);
 
 PyObject *AddUsingToClass(PyObject *self, PyObject *args);
 
+PyObject *AddArrayInterfacePyz(PyObject *self, PyObject *args);
+
 PyObject *AsRVec(PyObject *self, PyObject *obj);
 PyObject *AsRTensor(PyObject *self, PyObject *obj);
 
@@ -47,6 +49,7 @@ PyObject *GetDataPointer(PyObject *self, PyObject *args);
 PyObject *GetSizeOfType(PyObject *self, PyObject *args);
 
 PyObject *MakeNumpyDataFrameImpl(PyObject *self, PyObject *obj);
+PyObject *GetBatchCallbackAddress(PyObject *self, PyObject *args);
 
 } // namespace PyROOT
 
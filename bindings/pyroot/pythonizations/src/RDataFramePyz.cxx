@@ -116,3 +116,77 @@ PyObject *PyROOT::MakeNumpyDataFrameImpl(PyObject * /*self*/, PyObject * pydata)
 
    return pyobj;
 }
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Invoke a Python callable with a batch of column values
+/// \param[in] userData The Python callable
+/// \param[in] slot Processing slot of the event loop
+/// \param[in] nEntries Number of entries in the batch
+/// \param[in] nColumns Number of columns
+/// \param[in] columns Pointers to the values of the columns
+/// \param[in] formats Buffer protocol formats of the columns
+///
+/// The callable is invoked as `callable(slot, col1, col2, ...)`, where the columns
+/// are read-only memoryviews on the buffers of the event loop, which can be passed
+/// to numpy without copy. They are only valid during the call. The GIL is taken
+/// once per batch, therefore the event loop must run with the GIL released.
+static bool CallPyBatchCallback(void *userData, unsigned int slot, std::size_t nEntries, std::size_t nColumns,
+                                void *const *columns, const char *const *formats)
+{
+   auto state = PyGILState_Ensure();
+
+   auto pyargs = PyTuple_New(nColumns + 1);
+   PyTuple_SET_ITEM(pyargs, 0, PyLong_FromUnsignedLong(slot));
+   for (std::size_t i = 0; i < nColumns; ++i) {
+      Py_ssize_t shape = nEntries;
+      Py_buffer view;
+      if (PyBuffer_FillInfo(&view, nullptr, columns[i], 0, 1, PyBUF_FULL_RO) != 0) {
+         PyErr_Print();
+         Py_DECREF(pyargs);
+         PyGILState_Release(state);
+         return false;
+      }
+      // PyBuffer_FillInfo describes bytes, set the item type of the column; the shape is copied by the memoryview
+      view.format = const_cast<char *>(formats[i]);
+      switch (formats[i][0]) {
+      case '?':
+      case 'b':
+      case 'B': view.itemsize = 1; break;
+      case 'h':
+      case 'H': view.itemsize = 2; break;
+      case 'i':
+      case 'I':
+      case 'f': view.itemsize = 4; break;
+      default: view.itemsize = 8;
+      }
+      view.len = nEntries * view.itemsize;
+      view.shape = &shape;
+      view.strides = &view.itemsize;
+      PyTuple_SET_ITEM(pyargs, i + 1, PyMemoryView_FromBuffer(&view));
+   }
+
+   auto callable = static_cast<PyObject *>(userData);
+   auto res = PyObject_Call(callable, pyargs, nullptr);
+   Py_DECREF(pyargs);
+
+   const bool ok = res != nullptr;
+   if (!ok)
+      PyErr_Print();
+   Py_XDECREF(res);
+
+   PyGILState_Release(state);
+   return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// \brief Get the address of the function calling Python callables with batches of entries
+/// \param[in] self Always null, since this is a module function.
+/// \param[in] args Pointer to an empty Python tuple.
+///
+/// The address is passed with the address of the Python callable as user data
+/// to ROOT::Internal::RDF::BookBatchCallback. The callable has to be kept alive
+/// by the caller until the event loop has run.
+PyObject *PyROOT::GetBatchCallbackAddress(PyObject * /*self*/, PyObject * /*args*/)
+{
+   return PyLong_FromUnsignedLongLong(reinterpret_cast<uintptr_t>(&CallPyBatchCallback));
+}
@@ -18,12 +18,14 @@
 //                                                                      //
 // A set of inline byte swapping routines for arrays.                   //
 //                                                                      //
-// The bswapcpy16() and bswapcpy32() routines are used for packing      //
-// arrays of basic types into a buffer in a byte swapped order. Use     //
-// of asm and the `bswap' opcode (available on i486 and up) reduces     //
-// byte swapping overhead on linux.                                     //
+// The bswapcpy16(), bswapcpy32() and bswapcpy64() routines are used    //
+// for packing arrays of basic types into a buffer in a byte swapped    //
+// order. The bytes of several elements are swapped at once with SIMD   //
+// shuffles (AVX2 or SSSE3 if the code is compiled for them, SSE2 on    //
+// any x86-64, NEON on ARM), the remaining elements one by one.         //
 //                                                                      //
-// Use of routines is similar to that of memcpy.                        //
+// Use of routines is similar to that of memcpy. The arrays may be      //
+// unaligned but must not overlap.                                      //
 //                                                                      //
 // ATTENTION:                                                           //
 //                                                                      //
@@ -32,50 +34,149 @@
 //                                                                      //
 // For arrays of short type (2 bytes in size) use bswapcpy16().         //
 // For arrays of of 4-byte types (int, float) use bswapcpy32().         //
+// For arrays of of 8-byte types (long long, double) use bswapcpy64().  //
 //                                                                      //
 //                                                                      //
 // Author: Alexandre V. Vaniachine <AVVaniachine@lbl.gov>               //
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
-#if !defined(__CINT__)
-#include <sys/types.h>
+#include "Byteswap.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#define R__BSWAPCPY_AVX2
+#define R__BSWAPCPY_SSSE3
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#define R__BSWAPCPY_SSSE3
+#include <tmmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define R__BSWAPCPY_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define R__BSWAPCPY_NEON
+#include <arm_neon.h>
 #endif
 
-extern inline void * bswapcpy16(void * to, const void * from, size_t n)
+namespace ROOT {
+namespace Internal {
+
+#if defined(R__BSWAPCPY_SSSE3)
+/// Shuffle mask reversing the bytes of each element of N bytes of a 16 bytes vector
+template <std::size_t N>
+inline __m128i BswapMask()
+{
+   if constexpr (N == 2)
+      return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+   else if constexpr (N == 4)
+      return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+   else
+      return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+#elif defined(R__BSWAPCPY_SSE2)
+/// Reverse the bytes of each element of N bytes of `v`: SSE2 has no byte shuffle, the 16 bit words
+/// are reordered in each element first, then the two bytes of each word are swapped
+template <std::size_t N>
+inline __m128i BswapVector(__m128i v)
 {
-int d0, d1, d2, d3;
-__asm__ __volatile__(
-        "cld\n"
-        "1:\tlodsw\n\t"
-        "rorw $8, %%ax\n\t"
-        "stosw\n\t"
-        "loop 1b\n\t"
-        :"=&c" (d0), "=&D" (d1), "=&S" (d2), "=&a" (d3)
-        :"0" (n), "1" ((long) to),"2" ((long) from)
-        :"memory");
-return (to);
+   if constexpr (N == 4) {
+      v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+      v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+   } else if constexpr (N == 8) {
+      v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+      v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+   }
+   return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
 }
+#endif
 
-extern inline void * bswapcpy32(void * to, const void * from, size_t n)
+/// Copy `n` elements of N bytes from `from` to `to`, reversing the bytes of each of them
+template <std::size_t N>
+inline void BswapCopy(void *to, const void *from, std::size_t n)
 {
-int d0, d1, d2, d3;
-__asm__ __volatile__(
-        "cld\n"
-        "1:\tlodsl\n\t"
-#if !defined __i486__ && !defined __pentium__ && !defined __pentiumpro__ && \
-    !defined __pentium4__ && !defined __x86_64__
-        "rorw $8, %%ax\n\t"
-        "rorl $16, %%eax\n\t"
-        "rorw $8, %%ax\n\t"
-#else
-        "bswap %%eax\n\t"
+   static_assert(N == 2 || N == 4 || N == 8, "Only elements of 2, 4 or 8 bytes can be byte swapped");
+   auto dst = static_cast<unsigned char *>(to);
+   auto src = static_cast<const unsigned char *>(from);
+   std::size_t i = 0;
+
+#if defined(R__BSWAPCPY_AVX2)
+   {
+      const __m256i mask = _mm256_broadcastsi128_si256(BswapMask<N>());
+      for (; i + 32 / N <= n; i += 32 / N) {
+         __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i * N));
+         _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i * N), _mm256_shuffle_epi8(v, mask));
+      }
+   }
+#endif
+#if defined(R__BSWAPCPY_SSSE3)
+   {
+      const __m128i mask = BswapMask<N>();
+      for (; i + 16 / N <= n; i += 16 / N) {
+         __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * N));
+         _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * N), _mm_shuffle_epi8(v, mask));
+      }
+   }
+#elif defined(R__BSWAPCPY_SSE2)
+   for (; i + 16 / N <= n; i += 16 / N) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * N));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * N), BswapVector<N>(v));
+   }
+#elif defined(R__BSWAPCPY_NEON)
+   for (; i + 16 / N <= n; i += 16 / N) {
+      uint8x16_t v = vld1q_u8(src + i * N);
+      if constexpr (N == 2)
+         v = vrev16q_u8(v);
+      else if constexpr (N == 4)
+         v = vrev32q_u8(v);
+      else
+         v = vrev64q_u8(v);
+      vst1q_u8(dst + i * N, v);
+   }
 #endif
-        "stosl\n\t"
-        "loop 1b\n\t"
-        :"=&c" (d0), "=&D" (d1), "=&S" (d2), "=&a" (d3)
-        :"0" (n), "1" ((long) to),"2" ((long) from)
-        :"memory");
-return (to);
+
+   for (; i < n; ++i) {
+      if constexpr (N == 2) {
+         uint16_t x;
+         memcpy(&x, src + i * N, N);
+         x = Rbswap_16(x);
+         memcpy(dst + i * N, &x, N);
+      } else if constexpr (N == 4) {
+         uint32_t x;
+         memcpy(&x, src + i * N, N);
+         x = Rbswap_32(x);
+         memcpy(dst + i * N, &x, N);
+      } else {
+         uint64_t x;
+         memcpy(&x, src + i * N, N);
+         x = Rbswap_64(x);
+         memcpy(dst + i * N, &x, N);
+      }
+   }
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+inline void *bswapcpy16(void *to, const void *from, size_t n)
+{
+   ROOT::Internal::BswapCopy<2>(to, from, n);
+   return to;
+}
+
+inline void *bswapcpy32(void *to, const void *from, size_t n)
+{
+   ROOT::Internal::BswapCopy<4>(to, from, n);
+   return to;
 }
+
+inline void *bswapcpy64(void *to, const void *from, size_t n)
+{
+   ROOT::Internal::BswapCopy<8>(to, from, n);
+   return to;
+}
+
 #endif
@@ -76,6 +76,8 @@ public:
    static void SetReAllocHooks(ReAllocFun_t func1, ReAllocCFun_t func2);
    static void SetCustomNewDelete();
    static void EnableStatistics(int size= -1, int ix= -1);
+   static void EnableObjectPool(Bool_t enable = kTRUE);
+   static Bool_t IsObjectPoolEnabled();
 
    static Bool_t HasCustomNewDelete();
 
@@ -33,8 +33,9 @@ namespace ROOT {
       */
       kFileThreadSlot      = 23,
       kPerfStatsThreadSlot = 24,
+      kVirtualPSThreadSlot = 25,
 
-      kMaxThreadSlot       = 25  // Size of the array of thread local slots in TThread
+      kMaxThreadSlot       = 26  // Size of the array of thread local slots in TThread
    };
 }
 
@@ -90,6 +90,7 @@ class TVirtualFFT: public TObject {
  protected:
    static TVirtualFFT *fgFFT;      //current transformer
    static TString      fgDefault;  //default transformer
+   static Int_t        fgNThreads; //number of threads of the transforms
 
  public:
 
@@ -120,6 +121,7 @@ class TVirtualFFT: public TObject {
    virtual void       SetPointComplex(Int_t ipoint, TComplex &c) = 0;
    virtual void       SetPointsComplex(const Double_t *re, const Double_t *im) =0;
    virtual void       Transform() = 0;
+   virtual void       TransformMany(Int_t howmany, const Double_t *in, Double_t *out);
 
    static TVirtualFFT* FFT(Int_t ndim, Int_t *n, Option_t *option);
    static TVirtualFFT* SineCosine(Int_t ndim, Int_t *n, Int_t *r2rkind, Option_t *option);
@@ -128,6 +130,8 @@ class TVirtualFFT: public TObject {
    static void         SetTransform(TVirtualFFT *fft);
    static const char*  GetDefaultFFT();
    static void         SetDefaultFFT(const char *name ="");
+   static Int_t        GetDefaultNThreads();
+   static void         SetDefaultNThreads(Int_t nthreads = 1);
 
    ClassDefOverride(TVirtualFFT, 0); //abstract interface for FFT calculations
 };
@@ -74,10 +74,14 @@ public:
    virtual void  SetType(Int_t /*type*/ = -111) { }
    virtual Int_t GetType() const { return 111; }
 
+   static TVirtualPS *&PS();
+
    ClassDefOverride(TVirtualPS,0)  //Abstract interface to a PostScript driver
 };
 
 
-R__EXTERN TVirtualPS  *gVirtualPS;
+#ifndef __CINT__
+#define gVirtualPS (TVirtualPS::PS())
+#endif
 
 #endif
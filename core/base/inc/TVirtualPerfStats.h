@@ -88,6 +88,11 @@ public:
    virtual void SetUsed(size_t bi, size_t basketNumber) = 0;
    virtual void UpdateBranchIndices(TObjArray *branches) = 0;
 
+   /// Called when a tree being written changes the basket size (in bytes) of one of its branches
+   virtual void BasketSizeEvent(TBranch * /*branch*/, Long64_t /*entry*/, Int_t /*oldSize*/, Int_t /*newSize*/) {}
+   /// Called when a tree being written changes the size (in entries) of its clusters
+   virtual void ClusterSizeEvent(TObject * /*tree*/, Long64_t /*entry*/, Long64_t /*oldSize*/, Long64_t /*newSize*/) {}
+
    static const char *EventType(EEventType type);
 
    ClassDefOverride(TVirtualPerfStats,0)  // ABC for collecting PROOF statistics
@@ -0,0 +1,275 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TObjectPool.h"
+
+#include <ROOT/RConfig.hxx>
+#include "TError.h"
+#include "TString.h"
+
+#include <cstdlib>
+
+#ifdef R__UNIX
+#include <sys/mman.h>
+#endif
+
+namespace ROOT {
+namespace Internal {
+
+namespace {
+
+#ifdef R__B64
+constexpr std::size_t kRegionSize = std::size_t(32) << 30;
+#else
+constexpr std::size_t kRegionSize = std::size_t(256) << 20;
+#endif
+
+TObjectPool *gPool = nullptr;
+
+/// Owner of the cache of the thread, which gives the cached blocks back to the pool when the thread exits
+struct ThreadCacheOwner {
+   TObjectPool::ThreadCache_t fCache;
+   ThreadCacheOwner();
+   ~ThreadCacheOwner();
+};
+
+// Trivially destructible, so that they can still be read while (and after) the thread-local objects are destroyed
+thread_local TObjectPool::ThreadCache_t *gThreadCache = nullptr;
+thread_local bool gThreadCacheDestroyed = false;
+
+ThreadCacheOwner::ThreadCacheOwner()
+{
+   gThreadCache = &fCache;
+}
+
+ThreadCacheOwner::~ThreadCacheOwner()
+{
+   gThreadCache = nullptr;
+   gThreadCacheDestroyed = true;
+   gPool->ReleaseThreadCache(fCache);
+}
+
+/// The cache of the calling thread, nullptr once the thread-local objects of the thread have been destroyed
+TObjectPool::ThreadCache_t *GetThreadCache()
+{
+   if (gThreadCache || gThreadCacheDestroyed)
+      return gThreadCache;
+   thread_local ThreadCacheOwner owner;
+   return gThreadCache;
+}
+
+std::size_t ClassOf(std::size_t size)
+{
+   return size ? (size - 1) / TObjectPool::kGranularity : 0;
+}
+
+} // anonymous namespace
+
+TObjectPool::TObjectPool(char *base, std::size_t size) : fBase(base), fSize(size)
+{
+   fSlabClass = static_cast<std::uint8_t *>(std::calloc(size / kSlabSize, 1));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reserve the range of virtual memory of the pool. Returns nullptr if this is not possible on this platform.
+/// Only one pool can be created, and it is never destroyed.
+
+TObjectPool *TObjectPool::Create()
+{
+#ifdef R__UNIX
+   if (gPool)
+      return nullptr;
+#ifdef MAP_NORESERVE
+   const int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#else
+   const int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#endif
+   void *base = mmap(nullptr, kRegionSize, PROT_READ | PROT_WRITE, flags, -1, 0);
+   if (base == MAP_FAILED) {
+      ::Warning("TObjectPool::Create", "cannot reserve %zu bytes of virtual memory, the object pool is disabled",
+                kRegionSize);
+      return nullptr;
+   }
+   gPool = new TObjectPool(static_cast<char *>(base), kRegionSize);
+   return gPool;
+#else
+   return nullptr;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Allocate a block of at least `size` bytes, `size` being at most kMaxSize. Returns nullptr if the reserved range
+/// is exhausted.
+
+void *TObjectPool::Alloc(std::size_t size)
+{
+   const std::size_t cl = ClassOf(size);
+   ThreadCache_t *cache = GetThreadCache();
+   if (!cache) {
+      // thread being destroyed: use the central list directly
+      Class_t &c = fClasses[cl];
+      std::lock_guard<std::mutex> lock(c.fMutex);
+      if (!c.fHead) {
+         // carve a new slab and keep its blocks in the central list
+         ThreadCache_t tmp;
+         if (!Refill(tmp, cl))
+            return nullptr;
+         c.fHead = tmp.fHead[cl];
+      }
+      FreeBlock_t *block = c.fHead;
+      c.fHead = block->fNext;
+      c.fNAlloc.fetch_add(1, std::memory_order_relaxed);
+      return block;
+   }
+   if (!cache->fHead[cl]) {
+      std::lock_guard<std::mutex> lock(fClasses[cl].fMutex);
+      if (!Refill(*cache, cl))
+         return nullptr;
+   }
+   FreeBlock_t *block = cache->fHead[cl];
+   cache->fHead[cl] = block->fNext;
+   --cache->fCount[cl];
+   ++cache->fNAlloc[cl];
+   return block;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give back the block `p`, which must have been allocated by the pool.
+
+void TObjectPool::Free(void *p)
+{
+   const std::size_t cl = fSlabClass[(static_cast<char *>(p) - fBase) / kSlabSize] - 1;
+   FreeBlock_t *block = static_cast<FreeBlock_t *>(p);
+   ThreadCache_t *cache = GetThreadCache();
+   if (!cache) {
+      Class_t &c = fClasses[cl];
+      std::lock_guard<std::mutex> lock(c.fMutex);
+      block->fNext = c.fHead;
+      c.fHead = block;
+      c.fNFree.fetch_add(1, std::memory_order_relaxed);
+      return;
+   }
+   block->fNext = cache->fHead[cl];
+   cache->fHead[cl] = block;
+   ++cache->fCount[cl];
+   ++cache->fNFree[cl];
+   if (cache->fCount[cl] > 2 * kBatchSize) {
+      std::lock_guard<std::mutex> lock(fClasses[cl].fMutex);
+      Drain(*cache, cl, kBatchSize);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Move up to kBatchSize blocks of class `cl` from the central list to `cache`, carving a new slab if the central
+/// list is empty. Called with the mutex of the class held. Returns false if the reserved range is exhausted.
+
+bool TObjectPool::Refill(ThreadCache_t &cache, std::size_t cl)
+{
+   Class_t &c = fClasses[cl];
+   FlushStatistics(cache, cl);
+   if (c.fHead) {
+      for (std::size_t i = 0; i < kBatchSize && c.fHead; ++i) {
+         FreeBlock_t *block = c.fHead;
+         c.fHead = block->fNext;
+         block->fNext = cache.fHead[cl];
+         cache.fHead[cl] = block;
+         ++cache.fCount[cl];
+      }
+      return true;
+   }
+
+   const std::size_t slab = fNextSlab.fetch_add(1, std::memory_order_relaxed);
+   if (slab >= fSize / kSlabSize)
+      return false;
+   fSlabClass[slab] = cl + 1;
+   ++c.fNSlabs;
+   const std::size_t blockSize = (cl + 1) * kGranularity;
+   char *start = fBase + slab * kSlabSize;
+   // chain the blocks in increasing order of address
+   for (std::size_t n = kSlabSize / blockSize; n-- > 0;) {
+      FreeBlock_t *block = reinterpret_cast<FreeBlock_t *>(start + n * blockSize);
+      block->fNext = cache.fHead[cl];
+      cache.fHead[cl] = block;
+      ++cache.fCount[cl];
+   }
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Move `n` blocks of class `cl` from `cache` to the central list. Called with the mutex of the class held.
+
+void TObjectPool::Drain(ThreadCache_t &cache, std::size_t cl, std::size_t n)
+{
+   Class_t &c = fClasses[cl];
+   FlushStatistics(cache, cl);
+   for (std::size_t i = 0; i < n && cache.fHead[cl]; ++i) {
+      FreeBlock_t *block = cache.fHead[cl];
+      cache.fHead[cl] = block->fNext;
+      --cache.fCount[cl];
+      block->fNext = c.fHead;
+      c.fHead = block;
+   }
+}
+
+void TObjectPool::FlushStatistics(ThreadCache_t &cache, std::size_t cl)
+{
+   fClasses[cl].fNAlloc.fetch_add(cache.fNAlloc[cl], std::memory_order_relaxed);
+   fClasses[cl].fNFree.fetch_add(cache.fNFree[cl], std::memory_order_relaxed);
+   cache.fNAlloc[cl] = 0;
+   cache.fNFree[cl] = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give all the blocks of `cache` back to the central lists.
+
+void TObjectPool::ReleaseThreadCache(ThreadCache_t &cache)
+{
+   for (std::size_t cl = 0; cl < kNClasses; ++cl) {
+      std::lock_guard<std::mutex> lock(fClasses[cl].fMutex);
+      Drain(cache, cl, cache.fCount[cl]);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the number of allocations and deallocations per size class. The counts of the other running threads
+/// are only included up to their last exchange with the central lists.
+
+void TObjectPool::PrintStatistics()
+{
+   if (ThreadCache_t *cache = GetThreadCache()) {
+      for (std::size_t cl = 0; cl < kNClasses; ++cl)
+         FlushStatistics(*cache, cl);
+   }
+   std::size_t nTotalSlabs = 0;
+   Printf("Object pool statistics");
+   Printf("%12s%14s%14s%14s%8s", "size", "alloc", "free", "diff", "slabs");
+   Printf("==============================================================");
+   for (std::size_t cl = 0; cl < kNClasses; ++cl) {
+      Class_t &c = fClasses[cl];
+      std::size_t nSlabs;
+      {
+         std::lock_guard<std::mutex> lock(c.fMutex);
+         nSlabs = c.fNSlabs;
+      }
+      if (!nSlabs)
+         continue;
+      nTotalSlabs += nSlabs;
+      const auto nAlloc = c.fNAlloc.load(std::memory_order_relaxed);
+      const auto nFree = c.fNFree.load(std::memory_order_relaxed);
+      Printf("%12zu%14llu%14llu%14lld%8zu", (cl + 1) * kGranularity, (unsigned long long)nAlloc,
+             (unsigned long long)nFree, (long long)(nAlloc - nFree), nSlabs);
+   }
+   Printf("--------------------------------------------------------------");
+   Printf("Memory of the slabs: %zu kB", nTotalSlabs * kSlabSize / 1024);
+   Printf("==============================================================");
+}
+
+} // namespace Internal
+} // namespace ROOT
@@ -0,0 +1,96 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TObjectPool
+#define ROOT_TObjectPool
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ Pool of memory blocks for the small objects allocated by TStorage::ObjectAlloc.
+
+ The blocks of up to kMaxSize bytes are grouped in size classes, multiples of kGranularity bytes. Each class takes
+ its blocks from slabs of kSlabSize bytes, carved out of a single range of virtual memory reserved when the pool is
+ created, so that Contains() tells from the address alone whether a block belongs to the pool. Each thread keeps a
+ cache of free blocks per class, exchanged in batches of kBatchSize with the central free lists: most allocations
+ and deallocations take no lock.
+
+ The memory of the slabs is given to the pool for good: freed blocks are reused for objects of the same class only.
+*/
+class TObjectPool {
+public:
+   static constexpr std::size_t kGranularity = 16;
+   static constexpr std::size_t kMaxSize = 512;
+   static constexpr std::size_t kNClasses = kMaxSize / kGranularity;
+   static constexpr std::size_t kSlabSize = 64 * 1024;
+   static constexpr std::size_t kBatchSize = 128;
+
+   struct FreeBlock_t {
+      FreeBlock_t *fNext;
+   };
+
+   /// Free blocks of one class and the statistics of the class
+   struct alignas(64) Class_t {
+      std::mutex fMutex;
+      FreeBlock_t *fHead = nullptr; ///< Central free list, protected by fMutex
+      std::size_t fNSlabs = 0;      ///< Slabs of the class, protected by fMutex
+      std::atomic<std::uint64_t> fNAlloc{0};
+      std::atomic<std::uint64_t> fNFree{0};
+   };
+
+   /// Free blocks cached by one thread
+   struct ThreadCache_t {
+      FreeBlock_t *fHead[kNClasses] = {};
+      std::size_t fCount[kNClasses] = {};
+      std::uint64_t fNAlloc[kNClasses] = {}; ///< Allocations not yet added to Class_t::fNAlloc
+      std::uint64_t fNFree[kNClasses] = {};  ///< Deallocations not yet added to Class_t::fNFree
+   };
+
+private:
+   char *fBase = nullptr;           ///< Start of the reserved range
+   std::size_t fSize = 0;           ///< Size of the reserved range
+   std::atomic<std::size_t> fNextSlab{0};
+   std::uint8_t *fSlabClass = nullptr; ///< Size class of each slab in use
+   Class_t fClasses[kNClasses];
+
+   TObjectPool(char *base, std::size_t size);
+
+   bool Refill(ThreadCache_t &cache, std::size_t cl);
+   void Drain(ThreadCache_t &cache, std::size_t cl, std::size_t n);
+   void FlushStatistics(ThreadCache_t &cache, std::size_t cl);
+
+public:
+   static TObjectPool *Create();
+
+   TObjectPool(const TObjectPool &) = delete;
+   TObjectPool &operator=(const TObjectPool &) = delete;
+
+   /// True if `p` was allocated by the pool
+   bool Contains(const void *p) const
+   {
+      return static_cast<const char *>(p) >= fBase && static_cast<const char *>(p) < fBase + fSize;
+   }
+
+   void *Alloc(std::size_t size);
+   void Free(void *p);
+   void ReleaseThreadCache(ThreadCache_t &cache);
+   void PrintStatistics();
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
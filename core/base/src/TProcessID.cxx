@@ -71,6 +71,22 @@ static inline ULong_t Void_Hash(const void *ptr)
    return TString::Hash(&ptr, sizeof(void*));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the table of objects still references at least one object.
+/// Only the used range of the table is scanned and the scan stops at the
+/// first live slot, contrary to TObjArray::GetEntries() which always visits
+/// the full capacity of the table.
+
+static Bool_t HasReferencedObjects(const TObjArray *objects)
+{
+   const Int_t nused = objects->GetLast() + 1; // the table has a lower bound of 0
+   for (Int_t i = 0; i < nused; ++i) {
+      if (objects->UncheckedAt(i))
+         return kTRUE;
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor.
 
@@ -168,7 +184,7 @@ UInt_t TProcessID::AssignID(TObject *obj)
       fgNumber = 0;
       for(Int_t i = 0; i < fgPIDs->GetLast()+1; ++i) {
          TProcessID *pid = (TProcessID*)fgPIDs->At(i);
-         if (pid && pid->fObjects && pid->fObjects->GetEntries() == 0) {
+         if (pid && pid->fObjects && !HasReferencedObjects(pid->fObjects)) {
             pid->Clear();
          }
       }
@@ -218,8 +234,12 @@ void TProcessID::Cleanup()
 void TProcessID::Clear(Option_t *)
 {
    if (GetUniqueID()>254 && fObjects && fgObjPIDs) {
-      // We might have many references registered in the map
-      for(Int_t i = 0; i < fObjects->GetSize(); ++i) {
+      // We might have many references registered in the map. The slots
+      // beyond GetLast() were never filled, there is no need to visit them
+      // (the table is sized geometrically and can be much larger than its
+      // used range).
+      const Int_t nused = fObjects->GetLast() + 1;
+      for(Int_t i = 0; i < nused; ++i) {
          TObject *obj = fObjects->UncheckedAt(i);
          if (obj) {
             ULong64_t hash = Void_Hash(obj);
@@ -333,8 +353,10 @@ TObject *TProcessID::GetObjectWithID(UInt_t uidd)
 {
    Int_t uid = uidd & 0xffffff;  //take only the 24 lower bits
 
-   if (!fObjects || uid >= fObjects->GetSize()) return nullptr;
-   return fObjects->UncheckedAt(uid);
+   // Load the atomic table pointer only once.
+   const TObjArray *objects = fObjects;
+   if (!objects || uid >= objects->GetSize()) return nullptr;
+   return objects->UncheckedAt(uid);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
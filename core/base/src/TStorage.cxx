@@ -28,6 +28,10 @@ occur.
 
 Set the compile option R__NOSTATS to de-activate all memory checking
 and statistics gathering in the system.
+
+Optionally, the small TObjects allocated by TObject::operator new() can
+be allocated from a pool with per-thread caches and size classes,
+instead of the system allocator: see TStorage::EnableObjectPool().
 */
 
 #include <stdlib.h>
@@ -38,6 +42,10 @@ and statistics gathering in the system.
 #include "TString.h"
 #include "TVirtualMutex.h"
 #include "TInterpreter.h"
+#include "TObjectPool.h" // Private header
+
+#include <atomic>
+#include <mutex>
 
 #if !defined(R__NOSTATS)
 #   define MEM_DEBUG
@@ -83,6 +91,11 @@ static void   **gTraceArray = nullptr;
 static Int_t    gTraceCapacity = 10, gTraceIndex = 0,
                 gMemSize = -1, gMemIndex = -1;
 
+// Created when first enabled and never destroyed, so that the objects it allocated
+// can be deleted at any time.
+static std::atomic<ROOT::Internal::TObjectPool *> gObjectPool{nullptr};
+static std::atomic<bool> gObjectPoolEnabled{false};
+
 // Used in NewDelete.cxx; set by TMapFile.
 ROOT::Internal::FreeIfTMapFile_t *ROOT::Internal::gFreeIfTMapFile = nullptr;
 void *ROOT::Internal::gMmallocDesc = nullptr; //is used and set in TMapFile
@@ -289,7 +302,11 @@ Int_t *TStorage::ReAllocInt(Int_t *ovp, size_t size, size_t oldsize)
 
 void *TStorage::ObjectAlloc(size_t sz)
 {
-   void* space =  ::operator new(sz);
+   void *space = nullptr;
+   if (sz <= ROOT::Internal::TObjectPool::kMaxSize && IsObjectPoolEnabled())
+      space = gObjectPool.load(std::memory_order_acquire)->Alloc(sz);
+   if (!space)
+      space = ::operator new(sz);
    memset(space, kObjectAllocMemValue, sz);
    return space;
 }
@@ -320,8 +337,11 @@ void *TStorage::ObjectAlloc(size_t , void *vp)
 
 void TStorage::ObjectDealloc(void *vp)
 {
-
-   ::operator delete(vp);
+   ROOT::Internal::TObjectPool *pool = gObjectPool.load(std::memory_order_acquire);
+   if (pool && pool->Contains(vp))
+      pool->Free(vp);
+   else
+      ::operator delete(vp);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -339,7 +359,11 @@ void TStorage::ObjectDealloc(void *vp, void *ptr)
 
 void TStorage::ObjectDealloc(void *vp, size_t size)
 {
-   ::operator delete(vp, size);
+   ROOT::Internal::TObjectPool *pool = gObjectPool.load(std::memory_order_acquire);
+   if (pool && pool->Contains(vp))
+      pool->Free(vp);
+   else
+      ::operator delete(vp, size);
 }
 #endif
 
@@ -369,6 +393,9 @@ void TStorage::PrintStatistics()
    // Needs to be protected by global mutex
    R__LOCKGUARD(gGlobalMutex);
 
+   if (ROOT::Internal::TObjectPool *pool = gObjectPool.load(std::memory_order_acquire))
+      pool->PrintStatistics();
+
 #if defined(MEM_DEBUG) && defined(MEM_STAT)
 
    if (!gMemStatistics || !HasCustomNewDelete())
@@ -419,6 +446,54 @@ void TStorage::EnableStatistics(int size, int ix)
 #endif
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable (or disable) the allocation of the small objects created with
+/// TObject::operator new() from a pool (see ROOT::Internal::TObjectPool).
+///
+/// The objects of up to 512 bytes are then taken from slabs of a reserved
+/// range of virtual memory, by size classes of 16 bytes, with a cache of free
+/// blocks per thread: creating and deleting many small objects, e.g. TObjString
+/// or TKey, is then faster and fragments the heap less. The memory of the pool
+/// is not given back to the system, but reused for objects of the same size
+/// class. The pool is only available on Unix platforms.
+///
+/// The pool can be enabled and disabled at any time: the objects are always
+/// given back to the allocator they come from. It is also enabled by setting
+/// the environment variable ROOT_OBJECT_POOL to a non-zero value.
+///
+/// Note that memory obtained from ObjectAlloc() must then be released with
+/// ObjectDealloc() (or by deleting the object), not with ::operator delete().
+///
+/// TStorage::PrintStatistics() prints the number of allocations per size class.
+
+void TStorage::EnableObjectPool(Bool_t enable)
+{
+   if (enable && !gObjectPool.load(std::memory_order_acquire)) {
+      static std::mutex creationMutex;
+      std::lock_guard<std::mutex> lock(creationMutex);
+      if (!gObjectPool.load(std::memory_order_relaxed))
+         gObjectPool.store(ROOT::Internal::TObjectPool::Create(), std::memory_order_release);
+   }
+   gObjectPoolEnabled = enable && gObjectPool.load(std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the small objects are allocated from the pool, see
+/// EnableObjectPool().
+
+Bool_t TStorage::IsObjectPoolEnabled()
+{
+   // the environment variable is checked at the first allocation
+   static const bool checkedEnvironment = []() {
+      const char *env = std::getenv("ROOT_OBJECT_POOL");
+      if (env && *env && strcmp(env, "0") != 0)
+         EnableObjectPool();
+      return true;
+   }();
+   (void)checkedEnvironment;
+   return gObjectPoolEnabled.load(std::memory_order_relaxed);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///return static free hook data
 
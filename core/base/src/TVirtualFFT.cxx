@@ -78,6 +78,21 @@ pointer to a sine or cosine transform with requested parameters. Example:
 }
 ~~~
 Different options are explained in the function comments
+
+Many transforms of the same size and type are computed in one call with TransformMany(),
+e.g. the transforms of the two functions of a convolution:
+~~~ {.cpp}
+{
+   Int_t N = 1024;
+   std::vector<Double_t> in(2 * N), out(2 * 2 * (N / 2 + 1));
+   TVirtualFFT *fftr2c = TVirtualFFT::FFT(1, &N, "R2C K");
+   // fill in[0..N-1] and in[N..2N-1]
+   fftr2c->TransformMany(2, in.data(), out.data());
+}
+~~~
+
+With FFTW, the transforms of the same size, type and flags share their plan, so that
+creating a transform already computed before does not plan it again.
 */
 
 #include "TROOT.h"
@@ -87,6 +102,7 @@ Different options are explained in the function comments
 
 TVirtualFFT *TVirtualFFT::fgFFT    = nullptr;
 TString      TVirtualFFT::fgDefault   = "";
+Int_t        TVirtualFFT::fgNThreads  = 1;
 
 ClassImp(TVirtualFFT);
 
@@ -99,6 +115,22 @@ TVirtualFFT::~TVirtualFFT()
       fgFFT = nullptr;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Computes `howmany` transforms of the size and type of this transform.
+///
+/// \param[in] howmany  number of transforms
+/// \param[in] in       the `howmany` inputs one after the other, each in the layout of SetPoints()
+/// \param[out] out     the `howmany` outputs one after the other, each in the layout of GetPoints()
+///
+/// The input and output arrays of the transform (SetPoints(), GetPoints()) are not used.
+/// This default implementation reports an error: the FFT libraries implement it, FFTW
+/// with a single plan for all the transforms.
+
+void TVirtualFFT::TransformMany(Int_t /*howmany*/, const Double_t * /*in*/, Double_t * /*out*/)
+{
+   Error("TransformMany", "not implemented for transforms of type %s", GetType());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Returns a pointer to the FFT of requested size and type.
 ///
@@ -381,3 +413,22 @@ void TVirtualFFT::SetDefaultFFT(const char *name)
    fgFFT = nullptr;
    fgDefault = name;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// static: return the number of threads of the transforms created from now on
+
+Int_t TVirtualFFT::GetDefaultNThreads()
+{
+   return fgNThreads;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// static: set the number of threads of the transforms created from now on.
+///
+/// Large transforms are computed faster with several threads, small ones are not.
+/// With FFTW, this needs FFTW built with threads, otherwise the transforms use one thread.
+
+void TVirtualFFT::SetDefaultNThreads(Int_t nthreads)
+{
+   fgNThreads = nthreads > 0 ? nthreads : 1;
+}
@@ -19,13 +19,27 @@ TVirtualPS is an abstract interface to Postscript, PDF, SVG. TeX etc... drivers
 #include <fstream>
 #include "strlcpy.h"
 #include "TVirtualPS.h"
-
-TVirtualPS *gVirtualPS = nullptr;
+#include "TThreadSlots.h"
 
 const Int_t  kMaxBuffer = 250;
 
 ClassImp(TVirtualPS);
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the current PostScript, PDF, SVG, TeX or image driver, the one the
+/// pads paint to while they are printed. Like gPad, it is specific to each
+/// thread once ROOT::EnableThreadSafety() was called, so that several threads
+/// can print their own canvases concurrently.
+
+TVirtualPS *&TVirtualPS::PS()
+{
+   static TVirtualPS *currentPS = nullptr;
+   if (!gThreadTsd)
+      return currentPS;
+   else
+      return *(TVirtualPS**)(*gThreadTsd)(&currentPS,ROOT::kVirtualPSThreadSlot);
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// VirtualPS default constructor.
@@ -0,0 +1,31 @@
+#include "gtest/gtest.h"
+
+#include "TNamed.h"
+#include "TProcessID.h"
+#include "TObjArray.h"
+
+#include <memory>
+#include <vector>
+
+TEST(TProcessID, ObjectTable)
+{
+   std::vector<std::unique_ptr<TNamed>> objs;
+   std::vector<UInt_t> uids;
+   for (int i = 0; i < 1000; ++i) {
+      objs.emplace_back(new TNamed("obj", "referenced"));
+      uids.push_back(TProcessID::AssignID(objs.back().get()));
+   }
+
+   TProcessID *pid = TProcessID::GetProcessWithUID(objs.front().get());
+   ASSERT_NE(nullptr, pid);
+   for (std::size_t i = 0; i < objs.size(); ++i)
+      EXPECT_EQ(objs[i].get(), pid->GetObjectWithID(uids[i]));
+
+   // Deleting a referenced object empties its slot.
+   UInt_t uid = uids[10];
+   objs[10].reset();
+   EXPECT_EQ(nullptr, pid->GetObjectWithID(uid));
+
+   // An identifier beyond the table is not an error.
+   EXPECT_EQ(nullptr, pid->GetObjectWithID(uids.back() + 1000000));
+}
@@ -0,0 +1,58 @@
+#include "gtest/gtest.h"
+
+#include "TObjString.h"
+#include "TStorage.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(TStorage, ObjectPool)
+{
+   TStorage::EnableObjectPool(kFALSE);
+   EXPECT_FALSE(TStorage::IsObjectPoolEnabled());
+   auto before = std::make_unique<TObjString>("allocated before enabling the pool");
+
+   TStorage::EnableObjectPool();
+#ifdef R__UNIX
+   EXPECT_TRUE(TStorage::IsObjectPoolEnabled());
+#endif
+
+   std::vector<std::unique_ptr<TObjString>> strings;
+   for (int i = 0; i < 10000; ++i)
+      strings.emplace_back(new TObjString(TString::Format("string %d", i)));
+   for (int i = 0; i < 10000; ++i)
+      EXPECT_EQ(strings[i]->GetString(), TString::Format("string %d", i));
+
+   // objects are given back to the allocator they come from
+   before.reset();
+   TStorage::EnableObjectPool(kFALSE);
+   EXPECT_FALSE(TStorage::IsObjectPoolEnabled());
+   strings.clear();
+   TStorage::EnableObjectPool();
+
+   // objects created and deleted in different threads
+   std::vector<TObject *> objects(4000);
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 4; ++t)
+      threads.emplace_back([&objects, t]() {
+         for (std::size_t i = t; i < objects.size(); i += 4)
+            objects[i] = new TObjString("shared");
+      });
+   for (auto &thread : threads)
+      thread.join();
+   threads.clear();
+   for (int t = 0; t < 4; ++t)
+      threads.emplace_back([&objects, t]() {
+         for (std::size_t i = (t + 1) % 4; i < objects.size(); i += 4)
+            delete objects[i];
+      });
+   for (auto &thread : threads)
+      thread.join();
+
+   // large objects are not taken from the pool
+   void *large = TStorage::ObjectAlloc(4096);
+   TStorage::ObjectDealloc(large);
+
+   TStorage::EnableObjectPool(kFALSE);
+}
@@ -202,6 +202,7 @@ private:
    bool fRequestNoInputOperator;
    bool fRequestOnlyTClass;
    int  fRequestedVersionNumber;
+   bool fRequestDirectStreamer = false;
 
 public:
    enum ERootFlag {
@@ -277,6 +278,8 @@ public:
    bool RequestNoStreamer() const { return fRequestNoStreamer; }
    bool RequestOnlyTClass() const { return fRequestOnlyTClass; }
    int  RequestedVersionNumber() const { return fRequestedVersionNumber; }
+   bool RequestDirectStreamer() const { return fRequestDirectStreamer; }
+   void SetRequestDirectStreamer(bool value) { fRequestDirectStreamer = value; }
    int  RootFlag() const {
       // Return the request (streamerInfo, has_version, etc.) combined in a single
       // int.  See RScanner::AnnotatedRecordDecl::ERootFlag.
@@ -1311,6 +1311,102 @@ bool ROOT::TMetaUtils::HasCustomConvStreamerMemberFunction(const AnnotatedRecord
 }
 
 
+namespace {
+
+struct RDirectStreamerMember {
+   std::string fName;       // Name of the data member
+   std::string fType;       // ROOT typedef of the fundamental type used to stream it
+   uint64_t fArraySize = 0; // Total number of elements if the data member is an array, 0 otherwise
+};
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the ROOT typedef used to stream the fundamental type `type`, or an empty
+/// string if it has none.
+
+static std::string GetDirectStreamerTypeName(const clang::BuiltinType &type)
+{
+   switch (type.getKind()) {
+      case clang::BuiltinType::Bool: return "Bool_t";
+      case clang::BuiltinType::Char_S:
+      case clang::BuiltinType::Char_U:
+      case clang::BuiltinType::SChar: return "Char_t";
+      case clang::BuiltinType::UChar: return "UChar_t";
+      case clang::BuiltinType::Short: return "Short_t";
+      case clang::BuiltinType::UShort: return "UShort_t";
+      case clang::BuiltinType::Int: return "Int_t";
+      case clang::BuiltinType::UInt: return "UInt_t";
+      case clang::BuiltinType::Long: return "Long_t";
+      case clang::BuiltinType::ULong: return "ULong_t";
+      case clang::BuiltinType::LongLong: return "Long64_t";
+      case clang::BuiltinType::ULongLong: return "ULong64_t";
+      case clang::BuiltinType::Float: return "Float_t";
+      case clang::BuiltinType::Double: return "Double_t";
+      default: return "";
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Collect the data members streamed by the direct streamer requested for the class.
+/// The generated function is not a member of the class and streams the data members
+/// one after the other, as the StreamerInfo actions of a class without schema evolution
+/// would: only classes without bases nor virtual functions, whose persistent data members
+/// are all public and of fundamental types or arrays thereof, are eligible.
+/// Return false, with the reason in `why`, if the class is not eligible.
+
+static bool GetDirectStreamerMembers(const ROOT::TMetaUtils::AnnotatedRecordDecl &cl,
+                                     const clang::CXXRecordDecl *decl,
+                                     const cling::Interpreter &interp,
+                                     const ROOT::TMetaUtils::TNormalizedCtxt &normCtxt,
+                                     std::vector<RDirectStreamerMember> &members,
+                                     std::string &why)
+{
+   if (decl->getNumBases() || decl->isPolymorphic()) {
+      why = "it has base classes or virtual functions";
+      return false;
+   }
+   if (cl.RequestNoStreamer() || ROOT::TMetaUtils::HasCustomStreamerMemberFunction(cl, decl, interp, normCtxt)) {
+      why = "it has no StreamerInfo based streamer";
+      return false;
+   }
+
+   const clang::ASTContext &ctxt = decl->getASTContext();
+   for (const clang::FieldDecl *field : decl->fields()) {
+      auto comment = ROOT::TMetaUtils::GetComment(*field);
+      if (!comment.empty() && comment[0] == '!')
+         continue; // transient
+
+      const std::string name = field->getNameAsString();
+      if (field->getAccess() != clang::AS_public || field->isBitField()) {
+         why = "the data member " + name + " is not public or is a bit field";
+         return false;
+      }
+
+      RDirectStreamerMember member{name, "", 0};
+      clang::QualType type = field->getType();
+      while (const clang::ConstantArrayType *arrayType = ctxt.getAsConstantArrayType(type)) {
+         member.fArraySize = (member.fArraySize ? member.fArraySize : 1) * arrayType->getSize().getZExtValue();
+         type = arrayType->getElementType();
+      }
+      const clang::BuiltinType *builtin = llvm::dyn_cast<clang::BuiltinType>(type.getCanonicalType().getTypePtr());
+      if (builtin)
+         member.fType = GetDirectStreamerTypeName(*builtin);
+      if (member.fType.empty() || type.getCanonicalType().hasQualifiers() ||
+          ROOT::TMetaUtils::hasOpaqueTypedef(type, normCtxt)) {
+         // Double32_t and Float16_t have their own on-file representation.
+         why = "the data member " + name + " is not of a fundamental type";
+         return false;
+      }
+      members.push_back(member);
+   }
+   if (members.empty()) {
+      why = "it has no persistent data member";
+      return false;
+   }
+   return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Main implementation relying on GetFullyQualifiedTypeName
 /// All other GetQualifiedName functions leverage this one except the
@@ -1757,6 +1853,16 @@ void ROOT::TMetaUtils::WriteClassInit(std::ostream& finalString,
    if (HasCustomConvStreamerMemberFunction(cl, decl, interp, normCtxt)) {
       finalString << "   static void conv_streamer_" << mappedname.c_str() << "(TBuffer &buf, void *obj, const TClass*);" << "\n";
    }
+   bool hasDirectStreamer = false;
+   if (cl.RequestDirectStreamer()) {
+      std::vector<RDirectStreamerMember> members;
+      std::string why;
+      hasDirectStreamer = GetDirectStreamerMembers(cl, decl, interp, normCtxt, members, why);
+      if (hasDirectStreamer)
+         finalString << "   static void directStreamer_" << mappedname.c_str() << "(TBuffer &buf, void *obj);" << "\n";
+      else
+         ROOT::TMetaUtils::Warning(nullptr, "No direct streamer generated for %s: %s.\n", classname.c_str(), why.c_str());
+   }
    if (HasNewMerge(decl, interp) || HasOldMerge(decl, interp)) {
       finalString << "   static Long64_t merge_" << mappedname.c_str() << "(void *obj, TCollection *coll,TFileMergeInfo *info);" << "\n";
    }
@@ -1937,6 +2043,9 @@ void ROOT::TMetaUtils::WriteClassInit(std::ostream& finalString,
       // We have a custom member function streamer or an older (not StreamerInfo based) automatic streamer.
       finalString << "      instance.SetConvStreamerFunc(&conv_streamer_" << mappedname.c_str() << ");" << "\n";
    }
+   if (hasDirectStreamer) {
+      finalString << "      instance.SetDirectStreamerFunc(&directStreamer_" << mappedname.c_str() << ");" << "\n";
+   }
    if (HasNewMerge(decl, interp) || HasOldMerge(decl, interp)) {
       finalString << "      instance.SetMerge(&merge_" << mappedname.c_str() << ");" << "\n";
    }
@@ -2441,6 +2550,31 @@ void ROOT::TMetaUtils::WriteAuxFunctions(std::ostream& finalString,
       finalString << "   // Wrapper around a custom streamer member function." << "\n" << "   static void conv_streamer_" << mappedname.c_str() << "(TBuffer &buf, void *obj, const TClass *onfile_class) {" << "\n" << "      ((" << classname.c_str() << "*)obj)->" << classname.c_str() << "::Streamer(buf,onfile_class);" << "\n" << "   }" << "\n";
    }
 
+   std::vector<RDirectStreamerMember> directMembers;
+   std::string why;
+   if (cl.RequestDirectStreamer() && GetDirectStreamerMembers(cl, decl, interp, normCtxt, directMembers, why)) {
+      finalString << "   // Streamer used instead of the StreamerInfo actions when the on-file layout is the in-memory one." << "\n"
+                  << "   static void directStreamer_" << mappedname.c_str() << "(TBuffer &buf, void *obj) {" << "\n"
+                  << "      " << classname.c_str() << " &o = *static_cast<" << classname.c_str() << "*>(obj);" << "\n"
+                  << "      if (buf.IsReading()) {" << "\n";
+      for (const auto &member : directMembers) {
+         if (member.fArraySize)
+            finalString << "         buf.ReadFastArray(reinterpret_cast<" << member.fType << "*>(o." << member.fName << "), "
+                        << member.fArraySize << ");" << "\n";
+         else
+            finalString << "         buf >> reinterpret_cast<" << member.fType << "&>(o." << member.fName << ");" << "\n";
+      }
+      finalString << "      } else {" << "\n";
+      for (const auto &member : directMembers) {
+         if (member.fArraySize)
+            finalString << "         buf.WriteFastArray(reinterpret_cast<const " << member.fType << "*>(o." << member.fName
+                        << "), " << member.fArraySize << ");" << "\n";
+         else
+            finalString << "         buf << static_cast<" << member.fType << ">(o." << member.fName << ");" << "\n";
+      }
+      finalString << "      }" << "\n" << "   }" << "\n";
+   }
+
    if (HasNewMerge(decl, interp)) {
       finalString << "   // Wrapper around the merge function." << "\n" << "   static Long64_t merge_" << mappedname.c_str() << "(void *obj,TCollection *coll,TFileMergeInfo *info) {" << "\n" << "      return ((" << classname.c_str() << "*)obj)->Merge(coll,info);" << "\n" << "   }" << "\n";
    } else if (HasOldMerge(decl, interp)) {
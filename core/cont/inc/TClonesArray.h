@@ -32,6 +32,17 @@ protected:
    TClass       *fClass;       //!Pointer to the class of the elements
    TObjArray    *fKeep;        //!Saved copies of pointers to objects
 
+private:
+   char         *fArena = nullptr;     //!Contiguous storage for the objects, see ReserveContiguous()
+   Int_t         fArenaSize = 0;       //!Number of objects fitting in fArena
+   Int_t         fArenaNext = 0;       //!Number of objects of fArena handed out so far
+   void         *fArenaFree = nullptr; //!List of the released objects of fArena
+
+   Bool_t           IsInArena(const TObject *obj) const;
+   void            *AllocArenaObject();
+   TObject         *NewObject();
+   void             ReleaseObject(TObject *obj);
+
 public:
    enum EStatusBits {
       kBypassStreamer = BIT(12),  // Class Streamer not called (default)
@@ -66,6 +77,7 @@ public:
    TObject         *ConstructedAt(Int_t idx, Option_t *clear_options);
    void             SetClass(const char *classname,Int_t size=1000);
    void             SetClass(const TClass *cl,Int_t size=1000);
+   void             ReserveContiguous(Int_t n);
 
    void             AbsorbObjects(TClonesArray *tc);
    void             AbsorbObjects(TClonesArray *tc, Int_t idx1, Int_t idx2);
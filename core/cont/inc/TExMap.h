@@ -20,7 +20,8 @@
 // This class stores a (key,value) pair using an external hash.         //
 // The (key,value) are Long64_t's and therefore can contain object      //
 // pointers or any longs. The map uses an open addressing hashing       //
-// method (linear probing).                                             //
+// method (linear probing), with a one byte tag per slot to compare     //
+// a group of slots at once.                                            //
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
@@ -47,13 +48,20 @@ private:
       void       Clear() { fHash = 0x0; }
    };
 
+   static constexpr Int_t kGroupSize = 16; // number of slots probed at once
+
    Assoc_t    *fTable;
+   UChar_t    *fTags;  //! Tag of each slot (0 if empty), followed by a copy of the kGroupSize-1 first ones
    Int_t       fSize;
    Int_t       fTally;
 
    Bool_t      HighWaterMark() { return (Bool_t) (fTally >= ((3*fSize)/4)); }
    Int_t       FindElement(ULong64_t hash, Long64_t key);
+   Int_t       ProbeGroups(Int_t slot, UChar_t tag, Long64_t key) const;
    void        FixCollisions(Int_t index);
+   void        SetTag(Int_t slot, UChar_t tag);
+   void        SetSlot(Int_t slot, ULong64_t hash, Long64_t key, Long64_t value);
+   void        ClearSlot(Int_t slot);
 
 
 public:
@@ -121,6 +121,17 @@ When investigating misuse of TClonesArray, please make sure of the following:
      TClonesArrays are not destroyed and created on every event. They
      must only be constructed/destructed at the beginning/end of the
      run.
+
+### Contiguous storage
+
+By default every object of the array is allocated separately.
+ReserveContiguous(n) allocates a single block for n objects instead, and
+the objects created in new slots are placed in that block, one after the
+other. Looping over the objects, for instance when reading or writing
+them member-wise, then walks through memory linearly. Once the block is
+full, further objects are allocated separately as usual.
+The objects in the block cannot be moved to another TClonesArray with
+AbsorbObjects().
 */
 
 #include "TClonesArray.h"
@@ -166,11 +177,72 @@ static inline void R__ReleaseMemory(TClass *cl, TObject *obj)
       if (TObject::GetObjectStat() && gObjectTable) {
          gObjectTable->RemoveQuietly(obj);
       }
-      ::operator delete(obj);
+      TStorage::ObjectDealloc(obj);
    }
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Whether the memory of obj belongs to the contiguous storage of this array.
+
+Bool_t TClonesArray::IsInArena(const TObject *obj) const
+{
+   if (!fArena || !obj)
+      return kFALSE;
+   const char *addr = reinterpret_cast<const char *>(obj);
+   return addr >= fArena && addr < fArena + (size_t)fArenaSize * fClass->Size();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return zeroed memory for one object from the contiguous storage, or
+/// nullptr if there is no contiguous storage or it is full.
+
+void *TClonesArray::AllocArenaObject()
+{
+   void *space = nullptr;
+   if (fArenaFree) {
+      space = fArenaFree;
+      fArenaFree = *static_cast<void **>(space);
+   } else if (fArenaNext < fArenaSize) {
+      space = fArena + (size_t)fArenaNext * fClass->Size();
+      fArenaNext++;
+   } else {
+      return nullptr;
+   }
+   // not filled by TStorage::ObjectAlloc: the object is not marked as being on
+   // the heap, as it cannot be deleted individually
+   memset(space, 0, fClass->Size());
+   return space;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a new object with the default constructor, in the contiguous
+/// storage if possible.
+
+TObject *TClonesArray::NewObject()
+{
+   void *space = AllocArenaObject();
+   return space ? (TObject *)fClass->New(space) : (TObject *)fClass->New();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destruct obj if needed and release its memory.
+
+void TClonesArray::ReleaseObject(TObject *obj)
+{
+   if (!IsInArena(obj)) {
+      R__ReleaseMemory(fClass, obj);
+      return;
+   }
+   if (!obj->IsDestructed()) {
+      fClass->Destructor(obj, kTRUE);
+   } else if (TObject::GetObjectStat() && gObjectTable) {
+      gObjectTable->RemoveQuietly(obj);
+   }
+   *reinterpret_cast<void **>(obj) = fArenaFree;
+   fArenaFree = obj;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default Constructor.
 
@@ -247,7 +319,7 @@ TClonesArray& TClonesArray::operator=(const TClonesArray& tc)
 
    for (i = 0; i < fSize; i++)
       if (fKeep->fCont[i]) {
-         R__ReleaseMemory(fClass,fKeep->fCont[i]);
+         ReleaseObject(fKeep->fCont[i]);
          fKeep->fCont[i] = nullptr;
          fCont[i] = nullptr;
       }
@@ -271,11 +343,12 @@ TClonesArray::~TClonesArray()
 {
    if (fKeep) {
       for (Int_t i = 0; i < fKeep->fSize; i++) {
-         R__ReleaseMemory(fClass,fKeep->fCont[i]);
+         ReleaseObject(fKeep->fCont[i]);
          fKeep->fCont[i] = nullptr;
       }
    }
    SafeDelete(fKeep);
+   ::operator delete(fArena);
 
    // Protect against erroneously setting of owner bit
    SetOwner(kFALSE);
@@ -482,7 +555,7 @@ void TClonesArray::Expand(Int_t newSize)
       // Expand() will shrink correctly
       for (int i = newSize; i < fSize; i++)
          if (fKeep->fCont[i]) {
-            R__ReleaseMemory(fClass,fKeep->fCont[i]);
+            ReleaseObject(fKeep->fCont[i]);
             fKeep->fCont[i] = nullptr;
          }
    }
@@ -515,7 +588,7 @@ void TClonesArray::ExpandCreate(Int_t n)
    Int_t i;
    for (i = 0; i < n; i++) {
       if (!fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
+         fKeep->fCont[i] = NewObject();
       } else if (fKeep->fCont[i]->IsDestructed()) {
          // The object has been deleted (or never initialized)
          fClass->New(fKeep->fCont[i]);
@@ -525,7 +598,7 @@ void TClonesArray::ExpandCreate(Int_t n)
 
    for (i = n; i < fSize; i++)
       if (fKeep->fCont[i]) {
-         R__ReleaseMemory(fClass,fKeep->fCont[i]);
+         ReleaseObject(fKeep->fCont[i]);
          fKeep->fCont[i] = nullptr;
          fCont[i] = nullptr;
       }
@@ -552,7 +625,7 @@ void TClonesArray::ExpandCreateFast(Int_t n)
    Int_t i;
    for (i = 0; i < n; i++) {
       if (i >= oldSize || !fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
+         fKeep->fCont[i] = NewObject();
       } else if (fKeep->fCont[i]->IsDestructed()) {
          // The object has been deleted (or never initialized)
          fClass->New(fKeep->fCont[i]);
@@ -684,6 +757,30 @@ void TClonesArray::SetClass(const TClass *cl, Int_t s)
    BypassStreamer(kTRUE);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Allocate a single block of memory for n objects. The objects created in
+/// new slots of the array are then placed one after the other in this block,
+/// until it is full. Can be called only once, after the class of the array
+/// has been set.
+
+void TClonesArray::ReserveContiguous(Int_t n)
+{
+   if (!fClass || !fKeep) {
+      Error("ReserveContiguous", "invalid class specified in TClonesArray ctor");
+      return;
+   }
+   if (fArena) {
+      Error("ReserveContiguous", "contiguous storage is already reserved");
+      return;
+   }
+   if (n <= 0)
+      return;
+   fArena = static_cast<char *>(::operator new((size_t)n * fClass->Size()));
+   fArenaSize = n;
+   fArenaNext = 0;
+   fArenaFree = nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///see TClonesArray::SetClass(const TClass*)
 
@@ -800,7 +897,7 @@ void TClonesArray::Streamer(TBuffer &b)
       if (CanBypassStreamer() && !b.TestBit(TBuffer::kCannotHandleMemberWiseStreaming)) {
          for (Int_t i = 0; i < nobjects; i++) {
             if (!fKeep->fCont[i]) {
-               fKeep->fCont[i] = (TObject*)fClass->New();
+               fKeep->fCont[i] = NewObject();
             } else if (fKeep->fCont[i]->IsDestructed()) {
                // The object has been deleted (or never initialized)
                fClass->New(fKeep->fCont[i]);
@@ -835,7 +932,7 @@ void TClonesArray::Streamer(TBuffer &b)
             b >> nch;
             if (nch) {
                if (!fKeep->fCont[i])
-                  fKeep->fCont[i] = (TObject*)fClass->New();
+                  fKeep->fCont[i] = NewObject();
                else if (fKeep->fCont[i]->IsDestructed()) {
                   // The object has been deleted (or never initialized)
                   fClass->New(fKeep->fCont[i]);
@@ -919,14 +1016,19 @@ TObject *&TClonesArray::operator[](Int_t idx)
       Expand(TMath::Max(idx+1, GrowBy(fSize)));
 
    if (!fKeep->fCont[idx]) {
-      fKeep->fCont[idx] = (TObject*) TStorage::ObjectAlloc(fClass->Size());
-      // Reset the bit so that:
-      //    obj = myClonesArray[i];
-      //    ! obj->IsDestructed()
-      // will behave correctly.
-      // TObject::kNotDeleted is one of the higher bit that is not settable via the public
-      // interface. But luckily we are its friend.
-      fKeep->fCont[idx]->fBits &= ~kNotDeleted;
+      if (void *space = AllocArenaObject()) {
+         // zeroed memory, IsDestructed() is already true
+         fKeep->fCont[idx] = (TObject*) space;
+      } else {
+         fKeep->fCont[idx] = (TObject*) TStorage::ObjectAlloc(fClass->Size());
+         // Reset the bit so that:
+         //    obj = myClonesArray[i];
+         //    ! obj->IsDestructed()
+         // will behave correctly.
+         // TObject::kNotDeleted is one of the higher bit that is not settable via the public
+         // interface. But luckily we are its friend.
+         fKeep->fCont[idx]->fBits &= ~kNotDeleted;
+      }
    }
    fCont[idx] = fKeep->fCont[idx];
 
@@ -998,6 +1100,10 @@ void TClonesArray::AbsorbObjects(TClonesArray *tc, Int_t idx1, Int_t idx2)
       Error("AbsorbObjects", "cannot absorb objects when classes are different");
       return;
    }
+   if (tc->fArena) {
+      Error("AbsorbObjects", "cannot absorb objects from a TClonesArray with contiguous storage");
+      return;
+   }
 
    if (idx1 > idx2) {
       Error("AbsorbObjects", "range is not valid: idx1>idx2");
@@ -1022,7 +1128,7 @@ void TClonesArray::AbsorbObjects(TClonesArray *tc, Int_t idx1, Int_t idx2)
    for (Int_t i = idx1; i <= idx2; i++) {
       Int_t newindex = oldSize+i -idx1;
       fCont[newindex] = tc->fCont[i];
-      R__ReleaseMemory(fClass,fKeep->fCont[newindex]);
+      ReleaseObject(fKeep->fCont[newindex]);
       (*fKeep)[newindex] = (*(tc->fKeep))[i];
       tc->fCont[i] = nullptr;
       (*(tc->fKeep))[i] = nullptr;
@@ -15,6 +15,12 @@ This class stores a (key,value) pair using an external hash.
 The (key,value) are Long64_t's and therefore can contain object
 pointers or any longs. The map uses an open addressing hashing
 method (linear probing).
+
+Besides the table of entries, the map keeps a tag of one byte per slot,
+made of bits of the hash of the entry: the lookups compare the tags of
+16 consecutive slots at once (with SSE2 instructions when available) and
+only read the entries whose tag matches, so that most lookups touch a
+single cache line of tags and the entry searched for.
 */
 
 #include "TExMap.h"
@@ -23,9 +29,68 @@ method (linear probing).
 #include "TMathBase.h"
 #include <string.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 
 ClassImp(TExMap);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Tag of the slots holding an entry (never 0, the tag of the empty slots),
+/// taken from the upper bits of the mixed hash since the lower ones mostly
+/// select the slot.
+
+inline UChar_t HashTag(ULong64_t hash)
+{
+   return UChar_t(0x80 | ((hash * 0x9E3779B97F4A7C15ull) >> 57));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the bit i of `match` if tags[i] == tag and the bit i of `empty` if
+/// tags[i] == 0, for the 16 tags starting at `tags` (the bits after the
+/// first empty slot may be missing).
+
+inline void MatchGroup(const UChar_t *tags, UChar_t tag, UInt_t &match, UInt_t &empty)
+{
+#ifdef __SSE2__
+   const __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i *>(tags));
+   match = _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(char(tag))));
+   empty = _mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_setzero_si128()));
+#else
+   // only the slots up to the first empty one matter
+   match = empty = 0;
+   for (UInt_t i = 0; i < 16; ++i) {
+      if (tags[i] == 0) {
+         empty = 1u << i;
+         break;
+      }
+      match |= UInt_t(tags[i] == tag) << i;
+   }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Index of the lowest bit set in `mask`, which must not be 0.
+
+inline Int_t LowestBit(UInt_t mask)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_ctz(mask);
+#else
+   Int_t i = 0;
+   while (!(mask & 1)) {
+      mask >>= 1;
+      ++i;
+   }
+   return i;
+#endif
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create a TExMap.
 
@@ -42,8 +107,10 @@ TExMap::TExMap(Int_t mapSize)
          fSize  = (Int_t)TMath::NextPrime(mapSize);
    }
    fTable = new Assoc_t [fSize];
+   fTags = new UChar_t [fSize + kGroupSize - 1];
 
    memset(fTable,0,sizeof(Assoc_t)*fSize);
+   memset(fTags, 0, fSize + kGroupSize - 1);
    fTally = 0;
 }
 
@@ -55,7 +122,9 @@ TExMap::TExMap(const TExMap &map) : TObject(map)
    fSize  = map.fSize;
    fTally = map.fTally;
    fTable = new Assoc_t [fSize];
+   fTags = new UChar_t [fSize + kGroupSize - 1];
    memcpy(fTable, map.fTable, fSize*sizeof(Assoc_t));
+   memcpy(fTags, map.fTags, fSize + kGroupSize - 1);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -68,8 +137,11 @@ TExMap& TExMap::operator=(const TExMap &map)
       fSize  = map.fSize;
       fTally = map.fTally;
       delete [] fTable;
+      delete [] fTags;
       fTable = new Assoc_t [fSize];
+      fTags = new UChar_t [fSize + kGroupSize - 1];
       memcpy(fTable, map.fTable, fSize*sizeof(Assoc_t));
+      memcpy(fTags, map.fTags, fSize + kGroupSize - 1);
    }
    return *this;
 }
@@ -80,6 +152,62 @@ TExMap& TExMap::operator=(const TExMap &map)
 TExMap::~TExMap()
 {
    delete [] fTable; fTable = nullptr;
+   delete [] fTags; fTags = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find an entry with specified hash and key in the TExMap.
+/// Returns the slot of the key or the next empty slot.
+
+inline Int_t TExMap::FindElement(ULong64_t hash, Long64_t key)
+{
+   if (!fTable) return 0;
+
+   hash |= 0x1;
+   const UChar_t tag = HashTag(hash);
+   const Int_t slot = Int_t(hash % fSize);
+   // most lookups end at the first slot
+   if (fTags[slot] == 0 || (fTags[slot] == tag && key == fTable[slot].fKey))
+      return slot;
+   return ProbeGroups(slot, tag, key);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the entry with the given tag and key, or the next empty slot, from
+/// `slot` on.
+///
+/// The slots are probed in the order of linear probing, kGroupSize at a time:
+/// the tags of a group are compared at once with the tag of the hash and with
+/// the empty tag, and only the entries with the same tag are read.
+
+Int_t TExMap::ProbeGroups(Int_t slot, UChar_t tag, Long64_t key) const
+{
+   for (Int_t probed = 0; probed < fSize; probed += kGroupSize) {
+      UInt_t match, empty;
+      MatchGroup(fTags + slot, tag, match, empty);
+      // the probe sequence ends at the first empty slot
+      if (empty)
+         match &= (empty & (0u - empty)) - 1;
+      for (; match; match &= match - 1) {
+         Int_t i = slot + LowestBit(match);
+         while (i >= fSize)
+            i -= fSize;
+         if (key == fTable[i].fKey)
+            return i;
+      }
+      if (empty) {
+         Int_t i = slot + LowestBit(empty);
+         while (i >= fSize)
+            i -= fSize;
+         return i;
+      }
+      slot += kGroupSize;
+      while (slot >= fSize)
+         slot -= fSize;
+   }
+
+   Error("FindElement", "table full");
+   return 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -91,9 +219,7 @@ void TExMap::Add(ULong64_t hash, Long64_t key, Long64_t value)
 
    Int_t slot = FindElement(hash, key);
    if (!fTable[slot].InUse()) {
-      fTable[slot].SetHash(hash);
-      fTable[slot].fKey = key;
-      fTable[slot].fValue = value;
+      SetSlot(slot, hash, key, value);
       fTally++;
       if (HighWaterMark())
          Expand(2 * fSize);
@@ -119,9 +245,7 @@ void TExMap::AddAt(UInt_t slot, ULong64_t hash, Long64_t key, Long64_t value)
    if (!fTable) return;
 
    if (!fTable[slot].InUse()) {
-      fTable[slot].SetHash(hash);
-      fTable[slot].fKey = key;
-      fTable[slot].fValue = value;
+      SetSlot(slot, hash, key, value);
       fTally++;
       if (HighWaterMark())
          Expand(2 * fSize);
@@ -146,9 +270,7 @@ Long64_t &TExMap::operator()(ULong64_t hash, Long64_t key)
 
    Int_t slot = FindElement(hash, key);
    if (!fTable[slot].InUse()) {
-      fTable[slot].SetHash(hash);
-      fTable[slot].fKey = key;
-      fTable[slot].fValue = 0;
+      SetSlot(slot, hash, key, 0);
       fTally++;
       if (HighWaterMark()) {
          Expand(2 * fSize);
@@ -164,6 +286,7 @@ Long64_t &TExMap::operator()(ULong64_t hash, Long64_t key)
 void TExMap::Delete(Option_t *)
 {
    memset(fTable,0,sizeof(Assoc_t)*fSize);
+   memset(fTags, 0, fSize + kGroupSize - 1);
    fTally = 0;
 }
 
@@ -175,17 +298,8 @@ Long64_t TExMap::GetValue(ULong64_t hash, Long64_t key)
 {
    if (!fTable) return 0;
 
-   hash |= 0x1;
-   Int_t slot = Int_t(hash % fSize);
-   Int_t firstSlot = slot;
-   do {
-      if (!fTable[slot].InUse()) return 0;
-      if (key == fTable[slot].fKey) return fTable[slot].fValue;
-      if (++slot == fSize) slot = 0;
-   } while (firstSlot != slot);
-
-   Error("GetValue", "table full");
-   return 0;
+   const Int_t slot = FindElement(hash, key);
+   return fTable[slot].InUse() ? fTable[slot].fValue : 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -198,17 +312,8 @@ Long64_t TExMap::GetValue(ULong64_t hash, Long64_t key, UInt_t &slot)
 {
    if (!fTable) { slot = 0; return 0; }
 
-   hash |= 0x1;
-   slot = Int_t(hash % fSize);
-   UInt_t firstSlot = slot;
-   do {
-      if (!fTable[slot].InUse()) return 0;
-      if (key == fTable[slot].fKey) return fTable[slot].fValue;
-      if (++slot == (UInt_t)fSize) slot = 0;
-   } while (firstSlot != slot);
-
-   Error("GetValue", "table full");
-   return 0;
+   slot = FindElement(hash, key);
+   return fTable[slot].InUse() ? fTable[slot].fValue : 0;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -225,30 +330,41 @@ void TExMap::Remove(ULong64_t hash, Long64_t key)
       return;
    }
 
-   fTable[i].Clear();
+   ClearSlot(i);
    FixCollisions(i);
    fTally--;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Find an entry with specified hash and key in the TExMap.
-/// Returns the slot of the key or the next empty slot.
+/// Set the tag of a slot, and of its copies after the end of the table.
 
-Int_t TExMap::FindElement(ULong64_t hash, Long64_t key)
+void TExMap::SetTag(Int_t slot, UChar_t tag)
 {
-   if (!fTable) return 0;
+   fTags[slot] = tag;
+   if (slot < kGroupSize - 1) {
+      for (Int_t i = slot + fSize; i < fSize + kGroupSize - 1; i += fSize)
+         fTags[i] = tag;
+   }
+}
 
-   hash |= 0x1;
-   Int_t slot = Int_t(hash % fSize);
-   Int_t firstSlot = slot;
-   do {
-      if (!fTable[slot].InUse()) return slot;
-      if (key == fTable[slot].fKey) return slot;
-      if (++slot == fSize) slot = 0;
-   } while (firstSlot != slot);
+////////////////////////////////////////////////////////////////////////////////
+/// Store an entry in a slot.
 
-   Error("FindElement", "table full");
-   return 0;
+void TExMap::SetSlot(Int_t slot, ULong64_t hash, Long64_t key, Long64_t value)
+{
+   fTable[slot].SetHash(hash);
+   fTable[slot].fKey = key;
+   fTable[slot].fValue = value;
+   SetTag(slot, HashTag(fTable[slot].GetHash()));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Mark a slot as empty.
+
+void TExMap::ClearSlot(Int_t slot)
+{
+   fTable[slot].Clear();
+   SetTag(slot, 0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -267,8 +383,8 @@ void TExMap::FixCollisions(Int_t index)
          break;
       nextIndex = FindElement(nextObject.GetHash(), nextObject.fKey);
       if (nextIndex != oldIndex) {
-         fTable[nextIndex] = nextObject;
-         fTable[oldIndex].Clear();
+         SetSlot(nextIndex, nextObject.GetHash(), nextObject.fKey, nextObject.fValue);
+         ClearSlot(oldIndex);
       }
    }
 }
@@ -287,13 +403,16 @@ void TExMap::Expand(Int_t newSize)
    for (i = newSize; --i >= 0;) {
       fTable[i].Clear();
    }
+   delete [] fTags;
+   fTags = new UChar_t [newSize + kGroupSize - 1];
+   memset(fTags, 0, newSize + kGroupSize - 1);
 
    fSize = newSize;
    for (i = 0; i < oldsize; i++)
       if (oldTable[i].InUse()) {
          Int_t slot = FindElement(oldTable[i].GetHash(), oldTable[i].fKey);
          if (!fTable[slot].InUse())
-            fTable[slot] = oldTable[i];
+            SetSlot(slot, oldTable[i].GetHash(), oldTable[i].fKey, oldTable[i].fValue);
          else
             Error("Expand", "slot %d not empty (should never happen)", slot);
       }
@@ -326,10 +445,7 @@ void TExMap::Streamer(TBuffer &b)
             b >> hash;
             b >> key;
             b >> value;
-            Assoc_t *assoc = fTable + slot;
-            assoc->SetHash(hash);
-            assoc->fKey = key;
-            assoc->fValue = value;
+            SetSlot(slot, hash, key, value);
          }
          fTally = tally;
       } else if (R__v >= 2) {
@@ -346,10 +462,7 @@ void TExMap::Streamer(TBuffer &b)
             b >> hash;
             b >> key;
             b >> value;
-            Assoc_t* assoc = fTable + slot;
-            assoc->SetHash(hash);
-            assoc->fKey = key;
-            assoc->fValue = value;
+            SetSlot(slot, hash, key, value);
          }
          fTally = tally;
       } else {
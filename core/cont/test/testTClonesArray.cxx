@@ -0,0 +1,46 @@
+#include "TClonesArray.h"
+#include "TNamed.h"
+
+#include "gtest/gtest.h"
+
+TEST(TClonesArray, ContiguousStorage)
+{
+   TClonesArray arr("TNamed", 10);
+   arr.ReserveContiguous(8);
+
+   for (int i = 0; i < 10; ++i)
+      new (arr[i]) TNamed(TString::Format("n%d", i).Data(), "");
+   ASSERT_EQ(arr.GetEntriesFast(), 10);
+   for (int i = 1; i < 8; ++i) {
+      const char *prev = reinterpret_cast<const char *>(arr.UncheckedAt(i - 1));
+      EXPECT_EQ(reinterpret_cast<const char *>(arr.UncheckedAt(i)), prev + sizeof(TNamed));
+   }
+   EXPECT_STREQ(arr.At(9)->GetName(), "n9");
+   EXPECT_FALSE(arr.At(0)->IsOnHeap());
+
+   // reuse after clear keeps the same memory
+   TObject *first = arr.UncheckedAt(0);
+   arr.Clear("C");
+   auto named = static_cast<TNamed *>(arr.ConstructedAt(0));
+   EXPECT_EQ(named, first);
+
+   // shrinking releases the objects, which are then reused for new slots
+   arr.ExpandCreate(2);
+   EXPECT_EQ(arr.GetEntriesFast(), 2);
+   arr.ExpandCreate(8);
+   for (int i = 0; i < 8; ++i) {
+      ASSERT_NE(arr.UncheckedAt(i), nullptr);
+      EXPECT_FALSE(arr.UncheckedAt(i)->IsDestructed());
+   }
+}
+
+TEST(TClonesArray, AbsorbFromContiguousStorage)
+{
+   TClonesArray src("TNamed", 4);
+   src.ReserveContiguous(4);
+   new (src[0]) TNamed("a", "");
+   TClonesArray dst("TNamed", 4);
+   dst.AbsorbObjects(&src);
+   EXPECT_EQ(dst.GetEntriesFast(), 0);
+   EXPECT_EQ(src.GetEntriesFast(), 1);
+}
@@ -0,0 +1,78 @@
+#include "gtest/gtest.h"
+
+#include "TExMap.h"
+
+#include <map>
+#include <random>
+
+// Compare the map with a std::map under random insertions, lookups and removals
+TEST(TExMap, RandomOperations)
+{
+   std::mt19937_64 rng(42);
+   for (Int_t size : {5, 7, 100, 503}) {
+      TExMap map(size);
+      std::map<Long64_t, Long64_t> ref;
+      for (int i = 0; i < 50000; ++i) {
+         const Long64_t key = rng() % 3000;
+         // a poor hash, to get collisions
+         const ULong64_t hash = key * 7;
+         const auto found = ref.find(key);
+         switch (rng() % 3) {
+         case 0:
+            if (found == ref.end()) {
+               map.Add(hash, key, key + 1);
+               ref[key] = key + 1;
+            }
+            break;
+         case 1:
+            if (found != ref.end()) {
+               map.Remove(hash, key);
+               ref.erase(found);
+            }
+            break;
+         default: EXPECT_EQ(map.GetValue(hash, key), found == ref.end() ? 0 : found->second);
+         }
+         ASSERT_EQ(map.GetSize(), (Int_t)ref.size());
+      }
+
+      TExMapIter iter(&map);
+      Long64_t key, value;
+      std::size_t n = 0;
+      while (iter.Next(key, value)) {
+         EXPECT_EQ(ref[key], value);
+         ++n;
+      }
+      EXPECT_EQ(n, ref.size());
+
+      const TExMap copy(map);
+      for (auto &entry : ref)
+         EXPECT_EQ(const_cast<TExMap &>(copy).GetValue(entry.first * 7, entry.first), entry.second);
+   }
+}
+
+// The slot returned by GetValue is the one used by AddAt, as in TBufferFile::WriteObjectClass
+TEST(TExMap, AddAtSlot)
+{
+   TExMap map;
+   for (Long64_t key = 1; key <= 1000; ++key) {
+      UInt_t slot;
+      const ULong64_t hash = key * 0x9E3779B97F4A7C15ull;
+      EXPECT_EQ(map.GetValue(hash, key, slot), 0);
+      const Int_t capacity = map.Capacity();
+      map.AddAt(slot, hash, key, 2 * key);
+      if (capacity == map.Capacity()) {
+         UInt_t slot2;
+         EXPECT_EQ(map.GetValue(hash, key, slot2), 2 * key);
+         EXPECT_EQ(slot2, slot);
+      }
+   }
+   for (Long64_t key = 1; key <= 1000; ++key)
+      EXPECT_EQ(map.GetValue(key * 0x9E3779B97F4A7C15ull, key), 2 * key);
+
+   map.Delete();
+   EXPECT_EQ(map.GetSize(), 0);
+   EXPECT_EQ(map.GetValue(0x9E3779B97F4A7C15ull, 1), 0);
+
+   map(3) = 5;
+   EXPECT_EQ(map.GetValue(3), 5);
+}
@@ -157,6 +157,11 @@ void ClassSelectionRule::SetRequestedVersionNumber(int version)
    fRequestedVersionNumber = version;
 }
 
+void ClassSelectionRule::SetRequestDirectStreamer(bool value)
+{
+   fRequestDirectStreamer = value;
+}
+
 bool ClassSelectionRule::RequestOnlyTClass() const
 {
    return fRequestOnlyTClass;
@@ -176,3 +181,8 @@ int ClassSelectionRule::RequestedVersionNumber() const
 {
    return fRequestedVersionNumber;
 }
+
+bool ClassSelectionRule::RequestDirectStreamer() const
+{
+   return fRequestDirectStreamer;
+}
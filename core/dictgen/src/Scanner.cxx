@@ -575,6 +575,7 @@ int RScanner::AddAnnotatedRecordDecl(const ClassSelectionRule* selected,
                                     fInterpreter,
                                     fNormCtxt);
    }
+   fSelectedClasses.back().SetRequestDirectStreamer(selected->RequestDirectStreamer());
 
    if (fVerboseLevel > 0) {
       std::string qual_name;
@@ -951,6 +951,17 @@ bool XMLReader::Parse(const std::string &fileName, SelectionRules& out)
                     }
                   }
 
+                  // request a direct streamer
+                  if (tagKind == kClass && csr && "directStreamer" == iAttrName){
+                    if (iAttrValue == "true") {
+                      csr->SetRequestDirectStreamer(true);
+                    } else if (iAttrValue != "false") {
+                      ROOT::TMetaUtils::Error(nullptr,
+                         "XML at line %s: class attribute 'directStreamer' must be 'true' or 'false' (it was %s)\n",
+                         lineNumCharp, iAttrValue.c_str());
+                    }
+                  }
+
                   // Set the class version
                   if (tagKind == kClass &&
                       csr &&
@@ -29,6 +29,7 @@
 #include <sstream>
 #include <map>
 #include <fstream>
+#include <iterator>
 #include <sys/stat.h>
 #include <unordered_map>
 #include <unordered_set>
@@ -2911,10 +2912,14 @@ public:
       m_tempNames.push_back(tmpNameStr);
       ROOT::TMetaUtils::Info(nullptr, "File %s added to the tmp catalog.\n", name);
 
-      // This is to allow update of existing files
-      if (0 == std::rename(name , tmpName)) {
+      // This is to allow update of existing files. The existing file is kept
+      // in place, so that commit() can leave it untouched if the new content
+      // is the same: its timestamp does not trigger the rebuild of its users.
+      bool existing = llvm::sys::fs::exists(name) && !llvm::sys::fs::copy_file(name, tmpName);
+      if (existing) {
          ROOT::TMetaUtils::Info(nullptr, "File %s existing. Preserved as %s.\n", name, tmpName);
       }
+      m_existing.push_back(existing);
 
       // To change the name to its tmp version
       nameStr = tmpNameStr;
@@ -2942,10 +2947,27 @@ public:
             ROOT::TMetaUtils::Error(nullptr, "Removing %s!\n", tmpName);
             retval++;
          }
+         // as if the existing file had been moved to the temp one
+         if (m_existing[i])
+            std::remove(m_names[i].c_str());
       }
       return retval;
    }
 
+   /////////////////////////////////////////////////////////////////////////////
+   /// Compare the content of two files.
+
+   static bool haveSameContent(const char *name1, const char *name2) {
+      std::ifstream file1(name1, std::ios::binary | std::ios::ate);
+      std::ifstream file2(name2, std::ios::binary | std::ios::ate);
+      if (!file1 || !file2 || file1.tellg() != file2.tellg())
+         return false;
+      file1.seekg(0);
+      file2.seekg(0);
+      return std::equal(std::istreambuf_iterator<char>(file1), std::istreambuf_iterator<char>(),
+                        std::istreambuf_iterator<char>(file2));
+   }
+
    /////////////////////////////////////////////////////////////////////////////
 
    int commit() {
@@ -2962,6 +2984,14 @@ public:
          // accessing it from a Linux VM via a shared folder
          if (ifile.is_open())
             ifile.close();
+         if (m_existing[i] && haveSameContent(tmpName, name)) {
+            ROOT::TMetaUtils::Info(nullptr, "File %s unchanged.\n", name);
+            if (0 != std::remove(tmpName)) {
+               ROOT::TMetaUtils::Error(nullptr, "Removing %s!\n", tmpName);
+               retval++;
+            }
+            continue;
+         }
 #ifdef WIN32
          // Sometimes files cannot be renamed on Windows if they don't have
          // been released by the system. So just copy them and try to delete
@@ -3004,6 +3034,7 @@ private:
    const std::string m_emptyString;
    std::vector<std::string> m_names;
    std::vector<std::string> m_tempNames;
+   std::vector<bool> m_existing;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -5635,13 +5666,19 @@ int GenReflexMain(int argc, char **argv)
       "        Default value is 'false'\n"
       "      - noInputOperator [true/false]: turns off input operator generation if set\n"
       "        to 'true'. Default value is 'false'\n"
+      "      - directStreamer [true/false]: generates a streamer function used instead\n"
+      "        of the StreamerInfo actions when reading and writing objects whose layout\n"
+      "        matches the in-memory class. Only for classes without bases nor virtual\n"
+      "        functions whose data members are all public and of fundamental types or\n"
+      "        arrays thereof. Default value is 'false'\n"
       "      Example XML:\n"
       "        <lcgdict>\n"
       "        [<selection>]\n"
       "          <class [name=\"classname\"] [pattern=\"wildname\"]\n"
       "                 [file_name=\"filename\"] [file_pattern=\"wildname\"]\n"
       "                 [id=\"xxxx\"] [noStreamer=\"true/false\"]\n"
-      "                 [noInputOperator=\"true/false\"] />\n"
+      "                 [noInputOperator=\"true/false\"]\n"
+      "                 [directStreamer=\"true/false\"] />\n"
       "          <class name=\"classname\" >\n"
       "            <field name=\"m_transient\" transient=\"true\"/>\n"
       "            <field name=\"m_anothertransient\" persistent=\"false\"/>\n"
@@ -453,6 +453,10 @@
 
 /* #define R__NOSTATS */
 
+/*--- tracing of the hot paths, see ROOT/RTrace.hxx ---------------------------*/
+
+/* #define R__NOTRACE */
+
 /*--- cpp --------------------------------------------------------------------*/
 
 #ifdef ANSICPP
@@ -0,0 +1,109 @@
+/// \file ROOT/RTrace.hxx
+/// \ingroup Base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTrace
+#define ROOT_RTrace
+
+#include "ROOT/RConfig.hxx"
+#include "DllImport.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+
+/// Whether the spans are recorded, see RTrace
+R__EXTERN std::atomic<bool> gTraceEnabled;
+
+/**
+ Scoped tracing of the hot paths of ROOT (file reads, decompression, streamer info reading, event loops, tasks).
+
+ A span records the time spent in a scope, together with a category and a name, in a buffer of the current thread.
+ The recorded spans are written in the Chrome trace event format, which can be opened with https://ui.perfetto.dev
+ or chrome://tracing.
+
+ Tracing is enabled by setting the environment variable `ROOT_TRACE` to the name of the output file, which is
+ written at the end of the process, or by calling EnableTrace() and WriteTrace(). When tracing is disabled, a span
+ costs one relaxed atomic load; defining `R__NOTRACE` when building ROOT removes the spans completely.
+
+ ~~~{.cpp}
+ void ReadSomething()
+ {
+    R__TRACE_SPAN("io", "ReadSomething");
+    ...
+ }
+ ~~~
+
+ The category and the name must be string literals, or strings living until the trace is written: only their
+ addresses are recorded.
+*/
+class RTrace {
+public:
+   /// Whether the spans are currently recorded
+   static bool IsEnabled() { return gTraceEnabled.load(std::memory_order_relaxed); }
+   /// Start recording the spans; the trace is written to `fileName` at the end of the process, if not empty
+   static void Enable(const std::string &fileName = "");
+   /// Stop recording the spans; those already recorded are kept
+   static void Disable();
+   /// Write the spans recorded so far to `fileName`, in the Chrome trace event format; returns false on failure
+   static bool Write(const std::string &fileName);
+   /// Discard the spans recorded so far
+   static void Clear();
+   /// Number of spans recorded so far, by all threads
+   static std::size_t GetNSpans();
+
+   /// Current time in nanoseconds of the clock used for the spans
+   static std::int64_t Now()
+   {
+      return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+         .count();
+   }
+   /// Record a span of the current thread from `start` to `end`, as given by Now()
+   static void Record(const char *category, const char *name, std::int64_t start, std::int64_t end);
+};
+
+/// Records the time between its construction and its destruction as a span, if tracing is enabled.
+/// Use the R__TRACE_SPAN macro, which is removed by R__NOTRACE.
+class RTraceSpan {
+   const char *fCategory;
+   const char *fName;
+   std::int64_t fStart = -1; ///< -1 if tracing was disabled at construction
+
+public:
+   RTraceSpan(const char *category, const char *name) : fCategory(category), fName(name)
+   {
+      if (R__unlikely(RTrace::IsEnabled()))
+         fStart = RTrace::Now();
+   }
+   ~RTraceSpan()
+   {
+      if (R__unlikely(fStart >= 0))
+         RTrace::Record(fCategory, fName, fStart, RTrace::Now());
+   }
+   RTraceSpan(const RTraceSpan &) = delete;
+   RTraceSpan &operator=(const RTraceSpan &) = delete;
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#ifdef R__NOTRACE
+#define R__TRACE_SPAN(CATEGORY, NAME)
+#else
+#define R__TRACE_SPAN(CATEGORY, NAME) ::ROOT::Internal::RTraceSpan _R__UNIQUE_(R__traceSpan)(CATEGORY, NAME)
+#endif
+
+#endif
@@ -0,0 +1,210 @@
+/// \file RTrace.cxx
+/// \ingroup Base
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RTrace.hxx"
+
+#include "TError.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#ifdef _WIN32
+#include <process.h>
+#define R__getpid _getpid
+#else
+#include <unistd.h>
+#define R__getpid getpid
+#endif
+
+std::atomic<bool> ROOT::Internal::gTraceEnabled{false};
+
+namespace {
+
+struct RTraceEvent {
+   const char *fCategory;
+   const char *fName;
+   std::int64_t fStart;
+   std::int64_t fDuration;
+};
+
+/// Spans of one thread. The buffers are owned by the registry, so that the spans of finished threads are kept.
+struct RTraceBuffer {
+   std::mutex fMutex; ///< only contended while the trace is written
+   std::vector<RTraceEvent> fEvents;
+   std::size_t fNDropped = 0;
+   unsigned int fTid = 0;
+};
+
+/// Limit of the memory used by the spans of a thread, 4M spans or 96 MB
+constexpr std::size_t kMaxSpansPerThread = 1 << 22;
+
+struct RTraceRegistry {
+   std::mutex fMutex;
+   std::vector<std::unique_ptr<RTraceBuffer>> fBuffers;
+   std::string fFileName; ///< where to write the trace at the end of the process
+   std::int64_t fOrigin = ROOT::Internal::RTrace::Now();
+
+   RTraceRegistry()
+   {
+      if (const char *fileName = std::getenv("ROOT_TRACE")) {
+         if (*fileName) {
+            fFileName = fileName;
+            ROOT::Internal::gTraceEnabled = true;
+         }
+      }
+   }
+
+   ~RTraceRegistry()
+   {
+      ROOT::Internal::gTraceEnabled = false;
+      if (!fFileName.empty())
+         WriteTo(fFileName);
+   }
+
+   RTraceBuffer &GetThreadBuffer()
+   {
+      thread_local RTraceBuffer *buffer = nullptr;
+      if (!buffer) {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fBuffers.emplace_back(new RTraceBuffer);
+         buffer = fBuffers.back().get();
+         buffer->fTid = fBuffers.size();
+      }
+      return *buffer;
+   }
+
+   bool WriteTo(const std::string &fileName);
+};
+
+RTraceRegistry &GetRegistry()
+{
+   static RTraceRegistry registry;
+   return registry;
+}
+
+// read ROOT_TRACE when the library is loaded
+const bool gTraceRegistryInit = (GetRegistry(), true);
+
+void WriteJSONString(FILE *file, const char *str)
+{
+   fputc('"', file);
+   for (; *str; ++str) {
+      const unsigned char c = *str;
+      if (c == '"' || c == '\\')
+         fprintf(file, "\\%c", c);
+      else if (c < 0x20)
+         fprintf(file, "\\u%04x", c);
+      else
+         fputc(c, file);
+   }
+   fputc('"', file);
+}
+
+bool RTraceRegistry::WriteTo(const std::string &fileName)
+{
+   FILE *file = fopen(fileName.c_str(), "w");
+   if (!file) {
+      Error("RTrace::Write", "cannot open %s", fileName.c_str());
+      return false;
+   }
+   const int pid = R__getpid();
+   std::size_t nDropped = 0;
+   bool first = true;
+   fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+   std::lock_guard<std::mutex> lock(fMutex);
+   for (auto &buffer : fBuffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->fMutex);
+      nDropped += buffer->fNDropped;
+      for (const auto &event : buffer->fEvents) {
+         fputs(first ? "\n{\"name\":" : ",\n{\"name\":", file);
+         first = false;
+         WriteJSONString(file, event.fName);
+         fputs(",\"cat\":", file);
+         WriteJSONString(file, event.fCategory);
+         // the timestamps of the format are in microseconds
+         fprintf(file, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%u}",
+                 (event.fStart - fOrigin) * 1e-3, event.fDuration * 1e-3, pid, buffer->fTid);
+      }
+   }
+   fputs("\n]}\n", file);
+   const bool ok = !ferror(file);
+   if (fclose(file) != 0 || !ok) {
+      Error("RTrace::Write", "cannot write %s", fileName.c_str());
+      return false;
+   }
+   if (nDropped)
+      Warning("RTrace::Write", "%zu spans were dropped, more than %zu spans were recorded by a thread", nDropped,
+              kMaxSpansPerThread);
+   return true;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start recording the spans. If `fileName` is not empty, the trace is written to it at the end of the process,
+/// in addition to the file given by `ROOT_TRACE`.
+
+void ROOT::Internal::RTrace::Enable(const std::string &fileName)
+{
+   auto &registry = GetRegistry();
+   if (!fileName.empty()) {
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      registry.fFileName = fileName;
+   }
+   gTraceEnabled = true;
+}
+
+void ROOT::Internal::RTrace::Disable()
+{
+   gTraceEnabled = false;
+}
+
+bool ROOT::Internal::RTrace::Write(const std::string &fileName)
+{
+   return GetRegistry().WriteTo(fileName);
+}
+
+void ROOT::Internal::RTrace::Clear()
+{
+   auto &registry = GetRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   for (auto &buffer : registry.fBuffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->fMutex);
+      buffer->fEvents.clear();
+      buffer->fNDropped = 0;
+   }
+}
+
+std::size_t ROOT::Internal::RTrace::GetNSpans()
+{
+   auto &registry = GetRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   std::size_t n = 0;
+   for (auto &buffer : registry.fBuffers) {
+      std::lock_guard<std::mutex> bufferLock(buffer->fMutex);
+      n += buffer->fEvents.size();
+   }
+   return n;
+}
+
+void ROOT::Internal::RTrace::Record(const char *category, const char *name, std::int64_t start, std::int64_t end)
+{
+   auto &buffer = GetRegistry().GetThreadBuffer();
+   std::lock_guard<std::mutex> lock(buffer.fMutex);
+   if (buffer.fEvents.size() >= kMaxSpansPerThread) {
+      ++buffer.fNDropped;
+      return;
+   }
+   buffer.fEvents.push_back({category, name, start, end - start});
+}
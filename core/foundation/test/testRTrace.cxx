@@ -0,0 +1,69 @@
+#include "ROOT/RTrace.hxx"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using ROOT::Internal::RTrace;
+
+namespace {
+void TracedFunction()
+{
+   R__TRACE_SPAN("test", "TracedFunction");
+}
+
+std::string ReadFile(const std::string &fileName)
+{
+   std::ifstream file(fileName);
+   std::stringstream content;
+   content << file.rdbuf();
+   return content.str();
+}
+} // anonymous namespace
+
+TEST(RTrace, DisabledRecordsNothing)
+{
+   RTrace::Disable();
+   RTrace::Clear();
+   TracedFunction();
+   EXPECT_EQ(RTrace::GetNSpans(), 0u);
+}
+
+TEST(RTrace, SpansOfAllThreads)
+{
+   RTrace::Clear();
+   RTrace::Enable();
+   TracedFunction();
+   std::thread t([] {
+      TracedFunction();
+      TracedFunction();
+   });
+   t.join();
+   RTrace::Disable();
+   TracedFunction();
+   EXPECT_EQ(RTrace::GetNSpans(), 3u);
+   RTrace::Clear();
+   EXPECT_EQ(RTrace::GetNSpans(), 0u);
+}
+
+TEST(RTrace, WriteChromeTrace)
+{
+   RTrace::Clear();
+   RTrace::Enable();
+   {
+      R__TRACE_SPAN("test", "with \"quotes\"");
+   }
+   RTrace::Disable();
+   const std::string fileName = "testRTrace.json";
+   ASSERT_TRUE(RTrace::Write(fileName));
+   const auto content = ReadFile(fileName);
+   std::remove(fileName.c_str());
+   EXPECT_EQ(content.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0), 0u);
+   EXPECT_NE(content.find("\"name\":\"with \\\"quotes\\\"\",\"cat\":\"test\",\"ph\":\"X\""), std::string::npos);
+   EXPECT_EQ(content.substr(content.size() - 4), "\n]}\n");
+   RTrace::Clear();
+}
@@ -0,0 +1,85 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RRANGESCHEDULER
+#define ROOT_RRANGESCHEDULER
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/// A thread-safe scheduler that hands out ranges of entries to a fixed number of processing slots.
+///
+/// Every slot owns at most one range at a time, which it processes chunk by chunk (see GetNextChunk()). When a slot
+/// finishes its range and no range is pending anymore, it steals the second half of the unprocessed part of the
+/// largest range owned by another slot. Large ranges are thus split on demand, only if some slot would otherwise
+/// idle at the tail of the event loop, instead of being split up front into many small tasks.
+///
+/// A range can come with a set of split points (e.g. the cluster boundaries of a TTree): chunks and stolen ranges
+/// then always start at one of them. Without split points, ranges are split at any entry.
+class RRangeScheduler {
+public:
+   using Range_t = std::pair<std::uint64_t, std::uint64_t>;
+
+   /// A range of entries, [fRange.first, fRange.second), to be processed by one of the slots
+   struct RTask {
+      Range_t fRange;
+      /// Sorted entries within fRange at which the range can be split; if empty, it can be split anywhere
+      std::vector<std::uint64_t> fSplitPoints;
+      /// Minimum number of entries in a chunk; chunks end at the first split point after this many entries
+      std::uint64_t fChunkSize = 1;
+      /// Opaque value that allows callers to associate the range (and the ranges split from it) with its input
+      std::size_t fTag = 0;
+   };
+
+private:
+   /// The range currently owned by a slot. Only the unprocessed part, [fNext, fEnd), is kept.
+   struct RSlotState {
+      std::mutex fMutex;
+      std::uint64_t fNext = 0;
+      std::uint64_t fEnd = 0;
+      std::vector<std::uint64_t> fSplitPoints;
+      /// False if the range can only be split at fSplitPoints, which may run out as chunks are stolen
+      bool fSplitAnywhere = true;
+      std::uint64_t fChunkSize = 1;
+      std::size_t fTag = 0;
+   };
+
+   /// Ranges smaller than this are never split between slots
+   const std::uint64_t fMinSplitSize;
+   /// Protects fPending and serializes the slots that look for a new range
+   std::mutex fMutex;
+   std::deque<RTask> fPending;
+   std::vector<std::unique_ptr<RSlotState>> fSlots;
+
+   bool Steal(RSlotState &thief);
+
+public:
+   RRangeScheduler(unsigned int nSlots, std::uint64_t minSplitSize);
+   RRangeScheduler(const RRangeScheduler &) = delete;
+   RRangeScheduler &operator=(const RRangeScheduler &) = delete;
+
+   void AddTask(RTask &&task);
+   /// Give the slot a new range, either a pending one or one stolen from another slot. Return false if there is no
+   /// work left. On success, `tag` is set to the fTag of the task the range comes from and `begin` to its first entry.
+   bool AcquireRange(unsigned int slot, std::size_t &tag, std::uint64_t &begin);
+   /// Hand out the next chunk of the range owned by the slot. Return false once the range is exhausted, either
+   /// because it was processed or because its remaining part was stolen.
+   bool GetNextChunk(unsigned int slot, Range_t &chunk);
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
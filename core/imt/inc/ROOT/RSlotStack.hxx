@@ -11,27 +11,38 @@
 #ifndef ROOT_RSLOTSTACK
 #define ROOT_RSLOTSTACK
 
-#include <ROOT/TSpinMutex.hxx>
-
-#include <stack>
+#include <atomic>
+#include <memory>
 
 namespace ROOT {
 namespace Internal {
 
-/// A thread-safe stack of N indexes (0 to size - 1).
+/// A thread-safe pool of N indexes (0 to size - 1).
 /// RSlotStack can be used to safely assign a "processing slot" number to
 /// each thread in multi-thread applications.
-/// In release builds, pop and push operations are unchecked, potentially
-/// resulting in undefined behavior if more slot numbers than available are
-/// requested.
-/// An important design assumption is that a slot will almost always be available
-/// when a thread asks for it, and if it is not available it will be very soon,
-/// therefore a spinlock is used for synchronization.
+/// In debug builds, asking for more slot numbers than available, or returning
+/// a slot that is not in use, fail an assertion. In release builds, asking for
+/// a slot when none is available waits until one is returned.
+/// The pool is lock-free: each slot has its own flag, taken and released with
+/// atomic operations. A thread asking for a slot first tries the slot that it
+/// returned last, so that a worker thread keeps the same slot, and the per-slot
+/// data that it allocated and touched stays in the caches (and on the NUMA node)
+/// of its core, as long as the scheduling allows it.
 class RSlotStack {
 private:
+   /// Flag of a slot, alone in its cache line to avoid false sharing between the threads
+   struct alignas(64) RSlot {
+      std::atomic<bool> fBusy{false};
+   };
+
    const unsigned int fSize;
-   std::stack<unsigned int> fStack;
-   ROOT::TSpinMutex fMutex;
+   std::unique_ptr<RSlot[]> fSlots;
+
+   bool TryGetSlot(unsigned int slot)
+   {
+      return !fSlots[slot].fBusy.load(std::memory_order_relaxed) &&
+             !fSlots[slot].fBusy.exchange(true, std::memory_order_acquire);
+   }
 
 public:
    RSlotStack() = delete;
@@ -28,10 +28,13 @@
 #include "RTaskArena.hxx"
 #include "TError.h"
 
+#include <algorithm>
+#include <cstddef>
 #include <functional> //std::function
 #include <initializer_list>
+#include <iterator>
 #include <memory>
-#include <numeric> //std::accumulate
+#include <numeric> //std::accumulate, std::partial_sum
 #include <type_traits> //std::enable_if
 #include <utility> //std::move
 #include <vector>
@@ -98,6 +101,27 @@ namespace ROOT {
       template<class T, class R> auto Reduce(const std::vector<T> &objs, R redfunc) -> decltype(redfunc(objs));
       template<class T, class BINARYOP> auto Reduce(const std::vector<T> &objs, BINARYOP redfunc) -> decltype(redfunc(objs.front(), objs.front()));
 
+      // Parallel algorithms
+      //
+      // They split the range in nChunks consecutive chunks (0 to choose the number from the pool size and the
+      // length of the range) and run serially on short ranges.
+      template <class RandomIt>
+      void Sort(RandomIt first, RandomIt last);
+      template <class RandomIt, class Compare>
+      void Sort(RandomIt first, RandomIt last, Compare comp, unsigned nChunks = 0);
+      template <class RandomIt>
+      void StableSort(RandomIt first, RandomIt last);
+      template <class RandomIt, class Compare>
+      void StableSort(RandomIt first, RandomIt last, Compare comp, unsigned nChunks = 0);
+      template <class RandomIt, class OutputIt>
+      OutputIt InclusiveScan(RandomIt first, RandomIt last, OutputIt d_first);
+      template <class RandomIt, class OutputIt, class BINARYOP>
+      OutputIt InclusiveScan(RandomIt first, RandomIt last, OutputIt d_first, BINARYOP op, unsigned nChunks = 0);
+      template <class RandomIt, class Predicate>
+      RandomIt Partition(RandomIt first, RandomIt last, Predicate pred, unsigned nChunks = 0);
+      template <class F>
+      void Foreach2D(F func, unsigned nRows, unsigned nCols, unsigned rowGrain = 1, unsigned colGrain = 0);
+
       unsigned GetPoolSize() const;
 
    private:
@@ -133,6 +157,11 @@ namespace ROOT {
       template<class T, class R>
       auto SeqReduce(const std::vector<T> &objs, R redfunc) -> decltype(redfunc(objs));
 
+      // Helpers of the parallel algorithms
+      std::vector<std::size_t> SplitRange(std::size_t n, unsigned nChunks) const;
+      template <class RandomIt, class SortChunk, class Compare>
+      void MergeSort(RandomIt first, RandomIt last, SortChunk sortChunk, Compare comp, unsigned nChunks);
+
       /// Pointer to the TBB task arena wrapper
       std::shared_ptr<ROOT::Internal::RTaskArenaWrapper> fTaskArenaW = nullptr;
    };
@@ -600,6 +629,232 @@ namespace ROOT {
       return redfunc(objs);
    }
 
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Boundaries of the chunks in which the parallel algorithms split a range of `n` elements.
+   ///
+   /// Without an explicit number of chunks, the range is split in at most one chunk per thread of the pool, of
+   /// at least 16384 elements each. A single chunk {0, n} means that the algorithm should run serially.
+   inline std::vector<std::size_t> TThreadExecutor::SplitRange(std::size_t n, unsigned nChunks) const
+   {
+      constexpr std::size_t kMinChunkSize = 16384;
+      std::size_t chunks = nChunks;
+      if (chunks == 0)
+         chunks = std::min<std::size_t>(GetPoolSize(), n / kMinChunkSize);
+      chunks = std::max<std::size_t>(1, std::min(chunks, n));
+      std::vector<std::size_t> bounds(chunks + 1);
+      for (std::size_t c = 0; c <= chunks; ++c)
+         bounds[c] = n / chunks * c + n % chunks * c / chunks;
+      return bounds;
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Sort the chunks of a range in parallel with `sortChunk`, then merge them pairwise in parallel.
+   template <class RandomIt, class SortChunk, class Compare>
+   void TThreadExecutor::MergeSort(RandomIt first, RandomIt last, SortChunk sortChunk, Compare comp, unsigned nChunks)
+   {
+      const auto bounds = SplitRange(last - first, nChunks);
+      const unsigned chunks = bounds.size() - 1;
+      if (chunks == 1) {
+         sortChunk(first, last);
+         return;
+      }
+      Foreach([&](unsigned c) { sortChunk(first + bounds[c], first + bounds[c + 1]); }, ROOT::TSeqU(chunks));
+      // std::inplace_merge is stable, so merging stably sorted chunks gives a stable sort
+      for (unsigned width = 1; width < chunks; width *= 2) {
+         const unsigned nMerges = (chunks - width + 2 * width - 1) / (2 * width);
+         Foreach(
+            [&](unsigned m) {
+               const unsigned c = 2 * width * m;
+               std::inplace_merge(first + bounds[c], first + bounds[c + width],
+                                  first + bounds[std::min(c + 2 * width, chunks)], comp);
+            },
+            ROOT::TSeqU(nMerges));
+      }
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Sort a range in parallel in ascending order, as std::sort.
+   ///
+   /// \param first, last Random access iterators to the range to sort.
+   template <class RandomIt>
+   void TThreadExecutor::Sort(RandomIt first, RandomIt last)
+   {
+      Sort(first, last, std::less<>{});
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Sort a range in parallel according to a comparison function, as std::sort.
+   ///
+   /// The chunks are sorted with std::sort in parallel, then merged pairwise in parallel rounds.
+   /// \param first, last Random access iterators to the range to sort.
+   /// \param comp Comparison function, called concurrently from several threads.
+   /// \param nChunks Number of chunks to split the range for processing.
+   template <class RandomIt, class Compare>
+   void TThreadExecutor::Sort(RandomIt first, RandomIt last, Compare comp, unsigned nChunks)
+   {
+      MergeSort(first, last, [&](RandomIt b, RandomIt e) { std::sort(b, e, comp); }, comp, nChunks);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Sort a range in parallel in ascending order, preserving the order of equal elements, as
+   /// std::stable_sort.
+   ///
+   /// \param first, last Random access iterators to the range to sort.
+   template <class RandomIt>
+   void TThreadExecutor::StableSort(RandomIt first, RandomIt last)
+   {
+      StableSort(first, last, std::less<>{});
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Sort a range in parallel according to a comparison function, preserving the order of equal
+   /// elements, as std::stable_sort.
+   ///
+   /// The result does not depend on the number of chunks.
+   /// \param first, last Random access iterators to the range to sort.
+   /// \param comp Comparison function, called concurrently from several threads.
+   /// \param nChunks Number of chunks to split the range for processing.
+   template <class RandomIt, class Compare>
+   void TThreadExecutor::StableSort(RandomIt first, RandomIt last, Compare comp, unsigned nChunks)
+   {
+      MergeSort(first, last, [&](RandomIt b, RandomIt e) { std::stable_sort(b, e, comp); }, comp, nChunks);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Compute the inclusive prefix sums of a range in parallel, as std::partial_sum.
+   ///
+   /// \copydetails TThreadExecutor::InclusiveScan(RandomIt,RandomIt,OutputIt,BINARYOP,unsigned)
+   template <class RandomIt, class OutputIt>
+   OutputIt TThreadExecutor::InclusiveScan(RandomIt first, RandomIt last, OutputIt d_first)
+   {
+      return InclusiveScan(first, last, d_first, std::plus<>{});
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Compute the inclusive prefix reductions of a range with a binary operation in parallel, as
+   /// std::partial_sum.
+   ///
+   /// The totals of the chunks are computed in parallel and combined serially, then the chunks are scanned in
+   /// parallel starting from the combined totals of the chunks before them. The operation must therefore be
+   /// associative; for floating-point sums the rounding differs from a serial scan and depends on the number
+   /// of chunks. The output can be the input range itself.
+   /// \param first, last Random access iterators to the range to scan.
+   /// \param d_first Random access iterator to the beginning of the output range.
+   /// \param op Associative binary operation, called concurrently from several threads.
+   /// \param nChunks Number of chunks to split the range for processing.
+   /// \return Iterator to the end of the output range.
+   template <class RandomIt, class OutputIt, class BINARYOP>
+   OutputIt TThreadExecutor::InclusiveScan(RandomIt first, RandomIt last, OutputIt d_first, BINARYOP op,
+                                           unsigned nChunks)
+   {
+      using value_type = typename std::iterator_traits<RandomIt>::value_type;
+      const auto bounds = SplitRange(last - first, nChunks);
+      const unsigned chunks = bounds.size() - 1;
+      if (chunks == 1)
+         return std::partial_sum(first, last, d_first, op);
+
+      std::vector<value_type> totals(chunks);
+      Foreach(
+         [&](unsigned c) {
+            totals[c] = std::accumulate(first + bounds[c] + 1, first + bounds[c + 1], value_type(first[bounds[c]]), op);
+         },
+         ROOT::TSeqU(chunks));
+      for (unsigned c = 1; c < chunks; ++c)
+         totals[c] = op(totals[c - 1], totals[c]);
+      Foreach(
+         [&](unsigned c) {
+            if (c == 0) {
+               std::partial_sum(first, first + bounds[1], d_first, op);
+               return;
+            }
+            value_type acc = totals[c - 1];
+            for (std::size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+               acc = op(acc, first[i]);
+               d_first[i] = acc;
+            }
+         },
+         ROOT::TSeqU(chunks));
+      return d_first + bounds[chunks];
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Reorder a range in parallel so that the elements satisfying a predicate precede the others.
+   ///
+   /// The partition is stable, as std::stable_partition: the relative order of the elements is preserved in
+   /// both groups, independently of the number of chunks. The predicate is evaluated once per element, and the
+   /// elements are moved through a buffer, so their type must be default-constructible.
+   /// \param first, last Random access iterators to the range to partition.
+   /// \param pred Predicate, called concurrently from several threads.
+   /// \param nChunks Number of chunks to split the range for processing.
+   /// \return Iterator to the first element of the second group.
+   template <class RandomIt, class Predicate>
+   RandomIt TThreadExecutor::Partition(RandomIt first, RandomIt last, Predicate pred, unsigned nChunks)
+   {
+      using value_type = typename std::iterator_traits<RandomIt>::value_type;
+      const std::size_t n = last - first;
+      const auto bounds = SplitRange(n, nChunks);
+      const unsigned chunks = bounds.size() - 1;
+      if (chunks == 1)
+         return std::stable_partition(first, last, pred);
+
+      std::vector<char> selected(n);
+      std::vector<std::size_t> nSelected(chunks + 1, 0);
+      Foreach(
+         [&](unsigned c) {
+            std::size_t count = 0;
+            for (std::size_t i = bounds[c]; i < bounds[c + 1]; ++i) {
+               selected[i] = bool(pred(first[i]));
+               count += selected[i];
+            }
+            nSelected[c + 1] = count;
+         },
+         ROOT::TSeqU(chunks));
+      // nSelected[c] becomes the number of selected elements before chunk c
+      std::partial_sum(nSelected.begin(), nSelected.end(), nSelected.begin());
+      const std::size_t nTotal = nSelected[chunks];
+
+      std::vector<value_type> buffer(n);
+      Foreach(
+         [&](unsigned c) {
+            std::size_t outSelected = nSelected[c];
+            std::size_t outOther = nTotal + bounds[c] - nSelected[c];
+            for (std::size_t i = bounds[c]; i < bounds[c + 1]; ++i)
+               buffer[selected[i] ? outSelected++ : outOther++] = std::move(first[i]);
+         },
+         ROOT::TSeqU(chunks));
+      Foreach(
+         [&](unsigned c) { std::move(buffer.begin() + bounds[c], buffer.begin() + bounds[c + 1], first + bounds[c]); },
+         ROOT::TSeqU(chunks));
+      return first + nTotal;
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief Execute a function in parallel over the tiles of a two-dimensional range.
+   ///
+   /// The range [0, nRows) x [0, nCols) is split in tiles of `rowGrain` rows and `colGrain` columns (fewer at
+   /// the edges), and `func(rowBegin, rowEnd, colBegin, colEnd)` is called once per tile.
+   /// \param func Function to be executed on the tiles.
+   /// \param nRows, nCols Extent of the range.
+   /// \param rowGrain Number of rows of a tile, 0 for all rows.
+   /// \param colGrain Number of columns of a tile, 0 for all columns.
+   template <class F>
+   void TThreadExecutor::Foreach2D(F func, unsigned nRows, unsigned nCols, unsigned rowGrain, unsigned colGrain)
+   {
+      if (nRows == 0 || nCols == 0)
+         return;
+      if (rowGrain == 0 || rowGrain > nRows)
+         rowGrain = nRows;
+      if (colGrain == 0 || colGrain > nCols)
+         colGrain = nCols;
+      const unsigned nRowTiles = (nRows + rowGrain - 1) / rowGrain;
+      const unsigned nColTiles = (nCols + colGrain - 1) / colGrain;
+      ParallelFor(0U, nRowTiles * nColTiles, 1, [&](unsigned int tile) {
+         const unsigned row = tile / nColTiles * rowGrain;
+         const unsigned col = tile % nColTiles * colGrain;
+         func(row, std::min(row + rowGrain, nRows), col, std::min(col + colGrain, nCols));
+      });
+   }
+
 } // namespace ROOT
 
 #endif   // R__USE_IMT
@@ -0,0 +1,136 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RRangeScheduler.hxx>
+
+#include <algorithm>
+#include <cassert>
+
+ROOT::Internal::RRangeScheduler::RRangeScheduler(unsigned int nSlots, std::uint64_t minSplitSize)
+   : fMinSplitSize(std::max<std::uint64_t>(minSplitSize, 2))
+{
+   fSlots.reserve(nSlots);
+   for (auto i = 0u; i < nSlots; ++i)
+      fSlots.emplace_back(std::make_unique<RSlotState>());
+}
+
+void ROOT::Internal::RRangeScheduler::AddTask(RTask &&task)
+{
+   if (task.fRange.first >= task.fRange.second)
+      return;
+   assert(std::is_sorted(task.fSplitPoints.begin(), task.fSplitPoints.end()));
+   std::lock_guard<std::mutex> lock(fMutex);
+   fPending.emplace_back(std::move(task));
+}
+
+bool ROOT::Internal::RRangeScheduler::AcquireRange(unsigned int slot, std::size_t &tag, std::uint64_t &begin)
+{
+   assert(slot < fSlots.size());
+   auto &state = *fSlots[slot];
+
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (!fPending.empty()) {
+      auto task = std::move(fPending.front());
+      fPending.pop_front();
+      std::lock_guard<std::mutex> slotLock(state.fMutex);
+      state.fNext = task.fRange.first;
+      state.fEnd = task.fRange.second;
+      state.fSplitAnywhere = task.fSplitPoints.empty();
+      state.fSplitPoints = std::move(task.fSplitPoints);
+      state.fChunkSize = std::max<std::uint64_t>(task.fChunkSize, 1);
+      state.fTag = task.fTag;
+   } else if (!Steal(state)) {
+      return false;
+   }
+
+   std::lock_guard<std::mutex> slotLock(state.fMutex);
+   tag = state.fTag;
+   begin = state.fNext;
+   return true;
+}
+
+/// Move the second half of the largest unprocessed range owned by another slot to `thief`. If that range cannot be
+/// split, the next largest one is tried, and so on.
+/// Must be called with fMutex locked, which guarantees that the ranges can only shrink while we look at them.
+bool ROOT::Internal::RRangeScheduler::Steal(RSlotState &thief)
+{
+   std::vector<std::pair<std::uint64_t, RSlotState *>> victims;
+   for (auto &s : fSlots) {
+      if (s.get() == &thief)
+         continue;
+      std::lock_guard<std::mutex> slotLock(s->fMutex);
+      if (s->fNext < s->fEnd && s->fEnd - s->fNext >= fMinSplitSize)
+         victims.emplace_back(s->fEnd - s->fNext, s.get());
+   }
+   std::sort(victims.begin(), victims.end(), [](const auto &a, const auto &b) { return a.first > b.first; });
+
+   for (auto &v : victims) {
+      auto &victim = *v.second;
+      std::unique_lock<std::mutex> victimLock(victim.fMutex);
+      const auto next = victim.fNext;
+      const auto end = victim.fEnd;
+      if (next >= end || end - next < fMinSplitSize)
+         continue;
+
+      auto &splitPoints = victim.fSplitPoints;
+      auto split = next + (end - next) / 2;
+      if (!victim.fSplitAnywhere) {
+         // the first split point in the second half, or failing that the last one before the end
+         auto it = std::lower_bound(splitPoints.begin(), splitPoints.end(), split);
+         if (it == splitPoints.end() || *it >= end) {
+            it = std::lower_bound(splitPoints.begin(), splitPoints.end(), end);
+            if (it == splitPoints.begin())
+               continue;
+            --it;
+         }
+         if (*it <= next)
+            continue;
+         split = *it;
+      }
+
+      std::vector<std::uint64_t> stolenSplitPoints(std::upper_bound(splitPoints.begin(), splitPoints.end(), split),
+                                                   splitPoints.end());
+      splitPoints.erase(std::lower_bound(splitPoints.begin(), splitPoints.end(), split), splitPoints.end());
+      victim.fEnd = split;
+      const auto splitAnywhere = victim.fSplitAnywhere;
+      const auto chunkSize = victim.fChunkSize;
+      const auto tag = victim.fTag;
+      victimLock.unlock();
+
+      std::lock_guard<std::mutex> thiefLock(thief.fMutex);
+      thief.fNext = split;
+      thief.fEnd = end;
+      thief.fSplitPoints = std::move(stolenSplitPoints);
+      thief.fSplitAnywhere = splitAnywhere;
+      thief.fChunkSize = chunkSize;
+      thief.fTag = tag;
+      return true;
+   }
+   return false;
+}
+
+bool ROOT::Internal::RRangeScheduler::GetNextChunk(unsigned int slot, Range_t &chunk)
+{
+   assert(slot < fSlots.size());
+   auto &state = *fSlots[slot];
+
+   std::lock_guard<std::mutex> slotLock(state.fMutex);
+   if (state.fNext >= state.fEnd)
+      return false;
+
+   const auto begin = state.fNext;
+   const auto minEnd = begin + state.fChunkSize;
+   auto end = std::min(minEnd, state.fEnd);
+   if (!state.fSplitAnywhere) {
+      const auto it = std::lower_bound(state.fSplitPoints.begin(), state.fSplitPoints.end(), minEnd);
+      end = it == state.fSplitPoints.end() ? state.fEnd : std::min(*it, state.fEnd);
+   }
+   state.fNext = end;
+   chunk = {begin, end};
+   return true;
+}
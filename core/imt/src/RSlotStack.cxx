@@ -8,31 +8,54 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
-#include <ROOT/TSeq.hxx>
 #include <ROOT/RSlotStack.hxx>
 
 #include <cassert>
-#include <mutex> // std::lock_guard
+#include <functional> // std::hash
+#include <thread>
 
-ROOT::Internal::RSlotStack::RSlotStack(unsigned int size) : fSize(size)
-{
-   for (auto i : ROOT::TSeqU(size))
-      fStack.push(i);
-}
+namespace {
+/// The slot last returned by this thread, and the stack it was returned to
+struct RSlotHint {
+   const ROOT::Internal::RSlotStack *fStack = nullptr;
+   unsigned int fSlot = 0;
+};
+thread_local RSlotHint gSlotHint;
+} // namespace
+
+ROOT::Internal::RSlotStack::RSlotStack(unsigned int size) : fSize(size), fSlots(new RSlot[size]) {}
 
 void ROOT::Internal::RSlotStack::ReturnSlot(unsigned int slot)
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   assert(fStack.size() < fSize && "Trying to put back a slot to a full stack!");
-   (void)fSize;
-   fStack.push(slot);
+   assert(slot < fSize && "Trying to put back an invalid slot!");
+   const bool wasBusy = fSlots[slot].fBusy.exchange(false, std::memory_order_release);
+   assert(wasBusy && "Trying to put back a slot to a full stack!");
+   (void)wasBusy;
+   gSlotHint.fStack = this;
+   gSlotHint.fSlot = slot;
 }
 
 unsigned int ROOT::Internal::RSlotStack::GetSlot()
 {
-   std::lock_guard<ROOT::TSpinMutex> guard(fMutex);
-   assert(!fStack.empty() && "Trying to pop a slot from an empty stack!");
-   const auto slot = fStack.top();
-   fStack.pop();
-   return slot;
+   // the slot returned last by this thread, or else a slot depending on the thread, so that
+   // the threads starting together do not all compete for the first slots
+   assert(fSize > 0 && "Trying to pop a slot from an empty stack!");
+   unsigned int start;
+   if (gSlotHint.fStack == this && gSlotHint.fSlot < fSize) {
+      if (TryGetSlot(gSlotHint.fSlot))
+         return gSlotHint.fSlot;
+      start = gSlotHint.fSlot + 1;
+   } else {
+      start = std::hash<std::thread::id>{}(std::this_thread::get_id()) % fSize;
+   }
+
+   while (true) {
+      for (unsigned int i = 0; i < fSize; ++i) {
+         const unsigned int slot = (start + i) % fSize;
+         if (TryGetSlot(slot))
+            return slot;
+      }
+      assert(false && "Trying to pop a slot from an empty stack!");
+      std::this_thread::yield();
+   }
 }
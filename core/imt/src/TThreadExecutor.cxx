@@ -3,6 +3,7 @@
 
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROpaqueTaskArena.hxx"
+#include "ROOT/RTrace.hxx"
 #if !defined(_MSC_VER)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
@@ -169,7 +170,10 @@ void TThreadExecutor::ParallelFor(unsigned start, unsigned end, unsigned step,
    }
    fTaskArenaW->Access().execute([&] {
       tbb::this_task_arena::isolate([&] {
-         tbb::parallel_for(start, end, step, f);
+         tbb::parallel_for(start, end, step, [&f](unsigned int i) {
+            R__TRACE_SPAN("imt", "TThreadExecutor::Task");
+            f(i);
+         });
       });
    });
 }
@@ -0,0 +1,118 @@
+#include "ROOT/RRangeScheduler.hxx"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using ROOT::Internal::RRangeScheduler;
+
+TEST(RRangeScheduler, PendingRangesFirst)
+{
+   RRangeScheduler scheduler(2, 2);
+   scheduler.AddTask({{0, 10}, {}, 4, 1});
+   scheduler.AddTask({{10, 12}, {}, 4, 2});
+
+   std::size_t tag = 0;
+   std::uint64_t begin = 0;
+   RRangeScheduler::Range_t chunk;
+   ASSERT_TRUE(scheduler.AcquireRange(0, tag, begin));
+   EXPECT_EQ(1u, tag);
+   EXPECT_EQ(0u, begin);
+   ASSERT_TRUE(scheduler.AcquireRange(1, tag, begin));
+   EXPECT_EQ(2u, tag);
+   EXPECT_EQ(10u, begin);
+
+   ASSERT_TRUE(scheduler.GetNextChunk(0, chunk));
+   EXPECT_EQ(RRangeScheduler::Range_t(0, 4), chunk);
+   ASSERT_TRUE(scheduler.GetNextChunk(1, chunk));
+   EXPECT_EQ(RRangeScheduler::Range_t(10, 12), chunk);
+   EXPECT_FALSE(scheduler.GetNextChunk(1, chunk));
+}
+
+TEST(RRangeScheduler, Steal)
+{
+   RRangeScheduler scheduler(2, 2);
+   scheduler.AddTask({{0, 100}, {}, 10, 42});
+
+   std::size_t tag = 0;
+   std::uint64_t begin = 0;
+   RRangeScheduler::Range_t chunk;
+   ASSERT_TRUE(scheduler.AcquireRange(0, tag, begin));
+   ASSERT_TRUE(scheduler.GetNextChunk(0, chunk));
+   EXPECT_EQ(RRangeScheduler::Range_t(0, 10), chunk);
+
+   // slot 1 takes the second half of what slot 0 did not process yet, [10, 100)
+   ASSERT_TRUE(scheduler.AcquireRange(1, tag, begin));
+   EXPECT_EQ(42u, tag);
+   EXPECT_EQ(55u, begin);
+
+   std::uint64_t nEntries0 = 10;
+   while (scheduler.GetNextChunk(0, chunk))
+      nEntries0 += chunk.second - chunk.first;
+   EXPECT_EQ(55u, nEntries0);
+   EXPECT_EQ(55u, chunk.second);
+}
+
+TEST(RRangeScheduler, StealAtSplitPoints)
+{
+   RRangeScheduler scheduler(2, 2);
+   scheduler.AddTask({{0, 100}, {30, 40, 90}, 1, 0});
+
+   std::size_t tag = 0;
+   std::uint64_t begin = 0;
+   RRangeScheduler::Range_t chunk;
+   ASSERT_TRUE(scheduler.AcquireRange(0, tag, begin));
+   ASSERT_TRUE(scheduler.GetNextChunk(0, chunk));
+   EXPECT_EQ(RRangeScheduler::Range_t(0, 30), chunk);
+
+   // the middle of [30, 100) is 65, the next split point is 90
+   ASSERT_TRUE(scheduler.AcquireRange(1, tag, begin));
+   EXPECT_EQ(90u, begin);
+   ASSERT_TRUE(scheduler.GetNextChunk(1, chunk));
+   EXPECT_EQ(RRangeScheduler::Range_t(90, 100), chunk);
+   EXPECT_FALSE(scheduler.GetNextChunk(1, chunk));
+
+   // the clusters [30, 40) and [40, 90) are left to slot 0, the last one cannot be split
+   ASSERT_TRUE(scheduler.GetNextChunk(0, chunk));
+   EXPECT_EQ(RRangeScheduler::Range_t(30, 40), chunk);
+   EXPECT_FALSE(scheduler.AcquireRange(1, tag, begin));
+   ASSERT_TRUE(scheduler.GetNextChunk(0, chunk));
+   EXPECT_EQ(RRangeScheduler::Range_t(40, 90), chunk);
+   EXPECT_FALSE(scheduler.GetNextChunk(0, chunk));
+   EXPECT_FALSE(scheduler.AcquireRange(0, tag, begin));
+}
+
+TEST(RRangeScheduler, AllEntriesOnceMT)
+{
+   const unsigned int nSlots = 4;
+   const std::uint64_t nEntries = 100000;
+   RRangeScheduler scheduler(nSlots, 16);
+   // very uneven ranges: a small one per slot and a large one
+   for (auto i = 0u; i < nSlots; ++i)
+      scheduler.AddTask({{i * 10, (i + 1) * 10}, {}, 8, 0});
+   scheduler.AddTask({{nSlots * 10, nEntries}, {}, 64, 0});
+
+   std::vector<std::atomic<int>> timesSeen(nEntries);
+   std::vector<std::thread> threads;
+   for (auto slot = 0u; slot < nSlots; ++slot) {
+      threads.emplace_back([&, slot] {
+         std::size_t tag;
+         std::uint64_t begin;
+         RRangeScheduler::Range_t chunk;
+         while (scheduler.AcquireRange(slot, tag, begin)) {
+            while (scheduler.GetNextChunk(slot, chunk)) {
+               EXPECT_GE(chunk.first, begin);
+               for (auto e = chunk.first; e < chunk.second; ++e)
+                  ++timesSeen[e];
+            }
+         }
+      });
+   }
+   for (auto &t : threads)
+      t.join();
+
+   for (auto e = 0u; e < nEntries; ++e)
+      EXPECT_EQ(1, timesSeen[e]) << "entry " << e;
+}
@@ -0,0 +1,80 @@
+#include "ROOT/RSlotStack.hxx"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using ROOT::Internal::RSlotStack;
+using ROOT::Internal::RSlotStackRAII;
+
+TEST(RSlotStack, AllSlots)
+{
+   RSlotStack stack(4);
+   std::vector<bool> taken(4, false);
+   std::vector<unsigned int> slots;
+   for (unsigned int i = 0; i < 4; ++i) {
+      const unsigned int slot = stack.GetSlot();
+      ASSERT_LT(slot, 4u);
+      EXPECT_FALSE(taken[slot]);
+      taken[slot] = true;
+      slots.push_back(slot);
+   }
+   for (auto slot : slots)
+      stack.ReturnSlot(slot);
+}
+
+// a thread gets back the slot it returned last
+TEST(RSlotStack, SlotAffinity)
+{
+   RSlotStack stack(8);
+   const unsigned int slot1 = stack.GetSlot();
+   const unsigned int slot2 = stack.GetSlot();
+   stack.ReturnSlot(slot1);
+   EXPECT_EQ(slot1, stack.GetSlot());
+   stack.ReturnSlot(slot2);
+   EXPECT_EQ(slot2, stack.GetSlot());
+   stack.ReturnSlot(slot1);
+   stack.ReturnSlot(slot2);
+
+   // each thread keeps its own slot
+   std::thread([&] {
+      unsigned int slot;
+      {
+         RSlotStackRAII slotRAII(stack);
+         slot = slotRAII.fSlot;
+      }
+      for (int i = 0; i < 10; ++i) {
+         RSlotStackRAII slotRAII(stack);
+         EXPECT_EQ(slot, slotRAII.fSlot);
+      }
+   }).join();
+}
+
+// no slot is ever used by two threads at the same time
+TEST(RSlotStack, ExclusiveSlots)
+{
+   const unsigned int nSlots = 4;
+   RSlotStack stack(nSlots);
+   std::unique_ptr<std::atomic<int>[]> users(new std::atomic<int>[nSlots]);
+   for (unsigned int i = 0; i < nSlots; ++i)
+      users[i] = 0;
+   std::atomic<int> errors{0};
+
+   std::vector<std::thread> threads;
+   for (unsigned int t = 0; t < nSlots; ++t) {
+      threads.emplace_back([&] {
+         for (int i = 0; i < 10000; ++i) {
+            RSlotStackRAII slotRAII(stack);
+            if (users[slotRAII.fSlot]++ != 0)
+               ++errors;
+            users[slotRAII.fSlot]--;
+         }
+      });
+   }
+   for (auto &thread : threads)
+      thread.join();
+   EXPECT_EQ(0, errors);
+}
@@ -0,0 +1,126 @@
+#include "ROOT/TThreadExecutor.hxx"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+std::vector<int> RandomInts(std::size_t n, int max)
+{
+   std::mt19937 gen(1234);
+   std::uniform_int_distribution<int> dist(0, max);
+   std::vector<int> v(n);
+   for (auto &x : v)
+      x = dist(gen);
+   return v;
+}
+
+} // anonymous namespace
+
+TEST(TThreadExecutorAlgorithms, Sort)
+{
+   ROOT::TThreadExecutor pool(4);
+   for (unsigned nChunks : {0u, 1u, 3u, 4u, 7u}) {
+      auto v = RandomInts(100003, 1000000);
+      auto expected = v;
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+      pool.Sort(v.begin(), v.end(), std::greater<int>(), nChunks);
+      EXPECT_EQ(v, expected) << "nChunks = " << nChunks;
+   }
+   std::vector<int> empty;
+   pool.Sort(empty.begin(), empty.end());
+   EXPECT_TRUE(empty.empty());
+}
+
+TEST(TThreadExecutorAlgorithms, StableSort)
+{
+   ROOT::TThreadExecutor pool(4);
+   // sort (key, position) pairs on the key only: stability keeps the positions increasing for equal keys
+   const auto keys = RandomInts(50000, 100);
+   std::vector<std::pair<int, int>> v(keys.size());
+   for (std::size_t i = 0; i < keys.size(); ++i)
+      v[i] = {keys[i], int(i)};
+   auto expected = v;
+   auto byKey = [](const std::pair<int, int> &a, const std::pair<int, int> &b) { return a.first < b.first; };
+   std::stable_sort(expected.begin(), expected.end(), byKey);
+   for (unsigned nChunks : {1u, 5u, 16u}) {
+      auto w = v;
+      pool.StableSort(w.begin(), w.end(), byKey, nChunks);
+      EXPECT_EQ(w, expected) << "nChunks = " << nChunks;
+   }
+}
+
+TEST(TThreadExecutorAlgorithms, InclusiveScan)
+{
+   ROOT::TThreadExecutor pool(4);
+   const auto v = RandomInts(70001, 10);
+   std::vector<std::int64_t> in(v.begin(), v.end());
+   std::vector<std::int64_t> expected(in.size());
+   std::partial_sum(in.begin(), in.end(), expected.begin());
+   for (unsigned nChunks : {0u, 1u, 6u}) {
+      std::vector<std::int64_t> out(in.size());
+      auto end = pool.InclusiveScan(in.begin(), in.end(), out.begin(), std::plus<std::int64_t>(), nChunks);
+      EXPECT_EQ(end, out.end());
+      EXPECT_EQ(out, expected) << "nChunks = " << nChunks;
+   }
+   // in place, with another associative operation
+   auto inPlace = v;
+   auto maxOp = [](int a, int b) { return std::max(a, b); };
+   std::vector<int> expectedMax(v.size());
+   std::partial_sum(v.begin(), v.end(), expectedMax.begin(), maxOp);
+   pool.InclusiveScan(inPlace.begin(), inPlace.end(), inPlace.begin(), maxOp, 4);
+   EXPECT_EQ(inPlace, expectedMax);
+}
+
+TEST(TThreadExecutorAlgorithms, Partition)
+{
+   ROOT::TThreadExecutor pool(4);
+   auto isEven = [](int x) { return x % 2 == 0; };
+   for (unsigned nChunks : {0u, 1u, 4u, 9u}) {
+      auto v = RandomInts(60000, 1000000);
+      auto expected = v;
+      const auto expectedPoint = std::stable_partition(expected.begin(), expected.end(), isEven) - expected.begin();
+      const auto point = pool.Partition(v.begin(), v.end(), isEven, nChunks) - v.begin();
+      EXPECT_EQ(point, expectedPoint) << "nChunks = " << nChunks;
+      EXPECT_EQ(v, expected) << "nChunks = " << nChunks;
+   }
+}
+
+TEST(TThreadExecutorAlgorithms, Foreach2D)
+{
+   ROOT::TThreadExecutor pool(4);
+   const unsigned nRows = 37, nCols = 23;
+   std::vector<std::atomic<int>> visits(nRows * nCols);
+   for (auto &v : visits)
+      v = 0;
+   pool.Foreach2D(
+      [&](unsigned r0, unsigned r1, unsigned c0, unsigned c1) {
+         EXPECT_LE(r1 - r0, 8u);
+         EXPECT_LE(c1 - c0, 5u);
+         for (unsigned r = r0; r < r1; ++r)
+            for (unsigned c = c0; c < c1; ++c)
+               ++visits[r * nCols + c];
+      },
+      nRows, nCols, 8, 5);
+   for (auto &v : visits)
+      EXPECT_EQ(v, 1);
+
+   // a grain of 0 gives whole rows
+   std::atomic<int> nTiles{0};
+   pool.Foreach2D(
+      [&](unsigned r0, unsigned r1, unsigned c0, unsigned c1) {
+         EXPECT_EQ(r1 - r0, 1u);
+         EXPECT_EQ(c0, 0u);
+         EXPECT_EQ(c1, nCols);
+         ++nTiles;
+      },
+      nRows, nCols, 1, 0);
+   EXPECT_EQ(nTiles, int(nRows));
+}
@@ -241,6 +241,7 @@ private:
    ROOT::DirAutoAdd_t  fDirAutoAdd;     //pointer which implements the Directory Auto Add feature for this class.']'
    ClassStreamerFunc_t fStreamerFunc;   //Wrapper around this class custom Streamer member function.
    ClassConvStreamerFunc_t fConvStreamerFunc;   //Wrapper around this class custom conversion Streamer member function.
+   ClassStreamerFunc_t fDirectStreamerFunc = nullptr; //Generated function streaming the data members, see SetDirectStreamerFunc.
    Int_t               fSizeof;         //Sizeof the class.
 
    // Bit field
@@ -487,6 +488,7 @@ public:
    TClassStreamer    *GetStreamer() const;
    ClassStreamerFunc_t GetStreamerFunc() const;
    ClassConvStreamerFunc_t GetConvStreamerFunc() const;
+   ClassStreamerFunc_t GetDirectStreamerFunc() const { return fDirectStreamerFunc; }
    const TObjArray          *GetStreamerInfos() const { return fStreamerInfo; }
    TVirtualStreamerInfo     *GetStreamerInfo(Int_t version=0, Bool_t isTransient = kFALSE) const;
    TVirtualStreamerInfo     *GetStreamerInfoAbstractEmulated(Int_t version=0) const;
@@ -568,6 +570,7 @@ public:
    void               SetMemberStreamer(const char *name, MemberStreamerFunc_t strm);
    void               SetStreamerFunc(ClassStreamerFunc_t strm);
    void               SetConvStreamerFunc(ClassConvStreamerFunc_t strm);
+   void               SetDirectStreamerFunc(ClassStreamerFunc_t strm);
 
    // Function to retrieve the TClass object and dictionary function
    static void           AddClass(TClass *cl);
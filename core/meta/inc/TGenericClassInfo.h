@@ -64,6 +64,7 @@ namespace ROOT {
       TClassStreamer             *fStreamer;
       ClassStreamerFunc_t         fStreamerFunc;
       ClassConvStreamerFunc_t     fConvStreamerFunc;
+      ClassStreamerFunc_t         fDirectStreamerFunc;
       TVirtualCollectionProxy    *fCollectionProxy;
       Int_t                       fSizeof;
       Int_t                       fPragmaBits;
@@ -138,6 +139,7 @@ namespace ROOT {
       Short_t                           SetStreamer(ClassStreamerFunc_t);
       void                              SetStreamerFunc(ClassStreamerFunc_t);
       void                              SetConvStreamerFunc(ClassConvStreamerFunc_t);
+      void                              SetDirectStreamerFunc(ClassStreamerFunc_t);
       Short_t                           SetVersion(Short_t version);
 
       //   protected:
@@ -269,6 +269,9 @@ public:
    virtual void   ReportDiagnosticsToErrorHandler(bool /*enable*/ = true) {}
    virtual void   SetTempLevel(int /* val */) const {}
    virtual int    UnloadFile(const char * /* path */) const {return 0;}
+   /// \brief Give back to the system the memory freed by the interpreter, e.g. after a phase of just-in-time
+   /// compilation.
+   virtual void   ReleaseMemory() {}
 
    /// The created temporary must be deleted by the caller.
    /// Deprecated! Please use MakeInterpreterValue().
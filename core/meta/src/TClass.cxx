@@ -70,6 +70,7 @@ In order to access the name of a class within the ROOT type system, the method T
 #include "TROOT.h"
 #include "TRealData.h"
 #include "TCheckHashRecursiveRemoveConsistency.h" // Private header
+#include "TClassLookupCache.h" // Private header
 #include "TStreamer.h"
 #include "TStreamerElement.h"
 #include "TVirtualStreamerInfo.h"
@@ -488,6 +489,51 @@ DeclIdMap_t *TClass::GetDeclIdMap() {
 #endif
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Lock-free cache of the loaded classes found by TClass::GetClass(const char*), keyed by the requested name.
+/// Entries are only inserted while holding ROOT::gCoreMutex, after finding the class in the list of classes.
+
+ROOT::Internal::TClassLookupCache &GetClassNameCache()
+{
+#ifdef R__COMPLETE_MEM_TERMINATION
+   static ROOT::Internal::TClassLookupCache gClassNameCacheObject;
+   return gClassNameCacheObject;
+#else
+   static ROOT::Internal::TClassLookupCache *gClassNameCache = new ROOT::Internal::TClassLookupCache;
+   return *gClassNameCache;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Lock-free cache of the loaded classes found by TClass::GetClass(const std::type_info&), keyed by the name of
+/// the type_info. Entries are only inserted while holding ROOT::gCoreMutex, after finding the class in the IdMap.
+
+ROOT::Internal::TClassLookupCache &GetClassTypeIdCache()
+{
+#ifdef R__COMPLETE_MEM_TERMINATION
+   static ROOT::Internal::TClassLookupCache gClassTypeIdCacheObject;
+   return gClassTypeIdCacheObject;
+#else
+   static ROOT::Internal::TClassLookupCache *gClassTypeIdCache = new ROOT::Internal::TClassLookupCache;
+   return *gClassTypeIdCache;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove a class from the lookup caches, once it has been removed from the list of classes and the IdMap.
+/// Taking the write lock waits for the lookups that might still insert it.
+
+void RemoveFromLookupCaches(TClass *cl)
+{
+   R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+   GetClassNameCache().Remove(cl);
+   GetClassTypeIdCache().Remove(cl);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// static: Add a class to the list and map of classes.
 
@@ -529,6 +575,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (oldcl->fClassInfo) {
       //GetDeclIdMap()->Remove((void*)(oldcl->fClassInfo));
    }
+   RemoveFromLookupCaches(oldcl);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2981,6 +3028,10 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    if (!gROOT->GetListOfClasses())  return nullptr;
 
+   // Classes already found and loaded are returned without taking any lock.
+   if (TClass *cached = GetClassNameCache().Find(name))
+      return cached;
+
    // FindObject will take the read lock before actually getting the
    // TClass pointer so we will need not get a partially initialized
    // object.
@@ -2988,16 +3039,30 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
 
    // Early return to release the lock without having to execute the
    // long-ish normalization.
-   if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) return cl;
+   if (cl && cl->IsLoaded()) {
+      R__READ_LOCKGUARD(ROOT::gCoreMutex);
+      // Check again under the lock that the class has not been removed in the meantime.
+      if (gROOT->GetListOfClasses()->FindObject(name) == cl)
+         GetClassNameCache().Insert(name, cl);
+      return cl;
+   }
+   if (cl && cl->TestBit(kUnloading)) return cl;
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
+   // Cache the classes found and loaded from here on, while we hold the write lock.
+   auto cacheLoaded = [name](TClass *found) {
+      if (found && found->IsLoaded())
+         GetClassNameCache().Insert(name, found);
+      return found;
+   };
+
    // Now that we got the write lock, another thread may have constructed the
    // TClass while we were waiting, so we need to do the checks again.
 
    cl = (TClass*)gROOT->GetListOfClasses()->FindObject(name);
    if (cl) {
-      if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cl;
+      if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cacheLoaded(cl);
 
       // We could speed-up some of the search by adding (the equivalent of)
       //
@@ -3039,7 +3104,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
       TClass *loadedcl = (dict)();
       if (loadedcl) {
          loadedcl->PostLoadCheck();
-         return loadedcl;
+         return cacheLoaded(loadedcl);
       }
 
       // We should really not fall through to here, but if we do, let's just
@@ -3059,7 +3124,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
          cl = (TClass*)gROOT->GetListOfClasses()->FindObject(normalizedName.c_str());
 
          if (cl) {
-            if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cl;
+            if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cacheLoaded(cl);
 
             //we may pass here in case of a dummy class created by TVirtualStreamerInfo
             load = kTRUE;
@@ -3132,7 +3197,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
          }
       }
    }
-   if (loadedcl) return loadedcl;
+   if (loadedcl) return cacheLoaded(loadedcl);
 
    // See if the TClassGenerator can produce the TClass we need.
    loadedcl = LoadClassCustom(normalizedName.c_str(),silent);
@@ -3256,12 +3321,19 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (!gROOT->GetListOfClasses())
       return nullptr;
 
+   // Classes already found and loaded are returned without taking any lock.
+   if (TClass *cached = GetClassTypeIdCache().Find(typeinfo.name()))
+      return cached;
+
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
    TClass* cl = GetIdMap()->Find(typeinfo.name());
 
-   if (cl && cl->IsLoaded()) return cl;
+   if (cl && cl->IsLoaded()) {
+      GetClassTypeIdCache().Insert(typeinfo.name(), cl);
+      return cl;
+   }
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -3271,7 +3343,10 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    cl = GetIdMap()->Find(typeinfo.name());
 
    if (cl) {
-      if (cl->IsLoaded()) return cl;
+      if (cl->IsLoaded()) {
+         GetClassTypeIdCache().Insert(typeinfo.name(), cl);
+         return cl;
+      }
       //we may pass here in case of a dummy class created by TVirtualStreamerInfo
       load = kTRUE;
    } else {
@@ -4611,6 +4686,13 @@ TVirtualStreamerInfo* TClass::GetStreamerInfo(Int_t version /* = 0 */, Bool_t is
    if (sinfo && sinfo->GetClassVersion() == version)
       return sinfo;
 
+   // When reading several versions of the class, fLastReadInfo alternates between
+   // them: the info of the current version is also available without the lock
+   // once it is compiled.
+   sinfo = fCurrentInfo;
+   if (sinfo && sinfo->GetClassVersion() == version && sinfo->IsCompiled())
+      return sinfo;
+
    // Note that the access to fClassVersion above is technically not thread-safe with a low probably of problems.
    // fClassVersion is not an atomic and is modified TClass::SetClassVersion (called from RootClassVersion via
    // ROOT::ResetClassVersion) and is 'somewhat' protected by the atomic fVersionUsed.
@@ -6324,6 +6406,7 @@ void TClass::SetUnloaded()
 
    // Make sure SetClassInfo, re-calculated the state.
    fState = kForwardDeclared;
+   RemoveFromLookupCaches(this);
 
    delete fIsA; fIsA = nullptr;
    // Disable the autoloader while calling SetClassInfo, to prevent
@@ -6962,6 +7045,19 @@ void TClass::SetConvStreamerFunc(ClassConvStreamerFunc_t strm)
    fCanSplit = -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the function streaming the data members of this class, generated by
+/// rootcling for the classes selected with the `directstreamer` option.
+///
+/// It is used by TBufferFile instead of the sequence of StreamerInfo actions
+/// when the StreamerInfo of the data has the version and the checksum of the
+/// class in memory; any schema evolution goes through the actions as usual.
+
+void TClass::SetDirectStreamerFunc(ClassStreamerFunc_t strm)
+{
+   fDirectStreamerFunc = strm;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Install a new wrapper around 'Merge'.
@@ -0,0 +1,147 @@
+// @(#)root/meta:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TClassLookupCache.h"
+
+#include <functional>
+
+namespace ROOT {
+namespace Internal {
+
+namespace {
+constexpr std::size_t kInitialCapacity = 1024;
+}
+
+TClassLookupCache::Table::Table(std::size_t capacity)
+   : fMask(capacity - 1), fSlots(new std::atomic<Node *>[capacity])
+{
+   for (std::size_t i = 0; i < capacity; ++i)
+      fSlots[i].store(nullptr, std::memory_order_relaxed);
+}
+
+TClassLookupCache::TClassLookupCache()
+{
+   fTables.emplace_back(new Table(kInitialCapacity));
+   fTable.store(fTables.back().get(), std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the TClass inserted with `key`, or nullptr if there is none. Does not take any lock.
+
+TClass *TClassLookupCache::Find(std::string_view key) const
+{
+   const std::size_t hash = std::hash<std::string_view>{}(key);
+   const Table *table = fTable.load(std::memory_order_acquire);
+   for (std::size_t i = hash & table->fMask, probe = 0; probe <= table->fMask; i = (i + 1) & table->fMask, ++probe) {
+      const Node *node = table->fSlots[i].load(std::memory_order_acquire);
+      if (!node)
+         return nullptr;
+      if (node->fHash == hash && node->fKey == key) {
+         if (TClass *cl = node->fClass.load(std::memory_order_acquire))
+            return cl;
+      }
+   }
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Map `key` to `cl`, replacing the previous entry for `key` if any.
+
+void TClassLookupCache::Insert(std::string_view key, TClass *cl)
+{
+   if (!cl)
+      return;
+   std::lock_guard<std::mutex> lock(fWriteMutex);
+   if (2 * (fNUsed + 1) > fTable.load(std::memory_order_relaxed)->fMask + 1)
+      Grow();
+
+   const std::size_t hash = std::hash<std::string_view>{}(key);
+   const Table *table = fTable.load(std::memory_order_relaxed);
+   std::size_t free = table->fMask + 1;
+   std::size_t i = hash & table->fMask;
+   for (;; i = (i + 1) & table->fMask) {
+      Node *node = table->fSlots[i].load(std::memory_order_relaxed);
+      if (!node)
+         break;
+      TClass *nodeClass = node->fClass.load(std::memory_order_relaxed);
+      if (nodeClass && node->fHash == hash && node->fKey == key) {
+         if (nodeClass == cl)
+            return;
+         break;
+      }
+      if (!nodeClass && free > table->fMask)
+         free = i;
+   }
+
+   Node *old = table->fSlots[i].load(std::memory_order_relaxed);
+   if (old) {
+      // replacing the entry of another class for the same key
+      auto range = fSlotsOfClass.equal_range(old->fClass.load(std::memory_order_relaxed));
+      for (auto it = range.first; it != range.second; ++it) {
+         if (it->second == i) {
+            fSlotsOfClass.erase(it);
+            break;
+         }
+      }
+      old->fClass.store(nullptr, std::memory_order_release);
+   } else if (free <= table->fMask) {
+      // reuse the first removed entry of the probe sequence
+      i = free;
+   } else {
+      ++fNUsed;
+   }
+
+   fNodes.emplace_back(new Node(hash, key, cl));
+   fSlotsOfClass.emplace(cl, i);
+   table->fSlots[i].store(fNodes.back().get(), std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all the entries of `cl`.
+
+void TClassLookupCache::Remove(TClass *cl)
+{
+   std::lock_guard<std::mutex> lock(fWriteMutex);
+   auto range = fSlotsOfClass.equal_range(cl);
+   if (range.first == range.second)
+      return;
+   const Table *table = fTable.load(std::memory_order_relaxed);
+   for (auto it = range.first; it != range.second; ++it)
+      table->fSlots[it->second].load(std::memory_order_relaxed)->fClass.store(nullptr, std::memory_order_release);
+   fSlotsOfClass.erase(range.first, range.second);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Publish a copy of the table without the removed entries, twice as large if it is more than a quarter full of
+/// entries. Called with fWriteMutex held.
+
+void TClassLookupCache::Grow()
+{
+   const Table *table = fTable.load(std::memory_order_relaxed);
+   const std::size_t capacity = table->fMask + 1;
+   const std::size_t newCapacity = 4 * fSlotsOfClass.size() >= capacity ? 2 * capacity : capacity;
+   std::unique_ptr<Table> newTable(new Table(newCapacity));
+   std::unordered_multimap<TClass *, std::size_t> newSlotsOfClass;
+   for (const auto &entry : fSlotsOfClass) {
+      Node *node = table->fSlots[entry.second].load(std::memory_order_relaxed);
+      std::size_t i = node->fHash & newTable->fMask;
+      while (newTable->fSlots[i].load(std::memory_order_relaxed))
+         i = (i + 1) & newTable->fMask;
+      newTable->fSlots[i].store(node, std::memory_order_relaxed);
+      newSlotsOfClass.emplace(entry.first, i);
+   }
+   fNUsed = newSlotsOfClass.size();
+   fSlotsOfClass.swap(newSlotsOfClass);
+   fTables.emplace_back(std::move(newTable));
+   fTable.store(fTables.back().get(), std::memory_order_release);
+}
+
+} // namespace Internal
+} // namespace ROOT
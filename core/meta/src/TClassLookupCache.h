@@ -0,0 +1,78 @@
+// @(#)root/meta:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TClassLookupCache
+#define ROOT_TClassLookupCache
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+class TClass;
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ Lock-free cache of the TClass already resolved by TClass::GetClass, keyed by a class name or a typeid name.
+
+ Find() does not take any lock, so that threads looking up the same, already loaded, classes do not contend on
+ ROOT::gCoreMutex. Insert() and Remove() are serialized by a mutex of the cache. The table uses open addressing
+ and is replaced by a larger copy when it fills up. The entries are shared by the copies and a removed entry keeps
+ its slot with a null class, so that a Find() still reading a replaced table sees the removal; the replaced tables
+ and all the entries ever inserted are only freed with the cache.
+
+ Only loaded classes are inserted, and TClass::RemoveClass removes a class from the cache before it is deleted or
+ replaced.
+*/
+class TClassLookupCache {
+   struct Node {
+      Node(std::size_t hash, std::string_view key, TClass *cl) : fHash(hash), fKey(key), fClass(cl) {}
+      const std::size_t fHash;
+      const std::string fKey;
+      std::atomic<TClass *> fClass; ///< nullptr once the entry is removed
+   };
+
+   struct Table {
+      std::size_t fMask;
+      std::unique_ptr<std::atomic<Node *>[]> fSlots;
+      explicit Table(std::size_t capacity);
+   };
+
+   std::atomic<const Table *> fTable{nullptr};
+
+   // The members below are protected by fWriteMutex
+   std::mutex fWriteMutex;
+   std::size_t fNUsed = 0;                                    ///< Number of non-empty slots (entries and tombstones)
+   std::unordered_multimap<TClass *, std::size_t> fSlotsOfClass; ///< Slots of the entries of each class
+   std::vector<std::unique_ptr<Node>> fNodes;                 ///< Entries ever inserted
+   std::vector<std::unique_ptr<const Table>> fTables;         ///< Tables ever published
+
+   void Grow();
+
+public:
+   TClassLookupCache();
+   TClassLookupCache(const TClassLookupCache &) = delete;
+   TClassLookupCache &operator=(const TClassLookupCache &) = delete;
+
+   TClass *Find(std::string_view key) const;
+   void Insert(std::string_view key, TClass *cl);
+   void Remove(TClass *cl);
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -94,7 +94,7 @@ namespace Internal {
         fIsA(isa),
         fVersion(1),
         fMerge(nullptr),fResetAfterMerge(nullptr),fNew(nullptr),fNewArray(nullptr),fDelete(nullptr),fDeleteArray(nullptr),fDestructor(nullptr), fDirAutoAdd(nullptr), fStreamer(nullptr),
-        fStreamerFunc(nullptr), fConvStreamerFunc(nullptr), fCollectionProxy(nullptr), fSizeof(sizof), fPragmaBits(pragmabits),
+        fStreamerFunc(nullptr), fConvStreamerFunc(nullptr), fDirectStreamerFunc(nullptr), fCollectionProxy(nullptr), fSizeof(sizof), fPragmaBits(pragmabits),
         fCollectionProxyInfo(nullptr), fCollectionStreamerInfo(nullptr)
    {
       // Constructor.
@@ -114,7 +114,7 @@ namespace Internal {
         fIsA(isa),
         fVersion(version),
         fMerge(nullptr),fResetAfterMerge(nullptr),fNew(nullptr),fNewArray(nullptr),fDelete(nullptr),fDeleteArray(nullptr),fDestructor(nullptr), fDirAutoAdd(nullptr), fStreamer(nullptr),
-        fStreamerFunc(nullptr), fConvStreamerFunc(nullptr), fCollectionProxy(nullptr), fSizeof(sizof), fPragmaBits(pragmabits),
+        fStreamerFunc(nullptr), fConvStreamerFunc(nullptr), fDirectStreamerFunc(nullptr), fCollectionProxy(nullptr), fSizeof(sizof), fPragmaBits(pragmabits),
         fCollectionProxyInfo(nullptr), fCollectionStreamerInfo(nullptr)
 
    {
@@ -136,7 +136,7 @@ namespace Internal {
         fIsA(nullptr),
         fVersion(version),
         fMerge(nullptr),fResetAfterMerge(nullptr),fNew(nullptr),fNewArray(nullptr),fDelete(nullptr),fDeleteArray(nullptr),fDestructor(nullptr), fDirAutoAdd(nullptr), fStreamer(nullptr),
-        fStreamerFunc(nullptr), fConvStreamerFunc(nullptr), fCollectionProxy(nullptr), fSizeof(0), fPragmaBits(pragmabits),
+        fStreamerFunc(nullptr), fConvStreamerFunc(nullptr), fDirectStreamerFunc(nullptr), fCollectionProxy(nullptr), fSizeof(0), fPragmaBits(pragmabits),
         fCollectionProxyInfo(nullptr), fCollectionStreamerInfo(nullptr)
 
    {
@@ -271,6 +271,7 @@ namespace Internal {
          fClass->SetDirectoryAutoAdd(fDirAutoAdd);
          fClass->SetStreamerFunc(fStreamerFunc);
          fClass->SetConvStreamerFunc(fConvStreamerFunc);
+         fClass->SetDirectStreamerFunc(fDirectStreamerFunc);
          fClass->SetMerge(fMerge);
          fClass->SetResetAfterMerge(fResetAfterMerge);
          fClass->AdoptStreamer(fStreamer); fStreamer = nullptr;
@@ -510,6 +511,15 @@ namespace Internal {
       if (fClass) fClass->SetStreamerFunc(streamer);
    }
 
+   void TGenericClassInfo::SetDirectStreamerFunc(ClassStreamerFunc_t streamer)
+   {
+      // Set the function generated by rootcling to stream the data members
+      // of the class without going through its StreamerInfo actions.
+
+      fDirectStreamerFunc = streamer;
+      if (fClass) fClass->SetDirectStreamerFunc(streamer);
+   }
+
    void TGenericClassInfo::SetConvStreamerFunc(ClassConvStreamerFunc_t streamer)
    {
       // Set a wrapper around the Streamer member function.
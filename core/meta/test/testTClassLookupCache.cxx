@@ -0,0 +1,94 @@
+#include "../src/TClassLookupCache.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using ROOT::Internal::TClassLookupCache;
+
+namespace {
+
+// The cache never dereferences the TClass pointers
+TClass *FakeClass(std::size_t i)
+{
+   static char storage[100000];
+   return reinterpret_cast<TClass *>(&storage[i]);
+}
+
+} // anonymous namespace
+
+TEST(TClassLookupCache, InsertFindRemove)
+{
+   TClassLookupCache cache;
+   EXPECT_EQ(cache.Find("A"), nullptr);
+   cache.Insert("A", FakeClass(1));
+   cache.Insert("std::vector<A>", FakeClass(2));
+   cache.Insert("vector<A>", FakeClass(2));
+   EXPECT_EQ(cache.Find("A"), FakeClass(1));
+   EXPECT_EQ(cache.Find("vector<A>"), FakeClass(2));
+   EXPECT_EQ(cache.Find("std::vector<A>"), FakeClass(2));
+   EXPECT_EQ(cache.Find("B"), nullptr);
+
+   // replacing the class of a key
+   cache.Insert("A", FakeClass(3));
+   EXPECT_EQ(cache.Find("A"), FakeClass(3));
+   cache.Remove(FakeClass(1));
+   EXPECT_EQ(cache.Find("A"), FakeClass(3));
+
+   // all the keys of a class are removed
+   cache.Remove(FakeClass(2));
+   EXPECT_EQ(cache.Find("vector<A>"), nullptr);
+   EXPECT_EQ(cache.Find("std::vector<A>"), nullptr);
+   EXPECT_EQ(cache.Find("A"), FakeClass(3));
+
+   // a removed key can be inserted again
+   cache.Insert("vector<A>", FakeClass(4));
+   EXPECT_EQ(cache.Find("vector<A>"), FakeClass(4));
+}
+
+TEST(TClassLookupCache, Grow)
+{
+   TClassLookupCache cache;
+   const std::size_t n = 20000;
+   for (std::size_t i = 0; i < n; ++i)
+      cache.Insert("C" + std::to_string(i), FakeClass(i));
+   for (std::size_t i = 0; i < n; i += 2)
+      cache.Remove(FakeClass(i));
+   for (std::size_t i = 0; i < n; ++i)
+      EXPECT_EQ(cache.Find("C" + std::to_string(i)), i % 2 ? FakeClass(i) : nullptr);
+}
+
+TEST(TClassLookupCache, ConcurrentReaders)
+{
+   TClassLookupCache cache;
+   const std::size_t nStable = 100;
+   for (std::size_t i = 0; i < nStable; ++i)
+      cache.Insert("S" + std::to_string(i), FakeClass(i));
+
+   std::atomic<bool> done{false};
+   std::atomic<int> errors{0};
+   std::vector<std::thread> readers;
+   for (int t = 0; t < 4; ++t) {
+      readers.emplace_back([&]() {
+         while (!done) {
+            for (std::size_t i = 0; i < nStable; ++i) {
+               if (cache.Find("S" + std::to_string(i)) != FakeClass(i))
+                  ++errors;
+            }
+         }
+      });
+   }
+   // grow the table and remove entries while the readers run
+   for (std::size_t i = nStable; i < 20000; ++i) {
+      cache.Insert("T" + std::to_string(i), FakeClass(i));
+      if (i % 3 == 0)
+         cache.Remove(FakeClass(i));
+   }
+   done = true;
+   for (auto &reader : readers)
+      reader.join();
+   EXPECT_EQ(errors, 0);
+}
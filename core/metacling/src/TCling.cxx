@@ -130,6 +130,10 @@ clang/LLVM technology.
 #include <algorithm>
 #include <iostream>
 #include <cassert>
+#include <chrono>
+#if defined(__GLIBC__)
+#include <malloc.h> // malloc_trim
+#endif
 #include <map>
 #include <set>
 #include <stdexcept>
@@ -1053,6 +1057,80 @@ static bool LoadModule(const std::string &ModuleName, cling::Interpreter &interp
    return interp.loadModule(ModuleName, /*Complain=*/true);
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wall-clock times of the phases of the interpreter startup. Enabled by
+/// setting the environment variable ROOT_STARTUP_PROFILE, and reported at the
+/// end of TCling::Initialize().
+class TStartupProfile {
+   using Clock_t = std::chrono::steady_clock;
+
+   struct Phase_t {
+      std::string fName; // indented by the nesting level
+      double fSeconds;
+   };
+
+   bool fEnabled;
+   Clock_t::time_point fStart;
+   std::vector<Phase_t> fPhases; // in order of start
+   int fDepth = 0;               // nesting level of the next phase
+
+public:
+   TStartupProfile()
+      : fEnabled(llvm::sys::Process::GetEnv("ROOT_STARTUP_PROFILE").hasValue()), fStart(Clock_t::now()) {}
+
+   static TStartupProfile &Get()
+   {
+      static TStartupProfile profile;
+      return profile;
+   }
+
+   /// Measure the phase `name` until Stop() or the end of the scope of the object.
+   class TPhase {
+      TStartupProfile &fProfile;
+      bool fRunning = false;
+      size_t fIndex = 0;
+      Clock_t::time_point fPhaseStart;
+
+   public:
+      TPhase(const char *name) : fProfile(Get())
+      {
+         if (!fProfile.fEnabled)
+            return;
+         fRunning = true;
+         fIndex = fProfile.fPhases.size();
+         fProfile.fPhases.push_back({std::string(2 * fProfile.fDepth++, ' ') + name, 0.});
+         fPhaseStart = Clock_t::now();
+      }
+      ~TPhase() { Stop(); }
+      void Stop()
+      {
+         if (!fRunning)
+            return;
+         fRunning = false;
+         --fProfile.fDepth;
+         fProfile.fPhases[fIndex].fSeconds = std::chrono::duration<double>(Clock_t::now() - fPhaseStart).count();
+      }
+   };
+
+   /// Print the durations of the phases, the nested phases being indented below the phase containing them.
+   void Report()
+   {
+      if (!fEnabled || fPhases.empty())
+         return;
+      const double total = std::chrono::duration<double>(Clock_t::now() - fStart).count();
+      ::Info("TCling::Initialize", "startup profile (wall-clock time of the interpreter startup: %.1f ms)",
+             1e3 * total);
+      for (const auto &phase : fPhases)
+         ::Info("TCling::Initialize", "  %-40s %9.1f ms %5.1f%%", phase.fName.c_str(), 1e3 * phase.fSeconds,
+                100 * phase.fSeconds / total);
+      fPhases.clear();
+   }
+};
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Loads the C++ modules that we require to run any ROOT program. This is just
 /// supposed to make a C++ module from a modulemap available to the interpreter.
@@ -1195,9 +1273,12 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
    // Loading of a module might deserialize.
    cling::Interpreter::PushTransactionRAII deserRAII(&clingInterp);
 
+   TStartupProfile::TPhase profileModules("C++ modules");
+
    // Setup core C++ modules if we have any to setup.
 
    // Load libc and stl first.
+   TStartupProfile::TPhase profileSystemModules("system modules");
    // Load vcruntime module for windows
 #ifdef R__WIN32
    LoadModule("vcruntime", clingInterp);
@@ -1212,6 +1293,9 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
    LoadModule("std", clingInterp);
 
    LoadModule("_Builtin_intrinsics", clingInterp);
+   profileSystemModules.Stop();
+
+   TStartupProfile::TPhase profileCoreModules("core modules");
 
    // Load core modules
    // This should be vector in order to be able to pass it to LoadModules
@@ -1224,9 +1308,11 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
                                            "RIO"};
 
    LoadModules(CoreModules, clingInterp);
+   profileCoreModules.Stop();
 
    // Take this branch only from ROOT because we don't need to preload modules in rootcling
    if (!IsFromRootCling()) {
+      TStartupProfile::TPhase profilePreloaded("preloaded modules");
       std::vector<std::string> CommonModules = {"MathCore"};
       LoadModules(CommonModules, clingInterp);
 
@@ -1242,8 +1328,13 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
 
       LoadModules(FIXMEModules, clingInterp);
 
+      profilePreloaded.Stop();
+
       GlobalModuleIndex *GlobalIndex = nullptr;
-      loadGlobalModuleIndex(clingInterp);
+      {
+         TStartupProfile::TPhase profileIndex("global module index");
+         loadGlobalModuleIndex(clingInterp);
+      }
       // FIXME: The ASTReader still calls loadGlobalIndex and loads the file
       // We should investigate how to suppress it completely.
       GlobalIndex = CI.getASTReader()->getGlobalIndex();
@@ -1252,6 +1343,7 @@ static void RegisterCxxModules(cling::Interpreter &clingInterp)
       if (GlobalIndex)
          GlobalIndex->getKnownModuleFileNames(KnownModuleFileNames);
 
+      TStartupProfile::TPhase profileUnindexed("modules not in the global index");
       std::vector<std::string> PendingModules;
       PendingModules.reserve(256);
       for (auto I = MMap.module_begin(), E = MMap.module_end(); I != E; ++I) {
@@ -1347,6 +1439,8 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
   fPrevLoadedDynLibInfo(nullptr), fClingCallbacks(nullptr), fAutoLoadCallBack(nullptr),
   fTransactionCount(0), fHeaderParsingOnDemand(true), fIsAutoParsingSuspended(kFALSE)
 {
+   TStartupProfile::Get(); // start the clock of the startup profile
+
    fPrompt[0] = 0;
    const bool fromRootCling = IsFromRootCling();
 
@@ -1538,10 +1632,12 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
    if (!EnvOpt.hasValue())
       extensions.push_back(std::make_shared<TClingRdictModuleFileExtension>());
 
+   TStartupProfile::TPhase profileCreation("interpreter creation");
    fInterpreter = std::make_unique<cling::Interpreter>(interpArgs.size(),
                                                        &(interpArgs[0]),
                                                        llvmResourceDir, extensions,
                                                        interpLibHandle);
+   profileCreation.Stop();
 
    // Don't check whether modules' files exist.
    fInterpreter->getCI()->getPreprocessorOpts().DisablePCHOrModuleValidation =
@@ -1563,7 +1659,10 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
    fMetaProcessor = std::make_unique<cling::MetaProcessor>(*fInterpreter, fMPOuts);
 
    RegisterCxxModules(*fInterpreter);
-   RegisterPreIncludedHeaders(*fInterpreter);
+   {
+      TStartupProfile::TPhase profileHeaders("pre-included headers");
+      RegisterPreIncludedHeaders(*fInterpreter);
+   }
 
    // We are now ready (enough is loaded) to init the list of opaque typedefs.
    fNormalizedCtxt = new ROOT::TMetaUtils::TNormalizedCtxt(fInterpreter->getLookupHelper());
@@ -1614,6 +1713,7 @@ TCling::TCling(const char *name, const char *title, const char* const argv[], vo
          return stem.startswith("libNew") || stem.startswith("libcppyy_backend");
       };
       // Initialize the dyld for AutoloadLibraryGenerator.
+      TStartupProfile::TPhase profileDyld("dynamic library manager");
       DLM.initializeDyld(ShouldPermanentlyIgnore);
    }
 }
@@ -1653,10 +1753,19 @@ void TCling::Initialize()
    // *not* using them.
    // Note this call must happen before the first call to LoadLibraryMap.
    assert(GetRootMapFiles() == nullptr && "Must be called before LoadLibraryMap!");
-   TClass::ReadRules(); // Read the default customization rules ...
+   {
+      TStartupProfile::TPhase profileRules("customization rules");
+      TClass::ReadRules(); // Read the default customization rules ...
+   }
 
-   LoadLibraryMap();
+   {
+      TStartupProfile::TPhase profileRootmaps("rootmap files");
+      LoadLibraryMap();
+   }
    SetClassAutoLoading(true);
+
+   // Set ROOT_STARTUP_PROFILE to see where the startup time goes.
+   TStartupProfile::Get().Report();
 }
 
 void TCling::ShutDown()
@@ -7584,6 +7693,23 @@ int TCling::UnloadFile(const char* path) const
    return compRes == cling::Interpreter::kFailure;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Give back to the system the memory freed by the interpreter.
+///
+/// Parsing and code generation allocate and free a lot of temporary memory,
+/// which the C library keeps for later allocations: after the jitting phase of
+/// a batch job, it only adds to the resident memory of the process. With glibc,
+/// the free memory at the top of the heaps and the unused pages inside them are
+/// returned to the system. The ASTs and the generated code are not affected.
+
+void TCling::ReleaseMemory()
+{
+#if defined(__GLIBC__)
+   R__LOCKGUARD(gInterpreterMutex);
+   malloc_trim(0);
+#endif
+}
+
 std::unique_ptr<TInterpreterValue> TCling::MakeInterpreterValue() const {
    return std::unique_ptr<TInterpreterValue>(new TClingValue);
 }
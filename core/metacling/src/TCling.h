@@ -355,6 +355,7 @@ public: // Public Interface
    void   ReportDiagnosticsToErrorHandler(bool enable = true) final;
    void   SetTempLevel(int val) const final;
    int    UnloadFile(const char* path) const final;
+   void   ReleaseMemory() final;
 
    void   CodeComplete(const std::string&, size_t&,
                        std::vector<std::string>&) final;
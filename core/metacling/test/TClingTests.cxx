@@ -234,6 +234,16 @@ TEST_F(TClingTests, ClingLookupHelper) {
 }
 
 
+// The interpreter keeps working after giving back its free memory.
+TEST_F(TClingTests, ReleaseMemory)
+{
+   gInterpreter->Declare("int releaseMemoryBefore() { return 42; }");
+   gInterpreter->ReleaseMemory();
+   EXPECT_EQ(42, gInterpreter->Calc("releaseMemoryBefore()"));
+   gInterpreter->Declare("int releaseMemoryAfter() { return 43; }");
+   EXPECT_EQ(43, gInterpreter->Calc("releaseMemoryAfter()"));
+}
+
 // Check that compiled and interpreted statics share the same address.
 TEST_F(TClingTests, ROOT10499) {
 #if !defined(_MSC_VER) || defined(R__ENABLE_BROKEN_WIN_TESTS)
@@ -14,6 +14,109 @@
 #include "MPCode.h"
 #include <memory> //unique_ptr
 
+#ifdef __linux__
+#define R__MP_SHAREDMEM
+#include <cerrno>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+/// Set in the code of a message whose object is in a shared memory segment. The descriptor of the segment then
+/// follows the object size, attached to a single byte.
+constexpr unsigned kSharedMemFlag = 1u << 31;
+
+#ifdef R__MP_SHAREDMEM
+/// Send the file descriptor fd, attached to one byte, on the unix socket sock
+bool SendDescriptor(int sock, int fd)
+{
+   char byte = 0;
+   iovec iov{&byte, 1};
+   union {
+      cmsghdr fHeader;
+      char fBuf[CMSG_SPACE(sizeof(int))];
+   } control;
+   memset(&control, 0, sizeof(control));
+   msghdr msg{};
+   msg.msg_iov = &iov;
+   msg.msg_iovlen = 1;
+   msg.msg_control = control.fBuf;
+   msg.msg_controllen = sizeof(control.fBuf);
+   cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+   cmsg->cmsg_level = SOL_SOCKET;
+   cmsg->cmsg_type = SCM_RIGHTS;
+   cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+   memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
+   ssize_t n;
+   while ((n = sendmsg(sock, &msg, 0)) < 0 && errno == EINTR)
+      ;
+   return n == 1;
+}
+
+/// Receive a file descriptor sent with SendDescriptor on the unix socket sock. Return -1 on failure.
+int RecvDescriptor(int sock)
+{
+   char byte;
+   iovec iov{&byte, 1};
+   union {
+      cmsghdr fHeader;
+      char fBuf[CMSG_SPACE(sizeof(int))];
+   } control;
+   msghdr msg{};
+   msg.msg_iov = &iov;
+   msg.msg_iovlen = 1;
+   msg.msg_control = control.fBuf;
+   msg.msg_controllen = sizeof(control.fBuf);
+   ssize_t n;
+   while ((n = recvmsg(sock, &msg, MSG_CMSG_CLOEXEC)) < 0 && errno == EINTR)
+      ;
+   cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+   if (n != 1 || !cmsg || cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS)
+      return -1;
+   int fd;
+   memcpy(&fd, CMSG_DATA(cmsg), sizeof(int));
+   return fd;
+}
+
+/// Create an anonymous shared memory segment containing the len bytes of buf. Return -1 on failure.
+int CreateSegment(const char *buf, size_t len)
+{
+   const int fd = memfd_create("ROOT-MPResult", MFD_CLOEXEC);
+   if (fd < 0)
+      return -1;
+   size_t written = 0;
+   while (written < len) {
+      const ssize_t n = write(fd, buf + written, len - written);
+      if (n < 0 && errno == EINTR)
+         continue;
+      if (n <= 0) {
+         close(fd);
+         return -1;
+      }
+      written += n;
+   }
+   return fd;
+}
+
+/// A TBufferFile reading a shared memory segment mapped in memory, unmapped at destruction
+class TMappedBufferFile : public TBufferFile {
+   void *fAddress;
+   size_t fLength;
+
+public:
+   TMappedBufferFile(void *address, size_t length)
+      : TBufferFile(TBuffer::kRead, length, address, false), fAddress(address), fLength(length)
+   {
+   }
+   ~TMappedBufferFile() override { munmap(fAddress, fLength); }
+};
+#endif
+
+} // namespace
+
 //////////////////////////////////////////////////////////////////////////
 /// Send a message with the specified code on the specified socket.
 /// This standalone function can be used to send a code
@@ -38,6 +141,46 @@ int MPSend(TSocket *s, unsigned code)
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+/// Send a message with the specified code and the object serialized in
+/// objBuf on the specified socket.
+/// On Linux, the objects of at least ::kMPSharedMemThreshold bytes are not
+/// copied through the socket: they are written into an anonymous shared
+/// memory segment (memfd), whose descriptor is passed to the receiving process,
+/// which maps it in memory. MPRecv() handles both cases transparently.
+/// \param s a pointer to a valid TSocket. No validity checks are performed\n
+/// \param code the code to be sent
+/// \param objBuf the serialized object
+/// \return the number of bytes sent, as per TSocket::SendRaw
+int MPSendObjBuf(TSocket *s, unsigned code, const TBufferFile &objBuf)
+{
+   const ULong_t length = objBuf.Length();
+#ifdef R__MP_SHAREDMEM
+   if (length >= kMPSharedMemThreshold) {
+      const int fd = CreateSegment(objBuf.Buffer(), length);
+      if (fd >= 0) {
+         TBufferFile wBuf(TBuffer::kWrite);
+         wBuf.WriteUInt(code | kSharedMemFlag);
+         wBuf.WriteULong(length);
+         int nBytes = s->SendRaw(wBuf.Buffer(), wBuf.Length());
+         if (nBytes > 0 && SendDescriptor(s->GetDescriptor(), fd))
+            ++nBytes;
+         else
+            nBytes = -1;
+         close(fd);
+         return nBytes;
+      }
+      // could not create the segment, send the object through the socket
+   }
+#endif
+   TBufferFile wBuf(TBuffer::kWrite);
+   wBuf.WriteUInt(code);
+   wBuf.WriteULong(length);
+   if (length)
+      wBuf.WriteBuf(objBuf.Buffer(), length);
+   return s->SendRaw(wBuf.Buffer(), wBuf.Length());
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// Receive message from a socket.
 /// This standalone function can be used to read a message that
@@ -76,7 +219,21 @@ MPCodeBufPair MPRecv(TSocket *s)
 
    //receive object if needed
    std::unique_ptr<TBufferFile> objBuf; //defaults to nullptr
-   if (classBufSize != 0) {
+   if (code & kSharedMemFlag) {
+      //the object is in a shared memory segment (see MPSendObjBuf)
+      code &= ~kSharedMemFlag;
+#ifdef R__MP_SHAREDMEM
+      const int fd = RecvDescriptor(s->GetDescriptor());
+      void *address = fd < 0 ? MAP_FAILED : mmap(nullptr, classBufSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      if (fd >= 0)
+         close(fd);
+      if (address == MAP_FAILED)
+         return std::make_pair(MPCode::kRecvError, nullptr);
+      objBuf.reset(new TMappedBufferFile(address, classBufSize));
+#else
+      return std::make_pair(MPCode::kRecvError, nullptr);
+#endif
+   } else if (classBufSize != 0) {
       char *classBuf = new char[classBufSize];
       s->RecvRaw(classBuf, classBufSize);
       objBuf.reset(new TBufferFile(TBuffer::kRead, classBufSize, classBuf, true)); //the buffer is deleted by TBuffer's dtor
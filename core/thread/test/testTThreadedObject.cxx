@@ -180,3 +180,61 @@ TEST(TThreadedObject, GetNSlots)
 
    EXPECT_EQ(tto.GetNSlots(), 4u);
 }
+
+namespace {
+/// Runs each call of Foreach in its own thread
+struct ThreadPerTaskExecutor {
+   template <class F, class INTEGER>
+   void Foreach(F func, ROOT::TSeq<INTEGER> args)
+   {
+      std::vector<std::thread> threads;
+      for (auto i : args)
+         threads.emplace_back(func, i);
+      for (auto &t : threads)
+         t.join();
+   }
+};
+} // namespace
+
+TEST(TThreadedObject, ParallelMerge)
+{
+   ROOT::TThreadedObject<int> tto(ROOT::TNumSlots{7}, 0);
+   for (unsigned i = 0; i < 7; ++i)
+      tto.SetAtSlot(i, std::make_shared<int>(1 << i));
+
+   std::mutex m;
+   unsigned nCalls = 0;
+   auto sum_ints = [&](std::shared_ptr<int> first, std::vector<std::shared_ptr<int>> &all) {
+      for (auto &e : all)
+         if (e != first)
+            *first += *e;
+      std::lock_guard<std::mutex> lg(m);
+      ++nCalls;
+   };
+   ThreadPerTaskExecutor executor;
+   EXPECT_EQ(*tto.ParallelMerge(executor, sum_ints), 127);
+   EXPECT_EQ(nCalls, 6u);
+   EXPECT_EQ(*tto.GetAtSlot(0), 127);
+}
+
+TEST(TThreadedObject, PreMerge)
+{
+   TH1::AddDirectory(false);
+
+   ROOT::TThreadedObject<TH1F> tto("h", "h", 64, -4, 4);
+   auto task = [&tto] {
+      auto h = tto.Get();
+      for (int i = 0; i < 100; ++i)
+         h->Fill(0.5);
+      tto.PreMerge();
+   };
+   std::vector<std::thread> threads;
+   for (int i = 0; i < 8; ++i)
+      threads.emplace_back(task);
+   for (auto &t : threads)
+      t.join();
+
+   EXPECT_EQ(tto.SnapshotMerge()->GetEntries(), 800);
+   ThreadPerTaskExecutor executor;
+   EXPECT_EQ(tto.ParallelMerge(executor)->GetEntries(), 800);
+}
@@ -100,6 +100,26 @@ struct RCompressionSetting {
          kUndefined
       };
    };
+   struct EDictionary { /// Note: this is only temporarily a struct and will become a enum class hence the name
+                        /// convention used.
+      enum EValues {
+         /// No compression dictionary is trained
+         kNoDictionary = 0,
+         /// Number of baskets a ZSTD compression dictionary is trained from by default (see
+         /// TBranch::EnableCompressionDictionary)
+         kDefaultTrainingBaskets = 10,
+         /// Maximum size in bytes of a trained ZSTD compression dictionary
+         kDefaultMaxSize = 16 * 1024
+      };
+   };
+   struct ETuning { /// Note: this is only temporarily a struct and will become a enum class hence the name
+                    /// convention used.
+      enum EValues {
+         /// Number of baskets the compression settings of a branch are selected from by default (see
+         /// TBranch::EnableCompressionTuning)
+         kDefaultTrialBaskets = 2
+      };
+   };
 };
 
 enum ECompressionAlgorithm {
@@ -33,6 +33,59 @@ extern "C" void R__unzip(int *srcsize, unsigned char *src, int *tgtsize, unsigne
 
 extern "C" int R__unzip_header(int *srcsize, unsigned char *src, int *tgtsize);
 
+/**
+ * Compress the `srcsize` bytes of `src` into `tgt` as a sequence of independently compressed blocks, each with its
+ * own header, that can be decompressed one by one with R__unzip. The blocks are `blocksize` bytes long, kMAXZIPBUF
+ * if `blocksize` is 0, except the last one. Up to `nthreads` blocks are compressed concurrently; the result does not
+ * depend on the number of threads.
+ * Returns the total compressed size, or 0 if the data cannot be compressed or does not fit in the `tgtsize` bytes
+ * of `tgt`.
+ */
+extern "C" int R__zipBlocks(int cxlevel, int srcsize, char *src, int tgtsize, char *tgt,
+                            ROOT::RCompressionSetting::EAlgorithm::EValues, int blocksize, int nthreads);
+
+/**
+ * Decompress the sequence of compressed blocks of `src`, such as the ones written by R__zipBlocks, until `tgtsize`
+ * bytes are decompressed into `tgt` or the `srcsize` bytes of `src` are consumed. Up to `nthreads` blocks are
+ * decompressed concurrently. Returns the total decompressed size, or 0 in case of error.
+ */
+extern "C" int R__unzipBlocks(int srcsize, unsigned char *src, int tgtsize, unsigned char *tgt, int nthreads);
+
+/**
+ * Compression dictionaries, only supported by ZSTD: a dictionary trained from samples of small buffers similar to
+ * the ones to compress (e.g. the first baskets of a branch) improves both the compression ratio and the speed of
+ * these buffers.
+ *
+ * R__trainZipDictionary() trains a dictionary of at most `dictcapacity` bytes into `dict` from the `nsamples`
+ * samples concatenated in `samples`, whose sizes are given by `samplesizes`. Returns the size of the dictionary, or 0
+ * if the samples are not sufficient to train one.
+ *
+ * A dictionary must be registered with R__registerZipDictionary() to compress and decompress with it; the returned
+ * ID, or 0 if `dict` is not a valid dictionary, identifies it in the process. The ID is stored in the compressed
+ * buffers, and R__unzip() finds the dictionary to decompress them with by itself. Registrations are counted: the
+ * dictionary is freed when R__unregisterZipDictionary() has been called as many times as it was registered.
+ *
+ * R__zipDictionary() compresses like R__zipMultipleAlgorithm(), with the dictionary `dictid` if it is not 0 and the
+ * algorithm is ZSTD.
+ */
+extern "C" int R__trainZipDictionary(int nsamples, const char *samples, const int *samplesizes, int dictcapacity,
+                                     char *dict);
+extern "C" unsigned R__registerZipDictionary(int dictsize, const char *dict);
+extern "C" void R__unregisterZipDictionary(unsigned dictid);
+extern "C" void R__zipDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep,
+                                 ROOT::RCompressionSetting::EAlgorithm::EValues, unsigned dictid);
+
+/**
+ * Select the compression settings (algorithm * 100 + level) to compress buffers similar to the `nsamples` samples
+ * concatenated in `samples` with: each of the `ncandidates` settings of `candidates` is tried on all the samples,
+ * which are compressed and decompressed again. Among the candidates that decompress the samples at `minreadspeed`
+ * MB/s or more, the one giving the smallest compressed size is returned; if none is fast enough, the fastest one is
+ * returned. A `minreadspeed` of 0 selects the smallest compressed size. The samples must not be larger than
+ * kMAXZIPBUF. Returns -1 if there are no samples or no candidates.
+ */
+extern "C" int R__selectZipSettings(int nsamples, char *samples, const int *samplesizes, int ncandidates,
+                                    const int *candidates, double minreadspeed);
+
 enum { kMAXZIPBUF = 0xffffff };
 
 #endif
@@ -16,8 +16,15 @@
 
 #include "zlib.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdio>
 #include <cassert>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
 
 // The size of the ROOT block framing headers for compression:
 // - 3 bytes to identify the compression algorithm and version.
@@ -110,6 +117,100 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
   }
 }
 
+int R__trainZipDictionary(int nsamples, const char *samples, const int *samplesizes, int dictcapacity, char *dict)
+{
+  return R__trainZSTDDictionary(nsamples, samples, samplesizes, dictcapacity, dict);
+}
+
+unsigned R__registerZipDictionary(int dictsize, const char *dict)
+{
+  return R__registerZSTDDictionary(dictsize, dict);
+}
+
+void R__unregisterZipDictionary(unsigned dictid)
+{
+  R__unregisterZSTDDictionary(dictid);
+}
+
+void R__zipDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm, unsigned dictid)
+{
+  if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal) {
+    compressionAlgorithm = R__ZipMode;
+  }
+  if (dictid == 0 || compressionAlgorithm != ROOT::RCompressionSetting::EAlgorithm::kZSTD) {
+    R__zipMultipleAlgorithm(cxlevel, srcsize, src, tgtsize, tgt, irep, compressionAlgorithm);
+    return;
+  }
+  if (*srcsize < 1 + HDRSIZE + 1 || cxlevel <= 0) {
+    *irep = 0;
+    return;
+  }
+  R__zipZSTDDictionary(cxlevel, srcsize, src, tgtsize, tgt, irep, dictid);
+}
+
+int R__selectZipSettings(int nsamples, char *samples, const int *samplesizes, int ncandidates,
+                         const int *candidates, double minreadspeed)
+{
+  if (nsamples <= 0 || ncandidates <= 0)
+    return -1;
+
+  int maxsize = 0;
+  for (int i = 0; i < nsamples; ++i)
+    maxsize = std::max(maxsize, samplesizes[i]);
+  // Same margin as TBasket for the headers of an incompressible buffer.
+  std::vector<char> zipped(maxsize + HDRSIZE + 28);
+  std::vector<unsigned char> unzipped(maxsize);
+
+  int best = -1, fastest = -1;
+  long long bestsize = 0;
+  double fastestspeed = 0;
+  for (int c = 0; c < ncandidates; ++c) {
+    const int algorithm = candidates[c] / 100;
+    const int level = candidates[c] % 100;
+    long long zipsize = 0;
+    long long rawsize = 0;
+    double seconds = 0;
+    char *src = samples;
+    for (int i = 0; i < nsamples; src += samplesizes[i], ++i) {
+      int srcsize = samplesizes[i];
+      int tgtsize = zipped.size();
+      int nout = 0;
+      R__zipMultipleAlgorithm(level, &srcsize, src, &tgtsize, zipped.data(), &nout,
+                              static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(algorithm));
+      rawsize += samplesizes[i];
+      if (nout <= 0 || nout >= samplesizes[i]) {
+        // Stored uncompressed, as the baskets and pages would be: costs nothing to read.
+        zipsize += samplesizes[i];
+        continue;
+      }
+      zipsize += nout;
+      // Keep the fastest of a few decompressions, the first one also warms up the caches.
+      double sample = -1;
+      for (int rep = 0; rep < 3; ++rep) {
+        int zipinsize = nout;
+        int unzipsize = samplesizes[i];
+        int irep = 0;
+        const auto start = std::chrono::steady_clock::now();
+        R__unzip(&zipinsize, reinterpret_cast<unsigned char *>(zipped.data()), &unzipsize, unzipped.data(), &irep);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        if (sample < 0 || elapsed.count() < sample)
+          sample = elapsed.count();
+      }
+      seconds += sample;
+    }
+    const double speed = seconds > 0 ? rawsize / seconds / 1.e6 : std::numeric_limits<double>::max();
+    if (speed >= minreadspeed && (best < 0 || zipsize < bestsize)) {
+      best = c;
+      bestsize = zipsize;
+    }
+    if (fastest < 0 || speed > fastestspeed) {
+      fastest = c;
+      fastestspeed = speed;
+    }
+  }
+  return candidates[best >= 0 ? best : fastest];
+}
+
   // The very old algorithm for backward compatibility
   // 0 for selecting with R__ZipMode in a backward compatible way
   // 3 for selecting in other cases
@@ -244,6 +345,84 @@ void R__zip(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *
                            ROOT::RCompressionSetting::EAlgorithm::kUseGlobal);
 }
 
+/* Call `func(i)` for i in [0, n), on up to `nthreads` threads including the calling one */
+template <typename F>
+static void R__ForEachBlock(int n, int nthreads, F func)
+{
+   std::atomic<int> next(0);
+   auto work = [&]() {
+      for (int i = next++; i < n; i = next++)
+         func(i);
+   };
+   std::vector<std::thread> threads;
+   for (int t = 1; t < std::min(n, nthreads); ++t)
+      threads.emplace_back(work);
+   work();
+   for (auto &thread : threads)
+      thread.join();
+}
+
+int R__zipBlocks(int cxlevel, int srcsize, char *src, int tgtsize, char *tgt,
+                 ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm, int blocksize, int nthreads)
+{
+   if (srcsize <= 0)
+      return 0;
+   if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal)
+      compressionAlgorithm = R__ZipMode;
+   // the old algorithm keeps its state in globals
+   if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kOldCompressionAlgo ||
+       compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal)
+      nthreads = 1;
+   if (blocksize <= 0 || blocksize > kMAXZIPBUF)
+      blocksize = kMAXZIPBUF;
+   const int nblocks = (srcsize - 1) / blocksize + 1;
+
+   if (nthreads <= 1 || nblocks == 1) {
+      int noutot = 0;
+      for (int i = 0; i < nblocks; ++i) {
+         int bufmax = std::min(blocksize, srcsize - i * blocksize);
+         // some algorithms write up to tgtmax bytes after the header
+         int tgtmax = std::min(bufmax, tgtsize - noutot - HDRSIZE);
+         int nout = 0;
+         if (tgtmax > 0)
+            R__zipMultipleAlgorithm(cxlevel, &bufmax, src + i * blocksize, &tgtmax, tgt + noutot, &nout,
+                                    compressionAlgorithm);
+         if (nout == 0)
+            return 0;
+         noutot += nout;
+      }
+      return noutot;
+   }
+
+   // Each block is compressed into its own buffer, the compressed blocks are then concatenated
+   std::vector<std::vector<char>> zipped(nblocks);
+   std::atomic<bool> failed(false);
+   R__ForEachBlock(nblocks, nthreads, [&](int i) {
+      if (failed)
+         return;
+      int bufmax = std::min(blocksize, srcsize - i * blocksize);
+      int tgtmax = bufmax;
+      int nout = 0;
+      zipped[i].resize(bufmax + HDRSIZE);
+      R__zipMultipleAlgorithm(cxlevel, &bufmax, src + i * blocksize, &tgtmax, zipped[i].data(), &nout,
+                              compressionAlgorithm);
+      if (nout == 0)
+         failed = true;
+      zipped[i].resize(nout);
+   });
+   if (failed)
+      return 0;
+
+   int noutot = 0;
+   for (auto &block : zipped) {
+      if (noutot + (int)block.size() > tgtsize)
+         return 0;
+      memcpy(tgt + noutot, block.data(), block.size());
+      noutot += block.size();
+   }
+   return noutot;
+}
+
 /**
  * Below are the routines for unzipping (inflating) buffers.
  */
@@ -421,3 +600,50 @@ void R__unzipZLIB(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
      *irep = stream.total_out;
      return;
 }
+
+int R__unzipBlocks(int srcsize, unsigned char *src, int tgtsize, unsigned char *tgt, int nthreads)
+{
+   // Locate the blocks from their headers first: the decompressed size of each is known from its header
+   struct RBlock {
+      int fSrcOffset;
+      int fSrcSize;
+      int fTgtOffset;
+      int fTgtSize;
+   };
+   std::vector<RBlock> blocks;
+   int nin = 0, nin_tot = 0, nbuf = 0, nout_tot = 0;
+   while (nout_tot < tgtsize && nin_tot + HDRSIZE <= srcsize) {
+      if (R__unzip_header(&nin, src + nin_tot, &nbuf) != 0)
+         break;
+      if (nin_tot + nin > srcsize)
+         break;
+      if (is_valid_header_old(src + nin_tot))
+         nthreads = 1; // the old format can need a few more bytes than announced
+      blocks.push_back({nin_tot, nin, nout_tot, std::min(nbuf, tgtsize - nout_tot)});
+      nin_tot += nin;
+      nout_tot += nbuf;
+   }
+   if (blocks.empty())
+      return 0;
+
+   std::atomic<bool> failed(false);
+   std::atomic<int> noutot(0);
+   auto unzipBlock = [&](int i) {
+      if (failed)
+         return;
+      int bufin = blocks[i].fSrcSize;
+      int bufout = blocks[i].fTgtSize;
+      int nout = 0;
+      R__unzip(&bufin, src + blocks[i].fSrcOffset, &bufout, tgt + blocks[i].fTgtOffset, &nout);
+      if (nout == 0)
+         failed = true;
+      noutot += nout;
+   };
+   if (nthreads <= 1) {
+      for (int i = 0; i < (int)blocks.size() && !failed; ++i)
+         unzipBlock(i);
+   } else {
+      R__ForEachBlock(blocks.size(), nthreads, unzipBlock);
+   }
+   return failed ? 0 : noutot.load();
+}
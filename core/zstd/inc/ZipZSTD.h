@@ -17,6 +17,10 @@ extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+void R__zipZSTDDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned dictid);
+int R__trainZSTDDictionary(int nsamples, const char *samples, const int *samplesizes, int dictcapacity, char *dict);
+unsigned R__registerZSTDDictionary(int dictsize, const char *dict);
+void R__unregisterZSTDDictionary(unsigned dictid);
 #ifdef __cplusplus
 }
 #endif
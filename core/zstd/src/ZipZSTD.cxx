@@ -14,7 +14,12 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <iostream>
 
@@ -22,17 +27,95 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
-void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+namespace {
+
+/// A dictionary of the registry: its content, and the digested forms ZSTD compresses (one per compression level)
+/// and decompresses with.
+struct RZSTDDictionary {
+   std::string fContent;
+   ZSTD_DDict *fDDict = nullptr;
+   std::map<int, ZSTD_CDict *> fCDicts;
+   int fRefCount = 0;
+
+   ~RZSTDDictionary()
+   {
+      ZSTD_freeDDict(fDDict);
+      for (auto &cdict : fCDicts)
+         ZSTD_freeCDict(cdict.second);
+   }
+};
+
+/// The process-wide registry of dictionaries, indexed by the ID that ZSTD stores in the frames compressed with them.
+struct RZSTDDictionaryRegistry {
+   std::mutex fMutex;
+   std::unordered_map<unsigned, std::shared_ptr<RZSTDDictionary>> fDictionaries;
+
+   static RZSTDDictionaryRegistry &Instance()
+   {
+      static RZSTDDictionaryRegistry registry;
+      return registry;
+   }
+
+   /// The dictionary with ID `dictid`, or nullptr if it is not registered. The dictionary stays valid as long as
+   /// the returned pointer, even if it is unregistered meanwhile.
+   std::shared_ptr<RZSTDDictionary> Find(unsigned dictid)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto it = fDictionaries.find(dictid);
+      return it == fDictionaries.end() ? nullptr : it->second;
+   }
+
+   /// The digested form of `dict` for a compression at `level`, created on first use. Must be called while
+   /// holding a pointer to `dict` returned by Find().
+   ZSTD_CDict *GetCDict(RZSTDDictionary &dict, int level)
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto &cdict = dict.fCDicts[level];
+      if (!cdict)
+         cdict = ZSTD_createCDict(dict.fContent.data(), dict.fContent.size(), level);
+      return cdict;
+   }
+};
+
+} // anonymous namespace
+
+static void R__writeHeaderZSTD(char *tgt, size_t deflate_size, size_t inflate_size)
+{
+    tgt[0] = 'Z';
+    tgt[1] = 'S';
+    tgt[2] = '\1';
+    tgt[3] = deflate_size & 0xff;
+    tgt[4] = (deflate_size >> 8) & 0xff;
+    tgt[5] = (deflate_size >> 16) & 0xff;
+    tgt[6] = inflate_size & 0xff;
+    tgt[7] = (inflate_size >> 8) & 0xff;
+    tgt[8] = (inflate_size >> 16) & 0xff;
+}
+
+static void R__zipZSTDImpl(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned dictid)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
     Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
 
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    size_t retval;
+    if (dictid) {
+        auto dict = RZSTDDictionaryRegistry::Instance().Find(dictid);
+        ZSTD_CDict *cdict = dict ? RZSTDDictionaryRegistry::Instance().GetCDict(*dict, 2*cxlevel) : nullptr;
+        if (R__unlikely(!cdict)) {
+            std::cerr << "Error in zip ZSTD. Dictionary " << dictid << " is not registered." << std::endl;
+            return;
+        }
+        retval = ZSTD_compress_usingCDict(fCtx.get(),
+                                          &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                          src, static_cast<size_t>(*srcsize), cdict);
+    } else {
+        retval = ZSTD_compressCCtx(fCtx.get(),
+                                   &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                   src, static_cast<size_t>(*srcsize),
+                                   2*cxlevel);
+    }
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -45,17 +128,68 @@ void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, i
         *irep = static_cast<size_t>(retval + kHeaderSize);
     }
 
-    size_t deflate_size = retval;
-    size_t inflate_size = static_cast<size_t>(*srcsize);
-    tgt[0] = 'Z';
-    tgt[1] = 'S';
-    tgt[2] = '\1';
-    tgt[3] = deflate_size & 0xff;
-    tgt[4] = (deflate_size >> 8) & 0xff;
-    tgt[5] = (deflate_size >> 16) & 0xff;
-    tgt[6] = inflate_size & 0xff;
-    tgt[7] = (inflate_size >> 8) & 0xff;
-    tgt[8] = (inflate_size >> 16) & 0xff;
+    R__writeHeaderZSTD(tgt, retval, static_cast<size_t>(*srcsize));
+}
+
+void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+    R__zipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, 0);
+}
+
+void R__zipZSTDDictionary(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned dictid)
+{
+    R__zipZSTDImpl(cxlevel, srcsize, src, tgtsize, tgt, irep, dictid);
+}
+
+int R__trainZSTDDictionary(int nsamples, const char *samples, const int *samplesizes, int dictcapacity, char *dict)
+{
+    if (nsamples <= 0 || dictcapacity <= 0)
+        return 0;
+    std::vector<size_t> sizes(samplesizes, samplesizes + nsamples);
+    size_t retval = ZDICT_trainFromBuffer(dict, static_cast<size_t>(dictcapacity), samples, sizes.data(),
+                                          static_cast<unsigned>(nsamples));
+    // Training fails on samples that are too few or too small: the caller then simply compresses without dictionary
+    if (ZDICT_isError(retval))
+        return 0;
+    return static_cast<int>(retval);
+}
+
+unsigned R__registerZSTDDictionary(int dictsize, const char *dict)
+{
+    unsigned dictid = dictsize > 0 ? ZDICT_getDictID(dict, static_cast<size_t>(dictsize)) : 0;
+    if (dictid == 0)
+        return 0; // not a dictionary, or raw content that ZSTD would not identify in the frames
+
+    auto &registry = RZSTDDictionaryRegistry::Instance();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    auto &entry = registry.fDictionaries[dictid];
+    if (entry) {
+        if (R__unlikely(entry->fContent.compare(0, std::string::npos, dict, dictsize) != 0)) {
+            std::cerr << "Error in R__registerZSTDDictionary: another dictionary with ID " << dictid <<
+            " is already registered." << std::endl;
+            return 0;
+        }
+    } else {
+        auto newdict = std::make_shared<RZSTDDictionary>();
+        newdict->fContent.assign(dict, dictsize);
+        newdict->fDDict = ZSTD_createDDict(newdict->fContent.data(), newdict->fContent.size());
+        if (!newdict->fDDict) {
+            registry.fDictionaries.erase(dictid);
+            return 0;
+        }
+        entry = std::move(newdict);
+    }
+    ++entry->fRefCount;
+    return dictid;
+}
+
+void R__unregisterZSTDDictionary(unsigned dictid)
+{
+    auto &registry = RZSTDDictionaryRegistry::Instance();
+    std::lock_guard<std::mutex> lock(registry.fMutex);
+    auto it = registry.fDictionaries.find(dictid);
+    if (it != registry.fDictionaries.end() && --it->second->fRefCount == 0)
+        registry.fDictionaries.erase(it);
 }
 
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep)
@@ -77,9 +211,26 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    // Frames compressed with a dictionary carry its ID: the dictionary must have been registered by the reader,
+    // e.g. TBranch registers the one of its baskets when it is read from the file.
+    size_t retval;
+    unsigned dictid = ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    if (dictid) {
+        auto dict = RZSTDDictionaryRegistry::Instance().Find(dictid);
+        if (R__unlikely(!dict)) {
+            std::cerr << "Error in unzip ZSTD. The buffer is compressed with the dictionary " << dictid <<
+            ", which is not registered." << std::endl;
+            return;
+        }
+        retval = ZSTD_decompress_usingDDict(fCtx.get(),
+                                            (char *)tgt, static_cast<size_t>(*tgtsize),
+                                            (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize),
+                                            dict->fDDict);
+    } else {
+        retval = ZSTD_decompressDCtx(fCtx.get(),
+                                     (char *)tgt, static_cast<size_t>(*tgtsize),
+                                     (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    }
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
@@ -25,7 +25,7 @@ class TGeoHMatrix;
 class TGeoBoolNode : public TObject {
 public:
    enum EGeoBoolType { kGeoUnion, kGeoIntersection, kGeoSubtraction };
-   struct ThreadData_t {
+   struct alignas(64) ThreadData_t { // one cache line per thread
       Int_t fSelected; // ! selected branch
 
       ThreadData_t();
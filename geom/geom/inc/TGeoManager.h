@@ -12,6 +12,7 @@
 #ifndef ROOT_TGeoManager
 #define ROOT_TGeoManager
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <map>
@@ -119,6 +120,7 @@ private:
    NavigatorsMap_t fNavigators;      //! Map between thread id's and navigator arrays
    static ThreadsMap_t *fgThreadId;  //! Thread id's map
    static Int_t fgNumThreads;        //! Number of registered threads
+   static std::atomic<Int_t> fgThreadsMapGeneration; //! Incremented when the map is cleared, invalidating cached ids
    static Bool_t fgLockNavigators;   //! Lock existing navigators
    TGeoNavigator *fCurrentNavigator; //! current navigator
    TGeoVolume *fCurrentVolume;       //! current volume
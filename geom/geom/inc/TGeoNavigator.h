@@ -104,6 +104,8 @@ public:
    TGeoNode *FindNextBoundary(Double_t stepmax = TGeoShape::Big(), const char *path = "", Bool_t frombdr = kFALSE);
    TGeoNode *FindNextDaughterBoundary(Double_t *point, Double_t *dir, Int_t &idaughter, Bool_t compmatrix = kFALSE);
    TGeoNode *FindNextBoundaryAndStep(Double_t stepmax = TGeoShape::Big(), Bool_t compsafe = kFALSE);
+   void FindNextBoundaryAndStep_v(Int_t npart, Double_t *points, const Double_t *dirs, Double_t *steps, TGeoNode **nodes,
+                                  Double_t stepmax = TGeoShape::Big());
    TGeoNode *FindNode(Bool_t safe_start = kTRUE);
    TGeoNode *FindNode(Double_t x, Double_t y, Double_t z);
    Double_t *FindNormal(Bool_t forward = kTRUE);
@@ -30,7 +30,7 @@ class TGeoMatrix;
 
 class TGeoPatternFinder : public TObject {
 public:
-   struct ThreadData_t {
+   struct alignas(64) ThreadData_t { // one cache line per thread
       TGeoMatrix *fMatrix; //! generic matrix
       Int_t fCurrent;      //! current division element
       Int_t fNextIndex;    //! index of next node
@@ -19,7 +19,7 @@
 
 class TGeoPgon : public TGeoPcon {
 public:
-   struct ThreadData_t {
+   struct alignas(64) ThreadData_t { // one cache line per thread
       Int_t *fIntBuffer;    //![fNedges+4] temporary int buffer array
       Double_t *fDblBuffer; //![fNedges+4] temporary double buffer array
 
@@ -108,13 +108,36 @@ public:
    using Vertex_t = Tessellated::Vertex_t;
 
 private:
-   int fNfacets = 0;                // Number of facets
-   int fNvert = 0;                  // Number of vertices
-   int fNseg = 0;                   // Number of segments
-   bool fDefined = false;           //! Shape fully defined
-   bool fClosedBody = false;        // The faces are making a closed body
-   std::vector<Vertex_t> fVertices; // List of vertices
-   std::vector<TGeoFacet> fFacets;  // List of facets
+   /// Triangle of the surface, as used by the navigation (quadrilateral facets are split in two)
+   struct Triangle_t {
+      Vertex_t fV0;     // first vertex
+      Vertex_t fE1;     // edge from the first to the second vertex
+      Vertex_t fE2;     // edge from the first to the third vertex
+      Vertex_t fNormal; // unit normal pointing outside
+   };
+
+   /// Node of the bounding volume hierarchy of the triangles. The first child of an inner node follows it in the
+   /// array, fFirst is the index of the second one. A leaf holds the fCount triangles starting at fFirst.
+   struct BVHNode_t {
+      double fMin[3];
+      double fMax[3];
+      int fFirst;
+      int fCount; // 0 for inner nodes
+   };
+
+   int fNfacets = 0;                   // Number of facets
+   int fNvert = 0;                     // Number of vertices
+   int fNseg = 0;                      // Number of segments
+   bool fDefined = false;              //! Shape fully defined
+   bool fClosedBody = false;           // The faces are making a closed body
+   std::vector<Vertex_t> fVertices;    // List of vertices
+   std::vector<TGeoFacet> fFacets;     // List of facets
+   std::vector<Triangle_t> fTriangles; //! Triangles of the facets, in the order of the BVH leaves
+   std::vector<BVHNode_t> fBVH;        //! Bounding volume hierarchy of the triangles
+
+   void BuildBVH();
+   double RayCast(const Vertex_t &point, const Vertex_t &dir, int side, int &itri) const;
+   double SafetyToSurface(const Vertex_t &point, int &itri) const;
 
    TGeoTessellated(const TGeoTessellated &) = delete;
    TGeoTessellated &operator=(const TGeoTessellated &) = delete;
@@ -127,7 +150,21 @@ public:
    // destructor
    ~TGeoTessellated() override {}
 
+   Double_t Capacity() const override;
    void ComputeBBox() override;
+   void ComputeNormal(const Double_t *point, const Double_t *dir, Double_t *norm) override;
+   Bool_t Contains(const Double_t *point) const override;
+   void Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const override;
+   Double_t DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact = 1, Double_t step = TGeoShape::Big(),
+                           Double_t *safe = nullptr) const override;
+   void DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
+                         Double_t *step) const override;
+   Double_t DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact = 1,
+                            Double_t step = TGeoShape::Big(), Double_t *safe = nullptr) const override;
+   void DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
+                          Double_t *step) const override;
+   Double_t Safety(const Double_t *point, Bool_t in = kTRUE) const override;
+   void Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const override;
    void CloseShape(bool check = true, bool fixFlipped = true, bool verbose = true);
 
    bool AddFacet(const Vertex_t &pt0, const Vertex_t &pt1, const Vertex_t &pt2);
@@ -164,8 +201,9 @@ public:
    /// Flip all facets
    void FlipFacets()
    {
-      for (auto facet : fFacets)
+      for (auto &facet : fFacets)
          facet.Flip();
+      BuildBVH();
    }
 
    bool CheckClosure(bool fixFlipped = true, bool verbose = true);
@@ -315,7 +315,7 @@ public:
 
 class TGeoVolumeAssembly : public TGeoVolume {
 public:
-   struct ThreadData_t {
+   struct alignas(64) ThreadData_t { // one cache line per thread
       Int_t fCurrent; //! index of current selected node
       Int_t fNext;    //! index of next node to be entered
 
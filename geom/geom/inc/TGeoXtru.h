@@ -21,7 +21,7 @@ class TGeoPolygon;
 
 class TGeoXtru : public TGeoBBox {
 public:
-   struct ThreadData_t {
+   struct alignas(64) ThreadData_t { // one cache line per thread
       Int_t fSeg;         // !current segment [0,fNvert-1]
       Int_t fIz;          // !current z plane [0,fNz-1]
       Double_t *fXc;      // ![fNvert] current X positions for polygon vertices
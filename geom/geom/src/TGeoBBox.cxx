@@ -1200,8 +1200,15 @@ void TGeoBBox::FillBuffer3D(TBuffer3D &buffer, Int_t reqSections, Bool_t localFr
 
 void TGeoBBox::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      inside[i] = Contains(&points[3 * i]);
+   // branch-free version of Contains, which the compiler can vectorize
+   const Double_t ox = fOrigin[0], oy = fOrigin[1], oz = fOrigin[2];
+   const Double_t dx = fDX, dy = fDY, dz = fDZ;
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t ax = TMath::Abs(points[3 * i] - ox);
+      const Double_t ay = TMath::Abs(points[3 * i + 1] - oy);
+      const Double_t az = TMath::Abs(points[3 * i + 2] - oz);
+      inside[i] = !(ax > dx) & !(ay > dy) & !(az > dz);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1219,10 +1226,26 @@ void TGeoBBox::ComputeNormal_v(const Double_t *points, const Double_t *dirs, Dou
 /// Compute distance from array of input points having directions specified by dirs. Store output in dists
 
 void TGeoBBox::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
-                                Double_t *step) const
+                                Double_t * /*step*/) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+   // branch-free version of DistFromInside(point, dir, 3, step), which the compiler can vectorize
+   const Double_t ox = fOrigin[0], oy = fOrigin[1], oz = fOrigin[2];
+   const Double_t dx = fDX, dy = fDY, dz = fDZ;
+   const Double_t big = TGeoShape::Big();
+   // distance to the face of half-length par crossed along dir, big if dir is 0; negative if already outside
+   auto distToFace = [](Double_t newpt, Double_t dir, Double_t par, Double_t big) {
+      const Double_t s = ((dir > 0) ? (par - newpt) : (-(par + newpt))) / ((dir != 0) ? dir : 1.);
+      return (dir != 0) ? s : big;
+   };
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t sx = distToFace(points[3 * i] - ox, dirs[3 * i], dx, big);
+      const Double_t sy = distToFace(points[3 * i + 1] - oy, dirs[3 * i + 1], dy, big);
+      const Double_t sz = distToFace(points[3 * i + 2] - oz, dirs[3 * i + 2], dz, big);
+      Double_t smin = (sx < big) ? sx : big;
+      smin = (sy < smin) ? sy : smin;
+      smin = (sz < smin) ? sz : smin;
+      dists[i] = (smin < 0) ? 0. : smin;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1231,8 +1254,38 @@ void TGeoBBox::DistFromInside_v(const Double_t *points, const Double_t *dirs, Do
 void TGeoBBox::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
                                  Double_t *step) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      dists[i] = DistFromOutside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+   // branch-free version of DistFromOutside(point, dir, 3, step), which the compiler can vectorize
+   const Double_t ox = fOrigin[0], oy = fOrigin[1], oz = fOrigin[2];
+   const Double_t dx = fDX, dy = fDY, dz = fDZ;
+   const Double_t big = TGeoShape::Big();
+   // distance along dir to the face of the first axis (half-length par) if the two other coordinates (half-lengths
+   // par1, par2) are then within the face, big otherwise
+   auto distToFace = [](Double_t saf, Double_t newpt, Double_t dir, Double_t newpt1, Double_t dir1, Double_t par1,
+                        Double_t newpt2, Double_t dir2, Double_t par2, Double_t big) {
+      const Bool_t towards = !(saf < 0) & !(newpt * dir >= 0);
+      const Double_t snxt = saf / (towards ? TMath::Abs(dir) : 1.);
+      Double_t dist = towards ? snxt : big;
+      dist = (TMath::Abs(newpt1 + snxt * dir1) > par1) ? big : dist;
+      dist = (TMath::Abs(newpt2 + snxt * dir2) > par2) ? big : dist;
+      return dist;
+   };
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t x = points[3 * i] - ox, y = points[3 * i + 1] - oy, z = points[3 * i + 2] - oz;
+      const Double_t ux = dirs[3 * i], uy = dirs[3 * i + 1], uz = dirs[3 * i + 2];
+      const Double_t safx = TMath::Abs(x) - dx, safy = TMath::Abs(y) - dy, safz = TMath::Abs(z) - dz;
+      // point inside: 0, unless it is exiting through the closest face
+      const Double_t safxy = (safy > safx) ? safy : safx;
+      const Double_t safmax = (safz > safxy) ? safz : safxy;
+      const Double_t exiting = (safz > safxy) ? z * uz : ((safy > safx) ? y * uy : x * ux);
+      const Double_t din = (exiting > 0) ? big : 0.;
+      // point outside: distance to the first face (in the order x, y, z) that is entered
+      const Double_t sx = distToFace(safx, x, ux, y, uy, dy, z, uz, dz, big);
+      const Double_t sy = distToFace(safy, y, uy, z, uz, dz, x, ux, dx, big);
+      const Double_t sz = distToFace(safz, z, uz, x, ux, dx, y, uy, dy, big);
+      const Double_t dout = (sx != big) ? sx : ((sy != big) ? sy : sz);
+      const Double_t dist = (safmax > 0) ? dout : din;
+      dists[i] = (safmax >= step[i]) ? big : dist;
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1242,6 +1295,17 @@ void TGeoBBox::DistFromOutside_v(const Double_t *points, const Double_t *dirs, D
 
 void TGeoBBox::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      safe[i] = Safety(&points[3 * i], inside[i]);
+   // branch-free version of Safety, which the compiler can vectorize
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t ax = TMath::Abs(points[3 * i] - fOrigin[0]);
+      const Double_t ay = TMath::Abs(points[3 * i + 1] - fOrigin[1]);
+      const Double_t az = TMath::Abs(points[3 * i + 2] - fOrigin[2]);
+      Double_t safin = fDX - ax;
+      safin = (fDY - ay < safin) ? fDY - ay : safin;
+      safin = (fDZ - az < safin) ? fDZ - az : safin;
+      Double_t safout = -fDX + ax;
+      safout = (-fDY + ay > safout) ? -fDY + ay : safout;
+      safout = (-fDZ + az > safout) ? -fDZ + az : safout;
+      safe[i] = inside[i] ? safin : safout;
+   }
 }
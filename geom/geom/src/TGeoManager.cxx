@@ -298,6 +298,7 @@ Int_t TGeoManager::fgMaxLevel = 1;
 Int_t TGeoManager::fgMaxDaughters = 1;
 Int_t TGeoManager::fgMaxXtruVert = 1;
 Int_t TGeoManager::fgNumThreads = 0;
+std::atomic<Int_t> TGeoManager::fgThreadsMapGeneration{0};
 UInt_t TGeoManager::fgExportPrecision = 17;
 TGeoManager::EDefaultUnits TGeoManager::fgDefaultUnits = TGeoManager::kRootUnits;
 TGeoManager::ThreadsMap_t *TGeoManager::fgThreadId = 0;
@@ -818,6 +819,8 @@ TGeoNavigator *TGeoManager::GetCurrentNavigator() const
    TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
    if (nav)
       return nav;
+   // other threads may be adding their navigators
+   std::lock_guard<std::mutex> guard(fgMutex);
    std::thread::id threadId = std::this_thread::get_id();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
    if (it == fNavigators.end())
@@ -939,6 +942,17 @@ void TGeoManager::SetMaxThreads(Int_t nthreads)
       ClearThreadsMap();
       ClearThreadData();
    }
+   // Navigation rebuilds the voxels invalidated by changes after closing the geometry on demand, which
+   // is not thread safe: do it now, so that the geometry is only read by the navigators from now on.
+   TIter next(fVolumes);
+   TGeoVolume *vol;
+   while ((vol = (TGeoVolume *)next())) {
+      TGeoVoxelFinder *voxels = vol->GetVoxels();
+      if (voxels && voxels->NeedRebuild()) {
+         voxels->Voxelize();
+         vol->FindOverlaps();
+      }
+   }
    fMaxThreads = nthreads + 1;
    if (fMaxThreads > 0) {
       fMultiThread = kTRUE;
@@ -987,32 +1001,36 @@ void TGeoManager::ClearThreadsMap()
    if (!fgThreadId->empty())
       fgThreadId->clear();
    fgNumThreads = 0;
+   ++fgThreadsMapGeneration;
    fgMutex.unlock();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Translates the current thread id to an ordinal number. This can be used to
-/// manage data which is specific for a given thread.
+/// manage data which is specific for a given thread. The id is cached by the
+/// calling thread, so that only its first call (or the first one after
+/// ClearThreadsMap) takes the lock.
 
 Int_t TGeoManager::ThreadId()
 {
    TTHREAD_TLS(Int_t) tid = -1;
-   Int_t ttid = tid; // TTHREAD_TLS_GET(Int_t,tid);
-   if (ttid > -1)
-      return ttid;
+   TTHREAD_TLS(Int_t) generation = -1;
+   if (tid > -1 && generation == fgThreadsMapGeneration.load(std::memory_order_acquire))
+      return tid;
    if (gGeoManager && !gGeoManager->IsMultiThread())
       return 0;
    std::thread::id threadId = std::this_thread::get_id();
+   std::lock_guard<std::mutex> guard(fgMutex);
    TGeoManager::ThreadsMapIt_t it = fgThreadId->find(threadId);
-   if (it != fgThreadId->end())
-      return it->second;
-   // Map needs to be updated.
-   fgMutex.lock();
-   (*fgThreadId)[threadId] = fgNumThreads;
-   tid = fgNumThreads; // TTHREAD_TLS_SET(Int_t,tid,fgNumThreads);
-   ttid = fgNumThreads++;
-   fgMutex.unlock();
-   return ttid;
+   if (it != fgThreadId->end()) {
+      tid = it->second;
+   } else {
+      // Map needs to be updated.
+      (*fgThreadId)[threadId] = fgNumThreads;
+      tid = fgNumThreads++;
+   }
+   generation = fgThreadsMapGeneration.load(std::memory_order_relaxed);
+   return tid;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
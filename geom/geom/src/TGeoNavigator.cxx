@@ -1533,6 +1533,29 @@ TGeoNode *TGeoNavigator::FindNextBoundaryAndStep(Double_t stepmax, Bool_t compsa
    return CrossBoundaryAndLocate(kTRUE, current);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Transport a basket of `npart` particles to their next boundary, or by STEPMAX
+/// if no boundary is found, as FindNextBoundaryAndStep does for the current point.
+/// The positions `points` and directions `dirs` are arrays of 3 * npart coordinates
+/// in MARS; the positions are replaced by the ones after the step. For each particle,
+/// `steps` receives the length of the step and `nodes` the node where the step ends,
+/// null if the particle left the geometry.
+///
+/// Each particle is located starting from the location of the previous one, which
+/// is fast when the particles of the basket are close, e.g. grouped by volume. The
+/// navigator is left in the state of the last particle.
+
+void TGeoNavigator::FindNextBoundaryAndStep_v(Int_t npart, Double_t *points, const Double_t *dirs, Double_t *steps,
+                                              TGeoNode **nodes, Double_t stepmax)
+{
+   for (Int_t i = 0; i < npart; i++) {
+      InitTrack(&points[3 * i], &dirs[3 * i]);
+      nodes[i] = FindNextBoundaryAndStep(stepmax);
+      steps[i] = fStep;
+      memcpy(&points[3 * i], fPoint, kN3);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns deepest node containing current point.
 
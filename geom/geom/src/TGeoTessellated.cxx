@@ -14,8 +14,15 @@
 \ingroup Geometry_classes
 
 Tessellated solid class. It is composed by a set of planar faces having triangular or
-quadrilateral shape. The class does not provide navigation functionality, it just wraps the data
-for the composing faces.
+quadrilateral shape.
+
+The navigation functions work on the triangles of the facets (quadrilaterals are split in two),
+organized at CloseShape() in a bounding volume hierarchy: a binary tree of axis-aligned boxes
+where each leaf holds a few triangles. The rays and the safety computations only visit the
+triangles of the boxes they reach, so their cost grows with the logarithm of the number of
+facets. The normals are oriented from the sign of the enclosed volume, so that the point
+classification does not depend on the order of the vertices of the facets, but it assumes a
+closed body.
 */
 
 #include <iostream>
@@ -30,6 +37,7 @@ for the composing faces.
 #include "TBuffer3DTypes.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <array>
 #include <vector>
 
@@ -208,9 +216,10 @@ TGeoTessellated::TGeoTessellated(const char *name, const std::vector<Vertex_t> &
 void TGeoTessellated::AfterStreamer()
 {
    // The pointer to the array of vertices is not streamed so update it to facets
-   for (auto facet : fFacets)
+   for (auto &facet : fFacets)
       facet.SetVertices(&fVertices);
    fDefined = true;
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -332,14 +341,14 @@ void TGeoTessellated::CloseShape(bool check, bool fixFlipped, bool verbose)
 
    if (fVertices.size() > 0) {
       fDefined = true;
-      if (!check)
-         return;
-
-      // Check facets
-      for (auto &facet : fFacets) {
-         facet.Check();
+      if (check) {
+         // Check facets
+         for (auto &facet : fFacets) {
+            facet.Check();
+         }
+         fClosedBody = CheckClosure(fixFlipped, verbose);
       }
-      fClosedBody = CheckClosure(fixFlipped, verbose);
+      BuildBVH();
       return;
    }
 
@@ -411,15 +420,15 @@ void TGeoTessellated::CloseShape(bool check, bool fixFlipped, bool verbose)
    fNvert = fVertices.size();
    fNfacets = fFacets.size();
    fDefined = true;
-   if (!check)
-      return;
+   if (check) {
+      // Check facets
+      for (auto &facet : fFacets) {
+         facet.Check();
+      }
 
-   // Check facets
-   for (auto &facet : fFacets) {
-      facet.Check();
+      fClosedBody = CheckClosure(fixFlipped, verbose);
    }
-
-   fClosedBody = CheckClosure(fixFlipped, verbose);
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -511,6 +520,388 @@ void TGeoTessellated::ComputeBBox()
       fOrigin[i] = 0.5 * (vmax[i] + vmin[i]);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Split the facets in triangles and build the bounding volume hierarchy used by the navigation
+/// functions. The normals are flipped if needed to point outside of the enclosed volume.
+
+void TGeoTessellated::BuildBVH()
+{
+   constexpr int kMaxLeafSize = 4;
+   fTriangles.clear();
+   fBVH.clear();
+   double volume = 0.;
+   for (const auto &facet : fFacets) {
+      for (int i = 1; i < facet.GetNvert() - 1; ++i) {
+         Triangle_t tri;
+         tri.fV0 = facet.GetVertex(0);
+         tri.fE1 = facet.GetVertex(i) - tri.fV0;
+         tri.fE2 = facet.GetVertex(i + 1) - tri.fV0;
+         tri.fNormal = Vertex_t::Cross(tri.fE1, tri.fE2);
+         if (tri.fNormal.Mag2() == 0.)
+            continue;
+         volume += tri.fV0.Dot(tri.fNormal);
+         tri.fNormal.Normalize();
+         fTriangles.push_back(tri);
+      }
+   }
+   if (fTriangles.empty())
+      return;
+   if (volume < 0.) {
+      for (auto &tri : fTriangles)
+         tri.fNormal = -1. * tri.fNormal;
+   }
+
+   // Top-down build: sort the triangles of a node by the position of their centers along the largest extent of the
+   // centers and split them at the median
+   std::vector<Vertex_t> centers(fTriangles.size());
+   std::vector<int> order(fTriangles.size());
+   for (size_t i = 0; i < fTriangles.size(); ++i) {
+      centers[i] = fTriangles[i].fV0 + (fTriangles[i].fE1 + fTriangles[i].fE2) / 3.;
+      order[i] = i;
+   }
+   fBVH.reserve(2 * fTriangles.size() / kMaxLeafSize + 1);
+   auto build = [&](auto &self, int first, int count) -> void {
+      const int inode = fBVH.size();
+      fBVH.push_back(BVHNode_t());
+      double cmin[3], cmax[3];
+      for (int j = 0; j < 3; ++j) {
+         fBVH[inode].fMin[j] = cmin[j] = TGeoShape::Big();
+         fBVH[inode].fMax[j] = cmax[j] = -TGeoShape::Big();
+      }
+      for (int i = first; i < first + count; ++i) {
+         const Triangle_t &tri = fTriangles[order[i]];
+         const Vertex_t v1 = tri.fV0 + tri.fE1;
+         const Vertex_t v2 = tri.fV0 + tri.fE2;
+         for (int j = 0; j < 3; ++j) {
+            fBVH[inode].fMin[j] = TMath::Min(fBVH[inode].fMin[j], TMath::Min(tri.fV0[j], TMath::Min(v1[j], v2[j])));
+            fBVH[inode].fMax[j] = TMath::Max(fBVH[inode].fMax[j], TMath::Max(tri.fV0[j], TMath::Max(v1[j], v2[j])));
+            cmin[j] = TMath::Min(cmin[j], centers[order[i]][j]);
+            cmax[j] = TMath::Max(cmax[j], centers[order[i]][j]);
+         }
+      }
+      if (count <= kMaxLeafSize) {
+         fBVH[inode].fFirst = first;
+         fBVH[inode].fCount = count;
+         return;
+      }
+      int axis = 0;
+      for (int j = 1; j < 3; ++j) {
+         if (cmax[j] - cmin[j] > cmax[axis] - cmin[axis])
+            axis = j;
+      }
+      const int half = count / 2;
+      std::nth_element(order.begin() + first, order.begin() + first + half, order.begin() + first + count,
+                       [&](int a, int b) { return centers[a][axis] < centers[b][axis]; });
+      fBVH[inode].fCount = 0;
+      self(self, first, half);
+      fBVH[inode].fFirst = fBVH.size();
+      self(self, first + half, count - half);
+   };
+   build(build, 0, fTriangles.size());
+
+   std::vector<Triangle_t> sorted(fTriangles.size());
+   for (size_t i = 0; i < order.size(); ++i)
+      sorted[i] = fTriangles[order[i]];
+   fTriangles.swap(sorted);
+}
+
+namespace {
+
+/// Distance along the ray (point, invdir) to the entry in the box [bmin, bmax], TGeoShape::Big() if the ray misses
+/// it or enters it beyond tmax
+double RayBoxEntry(const Vertex_t &point, const Vertex_t &invdir, const double *bmin, const double *bmax, double tmax)
+{
+   double tmin = 0.;
+   for (int j = 0; j < 3; ++j) {
+      double t1 = (bmin[j] - point[j]) * invdir[j];
+      double t2 = (bmax[j] - point[j]) * invdir[j];
+      // 0 * inf gives NaN for rays in the plane of a face, which are then treated as hitting the box
+      if (t1 > t2)
+         std::swap(t1, t2);
+      if (t1 > tmin)
+         tmin = t1;
+      if (t2 < tmax)
+         tmax = t2;
+      if (tmin > tmax)
+         return TGeoShape::Big();
+   }
+   return tmin;
+}
+
+/// Squared distance from point to the box [bmin, bmax], 0 inside
+double BoxDistance2(const Vertex_t &point, const double *bmin, const double *bmax)
+{
+   double d2 = 0.;
+   for (int j = 0; j < 3; ++j) {
+      const double d = TMath::Max(TMath::Max(bmin[j] - point[j], point[j] - bmax[j]), 0.);
+      d2 += d * d;
+   }
+   return d2;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along the ray (point, dir) to the first triangle crossed, TGeoShape::Big() if none. With side = 1
+/// (-1) only the triangles crossed from inside (outside) are considered, with side = 0 all of them. The index of
+/// the triangle is returned in itri.
+
+double TGeoTessellated::RayCast(const Vertex_t &point, const Vertex_t &dir, int side, int &itri) const
+{
+   constexpr double kBarycentricTolerance = 1.e-12;
+   itri = -1;
+   if (fBVH.empty())
+      return TGeoShape::Big();
+   const Vertex_t invdir(1. / dir[0], 1. / dir[1], 1. / dir[2]);
+   // Hits slightly behind the point are accepted, so that a point on the surface sees it
+   const double tolerance = TGeoShape::Tolerance();
+   double tbest = TGeoShape::Big();
+   int stack[64];
+   int nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack) {
+      const BVHNode_t &node = fBVH[stack[--nstack]];
+      if (RayBoxEntry(point, invdir, node.fMin, node.fMax, tbest + tolerance) >= TGeoShape::Big())
+         continue;
+      if (node.fCount == 0) {
+         stack[nstack++] = node.fFirst;
+         stack[nstack++] = &node - fBVH.data() + 1;
+         continue;
+      }
+      for (int i = node.fFirst; i < node.fFirst + node.fCount; ++i) {
+         const Triangle_t &tri = fTriangles[i];
+         const double cosa = dir.Dot(tri.fNormal);
+         if (side * cosa < 0. || cosa == 0.)
+            continue;
+         // Moeller-Trumbore intersection
+         const Vertex_t pvec = Vertex_t::Cross(dir, tri.fE2);
+         const double det = tri.fE1.Dot(pvec);
+         if (det == 0.)
+            continue;
+         const double invdet = 1. / det;
+         const Vertex_t tvec = point - tri.fV0;
+         const double u = tvec.Dot(pvec) * invdet;
+         if (u < -kBarycentricTolerance || u > 1. + kBarycentricTolerance)
+            continue;
+         const Vertex_t qvec = Vertex_t::Cross(tvec, tri.fE1);
+         const double v = dir.Dot(qvec) * invdet;
+         if (v < -kBarycentricTolerance || u + v > 1. + kBarycentricTolerance)
+            continue;
+         const double t = tri.fE2.Dot(qvec) * invdet;
+         if (t < -tolerance || t >= tbest)
+            continue;
+         tbest = t;
+         itri = i;
+      }
+   }
+   return tbest;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance from point to the closest triangle, whose index is returned in itri
+
+double TGeoTessellated::SafetyToSurface(const Vertex_t &point, int &itri) const
+{
+   itri = -1;
+   if (fBVH.empty())
+      return TGeoShape::Big();
+   double best2 = TGeoShape::Big();
+   int stack[64];
+   int nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack) {
+      const BVHNode_t &node = fBVH[stack[--nstack]];
+      if (BoxDistance2(point, node.fMin, node.fMax) >= best2)
+         continue;
+      if (node.fCount == 0) {
+         // Visit first the closest child, which makes the pruning of the other one more likely
+         const int first = &node - fBVH.data() + 1;
+         const int second = node.fFirst;
+         const bool firstCloser = BoxDistance2(point, fBVH[first].fMin, fBVH[first].fMax) <
+                                  BoxDistance2(point, fBVH[second].fMin, fBVH[second].fMax);
+         stack[nstack++] = firstCloser ? second : first;
+         stack[nstack++] = firstCloser ? first : second;
+         continue;
+      }
+      for (int i = node.fFirst; i < node.fFirst + node.fCount; ++i) {
+         // Closest point of the triangle, from the Voronoi regions of its vertices and edges (C. Ericson,
+         // Real-Time Collision Detection, 5.1.5)
+         const Triangle_t &tri = fTriangles[i];
+         const Vertex_t ap = point - tri.fV0;
+         const double d1 = tri.fE1.Dot(ap);
+         const double d2 = tri.fE2.Dot(ap);
+         Vertex_t closest;
+         if (d1 <= 0. && d2 <= 0.) {
+            closest = tri.fV0;
+         } else {
+            const Vertex_t bp = ap - tri.fE1;
+            const double d3 = tri.fE1.Dot(bp);
+            const double d4 = tri.fE2.Dot(bp);
+            const Vertex_t cp = ap - tri.fE2;
+            const double d5 = tri.fE1.Dot(cp);
+            const double d6 = tri.fE2.Dot(cp);
+            const double vc = d1 * d4 - d3 * d2;
+            const double vb = d5 * d2 - d1 * d6;
+            const double va = d3 * d6 - d5 * d4;
+            if (d3 >= 0. && d4 <= d3) {
+               closest = tri.fV0 + tri.fE1;
+            } else if (d6 >= 0. && d5 <= d6) {
+               closest = tri.fV0 + tri.fE2;
+            } else if (vc <= 0. && d1 >= 0. && d3 <= 0.) {
+               closest = tri.fV0 + (d1 / (d1 - d3)) * tri.fE1;
+            } else if (vb <= 0. && d2 >= 0. && d6 <= 0.) {
+               closest = tri.fV0 + (d2 / (d2 - d6)) * tri.fE2;
+            } else if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.) {
+               closest = tri.fV0 + tri.fE1 + ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (tri.fE2 - tri.fE1);
+            } else {
+               const double denom = 1. / (va + vb + vc);
+               closest = tri.fV0 + (vb * denom) * tri.fE1 + (vc * denom) * tri.fE2;
+            }
+         }
+         const double dist2 = (point - closest).Mag2();
+         if (dist2 < best2) {
+            best2 = dist2;
+            itri = i;
+         }
+      }
+   }
+   return TMath::Sqrt(best2);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Volume enclosed by the facets
+
+Double_t TGeoTessellated::Capacity() const
+{
+   double volume = 0.;
+   for (const auto &tri : fTriangles)
+      volume += tri.fV0.Dot(Vertex_t::Cross(tri.fE1, tri.fE2));
+   return TMath::Abs(volume) / 6.;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Normal to the closest facet, oriented along dir
+
+void TGeoTessellated::ComputeNormal(const Double_t *point, const Double_t *dir, Double_t *norm)
+{
+   int itri;
+   SafetyToSurface(Vertex_t(point[0], point[1], point[2]), itri);
+   if (itri < 0) {
+      TGeoBBox::ComputeNormal(point, dir, norm);
+      return;
+   }
+   const Vertex_t &normal = fTriangles[itri].fNormal;
+   const double sign = (normal[0] * dir[0] + normal[1] * dir[1] + normal[2] * dir[2] < 0.) ? -1. : 1.;
+   for (int j = 0; j < 3; ++j)
+      norm[j] = sign * normal[j];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Test if point is inside the solid: the first facet crossed by a ray from the point is crossed from inside
+
+Bool_t TGeoTessellated::Contains(const Double_t *point) const
+{
+   if (!TGeoBBox::Contains(point))
+      return kFALSE;
+   // A direction not aligned with the axes or the diagonals, which the facets and their edges often follow
+   static const Vertex_t kDir(0.4243449, 0.5632958, 0.7087320);
+   int itri;
+   RayCast(Vertex_t(point[0], point[1], point[2]), kDir, 0, itri);
+   return itri >= 0 && kDir.Dot(fTriangles[itri].fNormal) > 0.;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check the inside status for each of the points in the array.
+
+void TGeoTessellated::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
+{
+   for (Int_t i = 0; i < vecsize; i++)
+      inside[i] = Contains(&points[3 * i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from inside point to surface of the solid
+
+Double_t
+TGeoTessellated::DistFromInside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step, Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kTRUE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   int itri;
+   const double dist = RayCast(Vertex_t(point[0], point[1], point[2]), Vertex_t(dir[0], dir[1], dir[2]), 1, itri);
+   // No facet crossed from inside: the point is on the surface or outside
+   if (itri < 0)
+      return 0.;
+   return TMath::Max(dist, 0.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from array of input points having directions specified by dirs. Store output in dists
+
+void TGeoTessellated::DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
+                                       Double_t *step) const
+{
+   for (Int_t i = 0; i < vecsize; i++)
+      dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from outside point to surface of the solid
+
+Double_t TGeoTessellated::DistFromOutside(const Double_t *point, const Double_t *dir, Int_t iact, Double_t step,
+                                          Double_t *safe) const
+{
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kFALSE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   // Rays missing the bounding box miss the solid
+   if (TGeoBBox::DistFromOutside(point, dir, fDX, fDY, fDZ, fOrigin, step) >= TGeoShape::Big())
+      return TGeoShape::Big();
+   int itri;
+   const double dist = RayCast(Vertex_t(point[0], point[1], point[2]), Vertex_t(dir[0], dir[1], dir[2]), -1, itri);
+   if (itri < 0)
+      return TGeoShape::Big();
+   return TMath::Max(dist, 0.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from array of input points having directions specified by dirs. Store output in dists
+
+void TGeoTessellated::DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
+                                        Double_t *step) const
+{
+   for (Int_t i = 0; i < vecsize; i++)
+      dists[i] = DistFromOutside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the closest distance from given point to the surface of the solid
+
+Double_t TGeoTessellated::Safety(const Double_t *point, Bool_t) const
+{
+   int itri;
+   const double safe = SafetyToSurface(Vertex_t(point[0], point[1], point[2]), itri);
+   return (itri < 0) ? 0. : safe;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute safe distance from each of the points in the input array.
+
+void TGeoTessellated::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
+{
+   for (Int_t i = 0; i < vecsize; i++)
+      safe[i] = Safety(&points[3 * i], inside[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns numbers of vertices, segments and polygons composing the shape mesh.
 
@@ -622,6 +1013,7 @@ void TGeoTessellated::ResizeCenter(double maxsize)
    fDX *= scale;
    fDY *= scale;
    fDZ *= scale;
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
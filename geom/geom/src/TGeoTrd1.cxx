@@ -811,8 +811,14 @@ void TGeoTrd1::Sizeof3D() const
 
 void TGeoTrd1::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      inside[i] = Contains(&points[3 * i]);
+   // branch-free version of Contains, which the compiler can vectorize
+   const Double_t dz = fDz, dy = fDy;
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t z = points[3 * i + 2];
+      const Double_t dx = 0.5 * (fDx2 * (z + dz) + fDx1 * (dz - z)) / dz;
+      const Double_t ax = TMath::Abs(points[3 * i]), ay = TMath::Abs(points[3 * i + 1]), az = TMath::Abs(z);
+      inside[i] = !(az > dz) & !(ay > dy) & !(ax > dx);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
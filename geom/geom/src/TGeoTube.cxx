@@ -1235,8 +1235,13 @@ const TBuffer3D &TGeoTube::GetBuffer3D(Int_t reqSections, Bool_t localFrame) con
 
 void TGeoTube::Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      inside[i] = Contains(&points[3 * i]);
+   // branch-free version of Contains, which the compiler can vectorize
+   const Double_t dz = fDz, rmin2 = fRmin * fRmin, rmax2 = fRmax * fRmax;
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t r2 = points[3 * i] * points[3 * i] + points[3 * i + 1] * points[3 * i + 1];
+      const Double_t az = TMath::Abs(points[3 * i + 2]);
+      inside[i] = !(az > dz) & !(r2 < rmin2) & !(r2 > rmax2);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1277,8 +1282,23 @@ void TGeoTube::DistFromOutside_v(const Double_t *points, const Double_t *dirs, D
 
 void TGeoTube::Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const
 {
-   for (Int_t i = 0; i < vecsize; i++)
-      safe[i] = Safety(&points[3 * i], inside[i]);
+   // branch-free version of Safety, which the compiler can vectorize
+   const Double_t dz = fDz, rmin = fRmin, rmax = fRmax;
+   const Bool_t hasRmin = (fRmin > 1E-10);
+   const Double_t big = TGeoShape::Big();
+   for (Int_t i = 0; i < vecsize; i++) {
+      const Double_t r = TMath::Sqrt(points[3 * i] * points[3 * i] + points[3 * i + 1] * points[3 * i + 1]);
+      const Double_t az = TMath::Abs(points[3 * i + 2]);
+      Double_t safin = dz - az;
+      const Double_t safrmin = hasRmin ? r - rmin : big;
+      safin = (safrmin < safin) ? safrmin : safin;
+      safin = (rmax - r < safin) ? rmax - r : safin;
+      Double_t safout = -dz + az;
+      const Double_t safrminout = hasRmin ? -r + rmin : -big;
+      safout = (safrminout > safout) ? safrminout : safout;
+      safout = (-rmax + r > safout) ? -rmax + r : safout;
+      safe[i] = inside[i] ? safin : safout;
+   }
 }
 
 ClassImp(TGeoTubeSeg);
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <TGeoManager.h>
+#include <TGeoMaterial.h>
+#include <TGeoMatrix.h>
+#include <TGeoMedium.h>
+#include <TGeoNavigator.h>
+#include <TGeoPgon.h>
+#include <TGeoVolume.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct TrackResult {
+   Int_t fNsteps = 0;
+   Double_t fLength = 0;
+   std::uint64_t fHash = 0; // hash of the sequence of crossed nodes
+
+   bool operator==(const TrackResult &other) const
+   {
+      return fNsteps == other.fNsteps && fLength == other.fLength && fHash == other.fHash;
+   }
+};
+
+/// A world filled with a grid of cells, each one containing a tube and a sphere, so that the navigation goes
+/// through voxels, several levels and shapes with their own thread data (TGeoPgon)
+TGeoManager *BuildGeometry()
+{
+   auto geom = new TGeoManager("navigation_mt", "Parallel navigation test");
+   auto vacuum = new TGeoMedium("Vacuum", 1, new TGeoMaterial("Vacuum", 0, 0, 0));
+   auto iron = new TGeoMedium("Iron", 2, new TGeoMaterial("Fe", 55.845, 26, 7.87));
+   auto world = geom->MakeBox("World", vacuum, 100, 100, 100);
+   geom->SetTopVolume(world);
+   auto cell = geom->MakeBox("Cell", vacuum, 9.5, 9.5, 9.5);
+   cell->AddNode(geom->MakeTube("Tube", iron, 2, 4, 8), 1, new TGeoTranslation(-4, 0, 0));
+   cell->AddNode(geom->MakeSphere("Sphere", iron, 0, 3), 1, new TGeoTranslation(5, 5, 0));
+   auto pgon = geom->MakePgon("Pgon", iron, 0, 360, 6, 2);
+   auto pgonShape = static_cast<TGeoPgon *>(pgon->GetShape());
+   pgonShape->DefineSection(0, -3, 0, 3);
+   pgonShape->DefineSection(1, 3, 0, 3);
+   cell->AddNode(pgon, 1, new TGeoTranslation(4, -5, 0));
+   Int_t copy = 0;
+   for (Int_t i = -4; i <= 4; ++i)
+      for (Int_t j = -4; j <= 4; ++j)
+         for (Int_t k = -4; k <= 4; ++k)
+            world->AddNode(cell, copy++, new TGeoTranslation(20 * i, 20 * j, 20 * k));
+   geom->CloseGeometry();
+   return geom;
+}
+
+/// Start point and direction of track `itrack`, the same for any thread
+void TrackStart(Int_t itrack, Double_t *point, Double_t *dir)
+{
+   std::uint64_t state = 0x9E3779B97F4A7C15ull * (itrack + 1);
+   auto uniform = [&state]() {
+      state = state * 6364136223846793005ull + 1442695040888963407ull;
+      return (state >> 11) * 0x1p-53;
+   };
+   for (Int_t i = 0; i < 3; ++i)
+      point[i] = 180 * uniform() - 90;
+   const Double_t cost = 2 * uniform() - 1;
+   const Double_t sint = std::sqrt(1 - cost * cost);
+   const Double_t phi = 2 * M_PI * uniform();
+   dir[0] = sint * std::cos(phi);
+   dir[1] = sint * std::sin(phi);
+   dir[2] = cost;
+}
+
+TrackResult Transport(TGeoNavigator &nav, Int_t itrack)
+{
+   Double_t point[3], dir[3];
+   TrackStart(itrack, point, dir);
+   TrackResult result;
+   nav.InitTrack(point, dir);
+   while (!nav.IsOutside() && result.fNsteps < 1000) {
+      TGeoNode *node = nav.FindNextBoundaryAndStep();
+      ++result.fNsteps;
+      result.fLength += nav.GetStep();
+      if (node)
+         result.fHash = result.fHash * 31 + std::uint64_t(node->GetNumber()) * 7 + node->GetVolume()->GetNumber();
+   }
+   return result;
+}
+
+} // anonymous namespace
+
+TEST(Geometry, ParallelNavigation)
+{
+   constexpr Int_t kNtracks = 20000;
+   const Int_t maxThreads = std::max(2u, std::min(8u, std::thread::hardware_concurrency()));
+   TGeoManager *geom = BuildGeometry();
+
+   std::vector<TrackResult> reference(kNtracks);
+   for (Int_t i = 0; i < kNtracks; ++i)
+      reference[i] = Transport(*geom->GetCurrentNavigator(), i);
+
+   geom->SetMaxThreads(maxThreads);
+   for (Int_t nthreads = 1; nthreads <= maxThreads; nthreads *= 2) {
+      std::vector<TrackResult> results(kNtracks);
+      const auto start = std::chrono::steady_clock::now();
+      std::vector<std::thread> threads;
+      for (Int_t t = 0; t < nthreads; ++t) {
+         threads.emplace_back([&, t] {
+            TGeoNavigator *nav = geom->AddNavigator();
+            for (Int_t i = t; i < kNtracks; i += nthreads)
+               results[i] = Transport(*nav, i);
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      std::cout << "navigation with " << nthreads << " threads: " << kNtracks / elapsed.count() << " tracks/s"
+                << std::endl;
+      geom->ClearNavigators();
+      geom->ClearThreadsMap();
+      for (Int_t i = 0; i < kNtracks; ++i)
+         EXPECT_EQ(results[i], reference[i]) << "track " << i << " with " << nthreads << " threads";
+   }
+   delete geom;
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <TGeoBBox.h>
+#include <TGeoCone.h>
+#include <TGeoManager.h>
+#include <TGeoMaterial.h>
+#include <TGeoMatrix.h>
+#include <TGeoMedium.h>
+#include <TGeoNavigator.h>
+#include <TGeoTrd1.h>
+#include <TGeoTrd2.h>
+#include <TGeoTube.h>
+#include <TGeoVolume.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr Int_t kNpoints = 10000;
+
+/// Random points and directions around a shape of size ~10, with some points on integer coordinates so that they
+/// lie on the faces of the shapes below, and some directions along the axes
+void MakePoints(std::vector<Double_t> &points, std::vector<Double_t> &dirs)
+{
+   std::mt19937_64 gen(42);
+   std::uniform_real_distribution<Double_t> uniform(-12, 12);
+   points.resize(3 * kNpoints);
+   dirs.resize(3 * kNpoints);
+   for (Int_t i = 0; i < kNpoints; i++) {
+      Double_t norm = 0;
+      for (Int_t j = 0; j < 3; j++) {
+         points[3 * i + j] = (i % 5 == 0) ? std::round(uniform(gen)) : uniform(gen);
+         dirs[3 * i + j] = (i % 7 == j) ? 0 : uniform(gen);
+         norm += dirs[3 * i + j] * dirs[3 * i + j];
+      }
+      for (Int_t j = 0; j < 3; j++)
+         dirs[3 * i + j] /= std::sqrt(norm);
+   }
+}
+
+/// The vectorized methods must give exactly the results of the methods for single points
+void CheckVectorized(const TGeoShape &shape)
+{
+   std::vector<Double_t> points, dirs;
+   MakePoints(points, dirs);
+   std::unique_ptr<Bool_t[]> inside(new Bool_t[kNpoints]);
+   std::vector<Double_t> steps(kNpoints), dists(kNpoints), safe(kNpoints);
+   for (Int_t i = 0; i < kNpoints; i++)
+      steps[i] = (i % 3 == 0) ? 2. : TGeoShape::Big();
+
+   shape.Contains_v(points.data(), inside.get(), kNpoints);
+   for (Int_t i = 0; i < kNpoints; i++)
+      ASSERT_EQ(inside[i], shape.Contains(&points[3 * i])) << shape.ClassName() << " point " << i;
+
+   shape.Safety_v(points.data(), inside.get(), safe.data(), kNpoints);
+   for (Int_t i = 0; i < kNpoints; i++)
+      ASSERT_EQ(safe[i], shape.Safety(&points[3 * i], inside[i])) << shape.ClassName() << " point " << i;
+
+   shape.DistFromInside_v(points.data(), dirs.data(), dists.data(), kNpoints, steps.data());
+   for (Int_t i = 0; i < kNpoints; i++)
+      ASSERT_EQ(dists[i], shape.DistFromInside(&points[3 * i], &dirs[3 * i], 3, steps[i]))
+         << shape.ClassName() << " point " << i;
+
+   shape.DistFromOutside_v(points.data(), dirs.data(), dists.data(), kNpoints, steps.data());
+   for (Int_t i = 0; i < kNpoints; i++)
+      ASSERT_EQ(dists[i], shape.DistFromOutside(&points[3 * i], &dirs[3 * i], 3, steps[i]))
+         << shape.ClassName() << " point " << i;
+}
+
+} // anonymous namespace
+
+TEST(Geometry, VectorizedShapes)
+{
+   Double_t origin[3] = {0.5, -1, 2};
+   CheckVectorized(TGeoBBox(3, 4, 5));
+   CheckVectorized(TGeoBBox(3, 4, 5, origin));
+   CheckVectorized(TGeoTube(0, 6, 5));
+   CheckVectorized(TGeoTube(2, 6, 5));
+   CheckVectorized(TGeoCone(5, 1, 4, 2, 8));
+   CheckVectorized(TGeoTrd1(2, 6, 4, 5));
+   CheckVectorized(TGeoTrd2(2, 6, 3, 7, 5));
+}
+
+TEST(Geometry, BasketNavigation)
+{
+   auto geom = new TGeoManager("basket", "Basket navigation test");
+   auto vacuum = new TGeoMedium("Vacuum", 1, new TGeoMaterial("Vacuum", 0, 0, 0));
+   auto world = geom->MakeBox("World", vacuum, 20, 20, 20);
+   geom->SetTopVolume(world);
+   world->AddNode(geom->MakeTube("Tube", vacuum, 2, 6, 5), 1, new TGeoTranslation(-8, 0, 0));
+   world->AddNode(geom->MakeBox("Box", vacuum, 3, 4, 5), 1, new TGeoTranslation(8, 0, 0));
+   geom->CloseGeometry();
+
+   std::vector<Double_t> points, dirs;
+   MakePoints(points, dirs);
+   std::vector<Double_t> expectedPoints(points);
+   std::vector<Double_t> steps(kNpoints);
+   std::vector<TGeoNode *> nodes(kNpoints);
+   TGeoNavigator *nav = geom->GetCurrentNavigator();
+   nav->FindNextBoundaryAndStep_v(kNpoints, points.data(), dirs.data(), steps.data(), nodes.data());
+
+   for (Int_t i = 0; i < kNpoints; i++) {
+      nav->InitTrack(&expectedPoints[3 * i], &dirs[3 * i]);
+      EXPECT_EQ(nodes[i], nav->FindNextBoundaryAndStep()) << "particle " << i;
+      EXPECT_EQ(steps[i], nav->GetStep()) << "particle " << i;
+      for (Int_t j = 0; j < 3; j++)
+         EXPECT_EQ(points[3 * i + j], nav->GetCurrentPoint()[j]) << "particle " << i;
+   }
+   delete geom;
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <TGeoBBox.h>
+#include <TGeoTessellated.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+namespace {
+
+using Vertex_t = TGeoTessellated::Vertex_t;
+
+/// Box of half-lengths dx, dy, dz with each face made of n x n quadrilateral facets
+TGeoTessellated *MakeTessellatedBox(double dx, double dy, double dz, int n)
+{
+   auto tsl = new TGeoTessellated("tbox", 6 * n * n);
+   const double d[3] = {dx, dy, dz};
+   for (int axis = 0; axis < 3; axis++) {
+      const int a1 = (axis + 1) % 3;
+      const int a2 = (axis + 2) % 3;
+      for (int side = -1; side <= 1; side += 2) {
+         auto vertex = [&](int i, int j) {
+            Vertex_t v;
+            v[axis] = side * d[axis];
+            v[a1] = d[a1] * (-1 + 2. * i / n);
+            v[a2] = d[a2] * (-1 + 2. * j / n);
+            return v;
+         };
+         for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+               // counter-clockwise seen from outside
+               if (side > 0)
+                  tsl->AddFacet(vertex(i, j), vertex(i + 1, j), vertex(i + 1, j + 1), vertex(i, j + 1));
+               else
+                  tsl->AddFacet(vertex(i, j), vertex(i, j + 1), vertex(i + 1, j + 1), vertex(i + 1, j));
+            }
+         }
+      }
+   }
+   tsl->CloseShape(true, true, false);
+   return tsl;
+}
+
+} // anonymous namespace
+
+TEST(Geometry, TessellatedNavigation)
+{
+   constexpr double kTolerance = 1.e-9;
+   const TGeoBBox box(3, 4, 5);
+   std::unique_ptr<TGeoTessellated> tsl(MakeTessellatedBox(3, 4, 5, 8));
+   EXPECT_TRUE(tsl->IsClosedBody());
+   EXPECT_NEAR(box.Capacity(), tsl->Capacity(), kTolerance);
+
+   std::mt19937_64 gen(42);
+   std::uniform_real_distribution<double> uniform(-7, 7);
+   for (int i = 0; i < 10000; i++) {
+      double point[3], dir[3];
+      double norm = 0;
+      for (int j = 0; j < 3; j++) {
+         point[j] = uniform(gen);
+         dir[j] = uniform(gen);
+         norm += dir[j] * dir[j];
+      }
+      for (int j = 0; j < 3; j++)
+         dir[j] /= std::sqrt(norm);
+
+      const bool inside = box.Contains(point);
+      ASSERT_EQ(inside, tsl->Contains(point)) << "point " << i;
+      // the safety of a box is an underestimate outside, the one of the tessellated solid is exact
+      if (inside)
+         ASSERT_NEAR(box.Safety(point, kTRUE), tsl->Safety(point, kTRUE), kTolerance) << "point " << i;
+      else
+         ASSERT_GE(tsl->Safety(point, kFALSE), box.Safety(point, kFALSE) - kTolerance) << "point " << i;
+      if (inside) {
+         ASSERT_NEAR(box.DistFromInside(point, dir), tsl->DistFromInside(point, dir), kTolerance) << "point " << i;
+      } else {
+         const double dist = box.DistFromOutside(point, dir);
+         if (dist >= TGeoShape::Big())
+            ASSERT_GE(tsl->DistFromOutside(point, dir), TGeoShape::Big()) << "point " << i;
+         else
+            ASSERT_NEAR(dist, tsl->DistFromOutside(point, dir), kTolerance) << "point " << i;
+      }
+   }
+}
+
+TEST(Geometry, TessellatedFlippedFacets)
+{
+   // The orientation of the normals comes from the enclosed volume, not from the order of the vertices
+   std::unique_ptr<TGeoTessellated> tsl(MakeTessellatedBox(1, 1, 1, 2));
+   tsl->FlipFacets();
+   const double inside[3] = {0.5, 0.2, -0.3};
+   const double outside[3] = {1.5, 0.2, -0.3};
+   const double dir[3] = {1, 0, 0};
+   EXPECT_TRUE(tsl->Contains(inside));
+   EXPECT_FALSE(tsl->Contains(outside));
+   EXPECT_NEAR(0.5, tsl->DistFromInside(inside, dir), 1.e-12);
+   const double back[3] = {-1, 0, 0};
+   EXPECT_NEAR(0.5, tsl->DistFromOutside(outside, back), 1.e-12);
+}
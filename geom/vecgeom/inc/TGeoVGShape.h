@@ -68,6 +68,29 @@ public:
    }
    Int_t GetByteCount() const override { return (fShape->GetByteCount()); }
    Double_t Safety(const Double_t *point, Bool_t in = kTRUE) const override;
+   // the vectorized methods of TGeoBBox only apply to boxes
+   void Contains_v(const Double_t *points, Bool_t *inside, Int_t vecsize) const override
+   {
+      for (Int_t i = 0; i < vecsize; i++)
+         inside[i] = Contains(&points[3 * i]);
+   }
+   void DistFromInside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
+                         Double_t *step) const override
+   {
+      for (Int_t i = 0; i < vecsize; i++)
+         dists[i] = DistFromInside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+   }
+   void DistFromOutside_v(const Double_t *points, const Double_t *dirs, Double_t *dists, Int_t vecsize,
+                          Double_t *step) const override
+   {
+      for (Int_t i = 0; i < vecsize; i++)
+         dists[i] = DistFromOutside(&points[3 * i], &dirs[3 * i], 3, step[i]);
+   }
+   void Safety_v(const Double_t *points, const Bool_t *inside, Double_t *safe, Int_t vecsize) const override
+   {
+      for (Int_t i = 0; i < vecsize; i++)
+         safe[i] = Safety(&points[3 * i], inside[i]);
+   }
    Bool_t GetPointsOnSegments(Int_t npoints, Double_t *array) const override
    {
       return (fShape->GetPointsOnSegments(npoints, array));
@@ -15,6 +15,7 @@
 #include <string>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 
 #include <ROOT/Browsable/RItem.hxx>
 
@@ -246,6 +247,7 @@ class RGeomDescription {
 
    std::vector<int> fSortMap;       ///<! nodes in order large -> smaller volume
    std::vector<ShapeDescr> fShapes; ///<! shapes with created descriptions
+   std::unordered_map<TGeoShape *, int> fShapesMap; ///<! index of shapes in fShapes
 
    std::string fSearch;             ///<! search string in hierarchy
    std::string fSearchJson;         ///<! drawing json for search
@@ -274,6 +276,14 @@ class RGeomDescription {
 
    ShapeDescr &FindShapeDescr(TGeoShape *shape);
 
+   bool IsServerBuildShape(TGeoShape *shape);
+
+   static bool IsThreadSafeShape(TGeoShape *shape);
+
+   void BuildRawInfo(ShapeDescr &elem);
+
+   void BuildShapesParallel(const std::vector<int> &viscnt);
+
    ShapeDescr &MakeShapeDescr(TGeoShape *shape);
 
    int GetUsedNSegments(int min = 20);
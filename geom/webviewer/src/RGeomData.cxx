@@ -43,6 +43,10 @@
 #include "TBufferJSON.h"
 #include "TRegexp.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 #include <algorithm>
 #include <array>
 
@@ -857,13 +861,14 @@ std::string RGeomDescription::ProcessBrowserRequest(const std::string &msg)
 
 RGeomDescription::ShapeDescr &RGeomDescription::FindShapeDescr(TGeoShape *shape)
 {
-   for (auto &descr : fShapes)
-      if (descr.fShape == shape)
-         return descr;
+   auto iter = fShapesMap.find(shape);
+   if (iter != fShapesMap.end())
+      return fShapes[iter->second];
 
    fShapes.emplace_back(shape);
    auto &elem = fShapes.back();
    elem.id = fShapes.size() - 1;
+   fShapesMap[shape] = elem.id;
    return elem;
 }
 
@@ -1066,88 +1071,184 @@ int RGeomDescription::CountShapeFaces(TGeoShape *shape)
 }
 
 /////////////////////////////////////////////////////////////////////
-/// Find description object and create render information
+/// Returns true if render data for the shape should be produced on the server
+/// Depends on configured build_shapes value and complexity of the shape
 
-RGeomDescription::ShapeDescr &RGeomDescription::MakeShapeDescr(TGeoShape *shape)
+bool RGeomDescription::IsServerBuildShape(TGeoShape *shape)
 {
-   auto &elem = FindShapeDescr(shape);
+   int boundary = 3; //
+   if (shape->IsComposite()) {
+      // composite is most complex for client, therefore by default build on server
+      boundary = 1;
+   } else if (!shape->IsCylType()) {
+      // simple box geometry is compact and can be delivered as raw
+      boundary = 2;
+   }
 
-   if (elem.nfaces == 0) {
+   return IsBuildShapes() >= boundary;
+}
 
-      int boundary = 3; //
-      if (shape->IsComposite()) {
-         // composite is most complex for client, therefore by default build on server
-         boundary = 1;
-      } else if (!shape->IsCylType()) {
-         // simple box geometry is compact and can be delivered as raw
-         boundary = 2;
-      }
+/////////////////////////////////////////////////////////////////////
+/// Returns true if the shape tessellation does not modify any shared data
+/// TGeoXtru uses per-thread scratch buffers of TGeoManager, which are shared when not in multi-threaded navigation mode
 
-      if (IsBuildShapes() < boundary) {
-         elem.nfaces = 1;
-         elem.fShapeInfo.shape = shape;
-      } else {
+bool RGeomDescription::IsThreadSafeShape(TGeoShape *shape)
+{
+   if (!shape || shape->InheritsFrom(TGeoXtru::Class()))
+      return false;
 
-         int old_nsegm = -1;
-         if (fCfg.nsegm > 0 && gGeoManager) {
-            old_nsegm = gGeoManager->GetNsegments();
-            gGeoManager->SetNsegments(fCfg.nsegm);
-         }
+   if (auto scaled = dynamic_cast<TGeoScaledShape *>(shape))
+      return IsThreadSafeShape(scaled->GetShape());
 
-         auto mesh = MakeGeoMesh(nullptr, shape);
+   if (auto comp = dynamic_cast<TGeoCompositeShape *>(shape))
+      return IsThreadSafeShape(comp->GetBoolNode()->GetLeftShape()) &&
+             IsThreadSafeShape(comp->GetBoolNode()->GetRightShape());
 
-         if (old_nsegm > 0 && gGeoManager)
-            gGeoManager->SetNsegments(old_nsegm);
+   return true;
+}
 
-         Int_t num_vertices = mesh->NumberOfVertices(), num_polynoms = 0;
+/////////////////////////////////////////////////////////////////////
+/// Create raw render information (vertices and triangles) for the shape
+/// Only modifies provided description, therefore can be invoked for different shapes in parallel
+/// Number of cylindrical segments should be configured by the caller
 
-         for (unsigned polyIndex = 0; polyIndex < mesh->NumberOfPolys(); ++polyIndex) {
+void RGeomDescription::BuildRawInfo(ShapeDescr &elem)
+{
+   auto mesh = MakeGeoMesh(nullptr, elem.fShape);
 
-            auto size_of_polygon = mesh->SizeOfPoly(polyIndex);
+   Int_t num_vertices = mesh->NumberOfVertices(), num_polynoms = 0;
 
-            if (size_of_polygon >= 3)
-               num_polynoms += (size_of_polygon - 2);
-         }
+   for (unsigned polyIndex = 0; polyIndex < mesh->NumberOfPolys(); ++polyIndex) {
+
+      auto size_of_polygon = mesh->SizeOfPoly(polyIndex);
+
+      if (size_of_polygon >= 3)
+         num_polynoms += (size_of_polygon - 2);
+   }
+
+   Int_t index_buffer_size = num_polynoms * 3, // triangle indexes
+      vertex_buffer_size = num_vertices * 3;   // X,Y,Z array
+
+   elem.nfaces = num_polynoms;
 
-         Int_t index_buffer_size = num_polynoms * 3, // triangle indexes
-            vertex_buffer_size = num_vertices * 3;   // X,Y,Z array
+   std::vector<float> vertices(vertex_buffer_size);
 
-         elem.nfaces = num_polynoms;
+   for (Int_t i = 0; i < num_vertices; ++i) {
+      auto v = mesh->GetVertex(i);
+      vertices[i * 3] = v[0];
+      vertices[i * 3 + 1] = v[1];
+      vertices[i * 3 + 2] = v[2];
+   }
+
+   elem.fRawInfo.raw.resize(vertices.size() * sizeof(float));
+
+   memcpy(reinterpret_cast<char *>(elem.fRawInfo.raw.data()), vertices.data(), vertices.size() * sizeof(float));
+
+   auto &indexes = elem.fRawInfo.idx;
+
+   indexes.resize(index_buffer_size);
+   int pos = 0;
 
-         std::vector<float> vertices(vertex_buffer_size);
+   for (unsigned polyIndex = 0; polyIndex < mesh->NumberOfPolys(); ++polyIndex) {
+      auto size_of_polygon = mesh->SizeOfPoly(polyIndex);
 
-         for (Int_t i = 0; i < num_vertices; ++i) {
-            auto v = mesh->GetVertex(i);
-            vertices[i * 3] = v[0];
-            vertices[i * 3 + 1] = v[1];
-            vertices[i * 3 + 2] = v[2];
+      // add first triangle
+      if (size_of_polygon >= 3)
+         for (int i = 0; i < 3; ++i)
+            indexes[pos++] = mesh->GetVertexIndex(polyIndex, i);
+
+      // add following triangles
+      if (size_of_polygon > 3)
+         for (unsigned vertex = 3; vertex < size_of_polygon; vertex++) {
+            indexes[pos++] = mesh->GetVertexIndex(polyIndex, 0);
+            indexes[pos++] = mesh->GetVertexIndex(polyIndex, vertex - 1);
+            indexes[pos++] = mesh->GetVertexIndex(polyIndex, vertex);
          }
+   }
+}
 
-         elem.fRawInfo.raw.resize(vertices.size() * sizeof(float));
+/////////////////////////////////////////////////////////////////////
+/// Create render information for all not yet processed shapes in parallel
+/// Only shapes which will be drawn with current visibility @param viscnt are processed, the limits for
+/// number of faces and nodes are applied using estimated number of faces
 
-         memcpy(reinterpret_cast<char *>(elem.fRawInfo.raw.data()), vertices.data(), vertices.size() * sizeof(float));
+void RGeomDescription::BuildShapesParallel(const std::vector<int> &viscnt)
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled())
+      return;
+
+   std::vector<int> ids; // indexes in fShapes
+   int numfaces = 0, numnodes = 0;
+
+   for (auto &sid : fSortMap) {
+      if ((viscnt[sid] <= 0) || (fDesc[sid].vol <= 0))
+         continue;
+
+      auto shape = GetVolume(sid)->GetShape();
+      if (!shape)
+         continue;
+
+      numfaces += CountShapeFaces(shape) * viscnt[sid];
+      if ((GetMaxVisFaces() > 0) && (numfaces > GetMaxVisFaces()))
+         break;
+
+      numnodes += viscnt[sid];
+      if ((GetMaxVisNodes() > 0) && (numnodes > GetMaxVisNodes()))
+         break;
+
+      auto &elem = FindShapeDescr(shape);
+      if ((elem.nfaces == 0) && IsServerBuildShape(shape) && IsThreadSafeShape(shape)) {
+         elem.nfaces = -1; // mark as scheduled
+         ids.emplace_back(elem.id);
+      }
+   }
+
+   // while processing, no new elements are added to fShapes
+   for (auto id : ids)
+      fShapes[id].nfaces = 0;
+
+   if (ids.size() < 2)
+      return;
+
+   int old_nsegm = -1;
+   if (fCfg.nsegm > 0 && gGeoManager) {
+      old_nsegm = gGeoManager->GetNsegments();
+      gGeoManager->SetNsegments(fCfg.nsegm);
+   }
 
-         auto &indexes = elem.fRawInfo.idx;
+   ROOT::TThreadExecutor pool;
+   pool.Foreach([this](int id) { BuildRawInfo(fShapes[id]); }, ids);
 
-         indexes.resize(index_buffer_size);
-         int pos = 0;
+   if (old_nsegm > 0 && gGeoManager)
+      gGeoManager->SetNsegments(old_nsegm);
+#else
+   (void)viscnt;
+#endif
+}
 
-         for (unsigned polyIndex = 0; polyIndex < mesh->NumberOfPolys(); ++polyIndex) {
-            auto size_of_polygon = mesh->SizeOfPoly(polyIndex);
+/////////////////////////////////////////////////////////////////////
+/// Find description object and create render information
 
-            // add first triangle
-            if (size_of_polygon >= 3)
-               for (int i = 0; i < 3; ++i)
-                  indexes[pos++] = mesh->GetVertexIndex(polyIndex, i);
+RGeomDescription::ShapeDescr &RGeomDescription::MakeShapeDescr(TGeoShape *shape)
+{
+   auto &elem = FindShapeDescr(shape);
 
-            // add following triangles
-            if (size_of_polygon > 3)
-               for (unsigned vertex = 3; vertex < size_of_polygon; vertex++) {
-                  indexes[pos++] = mesh->GetVertexIndex(polyIndex, 0);
-                  indexes[pos++] = mesh->GetVertexIndex(polyIndex, vertex - 1);
-                  indexes[pos++] = mesh->GetVertexIndex(polyIndex, vertex);
-               }
+   if (elem.nfaces == 0) {
+      if (!IsServerBuildShape(shape)) {
+         elem.nfaces = 1;
+         elem.fShapeInfo.shape = shape;
+      } else {
+         int old_nsegm = -1;
+         if (fCfg.nsegm > 0 && gGeoManager) {
+            old_nsegm = gGeoManager->GetNsegments();
+            gGeoManager->SetNsegments(fCfg.nsegm);
          }
+
+         BuildRawInfo(elem);
+
+         if (old_nsegm > 0 && gGeoManager)
+            gGeoManager->SetNsegments(old_nsegm);
       }
    }
 
@@ -1261,6 +1362,9 @@ std::string RGeomDescription::ProduceJson(bool all_nodes)
    // for (auto &node : fDesc)
    //   node.SetDisplayed(false);
 
+   // create render data of many shapes at once when implicit MT is enabled
+   BuildShapesParallel(viscnt);
+
    // build all shapes in volume decreasing order
    for (auto &sid : fSortMap) {
       fDrawIdCut++; //
@@ -1385,6 +1489,7 @@ void RGeomDescription::ClearCache()
 
    TLockGuard lock(fMutex);
    fShapes.clear();
+   fShapesMap.clear();
    fSearch.clear();
 }
 
@@ -91,6 +91,7 @@ ROOT tutorials: `$ROOTSYS/tutorials/image/`
 #include "snprintf.h"
 
 #include <memory>
+#include <mutex>
 
 #ifndef WIN32
 #ifndef R__HAS_COCOA
@@ -123,6 +124,8 @@ ASVisual *TASImage::fgVisual = nullptr;
 Bool_t TASImage::fgInit = kFALSE;
 
 static ASFontManager *gFontManager = nullptr;
+// Serializes the initialization of the visual and the use of the font manager, shared by all threads
+static std::mutex gAfterImageMutex;
 static unsigned long kAllPlanes = ~0;
 THashTable *TASImage::fgPlugList = new THashTable(50);
 
@@ -504,7 +507,7 @@ void TASImage::ReadImage(const char *filename, EImageFileTypes /*type*/)
    // suppress the "root : looking for image ..." messages
    set_output_threshold(0);
 
-   static ASImageImportParams iparams;
+   thread_local ASImageImportParams iparams;
    iparams.flags = 0;
    iparams.width = 0;
    iparams.height = 0;
@@ -688,9 +691,9 @@ void TASImage::WriteImage(const char *file, EImageFileTypes type)
    EImageQuality quality = GetImageQuality();
    MapQuality(quality, aquality);
 
-   static TString fname;
+   thread_local TString fname;
    fname = file;
-   static ASImageExportParams parms;
+   thread_local ASImageExportParams parms;
    ASImage *im = fScaledImage ? fScaledImage->fImage : fImage;
 
    switch (type) {
@@ -1817,7 +1820,7 @@ void TASImage::ExecuteEvent(Int_t event, Int_t px, Int_t py)
 
 char *TASImage::GetObjectInfo(Int_t px, Int_t py) const
 {
-   static char info[64];
+   thread_local char info[64];
    info[0] = 0;
 
    if (!IsValid()) return info;
@@ -2198,6 +2201,8 @@ void TASImage::GetZoomPosition(UInt_t &x, UInt_t &y, UInt_t &w, UInt_t &h) const
 
 Bool_t TASImage::InitVisual()
 {
+   std::lock_guard<std::mutex> lock(gAfterImageMutex);
+
    Bool_t inbatch = fgVisual && (fgVisual->dpy == (void*)1); // was in batch
    Bool_t noX = gROOT->IsBatch() || gVirtualX->InheritsFrom("TGWin32");
 
@@ -2612,6 +2617,7 @@ void TASImage::DrawText(Int_t x, Int_t y, const char *text, Int_t size,
       return;
    }
 
+   std::lock_guard<std::mutex> lock(gAfterImageMutex);
    if (!gFontManager) {
       gFontManager = create_font_manager(fgVisual->dpy, nullptr, nullptr);
    }
@@ -5473,7 +5479,7 @@ void TASImage::DrawFillArea(UInt_t count, TPoint *ptsIn, const char *col,
    Bool_t del = kTRUE;
 
    static const UInt_t gEdgeTableEntryCacheSize = 200;
-   static EdgeTableEntry gEdgeTableEntryCache[gEdgeTableEntryCacheSize];
+   thread_local EdgeTableEntry gEdgeTableEntryCache[gEdgeTableEntryCacheSize];
 
    if (count < gEdgeTableEntryCacheSize) {
       pETEs = (EdgeTableEntry*)&gEdgeTableEntryCache;
@@ -5656,7 +5662,7 @@ static void destroy_asdraw_context32( ASDrawContext *ctx )
 }
 
 static const UInt_t kBrushCacheSize = 20;
-static CARD32 gBrushCache[kBrushCacheSize*kBrushCacheSize];
+static thread_local CARD32 gBrushCache[kBrushCacheSize*kBrushCacheSize];
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Draw wide line.
@@ -5710,7 +5716,7 @@ void TASImage::DrawWideLine(UInt_t x1, UInt_t y1, UInt_t x2, UInt_t y2,
 
 void TASImage::DrawGlyph(void *bitmap, UInt_t color, Int_t bx, Int_t by)
 {
-   static UInt_t col[5];
+   thread_local UInt_t col[5];
    Int_t x, y, yy, y0, xx;
    Bool_t has_alpha = (color & 0xff000000) != 0xff000000;
 
@@ -5986,7 +5992,7 @@ void TASImage::DrawTextTTF(Int_t x, Int_t y, const char *text, Int_t size,
 
 void TASImage::GetImageBuffer(char **buffer, int *size, EImageFileTypes type)
 {
-   static ASImageExportParams params;
+   thread_local ASImageExportParams params;
    Bool_t ret = kFALSE;
    ASImage *img = fScaledImage ? fScaledImage->fImage : fImage;
 
@@ -6041,7 +6047,7 @@ Bool_t TASImage::SetImageBuffer(char **buffer, EImageFileTypes type)
 {
    DestroyImage();
 
-   static ASImageImportParams params;
+   thread_local ASImageImportParams params;
    params.flags = 0;
    params.width = 0;
    params.height = 0 ;
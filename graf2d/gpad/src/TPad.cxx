@@ -4841,6 +4841,29 @@ static Bool_t ContainsTImage(TList *li)
 /// If the file "myfile.gif" already exists, the new frame are appended at
 /// the end of the file. To avoid this, delete it first with `gSystem->Unlink(myfile.gif);`
 /// If you want the gif file to repeat or loop forever, check TASImage::WriteImage documentation
+///
+/// Canvases can be printed concurrently from several threads in batch mode,
+/// for instance to produce many plots in parallel, after a call to
+/// ROOT::EnableThreadSafety(). Each thread must create, fill and print its own
+/// canvas; the output stream (gVirtualPS), the current pad and the TrueType
+/// fonts are per thread. gStyle and the list of colors are shared and must not
+/// be modified while the threads are running.
+/// ~~~ {.cpp}
+///    ROOT::EnableThreadSafety();
+///    gROOT->SetBatch(kTRUE);
+///    auto work = [](int i) {
+///       TCanvas c(TString::Format("c%d", i), "", 800, 600);
+///       TH1F h(TString::Format("h%d", i), "", 100, -3, 3);
+///       h.FillRandom("gaus", 1000);
+///       h.Draw();
+///       c.Print(TString::Format("plot%d.png", i));
+///    };
+///    std::vector<std::thread> threads;
+///    for (int i = 0; i < 8; ++i)
+///       threads.emplace_back(work, i);
+///    for (auto &t : threads)
+///       t.join();
+/// ~~~
 
 void TPad::Print(const char *filename, Option_t *option)
 {
@@ -4981,7 +5004,10 @@ void TPad::Print(const char *filename, Option_t *option)
 
    //==============Save pad/canvas as a SVG file================================
    if (strstr(opt,"svg")) {
-      gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+      {
+         R__LOCKGUARD(gROOTMutex);
+         gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+      }
 
       Bool_t noScreen = kFALSE;
       if (!GetCanvas()->IsBatch() && GetCanvas()->GetCanvasID() == -1) {
@@ -5022,7 +5048,10 @@ void TPad::Print(const char *filename, Option_t *option)
 
    //==============Save pad/canvas as a TeX file================================
    if (strstr(opt,"tex") || strstr(opt,"Standalone")) {
-      gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+      {
+         R__LOCKGUARD(gROOTMutex);
+         gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+      }
 
       Bool_t noScreen = kFALSE;
       if (!GetCanvas()->IsBatch() && GetCanvas()->GetCanvasID() == -1) {
@@ -5083,7 +5112,11 @@ void TPad::Print(const char *filename, Option_t *option)
       copenb  = psname.EndsWith("["); if (copenb)  psname[psname.Length()-1] = 0;
       ccloseb = psname.EndsWith("]"); if (ccloseb) psname[psname.Length()-1] = 0;
    }
-   gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+   {
+      // The files being written are shared by all threads through the list of specials
+      R__LOCKGUARD(gROOTMutex);
+      gVirtualPS = (TVirtualPS*)gROOT->GetListOfSpecials()->FindObject(psname);
+   }
    if (gVirtualPS) mustOpen = mustClose = kFALSE;
    if (copen  || copenb)  mustClose = kFALSE;
    if (cclose || ccloseb) mustClose = kTRUE;
@@ -5142,10 +5175,14 @@ void TPad::Print(const char *filename, Option_t *option)
       if (noScreen) GetCanvas()->SetBatch(kFALSE);
 
       if (mustClose) {
-         gROOT->GetListOfSpecials()->Remove(gVirtualPS);
+         {
+            R__LOCKGUARD(gROOTMutex);
+            gROOT->GetListOfSpecials()->Remove(gVirtualPS);
+         }
          delete gVirtualPS;
          gVirtualPS = psave;
       } else {
+         R__LOCKGUARD(gROOTMutex);
          gROOT->GetListOfSpecials()->Add(gVirtualPS);
          gVirtualPS = nullptr;
       }
@@ -5170,7 +5207,10 @@ void TPad::Print(const char *filename, Option_t *option)
       if (mustClose) {
          if (cclose) Info("Print", "Current canvas added to %s file %s and file closed", opt.Data(), psname.Data());
          else        Info("Print", "%s file %s has been closed", opt.Data(), psname.Data());
-         gROOT->GetListOfSpecials()->Remove(gVirtualPS);
+         {
+            R__LOCKGUARD(gROOTMutex);
+            gROOT->GetListOfSpecials()->Remove(gVirtualPS);
+         }
          delete gVirtualPS;
          gVirtualPS = nullptr;
       } else {
@@ -72,24 +72,24 @@ TTF helper class containing glyphs description.
 protected:
    enum { kTTMaxFonts = 32, kMaxGlyphs = 1024 };
 
-   static Int_t          fgAscent;                ///< string ascent, used to compute Y alignment
-   static FT_BBox        fgCBox;                  ///< string control box
-   static FT_CharMap     fgCharMap[kTTMaxFonts];  ///< font character map
-   static Int_t          fgCurFontIdx;            ///< current font index
-   static Int_t          fgSymbItaFontIdx;        ///< Symbol italic font index
-   static Int_t          fgFontCount;             ///< number of fonts loaded
-   static char          *fgFontName[kTTMaxFonts]; ///< font name
-   static FT_Face        fgFace[kTTMaxFonts];     ///< font face
-   static TTF::TTGlyph   fgGlyphs[kMaxGlyphs];    ///< glyphs
-   static Bool_t         fgHinting;               ///< use hinting (true by default)
-   static Bool_t         fgInit;                  ///< true if the Init has been called
-   static Bool_t         fgKerning;               ///< use kerning (true by default)
-   static FT_Library     fgLibrary;               ///< FreeType font library
-   static Int_t          fgNumGlyphs;             ///< number of glyphs in the string
-   static FT_Matrix     *fgRotMatrix;             ///< rotation matrix
-   static Bool_t         fgSmoothing;             ///< use anti-aliasing (true when >8 planes, false otherwise)
-   static Int_t          fgTBlankW;               ///< trailing blanks width
-   static Int_t          fgWidth;                 ///< string width, used to compute X alignment
+   static thread_local Int_t        fgAscent;                ///< string ascent, used to compute Y alignment
+   static thread_local FT_BBox      fgCBox;                  ///< string control box
+   static thread_local FT_CharMap   fgCharMap[kTTMaxFonts];  ///< font character map
+   static thread_local Int_t        fgCurFontIdx;            ///< current font index
+   static thread_local Int_t        fgSymbItaFontIdx;        ///< Symbol italic font index
+   static thread_local Int_t        fgFontCount;             ///< number of fonts loaded
+   static thread_local char        *fgFontName[kTTMaxFonts]; ///< font name
+   static thread_local FT_Face      fgFace[kTTMaxFonts];     ///< font face
+   static thread_local TTF::TTGlyph fgGlyphs[kMaxGlyphs];    ///< glyphs
+   static Bool_t                    fgHinting;               ///< use hinting (true by default)
+   static thread_local Bool_t       fgInit;                  ///< true if the Init has been called
+   static Bool_t                    fgKerning;               ///< use kerning (true by default)
+   static thread_local FT_Library   fgLibrary;               ///< FreeType font library
+   static thread_local Int_t        fgNumGlyphs;             ///< number of glyphs in the string
+   static thread_local FT_Matrix   *fgRotMatrix;             ///< rotation matrix
+   static Bool_t                    fgSmoothing;             ///< use anti-aliasing (true when >8 planes, false otherwise)
+   static thread_local Int_t        fgTBlankW;               ///< trailing blanks width
+   static thread_local Int_t        fgWidth;                 ///< string width, used to compute X alignment
 
 public:
    static Short_t CharToUnicode(UInt_t code);
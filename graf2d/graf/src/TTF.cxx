@@ -30,24 +30,24 @@ const Float_t kScale = 0.93376068;
 
 TTF gCleanupTTF; // Allows to call "Cleanup" at the end of the session
 
-Bool_t         TTF::fgInit           = kFALSE;
-Bool_t         TTF::fgSmoothing      = kTRUE;
-Bool_t         TTF::fgKerning        = kTRUE;
-Bool_t         TTF::fgHinting        = kFALSE;
-Int_t          TTF::fgTBlankW        = 0;
-Int_t          TTF::fgWidth          = 0;
-Int_t          TTF::fgAscent         = 0;
-Int_t          TTF::fgCurFontIdx     = -1;
-Int_t          TTF::fgSymbItaFontIdx = -1;
-Int_t          TTF::fgFontCount      = 0;
-Int_t          TTF::fgNumGlyphs      = 0;
-char          *TTF::fgFontName[kTTMaxFonts];
-FT_Matrix     *TTF::fgRotMatrix      = nullptr;
-FT_Library     TTF::fgLibrary;
-FT_BBox        TTF::fgCBox;
-FT_Face        TTF::fgFace[kTTMaxFonts];
-FT_CharMap     TTF::fgCharMap[kTTMaxFonts];
-TTF::TTGlyph   TTF::fgGlyphs[kMaxGlyphs];
+thread_local Bool_t         TTF::fgInit             = kFALSE;
+Bool_t                      TTF::fgSmoothing        = kTRUE;
+Bool_t                      TTF::fgKerning          = kTRUE;
+Bool_t                      TTF::fgHinting          = kFALSE;
+thread_local Int_t          TTF::fgTBlankW          = 0;
+thread_local Int_t          TTF::fgWidth            = 0;
+thread_local Int_t          TTF::fgAscent           = 0;
+thread_local Int_t          TTF::fgCurFontIdx       = -1;
+thread_local Int_t          TTF::fgSymbItaFontIdx   = -1;
+thread_local Int_t          TTF::fgFontCount        = 0;
+thread_local Int_t          TTF::fgNumGlyphs        = 0;
+thread_local char          *TTF::fgFontName[kTTMaxFonts];
+thread_local FT_Matrix     *TTF::fgRotMatrix        = nullptr;
+thread_local FT_Library     TTF::fgLibrary;
+thread_local FT_BBox        TTF::fgCBox;
+thread_local FT_Face        TTF::fgFace[kTTMaxFonts];
+thread_local FT_CharMap     TTF::fgCharMap[kTTMaxFonts];
+thread_local TTF::TTGlyph   TTF::fgGlyphs[kMaxGlyphs];
 
 ClassImp(TTF);
 
@@ -64,6 +64,9 @@ TTF::~TTF()
 
 void TTF::Init()
 {
+   // The fonts are loaded per thread, they are released when the thread exits
+   thread_local TTF threadCleanup;
+
    fgInit = kTRUE;
 
    // initialize FTF library
@@ -86,10 +89,15 @@ void TTF::Cleanup()
    for (int i = 0; i < fgFontCount; i++) {
       delete [] fgFontName[i];
       FT_Done_Face(fgFace[i]);
+      fgCharMap[i] = nullptr;
    }
    if (fgRotMatrix) delete fgRotMatrix;
+   fgRotMatrix = nullptr;
    FT_Done_FreeType(fgLibrary);
 
+   fgFontCount = 0;
+   fgCurFontIdx = -1;
+   fgSymbItaFontIdx = -1;
    fgInit = kFALSE;
 }
 
@@ -347,7 +347,7 @@ void TPDF::Close(Option_t *)
 
 void TPDF::DrawBox(Double_t x1, Double_t y1, Double_t x2, Double_t  y2)
 {
-   static Double_t x[4], y[4];
+   thread_local Double_t x[4], y[4];
    Double_t ix1 = XtoPDF(x1);
    Double_t ix2 = XtoPDF(x2);
    Double_t iy1 = YtoPDF(y1);
@@ -414,7 +414,7 @@ void TPDF::DrawBox(Double_t x1, Double_t y1, Double_t x2, Double_t  y2)
 void TPDF::DrawFrame(Double_t xl, Double_t yl, Double_t xt, Double_t  yt,
                             Int_t mode, Int_t border, Int_t dark, Int_t light)
 {
-   static Double_t xps[7], yps[7];
+   thread_local Double_t xps[7], yps[7];
    Int_t i;
 
    // Draw top&left part of the box
@@ -145,7 +145,7 @@ protected:
 
    void            *fUserData{nullptr};     //! Externally assigned and controlled user data.
 
-   std::unique_ptr<REveRenderData> fRenderData;//! Vertex / normal / triangle index information for rendering.
+   std::unique_ptr<REveRenderData> fRenderData;//! Vertex / normal / triangle index information for rendering, kept until the next stamp.
 
    virtual void PreDeleteElement();
    virtual void RemoveElementsInternal();
@@ -1416,6 +1416,11 @@ void REveElement::RecheckImpliedSelections()
 
 void REveElement::AddStamp(UChar_t bits)
 {
+   // Render data is kept between streamings and rebuilt only after a change
+   // that can affect it.
+   if (bits & ~kCBVisibility)
+      fRenderData.reset();
+
    if (fDestructing == kNone && fScene && fScene->IsAcceptingChanges())
    {
       if (gDebug > 0)
@@ -1456,7 +1461,9 @@ const std::string& REveElement::ToString(Bool_t b)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Write core json. If rnr_offset is negative, render data shall not be
-/// written.
+/// written. Render data is built only if it does not exist yet or was dropped
+/// by a change stamp, so unchanged elements, like static geometry, are not
+/// rebuilt when their scene is streamed again to a new client.
 /// Returns number of bytes written into binary render data.
 
 Int_t REveElement::WriteCoreJson(nlohmann::json &j, Int_t rnr_offset)
@@ -1479,7 +1486,8 @@ Int_t REveElement::WriteCoreJson(nlohmann::json &j, Int_t rnr_offset)
    Int_t ret = 0;
 
    if (rnr_offset >= 0) {
-      BuildRenderData();
+      if (!fRenderData)
+         BuildRenderData();
 
       if (fRenderData) {
          nlohmann::json rd = {};
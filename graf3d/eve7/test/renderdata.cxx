@@ -0,0 +1,39 @@
+#include "gtest/gtest.h"
+
+#include <ROOT/REveManager.hxx>
+#include <ROOT/REvePointSet.hxx>
+#include <ROOT/REveRenderData.hxx>
+#include <ROOT/REveScene.hxx>
+
+#include <nlohmann/json.hpp>
+
+// Render data is kept between streamings of the scene, until the element is changed
+TEST(REveElement, RenderDataReuse)
+{
+   namespace REX = ROOT::Experimental;
+
+   auto eveMng = REX::REveManager::Create();
+
+   auto ps = new REX::REvePointSet("hits");
+   for (int i = 0; i < 100; ++i)
+      ps->SetNextPoint(i, 2 * i, 3 * i);
+   eveMng->GetEventScene()->AddElement(ps);
+
+   nlohmann::json j;
+   EXPECT_LT(0, ps->WriteCoreJson(j, 0));
+   auto rd = ps->GetRenderData();
+   ASSERT_NE(nullptr, rd);
+
+   ps->WriteCoreJson(j, 0);
+   EXPECT_EQ(rd, ps->GetRenderData());
+
+   // A change of visibility does not drop the vertices
+   ps->SetRnrSelf(kFALSE);
+   EXPECT_EQ(rd, ps->GetRenderData());
+
+   ps->SetNextPoint(1, 2, 3);
+   ps->StampObjProps();
+   EXPECT_EQ(nullptr, ps->GetRenderData());
+   EXPECT_LT(0, ps->WriteCoreJson(j, 0));
+   EXPECT_NE(nullptr, ps->GetRenderData());
+}
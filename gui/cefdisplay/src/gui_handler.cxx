@@ -283,8 +283,8 @@ public:
          response->SetStatus(404);
          response_length = 0;
       } else {
-         response->SetMimeType(fArg->GetContentType());
-         response->SetStatus(200);
+         response->SetMimeType(fArg->Is304() ? "text/html" : fArg->GetContentType());
+         response->SetStatus(fArg->Is304() ? 304 : 200);
          response_length = fArg->GetContentLength();
 
          if (fArg->NumHeader() > 0) {
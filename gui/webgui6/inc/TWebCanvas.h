@@ -76,6 +76,7 @@ protected:
       bool _detected{false};   ///<! if pad was detected during last scan
       bool _modified{false};   ///<! if pad was modified during last scan
       bool _has_specials{false}; ///<! are there any special objects with painting
+      UInt_t fHash{0};         ///<! hash of pad attributes and primitives, see CalculatePadHash
    };
 
    std::vector<WebConn> fWebConn;  ///<! connections
@@ -106,6 +107,10 @@ protected:
    Bool_t fTF1UseSave{kFALSE};     ///<! use save buffer for TF1/TF2, need when evaluation failed on client side
    std::vector<int> fWindowGeometry; ///<! last received window geometry
    Bool_t fFixedSize{kFALSE};      ///<! is canvas size fixed
+   Bool_t fCheckPadContent{kTRUE}; ///<! when pad marked as modified, compare its content with the last sent one
+   Long64_t fSnapCanvVersion{0};   ///<! canvas version of cached snapshot JSON
+   Long64_t fSnapBaseVersion{0};   ///<! version already drawn by the client for which cached JSON was created
+   std::string fSnapJSON;          ///<! cached snapshot JSON, reused for all clients with same versions
 
    UpdatedSignal_t fUpdatedSignal; ///<! signal emitted when canvas updated or state is changed
    PadSignal_t fActivePadChangedSignal; ///<! signal emitted when active pad changed in the canvas
@@ -122,6 +127,7 @@ protected:
    TVirtualPadPainter *CreatePadPainter() override;
 
    UInt_t CalculateColorsHash();
+   UInt_t CalculatePadHash(TPad *pad);
    void AddColorsPalette(TPadWebSnapshot &master);
 
    void CreateObjectSnapshot(TPadWebSnapshot &master, TPad *pad, TObject *obj, const char *opt, TWebPS *masterps = nullptr);
@@ -230,6 +236,9 @@ public:
    void SetLongerPolling(Bool_t on) { fLongerPolling = on; }
    Bool_t GetLongerPolling() const { return fLongerPolling; }
 
+   void SetCheckPadContent(Bool_t on = kTRUE) { fCheckPadContent = on; }
+   Bool_t GetCheckPadContent() const { return fCheckPadContent; }
+
    void SetCustomScripts(const std::string &src);
 
    void AddCustomClass(const std::string &clname, bool with_derived = false);
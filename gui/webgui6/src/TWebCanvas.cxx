@@ -43,6 +43,7 @@
 #include "TScatter.h"
 #include "TCutG.h"
 #include "TBufferJSON.h"
+#include "TBufferFile.h"
 #include "TBase64.h"
 #include "TAtt3D.h"
 #include "TView.h"
@@ -87,6 +88,8 @@ Following settings parameters can be useful for TWebCanvas:
      WebGui.StyleDelivery:    1     provide gStyle object to JSROOT client (default - 1)
      WebGui.PaletteDelivery:  1     provide color palette to JSROOT client (default - 1)
      WebGui.TF1UseSave:       0     used saved values for function drawing (1) or calculate function on the client side (0) (default - 0)
+     WebGui.CheckPadContent:  1     do not send pads marked as modified when their attributes and primitives did not change (default - 1)
+     WebGui.JsonComp:        23     TBufferJSON compression of the data send to the clients, 33 codes numeric arrays with base64 (default - 23)
 
 TWebCanvas is used by default in interactive ROOT session. To use web-based canvas in batch mode for image
 generation, one should explicitly specify `--web` option when starting ROOT:
@@ -114,6 +117,7 @@ TWebCanvas::TWebCanvas(TCanvas *c, const char *name, Int_t x, Int_t y, UInt_t wi
    fPrimitivesMerge = gEnv->GetValue("WebGui.PrimitivesMerge", 100);
    fTF1UseSave = gEnv->GetValue("WebGui.TF1UseSave", (Int_t) 0) > 0;
    fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kSameSuppression + TBufferJSON::kNoSpaces);
+   fCheckPadContent = gEnv->GetValue("WebGui.CheckPadContent", (Int_t) 1) > 0;
 }
 
 
@@ -324,6 +328,32 @@ UInt_t TWebCanvas::CalculateColorsHash()
 }
 
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Calculate hash function for pad attributes and for the streamed content of its primitives
+/// Sub-pads are not streamed, they have their own status and are checked separately
+
+UInt_t TWebCanvas::CalculatePadHash(TPad *pad)
+{
+   UInt_t hash = TString::Hash(pad, pad->IsA()->Size());
+
+   TBufferFile buf(TBuffer::kWrite, 10000);
+
+   TIter iter(pad->GetListOfPrimitives());
+   while (auto obj = iter()) {
+      TString opt = iter.GetOption();
+      hash = hash * 31 + opt.Hash();
+      if (obj->InheritsFrom(TPad::Class())) {
+         hash = hash * 31 + TString::Hash(&obj, sizeof(obj));
+         continue;
+      }
+      buf.Reset();
+      buf.WriteObject(obj);
+      hash = hash * 31 + TString::Hash(buf.Buffer(), buf.Length());
+   }
+
+   return hash;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// Add special canvas objects like colors list at selected palette
 
@@ -857,27 +887,44 @@ void TWebCanvas::CheckDataToSend(unsigned connid)
 
             buf = "SNAP6:"s + std::to_string(fCanvVersion) + ":"s;
 
-            TCanvasWebSnapshot holder(IsReadOnly(), true, false); // readonly, set ids, batchmode
-
-            holder.SetFixedSize(fFixedSize); // set fixed size flag
-
-            // scripts send only when canvas drawn for the first time
-            if (!conn.fSendVersion)
-               holder.SetScripts(fCustomScripts);
-
-            holder.SetHighlightConnect(Canvas()->HasConnection("Highlighted(TVirtualPad*,TObject*,Int_t,Int_t)"));
-
-            CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, [&buf, &conn, this](TPadWebSnapshot *snap) {
-               auto json = TBufferJSON::ToJSON(snap, fJsonComp);
-               auto hash = json.Hash();
-               if (conn.fLastSendHash && (conn.fLastSendHash == hash) && conn.fSendVersion) {
+            // clients, which display the same version, get the same data without creating snapshot again
+            if (conn.fSendVersion && (fSnapCanvVersion == fCanvVersion) && (fSnapBaseVersion == conn.fSendVersion)) {
+               auto hash = TString::Hash(fSnapJSON.data(), fSnapJSON.length());
+               if (conn.fLastSendHash && (conn.fLastSendHash == hash)) {
                   // prevent looping when same data send many times
                   buf.clear();
                } else {
-                  buf.append(json.Data());
+                  buf.append(fSnapJSON);
                   conn.fLastSendHash = hash;
                }
-            });
+            } else {
+               TCanvasWebSnapshot holder(IsReadOnly(), true, false); // readonly, set ids, batchmode
+
+               holder.SetFixedSize(fFixedSize); // set fixed size flag
+
+               // scripts send only when canvas drawn for the first time
+               if (!conn.fSendVersion)
+                  holder.SetScripts(fCustomScripts);
+
+               holder.SetHighlightConnect(Canvas()->HasConnection("Highlighted(TVirtualPad*,TObject*,Int_t,Int_t)"));
+
+               CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, [&buf, &conn, this](TPadWebSnapshot *snap) {
+                  auto json = TBufferJSON::ToJSON(snap, fJsonComp);
+                  auto hash = TString::Hash(json.Data(), json.Length());
+                  if (conn.fSendVersion) {
+                     fSnapCanvVersion = fCanvVersion;
+                     fSnapBaseVersion = conn.fSendVersion;
+                     fSnapJSON = json.Data();
+                  }
+                  if (conn.fLastSendHash && (conn.fLastSendHash == hash) && conn.fSendVersion) {
+                     // prevent looping when same data send many times
+                     buf.clear();
+                  } else {
+                     buf.append(json.Data());
+                     conn.fLastSendHash = hash;
+                  }
+               });
+            }
 
             conn.fCheckedVersion = fCanvVersion;
 
@@ -1789,7 +1836,16 @@ void TWebCanvas::CheckPadModified(TPad *pad)
    entry._detected = true;
    if (pad->IsModified()) {
       pad->Modified(kFALSE);
-      entry._modified = true;
+      // pads marked as modified without real changes are not send to the clients again
+      if (fCheckPadContent) {
+         auto hash = CalculatePadHash(pad);
+         if (hash != entry.fHash) {
+            entry.fHash = hash;
+            entry._modified = true;
+         }
+      } else {
+         entry._modified = true;
+      }
    }
 
    TIter iter(pad->GetListOfPrimitives());
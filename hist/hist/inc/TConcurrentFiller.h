@@ -0,0 +1,187 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TConcurrentFiller
+#define ROOT_TConcurrentFiller
+
+#include "RtypesCore.h"
+
+#include <atomic>
+#include <memory>
+
+class TEfficiency;
+class TH1;
+class TProfile;
+class TProfile2D;
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ Sums accumulated concurrently by several threads filling the same histogram.
+
+ The sums of each bin are stored once, in an array of atomics: threads filling the same bin at the same time are rare
+ as soon as the histogram has more than a few bins. The global statistics (sums of the weights and of the weighted
+ coordinates, number of entries) are updated by every fill and would be a point of contention: they are spread over a
+ few shards, each on its own cache line, each thread always updating the same shard.
+*/
+class TConcurrentSums {
+public:
+   static constexpr unsigned int kMaxStats = 11; ///< Maximum number of statistics (those of a TH3)
+
+private:
+   static constexpr unsigned int kNShards = 16;
+
+   struct alignas(64) RShard {
+      std::atomic<Double_t> fStats[kMaxStats];
+      std::atomic<Long64_t> fEntries;
+   };
+
+   Int_t fNcells = 0;                                ///< Number of bins, including underflow and overflow
+   unsigned int fNValues = 0;                        ///< Number of sums per bin
+   unsigned int fNStats = 0;                         ///< Number of statistics
+   std::unique_ptr<std::atomic<Double_t>[]> fBins;   ///< Sums of the bins, fNValues per bin
+   std::unique_ptr<RShard[]> fShards;                ///< Shards of the global statistics
+
+   static unsigned int GetShard();
+
+public:
+   static void AtomicAdd(std::atomic<Double_t> &sum, Double_t value)
+   {
+      Double_t old = sum.load(std::memory_order_relaxed);
+      while (!sum.compare_exchange_weak(old, old + value, std::memory_order_relaxed))
+         ;
+   }
+
+   TConcurrentSums(Int_t ncells, unsigned int nvalues, unsigned int nstats);
+
+   void Reset();
+
+   /// Add `value` to the `i`-th sum of `bin`
+   void AddToBin(Int_t bin, unsigned int i, Double_t value) { AtomicAdd(fBins[bin * fNValues + i], value); }
+   Double_t GetBin(Int_t bin, unsigned int i) const { return fBins[bin * fNValues + i].load(std::memory_order_relaxed); }
+
+   /// Add one entry and, if `stats` is not null, the fNStats values it points to to the global statistics
+   void AddEntry(const Double_t *stats)
+   {
+      RShard &shard = fShards[GetShard()];
+      shard.fEntries.fetch_add(1, std::memory_order_relaxed);
+      if (stats) {
+         for (unsigned int i = 0; i < fNStats; ++i)
+            AtomicAdd(shard.fStats[i], stats[i]);
+      }
+   }
+
+   Int_t GetNcells() const { return fNcells; }
+   Long64_t GetEntries() const;
+   void GetStats(Double_t *stats) const;
+
+   void FlushHistogram(TH1 &h);
+};
+
+} // namespace Internal
+
+/**
+ \class ROOT::TProfileConcurrentFiller
+ \ingroup Histograms
+ Fill a TProfile concurrently from several threads without locks and without per-thread copies of the profile.
+
+ The filled values are accumulated in one shared set of atomic sums (see ROOT::Internal::TConcurrentSums), so that the
+ memory needed does not grow with the number of threads. They are added to the profile by Flush(), called by the
+ destructor, which must not run concurrently with Fill(). The results are those of TProfile::Fill, up to the rounding
+ of the sums which depends on the order of the fills. The axes of the profile are not extended and the fills with
+ labels are not supported.
+
+ ~~~{.cpp}
+ TProfile prof("prof", "prof", 100, 0., 1.);
+ ROOT::TProfileConcurrentFiller filler(prof);
+ // in any number of threads
+ filler.Fill(x, y, w);
+ // after joining the threads
+ filler.Flush();
+ ~~~
+*/
+class TProfileConcurrentFiller {
+   TProfile *fProfile;                  ///< The profile to be filled
+   Internal::TConcurrentSums fSums;     ///< Sums of w*y, w*y*y, w, w*w per bin
+   Double_t fYmin;                      ///< Lower limit in Y of the profile (if set)
+   Double_t fYmax;                      ///< Upper limit in Y of the profile (if set)
+   Bool_t fStatOverflows;               ///< Whether the underflow and overflow fills enter the statistics
+   std::atomic<bool> fWeighted{false};  ///< Whether a weight different from 1 was used
+
+public:
+   explicit TProfileConcurrentFiller(TProfile &profile);
+   TProfileConcurrentFiller(const TProfileConcurrentFiller &) = delete;
+   TProfileConcurrentFiller &operator=(const TProfileConcurrentFiller &) = delete;
+   ~TProfileConcurrentFiller() { Flush(); }
+
+   Int_t Fill(Double_t x, Double_t y, Double_t w = 1.);
+   void Flush();
+};
+
+/**
+ \class ROOT::TProfile2DConcurrentFiller
+ \ingroup Histograms
+ Fill a TProfile2D concurrently from several threads, see ROOT::TProfileConcurrentFiller.
+*/
+class TProfile2DConcurrentFiller {
+   TProfile2D *fProfile;                ///< The profile to be filled
+   Internal::TConcurrentSums fSums;     ///< Sums of w*z, w*z*z, w, w*w per bin
+   Double_t fZmin;                      ///< Lower limit in Z of the profile (if set)
+   Double_t fZmax;                      ///< Upper limit in Z of the profile (if set)
+   Bool_t fStatOverflows;               ///< Whether the underflow and overflow fills enter the statistics
+   std::atomic<bool> fWeighted{false};  ///< Whether a weight different from 1 was used
+
+public:
+   explicit TProfile2DConcurrentFiller(TProfile2D &profile);
+   TProfile2DConcurrentFiller(const TProfile2DConcurrentFiller &) = delete;
+   TProfile2DConcurrentFiller &operator=(const TProfile2DConcurrentFiller &) = delete;
+   ~TProfile2DConcurrentFiller() { Flush(); }
+
+   Int_t Fill(Double_t x, Double_t y, Double_t z, Double_t w = 1.);
+   void Flush();
+};
+
+/**
+ \class ROOT::TEfficiencyConcurrentFiller
+ \ingroup Histograms
+ Fill a TEfficiency concurrently from several threads, see ROOT::TProfileConcurrentFiller.
+
+ The weighted fills switch the TEfficiency to weighted events (see TEfficiency::SetUseWeightedEvents) when they are
+ flushed.
+*/
+class TEfficiencyConcurrentFiller {
+   TEfficiency *fEfficiency;            ///< The efficiency to be filled
+   Internal::TConcurrentSums fTotal;    ///< Sums of w, w*w per bin of the total histogram
+   Internal::TConcurrentSums fPassed;   ///< Sums of w, w*w per bin of the passed histogram
+   Int_t fDimension;                    ///< Dimension of the efficiency
+   Bool_t fStatOverflows;               ///< Whether the underflow and overflow fills enter the statistics
+   std::atomic<bool> fWeighted{false};  ///< Whether FillWeighted was called
+
+   void DoFill(Bool_t passed, Double_t w, Double_t x, Double_t y, Double_t z);
+
+public:
+   explicit TEfficiencyConcurrentFiller(TEfficiency &efficiency);
+   TEfficiencyConcurrentFiller(const TEfficiencyConcurrentFiller &) = delete;
+   TEfficiencyConcurrentFiller &operator=(const TEfficiencyConcurrentFiller &) = delete;
+   ~TEfficiencyConcurrentFiller() { Flush(); }
+
+   void Fill(Bool_t passed, Double_t x, Double_t y = 0, Double_t z = 0) { DoFill(passed, 1., x, y, z); }
+   void FillWeighted(Bool_t passed, Double_t weight, Double_t x, Double_t y = 0, Double_t z = 0)
+   {
+      fWeighted.store(true, std::memory_order_relaxed);
+      DoFill(passed, weight, x, y, z);
+   }
+   void Flush();
+};
+
+} // namespace ROOT
+
+#endif
@@ -25,8 +25,14 @@ class TH1;
 class TH2;
 class TList;
 
+namespace ROOT {
+class TEfficiencyConcurrentFiller;
+}
+
 class TEfficiency: public TNamed, public TAttLine, public TAttFill, public TAttMarker
 {
+   friend class ROOT::TEfficiencyConcurrentFiller;
+
 public:
    /// Enumeration type for different statistic options for calculating confidence intervals
    /// kF* ... frequentist methods; kB* ... bayesian methods
@@ -16,11 +16,14 @@
 #include <vector>
 #include "TF1.h"
 #include "TGraph.h"
+#include "TVirtualFFT.h"
 
 class TF1Convolution : public TF1AbsComposition {
    std::unique_ptr<TF1> fFunction1;    ///< First function to be convolved
    std::unique_ptr<TF1> fFunction2;    ///< Second function to be convolved
    std::unique_ptr<TGraph> fGraphConv; ///<! Graph of the convolution
+   std::unique_ptr<TVirtualFFT> fFFTForward; ///<! Transform of the two functions, kept for the next convolutions
+   std::unique_ptr<TVirtualFFT> fFFTInverse; ///<! Inverse transform of the product of the transforms
 
    std::vector < Double_t >   fParams1;
    std::vector < Double_t >   fParams2;
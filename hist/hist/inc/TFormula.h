@@ -19,12 +19,19 @@
 #include <vector>
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <atomic>
 #include <Math/Types.h>
 
 class TMethodCall;
 
+namespace ROOT {
+namespace Internal {
+class TFormulaEvaluator;
+}
+} // namespace ROOT
+
 
 class TFormulaFunction
 {
@@ -106,9 +113,11 @@ private:
    CallFuncSignature fGradFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    CallFuncSignature fHessFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
+   std::shared_ptr<const ROOT::Internal::TFormulaEvaluator> fEvaluator; ///<! Built-in evaluator, if the expression does not need Cling
    static bool       fIsCladRuntimeIncluded;
 
    void     InputFormulaIntoCling();
+   Bool_t   PrepareClingFunction();
    Bool_t   PrepareEvalMethod();
    void     FillDefaults();
    void     HandlePolN(TString &formula);
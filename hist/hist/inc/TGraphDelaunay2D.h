@@ -50,6 +50,11 @@ public:
    TGraphDelaunay2D(TGraph2D *g = nullptr);
 
    Double_t  ComputeZ(Double_t x, Double_t y) { return fDelaunay.Interpolate(x,y); }
+   void      ComputeZ(Int_t n, const Double_t *x, const Double_t *y, Double_t *z,
+                      ROOT::EExecutionPolicy executionPolicy = ROOT::EExecutionPolicy::kSequential)
+   {
+      fDelaunay.Interpolate(n, x, y, z, executionPolicy);
+   }
    void      FindAllTriangles() { fDelaunay.FindAllTriangles(); }
 
    TGraph2D *GetGraph2D() const {return fGraph2D;}
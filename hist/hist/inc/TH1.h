@@ -53,6 +53,11 @@ class TCollection;
 class TVirtualFFT;
 class TVirtualHistPainter;
 class TRandom;
+namespace ROOT {
+namespace Internal {
+class THistPrefixSums;
+}
+}
 
 
 class TH1 : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
@@ -109,6 +114,7 @@ protected:
     Int_t         fDimension;       ///<! Histogram dimension (1, 2 or 3 dim)
     Double_t     *fIntegral;        ///<! Integral of bins used by GetRandom
     TVirtualHistPainter *fPainter;  ///<! Pointer to histogram painter
+    ROOT::Internal::THistPrefixSums *fPrefixSums; ///<! Cumulative sums of the bin contents, if the integral cache is on
     EBinErrorOpt  fBinStatErrOpt;   ///<  Option for bin statistical errors
     EStatOverflows fStatOverflows;  ///<  Per object flag to use under/overflows in statistics
     static Int_t  fgBufferSize;     ///<! Default buffer size for automatic histograms
@@ -147,7 +153,10 @@ protected:
    virtual Double_t DoIntegral(Int_t ix1, Int_t ix2, Int_t iy1, Int_t iy2, Int_t iz1, Int_t iz2, Double_t & err,
                                Option_t * opt, Bool_t doerr = kFALSE) const;
 
+   const ROOT::Internal::THistPrefixSums *GetPrefixSums(Bool_t errors) const;
+
    virtual void     DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride=1);
+   virtual void     AddBinContents(Int_t n, const Int_t *bins, const Double_t *w);
    Bool_t    GetStatOverflowsBehaviour() const { return EStatOverflows::kNeutral == fStatOverflows ? fgStatOverflows : EStatOverflows::kConsider == fStatOverflows; }
 
    static bool CheckAxisLimits(const TAxis* a1, const TAxis* a2);
@@ -274,6 +283,7 @@ public:
    virtual Double_t GetBinWithContent(Double_t c, Int_t &binx, Int_t firstx = 0, Int_t lastx = 0,Double_t maxdiff = 0) const;
    virtual void     GetCenter(Double_t *center) const;
    static  Bool_t   GetDefaultSumw2();
+   static  Bool_t   GetDefaultStatOverflows();
    TDirectory      *GetDirectory() const {return fDirectory;}
    virtual Double_t GetEntries() const;
    virtual Double_t GetEffectiveEntries() const;
@@ -304,6 +314,7 @@ public:
 
    virtual Int_t    GetQuantiles(Int_t nprobSum, Double_t *q, const Double_t *probSum = nullptr);
    virtual Double_t GetRandom(TRandom * rng = nullptr) const;
+   virtual void     GetRandomArray(Int_t n, Double_t *x, TRandom * rng = nullptr) const;
    virtual void     GetStats(Double_t *stats) const;
    virtual Double_t GetStdDev(Int_t axis=1) const;
    virtual Double_t GetStdDevError(Int_t axis=1) const;
@@ -332,6 +343,7 @@ public:
    virtual Double_t Interpolate(Double_t x, Double_t y) const;
    virtual Double_t Interpolate(Double_t x, Double_t y, Double_t z) const;
            Bool_t   IsBinOverflow(Int_t bin, Int_t axis = 0) const;
+           Bool_t   HasIntegralCache() const { return fPrefixSums != nullptr; }
            Bool_t   IsBinUnderflow(Int_t bin, Int_t axis = 0) const;
    virtual Bool_t   IsHighlight() const { return TestBit(kIsHighlight); }
    virtual Double_t AndersonDarlingTest(const TH1 *h2, Option_t *option="") const;
@@ -342,6 +354,7 @@ public:
    virtual void     LabelsOption(Option_t *option="h", Option_t *axis="X");
    virtual Long64_t Merge(TCollection *list) { return Merge(list,""); }
            Long64_t Merge(TCollection *list, Option_t * option);
+           Long64_t Merge(Int_t n, TH1 *const *hists, Option_t *option = "");
    virtual Bool_t   Multiply(TF1 *f1, Double_t c1=1);
    virtual Bool_t   Multiply(const TH1 *h1);
    virtual Bool_t   Multiply(const TH1 *h1, const TH1 *h2, Double_t c1=1, Double_t c2=1, Option_t *option=""); // *MENU*
@@ -404,6 +417,7 @@ public:
            void     SetNameTitle(const char *name, const char *title) override;
    virtual void     SetNdivisions(Int_t n=510, Option_t *axis="X");
    virtual void     SetNormFactor(Double_t factor=1) {fNormFactor = factor;}
+           void     SetIntegralCache(Bool_t on = kTRUE);
    virtual void     SetStats(Bool_t stats=kTRUE); // *MENU*
    virtual void     SetOption(Option_t *option=" ") {fOption = option;}
    virtual void     SetTickLength(Float_t length=0.02, Option_t *axis="X");
@@ -589,6 +603,8 @@ public:
    void     AddBinContent(Int_t bin) override {++fArray[bin];}
    void     AddBinContent(Int_t bin, Double_t w) override
                           { fArray[bin] += Float_t (w); }
+   void     AddBinContents(Int_t n, const Int_t *bins, const Double_t *w) override
+                          { for (Int_t i = 0; i < n; ++i) fArray[bins[i]] += Float_t (w[i]); }
    void     Copy(TObject &hnew) const override;
    void     Reset(Option_t *option = "") override;
    void     SetBinsLength(Int_t n=-1) override;
@@ -632,6 +648,8 @@ public:
    void     AddBinContent(Int_t bin) override {++fArray[bin];}
    void     AddBinContent(Int_t bin, Double_t w) override
                           {fArray[bin] += Double_t (w);}
+   void     AddBinContents(Int_t n, const Int_t *bins, const Double_t *w) override
+                          { for (Int_t i = 0; i < n; ++i) fArray[bins[i]] += w[i]; }
    void     Copy(TObject &hnew) const override;
    void     Reset(Option_t *option = "") override;
    void     SetBinsLength(Int_t n=-1) override;
@@ -44,6 +44,7 @@ public:
    Int_t     Fill(Double_t x) override;
    Int_t     Fill(Double_t x,Double_t w) override{return TH1::Fill(x,w);}
    Int_t     Fill(const char *name,Double_t w) override{return TH1::Fill(name,w);}
+   void      FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride=1) override;
    Double_t  GetBinContent(Int_t bin) const override;
    Double_t  GetBinContent(Int_t bin,Int_t) const override {return GetBinContent(bin);}
    Double_t  GetBinContent(Int_t bin,Int_t,Int_t) const override {return GetBinContent(bin);}
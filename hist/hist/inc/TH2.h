@@ -276,6 +276,8 @@ public:
            void     AddBinContent(Int_t bin) override {++fArray[bin];}
            void     AddBinContent(Int_t bin, Double_t w) override
                                  {fArray[bin] += Float_t (w);}
+           void     AddBinContents(Int_t n, const Int_t *bins, const Double_t *w) override
+                                 { for (Int_t i = 0; i < n; ++i) fArray[bins[i]] += Float_t (w[i]); }
            void     Copy(TObject &hnew) const override;
            void     Reset(Option_t *option="") override;
            void     SetBinsLength(Int_t n=-1) override;
@@ -319,6 +321,8 @@ public:
            void     AddBinContent(Int_t bin) override {++fArray[bin];}
            void     AddBinContent(Int_t bin, Double_t w) override
                                  {fArray[bin] += Double_t (w);}
+           void     AddBinContents(Int_t n, const Int_t *bins, const Double_t *w) override
+                                 { for (Int_t i = 0; i < n; ++i) fArray[bins[i]] += w[i]; }
            void     Copy(TObject &hnew) const override;
            void     Reset(Option_t *option="") override;
            void     SetBinsLength(Int_t n=-1) override;
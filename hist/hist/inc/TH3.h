@@ -79,6 +79,8 @@ public:
            void     Copy(TObject &hnew) const override;
    virtual Int_t    Fill(Double_t x, Double_t y, Double_t z);
    virtual Int_t    Fill(Double_t x, Double_t y, Double_t z, Double_t w);
+   using TH1::FillN;
+   virtual void     FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride=1);
 
    virtual Int_t    Fill(const char *namex, const char *namey, const char *namez, Double_t w);
    virtual Int_t    Fill(const char *namex, Double_t y, const char *namez, Double_t w);
@@ -283,6 +285,8 @@ public:
            void      AddBinContent(Int_t bin) override {++fArray[bin];}
            void      AddBinContent(Int_t bin, Double_t w) override
                                  {fArray[bin] += Float_t (w);}
+           void      AddBinContents(Int_t n, const Int_t *bins, const Double_t *w) override
+                                 { for (Int_t i = 0; i < n; ++i) fArray[bins[i]] += Float_t (w[i]); }
            void      Copy(TObject &hnew) const override;
            void      Reset(Option_t *option="") override;
            void      SetBinsLength(Int_t n=-1) override;
@@ -322,6 +326,8 @@ public:
            void      AddBinContent(Int_t bin) override {++fArray[bin];}
            void      AddBinContent(Int_t bin, Double_t w) override
                                  {fArray[bin] += Double_t (w);}
+           void      AddBinContents(Int_t n, const Int_t *bins, const Double_t *w) override
+                                 { for (Int_t i = 0; i < n; ++i) fArray[bins[i]] += w[i]; }
            void      Copy(TObject &hnew) const override;
            void      Reset(Option_t *option="") override;
            void      SetBinsLength(Int_t n=-1) override;
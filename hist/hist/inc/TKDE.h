@@ -164,6 +164,14 @@ public:
       TKDE *fKDE;
       UInt_t fNWeights;               ///< Number of kernel weights (bandwidth as vectorized for binning)
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
+      std::vector<Double_t> fSortedData;       ///< Data points sorted by value
+      std::vector<Double_t> fSortedCounts;     ///< Counts of the sorted data points, if binned or weighted
+      std::vector<Double_t> fSortedInvWeights; ///< Inverse of the adaptive weights of the sorted data points
+      Double_t fMaxWeight;                     ///< Largest kernel weight
+
+      template <class KernelFunction>
+      Double_t SumInSupport(Double_t x, const KernelFunction &kernel, Double_t support) const;
+      Double_t Sum(Double_t x) const;
    public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
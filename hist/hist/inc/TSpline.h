@@ -66,6 +66,7 @@ public:
    virtual Double_t GetXmax()  const {return fXmax;}
    void     Paint(Option_t *option="") override;
    virtual Double_t Eval(Double_t x) const=0;
+   virtual void     EvalN(Int_t n, const Double_t *x, Double_t *y) const;
    void     SaveAs(const char * /*filename*/,Option_t * /*option*/) const override {}
    void             SetNpx(Int_t n) {fNpx=n;}
 
@@ -235,6 +236,7 @@ public:
    TSpline3& operator=(const TSpline3&);
    Int_t    FindX(Double_t x) const;
    Double_t Eval(Double_t x) const override;
+   void     EvalN(Int_t n, const Double_t *x, Double_t *y) const override;
    Double_t Derivative(Double_t x) const;
    ~TSpline3() override {if (fPoly) delete [] fPoly;}
    void GetCoeff(Int_t i, Double_t &x, Double_t &y, Double_t &b,
@@ -297,6 +299,7 @@ public:
    TSpline5& operator=(const TSpline5&);
    Int_t    FindX(Double_t x) const;
    Double_t Eval(Double_t x) const override;
+   void     EvalN(Int_t n, const Double_t *x, Double_t *y) const override;
    Double_t Derivative(Double_t x) const;
    ~TSpline5() override {if (fPoly) delete [] fPoly;}
    void GetCoeff(Int_t i, Double_t &x, Double_t &y, Double_t &b,
@@ -235,8 +235,28 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
    }
 
 
+   // option VEC: evaluate the formula on several points at once during the minimization
+   bool vectorizedForFit = false;
+   if (fitOption.Vectorized && !linear && !f1->IsVectorized()) {
+#ifdef R__HAS_VECCORE
+      if (f1->GetFormula() && f1->GetNdim() > 0) {
+         f1->SetVectorized(true);
+         vectorizedForFit = f1->IsVectorized();
+      }
+#else
+      Info("Fit", "Ignore option VEC: ROOT is built without VecCore");
+#endif
+   }
+
    // set the fit function
    // if option grad is specified use gradient
+#ifdef R__HAS_VECCORE
+   // the vectorized gradient does not support the integral of the function in the bins
+   if (!linear && fitOption.Gradient && !fitOption.Integral && f1->IsVectorized())
+      fitter->SetFunction(static_cast<const ROOT::Math::IParamMultiGradFunctionTempl<ROOT::Double_v> &>(
+         ROOT::Math::WrappedMultiTF1Templ<ROOT::Double_v>(*f1)));
+   else
+#endif
    if ( (linear || fitOption.Gradient) )
       fitter->SetFunction(ROOT::Math::WrappedMultiTF1(*f1));
 #ifdef R__HAS_VECCORE
@@ -379,6 +399,10 @@ TFitResultPtr HFit::Fit(FitObject * h1, TF1 *f1 , Foption_t & fitOption , const
       Warning("Fit","Abnormal termination of minimization.");
    iret |= !fitok;
 
+   // the function stored with the object is not vectorized, as the one given by the user
+   if (vectorizedForFit)
+      f1->SetVectorized(false);
+
 
    const ROOT::Fit::FitResult & fitResult = fitter->Result();
    // one could set directly the fit result in TF1
@@ -699,6 +723,27 @@ void ROOT::Fit::FitOptionsMake(EFitObjectType type, const char *option, Foption_
    TString opt = option;
    opt.ToUpper();
 
+   // if (opt.Contains("MULTIPROC")) {
+   //    fitOption.ExecPolicy = ROOT::Fit::kMultiprocess;
+   //    opt.ReplaceAll("MULTIPROC","");
+   // }
+
+   // options common to histograms and graphs which must be removed before parsing the single letter ones
+   if (opt.Contains("SERIAL")) {
+      fitOption.ExecPolicy = ROOT::EExecutionPolicy::kSequential;
+      opt.ReplaceAll("SERIAL","");
+   }
+
+   if (opt.Contains("MULTITHREAD")) {
+      fitOption.ExecPolicy = ROOT::EExecutionPolicy::kMultiThread;
+      opt.ReplaceAll("MULTITHREAD","");
+   }
+
+   if (opt.Contains("VEC")) {
+      fitOption.Vectorized = 1;
+      opt.ReplaceAll("VEC","");
+   }
+
    // parse firt the specific options
    if (type == EFitObjectType::kHistogram) {
 
@@ -714,21 +759,6 @@ void ROOT::Fit::FitOptionsMake(EFitObjectType type, const char *option, Foption_
             opt.ReplaceAll("WIDTH","");
       }
 
-      // if (opt.Contains("MULTIPROC")) {
-      //    fitOption.ExecPolicy = ROOT::Fit::kMultiprocess;
-      //    opt.ReplaceAll("MULTIPROC","");
-      // }
-
-      if (opt.Contains("SERIAL")) {
-         fitOption.ExecPolicy = ROOT::EExecutionPolicy::kSequential;
-         opt.ReplaceAll("SERIAL","");
-      }
-
-      if (opt.Contains("MULTITHREAD")) {
-         fitOption.ExecPolicy = ROOT::EExecutionPolicy::kMultiThread;
-         opt.ReplaceAll("MULTITHREAD","");
-      }
-
       if (opt.Contains("I"))  fitOption.Integral= 1;   // integral of function in the bin (no sense for graph)
       if (opt.Contains("W")) fitOption.W1     = 1; // all non-empty bins or points have weight =1 (for chi2 fit)
       if (opt.Contains("WW")) fitOption.W1      = 2; //all bins have weight=1, even empty bins
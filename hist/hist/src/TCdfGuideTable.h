@@ -0,0 +1,89 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Inverse transform sampling of tabulated cumulative distributions, used internally by TF1 and TH1
+
+#ifndef ROOT_TCdfGuideTable
+#define ROOT_TCdfGuideTable
+
+#include "RConfigure.h"
+#include "Rtypes.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <algorithm>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ Guide table (H. C. Chen and Y. Asau, 1974) of a cumulative distribution tabulated at `n` increasing values in [0,1].
+
+ The table stores, for each of `n` equal intervals of [0,1], the first entry of the distribution not below the
+ start of the interval. Find(r) then starts from the entry of the interval of `r` and needs about one comparison
+ on average, instead of the log2(n) of a binary search, while giving the same result as
+ TMath::BinarySearch(n, cdf, r).
+*/
+class TCdfGuideTable {
+   const Double_t *fCdf;         ///< Tabulated cumulative distribution, not owned
+   Long64_t fN;                  ///< Number of entries of fCdf
+   std::vector<Long64_t> fGuide; ///< fGuide[k] = number of entries of fCdf below k / fN
+
+public:
+   TCdfGuideTable(Long64_t n, const Double_t *cdf) : fCdf(cdf), fN(n), fGuide(n + 1)
+   {
+      Long64_t i = 0;
+      for (Long64_t k = 0; k <= n; ++k) {
+         const Double_t r = Double_t(k) / n;
+         while (i < n && fCdf[i] < r)
+            ++i;
+         fGuide[k] = i;
+      }
+   }
+
+   /// Position of `r` in the table, with the convention of TMath::BinarySearch: the first entry equal to `r` if
+   /// there is one, otherwise the last entry below `r` (-1 if none)
+   Long64_t Find(Double_t r) const
+   {
+      const Long64_t k = std::min(fN, std::max(Long64_t(0), Long64_t(r * fN)));
+      Long64_t i = fGuide[k];
+      // the interval of r can be off by one because of the rounding of r * fN
+      while (i > 0 && fCdf[i - 1] >= r)
+         --i;
+      while (i < fN && fCdf[i] < r)
+         ++i;
+      return (i < fN && fCdf[i] == r) ? i : i - 1;
+   }
+};
+
+/// Call `transform(first, last)` on consecutive ranges covering [0, n), in parallel if implicit multi-threading is
+/// enabled and there are enough samples
+template <typename Transform_t>
+void ForEachSampleRange(Long64_t n, Transform_t &&transform)
+{
+#ifdef R__USE_IMT
+   constexpr Long64_t kChunkSize = 8192;
+   if (ROOT::IsImplicitMTEnabled() && n > 2 * kChunkSize) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Long64_t chunk) { transform(chunk * kChunkSize, std::min(n, (chunk + 1) * kChunkSize)); },
+                   ROOT::TSeq<Long64_t>((n + kChunkSize - 1) / kChunkSize));
+      return;
+   }
+#endif
+   transform(Long64_t(0), n);
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,321 @@
+// @(#)root/hist:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TConcurrentFiller.h"
+
+#include "TEfficiency.h"
+#include "TError.h"
+#include "TH3.h"
+#include "TMath.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+#include "TProfileHelper.h"
+
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Index of the shard of the statistics updated by the calling thread.
+
+unsigned int TConcurrentSums::GetShard()
+{
+   static std::atomic<unsigned int> gNextShard{0};
+   thread_local const unsigned int shard = gNextShard.fetch_add(1, std::memory_order_relaxed) % kNShards;
+   return shard;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create the sums of a histogram of `ncells` bins, with `nvalues` sums per bin and `nstats` statistics.
+
+TConcurrentSums::TConcurrentSums(Int_t ncells, unsigned int nvalues, unsigned int nstats)
+   : fNcells(ncells),
+     fNValues(nvalues),
+     fNStats(nstats),
+     fBins(new std::atomic<Double_t>[(std::size_t)ncells * nvalues]),
+     fShards(new RShard[kNShards])
+{
+   R__ASSERT(nstats <= kMaxStats);
+   Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set all the sums to zero.
+
+void TConcurrentSums::Reset()
+{
+   for (std::size_t i = 0; i < (std::size_t)fNcells * fNValues; ++i)
+      fBins[i].store(0., std::memory_order_relaxed);
+   for (unsigned int s = 0; s < kNShards; ++s) {
+      for (unsigned int i = 0; i < kMaxStats; ++i)
+         fShards[s].fStats[i].store(0., std::memory_order_relaxed);
+      fShards[s].fEntries.store(0, std::memory_order_relaxed);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of entries accumulated in all the shards.
+
+Long64_t TConcurrentSums::GetEntries() const
+{
+   Long64_t entries = 0;
+   for (unsigned int s = 0; s < kNShards; ++s)
+      entries += fShards[s].fEntries.load(std::memory_order_relaxed);
+   return entries;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Statistics accumulated in all the shards.
+
+void TConcurrentSums::GetStats(Double_t *stats) const
+{
+   for (unsigned int i = 0; i < fNStats; ++i) {
+      stats[i] = 0;
+      for (unsigned int s = 0; s < kNShards; ++s)
+         stats[i] += fShards[s].fStats[i].load(std::memory_order_relaxed);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the sums of weights (first sum of each bin) and of squared weights (second sum) to the histogram `h`, then
+/// reset them.
+
+void TConcurrentSums::FlushHistogram(TH1 &h)
+{
+   Double_t stats[kMaxStats] = {0};
+   Double_t sums[kMaxStats];
+   h.GetStats(stats);
+   GetStats(sums);
+   for (unsigned int i = 0; i < fNStats; ++i)
+      stats[i] += sums[i];
+   const Double_t entries = h.GetEntries() + GetEntries();
+
+   const Bool_t errors = h.GetSumw2N() > 0;
+   for (Int_t bin = 0; bin < fNcells; ++bin) {
+      h.AddBinContent(bin, GetBin(bin, 0));
+      if (errors)
+         h.GetSumw2()->fArray[bin] += GetBin(bin, 1);
+   }
+   h.PutStats(stats);
+   h.SetEntries(entries);
+   Reset();
+}
+
+} // namespace Internal
+
+namespace {
+/// Whether the fills in the underflow and overflow bins of `h` enter its statistics
+Bool_t UsesStatOverflows(const TH1 &h)
+{
+   return h.GetStatOverflows() == TH1::kNeutral ? TH1::GetDefaultStatOverflows() : h.GetStatOverflows() == TH1::kConsider;
+}
+
+/// Number of statistics of a histogram of dimension `dim`
+unsigned int NStats(Int_t dim)
+{
+   return dim == 1 ? 4 : (dim == 2 ? 7 : 11);
+}
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare to fill `profile`, which must not be modified until the filler is flushed. The content of its buffer, if
+/// any, is first added to it.
+
+TProfileConcurrentFiller::TProfileConcurrentFiller(TProfile &profile)
+   : fProfile(&profile),
+     fSums(profile.GetNcells(), 4, 6),
+     fYmin(profile.GetYmin()),
+     fYmax(profile.GetYmax()),
+     fStatOverflows(UsesStatOverflows(profile))
+{
+   if (profile.GetBuffer())
+      profile.BufferEmpty(1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the profile as TProfile::Fill(x, y, w) does. Can be called concurrently by several threads.
+/// Return the bin number, or -1 if the fill is rejected or does not enter the statistics.
+
+Int_t TProfileConcurrentFiller::Fill(Double_t x, Double_t y, Double_t w)
+{
+   if (fYmin != fYmax) {
+      if (y < fYmin || y > fYmax || TMath::IsNaN(y))
+         return -1;
+   }
+   if (w != 1. && !fWeighted.load(std::memory_order_relaxed))
+      fWeighted.store(true, std::memory_order_relaxed);
+
+   const TAxis &xaxis = *fProfile->GetXaxis();
+   const Int_t bin = xaxis.FindFixBin(x);
+   fSums.AddToBin(bin, 0, w * y);
+   fSums.AddToBin(bin, 1, w * y * y);
+   fSums.AddToBin(bin, 2, w);
+   fSums.AddToBin(bin, 3, w * w);
+   if (!fStatOverflows && (bin == 0 || bin > xaxis.GetNbins())) {
+      fSums.AddEntry(nullptr);
+      return -1;
+   }
+   const Double_t stats[6] = {w, w * w, w * x, w * x * x, w * y, w * y * y};
+   fSums.AddEntry(stats);
+   return bin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the accumulated fills to the profile. Must not be called concurrently with Fill().
+
+void TProfileConcurrentFiller::Flush()
+{
+   if (fSums.GetEntries() == 0)
+      return;
+   TProfile &p = *fProfile;
+   if (!p.GetBinSumw2()->fN && fWeighted.load() && !p.TestBit(TH1::kIsNotW))
+      p.Sumw2();
+
+   Double_t stats[6], sums[6];
+   p.GetStats(stats);
+   fSums.GetStats(sums);
+   for (int i = 0; i < 6; ++i)
+      stats[i] += sums[i];
+   const Double_t entries = p.GetEntries() + fSums.GetEntries();
+
+   TProfileHelper::AddBinSums(&p, fSums);
+   p.PutStats(stats);
+   p.SetEntries(entries);
+   fSums.Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare to fill `profile`, which must not be modified until the filler is flushed. The content of its buffer, if
+/// any, is first added to it.
+
+TProfile2DConcurrentFiller::TProfile2DConcurrentFiller(TProfile2D &profile)
+   : fProfile(&profile),
+     fSums(profile.GetNcells(), 4, 9),
+     fZmin(profile.GetZmin()),
+     fZmax(profile.GetZmax()),
+     fStatOverflows(UsesStatOverflows(profile))
+{
+   if (profile.GetBuffer())
+      profile.BufferEmpty(1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the profile as TProfile2D::Fill(x, y, z, w) does. Can be called concurrently by several threads.
+/// Return the bin number, or -1 if the fill is rejected or does not enter the statistics.
+
+Int_t TProfile2DConcurrentFiller::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
+{
+   if (fZmin != fZmax) {
+      if (z < fZmin || z > fZmax || TMath::IsNaN(z))
+         return -1;
+   }
+   if (w != 1. && !fWeighted.load(std::memory_order_relaxed))
+      fWeighted.store(true, std::memory_order_relaxed);
+
+   const TAxis &xaxis = *fProfile->GetXaxis();
+   const TAxis &yaxis = *fProfile->GetYaxis();
+   const Int_t binx = xaxis.FindFixBin(x);
+   const Int_t biny = yaxis.FindFixBin(y);
+   const Int_t bin = biny * (xaxis.GetNbins() + 2) + binx;
+   fSums.AddToBin(bin, 0, w * z);
+   fSums.AddToBin(bin, 1, w * z * z);
+   fSums.AddToBin(bin, 2, w);
+   fSums.AddToBin(bin, 3, w * w);
+   if (!fStatOverflows && (binx == 0 || binx > xaxis.GetNbins() || biny == 0 || biny > yaxis.GetNbins())) {
+      fSums.AddEntry(nullptr);
+      return -1;
+   }
+   const Double_t stats[9] = {w, w * w, w * x, w * x * x, w * y, w * y * y, w * x * y, w * z, w * z * z};
+   fSums.AddEntry(stats);
+   return bin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the accumulated fills to the profile. Must not be called concurrently with Fill().
+
+void TProfile2DConcurrentFiller::Flush()
+{
+   if (fSums.GetEntries() == 0)
+      return;
+   TProfile2D &p = *fProfile;
+   if (!p.GetBinSumw2()->fN && fWeighted.load() && !p.TestBit(TH1::kIsNotW))
+      p.Sumw2();
+
+   Double_t stats[9], sums[9];
+   p.GetStats(stats);
+   fSums.GetStats(sums);
+   for (int i = 0; i < 9; ++i)
+      stats[i] += sums[i];
+   const Double_t entries = p.GetEntries() + fSums.GetEntries();
+
+   TProfileHelper::AddBinSums(&p, fSums);
+   p.PutStats(stats);
+   p.SetEntries(entries);
+   fSums.Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare to fill `efficiency`, which must not be modified until the filler is flushed.
+
+TEfficiencyConcurrentFiller::TEfficiencyConcurrentFiller(TEfficiency &efficiency)
+   : fEfficiency(&efficiency),
+     fTotal(efficiency.GetTotalHistogram()->GetNcells(), 2, NStats(efficiency.GetDimension())),
+     fPassed(efficiency.GetTotalHistogram()->GetNcells(), 2, NStats(efficiency.GetDimension())),
+     fDimension(efficiency.GetDimension()),
+     fStatOverflows(UsesStatOverflows(*efficiency.GetTotalHistogram()))
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the total histogram and, if `passed`, the passed histogram with weight `w`, as TEfficiency::FillWeighted
+/// does. Can be called concurrently by several threads.
+
+void TEfficiencyConcurrentFiller::DoFill(Bool_t passed, Double_t w, Double_t x, Double_t y, Double_t z)
+{
+   const TH1 &total = *fEfficiency->GetTotalHistogram();
+   const TAxis &xaxis = *total.GetXaxis();
+   const TAxis &yaxis = *total.GetYaxis();
+   const TAxis &zaxis = *total.GetZaxis();
+   const Int_t binx = xaxis.FindFixBin(x);
+   const Int_t biny = fDimension > 1 ? yaxis.FindFixBin(y) : 0;
+   const Int_t binz = fDimension > 2 ? zaxis.FindFixBin(z) : 0;
+   const Int_t bin = binx + (xaxis.GetNbins() + 2) * (biny + (yaxis.GetNbins() + 2) * binz);
+
+   Bool_t inRange = binx > 0 && binx <= xaxis.GetNbins();
+   if (fDimension > 1)
+      inRange &= biny > 0 && biny <= yaxis.GetNbins();
+   if (fDimension > 2)
+      inRange &= binz > 0 && binz <= zaxis.GetNbins();
+   const Double_t stats[11] = {w,         w * w,     w * x,     w * x * x, w * y,    w * y * y,
+                               w * x * y, w * z,     w * z * z, w * x * z, w * y * z};
+   const Double_t *entryStats = (inRange || fStatOverflows) ? stats : nullptr;
+
+   for (Internal::TConcurrentSums *sums : {&fTotal, &fPassed}) {
+      if (sums == &fPassed && !passed)
+         break;
+      sums->AddToBin(bin, 0, w);
+      sums->AddToBin(bin, 1, w * w);
+      sums->AddEntry(entryStats);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the accumulated fills to the efficiency. Must not be called concurrently with Fill().
+
+void TEfficiencyConcurrentFiller::Flush()
+{
+   if (fTotal.GetEntries() == 0)
+      return;
+   if (fWeighted.load() && !fEfficiency->UsesWeights())
+      fEfficiency->SetUseWeightedEvents();
+   fTotal.FlushHistogram(*fEfficiency->fTotalHistogram);
+   fPassed.FlushHistogram(*fEfficiency->fPassedHistogram);
+}
+
+} // namespace ROOT
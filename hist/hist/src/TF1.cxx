@@ -53,6 +53,7 @@
 #include "v5/TF1Data.h"
 
 #include "AnalyticalIntegrals.h"
+#include "TCdfGuideTable.h"
 
 std::atomic<Bool_t> TF1::fgAbsValue(kFALSE);
 Bool_t TF1::fgRejectPoint = kFALSE;
@@ -2157,6 +2158,23 @@ Bool_t TF1::ComputeCdfTable(Option_t * option) {
    return kTRUE;
 }
 
+namespace {
+
+/// Invert in bin `bin` the parabolic approximation of the cumulative integral tabulated by TF1::ComputeCdfTable
+inline Double_t InvertCdfInBin(Double_t r, Int_t bin, const Double_t *integral, const Double_t *alpha,
+                               const Double_t *beta, const Double_t *gamma)
+{
+   Double_t rr = r - integral[bin];
+   Double_t yy;
+   if (gamma[bin] != 0)
+      yy = (-beta[bin] + TMath::Sqrt(beta[bin] * beta[bin] + 2 * gamma[bin] * rr)) / gamma[bin];
+   else
+      yy = rr / beta[bin];
+   return alpha[bin] + yy;
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return a random number following this function shape.
 ///
@@ -2200,18 +2218,54 @@ Double_t TF1::GetRandom(TRandom * rng, Option_t * option)
    // return random number
    Double_t r  = (rng) ? rng->Rndm() : gRandom->Rndm();
    Int_t bin  = TMath::BinarySearch(fNpx, fIntegral.data(), r);
-   Double_t rr = r - fIntegral[bin];
-
-   Double_t yy;
-   if (fGamma[bin] != 0)
-      yy = (-fBeta[bin] + TMath::Sqrt(fBeta[bin] * fBeta[bin] + 2 * fGamma[bin] * rr)) / fGamma[bin];
-   else
-      yy = rr / fBeta[bin];
-   Double_t x = fAlpha[bin] + yy;
+   Double_t x = InvertCdfInBin(r, bin, fIntegral.data(), fAlpha.data(), fBeta.data(), fGamma.data());
    if (fAlpha[fNpx] > 0) return TMath::Power(10, x);
    return x;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill `x` with `n` random numbers following this function shape.
+///
+/// The numbers are the same as the ones of `n` successive calls to GetRandom(rng, option), but the uniform numbers
+/// are generated at once with TRandom::RndmArray and the bin of the tabulated integral is found with a guide table
+/// instead of a binary search. If implicit multi-threading is enabled, the uniform numbers are transformed in
+/// parallel; the result does not depend on it.
+///
+/// @param n  Number of random numbers
+/// @param x  Array of at least `n` values, filled with the random numbers (NaN if the integral cannot be tabulated)
+/// @param rng  Random number generator. By default (or when passing a nullptr) the global gRandom is used
+/// @param option Option string which controls the binning used to compute the integral, see GetRandom()
+
+void TF1::GetRandomArray(Int_t n, Double_t *x, TRandom *rng, Option_t *option)
+{
+   if (n <= 0)
+      return;
+   //  Check if integral array must be built
+   if (fIntegral.size() == 0) {
+      Bool_t ret = ComputeCdfTable(option);
+      if (!ret) {
+         std::fill(x, x + n, TMath::QuietNaN());
+         return;
+      }
+   }
+
+   if (rng)
+      rng->RndmArray(n, x);
+   else
+      gRandom->RndmArray(n, x);
+
+   const ROOT::Internal::TCdfGuideTable guide(fNpx, fIntegral.data());
+   const Bool_t logScale = fAlpha[fNpx] > 0;
+   ROOT::Internal::ForEachSampleRange(n, [&](Long64_t first, Long64_t last) {
+      for (Long64_t i = first; i < last; ++i) {
+         const Int_t bin = guide.Find(x[i]);
+         x[i] = InvertCdfInBin(x[i], bin, fIntegral.data(), fAlpha.data(), fBeta.data(), fGamma.data());
+         if (logScale)
+            x[i] = TMath::Power(10, x[i]);
+      }
+   });
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Return a random number following this function shape in [xmin,xmax]
@@ -2258,18 +2312,12 @@ Double_t TF1::GetRandom(Double_t xmin, Double_t xmax, TRandom * rng, Option_t *
    Double_t pmin = fIntegral[nbinmin];
    Double_t pmax = fIntegral[nbinmax];
 
-   Double_t r, x, xx, rr;
+   Double_t r, x;
    do {
       r  = (rng) ? rng->Uniform(pmin, pmax) : gRandom->Uniform(pmin, pmax);
 
       Int_t bin  = TMath::BinarySearch(fNpx, fIntegral.data(), r);
-      rr = r - fIntegral[bin];
-
-      if (fGamma[bin] != 0)
-         xx = (-fBeta[bin] + TMath::Sqrt(fBeta[bin] * fBeta[bin] + 2 * fGamma[bin] * rr)) / fGamma[bin];
-      else
-         xx = rr / fBeta[bin];
-      x = fAlpha[bin] + xx;
+      x = InvertCdfInBin(r, bin, fIntegral.data(), fAlpha.data(), fBeta.data(), fGamma.data());
    } while (x < xmin || x > xmax);
    return x;
 }
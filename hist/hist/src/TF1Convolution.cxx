@@ -260,12 +260,14 @@ void TF1Convolution::MakeFFTConv()
       Info("MakeFFTConv","Making FFT convolution using %d points in range [%g,%g]",fNofPoints,fXmin,fXmax);
 
    std::vector < Double_t > x  (fNofPoints);
-   std::vector < Double_t > in1(fNofPoints);
-   std::vector < Double_t > in2(fNofPoints);
+   std::vector < Double_t > in (2*fNofPoints);
 
-   TVirtualFFT *fft1 = TVirtualFFT::FFT(1, &fNofPoints, "R2C K");
-   TVirtualFFT *fft2 = TVirtualFFT::FFT(1, &fNofPoints, "R2C K");
-   if (fft1 == nullptr || fft2 == nullptr) {
+   // the transforms are kept for the next convolutions with the same number of points
+   if (!fFFTForward || !fFFTInverse || fFFTForward->GetN()[0] != fNofPoints) {
+      fFFTForward.reset(TVirtualFFT::FFT(1, &fNofPoints, "R2C K"));
+      fFFTInverse.reset(TVirtualFFT::FFT(1, &fNofPoints, "C2R K"));
+   }
+   if (fFFTForward == nullptr || fFFTInverse == nullptr) {
       Warning("MakeFFTConv","Cannot use FFT, probably FFTW package is not available. Switch to numerical convolution");
       fFlagFFT = false;
       return;
@@ -278,28 +280,28 @@ void TF1Convolution::MakeFFTConv()
    {
       x[i]   = fXmin + (fXmax-fXmin)/(fNofPoints-1)*i;
       x2     = x[i] - shift2;
-      in1[i] = fFunction1 -> EvalPar( &x[i], nullptr);
-      in2[i] = fFunction2 -> EvalPar( &x2, nullptr);
-      fft1  -> SetPoint(i, in1[i]);
-      fft2  -> SetPoint(i, in2[i]);
+      in[i]             = fFunction1 -> EvalPar( &x[i], nullptr);
+      in[fNofPoints+i]  = fFunction2 -> EvalPar( &x2, nullptr);
    }
-   fft1 -> Transform();
-   fft2 -> Transform();
+   // transform both functions together
+   const Int_t nout = fNofPoints/2 + 1;
+   std::vector < Double_t > out(4*nout);
+   fFFTForward -> TransformMany(2, in.data(), out.data());
 
    //inverse transformation of the product
 
-   TVirtualFFT *fftinverse = TVirtualFFT::FFT(1, &fNofPoints, "C2R K");
-   Double_t re1, re2, im1, im2, out_re, out_im;
-
-   for (int i=0;i<=fNofPoints/2.;i++)
+   const Double_t *out1 = out.data();
+   const Double_t *out2 = out.data() + 2*nout;
+   std::vector < Double_t > product(2*nout);
+   for (int i=0;i<nout;i++)
    {
-      fft1 -> GetPointComplex(i,re1,im1);
-      fft2 -> GetPointComplex(i,re2,im2);
-      out_re = re1*re2 - im1*im2;
-      out_im = re1*im2 + re2*im1;
-      fftinverse -> SetPoint(i, out_re, out_im);
+      const Double_t re1 = out1[2*i], im1 = out1[2*i+1];
+      const Double_t re2 = out2[2*i], im2 = out2[2*i+1];
+      product[2*i]   = re1*re2 - im1*im2;
+      product[2*i+1] = re1*im2 + re2*im1;
    }
-   fftinverse -> Transform();
+   fFFTInverse -> SetPoints(product.data());
+   fFFTInverse -> Transform();
 
    // fill a graph with the result of the convolution
    if (!fGraphConv)
@@ -311,15 +313,10 @@ void TF1Convolution::MakeFFTConv()
       int j = i + fNofPoints/2;
       if (j >= fNofPoints) j -= fNofPoints;
       // need to normalize by dividing by the number of points and multiply by the bin width = Range/Number of points
-      fGraphConv->SetPoint(i, x[i], fftinverse->GetPointReal(j)*(fXmax-fXmin)/(fNofPoints*fNofPoints) );
+      fGraphConv->SetPoint(i, x[i], fFFTInverse->GetPointReal(j)*(fXmax-fXmin)/(fNofPoints*fNofPoints) );
    }
    fGraphConv->SetBit(TGraph::kIsSortedX); // indicate that points are sorted in X to speed up TGraph::Eval
    fFlagGraph = true; // we can use the graph
-
-   // delete the fft objects
-   delete fft1;
-   delete fft2;
-   delete fftinverse;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,7 @@
 #include "TInterpreter.h"
 #include "TInterpreterValue.h"
 #include "TFormula.h"
+#include "TFormulaEvaluator.h"
 #include "TRegexp.h"
 
 #include "ROOT/StringUtils.hxx"
@@ -247,6 +248,15 @@ ClassImp(TFormula);
     function. That means the expression `x@2` will be expanded to
     ```[n]*x + [n+1]*2``` where n is the first previously unused parameter number.
 
+    ### Evaluation without Cling
+
+    The expressions made only of numbers, variables, parameters, arithmetic, comparison and logical operators and of
+    the usual mathematical functions (as the predefined functions `gaus`, `expo`, `landau`, `polN`, `chebN`, ...) are
+    not compiled with Cling: they are evaluated by a small built-in interpreter, which is faster to set up and does
+    not take the interpreter lock, e.g. when the same function is fitted from several threads. Any other expression,
+    as well as the vectorized ones, is compiled with Cling. The function is declared to Cling anyway when its
+    gradient or hessian is computed with clad.
+
     \class TFormulaFunction
     Helper class for TFormula
 
@@ -754,6 +764,7 @@ void TFormula::Copy(TObject &obj) const
    fnew.fMethod.reset(m);
 
    fnew.fFuncPtr = fFuncPtr;
+   fnew.fEvaluator = fEvaluator;
    fnew.fGradGenerationInput = fGradGenerationInput;
    fnew.fHessGenerationInput = fHessGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
@@ -774,6 +785,7 @@ void TFormula::Clear(Option_t * )
    fClingName = "";
 
    fMethod.reset();
+   fEvaluator.reset();
 
    fClingVariables.clear();
    fClingParameters.clear();
@@ -897,6 +909,32 @@ void TFormula::InputFormulaIntoCling()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Declare the function to Cling if the formula is evaluated by the built-in evaluator,
+/// e.g. to generate its gradient with clad. Returns false if it could not be compiled.
+
+Bool_t TFormula::PrepareClingFunction()
+{
+   if (!fEvaluator || fFuncPtr)
+      return true;
+
+   R__LOCKGUARD(gROOTMutex);
+   auto funcit = gClingFunctions.find(fSavedInputFormula);
+   if (funcit != gClingFunctions.end()) {
+      fFuncPtr = (TFormula::CallFuncSignature)funcit->second;
+      return true;
+   }
+   // the formula is valid, InputFormulaIntoCling compiles it only if it is not yet initialized
+   fClingInitialized = false;
+   InputFormulaIntoCling();
+   if (fClingInitialized)
+      gClingFunctions.insert(std::make_pair(fSavedInputFormula, (void *)fFuncPtr));
+   else
+      fFuncPtr = nullptr;
+   fClingInitialized = true;
+   return fFuncPtr != nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///    Fill structures with default variables, constants and function shortcuts
 
@@ -2356,7 +2394,16 @@ void TFormula::ProcessFormula(TString &formula)
          //       fClingInitialized = false;
          // }
 
-         if (inputIntoCling) {
+         // no need of Cling for the expressions the built-in evaluator understands
+         fEvaluator.reset();
+         if (inputIntoCling && !fVectorized)
+            fEvaluator = ROOT::Internal::TFormulaEvaluator::Compile(inputFormula, fNdim, fNpar);
+
+         if (fEvaluator) {
+            fFuncPtr = nullptr;
+            fSavedInputFormula = inputFormulaVecFlag;
+            fClingInitialized = true;
+         } else if (inputIntoCling) {
             if (!fLazyInitialization) {
                InputFormulaIntoCling();
                if (fClingInitialized) {
@@ -3256,7 +3303,7 @@ bool TFormula::GenerateGradientPar() {
    if (fGradFuncPtr)
       return true;
 
-   if (HasGradientGenerationFailed())
+   if (HasGradientGenerationFailed() || !PrepareClingFunction())
       return false;
 
    IncludeCladRuntime(fIsCladRuntimeIncluded);
@@ -3321,7 +3368,7 @@ bool TFormula::GenerateHessianPar()
    if (fHessFuncPtr)
       return true;
 
-   if (HasHessianGenerationFailed())
+   if (HasHessianGenerationFailed() || !PrepareClingFunction())
       return false;
 
    IncludeCladRuntime(fIsCladRuntimeIncluded);
@@ -3468,6 +3515,11 @@ Double_t TFormula::DoEval(const double * x, const double * params) const
       return TMath::QuietNaN();
    }
 
+   if (fEvaluator) {
+      const double *vars = (x) ? x : fClingVariables.data();
+      return fEvaluator->Eval(vars, (params) ? params : fClingParameters.data());
+   }
+
    // Lazy initialization is set and needed when reading from a file
    if (!fClingInitialized && fLazyInitialization) {
       // try recompiling the formula. We need to lock because this is not anymore thread safe
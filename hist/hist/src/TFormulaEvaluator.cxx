@@ -0,0 +1,413 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TFormulaEvaluator.h"
+
+#include "TMath.h"
+#include "Math/ChebyshevPol.h"
+#include "Math/PdfFuncMathCore.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+using ROOT::Internal::TFormulaEvaluator;
+
+namespace {
+
+template <unsigned int N>
+double Chebyshev(const double *a)
+{
+   return ROOT::Math::ChebyshevN(N, a[0], a + 1);
+}
+
+struct RFunction {
+   const char *fName;
+   int fNargs;
+   TFormulaEvaluator::Func_t fFunc;
+   bool fKeepsInteger; ///< The result is an integer if all the arguments are, as for the templated TMath functions
+};
+
+// The functions TFormula replaces the short cuts with (e.g. exp -> TMath::Exp), the ones used by its predefined
+// functions and the functions of the C library with the same name
+const RFunction gFunctions[] = {
+   {"TMath::Exp", 1, [](const double *a) { return std::exp(a[0]); }, false},
+   {"TMath::Log", 1, [](const double *a) { return std::log(a[0]); }, false},
+   {"TMath::Log10", 1, [](const double *a) { return std::log10(a[0]); }, false},
+   {"TMath::Sqrt", 1, [](const double *a) { return std::sqrt(a[0]); }, false},
+   {"TMath::Sin", 1, [](const double *a) { return std::sin(a[0]); }, false},
+   {"TMath::Cos", 1, [](const double *a) { return std::cos(a[0]); }, false},
+   {"TMath::Tan", 1, [](const double *a) { return std::tan(a[0]); }, false},
+   {"TMath::ASin", 1, [](const double *a) { return TMath::ASin(a[0]); }, false},
+   {"TMath::ACos", 1, [](const double *a) { return TMath::ACos(a[0]); }, false},
+   {"TMath::ATan", 1, [](const double *a) { return std::atan(a[0]); }, false},
+   {"TMath::ATan2", 2, [](const double *a) { return TMath::ATan2(a[0], a[1]); }, false},
+   {"TMath::SinH", 1, [](const double *a) { return std::sinh(a[0]); }, false},
+   {"TMath::CosH", 1, [](const double *a) { return std::cosh(a[0]); }, false},
+   {"TMath::TanH", 1, [](const double *a) { return std::tanh(a[0]); }, false},
+   {"TMath::Ceil", 1, [](const double *a) { return std::ceil(a[0]); }, false},
+   {"TMath::Floor", 1, [](const double *a) { return std::floor(a[0]); }, false},
+   {"TMath::Power", 2, [](const double *a) { return std::pow(a[0], a[1]); }, false},
+   {"TMath::Sq", 1, [](const double *a) { return a[0] * a[0]; }, false},
+   {"TMath::Abs", 1, [](const double *a) { return std::abs(a[0]); }, true},
+   {"TMath::Min", 2, [](const double *a) { return TMath::Min(a[0], a[1]); }, true},
+   {"TMath::Max", 2, [](const double *a) { return TMath::Max(a[0], a[1]); }, true},
+   {"TMath::Sign", 2, [](const double *a) { return TMath::Sign(a[0], a[1]); }, true},
+   {"TMath::Erf", 1, [](const double *a) { return TMath::Erf(a[0]); }, false},
+   {"TMath::Erfc", 1, [](const double *a) { return TMath::Erfc(a[0]); }, false},
+   {"TMath::Gaus", 1, [](const double *a) { return TMath::Gaus(a[0]); }, false},
+   {"TMath::Gaus", 2, [](const double *a) { return TMath::Gaus(a[0], a[1]); }, false},
+   {"TMath::Gaus", 3, [](const double *a) { return TMath::Gaus(a[0], a[1], a[2]); }, false},
+   {"TMath::Gaus", 4, [](const double *a) { return TMath::Gaus(a[0], a[1], a[2], a[3] != 0); }, false},
+   {"TMath::Landau", 1, [](const double *a) { return TMath::Landau(a[0]); }, false},
+   {"TMath::Landau", 2, [](const double *a) { return TMath::Landau(a[0], a[1]); }, false},
+   {"TMath::Landau", 3, [](const double *a) { return TMath::Landau(a[0], a[1], a[2]); }, false},
+   {"TMath::Landau", 4, [](const double *a) { return TMath::Landau(a[0], a[1], a[2], a[3] != 0); }, false},
+   {"ROOT::Math::breitwigner_pdf", 2, [](const double *a) { return ROOT::Math::breitwigner_pdf(a[0], a[1]); }, false},
+   {"ROOT::Math::breitwigner_pdf", 3,
+    [](const double *a) { return ROOT::Math::breitwigner_pdf(a[0], a[1], a[2]); }, false},
+   {"ROOT::Math::crystalball_function", 4,
+    [](const double *a) { return ROOT::Math::crystalball_function(a[0], a[1], a[2], a[3]); }, false},
+   {"ROOT::Math::crystalball_function", 5,
+    [](const double *a) { return ROOT::Math::crystalball_function(a[0], a[1], a[2], a[3], a[4]); }, false},
+   {"ROOT::Math::Chebyshev0", 2, Chebyshev<0>, false},
+   {"ROOT::Math::Chebyshev1", 3, Chebyshev<1>, false},
+   {"ROOT::Math::Chebyshev2", 4, Chebyshev<2>, false},
+   {"ROOT::Math::Chebyshev3", 5, Chebyshev<3>, false},
+   {"ROOT::Math::Chebyshev4", 6, Chebyshev<4>, false},
+   {"ROOT::Math::Chebyshev5", 7, Chebyshev<5>, false},
+   {"ROOT::Math::Chebyshev6", 8, Chebyshev<6>, false},
+   {"ROOT::Math::Chebyshev7", 9, Chebyshev<7>, false},
+   {"ROOT::Math::Chebyshev8", 10, Chebyshev<8>, false},
+   {"ROOT::Math::Chebyshev9", 11, Chebyshev<9>, false},
+   {"ROOT::Math::Chebyshev10", 12, Chebyshev<10>, false},
+   {"exp", 1, [](const double *a) { return std::exp(a[0]); }, false},
+   {"log", 1, [](const double *a) { return std::log(a[0]); }, false},
+   {"log10", 1, [](const double *a) { return std::log10(a[0]); }, false},
+   {"sqrt", 1, [](const double *a) { return std::sqrt(a[0]); }, false},
+   {"sin", 1, [](const double *a) { return std::sin(a[0]); }, false},
+   {"cos", 1, [](const double *a) { return std::cos(a[0]); }, false},
+   {"tan", 1, [](const double *a) { return std::tan(a[0]); }, false},
+   {"asin", 1, [](const double *a) { return std::asin(a[0]); }, false},
+   {"acos", 1, [](const double *a) { return std::acos(a[0]); }, false},
+   {"atan", 1, [](const double *a) { return std::atan(a[0]); }, false},
+   {"atan2", 2, [](const double *a) { return std::atan2(a[0], a[1]); }, false},
+   {"sinh", 1, [](const double *a) { return std::sinh(a[0]); }, false},
+   {"cosh", 1, [](const double *a) { return std::cosh(a[0]); }, false},
+   {"tanh", 1, [](const double *a) { return std::tanh(a[0]); }, false},
+   {"ceil", 1, [](const double *a) { return std::ceil(a[0]); }, false},
+   {"floor", 1, [](const double *a) { return std::floor(a[0]); }, false},
+   {"pow", 2, [](const double *a) { return std::pow(a[0], a[1]); }, false},
+   {"fabs", 1, [](const double *a) { return std::fabs(a[0]); }, false},
+   {"erf", 1, [](const double *a) { return std::erf(a[0]); }, false},
+   {"erfc", 1, [](const double *a) { return std::erfc(a[0]); }, false},
+};
+
+const RFunction *FindFunction(const std::string &name, int nargs)
+{
+   // the functions of the standard library are the same with or without namespace
+   const char *unqualified = name.compare(0, 5, "std::") == 0 ? name.c_str() + 5 : name.c_str();
+   for (const auto &func : gFunctions) {
+      if (func.fNargs == nargs && std::strcmp(func.fName, unqualified) == 0)
+         return &func;
+   }
+   return nullptr;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Recursive descent parser of the expressions, following the precedence of the C++ operators. Each method parses
+/// a sub-expression, appends its instructions to the evaluator and returns false if it cannot be evaluated without
+/// Cling; `isInteger` tells whether the value of the sub-expression is an integer for C++, which matters only for
+/// the division.
+
+class TFormulaEvaluator::RParser {
+   const char *fCur;
+   int fNdim;
+   int fNpar;
+   int fDepth = 0;
+   TFormulaEvaluator &fEvaluator;
+
+   void SkipSpaces()
+   {
+      while (std::isspace(static_cast<unsigned char>(*fCur)))
+         ++fCur;
+   }
+
+   /// Skip `token` and the spaces after it if the expression continues with it
+   bool Accept(const char *token)
+   {
+      SkipSpaces();
+      const auto len = std::strlen(token);
+      if (std::strncmp(fCur, token, len) != 0)
+         return false;
+      fCur += len;
+      SkipSpaces();
+      return true;
+   }
+
+   /// Accept a one character operator which is not the beginning of a two character one, e.g. `<` but not `<=`
+   bool AcceptSingle(char op, const char *notFollowedBy)
+   {
+      SkipSpaces();
+      if (fCur[0] != op || (fCur[1] && std::strchr(notFollowedBy, fCur[1])))
+         return false;
+      ++fCur;
+      SkipSpaces();
+      return true;
+   }
+
+   bool Emit(RInstruction instr, int stackChange)
+   {
+      fDepth += stackChange;
+      if (fDepth > kMaxStackSize)
+         return false;
+      if (fDepth > fEvaluator.fStackSize)
+         fEvaluator.fStackSize = fDepth;
+      fEvaluator.fCode.push_back(instr);
+      return true;
+   }
+
+   bool EmitOp(EOpCode op, int stackChange) { return Emit({op}, stackChange); }
+
+   bool ParseBinary(int level, bool &isInteger);
+   bool ParseUnary(bool &isInteger);
+   bool ParsePrimary(bool &isInteger);
+   bool ParseNumber(bool &isInteger);
+
+public:
+   RParser(const std::string &expression, int ndim, int npar, TFormulaEvaluator &evaluator)
+      : fCur(expression.c_str()), fNdim(ndim), fNpar(npar), fEvaluator(evaluator)
+   {
+   }
+
+   bool Parse()
+   {
+      bool isInteger;
+      if (!ParseBinary(0, isInteger))
+         return false;
+      SkipSpaces();
+      return *fCur == '\0' && fDepth == 1;
+   }
+};
+
+bool TFormulaEvaluator::RParser::ParseBinary(int level, bool &isInteger)
+{
+   struct RBinaryOperator {
+      const char *fToken;
+      const char *fNotFollowedBy; ///< For the one character tokens, the characters which would make another operator
+      EOpCode fOp;
+   };
+   // by increasing precedence
+   static const std::vector<std::vector<RBinaryOperator>> operators = {
+      {{"||", nullptr, EOpCode::kOr}},
+      {{"&&", nullptr, EOpCode::kAnd}},
+      {{"==", nullptr, EOpCode::kEqual}, {"!=", nullptr, EOpCode::kNotEqual}},
+      {{"<=", nullptr, EOpCode::kLessEqual},
+       {">=", nullptr, EOpCode::kGreaterEqual},
+       {"<", "<=", EOpCode::kLess},
+       {">", ">=", EOpCode::kGreater}},
+      {{"+", "+=", EOpCode::kAdd}, {"-", "-=", EOpCode::kSub}},
+      {{"*", "*=", EOpCode::kMul}, {"/", "/=", EOpCode::kDiv}},
+   };
+   if (level == (int)operators.size())
+      return ParseUnary(isInteger);
+
+   if (!ParseBinary(level + 1, isInteger))
+      return false;
+   while (true) {
+      const RBinaryOperator *op = nullptr;
+      for (const auto &candidate : operators[level]) {
+         if (candidate.fNotFollowedBy ? AcceptSingle(candidate.fToken[0], candidate.fNotFollowedBy)
+                                      : Accept(candidate.fToken)) {
+            op = &candidate;
+            break;
+         }
+      }
+      if (!op)
+         return true;
+
+      bool rightIsInteger;
+      if (!ParseBinary(level + 1, rightIsInteger))
+         return false;
+      // the integer division of C++ is left to Cling
+      if (op->fOp == EOpCode::kDiv && isInteger && rightIsInteger)
+         return false;
+      if (op->fOp >= EOpCode::kLess)
+         isInteger = true; // bool
+      else
+         isInteger = isInteger && rightIsInteger;
+      if (!EmitOp(op->fOp, -1))
+         return false;
+   }
+}
+
+bool TFormulaEvaluator::RParser::ParseUnary(bool &isInteger)
+{
+   if (AcceptSingle('-', "-=")) {
+      if (!ParseUnary(isInteger))
+         return false;
+      auto &last = fEvaluator.fCode.back();
+      if (last.fOp == EOpCode::kConst) {
+         last.fValue = -last.fValue;
+         return true;
+      }
+      return EmitOp(EOpCode::kNeg, 0);
+   }
+   if (AcceptSingle('+', "+="))
+      return ParseUnary(isInteger);
+   if (AcceptSingle('!', "=")) {
+      if (!ParseUnary(isInteger))
+         return false;
+      isInteger = true;
+      return EmitOp(EOpCode::kNot, 0);
+   }
+   return ParsePrimary(isInteger);
+}
+
+bool TFormulaEvaluator::RParser::ParseNumber(bool &isInteger)
+{
+   // octal literals are left to Cling
+   if (fCur[0] == '0' && std::isdigit(static_cast<unsigned char>(fCur[1])))
+      return false;
+   char *end;
+   const double value = std::strtod(fCur, &end);
+   const std::string literal(fCur, end - fCur);
+   // as well as hexadecimal and suffixed ones
+   if (literal.empty() || literal.find_first_of("xX") != std::string::npos || *end == '_' ||
+       std::isalnum(static_cast<unsigned char>(*end)))
+      return false;
+   isInteger = literal.find_first_of(".eE") == std::string::npos;
+   fCur = end;
+   SkipSpaces();
+   RInstruction instr{EOpCode::kConst};
+   instr.fValue = value;
+   return Emit(instr, 1);
+}
+
+bool TFormulaEvaluator::RParser::ParsePrimary(bool &isInteger)
+{
+   SkipSpaces();
+   if (Accept("(")) {
+      if (!ParseBinary(0, isInteger))
+         return false;
+      return Accept(")");
+   }
+   if (std::isdigit(static_cast<unsigned char>(*fCur)) || *fCur == '.')
+      return ParseNumber(isInteger);
+
+   // (qualified) name
+   std::string name;
+   while (std::isalnum(static_cast<unsigned char>(*fCur)) || *fCur == '_' || (fCur[0] == ':' && fCur[1] == ':')) {
+      if (*fCur == ':') {
+         name += "::";
+         fCur += 2;
+      } else {
+         name += *fCur++;
+      }
+   }
+   if (name.empty())
+      return false;
+
+   if (name == "true" || name == "false") {
+      isInteger = true;
+      RInstruction instr{EOpCode::kConst};
+      instr.fValue = name == "true";
+      return Emit(instr, 1);
+   }
+
+   if ((name == "x" || name == "p") && Accept("[")) {
+      if (!std::isdigit(static_cast<unsigned char>(*fCur)))
+         return false;
+      char *end;
+      const long index = std::strtol(fCur, &end, 10);
+      fCur = end;
+      if (!Accept("]"))
+         return false;
+      const bool isVar = name == "x";
+      if (index >= (isVar ? fNdim : fNpar))
+         return false;
+      isInteger = false;
+      RInstruction instr{isVar ? EOpCode::kVar : EOpCode::kPar};
+      instr.fIndex = index;
+      return Emit(instr, 1);
+   }
+
+   if (!Accept("("))
+      return false;
+   int nargs = 0;
+   bool allInteger = true;
+   if (!Accept(")")) {
+      do {
+         bool argIsInteger;
+         if (!ParseBinary(0, argIsInteger))
+            return false;
+         allInteger = allInteger && argIsInteger;
+         ++nargs;
+      } while (Accept(","));
+      if (!Accept(")"))
+         return false;
+   }
+   const RFunction *func = FindFunction(name, nargs);
+   if (!func)
+      return false;
+   isInteger = func->fKeepsInteger && allInteger;
+   RInstruction instr{EOpCode::kCall};
+   instr.fIndex = nargs;
+   instr.fFunc = func->fFunc;
+   return Emit(instr, 1 - nargs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<TFormulaEvaluator>
+TFormulaEvaluator::Compile(const std::string &expression, int ndim, int npar)
+{
+   std::unique_ptr<TFormulaEvaluator> evaluator(new TFormulaEvaluator);
+   RParser parser(expression, ndim, npar, *evaluator);
+   if (!parser.Parse())
+      return nullptr;
+   return evaluator;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the expression for the variables `x` and the parameters `p`
+
+double TFormulaEvaluator::Eval(const double *x, const double *p) const
+{
+   double stack[kMaxStackSize];
+   int top = -1;
+   for (const auto &instr : fCode) {
+      switch (instr.fOp) {
+      case EOpCode::kConst: stack[++top] = instr.fValue; break;
+      case EOpCode::kVar: stack[++top] = x[instr.fIndex]; break;
+      case EOpCode::kPar: stack[++top] = p[instr.fIndex]; break;
+      case EOpCode::kNeg: stack[top] = -stack[top]; break;
+      case EOpCode::kNot: stack[top] = !stack[top]; break;
+      case EOpCode::kAdd: --top; stack[top] += stack[top + 1]; break;
+      case EOpCode::kSub: --top; stack[top] -= stack[top + 1]; break;
+      case EOpCode::kMul: --top; stack[top] *= stack[top + 1]; break;
+      case EOpCode::kDiv: --top; stack[top] /= stack[top + 1]; break;
+      case EOpCode::kLess: --top; stack[top] = stack[top] < stack[top + 1]; break;
+      case EOpCode::kLessEqual: --top; stack[top] = stack[top] <= stack[top + 1]; break;
+      case EOpCode::kGreater: --top; stack[top] = stack[top] > stack[top + 1]; break;
+      case EOpCode::kGreaterEqual: --top; stack[top] = stack[top] >= stack[top + 1]; break;
+      case EOpCode::kEqual: --top; stack[top] = stack[top] == stack[top + 1]; break;
+      case EOpCode::kNotEqual: --top; stack[top] = stack[top] != stack[top + 1]; break;
+      case EOpCode::kAnd: --top; stack[top] = stack[top] && stack[top + 1]; break;
+      case EOpCode::kOr: --top; stack[top] = stack[top] || stack[top + 1]; break;
+      case EOpCode::kCall:
+         top -= instr.fIndex - 1;
+         stack[top] = instr.fFunc(stack + top);
+         break;
+      }
+   }
+   return stack[0];
+}
@@ -0,0 +1,82 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Built-in evaluator of the TFormula expressions which do not need Cling, used internally by TFormula
+
+#ifndef ROOT_TFormulaEvaluator
+#define ROOT_TFormulaEvaluator
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ Evaluator of the expressions made only of numbers, variables `x[i]`, parameters `p[i]`, arithmetic, comparison and
+ logical operators and of a fixed set of mathematical functions (the ones the predefined functions of TFormula, like
+ `gaus`, `expo`, `landau`, `polN` or `chebN`, are made of).
+
+ The expression, as generated by TFormula for Cling, is compiled once into a sequence of instructions for a small
+ stack machine, evaluated without any call to the interpreter: the evaluation is thread safe and does not take the
+ interpreter lock. Compile() returns nullptr for any expression it does not understand, which is then left to Cling.
+*/
+class TFormulaEvaluator {
+public:
+   using Func_t = double (*)(const double *args);
+
+private:
+   enum class EOpCode : unsigned char {
+      kConst,
+      kVar,
+      kPar,
+      kNeg,
+      kNot,
+      kAdd,
+      kSub,
+      kMul,
+      kDiv,
+      kLess,
+      kLessEqual,
+      kGreater,
+      kGreaterEqual,
+      kEqual,
+      kNotEqual,
+      kAnd,
+      kOr,
+      kCall
+   };
+
+   struct RInstruction {
+      EOpCode fOp;
+      int fIndex = 0;       ///< Index of the variable or parameter, number of arguments of the function
+      double fValue = 0;    ///< Value of the constant
+      Func_t fFunc = nullptr;
+   };
+
+   std::vector<RInstruction> fCode; ///< Instructions, in the order of evaluation
+   int fStackSize = 0;              ///< Maximum depth of the stack during the evaluation
+
+   class RParser;
+
+public:
+   /// Maximum depth of the stack: deeper expressions are left to Cling
+   static constexpr int kMaxStackSize = 64;
+
+   /// Compile `expression`, which uses `ndim` variables and `npar` parameters, or return nullptr if it cannot be
+   /// evaluated without Cling
+   static std::unique_ptr<TFormulaEvaluator> Compile(const std::string &expression, int ndim, int npar);
+
+   double Eval(const double *x, const double *p) const;
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
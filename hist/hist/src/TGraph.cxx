@@ -1016,9 +1016,77 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Execute action corresponding to one event.
+/// Interpolate points in this graph at the n abscissas x, storing the results in y.
 ///
-///  This member function is called when a graph is clicked with the locator
+/// The results are the same as the ones of Eval() with the same spline and
+/// option for every point, but the evaluation is faster:
+///  - if spline is specified, or with option "S", the knot interval of a point
+///    is reused for the following points if possible, see TSpline3::EvalN().
+///    With option "S" the TSpline3 is created only once for all the points.
+///  - for a linear interpolation of a graph sorted in X (see Eval()), the
+///    interval between two points of the graph found for an abscissa is reused
+///    for the following ones if possible, instead of a binary search per abscissa.
+///
+/// In both cases, sorting the abscissas x, or evaluating them in a locally
+/// monotonic order, avoids most of the searches.
+
+void TGraph::EvalN(Int_t n, const Double_t *x, Double_t *y, TSpline *spline, Option_t *option) const
+{
+   if (spline) {
+      spline->EvalN(n, x, y);
+      return;
+   }
+
+   if (fNpoints > 1 && option && *option) {
+      TString opt = option;
+      opt.ToLower();
+      if (opt.Contains("s")) {
+         // points must be sorted before using a TSpline, see Eval()
+         std::vector<Double_t> xsort(fNpoints);
+         std::vector<Double_t> ysort(fNpoints);
+         std::vector<Int_t> indxsort(fNpoints);
+         TMath::Sort(fNpoints, fX, &indxsort[0], false);
+         for (Int_t i = 0; i < fNpoints; ++i) {
+            xsort[i] = fX[ indxsort[i] ];
+            ysort[i] = fY[ indxsort[i] ];
+         }
+         TSpline3 s("", &xsort[0], &ysort[0], fNpoints);
+         s.EvalN(n, x, y);
+         return;
+      }
+   }
+
+   if (fNpoints < 2 || !TestBit(TGraph::kIsSortedX)) {
+      for (Int_t i = 0; i < n; ++i)
+         y[i] = Eval(x[i], nullptr, option);
+      return;
+   }
+
+   // Only the abscissas strictly between two points of the graph use the cached interval, as the
+   // binary search of Eval() would give the same interval for them. The points of the graph
+   // themselves and the extrapolations go through Eval().
+   constexpr Int_t kMaxSteps = 4;
+   Int_t low = -1;
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t xi = x[i];
+      if (low >= 0 && fX[low] < xi) {
+         Int_t nsteps = 0;
+         while (low < fNpoints - 1 && !(xi < fX[low + 1]) && nsteps++ < kMaxSteps) {
+            if (xi == fX[low + 1])
+               break;
+            ++low;
+         }
+      }
+      if (low < 0 || low >= fNpoints - 1 || !(fX[low] < xi && xi < fX[low + 1])) {
+         y[i] = Eval(xi, nullptr, option);
+         low = TMath::BinarySearch(fNpoints, fX, xi);
+         continue;
+      }
+      const Int_t up = low + 1;
+      y[i] = fY[up] + (xi - fX[up]) * (fY[low] - fY[up]) / (fX[low] - fX[up]);
+   }
+}
+
 ///
 ///  If Left button clicked on one of the line end points, this point
 ///     follows the cursor until button is released.
@@ -1126,6 +1194,9 @@ TObject *TGraph::FindObject(const TObject *obj) const
 /// "G"  | Uses the gradient implemented in `TF1::GradientPar` for the minimization. This allows to use Automatic Differentiation when it is supported by the provided TF1 function.
 /// "EX0" | When fitting a TGraphErrors or TGraphAsymErrors do not consider errors in the X coordinates
 /// "ROB" | In case of linear fitting, compute the LTS regression coefficients (robust (resistant) regression), using the default fraction of good points "ROB=0.x" - compute the LTS regression coefficients, using 0.x as a fraction of good points
+/// "SERIAL" | Runs in serial mode. By default if ROOT is built with MT support and MT is enabled, the fit is performed in multi-thread
+/// "MULTITHREAD" | Forces usage of multi-thread execution whenever possible
+/// "VEC" | Evaluates the formula of the function on several points at once (SIMD) during the fit, also its gradient with option "G". Requires ROOT built with VecCore.
 ///
 ///
 /// This function is used for fitting also the derived TGraph classes such as TGraphErrors or TGraphAsymmErrors.
@@ -26,10 +26,12 @@
 #include "strtok.h"
 #include "snprintf.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cassert>
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 #include "HFitInterface.h"
 #include "Fit/DataRange.h"
@@ -1095,22 +1097,29 @@ TH2D *TGraph2D::GetHistogram(Option_t *option)
    Double_t dx = (hxmax - hxmin) / fNpx;
    Double_t dy = (hymax - hymin) / fNpy;
 
-   Double_t x, y, z;
-
-   for (Int_t ix = 1; ix <= fNpx; ix++) {
-      x  = hxmin + (ix - 0.5) * dx;
-      for (Int_t iy = 1; iy <= fNpy; iy++) {
-         y  = hymin + (iy - 0.5) * dy;
-         // do interpolation
-         if (oldInterp)
-            z  = ((TGraphDelaunay*)fDelaunay)->ComputeZ(x, y);
-         else
-            z  = ((TGraphDelaunay2D*)fDelaunay)->ComputeZ(x, y);
-
-         fHistogram->Fill(x, y, z);
+   // bin centres, interpolated all at once (in parallel if the implicit multithreading is enabled)
+   const Int_t ncentres = fNpx * fNpy;
+   std::vector<Double_t> xc(ncentres), yc(ncentres), zc(ncentres);
+   for (Int_t ix = 1, i = 0; ix <= fNpx; ix++) {
+      const Double_t x = hxmin + (ix - 0.5) * dx;
+      for (Int_t iy = 1; iy <= fNpy; iy++, i++) {
+         xc[i] = x;
+         yc[i] = hymin + (iy - 0.5) * dy;
       }
    }
 
+   if (oldInterp) {
+      for (Int_t i = 0; i < ncentres; i++)
+         zc[i] = ((TGraphDelaunay*)fDelaunay)->ComputeZ(xc[i], yc[i]);
+   } else {
+      auto policy = ROOT::IsImplicitMTEnabled() ? ROOT::EExecutionPolicy::kMultiThread
+                                                : ROOT::EExecutionPolicy::kSequential;
+      ((TGraphDelaunay2D*)fDelaunay)->ComputeZ(ncentres, xc.data(), yc.data(), zc.data(), policy);
+   }
+
+   for (Int_t i = 0; i < ncentres; i++)
+      fHistogram->Fill(xc[i], yc[i], zc[i]);
+
 
    if (fMinimum != -1111) fHistogram->SetMinimum(fMinimum);
    if (fMaximum != -1111) fHistogram->SetMaximum(fMaximum);
@@ -1236,6 +1245,36 @@ Double_t TGraph2D::Interpolate(Double_t x, Double_t y)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Finds the z values at the `n` positions (x[i],y[i]) thanks to the Delaunay
+/// interpolation and stores them in z[i].
+///
+/// The triangles are found only once. With the default interpolator (TGraphDelaunay2D)
+/// the points are interpolated in parallel when the implicit multithreading is enabled
+/// (see ROOT::EnableImplicitMT).
+
+void TGraph2D::Interpolate(Int_t n, const Double_t *x, const Double_t *y, Double_t *z)
+{
+   if (n <= 0) return;
+
+   // the first point finds (or creates) the interpolator
+   z[0] = Interpolate(x[0], y[0]);
+   if (!fDelaunay) {
+      std::fill(z + 1, z + n, z[0]);
+      return;
+   }
+
+   if (fDelaunay->IsA() == TGraphDelaunay2D::Class()) {
+      auto policy = ROOT::IsImplicitMTEnabled() ? ROOT::EExecutionPolicy::kMultiThread
+                                                : ROOT::EExecutionPolicy::kSequential;
+      ((TGraphDelaunay2D*)fDelaunay)->ComputeZ(n - 1, x + 1, y + 1, z + 1, policy);
+   } else {
+      for (Int_t i = 1; i < n; i++)
+         z[i] = ((TGraphDelaunay*)fDelaunay)->ComputeZ(x[i], y[i]);
+   }
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Paints this 2D graph with its current attributes
 
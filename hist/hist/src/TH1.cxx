@@ -17,6 +17,7 @@
 #include <sstream>
 #include <cmath>
 #include <iostream>
+#include <algorithm>
 
 #include "TROOT.h"
 #include "TBuffer.h"
@@ -52,6 +53,8 @@
 #include "Math/QuantFuncMathCore.h"
 
 #include "TH1Merger.h"
+#include "TCdfGuideTable.h"
+#include "THistPrefixSums.h"
 
 /** \addtogroup Histograms
 @{
@@ -599,6 +602,7 @@ TH1::TH1(): TNamed(), TAttLine(), TAttFill(), TAttMarker()
    fFunctions     = new TList;
    fNcells        = 0;
    fIntegral      = nullptr;
+   fPrefixSums    = nullptr;
    fPainter       = nullptr;
    fEntries       = 0;
    fNormFactor    = 0;
@@ -628,6 +632,8 @@ TH1::~TH1()
    }
    delete[] fIntegral;
    fIntegral = nullptr;
+   delete fPrefixSums;
+   fPrefixSums = nullptr;
    delete[] fBuffer;
    fBuffer = nullptr;
    if (fFunctions) {
@@ -754,6 +760,7 @@ void TH1::Build()
    fDirectory     = nullptr;
    fPainter       = nullptr;
    fIntegral      = nullptr;
+   fPrefixSums    = nullptr;
    fEntries       = 0;
    fNormFactor    = 0;
    fTsumw         = fTsumw2=fTsumwx=fTsumwx2=0;
@@ -1252,6 +1259,19 @@ void TH1::AddBinContent(Int_t, Double_t)
    AbstractMethod("AddBinContent");
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment the contents of the `n` bins `bins[i]` by the weights `w[i]`.
+///
+/// Used by the FillN methods once the bins of a chunk of entries have been
+/// found; the histograms of the basic types override it with a plain loop on
+/// their array.
+
+void TH1::AddBinContents(Int_t n, const Int_t *bins, const Double_t *w)
+{
+   for (Int_t i = 0; i < n; ++i)
+      AddBinContent(bins[i], w[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Sets the flag controlling the automatic add of histograms in memory
 ///
@@ -3476,23 +3496,65 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
    fEntries += ntimes;
    Double_t ww = 1;
    Int_t nbins   = fXaxis.GetNbins();
-   ntimes *= stride;
-   for (i=0;i<ntimes;i+=stride) {
-      bin =fXaxis.FindBin(x[i]);
-      if (bin <0) continue;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin, ww);
-      if (bin == 0 || bin > nbins) {
-         if (!GetStatOverflowsBehaviour()) continue;
+
+   if (fXaxis.CanExtend() && !fXaxis.IsAlphanumeric()) {
+      // the axis may be extended while filling: find the bins one by one
+      ntimes *= stride;
+      for (i=0;i<ntimes;i+=stride) {
+         bin =fXaxis.FindBin(x[i]);
+         if (bin <0) continue;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin, ww);
+         if (bin == 0 || bin > nbins) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         Double_t z= ww;
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
+      }
+      return;
+   }
+
+   // the entries are processed by chunks: the bins of a whole chunk are found at once, then the
+   // chunk is added to the contents, the sums of squares of weights and the statistics
+   constexpr Int_t kChunk = 256;
+   Int_t bins[kChunk];
+   Double_t weights[kChunk];
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+   for (Int_t first = 0; first < ntimes; first += kChunk) {
+      const Int_t n = std::min(kChunk, ntimes - first);
+      const Long64_t offset = (Long64_t)first * stride;
+      fXaxis.FindFixBins(n, x + offset, bins, stride);
+      Bool_t unitWeights = kTRUE;
+      for (i = 0; i < n; ++i) {
+         weights[i] = w ? w[offset + (Long64_t)i * stride] : 1.;
+         unitWeights &= (weights[i] == 1.);
+      }
+      if (!fSumw2.fN && !unitWeights && !TestBit(TH1::kIsNotW)) Sumw2();
+      if (fSumw2.fN) {
+         for (i = 0; i < n; ++i)
+            fSumw2.fArray[bins[i]] += weights[i] * weights[i];
+      }
+      AddBinContents(n, bins, weights);
+      for (i = 0; i < n; ++i) {
+         if (!statOverflows && (bins[i] == 0 || bins[i] > nbins)) continue;
+         const Double_t z = weights[i];
+         const Double_t xx = x[offset + (Long64_t)i * stride];
+         tsumw   += z;
+         tsumw2  += z*z;
+         tsumwx  += z*xx;
+         tsumwx2 += z*xx*xx;
       }
-      Double_t z= ww;
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
    }
+   fTsumw = tsumw;
+   fTsumw2 = tsumw2;
+   fTsumwx = tsumwx;
+   fTsumwx2 = tsumwx2;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3517,8 +3579,7 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
 
 void TH1::FillRandom(const char *fname, Int_t ntimes, TRandom * rng)
 {
-   Int_t bin, binx, ibin, loop;
-   Double_t r1, x;
+   Int_t bin, binx, loop;
    //   - Search for fname in the list of ROOT defined functions
    TF1 *f1 = (TF1*)gROOT->GetFunction(fname);
    if (!f1) { Error("FillRandom", "Unknown function: %s",fname); return; }
@@ -3554,14 +3615,26 @@ void TH1::FillRandom(const char *fname, Int_t ntimes, TRandom * rng)
    for (bin=1;bin<=nbinsx;bin++)  integral[bin] /= integral[nbinsx];
 
    //   --------------Start main loop ntimes
-   for (loop=0;loop<ntimes;loop++) {
-      r1 = (rng) ? rng->Rndm() : gRandom->Rndm();
-      ibin = TMath::BinarySearch(nbinsx,&integral[0],r1);
-      //binx = 1 + ibin;
-      //x    = xAxis->GetBinCenter(binx); //this is not OK when SetBuffer is used
-      x    = xAxis->GetBinLowEdge(ibin+first)
-             +xAxis->GetBinWidth(ibin+first)*(r1-integral[ibin])/(integral[ibin+1] - integral[ibin]);
-      Fill(x);
+   // the random numbers are generated, transformed and filled by chunks
+   const ROOT::Internal::TCdfGuideTable guide(nbinsx, integral);
+   constexpr Int_t kChunk = 65536;
+   std::vector<Double_t> values(std::max(0, std::min(ntimes, kChunk)));
+   for (loop = 0; loop < ntimes; loop += kChunk) {
+      const Int_t n = std::min(kChunk, ntimes - loop);
+      if (rng)
+         rng->RndmArray(n, values.data());
+      else
+         gRandom->RndmArray(n, values.data());
+      ROOT::Internal::ForEachSampleRange(n, [&](Long64_t firstValue, Long64_t lastValue) {
+         for (Long64_t i = firstValue; i < lastValue; ++i) {
+            const Double_t r1 = values[i];
+            const Int_t ibin = guide.Find(r1);
+            //x    = xAxis->GetBinCenter(1 + ibin); //this is not OK when SetBuffer is used
+            values[i] = xAxis->GetBinLowEdge(ibin+first)
+                        +xAxis->GetBinWidth(ibin+first)*(r1-integral[ibin])/(integral[ibin+1] - integral[ibin]);
+         }
+      });
+      FillN(n, values.data(), nullptr);
    }
    delete [] integral;
 }
@@ -3651,11 +3724,13 @@ void TH1::FillRandom(TH1 *h, Int_t ntimes, TRandom * rng)
    // case of different axis and not too large ntimes
 
    if (h->ComputeIntegral() ==0) return;
-   Int_t loop;
-   Double_t x;
-   for (loop=0;loop<ntimes;loop++) {
-      x = h->GetRandom();
-      Fill(x);
+   // the random numbers are generated and filled by chunks
+   constexpr Int_t kChunk = 65536;
+   std::vector<Double_t> values(std::max(0, std::min(ntimes, kChunk)));
+   for (Int_t loop = 0; loop < ntimes; loop += kChunk) {
+      const Int_t n = std::min(kChunk, ntimes - loop);
+      h->GetRandomArray(n, values.data(), rng);
+      FillN(n, values.data(), nullptr);
    }
 }
 
@@ -3964,6 +4039,7 @@ TFitResultPtr TH1::Fit(const char *fname ,Option_t *option ,Option_t *goption, D
 ///   "WIDTH" | Scales the histogran bin content by the bin width (useful for variable bins histograms)
 ///   "SERIAL" | Runs in serial mode. By defult if ROOT is built with MT support and MT is enables, the fit is perfomed in multi-thread     - "E"  Perform better Errors estimation using Minos technique
 ///   "MULTITHREAD" | Forces usage of multi-thread execution whenever possible
+///   "VEC" | Evaluates the formula of the function on several bins at once (SIMD) during the fit, also its gradient with option "G". Requires ROOT built with VecCore.
 ///
 /// The default fitting of an histogram (when no option is given) is perfomed as following:
 ///   - a chi-square fit (see below Chi-square Fits) computed using the bin histogram errors and excluding bins with zero errors (empty bins);
@@ -4418,6 +4494,16 @@ Bool_t TH1::GetDefaultSumw2()
    return fgDefaultSumw2;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the underflows and overflows are used in the computation of
+/// the statistics by the histograms with the TH1::kNeutral behaviour.
+/// see TH1::StatOverflows.
+
+Bool_t TH1::GetDefaultStatOverflows()
+{
+   return fgStatOverflows;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the current number of entries.
 
@@ -5003,6 +5089,62 @@ Double_t TH1::GetRandom(TRandom * rng) const
    return x;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill `x` with `n` random numbers distributed according the histogram bin contents.
+///
+/// The numbers are the same as the ones of `n` successive calls to GetRandom(rng), but
+/// the uniform numbers are generated at once with TRandom::RndmArray and the bin of the
+/// integral is found with a guide table instead of a binary search. If implicit
+/// multi-threading is enabled, the uniform numbers are transformed in parallel; the
+/// result does not depend on it.
+///
+/// @param n   Number of random numbers
+/// @param x   Array of at least `n` values, filled with the random numbers
+/// @param rng (optional) Random number generator pointer used (default is gRandom)
+///
+/// NB Only valid for 1-d histograms.
+/// If the histogram has a bin with negative content, `x` is filled with NaN
+
+void TH1::GetRandomArray(Int_t n, Double_t *x, TRandom * rng) const
+{
+   if (n <= 0)
+      return;
+   if (fDimension > 1) {
+      Error("GetRandomArray","Function only valid for 1-d histograms");
+      std::fill(x, x + n, 0.);
+      return;
+   }
+   Int_t nbinsx = GetNbinsX();
+   Double_t integral = 0;
+   // compute integral checking that all bins have positive content (see ROOT-5894)
+   if (fIntegral) {
+      if (fIntegral[nbinsx+1] != fEntries) integral = ((TH1*)this)->ComputeIntegral(true);
+      else  integral = fIntegral[nbinsx];
+   } else {
+      integral = ((TH1*)this)->ComputeIntegral(true);
+   }
+   if (integral == 0 || std::isnan(integral)) {
+      std::fill(x, x + n, integral);
+      return;
+   }
+
+   if (rng)
+      rng->RndmArray(n, x);
+   else
+      gRandom->RndmArray(n, x);
+
+   const ROOT::Internal::TCdfGuideTable guide(nbinsx, fIntegral);
+   ROOT::Internal::ForEachSampleRange(n, [&](Long64_t first, Long64_t last) {
+      for (Long64_t i = first; i < last; ++i) {
+         const Double_t r1 = x[i];
+         const Int_t ibin = guide.Find(r1);
+         x[i] = GetBinLowEdge(ibin+1);
+         if (r1 > fIntegral[ibin]) x[i] +=
+            GetBinWidth(ibin+1)*(r1-fIntegral[ibin])/(fIntegral[ibin+1] - fIntegral[ibin]);
+      }
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return content of bin number bin.
 ///
@@ -6001,6 +6143,35 @@ Long64_t TH1::Merge(TCollection *li,Option_t * opt)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Add the n histograms of the array hists to this histogram.
+///
+/// This is equivalent to Merge(TCollection*, Option_t*) with a list of the histograms, without building
+/// the list. When all the histograms are of the same class as this one, with contents stored as double or
+/// float (e.g. TH1D, TH2F, TH3D, but not profiles), with identical axes without labels, the bin arrays are added
+/// directly, in parallel over the bins if implicit multi-threading is enabled and the histograms are large (see
+/// ROOT::EnableImplicitMT): this is the fast path for the merging of many partial histograms of the same quantity,
+/// as in online monitoring. Otherwise the histograms are merged as by Merge(TCollection*, Option_t*).
+///
+/// Returns the number of entries of the merged histogram, or -1 in case of failure.
+
+Long64_t TH1::Merge(Int_t n, TH1 *const *hists, Option_t *option)
+{
+   if (n <= 0 || !hists) return (Long64_t) GetEntries();
+
+   Bool_t sameBinning = kTRUE;
+   for (Int_t i = 0; i < n && sameBinning; ++i)
+      sameBinning = hists[i] && TH1Merger::CanAddBinArrays(this, hists[i]);
+   if (sameBinning)
+      return TH1Merger::BinArraysMerge(*this, n, hists) ? GetEntries() : -1;
+
+   TList list;
+   for (Int_t i = 0; i < n; ++i)
+      if (hists[i]) list.Add(hists[i]);
+   // the merge of the derived classes may be overridden in the version without option
+   return (option && option[0]) ? Merge(&list, option) : Merge(&list);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Performs the operation:
 ///
@@ -7920,6 +8091,12 @@ Double_t TH1::DoIntegral(Int_t binx1, Int_t binx2, Int_t biny1, Int_t biny2, Int
    Bool_t width   = kFALSE;
    if (opt.Contains("width")) width = kTRUE;
 
+   if (!width) {
+      if (auto sums = GetPrefixSums(doError)) {
+         if (doError) error = TMath::Sqrt(sums->GetSumError2(binx1, binx2, biny1, biny2, binz1, binz2));
+         return sums->GetSum(binx1, binx2, biny1, biny2, binz1, binz2);
+      }
+   }
 
    Double_t dx = 1., dy = .1, dz =.1;
    Double_t integral = 0;
@@ -7950,6 +8127,57 @@ Double_t TH1::DoIntegral(Int_t binx1, Int_t binx2, Int_t biny1, Int_t biny2, Int
    return integral;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Turn on or off the cache of the integrals of the bin contents.
+///
+/// When the cache is on, the cumulative sums of the bin contents and of the squares of the bin errors
+/// (summed-area tables, including the underflow and overflow bins) are computed the first time they are needed.
+/// Integral() and IntegralAndError() without the option "width", as well as the projections of TH2 and TH3
+/// without cuts, then sum any rectangular range of bins at a constant cost, instead of a cost proportional to the
+/// number of bins in the range: this pays off when many integrals or projections are computed from the same
+/// histogram.
+///
+/// The cache is rebuilt when the number of entries or the sums of weights of the histogram changed, i.e. after a
+/// Fill, SetBinContent, Add, Scale or Reset. When the bin contents are modified without changing these statistics,
+/// for instance with AddBinContent or through GetArray, call SetIntegralCache() again to discard the cache.
+///
+/// The sums are computed in double precision by differences of cumulative sums: they are exact for integer bin
+/// contents, otherwise they can differ from the bin by bin sums by rounding errors relative to the total sum.
+/// The cache is not copied nor streamed.
+
+void TH1::SetIntegralCache(Bool_t on)
+{
+   delete fPrefixSums;
+   fPrefixSums = on ? new ROOT::Internal::THistPrefixSums() : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the cumulative sums of the bin contents, and of the squares of the bin errors if `errors`, rebuilding
+/// them if the histogram changed. Return nullptr if the integral cache is off (see SetIntegralCache).
+
+const ROOT::Internal::THistPrefixSums *TH1::GetPrefixSums(Bool_t errors) const
+{
+   if (!fPrefixSums) return nullptr;
+   if (fBuffer) ((TH1*)this)->BufferEmpty();
+
+   ROOT::Internal::THistPrefixSums::RKey key;
+   key.fEntries = fEntries;
+   key.fTsumw = fTsumw;
+   key.fTsumw2 = fTsumw2;
+   key.fNcells = fNcells;
+   key.fNsumw2 = fSumw2.fN;
+   if (fPrefixSums->IsValid(key, errors)) return fPrefixSums;
+
+   const Int_t nx = fXaxis.GetNbins() + 2;
+   const Int_t ny = GetDimension() > 1 ? fYaxis.GetNbins() + 2 : 1;
+   const Int_t nz = GetDimension() > 2 ? fZaxis.GetNbins() + 2 : 1;
+   fPrefixSums->Build(key, nx, ny, nz,
+                      [this](Int_t ix, Int_t iy, Int_t iz) { return RetrieveBinContent(GetBin(ix, iy, iz)); },
+                      errors,
+                      [this](Int_t ix, Int_t iy, Int_t iz) { return GetBinErrorSqUnchecked(GetBin(ix, iy, iz)); });
+   return fPrefixSums;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Statistical test of compatibility in shape between
 /// this histogram and h2, using the Anderson-Darling 2 sample test.
@@ -109,6 +109,20 @@ Int_t TH1K::Fill(Double_t x)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram with the `ntimes` values of `x` (and weights `w`, if not null)
+/// taken every `stride` elements, entry by entry with Fill().
+
+void TH1K::FillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride)
+{
+   for (Int_t i = 0; i < ntimes; ++i) {
+      if (w)
+         Fill(x[i * stride], w[i * stride]);
+      else
+         Fill(x[i * stride]);
+   }
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Return content of global bin number bin.
@@ -8,6 +8,13 @@
 #include "TError.h"
 #include "THashList.h"
 #include "TClass.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
 #include <iostream>
 #include <limits>
 #include <utility>
@@ -23,9 +30,39 @@ Bool_t TH1Merger::AxesHaveLimits(const TH1 * h) {
    return hasLimits;
 }
 
+namespace {
+
+// axes with exactly the same bins, with limits and without labels
+Bool_t IdenticalAxes(const TAxis &a1, const TAxis &a2)
+{
+   if (a1.GetNbins() != a2.GetNbins() || a1.GetXmin() != a2.GetXmin() || a1.GetXmax() != a2.GetXmax())
+      return kFALSE;
+   if (!(a1.GetXmin() < a1.GetXmax()) || a1.GetLabels() || a2.GetLabels())
+      return kFALSE;
+   const TArrayD &bins1 = *a1.GetXbins();
+   const TArrayD &bins2 = *a2.GetXbins();
+   return bins1.fN == bins2.fN && std::equal(bins1.fArray, bins1.fArray + bins1.fN, bins2.fArray);
+}
+
+} // namespace
+
 /// Function performing the actual merge
 Bool_t TH1Merger::operator() () {
 
+   // fast path: histograms with the same class and binning are merged adding directly their bin arrays
+   if (!fIsProfileMerge) {
+      std::vector<TH1 *> hists;
+      hists.reserve(fInputList.GetSize());
+      TIter next(&fInputList);
+      while (TObject *obj = next()) {
+         TH1 *h = dynamic_cast<TH1 *>(obj);
+         if (!h || !CanAddBinArrays(fH0, h))
+            break;
+         hists.push_back(h);
+      }
+      if (hists.size() == (size_t)fInputList.GetSize())
+         return BinArraysMerge(*fH0, hists.size(), hists.data());
+   }
 
    EMergerType type = ExamineHistograms();
 
@@ -793,6 +830,118 @@ Bool_t TH1Merger::SameAxesMerge() {
 }
 
 
+/// Check if the histogram hist can be merged into h0 by adding their bin arrays element by element: both are
+/// histograms (not profiles) of the same class, storing their contents in an array of double or float, with
+/// identical axes without labels, and do not have any entry left in their buffer.
+
+Bool_t TH1Merger::CanAddBinArrays(const TH1 *h0, const TH1 *hist)
+{
+   if (hist->IsA() != h0->IsA())
+      return kFALSE;
+   if (!dynamic_cast<const TArrayD *>(h0) && !dynamic_cast<const TArrayF *>(h0))
+      return kFALSE;
+   if (h0->InheritsFrom(TProfile::Class()) || h0->InheritsFrom(TProfile2D::Class()) ||
+       h0->InheritsFrom(TProfile3D::Class()) || h0->InheritsFrom("TH1K"))
+      return kFALSE;
+   for (const TH1 *h : {h0, hist}) {
+      if (h->TestBit(TH1::kAutoBinPTwo) || (h->fBuffer && h->fBuffer[0] != 0))
+         return kFALSE;
+   }
+   if (!IdenticalAxes(h0->fXaxis, hist->fXaxis))
+      return kFALSE;
+   if (h0->fDimension > 1 && !IdenticalAxes(h0->fYaxis, hist->fYaxis))
+      return kFALSE;
+   if (h0->fDimension > 2 && !IdenticalAxes(h0->fZaxis, hist->fZaxis))
+      return kFALSE;
+   return kTRUE;
+}
+
+/// Add the bins [first, last) of the contents and of the sums of the squares of the weights of the histograms
+/// hists to the ones of h.
+
+template <class TArrayType>
+void TH1Merger::AddBinArrays(TH1 &h, const std::vector<const TH1 *> &hists, Int_t first, Int_t last)
+{
+   auto out = dynamic_cast<TArrayType &>(h).fArray;
+   Double_t *outSumw2 = h.fSumw2.fN ? h.fSumw2.fArray : nullptr;
+   for (const TH1 *hist : hists) {
+      const auto in = dynamic_cast<const TArrayType &>(*hist).fArray;
+      for (Int_t bin = first; bin < last; ++bin)
+         out[bin] += in[bin];
+      if (!outSumw2)
+         continue;
+      if (hist->fSumw2.fN) {
+         const Double_t *inSumw2 = hist->fSumw2.fArray;
+         for (Int_t bin = first; bin < last; ++bin)
+            outSumw2[bin] += inSumw2[bin];
+      } else {
+         for (Int_t bin = first; bin < last; ++bin)
+            outSumw2[bin] += in[bin];
+      }
+   }
+}
+
+/// Merge the n histograms hists into h when they all have the same class and binning as h (see
+/// CanAddBinArrays): the bin arrays are added element by element, without any lookup of the bins.
+///
+/// With implicit multi-threading enabled, the bins of large histograms are split in chunks added in parallel; each
+/// bin still sums the histograms in the order they are given, so the result does not depend on the number of threads.
+
+Bool_t TH1Merger::BinArraysMerge(TH1 &h, Int_t n, TH1 *const *hists)
+{
+   Double_t stats[TH1::kNstat], totstats[TH1::kNstat];
+   for (Int_t i = 0; i < TH1::kNstat; i++) {
+      totstats[i] = stats[i] = 0;
+   }
+   h.GetStats(totstats);
+   Double_t nentries = h.GetEntries();
+
+   Bool_t haveWeights = h.GetSumw2N() != 0;
+   std::vector<const TH1 *> inputs;
+   inputs.reserve(n);
+   for (Int_t i = 0; i < n; ++i) {
+      const TH1 *hist = hists[i];
+      haveWeights |= hist->GetSumw2N() != 0;
+      // skip empty histograms
+      if (hist->IsEmpty())
+         continue;
+      hist->GetStats(stats);
+      for (Int_t j = 0; j < TH1::kNstat; j++)
+         totstats[j] += stats[j];
+      nentries += hist->GetEntries();
+      inputs.push_back(hist);
+   }
+   // in case of weighted histogram set Sumw2() on h if it is not weighted
+   if (haveWeights && h.GetSumw2N() == 0)
+      h.Sumw2();
+
+   const bool isDouble = dynamic_cast<TArrayD *>(&h) != nullptr;
+   auto addBins = [&](Int_t first, Int_t last) {
+      if (isDouble)
+         AddBinArrays<TArrayD>(h, inputs, first, last);
+      else
+         AddBinArrays<TArrayF>(h, inputs, first, last);
+   };
+
+   const Int_t ncells = h.fNcells;
+#ifdef R__USE_IMT
+   // bins added by each task, and minimum number of bins times histograms to add to go parallel
+   constexpr Int_t kChunkSize = 8192;
+   constexpr Long64_t kMinParallelWork = 1 << 22;
+   if (ROOT::IsImplicitMTEnabled() && ncells >= 2 * kChunkSize && (Long64_t)ncells * (Long64_t)inputs.size() >= kMinParallelWork) {
+      const UInt_t nchunks = (ncells + kChunkSize - 1) / kChunkSize;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](UInt_t chunk) { addBins(chunk * kChunkSize, std::min<Int_t>(ncells, (chunk + 1) * kChunkSize)); },
+                   ROOT::TSeqU(nchunks));
+   } else
+#endif
+      addBins(0, ncells);
+
+   h.PutStats(totstats);
+   h.SetEntries(nentries);
+   return kTRUE;
+}
+
 /**
    Merged histogram when axis can be different.
    Histograms are merged looking at bin center positions
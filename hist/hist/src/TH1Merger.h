@@ -17,6 +17,8 @@
 #include "TProfile3D.h"
 #include "TList.h"
 
+#include <vector>
+
 class TH1Merger {
 
 public:
@@ -59,6 +61,12 @@ public:
     // function to check if histogram bin is empty
    static Bool_t IsBinEmpty(const TH1 *hist, Int_t bin);
 
+   // check if hist can be merged into h0 adding their bin arrays: same class and identical binning, no labels
+   static Bool_t CanAddBinArrays(const TH1 *h0, const TH1 *hist);
+
+   // merge the n histograms into h, adding their bin arrays (see CanAddBinArrays)
+   static Bool_t BinArraysMerge(TH1 &h, Int_t n, TH1 *const *hists);
+
 
 
    TH1Merger(TH1 & h, TCollection & l, Option_t * opt = "") :
@@ -116,6 +124,9 @@ private:
 
    Bool_t SameAxesMerge();
 
+   template <class TArrayType>
+   static void AddBinArrays(TH1 &h, const std::vector<const TH1 *> &hists, Int_t first, Int_t last);
+
    Bool_t DifferentAxesMerge();
 
    Bool_t LabelMerge(bool newLimits = false);
@@ -27,6 +27,9 @@
 #include "TObjArray.h"
 #include "TVirtualHistPainter.h"
 #include "snprintf.h"
+#include "THistPrefixSums.h"
+
+#include <algorithm>
 
 ClassImp(TH2);
 
@@ -618,35 +621,94 @@ void TH2::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double
          return;
    }
 
-   Double_t ww = 1;
-   for (i=ifirst;i<ntimes;i+=stride) {
-      fEntries++;
-      binx = fXaxis.FindBin(x[i]);
-      biny = fYaxis.FindBin(y[i]);
-      if (binx <0 || biny <0) continue;
-      bin  = biny*(fXaxis.GetNbins()+2) + binx;
-      if (w) ww = w[i];
-      if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
-      if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
-      AddBinContent(bin,ww);
-      if (binx == 0 || binx > fXaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+   if ((fXaxis.CanExtend() && !fXaxis.IsAlphanumeric()) || (fYaxis.CanExtend() && !fYaxis.IsAlphanumeric())) {
+      // an axis may be extended while filling: find the bins one by one
+      Double_t ww = 1;
+      for (i=ifirst;i<ntimes;i+=stride) {
+         fEntries++;
+         binx = fXaxis.FindBin(x[i]);
+         biny = fYaxis.FindBin(y[i]);
+         if (binx <0 || biny <0) continue;
+         bin  = biny*(fXaxis.GetNbins()+2) + binx;
+         if (w) ww = w[i];
+         if (!fSumw2.fN && ww != 1.0 && !TestBit(TH1::kIsNotW))  Sumw2();
+         if (fSumw2.fN) fSumw2.fArray[bin] += ww*ww;
+         AddBinContent(bin,ww);
+         if (binx == 0 || binx > fXaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         if (biny == 0 || biny > fYaxis.GetNbins()) {
+            if (!GetStatOverflowsBehaviour()) continue;
+         }
+         Double_t z= ww; //(ww > 0 ? ww : -ww);
+         fTsumw   += z;
+         fTsumw2  += z*z;
+         fTsumwx  += z*x[i];
+         fTsumwx2 += z*x[i]*x[i];
+         fTsumwy  += z*y[i];
+         fTsumwy2 += z*y[i]*y[i];
+         fTsumwxy += z*x[i]*y[i];
+      }
+      return;
+   }
+
+   // the entries are processed by chunks, see TH1::DoFillN
+   constexpr Int_t kChunk = 256;
+   Int_t bins[kChunk], binsy[kChunk];
+   Double_t weights[kChunk];
+   Bool_t inRange[kChunk];
+   const Int_t nx = fXaxis.GetNbins();
+   const Int_t ny = fYaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+   Double_t tsumwy = fTsumwy, tsumwy2 = fTsumwy2, tsumwxy = fTsumwxy;
+   const Int_t nentries = (ntimes - ifirst + stride - 1) / stride;
+   fEntries += nentries;
+   for (Int_t first = 0; first < nentries; first += kChunk) {
+      const Int_t n = std::min(kChunk, nentries - first);
+      const Long64_t offset = ifirst + (Long64_t)first * stride;
+      fXaxis.FindFixBins(n, x + offset, bins, stride);
+      fYaxis.FindFixBins(n, y + offset, binsy, stride);
+      Bool_t unitWeights = kTRUE;
+      for (i = 0; i < n; ++i) {
+         weights[i] = w ? w[offset + (Long64_t)i * stride] : 1.;
+         unitWeights &= (weights[i] == 1.);
       }
-      if (biny == 0 || biny > fYaxis.GetNbins()) {
-         if (!GetStatOverflowsBehaviour()) continue;
+      if (!fSumw2.fN && !unitWeights && !TestBit(TH1::kIsNotW)) Sumw2();
+      for (i = 0; i < n; ++i) {
+         binx = bins[i];
+         biny = binsy[i];
+         bins[i] = biny * (nx + 2) + binx;
+         inRange[i] = statOverflows || (binx > 0 && binx <= nx && biny > 0 && biny <= ny);
+      }
+      if (fSumw2.fN) {
+         for (i = 0; i < n; ++i)
+            fSumw2.fArray[bins[i]] += weights[i] * weights[i];
+      }
+      AddBinContents(n, bins, weights);
+      for (i = 0; i < n; ++i) {
+         if (!inRange[i]) continue;
+         const Double_t z = weights[i];
+         const Double_t xx = x[offset + (Long64_t)i * stride];
+         const Double_t yy = y[offset + (Long64_t)i * stride];
+         tsumw   += z;
+         tsumw2  += z*z;
+         tsumwx  += z*xx;
+         tsumwx2 += z*xx*xx;
+         tsumwy  += z*yy;
+         tsumwy2 += z*yy*yy;
+         tsumwxy += z*xx*yy;
       }
-      Double_t z= ww; //(ww > 0 ? ww : -ww);
-      fTsumw   += z;
-      fTsumw2  += z*z;
-      fTsumwx  += z*x[i];
-      fTsumwx2 += z*x[i]*x[i];
-      fTsumwy  += z*y[i];
-      fTsumwy2 += z*y[i]*y[i];
-      fTsumwxy += z*x[i]*y[i];
    }
+   fTsumw = tsumw;
+   fTsumw2 = tsumw2;
+   fTsumwx = tsumwx;
+   fTsumwx2 = tsumwx2;
+   fTsumwy = tsumwy;
+   fTsumwy2 = tsumwy2;
+   fTsumwxy = tsumwxy;
 }
 
-
 ////////////////////////////////////////////////////////////////////////////////
 /// Fill histogram following distribution in function fname.
 ///
@@ -2246,6 +2308,11 @@ TH1D *TH2::DoProjection(bool onX, const char *name, Int_t firstbin, Int_t lastbi
    Double_t totcont = 0;
    Bool_t  computeErrors = h1->GetSumw2N();
 
+   // with the integral cache the sums along the integrated axis are read from the cumulative sums; without Sumw2 the
+   // errors of the bins are the square roots of the absolute values of the contents and cannot be summed this way
+   const ROOT::Internal::THistPrefixSums *sums = nullptr;
+   if (!ncuts && (!computeErrors || GetSumw2N())) sums = GetPrefixSums(computeErrors);
+
    // implement filling of projected histogram
    // outbin is bin number of outAxis (the projected axis). Loop is done on all bin of TH2 histograms
    // inbin is the axis being integrated. Loop is done only on the selected bins
@@ -2254,19 +2321,30 @@ TH1D *TH2::DoProjection(bool onX, const char *name, Int_t firstbin, Int_t lastbi
       cont = 0;
       if (outAxis->TestBit(TAxis::kAxisRange) && ( outbin < firstOutBin || outbin > lastOutBin )) continue;
 
-      for (Int_t inbin = firstbin ; inbin <= lastbin ; ++inbin) {
-         Int_t binx, biny;
-         if (onX) { binx = outbin; biny=inbin; }
-         else     { binx = inbin;  biny=outbin; }
-
-         if (ncuts) {
-            if (!fPainter->IsInside(binx,biny)) continue;
+      if (sums) {
+         if (onX) {
+            cont = sums->GetSum(outbin, outbin, firstbin, lastbin);
+            if (computeErrors) err2 = sums->GetSumError2(outbin, outbin, firstbin, lastbin);
+         } else {
+            cont = sums->GetSum(firstbin, lastbin, outbin, outbin);
+            if (computeErrors) err2 = sums->GetSumError2(firstbin, lastbin, outbin, outbin);
          }
-         // sum bin content and error if needed
-         cont  += GetBinContent(binx,biny);
-         if (computeErrors) {
-            Double_t exy = GetBinError(binx,biny);
-            err2  += exy*exy;
+      }
+      else {
+         for (Int_t inbin = firstbin ; inbin <= lastbin ; ++inbin) {
+            Int_t binx, biny;
+            if (onX) { binx = outbin; biny=inbin; }
+            else     { binx = inbin;  biny=outbin; }
+
+            if (ncuts) {
+               if (!fPainter->IsInside(binx,biny)) continue;
+            }
+            // sum bin content and error if needed
+            cont  += GetBinContent(binx,biny);
+            if (computeErrors) {
+               Double_t exy = GetBinError(binx,biny);
+               err2  += exy*exy;
+            }
          }
       }
       // find corresponding bin number in h1 for outbin
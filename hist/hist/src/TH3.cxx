@@ -24,6 +24,9 @@
 #include "TError.h"
 #include "TMath.h"
 #include "TObjString.h"
+#include "THistPrefixSums.h"
+
+#include <algorithm>
 
 ClassImp(TH3);
 
@@ -422,6 +425,103 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill a 3-D histogram with an array of values and weights.
+///
+///  - ntimes:  number of entries in arrays x, y, z and w (array size must be ntimes*stride)
+///  - x:       array of x values to be histogrammed
+///  - y:       array of y values to be histogrammed
+///  - z:       array of z values to be histogrammed
+///  - w:       array of weights
+///  - stride:  step size through arrays x, y, z and w
+///
+///   - If the weight is not equal to 1, the storage of the sum of squares of
+///     weights is automatically triggered and the sum of the squares of weights is incremented
+///     by w[i]^2 in the bin corresponding to x[i],y[i],z[i].
+///   - If w is NULL each entry is assumed a weight=1
+///
+/// The bins of the entries are found by chunks, which is faster than calling
+/// TH3::Fill for each of them when the axes cannot be extended.
+
+void TH3::FillN(Int_t ntimes, const Double_t *x, const Double_t *y, const Double_t *z, const Double_t *w, Int_t stride)
+{
+   Int_t i;
+   if (fBuffer || (fXaxis.CanExtend() && !fXaxis.IsAlphanumeric()) ||
+       (fYaxis.CanExtend() && !fYaxis.IsAlphanumeric()) || (fZaxis.CanExtend() && !fZaxis.IsAlphanumeric())) {
+      // the entries are buffered or an axis may be extended while filling: fill them one by one
+      for (i = 0; i < ntimes; ++i) {
+         const Long64_t j = (Long64_t)i * stride;
+         Fill(x[j], y[j], z[j], w ? w[j] : 1.);
+      }
+      return;
+   }
+
+   constexpr Int_t kChunk = 256;
+   Int_t bins[kChunk], binsy[kChunk], binsz[kChunk];
+   Double_t weights[kChunk];
+   Bool_t inRange[kChunk];
+   const Int_t nx = fXaxis.GetNbins();
+   const Int_t ny = fYaxis.GetNbins();
+   const Int_t nz = fZaxis.GetNbins();
+   const Bool_t statOverflows = GetStatOverflowsBehaviour();
+   Double_t tsumw = fTsumw, tsumw2 = fTsumw2, tsumwx = fTsumwx, tsumwx2 = fTsumwx2;
+   Double_t tsumwy = fTsumwy, tsumwy2 = fTsumwy2, tsumwxy = fTsumwxy;
+   Double_t tsumwz = fTsumwz, tsumwz2 = fTsumwz2, tsumwxz = fTsumwxz, tsumwyz = fTsumwyz;
+   fEntries += ntimes;
+   for (Int_t first = 0; first < ntimes; first += kChunk) {
+      const Int_t n = std::min(kChunk, ntimes - first);
+      const Long64_t offset = (Long64_t)first * stride;
+      fXaxis.FindFixBins(n, x + offset, bins, stride);
+      fYaxis.FindFixBins(n, y + offset, binsy, stride);
+      fZaxis.FindFixBins(n, z + offset, binsz, stride);
+      Bool_t unitWeights = kTRUE;
+      for (i = 0; i < n; ++i) {
+         weights[i] = w ? w[offset + (Long64_t)i * stride] : 1.;
+         unitWeights &= (weights[i] == 1.);
+      }
+      if (!fSumw2.fN && !unitWeights && !TestBit(TH1::kIsNotW)) Sumw2();
+      for (i = 0; i < n; ++i) {
+         const Int_t binx = bins[i];
+         bins[i] = binx + (nx + 2) * (binsy[i] + (ny + 2) * binsz[i]);
+         inRange[i] = statOverflows || (binx > 0 && binx <= nx && binsy[i] > 0 && binsy[i] <= ny &&
+                                        binsz[i] > 0 && binsz[i] <= nz);
+      }
+      if (fSumw2.fN) {
+         for (i = 0; i < n; ++i)
+            fSumw2.fArray[bins[i]] += weights[i] * weights[i];
+      }
+      AddBinContents(n, bins, weights);
+      for (i = 0; i < n; ++i) {
+         if (!inRange[i]) continue;
+         const Long64_t j = offset + (Long64_t)i * stride;
+         const Double_t ww = weights[i];
+         tsumw   += ww;
+         tsumw2  += ww*ww;
+         tsumwx  += ww*x[j];
+         tsumwx2 += ww*x[j]*x[j];
+         tsumwy  += ww*y[j];
+         tsumwy2 += ww*y[j]*y[j];
+         tsumwxy += ww*x[j]*y[j];
+         tsumwz  += ww*z[j];
+         tsumwz2 += ww*z[j]*z[j];
+         tsumwxz += ww*x[j]*z[j];
+         tsumwyz += ww*y[j]*z[j];
+      }
+   }
+   fTsumw = tsumw;
+   fTsumw2 = tsumw2;
+   fTsumwx = tsumwx;
+   fTsumwx2 = tsumwx2;
+   fTsumwy = tsumwy;
+   fTsumwy2 = tsumwy2;
+   fTsumwxy = tsumwxy;
+   fTsumwz = tsumwz;
+   fTsumwz2 = tsumwz2;
+   fTsumwxz = tsumwxz;
+   fTsumwyz = tsumwyz;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by namex,namey,namez by a weight w
 ///
@@ -1975,23 +2075,37 @@ TH1D *TH3::DoProject1D(const char* name, const char * title, const TAxis* projX,
    if (useUF && !out2->TestBit(TAxis::kAxisRange) )  out2min -= 1;
    if (useOF && !out2->TestBit(TAxis::kAxisRange) )  out2max += 1;
 
+   // with the integral cache the sums over the integrated axes are read from the cumulative sums; without Sumw2 the
+   // errors of the bins are the square roots of the absolute values of the contents and cannot be summed this way
+   const ROOT::Internal::THistPrefixSums *sums = nullptr;
+   if (!computeErrors || GetSumw2N()) sums = GetPrefixSums(computeErrors);
+
    for (ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
       if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
 
       Double_t cont = 0;
       Double_t err2 = 0;
 
-      // loop on the bins to be integrated (outbin should be called inbin)
-      for (out1bin = out1min; out1bin <= out1max; out1bin++) {
-         for (out2bin = out2min; out2bin <= out2max; out2bin++) {
+      if (sums) {
+         // the references give the bins of the corners of the integrated range along the axes of the histogram
+         out1bin = out1min; out2bin = out2min;
+         const Int_t lo[3] = {*refX, *refY, *refZ};
+         out1bin = out1max; out2bin = out2max;
+         cont = sums->GetSum(lo[0], *refX, lo[1], *refY, lo[2], *refZ);
+         if (computeErrors) err2 = sums->GetSumError2(lo[0], *refX, lo[1], *refY, lo[2], *refZ);
+      } else {
+         // loop on the bins to be integrated (outbin should be called inbin)
+         for (out1bin = out1min; out1bin <= out1max; out1bin++) {
+            for (out2bin = out2min; out2bin <= out2max; out2bin++) {
 
-            Int_t bin = GetBin(*refX, *refY, *refZ);
+               Int_t bin = GetBin(*refX, *refY, *refZ);
 
-            // sum the bin contents and errors if needed
-            cont += RetrieveBinContent(bin);
-            if (computeErrors) {
-               Double_t exyz = GetBinError(bin);
-               err2 += exyz*exyz;
+               // sum the bin contents and errors if needed
+               cont += RetrieveBinContent(bin);
+               if (computeErrors) {
+                  Double_t exyz = GetBinError(bin);
+                  err2 += exyz*exyz;
+               }
             }
          }
       }
@@ -2201,6 +2315,10 @@ TH2D *TH3::DoProject2D(const char* name, const char * title, const TAxis* projX,
    if (useUF && !out->TestBit(TAxis::kAxisRange) )  outmin -= 1;
    if (useOF && !out->TestBit(TAxis::kAxisRange) )  outmax += 1;
 
+   // with the integral cache the sums along the integrated axis are read from the cumulative sums (see DoProject1D)
+   const ROOT::Internal::THistPrefixSums *sums = nullptr;
+   if (!computeErrors || GetSumw2N()) sums = GetPrefixSums(computeErrors);
+
    for (ixbin=0;ixbin<=1+projX->GetNbins();ixbin++) {
       if ( projX->TestBit(TAxis::kAxisRange) && ( ixbin < ixmin || ixbin > ixmax )) continue;
       Int_t ix = h2->GetYaxis()->FindBin( projX->GetBinCenter(ixbin) );
@@ -2212,18 +2330,25 @@ TH2D *TH3::DoProject2D(const char* name, const char * title, const TAxis* projX,
          Double_t cont = 0;
          Double_t err2 = 0;
 
-         // loop on the bins to be integrated (outbin should be called inbin)
-         for (outbin = outmin; outbin <= outmax; outbin++) {
+         if (sums) {
+            outbin = outmin;
+            const Int_t lo[3] = {*refX, *refY, *refZ};
+            outbin = outmax;
+            cont = sums->GetSum(lo[0], *refX, lo[1], *refY, lo[2], *refZ);
+            if (computeErrors) err2 = sums->GetSumError2(lo[0], *refX, lo[1], *refY, lo[2], *refZ);
+         } else {
+            // loop on the bins to be integrated (outbin should be called inbin)
+            for (outbin = outmin; outbin <= outmax; outbin++) {
 
-            Int_t bin = GetBin(*refX,*refY,*refZ);
+               Int_t bin = GetBin(*refX,*refY,*refZ);
 
-            // sum the bin contents and errors if needed
-            cont += RetrieveBinContent(bin);
-            if (computeErrors) {
-               Double_t exyz = GetBinError(bin);
-               err2 += exyz*exyz;
+               // sum the bin contents and errors if needed
+               cont += RetrieveBinContent(bin);
+               if (computeErrors) {
+                  Double_t exyz = GetBinError(bin);
+                  err2 += exyz*exyz;
+               }
             }
-
          }
 
          // remember axis are inverted
@@ -0,0 +1,81 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "THistPrefixSums.h"
+
+#include <algorithm>
+
+namespace ROOT {
+namespace Internal {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Replace each element of `table` by the sum of all the elements with lower or equal indices along every axis.
+
+void THistPrefixSums::Accumulate(std::vector<double> &table, const int *n)
+{
+   const std::size_t nx = n[0], ny = n[1], nz = n[2];
+   for (std::size_t iz = 0; iz < nz; ++iz) {
+      for (std::size_t iy = 0; iy < ny; ++iy) {
+         double *row = table.data() + nx * (iy + ny * iz);
+         for (std::size_t ix = 1; ix < nx; ++ix)
+            row[ix] += row[ix - 1];
+         if (iy > 0) {
+            const double *previous = row - nx;
+            for (std::size_t ix = 0; ix < nx; ++ix)
+               row[ix] += previous[ix];
+         }
+      }
+      if (iz > 0) {
+         double *plane = table.data() + nx * ny * iz;
+         const double *previous = plane - nx * ny;
+         for (std::size_t i = 0; i < nx * ny; ++i)
+            plane[i] += previous[i];
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sum of the elements of the table in the given ranges, by inclusion-exclusion of the cumulative sums at the
+/// corners of the box. The ranges are clamped to the table, an empty range gives 0.
+
+double THistPrefixSums::Sum(const std::vector<double> &table, const int *n, int ix1, int ix2, int iy1, int iy2,
+                            int iz1, int iz2)
+{
+   int lo[3] = {ix1, iy1, iz1};
+   int hi[3] = {ix2, iy2, iz2};
+   for (int axis = 0; axis < 3; ++axis) {
+      lo[axis] = std::max(lo[axis], 0);
+      hi[axis] = std::min(hi[axis], n[axis] - 1);
+      if (hi[axis] < lo[axis])
+         return 0;
+   }
+
+   const std::size_t nx = n[0], nxy = (std::size_t)n[0] * n[1];
+   double sum = 0;
+   // corner c takes the upper bound along the axes whose bit is set, the bin before the lower bound otherwise
+   for (int c = 0; c < 8; ++c) {
+      int idx[3];
+      int sign = 1;
+      bool empty = false;
+      for (int axis = 0; axis < 3; ++axis) {
+         if (c & (1 << axis)) {
+            idx[axis] = hi[axis];
+         } else {
+            idx[axis] = lo[axis] - 1;
+            sign = -sign;
+            empty |= idx[axis] < 0;
+         }
+      }
+      if (!empty)
+         sum += sign * table[idx[0] + nx * idx[1] + nxy * idx[2]];
+   }
+   return sum;
+}
+
+} // namespace Internal
+} // namespace ROOT
@@ -0,0 +1,102 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Summed-area tables of the bin contents of a histogram, used internally by TH1, TH2 and TH3
+
+#ifndef ROOT_THistPrefixSums
+#define ROOT_THistPrefixSums
+
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+ Cumulative sums of the bin contents (and optionally of the squares of the bin errors) of a histogram of up to three
+ dimensions, including the underflow and overflow bins.
+
+ Once built, the sum over any rectangular range of bins is obtained from at most eight entries of the table, whatever
+ the size of the range. The tables record the state of the histogram they were built from (number of entries and sums
+ of weights), so that a stale table is detected and rebuilt after the histogram is filled, reset or scaled.
+*/
+class THistPrefixSums {
+public:
+   /// State of the histogram when the tables are built
+   struct RKey {
+      double fEntries = -1;
+      double fTsumw = 0;
+      double fTsumw2 = 0;
+      int fNcells = 0;
+      int fNsumw2 = 0;
+
+      bool operator==(const RKey &other) const
+      {
+         return fEntries == other.fEntries && fTsumw == other.fTsumw && fTsumw2 == other.fTsumw2 &&
+                fNcells == other.fNcells && fNsumw2 == other.fNsumw2;
+      }
+   };
+
+private:
+   int fN[3] = {0, 0, 0};           ///< Number of bins along each axis, including underflow and overflow
+   std::vector<double> fContents;   ///< Cumulative sums of the bin contents
+   std::vector<double> fErrors;     ///< Cumulative sums of the squares of the bin errors, if built
+   RKey fKey;                       ///< State of the histogram the tables were built from
+
+   static void Accumulate(std::vector<double> &table, const int *n);
+   static double Sum(const std::vector<double> &table, const int *n, int ix1, int ix2, int iy1, int iy2, int iz1,
+                     int iz2);
+
+public:
+   /// Whether the tables describe a histogram in the state `key`, with the errors if `errors`
+   bool IsValid(const RKey &key, bool errors) const { return fKey == key && (!errors || !fErrors.empty()); }
+
+   /// Build the tables of a histogram with `nx` * `ny` * `nz` bins, including underflow and overflow. `content(ix,
+   /// iy, iz)` and, if `errors`, `error2(ix, iy, iz)` return the content and the square of the error of a bin.
+   template <typename Content_t, typename Error2_t>
+   void Build(const RKey &key, int nx, int ny, int nz, Content_t &&content, bool errors, Error2_t &&error2)
+   {
+      fN[0] = nx;
+      fN[1] = ny;
+      fN[2] = nz;
+      fKey = key;
+      const std::size_t size = (std::size_t)nx * ny * nz;
+      fContents.resize(size);
+      fErrors.resize(errors ? size : 0);
+      fErrors.shrink_to_fit();
+      std::size_t i = 0;
+      for (int iz = 0; iz < nz; ++iz) {
+         for (int iy = 0; iy < ny; ++iy) {
+            for (int ix = 0; ix < nx; ++ix, ++i) {
+               fContents[i] = content(ix, iy, iz);
+               if (errors)
+                  fErrors[i] = error2(ix, iy, iz);
+            }
+         }
+      }
+      Accumulate(fContents, fN);
+      if (errors)
+         Accumulate(fErrors, fN);
+   }
+
+   /// Sum of the contents of the bins in the given ranges, bounds included
+   double GetSum(int ix1, int ix2, int iy1 = 0, int iy2 = 0, int iz1 = 0, int iz2 = 0) const
+   {
+      return Sum(fContents, fN, ix1, ix2, iy1, iy2, iz1, iz2);
+   }
+
+   /// Sum of the squares of the errors of the bins in the given ranges, bounds included
+   double GetSumError2(int ix1, int ix2, int iy1 = 0, int iy2 = 0, int iz1 = 0, int iz2 = 0) const
+   {
+      return Sum(fErrors, fN, ix1, ix2, iy1, iy2, iz1, iz2);
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
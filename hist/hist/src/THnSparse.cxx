@@ -16,6 +16,8 @@
 #include "TDataMember.h"
 #include "TDataType.h"
 
+#include <vector>
+
 namespace {
 //______________________________________________________________________________
 //
@@ -409,6 +411,120 @@ THnSparseCompactBinCoord::~THnSparseCompactBinCoord()
    delete [] fCurrentBin;
 }
 
+/** \class THnSparseBinIndex
+THnSparseBinIndex is used by THnSparse internally. It maps the hash of the
+compact coordinates of each filled bin to the bin's linear index, in an
+open-addressing hash table with linear probing: a lookup reads consecutive
+slots of one array instead of following the chains of a TExMap, and bins with
+the same hash simply occupy consecutive slots. Each slot takes 16 bytes; the
+table is kept at most 70% full.
+*/
+
+class THnSparseBinIndex {
+public:
+   THnSparseBinIndex() { Clear(); }
+
+   /// Index of the first slot to probe for bins with the given hash
+   Long64_t GetFirstSlot(ULong64_t hash) const { return Mix(hash) & fMask; }
+   /// Index of the slot to probe after `slot`
+   Long64_t GetNextSlot(Long64_t slot) const { return (slot + 1) & fMask; }
+   /// Linear index + 1 of the bin in `slot`, 0 if the slot is empty
+   Long64_t GetBinPlusOne(Long64_t slot) const { return fSlots[slot].fBinPlusOne; }
+   ULong64_t GetHash(Long64_t slot) const { return fSlots[slot].fHash; }
+
+   Long64_t GetSize() const { return fSize; }
+   Long64_t GetCapacity() const { return fSlots.size(); }
+   /// Memory used by the index, in bytes
+   Long64_t GetMemorySize() const { return fSlots.size() * sizeof(Slot_t); }
+   Bool_t IsEmpty() const { return fSize == 0; }
+
+   void Reserve(Long64_t nbins);
+   void Insert(Long64_t slot, ULong64_t hash, Long64_t bin);
+   void Insert(ULong64_t hash, Long64_t bin) { Insert(-1, hash, bin); }
+   /// Remove all bins and release the memory of the slots
+   void Clear()
+   {
+      std::vector<Slot_t>(kMinCapacity).swap(fSlots);
+      fMask = kMinCapacity - 1;
+      fSize = 0;
+   }
+
+private:
+   static constexpr Long64_t kMinCapacity = 1024;
+
+   struct Slot_t {
+      ULong64_t fHash = 0;      // hash of the compact coordinates of the bin
+      Long64_t fBinPlusOne = 0; // linear index + 1 of the bin, 0 for an empty slot
+   };
+
+   /// The compact coordinates of neighbouring bins differ in a few low bits only: spread them over the table
+   static ULong64_t Mix(ULong64_t hash)
+   {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+      hash *= 0xc4ceb9fe1a85ec53ULL;
+      hash ^= hash >> 33;
+      return hash;
+   }
+
+   void Rehash(Long64_t capacity);
+
+   std::vector<Slot_t> fSlots; // the slots, their number is a power of 2
+   Long64_t fMask;             // number of slots - 1
+   Long64_t fSize;             // number of bins in the table
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make room for `nbins` bins without rehashing.
+
+void THnSparseBinIndex::Reserve(Long64_t nbins)
+{
+   Long64_t capacity = kMinCapacity;
+   while (10 * nbins > 7 * capacity)
+      capacity *= 2;
+   if (capacity > GetCapacity())
+      Rehash(capacity);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Move the bins into a table of `capacity` slots.
+
+void THnSparseBinIndex::Rehash(Long64_t capacity)
+{
+   std::vector<Slot_t> slots(capacity);
+   std::swap(fSlots, slots);
+   fMask = capacity - 1;
+   for (const Slot_t &old : slots) {
+      if (!old.fBinPlusOne)
+         continue;
+      Long64_t slot = GetFirstSlot(old.fHash);
+      while (fSlots[slot].fBinPlusOne)
+         slot = GetNextSlot(slot);
+      fSlots[slot] = old;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the bin with linear index `bin` and hash `hash`. `slot` is the empty
+/// slot where the probing for `hash` stopped, or -1 if it is not known.
+
+void THnSparseBinIndex::Insert(Long64_t slot, ULong64_t hash, Long64_t bin)
+{
+   if (10 * (fSize + 1) > 7 * GetCapacity()) {
+      Rehash(2 * GetCapacity());
+      slot = -1;
+   }
+   if (slot < 0) {
+      slot = GetFirstSlot(hash);
+      while (fSlots[slot].fBinPlusOne)
+         slot = GetNextSlot(slot);
+   }
+   fSlots[slot].fHash = hash;
+   fSlots[slot].fBinPlusOne = bin + 1;
+   ++fSize;
+}
+
 /** \class THnSparseArrayChunk
 THnSparseArrayChunk is used internally by THnSparse.
 THnSparse stores its (dynamic size) array of bin coordinates and their
@@ -570,14 +686,14 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in fBinIndex, an open-addressing
+hash table (see THnSparseBinIndex) that is not stored but rebuilt from the
+chunks when needed. The slots following the one of the hash are probed until
+an empty one is found; for each slot with the same hash, the coordinates of
+the bin it points to are compared to the coordinates passed to GetBin(). If
+they do not match, these two coordinates have the same hash - which is
+extremely unlikely but (for the case where the compact bin coordinates are
+larger than 8 bytes) possible.
 */
 
 
@@ -587,7 +703,7 @@ ClassImp(THnSparse);
 /// Construct an empty THnSparse.
 
 THnSparse::THnSparse():
-   fChunkSize(1024), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(1024), fFilledBins(0), fBinIndex(nullptr), fCompactCoord(0)
 {
    fBinContent.SetOwner();
 }
@@ -604,7 +720,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
                      const Int_t* nbins, const Double_t* xmin, const Double_t* xmax,
                      Int_t chunksize):
    THnBase(name, title, dim, nbins, xmin, xmax),
-   fChunkSize(chunksize), fFilledBins(0), fCompactCoord(0)
+   fChunkSize(chunksize), fFilledBins(0), fBinIndex(nullptr), fCompactCoord(0)
 {
    fCompactCoord = new THnSparseCompactBinCoord(dim, nbins);
    fBinContent.SetOwner();
@@ -614,6 +730,7 @@ THnSparse::THnSparse(const char* name, const char* title, Int_t dim,
 /// Destruct a THnSparse
 
 THnSparse::~THnSparse() {
+   delete fBinIndex;
    delete fCompactCoord;
 }
 
@@ -650,36 +767,26 @@ void THnSparse::InitStorage(Int_t* nbins, Int_t chunkSize)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///We have been streamed; set up fBins
+/// We have been streamed, or the index was not needed yet; set up fBinIndex
 
-void THnSparse::FillExMap()
+void THnSparse::FillBinIndex()
 {
+   if (!fBinIndex)
+      fBinIndex = new THnSparseBinIndex();
+   fBinIndex->Clear();
+   fBinIndex->Reserve(GetNbins());
+
    TIter iChunk(&fBinContent);
    THnSparseArrayChunk* chunk = 0;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         fBinIndex->Insert(compactCoord.GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -687,12 +794,9 @@ void THnSparse::FillExMap()
 /// Initialize storage for nbins
 
 void THnSparse::Reserve(Long64_t nbins) {
-   if (!fBins.GetSize() && fBinContent.GetSize()) {
-      FillExMap();
-   }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   if (!fBinIndex || (fBinIndex->IsEmpty() && fBinContent.GetEntriesFast()))
+      FillBinIndex();
+   fBinIndex->Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -790,19 +894,17 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 {
    THnSparseCompactBinCoord* cc = GetCompactCoord();
    ULong64_t hash = cc->GetHash();
-   if (fBinContent.GetSize() && !fBins.GetSize())
-      FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
+   if (!fBinIndex || (fBinIndex->IsEmpty() && fBinContent.GetEntriesFast()))
+      FillBinIndex();
+   Long64_t slot = fBinIndex->GetFirstSlot(hash);
+   while (Long64_t linidx = fBinIndex->GetBinPlusOne(slot)) {
+      // fBinIndex stores index + 1, 0 is an empty slot
+      if (fBinIndex->GetHash(slot) == hash) {
+         THnSparseArrayChunk* chunk = GetChunk((linidx - 1) / fChunkSize);
+         if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
+            return linidx - 1;
+      }
+      slot = fBinIndex->GetNextSlot(slot);
    }
    if (!allocate) return -1;
 
@@ -817,18 +919,9 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
    }
    chunk->AddBin(newidx, cc->GetBuffer());
 
-   // store translation between hash and bin
+   // store translation between hash and bin, in the empty slot that ended the probing
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBinIndex->Insert(slot, hash, newidx);
    return newidx;
 }
 
@@ -880,7 +973,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += fBinIndex ? fBinIndex->GetMemorySize() : 0;
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +1055,8 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   if (fBinIndex)
+      fBinIndex->Clear();
    fBinContent.Delete();
    ResetBase(option);
 }
@@ -42,8 +42,13 @@
 #include "TF1.h"
 #include "TH1.h"
 #include "TVirtualPad.h"
+#include "TROOT.h"
 #include "TKDE.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 ClassImp(TKDE);
 
 
@@ -770,8 +775,23 @@ TKDE::TKernel::TKernel(Double_t weight, TKDE* kde) :
 // Internal class constructor
 fKDE(kde),
 fNWeights(kde->fData.size()),
-fWeights(1, weight)
-{}
+fWeights(1, weight),
+fMaxWeight(weight)
+{
+   // sort the data points, so that only the ones in the support of the kernel are visited by operator()
+   const UInt_t n = fNWeights;
+   std::vector<UInt_t> order(n);
+   std::iota(order.begin(), order.end(), 0);
+   std::stable_sort(order.begin(), order.end(), [kde](UInt_t i, UInt_t j) { return kde->fData[i] < kde->fData[j]; });
+   fSortedData.resize(n);
+   for (UInt_t i = 0; i < n; ++i)
+      fSortedData[i] = kde->fData[order[i]];
+   if (kde->fBinCount.size() == n) {
+      fSortedCounts.resize(n);
+      for (UInt_t i = 0; i < n; ++i)
+         fSortedCounts[i] = kde->fBinCount[order[i]];
+   }
+}
 
 void TKDE::TKernel::ComputeAdaptiveWeights() {
    // Gets the adaptive weights (bandwidths) for TKernel internal computation
@@ -780,6 +800,26 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    // we will store computed adaptive weights in weights
    std::vector<Double_t> weights(n, fWeights[0]);
    bool useDataWeights = (fKDE->fBinCount.size() == n);
+
+   // the pilot estimates at the data points are independent: they are evaluated in parallel if implicit
+   // multi-threading is enabled, and the weights below are computed from them in the order of the data
+   std::vector<Double_t> pilot(n, 0.);
+   auto evaluatePilot = [&](UInt_t first, UInt_t last) {
+      for (UInt_t i = first; i < last; ++i) {
+         if (!useDataWeights || fKDE->fBinCount[i] > 0)
+            pilot[i] = (*this)(fKDE->fData[i]);
+      }
+   };
+#ifdef R__USE_IMT
+   constexpr UInt_t kChunkSize = 1024;
+   if (ROOT::IsImplicitMTEnabled() && n > kChunkSize) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](UInt_t chunk) { evaluatePilot(chunk * kChunkSize, std::min(n, (chunk + 1) * kChunkSize)); },
+                   ROOT::TSeqU((n + kChunkSize - 1) / kChunkSize));
+   } else
+#endif
+      evaluatePilot(0, n);
+
    Double_t f = 0.0;
    for (unsigned int i = 0; i < n; ++i) {
       // for negative or null bin contents use the fixed weight value (fWeights[0])
@@ -787,7 +827,7 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
          weights[i] = fWeights[0];
          continue; // skip negative or null weights
       }
-      f = (*fKDE->fKernel)(fKDE->fData[i]);
+      f = pilot[i];
       if (f <= 0) {
          // this can happen when data are outside range and fAsymLeft or fAsymRight is on
          fKDE->Warning("ComputeAdativeWeights","function value is zero or negative for x = %f w = %f - set their bandwidth to zero",
@@ -808,6 +848,15 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    fWeights.resize(n);
    transform(weights.begin(), weights.end(), fWeights.begin(),
              std::bind(std::multiplies<Double_t>(), std::placeholders::_1, fKDE->fAdaptiveBandwidthFactor));
+
+   // inverse of the weights of the sorted data points (zero for the points with zero bandwidth, which are skipped)
+   fMaxWeight = fWeights.empty() ? 0. : *std::max_element(fWeights.begin(), fWeights.end());
+   std::vector<UInt_t> order(n);
+   std::iota(order.begin(), order.end(), 0);
+   std::stable_sort(order.begin(), order.end(), [this](UInt_t i, UInt_t j) { return fKDE->fData[i] < fKDE->fData[j]; });
+   fSortedInvWeights.resize(n);
+   for (UInt_t i = 0; i < n; ++i)
+      fSortedInvWeights[i] = (fWeights[order[i]] == 0) ? 0. : 1. / fWeights[order[i]];
    //printf("adaptive bandwidth factor % f weight 0 %f , %f \n",fKDE->fAdaptiveBandwidthFactor, weights[0],fWeights[0] );
 }
 
@@ -1009,14 +1058,73 @@ const std::vector<Double_t> & TKDE::TKernel::GetAdaptiveWeights() const {
 
 Double_t TKDE::TKernel::operator()(Double_t x) const {
    // The internal class's unary function: returns the kernel density estimate
+   Double_t result(0.0);
+   // the built-in kernels vanish outside [-support, support]: only the data points closer to x than the support
+   // times the largest bandwidth are summed, with the kernel inlined. The data points filled after the creation
+   // of the kernel are not sorted, and the user kernels are called for all the points
+   if (fSortedData.size() == fKDE->fData.size()) {
+      TKDE *kde = fKDE;
+      switch (fKDE->fKernelType) {
+         case kGaussian:
+            result = SumInSupport(x, [kde](Double_t u) { return kde->GaussianKernel(u); }, 9.);
+            break;
+         case kEpanechnikov:
+            result = SumInSupport(x, [kde](Double_t u) { return kde->EpanechnikovKernel(u); }, 1.);
+            break;
+         case kBiweight:
+            result = SumInSupport(x, [kde](Double_t u) { return kde->BiweightKernel(u); }, 1.);
+            break;
+         case kCosineArch:
+            result = SumInSupport(x, [kde](Double_t u) { return kde->CosineArchKernel(u); }, 1.);
+            break;
+         default:
+            result = Sum(x);
+      }
+   } else {
+      result = Sum(x);
+   }
+   if ( TMath::IsNaN(result) ) {
+      fKDE->Warning("operator()","Result is NaN for  x %f \n",x);
+   }
+   // also in case of unbinned unweighted data fSumOfCounts is sum of events in range
+   // events outside range should be used to normalize the TKDE ??
+   return result / fKDE->fSumOfCounts;
+}
+
+/// Sum of the kernels of the data points in the support of a built-in kernel, through the sorted data points.
+/// The kernels of the mirrored points (fAsymLeft, fAsymRight) are centred at 2 * xmin - d or 2 * xmax - d.
+template <class KernelFunction>
+Double_t TKDE::TKernel::SumInSupport(Double_t x, const KernelFunction &kernel, Double_t support) const {
+   const UInt_t n = fSortedData.size();
+   const Double_t *data = fSortedData.data();
+   const Double_t *counts = fSortedCounts.empty() ? nullptr : fSortedCounts.data();
+   const Double_t *invWeights = fSortedInvWeights.empty() ? nullptr : fSortedInvWeights.data();
+   const Double_t fixedInvWeight = 1. / fWeights[0];
+   const Double_t range = support * fMaxWeight;
+
+   Double_t result(0.0);
+   auto addRange = [&](Double_t reflect, Double_t sign) {
+      const Double_t centre = sign * (x - reflect);
+      const UInt_t first = std::lower_bound(data, data + n, centre - range) - data;
+      const UInt_t last = std::upper_bound(data + first, data + n, centre + range) - data;
+      for (UInt_t i = first; i < last; ++i) {
+         const Double_t binCount = counts ? counts[i] : 1.0;
+         const Double_t invWeight = invWeights ? invWeights[i] : fixedInvWeight;
+         result += binCount * invWeight * kernel((x - (reflect + sign * data[i])) * invWeight);
+      }
+   };
+   addRange(0., 1.);
+   if (fKDE->fAsymLeft) addRange(2. * fKDE->fXMin, -1.);
+   if (fKDE->fAsymRight) addRange(2. * fKDE->fXMax, -1.);
+   return result;
+}
+
+/// Sum of the kernels of all the data points, calling the kernel function
+Double_t TKDE::TKernel::Sum(Double_t x) const {
    Double_t result(0.0);
    UInt_t n = fKDE->fData.size();
    // case of bins or weighted data
    Bool_t useCount = (fKDE->fBinCount.size() == n);
-   // also in case of unbinned unweighted data fSumOfCounts is sum of events in range
-   // events outside range should be used to normalize the TKDE ??
-   Double_t nSum = fKDE->fSumOfCounts; //(useBins) ? fKDE->fSumOfCounts : fKDE->fNEvents;
-   //if (!useCount) nSum = fKDE->fNEvents;
    // in case of non-adaptive fWeights is a vector of size 1
    Bool_t hasAdaptiveWeights = (fWeights.size() == n);
    Double_t invWeight = (!hasAdaptiveWeights) ? 1. / fWeights[0] : 0;
@@ -1039,10 +1147,7 @@ Double_t TKDE::TKernel::operator()(Double_t x) const {
       }
       // printf("data point %i  %f  %f  count %f weight % f result % f\n",i,fKDE->fData[i],fKDE->fEvents[i],binCount,fWeights[i], result);
    }
-   if ( TMath::IsNaN(result) ) {
-      fKDE->Warning("operator()","Result is NaN for  x %f \n",x);
-   }
-   return result / nSum;
+   return result;
 }
 
 ////////////////////////////////////////////////////
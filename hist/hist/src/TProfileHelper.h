@@ -65,6 +65,9 @@ public:
 
    template <typename T>
    static void SetErrorOption(T* p, Option_t * opt);
+
+   template <typename T, typename Sums>
+   static void AddBinSums(T* p, const Sums &sums);
 };
 
 template <typename T>
@@ -229,6 +232,19 @@ Long64_t TProfileHelper::Merge(T* p, TCollection *li) {
             }
             firstNonEmptyHist = kFALSE;
          }
+template <typename T, typename Sums>
+void TProfileHelper::AddBinSums(T* p, const Sums &sums) {
+//    Add to each bin of the profile the sums accumulated by a concurrent filler: sum of w*y, of w*y*y,
+//    of w and of w*w (see ROOT::Internal::TConcurrentSums)
+
+   for (Int_t bin = 0; bin < p->fNcells; ++bin) {
+      p->fArray[bin] += sums.GetBin(bin, 0);
+      p->fSumw2.fArray[bin] += sums.GetBin(bin, 1);
+      p->fBinEntries.fArray[bin] += sums.GetBin(bin, 2);
+      if (p->fBinSumw2.fN) p->fBinSumw2.fArray[bin] += sums.GetBin(bin, 3);
+   }
+}
+
 #endif
 
          // this is executed the first time an histogram with limits is found
@@ -423,6 +439,19 @@ Long64_t TProfileHelper::Merge(T* p, TCollection *li) {
       delete hclone;
    }
    return (Long64_t)nentries;
+template <typename T, typename Sums>
+void TProfileHelper::AddBinSums(T* p, const Sums &sums) {
+//    Add to each bin of the profile the sums accumulated by a concurrent filler: sum of w*y, of w*y*y,
+//    of w and of w*w (see ROOT::Internal::TConcurrentSums)
+
+   for (Int_t bin = 0; bin < p->fNcells; ++bin) {
+      p->fArray[bin] += sums.GetBin(bin, 0);
+      p->fSumw2.fArray[bin] += sums.GetBin(bin, 1);
+      p->fBinEntries.fArray[bin] += sums.GetBin(bin, 2);
+      if (p->fBinSumw2.fN) p->fBinSumw2.fArray[bin] += sums.GetBin(bin, 3);
+   }
+}
+
 #endif
 }
 
@@ -776,4 +805,17 @@ void TProfileHelper::SetBinEntries(T* p, Int_t bin, Double_t w) {
 
 }
 
+template <typename T, typename Sums>
+void TProfileHelper::AddBinSums(T* p, const Sums &sums) {
+//    Add to each bin of the profile the sums accumulated by a concurrent filler: sum of w*y, of w*y*y,
+//    of w and of w*w (see ROOT::Internal::TConcurrentSums)
+
+   for (Int_t bin = 0; bin < p->fNcells; ++bin) {
+      p->fArray[bin] += sums.GetBin(bin, 0);
+      p->fSumw2.fArray[bin] += sums.GetBin(bin, 1);
+      p->fBinEntries.fArray[bin] += sums.GetBin(bin, 2);
+      if (p->fBinSumw2.fN) p->fBinSumw2.fArray[bin] += sums.GetBin(bin, 3);
+   }
+}
+
 #endif
@@ -35,6 +35,48 @@ ClassImp(TSpline3);
 ClassImp(TSpline5);
 ClassImp(TSpline);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the polynomials of a spline at the n points x, returning the same
+/// values as Eval(). The knot interval found for a point is reused for the next
+/// one if it still contains it, or if it lies a few knots further: monotonic or
+/// clustered points, e.g. sorted calibration inputs, then avoid most of the knot
+/// searches. The knots are only searched with findX, the FindX() method of the
+/// spline, for equidistant knots, outside the knot range or if the point moved
+/// backwards. maxKnot is the last polynomial used for the extrapolation.
+
+template <class Poly, class FindX_t>
+void SplineEvalN(Poly *poly, Int_t np, Double_t xmin, Double_t xmax, Bool_t equidistant, Int_t maxKnot,
+                 FindX_t &&findX, Int_t n, const Double_t *x, Double_t *y)
+{
+   constexpr Int_t kMaxSteps = 4;
+   Int_t klow = -1;
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t xi = x[i];
+      if (equidistant || !(xi > xmin && xi < xmax)) {
+         // O(1) for equidistant knots, and keeps the behaviour of FindX at the boundaries
+         klow = findX(xi);
+      } else if (klow < 0 || klow >= np - 1 || !(poly[klow].X() < xi)) {
+         klow = findX(xi);
+      } else {
+         // same interval as the binary search of FindX: X(klow) < xi <= X(klow+1)
+         Int_t nsteps = 0;
+         while (xi > poly[klow + 1].X() && klow < np - 2) {
+            if (++nsteps > kMaxSteps) {
+               klow = findX(xi);
+               break;
+            }
+            ++klow;
+         }
+      }
+      // call the polynomial non virtually such that it can be inlined
+      y[i] = poly[TMath::Min(klow, maxKnot)].Poly::Eval(xi);
+   }
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy constructor.
 
@@ -63,6 +105,19 @@ TSpline::~TSpline()
    if(fGraph) delete fGraph;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this spline at the n points x, storing the results in y.
+///
+/// This is equivalent to calling Eval() for every point. TSpline3 and TSpline5
+/// reuse the knot interval of the previous point, which is faster if the points
+/// are sorted or clustered.
+
+void TSpline::EvalN(Int_t n, const Double_t *x, Double_t *y) const
+{
+   for (Int_t i = 0; i < n; ++i)
+      y[i] = Eval(x[i]);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Assignment operator.
 
@@ -790,6 +845,22 @@ Double_t TSpline3::Eval(Double_t x) const
    return fPoly[klow].Eval(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Eval this spline at the n points x, storing the results in y.
+///
+/// The results are the same as the ones of Eval(), but the knot interval of a
+/// point is reused for the following points if possible instead of searching it
+/// for every point: sort the points, or evaluate them in a locally monotonic
+/// order, to profit from it.
+
+void TSpline3::EvalN(Int_t n, const Double_t *x, Double_t *y) const
+{
+   if (fNp <= 0)
+      return TSpline::EvalN(n, x, y);
+   const Int_t maxKnot = (fNp > 1) ? fNp - 2 : 0;
+   SplineEvalN(fPoly, fNp, fXmin, fXmax, fKstep, maxKnot, [this](Double_t xi) { return FindX(xi); }, n, x, y);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Derivative.
 
@@ -1565,6 +1636,18 @@ Double_t TSpline5::Eval(Double_t x) const
    return fPoly[klow].Eval(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Eval this spline at the n points x, storing the results in y.
+///
+/// See TSpline3::EvalN().
+
+void TSpline5::EvalN(Int_t n, const Double_t *x, Double_t *y) const
+{
+   if (fNp <= 0)
+      return TSpline::EvalN(n, x, y);
+   SplineEvalN(fPoly, fNp, fXmin, fXmax, fKstep, fNp - 1, [this](Double_t xi) { return FindX(xi); }, n, x, y);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Derivative.
 
@@ -1,9 +1,14 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
 
+#include <map>
+#include <memory>
+#include <vector>
+
 // Filling THn
 TEST(THn, Fill) {
    Int_t bins[2] = {2, 3};
@@ -111,3 +116,43 @@ TEST(THn, Projection) {
    }
 
 }
+
+// Finding the filled bins of a THnSparse, with compact coordinates of up to 8 bytes and beyond
+TEST(THnSparse, BinIndex) {
+   for (Int_t ndim : {4, 10}) {
+      std::vector<Int_t> bins(ndim, 100);
+      std::vector<Double_t> xmin(ndim, 0.), xmax(ndim, 100.);
+      THnSparseD hs("hs", "hs", ndim, bins.data(), xmin.data(), xmax.data(), 1000);
+
+      std::map<std::vector<Int_t>, Double_t> expected;
+      std::vector<Int_t> coord(ndim);
+      for (Int_t i = 0; i < 20000; ++i) {
+         // many bins share all their coordinates but one
+         for (Int_t d = 0; d < ndim; ++d)
+            coord[d] = 1 + (i * (d + 1) * 7919 / (d + 3)) % 97;
+         hs.AddBinContent(coord.data(), 0.5 + i % 3);
+         expected[coord] += 0.5 + i % 3;
+      }
+      EXPECT_EQ(Long64_t(expected.size()), hs.GetNbins());
+
+      // the index is not stored: a streamed copy must rebuild it
+      std::unique_ptr<THnSparse> clone(static_cast<THnSparse *>(hs.Clone()));
+      for (const THnSparse *h : std::initializer_list<const THnSparse *>{&hs, clone.get()}) {
+         for (const auto &bin : expected) {
+            const Long64_t idx = h->GetBin(bin.first.data());
+            ASSERT_GE(idx, 0);
+            EXPECT_DOUBLE_EQ(bin.second, h->GetBinContent(idx, coord.data()));
+            EXPECT_EQ(bin.first, coord);
+         }
+         coord.assign(ndim, 98);
+         EXPECT_EQ(-1, h->GetBin(coord.data()));
+      }
+
+      hs.Reset();
+      EXPECT_EQ(0, hs.GetNbins());
+      EXPECT_EQ(-1, static_cast<const THnSparse &>(hs).GetBin(expected.begin()->first.data()));
+      hs.AddBinContent(expected.begin()->first.data(), 2.);
+      EXPECT_EQ(1, hs.GetNbins());
+      EXPECT_DOUBLE_EQ(2., hs.GetBinContent(expected.begin()->first.data()));
+   }
+}
@@ -0,0 +1,125 @@
+#include "TConcurrentFiller.h"
+#include "TEfficiency.h"
+#include "TH1.h"
+#include "TProfile.h"
+#include "TProfile2D.h"
+
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace {
+constexpr int kNThreads = 4;
+constexpr int kNFills = 20000;
+
+// run `fill(gen, threadIndex)` kNFills times in each of kNThreads threads
+template <typename F>
+void RunThreads(F &&fill)
+{
+   std::vector<std::thread> threads;
+   for (int t = 0; t < kNThreads; ++t) {
+      threads.emplace_back([&fill, t]() {
+         std::mt19937 gen(t);
+         for (int i = 0; i < kNFills; ++i)
+            fill(gen);
+      });
+   }
+   for (auto &thr : threads)
+      thr.join();
+}
+
+void ExpectSameHistograms(const TH1 &h1, const TH1 &h2)
+{
+   ASSERT_EQ(h1.GetNcells(), h2.GetNcells());
+   EXPECT_DOUBLE_EQ(h1.GetEntries(), h2.GetEntries());
+   for (int bin = 0; bin < h1.GetNcells(); ++bin) {
+      EXPECT_NEAR(h1.GetBinContent(bin), h2.GetBinContent(bin), 1e-9 * (1 + std::abs(h1.GetBinContent(bin))));
+      EXPECT_NEAR(h1.GetBinError(bin), h2.GetBinError(bin), 1e-9 * (1 + h1.GetBinError(bin)));
+   }
+   EXPECT_NEAR(h1.GetMean(), h2.GetMean(), 1e-9);
+   EXPECT_NEAR(h1.GetStdDev(), h2.GetStdDev(), 1e-9);
+}
+} // namespace
+
+TEST(TConcurrentFiller, Profile)
+{
+   TProfile prof("prof", "prof", 50, 0., 1.);
+   TProfile ref("ref", "ref", 50, 0., 1.);
+   prof.SetDirectory(nullptr);
+   ref.SetDirectory(nullptr);
+   // the profile may already hold some entries
+   prof.Fill(0.5, 1.);
+   ref.Fill(0.5, 1.);
+
+   std::mutex mutex;
+
+   {
+      ROOT::TProfileConcurrentFiller filler(prof);
+      RunThreads([&](std::mt19937 &gen) {
+         std::uniform_real_distribution<double> uniform(-0.1, 1.1);
+         const double x = uniform(gen);
+         const double y = 2 * x + uniform(gen);
+         const double w = 0.5 + uniform(gen);
+         filler.Fill(x, y, w);
+         std::lock_guard<std::mutex> lock(mutex);
+         ref.Fill(x, y, w);
+      });
+      // the destructor flushes the filler
+   }
+
+   ExpectSameHistograms(prof, ref);
+   EXPECT_EQ(prof.GetBinSumw2()->fN, ref.GetBinSumw2()->fN);
+   for (int bin = 0; bin < prof.GetNcells(); ++bin)
+      EXPECT_NEAR(prof.GetBinEffectiveEntries(bin), ref.GetBinEffectiveEntries(bin), 1e-6);
+}
+
+TEST(TConcurrentFiller, Profile2D)
+{
+   TProfile2D prof("prof2", "prof2", 10, 0., 1., 10, 0., 1.);
+   TProfile2D ref("ref2", "ref2", 10, 0., 1., 10, 0., 1.);
+   prof.SetDirectory(nullptr);
+   ref.SetDirectory(nullptr);
+   std::mutex mutex;
+
+   ROOT::TProfile2DConcurrentFiller filler(prof);
+   RunThreads([&](std::mt19937 &gen) {
+      std::uniform_real_distribution<double> uniform(-0.1, 1.1);
+      const double x = uniform(gen), y = uniform(gen);
+      const double z = x * y + uniform(gen);
+      filler.Fill(x, y, z);
+      std::lock_guard<std::mutex> lock(mutex);
+      ref.Fill(x, y, z);
+   });
+   filler.Flush();
+
+   ExpectSameHistograms(prof, ref);
+   EXPECT_EQ(prof.GetBinSumw2()->fN, 0);
+}
+
+TEST(TConcurrentFiller, Efficiency)
+{
+   TEfficiency eff("eff", "eff", 20, 0., 1.);
+   TEfficiency ref("effref", "effref", 20, 0., 1.);
+   eff.SetDirectory(nullptr);
+   ref.SetDirectory(nullptr);
+   std::mutex mutex;
+
+   ROOT::TEfficiencyConcurrentFiller filler(eff);
+   RunThreads([&](std::mt19937 &gen) {
+      std::uniform_real_distribution<double> uniform(0., 1.);
+      const double x = uniform(gen);
+      const bool passed = uniform(gen) < x;
+      filler.Fill(passed, x);
+      std::lock_guard<std::mutex> lock(mutex);
+      ref.Fill(passed, x);
+   });
+   filler.Flush();
+
+   ExpectSameHistograms(*eff.GetTotalHistogram(), *ref.GetTotalHistogram());
+   ExpectSameHistograms(*eff.GetPassedHistogram(), *ref.GetPassedHistogram());
+   EXPECT_FALSE(eff.UsesWeights());
+}
@@ -1,9 +1,41 @@
 #include "gtest/gtest.h"
 
 #include "TFormula.h"
+#include "TMath.h"
+
+#include <cmath>
 
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+// Expressions made of predefined functions are evaluated without Cling, others are still compiled
+TEST(TFormula, BuiltinEvaluator)
+{
+   const double x[] = {0.7, -1.3};
+   const double p[] = {2., 0.5, 1.5, 0.3};
+
+   TFormula gaus("gausBuiltin", "gaus", false);
+   EXPECT_NEAR(gaus.EvalPar(x, p), 2 * TMath::Gaus(0.7, 0.5, 1.5), 1e-12);
+   TFormula expo("expoBuiltin", "expo", false);
+   EXPECT_NEAR(expo.EvalPar(x, p), std::exp(2 + 0.5 * 0.7), 1e-12);
+   TFormula landau("landauBuiltin", "landau", false);
+   EXPECT_NEAR(landau.EvalPar(x, p), 2 * TMath::Landau(0.7, 0.5, 1.5), 1e-12);
+   TFormula pol3("pol3Builtin", "pol3", false);
+   EXPECT_NEAR(pol3.EvalPar(x, p), 2 + 0.5 * 0.7 + 1.5 * 0.7 * 0.7 + 0.3 * 0.7 * 0.7 * 0.7, 1e-12);
+   TFormula cheb2("cheb2Builtin", "cheb2", false);
+   EXPECT_NEAR(cheb2.EvalPar(x, p), 2 + 0.5 * 0.7 + 1.5 * (2 * 0.7 * 0.7 - 1), 1e-12);
+   TFormula xy("xyBuiltin", "(x > 0) * sqrt(abs(y)) + x^3 - 1e-1", false);
+   EXPECT_NEAR(xy.EvalPar(x), std::sqrt(1.3) + 0.7 * 0.7 * 0.7 - 0.1, 1e-12);
+
+   // the copies share the evaluator
+   TFormula copy(gaus);
+   EXPECT_NEAR(copy.EvalPar(x, p), gaus.EvalPar(x, p), 1e-15);
+   EXPECT_TRUE(TString(gaus.GetExpFormula("CLING")).Contains("exp"));
+
+   // integer division as in C++
+   TFormula intDiv("intDivBuiltin", "1/2 + x", false);
+   EXPECT_DOUBLE_EQ(intDiv.Eval(1.), 1.);
+}
@@ -0,0 +1,94 @@
+// test TGraph::EvalN, TSpline3::EvalN and TSpline5::EvalN against the point by point Eval
+
+#include "gtest/gtest.h"
+
+#include "TGraph.h"
+#include "TSpline.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+TGraph MakeGraph(bool uniform)
+{
+   TGraph g;
+   double x = -1.;
+   for (int i = 0; i < 50; ++i) {
+      g.SetPoint(i, x, std::sin(x));
+      x += uniform ? 0.2 : 0.05 + 0.01 * (i % 7);
+   }
+   return g;
+}
+
+// sorted, shuffled and repeated abscissas, including the knots and the extrapolation ranges
+std::vector<double> MakeAbscissas(const TGraph &g)
+{
+   std::vector<double> x;
+   std::mt19937 gen(42);
+   std::uniform_real_distribution<double> dist(g.GetX()[0] - 1., g.GetX()[g.GetN() - 1] + 1.);
+   for (int i = 0; i < 2000; ++i)
+      x.push_back(dist(gen));
+   for (int i = 0; i < g.GetN(); ++i)
+      x.push_back(g.GetX()[i]);
+   std::vector<double> sorted = x;
+   std::sort(sorted.begin(), sorted.end());
+   x.insert(x.end(), sorted.begin(), sorted.end());
+   x.insert(x.end(), sorted.rbegin(), sorted.rend());
+   x.insert(x.end(), 10, sorted[sorted.size() / 2]);
+   return x;
+}
+
+template <class Eval_t, class EvalN_t>
+void Compare(const std::vector<double> &x, Eval_t &&eval, EvalN_t &&evalN)
+{
+   std::vector<double> y(x.size());
+   evalN(x.size(), x.data(), y.data());
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_EQ(eval(x[i]), y[i]) << "at x = " << x[i];
+}
+
+} // namespace
+
+TEST(TGraph, EvalNLinear)
+{
+   for (bool uniform : {true, false}) {
+      auto g = MakeGraph(uniform);
+      const auto x = MakeAbscissas(g);
+      // unsorted graph, point by point
+      Compare(
+         x, [&](double xi) { return g.Eval(xi); },
+         [&](int n, const double *xx, double *yy) { g.EvalN(n, xx, yy); });
+      g.SetBit(TGraph::kIsSortedX);
+      Compare(
+         x, [&](double xi) { return g.Eval(xi); },
+         [&](int n, const double *xx, double *yy) { g.EvalN(n, xx, yy); });
+   }
+}
+
+TEST(TGraph, EvalNSpline)
+{
+   auto g = MakeGraph(false);
+   const auto x = MakeAbscissas(g);
+   Compare(
+      x, [&](double xi) { return g.Eval(xi, nullptr, "S"); },
+      [&](int n, const double *xx, double *yy) { g.EvalN(n, xx, yy, nullptr, "S"); });
+}
+
+TEST(TSpline, EvalN)
+{
+   for (bool uniform : {true, false}) {
+      auto g = MakeGraph(uniform);
+      const auto x = MakeAbscissas(g);
+      TSpline3 s3("s3", &g);
+      TSpline5 s5("s5", &g);
+      Compare(
+         x, [&](double xi) { return s3.Eval(xi); },
+         [&](int n, const double *xx, double *yy) { s3.EvalN(n, xx, yy); });
+      Compare(
+         x, [&](double xi) { return s5.Eval(xi); },
+         [&](int n, const double *xx, double *yy) { g.EvalN(n, xx, yy, &s5); });
+   }
+}
@@ -1,8 +1,19 @@
 #include "gtest/gtest.h"
 
+#include "Foption.h"
+#include "HFitInterface.h"
+#include "TF1.h"
 #include "TH1.h"
 #include "TH1F.h"
+#include "TH2.h"
+#include "TH3.h"
 #include "THLimitsFinder.h"
+#include "TList.h"
+#include "TRandom3.h"
+
+#include <limits>
+#include <memory>
+#include <vector>
 
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
@@ -46,3 +57,234 @@ TEST(THLimitsFinder, Degenerate)
    EXPECT_LE(xmin, centralValue - 5.);
    EXPECT_GE(xmax, centralValue + 5.);
 }
+
+// FillN finds the bins of the entries by chunks: it must give the same histogram as Fill
+TEST(TH1, FillN)
+{
+   const Int_t n = 1000;
+   std::vector<Double_t> x(2 * n), y(2 * n), z(2 * n), w(2 * n);
+   for (Int_t i = 0; i < 2 * n; ++i) {
+      x[i] = -1.5 + 13. * ((i * 37) % 1000) / 1000.;
+      y[i] = -2. + 14. * ((i * 53) % 1000) / 1000.;
+      z[i] = -1. + 12. * ((i * 71) % 1000) / 1000.;
+      w[i] = 0.5 + (i % 7) * 0.25;
+   }
+   x[3] = std::numeric_limits<Double_t>::quiet_NaN();
+   const Double_t edges[] = {0., 0.5, 2., 3.5, 6., 10.};
+
+   auto expectEqual = [](const TH1 &h1, const TH1 &h2) {
+      EXPECT_EQ(h1.GetEntries(), h2.GetEntries());
+      for (Int_t bin = 0; bin < h1.GetNcells(); ++bin) {
+         EXPECT_DOUBLE_EQ(h1.GetBinContent(bin), h2.GetBinContent(bin));
+         EXPECT_DOUBLE_EQ(h1.GetBinError(bin), h2.GetBinError(bin));
+      }
+      Double_t stats1[TH1::kNstat], stats2[TH1::kNstat];
+      h1.GetStats(stats1);
+      h2.GetStats(stats2);
+      for (Int_t i = 0; i < TH1::kNstat; ++i)
+         EXPECT_DOUBLE_EQ(stats1[i], stats2[i]);
+   };
+
+   for (Int_t stride : {1, 2}) {
+      for (bool weighted : {false, true}) {
+         const Double_t *weights = weighted ? w.data() : nullptr;
+         TH1D fixed("fixed", "", 10, 0, 10), fixedN("fixedN", "", 10, 0, 10);
+         TH1F variable("variable", "", 5, edges), variableN("variableN", "", 5, edges);
+         TH2D h2("h2", "", 10, 0, 10, 5, edges), h2N("h2N", "", 10, 0, 10, 5, edges);
+         TH3F h3("h3", "", 10, 0, 10, 5, 0, 10, 4, 0, 10), h3N("h3N", "", 10, 0, 10, 5, 0, 10, 4, 0, 10);
+         for (auto h : std::initializer_list<TH1 *>{&fixed, &fixedN, &variable, &variableN, &h2, &h2N, &h3, &h3N})
+            h->SetDirectory(nullptr);
+         h3.GetYaxis()->Set(5, edges);
+         h3N.GetYaxis()->Set(5, edges);
+         for (Int_t i = 0; i < n * stride; i += stride) {
+            const Double_t ww = weighted ? w[i] : 1.;
+            fixed.Fill(x[i], ww);
+            variable.Fill(x[i], ww);
+            h2.Fill(x[i], y[i], ww);
+            h3.Fill(x[i], y[i], z[i], ww);
+         }
+         fixedN.FillN(n, x.data(), weights, stride);
+         variableN.FillN(n, x.data(), weights, stride);
+         h2N.FillN(n, x.data(), y.data(), weights, stride);
+         h3N.FillN(n, x.data(), y.data(), z.data(), weights, stride);
+         expectEqual(fixed, fixedN);
+         expectEqual(variable, variableN);
+         expectEqual(h2, h2N);
+         expectEqual(h3, h3N);
+      }
+   }
+}
+
+// The execution options are parsed for graphs too, without being taken for single letter options
+TEST(TH1, FitOptions)
+{
+   using ROOT::Fit::EFitObjectType;
+   for (auto type : {EFitObjectType::kHistogram, EFitObjectType::kGraph}) {
+      Foption_t opt;
+      ROOT::Fit::FitOptionsMake(type, "MULTITHREAD VEC Q", opt);
+      EXPECT_EQ(opt.ExecPolicy, ROOT::EExecutionPolicy::kMultiThread);
+      EXPECT_EQ(opt.Vectorized, 1);
+      EXPECT_EQ(opt.Quiet, 1);
+      EXPECT_EQ(opt.Verbose, 0);
+      EXPECT_EQ(opt.Errors, 0);
+      EXPECT_EQ(opt.Robust, 0);
+      EXPECT_EQ(opt.NoErrX, 0);
+      EXPECT_EQ(opt.Like, 0);
+
+      Foption_t serial;
+      ROOT::Fit::FitOptionsMake(type, "SERIAL", serial);
+      EXPECT_EQ(serial.ExecPolicy, ROOT::EExecutionPolicy::kSequential);
+      EXPECT_EQ(serial.Integral, 0);
+      EXPECT_EQ(serial.Range, 0);
+   }
+
+   // the function is fitted vectorized if possible, but stored as given
+   TH1D h("hFitOptions", "", 100, -5, 5);
+   TF1 gen("genFitOptions", "gaus", -5, 5);
+   gen.SetParameters(1, 0.5, 1.2);
+   h.FillRandom("genFitOptions", 10000);
+   TF1 f("fFitOptions", "gaus", -5, 5);
+   f.SetParameters(h.GetMaximum(), 0, 1);
+   EXPECT_EQ(int(h.Fit(&f, "Q0 VEC G")), 0);
+   EXPECT_FALSE(f.IsVectorized());
+   EXPECT_NEAR(f.GetParameter(1), 0.5, 0.1);
+   EXPECT_NEAR(f.GetParameter(2), 1.2, 0.1);
+}
+
+// Integrals and projections computed with the integral cache must be the ones computed bin by bin
+TEST(TH1, IntegralCache)
+{
+   TH2D h2a("h2a", "h2a", 20, 0, 1, 15, 0, 1);
+   TH3D h3a("h3a", "h3a", 10, 0, 1, 8, 0, 1, 6, 0, 1);
+   for (int i = 0; i < 20000; ++i) {
+      const double x = -0.1 + 1.2 * ((i * 7919) % 10007) / 10007.;
+      const double y = -0.1 + 1.2 * ((i * 104729) % 10009) / 10009.;
+      const double z = -0.1 + 1.2 * ((i * 1299709) % 10037) / 10037.;
+      h2a.Fill(x, y, 1 + i % 3);
+      h3a.Fill(x, y, z, 1 + i % 3);
+   }
+   std::unique_ptr<TH2D> h2b(static_cast<TH2D *>(h2a.Clone("h2b")));
+   std::unique_ptr<TH3D> h3b(static_cast<TH3D *>(h3a.Clone("h3b")));
+   EXPECT_FALSE(h2b->HasIntegralCache());
+   h2b->SetIntegralCache();
+   h3b->SetIntegralCache();
+   EXPECT_TRUE(h2b->HasIntegralCache());
+
+   double erra, errb;
+   for (int first : {0, 1, 3}) {
+      for (int last : {2, 7, 16}) {
+         EXPECT_DOUBLE_EQ(h2a.Integral(first, last, first, last), h2b->Integral(first, last, first, last));
+         EXPECT_DOUBLE_EQ(h2a.IntegralAndError(first, last, 2, last, erra),
+                          h2b->IntegralAndError(first, last, 2, last, errb));
+         EXPECT_DOUBLE_EQ(erra, errb);
+         EXPECT_DOUBLE_EQ(h3a.IntegralAndError(first, last, 1, 5, first, 4, erra),
+                          h3b->IntegralAndError(first, last, 1, 5, first, 4, errb));
+         EXPECT_DOUBLE_EQ(erra, errb);
+
+         std::unique_ptr<TH1D> pa(h2a.ProjectionY("pa", first, last, "e"));
+         std::unique_ptr<TH1D> pb(h2b->ProjectionY("pb", first, last, "e"));
+         for (int bin = 0; bin <= pa->GetNbinsX() + 1; ++bin) {
+            EXPECT_DOUBLE_EQ(pa->GetBinContent(bin), pb->GetBinContent(bin));
+            EXPECT_DOUBLE_EQ(pa->GetBinError(bin), pb->GetBinError(bin));
+         }
+      }
+   }
+
+   h3a.GetYaxis()->SetRange(2, 6);
+   h3b->GetYaxis()->SetRange(2, 6);
+   std::unique_ptr<TH1D> pa(static_cast<TH1D *>(h3a.Project3D("z")));
+   std::unique_ptr<TH1D> pb(static_cast<TH1D *>(h3b->Project3D("z")));
+   for (int bin = 0; bin <= pa->GetNbinsX() + 1; ++bin) {
+      EXPECT_DOUBLE_EQ(pa->GetBinContent(bin), pb->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(pa->GetBinError(bin), pb->GetBinError(bin));
+   }
+   std::unique_ptr<TH2D> pxza(static_cast<TH2D *>(h3a.Project3D("xz")));
+   std::unique_ptr<TH2D> pxzb(static_cast<TH2D *>(h3b->Project3D("xz")));
+   for (int bin = 0; bin < pxza->GetNcells(); ++bin) {
+      EXPECT_DOUBLE_EQ(pxza->GetBinContent(bin), pxzb->GetBinContent(bin));
+      EXPECT_DOUBLE_EQ(pxza->GetBinError(bin), pxzb->GetBinError(bin));
+   }
+
+   // the cache is rebuilt after the histogram changed
+   const double before = h2b->Integral();
+   h2b->Fill(0.5, 0.5, 4.);
+   EXPECT_DOUBLE_EQ(h2b->Integral(), before + 4.);
+   h2b->Scale(0.5);
+   EXPECT_DOUBLE_EQ(h2b->Integral(), (before + 4.) * 0.5);
+   h2b->Reset();
+   EXPECT_EQ(h2b->Integral(), 0.);
+}
+
+// Merge of histograms with identical binning, through a list or an array, must give the same as Add
+TEST(TH1, MergeSameBinning)
+{
+   std::vector<std::unique_ptr<TH2F>> parts;
+   TH2F expected("expected", "expected", 30, 0, 1, 20, -1, 1);
+   for (int i = 0; i < 8; ++i) {
+      parts.emplace_back(new TH2F(Form("part%d", i), "part", 30, 0, 1, 20, -1, 1));
+      for (int j = 0; j < 1000; ++j)
+         parts.back()->Fill(((j * 7 + i) % 101) / 100., ((j * 13 + i) % 97) / 48. - 1.05, i % 2 ? 1. : 0.5);
+      expected.Add(parts.back().get());
+   }
+   // an empty histogram is skipped
+   parts.emplace_back(new TH2F("empty", "empty", 30, 0, 1, 20, -1, 1));
+
+   TH2F fromList("fromList", "fromList", 30, 0, 1, 20, -1, 1);
+   TList list;
+   for (auto &part : parts)
+      list.Add(part.get());
+   fromList.Merge(&list);
+
+   TH2F fromArray("fromArray", "fromArray", 30, 0, 1, 20, -1, 1);
+   std::vector<TH1 *> hists;
+   for (auto &part : parts)
+      hists.push_back(part.get());
+   EXPECT_EQ(fromArray.Merge(hists.size(), hists.data()), 8000);
+
+   for (const TH2F *h : {&fromList, &fromArray}) {
+      EXPECT_EQ(h->GetEntries(), expected.GetEntries());
+      EXPECT_DOUBLE_EQ(h->GetMean(1), expected.GetMean(1));
+      EXPECT_DOUBLE_EQ(h->GetMean(2), expected.GetMean(2));
+      EXPECT_DOUBLE_EQ(h->GetStdDev(2), expected.GetStdDev(2));
+      for (int bin = 0; bin < expected.GetNcells(); ++bin) {
+         EXPECT_FLOAT_EQ(h->GetBinContent(bin), expected.GetBinContent(bin));
+         EXPECT_FLOAT_EQ(h->GetBinError(bin), expected.GetBinError(bin));
+      }
+   }
+
+   // different binning: merged bin by bin
+   TH2F other("other", "other", 15, 0, 1, 20, -1, 1);
+   TH1 *first[] = {parts[0].get(), parts[1].get()};
+   other.Merge(2, first);
+   EXPECT_DOUBLE_EQ(other.Integral(), parts[0]->Integral() + parts[1]->Integral());
+}
+
+// The bulk sampling gives the same numbers as the one by one sampling with the same generator
+TEST(TH1, GetRandomArray)
+{
+   TH1D h("hsource", "hsource", 50, -5, 5);
+   for (int bin = 1; bin <= 50; ++bin)
+      h.SetBinContent(bin, bin % 7 == 0 ? 0. : bin * (51 - bin));
+   TRandom3 rng1(42);
+   TRandom3 rng2(42);
+   std::vector<double> values(1000);
+   h.GetRandomArray(values.size(), values.data(), &rng1);
+   for (double value : values)
+      EXPECT_EQ(value, h.GetRandom(&rng2));
+
+   TF1 f("fsource", "gaus", -5, 5);
+   f.SetParameters(1, 0.5, 1.2);
+   f.GetRandomArray(values.size(), values.data(), &rng1);
+   for (double value : values)
+      EXPECT_EQ(value, f.GetRandom(&rng2));
+
+   // FillRandom with the same generator gives the same histogram as filling with GetRandom
+   TH1D filled("filled", "filled", 40, -5, 5);
+   TH1D expected("expected", "expected", 40, -5, 5);
+   filled.FillRandom(&h, 300, &rng1);
+   for (int i = 0; i < 300; ++i)
+      expected.Fill(h.GetRandom(&rng2));
+   for (int bin = 0; bin < expected.GetNcells(); ++bin)
+      EXPECT_EQ(filled.GetBinContent(bin), expected.GetBinContent(bin));
+   EXPECT_DOUBLE_EQ(filled.GetMean(), expected.GetMean());
+}
@@ -10,6 +10,9 @@
 #include "TH1.h"
 #include "Math/DistFuncMathCore.h"
 
+#include <cmath>
+#include <vector>
+
 
 struct TestKDE {
 
@@ -496,4 +499,43 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+/// The estimate summed over the data points in the support of the kernel must be the sum over all the data points
+TEST(TKDE, tkde_support)
+{
+   TRandom3 r(1234);
+   std::vector<double> data(3000);
+   for (auto &x : data)
+      x = (r.Rndm() < 0.3) ? r.Gaus(5, 0.5) : r.Exp(4.);
+
+   for (const char *kernel : {"Gaussian", "Epanechnikov", "Biweight", "CosineArch"}) {
+      for (const char *iteration : {"Fixed", "Adaptive"}) {
+         TString opt = TString::Format("KernelType:%s;Iteration:%s;Mirror:noMirror;Binning:Unbinned", kernel, iteration);
+         TKDE kde(data.size(), data.data(), -1., 40., opt);
+         const bool adaptive = TString(iteration) == "Adaptive";
+         const double *weights = adaptive ? kde.GetAdaptiveWeights() : nullptr;
+         const double fixedWeight = adaptive ? 0. : kde.GetFixedWeight();
+         for (double x : {-0.5, 0.1, 1., 4.9, 5.3, 12., 39.}) {
+            double expected = 0;
+            for (size_t i = 0; i < data.size(); ++i) {
+               const double w = adaptive ? weights[i] : fixedWeight;
+               if (w == 0)
+                  continue;
+               const double u = (x - data[i]) / w;
+               double k = 0;
+               if (TString(kernel) == "Gaussian")
+                  k = (u > -9 && u < 9) ? std::exp(-0.5 * u * u) / std::sqrt(2 * M_PI) : 0;
+               else if (TString(kernel) == "Epanechnikov")
+                  k = (u > -1 && u < 1) ? 0.75 * (1 - u * u) : 0;
+               else if (TString(kernel) == "Biweight")
+                  k = (u > -1 && u < 1) ? 15. / 16. * (1 - u * u) * (1 - u * u) : 0;
+               else
+                  k = (u > -1 && u < 1) ? M_PI_4 * std::cos(M_PI_2 * u) : 0;
+               expected += k / w;
+            }
+            expected /= data.size();
+            EXPECT_NEAR(kde(x), expected, 1.E-12 * std::max(expected, 1.)) << opt << " x = " << x;
+         }
+      }
+   }
+}
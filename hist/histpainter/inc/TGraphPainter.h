@@ -61,10 +61,16 @@ public:
    void           SetHighlight(TGraph *theGraph) override;
    void           Smooth(TGraph *theGraph, Int_t npoints, Double_t *x, Double_t *y, Int_t drawtype);
    static void    SetMaxPointsPerLine(Int_t maxp=50);
+   static void    SetLevelOfDetail(Int_t level=1);
+   static Int_t   GetLevelOfDetail();
+   static Bool_t  UseLevelOfDetail();
+   static Int_t   ReducePolyLine(Int_t n, Double_t *x, Double_t *y);
+   static Int_t   ReducePolyMarker(Int_t n, Double_t *x, Double_t *y);
 
 protected:
 
    static Int_t   fgMaxPointsPerLine;  ///< Number of points per chunks' line when drawing a graph.
+   static Int_t   fgLevelOfDetail;     ///< Level of detail reduction: 0 off, 1 on screen only, 2 always, -1 from gEnv.
 
    std::vector<Double_t> gxwork, gywork, gxworkl, gyworkl; ///< Internal buffers for coordinates. Used for graphs painting.
 
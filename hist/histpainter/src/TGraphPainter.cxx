@@ -36,12 +36,15 @@
 #include "TMarker.h"
 #include "TVirtualPadEditor.h"
 #include "TVirtualX.h"
+#include "TVirtualPS.h"
+#include "TEnv.h"
 #include "TRegexp.h"
 #include "strlcpy.h"
 #include "snprintf.h"
 #include <memory>
 
 Int_t TGraphPainter::fgMaxPointsPerLine = 50;
+Int_t TGraphPainter::fgLevelOfDetail    = -1;
 
 static Int_t    gHighlightPoint  = -1;         // highlight point of graph
 static TGraph  *gHighlightGraph  = nullptr;    // pointer to graph with highlight point
@@ -191,6 +194,15 @@ Begin_Macro(source)
 }
 End_Macro
 
+Graphs with many more points than the pad has pixels are reduced when painted on
+the screen: the lines keep the first, last, lowest and highest points of each
+pixel column and the markers keep one point per pixel, so that the picture is
+unchanged while a graph with millions of points stays fast to display. The same
+applies to histograms drawn with lines. The reduction is set with
+`TGraphPainter::SetLevelOfDetail(level)`: 0 disables it, 1 (default) applies it
+to the screen only and 2 also to the files produced with TPad::Print. The
+default can be changed with the rootrc variable `Hist.LevelOfDetail`.
+
 \anchor GrP2
 ### Exclusion graphs
 
@@ -1474,6 +1486,7 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
                }
                if (optionLine) {
                   if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npt, gyworkl.data(), gxworkl.data());
+                  else if (!optionFill) npt = ReducePolyLine(npt, gyworkl.data(), gxworkl.data());
                   gPad->PaintPolyLine(npt,gyworkl.data(),gxworkl.data());
                }
             } else {
@@ -1483,6 +1496,7 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
                }
                if (optionLine) {
                   if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npt, gxworkl.data(), gyworkl.data());
+                  else if (!optionFill) npt = ReducePolyLine(npt, gxworkl.data(), gyworkl.data());
                   gPad->PaintPolyLine(npt,gxworkl.data(),gyworkl.data());
                }
             }
@@ -1567,8 +1581,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
          npt++;
          if (i == npoints) {
             ComputeLogs(npt, optionZ);
-            if (optionR)  gPad->PaintPolyMarker(npt,gyworkl.data(),gxworkl.data());
-            else          gPad->PaintPolyMarker(npt,gxworkl.data(),gyworkl.data());
+            if (optionR)  gPad->PaintPolyMarker(ReducePolyMarker(npt,gyworkl.data(),gxworkl.data()),gyworkl.data(),gxworkl.data());
+            else          gPad->PaintPolyMarker(ReducePolyMarker(npt,gxworkl.data(),gyworkl.data()),gxworkl.data(),gyworkl.data());
             npt = 0;
          }
       }
@@ -1582,8 +1596,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
          npt++;
          if (i == npoints) {
             ComputeLogs(npt, optionZ);
-            if (optionR) gPad->PaintPolyMarker(npt,gyworkl.data(),gxworkl.data());
-            else         gPad->PaintPolyMarker(npt,gxworkl.data(),gyworkl.data());
+            if (optionR) gPad->PaintPolyMarker(ReducePolyMarker(npt,gyworkl.data(),gxworkl.data()),gyworkl.data(),gxworkl.data());
+            else         gPad->PaintPolyMarker(ReducePolyMarker(npt,gxworkl.data(),gyworkl.data()),gxworkl.data(),gyworkl.data());
             npt = 0;
          }
       }
@@ -2021,6 +2035,7 @@ void TGraphPainter::PaintGrapHist(TGraph *theGraph, Int_t npoints, const Double_
                   if (gxwork[nbpoints] < gPad->GetUxmax()) nbpoints++;
                }
 
+               nbpoints = ReducePolyLine(nbpoints, gxworkl.data() + point1, gyworkl.data() + point1);
                gPad->PaintPolyLine(nbpoints,gxworkl.data() + point1, gyworkl.data() + point1, noClip);
                continue;
             }
@@ -5288,3 +5303,115 @@ void TGraphPainter::SetMaxPointsPerLine(Int_t maxp)
    fgMaxPointsPerLine = maxp;
    if (maxp < 50) fgMaxPointsPerLine = 50;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to set the level of detail reduction applied when painting
+/// graphs and histograms with many more points or bins than pixels:
+///
+/// - 0: everything is painted.
+/// - 1: (default) the reduction is applied to the screen output only, files
+///      produced with TPad::Print get all the points.
+/// - 2: the reduction is also applied to the files.
+///
+/// The default can be changed with the rootrc variable `Hist.LevelOfDetail`.
+/// The lines of graphs and histograms keep the first, last, minimum and maximum
+/// points of each pixel column, the markers keep one point per pixel, and the
+/// COL/COLZ plots of 2D histograms merge the bins to the pixel resolution.
+
+void TGraphPainter::SetLevelOfDetail(Int_t level)
+{
+   fgLevelOfDetail = TMath::Max(0, TMath::Min(level, 2));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the level of detail reduction set by SetLevelOfDetail().
+
+Int_t TGraphPainter::GetLevelOfDetail()
+{
+   if (fgLevelOfDetail < 0)
+      SetLevelOfDetail(gEnv->GetValue("Hist.LevelOfDetail", 1));
+   return fgLevelOfDetail;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the level of detail reduction applies to the current output.
+
+Bool_t TGraphPainter::UseLevelOfDetail()
+{
+   if (!gPad)
+      return kFALSE;
+   Int_t level = GetLevelOfDetail();
+   return level == 2 || (level == 1 && !gVirtualPS);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce in place the polyline (x,y), given in pad coordinates, to at most
+/// four points per pixel column of gPad: the first, the lowest, the highest
+/// and the last of each run of consecutive points falling in the same column.
+/// The painted line is the same at the pad resolution. Returns the new number
+/// of points; nothing is done if the level of detail reduction does not apply
+/// or if there are not many more points than pixels.
+
+Int_t TGraphPainter::ReducePolyLine(Int_t n, Double_t *x, Double_t *y)
+{
+   if (!UseLevelOfDetail())
+      return n;
+   Int_t npx = TMath::Abs(gPad->XtoAbsPixel(gPad->GetX2()) - gPad->XtoAbsPixel(gPad->GetX1())) + 1;
+   if (n <= 4*npx)
+      return n;
+
+   Int_t nout = 0;
+   Int_t i = 0;
+   while (i < n) {
+      Int_t px = gPad->XtoAbsPixel(x[i]);
+      Int_t imin = i, imax = i, ifirst = i, ilast = i;
+      for (++i; i < n && gPad->XtoAbsPixel(x[i]) == px; ++i) {
+         if (y[i] < y[imin]) imin = i;
+         if (y[i] > y[imax]) imax = i;
+         ilast = i;
+      }
+      // the kept points are in their original order, and never behind nout
+      Int_t keep[4] = {ifirst, TMath::Min(imin, imax), TMath::Max(imin, imax), ilast};
+      for (Int_t k = 0; k < 4; k++) {
+         if (k > 0 && keep[k] == keep[k-1]) continue;
+         x[nout] = x[keep[k]];
+         y[nout] = y[keep[k]];
+         nout++;
+      }
+   }
+   return nout;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce in place the markers (x,y), given in pad coordinates, to one marker
+/// per pixel of gPad. The markers outside the pad are kept. Returns the new
+/// number of markers; nothing is done if the level of detail reduction does not
+/// apply or if there are not many more markers than pixel columns.
+
+Int_t TGraphPainter::ReducePolyMarker(Int_t n, Double_t *x, Double_t *y)
+{
+   if (!UseLevelOfDetail())
+      return n;
+   Int_t px1 = gPad->XtoAbsPixel(gPad->GetX1()), px2 = gPad->XtoAbsPixel(gPad->GetX2());
+   Int_t py1 = gPad->YtoAbsPixel(gPad->GetY2()), py2 = gPad->YtoAbsPixel(gPad->GetY1());
+   Int_t npx = TMath::Abs(px2 - px1) + 1, npy = TMath::Abs(py2 - py1) + 1;
+   if (n <= 4*npx)
+      return n;
+
+   Int_t pxmin = TMath::Min(px1, px2), pymin = TMath::Min(py1, py2);
+   std::vector<bool> used(static_cast<size_t>(npx)*npy, false);
+   Int_t nout = 0;
+   for (Int_t i = 0; i < n; i++) {
+      Int_t ix = gPad->XtoAbsPixel(x[i]) - pxmin;
+      Int_t iy = gPad->YtoAbsPixel(y[i]) - pymin;
+      if (ix >= 0 && ix < npx && iy >= 0 && iy < npy) {
+         size_t pixel = static_cast<size_t>(iy)*npx + ix;
+         if (used[pixel]) continue;
+         used[pixel] = true;
+      }
+      x[nout] = x[i];
+      y[nout] = y[i];
+      nout++;
+   }
+   return nout;
+}
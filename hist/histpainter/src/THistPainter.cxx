@@ -47,6 +47,7 @@
 #include "TPainter3dAlgorithms.h"
 #include "TGraph2D.h"
 #include "TGraph2DPainter.h"
+#include "TGraphPainter.h"
 #include "TGraphDelaunay2D.h"
 #include "TView.h"
 #include "TMath.h"
@@ -1204,6 +1205,13 @@ COL2 option renders the histogram as a bitmap. Therefore it cannot be saved in v
 graphics file format like PostScript or PDF (an empty image will be generated). It can
 be saved only in bitmap files like PNG format for instance.
 
+When a 2D histogram has more bins than the frame has pixels, the COL and COLZ
+options merge the bins on the screen: each painted box covers a group of bins
+and gets the color of the largest content of the group. This level of detail
+reduction is controlled by TGraphPainter::SetLevelOfDetail() and the rootrc
+variable `Hist.LevelOfDetail`; by default it is not applied to the files
+produced with TPad::Print.
+
 
 \anchor HP140
 ### The CANDLE and VIOLIN options
@@ -5828,31 +5836,52 @@ void THistPainter::PaintColorLevels(Option_t*)
    if (!fH->TestBit(TH1::kUserContour)) fH->SetContour(ndiv);
    Double_t scale = (dz ? ndivz / dz : 1.0);
 
+   // Level of detail: when there are more bins than pixels, groups of mergeX x mergeY
+   // bins are painted as one box with the largest content of the group.
+   Int_t mergeX = 1, mergeY = 1;
+   if (Hoption.System == kCARTESIAN && TGraphPainter::UseLevelOfDetail()) {
+      Int_t npx = TMath::Abs(gPad->XtoAbsPixel(gPad->GetUxmax()) - gPad->XtoAbsPixel(gPad->GetUxmin()));
+      Int_t npy = TMath::Abs(gPad->YtoAbsPixel(gPad->GetUymax()) - gPad->YtoAbsPixel(gPad->GetUymin()));
+      if (npx > 0) mergeX = TMath::Max(1, (Hparam.xlast - Hparam.xfirst + 1)/npx);
+      if (npy > 0) mergeY = TMath::Max(1, (Hparam.ylast - Hparam.yfirst + 1)/npy);
+   }
+
    Int_t color;
    TProfile2D* prof2d = dynamic_cast<TProfile2D*>(fH);
-   for (Int_t j=Hparam.yfirst; j<=Hparam.ylast;j++) {
+   for (Int_t j=Hparam.yfirst; j<=Hparam.ylast;j+=mergeY) {
+      Int_t jlast = TMath::Min(j+mergeY-1, Hparam.ylast);
       yk    = fYaxis->GetBinLowEdge(j);
-      ystep = fYaxis->GetBinWidth(j);
-      for (Int_t i=Hparam.xfirst; i<=Hparam.xlast;i++) {
-         Int_t bin  = j*(fXaxis->GetNbins()+2) + i;
+      ystep = fYaxis->GetBinUpEdge(jlast) - yk;
+      for (Int_t i=Hparam.xfirst; i<=Hparam.xlast;i+=mergeX) {
+         Int_t ilast = TMath::Min(i+mergeX-1, Hparam.xlast);
          xk    = fXaxis->GetBinLowEdge(i);
-         xstep = fXaxis->GetBinWidth(i);
+         xstep = fXaxis->GetBinUpEdge(ilast) - xk;
          if (Hoption.System == kPOLAR && xk<0) xk= 2*TMath::Pi()+xk;
          if (!IsInside(xk+0.5*xstep,yk+0.5*ystep)) continue;
-         z     = fH->GetBinContent(bin);
-         // if fH is a profile histogram do not draw empty bins
-         if (prof2d) {
-            const Double_t binEntries = prof2d->GetBinEntries(bin);
-            if (binEntries == 0)
-               continue;
-         } else {
-            // don't draw the empty bins for non-profile histograms
-            // with positive content
-            if (z == 0) {
-               if (zmin >= 0 || Hoption.Logz) continue;
-               if (Hoption.Color == 2) continue;
+         Bool_t filled = kFALSE;
+         z = 0;
+         for (Int_t jb=j; jb<=jlast; jb++) {
+            for (Int_t ib=i; ib<=ilast; ib++) {
+               Int_t bin = jb*(fXaxis->GetNbins()+2) + ib;
+               Double_t zb = fH->GetBinContent(bin);
+               // if fH is a profile histogram do not draw empty bins
+               if (prof2d) {
+                  const Double_t binEntries = prof2d->GetBinEntries(bin);
+                  if (binEntries == 0)
+                     continue;
+               } else {
+                  // don't draw the empty bins for non-profile histograms
+                  // with positive content
+                  if (zb == 0) {
+                     if (zmin >= 0 || Hoption.Logz) continue;
+                     if (Hoption.Color == 2) continue;
+                  }
+               }
+               if (!filled || zb > z) z = zb;
+               filled = kTRUE;
             }
          }
+         if (!filled) continue;
 
          if (Hoption.Logz) {
             if (z > 0) z = TMath::Log10(z);
@@ -458,6 +458,17 @@ public:
       return AdjustOverflowBinNumber(rawbin);
    }
 
+   /// Find the bin index for the given coordinate if it is within a regular
+   /// bin, otherwise return `kInvalidBin`. Unlike `FindBin()` this does not
+   /// need the (virtual) under- and overflow handling and can be inlined.
+   int FindRegularBin(double x) const noexcept
+   {
+      const double rawbin = FindBinRaw(x) + 1;
+      if (!(rawbin >= 1 && rawbin < fNBinsNoOver + 1))
+         return kInvalidBin;
+      return (int)rawbin;
+   }
+
    /// This axis cannot grow.
    bool CanGrow() const noexcept override { return false; }
 
@@ -686,6 +697,16 @@ public:
       return rawbin;
    }
 
+   /// Find the bin index for the given coordinate if it is within a regular
+   /// bin, otherwise return `kInvalidBin`. Unlike `FindBin()` this can be inlined.
+   int FindRegularBin(double x) const noexcept
+   {
+      const int rawbin = FindBinRaw(x);
+      if (rawbin < 1 || rawbin >= (int)fBinBorders.size())
+         return kInvalidBin;
+      return rawbin;
+   }
+
    /// Get the bin center of the bin with the given index.
    /// The result of this method on an overflow or underflow bin is unspecified.
    double GetBinCenter(int bin) const final { return 0.5 * (fBinBorders[bin - 1] + fBinBorders[bin]); }
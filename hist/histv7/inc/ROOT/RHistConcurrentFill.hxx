@@ -18,8 +18,12 @@
 
 #include "ROOT/RSpan.hxx"
 #include "ROOT/RHistBufferedFill.hxx"
+#include "ROOT/RHistUtils.hxx"
+#include "ROOT/RLogger.hxx"
 
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -27,21 +31,36 @@ namespace Experimental {
 template <class HIST, int SIZE>
 class RHistConcurrentFillManager;
 
+/// How the RHistConcurrentFiller objects of a RHistConcurrentFillManager fill the histogram.
+enum class EHistConcurrentFillMode {
+   /// The buffers of the fillers are filled into the histogram, under a lock shared by all fillers.
+   kBuffered,
+   /// Each filler fills its buffers into its own partial histogram, without any lock. The partial
+   /// histograms are added to the histogram by RHistConcurrentFillManager::Merge().
+   kPerThread
+};
+
 /**
  \class RHistConcurrentFiller
  Buffers a thread's Fill calls and submits them to the
- RHistConcurrentFillManager. Enables multi-threaded filling.
+ RHistConcurrentFillManager, or to the filler's own partial histogram if the
+ manager is in EHistConcurrentFillMode::kPerThread mode. Enables multi-threaded
+ filling.
  **/
 
 template <class HIST, int SIZE>
 class RHistConcurrentFiller: public Internal::RHistBufferedFillBase<RHistConcurrentFiller<HIST, SIZE>, HIST, SIZE> {
    RHistConcurrentFillManager<HIST, SIZE> &fManager;
+   HIST *fPartial; ///< The histogram filled by this filler only, nullptr to fill through the manager
 
 public:
    using CoordArray_t = typename HIST::CoordArray_t;
    using Weight_t = typename HIST::Weight_t;
 
-   RHistConcurrentFiller(RHistConcurrentFillManager<HIST, SIZE> &manager): fManager(manager) {}
+   RHistConcurrentFiller(RHistConcurrentFillManager<HIST, SIZE> &manager, HIST *partial = nullptr)
+      : fManager(manager), fPartial(partial)
+   {
+   }
 
    /// Thread-specific HIST::Fill().
    using Internal::RHistBufferedFillBase<RHistConcurrentFiller<HIST, SIZE>, HIST, SIZE>::Fill;
@@ -49,17 +68,26 @@ public:
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
    {
-      fManager.FillN(xN, weightN);
+      if (fPartial)
+         fPartial->FillN(xN, weightN);
+      else
+         fManager.FillN(xN, weightN);
    }
 
    /// Thread-specific HIST::FillN().
-   void FillN(const std::span<const CoordArray_t> xN) { fManager.FillN(xN); }
+   void FillN(const std::span<const CoordArray_t> xN)
+   {
+      if (fPartial)
+         fPartial->FillN(xN);
+      else
+         fManager.FillN(xN);
+   }
 
    static constexpr int GetNDim() { return HIST::GetNDim(); }
 
 private:
    friend class Internal::RHistBufferedFillBase<RHistConcurrentFiller<HIST, SIZE>, HIST, SIZE>;
-   void FlushImpl() { fManager.FillN(this->GetCoords(), this->GetWeights()); }
+   void FlushImpl() { FillN(this->GetCoords(), this->GetWeights()); }
 };
 
 /**
@@ -71,6 +99,23 @@ private:
  buffer calls to Fill() until the buffer is full, and then swap the buffer
  with that of the RHistConcurrentFillManager. The manager than fills the
  histogram.
+
+ With many threads filling the same histogram, they spend most of their time
+ waiting for that lock. In EHistConcurrentFillMode::kPerThread mode, each filler
+ instead fills a partial histogram of its own, with the same axes as the
+ histogram; the partial histograms are added to the histogram by Merge(), which
+ is also called when the manager is destroyed. Merge() must not be called while
+ fillers are filling, and the fillers must have been flushed (or destroyed)
+ before it for their buffered entries to be included. Only histograms without
+ growable axes can be filled this way: the partial histograms must keep the
+ binning of the histogram.
+
+     RHistConcurrentFillManager<RH2D> fillMgr(hist, EHistConcurrentFillMode::kPerThread);
+     for (auto &thr : threads)
+        thr = std::thread(fill, fillMgr.MakeFiller()); // each filler has its own partial histogram
+     for (auto &thr : threads)
+        thr.join();
+     fillMgr.Merge(); // hist now contains the entries of all threads
  **/
 
 template <class HIST, int SIZE = 1024>
@@ -84,12 +129,60 @@ public:
 
 private:
    HIST &fHist;
+   EHistConcurrentFillMode fMode;
    std::mutex fFillMutex; // should become a spin lock
+   std::vector<std::unique_ptr<HIST>> fPartials; ///< The partial histograms of the fillers, in kPerThread mode
+
+   /// Reset the statistics of `hist`, keeping its axes.
+   static void ResetStat(HIST &hist)
+   {
+      auto &impl = *hist.GetImpl();
+      impl.GetStat() = typename std::remove_reference_t<decltype(impl)>::Stat_t(impl.GetNBinsNoOver(),
+                                                                                    impl.GetNOverflowBins());
+   }
 
 public:
-   RHistConcurrentFillManager(HIST &hist): fHist(hist) {}
+   RHistConcurrentFillManager(HIST &hist, EHistConcurrentFillMode mode = EHistConcurrentFillMode::kBuffered)
+      : fHist(hist), fMode(mode)
+   {
+      if (fMode != EHistConcurrentFillMode::kPerThread)
+         return;
+      for (int iAxis = 0; iAxis < HIST::GetNDim(); ++iAxis) {
+         if (fHist.GetImpl()->GetAxis(iAxis).CanGrow()) {
+            R__LOG_WARNING(HistLog()) << "A histogram with a growable axis cannot be filled with per-thread "
+                                         "partial histograms, its fillers are buffered.";
+            fMode = EHistConcurrentFillMode::kBuffered;
+            break;
+         }
+      }
+   }
+
+   ~RHistConcurrentFillManager() { Merge(); }
+
+   EHistConcurrentFillMode GetMode() const { return fMode; }
 
-   RHistConcurrentFiller<HIST, SIZE> MakeFiller() { return RHistConcurrentFiller<HIST, SIZE>{*this}; }
+   RHistConcurrentFiller<HIST, SIZE> MakeFiller()
+   {
+      if (fMode != EHistConcurrentFillMode::kPerThread)
+         return RHistConcurrentFiller<HIST, SIZE>{*this};
+
+      auto partial = std::make_unique<HIST>(fHist);
+      ResetStat(*partial);
+      std::lock_guard<std::mutex> lockGuard(fFillMutex);
+      fPartials.emplace_back(std::move(partial));
+      return RHistConcurrentFiller<HIST, SIZE>{*this, fPartials.back().get()};
+   }
+
+   /// Add the partial histograms of the fillers to the histogram, and reset them. Only needed in
+   /// EHistConcurrentFillMode::kPerThread mode; the fillers can continue filling afterwards.
+   void Merge()
+   {
+      std::lock_guard<std::mutex> lockGuard(fFillMutex);
+      for (auto &partial : fPartials) {
+         Add(fHist, *partial);
+         ResetStat(*partial);
+      }
+   }
 
    /// Thread-specific HIST::FillN().
    void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
@@ -680,6 +680,36 @@ struct RFindLocalBins {
    }
 };
 
+/// Find the global bin index of a set of coordinates that are within the regular
+/// bins of all axes, or `kInvalidBin` if any of them is in an under- or overflow
+/// bin. Only calls non-virtual functions of the concrete axis types, such that
+/// the computation is inlined for the axis types known at compile time.
+template <int I, int NDIMS, typename COORD, class AXES>
+struct RFindRegularGlobalBin;
+
+template <int NDIMS, typename COORD, class AXES>
+struct RFindRegularGlobalBin<-1, NDIMS, COORD, AXES> {
+   int operator()(int globalBin, const AXES & /*axes*/, const COORD & /*coords*/, int /*binSize*/) const
+   {
+      return globalBin + 1;
+   }
+};
+
+template <int I, int NDIMS, typename COORD, class AXES>
+struct RFindRegularGlobalBin {
+   int operator()(int globalBin, const AXES &axes, const COORD &coords, int binSize) const
+   {
+      constexpr const int thisAxis = NDIMS - I - 1;
+      const auto &axis = std::get<thisAxis>(axes);
+      const int localBin = axis.FindRegularBin(coords[thisAxis]);
+      if (localBin == RAxisBase::kInvalidBin)
+         return RAxisBase::kInvalidBin;
+      globalBin += (localBin - 1) * binSize;
+      binSize *= axis.GetNBinsNoOver();
+      return RFindRegularGlobalBin<I - 1, NDIMS, COORD, AXES>()(globalBin, axes, coords, binSize);
+   }
+};
+
 /// Recursively converts local axis bins from the standard `kUnderflowBin`/`kOverflowBin` for
 /// under/overflow bin indexing convention, to the corresponding bin coordinates.
 template <int I, int NDIMS, typename BINS, typename COORD, class AXES>
@@ -972,11 +1002,23 @@ public:
       return VirtualBinsToLocalBins<NDIMS>(virtual_bins);
    }
 
+   /// Get the bin index for the given coordinates `x` if they are within the
+   /// regular bins of all axes, otherwise return `RAxisBase::kInvalidBin`.
+   /// This is the fast path of `GetBinIndex()`: it is computed in one pass over
+   /// the concrete axis types, without virtual calls.
+   int GetRegularBinIndex(const CoordArray_t &x) const
+   {
+      return Internal::RFindRegularGlobalBin<DATA::GetNDim() - 1, DATA::GetNDim(), CoordArray_t, decltype(fAxes)>()(0, fAxes, x, 1);
+   }
+
    /// Get the bin index for the given coordinates `x`. The use of `RFindLocalBins`
    /// allows to convert the coordinates to local per-axis bin indices before using
    /// `ComputeGlobalBin()`.
    int GetBinIndex(const CoordArray_t &x) const final
    {
+      const int regularBin = GetRegularBinIndex(x);
+      if (regularBin != RAxisBase::kInvalidBin)
+         return regularBin;
       BinArray_t localBins = {};
       Internal::RFindLocalBins<DATA::GetNDim() - 1, DATA::GetNDim(), BinArray_t, CoordArray_t, decltype(fAxes)>()(localBins, fAxes, x);
       int result = ComputeGlobalBin<DATA::GetNDim()>(localBins);
@@ -990,6 +1032,9 @@ public:
    /// TODO: implement growable behavior
    int GetBinIndexAndGrow(const CoordArray_t &x) const final
    {
+      const int regularBin = GetRegularBinIndex(x);
+      if (regularBin != RAxisBase::kInvalidBin)
+         return regularBin;
       Internal::EFindStatus status = Internal::EFindStatus::kCanGrow;
       int ret = 0;
       BinArray_t localBins = {};
@@ -0,0 +1,82 @@
+/// \file concurrentfillspeedtest.cxx
+///
+/// Compares the modes of RHistConcurrentFillManager: threads filling the same
+/// few histograms through buffers flushed under a lock, or into per-thread
+/// partial histograms merged at the end.
+///
+///     g++ -o concurrentfillspeedtest concurrentfillspeedtest.cxx `root-config --cflags --libs` -O3
+///     ./concurrentfillspeedtest [nthreads] [nfills per thread]
+///
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+#include "ROOT/RHist.hxx"
+#include "ROOT/RHistConcurrentFill.hxx"
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ROOT;
+
+constexpr int gNHists = 4;
+
+using Manager_t = Experimental::RHistConcurrentFillManager<Experimental::RH2D>;
+using Filler_t = Experimental::RHistConcurrentFiller<Experimental::RH2D, 1024>;
+
+void FillConcurrently(Experimental::EHistConcurrentFillMode mode, int nthreads, long nfills, const char *title)
+{
+   std::vector<Experimental::RH2D> hists;
+   for (int i = 0; i < gNHists; ++i)
+      hists.emplace_back(Experimental::RAxisConfig{100, 0., 1.}, Experimental::RAxisConfig{{0., 0.1, 0.3, 0.6, 1.}});
+
+   auto start = std::chrono::high_resolution_clock::now();
+   {
+      std::vector<std::unique_ptr<Manager_t>> managers;
+      for (auto &hist : hists)
+         managers.emplace_back(std::make_unique<Manager_t>(hist, mode));
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < nthreads; ++t) {
+         std::vector<Filler_t> fillers;
+         for (auto &manager : managers)
+            fillers.emplace_back(manager->MakeFiller());
+         threads.emplace_back(
+            [nfills, t](std::vector<Filler_t> threadFillers) {
+               std::mt19937 gen(t);
+               std::uniform_real_distribution<double> uniform;
+               for (long i = 0; i < nfills; ++i) {
+                  for (auto &filler : threadFillers)
+                     filler.Fill({uniform(gen), uniform(gen)});
+               }
+            },
+            std::move(fillers));
+      }
+      for (auto &thr : threads)
+         thr.join();
+      // the managers merge the partial histograms when destroyed
+   }
+   std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+
+   const double nentries = (double)nthreads * nfills * gNHists;
+   std::cout << nthreads << " threads * " << title << ": " << elapsed.count() << " seconds, \t"
+             << nentries / 1e6 / elapsed.count() << " millions per seconds\n";
+   for (auto &hist : hists) {
+      if (hist.GetEntries() != (int64_t)nthreads * nfills)
+         std::cerr << "  wrong number of entries: " << hist.GetEntries() << '\n';
+   }
+}
+
+int main(int argc, char **argv)
+{
+   int nthreads = argc > 1 ? std::atoi(argv[1]) : (int)std::thread::hardware_concurrency();
+   long nfills = argc > 2 ? std::atol(argv[2]) : 10000000;
+
+   FillConcurrently(Experimental::EHistConcurrentFillMode::kBuffered, nthreads, nfills, "fills (buffered)  ");
+   FillConcurrently(Experimental::EHistConcurrentFillMode::kPerThread, nthreads, nfills, "fills (per thread)");
+   return 0;
+}
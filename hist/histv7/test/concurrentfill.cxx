@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include "ROOT/RHist.hxx"
 #include "ROOT/RHistConcurrentFill.hxx"
+#include "ROOT/RLogger.hxx"
 
 #include <iostream>
 #include <future>
@@ -143,3 +144,48 @@ TEST(ConcurrentFillTest, FillFlush)
    EXPECT_EQ(0, (int)Filler_1.GetCoords().size());
    EXPECT_EQ(0, (int)Filler_2.GetCoords().size());
 }
+
+// Test filling with per-thread partial histograms
+TEST(ConcurrentFillTest, PerThread)
+{
+   Experimental::RH2D hist{{100, 0., 1.}, {{0., 1., 2., 3., 10.}}};
+   hist.Fill({0.42, 4.2});
+
+   {
+      Experimental::RHistConcurrentFillManager<Experimental::RH2D> fillMgr(
+         hist, Experimental::EHistConcurrentFillMode::kPerThread);
+      EXPECT_EQ(Experimental::EHistConcurrentFillMode::kPerThread, fillMgr.GetMode());
+
+      std::array<std::thread, 4> threads;
+      for (auto &thr : threads)
+         thr = std::thread(fillWithWeights, fillMgr.MakeFiller());
+      for (auto &thr : threads)
+         thr.join();
+
+      // the threads filled their partial histograms only
+      EXPECT_EQ(1, hist.GetEntries());
+      fillMgr.Merge();
+      EXPECT_EQ(1 + 4 * 3000, hist.GetEntries());
+      EXPECT_FLOAT_EQ(1.f + 4 * 42.f, hist.GetBinContent({(double)42 / 100, (double)42 / 10}));
+
+      // merging again does not add the partial histograms twice
+      Filler_t filler = fillMgr.MakeFiller();
+      filler.Fill({0.42, 4.2}, 2.f);
+      filler.Flush();
+      fillMgr.Merge();
+      EXPECT_EQ(2 + 4 * 3000, hist.GetEntries());
+      EXPECT_FLOAT_EQ(3.f + 4 * 42.f, hist.GetBinContent({(double)42 / 100, (double)42 / 10}));
+   }
+   EXPECT_EQ(2 + 4 * 3000, hist.GetEntries());
+}
+
+// Histograms with growable axes are always filled through the buffers
+TEST(ConcurrentFillTest, PerThreadGrowable)
+{
+   Experimental::RH1D hist(Experimental::RAxisConfig(Experimental::RAxisConfig::Grow, 10, 0., 1.));
+   Experimental::RLogScopedDiagCount diagCount;
+   Experimental::RHistConcurrentFillManager<Experimental::RH1D> fillMgr(
+      hist, Experimental::EHistConcurrentFillMode::kPerThread);
+   EXPECT_EQ(Experimental::EHistConcurrentFillMode::kBuffered, fillMgr.GetMode());
+   EXPECT_EQ(1, diagCount.GetAccumulatedWarnings());
+}
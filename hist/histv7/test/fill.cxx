@@ -629,3 +629,25 @@ TEST(HistFillTest, FillN3DCoordsWeightsUncertainty)
    EXPECT_FLOAT_EQ(std::sqrt(weight2 * weight2), hist.GetBinUncertainty({0.2222, 4.33, 7.11}));
    EXPECT_FLOAT_EQ(std::sqrt((weight3 * weight3) + (weight2 * weight2)), hist.GetBinUncertainty({0.3333, 4.11, 7.22}));
 }
+
+// Test that the bin index of regular bins, computed without virtual calls on the axes, agrees with the one
+// computed from the per-axis bins, including under- and overflow
+TEST(HistFillTest, RegularBinIndex)
+{
+   ROOT::Experimental::RH2F hist({10, 0., 1.}, {{0., 0.1, 0.5, 1., 4.}});
+   auto impl = hist.GetImpl();
+   for (double x = -0.25; x < 1.3; x += 0.0625) {
+      for (double y = -0.5; y < 4.6; y += 0.125) {
+         const int expected =
+            impl->GetBinIndexFromLocalBins({impl->GetAxis(0).FindBin(x), impl->GetAxis(1).FindBin(y)});
+         EXPECT_EQ(expected, impl->GetBinIndex({x, y})) << "x=" << x << " y=" << y;
+      }
+   }
+
+   hist.FillN({{0.05, 0.05}, {0.95, 3.5}, {1.5, 0.2}, {0.5, -1.}});
+   EXPECT_FLOAT_EQ(1.f, hist.GetBinContent({0.05, 0.05}));
+   EXPECT_FLOAT_EQ(1.f, hist.GetBinContent({0.95, 3.5}));
+   EXPECT_FLOAT_EQ(1.f, hist.GetBinContent({1.5, 0.2}));
+   EXPECT_FLOAT_EQ(1.f, hist.GetBinContent({0.5, -1.}));
+   EXPECT_EQ(4, hist.GetEntries());
+}
@@ -13,6 +13,9 @@
 
 #include "TNamed.h"
 
+#include <memory>
+#include <vector>
+
 class TH1;
 
 class TSpectrum : public TNamed {
@@ -74,6 +77,7 @@ public:
 
    static Int_t        StaticSearch(const TH1 *hist, Double_t sigma=2, Option_t *option="goff", Double_t threshold=0.05);
    static TH1         *StaticBackground(const TH1 *hist,Int_t niter=20, Option_t *option="");
+   static std::vector<std::unique_ptr<TSpectrum>> SearchBatch(const std::vector<const TH1 *> &hists, Double_t sigma=2, Option_t *option="", Double_t threshold=0.05, Int_t maxpositions=100);
 
    ClassDefOverride(TSpectrum,3)  //Peak Finder, background estimator, Deconvolution
 };
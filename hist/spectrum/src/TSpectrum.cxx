@@ -7,8 +7,11 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TSpectrumParallel.h"
 #include "snprintf.h"
 
+#include <algorithm>
+
 /** \class TSpectrum
     \ingroup Spectrum
     \brief Advanced Spectra Processing
@@ -2425,14 +2428,11 @@ Int_t TSpectrum::SearchHighRes(Double_t *source,Double_t *destVector, int ssize,
    imin = -i,imax = size_ext + i - 1;
    for(i = imin; i <= imax; i++){
       lda = 0;
-      for(j = 0; j <= (lh_gold - 1); j++){
-         ldb = working_space[j];
-         k = i + j;
-         if(k >= 0 && k < size_ext){
-            ldc = working_space[2 * size_ext + k];
-            lda = lda + ldb * ldc;
-         }
-
+      // the terms outside of the source vector are skipped
+      jmin = std::max(0, -i);
+      jmax = std::min(lh_gold - 1, size_ext - 1 - i);
+      for(j = jmin; j <= jmax; j++){
+         lda = lda + working_space[j] * working_space[2 * size_ext + i + j];
       }
       working_space[4 * size_ext + i - imin] = lda;
    }
@@ -2444,35 +2444,27 @@ Int_t TSpectrum::SearchHighRes(Double_t *source,Double_t *destVector, int ssize,
       working_space[i] = 1;
 //START OF ITERATIONS
    for(lindex = 0; lindex < deconIterations; lindex++){
-      for(i = 0; i < size_ext; i++){
-         if(TMath::Abs(working_space[2 * size_ext + i]) > 0.00001 && TMath::Abs(working_space[i]) > 0.00001){
-            lda=0;
-            jmin = lh_gold - 1;
-            if(jmin > i)
-               jmin = i;
-
-            jmin = -jmin;
-            jmax = lh_gold - 1;
-            if(jmax > (size_ext - 1 - i))
-               jmax=size_ext-1-i;
-
-            for(j = jmin; j <= jmax; j++){
-               ldb = working_space[j + lh_gold - 1 + size_ext];
-               ldc = working_space[i + j];
-               lda = lda + ldb * ldc;
-            }
-            ldb = working_space[2 * size_ext + i];
-            if(lda != 0)
-               lda = ldb / lda;
+      // the channels are independent and may be split between threads
+      ROOT::Internal::SpectrumForeachRange(size_ext, Long64_t(size_ext) * (2 * lh_gold - 1), [&](Int_t first, Int_t last) {
+         for(Int_t ii = first; ii < last; ii++){
+            if(TMath::Abs(working_space[2 * size_ext + ii]) > 0.00001 && TMath::Abs(working_space[ii]) > 0.00001){
+               Double_t sum = 0;
+               const Int_t jjmin = -std::min(lh_gold - 1, ii);
+               const Int_t jjmax = std::min(lh_gold - 1, size_ext - 1 - ii);
+               for(Int_t jj = jjmin; jj <= jjmax; jj++){
+                  sum = sum + working_space[jj + lh_gold - 1 + size_ext] * working_space[ii + jj];
+               }
+               Double_t ratio = working_space[2 * size_ext + ii];
+               if(sum != 0)
+                  ratio = ratio / sum;
 
-            else
-               lda = 0;
+               else
+                  ratio = 0;
 
-            ldb = working_space[i];
-            lda = lda * ldb;
-            working_space[3 * size_ext + i] = lda;
+               working_space[3 * size_ext + ii] = ratio * working_space[ii];
+            }
          }
-      }
+      });
       for(i = 0; i < size_ext; i++){
          working_space[i] = working_space[3 * size_ext + i];
       }
@@ -2592,3 +2584,44 @@ TH1 *TSpectrum::StaticBackground(const TH1 *hist,Int_t niter, Option_t *option)
    TSpectrum s;
    return s.Background(hist,niter,option);
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Search for peaks in a batch of one-dimensional histograms, e.g. in the
+/// spectra of all the channels of a detector.
+///
+/// Every histogram is searched by its own TSpectrum with space for
+/// maxpositions peaks, as with Search(hist, sigma, option, threshold). The
+/// histograms are searched in parallel if implicit multi-threading is enabled.
+/// The option "goff" is always added, i.e. no polymarker is added to the
+/// histograms and nothing is drawn.
+///
+/// Returns one TSpectrum per histogram, in the same order, with the positions
+/// of the peaks found. The entry for a null histogram has no peaks.
+
+std::vector<std::unique_ptr<TSpectrum>> TSpectrum::SearchBatch(const std::vector<const TH1 *> &hists, Double_t sigma,
+                                                               Option_t *option, Double_t threshold,
+                                                               Int_t maxpositions)
+{
+   TString opt = option;
+   opt += " goff";
+   const Int_t n = hists.size();
+   std::vector<std::unique_ptr<TSpectrum>> result(n);
+
+   // approximate number of operations of the background clipping and of the
+   // deconvolution iterations
+   const Double_t width = 7 * std::max(sigma, 1.);
+   Long64_t work = 0;
+   for (const TH1 *h : hists) {
+      if (h)
+         work += Long64_t((h->GetNbinsX() + 2 * width) * width * (1 + 2 * fgIterations));
+   }
+
+   ROOT::Internal::SpectrumForeachRange(n, work, [&](Int_t first, Int_t last) {
+      for (Int_t i = first; i < last; i++) {
+         result[i] = std::make_unique<TSpectrum>(maxpositions);
+         if (hists[i])
+            result[i]->Search(hists[i], sigma, opt.Data(), threshold);
+      }
+   });
+   return result;
+}
@@ -46,6 +46,11 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TSpectrumParallel.h"
+
+#include <algorithm>
+#include <vector>
+
 #define PEAK_WINDOW 1024
 
 Int_t TSpectrum2::fgIterations    = 3;
@@ -1102,7 +1107,7 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
    Double_t nom, nip, nim, sp, sm, spx, spy, smx, smy;
    Double_t p1, p2, p3, p4, s1, s2, s3, s4;
    Int_t x, y;
-   Int_t lhx, lhy, i1, i2, j1, j2, k1, k2, i1min, i1max, i2min, i2max, j1min, j1max, j2min, j2max, positx, posity;
+   Int_t lhx, lhy, i1, i2, j1, j2, i1min, i1max, i2min, i2max, j1min, j1max, j2min, j2max, positx, posity;
    if (sigma < 1) {
       Error("SearchHighRes", "Invalid sigma, must be greater than or equal to 1");
       return 0;
@@ -1532,23 +1537,27 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
 
    i2min = -j,i2max = ssizey_ext + j - 1;
    i1min = -i,i1max = ssizex_ext + i - 1;
-   for(i2 = i2min; i2 <= i2max; i2++){
-      for(i1=i1min;i1<=i1max;i1++){
-         ldc=0;
-         for(j2 = 0; j2 <= (lhy - 1); j2++){
-            for(j1 = 0; j1 <= (lhx - 1); j1++){
-               k2 = i2 + j2,k1 = i1 + j1;
-               if(k2 >= 0 && k2 < ssizey_ext && k1 >= 0 && k1 < ssizex_ext){
-                  lda = working_space[j1][j2];
-                  ldb = working_space[k1][k2 + 14 * ssizey_ext];
-                  ldc = ldc + lda * ldb;
+   // the sums skip the terms outside of the source matrix, the channels i1
+   // are independent and may be split between threads
+   ROOT::Internal::SpectrumForeachRange(i1max - i1min + 1,
+      Long64_t(i1max - i1min + 1) * (i2max - i2min + 1) * lhx * lhy, [&](Int_t first, Int_t last) {
+      for(Int_t ii2 = i2min; ii2 <= i2max; ii2++){
+         const Int_t jj2min = std::max(0, -ii2);
+         const Int_t jj2max = std::min(lhy - 1, ssizey_ext - 1 - ii2);
+         for(Int_t ii1 = i1min + first; ii1 < i1min + last; ii1++){
+            const Int_t jj1min = std::max(0, -ii1);
+            const Int_t jj1max = std::min(lhx - 1, ssizex_ext - 1 - ii1);
+            Double_t sum = 0;
+            for(Int_t jj2 = jj2min; jj2 <= jj2max; jj2++){
+               for(Int_t jj1 = jj1min; jj1 <= jj1max; jj1++){
+                  sum = sum + working_space[jj1][jj2] * working_space[ii1 + jj1][ii2 + jj2 + 14 * ssizey_ext];
                }
             }
+            const Int_t kk = (ii1 + ssizex_ext) / ssizex_ext;
+            working_space[(ii1 + ssizex_ext) % ssizex_ext][ii2 + ssizey_ext + ssizey_ext + kk * 3 * ssizey_ext] = sum;
          }
-         k = (i1 + ssizex_ext) / ssizex_ext;
-         working_space[(i1 + ssizex_ext) % ssizex_ext][i2 + ssizey_ext + ssizey_ext + k * 3 * ssizey_ext] = ldc;
       }
-   }
+   });
    //move matrix p
    for(i2 = 0; i2 < ssizey_ext; i2++){
       for(i1 = 0; i1 < ssizex_ext; i1++){
@@ -1566,50 +1575,41 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
    }
    //START OF ITERATIONS
    for(lindex = 0; lindex < deconIterations; lindex++){
-      for(i2 = 0; i2 < ssizey_ext; i2++){
-         for(i1 = 0; i1 < ssizex_ext; i1++){
-            lda = working_space[i1][i2 + ssizey_ext];
-            ldc = working_space[i1][i2 + 14 * ssizey_ext];
-            if(lda > 0.000001 && ldc > 0.000001){
-               ldb=0;
-               j2min=i2;
-               if(j2min > lhy - 1)
-                  j2min = lhy - 1;
-
-               j2min = -j2min;
-               j2max = ssizey_ext - i2 - 1;
-               if(j2max > lhy - 1)
-                  j2max = lhy - 1;
-
-               j1min = i1;
-               if(j1min > lhx - 1)
-                  j1min = lhx - 1;
-
-               j1min = -j1min;
-               j1max = ssizex_ext - i1 - 1;
-               if(j1max > lhx - 1)
-                  j1max = lhx - 1;
-
-               for(j2 = j2min; j2 <= j2max; j2++){
-                  for(j1 = j1min; j1 <= j1max; j1++){
-                     k = (j1 + ssizex_ext) / ssizex_ext;
-                     ldc = working_space[(j1 + ssizex_ext) % ssizex_ext][j2 + ssizey_ext + 10 * ssizey_ext + k * 2 * ssizey_ext];
-                     lda = working_space[i1 + j1][i2 + j2 + ssizey_ext];
-                     ldb = ldb + lda * ldc;
+      // the channels i1 are independent and may be split between threads
+      ROOT::Internal::SpectrumForeachRange(ssizex_ext,
+         Long64_t(ssizex_ext) * ssizey_ext * (2 * lhx - 1) * (2 * lhy - 1), [&](Int_t first, Int_t last) {
+         // columns of the matrix b=ht*h for all the shifts along x
+         std::vector<Double_t *> bColumns(2 * lhx - 1);
+         for(Int_t jj1 = -(lhx - 1); jj1 <= lhx - 1; jj1++){
+            const Int_t kk = (jj1 + ssizex_ext) / ssizex_ext;
+            bColumns[jj1 + lhx - 1] = working_space[(jj1 + ssizex_ext) % ssizex_ext] + ssizey_ext + 10 * ssizey_ext + kk * 2 * ssizey_ext;
+         }
+         for(Int_t ii2 = 0; ii2 < ssizey_ext; ii2++){
+            for(Int_t ii1 = first; ii1 < last; ii1++){
+               Double_t x1 = working_space[ii1][ii2 + ssizey_ext];
+               const Double_t p = working_space[ii1][ii2 + 14 * ssizey_ext];
+               if(x1 > 0.000001 && p > 0.000001){
+                  Double_t sum = 0;
+                  const Int_t jj2min = -std::min(ii2, lhy - 1);
+                  const Int_t jj2max = std::min(ssizey_ext - ii2 - 1, lhy - 1);
+                  const Int_t jj1min = -std::min(ii1, lhx - 1);
+                  const Int_t jj1max = std::min(ssizex_ext - ii1 - 1, lhx - 1);
+                  for(Int_t jj2 = jj2min; jj2 <= jj2max; jj2++){
+                     for(Int_t jj1 = jj1min; jj1 <= jj1max; jj1++){
+                        sum = sum + working_space[ii1 + jj1][ii2 + jj2 + ssizey_ext] * bColumns[jj1 + lhx - 1][jj2];
+                     }
+                  }
+                  if(p * x1 != 0 && sum != 0){
+                     x1 = x1 * p / sum;
                   }
-               }
-               lda = working_space[i1][i2 + ssizey_ext];
-               ldc = working_space[i1][i2 + 14 * ssizey_ext];
-               if(ldc * lda != 0 && ldb != 0){
-                  lda =lda * ldc / ldb;
-               }
 
-               else
-                  lda=0;
-               working_space[i1][i2 + 2 * ssizey_ext] = lda;
+                  else
+                     x1 = 0;
+                  working_space[ii1][ii2 + 2 * ssizey_ext] = x1;
+               }
             }
          }
-      }
+      });
       for(i2 = 0; i2 < ssizey_ext; i2++){
          for(i1 = 0; i1 < ssizex_ext; i1++)
             working_space[i1][i2 + ssizey_ext] = working_space[i1][i2 + 2 * ssizey_ext];
@@ -50,6 +50,10 @@
 #include "TSpectrum3.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TSpectrumParallel.h"
+
+#include <algorithm>
+
 #define PEAK_WINDOW 1024
 
 ClassImp(TSpectrum3);
@@ -1961,7 +1965,7 @@ Int_t TSpectrum3::SearchHighRes(const Double_t***source,Double_t***dest, Int_t s
    Double_t p1,p2,p3,p4,p5,p6,p7,p8,s1,s2,s3,s4,s5,s6,s7,s8,s9,s10,s11,s12,r1,r2,r3,r4,r5,r6;
    Int_t x,y,z;
    Double_t pocet_sigma = 5;
-   Int_t lhx,lhy,lhz,i1,i2,i3,j1,j2,j3,k1,k2,k3,i1min,i1max,i2min,i2max,i3min,i3max,j1min,j1max,j2min,j2max,j3min,j3max,positx,posity,positz;
+   Int_t lhx,lhy,lhz,i1,i2,i3,j1,j2,j3,i1min,i1max,i2min,i2max,i3min,i3max,j1min,j1max,j2min,j2max,j3min,j3max,positx,posity,positz;
    if(sigma < 1){
       Error("SearchHighRes", "Invalid sigma, must be greater than or equal to 1");
       return 0;
@@ -2946,26 +2950,29 @@ Int_t TSpectrum3::SearchHighRes(const Double_t***source,Double_t***dest, Int_t s
       }
    }
    //calculate ht*y and write into p
-   for (i3 = 0; i3 < sizez_ext; i3++) {
-      for (i2 = 0; i2 < sizey_ext; i2++) {
-         for (i1 = 0; i1 < sizex_ext; i1++) {
-            ldc = 0;
-            for (j3 = 0; j3 <= (lhz - 1); j3++) {
-               for (j2 = 0; j2 <= (lhy - 1); j2++) {
-                  for (j1 = 0; j1 <= (lhx - 1); j1++) {
-                     k3 = i3 + j3, k2 = i2 + j2, k1 = i1 + j1;
-                     if (k3 >= 0 && k3 < sizez_ext && k2 >= 0 && k2 < sizey_ext && k1 >= 0 && k1 < sizex_ext) {
-                        lda = working_space[j1][j2][j3];
-                        ldb = working_space[k1][k2][k3+2*sizez_ext];
-                        ldc = ldc + lda * ldb;
+   // the sums skip the terms outside of the source cube, the channels i1
+   // are independent and may be split between threads
+   ROOT::Internal::SpectrumForeachRange(sizex_ext,
+      Long64_t(sizex_ext) * sizey_ext * sizez_ext * lhx * lhy * lhz, [&](Int_t first, Int_t last) {
+      for (Int_t ii3 = 0; ii3 < sizez_ext; ii3++) {
+         const Int_t jj3max = std::min(lhz - 1, sizez_ext - 1 - ii3);
+         for (Int_t ii2 = 0; ii2 < sizey_ext; ii2++) {
+            const Int_t jj2max = std::min(lhy - 1, sizey_ext - 1 - ii2);
+            for (Int_t ii1 = first; ii1 < last; ii1++) {
+               const Int_t jj1max = std::min(lhx - 1, sizex_ext - 1 - ii1);
+               Double_t sum = 0;
+               for (Int_t jj3 = 0; jj3 <= jj3max; jj3++) {
+                  for (Int_t jj2 = 0; jj2 <= jj2max; jj2++) {
+                     for (Int_t jj1 = 0; jj1 <= jj1max; jj1++) {
+                        sum = sum + working_space[jj1][jj2][jj3] * working_space[ii1 + jj1][ii2 + jj2][ii3 + jj3 + 2 * sizez_ext];
                      }
                   }
                }
+               working_space[ii1][ii2][ii3 + sizez_ext] = sum;
             }
-            working_space[i1][i2][i3 + sizez_ext] = ldc;
          }
       }
-   }
+   });
 //calculate b=ht*h
    i1min = -(lhx - 1), i1max = lhx - 1;
    i2min = -(lhy - 1), i2max = lhy - 1;
@@ -3028,60 +3035,42 @@ Int_t TSpectrum3::SearchHighRes(const Double_t***source,Double_t***dest, Int_t s
 
 //START OF ITERATIONS
    for (lindex=0;lindex<deconIterations;lindex++){
-      for (i3 = 0; i3 < sizez_ext; i3++) {
-         for (i2 = 0; i2 < sizey_ext; i2++) {
-            for (i1 = 0; i1 < sizex_ext; i1++) {
-               if (TMath::Abs(working_space[i1][i2][i3 + 3 * sizez_ext])>1e-6 && TMath::Abs(working_space[i1][i2][i3 + 1 * sizez_ext])>1e-6){
-                  ldb = 0;
-                  j3min = i3;
-                  if (j3min > lhz - 1)
-                     j3min = lhz - 1;
-
-                  j3min = -j3min;
-                  j3max = sizez_ext - i3 - 1;
-                  if (j3max > lhz - 1)
-                     j3max = lhz - 1;
-
-                  j2min = i2;
-                  if (j2min > lhy - 1)
-                     j2min = lhy - 1;
-
-                  j2min = -j2min;
-                  j2max = sizey_ext - i2 - 1;
-                  if (j2max > lhy - 1)
-                     j2max = lhy - 1;
-
-                  j1min = i1;
-                  if (j1min > lhx - 1)
-                     j1min = lhx - 1;
-
-                  j1min = -j1min;
-                  j1max = sizex_ext - i1 - 1;
-                  if (j1max > lhx - 1)
-                     j1max = lhx - 1;
-
-                  for (j3 = j3min; j3 <= j3max; j3++) {
-                     for (j2 = j2min; j2 <= j2max; j2++) {
-                        for (j1 = j1min; j1 <= j1max; j1++) {
-                           ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * sizez_ext];
-                           lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * sizez_ext];
-                           ldb = ldb + lda * ldc;
+      // the channels i1 are independent and may be split between threads
+      ROOT::Internal::SpectrumForeachRange(sizex_ext,
+         Long64_t(sizex_ext) * sizey_ext * sizez_ext * (2 * lhx - 1) * (2 * lhy - 1) * (2 * lhz - 1),
+         [&](Int_t first, Int_t last) {
+         for (Int_t ii3 = 0; ii3 < sizez_ext; ii3++) {
+            const Int_t jj3min = -std::min(ii3, lhz - 1);
+            const Int_t jj3max = std::min(sizez_ext - ii3 - 1, lhz - 1);
+            for (Int_t ii2 = 0; ii2 < sizey_ext; ii2++) {
+               const Int_t jj2min = -std::min(ii2, lhy - 1);
+               const Int_t jj2max = std::min(sizey_ext - ii2 - 1, lhy - 1);
+               for (Int_t ii1 = first; ii1 < last; ii1++) {
+                  Double_t x1 = working_space[ii1][ii2][ii3 + 3 * sizez_ext];
+                  const Double_t p = working_space[ii1][ii2][ii3 + 1 * sizez_ext];
+                  if (TMath::Abs(x1)>1e-6 && TMath::Abs(p)>1e-6){
+                     Double_t sum = 0;
+                     const Int_t jj1min = -std::min(ii1, lhx - 1);
+                     const Int_t jj1max = std::min(sizex_ext - ii1 - 1, lhx - 1);
+                     for (Int_t jj3 = jj3min; jj3 <= jj3max; jj3++) {
+                        for (Int_t jj2 = jj2min; jj2 <= jj2max; jj2++) {
+                           for (Int_t jj1 = jj1min; jj1 <= jj1max; jj1++) {
+                              sum = sum + working_space[ii1 + jj1][ii2 + jj2][ii3 + jj3 + 3 * sizez_ext] * working_space[jj1 - i1min][jj2 - i2min][jj3 - i3min + 2 * sizez_ext];
+                           }
                         }
                      }
-                  }
-                  lda = working_space[i1][i2][i3 + 3 * sizez_ext];
-                  ldc = working_space[i1][i2][i3 + 1 * sizez_ext];
-                  if (ldc * lda != 0 && ldb != 0) {
-                     lda = lda * ldc / ldb;
-                  }
+                     if (p * x1 != 0 && sum != 0) {
+                        x1 = x1 * p / sum;
+                     }
 
-                  else
-                     lda = 0;
-                  working_space[i1][i2][i3 + 4 * sizez_ext] = lda;
+                     else
+                        x1 = 0;
+                     working_space[ii1][ii2][ii3 + 4 * sizez_ext] = x1;
+                  }
                }
             }
          }
-      }
+      });
       for (i3 = 0; i3 < sizez_ext; i3++) {
          for (i2 = 0; i2 < sizey_ext; i2++) {
             for (i1 = 0; i1 < sizex_ext; i1++)
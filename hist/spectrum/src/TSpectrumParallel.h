@@ -0,0 +1,53 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Splitting of the loops over the channels of a spectrum between threads, used internally by the spectrum package
+
+#ifndef ROOT_TSpectrumParallel
+#define ROOT_TSpectrumParallel
+
+#include "RConfigure.h"
+#include "Rtypes.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <algorithm>
+
+namespace ROOT {
+namespace Internal {
+
+/// Call `func(first, last)` on consecutive ranges covering [0, n), in parallel if implicit multi-threading is
+/// enabled and the loop needs `work` >= 2^21 multiply-adds in total. The channels of a range must be independent
+/// of the channels of the other ranges.
+template <typename Func_t>
+void SpectrumForeachRange(Int_t n, Long64_t work, Func_t &&func)
+{
+#ifdef R__USE_IMT
+   constexpr Long64_t kMinWork = 1 << 21;
+   if (work >= kMinWork && n > 1 && ROOT::IsImplicitMTEnabled()) {
+      const Int_t nChunks = std::min<Long64_t>(n, 4 * Long64_t(ROOT::GetThreadPoolSize()));
+      const Int_t chunkSize = (n + nChunks - 1) / nChunks;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Int_t chunk) { func(std::min(n, chunk * chunkSize), std::min(n, (chunk + 1) * chunkSize)); },
+                   ROOT::TSeqI(nChunks));
+      return;
+   }
+#else
+   (void)work;
+#endif
+   func(0, n);
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -120,7 +120,14 @@ along with TUnfold.  If not, see <http://www.gnu.org/licenses/>.
 #include <TMath.h>
 #include "TUnfold.h"
 #include "TGraph.h"
+#include "TROOT.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
 #include <map>
 #include <vector>
 
@@ -130,6 +137,169 @@ along with TUnfold.  If not, see <http://www.gnu.org/licenses/>.
 
 ClassImp(TUnfold);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call `func(first, last)` on consecutive ranges covering [0, n), in parallel
+/// if implicit multi-threading is enabled and the loop needs at least 2^21
+/// multiply-adds in total. The result of `func` on an index must not depend
+/// on its range.
+
+template <typename Func_t>
+void ForeachRange(Int_t n, Long64_t work, Func_t &&func)
+{
+#ifdef R__USE_IMT
+   constexpr Long64_t kMinWork = 1 << 21;
+   if (work >= kMinWork && n > 1 && ROOT::IsImplicitMTEnabled()) {
+      const Int_t nChunks = std::min<Long64_t>(n, 4 * Long64_t(ROOT::GetThreadPoolSize()));
+      const Int_t chunkSize = (n + nChunks - 1) / nChunks;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Int_t chunk) { func(std::min(n, chunk * chunkSize), std::min(n, (chunk + 1) * chunkSize)); },
+                   ROOT::TSeqI(nChunks));
+      return;
+   }
+#else
+   (void)work;
+#endif
+   func(0, n);
+}
+
+/// View of a sparse matrix in compressed row storage, as used by TMatrixDSparse
+struct CSRMatrix_t {
+   Int_t fNrows = 0;
+   Int_t fNcols = 0;
+   const Int_t *fRows = nullptr;
+   const Int_t *fCols = nullptr;
+   const Double_t *fData = nullptr;
+};
+
+CSRMatrix_t MakeCSR(const TMatrixDSparse *m)
+{
+   return {m->GetNrows(), m->GetNcols(), m->GetRowIndexArray(), m->GetColIndexArray(), m->GetMatrixArray()};
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Transpose a sparse matrix, the arrays of the result are stored in
+/// rows, cols and data. The columns of every row are in increasing order.
+
+CSRMatrix_t TransposeCSR(const TMatrixDSparse *m, std::vector<Int_t> &rows, std::vector<Int_t> &cols,
+                         std::vector<Double_t> &data)
+{
+   const Int_t *m_rows = m->GetRowIndexArray();
+   const Int_t *m_cols = m->GetColIndexArray();
+   const Double_t *m_data = m->GetMatrixArray();
+   const Int_t nEl = (m->GetNrows() > 0) ? m_rows[m->GetNrows()] : 0;
+   rows.assign(m->GetNcols() + 1, 0);
+   cols.resize(nEl);
+   data.resize(nEl);
+   for (Int_t index = 0; index < nEl; index++)
+      rows[m_cols[index] + 1]++;
+   for (Int_t i = 0; i < m->GetNcols(); i++)
+      rows[i + 1] += rows[i];
+   std::vector<Int_t> next(rows.begin(), rows.end() - 1);
+   for (Int_t irow = 0; irow < m->GetNrows(); irow++) {
+      for (Int_t index = m_rows[irow]; index < m_rows[irow + 1]; index++) {
+         const Int_t pos = next[m_cols[index]]++;
+         cols[pos] = irow;
+         data[pos] = m_data[index];
+      }
+   }
+   return {m->GetNcols(), m->GetNrows(), rows.data(), cols.data(), data.data()};
+}
+
+/// Nonzero elements of a sparse matrix, in the format of TUnfold::CreateSparseMatrix()
+struct SparseElements_t {
+   std::vector<Int_t> fRows;
+   std::vector<Int_t> fCols;
+   std::vector<Double_t> fData;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Multiply two sparse matrices, r=a*diag(v)*b, by accumulating the rows of b
+/// for every row of a. The optional vector v has one factor per column of a,
+/// the columns k with hasV[k]==false are skipped.
+/// The scratch memory is one row of the result, so that only the nonzero
+/// elements of r are stored. An element of r is always summed in the order of
+/// the columns of a, whether the rows of r are split between threads or not.
+/// Elements which sum up to zero are kept only if keepZeros is set.
+
+SparseElements_t MultiplyCSR(const CSRMatrix_t &a, const CSRMatrix_t &b, const Double_t *v, const char *hasV,
+                             Bool_t keepZeros)
+{
+   Long64_t work = 0;
+   if (a.fCols && b.fCols) {
+      for (Int_t index = 0; index < a.fRows[a.fNrows]; index++) {
+         const Int_t k = a.fCols[index];
+         work += b.fRows[k + 1] - b.fRows[k];
+      }
+   }
+   if (work == 0)
+      return {};
+
+   const Int_t nChunks =
+#ifdef R__USE_IMT
+      ROOT::IsImplicitMTEnabled() ? std::min<Long64_t>(a.fNrows, 4 * Long64_t(ROOT::GetThreadPoolSize())) :
+#endif
+      1;
+   const Int_t chunkSize = (a.fNrows + nChunks - 1) / nChunks;
+   std::vector<SparseElements_t> parts(nChunks);
+   ForeachRange(nChunks, (nChunks > 1) ? work : 0, [&](Int_t firstChunk, Int_t lastChunk) {
+      std::vector<Double_t> rowData(b.fNcols, 0.0);
+      std::vector<Int_t> lastRow(b.fNcols, -1);
+      std::vector<Int_t> touched;
+      for (Int_t chunk = firstChunk; chunk < lastChunk; chunk++) {
+         SparseElements_t &r = parts[chunk];
+         const Int_t lastIrow = std::min(a.fNrows, (chunk + 1) * chunkSize);
+         for (Int_t irow = std::min(a.fNrows, chunk * chunkSize); irow < lastIrow; irow++) {
+            touched.clear();
+            for (Int_t ia = a.fRows[irow]; ia < a.fRows[irow + 1]; ia++) {
+               const Int_t k = a.fCols[ia];
+               if (hasV && !hasV[k])
+                  continue;
+               for (Int_t ib = b.fRows[k]; ib < b.fRows[k + 1]; ib++) {
+                  const Int_t icol = b.fCols[ib];
+                  if (lastRow[icol] != irow) {
+                     lastRow[icol] = irow;
+                     rowData[icol] = 0.0;
+                     touched.push_back(icol);
+                  }
+                  if (v)
+                     rowData[icol] += a.fData[ia] * b.fData[ib] * v[k];
+                  else
+                     rowData[icol] += a.fData[ia] * b.fData[ib];
+               }
+            }
+            std::sort(touched.begin(), touched.end());
+            for (Int_t icol : touched) {
+               if (keepZeros || rowData[icol] != 0.0) {
+                  r.fRows.push_back(irow);
+                  r.fCols.push_back(icol);
+                  r.fData.push_back(rowData[icol]);
+               }
+            }
+         }
+      }
+   });
+
+   if (nChunks == 1)
+      return std::move(parts[0]);
+   SparseElements_t result;
+   std::size_t n = 0;
+   for (auto &part : parts)
+      n += part.fData.size();
+   result.fRows.reserve(n);
+   result.fCols.reserve(n);
+   result.fData.reserve(n);
+   for (auto &part : parts) {
+      result.fRows.insert(result.fRows.end(), part.fRows.begin(), part.fRows.end());
+      result.fCols.insert(result.fCols.end(), part.fCols.begin(), part.fCols.end());
+      result.fData.insert(result.fData.end(), part.fData.begin(), part.fData.end());
+   }
+   return result;
+}
+
+} // anonymous namespace
+
 TUnfold::~TUnfold(void)
 {
    // delete all data members
@@ -624,58 +794,9 @@ TMatrixDSparse *TUnfold::MultiplyMSparseMSparse(const TMatrixDSparse *a,
             a->GetNcols(),b->GetNrows());
    }
 
-   TMatrixDSparse *r=new TMatrixDSparse(a->GetNrows(),b->GetNcols());
-   const Int_t *a_rows=a->GetRowIndexArray();
-   const Int_t *a_cols=a->GetColIndexArray();
-   const Double_t *a_data=a->GetMatrixArray();
-   const Int_t *b_rows=b->GetRowIndexArray();
-   const Int_t *b_cols=b->GetColIndexArray();
-   const Double_t *b_data=b->GetMatrixArray();
-   // maximum size of the output matrix
-   int nMax=0;
-   for (Int_t irow = 0; irow < a->GetNrows(); irow++) {
-      if(a_rows[irow+1]>a_rows[irow]) nMax += b->GetNcols();
-   }
-   if((nMax>0)&&(a_cols)&&(b_cols)) {
-      Int_t *r_rows=new Int_t[nMax];
-      Int_t *r_cols=new Int_t[nMax];
-      Double_t *r_data=new Double_t[nMax];
-      Double_t *row_data=new Double_t[b->GetNcols()];
-      Int_t n=0;
-      for (Int_t irow = 0; irow < a->GetNrows(); irow++) {
-         if(a_rows[irow+1]<=a_rows[irow]) continue;
-         // clear row data
-         for(Int_t icol=0;icol<b->GetNcols();icol++) {
-            row_data[icol]=0.0;
-         }
-         // loop over a-columns in this a-row
-         for(Int_t ia=a_rows[irow];ia<a_rows[irow+1];ia++) {
-            Int_t k=a_cols[ia];
-            // loop over b-columns in b-row k
-            for(Int_t ib=b_rows[k];ib<b_rows[k+1];ib++) {
-               row_data[b_cols[ib]] += a_data[ia]*b_data[ib];
-            }
-         }
-         // store nonzero elements
-         for(Int_t icol=0;icol<b->GetNcols();icol++) {
-            if(row_data[icol] != 0.0) {
-               r_rows[n]=irow;
-               r_cols[n]=icol;
-               r_data[n]=row_data[icol];
-               n++;
-            }
-         }
-      }
-      if(n>0) {
-         r->SetMatrixArray(n,r_rows,r_cols,r_data);
-      }
-      delete[] r_rows;
-      delete[] r_cols;
-      delete[] r_data;
-      delete[] row_data;
-   }
-
-   return r;
+   SparseElements_t r=MultiplyCSR(MakeCSR(a),MakeCSR(b),nullptr,nullptr,kFALSE);
+   return CreateSparseMatrix(a->GetNrows(),b->GetNcols(),r.fData.size(),
+                             r.fRows.data(),r.fCols.data(),r.fData.data());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -699,65 +820,14 @@ TMatrixDSparse *TUnfold::MultiplyMSparseTranspMSparse
             a->GetNrows(),b->GetNrows());
    }
 
-   TMatrixDSparse *r=new TMatrixDSparse(a->GetNcols(),b->GetNcols());
-   const Int_t *a_rows=a->GetRowIndexArray();
-   const Int_t *a_cols=a->GetColIndexArray();
-   const Double_t *a_data=a->GetMatrixArray();
-   const Int_t *b_rows=b->GetRowIndexArray();
-   const Int_t *b_cols=b->GetColIndexArray();
-   const Double_t *b_data=b->GetMatrixArray();
-   // maximum size of the output matrix
-
-   // matrix multiplication
-   typedef std::map<Int_t,Double_t> MMatrixRow_t;
-   typedef std::map<Int_t, MMatrixRow_t > MMatrix_t;
-   MMatrix_t matrix;
-
-   for(Int_t iRowAB=0;iRowAB<a->GetNrows();iRowAB++) {
-      for(Int_t ia=a_rows[iRowAB];ia<a_rows[iRowAB+1];ia++) {
-         for(Int_t ib=b_rows[iRowAB];ib<b_rows[iRowAB+1];ib++) {
-            // this creates a new row if necessary
-            MMatrixRow_t &row=matrix[a_cols[ia]];
-            MMatrixRow_t::iterator icol=row.find(b_cols[ib]);
-            if(icol!=row.end()) {
-               // update existing row
-               (*icol).second += a_data[ia]*b_data[ib];
-            } else {
-               // create new row
-               row[b_cols[ib]] = a_data[ia]*b_data[ib];
-            }
-         }
-      }
-   }
-
-   Int_t n=0;
-   for (MMatrix_t::const_iterator irow = matrix.begin(); irow != matrix.end(); ++irow) {
-      n += (*irow).second.size();
-   }
-   if(n>0) {
-      // pack matrix into arrays
-      Int_t *r_rows=new Int_t[n];
-      Int_t *r_cols=new Int_t[n];
-      Double_t *r_data=new Double_t[n];
-      n=0;
-      for (MMatrix_t::const_iterator irow = matrix.begin(); irow != matrix.end(); ++irow) {
-         for (MMatrixRow_t::const_iterator icol = (*irow).second.begin(); icol != (*irow).second.end(); ++icol) {
-            r_rows[n]=(*irow).first;
-            r_cols[n]=(*icol).first;
-            r_data[n]=(*icol).second;
-            n++;
-         }
-      }
-      // pack arrays into TMatrixDSparse
-      if(n>0) {
-         r->SetMatrixArray(n,r_rows,r_cols,r_data);
-      }
-      delete[] r_rows;
-      delete[] r_cols;
-      delete[] r_data;
-   }
-
-   return r;
+   // the elements of a#, with the rows of a as columns, are kept in the same
+   // order as the terms of the sums, and all computed elements are stored
+   std::vector<Int_t> at_rows,at_cols;
+   std::vector<Double_t> at_data;
+   CSRMatrix_t at=TransposeCSR(a,at_rows,at_cols,at_data);
+   SparseElements_t r=MultiplyCSR(at,MakeCSR(b),nullptr,nullptr,kTRUE);
+   return CreateSparseMatrix(a->GetNcols(),b->GetNcols(),r.fData.size(),
+                             r.fRows.data(),r.fCols.data(),r.fData.data());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -845,74 +915,34 @@ TMatrixDSparse *TUnfold::MultiplyMSparseMSparseTranspVector
                "matrix cols %d!=%d\n",m1->GetNcols(),m2->GetNcols());
       }
    }
-   const Int_t *rows_m1=m1->GetRowIndexArray();
-   const Int_t *cols_m1=m1->GetColIndexArray();
-   const Double_t *data_m1=m1->GetMatrixArray();
-   Int_t num_m1=0;
-   for(Int_t i=0;i<m1->GetNrows();i++) {
-      if(rows_m1[i]<rows_m1[i+1]) num_m1++;
-   }
-   const Int_t *rows_m2=m2->GetRowIndexArray();
-   const Int_t *cols_m2=m2->GetColIndexArray();
-   const Double_t *data_m2=m2->GetMatrixArray();
-   Int_t num_m2=0;
-   for(Int_t j=0;j<m2->GetNrows();j++) {
-      if(rows_m2[j]<rows_m2[j+1]) num_m2++;
-   }
-   const TMatrixDSparse *v_sparse=dynamic_cast<const TMatrixDSparse *>(v);
-   const Int_t *v_rows=0;
-   const Double_t *v_data=0;
-   if(v_sparse) {
-      v_rows=v_sparse->GetRowIndexArray();
-      v_data=v_sparse->GetMatrixArray();
-   }
-   Int_t num_r=num_m1*num_m2+1;
-   Int_t *row_r=new Int_t[num_r];
-   Int_t *col_r=new Int_t[num_r];
-   Double_t *data_r=new Double_t[num_r];
-   num_r=0;
-   for(Int_t i=0;i<m1->GetNrows();i++) {
-      for(Int_t j=0;j<m2->GetNrows();j++) {
-         data_r[num_r]=0.0;
-         Int_t index_m1=rows_m1[i];
-         Int_t index_m2=rows_m2[j];
-         while((index_m1<rows_m1[i+1])&&(index_m2<rows_m2[j+1])) {
-            Int_t k1=cols_m1[index_m1];
-            Int_t k2=cols_m2[index_m2];
-            if(k1<k2) {
-               index_m1++;
-            } else if(k1>k2) {
-               index_m2++;
-            } else {
-               if(v_sparse) {
-                  Int_t v_index=v_rows[k1];
-                  if(v_index<v_rows[k1+1]) {
-                     data_r[num_r] += data_m1[index_m1] * data_m2[index_m2]
-                        * v_data[v_index];
-                  }
-               } else if(v) {
-                  data_r[num_r] += data_m1[index_m1] * data_m2[index_m2]
-                     * (*v)(k1,0);
-               } else {
-                  data_r[num_r] += data_m1[index_m1] * data_m2[index_m2];
-               }
-               index_m1++;
-               index_m2++;
-            }
+   // factors of the diagonal matrix, elements missing in a sparse vector are skipped
+   std::vector<Double_t> vData;
+   std::vector<char> vPresent;
+   if(v) {
+      vData.assign(m1->GetNcols(),0.0);
+      vPresent.assign(m1->GetNcols(),1);
+      const TMatrixDSparse *v_sparse=dynamic_cast<const TMatrixDSparse *>(v);
+      if(v_sparse) {
+         const Int_t *v_rows=v_sparse->GetRowIndexArray();
+         const Double_t *v_data=v_sparse->GetMatrixArray();
+         for(Int_t k=0;k<m1->GetNcols();k++) {
+            vPresent[k]=(v_rows[k]<v_rows[k+1]);
+            if(vPresent[k]) vData[k]=v_data[v_rows[k]];
          }
-         if(data_r[num_r] !=0.0) {
-            row_r[num_r]=i;
-            col_r[num_r]=j;
-            num_r++;
+      } else {
+         for(Int_t k=0;k<m1->GetNcols();k++) {
+            vData[k]=(*v)(k,0);
          }
       }
    }
-   TMatrixDSparse *r=CreateSparseMatrix(m1->GetNrows(),m2->GetNrows(),
-                                        num_r,row_r,col_r,data_r);
-   delete[] row_r;
-   delete[] col_r;
-   delete[] data_r;
-   return r;
+   // r = m1 * diag(v) * m2#, summed in the order of the columns of m1
+   std::vector<Int_t> m2t_rows,m2t_cols;
+   std::vector<Double_t> m2t_data;
+   CSRMatrix_t m2t=TransposeCSR(m2,m2t_rows,m2t_cols,m2t_data);
+   SparseElements_t r=MultiplyCSR(MakeCSR(m1),m2t,v ? vData.data() : nullptr,
+                                  v ? vPresent.data() : nullptr,kFALSE);
+   return CreateSparseMatrix(m1->GetNrows(),m2->GetNrows(),r.fData.size(),
+                             r.fRows.data(),r.fCols.data(),r.fData.data());
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1203,9 +1233,11 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
    //      *rankPtr=rank(D1)+nrow(D2)+nrow(C)
    //      return Ainv as defined above
 
-   Double_t *rEl_data=new Double_t[A->GetNrows()*A->GetNrows()];
-   Int_t *rEl_col=new Int_t[A->GetNrows()*A->GetNrows()];
-   Int_t *rEl_row=new Int_t[A->GetNrows()*A->GetNrows()];
+   // nonzero elements of the inverse, only the parts which are inverted
+   // below are stored
+   std::vector<Double_t> rEl_data;
+   std::vector<Int_t> rEl_col;
+   std::vector<Int_t> rEl_row;
    Int_t rNumEl=0;
 
    //====================================================
@@ -1214,9 +1246,9 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
    for(Int_t i=0;i<iDiagonal;++i) {
       Int_t iA=swap[i];
       if(aII(iA)>0.0) {
-         rEl_col[rNumEl]=iA;
-         rEl_row[rNumEl]=iA;
-         rEl_data[rNumEl]=1./aII(iA);
+         rEl_col.push_back(iA);
+         rEl_row.push_back(iA);
+         rEl_data.push_back(1./aII(iA));
          ++rankD1;
          ++rNumEl;
       }
@@ -1343,32 +1375,38 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
          const Int_t *f_cols=F->GetColIndexArray();
          const Double_t *f_data=F->GetMatrixArray();
          // cholesky-type decomposition of F
+         // c is lower triangular, its rows are accessed contiguously
          TMatrixD c(nF,nF);
+         Double_t *c_data=c.GetMatrixArray();
          Int_t nErrorF=0;
          for(Int_t i=0;i<nF;i++) {
             for(Int_t indexF=f_rows[i];indexF<f_rows[i+1];indexF++) {
-               if(f_cols[indexF]>=i) c(f_cols[indexF],i)=f_data[indexF];
+               if(f_cols[indexF]>=i) c_data[f_cols[indexF]*nF+i]=f_data[indexF];
             }
             // calculate diagonal element
-       Double_t c_ii=c(i,i);
+            const Double_t *c_i=c_data+i*nF;
+            Double_t c_ii=c_i[i];
             for(Int_t j=0;j<i;j++) {
-               Double_t c_ij=c(i,j);
+               Double_t c_ij=c_i[j];
                c_ii -= c_ij*c_ij;
             }
             if(c_ii<=0.0) {
                nErrorF++;
                break;
             }
-       c_ii=TMath::Sqrt(c_ii);
-       c(i,i)=c_ii;
-            // off-diagonal elements
-            for(Int_t j=i+1;j<nF;j++) {
-               Double_t c_ji=c(j,i);
-               for(Int_t k=0;k<i;k++) {
-                  c_ji -= c(i,k)*c(j,k);
+            c_ii=TMath::Sqrt(c_ii);
+            c_data[i*nF+i]=c_ii;
+            // off-diagonal elements, the rows below i are independent
+            ForeachRange(nF-i-1,Long64_t(nF-i-1)*i,[&](Int_t first,Int_t last) {
+               for(Int_t j=i+1+first;j<i+1+last;j++) {
+                  Double_t *c_j=c_data+j*nF;
+                  Double_t c_ji=c_j[i];
+                  for(Int_t k=0;k<i;k++) {
+                     c_ji -= c_i[k]*c_j[k];
+                  }
+                  c_j[i] = c_ji/c_ii;
                }
-               c(j,i) = c_ji/c_ii;
-            }
+            });
          }
          // check condition of dInv
          if(!nErrorF) {
@@ -1385,23 +1423,29 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
          }
          if(!nErrorF) {
             // here: F = c c#
-            // construct inverse of c
-            TMatrixD cinv(nF,nF);
+            // construct inverse of c, stored transposed such that
+            // cinvT(i,k) = cinv(k,i). The columns of cinv are independent
+            TMatrixD cinvT(nF,nF);
+            Double_t *cinvT_data=cinvT.GetMatrixArray();
             for(Int_t i=0;i<nF;i++) {
-               cinv(i,i)=1./c(i,i);
+               cinvT_data[i*nF+i]=1./c_data[i*nF+i];
             }
-            for(Int_t i=0;i<nF;i++) {
-               for(Int_t j=i+1;j<nF;j++) {
-                  Double_t tmp=-c(j,i)*cinv(i,i);
-                  for(Int_t k=i+1;k<j;k++) {
-                     tmp -= cinv(k,i)*c(j,k);
+            ForeachRange(nF,Long64_t(nF)*nF*nF/6,[&](Int_t first,Int_t last) {
+               for(Int_t i=first;i<last;i++) {
+                  Double_t *cinv_i=cinvT_data+i*nF;
+                  for(Int_t j=i+1;j<nF;j++) {
+                     const Double_t *c_j=c_data+j*nF;
+                     Double_t tmp=-c_j[i]*cinv_i[i];
+                     for(Int_t k=i+1;k<j;k++) {
+                        tmp -= cinv_i[k]*c_j[k];
+                     }
+                     cinv_i[j]=tmp*cinvT_data[j*nF+j];
                   }
-                  cinv(j,i)=tmp*cinv(j,j);
                }
-            }
-            TMatrixDSparse cInvSparse(cinv);
-            Finv=MultiplyMSparseTranspMSparse
-               (&cInvSparse,&cInvSparse);
+            });
+            // F^-1 = cinv# cinv, with the dense matrix product
+            Finv=new TMatrixDSparse
+               (TMatrixD(cinvT,TMatrixD::kMultTranspose,cinvT));
          }
          DeleteMatrix(&F);
       }
@@ -1449,9 +1493,9 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
                for(Int_t indexE=e_rows[iE];indexE<e_rows[iE+1];++indexE) {
                   Int_t jE=e_cols[indexE];
                   Int_t jA=swap[jE+iDiagonal];
-                  rEl_col[rNumEl]=iA;
-                  rEl_row[rNumEl]=jA;
-                  rEl_data[rNumEl]=e_data[indexE];
+                  rEl_col.push_back(iA);
+                  rEl_row.push_back(jA);
+                  rEl_data.push_back(e_data[indexE]);
                   ++rNumEl;
                }
             }
@@ -1468,14 +1512,14 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
                   Int_t jG=g_cols[indexG];
                   Int_t jA=swap[jG+iDiagonal];
                   // G
-                  rEl_col[rNumEl]=iA;
-                  rEl_row[rNumEl]=jA;
-                  rEl_data[rNumEl]=g_data[indexG];
+                  rEl_col.push_back(iA);
+                  rEl_row.push_back(jA);
+                  rEl_data.push_back(g_data[indexG]);
                   ++rNumEl;
                   // G#
-                  rEl_col[rNumEl]=jA;
-                  rEl_row[rNumEl]=iA;
-                  rEl_data[rNumEl]=g_data[indexG];
+                  rEl_col.push_back(jA);
+                  rEl_row.push_back(iA);
+                  rEl_data.push_back(g_data[indexG]);
                   ++rNumEl;
                }
             }
@@ -1491,9 +1535,9 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
                for(Int_t indexF=finv_rows[iF];indexF<finv_rows[iF+1];++indexF) {
                   Int_t jF=finv_cols[indexF];
                   Int_t jA=swap[jF+iBlock];
-                  rEl_col[rNumEl]=iA;
-                  rEl_row[rNumEl]=jA;
-                  rEl_data[rNumEl]=finv_data[indexF];
+                  rEl_col.push_back(iA);
+                  rEl_row.push_back(jA);
+                  rEl_data.push_back(finv_data[indexF]);
                   ++rNumEl;
                }
             }
@@ -1590,9 +1634,9 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
                 indexVDVt<vdvt_rows[iVDVt+1];++indexVDVt) {
                Int_t jVDVt=vdvt_cols[indexVDVt];
                Int_t jA=swap[jVDVt+iDiagonal];
-               rEl_col[rNumEl]=iA;
-               rEl_row[rNumEl]=jA;
-               rEl_data[rNumEl]=vdvt_data[indexVDVt];
+               rEl_col.push_back(iA);
+               rEl_row.push_back(jA);
+               rEl_data.push_back(vdvt_data[indexVDVt]);
                ++rNumEl;
             }
          }
@@ -1615,10 +1659,7 @@ TMatrixDSparse *TUnfold::InvertMSparseSymmPos
 
    TMatrixDSparse *r=(rNumEl>=0) ?
       CreateSparseMatrix(A->GetNrows(),A->GetNrows(),rNumEl,
-                         rEl_row,rEl_col,rEl_data) : 0;
-   delete [] rEl_data;
-   delete [] rEl_col;
-   delete [] rEl_row;
+                         rEl_row.data(),rEl_col.data(),rEl_data.data()) : 0;
 
 #ifdef DEBUG_DETAIL
    // sanity test
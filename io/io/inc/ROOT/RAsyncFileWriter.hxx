@@ -0,0 +1,75 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RAsyncFileWriter
+#define ROOT_RAsyncFileWriter
+
+#include "RtypesCore.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+\class ROOT::Internal::RAsyncFileWriter
+\ingroup IO
+\brief Writes buffers to a file descriptor from a background thread, see TFile::SetAsyncWrite().
+
+The buffers are copied and written in the order they were queued, each at its own offset, without moving the file
+position of the descriptor. Queuing blocks while the queued buffers that are not yet written exceed a maximum size.
+*/
+class RAsyncFileWriter {
+   struct RPendingWrite {
+      std::unique_ptr<char[]> fBuffer;
+      std::size_t fSize;
+      Long64_t fOffset;
+   };
+
+   int fFd;                            ///< The file descriptor to write to
+   std::size_t fMaxInFlight;           ///< Maximum total size of the queued buffers
+   std::size_t fInFlight = 0;          ///< Total size of the queued buffers, including the one being written
+   std::deque<RPendingWrite> fQueue;   ///< The buffers to write, the next one first
+   int fError = 0;                     ///< errno of the first write that failed since the last PopError()
+   bool fStop = false;                 ///< Whether the thread has to stop once the queue is empty
+   std::mutex fMutex;                  ///< Protects all the members above
+   std::condition_variable fQueued;    ///< Signals the thread that a buffer is queued, or that it has to stop
+   std::condition_variable fWritten;   ///< Signals the queuing thread that a buffer is written
+   std::thread fThread;
+
+   void Run();
+
+public:
+   /// Whether writes can be made asynchronous on this platform
+   static bool IsSupported();
+
+   RAsyncFileWriter(int fd, std::size_t maxInFlight);
+   RAsyncFileWriter(const RAsyncFileWriter &) = delete;
+   RAsyncFileWriter &operator=(const RAsyncFileWriter &) = delete;
+   /// Write the queued buffers and stop the thread
+   ~RAsyncFileWriter();
+
+   /// Queue a copy of the `size` bytes of `buffer`, to be written at `offset` of the file
+   void Write(const char *buffer, std::size_t size, Long64_t offset);
+   /// Wait until all the queued buffers are written
+   void Wait();
+   /// Return the errno of the first write that failed since the last call (EIO if it was incomplete), 0 if none
+   int PopError();
+
+   std::size_t GetMaxInFlight() const { return fMaxInFlight; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,93 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RBlockCache
+#define ROOT_RBlockCache
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/**
+\class ROOT::Internal::RBlockCache
+\ingroup IO
+\brief Persistent cache of the blocks of remote files in a local directory, shared by all the processes using it.
+
+The files are cut into blocks of kBlockSize bytes, stored as one file per block in a subdirectory per remote file.
+The remote file is identified by its URL, size and modification time, so that a modified file is not served from
+stale blocks. A block is written to a temporary file and renamed, so that concurrent processes see either no block or
+a complete one. Reading a block marks it as recently used; once the blocks written by a process since the last
+check exceed a sixteenth of the maximum size, the least recently used blocks of the whole directory are removed
+until its size is below the maximum.
+
+The global cache used by TNetXNGFile, TDavixFile and the remote RRawFile implementations is configured by the
+rootrc variables `TFile.BlockCacheDir` (empty, the default, disables it) and `TFile.BlockCacheSize` (in MB,
+default 10240).
+*/
+class RBlockCache {
+public:
+   static constexpr std::uint64_t kBlockSize = 1024 * 1024;
+
+   /// A range of a file, to be read into fBuffer
+   struct RRange {
+      void *fBuffer;
+      std::uint64_t fOffset;
+      std::size_t fSize;
+   };
+   /// Reads the ranges from the remote file; returns false on failure
+   using FetchFunc_t = std::function<bool(std::vector<RRange> &ranges)>;
+
+private:
+   std::string fDirectory;                  ///< Root directory of the cache
+   std::uint64_t fMaxSize;                  ///< Maximum size of the directory in bytes
+   std::atomic<std::uint64_t> fNHits{0};    ///< Number of blocks read from the cache
+   std::atomic<std::uint64_t> fNMisses{0};  ///< Number of blocks fetched from the remote files
+   std::atomic<std::uint64_t> fNWritten{0}; ///< Bytes written since the last eviction run
+   std::atomic<std::uint64_t> fNTmp{0};     ///< Counter of the temporary files of this process
+   std::mutex fEvictMutex;                  ///< Serializes the eviction runs of this process
+
+   std::string GetFileDirectory(const std::string &fileId) const;
+   bool LoadBlock(const std::string &path, unsigned char *buffer, std::size_t size);
+   void StoreBlock(const std::string &fileDir, const std::string &path, const unsigned char *buffer, std::size_t size);
+   void Evict();
+
+public:
+   RBlockCache(const std::string &directory, std::uint64_t maxSize);
+   RBlockCache(const RBlockCache &) = delete;
+   RBlockCache &operator=(const RBlockCache &) = delete;
+
+   /// The cache configured in the rootrc, or nullptr if it is disabled
+   static RBlockCache *GetGlobal();
+   /// The identifier of a remote file; a change of the size or of the modification time gives a new identifier
+   static std::string MakeFileId(const std::string &url, std::uint64_t fileSize, std::int64_t mtime);
+
+   /// Read the ranges of the file `fileId` of size `fileSize`, from the cached blocks if available. The missing
+   /// blocks are fetched together with a single call to `fetch` and stored. Returns false if the fetch fails.
+   bool ReadV(const std::string &fileId, std::uint64_t fileSize, RRange *ranges, std::size_t nRanges,
+              const FetchFunc_t &fetch);
+
+   /// Remove the blocks of all files
+   void Clear();
+
+   const std::string &GetDirectory() const { return fDirectory; }
+   std::uint64_t GetMaxSize() const { return fMaxSize; }
+   std::uint64_t GetNHits() const { return fNHits; }
+   std::uint64_t GetNMisses() const { return fNMisses; }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
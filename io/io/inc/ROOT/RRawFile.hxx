@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 
@@ -52,7 +53,7 @@ public:
    static constexpr int kFeatureHasSize = 0x01;
    /// Map() and Unmap() are implemented
    static constexpr int kFeatureHasMmap = 0x02;
-   /// File supports async IO
+   /// ReadVAsync() returns before the data is read, i.e. ReadVAsyncImpl() is implemented
    static constexpr int kFeatureHasAsyncIo = 0x04;
 
    /// On construction, an ROptions parameter can customize the RRawFile behavior
@@ -137,6 +138,9 @@ protected:
 
    /// By default implemented as a loop of ReadAt calls but can be overwritten, e.g. XRootD or DAVIX implementations
    virtual void ReadVImpl(RIOVec *ioVec, unsigned int nReq);
+   /// By default calls ReadVImpl and returns a ready future. Derived classes with kFeatureHasAsyncIo return as soon
+   /// as the requests are submitted.
+   virtual std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq);
 
 public:
    RRawFile(std::string_view url, ROptions options);
@@ -172,6 +176,10 @@ public:
 
    /// Opens the file if necessary and calls ReadVImpl
    void ReadV(RIOVec *ioVec, unsigned int nReq);
+   /// Opens the file if necessary and calls ReadVAsyncImpl. The read data and the fOutBytes members of ioVec are
+   /// available once the returned future is ready; its get() method rethrows a failure of the read. ioVec and its
+   /// buffers must remain valid until then. Several asynchronous reads can be in flight at the same time.
+   std::future<void> ReadVAsync(RIOVec *ioVec, unsigned int nReq);
 
    /// Memory mapping according to POSIX standard; in particular, new mappings of the same range replace older ones.
    /// Mappings need to be aligned at page boundaries, therefore the real offset can be smaller than the desired value.
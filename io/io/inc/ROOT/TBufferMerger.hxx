@@ -15,10 +15,11 @@
 #include "TFileMerger.h"
 #include "TMemFile.h"
 
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
 
 namespace ROOT {
 
@@ -35,6 +36,11 @@ class TBufferMergerFile;
  * socket, TBufferMerger uses threads that each write to a
  * TBufferMergerFile, which in turn push data into a queue
  * managed by the TBufferMerger.
+ *
+ * Pushing to the queue is lock-free: a writing thread never
+ * waits for another one, whether it is pushing or merging.
+ * The merge is done by the writing thread that finds the merger
+ * idle; the others push their data and go on.
  */
 
 class TBufferMerger {
@@ -70,6 +76,18 @@ public:
    /** Returns the number of buffers currently in the queue. */
    size_t GetQueueSize() const;
 
+   /** Returns the largest number of buffers that were in the queue at the same time. */
+   size_t GetMaxQueueSize() const { return fMaxQueueSize; }
+
+   /** Returns the number of merges done so far. */
+   size_t GetNMerges() const { return fNMerges; }
+
+   /** Returns the total time spent merging, in seconds. */
+   double GetMergeTime() const { return fMergeTime * 1e-9; }
+
+   /** Returns the total time the merged buffers waited in the queue, in seconds. */
+   double GetQueueWaitTime() const { return fQueueWaitTime * 1e-9; }
+
    /** Returns the number of bytes currently buffered (i.e. in the queue). */
    size_t GetBuffered() const
    {
@@ -157,13 +175,26 @@ private:
    void Push(TBufferFile *buffer);
    bool TryMerge(TBufferMergerFile *memfile);
 
+   using Clock_t = std::chrono::steady_clock;
+
+   /// A buffer of the queue
+   struct RQueueNode {
+      TBufferFile *fBuffer;
+      RQueueNode *fNext;          //< The buffer pushed before this one
+      Clock_t::time_point fPushed; //< When the buffer was pushed
+   };
+
    bool fCompressTemporaryKeys{false};                           //< Enable compression of the TKeys in the TMemFile (save memory at the expense of time, end result is unchanged)
    size_t fAutoSave{0};                                          //< AutoSave only every fAutoSave bytes
    std::atomic<size_t> fBuffered{0};                             //< Number of bytes currently buffered
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
-   mutable std::mutex fQueueMutex;                               //< Mutex used to lock fQueue
-   std::queue<TBufferFile *> fQueue;                             //< Queue to which data is pushed and merged
+   std::atomic<RQueueNode *> fQueue{nullptr};                    //< Lock-free stack of the pushed buffers, the last pushed first
+   std::atomic<size_t> fQueueSize{0};                            //< Number of buffers in fQueue
+   std::atomic<size_t> fMaxQueueSize{0};                         //< Largest value of fQueueSize
+   std::atomic<size_t> fNMerges{0};                              //< Number of merges done
+   std::atomic<Long64_t> fMergeTime{0};                          //< Total time spent merging, in ns
+   std::atomic<Long64_t> fQueueWaitTime{0};                      //< Total time the merged buffers spent in fQueue, in ns
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
 };
 
@@ -282,6 +282,9 @@ protected:
    void JsonWriteBasic(ULong_t value);
    void JsonWriteBasic(ULong64_t value);
 
+   template <typename T>
+   R__ALWAYS_INLINE void JsonWriteInteger(T value);
+
    void JsonWriteConstChar(const char *value, Int_t len = -1, const char * /*typname*/ = nullptr);
 
    void JsonWriteObject(const void *obj, const TClass *objClass, Bool_t check_map = kTRUE);
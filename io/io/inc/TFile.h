@@ -43,6 +43,7 @@
 class TMap;
 class TFree;
 class TArrayC;
+class THashList;
 class TArchiveFile;
 class TFileOpenHandle;
 class TFileCacheRead;
@@ -51,6 +52,12 @@ class TProcessID;
 class TStopwatch;
 class TFilePrefetch;
 
+namespace ROOT {
+namespace Internal {
+class RAsyncFileWriter;
+}
+}
+
 class TFile : public TDirectoryFile {
   friend class TDirectoryFile;
   friend class TFilePrefetch;
@@ -99,6 +106,7 @@ protected:
    TFileCacheRead  *fCacheRead{nullptr};      ///<!Pointer to the read cache (if any)
    TMap            *fCacheReadMap{nullptr};   ///<!Pointer to the read cache (if any)
    TFileCacheWrite *fCacheWrite{nullptr};     ///<!Pointer to the write cache (if any)
+   ROOT::Internal::RAsyncFileWriter *fAsyncWriter{nullptr}; ///<!Writes the buffers from a background thread (if any)
    Long64_t         fArchiveOffset{0};        ///<!Offset at which file starts in archive
    Bool_t           fIsArchive{kFALSE};       ///<!True if this is a pure archive file
    Bool_t           fNoAnchorInName{kFALSE};  ///<!True if we don't want to force the anchor to be appended to the file name
@@ -111,6 +119,8 @@ protected:
    TUrl             fUrl;                     ///<!URL of file
 
    TList           *fInfoCache{nullptr};      ///<!Cached list of the streamer infos in this file
+   THashList       *fPendingInfos{nullptr};   ///<!Streamer infos read but not yet built, one list per class name
+   std::atomic<Bool_t> fHasPendingInfos{kFALSE}; ///<!True if fPendingInfos is not empty
    TList           *fOpenPhases{nullptr};     ///<!Time info about open phases
 
    bool             fGlobalRegistration = true; ///<! if true, bypass use of global lists
@@ -134,11 +144,14 @@ protected:
    static std::atomic<Int_t>     fgReadCalls;             ///<Number of bytes read from all TFile objects
    static Int_t     fgReadaheadSize;         ///<Readahead buffer size
    static Bool_t    fgReadInfo;              ///<if true (default) ReadStreamerInfo is called when opening a file
+   static Bool_t    fgReadInfoLazily;        ///<if true, the streamerinfos of read-only files are built on first use
 
    virtual EAsyncOpenStatus GetAsyncOpenStatus() { return fAsyncOpenStatus; }
    virtual void        Init(Bool_t create);
+           Bool_t      FinishAsyncWrites();
            Bool_t      FlushWriteCache();
            Int_t       ReadBufferViaCache(char *buf, Int_t len);
+           Bool_t      WriteBufferAsync(const char *buf, Int_t len);
            Int_t       WriteBufferViaCache(const char *buf, Int_t len);
 
    ////////////////////////////////////////////////////////////////////////////////
@@ -236,6 +249,7 @@ public:
    virtual Long64_t    GetBytesReadExtra() const { return fBytesReadExtra; }
    virtual Long64_t    GetBytesWritten() const;
    virtual Int_t       GetReadCalls() const { return fReadCalls; }
+           Long64_t    GetAsyncWrite() const;
            Int_t       GetVersion() const { return fVersion; }
            Int_t       GetRecordHeader(char *buf, Long64_t first, Int_t maxbytes,
                                        Int_t &nbytes, Int_t &objlen, Int_t &keylen);
@@ -249,6 +263,7 @@ public:
    virtual TList      *GetStreamerInfoList() final; // Note: to override behavior, please override GetStreamerInfoListImpl
    const   TList      *GetStreamerInfoCache();
    virtual void        IncrementProcessIDs() { fNProcessIDs++; }
+           Bool_t      HasPendingStreamerInfo() const { return fHasPendingInfos; }
    virtual Bool_t      IsArchive() const { return fIsArchive; }
            Bool_t      IsBinary() const { return TestBit(kBinaryFile); }
            Bool_t      IsRaw() const { return !fIsRootFile; }
@@ -259,6 +274,7 @@ public:
                                    Option_t *option="new"); // *MENU*
    virtual void        Map(Option_t *opt); // *MENU*
    virtual void        Map() { Map(""); }; // *MENU*
+           Bool_t      LoadStreamerInfo(const char *classname);
    virtual Bool_t      Matches(const char *name);
    virtual Bool_t      MustFlush() const {return fMustFlush;}
            void        Paint(Option_t *option="") override;
@@ -267,6 +283,8 @@ public:
    virtual Bool_t      ReadBuffer(char *buf, Int_t len);
    virtual Bool_t      ReadBuffer(char *buf, Long64_t pos, Int_t len);
    virtual Bool_t      ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
+   /// Whether ReadBuffers() can be called by several threads at once (see TFilePrefetch)
+   virtual Bool_t      SupportsConcurrentReads() const { return kFALSE; }
    virtual void        ReadFree();
    virtual TProcessID *ReadProcessID(UShort_t pidf);
    virtual void        ReadStreamerInfo();
@@ -275,6 +293,7 @@ public:
    virtual void        Seek(Long64_t offset, ERelativeTo pos = kBeg);
    virtual void        SetCacheRead(TFileCacheRead *cache, TObject *tree = nullptr, ECacheAction action = kDisconnect);
    virtual void        SetCacheWrite(TFileCacheWrite *cache);
+           Bool_t      SetAsyncWrite(Long64_t maxBytesInFlight = 64 * 1024 * 1024);
    virtual void        SetCompressionAlgorithm(Int_t algorithm = ROOT::RCompressionSetting::EAlgorithm::kUseGlobal);
    virtual void        SetCompressionLevel(Int_t level = ROOT::RCompressionSetting::ELevel::kUseMin);
    virtual void        SetCompressionSettings(Int_t settings = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault);
@@ -319,6 +338,8 @@ public:
    static void         SetReadaheadSize(Int_t bufsize = 256000);
    static void         SetReadStreamerInfo(Bool_t readinfo=kTRUE);
    static Bool_t       GetReadStreamerInfo();
+   static void         SetReadStreamerInfoLazily(Bool_t lazy=kTRUE);
+   static Bool_t       GetReadStreamerInfoLazily();
 
    static Long64_t     GetFileCounter();
    static void         IncrementFileCounter();
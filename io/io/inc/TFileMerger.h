@@ -17,6 +17,7 @@
 #include "TString.h"
 #include "TStopwatch.h"
 #include <string>
+#include <vector>
 
 class TFile;
 class TDirectory;
@@ -54,8 +55,11 @@ protected:
    TString        fObjectNames;               ///< List of object names to be either merged exclusively or skipped
    TList          fMergeList;                 ///< list of TObjString containing the name of the files need to be merged
    TList          fExcessFiles;               ///<! List of TObjString containing the name of the files not yet added to fFileList due to user or system limitation on the max number of files opened.
+   Int_t          fNParallelMerges{0};        ///< Number of partial merges run concurrently (0 or 1 for a sequential merge)
+   TString        fParallelDir;               ///< Directory of the partial files of a parallel merge (default is the temporary directory)
 
    Bool_t         OpenExcessFiles();
+   Bool_t         MergeInParallel(Int_t type, std::vector<TString> &partialFiles);
    virtual Bool_t AddFile(TFile *source, Bool_t own, Bool_t cpProgress);
    virtual Bool_t MergeRecursive(TDirectory *target, TList *sourcelist, Int_t type = kRegular | kAll);
 
@@ -101,6 +105,8 @@ public:
    void        AddObjectNames(const char *name) {fObjectNames += name; fObjectNames += " ";}
    const char *GetObjectNames() const {return fObjectNames.Data();}
    void        ClearObjectNames() {fObjectNames.Clear();}
+   Int_t       GetParallelMerges() const { return fNParallelMerges; }
+   void        SetParallelMerges(Int_t n, const char *workingDir = nullptr);
 
     //--- file management interface
    virtual Bool_t SetCWD(const char * /*path*/) { MayNotUse("SetCWD"); return kFALSE; }
@@ -124,7 +130,7 @@ public:
    virtual void   SetNotrees(Bool_t notrees=kFALSE) {fNoTrees = notrees;}
            void   RecursiveRemove(TObject *obj) override;
 
-   ClassDefOverride(TFileMerger, 6)  // File copying and merging services
+   ClassDefOverride(TFileMerger, 7)  // File copying and merging services
 };
 
 #endif
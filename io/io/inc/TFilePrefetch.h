@@ -20,7 +20,10 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #ifdef R__LESS_INCLUDES
 class TSemaphore;
@@ -37,6 +40,7 @@ private:
    TList      *fPendingBlocks;              ///< list of pending blocks to be read
    TList      *fReadBlocks;                 ///< list of blocks read
    TThread    *fConsumer;                   ///< consumer thread
+   Int_t       fNThreads;                   ///< maximum number of pieces of a block read concurrently
    std::mutex fMutexPendingList;            ///< mutex for the pending list
    std::mutex fMutexReadList;               ///< mutex for the list of read blocks
    std::condition_variable fNewBlockAdded;  ///< signal the addition of a new pending block
@@ -46,8 +50,26 @@ private:
    TStopwatch  fWaitTime;                   ///< time waiting to prefetch a buffer (in usec)
    Bool_t      fThreadJoined;               ///< mark if async thread was joined
    std::atomic<Bool_t> fPrefetchFinished;   ///< true if prefetching is over
+   mutable std::mutex fMutexStats;          ///< mutex for fLatency and fBandwidth
+   Double_t    fLatency;                    ///< shortest time measured for a read request, in seconds (0 if none)
+   Double_t    fBandwidth;                  ///< average bandwidth measured for large read requests, in bytes/s (0 if none)
+
+   struct CachedBlock {
+      TString fPath;                        ///< path of the file of the block in the cache directory
+      std::vector<char> fBuffer;            ///< content of the block
+   };
+   std::thread fCacheWriter;                ///< thread writing the blocks to the cache directory
+   std::deque<CachedBlock> fCacheQueue;     ///< blocks to write to the cache directory
+   std::mutex  fMutexCacheQueue;            ///< mutex for fCacheQueue and fCacheWriterStop
+   std::condition_variable fCacheQueueChanged; ///< signal the addition or the removal of a block of fCacheQueue
+   Bool_t      fCacheWriterStop;            ///< true if the cache writer has to stop once fCacheQueue is empty
 
    static TThread::VoidRtnFunc_t ThreadProc(void*);  //create a joinable worker thread
+   void      ReadPieces(TFPBlock*);
+   void      UpdateReadStats(Long64_t bytes, Double_t seconds);
+   void      WriteCacheQueue();
+   void      FinishCacheWrites();
+   TString   GetBlockCachePath(TFPBlock*, Bool_t create);
 
 public:
    TFilePrefetch(TFile*);
@@ -66,6 +88,9 @@ public:
 
    TThread  *GetThread() const;
    Int_t     ThreadStart();
+   void      SetNThreads(Int_t n) { fNThreads = n > 0 ? n : 1; }
+   Int_t     GetNThreads() const { return fNThreads; }
+   Long64_t  GetPieceSize() const;
 
    Bool_t    SetCache(const char*);
    Bool_t    CheckBlockInCache(char*&, TFPBlock*);
@@ -25,6 +25,12 @@ public:
       const size_t fSize;
       explicit ZeroCopyView_t(const char * start, const size_t size) : fStart(start), fSize(size) {}
    };
+   /// A shared memory region holding the content of the file, identified by a file descriptor.
+   /// A negative descriptor asks a writable TMemFile to create its own region.
+   struct SharedMemory_t {
+      const Int_t fFd;
+      explicit SharedMemory_t(Int_t fd = -1) : fFd(fd) {}
+   };
 
 protected:
    struct TMemBlock {
@@ -43,6 +49,7 @@ protected:
       TMemBlock *fNext{nullptr};
       UChar_t   *fBuffer{nullptr};
       Long64_t   fSize{0};
+      Bool_t     fMapped{kFALSE};          ///< fBuffer is a memory mapping, to be unmapped rather than deleted
    };
    TMemBlock    fBlockList;               ///< Collection of memory blocks of size fgDefaultBlockSize
    ExternalDataPtr_t fExternalData;       ///< shared file data / content
@@ -51,6 +58,8 @@ protected:
    Long64_t     fSysOffset{0};            ///< Seek offset in file
    TMemBlock   *fBlockSeek{nullptr};      ///< Pointer to the block we seeked to.
    Long64_t     fBlockOffset{0};          ///< Seek offset within the block
+   Int_t        fShmFd{-1};               ///< Descriptor of the shared memory region holding the blocks, -1 if none
+   Bool_t       fShmOwned{kFALSE};        ///< if fShmFd was created by this TMemFile and must be closed with it
 
    constexpr static Long64_t fgDefaultBlockSize = 2 * 1024 * 1024;
    Long64_t fDefaultBlockSize = fgDefaultBlockSize;
@@ -58,6 +67,8 @@ protected:
    Bool_t IsExternalData() const { return !fIsOwnedByROOT; }
 
    Long64_t MemRead(Int_t fd, void *buf, Long64_t len) const;
+   UChar_t *MapSharedBlock(Long64_t offset, Long64_t size);
+   void     AddBlock(TMemBlock *last);
 
    // Overload TFile interfaces.
    Int_t    SysOpen(const char *pathname, Int_t flags, UInt_t mode) override;
@@ -94,12 +105,16 @@ public:
    TMemFile(const char *name, ExternalDataPtr_t data);
    TMemFile(const char *name, const ZeroCopyView_t &datarange);
    TMemFile(const char *name, std::unique_ptr<TBufferFile> buffer);
+   TMemFile(const char *name, const SharedMemory_t &shm, Option_t *option = "", const char *ftitle = "",
+            Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault, Long64_t defBlockSize = 0LL);
    TMemFile(const TMemFile &orig);
    ~TMemFile() override;
 
    virtual Long64_t CopyTo(void *to, Long64_t maxsize) const;
    virtual void     CopyTo(TBuffer &tobuf) const;
            Long64_t GetSize() const override;
+           Int_t    GetSharedMemoryFd() const { return fShmFd; }
+   static  Int_t    CreateSharedMemory(const char *name);
 
            void ResetAfterMerge(TFileMergeInfo *) override;
            void ResetErrno() const override;
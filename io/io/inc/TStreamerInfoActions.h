@@ -210,6 +210,7 @@ namespace TStreamerInfoActions {
       TVirtualStreamerInfo *fStreamerInfo; ///< StreamerInfo used to derive these actions.
       TLoopConfiguration   *fLoopConfig;   ///< If this is a bundle of memberwise streaming action, this configures the looping
       ActionContainer_t     fActions;
+      ClassStreamerFunc_t   fDirectStreamer = nullptr; ///< Generated function equivalent to the whole sequence of actions, if any (see TClass::SetDirectStreamerFunc)
 
       void AddToOffset(Int_t delta);
       void SetMissing();
@@ -0,0 +1,113 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RAsyncFileWriter.hxx"
+#include "RConfigure.h"
+
+#include <cerrno>
+#include <cstring>
+
+#ifndef R__WIN32
+#include <unistd.h>
+#endif
+
+using ROOT::Internal::RAsyncFileWriter;
+
+bool RAsyncFileWriter::IsSupported()
+{
+#ifdef R__WIN32
+   return false;
+#else
+   return true;
+#endif
+}
+
+RAsyncFileWriter::RAsyncFileWriter(int fd, std::size_t maxInFlight) : fFd(fd), fMaxInFlight(maxInFlight)
+{
+   fThread = std::thread([this] { Run(); });
+}
+
+RAsyncFileWriter::~RAsyncFileWriter()
+{
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = true;
+   }
+   fQueued.notify_one();
+   fThread.join();
+}
+
+void RAsyncFileWriter::Write(const char *buffer, std::size_t size, Long64_t offset)
+{
+   RPendingWrite write{std::unique_ptr<char[]>(new char[size]), size, offset};
+   std::memcpy(write.fBuffer.get(), buffer, size);
+
+   std::unique_lock<std::mutex> lock(fMutex);
+   // a buffer larger than the maximum is queued alone
+   fWritten.wait(lock, [&] { return fInFlight == 0 || fInFlight + size <= fMaxInFlight; });
+   fInFlight += size;
+   fQueue.push_back(std::move(write));
+   lock.unlock();
+   fQueued.notify_one();
+}
+
+void RAsyncFileWriter::Wait()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   fWritten.wait(lock, [this] { return fInFlight == 0; });
+}
+
+int RAsyncFileWriter::PopError()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   int error = fError;
+   fError = 0;
+   return error;
+}
+
+void RAsyncFileWriter::Run()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (true) {
+      fQueued.wait(lock, [this] { return fStop || !fQueue.empty(); });
+      if (fQueue.empty())
+         return; // stopping, and everything is written
+
+      // the buffer stays in the queue, and counted in flight, until it is written
+      RPendingWrite &write = fQueue.front();
+      lock.unlock();
+
+      int error = 0;
+#ifndef R__WIN32
+      const char *cur = write.fBuffer.get();
+      std::size_t left = write.fSize;
+      Long64_t offset = write.fOffset;
+      while (left > 0) {
+         ssize_t siz = ::pwrite(fFd, cur, left, offset);
+         if (siz < 0 && errno == EINTR)
+            continue;
+         if (siz <= 0) {
+            error = siz < 0 ? errno : EIO;
+            break;
+         }
+         cur += siz;
+         left -= siz;
+         offset += siz;
+      }
+#else
+      error = ENOSYS;
+#endif
+
+      lock.lock();
+      if (error && !fError)
+         fError = error;
+      fInFlight -= write.fSize;
+      fQueue.pop_front();
+      fWritten.notify_all();
+   }
+}
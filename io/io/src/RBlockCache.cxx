@@ -0,0 +1,253 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RBlockCache.hxx"
+
+#include "TEnv.h"
+#include "TError.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <memory>
+
+namespace {
+
+/// FNV-1a hash, stable across processes and platforms
+std::uint64_t HashFileId(const std::string &fileId)
+{
+   std::uint64_t hash = 14695981039346656037ULL;
+   for (unsigned char c : fileId) {
+      hash ^= c;
+      hash *= 1099511628211ULL;
+   }
+   return hash;
+}
+
+struct RCachedBlock {
+   std::string fPath;
+   std::uint64_t fSize;
+   Long_t fMtime;
+};
+
+} // anonymous namespace
+
+ROOT::Internal::RBlockCache::RBlockCache(const std::string &directory, std::uint64_t maxSize)
+   : fDirectory(directory), fMaxSize(maxSize)
+{
+}
+
+ROOT::Internal::RBlockCache *ROOT::Internal::RBlockCache::GetGlobal()
+{
+   // Never deleted: files may still be closed during the tear down of the static objects
+   static RBlockCache *gCache = []() -> RBlockCache * {
+      TString dir = gEnv->GetValue("TFile.BlockCacheDir", "");
+      if (dir.IsNull())
+         return nullptr;
+      gSystem->ExpandPathName(dir);
+      if (gSystem->AccessPathName(dir) && gSystem->mkdir(dir, kTRUE) != 0) {
+         ::Error("RBlockCache::GetGlobal", "cannot create the block cache directory %s", dir.Data());
+         return nullptr;
+      }
+      const std::uint64_t maxSizeMB = std::max(1, gEnv->GetValue("TFile.BlockCacheSize", 10240));
+      return new RBlockCache(dir.Data(), maxSizeMB * 1024 * 1024);
+   }();
+   return gCache;
+}
+
+std::string ROOT::Internal::RBlockCache::MakeFileId(const std::string &url, std::uint64_t fileSize, std::int64_t mtime)
+{
+   return url + "#" + std::to_string(fileSize) + "#" + std::to_string(mtime);
+}
+
+std::string ROOT::Internal::RBlockCache::GetFileDirectory(const std::string &fileId) const
+{
+   char hash[17];
+   snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(HashFileId(fileId)));
+   return fDirectory + "/" + hash;
+}
+
+bool ROOT::Internal::RBlockCache::LoadBlock(const std::string &path, unsigned char *buffer, std::size_t size)
+{
+   std::ifstream file(path, std::ios::binary);
+   if (!file)
+      return false;
+   file.read(reinterpret_cast<char *>(buffer), size);
+   // A block of the wrong size is not used, it cannot come from this version of the file
+   if (static_cast<std::size_t>(file.gcount()) != size || file.peek() != std::ifstream::traits_type::eof())
+      return false;
+   const Long_t now = std::time(nullptr);
+   gSystem->Utime(path.c_str(), now, now);
+   return true;
+}
+
+void ROOT::Internal::RBlockCache::StoreBlock(const std::string &fileDir, const std::string &path,
+                                             const unsigned char *buffer, std::size_t size)
+{
+   if (gSystem->AccessPathName(fileDir.c_str()))
+      gSystem->mkdir(fileDir.c_str(), kTRUE);
+
+   const std::string tmpPath =
+      path + ".tmp" + std::to_string(gSystem->GetPid()) + "." + std::to_string(fNTmp++);
+   {
+      std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+      file.write(reinterpret_cast<const char *>(buffer), size);
+      if (!file) {
+         file.close();
+         gSystem->Unlink(tmpPath.c_str());
+         return;
+      }
+   }
+   if (gSystem->Rename(tmpPath.c_str(), path.c_str()) != 0) {
+      gSystem->Unlink(tmpPath.c_str());
+      return;
+   }
+
+   if ((fNWritten += size) > fMaxSize / 16) {
+      fNWritten = 0;
+      Evict();
+   }
+}
+
+void ROOT::Internal::RBlockCache::Evict()
+{
+   std::lock_guard<std::mutex> guard(fEvictMutex);
+
+   std::vector<RCachedBlock> blocks;
+   std::uint64_t totalSize = 0;
+   void *dir = gSystem->OpenDirectory(fDirectory.c_str());
+   if (!dir)
+      return;
+   while (const char *fileDirName = gSystem->GetDirEntry(dir)) {
+      if (!strcmp(fileDirName, ".") || !strcmp(fileDirName, ".."))
+         continue;
+      const std::string fileDir = fDirectory + "/" + fileDirName;
+      void *subdir = gSystem->OpenDirectory(fileDir.c_str());
+      if (!subdir)
+         continue;
+      while (const char *blockName = gSystem->GetDirEntry(subdir)) {
+         // The temporary files are being written by another process
+         if (!strcmp(blockName, ".") || !strcmp(blockName, "..") || strstr(blockName, ".tmp"))
+            continue;
+         const std::string path = fileDir + "/" + blockName;
+         FileStat_t stat;
+         if (gSystem->GetPathInfo(path.c_str(), stat) != 0)
+            continue;
+         blocks.push_back({path, static_cast<std::uint64_t>(stat.fSize), stat.fMtime});
+         totalSize += stat.fSize;
+      }
+      gSystem->FreeDirectory(subdir);
+   }
+   gSystem->FreeDirectory(dir);
+
+   if (totalSize <= fMaxSize)
+      return;
+
+   // Remove the least recently used blocks until 90% of the maximum size, to not evict again right away
+   std::sort(blocks.begin(), blocks.end(),
+             [](const RCachedBlock &a, const RCachedBlock &b) { return a.fMtime < b.fMtime; });
+   const std::uint64_t target = fMaxSize / 10 * 9;
+   for (const auto &block : blocks) {
+      if (totalSize <= target)
+         break;
+      if (gSystem->Unlink(block.fPath.c_str()) == 0)
+         totalSize -= block.fSize;
+   }
+}
+
+void ROOT::Internal::RBlockCache::Clear()
+{
+   std::lock_guard<std::mutex> guard(fEvictMutex);
+
+   void *dir = gSystem->OpenDirectory(fDirectory.c_str());
+   if (!dir)
+      return;
+   std::vector<std::string> fileDirs;
+   while (const char *fileDirName = gSystem->GetDirEntry(dir)) {
+      if (strcmp(fileDirName, ".") && strcmp(fileDirName, ".."))
+         fileDirs.emplace_back(fDirectory + "/" + fileDirName);
+   }
+   gSystem->FreeDirectory(dir);
+
+   for (const auto &fileDir : fileDirs) {
+      void *subdir = gSystem->OpenDirectory(fileDir.c_str());
+      if (!subdir)
+         continue;
+      std::vector<std::string> paths;
+      while (const char *blockName = gSystem->GetDirEntry(subdir)) {
+         if (strcmp(blockName, ".") && strcmp(blockName, ".."))
+            paths.emplace_back(fileDir + "/" + blockName);
+      }
+      gSystem->FreeDirectory(subdir);
+      for (const auto &path : paths)
+         gSystem->Unlink(path.c_str());
+      gSystem->Unlink(fileDir.c_str());
+   }
+}
+
+bool ROOT::Internal::RBlockCache::ReadV(const std::string &fileId, std::uint64_t fileSize, RRange *ranges,
+                                        std::size_t nRanges, const FetchFunc_t &fetch)
+{
+   const std::string fileDir = GetFileDirectory(fileId);
+   auto blockSize = [fileSize](std::uint64_t block) {
+      return static_cast<std::size_t>(std::min(kBlockSize, fileSize - block * kBlockSize));
+   };
+
+   // The blocks touched by the ranges; the parts of the ranges beyond the end of the file are not read
+   std::map<std::uint64_t, std::unique_ptr<unsigned char[]>> blocks;
+   for (std::size_t i = 0; i < nRanges; ++i) {
+      if (ranges[i].fSize == 0 || ranges[i].fOffset >= fileSize)
+         continue;
+      const std::uint64_t end = std::min(fileSize, ranges[i].fOffset + ranges[i].fSize);
+      for (std::uint64_t block = ranges[i].fOffset / kBlockSize; block * kBlockSize < end; ++block)
+         blocks[block];
+   }
+
+   std::vector<RRange> missing;
+   for (auto &entry : blocks) {
+      const auto size = blockSize(entry.first);
+      entry.second.reset(new unsigned char[size]);
+      if (LoadBlock(fileDir + "/" + std::to_string(entry.first), entry.second.get(), size)) {
+         fNHits++;
+      } else {
+         missing.push_back({entry.second.get(), entry.first * kBlockSize, size});
+      }
+   }
+
+   if (!missing.empty()) {
+      if (!fetch(missing))
+         return false;
+      fNMisses += missing.size();
+      for (const auto &range : missing) {
+         const auto block = range.fOffset / kBlockSize;
+         StoreBlock(fileDir, fileDir + "/" + std::to_string(block), static_cast<unsigned char *>(range.fBuffer),
+                    range.fSize);
+      }
+   }
+
+   for (std::size_t i = 0; i < nRanges; ++i) {
+      if (ranges[i].fSize == 0 || ranges[i].fOffset >= fileSize)
+         continue;
+      const std::uint64_t end = std::min(fileSize, ranges[i].fOffset + ranges[i].fSize);
+      auto dest = static_cast<unsigned char *>(ranges[i].fBuffer);
+      for (std::uint64_t offset = ranges[i].fOffset; offset < end;) {
+         const auto block = offset / kBlockSize;
+         const auto posInBlock = offset - block * kBlockSize;
+         const auto n = std::min(end, (block + 1) * kBlockSize) - offset;
+         memcpy(dest, blocks[block].get() + posInBlock, n);
+         dest += n;
+         offset += n;
+      }
+   }
+   return true;
+}
@@ -116,9 +116,13 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
 #ifdef R__HAS_URING
    thread_local bool uring_failed = false;
+   // The ring is shared by all the files that issue vector reads from the same thread, such as the I/O thread of
+   // the RNTuple cluster pool. Thus we don't pay for the ring setup and teardown with every call.
+   thread_local std::unique_ptr<RIoUring> ring;
    if (!uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
+         if (!ring)
+            ring = std::make_unique<RIoUring>(); // throws std::runtime_error
          std::vector<RIoUring::RReadEvent> reads;
          reads.reserve(nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
@@ -129,7 +133,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
             ev.fFileDes = fFileDes;
             reads.push_back(ev);
          }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
+         ring->SubmitReadsAndWait(reads.data(), nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
             ioVec[i].fOutBytes = reads.at(i).fOutBytes;
          }
@@ -139,6 +143,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
          Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
          Warning("RRawFileUnix",
               "io_uring setup failed, falling back to blocking I/O in ReadV");
+         ring.reset();
          uring_failed = true;
       }
    }
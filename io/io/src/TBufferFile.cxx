@@ -17,6 +17,7 @@
 The concrete implementation of TBuffer for writing/reading to/from a ROOT file or socket.
 */
 
+#include <algorithm>
 #include <string.h>
 #include <typeinfo>
 #include <string>
@@ -35,14 +36,7 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 #include "TInterpreter.h"
 #include "TVirtualMutex.h"
 
-#if (defined(__linux) || defined(__APPLE__)) && defined(__i386__) && \
-     defined(__GNUC__)
-#define USE_BSWAPCPY
-#endif
-
-#ifdef USE_BSWAPCPY
 #include "Bswapcpy.h"
-#endif
 
 
 const UInt_t kNewClassTag       = 0xFFFFFFFF;
@@ -52,6 +46,7 @@ const UInt_t kMaxMapCount       = 0x3FFFFFFE;  // last valid fMapCount and byte
 const Version_t kByteCountVMask = 0x4000;      // OR the version byte count with this
 const Version_t kMaxVersion     = 0x3FFF;      // highest possible version number
 const Int_t  kMapOffset         = 2;   // first 2 map entries are taken by null obj and self obj
+const Int_t  kConvertBlockSize  = 256; // number of Float16_t/Double32_t values converted at once
 
 
 ClassImp(TBufferFile);
@@ -68,6 +63,34 @@ static inline bool Class_Has_StreamerInfo(const TClass* cl)
    return cl->GetStreamerInfos()->GetLast()>1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build the streamer infos of a class, if the file of the buffer builds them on
+/// first use (see TFile::SetReadStreamerInfoLazily). Returns true if some were built.
+
+static inline bool Load_Pending_StreamerInfo(TObject *parent, const TClass *cl)
+{
+   TFile *file = (TFile*)parent;
+   return file && cl && file->HasPendingStreamerInfo() && file->LoadStreamerInfo(cl->GetName());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the streamer infos of a class, if the file of the buffer builds them on
+/// first use and the given version is not known yet.
+
+static inline void Load_Pending_StreamerInfo(TObject *parent, const TClass *cl, Version_t version)
+{
+   TFile *file = (TFile*)parent;
+   if (!file || !cl || !file->HasPendingStreamerInfo())
+      return;
+   {
+      R__READ_LOCKGUARD(ROOT::gCoreMutex);
+      auto infos = cl->GetStreamerInfos();
+      if (version >= 0 && version < infos->GetSize() && infos->At(version))
+         return;
+   }
+   file->LoadStreamerInfo(cl->GetName());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create an I/O buffer object. Mode should be either TBuffer::kRead or
 /// TBuffer::kWrite. By default the I/O buffer has a size of
@@ -762,13 +785,8 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
    if (!h) h = new Short_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy16(h, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -795,13 +813,8 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
    if (!ii) ii = new Int_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(ii, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -854,8 +867,8 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   bswapcpy64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -882,13 +895,8 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
    if (!f) f = new Float_t[n];
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(f, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -915,8 +923,8 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   bswapcpy64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1035,13 +1043,8 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
    if (!h) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy16(h, fBufCur, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -1067,13 +1070,8 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
    if (!ii) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -1124,8 +1122,8 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   bswapcpy64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1151,13 +1149,8 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
    if (!f) return 0;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -1183,8 +1176,8 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   bswapcpy64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1301,13 +1294,8 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
    if (n <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy16(h, fBufCur, n);
    fBufCur += sizeof(Short_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
-# endif
 #else
    memcpy(h, fBufCur, l);
    fBufCur += l;
@@ -1323,13 +1311,8 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
-# endif
 #else
    memcpy(ii, fBufCur, l);
    fBufCur += l;
@@ -1361,8 +1344,8 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   bswapcpy64(ll, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1378,13 +1361,8 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
-# else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
-# endif
 #else
    memcpy(f, fBufCur, l);
    fBufCur += l;
@@ -1400,8 +1378,8 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   bswapcpy64(d, fBufCur, n);
+   fBufCur += l;
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1420,8 +1398,11 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
       //a range was specified. We read an integer and convert it back to a float
       Double_t xmin = ele->GetXmin();
       Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; f[j] = (Float_t)(aint/factor + xmin);
+      UInt_t aint[kConvertBlockSize];
+      for (Int_t j0 = 0; j0 < n; j0 += kConvertBlockSize) {
+         const Int_t m = std::min(n - j0, kConvertBlockSize);
+         ReadFastArray(aint, m);
+         for (Int_t j = 0; j < m; j++) f[j0 + j] = (Float_t)(aint[j]/factor + xmin);
       }
    } else {
       Int_t i;
@@ -1457,8 +1438,11 @@ void TBufferFile::ReadFastArrayWithFactor(Float_t *ptr, Int_t n, Double_t factor
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a float
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; ptr[j] = (Float_t)(aint/factor + minvalue);
+   UInt_t aint[kConvertBlockSize];
+   for (Int_t j0 = 0; j0 < n; j0 += kConvertBlockSize) {
+      const Int_t m = std::min(n - j0, kConvertBlockSize);
+      ReadFastArray(aint, m);
+      for (Int_t j = 0; j < m; j++) ptr[j0 + j] = (Float_t)(aint[j]/factor + minvalue);
    }
 }
 
@@ -1502,19 +1486,23 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
       //a range was specified. We read an integer and convert it back to a double.
       Double_t xmin = ele->GetXmin();
       Double_t factor = ele->GetFactor();
-      for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + xmin);
+      UInt_t aint[kConvertBlockSize];
+      for (Int_t j0 = 0; j0 < n; j0 += kConvertBlockSize) {
+         const Int_t m = std::min(n - j0, kConvertBlockSize);
+         ReadFastArray(aint, m);
+         for (Int_t j = 0; j < m; j++) d[j0 + j] = (Double_t)(aint[j]/factor + xmin);
       }
    } else {
       Int_t i;
       Int_t nbits = 0;
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) {
-         //we read a float and convert it to double
-         Float_t afloat;
-         for (i = 0; i < n; i++) {
-            *this >> afloat;
-            d[i] = (Double_t)afloat;
+         //we read floats and convert them to double
+         Float_t afloat[kConvertBlockSize];
+         for (Int_t i0 = 0; i0 < n; i0 += kConvertBlockSize) {
+            const Int_t m = std::min(n - i0, kConvertBlockSize);
+            ReadFastArray(afloat, m);
+            for (i = 0; i < m; i++) d[i0 + i] = (Double_t)afloat[i];
          }
       } else {
          //we read the exponent and the truncated mantissa of the float
@@ -1547,8 +1535,11 @@ void TBufferFile::ReadFastArrayWithFactor(Double_t *d, Int_t n, Double_t factor,
    if (n <= 0 || 3*n > fBufSize) return;
 
    //a range was specified. We read an integer and convert it back to a double.
-   for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + minvalue);
+   UInt_t aint[kConvertBlockSize];
+   for (Int_t j0 = 0; j0 < n; j0 += kConvertBlockSize) {
+      const Int_t m = std::min(n - j0, kConvertBlockSize);
+      ReadFastArray(aint, m);
+      for (Int_t j = 0; j < m; j++) d[j0 + j] = (Double_t)(aint[j]/factor + minvalue);
    }
 }
 
@@ -1561,11 +1552,12 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
    if (n <= 0 || 3*n > fBufSize) return;
 
    if (!nbits) {
-      //we read a float and convert it to double
-      Float_t afloat;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> afloat;
-         d[i] = (Double_t)afloat;
+      //we read floats and convert them to double
+      Float_t afloat[kConvertBlockSize];
+      for (Int_t i0 = 0; i0 < n; i0 += kConvertBlockSize) {
+         const Int_t m = std::min(n - i0, kConvertBlockSize);
+         ReadFastArray(afloat, m);
+         for (Int_t i = 0; i < m; i++) d[i0 + i] = (Double_t)afloat[i];
       }
    } else {
       //we read the exponent and the truncated mantissa of the float
@@ -1734,13 +1726,8 @@ void TBufferFile::WriteArray(const Short_t *h, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy16(fBufCur, h, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
 #else
    memcpy(fBufCur, h, l);
    fBufCur += l;
@@ -1764,13 +1751,8 @@ void TBufferFile::WriteArray(const Int_t *ii, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(fBufCur, ii, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
 #else
    memcpy(fBufCur, ii, l);
    fBufCur += l;
@@ -1832,8 +1814,8 @@ void TBufferFile::WriteArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   bswapcpy64(fBufCur, ll, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -1857,13 +1839,8 @@ void TBufferFile::WriteArray(const Float_t *f, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(fBufCur, f, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
 #else
    memcpy(fBufCur, f, l);
    fBufCur += l;
@@ -1887,8 +1864,8 @@ void TBufferFile::WriteArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   bswapcpy64(fBufCur, d, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2000,13 +1977,8 @@ void TBufferFile::WriteFastArray(const Short_t *h, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy16(fBufCur, h, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
-# endif
 #else
    memcpy(fBufCur, h, l);
    fBufCur += l;
@@ -2024,13 +1996,8 @@ void TBufferFile::WriteFastArray(const Int_t *ii, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(fBufCur, ii, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
-# endif
 #else
    memcpy(fBufCur, ii, l);
    fBufCur += l;
@@ -2076,8 +2043,8 @@ void TBufferFile::WriteFastArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   bswapcpy64(fBufCur, ll, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -2095,13 +2062,8 @@ void TBufferFile::WriteFastArray(const Float_t *f, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-# ifdef USE_BSWAPCPY
    bswapcpy32(fBufCur, f, n);
    fBufCur += l;
-# else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
-# endif
 #else
    memcpy(fBufCur, f, l);
    fBufCur += l;
@@ -2119,8 +2081,8 @@ void TBufferFile::WriteFastArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   bswapcpy64(fBufCur, d, n);
+   fBufCur += l;
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2145,11 +2107,16 @@ void TBufferFile::WriteFastArrayFloat16(const Float_t *f, Int_t n, TStreamerElem
       Double_t factor = ele->GetFactor();
       Double_t xmin = ele->GetXmin();
       Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Float_t x = f[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
+      UInt_t aint[kConvertBlockSize];
+      for (Int_t j0 = 0; j0 < n; j0 += kConvertBlockSize) {
+         const Int_t m = std::min(n - j0, kConvertBlockSize);
+         for (Int_t j = 0; j < m; j++) {
+            Float_t x = f[j0 + j];
+            if (x < xmin) x = xmin;
+            if (x > xmax) x = xmax;
+            aint[j] = UInt_t(0.5+factor*(x-xmin));
+         }
+         WriteFastArray(aint, m);
       }
    } else {
       Int_t nbits = 0;
@@ -2196,11 +2163,16 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
       Double_t factor = ele->GetFactor();
       Double_t xmin = ele->GetXmin();
       Double_t xmax = ele->GetXmax();
-      for (int j = 0; j < n; j++) {
-         Double_t x = d[j];
-         if (x < xmin) x = xmin;
-         if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
+      UInt_t aint[kConvertBlockSize];
+      for (Int_t j0 = 0; j0 < n; j0 += kConvertBlockSize) {
+         const Int_t m = std::min(n - j0, kConvertBlockSize);
+         for (Int_t j = 0; j < m; j++) {
+            Double_t x = d[j0 + j];
+            if (x < xmin) x = xmin;
+            if (x > xmax) x = xmax;
+            aint[j] = UInt_t(0.5+factor*(x-xmin));
+         }
+         WriteFastArray(aint, m);
       }
    } else {
       Int_t nbits = 0;
@@ -2209,9 +2181,11 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
       Int_t i;
       if (!nbits) {
          //if no range and no bits specified, we convert from double to float
-         for (i = 0; i < n; i++) {
-            Float_t afloat = (Float_t)d[i];
-            *this << afloat;
+         Float_t afloat[kConvertBlockSize];
+         for (Int_t i0 = 0; i0 < n; i0 += kConvertBlockSize) {
+            const Int_t m = std::min(n - i0, kConvertBlockSize);
+            for (i = 0; i < m; i++) afloat[i] = (Float_t)d[i0 + i];
+            WriteFastArray(afloat, m);
          }
       } else {
          //a range is not specified, but nbits is.
@@ -2708,6 +2682,8 @@ void TBufferFile::SkipVersion(const TClass *cl)
          //*this >> checksum;
          frombuf(this->fBufCur,&checksum);
          TStreamerInfo *vinfo = (TStreamerInfo*)cl->FindStreamerInfo(checksum);
+         if (!vinfo && Load_Pending_StreamerInfo(fParent, cl))
+            vinfo = (TStreamerInfo*)cl->FindStreamerInfo(checksum);
          if (vinfo) {
             return;
          } else {
@@ -2804,6 +2780,8 @@ Version_t TBufferFile::ReadVersion(UInt_t *startpos, UInt_t *bcnt, const TClass
                //*this >> checksum;
                frombuf(this->fBufCur,&checksum);
                TStreamerInfo *vinfo = (TStreamerInfo*)cl->FindStreamerInfo(checksum);
+               if (!vinfo && Load_Pending_StreamerInfo(fParent, cl))
+                  vinfo = (TStreamerInfo*)cl->FindStreamerInfo(checksum);
                if (vinfo) {
                   return vinfo->TStreamerInfo::GetClassVersion(); // Try to get inlining.
                } else {
@@ -2923,6 +2901,8 @@ Version_t TBufferFile::ReadVersionForMemberWise(const TClass *cl)
                UInt_t checksum = 0;
                frombuf(this->fBufCur,&checksum);
                TStreamerInfo *vinfo = (TStreamerInfo*)cl->FindStreamerInfo(checksum);
+               if (!vinfo && Load_Pending_StreamerInfo(fParent, cl))
+                  vinfo = (TStreamerInfo*)cl->FindStreamerInfo(checksum);
                if (vinfo) {
                   return vinfo->TStreamerInfo::GetClassVersion(); // Try to get inlining.
                } else {
@@ -3303,6 +3283,7 @@ Int_t TBufferFile::ReadClassBuffer(const TClass *cl, void *pointer, Int_t versio
    /// The StreamerInfo should exist at this point.
 
    else {
+      Load_Pending_StreamerInfo(fParent, cl, version);
       R__READ_LOCKGUARD(ROOT::gCoreMutex);
       auto infos = cl->GetStreamerInfos();
       auto ninfos = infos->GetSize();
@@ -3417,6 +3398,7 @@ Int_t TBufferFile::ReadClassBuffer(const TClass *cl, void *pointer, const TClass
          sinfo = guess;
       } else {
          // The last one is not the one we are looking for.
+         Load_Pending_StreamerInfo(fParent, cl, version);
          {
             R__LOCKGUARD(gInterpreterMutex);
 
@@ -3561,6 +3543,11 @@ Int_t TBufferFile::WriteClassBuffer(const TClass *cl, void *pointer)
 
 Int_t TBufferFile::ApplySequence(const TStreamerInfoActions::TActionSequence &sequence, void *obj)
 {
+   if (sequence.fDirectStreamer && !gDebug) {
+      // generated by rootcling, equivalent to the actions
+      sequence.fDirectStreamer(*this, obj);
+      return 0;
+   }
    if (gDebug) {
       //loop on all active members
       TStreamerInfoActions::ActionContainer_t::const_iterator end = sequence.fActions.end();
@@ -93,6 +93,7 @@ class Container {
 #include "TBufferJSON.h"
 
 #include <typeinfo>
+#include <charconv>
 #include <string>
 #include <cstring>
 #include <locale.h>
@@ -3036,10 +3037,14 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
    bool is_base64 = Stack()->fBase64 || (fArrayCompact == kBase64);
 
    if (!is_base64 && ((fArrayCompact == 0) || (arrsize < 6))) {
+      // avoid repeated reallocations for large arrays like histogram bins, assuming few characters per value
+      const Ssiz_t expected = fValue.Length() + arrsize * (fArraySepar.Length() + 4) + 2;
+      if (fValue.Capacity() < expected)
+         fValue.Capacity(expected);
       fValue.Append("[");
       for (Int_t indx = 0; indx < arrsize; indx++) {
          if (indx > 0)
-            fValue.Append(fArraySepar.Data());
+            fValue.Append(fArraySepar);
          JsonWriteBasic(vname[indx]);
       }
       fValue.Append("]");
@@ -3120,7 +3125,7 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
                fValue.Append("[");
                for (Int_t indx = p0; indx < pp; indx++) {
                   if (indx > p0)
-                     fValue.Append(fArraySepar.Data());
+                     fValue.Append(fArraySepar);
                   JsonWriteBasic(vname[indx]);
                }
                fValue.Append("]");
@@ -3875,14 +3880,23 @@ void TBufferJSON::WriteCharStar(char *s)
    JsonWriteConstChar(s);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// converts integer value to string and add to json value buffer
+
+template <typename T>
+R__ALWAYS_INLINE void TBufferJSON::JsonWriteInteger(T value)
+{
+   char buf[32];
+   auto res = std::to_chars(buf, buf + sizeof(buf), value);
+   fValue.Append(buf, res.ptr - buf);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// converts Char_t to string and add to json value buffer
 
 void TBufferJSON::JsonWriteBasic(Char_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3890,9 +3904,7 @@ void TBufferJSON::JsonWriteBasic(Char_t value)
 
 void TBufferJSON::JsonWriteBasic(Short_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hd", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3900,9 +3912,7 @@ void TBufferJSON::JsonWriteBasic(Short_t value)
 
 void TBufferJSON::JsonWriteBasic(Int_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3910,9 +3920,7 @@ void TBufferJSON::JsonWriteBasic(Int_t value)
 
 void TBufferJSON::JsonWriteBasic(Long_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%ld", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3920,7 +3928,7 @@ void TBufferJSON::JsonWriteBasic(Long_t value)
 
 void TBufferJSON::JsonWriteBasic(Long64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3968,9 +3976,7 @@ void TBufferJSON::JsonWriteBasic(Bool_t value)
 
 void TBufferJSON::JsonWriteBasic(UChar_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3978,9 +3984,7 @@ void TBufferJSON::JsonWriteBasic(UChar_t value)
 
 void TBufferJSON::JsonWriteBasic(UShort_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hu", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3988,9 +3992,7 @@ void TBufferJSON::JsonWriteBasic(UShort_t value)
 
 void TBufferJSON::JsonWriteBasic(UInt_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3998,9 +4000,7 @@ void TBufferJSON::JsonWriteBasic(UInt_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%lu", value);
-   fValue.Append(buf);
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4008,7 +4008,7 @@ void TBufferJSON::JsonWriteBasic(ULong_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   JsonWriteInteger(value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -46,7 +46,7 @@ TBufferMerger::~TBufferMerger()
    for (const auto &f : fAttachedFiles)
       if (!f.expired()) Fatal("TBufferMerger", " TBufferMergerFiles must be destroyed before the server");
 
-   if (!fQueue.empty())
+   if (fQueue.load())
       Merge();
 
    // Since we support purely incremental merging, Merge does not write the target objects
@@ -67,17 +67,19 @@ std::shared_ptr<TBufferMergerFile> TBufferMerger::GetFile()
 
 size_t TBufferMerger::GetQueueSize() const
 {
-   std::lock_guard<std::mutex> lock(fQueueMutex);
-   return fQueue.size();
+   return fQueueSize;
 }
 
 void TBufferMerger::Push(TBufferFile *buffer)
 {
-   {
-      std::lock_guard<std::mutex> lock(fQueueMutex);
-      fBuffered += buffer->BufferSize();
-      fQueue.push(buffer);
-   }
+   fBuffered += buffer->BufferSize();
+   auto node = new RQueueNode{buffer, fQueue.load(std::memory_order_relaxed), Clock_t::now()};
+   while (!fQueue.compare_exchange_weak(node->fNext, node, std::memory_order_release, std::memory_order_relaxed))
+      ;
+   const size_t size = ++fQueueSize;
+   size_t maxSize = fMaxQueueSize.load(std::memory_order_relaxed);
+   while (size > maxSize && !fMaxQueueSize.compare_exchange_weak(maxSize, size, std::memory_order_relaxed))
+      ;
 
    if (fBuffered > fAutoSave)
       Merge();
@@ -114,22 +116,35 @@ void TBufferMerger::Merge()
 
 void TBufferMerger::MergeImpl()
 {
-   std::queue<TBufferFile *> queue;
-   {
-      std::lock_guard<std::mutex> q(fQueueMutex);
-      std::swap(queue, fQueue);
-      fBuffered = 0;
+   const auto start = Clock_t::now();
+
+   // Take all the buffers pushed so far, and put them back in the order they were pushed
+   RQueueNode *node = fQueue.exchange(nullptr, std::memory_order_acquire);
+   RQueueNode *first = nullptr;
+   while (node) {
+      RQueueNode *next = node->fNext;
+      node->fNext = first;
+      first = node;
+      node = next;
    }
 
-   while (!queue.empty()) {
-      std::unique_ptr<TBufferFile> buffer{queue.front()};
+   Long64_t waitTime = 0;
+   while (first) {
+      std::unique_ptr<TBufferFile> buffer{first->fBuffer};
+      fBuffered -= buffer->BufferSize();
+      --fQueueSize;
+      waitTime += std::chrono::duration_cast<std::chrono::nanoseconds>(start - first->fPushed).count();
       fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
-      queue.pop();
+      delete std::exchange(first, first->fNext);
    }
 
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
                         TFileMerger::kKeepCompression);
    fMerger.Reset();
+
+   ++fNMerges;
+   fQueueWaitTime += waitTime;
+   fMergeTime += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_t::now() - start).count();
 }
 
 bool TBufferMerger::TryMerge(ROOT::TBufferMergerFile *memfile)
@@ -32,6 +32,8 @@ actions list for both are the same.
 #include "TError.h"
 #include "snprintf.h"
 
+#include <charconv>
+
 ClassImp(TBufferText);
 
 const char *TBufferText::fgFloatFmt = "%e";
@@ -830,17 +832,66 @@ const char *TBufferText::GetDoubleFormat()
    return fgDoubleFmt;
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print value like snprintf(buf, len, fmt, value) without the parsing of the format and the locale handling of
+/// printf, when fmt is "%e" or "%.Ne" (the default formats) or "%1.0f". Returns false for other formats, or if
+/// std::to_chars does not support floating-point numbers.
+
+bool FastConvert(Double_t value, const char *fmt, char *buf, unsigned len)
+{
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+   if (fmt[0] != '%')
+      return false;
+   std::chars_format format = std::chars_format::scientific;
+   int precision = 6;
+   if (fmt[1] == 'e' && !fmt[2]) {
+      // %e
+   } else if (fmt[1] == '1' && fmt[2] == '.' && fmt[3] == '0' && fmt[4] == 'f' && !fmt[5]) {
+      format = std::chars_format::fixed;
+      precision = 0;
+   } else if (fmt[1] == '.') {
+      precision = 0;
+      const char *p = fmt + 2;
+      for (; (*p >= '0') && (*p <= '9') && (p - fmt < 5); ++p)
+         precision = precision * 10 + (*p - '0');
+      if ((p == fmt + 2) || (p[0] != 'e') || p[1])
+         return false;
+   } else {
+      return false;
+   }
+   // to_chars gives the same characters as printf for a given precision
+   auto res = std::to_chars(buf, buf + len - 1, value, format, precision);
+   if (res.ec != std::errc())
+      return false;
+   *res.ptr = 0;
+   return true;
+#else
+   (void)value;
+   (void)fmt;
+   (void)buf;
+   (void)len;
+   return false;
+#endif
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// convert float to string with configured format
 
 const char *TBufferText::ConvertFloat(Float_t value, char *buf, unsigned len, Bool_t not_optimize)
 {
    if (not_optimize) {
-      snprintf(buf, len, fgFloatFmt, value);
+      if (!FastConvert(value, fgFloatFmt, buf, len))
+         snprintf(buf, len, fgFloatFmt, value);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e15)) {
-      snprintf(buf, len, "%1.0f", value);
+      if (!FastConvert(value, "%1.0f", buf, len))
+         snprintf(buf, len, "%1.0f", value);
    } else {
-      snprintf(buf, len, fgFloatFmt, value);
+      if (!FastConvert(value, fgFloatFmt, buf, len))
+         snprintf(buf, len, fgFloatFmt, value);
       CompactFloatString(buf, len);
    }
    return buf;
@@ -852,11 +903,14 @@ const char *TBufferText::ConvertFloat(Float_t value, char *buf, unsigned len, Bo
 const char *TBufferText::ConvertDouble(Double_t value, char *buf, unsigned len, Bool_t not_optimize)
 {
    if (not_optimize) {
-      snprintf(buf, len, fgFloatFmt, value);
+      if (!FastConvert(value, fgFloatFmt, buf, len))
+         snprintf(buf, len, fgFloatFmt, value);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e25)) {
-      snprintf(buf, len, "%1.0f", value);
+      if (!FastConvert(value, "%1.0f", buf, len))
+         snprintf(buf, len, "%1.0f", value);
    } else {
-      snprintf(buf, len, fgDoubleFmt, value);
+      if (!FastConvert(value, fgDoubleFmt, buf, len))
+         snprintf(buf, len, fgDoubleFmt, value);
       CompactFloatString(buf, len);
    }
    return buf;
@@ -49,9 +49,36 @@ End_Macro
 #include "TVirtualMutex.h"
 #include "TEmulatedCollectionProxy.h"
 
+#include <unordered_set>
+#include <vector>
+
 const UInt_t kIsBigFile = BIT(16);
 const Int_t  kMaxLen = 2048;
 
+// The keys record of a directory with at least kMinKeysForIndex keys ends with an index of the keys, see WriteKeys()
+const Int_t  kMinKeysForIndex = 1000;
+const UInt_t kKeyIndexMagic = 0x4B494458; // "KIDX"
+
+/// Hash of a key name stored in the index of the keys (32 bits FNV-1a, independent of the platform)
+static UInt_t KeyNameHash(const char *name)
+{
+   UInt_t hash = 2166136261u;
+   for (const char *c = name; *c; ++c)
+      hash = (hash ^ (UChar_t)*c) * 16777619u;
+   return hash;
+}
+
+/// Keys of the keys record of a directory which have not been added yet to fKeys
+struct TDirectoryFile::RKeyIndex {
+   std::vector<char>   fBuffer;   ///< Content of the keys record, from the number of keys on
+   std::vector<Int_t>  fOffsets;  ///< Position in fBuffer of the header of each key
+   std::vector<UInt_t> fHashes;   ///< Hash of the name of each key
+   std::vector<TKey*>  fKeys;     ///< Object of each key, nullptr if not created yet
+   Int_t               fNUnread;  ///< Number of keys not created yet
+   std::vector<Int_t>  fTable;    ///< Hash table (linear probing) of the key numbers + 1, 0 for an empty slot
+   Long64_t            fFileSize; ///< Size of the file, to check the keys
+};
+
 ClassImp(TDirectoryFile);
 
 
@@ -177,6 +204,7 @@ void TDirectoryFile::InitDirectoryFile(TClass *cl)
 
 TDirectoryFile::~TDirectoryFile()
 {
+   DeleteKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
       SafeDelete(fKeys);
@@ -233,6 +261,7 @@ Int_t TDirectoryFile::AppendKey(TKey *key)
    fModified = kTRUE;
 
    key->SetMotherDir(this);
+   LoadAllKeys();
 
    // This is a fast hash lookup in case the key does not already exist
    TKey *oldkey = (TKey*)fKeys->FindObject(key->GetName());
@@ -266,6 +295,7 @@ void TDirectoryFile::Browse(TBrowser *b)
       TObject *obj = nullptr;
       TIter nextin(fList);
       TKey *key = nullptr, *keyo = nullptr;
+      LoadAllKeys();
       TIter next(fKeys);
 
       cd();
@@ -588,6 +618,7 @@ void TDirectoryFile::Close(Option_t *option)
    }
 
    // Delete keys from key list (but don't delete the list header)
+   DeleteKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -801,7 +832,8 @@ TKey *TDirectoryFile::FindKeyAny(const char *keyname) const
 
    DecodeNameCycle(keyname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(name);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("FindKeyAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -853,7 +885,8 @@ TObject *TDirectoryFile::FindObjectAny(const char *aname) const
 
    DecodeNameCycle(aname, name, cycle, kMaxLen);
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(name);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("FindObjectAny", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -974,7 +1007,8 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(namobj);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("Get", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1097,7 +1131,8 @@ void *TDirectoryFile::GetObjectChecked(const char *namecycle, const TClass* expe
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(namobj);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("GetObjectChecked", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1138,7 +1173,8 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
 {
    if (!fKeys) return nullptr;
 
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(name);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("GetKey", "Unexpected type of TDirectoryFile::fKeys!");
       return nullptr;
@@ -1204,6 +1240,7 @@ void TDirectoryFile::ls(Option_t *option) const
    }
 
    if (diskobj && fKeys) {
+      LoadAllKeys();
       //*-* Loop on all the keys
       for (TObjLink *lnk = fKeys->FirstLink(); lnk != nullptr; lnk = lnk->Next()) {
          TKey *key = (TKey*)lnk->GetObject();
@@ -1383,6 +1420,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
    char *buffer;
    if (forceRead) {
+      DeleteKeyIndex();
       fKeys->Delete();
       //In case directory was updated by another process, read new
       //position for the keys
@@ -1423,8 +1461,53 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
       buffer = headerkey->GetBuffer();
       headerkey->ReadKeyBuffer(buffer);
 
-      TKey *key;
+      char *start = buffer;
       frombuf(buffer, &nkeys);
+
+      // With an index, the keys are only created when looked up, see LoadKeys()
+      const Int_t nbytes = fNbytesKeys - headerkey->GetKeylen();
+      Int_t nindex = 0;
+      UInt_t magic = 0;
+      if (nkeys >= kMinKeysForIndex && nbytes >= Long64_t(nkeys) * 8 + 12) {
+         char *trailer = start + nbytes - 8;
+         frombuf(trailer, &nindex);
+         frombuf(trailer, &magic);
+      }
+      if (magic == kKeyIndexMagic && nindex == nkeys) {
+         RKeyIndex *index = new RKeyIndex;
+         index->fBuffer.assign(start, start + nbytes);
+         index->fOffsets.resize(nkeys);
+         index->fHashes.resize(nkeys);
+         index->fKeys.assign(nkeys, nullptr);
+         index->fNUnread = nkeys;
+         index->fFileSize = fsize;
+         UInt_t tableSize = 1;
+         while (tableSize < 2 * (UInt_t)nkeys)
+            tableSize *= 2;
+         index->fTable.assign(tableSize, 0);
+         const Int_t end = nbytes - nkeys * 8 - 8;
+         char *entry = index->fBuffer.data() + end;
+         for (Int_t i = 0; i < nkeys; i++) {
+            frombuf(entry, &index->fOffsets[i]);
+            frombuf(entry, &index->fHashes[i]);
+            if (index->fOffsets[i] < (Int_t)sizeof(nkeys) || index->fOffsets[i] >= end) {
+               Error("ReadKeys", "illegal index of the keys, reading all the keys");
+               SafeDelete(index);
+               break;
+            }
+            UInt_t slot = index->fHashes[i] & (tableSize - 1);
+            while (index->fTable[slot])
+               slot = (slot + 1) & (tableSize - 1);
+            index->fTable[slot] = i + 1;
+         }
+         if (index) {
+            fKeyIndex = index;
+            delete headerkey;
+            return nkeys;
+         }
+      }
+
+      TKey *key;
       for (Int_t i = 0; i < nkeys; i++) {
          key = new TKey(this);
          key->ReadKeyBuffer(buffer);
@@ -1449,6 +1532,117 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Create the key number `i` of the index of the keys. Returns nullptr if the
+/// key is illegal.
+
+TKey *TDirectoryFile::ReadIndexedKey(Int_t i) const
+{
+   char *buffer = fKeyIndex->fBuffer.data() + fKeyIndex->fOffsets[i];
+   TKey *key = new TKey(const_cast<TDirectoryFile *>(this));
+   key->ReadKeyBuffer(buffer);
+   if (key->GetSeekKey() < 64 || key->GetSeekKey() > fKeyIndex->fFileSize ||
+       key->GetSeekPdir() < 64 || key->GetSeekPdir() > fKeyIndex->fFileSize) {
+      Error("ReadKeys", "reading illegal key %d", i);
+      key->SetMotherDir(nullptr); // do not remove it from fKeys, which would read all the keys
+      delete key;
+      return nullptr;
+   }
+   return key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add to fKeys the keys named `name` which have not been read yet from the
+/// index of the keys, in the order of the keys record.
+
+void TDirectoryFile::LoadKeys(const char *name) const
+{
+   if (!fKeyIndex)
+      return;
+
+   const UInt_t hash = KeyNameHash(name);
+   const UInt_t mask = fKeyIndex->fTable.size() - 1;
+   for (UInt_t slot = hash & mask; fKeyIndex->fTable[slot]; slot = (slot + 1) & mask) {
+      const Int_t i = fKeyIndex->fTable[slot] - 1;
+      if (fKeyIndex->fHashes[i] != hash || fKeyIndex->fKeys[i])
+         continue;
+      TKey *key = ReadIndexedKey(i);
+      if (key && strcmp(key->GetName(), name)) {
+         // another name with the same hash: it will be added with the keys of its own name
+         key->SetMotherDir(nullptr);
+         delete key;
+         continue;
+      }
+      if (key) {
+         fKeyIndex->fKeys[i] = key;
+         --fKeyIndex->fNUnread;
+         fKeys->Add(key);
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add to fKeys all the keys not read yet from the index of the keys, then
+/// delete it. The keys are ordered as in the keys record.
+
+void TDirectoryFile::LoadAllKeys() const
+{
+   if (!fKeyIndex)
+      return;
+
+   // The keys already looked up which are still in fKeys, they might have been removed meanwhile
+   std::vector<TObject *> previous;
+   previous.reserve(fKeys->GetSize());
+   for (TObject *key : *fKeys)
+      previous.push_back(key);
+   std::unordered_set<TObject *> loaded(previous.begin(), previous.end());
+   fKeys->Clear("nodelete");
+
+   for (std::size_t i = 0; i < fKeyIndex->fKeys.size(); i++) {
+      TKey *key = fKeyIndex->fKeys[i];
+      if (key) {
+         if (loaded.erase(key))
+            fKeys->Add(key);
+      } else if ((key = ReadIndexedKey(i))) {
+         fKeys->Add(key);
+      }
+   }
+   // keys which do not come from the index, if any, are kept after the others
+   for (TObject *key : previous)
+      if (loaded.count(key))
+         fKeys->Add(key);
+   DeleteKeyIndex();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Forget the keys not read yet from the index of the keys.
+
+void TDirectoryFile::DeleteKeyIndex() const
+{
+   delete fKeyIndex;
+   fKeyIndex = nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the list of keys of the directory.
+///
+/// When the keys record ends with an index of the keys, the keys are read
+/// when they are looked up: all the keys not read yet are read here.
+
+TList *TDirectoryFile::GetListOfKeys() const
+{
+   LoadAllKeys();
+   return fKeys;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of the directory, including those not read yet.
+
+Int_t TDirectoryFile::GetNkeys() const
+{
+   return fKeys->GetSize() + (fKeyIndex ? fKeyIndex->fNUnread : 0);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read object with keyname from the current directory
 ///
@@ -1461,7 +1655,8 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 Int_t TDirectoryFile::ReadTObject(TObject *obj, const char *keyname)
 {
    if (!fFile) { Error("ReadTObject","No file open"); return 0; }
-   auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
+   LoadKeys(keyname);
+   auto listOfKeys = dynamic_cast<THashList *>(fKeys);
    if (!listOfKeys) {
       Error("ReadTObject", "Unexpected type of TDirectoryFile::fKeys!");
       return 0;
@@ -1502,6 +1697,7 @@ void TDirectoryFile::ResetAfterMerge(TFileMergeInfo *info)
    fSeekParent = 0; // updated by Init
    fSeekKeys = 0;   // updated by Init
    // Does not change: fFile
+   LoadKeys(fName);
    TKey *key = fKeys ? (TKey*)fKeys->FindObject(fName) : nullptr;
    TClass *cl = IsA();
    if (key) {
@@ -1509,6 +1705,7 @@ void TDirectoryFile::ResetAfterMerge(TFileMergeInfo *info)
    }
    // NOTE: We should check that the content is really mergeable and in
    // the in-mmeory list, before deleting the keys.
+   DeleteKeyIndex();
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -2175,6 +2372,7 @@ void TDirectoryFile::WriteKeys()
       f->MakeFree(fSeekKeys, fSeekKeys + fNbytesKeys -1);
    }
 //*-* Write new keys record
+   LoadAllKeys();
    TIter next(fKeys);
    TKey *key;
    Int_t nkeys  = fKeys->GetSize();
@@ -2183,17 +2381,39 @@ void TDirectoryFile::WriteKeys()
    while ((key = (TKey*)next())) {
       nbytes += key->Sizeof();
    }
+   // Large directories get an index of the keys at the end of the record: the position
+   // of each key header and the hash of its name, followed by the number of keys and a
+   // magic number. Previous versions of ROOT stop reading the record after the keys.
+   const Bool_t writeIndex = nkeys >= kMinKeysForIndex;
+   const Int_t nbytesIndex = writeIndex ? nkeys * 8 + 8 : 0;
+   nbytes += nbytesIndex;
    TKey *headerkey  = new TKey(fName,fTitle,IsA(),nbytes,this);
    if (headerkey->GetSeekKey() == 0) {
       delete headerkey;
       return;
    }
    char *buffer = headerkey->GetBuffer();
+   char *start = buffer;
    next.Reset();
    tobuf(buffer, nkeys);
+   std::vector<Int_t> offsets;
+   if (writeIndex)
+      offsets.reserve(nkeys);
    while ((key = (TKey*)next())) {
+      if (writeIndex)
+         offsets.push_back(Int_t(buffer - start));
       key->FillBuffer(buffer);
    }
+   if (writeIndex) {
+      buffer = start + nbytes - nbytesIndex;
+      next.Reset();
+      for (Int_t i = 0; (key = (TKey*)next()); ++i) {
+         tobuf(buffer, offsets[i]);
+         tobuf(buffer, KeyNameHash(key->GetName()));
+      }
+      tobuf(buffer, nkeys);
+      tobuf(buffer, kKeyIndexMagic);
+   }
 
    fSeekKeys     = headerkey->GetSeekKey();
    fNbytesKeys   = headerkey->GetNbytes();
@@ -111,6 +111,7 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TFileCacheRead.h"
 #include "TFileCacheWrite.h"
 #include "TFree.h"
+#include "THashList.h"
 #include "TInterpreter.h"
 #include "TKey.h"
 #include "TMakeProject.h"
@@ -140,7 +141,10 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TSchemaRuleSet.h"
 #include "TThreadSlots.h"
 #include "TGlobal.h"
+#include "ROOT/RAsyncFileWriter.hxx"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include "ROOT/RTrace.hxx"
+#include <cstring>
 #include <memory>
 
 #ifdef R__FBSD
@@ -155,6 +159,7 @@ std::atomic<Long64_t> TFile::fgFileCounter{0};
 std::atomic<Int_t>    TFile::fgReadCalls{0};
 Int_t    TFile::fgReadaheadSize = 256000;
 Bool_t   TFile::fgReadInfo = kTRUE;
+Bool_t   TFile::fgReadInfoLazily = kFALSE;
 TList   *TFile::fgAsyncOpenRequests = nullptr;
 TString  TFile::fgCacheFileDir;
 Bool_t   TFile::fgCacheFileForce = kFALSE;
@@ -575,10 +580,13 @@ TFile::~TFile()
    SafeDelete(fCacheRead);
    SafeDelete(fCacheReadMap);
    SafeDelete(fCacheWrite);
+   SafeDelete(fAsyncWriter);
    SafeDelete(fProcessIDs);
    SafeDelete(fFree);
    SafeDelete(fArchive);
    SafeDelete(fInfoCache);
+   fHasPendingInfos = kFALSE;
+   SafeDelete(fPendingInfos);
    SafeDelete(fOpenPhases);
 
    if (fGlobalRegistration) {
@@ -887,7 +895,7 @@ void TFile::Init(Bool_t create)
             }
          } else if (fVersion != gROOT->GetVersionInt() && fVersion > 30000) {
             // Don't complain about missing streamer info for empty files.
-            if (fKeys->GetSize()) {
+            if (GetNkeys()) {
                Warning("Init","no StreamerInfo found in %s therefore preventing schema evolution when reading this file."
                               " The file was produced with version %d.%02d/%02d of ROOT.",
                               GetName(),  fVersion / 10000, (fVersion / 100) % (100), fVersion  % 100);
@@ -897,7 +905,12 @@ void TFile::Init(Bool_t create)
    }
 
    // Count number of TProcessIDs in this file
-   {
+   if (fKeyIndex) {
+      // the keys are read when looked up: find the ProcessIDs by name, see WriteProcessID()
+      while (GetKey(TString::Format("ProcessID%d", fNProcessIDs)))
+         fNProcessIDs++;
+      fProcessIDs = new TObjArray(fNProcessIDs+1);
+   } else {
       TIter next(fKeys);
       TKey *key;
       while ((key = (TKey*)next())) {
@@ -906,6 +919,12 @@ void TFile::Init(Bool_t create)
       fProcessIDs = new TObjArray(fNProcessIDs+1);
    }
 
+   if (fWritable && IsA() == TFile::Class()) {
+      Long64_t asyncWrite = gEnv->GetValue("TFile.AsyncWrite", 0);
+      if (asyncWrite > 0)
+         SetAsyncWrite(asyncWrite);
+   }
+
    return;
 
 zombie:
@@ -941,6 +960,7 @@ void TFile::Close(Option_t *option)
 
    if (fIsArchive || !fIsRootFile) {
       FlushWriteCache();
+      SetAsyncWrite(0);
       SysClose(fD);
       fD = -1;
 
@@ -996,6 +1016,7 @@ void TFile::Close(Option_t *option)
    }
 
    if (IsOpen()) {
+      SetAsyncWrite(0);
       SysClose(fD);
       fD = -1;
    }
@@ -1126,6 +1147,7 @@ void TFile::Flush()
 {
    if (IsOpen() && fWritable) {
       FlushWriteCache();
+      FinishAsyncWrites();
       if (SysSync(fD) < 0) {
          // Write the system error only once for this file
          SetBit(kWriteError); SetWritable(kFALSE);
@@ -1134,6 +1156,26 @@ void TFile::Flush()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait until the buffers written asynchronously are on the file, see
+/// SetAsyncWrite().
+///
+/// Return kTRUE in case of error
+
+Bool_t TFile::FinishAsyncWrites()
+{
+   if (!fAsyncWriter)
+      return kFALSE;
+   fAsyncWriter->Wait();
+   if (int error = fAsyncWriter->PopError()) {
+      // Write the system error only once for this file
+      SetBit(kWriteError); SetWritable(kFALSE);
+      Error("WriteBuffer", "error writing to file %s (%s)", GetName(), strerror(error));
+      return kTRUE;
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Flush the write cache if active.
 ///
@@ -1335,6 +1377,9 @@ Long64_t TFile::GetSize() const
    if (fArchive && fArchive->GetMember()) {
       size = fArchive->GetMember()->GetDecompressedSize();
    } else {
+      // the size includes the buffers still being written
+      if (fAsyncWriter)
+         fAsyncWriter->Wait();
       Long_t id, flags, modtime;
       if (const_cast<TFile*>(this)->SysStat(fD, &id, &size, &flags, &modtime)) {  // NOLINT: silence clang-tidy warnings
          Error("GetSize", "cannot stat the file %s", GetName());
@@ -1703,6 +1748,7 @@ void TFile::Print(Option_t *option) const
 
 Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 {
+   R__TRACE_SPAN("io", "TFile::ReadBuffer");
    if (IsOpen()) {
 
       SetOffset(pos);
@@ -1717,6 +1763,8 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
          return kFALSE;
       }
 
+      // the data might still be in a buffer being written
+      FinishAsyncWrites();
       Seek(pos);
       ssize_t siz;
 
@@ -1753,6 +1801,7 @@ Bool_t TFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
 
 Bool_t TFile::ReadBuffer(char *buf, Int_t len)
 {
+   R__TRACE_SPAN("io", "TFile::ReadBuffer");
    if (IsOpen()) {
 
       Int_t st;
@@ -1762,6 +1811,7 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
          return kFALSE;
       }
 
+      FinishAsyncWrites();
       ssize_t siz;
       Double_t start = 0;
 
@@ -1804,6 +1854,7 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
 
 Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 {
+   R__TRACE_SPAN("io", "TFile::ReadBuffers");
    // called with buf=0, from TFileCacheRead to pass list of readahead buffers
    if (!buf) {
       for (Int_t j = 0; j < nbuf; j++) {
@@ -2175,6 +2226,7 @@ Int_t TFile::ReOpen(Option_t *mode)
          }
 
          FlushWriteCache();
+         SetAsyncWrite(0);
 
          // delete free segments from free list
          fFree->Delete();
@@ -2375,6 +2427,50 @@ void TFile::SetCacheWrite(TFileCacheWrite *cache)
    fCacheWrite = cache;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Write the buffers of this file from a background thread, so that writing
+/// the keys does not wait for the file system. This helps when the latency of
+/// the writes dominates, e.g. on network file systems.
+///
+/// The buffers are copied and written in order; writing a buffer waits while
+/// more than `maxBytesInFlight` bytes are still to be written. Reading from
+/// the file, Flush() and Close() wait until all the buffers are written.
+/// Write errors are reported by the next write, flush or close.
+///
+/// A `maxBytesInFlight` of 0 makes the writes synchronous again. The writes
+/// of the local files written by TFile itself can be made asynchronous, not
+/// the ones of its derived classes. The writes of all the TFile opened for
+/// writing are asynchronous if the rootrc variable TFile.AsyncWrite is set to
+/// the maximum number of bytes in flight.
+///
+/// Returns kTRUE if the writes are asynchronous.
+
+Bool_t TFile::SetAsyncWrite(Long64_t maxBytesInFlight)
+{
+   if (fAsyncWriter) {
+      FinishAsyncWrites();
+      SafeDelete(fAsyncWriter);
+   }
+   if (maxBytesInFlight <= 0)
+      return kFALSE;
+
+   if (!IsOpen() || !IsWritable() || IsA() != TFile::Class() || !ROOT::Internal::RAsyncFileWriter::IsSupported()) {
+      Warning("SetAsyncWrite", "asynchronous writes are not supported for %s", GetName());
+      return kFALSE;
+   }
+   fAsyncWriter = new ROOT::Internal::RAsyncFileWriter(fD, maxBytesInFlight);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the maximum number of bytes in flight if the writes are
+/// asynchronous, 0 otherwise. See SetAsyncWrite().
+
+Long64_t TFile::GetAsyncWrite() const
+{
+   return fAsyncWriter ? (Long64_t)fAsyncWriter->GetMaxInFlight() : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the size in bytes of the file header.
 
@@ -2468,6 +2564,9 @@ Bool_t TFile::WriteBuffer(const char *buf, Int_t len)
          return kFALSE;
       }
 
+      if (fAsyncWriter)
+         return WriteBufferAsync(buf, len);
+
       ssize_t siz;
       gSystem->IgnoreInterrupt();
       while ((siz = SysWrite(fD, buf, len)) < 0 && GetErrno() == EINTR)  // NOLINT: silence clang-tidy warnings
@@ -2496,6 +2595,37 @@ Bool_t TFile::WriteBuffer(const char *buf, Int_t len)
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Hand a copy of the buffer over to the background thread that writes it at
+/// the current position in the file, and move the position after it as if it
+/// was written. Returns kTRUE in case of error, which might be the one of a
+/// previous asynchronous write.
+
+Bool_t TFile::WriteBufferAsync(const char *buf, Int_t len)
+{
+   if (int error = fAsyncWriter->PopError()) {
+      SetBit(kWriteError); SetWritable(kFALSE);
+      Error("WriteBuffer", "error writing to file %s (%s)", GetName(), strerror(error));
+      return kTRUE;
+   }
+   Long64_t pos = SysSeek(fD, 0, SEEK_CUR);
+   if (pos < 0) {
+      SetBit(kWriteError); SetWritable(kFALSE);
+      SysError("WriteBuffer", "error writing to file %s", GetName());
+      return kTRUE;
+   }
+   fAsyncWriter->Write(buf, len, pos);
+   SysSeek(fD, pos + len, SEEK_SET);
+
+   fBytesWrite  += len;
+   fgBytesWrite += len;
+
+   if (gMonitoringWriter)
+      gMonitoringWriter->SendFileWriteProgress(this);
+
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write buffer via cache. Returns 0 if cache is not active, 1 in case
 /// write via cache was successful, 2 in case write via cache failed.
@@ -3585,10 +3715,25 @@ Int_t TFile::MakeProjectParProofInf(const char *pack, const char *proofinf)
 /// The corresponding TClass objects are updated.
 /// Note that this function is not called if the static member fgReadInfo is false.
 /// (see TFile::SetReadStreamerInfo)
+///
+/// If the static member fgReadInfoLazily is true and the file is read-only, the
+/// TStreamerInfo objects of the file opening are only indexed by class name;
+/// they are checked against the TClass objects by LoadStreamerInfo when the
+/// class is first read (see TFile::SetReadStreamerInfoLazily). A later explicit
+/// call of this function builds all of them.
 
 void TFile::ReadStreamerInfo()
 {
-   auto listRetcode = GetStreamerInfoListImpl(/*lookupSICache*/ true);  // NOLINT: silence clang-tidy warnings
+   R__TRACE_SPAN("io", "TFile::ReadStreamerInfo");
+   const Bool_t lazy = fgReadInfoLazily && !IsWritable() && !fPendingInfos;
+   if (fPendingInfos) {
+      // All the streamer infos are built below
+      R__LOCKGUARD(gInterpreterMutex);
+      fHasPendingInfos = kFALSE;
+      fPendingInfos->Delete();
+   }
+   // The record is not marked as treated in lazy mode, since its infos are not all built
+   auto listRetcode = GetStreamerInfoListImpl(/*lookupSICache*/ !lazy);  // NOLINT: silence clang-tidy warnings
    TList *list = listRetcode.fList;
    auto retcode = listRetcode.fReturnCode;
    if (!list) {
@@ -3630,6 +3775,36 @@ void TFile::ReadStreamerInfo()
       }
    }
 
+   if (lazy) {
+      fPendingInfos = new THashList(list->GetSize());
+      fPendingInfos->SetOwner();
+      TObjLink *lnk = list->FirstLink();
+      while (lnk) {
+         TObject *obj = lnk->GetObject();
+         lnk = lnk->Next();
+         if (!obj)
+            continue;
+         if (obj->IsA() != TStreamerInfo::Class()) {
+            if (strcmp(obj->GetName(), "listOfRules") != 0)
+               Warning("ReadStreamerInfo","%s has a %s in the list of TStreamerInfo.", GetName(), obj->IsA()->GetName());
+            delete obj;
+            continue;
+         }
+         TList *infos = (TList*)fPendingInfos->FindObject(obj->GetName());
+         if (!infos) {
+            infos = new TList();
+            infos->SetName(obj->GetName());
+            infos->SetOwner();
+            fPendingInfos->Add(infos);
+         }
+         infos->Add(obj);
+      }
+      fHasPendingInfos = !fPendingInfos->IsEmpty();
+      list->Clear("nodelete");
+      delete list;
+      return;
+   }
+
    // loop on all TStreamerInfo classes
    for (int mode=0;mode<2; ++mode) {
       // In order for the collection proxy to be initialized properly, we need
@@ -3700,6 +3875,82 @@ void TFile::ReadStreamerInfo()
 #endif
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the pending streamer infos of the type of a data member, of its
+/// template arguments and of their template arguments.
+
+void LoadStreamerInfoOfType(TFile *file, std::string type)
+{
+   while (!type.empty() && (type.back() == '*' || type.back() == ' '))
+      type.pop_back();
+   if (type.compare(0, 6, "const ") == 0)
+      type.erase(0, 6);
+   if (type.empty())
+      return;
+   file->LoadStreamerInfo(type.c_str());
+   if (type.find('<') == std::string::npos)
+      return;
+   TClassEdit::TSplitType split(type.c_str());
+   for (std::size_t i = 1; i < split.fElements.size(); ++i)
+      LoadStreamerInfoOfType(file, split.fElements[i]);
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check the TStreamerInfo objects of the class `classname` read from this
+/// file against the TClass, if they have not been yet (see
+/// TFile::SetReadStreamerInfoLazily). The infos of its base classes and of the
+/// classes of its data members are built first.
+///
+/// Returns true if some TStreamerInfo has been built.
+
+Bool_t TFile::LoadStreamerInfo(const char *classname)
+{
+   if (!fHasPendingInfos)
+      return kFALSE;
+
+   R__LOCKGUARD(gInterpreterMutex);
+   TList *infos = fPendingInfos ? (TList*)fPendingInfos->FindObject(classname) : nullptr;
+   if (!infos)
+      return kFALSE;
+   // Removed first, so that the recursion ends for classes referring to each other
+   fPendingInfos->Remove(infos);
+
+   TIter next(infos);
+   TStreamerInfo *info;
+   while ((info = (TStreamerInfo*)next())) {
+      TIter nextelem(info->GetElements());
+      TStreamerElement *element;
+      while ((element = (TStreamerElement*)nextelem()))
+         LoadStreamerInfoOfType(this, element->IsBase() ? element->GetName() : element->GetTypeName());
+   }
+
+   infos->SetOwner(kFALSE);
+   next.Reset();
+   while ((info = (TStreamerInfo*)next())) {
+      if (info->GetElements()==0) {
+         Warning("LoadStreamerInfo","The StreamerInfo for %s does not have a list of elements.",info->GetName());
+         continue;
+      }
+      info->BuildCheck(this);
+      Int_t uid = info->GetNumber();
+      Int_t asize = fClassIndex->GetSize();
+      if (uid >= asize && uid <100000) fClassIndex->Set(2*asize);
+      if (uid >= 0 && uid < fClassIndex->GetSize()) fClassIndex->fArray[uid] = 1;
+      if (gDebug > 0) printf(" -class: %s version: %d info read at slot %d\n",info->GetName(), info->GetClassVersion(),uid);
+   }
+   fClassIndex->fArray[0] = 0;
+   infos->Clear();  //this will delete all TStreamerInfo objects with kCanDelete bit set
+   delete infos;
+
+   if (fPendingInfos->IsEmpty())
+      fHasPendingInfos = kFALSE;
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Specify if the streamerinfos must be read at file opening.
 ///
@@ -3726,6 +3977,36 @@ Bool_t TFile::GetReadStreamerInfo()
    return fgReadInfo;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Specify if the streamerinfos of the files opened read-only are built on
+/// first use.
+///
+/// By default, the TStreamerInfo of every class in the file is checked against
+/// the TClass (and the emulated class created if needed) at file opening. For
+/// files with many classes, this dominates the opening time of jobs reading
+/// only a few of them. If lazy is true, the record of the streamerinfos is
+/// still read at file opening, but the TStreamerInfo objects are only indexed
+/// by class name. They are built the first time an object of their class is
+/// read from the file, see TFile::LoadStreamerInfo.
+///
+/// This has no effect on files opened for writing, whose streamerinfos are
+/// always built at opening.
+
+void TFile::SetReadStreamerInfoLazily(Bool_t lazy)
+{
+   fgReadInfoLazily = lazy;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// If the streamerinfos of the files opened read-only are built on first use.
+///
+/// See TFile::SetReadStreamerInfoLazily for more documentation.
+
+Bool_t TFile::GetReadStreamerInfoLazily()
+{
+   return fgReadInfoLazily;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Show the StreamerInfo of all classes written to this file.
 
@@ -337,6 +337,7 @@ void TFileCacheRead::Print(Option_t *option) const
    if (fPrefetch){
      printf("Prefetching .......................: %lli blocks\n", fPrefetchedBlocks);
      printf("Prefetching Wait Time..............: %f seconds\n", fPrefetch->GetWaitTime() / 1e+6);
+     printf("Prefetching requests per block.....: up to %d of at least %lld bytes\n", fPrefetch->GetNThreads(), fPrefetch->GetPieceSize());
    }
 
    if (!opt.Contains("a")) return;
@@ -50,6 +50,9 @@ to be merged, like the standalone hadd program.
 #endif
 
 #include <cstring>
+#include <algorithm>
+#include <memory>
+#include <thread>
 
 ClassImp(TFileMerger);
 
@@ -964,6 +967,9 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
 
    Bool_t result = kTRUE;
    Int_t type = in_type;
+   std::vector<TString> partialFiles;
+   if (fNParallelMerges > 1 && !fExcessFiles.GetEntries())
+      result = MergeInParallel(type, partialFiles);
    while (result && fFileList.GetEntries()>0) {
       result = MergeRecursive(fOutputFile, &fFileList, type);
 
@@ -991,6 +997,8 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
          result = OpenExcessFiles();
       }
    }
+   for (const auto &partial : partialFiles)
+      gSystem->Unlink(partial);
    if (!result) {
       Error("Merge", "error during merge of your ROOT files");
    } else {
@@ -1025,6 +1033,98 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Merge the input files in `n` groups of consecutive files concurrently, each
+/// into a partial file written in `workingDir` (the temporary directory by
+/// default); the partial files are then merged into the output file. Every
+/// object, including the fast cloning of the trees, is merged concurrently for
+/// the different groups, at the cost of writing and reading the partial files.
+/// This calls ROOT::EnableThreadSafety(). The files exceeding the maximum
+/// number of opened files are not merged concurrently.
+///
+/// This is the multi-threaded version of `hadd -j`: a single output file
+/// cannot be written from several threads.
+
+void TFileMerger::SetParallelMerges(Int_t n, const char *workingDir)
+{
+   fNParallelMerges = n;
+   fParallelDir = workingDir;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Merge the files of fFileList into fNParallelMerges partial files
+/// concurrently, and replace them in fFileList by the partial files, whose
+/// names are appended to `partialFiles`. Each group has at least two files.
+
+Bool_t TFileMerger::MergeInParallel(Int_t type, std::vector<TString> &partialFiles)
+{
+   const Int_t nFiles = fFileList.GetEntries();
+   const Int_t nGroups = std::min(fNParallelMerges, nFiles / 2);
+   if (nGroups < 2)
+      return kTRUE;
+
+   ROOT::EnableThreadSafety();
+   const TString dir = fParallelDir.IsNull() ? TString(gSystem->TempDirectory()) : fParallelDir;
+   const TString tail = TUUID().AsString();
+   std::vector<std::unique_ptr<TFileMerger>> mergers;
+   for (Int_t g = 0; g < nGroups; ++g) {
+      auto merger = std::make_unique<TFileMerger>(kFALSE, fHistoOneGo);
+      merger->SetMsgPrefix(fMsgPrefix);
+      merger->SetPrintLevel(fPrintLevel - 1);
+      merger->fFastMethod = fFastMethod;
+      merger->fNoTrees = fNoTrees;
+      merger->fMergeOptions = fMergeOptions;
+      merger->fIOFeatures = fIOFeatures;
+      merger->fObjectNames = fObjectNames;
+      partialFiles.emplace_back(TString::Format("%s/TFileMerger_partial%d_%s.root", dir.Data(), g, tail.Data()));
+      if (!merger->OutputFile(partialFiles.back(), "RECREATE", fOutputFile->GetCompressionSettings()))
+         return kFALSE;
+      merger->fExplicitCompLevel = fExplicitCompLevel;
+      merger->fCompressionChange = fCompressionChange;
+      mergers.emplace_back(std::move(merger));
+   }
+   // consecutive files go to the same group, so that the entries of the trees stay in order
+   Int_t i = 0;
+   for (TObject *file : fFileList)
+      mergers[i++ * nGroups / nFiles]->fFileList.Add(file);
+
+   const Int_t partialType = type & ~(kIncremental | kDelayWrite);
+   std::vector<Int_t> results(nGroups, kFALSE); // not std::vector<bool>, written from different threads
+   std::vector<std::thread> threads;
+   for (Int_t g = 0; g < nGroups; ++g)
+      threads.emplace_back([&, g]() { results[g] = mergers[g]->PartialMerge(partialType); });
+   for (auto &thread : threads)
+      thread.join();
+
+   // the input files were closed by the partial merges, remove the local copies if there are any
+   if (fLocal) {
+      for (TObject *file : fFileList) {
+         if (file->InheritsFrom(TMemFile::Class()))
+            continue;
+         TString p(static_cast<TFile *>(file)->GetPath());
+         p = p(0, p.Index(':', 0));
+         gSystem->Unlink(p);
+      }
+   }
+   fFileList.Clear();
+   if (std::find(results.begin(), results.end(), kFALSE) != results.end()) {
+      Error("MergeInParallel", "error during a partial merge");
+      return kFALSE;
+   }
+
+   for (const auto &partial : partialFiles) {
+      TFile *file = TFile::Open(partial, "READ");
+      if (!file || file->IsZombie()) {
+         Error("MergeInParallel", "cannot open the partial file %s", partial.Data());
+         delete file;
+         return kFALSE;
+      }
+      file->SetBit(kCanDelete);
+      fFileList.Add(file);
+   }
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Open up to fMaxOpenedFiles of the excess files.
 
@@ -17,8 +17,11 @@
 #include "TVirtualMonitoring.h"
 #include "TSemaphore.h"
 #include "TFPBlock.h"
+#include "TEnv.h"
 #include "strlcpy.h"
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <sstream>
 #include <cstdio>
@@ -27,6 +30,9 @@
 #include <cassert>
 
 static const int kMAX_READ_SIZE    = 2;   //maximum size of the read list of blocks
+static const int kMAX_CACHE_QUEUE  = 4;   //maximum number of blocks waiting to be written in the cache directory
+static const Long64_t kMIN_PIECE_SIZE = 256 * 1024;       //minimum size of a piece of block read concurrently
+static const Long64_t kMAX_PIECE_SIZE = 64 * 1024 * 1024; //maximum size of a piece derived from the measured latency
 
 inline int xtod(char c) { return (c>='0' && c<='9') ? c-'0' : ((c>='A' && c<='F') ? c-'A'+10 : ((c>='a' && c<='f') ? c-'a'+10 : 0)); }
 
@@ -47,6 +53,18 @@ processing considerably decreases. Besides the prefetching
 mechanisms there is also a local caching option which can be
 enabled by the user. Both capabilities are disabled by default
 and must be explicitly enabled by the user.
+
+For the files which support concurrent calls to TFile::ReadBuffers()
+(see TFile::SupportsConcurrentReads(), e.g. TNetXNGFile and TDavixFile)
+a block is split in up to `TFile.AsyncPrefetching.Threads` pieces (4 by
+default) which are requested at the same time, hiding the round trip
+time of each request. The size of the pieces is tuned from the latency
+and the bandwidth measured for the previous requests: it is at least a
+few times the bandwidth-delay product, so that the cost of the round trip
+stays small compared to the transfer of a piece.
+The blocks saved in the local cache directory are written by a
+background thread, so that they don't delay the reading of the next
+blocks.
 */
 
 
@@ -57,8 +75,13 @@ TFilePrefetch::TFilePrefetch(TFile* file) :
   fFile(file),
   fConsumer(0),
   fThreadJoined(kTRUE),
-  fPrefetchFinished(kFALSE)
+  fPrefetchFinished(kFALSE),
+  fLatency(0),
+  fBandwidth(0),
+  fCacheWriterStop(kFALSE)
 {
+   SetNThreads(gEnv->GetValue("TFile.AsyncPrefetching.Threads", 4));
+
    fPendingBlocks    = new TList();
    fReadBlocks       = new TList();
 
@@ -76,6 +99,7 @@ TFilePrefetch::~TFilePrefetch()
    if (!fThreadJoined) {
      WaitFinishPrefetch();
    }
+   FinishCacheWrites();
 
    SafeDelete(fConsumer);
    SafeDelete(fPendingBlocks);
@@ -99,6 +123,8 @@ void TFilePrefetch::WaitFinishPrefetch()
    fConsumer->Join();
    fThreadJoined = kTRUE;
    fPrefetchFinished = kFALSE;
+
+   FinishCacheWrites();
 }
 
 
@@ -114,7 +140,14 @@ void TFilePrefetch::ReadAsync(TFPBlock* block, Bool_t &inCache)
       inCache = kTRUE;
    }
    else{
-      fFile->ReadBuffers(block->GetBuffer(), block->GetPos(), block->GetLen(), block->GetNoElem());
+      if (fNThreads > 1 && block->GetNoElem() > 1 && fFile->SupportsConcurrentReads()) {
+         ReadPieces(block);
+      } else {
+         auto start = std::chrono::steady_clock::now();
+         fFile->ReadBuffers(block->GetBuffer(), block->GetPos(), block->GetLen(), block->GetNoElem());
+         UpdateReadStats(block->GetDataSize(),
+                         std::chrono::duration<Double_t>(std::chrono::steady_clock::now() - start).count());
+      }
       if (fFile->GetArchive()) {
          for (Int_t i = 0; i < block->GetNoElem(); i++)
             block->SetPos(i, block->GetPos(i) - fFile->GetArchiveOffset());
@@ -124,6 +157,75 @@ void TFilePrefetch::ReadAsync(TFPBlock* block, Bool_t &inCache)
    delete[] path;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the elements of a block with up to fNThreads concurrent requests,
+/// each of them reading a contiguous range of elements.
+
+void TFilePrefetch::ReadPieces(TFPBlock* block)
+{
+   const Int_t nelem = block->GetNoElem();
+   const Long64_t pieceSize = std::max(GetPieceSize(), (block->GetDataSize() + fNThreads - 1) / fNThreads);
+
+   // index of the first element of each piece, followed by the end of the last one
+   std::vector<Int_t> firsts;
+   Long64_t size = 0;
+   for (Int_t i = 0; i < nelem; i++) {
+      if (i == 0 || (size >= pieceSize && (Int_t)firsts.size() < fNThreads)) {
+         firsts.push_back(i);
+         size = 0;
+      }
+      size += block->GetLen(i);
+   }
+   firsts.push_back(nelem);
+
+   auto readPiece = [this, block](Int_t first, Int_t last) {
+      auto start = std::chrono::steady_clock::now();
+      fFile->ReadBuffers(block->GetPtrToPiece(first), block->GetPos() + first, block->GetLen() + first, last - first);
+      Long64_t bytes = 0;
+      for (Int_t i = first; i < last; i++)
+         bytes += block->GetLen(i);
+      UpdateReadStats(bytes, std::chrono::duration<Double_t>(std::chrono::steady_clock::now() - start).count());
+   };
+
+   std::vector<std::thread> threads;
+   for (size_t p = 1; p + 1 < firsts.size(); p++)
+      threads.emplace_back(readPiece, firsts[p], firsts[p + 1]);
+   readPiece(firsts[0], firsts[1]);
+   for (auto &thread : threads)
+      thread.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Account for a read request of `bytes` bytes which took `seconds`.
+///
+/// The latency is estimated by the fastest request, the bandwidth by a moving
+/// average over the requests which took significantly longer than the latency.
+
+void TFilePrefetch::UpdateReadStats(Long64_t bytes, Double_t seconds)
+{
+   if (seconds <= 0)
+      return;
+
+   std::lock_guard<std::mutex> lk(fMutexStats);
+   if (fLatency == 0 || seconds < fLatency)
+      fLatency = seconds;
+   if (seconds > 2 * fLatency) {
+      Double_t bandwidth = bytes / (seconds - fLatency);
+      fBandwidth = (fBandwidth == 0) ? bandwidth : 0.75 * fBandwidth + 0.25 * bandwidth;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the size of the pieces in which a block is split: four times the
+/// bandwidth-delay product measured so far, at least kMIN_PIECE_SIZE.
+
+Long64_t TFilePrefetch::GetPieceSize() const
+{
+   std::lock_guard<std::mutex> lk(fMutexStats);
+   Long64_t size = (Long64_t)(4 * fLatency * fBandwidth);
+   return std::min(std::max(size, kMIN_PIECE_SIZE), kMAX_PIECE_SIZE);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get blocks specified in prefetchBlocks.
 
@@ -392,49 +494,56 @@ Int_t TFilePrefetch::SumHex(const char *hex)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Test if the block is in cache.
+/// Return the path of the file holding the block in the cache directory. If
+/// `create` the subdirectory holding it is created if needed.
 
-Bool_t TFilePrefetch::CheckBlockInCache(char*& path, TFPBlock* block)
+TString TFilePrefetch::GetBlockCachePath(TFPBlock* block, Bool_t create)
 {
-   if (fPathCache == "")
-      return false;
-
-   Bool_t found = false;
    TString fullPath(fPathCache); // path of the cached files.
 
-   Int_t value = 0;
-
-   if (!gSystem->OpenDirectory(fullPath))
+   if (create && !gSystem->OpenDirectory(fullPath))
       gSystem->mkdir(fullPath);
 
    //dir is SHA1 value modulo 16; filename is the value of the SHA1(offset+len)
-   TMD5* md = new TMD5();
+   TMD5 md;
 
    TString concatStr;
    for (Int_t i=0; i < block->GetNoElem(); i++){
       concatStr.Form("%lld", block->GetPos(i));
-      md->Update((UChar_t*)concatStr.Data(), concatStr.Length());
+      md.Update((UChar_t*)concatStr.Data(), concatStr.Length());
    }
 
-   md->Final();
-   TString fileName( md->AsString() );
-   value = SumHex(fileName);
+   md.Final();
+   TString fileName( md.AsString() );
+   Int_t value = SumHex(fileName);
    value = value % 16;
    TString dirName;
    dirName.Form("%i", value);
 
-   fullPath += "/" + dirName + "/" + fileName;
+   fullPath += "/" + dirName;
+   if (create && !gSystem->OpenDirectory(fullPath))
+      gSystem->mkdir(fullPath);
+
+   return fullPath + "/" + fileName;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Test if the block is in cache.
+
+Bool_t TFilePrefetch::CheckBlockInCache(char*& path, TFPBlock* block)
+{
+   if (fPathCache == "")
+      return false;
+
+   TString fullPath = GetBlockCachePath(block, kTRUE);
 
    FileStat_t stat;
    if (gSystem->GetPathInfo(fullPath, stat) == 0) {
       path = new char[fullPath.Length() + 1];
       strlcpy(path, fullPath,fullPath.Length() + 1);
-      found = true;
-   } else
-      found = false;
-
-   delete md;
-   return found;
+      return true;
+   }
+   return false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -472,56 +581,82 @@ char* TFilePrefetch::GetBlockFromCache(const char* path, Int_t length)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Save the block content in cache.
+///
+/// The content is copied and written by a background thread; at most
+/// kMAX_CACHE_QUEUE blocks wait to be written, this method blocks beyond.
 
 void TFilePrefetch::SaveBlockInCache(TFPBlock* block)
 {
    if (fPathCache == "")
       return;
 
-   //dir is SHA1 value modulo 16; filename is the value of the SHA1
-   TMD5* md = new TMD5();
+   CachedBlock cached;
+   cached.fPath = GetBlockCachePath(block, kTRUE);
+   cached.fBuffer.assign(block->GetBuffer(), block->GetBuffer() + block->GetDataSize());
 
-   TString concatStr;
-   for(Int_t i=0; i< block->GetNoElem(); i++){
-      concatStr.Form("%lld", block->GetPos(i));
-      md->Update((UChar_t*)concatStr.Data(), concatStr.Length());
-   }
-   md->Final();
+   std::unique_lock<std::mutex> lk(fMutexCacheQueue);
+   fCacheQueueChanged.wait(lk, [&]{ return fCacheQueue.size() < (size_t)kMAX_CACHE_QUEUE; });
+   fCacheQueue.push_back(std::move(cached));
+   if (!fCacheWriter.joinable())
+      fCacheWriter = std::thread(&TFilePrefetch::WriteCacheQueue, this);
+   lk.unlock();
 
-   TString fileName( md->AsString() );
-   Int_t value = SumHex(fileName);
-   value = value % 16;
+   fCacheQueueChanged.notify_all();
+}
 
-   TString fullPath( fPathCache );
-   TString dirName;
-   dirName.Form("%i", value);
-   fullPath += ("/" + dirName);
+////////////////////////////////////////////////////////////////////////////////
+/// Execution loop of the thread writing the blocks to the cache directory.
+///
+/// A block is written to a temporary file renamed once complete, so that
+/// CheckBlockInCache() never finds a partially written block.
 
-   if (!gSystem->OpenDirectory(fullPath))
-      gSystem->mkdir(fullPath);
+void TFilePrefetch::WriteCacheQueue()
+{
+   std::unique_lock<std::mutex> lk(fMutexCacheQueue);
+   while (true) {
+      fCacheQueueChanged.wait(lk, [&]{ return !fCacheQueue.empty() || fCacheWriterStop; });
+      if (fCacheQueue.empty())
+         break;
+      CachedBlock cached = std::move(fCacheQueue.front());
+      fCacheQueue.pop_front();
+      lk.unlock();
+      fCacheQueueChanged.notify_all();
+
+      TString tmpPath;
+      tmpPath.Form("%s.%d.tmp", cached.fPath.Data(), gSystem->GetPid());
+      TFile* file = TFile::Open(tmpPath + "?filetype=raw", "recreate");
+      if (file) {
+         // coverity[unchecked_value] We do not print error message, have not error
+         // return code and close the file anyway, not need to check the return value.
+         file->WriteBuffer(cached.fBuffer.data(), cached.fBuffer.size());
+         file->Close();
+         delete file;
+         if (gSystem->Rename(tmpPath, cached.fPath))
+            gSystem->Unlink(tmpPath);
+      }
 
-   TFile* file = 0;
-   fullPath += ("/" + fileName);
-   FileStat_t stat;
-   if (gSystem->GetPathInfo(fullPath, stat) == 0) {
-      fullPath += "?filetype=raw";
-      file = TFile::Open(fullPath, "update");
-   } else{
-      fullPath += "?filetype=raw";
-      file = TFile::Open(fullPath, "new");
+      lk.lock();
    }
+}
 
-   if (file) {
-      // coverity[unchecked_value] We do not print error message, have not error
-      // return code and close the file anyway, not need to check the return value.
-      file->WriteBuffer(block->GetBuffer(), block->GetDataSize());
-      file->Close();
-      delete file;
+////////////////////////////////////////////////////////////////////////////////
+/// Write the blocks waiting in the queue to the cache directory and stop the
+/// thread writing them.
+
+void TFilePrefetch::FinishCacheWrites()
+{
+   if (!fCacheWriter.joinable())
+      return;
+
+   {
+      std::lock_guard<std::mutex> lk(fMutexCacheQueue);
+      fCacheWriterStop = kTRUE;
    }
-   delete md;
+   fCacheQueueChanged.notify_all();
+   fCacheWriter.join();
+   fCacheWriterStop = kFALSE;
 }
 
-
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the path of the cache directory.
 
@@ -15,6 +15,24 @@
 
 A TMemFile is like a normal TFile except that it reads and writes
 only from memory.
+
+The memory can be a shared memory region, identified by a file descriptor
+(see the constructor taking a TMemFile::SharedMemory_t): the content written
+by a process can then be read by another one without being copied or sent,
+e.g. by the parent of a worker process created with fork(), which inherits
+the descriptors of its parent:
+~~~{.cpp}
+int fd = TMemFile::CreateSharedMemory("output");
+if (fork() == 0) {
+   TMemFile out("output", TMemFile::SharedMemory_t(fd), "RECREATE");
+   ... // write the output of the worker
+   out.Write();
+   out.Close();
+   _exit(0);
+}
+wait(nullptr);
+TMemFile in("output", TMemFile::SharedMemory_t(fd)); // maps the output, copy-on-write
+~~~
 */
 
 #include "TBufferFile.h"
@@ -30,6 +48,12 @@ only from memory.
 #include <errno.h>
 #include <stdio.h>
 #include <sys/stat.h>
+#include <string>
+#ifndef R__WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 // The following snippet is used for developer-level debugging
 #define TMemFile_TRACE
@@ -72,6 +96,12 @@ TMemFile::TMemBlock::TMemBlock(UChar_t *data, Long64_t size) : fBuffer(data), fS
 TMemFile::TMemBlock::~TMemBlock()
 {
    delete fNext;
+#ifndef R__WIN32
+   if (fMapped) {
+      munmap(fBuffer, fSize);
+      return;
+   }
+#endif
    delete [] fBuffer;
 }
 
@@ -208,6 +238,169 @@ zombie:
    gDirectory = gROOT;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor of a TMemFile whose content is in a shared memory region.
+///
+/// When the file is opened for reading (the default), `shm` is an existing
+/// region, e.g. written by another process: it is mapped copy-on-write, the
+/// TMemFile sees its content without copying it and never modifies it.
+///
+/// With the options "CREATE" or "RECREATE", the blocks of the TMemFile are
+/// allocated in the region `shm`, which is emptied first, or in a new region
+/// if its descriptor is negative (see GetSharedMemoryFd()). Such a file
+/// cannot be updated: "UPDATE" is not supported.
+///
+/// See the TFile constructor for the other parameters.
+
+TMemFile::TMemFile(const char *path, const SharedMemory_t &shm, Option_t *option, const char *ftitle, Int_t compress,
+                   Long64_t defBlockSize)
+   : TFile(path, "WEB", ftitle, compress), fBlockList(-1), fIsOwnedByROOT(kTRUE), fBlockSeek(&(fBlockList))
+{
+   EMode optmode = ParseOption(option);
+#ifdef R__WIN32
+   (void)shm;
+   (void)defBlockSize;
+   (void)optmode;
+   Error("TMemFile", "%s: shared memory files are not supported on this platform", path);
+#else
+   struct stat st;
+   void *addr = MAP_FAILED;
+
+   fShmFd = shm.fFd;
+   if (NeedsToWrite(optmode)) {
+      if (optmode == EMode::kUpdate) {
+         Error("TMemFile", "%s: a shared memory file can only be created or read, not updated", path);
+         goto zombie;
+      }
+      if (fShmFd < 0) {
+         fShmFd = CreateSharedMemory(path);
+         fShmOwned = fShmFd >= 0;
+         if (fShmFd < 0)
+            goto zombie;
+      } else if (ftruncate(fShmFd, 0)) {
+         SysError("TMemFile", "cannot reset the shared memory of %s", path);
+         goto zombie;
+      }
+
+      // the blocks are mapped at their offset in the region, which must be a multiple of the page size
+      const Long64_t page = sysconf(_SC_PAGESIZE);
+      fDefaultBlockSize = defBlockSize == 0LL ? fgDefaultBlockSize : defBlockSize;
+      fDefaultBlockSize = (fDefaultBlockSize + page - 1) / page * page;
+
+      fD = TMemFile::SysOpen(path, O_RDWR | O_CREAT, 0644);
+      if (fD == -1) {
+         SysError("TMemFile", "file %s can not be opened", path);
+         goto zombie;
+      }
+      fWritable = kTRUE;
+      Init(kTRUE);
+      return;
+   }
+
+   if (fShmFd < 0 || fstat(fShmFd, &st) || st.st_size <= 0) {
+      Error("TMemFile", "%s: the descriptor %d is not a shared memory file", path, fShmFd);
+      goto zombie;
+   }
+   addr = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fShmFd, 0);
+   if (addr == MAP_FAILED) {
+      SysError("TMemFile", "cannot map the shared memory of %s", path);
+      goto zombie;
+   }
+   fBlockList.fBuffer = static_cast<UChar_t *>(addr);
+   fBlockList.fSize = st.st_size;
+   fBlockList.fMapped = kTRUE;
+   fSize = st.st_size;
+   fD = 0;
+   fWritable = kFALSE;
+   Init(kFALSE);
+   return;
+
+zombie:
+#endif
+   // Error in opening file; make this a zombie
+   MakeZombie();
+   gDirectory = gROOT;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create a shared memory region to hold the content of a TMemFile (see the
+/// constructor taking a TMemFile::SharedMemory_t) and return its descriptor,
+/// or -1 in case of error. The caller owns the descriptor: it must close it.
+
+Int_t TMemFile::CreateSharedMemory(const char *name)
+{
+#ifdef R__WIN32
+   ::Error("TMemFile::CreateSharedMemory", "%s: shared memory files are not supported on this platform", name);
+   return -1;
+#else
+   Int_t fd = -1;
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+   fd = memfd_create(name, MFD_CLOEXEC);
+#else
+   // an unlinked temporary file: unlike POSIX shared memory, it can grow on all platforms
+   std::string templ = std::string(gSystem->TempDirectory()) + "/TMemFile-XXXXXX";
+   fd = mkstemp(&templ[0]);
+   if (fd >= 0)
+      unlink(templ.c_str());
+#endif
+   if (fd < 0)
+      ::SysError("TMemFile::CreateSharedMemory", "cannot create the shared memory of %s", name);
+   return fd;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Map `size` bytes at `offset` of the shared memory region, extending it.
+/// Returns nullptr in case of error.
+
+UChar_t *TMemFile::MapSharedBlock(Long64_t offset, Long64_t size)
+{
+#ifndef R__WIN32
+   if (ftruncate(fShmFd, offset + size)) {
+      SysError("MapSharedBlock", "cannot extend the shared memory of %s", GetName());
+      return nullptr;
+   }
+   void *addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fShmFd, offset);
+   if (addr == MAP_FAILED) {
+      SysError("MapSharedBlock", "cannot map the shared memory of %s", GetName());
+      return nullptr;
+   }
+   return static_cast<UChar_t *>(addr);
+#else
+   (void)offset;
+   (void)size;
+   return nullptr;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add a block of fDefaultBlockSize bytes after `last`, the last block.
+///
+/// If the block cannot be allocated in the shared memory region, it is
+/// allocated on the heap and the content of the file is no longer shared.
+
+void TMemFile::AddBlock(TMemBlock *last)
+{
+   UChar_t *buffer = fShmFd >= 0 ? MapSharedBlock(fSize, fDefaultBlockSize) : nullptr;
+   if (fShmFd >= 0 && !buffer) {
+      Error("AddBlock", "the content of %s is no longer in shared memory", GetName());
+#ifndef R__WIN32
+      if (fShmOwned)
+         close(fShmFd);
+#endif
+      fShmFd = -1;
+      fShmOwned = kFALSE;
+   }
+   if (buffer) {
+      last->fNext = new TMemBlock(buffer, fDefaultBlockSize);
+      last->fNext->fPrevious = last;
+      last->fNext->fMapped = kTRUE;
+   } else {
+      last->CreateNext(fDefaultBlockSize);
+   }
+   fSize += fDefaultBlockSize;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copying the content of the TMemFile into another TMemFile.
 
@@ -244,6 +437,11 @@ TMemFile::~TMemFile()
       // We must not get extra blocks, as writing is disabled for external data!
       R__ASSERT(!fBlockList.fNext && "External block is not the only one!");
    }
+#ifndef R__WIN32
+   // the blocks can stay mapped after the descriptor is closed
+   if (fShmOwned)
+      close(fShmFd);
+#endif
    TRACE("destroy")
 }
 
@@ -572,6 +770,14 @@ Long64_t TMemFile::SysSeek(Int_t, Long64_t offset, Int_t whence)
 
 Int_t TMemFile::SysOpen(const char * /* pathname */, Int_t /* flags */, UInt_t /* mode */)
 {
+   if (!fBlockList.fBuffer && fShmFd >= 0) {
+      fBlockList.fBuffer = MapSharedBlock(0, fDefaultBlockSize);
+      if (!fBlockList.fBuffer)
+         return -1;
+      fBlockList.fMapped = kTRUE;
+      fBlockList.fSize = fDefaultBlockSize;
+      fSize = fDefaultBlockSize;
+   }
    if (!fBlockList.fBuffer) {
       fBlockList.fBuffer = new UChar_t[fDefaultBlockSize];
       fBlockList.fSize = fDefaultBlockSize;
@@ -625,10 +831,8 @@ Int_t TMemFile::SysWriteImpl(Int_t /* fd */, const void *buf, Long64_t len)
          // Move to the next.
          buf = (char*)buf + sublen;
          Int_t len_left = len - sublen;
-         if (!fBlockSeek->fNext) {
-            fBlockSeek->CreateNext(fDefaultBlockSize);
-            fSize += fDefaultBlockSize;
-         }
+         if (!fBlockSeek->fNext)
+            AddBlock(fBlockSeek);
          fBlockSeek = fBlockSeek->fNext;
 
          // Copy all the full blocks that are covered by the request.
@@ -638,10 +842,8 @@ Int_t TMemFile::SysWriteImpl(Int_t /* fd */, const void *buf, Long64_t len)
             memcpy(fBlockSeek->fBuffer, buf, fBlockSeek->fSize);
             buf = (char*)buf + fBlockSeek->fSize;
             len_left -= fBlockSeek->fSize;
-            if (!fBlockSeek->fNext) {
-               fBlockSeek->CreateNext(fDefaultBlockSize);
-               fSize += fDefaultBlockSize;
-            }
+            if (!fBlockSeek->fNext)
+               AddBlock(fBlockSeek);
             fBlockSeek = fBlockSeek->fNext;
          }
 
@@ -3038,9 +3038,11 @@ void TStreamerInfo::Compile()
 
    if (fReadObjectWise) fReadObjectWise->fActions.clear();
    else fReadObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
+   fReadObjectWise->fDirectStreamer = nullptr;
 
    if (fWriteObjectWise) fWriteObjectWise->fActions.clear();
    else fWriteObjectWise = new TStreamerInfoActions::TActionSequence(this,ndata);
+   fWriteObjectWise->fDirectStreamer = nullptr;
 
    if (fReadMemberWise) fReadMemberWise->fActions.clear();
    else fReadMemberWise = new TStreamerInfoActions::TActionSequence(this,ndata);
@@ -3233,6 +3235,21 @@ void TStreamerInfo::Compile()
       AddReadTextAction(fReadText, i, fCompFull[i]);
       AddWriteTextAction(fWriteText, i, fCompFull[i]);
    }
+
+   // The streamer generated by rootcling for the data members can replace the object-wise actions
+   // only if the data have exactly the layout of the class in memory.
+   if (ClassStreamerFunc_t direct = fClass->GetDirectStreamerFunc()) {
+      Bool_t sameLayout = fClassVersion == fClass->GetClassVersion() && fCheckSum == fClass->GetCheckSum();
+      for (i = 0; sameLayout && i < fNfulldata; ++i) {
+         const TStreamerElement *elem = fCompFull[i]->fElem;
+         sameLayout = elem && elem->GetType() >= 0 && elem->GetType() == elem->GetNewType() &&
+                      elem->IsA() != TStreamerArtificial::Class() && !elem->TestBit(TStreamerElement::kCache);
+      }
+      if (sameLayout) {
+         fReadObjectWise->fDirectStreamer = direct;
+         fWriteObjectWise->fDirectStreamer = direct;
+      }
+   }
    ComputeSize();
 
    fOptimized = isOptimized;
@@ -0,0 +1,16 @@
+#ifndef ROOT_IO_TEST_DIRECTSTREAMER
+#define ROOT_IO_TEST_DIRECTSTREAMER
+
+#include "Rtypes.h"
+
+// Selected with the directstreamer option: its data members are streamed by a generated function
+struct DirectStreamerHit {
+   Int_t fId = 0;
+   Float_t fPos[3] = {0, 0, 0};
+   Double_t fEnergy = 0;
+   Bool_t fGood = false;
+   Short_t fLayers[2][2] = {{0, 0}, {0, 0}};
+   Int_t fCache = 0; //! transient
+};
+
+#endif
@@ -0,0 +1,6 @@
+#ifdef __CLING__
+
+#pragma link C++ options=directstreamer class DirectStreamerHit+;
+#pragma link C++ class std::vector<DirectStreamerHit>+;
+
+#endif
@@ -0,0 +1,71 @@
+#include "DirectStreamer.h"
+
+#include "TClass.h"
+#include "TMemFile.h"
+#include "TStreamerInfo.h"
+#include "TStreamerInfoActions.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+DirectStreamerHit MakeHit(int i)
+{
+   DirectStreamerHit hit;
+   hit.fId = i;
+   for (int j = 0; j < 3; ++j)
+      hit.fPos[j] = i + 0.5f * j;
+   hit.fEnergy = 10. * i;
+   hit.fGood = i % 2;
+   for (int j = 0; j < 4; ++j)
+      hit.fLayers[j / 2][j % 2] = i + j;
+   hit.fCache = 42;
+   return hit;
+}
+
+void ExpectEqual(const DirectStreamerHit &hit, const DirectStreamerHit &expected)
+{
+   EXPECT_EQ(hit.fId, expected.fId);
+   for (int j = 0; j < 3; ++j)
+      EXPECT_EQ(hit.fPos[j], expected.fPos[j]);
+   EXPECT_EQ(hit.fEnergy, expected.fEnergy);
+   EXPECT_EQ(hit.fGood, expected.fGood);
+   for (int j = 0; j < 4; ++j)
+      EXPECT_EQ(hit.fLayers[j / 2][j % 2], expected.fLayers[j / 2][j % 2]);
+   EXPECT_EQ(hit.fCache, 0);
+}
+
+} // anonymous namespace
+
+TEST(DirectStreamer, ReplacesActions)
+{
+   auto cl = TClass::GetClass<DirectStreamerHit>();
+   ASSERT_NE(cl->GetDirectStreamerFunc(), nullptr);
+   auto info = static_cast<TStreamerInfo *>(cl->GetStreamerInfo());
+   EXPECT_EQ(info->GetReadObjectWiseActions()->fDirectStreamer, cl->GetDirectStreamerFunc());
+   EXPECT_EQ(info->GetWriteObjectWiseActions()->fDirectStreamer, cl->GetDirectStreamerFunc());
+}
+
+TEST(DirectStreamer, RoundTrip)
+{
+   TMemFile file("directstreamer.root", "RECREATE");
+   auto hit = MakeHit(3);
+   std::vector<DirectStreamerHit> hits;
+   for (int i = 0; i < 10; ++i)
+      hits.push_back(MakeHit(i));
+   file.WriteObject(&hit, "hit");
+   file.WriteObject(&hits, "hits");
+
+   std::unique_ptr<DirectStreamerHit> readHit(file.Get<DirectStreamerHit>("hit"));
+   ASSERT_NE(readHit, nullptr);
+   ExpectEqual(*readHit, MakeHit(3));
+
+   std::unique_ptr<std::vector<DirectStreamerHit>> readHits(file.Get<std::vector<DirectStreamerHit>>("hits"));
+   ASSERT_NE(readHits, nullptr);
+   ASSERT_EQ(readHits->size(), 10u);
+   for (int i = 0; i < 10; ++i)
+      ExpectEqual((*readHits)[i], MakeHit(i));
+}
@@ -0,0 +1,147 @@
+#include "ROOT/RBlockCache.hxx"
+#include "TSystem.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using ROOT::Internal::RBlockCache;
+
+namespace {
+
+/// Serves a file held in memory and counts the bytes fetched by the cache
+struct RRemoteMock {
+   std::string fContent;
+   std::size_t fNFetched = 0;
+   std::size_t fNFetchCalls = 0;
+
+   bool operator()(std::vector<RBlockCache::RRange> &ranges)
+   {
+      fNFetchCalls++;
+      for (auto &r : ranges) {
+         if (r.fOffset + r.fSize > fContent.size())
+            return false;
+         memcpy(r.fBuffer, fContent.data() + r.fOffset, r.fSize);
+         fNFetched += r.fSize;
+      }
+      return true;
+   }
+};
+
+/// A cache in a fresh directory, removed at the end of the test
+class RBlockCacheRaii {
+   std::string fDirectory;
+   RBlockCache fCache;
+
+public:
+   RBlockCacheRaii(const std::string &name, std::uint64_t maxSize)
+      : fDirectory(std::string(gSystem->TempDirectory()) + "/" + name + std::to_string(gSystem->GetPid())),
+        fCache(fDirectory, maxSize)
+   {
+      gSystem->mkdir(fDirectory.c_str(), kTRUE);
+   }
+   ~RBlockCacheRaii()
+   {
+      fCache.Clear();
+      gSystem->Unlink(fDirectory.c_str());
+   }
+   RBlockCache &Get() { return fCache; }
+};
+
+std::string MakeContent(std::size_t size)
+{
+   std::string content(size, 0);
+   for (std::size_t i = 0; i < size; ++i)
+      content[i] = static_cast<char>((i * 7919) % 251);
+   return content;
+}
+
+} // anonymous namespace
+
+TEST(RBlockCache, ReadV)
+{
+   RBlockCacheRaii guard("test_blockcache_readv", 64 * RBlockCache::kBlockSize);
+   auto &cache = guard.Get();
+   RRemoteMock remote;
+   remote.fContent = MakeContent(3 * RBlockCache::kBlockSize + 1000);
+   const auto fileId = RBlockCache::MakeFileId("root://host//file.root", remote.fContent.size(), 42);
+   auto fetch = [&remote](std::vector<RBlockCache::RRange> &ranges) { return remote(ranges); };
+
+   // A range across the first two blocks, and one in the short last block
+   std::vector<char> buf1(200), buf2(500);
+   RBlockCache::RRange ranges[2] = {{buf1.data(), RBlockCache::kBlockSize - 100, buf1.size()},
+                                    {buf2.data(), 3 * RBlockCache::kBlockSize + 400, buf2.size()}};
+   EXPECT_TRUE(cache.ReadV(fileId, remote.fContent.size(), ranges, 2, fetch));
+   EXPECT_EQ(0, memcmp(buf1.data(), remote.fContent.data() + ranges[0].fOffset, buf1.size()));
+   EXPECT_EQ(0, memcmp(buf2.data(), remote.fContent.data() + ranges[1].fOffset, buf2.size()));
+   EXPECT_EQ(1u, remote.fNFetchCalls);
+   EXPECT_EQ(2 * RBlockCache::kBlockSize + 1000, remote.fNFetched);
+   EXPECT_EQ(0u, cache.GetNHits());
+   EXPECT_EQ(3u, cache.GetNMisses());
+
+   // The same blocks come from the cache now, also for a second instance on the same directory
+   std::fill(buf1.begin(), buf1.end(), 0);
+   EXPECT_TRUE(cache.ReadV(fileId, remote.fContent.size(), ranges, 1, fetch));
+   EXPECT_EQ(0, memcmp(buf1.data(), remote.fContent.data() + ranges[0].fOffset, buf1.size()));
+   EXPECT_EQ(1u, remote.fNFetchCalls);
+   EXPECT_EQ(2u, cache.GetNHits());
+
+   RBlockCache other(cache.GetDirectory(), cache.GetMaxSize());
+   std::fill(buf2.begin(), buf2.end(), 0);
+   EXPECT_TRUE(other.ReadV(fileId, remote.fContent.size(), &ranges[1], 1, fetch));
+   EXPECT_EQ(0, memcmp(buf2.data(), remote.fContent.data() + ranges[1].fOffset, buf2.size()));
+   EXPECT_EQ(1u, remote.fNFetchCalls);
+   EXPECT_EQ(1u, other.GetNHits());
+
+   // A new modification time is a different file
+   const auto newFileId = RBlockCache::MakeFileId("root://host//file.root", remote.fContent.size(), 43);
+   EXPECT_TRUE(cache.ReadV(newFileId, remote.fContent.size(), ranges, 1, fetch));
+   EXPECT_EQ(2u, remote.fNFetchCalls);
+}
+
+TEST(RBlockCache, FetchFailure)
+{
+   RBlockCacheRaii guard("test_blockcache_failure", 64 * RBlockCache::kBlockSize);
+   auto &cache = guard.Get();
+   RRemoteMock remote;
+   remote.fContent = MakeContent(1000);
+   const auto fileId = RBlockCache::MakeFileId("https://host/file.root", 1000, 0);
+   auto fail = [](std::vector<RBlockCache::RRange> &) { return false; };
+   auto fetch = [&remote](std::vector<RBlockCache::RRange> &ranges) { return remote(ranges); };
+
+   char buf[10];
+   RBlockCache::RRange range{buf, 100, sizeof(buf)};
+   EXPECT_FALSE(cache.ReadV(fileId, 1000, &range, 1, fail));
+   // Nothing was stored by the failed read
+   EXPECT_TRUE(cache.ReadV(fileId, 1000, &range, 1, fetch));
+   EXPECT_EQ(1u, remote.fNFetchCalls);
+   EXPECT_EQ(0, memcmp(buf, remote.fContent.data() + 100, sizeof(buf)));
+}
+
+TEST(RBlockCache, Evict)
+{
+   // Room for 4 blocks: storing 8 blocks evicts the least recently used ones
+   RBlockCacheRaii guard("test_blockcache_evict", 4 * RBlockCache::kBlockSize);
+   auto &cache = guard.Get();
+   RRemoteMock remote;
+   remote.fContent = MakeContent(8 * RBlockCache::kBlockSize);
+   const auto fileId = RBlockCache::MakeFileId("root://host//big.root", remote.fContent.size(), 1);
+   auto fetch = [&remote](std::vector<RBlockCache::RRange> &ranges) { return remote(ranges); };
+
+   char buf[10];
+   for (std::uint64_t block = 0; block < 8; ++block) {
+      RBlockCache::RRange range{buf, block * RBlockCache::kBlockSize, sizeof(buf)};
+      EXPECT_TRUE(cache.ReadV(fileId, remote.fContent.size(), &range, 1, fetch));
+      EXPECT_EQ(0, memcmp(buf, remote.fContent.data() + range.fOffset, sizeof(buf)));
+   }
+
+   // Reading everything again needs to fetch some of the blocks again
+   std::vector<char> all(remote.fContent.size());
+   RBlockCache::RRange range{all.data(), 0, all.size()};
+   EXPECT_TRUE(cache.ReadV(fileId, remote.fContent.size(), &range, 1, fetch));
+   EXPECT_EQ(0, memcmp(all.data(), remote.fContent.data(), all.size()));
+   EXPECT_LT(8 * RBlockCache::kBlockSize, remote.fNFetched);
+   EXPECT_GT(16 * RBlockCache::kBlockSize, remote.fNFetched);
+}
@@ -138,6 +138,37 @@ TEST(RRawFile, ReadV)
 }
 
 
+TEST(RRawFile, ReadVAsync)
+{
+   FileRaii readvGuard("test_rawfile_readv_async", "Hello, World");
+   auto f = RRawFile::Create("test_rawfile_readv_async");
+
+   char buffer[3];
+   buffer[0] = buffer[1] = buffer[2] = 0;
+   RRawFile::RIOVec iovec[3];
+   iovec[0].fBuffer = &buffer[0];
+   iovec[0].fOffset = 0;
+   iovec[0].fSize = 1;
+   iovec[1].fBuffer = &buffer[1];
+   iovec[1].fOffset = 7;
+   iovec[1].fSize = 1;
+   iovec[2].fBuffer = &buffer[2];
+   iovec[2].fOffset = 11;
+   iovec[2].fSize = 2;
+   auto first = f->ReadVAsync(&iovec[0], 1);
+   auto second = f->ReadVAsync(&iovec[1], 2);
+   first.get();
+   second.get();
+
+   EXPECT_EQ(1U, iovec[0].fOutBytes);
+   EXPECT_EQ(1U, iovec[1].fOutBytes);
+   EXPECT_EQ(1U, iovec[2].fOutBytes);
+   EXPECT_EQ('H', buffer[0]);
+   EXPECT_EQ('W', buffer[1]);
+   EXPECT_EQ('d', buffer[2]);
+}
+
+
 TEST(RRawFile, SplitUrl)
 {
    EXPECT_STREQ("C:\\Data\\events.root", RRawFile::GetLocation("C:\\Data\\events.root").c_str());
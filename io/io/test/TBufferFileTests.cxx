@@ -26,3 +26,73 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+// The arrays are byte swapped several elements at a time: check all the lengths around the vector sizes, and that
+// the bytes in the buffer are big endian
+template <typename T>
+void CheckFastArrayRoundTrip()
+{
+   for (Int_t n = 1; n < 70; ++n) {
+      std::vector<T> values(n);
+      for (Int_t i = 0; i < n; ++i)
+         values[i] = static_cast<T>(i * 37 + 1);
+
+      TBufferFile buf(TBuffer::kWrite);
+      buf.WriteFastArray(values.data(), n);
+      ASSERT_EQ(buf.Length(), Int_t(n * sizeof(T)));
+      // the least significant byte of the last element comes last
+      EXPECT_EQ(static_cast<UChar_t>(buf.Buffer()[n * sizeof(T) - 1]), UChar_t((n - 1) * 37 + 1))
+         << "n = " << n;
+
+      buf.SetReadMode();
+      buf.Reset();
+      std::vector<T> read(n);
+      buf.ReadFastArray(read.data(), n);
+      EXPECT_EQ(read, values) << "n = " << n;
+   }
+}
+
+TEST(TBufferFile, FastArrayByteSwap)
+{
+   CheckFastArrayRoundTrip<Short_t>();
+   CheckFastArrayRoundTrip<UShort_t>();
+   CheckFastArrayRoundTrip<Int_t>();
+   CheckFastArrayRoundTrip<UInt_t>();
+   CheckFastArrayRoundTrip<Long64_t>();
+   CheckFastArrayRoundTrip<ULong64_t>();
+}
+
+TEST(TBufferFile, FastArrayDouble32)
+{
+   const Int_t n = 1000;
+   std::vector<Double_t> values(n);
+   for (Int_t i = 0; i < n; ++i)
+      values[i] = 0.25 * i;
+
+   TBufferFile buf(TBuffer::kWrite);
+   buf.WriteFastArrayDouble32(values.data(), n);
+   buf.WriteFastArrayFloat16(std::vector<Float_t>(values.begin(), values.end()).data(), n);
+   EXPECT_EQ(buf.Length(), Int_t(n * sizeof(Float_t) + n * 3));
+
+   buf.SetReadMode();
+   buf.Reset();
+   std::vector<Double_t> read(n);
+   buf.ReadFastArrayDouble32(read.data(), n);
+   EXPECT_EQ(read, values);
+   std::vector<Float_t> readFloat16(n);
+   buf.ReadFastArrayFloat16(readFloat16.data(), n);
+   for (Int_t i = 0; i < n; ++i)
+      EXPECT_NEAR(readFloat16[i], values[i], 1e-3 * values[i]);
+
+   // with a range, the values are written as integers: x = aint / factor + xmin
+   std::vector<UInt_t> integers(n);
+   for (Int_t i = 0; i < n; ++i)
+      integers[i] = i;
+   buf.SetWriteMode();
+   buf.Reset();
+   buf.WriteFastArray(integers.data(), n);
+   buf.SetReadMode();
+   buf.Reset();
+   buf.ReadFastArrayWithFactor(read.data(), n, 4., 0.);
+   EXPECT_EQ(read, values);
+}
@@ -1,5 +1,7 @@
 #include "TBufferJSON.h"
 #include "TNamed.h"
+#include <cmath>
+#include <cstdio>
 #include <string>
 
 #include "gtest/gtest.h"
@@ -47,3 +49,29 @@ TEST(TBufferJSON, utf8_3)
    EXPECT_EQ(str0, named1->GetTitle());
 }
 
+
+// conversion of numbers must give the same strings as printf with the configured formats
+TEST(TBufferJSON, number_format)
+{
+   char buf[100], ref[100];
+   const Double_t values[] = {0.1, -3.75, 3.75e-3, 3.75e-4, 1.1e-10, 123.456789, 1. / 3, 2.5e300, -7e-310, 1e24, -17};
+   for (auto v : values) {
+      snprintf(ref, sizeof(ref), "%e", v);
+      EXPECT_STREQ(ref, TBufferText::ConvertDouble(v, buf, sizeof(buf), kTRUE));
+
+      if ((v == std::nearbyint(v)) && (std::abs(v) < 1e25))
+         snprintf(ref, sizeof(ref), "%1.0f", v);
+      else {
+         snprintf(ref, sizeof(ref), "%.14e", v);
+         TBufferText::CompactFloatString(ref, sizeof(ref));
+      }
+      EXPECT_STREQ(ref, TBufferText::ConvertDouble(v, buf, sizeof(buf)));
+
+      snprintf(ref, sizeof(ref), "%e", (Float_t)v);
+      EXPECT_STREQ(ref, TBufferText::ConvertFloat(v, buf, sizeof(buf), kTRUE));
+   }
+
+   EXPECT_STREQ("0.00375", TBufferText::ConvertDouble(3.75e-3, buf, sizeof(buf)));
+   EXPECT_STREQ("3.75e-4", TBufferText::ConvertDouble(3.75e-4, buf, sizeof(buf)));
+   EXPECT_STREQ("123", TBufferText::ConvertFloat(123, buf, sizeof(buf)));
+}
@@ -160,6 +160,56 @@ TEST(TBufferMerger, AutoSave)
    RemoveFile("tbuffermerger_autosave.root");
 }
 
+TEST(TBufferMerger, QueueMetrics)
+{
+   int nthreads = 8;
+   int nwrites = 4;
+   int nevents = 1024;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_queuemetrics.root");
+      merger.SetAutoSave(128 * 1024 * 1024); // merge the queue only at the end
+
+      std::vector<std::thread> threads;
+      for (int i = 0; i < nthreads; ++i) {
+         threads.emplace_back([=, &merger]() {
+            auto myfile = merger.GetFile();
+            auto mytree = new TTree("mytree", "mytree");
+            int n = 0;
+            mytree->Branch("n", &n, "n/I");
+            for (int w = 0; w < nwrites; ++w) {
+               for (int j = 0; j < nevents; ++j) {
+                  n = j;
+                  mytree->Fill();
+               }
+               myfile->Write();
+            }
+            mytree->ResetBranchAddresses();
+         });
+      }
+
+      for (auto &&t : threads)
+         t.join();
+
+      // the threads that found the merger idle merged their data directly, the others pushed it to the queue
+      EXPECT_GE(merger.GetNMerges(), 1u);
+      EXPECT_GT(merger.GetMergeTime(), 0.);
+      EXPECT_LE(merger.GetQueueSize(), merger.GetMaxQueueSize());
+      EXPECT_EQ(merger.GetQueueSize() == 0, merger.GetBuffered() == 0);
+   }
+
+   {
+      TFile f("tbuffermerger_queuemetrics.root");
+      auto t = f.Get<TTree>("mytree");
+      ASSERT_TRUE(t != nullptr);
+      EXPECT_EQ(nthreads * nwrites * nevents, t->GetEntries());
+   }
+
+   RemoveFile("tbuffermerger_queuemetrics.root");
+}
+
 TEST(TBufferMerger, CheckTreeFillResults)
 {
    int sum_s, sum_p;
@@ -2,9 +2,14 @@
 
 #include "TFileMerger.h"
 
+#include "TFile.h"
 #include "TMemFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <string>
+#include <vector>
+
 static void CreateATuple(TMemFile &file, const char *name, double value)
 {
    auto mytree = new TTree(name, "A tree");
@@ -68,3 +73,52 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+TEST(TFileMerger, ParallelMerges)
+{
+   const int nFiles = 8;
+   std::vector<std::string> names;
+   for (int i = 0; i < nFiles; ++i) {
+      names.emplace_back("tfilemerger_parallel" + std::to_string(i) + ".root");
+      TFile f(names.back().c_str(), "RECREATE");
+      TTree t("t", "t");
+      int x;
+      t.Branch("x", &x);
+      for (int j = 0; j < 100; ++j) {
+         x = i * 100 + j;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   const auto outName = "tfilemerger_parallel_out.root";
+   {
+      TFileMerger merger(kFALSE, kFALSE);
+      merger.SetParallelMerges(3, ".");
+      ASSERT_TRUE(merger.OutputFile(outName, "RECREATE"));
+      for (const auto &name : names)
+         ASSERT_TRUE(merger.AddFile(name.c_str(), kFALSE));
+      EXPECT_TRUE(merger.Merge());
+   }
+
+   TFile f(outName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   ASSERT_EQ(t->GetEntries(), nFiles * 100);
+   int x;
+   t->SetBranchAddress("x", &x);
+   for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+      t->GetEntry(e);
+      EXPECT_EQ(x, e);
+   }
+   t->ResetBranchAddresses();
+   // the partial files are removed
+   void *dir = gSystem->OpenDirectory(".");
+   while (const char *entry = gSystem->GetDirEntry(dir))
+      EXPECT_NE(std::string(entry).find("TFileMerger_partial"), 0u);
+   gSystem->FreeDirectory(dir);
+
+   gSystem->Unlink(outName);
+   for (const auto &name : names)
+      gSystem->Unlink(name.c_str());
+}
@@ -1,15 +1,25 @@
+#include <cstring>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "ROOT/TestSupport.hxx"
+#include "RZip.h"
 #include "TFile.h"
 #include "TKey.h"
+#include "TMemFile.h"
 #include "TNamed.h"
 #include "TPluginManager.h"
 #include "TROOT.h" // gROOT
 #include "TSystem.h"
 
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 TEST(TFile, WriteObjectTObject)
 {
     auto filename{"tfile_writeobject_tobject.root"};
@@ -135,3 +145,210 @@ TEST(TFile, ReadWithoutGlobalRegistrationNet)
    const auto netFile = "root://eospublic.cern.ch//eos/root-eos/h1/dstarmb.root";
    TestReadWithoutGlobalRegistrationIfPossible(netFile);
 }
+
+TEST(TFile, ParallelZipBlocks)
+{
+   // more than two 16MB compression blocks, compressible
+   const int n = 2 * kMAXZIPBUF + 1000;
+   std::vector<char> data(n);
+   for (int i = 0; i < n; ++i)
+      data[i] = (i / 7) % 13;
+
+   for (auto algorithm : {ROOT::RCompressionSetting::EAlgorithm::kZLIB, ROOT::RCompressionSetting::EAlgorithm::kLZ4,
+                          ROOT::RCompressionSetting::EAlgorithm::kZSTD}) {
+      std::vector<char> zipped1(n), zipped4(n);
+      const int nzip1 = R__zipBlocks(1, n, data.data(), n, zipped1.data(), algorithm, 0, 1);
+      const int nzip4 = R__zipBlocks(1, n, data.data(), n, zipped4.data(), algorithm, 0, 4);
+      ASSERT_GT(nzip1, 0);
+      // the result does not depend on the number of threads
+      ASSERT_EQ(nzip1, nzip4);
+      EXPECT_EQ(0, memcmp(zipped1.data(), zipped4.data(), nzip1));
+
+      std::vector<char> unzipped(n);
+      EXPECT_EQ(n, R__unzipBlocks(nzip4, reinterpret_cast<unsigned char *>(zipped4.data()), n,
+                                  reinterpret_cast<unsigned char *>(unzipped.data()), 4));
+      EXPECT_EQ(data, unzipped);
+   }
+}
+
+TEST(TFile, LargeCompressedKey)
+{
+   TMemFile f("largecompressedkey.root", "RECREATE");
+   TNamed named("large", std::string(2 * kMAXZIPBUF + 1000, 'x').c_str());
+   f.WriteObject(&named, named.GetName());
+   auto key = f.GetKey("large");
+   ASSERT_NE(key, nullptr);
+   EXPECT_LT(key->GetNbytes(), key->GetObjlen());
+
+   std::unique_ptr<TNamed> read(f.Get<TNamed>("large"));
+   ASSERT_NE(read, nullptr);
+   EXPECT_STREQ(read->GetTitle(), named.GetTitle());
+}
+
+TEST(TFile, AsyncWrite)
+{
+   auto filename{"tfile_asyncwrite.root"};
+   const int n = 1000;
+   {
+      TFile f{filename, "RECREATE"};
+      // a small limit, so that writing has to wait for the background thread
+      ASSERT_TRUE(f.SetAsyncWrite(64 * 1024));
+      EXPECT_EQ(f.GetAsyncWrite(), 64 * 1024);
+      for (int i = 0; i < n; ++i) {
+         TNamed named(("named" + std::to_string(i)).c_str(), std::string(1000 + i, 'a' + i % 26).c_str());
+         EXPECT_GT(f.WriteObject(&named, named.GetName()), 0);
+      }
+      // reading waits until what it reads is written
+      std::unique_ptr<TNamed> read(f.Get<TNamed>("named42"));
+      ASSERT_NE(read, nullptr);
+      EXPECT_EQ(std::string(read->GetTitle()), std::string(1042, 'a' + 42 % 26));
+      f.Close();
+      EXPECT_FALSE(f.TestBit(TFile::kWriteError));
+   }
+
+   TFile f{filename};
+   for (int i = 0; i < n; ++i) {
+      std::unique_ptr<TNamed> read(f.Get<TNamed>(("named" + std::to_string(i)).c_str()));
+      ASSERT_NE(read, nullptr);
+      EXPECT_EQ(std::string(read->GetTitle()), std::string(1000 + i, 'a' + i % 26));
+   }
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, AsyncWriteNotSupported)
+{
+   TMemFile f("asyncwritenotsupported.root", "RECREATE");
+   ROOT_EXPECT_WARNING(EXPECT_FALSE(f.SetAsyncWrite()), "TMemFile::SetAsyncWrite",
+                       "asynchronous writes are not supported for asyncwritenotsupported.root");
+   EXPECT_EQ(f.GetAsyncWrite(), 0);
+}
+
+TEST(TFile, KeyIndex)
+{
+   auto filename{"tfile_keyindex.root"};
+   const int n = 5000;
+   {
+      TFile f{filename, "RECREATE"};
+      for (int i = 0; i < n; ++i) {
+         TNamed named(("named" + std::to_string(i)).c_str(), "cycle 1");
+         f.WriteTObject(&named);
+      }
+      TNamed named("named7", "cycle 2");
+      f.WriteTObject(&named);
+   }
+   {
+      // the keys are read as they are looked up
+      TFile f{filename};
+      EXPECT_EQ(f.GetNkeys(), n + 1);
+      std::unique_ptr<TNamed> read(f.Get<TNamed>("named7"));
+      ASSERT_NE(read, nullptr);
+      EXPECT_STREQ(read->GetTitle(), "cycle 2");
+      read.reset(f.Get<TNamed>("named7;1"));
+      ASSERT_NE(read, nullptr);
+      EXPECT_STREQ(read->GetTitle(), "cycle 1");
+      EXPECT_EQ(f.GetKey("named4999")->GetCycle(), 1);
+      EXPECT_EQ(f.GetKey("named5000"), nullptr);
+
+      // listing the keys reads the others, in the order of the file
+      TList *keys = f.GetListOfKeys();
+      ASSERT_EQ(keys->GetSize(), n + 1);
+      EXPECT_STREQ(keys->At(0)->GetName(), "named0");
+      EXPECT_STREQ(keys->At(7)->GetName(), "named7");
+      EXPECT_EQ(static_cast<TKey *>(keys->At(7))->GetCycle(), 2);
+      EXPECT_EQ(static_cast<TKey *>(keys->At(8))->GetCycle(), 1);
+      EXPECT_STREQ(keys->At(n)->GetName(), "named4999");
+   }
+   {
+      TFile f{filename, "UPDATE"};
+      TNamed named("added", "added");
+      f.WriteTObject(&named);
+      TNamed replaced("named42", "cycle 2");
+      f.WriteTObject(&replaced, nullptr, "WriteDelete");
+   }
+   TFile f{filename};
+   EXPECT_EQ(f.GetNkeys(), n + 2);
+   std::unique_ptr<TNamed> read(f.Get<TNamed>("added"));
+   ASSERT_NE(read, nullptr);
+   read.reset(f.Get<TNamed>("named42"));
+   ASSERT_NE(read, nullptr);
+   EXPECT_STREQ(read->GetTitle(), "cycle 2");
+   EXPECT_EQ(f.GetKey("named42", 1), nullptr);
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, ReadStreamerInfoLazily)
+{
+   auto filename{"tfile_readstreamerinfolazily.root"};
+   {
+      TFile f{filename, "RECREATE"};
+      TNamed named("named", "title");
+      f.WriteTObject(&named);
+      std::vector<int> v{1, 2, 3};
+      f.WriteObject(&v, "vector");
+   }
+
+   TFile::SetReadStreamerInfoLazily();
+   {
+      TFile f{filename};
+      EXPECT_TRUE(f.HasPendingStreamerInfo());
+      std::unique_ptr<TNamed> named(f.Get<TNamed>("named"));
+      ASSERT_NE(named, nullptr);
+      EXPECT_STREQ(named->GetTitle(), "title");
+      // built when TNamed was read, with its base class
+      EXPECT_FALSE(f.LoadStreamerInfo("TNamed"));
+      EXPECT_FALSE(f.LoadStreamerInfo("TObject"));
+
+      std::unique_ptr<std::vector<int>> v(f.Get<std::vector<int>>("vector"));
+      ASSERT_NE(v, nullptr);
+      EXPECT_EQ(v->size(), 3u);
+      EXPECT_FALSE(f.LoadStreamerInfo("vector<int>"));
+   }
+   {
+      // the streamer infos of writable files are always built at opening
+      TFile f{filename, "UPDATE"};
+      EXPECT_FALSE(f.HasPendingStreamerInfo());
+   }
+   TFile::SetReadStreamerInfoLazily(kFALSE);
+   gSystem->Unlink(filename);
+}
+
+#ifndef _WIN32
+TEST(TMemFile, SharedMemory)
+{
+   const int fd = TMemFile::CreateSharedMemory("tmemfile_sharedmemory");
+   ASSERT_GE(fd, 0);
+
+   // a worker process writes in the shared memory, its parent reads it without copying it
+   pid_t pid = fork();
+   ASSERT_GE(pid, 0);
+   if (pid == 0) {
+      TMemFile out("tmemfile_sharedmemory.root", TMemFile::SharedMemory_t(fd), "RECREATE", "", 0, 4096);
+      for (int i = 0; i < 100; ++i) {
+         TNamed named(("named" + std::to_string(i)).c_str(), std::string(1000 + i, 'a' + i % 26).c_str());
+         out.WriteTObject(&named);
+      }
+      out.Write();
+      out.Close();
+      _exit(out.TestBit(TFile::kWriteError) || out.GetSharedMemoryFd() != fd);
+   }
+   int status = 0;
+   ASSERT_EQ(waitpid(pid, &status, 0), pid);
+   ASSERT_TRUE(WIFEXITED(status));
+   ASSERT_EQ(WEXITSTATUS(status), 0);
+
+   {
+      TMemFile in("tmemfile_sharedmemory.root", TMemFile::SharedMemory_t(fd));
+      ASSERT_FALSE(in.IsZombie());
+      EXPECT_FALSE(in.IsWritable());
+      for (int i = 0; i < 100; ++i) {
+         std::unique_ptr<TNamed> read(in.Get<TNamed>(("named" + std::to_string(i)).c_str()));
+         ASSERT_NE(read, nullptr);
+         EXPECT_EQ(std::string(read->GetTitle()), std::string(1000 + i, 'a' + i % 26));
+      }
+   }
+
+   ROOT_EXPECT_ERROR(TMemFile("tmemfile_sharedmemory.root", TMemFile::SharedMemory_t(fd), "UPDATE"), "TMemFile::TMemFile",
+                     "tmemfile_sharedmemory.root: a shared memory file can only be created or read, not updated");
+   close(fd);
+}
+#endif
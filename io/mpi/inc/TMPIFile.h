@@ -25,6 +25,9 @@
 // When Sync() is called, this triggers objects in the TFile space to   //
 // be communicated over MPI to a master writer which combines the data  //
 // before writing it to file.                                           //
+// In direct write mode, the workers write the records of their files   //
+// to disjoint regions of the output file with MPI-IO, and only the     //
+// metadata is sent to the collector.                                   //
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
@@ -56,6 +59,9 @@ private:
 
    char *fSendBuf = 0; // message buffer, only used by worker
 
+   Bool_t fDirectWrite = kFALSE;       // workers write their records themselves to the output file
+   MPI_File fMPIFile = MPI_FILE_NULL; // output file opened with MPI-IO, only used in direct write mode
+
    struct ParallelFileMerger : public TObject {
    private:
       using ClientColl_t = std::vector<TMPIClientInfo>;
@@ -68,7 +74,8 @@ private:
       TFileMerger fMerger;
 
       static void DeleteObject(TDirectory *dir, Bool_t withReset);
-      
+      static Bool_t ImportTrees(TDirectory *input, TDirectory *output, Long64_t seekOffset);
+
    public:
       ParallelFileMerger(const char *filename, Int_t compression_settings, Bool_t writeCache = kFALSE);
       ~ParallelFileMerger() override;
@@ -83,12 +90,20 @@ private:
       Bool_t NeedMerge(Float_t clientThreshold);
       Bool_t NeedFinalMerge() { return fClientsContact.CountBits() > 0; };
       void RegisterClient(UInt_t clientID, TFile *file);
+
+      TFile *GetOutputFile() { return fMerger.GetOutputFile(); }
+      Long64_t ReserveRegion(Long64_t nbytes);
+      Bool_t ImportTrees(TDirectory *input, Long64_t seekOffset);
    };
 
    void SetOutputName();
    void CheckSplitLevel();
    void SplitMPIComm();
    void UpdateEndProcess();
+   void OpenMPIFile();
+   void CloseMPIFile();
+   void SyncDirect();
+   static void CopyMetadata(TDirectory *input, TDirectory *output);
 
    Bool_t IsReceived();
 
@@ -109,6 +124,10 @@ public:
 
    TString GetMPIFilename() const { return fMPIFilename; };
 
+   // Direct write mode, to be set identically on all ranks before RunCollector() and Sync()
+   void SetDirectWrite(Bool_t on = kTRUE) { fDirectWrite = on; }
+   Bool_t IsDirectWrite() const { return fDirectWrite; }
+
    // Collector Functions
    void RunCollector(Bool_t cache = kFALSE);
    Bool_t IsCollector();
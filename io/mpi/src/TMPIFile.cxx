@@ -11,9 +11,14 @@
 
 #include "TMPIFile.h"
 #include "TFileCacheWrite.h"
+#include "TFree.h"
 #include "TKey.h"
 #include "THashTable.h"
 #include "TMath.h"
+#include "TTree.h"
+
+#include <algorithm>
+#include <cstring>
 
 ClassImp(TMPIFile);
 
@@ -44,11 +49,28 @@ Begin_Macro (source)
 }
 End_Macro
 
+### Direct write mode
+
+By default, the workers send their complete TMemFile to the collector,
+which copies every basket into the output file. If SetDirectWrite() is
+called on all ranks before RunCollector() and Sync(), the output file is
+opened with MPI-IO by all the ranks of the sub-communicator instead. At
+every Sync(), a worker asks the collector for a region of the output file,
+writes the records of its TMemFile there itself and sends only the
+metadata (the tree headers and the histograms) to the collector. The
+collector adds the baskets of the worker to its output trees in place, see
+TTree::ImportBaskets(), and merges the histograms as usual.
+
 See TMPIFile class for the list of functions
 */
 
 const Int_t MIN_FILE_NUM = 2;
 
+// Message tags of the direct write mode, distinct from the communicator colors
+const Int_t kTagReserve = 30001;
+const Int_t kTagOffset = 30002;
+const Int_t kTagMetadata = 30003;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// TMPIFile constructor
 ///
@@ -128,6 +150,12 @@ void TMPIFile::RunCollector(Bool_t cache)
    Int_t client_Id = 0;
    std::vector<char> buffer(0);
 
+   if (fDirectWrite) {
+      // the output file must exist before the workers write into it with MPI-IO
+      mergers.Add(new ParallelFileMerger(fMPIFilename, this->GetCompressionSettings(), cache));
+      OpenMPIFile();
+   }
+
    // loop until all other ranks in the subcommunicator have exited
    while (fEndProcess != fMPILocalSize - 1) {
       // Info("RunCollector","process counter %i",fEndProcess);
@@ -145,12 +173,41 @@ void TMPIFile::RunCollector(Bool_t cache)
       Int_t source = status.MPI_SOURCE;
       Int_t tag = status.MPI_TAG;
 
+      // a worker in direct write mode asks for a region of the output file
+      if (tag == kTagReserve) {
+         Long64_t nbytes = 0;
+         MPI_Recv(&nbytes, 1, MPI_LONG_LONG, source, tag, fSubComm, MPI_STATUS_IGNORE);
+         ParallelFileMerger *info = (ParallelFileMerger *)mergers.FindObject(fMPIFilename);
+         Long64_t offset = info->ReserveRegion(nbytes);
+         MPI_Send(&offset, 1, MPI_LONG_LONG, source, kTagOffset, fSubComm);
+         continue;
+      }
+
       // retrieve the message
       MPI_Recv(buf, number_bytes, MPI_CHAR, source, tag, fSubComm, MPI_STATUS_IGNORE);
 
       // empty message signifies a Worker exited
       if (number_bytes == 0) {
          this->UpdateEndProcess();
+      } else if (tag == kTagMetadata) {
+         // the records are already in the output file, the message starts with their offset
+         Long64_t seekOffset = 0;
+         memcpy(&seekOffset, buf, sizeof(seekOffset));
+         TMemFile *transient =
+            new TMemFile(fMPIFilename, buf + sizeof(seekOffset), number_bytes - sizeof(seekOffset), "UPDATE");
+         if (transient->IsZombie()) {
+            Error("RunCollector", "Failed to create TMemFile from buffer");
+         }
+         transient->SetCompressionSettings(this->GetCompressionSettings());
+
+         ParallelFileMerger *info = (ParallelFileMerger *)mergers.FindObject(fMPIFilename);
+         // reference the baskets of the worker in the output trees, then merge the remaining objects
+         info->ImportTrees(transient, seekOffset);
+         info->RegisterClient(client_Id, transient);
+         info->Merge();
+         transient = 0;
+
+         client_Id++;
       } else {
          // create a TMemFile from the buffer
          TMemFile *transient = new TMemFile(fMPIFilename, buf, number_bytes, "UPDATE");
@@ -185,6 +242,11 @@ void TMPIFile::RunCollector(Bool_t cache)
    }
 
    if (fEndProcess == fMPILocalSize - 1) {
+      if (fDirectWrite) {
+         CloseMPIFile();
+         ParallelFileMerger *info = (ParallelFileMerger *)mergers.FindObject(fMPIFilename);
+         info->GetOutputFile()->Write("", TObject::kOverwrite);
+      }
       mergers.Delete();
       return;
    }
@@ -345,6 +407,83 @@ void TMPIFile::ParallelFileMerger::RegisterClient(UInt_t clientID, TFile *file)
    fClients[clientID].SetFile(file);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Reserve nbytes at the end of the output file for the records written by
+/// a worker in direct write mode, and return the offset of the region.
+///
+/// The region is cut from the last free segment of the output file, so that
+/// the keys written later by the collector itself are placed after it.
+
+Long64_t TMPIFile::ParallelFileMerger::ReserveRegion(Long64_t nbytes)
+{
+   TFile *file = fMerger.GetOutputFile();
+   Long64_t offset = file->GetEND();
+   TFree *lastfree = (TFree *)file->GetListOfFree()->Last();
+   if (!lastfree || lastfree->GetFirst() != offset) {
+      Error("ReserveRegion", "unexpected free segments in the output file %s", file->GetName());
+      return -1;
+   }
+   lastfree->SetFirst(offset + nbytes);
+   if (lastfree->GetLast() < offset + nbytes)
+      lastfree->SetLast(offset + nbytes + 1000000000LL);
+   file->SetEND(offset + nbytes);
+   return offset;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the baskets of the trees in input, which are at seekOffset in the
+/// output file, to the trees of the same name in output. The output trees
+/// are created as empty clones of the input trees if needed.
+
+Bool_t TMPIFile::ParallelFileMerger::ImportTrees(TDirectory *input, TDirectory *output, Long64_t seekOffset)
+{
+   Bool_t result = kTRUE;
+   TIter nextkey(input->GetListOfKeys());
+   TKey *key;
+   while ((key = (TKey *)nextkey())) {
+      // only the highest cycle of every key
+      if (input->GetKey(key->GetName()) != key)
+         continue;
+      TClass *cl = TClass::GetClass(key->GetClassName());
+      if (!cl)
+         continue;
+      if (cl->InheritsFrom(TDirectory::Class())) {
+         TDirectory *subdir = input->GetDirectory(key->GetName());
+         TDirectory *outsubdir = output->GetDirectory(key->GetName());
+         if (!outsubdir)
+            outsubdir = output->mkdir(key->GetName(), key->GetTitle());
+         if (subdir && outsubdir)
+            result &= ImportTrees(subdir, outsubdir, seekOffset);
+      } else if (cl->InheritsFrom(TTree::Class())) {
+         TTree *fromtree = (TTree *)input->Get(key->GetName());
+         if (!fromtree)
+            continue;
+         TTree *totree = (TTree *)output->GetList()->FindObject(key->GetName());
+         if (!totree) {
+            totree = fromtree->CloneTree(0);
+            totree->SetDirectory(output);
+         }
+         if (totree->ImportBaskets(fromtree, seekOffset) < 0) {
+            ::Error("TMPIFile::ParallelFileMerger::ImportTrees", "cannot add the baskets of the tree %s", key->GetName());
+            result = kFALSE;
+         }
+      }
+   }
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the baskets of the trees in input, which are at seekOffset in the
+/// output file, to the output trees, and remove the trees from the input so
+/// that they are not merged again.
+
+Bool_t TMPIFile::ParallelFileMerger::ImportTrees(TDirectory *input, Long64_t seekOffset)
+{
+   Bool_t result = ImportTrees(input, fMerger.GetOutputFile(), seekOffset);
+   DeleteObject(input, kTRUE);
+   return result;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return true, if enough client have reported
 ///
@@ -430,6 +569,11 @@ void TMPIFile::CreateEmptyBufferAndSend()
 
 void TMPIFile::Sync()
 {
+   if (fDirectWrite) {
+      SyncDirect();
+      this->ResetAfterMerge((TFileMergeInfo *)0);
+      return;
+   }
    // check if the previous send request is accepted by master.
    if (!IsReceived()) {
       MPI_Wait(&fMPIRequest, MPI_STATUS_IGNORE);
@@ -440,6 +584,128 @@ void TMPIFile::Sync()
    this->ResetAfterMerge((TFileMergeInfo *)0);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Called by the Workers only in direct write mode: writes the records of
+/// the file to a region of the output file reserved by the Collector, and
+/// sends the metadata needed to reference them to the Collector.
+///
+/// The records are written with independent MPI-IO calls, because the
+/// Workers synchronize at different times.
+
+void TMPIFile::SyncDirect()
+{
+   if (this->IsCollector()) {
+      Error("SyncDirect", " should not be called by a collector");
+      return;
+   }
+   if (!IsReceived()) {
+      MPI_Wait(&fMPIRequest, MPI_STATUS_IGNORE);
+   }
+   delete[] fSendBuf;
+   fSendBuf = nullptr;
+
+   OpenMPIFile();
+   this->Write();
+
+   // reserve a region for the records following the file header
+   Long64_t nbytes = this->GetEND() - fBEGIN;
+   Long64_t offset = -1;
+   MPI_Send(&nbytes, 1, MPI_LONG_LONG, 0, kTagReserve, fSubComm);
+   MPI_Recv(&offset, 1, MPI_LONG_LONG, 0, kTagOffset, fSubComm, MPI_STATUS_IGNORE);
+   if (offset < 0) {
+      Error("SyncDirect", "no region of the output file %s could be reserved", fMPIFilename.Data());
+      return;
+   }
+
+   std::vector<char> image(this->GetEND());
+   this->CopyTo(image.data(), image.size());
+   // MPI-IO counts are integers
+   const Long64_t maxChunk = 1LL << 30;
+   for (Long64_t pos = 0; pos < nbytes; pos += maxChunk) {
+      Int_t count = std::min(maxChunk, nbytes - pos);
+      MPI_File_write_at(fMPIFile, offset + pos, image.data() + fBEGIN + pos, count, MPI_CHAR, MPI_STATUS_IGNORE);
+   }
+
+   // the metadata is a copy of the objects of the file, without its records
+   TMemFile *meta;
+   {
+      TDirectory::TContext ctxt;
+      meta = new TMemFile(fMPIFilename, "RECREATE");
+      meta->SetCompressionSettings(this->GetCompressionSettings());
+      CopyMetadata(this, meta);
+      meta->Write();
+   }
+   const Long64_t seekOffset = offset - fBEGIN;
+   const Long64_t count = meta->GetEND();
+   fSendBuf = new char[sizeof(seekOffset) + count];
+   memcpy(fSendBuf, &seekOffset, sizeof(seekOffset));
+   meta->CopyTo(fSendBuf + sizeof(seekOffset), count);
+   delete meta;
+   MPI_Isend(fSendBuf, sizeof(seekOffset) + count, MPI_CHAR, 0, kTagMetadata, fSubComm, &fMPIRequest);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copies the highest cycle of the objects of the directory input to the
+/// directory output, recursively. The trees are copied with their basket
+/// addresses, but without their baskets.
+
+void TMPIFile::CopyMetadata(TDirectory *input, TDirectory *output)
+{
+   TIter nextkey(input->GetListOfKeys());
+   TKey *key;
+   while ((key = (TKey *)nextkey())) {
+      if (input->GetKey(key->GetName()) != key)
+         continue;
+      TClass *cl = TClass::GetClass(key->GetClassName());
+      if (cl && cl->InheritsFrom(TDirectory::Class())) {
+         TDirectory *subdir = input->GetDirectory(key->GetName());
+         TDirectory *outsubdir = output->mkdir(key->GetName(), key->GetTitle());
+         if (subdir && outsubdir)
+            CopyMetadata(subdir, outsubdir);
+         continue;
+      }
+      // the objects in memory are up to date after Write()
+      TObject *obj = input->GetList()->FindObject(key->GetName());
+      Bool_t owned = kFALSE;
+      if (!obj) {
+         obj = key->ReadObj();
+         owned = kTRUE;
+      }
+      if (obj)
+         output->WriteTObject(obj, key->GetName());
+      if (owned)
+         delete obj;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Opens the output file with MPI-IO. This is collective over the ranks of
+/// the sub-communicator, which all open the file of their Collector.
+
+void TMPIFile::OpenMPIFile()
+{
+   if (fMPIFile != MPI_FILE_NULL)
+      return;
+   if (!this->IsCollector())
+      this->SetOutputName();
+   Int_t err = MPI_File_open(fSubComm, fMPIFilename.Data(), MPI_MODE_WRONLY | MPI_MODE_CREATE, MPI_INFO_NULL,
+                             &fMPIFile);
+   if (err != MPI_SUCCESS) {
+      Error("OpenMPIFile", "cannot open %s with MPI-IO", fMPIFilename.Data());
+      fMPIFile = MPI_FILE_NULL;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Closes the output file opened with MPI-IO. This is collective over the
+/// ranks of the sub-communicator.
+
+void TMPIFile::CloseMPIFile()
+{
+   if (fMPIFile != MPI_FILE_NULL)
+      MPI_File_close(&fMPIFile);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Closes the file. For Worker ranks, this function will signal to the
 /// Collector that the Worker has exited. It also closes the inherited TMemFile.
@@ -447,8 +713,13 @@ void TMPIFile::Sync()
 void TMPIFile::Close(Option_t *option)
 {
    if (IsOpen()) {
+      // the collective open and close of the output file must be matched by all workers
+      if (fDirectWrite && !this->IsCollector())
+         OpenMPIFile();
       // sends empty buffer
       CreateEmptyBufferAndSend();
+      if (fDirectWrite && !this->IsCollector())
+         CloseMPIFile();
       // call parent close function
       TMemFile::Close(option);
       
@@ -28,6 +28,7 @@ def get_argparse():
     parser.add_argument("-v", help=textwrap.fill(
         "Explicitly set the verbosity level: 0 request no output, 99 is the default"))
     parser.add_argument("-j", help="Parallelize the execution in multiple processes")
+    parser.add_argument("-mt", help="Parallelize the execution in multiple threads")
     parser.add_argument("-dbg", help=textwrap.fill(
         "Parallelize the execution in multiple processes in debug mode "
         "(Does not delete partial files stored inside working directory)"))
@@ -27,6 +27,7 @@
   \param -O   Re-optimize basket size when merging TTree
   \param -v   Explicitly set the verbosity level: 0 request no output, 99 is the default
   \param -j   Parallelise the execution in multiple processes
+  \param -mt  Parallelise the execution in multiple threads of the same process
   \param -dbg  Parallelise the execution in multiple processes in debug mode (Does not delete  partial  files  stored
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
@@ -139,6 +140,7 @@ int main( int argc, char **argv )
    Bool_t keepCompressionAsIs = kFALSE;
    Bool_t useFirstInputCompression = kFALSE;
    Bool_t multiproc = kFALSE;
+   Int_t nThreads = 0;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
    Int_t verbosity = 99;
@@ -213,6 +215,16 @@ int main( int argc, char **argv )
          }
          multiproc = kTRUE;
          ++ffirst;
+      } else if (strcmp(argv[a], "-mt") == 0) {
+         // If the number of threads is not specified, use the number of logical cores.
+         nThreads = s.fCpus;
+         if (a + 1 != argc && isdigit(argv[a + 1][0])) {
+            nThreads = (Int_t)strtol(argv[a + 1], 0, 10);
+            ++a;
+            ++ffirst;
+         }
+         std::cout << "Parallelizing  with " << nThreads << " threads.\n";
+         ++ffirst;
       } else if ( strcmp(argv[a],"-cachesize=") == 0 ) {
          int size;
          static const size_t arglen = strlen("-cachesize=");
@@ -540,6 +552,8 @@ int main( int argc, char **argv )
          }
       }
    } else {
+      if (nThreads > 1)
+         fileMerger.SetParallelMerges(nThreads, workingDir);
       status = sequentialMerge(fileMerger, ffirst, filesToProcess);
    }
 #else
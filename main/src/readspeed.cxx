@@ -11,6 +11,8 @@
 #include "ReadSpeedCLI.hxx"
 #include "ReadSpeed.hxx"
 
+#include <iostream>
+
 using namespace ReadSpeed;
 
 int main(int argc, char **argv)
@@ -20,7 +22,11 @@ int main(int argc, char **argv)
    if (!args.fShouldRun)
       return 1; // ParseArgs has printed the --help, has run the --test or has encountered an issue and logged about it
 
-   PrintThroughput(EvalThroughput(args.fData, args.fNThreads));
+   const auto result = EvalThroughput(args.fData, args.fNThreads);
+   if (args.fJSON)
+      PrintThroughputJSON(result, std::cout);
+   else
+      PrintThroughput(result);
 
    return 0;
 }
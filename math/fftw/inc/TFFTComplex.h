@@ -27,6 +27,10 @@ protected:
    Int_t    *fN;         //transform sizes in each dimension
    Int_t     fSign;      //sign of the exponent of the transform (-1 is FFTW_FORWARD and +1 FFTW_BACKWARD)
    TString   fFlags;     //transform flags
+   void     *fManyIn = nullptr;   //input arrays of TransformMany
+   void     *fManyOut = nullptr;  //output arrays of TransformMany
+   void     *fManyPlan = nullptr; //fftw plan of TransformMany
+   Int_t     fHowMany = 0;        //number of transforms of fManyPlan
 
    UInt_t MapFlag(Option_t *flag);
 
@@ -61,6 +65,7 @@ public:
    void       SetPointComplex(Int_t ipoint, TComplex &c) override;
    void       SetPointsComplex(const Double_t *re, const Double_t *im) override;
    void       Transform() override;
+   void       TransformMany(Int_t howmany, const Double_t *in, Double_t *out) override;
 
    ClassDefOverride(TFFTComplex,0);
 };
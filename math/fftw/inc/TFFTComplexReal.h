@@ -28,6 +28,10 @@ class TFFTComplexReal: public TVirtualFFT {
    Int_t     fTotalSize; //total size of the transform
    Int_t    *fN;         //transform sizes in each dimension
    TString   fFlags;     //transform flags
+   void     *fManyIn = nullptr;   //input arrays of TransformMany
+   void     *fManyOut = nullptr;  //output arrays of TransformMany
+   void     *fManyPlan = nullptr; //fftw plan of TransformMany
+   Int_t     fHowMany = 0;        //number of transforms of fManyPlan
 
    UInt_t MapFlag(Option_t *flag);
 
@@ -62,6 +66,7 @@ class TFFTComplexReal: public TVirtualFFT {
    void       SetPointComplex(Int_t ipoint, TComplex &c) override;
    void       SetPointsComplex(const Double_t *re, const Double_t *im) override;
    void       Transform() override;
+   void       TransformMany(Int_t howmany, const Double_t *in, Double_t *out) override;
 
    ClassDefOverride(TFFTComplexReal,0);
 };
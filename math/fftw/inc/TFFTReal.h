@@ -27,6 +27,10 @@ class TFFTReal: public TVirtualFFT{
    Int_t    *fN;          //transform sizes in each dimension
    void     *fKind;       //transform kinds in each dimension
    TString   fFlags;      //transform flags
+   void     *fManyIn = nullptr;   //input arrays of TransformMany
+   void     *fManyOut = nullptr;  //output arrays of TransformMany
+   void     *fManyPlan = nullptr; //fftw plan of TransformMany
+   Int_t     fHowMany = 0;        //number of transforms of fManyPlan
 
    Int_t  MapOptions(const Int_t *kind);
    UInt_t MapFlag(Option_t *flag);
@@ -64,6 +68,7 @@ class TFFTReal: public TVirtualFFT{
    void      SetPointComplex(Int_t /*ipoint*/, TComplex &/*c*/) override{};
    void      SetPointsComplex(const Double_t* /*re*/, const Double_t* /*im*/) override{};
    void      Transform() override;
+   void      TransformMany(Int_t howmany, const Double_t *in, Double_t *out) override;
 
 
    ClassDefOverride(TFFTReal,0);
@@ -42,6 +42,9 @@
 #include "TFFTComplex.h"
 #include "fftw3.h"
 #include "TComplex.h"
+#include "TFFTWPlanCache.h"
+
+#include <algorithm>
 
 
 ClassImp(TFFTComplex);
@@ -102,14 +105,16 @@ TFFTComplex::TFFTComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan stays in the cache of plans until the end of the
+///session, and is reused by the transforms of the same size and type
 
 TFFTComplex::~TFFTComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
+   if (fManyIn)
+      fftw_free(fManyIn);
+   if (fManyOut)
+      fftw_free(fManyOut);
    fftw_free((fftw_complex*)fIn);
    if (fOut)
       fftw_free((fftw_complex*)fOut);
@@ -142,14 +147,15 @@ void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
    fSign = sign;
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = 0;
+   fHowMany = 0; // the plan of TransformMany depends on the flags
 
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fOut, sign,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fIn, sign, MapFlag(flags));
+   const UInt_t flag = MapFlag(flags);
+   std::vector<Int_t> key = ROOT::Internal::MakeFFTWPlanKey(0, flag, !fOut, 1, fNdim, fN);
+   key.push_back(sign);
+   fftw_complex *out = (fftw_complex*)(fOut ? fOut : fIn);
+   fPlan = ROOT::Internal::GetFFTWPlan(key, [&] {
+      return (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, out, sign, flag);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -158,13 +164,51 @@ void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
 void TFFTComplex::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft((fftw_plan)fPlan, (fftw_complex*)fIn, (fftw_complex*)(fOut ? fOut : fIn));
    else {
       Error("Transform", "transform not initialised");
       return;
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Computes howmany transforms of the size, sign and flags of this transform with a single
+///fftw plan. The k-th input is in[2*k*n] to in[2*(k+1)*n-1], with n the total size of the
+///transform, in the layout of SetPoints() (real and imaginary parts of each point one after
+///the other), and the k-th output is at the same place in out, in the layout of GetPoints().
+///The input and output arrays of the transform are not used.
+
+void TFFTComplex::TransformMany(Int_t howmany, const Double_t *in, Double_t *out)
+{
+   if (!fPlan) {
+      Error("TransformMany", "transform not initialised");
+      return;
+   }
+   if (howmany < 1) {
+      Error("TransformMany", "invalid number of transforms %d", howmany);
+      return;
+   }
+   if (howmany != fHowMany) {
+      if (fManyIn)
+         fftw_free(fManyIn);
+      if (fManyOut)
+         fftw_free(fManyOut);
+      fManyIn = fftw_malloc(sizeof(fftw_complex)*fTotalSize*howmany);
+      fManyOut = fftw_malloc(sizeof(fftw_complex)*fTotalSize*howmany);
+      const UInt_t flag = MapFlag(fFlags);
+      std::vector<Int_t> key = ROOT::Internal::MakeFFTWPlanKey(0, flag, kFALSE, howmany, fNdim, fN);
+      key.push_back(fSign);
+      fManyPlan = ROOT::Internal::GetFFTWPlan(key, [&] {
+         return (void*)fftw_plan_many_dft(fNdim, fN, howmany, (fftw_complex*)fManyIn, nullptr, 1, fTotalSize,
+                                          (fftw_complex*)fManyOut, nullptr, 1, fTotalSize, fSign, flag);
+      });
+      fHowMany = howmany;
+   }
+   std::copy(in, in + 2*fTotalSize*howmany, (Double_t*)fManyIn);
+   fftw_execute_dft((fftw_plan)fManyPlan, (fftw_complex*)fManyIn, (fftw_complex*)fManyOut);
+   std::copy((Double_t*)fManyOut, (Double_t*)fManyOut + 2*fTotalSize*howmany, out);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Copies the output(or input) into the argument array
 
@@ -44,6 +44,9 @@
 #include "TFFTComplexReal.h"
 #include "fftw3.h"
 #include "TComplex.h"
+#include "TFFTWPlanCache.h"
+
+#include <algorithm>
 
 
 ClassImp(TFFTComplexReal);
@@ -108,14 +111,16 @@ TFFTComplexReal::TFFTComplexReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan stays in the cache of plans until the end of the
+///session, and is reused by the transforms of the same size and type
 
 TFFTComplexReal::~TFFTComplexReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
+   if (fManyIn)
+      fftw_free(fManyIn);
+   if (fManyOut)
+      fftw_free(fManyOut);
    fftw_free((fftw_complex*)fIn);
    if (fOut)
       fftw_free(fOut);
@@ -148,15 +153,13 @@ TFFTComplexReal::~TFFTComplexReal()
 void TFFTComplexReal::Init( Option_t *flags, Int_t /*sign*/,const Int_t* /*kind*/)
 {
    fFlags = flags;
+   fHowMany = 0; // the plan of TransformMany depends on the flags
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = 0;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_c2r(fNdim, fN,(fftw_complex*)fIn,(Double_t*)fOut, MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_c2r(fNdim, fN, (fftw_complex*)fIn, (Double_t*)fIn, MapFlag(flags));
+   const UInt_t flag = MapFlag(flags);
+   Double_t *out = (Double_t*)(fOut ? fOut : fIn);
+   fPlan = ROOT::Internal::GetFFTWPlan(ROOT::Internal::MakeFFTWPlanKey(2, flag, !fOut, 1, fNdim, fN), [&] {
+      return (void*)fftw_plan_dft_c2r(fNdim, fN, (fftw_complex*)fIn, out, flag);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -165,13 +168,51 @@ void TFFTComplexReal::Init( Option_t *flags, Int_t /*sign*/,const Int_t* /*kind*
 void TFFTComplexReal::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft_c2r((fftw_plan)fPlan, (fftw_complex*)fIn, (Double_t*)(fOut ? fOut : fIn));
    else {
       Error("Transform", "transform was not initialized");
       return;
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Computes howmany transforms of the size and flags of this transform with a single fftw
+///plan. The k-th input is in[2*k*m] to in[2*(k+1)*m-1], with m the number of complex points
+///of the input, in the layout of SetPoints(), and the k-th output is out[k*n] to
+///out[(k+1)*n-1], with n the total size of the transform. The input and output arrays of
+///the transform are not used, and in is not modified.
+
+void TFFTComplexReal::TransformMany(Int_t howmany, const Double_t *in, Double_t *out)
+{
+   if (!fPlan) {
+      Error("TransformMany", "transform was not initialized");
+      return;
+   }
+   if (howmany < 1) {
+      Error("TransformMany", "invalid number of transforms %d", howmany);
+      return;
+   }
+   const Int_t sizein = Int_t(Double_t(fTotalSize)*(fN[fNdim-1]/2+1)/fN[fNdim-1]);
+   if (howmany != fHowMany) {
+      if (fManyIn)
+         fftw_free(fManyIn);
+      if (fManyOut)
+         fftw_free(fManyOut);
+      fManyIn = fftw_malloc(sizeof(fftw_complex)*sizein*howmany);
+      fManyOut = fftw_malloc(sizeof(Double_t)*fTotalSize*howmany);
+      const UInt_t flag = MapFlag(fFlags);
+      const std::vector<Int_t> key = ROOT::Internal::MakeFFTWPlanKey(2, flag, kFALSE, howmany, fNdim, fN);
+      fManyPlan = ROOT::Internal::GetFFTWPlan(key, [&] {
+         return (void*)fftw_plan_many_dft_c2r(fNdim, fN, howmany, (fftw_complex*)fManyIn, nullptr, 1, sizein,
+                                              (Double_t*)fManyOut, nullptr, 1, fTotalSize, flag);
+      });
+      fHowMany = howmany;
+   }
+   std::copy(in, in + 2*sizein*howmany, (Double_t*)fManyIn);
+   fftw_execute_dft_c2r((fftw_plan)fManyPlan, (fftw_complex*)fManyIn, (Double_t*)fManyOut);
+   std::copy((Double_t*)fManyOut, (Double_t*)fManyOut + fTotalSize*howmany, out);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Fills the argument array with the computed transform
 /// Works only for output (input array is destroyed in a C2R transform)
@@ -60,6 +60,9 @@
 
 #include "TFFTReal.h"
 #include "fftw3.h"
+#include "TFFTWPlanCache.h"
+
+#include <algorithm>
 
 ClassImp(TFFTReal);
 
@@ -119,12 +122,16 @@ TFFTReal::TFFTReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///clean-up
+///clean-up. The plan stays in the cache of plans until the end of the session, and is
+///reused by the transforms of the same size and kind
 
 TFFTReal::~TFFTReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
+   if (fManyIn)
+      fftw_free(fManyIn);
+   if (fManyOut)
+      fftw_free(fManyOut);
    fftw_free(fIn);
    fIn = 0;
    if (fOut){
@@ -175,18 +182,20 @@ TFFTReal::~TFFTReal()
 
 void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 {
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
+   fHowMany = 0; // the plan of TransformMany depends on the flags and kinds
 
    if (!fKind)
       fKind = (fftw_r2r_kind*)fftw_malloc(sizeof(fftw_r2r_kind)*fNdim);
 
    if (MapOptions(kind)){
-      if (fOut)
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fOut, (fftw_r2r_kind*)fKind, MapFlag(flags));
-      else
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fIn, (fftw_r2r_kind*)fKind, MapFlag(flags));
+      const UInt_t flag = MapFlag(flags);
+      std::vector<Int_t> key = ROOT::Internal::MakeFFTWPlanKey(3, flag, !fOut, 1, fNdim, fN);
+      key.insert(key.end(), (fftw_r2r_kind*)fKind, (fftw_r2r_kind*)fKind + fNdim);
+      Double_t *out = (Double_t*)(fOut ? fOut : fIn);
+      fPlan = ROOT::Internal::GetFFTWPlan(key, [&] {
+         return (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, out, (fftw_r2r_kind*)fKind, flag);
+      });
       fFlags = flags;
    }
 }
@@ -197,13 +206,50 @@ void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 void TFFTReal::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_r2r((fftw_plan)fPlan, (Double_t*)fIn, (Double_t*)(fOut ? fOut : fIn));
    else {
       Error("Transform", "transform hasn't been initialised");
       return;
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Computes howmany transforms of the size, kinds and flags of this transform with a single
+///fftw plan. The k-th input is in[k*n] to in[(k+1)*n-1], with n the total size of the
+///transform, and the k-th output is at the same place in out. The input and output arrays
+///of the transform are not used.
+
+void TFFTReal::TransformMany(Int_t howmany, const Double_t *in, Double_t *out)
+{
+   if (!fPlan) {
+      Error("TransformMany", "transform hasn't been initialised");
+      return;
+   }
+   if (howmany < 1) {
+      Error("TransformMany", "invalid number of transforms %d", howmany);
+      return;
+   }
+   if (howmany != fHowMany) {
+      if (fManyIn)
+         fftw_free(fManyIn);
+      if (fManyOut)
+         fftw_free(fManyOut);
+      fManyIn = fftw_malloc(sizeof(Double_t)*fTotalSize*howmany);
+      fManyOut = fftw_malloc(sizeof(Double_t)*fTotalSize*howmany);
+      const UInt_t flag = MapFlag(fFlags);
+      std::vector<Int_t> key = ROOT::Internal::MakeFFTWPlanKey(3, flag, kFALSE, howmany, fNdim, fN);
+      key.insert(key.end(), (fftw_r2r_kind*)fKind, (fftw_r2r_kind*)fKind + fNdim);
+      fManyPlan = ROOT::Internal::GetFFTWPlan(key, [&] {
+         return (void*)fftw_plan_many_r2r(fNdim, fN, howmany, (Double_t*)fManyIn, nullptr, 1, fTotalSize,
+                                          (Double_t*)fManyOut, nullptr, 1, fTotalSize, (fftw_r2r_kind*)fKind, flag);
+      });
+      fHowMany = howmany;
+   }
+   std::copy(in, in + fTotalSize*howmany, (Double_t*)fManyIn);
+   fftw_execute_r2r((fftw_plan)fManyPlan, (Double_t*)fManyIn, (Double_t*)fManyOut);
+   std::copy((Double_t*)fManyOut, (Double_t*)fManyOut + fTotalSize*howmany, out);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Returns the type of the transform
 
@@ -45,6 +45,9 @@
 #include "TFFTRealComplex.h"
 #include "fftw3.h"
 #include "TComplex.h"
+#include "TFFTWPlanCache.h"
+
+#include <algorithm>
 
 
 ClassImp(TFFTRealComplex);
@@ -112,14 +115,16 @@ TFFTRealComplex::TFFTRealComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan stays in the cache of plans until the end of the
+///session, and is reused by the transforms of the same size and type
 
 TFFTRealComplex::~TFFTRealComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
+   if (fManyIn)
+      fftw_free(fManyIn);
+   if (fManyOut)
+      fftw_free(fManyOut);
    fftw_free(fIn);
    fIn = 0;
    if (fOut)
@@ -152,15 +157,13 @@ TFFTRealComplex::~TFFTRealComplex()
 void TFFTRealComplex::Init(Option_t *flags,Int_t /*sign*/, const Int_t* /*kind*/)
 {
    fFlags = flags;
+   fHowMany = 0; // the plan of TransformMany depends on the flags
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = 0;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fOut,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fIn, MapFlag(flags));
+   const UInt_t flag = MapFlag(flags);
+   fftw_complex *out = (fftw_complex*)(fOut ? fOut : fIn);
+   fPlan = ROOT::Internal::GetFFTWPlan(ROOT::Internal::MakeFFTWPlanKey(1, flag, !fOut, 1, fNdim, fN), [&] {
+      return (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, out, flag);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -170,7 +173,7 @@ void TFFTRealComplex::Transform()
 {
 
    if (fPlan){
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft_r2c((fftw_plan)fPlan, (Double_t*)fIn, (fftw_complex*)(fOut ? fOut : fIn));
    }
    else {
       Error("Transform", "transform hasn't been initialised");
@@ -178,6 +181,44 @@ void TFFTRealComplex::Transform()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Computes howmany transforms of the size and flags of this transform with a single fftw
+///plan. The k-th input is in[k*n] to in[(k+1)*n-1], with n the total size of the transform,
+///and the k-th output is out[2*k*m] to out[2*(k+1)*m-1], with m the number of complex
+///points of the output, in the layout of GetPoints(). The input and output arrays of the
+///transform are not used.
+
+void TFFTRealComplex::TransformMany(Int_t howmany, const Double_t *in, Double_t *out)
+{
+   if (!fPlan) {
+      Error("TransformMany", "transform hasn't been initialised");
+      return;
+   }
+   if (howmany < 1) {
+      Error("TransformMany", "invalid number of transforms %d", howmany);
+      return;
+   }
+   const Int_t sizeout = Int_t(Double_t(fTotalSize)*(fN[fNdim-1]/2+1)/fN[fNdim-1]);
+   if (howmany != fHowMany) {
+      if (fManyIn)
+         fftw_free(fManyIn);
+      if (fManyOut)
+         fftw_free(fManyOut);
+      fManyIn = fftw_malloc(sizeof(Double_t)*fTotalSize*howmany);
+      fManyOut = fftw_malloc(sizeof(fftw_complex)*sizeout*howmany);
+      const UInt_t flag = MapFlag(fFlags);
+      const std::vector<Int_t> key = ROOT::Internal::MakeFFTWPlanKey(1, flag, kFALSE, howmany, fNdim, fN);
+      fManyPlan = ROOT::Internal::GetFFTWPlan(key, [&] {
+         return (void*)fftw_plan_many_dft_r2c(fNdim, fN, howmany, (Double_t*)fManyIn, nullptr, 1, fTotalSize,
+                                              (fftw_complex*)fManyOut, nullptr, 1, sizeout, flag);
+      });
+      fHowMany = howmany;
+   }
+   std::copy(in, in + fTotalSize*howmany, (Double_t*)fManyIn);
+   fftw_execute_dft_r2c((fftw_plan)fManyPlan, (Double_t*)fManyIn, (fftw_complex*)fManyOut);
+   std::copy((Double_t*)fManyOut, (Double_t*)fManyOut + 2*sizeout*howmany, out);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Fills the array data with the computed transform.
 ///Only (roughly) a half of the transform is copied (exactly the output of FFTW),
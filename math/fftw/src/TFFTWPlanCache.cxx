@@ -0,0 +1,58 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TFFTWPlanCache.h"
+#include "TVirtualFFT.h"
+#include "fftw3.h"
+
+#include <map>
+#include <mutex>
+
+namespace {
+
+struct FFTWPlanCache {
+   std::mutex fMutex;
+   std::map<std::vector<Int_t>, void *> fPlans;
+
+   ~FFTWPlanCache()
+   {
+      for (auto &plan : fPlans)
+         fftw_destroy_plan((fftw_plan)plan.second);
+   }
+};
+
+FFTWPlanCache &GetCache()
+{
+   static FFTWPlanCache cache;
+   return cache;
+}
+
+} // namespace
+
+void *ROOT::Internal::GetFFTWPlan(const std::vector<Int_t> &key, const std::function<void *()> &create)
+{
+   FFTWPlanCache &cache = GetCache();
+   std::lock_guard<std::mutex> lock(cache.fMutex);
+
+   std::vector<Int_t> fullKey(key);
+   const Int_t nthreads = TVirtualFFT::GetDefaultNThreads();
+   fullKey.push_back(nthreads);
+   auto it = cache.fPlans.find(fullKey);
+   if (it != cache.fPlans.end())
+      return it->second;
+
+#ifdef R__HAS_FFTW_THREADS
+   static const bool threadsInitialized = fftw_init_threads();
+   if (threadsInitialized)
+      fftw_plan_with_nthreads(nthreads);
+#endif
+   void *plan = create();
+   if (plan)
+      cache.fPlans.emplace(std::move(fullKey), plan);
+   return plan;
+}
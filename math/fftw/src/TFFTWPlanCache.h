@@ -0,0 +1,44 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Cache of the FFTW plans, used internally by the FFTW interface classes
+
+#ifndef ROOT_TFFTWPlanCache
+#define ROOT_TFFTWPlanCache
+
+#include "Rtypes.h"
+
+#include <functional>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+
+/// Return the FFTW plan of the transform described by `key` (type, sizes, flags...), calling `create` to make
+/// it if the cache has none yet.
+///
+/// A plan can be executed with the new-array execute functions of FFTW on any arrays of the size, alignment
+/// and placement it was made for, so all the transforms of the same size, type and flags share one plan.
+/// The plans are owned by the cache and kept until the end of the process. Planning with FFTW is not thread
+/// safe: the calls to `create` are serialized, and plan transforms with TVirtualFFT::GetDefaultNThreads()
+/// threads if FFTW was built with threads.
+void *GetFFTWPlan(const std::vector<Int_t> &key, const std::function<void *()> &create);
+
+/// Key of the plan of `howmany` transforms of type `type` and sizes n[0..ndim-1], with the FFTW planner flags `flags`
+inline std::vector<Int_t>
+MakeFFTWPlanKey(Int_t type, UInt_t flags, Bool_t inPlace, Int_t howmany, Int_t ndim, const Int_t *n)
+{
+   std::vector<Int_t> key{type, Int_t(flags), inPlace, howmany, ndim};
+   key.insert(key.end(), n, n + ndim);
+   return key;
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,299 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Header file for class LorentzVectorBatch
+
+#ifndef ROOT_Math_GenVector_LorentzVectorBatch
+#define ROOT_Math_GenVector_LorentzVectorBatch  1
+
+#include "Math/GenVector/LorentzVector.h"
+#include "Math/GenVector/PxPyPzE4D.h"
+#include "Math/GenVector/VectorUtil.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ROOT {
+
+  namespace Math {
+
+//__________________________________________________________________________________________
+/** @ingroup GenVector
+
+Batch of LorentzVector stored as a structure of arrays: one column per coordinate,
+in the order of the coordinate system (e.g. pt, eta, phi and mass for PtEtaPhiM4D).
+
+The columns are of type `Container`, any contiguous container of `Scalar` with
+`size()`, `data()`, `resize()` and `push_back()`: std::vector (the default) or
+ROOT::RVec. With RVec, the columns of an RDataFrame make a batch and the results
+are again columns, e.g. for the masses of all pairs of jets of an event:
+
+~~~{.cpp}
+using Jets = ROOT::Math::LorentzVectorBatch<ROOT::Math::PtEtaPhiM4D<float>, ROOT::RVecF>;
+ROOT::RVecF DijetMasses(const ROOT::RVecF &pt, const ROOT::RVecF &eta, const ROOT::RVecF &phi, const ROOT::RVecF &m)
+{
+   const Jets jets(pt, eta, phi, m);
+   const auto pairs = ROOT::VecOps::Combinations(pt, 2);
+   return InvariantMasses(jets.Take(pairs[0]), jets.Take(pairs[1]));
+}
+auto df2 = df.Define("mjj", DijetMasses, {"Jet_pt", "Jet_eta", "Jet_phi", "Jet_mass"});
+~~~
+
+The operations on the whole batch apply the formulas of LorentzVector to each
+vector, so that they give the same results as the operations on single vectors,
+in loops over the contiguous columns that the compiler can vectorize.
+
+@sa Overview of the @ref GenVector "physics vector library"
+*/
+
+    template <class CoordSystem, class Container = std::vector<typename CoordSystem::Scalar>>
+    class LorentzVectorBatch {
+
+    public:
+
+       typedef typename CoordSystem::Scalar Scalar;
+       typedef CoordSystem CoordinateType;
+       typedef Container ContainerType;
+       typedef LorentzVector<CoordSystem> VectorType;
+
+       /**
+          default constructor of an empty batch
+       */
+       LorentzVectorBatch() {}
+
+       /**
+          constructor of a batch of n null vectors
+       */
+       explicit LorentzVectorBatch(std::size_t n) : fColumns{Container(n), Container(n), Container(n), Container(n)} {}
+
+       /**
+          constructor from the four coordinate columns, in the order of the
+          coordinate system. The columns must have the same size.
+       */
+       LorentzVectorBatch(Container c0, Container c1, Container c2, Container c3) :
+          fColumns{std::move(c0), std::move(c1), std::move(c2), std::move(c3)}
+       {
+          CheckSize("LorentzVectorBatch", fColumns[1].size());
+          CheckSize("LorentzVectorBatch", fColumns[2].size());
+          CheckSize("LorentzVectorBatch", fColumns[3].size());
+       }
+
+       /**
+          constructor from a batch expressed in different coordinates, or
+          using a different Scalar or Container type
+       */
+       template <class Coords, class Container2>
+       explicit LorentzVectorBatch(const LorentzVectorBatch<Coords, Container2> &other) : LorentzVectorBatch(other.size())
+       {
+          const std::size_t n = size();
+          for (std::size_t i = 0; i < n; ++i)
+             Set(i, other[i]);
+       }
+
+       // ------ size and elements ------
+
+       std::size_t size() const { return fColumns[0].size(); }
+       bool empty() const { return fColumns[0].empty(); }
+
+       void resize(std::size_t n)
+       {
+          for (auto &column : fColumns)
+             column.resize(n);
+       }
+
+       /**
+          the i-th vector of the batch
+       */
+       VectorType operator[](std::size_t i) const
+       {
+          return VectorType(fColumns[0][i], fColumns[1][i], fColumns[2][i], fColumns[3][i]);
+       }
+
+       /**
+          set the i-th vector of the batch, converting v to the coordinate system of the batch
+       */
+       template <class Coords>
+       void Set(std::size_t i, const LorentzVector<Coords> &v)
+       {
+          VectorType(v).GetCoordinates(fColumns[0][i], fColumns[1][i], fColumns[2][i], fColumns[3][i]);
+       }
+
+       /**
+          append v, converted to the coordinate system of the batch
+       */
+       template <class Coords>
+       void push_back(const LorentzVector<Coords> &v)
+       {
+          Scalar a, b, c, d;
+          VectorType(v).GetCoordinates(a, b, c, d);
+          fColumns[0].push_back(a);
+          fColumns[1].push_back(b);
+          fColumns[2].push_back(c);
+          fColumns[3].push_back(d);
+       }
+
+       /**
+          column of the i-th coordinate (0 to 3) of the vectors
+       */
+       const Container &Column(unsigned int i) const { return fColumns[i]; }
+       Container &Column(unsigned int i) { return fColumns[i]; }
+
+       /**
+          batch of the vectors at the positions given by indices, e.g. a column
+          of ROOT::VecOps::Combinations
+       */
+       template <class Indices>
+       LorentzVectorBatch Take(const Indices &indices) const
+       {
+          LorentzVectorBatch result(indices.size());
+          for (unsigned int k = 0; k < 4; ++k) {
+             const Scalar *in = fColumns[k].data();
+             Scalar *out = result.fColumns[k].data();
+             const std::size_t n = indices.size();
+             for (std::size_t i = 0; i < n; ++i)
+                out[i] = in[indices[i]];
+          }
+          return result;
+       }
+
+       // ------ vectorized operations ------
+
+       /**
+          column of func(v) for all vectors v of the batch, where func takes a
+          LorentzVector<CoordSystem> and returns a Scalar
+       */
+       template <class Func>
+       Container Map(Func &&func) const
+       {
+          const std::size_t n = size();
+          Container result(n);
+          const Scalar *c0 = fColumns[0].data();
+          const Scalar *c1 = fColumns[1].data();
+          const Scalar *c2 = fColumns[2].data();
+          const Scalar *c3 = fColumns[3].data();
+          Scalar *out = result.data();
+          for (std::size_t i = 0; i < n; ++i)
+             out[i] = func(VectorType(c0[i], c1[i], c2[i], c3[i]));
+          return result;
+       }
+
+       /**
+          columns of the components of the vectors, see the LorentzVector methods of the same names
+       */
+       Container Px() const { return Map([](const VectorType &v) { return v.Px(); }); }
+       Container Py() const { return Map([](const VectorType &v) { return v.Py(); }); }
+       Container Pz() const { return Map([](const VectorType &v) { return v.Pz(); }); }
+       Container E() const { return Map([](const VectorType &v) { return v.E(); }); }
+       Container P() const { return Map([](const VectorType &v) { return v.P(); }); }
+       Container Pt() const { return Map([](const VectorType &v) { return v.Pt(); }); }
+       Container Eta() const { return Map([](const VectorType &v) { return v.Eta(); }); }
+       Container Phi() const { return Map([](const VectorType &v) { return v.Phi(); }); }
+       Container M() const { return Map([](const VectorType &v) { return v.M(); }); }
+       Container M2() const { return Map([](const VectorType &v) { return v.M2(); }); }
+       Container Mt() const { return Map([](const VectorType &v) { return v.Mt(); }); }
+       Container Rapidity() const { return Map([](const VectorType &v) { return v.Rapidity(); }); }
+
+       /**
+          batch of the vectors boosted by the same beta vector b (any 3D vector
+          with X(), Y() and Z()), as with VectorUtil::boost
+       */
+       template <class BoostVector>
+       LorentzVectorBatch Boosted(const BoostVector &b) const
+       {
+          const std::size_t n = size();
+          LorentzVectorBatch result(n);
+          for (std::size_t i = 0; i < n; ++i)
+             result.Set(i, VectorUtil::boost(LorentzVector<PxPyPzE4D<Scalar>>((*this)[i]), b));
+          return result;
+       }
+
+       /**
+          batch of the vectors boosted each by its own beta vector, given by
+          the columns bx, by and bz
+       */
+       LorentzVectorBatch Boosted(const Container &bx, const Container &by, const Container &bz) const
+       {
+          const std::size_t n = size();
+          CheckSize("Boosted", bx.size());
+          CheckSize("Boosted", by.size());
+          CheckSize("Boosted", bz.size());
+          LorentzVectorBatch result(n);
+          for (std::size_t i = 0; i < n; ++i) {
+             const DisplacementVector3D<Cartesian3D<Scalar>> b(bx[i], by[i], bz[i]);
+             result.Set(i, VectorUtil::boost(LorentzVector<PxPyPzE4D<Scalar>>((*this)[i]), b));
+          }
+          return result;
+       }
+
+       /**
+          element-wise sum of two batches of the same size
+       */
+       template <class Coords, class Container2>
+       LorentzVectorBatch operator+(const LorentzVectorBatch<Coords, Container2> &other) const
+       {
+          const std::size_t n = size();
+          CheckSize("operator+", other.size());
+          LorentzVectorBatch result(n);
+          for (std::size_t i = 0; i < n; ++i)
+             result.Set(i, LorentzVector<PxPyPzE4D<Scalar>>((*this)[i]) + other[i]);
+          return result;
+       }
+
+       /// throw std::runtime_error if n is not the size of the batch
+       void CheckSize(const char *where, std::size_t n) const
+       {
+          if (n != size())
+             throw std::runtime_error(std::string("LorentzVectorBatch::") + where + ": size mismatch, " +
+                                      std::to_string(size()) + " vectors and " + std::to_string(n));
+       }
+
+    private:
+
+       Container fColumns[4]; // the coordinates of the vectors, in the order of CoordSystem
+
+    };
+
+    /**
+       column of the invariant masses of the pairs (a[i], b[i]), as with VectorUtil::InvariantMass
+    */
+    template <class Coords1, class Coords2, class Container>
+    Container InvariantMasses(const LorentzVectorBatch<Coords1, Container> &a,
+                              const LorentzVectorBatch<Coords2, Container> &b)
+    {
+       a.CheckSize("InvariantMasses", b.size());
+       const std::size_t n = a.size();
+       Container result(n);
+       for (std::size_t i = 0; i < n; ++i)
+          result[i] = VectorUtil::InvariantMass(a[i], b[i]);
+       return result;
+    }
+
+    /**
+       column of the distances in (eta, phi) of the pairs (a[i], b[i]), as with VectorUtil::DeltaR
+    */
+    template <class Coords1, class Coords2, class Container>
+    Container DeltaR(const LorentzVectorBatch<Coords1, Container> &a, const LorentzVectorBatch<Coords2, Container> &b)
+    {
+       a.CheckSize("DeltaR", b.size());
+       const std::size_t n = a.size();
+       Container result(n);
+       for (std::size_t i = 0; i < n; ++i)
+          result[i] = VectorUtil::DeltaR(a[i], b[i]);
+       return result;
+    }
+
+  } // end namespace Math
+
+} // end namespace ROOT
+
+#endif
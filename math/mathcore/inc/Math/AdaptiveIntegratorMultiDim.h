@@ -18,6 +18,8 @@
 
 #include "Math/VirtualIntegrator.h"
 
+#include "ROOT/EExecutionPolicy.hxx"
+
 namespace ROOT {
 namespace Math {
 
@@ -70,6 +72,12 @@ For a more detailed description of the method see References.
   2..Numerical integration usually works best for smooth functions.
      Some analysis or suitable transformations of the integral prior to
      numerical work may contribute to numerical efficiency.
+  3..The nodes of a region, and of the two halves of a divided region, are
+     computed first and then evaluated together with IMultiGenFunction::EvalBatch,
+     which integrands can re-implement to evaluate many points at a time.
+     With SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread) the nodes are
+     evaluated in parallel by the ROOT thread pool; the integrand must then be
+     thread safe. The result does not depend on the execution policy.
 
 ### References:
 
@@ -166,6 +174,13 @@ public:
    ///set max points
    void SetMaxPts(unsigned int n) { fMaxPts = n; }
 
+   /// set the execution policy of the evaluation of the integrand: with ROOT::EExecutionPolicy::kMultiThread
+   /// the nodes are evaluated in parallel, so the integrand must be thread safe
+   void SetExecutionPolicy(ROOT::EExecutionPolicy policy) { fExecutionPolicy = policy; }
+
+   /// return the execution policy of the evaluation of the integrand
+   ROOT::EExecutionPolicy GetExecutionPolicy() const { return fExecutionPolicy; }
+
    /// set the options
    void SetOptions(const ROOT::Math::IntegratorMultiDimOptions & opt) override;
 
@@ -177,6 +192,9 @@ protected:
    // internal function to compute the integral (if absVal is true compute abs value of function integral
    double DoIntegral(const double* xmin, const double * xmax, bool absVal = false);
 
+   // evaluate the integrand at the npoints nodes stored one after the other in x, following the execution policy
+   void EvalNodes(unsigned int npoints, const double *x, double *f) const;
+
  private:
 
    unsigned int fDim;     ///< dimensionality of integrand
@@ -192,6 +210,8 @@ protected:
    int    fNEval;         ///< number of function evaluation
    int fStatus;           ///< status of algorithm (error if not zero)
 
+   ROOT::EExecutionPolicy fExecutionPolicy = ROOT::EExecutionPolicy::kSequential; ///< policy of the evaluation of the integrand
+
    const IMultiGenFunction* fFun;   // pointer to integrand function
 
 };
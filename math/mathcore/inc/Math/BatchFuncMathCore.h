@@ -0,0 +1,88 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/**
+
+Batch versions of the most used special functions, probability density functions and
+cumulative distribution functions of MathCore.
+
+Each function evaluates the scalar function of the same name, with the same parameters, for all
+the elements of the input `x` and writes the results to `out`, which must have the same size as `x`.
+`out` may be the same array as `x`. The parameters of the distributions are checked and the
+quantities depending only on them are computed once per batch, which makes these functions suited
+for the inner loops of fits, e.g. in RooBatchCompute, TF1 or on RVec data:
+
+~~~ {.cpp}
+std::vector<double> x = ..., y(x.size());
+ROOT::Math::crystalball_pdf(x, y, alpha, n, sigma, mean);
+ROOT::Math::erf({v.data(), v.size()}, {v.data(), v.size()}); // in place on a ROOT::RVecD v
+~~~
+
+The results are identical to the ones of the scalar functions, except for #gaussian_pdf
+which uses the SIMD exponential of VecCore if ROOT is built with Vc, and agrees with
+the scalar function to a few units in the last place.
+
+@ingroup StatFunc
+
+*/
+
+#ifndef ROOT_Math_BatchFuncMathCore
+#define ROOT_Math_BatchFuncMathCore
+
+#include "ROOT/RSpan.hxx"
+
+namespace ROOT {
+namespace Math {
+
+/// Batch version of ROOT::Math::erf(double)
+void erf(std::span<const double> x, std::span<double> out);
+
+/// Batch version of ROOT::Math::erfc(double)
+void erfc(std::span<const double> x, std::span<double> out);
+
+/// Batch version of ROOT::Math::tgamma(double)
+void tgamma(std::span<const double> x, std::span<double> out);
+
+/// Batch version of ROOT::Math::lgamma(double)
+void lgamma(std::span<const double> x, std::span<double> out);
+
+/// Batch version of ROOT::Math::gaussian_pdf(double, double, double)
+void gaussian_pdf(std::span<const double> x, std::span<double> out, double sigma = 1, double x0 = 0);
+
+/// Batch version of ROOT::Math::gaussian_cdf(double, double, double)
+void gaussian_cdf(std::span<const double> x, std::span<double> out, double sigma = 1, double x0 = 0);
+
+/// Batch version of ROOT::Math::breitwigner_pdf(double, double, double)
+void breitwigner_pdf(std::span<const double> x, std::span<double> out, double gamma, double x0 = 0);
+
+/// Batch version of ROOT::Math::exponential_pdf(double, double, double)
+void exponential_pdf(std::span<const double> x, std::span<double> out, double lambda, double x0 = 0);
+
+/// Batch version of ROOT::Math::landau_pdf(double, double, double)
+void landau_pdf(std::span<const double> x, std::span<double> out, double xi = 1, double x0 = 0);
+
+/// Batch version of ROOT::Math::landau_cdf(double, double, double)
+void landau_cdf(std::span<const double> x, std::span<double> out, double xi = 1, double x0 = 0);
+
+/// Batch version of ROOT::Math::crystalball_function(double, double, double, double, double)
+void crystalball_function(std::span<const double> x, std::span<double> out, double alpha, double n, double sigma,
+                          double mean = 0);
+
+/// Batch version of ROOT::Math::crystalball_pdf(double, double, double, double, double)
+void crystalball_pdf(std::span<const double> x, std::span<double> out, double alpha, double n, double sigma,
+                     double mean = 0);
+
+/// Batch version of ROOT::Math::poisson_pdf(unsigned int, double)
+void poisson_pdf(std::span<const unsigned int> n, std::span<double> out, double mu);
+
+} // namespace Math
+} // namespace ROOT
+
+#endif
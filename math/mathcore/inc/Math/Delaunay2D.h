@@ -28,6 +28,8 @@
 #include <set>
 #include <functional>
 
+#include "ROOT/EExecutionPolicy.hxx"
+
 #ifdef HAS_CGAL
    /* CGAL uses the name PTR as member name in its Handle class
     * but its a macro defined in mmalloc.h of ROOT
@@ -103,7 +105,8 @@ namespace ROOT {
 
    To speed up localisation of points (to see to which triangle belong) a grid is layed over the internal coordinate space.
    A reference to triangle ABC is added to _all_ grid cells that include ABC's bounding box.
-   The size of the grid is defined to be 25x25
+   The size of the grid grows with the number of triangles (with at least 25x25 cells), so that only a few
+   triangles have to be tested for each interpolated point.
 
    Optionally (if the compiler macro `HAS_GCAL` is defined ) the triangle findings and interpolation can be computed
    using the GCAL library. This is however not supported when using the class within ROOT
@@ -142,6 +145,12 @@ public:
    /// See the class documentation for  how the interpolation is computed.
    double  Interpolate(double x, double y);
 
+   /// Interpolate the `n` points (x[i], y[i]) and store the results in z[i].
+   /// The triangles are found once, then the points are interpolated independently: with
+   /// ROOT::EExecutionPolicy::kMultiThread they are shared among the threads of the ROOT thread pool.
+   void    Interpolate(int n, const double *x, const double *y, double *z,
+                       ROOT::EExecutionPolicy executionPolicy = ROOT::EExecutionPolicy::kSequential);
+
    /// Find all triangles
    void      FindAllTriangles();
 
@@ -225,10 +234,13 @@ protected:
    std::vector<double> fXN; ///<! normalized X
    std::vector<double> fYN; ///<! normalized Y
 
-   static const int fNCells = 25; ///<! number of cells to divide the normalized space
+   static const int fMinNCells = 25;   ///<! minimum number of cells along each axis
+   static const int fMaxNCells = 4096; ///<! maximum number of cells along each axis
+   int fNCells;       ///<! number of cells to divide the normalized space along each axis
    double fXCellStep; ///<! inverse denominator to calculate X cell = fNCells / (fXNmax - fXNmin)
    double fYCellStep; ///<! inverse denominator to calculate X cell = fNCells / (fYNmax - fYNmin)
-   std::set<unsigned int> fCells[(fNCells+1)*(fNCells+1)]; ///<! grid cells with containing triangles
+   std::vector<unsigned int> fCellStart;     ///<! position in fCellTriangles of the first triangle of each cell
+   std::vector<unsigned int> fCellTriangles; ///<! triangles overlapping each grid cell, cell after cell
 
    inline unsigned int Cell(unsigned int x, unsigned int y) const {
       return x*(fNCells+1) + y;
@@ -78,6 +78,10 @@ namespace ROOT {
          /// Use the pure virtual private method DoEval which must be implemented by the sub-classes.
          T operator()(const T *x) const { return DoEval(x); }
 
+         /// Evaluate the function at the n points stored one after the other in x[], the i-th at x + i * NDim(),
+         /// and write the values to f[]. Used by the numerical methods evaluating many points at a time.
+         void EvalBatch(unsigned int n, const T *x, T *f) const { DoEvalBatch(n, x, f); }
+
 #ifdef LATER
          /// Template method to evaluate the function using the begin of an iterator.
          /// User is responsible to provide correct size for the iterator.
@@ -93,6 +97,15 @@ namespace ROOT {
 
          /// Implementation of the evaluation function. Must be implemented by derived classes.
          virtual T DoEval(const T *x) const = 0;
+
+         /// Implementation of the evaluation at many points. The default calls DoEval for each point, derived
+         /// classes can re-implement it to evaluate the points together, e.g. in a vectorized loop.
+         virtual void DoEvalBatch(unsigned int n, const T *x, T *f) const
+         {
+            const unsigned int ndim = NDim();
+            for (unsigned int i = 0; i < n; ++i)
+               f[i] = DoEval(x + i * ndim);
+         }
       };
 
 
@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <string>
+#include <vector>
 
 /**
    @defgroup ParamFunc Parametric Function Evaluation Interfaces.
@@ -127,6 +128,17 @@ namespace ROOT {
             return DoEval(x);
          }
 
+         /**
+            Evaluate the function for the given parameters p at n points, whose coordinates
+            are passed in structure-of-arrays layout: x[icoord][ipoint], as they are stored in
+            ROOT::Fit::FitData. The n function values are written in y.
+            Derived classes can implement DoEvalParN to evaluate the points in a vectorized way.
+         */
+         void EvalParN(unsigned int n, const T *const *x, const double *p, T *y) const
+         {
+            DoEvalParN(n, x, p, y);
+         }
+
       private:
          /**
             Implementation of the evaluation function using the x values and the parameters.
@@ -134,6 +146,26 @@ namespace ROOT {
          */
          virtual T DoEvalPar(const T *x, const double *p) const = 0;
 
+         /**
+            Implementation of the evaluation on a batch of points. The default calls
+            DoEvalPar for each point.
+         */
+         virtual void DoEvalParN(unsigned int n, const T *const *x, const double *p, T *y) const
+         {
+            const unsigned int ndim = this->NDim();
+            if (ndim == 1) {
+               for (unsigned int i = 0; i < n; ++i)
+                  y[i] = DoEvalPar(x[0] + i, p);
+               return;
+            }
+            std::vector<T> point(ndim);
+            for (unsigned int i = 0; i < n; ++i) {
+               for (unsigned int j = 0; j < ndim; ++j)
+                  point[j] = x[j][i];
+               y[i] = DoEvalPar(point.data(), p);
+            }
+         }
+
          /**
             Implement the ROOT::Math::IBaseFunctionMultiDim interface DoEval(x) using the cached parameter values
          */
@@ -0,0 +1,118 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_Math_PhiloxEngine
+#define ROOT_Math_PhiloxEngine
+
+#include "Math/TRandomEngine.h"
+
+#include <cstdint>
+
+namespace ROOT {
+namespace Math {
+
+/**
+   Counter-based random number engine Philox4x32-10, described in
+
+   J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw, *Parallel random numbers: as easy as 1, 2, 3*,
+   Proceedings of SC11 (2011), http://dx.doi.org/10.1145/2063384.2063405
+
+   The numbers are obtained by encrypting a 128 bit counter with the 64 bit key given by the seed, so
+   the engine has no state to advance: skipping ahead by any amount with Skip() is as fast as generating
+   a single number. The upper 64 bits of the counter are a stream number, which selects one of 2^64
+   independent sequences of 2^65 numbers for the same seed. Giving a different stream to each thread or
+   job makes a parallel generation reproducible, independently of the scheduling.
+
+   Each 128 bit output gives two double-precision numbers with 53 bits of randomness.
+
+   @ingroup Random
+*/
+class PhiloxEngine final : public TRandomEngine {
+
+public:
+   PhiloxEngine(uint64_t seed = 1, uint64_t stream = 0) : fStream(stream) { SetSeed(seed); }
+   ~PhiloxEngine() override {}
+
+   /// Generate a double-precision random number in ]0,1[
+   double Rndm() override { return (*this)(); }
+   /// Generate a double-precision random number in ]0,1[ (non-virtual method)
+   double operator()() { return ToDouble(IntRndm()); }
+   /// Generate a random integer value with 64 bits
+   uint64_t IntRndm()
+   {
+      if (fPos == 2) {
+         Block(fCounter++, fBuffer);
+         fPos = 0;
+      }
+      return fBuffer[fPos++];
+   }
+
+   /// Fill `array` with `n` numbers in ]0,1[, the same as `n` calls to Rndm()
+   void RndmArray(int n, double *array);
+   /// Fill `array` with `n` gaussian numbers of mean 0 and sigma 1, using the Box-Muller transform
+   void GausArray(int n, double *array);
+
+   /// Initialize the key with `seed` and go back to the start of the current stream
+   void SetSeed(uint64_t seed);
+   /// Select the stream `stream` and go back to its start
+   void SetStream(uint64_t stream);
+   /// Skip `n` random numbers without generating them
+   void Skip(uint64_t n);
+
+   uint64_t GetSeed() const { return fSeed; }
+   uint64_t GetStream() const { return fStream; }
+   /// Number of random numbers generated (or skipped) since the start of the stream, modulo 2^64
+   uint64_t GetPosition() const { return 2 * fCounter - (2 - fPos); }
+
+   /// Get name of the generator
+   static const char *Name() { return "Philox4x32-10"; }
+
+private:
+   /// Encrypt the counter (`counter`, fStream) and store the result as two 64 bit words in `out`
+   void Block(uint64_t counter, uint64_t *out) const
+   {
+      constexpr uint32_t kM0 = 0xD2511F53;
+      constexpr uint32_t kM1 = 0xCD9E8D57;
+      constexpr uint32_t kW0 = 0x9E3779B9;
+      constexpr uint32_t kW1 = 0xBB67AE85;
+      uint32_t c0 = uint32_t(counter);
+      uint32_t c1 = uint32_t(counter >> 32);
+      uint32_t c2 = uint32_t(fStream);
+      uint32_t c3 = uint32_t(fStream >> 32);
+      uint32_t k0 = uint32_t(fSeed);
+      uint32_t k1 = uint32_t(fSeed >> 32);
+      for (int round = 0; round < 10; ++round) {
+         const uint64_t p0 = uint64_t(kM0) * c0;
+         const uint64_t p1 = uint64_t(kM1) * c2;
+         c0 = uint32_t(p1 >> 32) ^ c1 ^ k0;
+         c1 = uint32_t(p1);
+         c2 = uint32_t(p0 >> 32) ^ c3 ^ k1;
+         c3 = uint32_t(p0);
+         k0 += kW0;
+         k1 += kW1;
+      }
+      out[0] = uint64_t(c0) | (uint64_t(c1) << 32);
+      out[1] = uint64_t(c2) | (uint64_t(c3) << 32);
+   }
+
+   /// Map the upper 53 bits of `x` to the centre of one of 2^53 intervals of ]0,1[
+   static double ToDouble(uint64_t x) { return ((x >> 11) + 0.5) * 0x1p-53; }
+
+   uint64_t fSeed = 0;      ///< key of the encryption
+   uint64_t fStream = 0;    ///< upper 64 bits of the counter
+   uint64_t fCounter = 0;   ///< lower 64 bits of the counter of the next block
+   uint64_t fBuffer[2] = {}; ///< last block
+   unsigned int fPos = 2;   ///< number of words of fBuffer already used
+};
+
+} // end namespace Math
+} // end namespace ROOT
+
+#endif /* ROOT_Math_PhiloxEngine */
@@ -28,6 +28,8 @@
 //       can be created for different state N.                          //
 //    * ROOT::MATH::StdEngine to create genersators based on engines    //
 //      provided by the C++ standard libraries
+//    * ROOT::Math::PhiloxEngine, a counter-based generator with independent
+//      streams and skipping ahead in constant time
 //
 //  Convenient typedef are defines to define the different types of
 //  generators. These typedef are
@@ -36,6 +38,7 @@
 //   * TRandomMixMax256 for the MixMaxEngine<256,2> (MIXMAX with state N=256 )
 //   * TRandomMT64 for the  StdEngine<std::mt19937_64> ( MersenneTwister 64 bits)
 //   * TRandomRanlux48 for the  StdEngine<std::ranlux48> (Ranlux 48 bits)
+//   * TRandomPhilox for the PhiloxEngine (Philox4x32-10)
 //
 //                                                                     //
 //////////////////////////////////////////////////////////////////////////
@@ -65,10 +68,15 @@ public:
    }
     void     RndmArray(Int_t n, Double_t *array) override {
             for (int i = 0; i < n; ++i) array[i] = fEngine();
+   }
+    void     GausArray(Int_t n, Double_t *array, Double_t mean=0, Double_t sigma=1) override {
+      TRandom::GausArray(n, array, mean, sigma);
    }
     void     SetSeed(ULong_t seed=0) override {
       fEngine.SetSeed(seed);
    }
+   /// Access the engine, e.g. to select a stream or to skip ahead
+   Engine &GetEngine() { return fEngine; }
 
    ClassDefOverride(TRandomGen,1)  //Generic Random number generator template on the Engine type
 };
@@ -77,6 +85,22 @@ public:
 #include "Math/StdEngine.h"
 #include "Math/MixMaxEngine.h"
 #include "Math/RanluxppEngine.h"
+#include "Math/PhiloxEngine.h"
+
+// the Philox engine generates arrays in bulk
+template <>
+inline void TRandomGen<ROOT::Math::PhiloxEngine>::RndmArray(Int_t n, Double_t *array)
+{
+   fEngine.RndmArray(n, array);
+}
+
+template <>
+inline void TRandomGen<ROOT::Math::PhiloxEngine>::GausArray(Int_t n, Double_t *array, Double_t mean, Double_t sigma)
+{
+   fEngine.GausArray(n, array);
+   for (Int_t i = 0; i < n; ++i)
+      array[i] = mean + sigma * array[i];
+}
 
 // not working wight now for this classes
 //#define  DEFINE_TEMPL_INSTANCE
@@ -131,6 +155,14 @@ typedef TRandomGen<ROOT::Math::MixMaxEngine<256,2>> TRandomMixMax256;
 
 typedef TRandomGen<ROOT::Math::RanluxppEngine2048> TRandomRanluxpp;
 
+/**
+  @ingroup Random
+  Counter-based generator Philox4x32-10, see ROOT::Math::PhiloxEngine.
+  Independent streams for parallel generation are selected with
+  `GetEngine().SetStream(stream)`, e.g. one per thread or per toy.
+ */
+typedef TRandomGen<ROOT::Math::PhiloxEngine> TRandomPhilox;
+
 /**
   @ingroup Random
   Generator based on a the Mersenne-Twister generator with 64 bits,
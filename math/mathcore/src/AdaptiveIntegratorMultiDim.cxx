@@ -6,12 +6,113 @@
 #include "Math/IntegratorOptions.h"
 #include "Math/Error.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 #include <cmath>
 #include <algorithm>
+#include <vector>
 
 namespace ROOT {
 namespace Math {
 
+namespace {
+
+/// Apply the degree seven rule to the region of centre ctr and half widths wth, calling eval(z) at each of its
+/// 2^n + 2n(n+1) + 1 nodes z, always in the same order, and return the weighted sums of the function values in
+/// sums[0..4] and the coordinate with the largest fourth difference in idvaxn
+template <class Eval_t>
+void GenzMalikRule(unsigned int n, const double *ctr, const double *wth, bool absValue, Eval_t &&eval, double *sums,
+                   unsigned int &idvaxn)
+{
+   static const double xl2 = 0.358568582800318073;//lambda_2
+   static const double xl4 = 0.948683298050513796;//lambda_4
+   static const double xl5 = 0.688247201611685289;//lambda_5
+
+   double wthl[15], z[15];
+   double sum1, sum2, sum3, sum4, sum5, difmax, f2, f3, dif;
+   unsigned int j, j1, k, l, m;
+
+   for (j=0; j<n; j++)
+      z[j]    = ctr[j]; //temporary node
+   sum1 = eval(z); //evaluate function
+
+   difmax = 0;
+   sum2   = 0;
+   sum3   = 0;
+
+   //loop over coordinates
+   for (j=0; j<n; j++) {
+      z[j]    = ctr[j] - xl2*wth[j];
+      if (absValue) f2 = std::abs(eval(z));
+      else          f2 = eval(z);
+      z[j]    = ctr[j] + xl2*wth[j];
+      if (absValue) f2 += std::abs(eval(z));
+      else          f2 += eval(z);
+      wthl[j] = xl4*wth[j];
+      z[j]    = ctr[j] - wthl[j];
+      if (absValue) f3 = std::abs(eval(z));
+      else          f3 = eval(z);
+      z[j]    = ctr[j] + wthl[j];
+      if (absValue) f3 += std::abs(eval(z));
+      else          f3 += eval(z);
+      sum2   += f2;//sum func eval with different weights separately
+      sum3   += f3;//for a given region
+      dif     = std::abs(7*f2-f3-12*sum1);
+      //storing dimension with biggest error/difference (?)
+      if (dif >= difmax) {
+         difmax=dif;
+         idvaxn=j+1;
+      }
+      z[j]    = ctr[j];
+   }
+
+   sum4 = 0;
+   for (j=1;j<n;j++) {
+      j1 = j-1;
+      for (k=j;k<n;k++) {
+         for (l=0;l<2;l++) {
+            wthl[j1] = -wthl[j1];
+            z[j1]    = ctr[j1] + wthl[j1];
+            for (m=0;m<2;m++) {
+               wthl[k] = -wthl[k];
+               z[k]    = ctr[k] + wthl[k];
+               if (absValue) sum4 += std::abs(eval(z));
+               else            sum4 += eval(z);
+            }
+         }
+         z[k] = ctr[k];
+      }
+      z[j1] = ctr[j1];
+   }
+
+   sum5 = 0;
+
+   for (j=0;j<n;j++) {
+      wthl[j] = -xl5*wth[j];
+      z[j] = ctr[j] + wthl[j];
+   }
+L90: //sum over end nodes ~gray codes
+   if (absValue) sum5 += std::abs(eval(z));
+   else          sum5 += eval(z);
+   for (j=0;j<n;j++) {
+      wthl[j] = -wthl[j];
+      z[j] = ctr[j] + wthl[j];
+      if (wthl[j] > 0) goto L90;
+   }
+
+   sums[0] = sum1;
+   sums[1] = sum2;
+   sums[2] = sum3;
+   sums[3] = sum4;
+   sums[4] = sum5;
+}
+
+} // namespace
+
 
 
 AdaptiveIntegratorMultiDim::AdaptiveIntegratorMultiDim(double absTol, double relTol, unsigned int maxpts, unsigned int size):
@@ -96,11 +197,8 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
    double relerr; //an estimation of the relative accuracy of the result
 
 
-   double ctr[15], wth[15], wthl[15], z[15];
+   double ctr[15], wth[15], ctrUpper[15];
 
-   static const double xl2 = 0.358568582800318073;//lambda_2
-   static const double xl4 = 0.948683298050513796;//lambda_4
-   static const double xl5 = 0.688247201611685289;//lambda_5
    static const double w2  = 980./6561; //weights/2^n
    static const double w4  = 200./19683;
    static const double wp2 = 245./486;//error weights/2^n
@@ -177,84 +275,55 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
       wth[j] = (xmax[j] - xmin[j])*0.5;//its width
    }
 
-   double rgnvol, sum1, sum2, sum3, sum4, sum5, difmax, f2, f3, dif, aresult;
+   double rgnvol, sum1, sum2, sum3, sum4, sum5, sums[5], aresult;
    double rgncmp=0, rgnval, rgnerr;
 
-   unsigned int j1, k, l, m, idvaxn=0, idvax0=0, isbtmp, isbtpp;
-
-   //InitArgs(z,fParams);
+   unsigned int k, idvaxn=0, idvaxnRecord, idvax0=0, isbtmp, isbtpp;
+
+   // nodes of the regions to evaluate, their function values and the position of the next value to use
+   std::vector<double> nodes, values;
+   std::size_t ivalue = 0;
+   bool upperEvaluated = false;
+   auto recordNode = [&](const double *z) {
+      nodes.insert(nodes.end(), z, z + n);
+      return 0.;
+   };
+
+#ifndef R__USE_IMT
+   if (fExecutionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      MATH_WARN_MSG("AdaptiveIntegratorMultiDim::DoIntegral", "Multithread execution policy is not available, "
+                                                              "using ROOT::EExecutionPolicy::kSequential");
+      fExecutionPolicy = ROOT::EExecutionPolicy::kSequential;
+   }
+#endif
 
 L20:
    rgnvol = twondm;//=2^n
    for (j=0; j<n; j++) {
       rgnvol *= wth[j]; //region volume
-      z[j]    = ctr[j]; //temporary node
-   }
-   sum1 = (*fFun)((const double*)z);//EvalPar(z,fParams); //evaluate function
-
-   difmax = 0;
-   sum2   = 0;
-   sum3   = 0;
-
-   //loop over coordinates
-   for (j=0; j<n; j++) {
-      z[j]    = ctr[j] - xl2*wth[j];
-      if (absValue) f2 = std::abs((*fFun)(z));
-      else          f2 = (*fFun)(z);
-      z[j]    = ctr[j] + xl2*wth[j];
-      if (absValue) f2 += std::abs((*fFun)(z));
-      else          f2 += (*fFun)(z);
-      wthl[j] = xl4*wth[j];
-      z[j]    = ctr[j] - wthl[j];
-      if (absValue) f3 = std::abs((*fFun)(z));
-      else          f3 = (*fFun)(z);
-      z[j]    = ctr[j] + wthl[j];
-      if (absValue) f3 += std::abs((*fFun)(z));
-      else          f3 += (*fFun)(z);
-      sum2   += f2;//sum func eval with different weights separately
-      sum3   += f3;//for a given region
-      dif     = std::abs(7*f2-f3-12*sum1);
-      //storing dimension with biggest error/difference (?)
-      if (dif >= difmax) {
-         difmax=dif;
-         idvaxn=j+1;
-      }
-      z[j]    = ctr[j];
    }
 
-   sum4 = 0;
-   for (j=1;j<n;j++) {
-      j1 = j-1;
-      for (k=j;k<n;k++) {
-         for (l=0;l<2;l++) {
-            wthl[j1] = -wthl[j1];
-            z[j1]    = ctr[j1] + wthl[j1];
-            for (m=0;m<2;m++) {
-               wthl[k] = -wthl[k];
-               z[k]    = ctr[k] + wthl[k];
-               if (absValue) sum4 += std::abs((*fFun)(z));
-               else            sum4 += (*fFun)(z);
-            }
-         }
-         z[k] = ctr[k];
+   // the nodes of the region are first collected and then evaluated together. When dividing, the nodes of the
+   // upper half are evaluated with those of the lower half, and their values used at the next pass
+   if (!upperEvaluated) {
+      nodes.clear();
+      GenzMalikRule(n, ctr, wth, absValue, recordNode, sums, idvaxnRecord);
+      if (ldv) {
+         std::copy(ctr, ctr + n, ctrUpper);
+         ctrUpper[idvax0-1] += 2*wth[idvax0-1];
+         GenzMalikRule(n, ctrUpper, wth, absValue, recordNode, sums, idvaxnRecord);
       }
-      z[j1] = ctr[j1];
-   }
-
-   sum5 = 0;
-
-   for (j=0;j<n;j++) {
-      wthl[j] = -xl5*wth[j];
-      z[j] = ctr[j] + wthl[j];
-   }
-L90: //sum over end nodes ~gray codes
-   if (absValue) sum5 += std::abs((*fFun)(z));
-   else          sum5 += (*fFun)(z);
-   for (j=0;j<n;j++) {
-      wthl[j] = -wthl[j];
-      z[j] = ctr[j] + wthl[j];
-      if (wthl[j] > 0) goto L90;
+      values.resize(nodes.size() / n);
+      EvalNodes(values.size(), nodes.data(), values.data());
+      ivalue = 0;
    }
+   upperEvaluated = ldv;
+   GenzMalikRule(n, ctr, wth, absValue, [&](const double *) { return values[ivalue++]; }, sums, idvaxn);
+   sum1 = sums[0];
+   sum2 = sums[1];
+   sum3 = sums[2];
+   sum4 = sums[3];
+   sum5 = sums[4];
 
    rgncmp  = rgnvol*(wpn1[n-2]*sum1+wp2*sum2+wpn3[n-2]*sum3+wp4*sum4);
    rgnval  = wn1[n-2]*sum1+w2*sum2+wn3[n-2]*sum3+w4*sum4+wn5[n-2]*sum5;
@@ -383,6 +452,27 @@ L160: //to divide or not
 
 
 
+void AdaptiveIntegratorMultiDim::EvalNodes(unsigned int npoints, const double *x, double *f) const
+{
+   // evaluate the integrand at the nodes, in parallel with the multi-thread execution policy
+#ifdef R__USE_IMT
+   if (fExecutionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      const unsigned int nchunks = std::min(npoints, ROOT::GetThreadPoolSize());
+      const unsigned int chunkSize = (npoints + nchunks - 1) / nchunks;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int chunk) {
+            const unsigned int first = chunk * chunkSize;
+            if (first < npoints)
+               fFun->EvalBatch(std::min(chunkSize, npoints - first), x + first * fDim, f + first);
+         },
+         ROOT::TSeqU(nchunks));
+      return;
+   }
+#endif
+   fFun->EvalBatch(npoints, x, f);
+}
+
 double AdaptiveIntegratorMultiDim::Integral(const IMultiGenFunction &f, const double* xmin, const double * xmax)
 {
    // calculate integral passing a function object
@@ -0,0 +1,205 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "Math/BatchFuncMathCore.h"
+#include "Math/Error.h"
+#include "Math/PdfFuncMathCore.h"
+#include "Math/ProbFuncMathCore.h"
+#include "Math/SpecFuncMathCore.h"
+#include "Math/Types.h"
+
+#include <cmath>
+#include <limits>
+
+namespace {
+
+/// Checks that the output of a batch function has the size of its input
+template <typename T>
+bool CheckSizes(const char *name, std::span<const T> x, std::span<double> out)
+{
+   if (x.size() == out.size())
+      return true;
+   MATH_ERROR_MSGVAL(name, "the sizes of the input and of the output differ, output size is", out.size());
+   return false;
+}
+
+/// Fills out with the constant value for all elements of x
+bool FillConstant(const char *name, std::span<const double> x, std::span<double> out, double value)
+{
+   if (!CheckSizes(name, x, out))
+      return false;
+   for (auto &y : out)
+      y = value;
+   return true;
+}
+
+/// Applies the scalar function func to all elements of x
+template <typename T, typename F>
+void Apply(const char *name, std::span<const T> x, std::span<double> out, F &&func)
+{
+   if (!CheckSizes(name, x, out))
+      return;
+   const std::size_t n = x.size();
+   for (std::size_t i = 0; i < n; ++i)
+      out[i] = func(x[i]);
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace Math {
+
+void erf(std::span<const double> x, std::span<double> out)
+{
+   Apply("ROOT::Math::erf", x, out, [](double v) { return ROOT::Math::erf(v); });
+}
+
+void erfc(std::span<const double> x, std::span<double> out)
+{
+   Apply("ROOT::Math::erfc", x, out, [](double v) { return ROOT::Math::erfc(v); });
+}
+
+void tgamma(std::span<const double> x, std::span<double> out)
+{
+   Apply("ROOT::Math::tgamma", x, out, [](double v) { return ROOT::Math::tgamma(v); });
+}
+
+void lgamma(std::span<const double> x, std::span<double> out)
+{
+   Apply("ROOT::Math::lgamma", x, out, [](double v) { return ROOT::Math::lgamma(v); });
+}
+
+void gaussian_pdf(std::span<const double> x, std::span<double> out, double sigma, double x0)
+{
+   const char *name = "ROOT::Math::gaussian_pdf";
+   if (!CheckSizes(name, x, out))
+      return;
+   const double norm = 1.0 / (std::sqrt(2 * M_PI) * std::fabs(sigma));
+   const std::size_t n = x.size();
+   std::size_t i = 0;
+#if defined(R__HAS_VECCORE) && defined(R__HAS_VC)
+   // the exponential dominates, evaluate it on several elements at once
+   const std::size_t vs = vecCore::VectorSize<ROOT::Double_v>();
+   const ROOT::Double_v vx0(x0), vsigma(sigma), vnorm(norm);
+   for (; i + vs <= n; i += vs) {
+      ROOT::Double_v v;
+      vecCore::Load<ROOT::Double_v>(v, &x[i]);
+      const ROOT::Double_v tmp = (v - vx0) / vsigma;
+      vecCore::Store<ROOT::Double_v>(vnorm * vecCore::math::Exp(-tmp * tmp / 2), &out[i]);
+   }
+#endif
+   for (; i < n; ++i) {
+      const double tmp = (x[i] - x0) / sigma;
+      out[i] = norm * std::exp(-tmp * tmp / 2);
+   }
+}
+
+void gaussian_cdf(std::span<const double> x, std::span<double> out, double sigma, double x0)
+{
+   Apply("ROOT::Math::gaussian_cdf", x, out, [=](double v) { return ROOT::Math::gaussian_cdf(v, sigma, x0); });
+}
+
+void breitwigner_pdf(std::span<const double> x, std::span<double> out, double gamma, double x0)
+{
+   const double gammahalf = gamma / 2.0;
+   const double gammahalf2 = gammahalf * gammahalf;
+   Apply("ROOT::Math::breitwigner_pdf", x, out,
+         [=](double v) { return gammahalf / (M_PI * ((v - x0) * (v - x0) + gammahalf2)); });
+}
+
+void exponential_pdf(std::span<const double> x, std::span<double> out, double lambda, double x0)
+{
+   Apply("ROOT::Math::exponential_pdf", x, out,
+         [=](double v) { return ((v - x0) < 0) ? 0.0 : lambda * std::exp(-lambda * (v - x0)); });
+}
+
+void landau_pdf(std::span<const double> x, std::span<double> out, double xi, double x0)
+{
+   const char *name = "ROOT::Math::landau_pdf";
+   if (xi <= 0) {
+      FillConstant(name, x, out, 0.);
+      return;
+   }
+   Apply(name, x, out, [=](double v) { return ROOT::Math::landau_pdf(v, xi, x0); });
+}
+
+void landau_cdf(std::span<const double> x, std::span<double> out, double xi, double x0)
+{
+   Apply("ROOT::Math::landau_cdf", x, out, [=](double v) { return ROOT::Math::landau_cdf(v, xi, x0); });
+}
+
+void crystalball_function(std::span<const double> x, std::span<double> out, double alpha, double n, double sigma,
+                          double mean)
+{
+   const char *name = "ROOT::Math::crystalball_function";
+   if (sigma < 0.) {
+      FillConstant(name, x, out, 0.);
+      return;
+   }
+   // the constants of the power law tail, as in the scalar function
+   const double abs_alpha = std::abs(alpha);
+   const double nDivAlpha = n / abs_alpha;
+   const double AA = std::exp(-0.5 * abs_alpha * abs_alpha);
+   const double B = nDivAlpha - abs_alpha;
+   const bool flip = alpha < 0;
+   Apply(name, x, out, [=](double v) {
+      double z = (v - mean) / sigma;
+      if (flip)
+         z = -z;
+      if (z > -abs_alpha)
+         return std::exp(-0.5 * z * z);
+      return AA * std::pow(nDivAlpha / (B - z), n);
+   });
+}
+
+void crystalball_pdf(std::span<const double> x, std::span<double> out, double alpha, double n, double sigma,
+                     double mean)
+{
+   const char *name = "ROOT::Math::crystalball_pdf";
+   if (sigma < 0.) {
+      FillConstant(name, x, out, 0.);
+      return;
+   }
+   if (n <= 1) {
+      // pdf is not normalized for n <=1
+      FillConstant(name, x, out, std::numeric_limits<double>::quiet_NaN());
+      return;
+   }
+   const double abs_alpha = std::abs(alpha);
+   const double C = n / abs_alpha * 1. / (n - 1.) * std::exp(-alpha * alpha / 2.);
+   const double D = std::sqrt(M_PI / 2.) * (1. + ROOT::Math::erf(abs_alpha / std::sqrt(2.)));
+   const double N = 1. / (sigma * (C + D));
+   crystalball_function(x, out, alpha, n, sigma, mean);
+   for (auto &y : out)
+      y *= N;
+}
+
+void poisson_pdf(std::span<const unsigned int> n, std::span<double> out, double mu)
+{
+   const char *name = "ROOT::Math::poisson_pdf";
+   if (!CheckSizes(name, n, out))
+      return;
+   if (!(mu >= 0)) {
+      // return a nan for mu < 0 since it does not make sense
+      for (auto &y : out)
+         y = std::numeric_limits<double>::quiet_NaN();
+      return;
+   }
+   const double logMu = std::log(mu);
+   const double expMinusMu = std::exp(-mu);
+   const std::size_t size = n.size();
+   for (std::size_t i = 0; i < size; ++i) {
+      // when n = 0 and mu = 0, 1 is returned
+      out[i] = (n[i] > 0) ? std::exp(n[i] * logMu - ROOT::Math::lgamma(n[i] + 1) - mu) : expMinusMu;
+   }
+}
+
+} // namespace Math
+} // namespace ROOT
@@ -12,8 +12,13 @@
 // Implementation file for class Delaunay2D
 
 #include "Math/Delaunay2D.h"
+#include "Math/Error.h"
 #include "Rtypes.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 //#include <thread>
 
 // use the triangle library if we do not use CGAL
@@ -22,6 +27,7 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <stdlib.h>
 
 #include <iostream>
@@ -97,6 +103,7 @@ void Delaunay2D::SetInputPoints(int n, const double * x, const double * y, const
 
 
 #ifndef HAS_CGAL
+   fNCells       = fMinNCells;
    fXCellStep    = 0.;
    fYCellStep    = 0.;
 #endif
@@ -132,6 +139,47 @@ double Delaunay2D::Interpolate(double x, double y)
    return zz;
 }
 
+//______________________________________________________________________________
+void Delaunay2D::Interpolate(int n, const double *x, const double *y, double *z, ROOT::EExecutionPolicy executionPolicy)
+{
+   // Interpolate many points at once: the triangles are found (once) before any point is looked up, the lookup
+   // itself does not modify the object and can be done concurrently.
+
+   FindAllTriangles();
+
+   if (fNdt == 0) {
+      std::fill(z, z + n, fZout);
+      return;
+   }
+
+   auto interpolateRange = [&](int first, int last) {
+      for (int i = first; i < last; ++i)
+         z[i] = DoInterpolateNormalized(Linear_transform(x[i], fOffsetX, fScaleFactorX),
+                                        Linear_transform(y[i], fOffsetY, fScaleFactorY));
+   };
+
+#if !defined(R__USE_IMT) || defined(HAS_CGAL)
+   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      MATH_WARN_MSG("Delaunay2D::Interpolate", "Multithread execution policy is not available, "
+                                               "using ROOT::EExecutionPolicy::kSequential");
+      executionPolicy = ROOT::EExecutionPolicy::kSequential;
+   }
+#else
+   if (executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
+      constexpr int chunkSize = 4096;
+      const unsigned int nchunks = (n + chunkSize - 1) / chunkSize;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int chunk) {
+            interpolateRange(chunk * chunkSize, std::min(n, (int)(chunk + 1) * chunkSize));
+         },
+         ROOT::TSeqU(nchunks));
+      return;
+   }
+#endif
+   interpolateRange(0, n);
+}
+
 //______________________________________________________________________________
 void Delaunay2D::FindAllTriangles()
 {
@@ -163,14 +211,12 @@ void Delaunay2D::FindAllTriangles()
 
 /// Triangle implementation for points normalization
 void Delaunay2D::DoNormalizePoints() {
+   fXN.resize(fNpoints);
+   fYN.resize(fNpoints);
    for (Int_t n = 0; n < fNpoints; n++) {
-      fXN.push_back(Linear_transform(fX[n], fOffsetX, fScaleFactorX));
-      fYN.push_back(Linear_transform(fY[n], fOffsetY, fScaleFactorY));
+      fXN[n] = Linear_transform(fX[n], fOffsetX, fScaleFactorX);
+      fYN[n] = Linear_transform(fY[n], fOffsetY, fScaleFactorY);
    }
-
-   //also initialize fXCellStep and FYCellStep
-   fXCellStep = fNCells / (fXNmax - fXNmin);
-   fYCellStep = fNCells / (fYNmax - fYNmin);
 }
 
 /// Triangle implementation for finding all the triangles
@@ -272,23 +318,38 @@ void Delaunay2D::DoFindTriangles() {
       tri.invDenom = 1 / ( (tri.y[1] - tri.y[2])*(tri.x[0] - tri.x[2]) + (tri.x[2] - tri.x[1])*(tri.y[0] - tri.y[2]) );
 
       fTriangles[t] = tri;
+   }
 
+   // grid with about one cell per triangle, so that only a few triangles are tested for each interpolated point
+   fNCells = std::max(fMinNCells, std::min(fMaxNCells, (int)std::sqrt((double)fTriangles.size())));
+   fXCellStep = fNCells / (fXNmax - fXNmin);
+   fYCellStep = fNCells / (fYNmax - fYNmin);
+
+   // call f(cell) for all the cells overlapping the bounding box of the triangle
+   auto forEachCell = [&](const Triangle &tri, auto &&f) {
       auto bx = std::minmax({tri.x[0], tri.x[1], tri.x[2]});
       auto by = std::minmax({tri.y[0], tri.y[1], tri.y[2]});
+      auto clamp = [&](int c) { return (unsigned int)std::max(0, std::min(fNCells, c)); };
+      unsigned int cellXmin = clamp(CellX(bx.first));
+      unsigned int cellXmax = clamp(CellX(bx.second));
+      unsigned int cellYmin = clamp(CellY(by.first));
+      unsigned int cellYmax = clamp(CellY(by.second));
+      for (unsigned int i = cellXmin; i <= cellXmax; ++i)
+         for (unsigned int j = cellYmin; j <= cellYmax; ++j)
+            f(Cell(i, j));
+   };
 
-      unsigned int cellXmin = CellX(bx.first);
-      unsigned int cellXmax = CellX(bx.second);
-
-      unsigned int cellYmin = CellY(by.first);
-      unsigned int cellYmax = CellY(by.second);
-
-      for(unsigned int i = cellXmin; i <= cellXmax; ++i) {
-         for(unsigned int j = cellYmin; j <= cellYmax; ++j) {
-            //printf("(%u,%u) = %u\n", i, j, Cell(i,j));
-            fCells[Cell(i,j)].insert(t);
-         }
-      }
-   }
+   // count the triangles of each cell, then store them contiguously, in increasing order in each cell
+   const unsigned int ncells = (fNCells + 1) * (fNCells + 1);
+   fCellStart.assign(ncells + 1, 0);
+   for (const Triangle &tri : fTriangles)
+      forEachCell(tri, [&](unsigned int cell) { ++fCellStart[cell + 1]; });
+   for (unsigned int cell = 0; cell < ncells; ++cell)
+      fCellStart[cell + 1] += fCellStart[cell];
+   fCellTriangles.resize(fCellStart[ncells]);
+   std::vector<unsigned int> next(fCellStart.begin(), fCellStart.end() - 1);
+   for (unsigned int t = 0; t < fTriangles.size(); ++t)
+      forEachCell(fTriangles[t], [&](unsigned int cell) { fCellTriangles[next[cell]++] = t; });
 
    freeStruct(in); freeStruct(out);
 }
@@ -331,7 +392,9 @@ double Delaunay2D::DoInterpolateNormalized(double xx, double yy)
    if (cX < 0 || cX > fNCells || cY < 0 || cY > fNCells)
       return fZout; // TODO some more fancy interpolation here
 
-   for (unsigned int t : fCells[Cell(cX, cY)]) {
+   const unsigned int cell = Cell(cX, cY);
+   for (unsigned int i = fCellStart[cell]; i < fCellStart[cell + 1]; ++i) {
+      const unsigned int t = fCellTriangles[i];
 
       auto coords = bayCoords(t);
 
@@ -1000,49 +1000,41 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
 
          // needed to compute effective global weight in case of extended likelihood
 
-         auto mapFunction = [&](const unsigned i) {
-            double W = 0;
-            double W2 = 0;
-            double fval = 0;
-
-            if (data.NDim() > 1) {
-               std::vector<double> x(data.NDim());
-               for (unsigned int j = 0; j < data.NDim(); ++j)
-                  x[j] = *data.GetCoordComponent(i, j);
-#ifdef USE_PARAMCACHE
-               fval = func(x.data());
-#else
-               fval = func(x.data(), p);
-#endif
-
-               // one -dim case
-            } else {
-               const auto x = data.GetCoordComponent(i, 0);
-#ifdef USE_PARAMCACHE
-               fval = func(x);
-#else
-               fval = func(x, p);
-#endif
-            }
-
-            if (normalizeFunc)
-               fval = fval * (1 / norm);
-
-            // function EvalLog protects against negative or too small values of fval
-            double logval = ROOT::Math::Util::EvalLog(fval);
-            if (iWeight > 0) {
-               double weight = data.Weight(i);
-               logval *= weight;
-               if (iWeight == 2) {
-                  logval *= weight; // use square of weights in likelihood
-                  if (!extended) {
-                     // needed sum of weights and sum of weight square if likelkihood is extended
-                     W = weight;
-                     W2 = weight * weight;
+         // the model function is evaluated on batches of points, passing the coordinates
+         // directly in the structure-of-arrays layout of the data
+         constexpr unsigned int batchSize = 256;
+         const unsigned int nBatches = (n + batchSize - 1) / batchSize;
+
+         // add the contributions of the points of batch ibatch to res
+         auto evalBatch = [&](const unsigned ibatch, LikelihoodAux<double> &res) {
+            const unsigned int begin = ibatch * batchSize;
+            const unsigned int nInBatch = std::min(batchSize, n - begin);
+            std::vector<const double *> x(data.NDim());
+            for (unsigned int j = 0; j < data.NDim(); ++j)
+               x[j] = data.GetCoordComponent(begin, j);
+            double fval[batchSize];
+            func.EvalParN(nInBatch, x.data(), p, fval);
+
+            for (unsigned int k = 0; k < nInBatch; ++k) {
+               if (normalizeFunc)
+                  fval[k] = fval[k] * (1 / norm);
+
+               // function EvalLog protects against negative or too small values of fval
+               double logval = ROOT::Math::Util::EvalLog(fval[k]);
+               if (iWeight > 0) {
+                  double weight = data.Weight(begin + k);
+                  logval *= weight;
+                  if (iWeight == 2) {
+                     logval *= weight; // use square of weights in likelihood
+                     if (!extended) {
+                        // needed sum of weights and sum of weight square if likelkihood is extended
+                        res.weight += weight;
+                        res.weight2 += weight * weight;
+                     }
                   }
                }
+               res.logvalue += logval;
             }
-            return LikelihoodAux<double>(logval, W, W2);
          };
 
 #ifdef R__USE_IMT
@@ -1075,17 +1067,23 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
   double sumW{};
   double sumW2{};
   if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
-    for (unsigned int i=0; i<n; ++i) {
-      auto resArray = mapFunction(i);
-      logl+=resArray.logvalue;
-      sumW+=resArray.weight;
-      sumW2+=resArray.weight2;
-    }
+    LikelihoodAux<double> resArray;
+    for (unsigned int ibatch=0; ibatch<nBatches; ++ibatch)
+      evalBatch(ibatch, resArray);
+    logl=resArray.logvalue;
+    sumW=resArray.weight;
+    sumW2=resArray.weight2;
 #ifdef R__USE_IMT
   } else if(executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
     ROOT::TThreadExecutor pool;
+    auto mapFunction = [&](const unsigned ibatch) {
+      LikelihoodAux<double> res;
+      evalBatch(ibatch, res);
+      return res;
+    };
     auto chunks = nChunks !=0? nChunks: setAutomaticChunking(data.Size());
-    auto resArray = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
+    chunks = std::max(1u, std::min(chunks, nBatches));
+    auto resArray = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, nBatches), redFunction, chunks);
     logl=resArray.logvalue;
     sumW=resArray.weight;
     sumW2=resArray.weight2;
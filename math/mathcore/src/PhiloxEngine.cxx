@@ -0,0 +1,98 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "Math/PhiloxEngine.h"
+
+#include <cmath>
+
+namespace ROOT {
+namespace Math {
+
+void PhiloxEngine::SetSeed(uint64_t seed)
+{
+   fSeed = seed;
+   fCounter = 0;
+   fPos = 2;
+}
+
+void PhiloxEngine::SetStream(uint64_t stream)
+{
+   fStream = stream;
+   fCounter = 0;
+   fPos = 2;
+}
+
+void PhiloxEngine::Skip(uint64_t n)
+{
+   // block of the next number and position in it, written such that the
+   // counter wraps around like in a sequential generation
+   uint64_t block = fPos == 2 ? fCounter : fCounter - 1;
+   const unsigned int pos = fPos == 2 ? 0 : fPos;
+   block += n / 2 + (pos + n % 2) / 2;
+   fCounter = block;
+   fPos = 2;
+   if ((pos + n % 2) % 2 != 0) {
+      Block(fCounter++, fBuffer);
+      fPos = 1;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// The blocks not needed for the start and the end of the array are written
+/// directly to it, without going through the buffer, so that the loop over
+/// them can be vectorized.
+
+void PhiloxEngine::RndmArray(int n, double *array)
+{
+   int i = 0;
+   for (; i < n && fPos < 2; ++i)
+      array[i] = (*this)();
+
+   const uint64_t nBlocks = (n - i) / 2;
+   const uint64_t first = fCounter;
+   for (uint64_t j = 0; j < nBlocks; ++j) {
+      uint64_t block[2];
+      Block(first + j, block);
+      array[i + 2 * j] = ToDouble(block[0]);
+      array[i + 2 * j + 1] = ToDouble(block[1]);
+   }
+   fCounter += nBlocks;
+   i += 2 * nBlocks;
+
+   for (; i < n; ++i)
+      array[i] = (*this)();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Each pair of uniform numbers (u1, u2) gives the two gaussian numbers
+/// sqrt(-2 log u1) cos(2 pi u2) and sqrt(-2 log u1) sin(2 pi u2). The uniform
+/// numbers are first generated in `array` with RndmArray().
+
+void PhiloxEngine::GausArray(int n, double *array)
+{
+   RndmArray(n, array);
+
+   constexpr double kTwoPi = 6.28318530717958647692;
+   const int nPairs = n / 2;
+   for (int j = 0; j < nPairs; ++j) {
+      const double r = std::sqrt(-2. * std::log(array[2 * j]));
+      const double phi = kTwoPi * array[2 * j + 1];
+      array[2 * j] = r * std::cos(phi);
+      array[2 * j + 1] = r * std::sin(phi);
+   }
+   if (n % 2 != 0) {
+      // the last number needs a second uniform number of its own
+      const double r = std::sqrt(-2. * std::log(array[n - 1]));
+      array[n - 1] = r * std::cos(kTwoPi * (*this)());
+   }
+}
+
+} // end namespace Math
+} // end namespace ROOT
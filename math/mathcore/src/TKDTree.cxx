@@ -15,9 +15,53 @@
 #include "TString.h"
 #include <string.h>
 #include <limits>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#include <algorithm>
+#endif
 
 templateClassImp(TKDTree);
 
+namespace {
+
+#ifdef R__USE_IMT
+/// Minimal number of points for building the tree or querying a batch of points with several threads
+constexpr Int_t kMinParallelPoints = 1 << 14;
+#endif
+/// Minimal number of points of a batched query for using several threads
+constexpr Int_t kMinParallelQueries = 64;
+
+/// Calls `func(first, last)` on consecutive ranges of [0, n), with the implicit multi-threading thread pool
+/// if it is enabled and n is at least `minParallel`
+template <typename F>
+void ForeachRange(Int_t n, Int_t minParallel, F &&func)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && n >= minParallel && n > 1) {
+      const Int_t nchunks = std::min<Int_t>(n, 4 * ROOT::GetThreadPoolSize());
+      const Int_t chunkSize = (n + nchunks - 1) / nchunks;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](Int_t chunk) {
+            const Int_t first = chunk * chunkSize;
+            if (first < n)
+               func(first, std::min(n, first + chunkSize));
+         },
+         ROOT::TSeqI(nchunks));
+      return;
+   }
+#else
+   (void)minParallel;
+#endif
+   func(0, n);
+}
+
+} // anonymous namespace
+
 
 /**
 \class TKDTree
@@ -159,6 +203,13 @@ in the 2 subtrees as close as possible. The following section gives more details
     part of the index array. To find the number of point in the node
     (not only terminal), call TKDTree::GetNpointsNode(Index inode).
 
+    The nearest neighbors and the points in range of many points are found by passing all the
+    points at once to TKDTree::FindNearestNeighbors(Index npoints, const Value *points, Int_t k,
+    Index *ind, Value *dist) and TKDTree::FindInRange(Index npoints, const Value *points,
+    Value range, std::vector<std::vector<Index>> &res). If the implicit multi-threading is enabled
+    (ROOT::EnableImplicitMT()), the points are then processed by several threads. The tree itself is
+    also built in parallel in that case: below the first rows, the subtrees are independent.
+
 ### 4.  TKDtree implementation details - internal information, not needed to use the kd-tree.
 
 ####  4a. Order of nodes in the node information arrays:
@@ -449,71 +500,132 @@ void TKDTree<Index, Value>::Build()
    //
    //
    //4.
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && fNPoints >= kMinParallelPoints) {
+      // divide the first rows serially, until there are enough subtrees to keep the threads busy. The
+      // subtrees own disjoint ranges of fIndPoints and disjoint nodes, they are built concurrently and
+      // the resulting tree does not depend on the number of threads.
+      const std::size_t nSubtrees = 4 * ROOT::GetThreadPoolSize();
+      std::vector<Int_t> rows{0}, nodes{0}, npoints{fNPoints}, positions{0};
+      while (rows.size() < nSubtrees) {
+         std::vector<Int_t> nextRows, nextNodes, nextNpoints, nextPositions;
+         for (std::size_t i = 0; i < rows.size(); ++i) {
+            if (npoints[i] <= fBucketSize)
+               continue; // terminal node
+            const Int_t nleft = DivideNode(rows[i], nodes[i], npoints[i], positions[i]);
+            nextRows.insert(nextRows.end(), {rows[i] + 1, rows[i] + 1});
+            nextNodes.insert(nextNodes.end(), {2 * nodes[i] + 1, 2 * nodes[i] + 2});
+            nextNpoints.insert(nextNpoints.end(), {nleft, npoints[i] - nleft});
+            nextPositions.insert(nextPositions.end(), {positions[i], positions[i] + nleft});
+         }
+         rows.swap(nextRows);
+         nodes.swap(nextNodes);
+         npoints.swap(nextNpoints);
+         positions.swap(nextPositions);
+         if (rows.empty())
+            return;
+      }
+      ForeachRange(rows.size(), 2, [&](Int_t first, Int_t last) {
+         for (Int_t i = first; i < last; ++i)
+            BuildSubtree(rows[i], nodes[i], npoints[i], positions[i]);
+      });
+      return;
+   }
+#endif
+   BuildSubtree(0, 0, fNPoints, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Divide the npoints points starting at index pos of fIndPoints, which belong to the
+/// node inode of the row irow, along the axis with the biggest spread.
+/// Returns the number of points of the left daughter node.
+
+template <typename  Index, typename Value>
+Int_t TKDTree<Index, Value>::DivideNode(Int_t irow, Int_t inode, Int_t npoints, Int_t pos)
+{
+   //
+   // divide points
+   Int_t nbuckets0 = npoints/fBucketSize;           //current number of  buckets
+   if (npoints%fBucketSize) nbuckets0++;            //
+   Int_t restRows = fRowT0-irow;                    // rest of fully occupied node row
+   if (restRows<0) restRows =0;
+   for (;nbuckets0>(2<<restRows); restRows++) {}
+   Int_t nfull = 1<<restRows;
+   Int_t nrest = nbuckets0-nfull;
+   Int_t nleft =0, nright =0;
+   //
+   if (nrest>(nfull/2)){
+      nleft  = nfull*fBucketSize;
+      nright = npoints-nleft;
+   }else{
+      nright = nfull*fBucketSize/2;
+      nleft  = npoints-nright;
+   }
+
+   //
+   //find the axis with biggest spread
+   Value maxspread=0;
+   Value tempspread, min, max;
+   Index axspread=0;
+   Value *array;
+   for (Int_t idim=0; idim<fNDim; idim++){
+      array = fData[idim];
+      Spread(npoints, array, fIndPoints+pos, min, max);
+      tempspread = max - min;
+      if (maxspread < tempspread) {
+         maxspread=tempspread;
+         axspread = idim;
+      }
+      if(inode) continue;
+      //printf("set %d %6.3f %6.3f\n", idim, min, max);
+      fRange[2*idim] = min; fRange[2*idim+1] = max;
+   }
+   array = fData[axspread];
+   KOrdStat(npoints, array, nleft, fIndPoints+pos);
+   fAxis[inode]  = axspread;
+   fValue[inode] = array[fIndPoints[pos+nleft]];
+   //printf("Set node %d : ax %d val %f\n", inode, node->fAxis, node->fValue);
+   //
+   if (0){
+      // consistency check
+      Info("Build()", "%s", Form("points %d left %d right %d", npoints, nleft, nright));
+      if (nleft<nright) Warning("Build", "Problem Left-Right");
+      if (nleft<0 || nright<0) Warning("Build()", "Problem Negative number");
+   }
+   return nleft;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Non recursive build of the subtree below the node inode of the row irow, which
+/// contains the npoints points starting at index pos of fIndPoints
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::BuildSubtree(Int_t irow, Int_t inode, Int_t npoints, Int_t pos)
+{
    //    stack for non recursive build - size 128 bytes enough
    Int_t rowStack[128];
    Int_t nodeStack[128];
    Int_t npointStack[128];
    Int_t posStack[128];
    Int_t currentIndex = 0;
-   rowStack[0]    = 0;
-   nodeStack[0]   = 0;
-   npointStack[0] = fNPoints;
-   posStack[0]   = 0;
+   rowStack[0]    = irow;
+   nodeStack[0]   = inode;
+   npointStack[0] = npoints;
+   posStack[0]   = pos;
    //
    while (currentIndex>=0){
       //
-      Int_t npoints  = npointStack[currentIndex];
-      if (npoints<=fBucketSize) {
+      Int_t cnpoints = npointStack[currentIndex];
+      if (cnpoints<=fBucketSize) {
          currentIndex--;
          continue; // terminal node
       }
       Int_t crow     = rowStack[currentIndex];
       Int_t cpos     = posStack[currentIndex];
       Int_t cnode    = nodeStack[currentIndex];
-      //printf("currentIndex %d npoints %d node %d\n", currentIndex, npoints, cnode);
-      //
-      // divide points
-      Int_t nbuckets0 = npoints/fBucketSize;           //current number of  buckets
-      if (npoints%fBucketSize) nbuckets0++;            //
-      Int_t restRows = fRowT0-rowStack[currentIndex];  // rest of fully occupied node row
-      if (restRows<0) restRows =0;
-      for (;nbuckets0>(2<<restRows); restRows++) {}
-      Int_t nfull = 1<<restRows;
-      Int_t nrest = nbuckets0-nfull;
-      Int_t nleft =0, nright =0;
-      //
-      if (nrest>(nfull/2)){
-         nleft  = nfull*fBucketSize;
-         nright = npoints-nleft;
-      }else{
-         nright = nfull*fBucketSize/2;
-         nleft  = npoints-nright;
-      }
-
-      //
-      //find the axis with biggest spread
-      Value maxspread=0;
-      Value tempspread, min, max;
-      Index axspread=0;
-      Value *array;
-      for (Int_t idim=0; idim<fNDim; idim++){
-         array = fData[idim];
-         Spread(npoints, array, fIndPoints+cpos, min, max);
-         tempspread = max - min;
-         if (maxspread < tempspread) {
-            maxspread=tempspread;
-            axspread = idim;
-         }
-         if(cnode) continue;
-         //printf("set %d %6.3f %6.3f\n", idim, min, max);
-         fRange[2*idim] = min; fRange[2*idim+1] = max;
-      }
-      array = fData[axspread];
-      KOrdStat(npoints, array, nleft, fIndPoints+cpos);
-      fAxis[cnode]  = axspread;
-      fValue[cnode] = array[fIndPoints[cpos+nleft]];
-      //printf("Set node %d : ax %d val %f\n", cnode, node->fAxis, node->fValue);
-      //
+      //printf("currentIndex %d npoints %d node %d\n", currentIndex, cnpoints, cnode);
+      Int_t nleft  = DivideNode(crow, cnode, cnpoints, cpos);
+      Int_t nright = cnpoints-nleft;
       //
       npointStack[currentIndex] = nleft;
       rowStack[currentIndex]    = crow+1;
@@ -524,13 +636,6 @@ void TKDTree<Index, Value>::Build()
       rowStack[currentIndex]    = crow+1;
       posStack[currentIndex]    = cpos+nleft;
       nodeStack[currentIndex]   = (cnode*2)+2;
-      //
-      if (0){
-         // consistency check
-         Info("Build()", "%s", Form("points %d left %d right %d", npoints, nleft, nright));
-         if (nleft<nright) Warning("Build", "Problem Left-Right");
-         if (nleft<0 || nright<0) Warning("Build()", "Problem Negative number");
-      }
    }
 }
 
@@ -556,6 +661,36 @@ void TKDTree<Index, Value>::FindNearestNeighbors(const Value *point, const Int_t
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find the kNN nearest neighbors of each of the npoints points of the array points,
+///which holds the coordinates of the first point, followed by the ones of the second point, etc.
+///The indexes and distances of the neighbors of the point i are returned in
+///ind[i*kNN] ... ind[i*kNN+kNN-1] and dist[i*kNN] ... dist[i*kNN+kNN-1]. The arrays ind and
+///dist are provided by the user and are assumed to be at least npoints*kNN elements long.
+///The points are processed by several threads if the implicit multi-threading is enabled.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindNearestNeighbors(Index npoints, const Value *points, Int_t kNN, Index *ind, Value *dist)
+{
+   if (!ind || !dist) {
+      Error("FindNearestNeighbors", "Working arrays must be allocated by the user!");
+      return;
+   }
+   // the boundaries are computed once, the queries only read the tree
+   MakeBoundariesExact();
+   ForeachRange(npoints, kMinParallelQueries, [&](Index first, Index last) {
+      for (Index ipoint = first; ipoint < last; ipoint++) {
+         Index *pind = ind + static_cast<Long64_t>(ipoint) * kNN;
+         Value *pdist = dist + static_cast<Long64_t>(ipoint) * kNN;
+         for (Int_t i = 0; i < kNN; i++) {
+            pdist[i] = std::numeric_limits<Value>::max();
+            pind[i] = -1;
+         }
+         UpdateNearestNeighbors(0, points + static_cast<Long64_t>(ipoint) * fNDim, kNN, pind, pdist);
+      }
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Update the nearest neighbors values by examining the node inode
 
@@ -752,11 +887,31 @@ void TKDTree<Index, Value>::FindInRange(Value * point, Value range, std::vector<
    UpdateRange(0, point, range, res);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+///Find all points in the sphere of a given radius "range" around each of the npoints points
+///of the array points, which holds the coordinates of the first point, followed by the ones of
+///the second point, etc. The indexes of the points around the point i are returned in res[i].
+///The points are processed by several threads if the implicit multi-threading is enabled.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindInRange(Index npoints, const Value *points, Value range, std::vector<std::vector<Index>> &res)
+{
+   res.resize(npoints);
+   // the boundaries are computed once, the queries only read the tree
+   MakeBoundariesExact();
+   ForeachRange(npoints, kMinParallelQueries, [&](Index first, Index last) {
+      for (Index ipoint = first; ipoint < last; ipoint++) {
+         res[ipoint].clear();
+         UpdateRange(0, points + static_cast<Long64_t>(ipoint) * fNDim, range, res[ipoint]);
+      }
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Internal recursive function with the implementation of range searches
 
 template <typename  Index, typename Value>
-void TKDTree<Index, Value>::UpdateRange(Index inode, Value* point, Value range, std::vector<Index> &res)
+void TKDTree<Index, Value>::UpdateRange(Index inode, const Value* point, Value range, std::vector<Index> &res)
 {
    Value min, max;
    DistanceToNode(point, inode, min, max);
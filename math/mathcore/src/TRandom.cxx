@@ -353,6 +353,19 @@ Double_t TRandom::Gaus(Double_t mean, Double_t sigma)
    return mean + sigma * result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill `array` with `n` random numbers from a gaussian distribution of mean
+/// `mean` and standard deviation `sigma`.
+/// The default implementation calls Gaus() `n` times; generators able to
+/// produce the numbers in bulk, like TRandomGen<ROOT::Math::PhiloxEngine>,
+/// override it.
+
+void TRandom::GausArray(Int_t n, Double_t *array, Double_t mean, Double_t sigma)
+{
+   for (Int_t i = 0; i < n; ++i)
+      array[i] = Gaus(mean, sigma);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns a random integer uniformly distributed on the interval [ 0, imax-1 ].
 /// Note that the interval contains the values of 0 and imax-1 but not imax.
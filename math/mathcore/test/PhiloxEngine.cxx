@@ -0,0 +1,110 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "Math/PhiloxEngine.h"
+#include "TRandomGen.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace ROOT::Math;
+
+namespace {
+
+// the two numbers of a block, as the four 32 bit words of the reference implementation
+std::vector<uint32_t> NextBlock(PhiloxEngine &rng)
+{
+   const uint64_t a = rng.IntRndm();
+   const uint64_t b = rng.IntRndm();
+   return {uint32_t(a), uint32_t(a >> 32), uint32_t(b), uint32_t(b >> 32)};
+}
+
+} // namespace
+
+// Known answers of the Random123 library for philox4x32_10
+TEST(PhiloxEngine, KnownAnswers)
+{
+   PhiloxEngine zero(0, 0);
+   EXPECT_EQ(NextBlock(zero), (std::vector<uint32_t>{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+
+   // reach the counter 0xffffffffffffffff with two skips, each of 2^64 - 1 numbers
+   PhiloxEngine ones(~0ULL, ~0ULL);
+   ones.Skip(~0ULL);
+   ones.Skip(~0ULL);
+   EXPECT_EQ(NextBlock(ones), (std::vector<uint32_t>{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+
+   PhiloxEngine pi(0x299f31d0a4093822ULL, 0x0370734413198a2eULL);
+   pi.Skip(0x85a308d3243f6a88ULL);
+   pi.Skip(0x85a308d3243f6a88ULL);
+   EXPECT_EQ(NextBlock(pi), (std::vector<uint32_t>{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(PhiloxEngine, Skip)
+{
+   PhiloxEngine rng(5, 3);
+   PhiloxEngine skipped(5, 3);
+   for (int i = 0; i < 777; ++i)
+      rng.Rndm();
+   skipped.Skip(777);
+   EXPECT_EQ(skipped.GetPosition(), 777u);
+   EXPECT_EQ(rng.Rndm(), skipped.Rndm());
+
+   // skip inside a block
+   rng.Rndm();
+   skipped.Skip(1);
+   EXPECT_EQ(rng.IntRndm(), skipped.IntRndm());
+   EXPECT_EQ(rng.GetPosition(), 780u);
+}
+
+TEST(PhiloxEngine, Streams)
+{
+   PhiloxEngine stream0(42, 0);
+   PhiloxEngine stream1(42, 1);
+   EXPECT_NE(stream0.IntRndm(), stream1.IntRndm());
+
+   stream1.SetStream(0);
+   stream0.SetSeed(42);
+   EXPECT_EQ(stream0.IntRndm(), stream1.IntRndm());
+}
+
+TEST(PhiloxEngine, RndmArray)
+{
+   PhiloxEngine rng(42, 7);
+   PhiloxEngine reference(42, 7);
+   // start in the middle of a block
+   EXPECT_EQ(rng.Rndm(), reference.Rndm());
+
+   std::vector<double> values(1001);
+   rng.RndmArray(values.size(), values.data());
+   for (double value : values) {
+      EXPECT_EQ(value, reference.Rndm());
+      EXPECT_GT(value, 0.);
+      EXPECT_LT(value, 1.);
+   }
+   EXPECT_EQ(rng.Rndm(), reference.Rndm());
+}
+
+TEST(PhiloxEngine, GausArray)
+{
+   TRandomPhilox rng(3);
+   std::vector<double> values(100001);
+   rng.GausArray(values.size(), values.data(), 1., 2.);
+
+   double sum = 0.;
+   double sum2 = 0.;
+   for (double value : values) {
+      sum += value;
+      sum2 += value * value;
+   }
+   const double mean = sum / values.size();
+   const double sigma = std::sqrt(sum2 / values.size() - mean * mean);
+   EXPECT_NEAR(mean, 1., 0.02);
+   EXPECT_NEAR(sigma, 2., 0.02);
+}
@@ -0,0 +1,85 @@
+// @(#)root/mathcore:$Id$
+
+#include "Math/AdaptiveIntegratorMultiDim.h"
+#include "Math/Functor.h"
+#include "Math/IFunction.h"
+
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <cmath>
+
+namespace {
+
+double Gaus4D(const double *x)
+{
+   double s = 0;
+   for (int i = 0; i < 4; ++i)
+      s += (i + 1) * x[i] * x[i];
+   return std::exp(-s) * std::cos(3 * x[0]);
+}
+
+// integrand counting its batch evaluations
+class BatchGaus4D : public ROOT::Math::IMultiGenFunction {
+public:
+   mutable std::atomic<unsigned int> fNBatches{0};
+   mutable std::atomic<unsigned int> fNPoints{0};
+
+   ROOT::Math::IMultiGenFunction *Clone() const override { return new BatchGaus4D; }
+   unsigned int NDim() const override { return 4; }
+
+private:
+   double DoEval(const double *x) const override { return Gaus4D(x); }
+   void DoEvalBatch(unsigned int n, const double *x, double *f) const override
+   {
+      ++fNBatches;
+      fNPoints += n;
+      for (unsigned int i = 0; i < n; ++i)
+         f[i] = Gaus4D(x + 4 * i);
+   }
+};
+
+} // namespace
+
+// the nodes evaluated in batches and in parallel must give exactly the result of the sequential evaluation
+TEST(AdaptiveIntegratorMultiDim, ExecutionPolicy)
+{
+   ROOT::Math::Functor f(&Gaus4D, 4);
+   const double a[4] = {-1, -1, -1, -1};
+   const double b[4] = {2, 1.5, 1, 1};
+
+   ROOT::Math::AdaptiveIntegratorMultiDim ig1(f, 0, 1e-8, 200000);
+   const double result = ig1.Integral(a, b);
+
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT(4);
+#endif
+   ROOT::Math::AdaptiveIntegratorMultiDim ig2(f, 0, 1e-8, 200000);
+   ig2.SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread);
+   EXPECT_EQ(ig2.Integral(a, b), result);
+   EXPECT_EQ(ig2.Error(), ig1.Error());
+   EXPECT_EQ(ig2.NEval(), ig1.NEval());
+   EXPECT_EQ(ig2.Status(), ig1.Status());
+#ifdef R__USE_IMT
+   ROOT::DisableImplicitMT();
+#endif
+}
+
+// the integrand is called once per region, or per pair of halves of a divided region
+TEST(AdaptiveIntegratorMultiDim, EvalBatch)
+{
+   BatchGaus4D f;
+   const double a[4] = {-1, -1, -1, -1};
+   const double b[4] = {2, 1.5, 1, 1};
+
+   ROOT::Math::AdaptiveIntegratorMultiDim ig(f, 0, 1e-8, 200000);
+   const double result = ig.Integral(a, b);
+   EXPECT_EQ(int(f.fNPoints), ig.NEval());
+   EXPECT_EQ(2 * f.fNBatches - 1, (unsigned int)(ig.NEval() / 57));
+
+   ROOT::Math::Functor g(&Gaus4D, 4);
+   ROOT::Math::AdaptiveIntegratorMultiDim ig2(g, 0, 1e-8, 200000);
+   EXPECT_EQ(ig2.Integral(a, b), result);
+}
@@ -0,0 +1,76 @@
+#include "Math/BatchFuncMathCore.h"
+#include "Math/PdfFuncMathCore.h"
+#include "Math/ProbFuncMathCore.h"
+#include "Math/SpecFuncMathCore.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+std::vector<double> MakeInput()
+{
+   std::vector<double> x;
+   for (int i = 0; i < 1001; ++i)
+      x.push_back(-10. + 0.02 * i);
+   return x;
+}
+
+} // anonymous namespace
+
+#define EXPECT_BATCH_EQ(batchcall, scalarcall)   \
+   {                                             \
+      const auto x = MakeInput();                \
+      std::vector<double> out(x.size());         \
+      ROOT::Math::batchcall;                     \
+      for (std::size_t i = 0; i < x.size(); ++i) \
+         EXPECT_EQ(out[i], ROOT::Math::scalarcall) << "at x = " << x[i]; \
+   }
+
+TEST(BatchFuncMathCore, SpecFunc)
+{
+   EXPECT_BATCH_EQ(erf(x, out), erf(x[i]));
+   EXPECT_BATCH_EQ(erfc(x, out), erfc(x[i]));
+   EXPECT_BATCH_EQ(lgamma(x, out), lgamma(x[i]));
+}
+
+TEST(BatchFuncMathCore, Distributions)
+{
+   EXPECT_BATCH_EQ(gaussian_cdf(x, out, 2., 1.), gaussian_cdf(x[i], 2., 1.));
+   EXPECT_BATCH_EQ(breitwigner_pdf(x, out, 1.5, 0.5), breitwigner_pdf(x[i], 1.5, 0.5));
+   EXPECT_BATCH_EQ(exponential_pdf(x, out, 0.7, -1.), exponential_pdf(x[i], 0.7, -1.));
+   EXPECT_BATCH_EQ(landau_pdf(x, out, 0.8, 1.), landau_pdf(x[i], 0.8, 1.));
+   EXPECT_BATCH_EQ(landau_cdf(x, out, 0.8, 1.), landau_cdf(x[i], 0.8, 1.));
+   EXPECT_BATCH_EQ(crystalball_function(x, out, 1.2, 2.5, 1.3, 0.2), crystalball_function(x[i], 1.2, 2.5, 1.3, 0.2));
+   EXPECT_BATCH_EQ(crystalball_pdf(x, out, -1.2, 2.5, 1.3, 0.2), crystalball_pdf(x[i], -1.2, 2.5, 1.3, 0.2));
+
+   const auto x = MakeInput();
+   std::vector<double> out(x.size());
+   ROOT::Math::gaussian_pdf(x, out, 1.5, 0.3);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_NEAR(out[i], ROOT::Math::gaussian_pdf(x[i], 1.5, 0.3), 1e-14);
+}
+
+TEST(BatchFuncMathCore, Poisson)
+{
+   std::vector<unsigned int> n;
+   for (unsigned int i = 0; i < 200; ++i)
+      n.push_back(i);
+   std::vector<double> out(n.size());
+   for (double mu : {0., 0.5, 30.}) {
+      ROOT::Math::poisson_pdf(n, out, mu);
+      for (std::size_t i = 0; i < n.size(); ++i)
+         EXPECT_EQ(out[i], ROOT::Math::poisson_pdf(n[i], mu));
+   }
+}
+
+TEST(BatchFuncMathCore, InPlace)
+{
+   auto x = MakeInput();
+   const auto y = x;
+   ROOT::Math::erf(x, x);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_EQ(x[i], ROOT::Math::erf(y[i]));
+}
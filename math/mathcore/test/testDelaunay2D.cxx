@@ -7,6 +7,10 @@
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+#include <random>
+#include <vector>
+
 // test Delauney interpolation on edges of a triangle
 // some of these tests failed when using the older version
 // see issue #
@@ -61,4 +65,41 @@ TEST(Delaunay2D,interpolation_at_edges)
 
 }
 
-
+// test the interpolation of many points at once, with enough triangles to use a finer grid
+// than the minimal one: a plane must be reproduced exactly inside the convex hull
+TEST(Delaunay2D,bulk_interpolation)
+{
+   const int n = 5000;
+   std::mt19937 gen(42);
+   std::uniform_real_distribution<double> uniform(-1, 1);
+   std::vector<double> x(n), y(n), z(n);
+   auto plane = [](double xx, double yy) { return 2 * xx - 3 * yy + 1; };
+   for (int i = 0; i < n; ++i) {
+      x[i] = uniform(gen);
+      y[i] = 10 * uniform(gen);
+      z[i] = plane(x[i], y[i]);
+   }
+   ROOT::Math::Delaunay2D d(n, x.data(), y.data(), z.data());
+   d.SetZOuterValue(-999);
+
+   const int m = 2000;
+   std::vector<double> xi(m), yi(m), zi(m);
+   for (int i = 0; i < m; ++i) {
+      xi[i] = 1.2 * uniform(gen);
+      yi[i] = 12 * uniform(gen);
+   }
+   d.Interpolate(m, xi.data(), yi.data(), zi.data());
+   EXPECT_GT(d.NumberOfTriangles(), 25 * 25);
+
+   int ninside = 0;
+   for (int i = 0; i < m; ++i) {
+      EXPECT_EQ(zi[i], d.Interpolate(xi[i], yi[i]));
+      if (zi[i] != -999) {
+         ++ninside;
+         EXPECT_NEAR(zi[i], plane(xi[i], yi[i]), 1e-9);
+      } else {
+         EXPECT_TRUE(std::abs(xi[i]) > 0.9 || std::abs(yi[i]) > 9);
+      }
+   }
+   EXPECT_GT(ninside, m / 2);
+}
@@ -0,0 +1,99 @@
+#include "Fit/FitUtil.h"
+#include "Fit/UnBinData.h"
+#include "Math/IParamFunction.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// unnormalized 2D gaussian, exp(-((x-p0)^2 + (y-p1)^2) / 2)
+class Gaus2D : public ROOT::Math::IParamMultiFunction {
+public:
+   unsigned int NDim() const override { return 2; }
+   unsigned int NPar() const override { return 2; }
+   const double *Parameters() const override { return fParams; }
+   void SetParameters(const double *p) override { std::copy(p, p + 2, fParams); }
+   ROOT::Math::IMultiGenFunction *Clone() const override { return new Gaus2D(*this); }
+
+protected:
+   double fParams[2] = {0., 0.};
+
+private:
+   double DoEvalPar(const double *x, const double *p) const override
+   {
+      return std::exp(-0.5 * ((x[0] - p[0]) * (x[0] - p[0]) + (x[1] - p[1]) * (x[1] - p[1])));
+   }
+};
+
+// same function, with a batched evaluation counting the points it was called for
+class Gaus2DBatch : public Gaus2D {
+public:
+   ROOT::Math::IMultiGenFunction *Clone() const override { return new Gaus2DBatch(*this); }
+   mutable unsigned int fNBatchPoints = 0;
+
+private:
+   void DoEvalParN(unsigned int n, const double *const *x, const double *p, double *y) const override
+   {
+      fNBatchPoints += n;
+      for (unsigned int i = 0; i < n; ++i) {
+         const double dx = x[0][i] - p[0];
+         const double dy = x[1][i] - p[1];
+         y[i] = std::exp(-0.5 * (dx * dx + dy * dy));
+      }
+   }
+};
+
+} // namespace
+
+TEST(EvalParN, DefaultLoopsOverPoints)
+{
+   const std::vector<double> xs{0., 0.5, -1., 2.};
+   const std::vector<double> ys{1., -0.5, 0.25, 0.};
+   const double *coords[] = {xs.data(), ys.data()};
+   const double p[] = {0.1, -0.2};
+
+   Gaus2D func;
+   std::vector<double> out(xs.size());
+   func.EvalParN(xs.size(), coords, p, out.data());
+   for (std::size_t i = 0; i < xs.size(); ++i) {
+      const double x[] = {xs[i], ys[i]};
+      EXPECT_EQ(out[i], func(x, p));
+   }
+}
+
+TEST(EvalParN, LogLUsesBatches)
+{
+   // more points than a single batch, and not a multiple of the batch size
+   const unsigned int n = 1000;
+   std::vector<double> xs(n);
+   std::vector<double> ys(n);
+   for (unsigned int i = 0; i < n; ++i) {
+      xs[i] = std::sin(0.37 * i);
+      ys[i] = std::cos(0.11 * i);
+   }
+   const double *coords[] = {xs.data(), ys.data()};
+   ROOT::Fit::UnBinData data(n, 2, coords);
+
+   const double p[] = {0.1, -0.2};
+   double expected = 0;
+   Gaus2D func;
+   for (unsigned int i = 0; i < n; ++i) {
+      const double x[] = {xs[i], ys[i]};
+      expected -= std::log(func(x, p));
+   }
+
+   unsigned int nPoints = 0;
+   const double logl =
+      ROOT::Fit::FitUtil::EvaluateLogL(func, data, p, 0, false, nPoints, ROOT::EExecutionPolicy::kSequential);
+   EXPECT_EQ(nPoints, n);
+   EXPECT_NEAR(logl, expected, 1e-10 * std::abs(expected));
+
+   Gaus2DBatch batchFunc;
+   const double logl2 =
+      ROOT::Fit::FitUtil::EvaluateLogL(batchFunc, data, p, 0, false, nPoints, ROOT::EExecutionPolicy::kSequential);
+   EXPECT_EQ(batchFunc.fNBatchPoints, n);
+   EXPECT_NEAR(logl2, expected, 1e-10 * std::abs(expected));
+}
@@ -0,0 +1,94 @@
+#include "TKDTree.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+constexpr Int_t kNPoints = 50000;
+constexpr Int_t kNDim = 3;
+
+std::vector<Double_t> MakeData()
+{
+   TRandom3 rng(42);
+   std::vector<Double_t> data(kNPoints * kNDim);
+   for (auto &x : data)
+      x = rng.Gaus();
+   return data;
+}
+
+std::unique_ptr<TKDTreeID> MakeTree(std::vector<Double_t> &data)
+{
+   auto tree = std::make_unique<TKDTreeID>(kNPoints, kNDim, 10);
+   for (Int_t idim = 0; idim < kNDim; ++idim)
+      tree->SetData(idim, data.data() + idim * kNPoints);
+   tree->Build();
+   return tree;
+}
+
+} // anonymous namespace
+
+TEST(TKDTree, BatchQueries)
+{
+   auto data = MakeData();
+   auto tree = MakeTree(data);
+
+   constexpr Int_t nQueries = 200;
+   constexpr Int_t k = 5;
+   TRandom3 rng(1);
+   std::vector<Double_t> points(nQueries * kNDim);
+   for (auto &x : points)
+      x = rng.Gaus();
+
+   std::vector<Int_t> ind(nQueries * k);
+   std::vector<Double_t> dist(nQueries * k);
+   tree->FindNearestNeighbors(nQueries, points.data(), k, ind.data(), dist.data());
+   std::vector<std::vector<Int_t>> inRange;
+   tree->FindInRange(nQueries, points.data(), 0.2, inRange);
+   ASSERT_EQ(inRange.size(), static_cast<std::size_t>(nQueries));
+
+   for (Int_t i = 0; i < nQueries; ++i) {
+      Int_t ind1[k];
+      Double_t dist1[k];
+      tree->FindNearestNeighbors(points.data() + i * kNDim, k, ind1, dist1);
+      for (Int_t j = 0; j < k; ++j) {
+         EXPECT_EQ(ind[i * k + j], ind1[j]);
+         EXPECT_EQ(dist[i * k + j], dist1[j]);
+      }
+      std::vector<Int_t> inRange1;
+      tree->FindInRange(points.data() + i * kNDim, 0.2, inRange1);
+      EXPECT_EQ(inRange[i], inRange1);
+   }
+}
+
+#ifdef R__USE_IMT
+TEST(TKDTree, ParallelBuild)
+{
+   auto data = MakeData();
+   auto serial = MakeTree(data);
+   ROOT::EnableImplicitMT(4);
+   auto parallel = MakeTree(data);
+
+   ASSERT_EQ(serial->GetNNodes(), parallel->GetNNodes());
+   for (Int_t inode = 0; inode < serial->GetNNodes(); ++inode) {
+      EXPECT_EQ(serial->GetNodeAxis(inode), parallel->GetNodeAxis(inode));
+      EXPECT_EQ(serial->GetNodeValue(inode), parallel->GetNodeValue(inode));
+   }
+   for (Int_t i = 0; i < kNPoints; ++i)
+      EXPECT_EQ(serial->GetIndPoints()[i], parallel->GetIndPoints()[i]);
+
+   constexpr Int_t nQueries = 1000;
+   constexpr Int_t k = 3;
+   std::vector<Int_t> ind(nQueries * k), indSerial(nQueries * k);
+   std::vector<Double_t> dist(nQueries * k), distSerial(nQueries * k);
+   parallel->FindNearestNeighbors(nQueries, data.data(), k, ind.data(), dist.data());
+   ROOT::DisableImplicitMT();
+   serial->FindNearestNeighbors(nQueries, data.data(), k, indSerial.data(), distSerial.data());
+   EXPECT_EQ(ind, indSerial);
+   EXPECT_EQ(dist, distSerial);
+}
+#endif
@@ -26,6 +26,7 @@
 
 #include "TDecompChol.h"
 #include "TMath.h"
+#include "TMatrixTParallel.h"
 
 ClassImp(TDecompChol);
 
@@ -112,7 +113,7 @@ Bool_t TDecompChol::Decompose()
       return kFALSE;
    }
 
-   Int_t i,j,icol,irow;
+   Int_t icol,irow;
    const Int_t     n  = fU.GetNrows();
          Double_t *pU = fU.GetMatrixArray();
    for (icol = 0; icol < n; icol++) {
@@ -132,14 +133,19 @@ Bool_t TDecompChol::Decompose()
       pU[rowOff+icol] = ujj;
 
       if (icol < n-1) {
-         for (j = icol+1; j < n; j++) {
-            for (i = 0; i < icol; i++) {
-               const Int_t rowOff2 = i*n;
-               pU[rowOff+j] -= pU[rowOff2+j]*pU[rowOff2+icol];
+         // the rows above icol are scanned contiguously, subtracting in the same
+         // order for each element; large rows are split between threads
+         ROOT::Internal::MatrixForeachRange(n-icol-1,Long64_t(icol)*(n-icol-1),256,[&](Int_t first,Int_t last) {
+            Double_t * const pRow = pU+rowOff+icol+1;
+            for (Int_t i = 0; i < icol; i++) {
+               const Double_t * const pRowi = pU+i*n+icol+1;
+               const Double_t u_i = pU[i*n+icol];
+               for (Int_t j = first; j < last; j++)
+                  pRow[j] -= pRowi[j]*u_i;
             }
-         }
-         for (j = icol+1; j < n; j++)
-            pU[rowOff+j] /= ujj;
+            for (Int_t j = first; j < last; j++)
+               pRow[j] /= ujj;
+         });
       }
    }
 
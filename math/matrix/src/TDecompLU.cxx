@@ -11,6 +11,9 @@
 
 #include "TDecompLU.h"
 #include "TMath.h"
+#include "TMatrixTParallel.h"
+
+#include <vector>
 
 ClassImp(TDecompLU);
 
@@ -624,35 +627,48 @@ Bool_t TDecompLU::DecomposeLUCrout(TMatrixD &lu,Int_t *index,Double_t &sign,
       scale[i] = (max == 0.0 ? 0.0 : 1.0/max);
    }
 
+   // The jth column is worked on in a contiguous copy, so that the inner loops
+   // below run along rows of fLU instead of down its columns
+   std::vector<Double_t> column(n);
+   Double_t * const pCol = column.data();
+
    for (Int_t j = 0; j < n; j++) {
       const Int_t off_j = j*n;
+      for (Int_t i = 0; i < n; i++)
+         pCol[i] = pLU[i*n+j];
+
       // Run down jth column from top to diag, to form the elements of U.
       for (Int_t i = 0; i < j; i++) {
          const Int_t off_i = i*n;
-         Double_t r = pLU[off_i+j];
-         for (Int_t k = 0; k < i; k++) {
-            const Int_t off_k = k*n;
-            r -= pLU[off_i+k]*pLU[off_k+j];
-         }
-         pLU[off_i+j] = r;
+         Double_t r = pCol[i];
+         for (Int_t k = 0; k < i; k++)
+            r -= pLU[off_i+k]*pCol[k];
+         pCol[i] = r;
       }
 
       // Run down jth subdiag to form the residuals after the elimination of
       // the first j-1 subdiags.  These residuals divided by the appropriate
       // diagonal term will become the multipliers in the elimination of the jth.
-      // subdiag. Find fIndex of largest scaled term in imax.
+      // subdiag. The rows are independent, large columns are split between threads.
+
+      ROOT::Internal::MatrixForeachRange(n-j,Long64_t(n-j)*j,64,[&](Int_t first,Int_t last) {
+         for (Int_t i = j+first; i < j+last; i++) {
+            const Int_t off_i = i*n;
+            Double_t r = pCol[i];
+            for (Int_t k = 0; k < j; k++)
+               r -= pLU[off_i+k]*pCol[k];
+            pCol[i] = r;
+         }
+      });
+      for (Int_t i = 0; i < n; i++)
+         pLU[i*n+j] = pCol[i];
+
+      // Find fIndex of largest scaled term in imax.
 
       Double_t max = 0.0;
       Int_t imax = 0;
       for (Int_t i = j; i < n; i++) {
-         const Int_t off_i = i*n;
-         Double_t r = pLU[off_i+j];
-         for (Int_t k = 0; k < j; k++) {
-            const Int_t off_k = k*n;
-            r -= pLU[off_i+k]*pLU[off_k+j];
-         }
-         pLU[off_i+j] = r;
-         const Double_t tmp = scale[i]*TMath::Abs(r);
+         const Double_t tmp = scale[i]*TMath::Abs(pCol[i]);
          if (tmp >= max) {
             max = tmp;
             imax = i;
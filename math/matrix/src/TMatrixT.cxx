@@ -30,6 +30,9 @@ See the \ref Matrix page for the documentation of the linear algebra package
 #include "TDecompLU.h"
 #include "TMatrixDEigen.h"
 #include "TMath.h"
+#include "TMatrixTParallel.h"
+
+#include <algorithm>
 
 templateClassImp(TMatrixT);
 
@@ -3071,13 +3074,174 @@ TMatrixT<Element> &TMatrixTAutoloadOps::ElementDiv(TMatrixT<Element> &target,con
    return target;
 }
 
+namespace {
+
+// Multiplications needing fewer multiply-adds keep the plain loops, for which the blocking does not pay off
+constexpr Long64_t kBlockedMultMinWork = 32 * 32 * 32;
+// Size of the blocks of B kept in cache while they are combined with all rows of A
+constexpr Int_t kBlockDim = 64;
+constexpr Int_t kBlockCols = 256;
+
+#ifdef MATRIX_USE_BLAS
+// Multiplications using at least this many multiply-adds are done by the BLAS library
+constexpr Long64_t kBlasMultMinWork = 64 * 64 * 64;
+
+extern "C" {
+void dgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k, const double *alpha,
+            const double *a, const int *lda, const double *b, const int *ldb, const double *beta, double *c,
+            const int *ldc);
+void sgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k, const float *alpha,
+            const float *a, const int *lda, const float *b, const int *ldb, const float *beta, float *c,
+            const int *ldc);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Column-major C = op(A) * op(B) with the BLAS gemm routine of the element type.
+/// A row-major matrix is the column-major storage of its transpose, so the
+/// callers compute C^T = op(B)^T * op(A)^T.
+
+void Gemm(char transa, char transb, int m, int n, int k, const Double_t *a, int lda, const Double_t *b, int ldb,
+          Double_t *c, int ldc)
+{
+   const Double_t one = 1.;
+   const Double_t zero = 0.;
+   dgemm_(&transa, &transb, &m, &n, &k, &one, a, &lda, b, &ldb, &zero, c, &ldc);
+}
+
+void Gemm(char transa, char transb, int m, int n, int k, const Float_t *a, int lda, const Float_t *b, int ldb,
+          Float_t *c, int ldc)
+{
+   const Float_t one = 1.;
+   const Float_t zero = 0.;
+   sgemm_(&transa, &transb, &m, &n, &k, &one, a, &lda, b, &ldb, &zero, c, &ldc);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rows [rowFirst,rowLast) of the (nrowsc x ncolsb) matrix C = op(A) * B, where
+/// op(A)[i,k] = ap[i*aRowStride+k*aColStride] and B is (nk x ncolsb). C[i,j] is
+/// accumulated in increasing k, as in a dot product, so that the result is the
+/// same as with the plain loops; but the loops run over blocks of B and along
+/// the rows of B and C, which are contiguous.
+
+template <class Element>
+void MultRowsBlocked(const Element *ap, Int_t aRowStride, Int_t aColStride, const Element *bp, Int_t nk,
+                     Int_t ncolsb, Element *cp, Int_t rowFirst, Int_t rowLast)
+{
+   std::fill(cp + Long64_t(rowFirst) * ncolsb, cp + Long64_t(rowLast) * ncolsb, Element(0));
+   for (Int_t k0 = 0; k0 < nk; k0 += kBlockDim) {
+      const Int_t k1 = std::min(nk, k0 + kBlockDim);
+      for (Int_t j0 = 0; j0 < ncolsb; j0 += kBlockCols) {
+         const Int_t j1 = std::min(ncolsb, j0 + kBlockCols);
+         for (Int_t i = rowFirst; i < rowLast; i++) {
+            Element *crp = cp + Long64_t(i) * ncolsb;
+            const Element *aip = ap + Long64_t(i) * aRowStride;
+            Int_t k = k0;
+            // four rows of B at a time, still added in order, to load and store C less often
+            for (; k + 4 <= k1; k += 4) {
+               const Element a0 = aip[Long64_t(k) * aColStride];
+               const Element a1 = aip[Long64_t(k + 1) * aColStride];
+               const Element a2 = aip[Long64_t(k + 2) * aColStride];
+               const Element a3 = aip[Long64_t(k + 3) * aColStride];
+               const Element *brp0 = bp + Long64_t(k) * ncolsb;
+               const Element *brp1 = brp0 + ncolsb;
+               const Element *brp2 = brp1 + ncolsb;
+               const Element *brp3 = brp2 + ncolsb;
+               for (Int_t j = j0; j < j1; j++)
+                  crp[j] = crp[j] + a0 * brp0[j] + a1 * brp1[j] + a2 * brp2[j] + a3 * brp3[j];
+            }
+            for (; k < k1; k++) {
+               const Element aik = aip[Long64_t(k) * aColStride];
+               const Element *brp = bp + Long64_t(k) * ncolsb;
+               for (Int_t j = j0; j < j1; j++)
+                  crp[j] += aik * brp[j];
+            }
+         }
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rows [rowFirst,rowLast) of the (nrowsc x nrowsb) matrix C = A * B^T, with
+/// A (nrowsc x ncols) and B (nrowsb x ncols). The dot products of the rows of A
+/// and B are split in blocks of columns, summed in order into C, so that a block
+/// of rows of B stays in cache for all rows of A.
+
+template <class Element>
+void MultBtRowsBlocked(const Element *ap, const Element *bp, Int_t nrowsb, Int_t ncols, Element *cp,
+                       Int_t rowFirst, Int_t rowLast)
+{
+   std::fill(cp + Long64_t(rowFirst) * nrowsb, cp + Long64_t(rowLast) * nrowsb, Element(0));
+   for (Int_t k0 = 0; k0 < ncols; k0 += kBlockCols) {
+      const Int_t k1 = std::min(ncols, k0 + kBlockCols);
+      for (Int_t j0 = 0; j0 < nrowsb; j0 += kBlockDim) {
+         const Int_t j1 = std::min(nrowsb, j0 + kBlockDim);
+         for (Int_t i = rowFirst; i < rowLast; i++) {
+            const Element *arp = ap + Long64_t(i) * ncols;
+            Element *crp = cp + Long64_t(i) * nrowsb;
+            Int_t j = j0;
+            // four independent sums at a time, which the processor can interleave
+            for (; j + 4 <= j1; j += 4) {
+               const Element *brp0 = bp + Long64_t(j) * ncols;
+               const Element *brp1 = brp0 + ncols;
+               const Element *brp2 = brp1 + ncols;
+               const Element *brp3 = brp2 + ncols;
+               Element c0 = crp[j];
+               Element c1 = crp[j + 1];
+               Element c2 = crp[j + 2];
+               Element c3 = crp[j + 3];
+               for (Int_t k = k0; k < k1; k++) {
+                  const Element aik = arp[k];
+                  c0 += aik * brp0[k];
+                  c1 += aik * brp1[k];
+                  c2 += aik * brp2[k];
+                  c3 += aik * brp3[k];
+               }
+               crp[j] = c0;
+               crp[j + 1] = c1;
+               crp[j + 2] = c2;
+               crp[j + 3] = c3;
+            }
+            for (; j < j1; j++) {
+               const Element *brp = bp + Long64_t(j) * ncols;
+               Element cij = crp[j];
+               for (Int_t k = k0; k < k1; k++)
+                  cij += arp[k] * brp[k];
+               crp[j] = cij;
+            }
+         }
+      }
+   }
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A*B
+///
+/// Large products are computed by blocks, split by rows of C between threads
+/// when implicit multi-threading is enabled, or by the BLAS library when ROOT is
+/// built with the matrix_blas option.
 
 template<class Element>
 void TMatrixTAutoloadOps::AMultB(const Element * const ap,Int_t na,Int_t ncolsa,
             const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
+   const Int_t nrowsa = ncolsa > 0 ? na/ncolsa : 0;
+   const Long64_t work = Long64_t(na)*ncolsb;
+#ifdef MATRIX_USE_BLAS
+   if (work >= kBlasMultMinWork) {
+      Gemm('N','N',ncolsb,nrowsa,ncolsa,bp,ncolsb,ap,ncolsa,cp,ncolsb);
+      return;
+   }
+#endif
+   if (work >= kBlockedMultMinWork) {
+      ROOT::Internal::MatrixForeachRange(nrowsa,work,kBlockDim/4,[&](Int_t first,Int_t last) {
+         MultRowsBlocked(ap,ncolsa,1,bp,ncolsa,ncolsb,cp,first,last);
+      });
+      return;
+   }
+
    const Element *arp0 = ap;                     // Pointer to  A[i,0];
    while (arp0 < ap+na) {
       for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
@@ -3096,11 +3260,28 @@ void TMatrixTAutoloadOps::AMultB(const Element * const ap,Int_t na,Int_t ncolsa,
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A^T*B
+///
+/// Large products are computed like in AMultB().
 
 template<class Element>
 void TMatrixTAutoloadOps::AtMultB(const Element * const ap,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
+   const Int_t nrowsb = ncolsb > 0 ? nb/ncolsb : 0;
+   const Long64_t work = Long64_t(nb)*ncolsa;
+#ifdef MATRIX_USE_BLAS
+   if (work >= kBlasMultMinWork) {
+      Gemm('N','T',ncolsb,ncolsa,nrowsb,bp,ncolsb,ap,ncolsa,cp,ncolsb);
+      return;
+   }
+#endif
+   if (work >= kBlockedMultMinWork) {
+      ROOT::Internal::MatrixForeachRange(ncolsa,work,kBlockDim/4,[&](Int_t first,Int_t last) {
+         MultRowsBlocked(ap,1,ncolsa,bp,nrowsb,ncolsb,cp,first,last);
+      });
+      return;
+   }
+
    const Element *acp0 = ap;           // Pointer to  A[i,0];
    while (acp0 < ap+ncolsa) {
       for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
@@ -3120,11 +3301,29 @@ void TMatrixTAutoloadOps::AtMultB(const Element * const ap,Int_t ncolsa,
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A*B^T
+///
+/// Large products are computed like in AMultB().
 
 template<class Element>
 void TMatrixTAutoloadOps::AMultBt(const Element * const ap,Int_t na,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
+   const Int_t nrowsa = ncolsa > 0 ? na/ncolsa : 0;
+   const Int_t nrowsb = ncolsb > 0 ? nb/ncolsb : 0;
+   const Long64_t work = Long64_t(na)*nrowsb;
+#ifdef MATRIX_USE_BLAS
+   if (work >= kBlasMultMinWork) {
+      Gemm('T','N',nrowsb,nrowsa,ncolsb,bp,ncolsb,ap,ncolsa,cp,nrowsb);
+      return;
+   }
+#endif
+   if (work >= kBlockedMultMinWork) {
+      ROOT::Internal::MatrixForeachRange(nrowsa,work,kBlockDim/4,[&](Int_t first,Int_t last) {
+         MultBtRowsBlocked(ap,bp,nrowsb,ncolsb,cp,first,last);
+      });
+      return;
+   }
+
    const Element *arp0 = ap;                    // Pointer to  A[i,0];
    while (arp0 < ap+na) {
       const Element *brp0 = bp;                  // Pointer to  B[j,0];
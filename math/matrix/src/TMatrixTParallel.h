@@ -0,0 +1,55 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Splitting of the loops of the large matrix operations between threads, used internally by the matrix package
+
+#ifndef ROOT_TMatrixTParallel
+#define ROOT_TMatrixTParallel
+
+#include "RConfigure.h"
+#include "Rtypes.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <algorithm>
+
+namespace ROOT {
+namespace Internal {
+
+/// Call `func(first, last)` on consecutive ranges of at least `minChunk` indices covering [0, n), in parallel if
+/// implicit multi-threading is enabled and the loop needs `work` >= 2^21 multiply-adds in total. The split
+/// depends on the number of threads, so the result of `func` on an index must not depend on its range.
+template <typename Func_t>
+void MatrixForeachRange(Int_t n, Long64_t work, Int_t minChunk, Func_t &&func)
+{
+#ifdef R__USE_IMT
+   constexpr Long64_t kMinWork = 1 << 21;
+   if (work >= kMinWork && n > minChunk && ROOT::IsImplicitMTEnabled()) {
+      const Int_t nChunks =
+         std::min<Long64_t>((n + minChunk - 1) / minChunk, 4 * Long64_t(ROOT::GetThreadPoolSize()));
+      const Int_t chunkSize = (n + nChunks - 1) / nChunks;
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Int_t chunk) { func(chunk * chunkSize, std::min(n, (chunk + 1) * chunkSize)); },
+                   ROOT::TSeqI(nChunks));
+      return;
+   }
+#else
+   (void)work;
+   (void)minChunk;
+#endif
+   func(0, n);
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -20,6 +20,10 @@
 // #include "Math/Util.h"
 // #endif
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <cmath>
 #include <cassert>
 #include <vector>
@@ -96,60 +100,100 @@ void FumiliFCNAdapter<Function>::EvaluateAll(const std::vector<double> &v)
 
    unsigned int ndata = fFunc.NPoints();
 
-   std::vector<double> gf(npar);
-   std::vector<double> h(hess.size());
-
-   // loop on the data points
-
-   // if FCN is of type least-square
-   if (fFunc.Type() == Function::kLeastSquare) {
+   const Type_t type = fFunc.Type();
+   if (type == Function::kLeastSquare) {
       print.Debug("Chi2 FCN: Evaluate gradient and Hessian");
+   } else if (type == Function::kLogLikelihood) {
+      print.Debug("LogLikelihood FCN: Evaluate gradient and Hessian");
+   } else if (type == Function::kPoissonLikelihood) {
+      print.Debug("Poisson Likelihood FCN: Evaluate gradient and Hessian");
+   } else {
+      print.Error("Type of fit method is not supported, it must be chi2 or log-likelihood or Poisson Likelihood");
+      return;
+   }
 
-      for (unsigned int i = 0; i < ndata; ++i) {
+   // add the contribution of the data point i to the gradient g and to the Hessian h,
+   // using gf and hf as work space
+   auto addPoint = [&](unsigned int i, std::vector<double> &gf, std::vector<double> &hf, std::vector<double> &g,
+                       std::vector<double> &h) {
+      if (type == Function::kLeastSquare) {
          // calculate data element and gradient (no need to compute Hessian)
          double fval = fFunc.DataElement(&v.front(), i, &gf[0]);
 
          for (unsigned int j = 0; j < npar; ++j) {
-            grad[j] += 2. * fval * gf[j];
+            g[j] += 2. * fval * gf[j];
             for (unsigned int k = j; k < npar; ++k) {
                int idx = j + k * (k + 1) / 2;
-               hess[idx] += 2.0 * gf[j] * gf[k];
+               h[idx] += 2.0 * gf[j] * gf[k];
             }
          }
-      }
-   } else if (fFunc.Type() == Function::kLogLikelihood) {
-      print.Debug("LogLikelihood FCN: Evaluate gradient and Hessian");
-      for (unsigned int i = 0; i < ndata; ++i) {
-
+      } else if (type == Function::kLogLikelihood) {
          // calculate data element and gradient: returns derivative of log(pdf)
          fFunc.DataElement(&v.front(), i, &gf[0]);
 
          for (unsigned int j = 0; j < npar; ++j) {
             double gfj = gf[j];
-            grad[j] -= gfj; // need a minus sign since is a NLL
+            g[j] -= gfj; // need a minus sign since is a NLL
             for (unsigned int k = j; k < npar; ++k) {
                int idx = j + k * (k + 1) / 2;
-               hess[idx] += gfj * gf[k];
+               h[idx] += gfj * gf[k];
             }
          }
-      }
-   } else if (fFunc.Type() == Function::kPoissonLikelihood) {
-      print.Debug("Poisson Likelihood FCN: Evaluate gradient and Hessian");
-      // for Poisson need Hessian computed in DataElement since one needs the bin expected value ad bin observed value
-     for (unsigned int i = 0; i < ndata; ++i) {
-         // calculate data element and gradient
-         fFunc.DataElement(&v.front(), i, gf.data(), h.data());
+      } else {
+         // for Poisson need Hessian computed in DataElement since one needs the bin expected value ad bin observed value
+         fFunc.DataElement(&v.front(), i, gf.data(), hf.data());
          for (size_t j = 0; j < npar; ++j) {
-            grad[j] += gf[j];
+            g[j] += gf[j];
             for (unsigned int k = j; k < npar; ++k) {
                int idx = j + k * (k + 1) / 2;
-               hess[idx] += h[idx];
+               h[idx] += hf[idx];
             }
          }
-     }
-   } else {
-      print.Error("Type of fit method is not supported, it must be chi2 or log-likelihood or Poisson Likelihood");
+      }
+   };
+
+#ifndef _OPENMP
+
+   std::vector<double> gf(npar);
+   std::vector<double> h(hess.size());
+
+   // loop on the data points
+   for (unsigned int i = 0; i < ndata; ++i)
+      addPoint(i, gf, h, grad, hess);
+
+#else
+
+   // parallelize the loop on the data points using OpenMP: every thread accumulates its own partial gradient and
+   // Hessian over a static range of points, which are summed in the order of the threads so that the result does
+   // not depend on the scheduling
+   std::vector<std::vector<double>> partialGrad(omp_get_max_threads());
+   std::vector<std::vector<double>> partialHess(partialGrad.size());
+
+#pragma omp parallel
+   {
+      const int ithread = omp_get_thread_num();
+      std::vector<double> gf(npar);
+      std::vector<double> h(hess.size());
+      std::vector<double> &g = partialGrad[ithread];
+      std::vector<double> &hs = partialHess[ithread];
+      g.assign(npar, 0.0);
+      hs.assign(hess.size(), 0.0);
+
+#pragma omp for schedule(static)
+      for (int i = 0; i < int(ndata); ++i)
+         addPoint(i, gf, h, g, hs);
    }
+
+   for (std::size_t ithread = 0; ithread < partialGrad.size(); ++ithread) {
+      if (partialGrad[ithread].empty())
+         continue; // thread not used
+      for (unsigned int j = 0; j < npar; ++j)
+         grad[j] += partialGrad[ithread][j];
+      for (std::size_t idx = 0; idx < hess.size(); ++idx)
+         hess[idx] += partialHess[ithread][idx];
+   }
+
+#endif
 }
 
 } // end namespace Minuit2
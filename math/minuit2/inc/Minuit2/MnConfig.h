@@ -18,4 +18,14 @@
 #include <cstdlib>
 #endif
 
+#ifdef MINUIT2_USE_BLAS
+namespace ROOT {
+namespace Minuit2 {
+// matrix size from which the packed symmetric matrix operations are done by
+// the external BLAS/LAPACK instead of the built-in routines
+constexpr unsigned int kBlasMinSize = 64;
+} // namespace Minuit2
+} // namespace ROOT
+#endif
+
 #endif
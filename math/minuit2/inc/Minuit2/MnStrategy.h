@@ -46,6 +46,11 @@ public:
    double HessianG2Tolerance() const { return fHessTlrG2; }
    unsigned int HessianGradientNCycles() const { return fHessGradNCyc; }
 
+   // number of threads computing the numerical gradient (0 = all cores)
+   unsigned int GradientNThreads() const { return fGradNThreads; }
+   // number of threads computing the numerical Hessian in MnHesse (0 = all cores)
+   unsigned int HessianNThreads() const { return fHessNThreads; }
+
    int StorageLevel() const { return fStoreLevel; }
 
    bool IsLow() const { return fStrategy == 0; }
@@ -65,6 +70,11 @@ public:
    void SetHessianG2Tolerance(double toler) { fHessTlrG2 = toler; }
    void SetHessianGradientNCycles(unsigned int n) { fHessGradNCyc = n; }
 
+   // compute the numerical gradient in n threads, the FCN must then be thread safe
+   void SetGradientNThreads(unsigned int n) { fGradNThreads = n; }
+   // compute the numerical Hessian in n threads, the FCN must then be thread safe
+   void SetHessianNThreads(unsigned int n) { fHessNThreads = n; }
+
    // set storage level of iteration quantities
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
@@ -73,12 +83,14 @@ private:
    unsigned int fStrategy;
 
    unsigned int fGradNCyc;
+   unsigned int fGradNThreads = 1;
    double fGradTlrStp;
    double fGradTlr;
    unsigned int fHessNCyc;
    double fHessTlrStp;
    double fHessTlrG2;
    unsigned int fHessGradNCyc;
+   unsigned int fHessNThreads = 1;
    int fStoreLevel;
 };
 
@@ -472,6 +472,8 @@ bool Minuit2Minimizer::Minimize()
       int nGradCycles = strategy.GradientNCycles();
       int nHessCycles = strategy.HessianNCycles();
       int nHessGradCycles = strategy.HessianGradientNCycles();
+      int nGradThreads = strategy.GradientNThreads();
+      int nHessThreads = strategy.HessianNThreads();
 
       double gradTol = strategy.GradientTolerance();
       double gradStepTol = strategy.GradientStepTolerance();
@@ -481,6 +483,8 @@ bool Minuit2Minimizer::Minimize()
       minuit2Opt->GetValue("GradientNCycles", nGradCycles);
       minuit2Opt->GetValue("HessianNCycles", nHessCycles);
       minuit2Opt->GetValue("HessianGradientNCycles", nHessGradCycles);
+      minuit2Opt->GetValue("GradientNThreads", nGradThreads);
+      minuit2Opt->GetValue("HessianNThreads", nHessThreads);
 
       minuit2Opt->GetValue("GradientTolerance", gradTol);
       minuit2Opt->GetValue("GradientStepTolerance", gradStepTol);
@@ -490,6 +494,8 @@ bool Minuit2Minimizer::Minimize()
       strategy.SetGradientNCycles(nGradCycles);
       strategy.SetHessianNCycles(nHessCycles);
       strategy.SetHessianGradientNCycles(nHessGradCycles);
+      strategy.SetGradientNThreads(nGradThreads);
+      strategy.SetHessianNThreads(nHessThreads);
 
       strategy.SetGradientTolerance(gradTol);
       strategy.SetGradientStepTolerance(gradStepTol);
@@ -1213,7 +1219,16 @@ bool Minuit2Minimizer::Hesse()
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnHesse hesse(strategy);
+   // the Hessian can be computed in several threads also when Hesse is called alone
+   ROOT::Minuit2::MnStrategy hesseStrategy(strategy);
+   ROOT::Math::IOptions *minuit2Opt = ROOT::Math::MinimizerOptions::FindDefault("Minuit2");
+   if (minuit2Opt) {
+      int nHessThreads = hesseStrategy.HessianNThreads();
+      minuit2Opt->GetValue("HessianNThreads", nHessThreads);
+      hesseStrategy.SetHessianNThreads(nHessThreads);
+   }
+
+   ROOT::Minuit2::MnHesse hesse(hesseStrategy);
 
    // case when function minimum exists
    if (fMinimum) {
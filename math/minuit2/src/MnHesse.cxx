@@ -24,10 +24,70 @@
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace ROOT {
 
 namespace Minuit2 {
 
+namespace {
+
+// Call func(i, x) for all the indices i in [begin, end) in nThreads threads
+// (0 = all cores), each passing its own copy x of the point x0. The indices are
+// handed out in increasing order, and no new one once func returned false: all
+// the indices before the one that stopped are therefore always done.
+// Exceptions thrown by func are rethrown in the calling thread.
+template <class Func>
+void ForEachIndex(unsigned int nThreads, unsigned int begin, unsigned int end, const MnAlgebraicVector &x0, Func &func)
+{
+   if (nThreads == 0)
+      nThreads = std::thread::hardware_concurrency();
+   nThreads = std::min(nThreads, end > begin ? end - begin : 0u);
+
+   if (nThreads <= 1) {
+      MnAlgebraicVector x = x0;
+      for (unsigned int i = begin; i < end; i++) {
+         if (!func(i, x))
+            break;
+      }
+      return;
+   }
+
+   std::atomic<unsigned int> next{begin};
+   std::exception_ptr exception;
+   std::mutex exceptionMutex;
+   auto work = [&]() {
+      MnAlgebraicVector x = x0;
+      try {
+         for (unsigned int i = next++; i < end; i = next++) {
+            if (!func(i, x))
+               next = end;
+         }
+      } catch (...) {
+         std::lock_guard<std::mutex> lock(exceptionMutex);
+         if (!exception)
+            exception = std::current_exception();
+         next = end;
+      }
+   };
+   std::vector<std::thread> threads;
+   for (unsigned int ithread = 1; ithread < nThreads; ++ithread)
+      threads.emplace_back(work);
+   work();
+   for (auto &thread : threads)
+      thread.join();
+   if (exception)
+      std::rethrow_exception(exception);
+}
+
+} // namespace
+
 MnUserParameterState MnHesse::operator()(const FCNBase &fcn, const std::vector<double> &par,
                                          const std::vector<double> &err, unsigned int maxcalls) const
 {
@@ -228,9 +288,21 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
    print.Debug("Gradient is", st.Gradient().IsAnalytical() ? "analytical" : "numerical", "\n  point:", x,
                "\n  fcn  :", amin, "\n  grad :", grd, "\n  step :", gst, "\n  g2   :", g2);
 
-   for (unsigned int i = 0; i < n; i++) {
-
-      double xtf = x(i);
+   // the diagonal elements of the parameters are independent, and so are the
+   // off-diagonal elements: each parameter or element is computed in one of
+   // the threads, in the same way as in a serial computation, so that the
+   // result does not depend on the number of threads
+   const unsigned int nThreads = fStrategy.HessianNThreads();
+
+   // status of the diagonal element of each parameter (0 = ok, 1 = 2nd derivative zero)
+   // and number of function calls spent on it
+   std::vector<int> diagStatus(n, 0);
+   std::vector<unsigned int> diagNCalls(n, 0);
+   const MnAlgebraicVector g2Start = g2;
+   const unsigned int nCallsStart = mfcn.NumOfCalls();
+
+   auto computeDiagonal = [&](unsigned int i, MnAlgebraicVector &xw) {
+      double xtf = xw(i);
       double dmin = 8. * prec.Eps2() * (std::fabs(xtf) + prec.Eps2());
       double d = std::fabs(gst(i));
       if (d < dmin)
@@ -243,21 +315,22 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          double fs1 = 0.;
          double fs2 = 0.;
          for (unsigned int multpy = 0; multpy < 5; multpy++) {
-            x(i) = xtf + d;
-            fs1 = mfcn(x);
-            x(i) = xtf - d;
-            fs2 = mfcn(x);
-            x(i) = xtf;
+            xw(i) = xtf + d;
+            fs1 = mfcn(xw);
+            xw(i) = xtf - d;
+            fs2 = mfcn(xw);
+            xw(i) = xtf;
+            diagNCalls[i] += 2;
             sag = 0.5 * (fs1 + fs2 - 2. * amin);
 
             print.Debug("cycle", icyc, "mul", multpy, "\tsag =", sag, "d =", d);
 
             //  Now as F77 Minuit - check that sag is not zero
             if (sag != 0)
-               goto L30; // break
+               break;
             if (trafo.Parameter(i).HasLimits()) {
                if (d > 0.5)
-                  goto L26;
+                  break;
                d *= 10.;
                if (d > 0.5)
                   d = 0.51;
@@ -266,21 +339,11 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
             d *= 10.;
          }
 
-      L26:
-         // get parameter name for i
-         // (need separate scope for avoiding compl error when declaring name)
-         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
-                    "; MnHesse fails and will return diagonal matrix");
-
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+         if (sag == 0) {
+            diagStatus[i] = 1;
+            return false;
          }
 
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
-                             mfcn.NumOfCalls());
-
-      L30:
          double g2bfor = g2(i);
          g2(i) = 2. * sag / (d * d);
          grd(i) = (fs1 - fs2) / (2. * d);
@@ -306,19 +369,38 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
          d = std::max(d, 0.1 * dlast);
       }
       vhmat(i, i) = g2(i);
-      if (mfcn.NumOfCalls() > maxcalls) {
+      return mfcn.NumOfCalls() <= maxcalls;
+   };
 
-         // std::cout<<"maxcalls " << maxcalls << " " << mfcn.NumOfCalls() << "  " <<   st.NFcn() << std::endl;
-         print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+   ForEachIndex(nThreads, 0, n, x, computeDiagonal);
 
-         for (unsigned int j = 0; j < n; j++) {
-            double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
-            vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
-         }
+   // check the failures in the order of a serial computation, which would stop
+   // at the first failing parameter and leave the following ones untouched
+   unsigned int nCallsDiagonal = nCallsStart;
+   for (unsigned int i = 0; i < n; i++) {
+      nCallsDiagonal += diagNCalls[i];
+      if (diagStatus[i] == 0 && nCallsDiagonal <= maxcalls)
+         continue;
+
+      for (unsigned int j = i + 1; j < n; j++)
+         g2(j) = g2Start(j);
+      for (unsigned int j = 0; j < n; j++) {
+         double tmp = g2(j) < prec.Eps2() ? 1. : 1. / g2(j);
+         vhmat(j, j) = tmp < prec.Eps2() ? 1. : tmp;
+      }
+
+      if (diagStatus[i] != 0) {
+         print.Warn("2nd derivative zero for parameter", trafo.Name(trafo.ExtOfInt(i)),
+                    "; MnHesse fails and will return diagonal matrix");
 
-         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnReachedCallLimit), st.Gradient(),
-                             st.Edm(), mfcn.NumOfCalls());
+         return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnHesseFailed), st.Gradient(), st.Edm(),
+                             mfcn.NumOfCalls());
       }
+
+      print.Warn("Maximum number of allowed function calls exhausted; will return diagonal matrix");
+
+      return MinimumState(st.Parameters(), MinimumError(vhmat, MinimumError::MnReachedCallLimit), st.Gradient(),
+                          st.Edm(), mfcn.NumOfCalls());
    }
 
    print.Debug("Second derivatives", g2);
@@ -339,32 +421,29 @@ MinimumState MnHesse::ComputeNumerical(const MnFcn &mfcn, const MinimumState &st
       unsigned int startParIndexOffDiagonal = mpiprocOffDiagonal.StartElementIndex();
       unsigned int endParIndexOffDiagonal = mpiprocOffDiagonal.EndElementIndex();
 
-      unsigned int offsetVect = 0;
-      for (unsigned int in = 0; in < startParIndexOffDiagonal; in++)
-         if ((in + offsetVect) % (n - 1) == 0)
-            offsetVect += (in + offsetVect) / (n - 1);
+      // index of the first element of each row in the upper triangle
+      std::vector<unsigned int> rowStart(n);
+      for (unsigned int i = 1; i < n; i++)
+         rowStart[i] = rowStart[i - 1] + n - i;
 
-      for (unsigned int in = startParIndexOffDiagonal; in < endParIndexOffDiagonal; in++) {
+      auto computeOffDiagonal = [&](unsigned int in, MnAlgebraicVector &xw) {
+         unsigned int i = std::upper_bound(rowStart.begin(), rowStart.end(), in) - rowStart.begin() - 1;
+         unsigned int j = i + 1 + in - rowStart[i];
 
-         int i = (in + offsetVect) / (n - 1);
-         if ((in + offsetVect) % (n - 1) == 0)
-            offsetVect += i;
-         int j = (in + offsetVect) % (n - 1) + 1;
+         const double xi = xw(i);
+         const double xj = xw(j);
+         xw(i) = xi + dirin(i);
+         xw(j) = xj + dirin(j);
+         double fs1 = mfcn(xw);
+         xw(i) = xi;
+         xw(j) = xj;
 
-         if ((i + 1) == j || in == startParIndexOffDiagonal)
-            x(i) += dirin(i);
-
-         x(j) += dirin(j);
-
-         double fs1 = mfcn(x);
          double elem = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
          vhmat(i, j) = elem;
+         return true;
+      };
 
-         x(j) -= dirin(j);
-
-         if (j % (n - 1) == 0 || in == endParIndexOffDiagonal - 1)
-            x(i) -= dirin(i);
-      }
+      ForEachIndex(nThreads, startParIndexOffDiagonal, endParIndexOffDiagonal, x, computeOffDiagonal);
 
       mpiprocOffDiagonal.SyncSymMatrixOffDiagonal(vhmat);
    }
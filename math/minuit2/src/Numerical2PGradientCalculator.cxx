@@ -21,9 +21,15 @@
 #include <omp.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cassert>
+#include <exception>
 #include <iomanip>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 #include "Minuit2/MPIProcess.h"
 
@@ -97,35 +103,9 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around function value", fcnmin, "\n\t at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // compute the derivative along parameter i, x is the work copy of the point
+   // owned by the calling thread
+   auto computeParameter = [&](unsigned int i, MnAlgebraicVector &x) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
@@ -210,15 +190,73 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          }
       }
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
-   }
+   };
 
 #ifndef _OPENMP
+
+   MPIProcess mpiproc(n, 0);
+
+   unsigned int startElementIndex = mpiproc.StartElementIndex();
+   unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+   unsigned int nThreads = Strategy().GradientNThreads();
+   if (nThreads == 0)
+      nThreads = std::thread::hardware_concurrency();
+   nThreads = std::min(nThreads, endElementIndex - startElementIndex);
+
+   if (nThreads <= 1) {
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
+         computeParameter(i, x);
+      }
+   } else {
+      // the threads take the parameters one at a time, since the number of
+      // cycles and hence of function calls differs between parameters
+      std::atomic<unsigned int> nextElementIndex{startElementIndex};
+      std::exception_ptr exception;
+      std::mutex exceptionMutex;
+      auto work = [&]() {
+         MnAlgebraicVector x = par.Vec();
+         try {
+            for (unsigned int i = nextElementIndex++; i < endElementIndex; i = nextElementIndex++) {
+               computeParameter(i, x);
+            }
+         } catch (...) {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!exception)
+               exception = std::current_exception();
+            nextElementIndex = endElementIndex;
+         }
+      };
+      std::vector<std::thread> threads;
+      for (unsigned int ithread = 1; ithread < nThreads; ++ithread)
+         threads.emplace_back(work);
+      work();
+      for (auto &thread : threads)
+         thread.join();
+      if (exception)
+         std::rethrow_exception(exception);
+   }
+
    mpiproc.SyncVector(grd);
    mpiproc.SyncVector(g2);
    mpiproc.SyncVector(gstep);
+
+#else
+
+   // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+   //#pragma omp for schedule (static, N_PARALLEL_PAR)
+
+   for (int i = 0; i < int(n); i++) {
+      // create in loop since each thread will use its own copy
+      MnAlgebraicVector x = par.Vec();
+      computeParameter(i, x);
+   }
+
 #endif
 
    // print after parallel processing to avoid synchronization issues
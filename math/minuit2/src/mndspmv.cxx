@@ -12,6 +12,8 @@
    -lf2c -lm   (in that order)
 */
 
+#include "Minuit2/MnConfig.h"
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -19,9 +21,21 @@ namespace Minuit2 {
 bool mnlsame(const char *, const char *);
 int mnxerbla(const char *, int);
 
+#ifdef MINUIT2_USE_BLAS
+extern "C" void dspmv_(const char *uplo, const int *n, const double *alpha, const double *ap, const double *x,
+                       const int *incx, const double *beta, double *y, const int *incy);
+#endif
+
 int Mndspmv(const char *uplo, unsigned int n, double alpha, const double *ap, const double *x, int incx, double beta,
             double *y, int incy)
 {
+#ifdef MINUIT2_USE_BLAS
+   if (n >= kBlasMinSize) {
+      const int nn = n;
+      dspmv_(uplo, &nn, &alpha, ap, x, &incx, &beta, y, &incy);
+      return 0;
+   }
+#endif
    /* System generated locals */
    int i__1, i__2;
 
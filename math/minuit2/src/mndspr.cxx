@@ -12,6 +12,8 @@
    -lf2c -lm   (in that order)
 */
 
+#include "Minuit2/MnConfig.h"
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -19,8 +21,20 @@ namespace Minuit2 {
 bool mnlsame(const char *, const char *);
 int mnxerbla(const char *, int);
 
+#ifdef MINUIT2_USE_BLAS
+extern "C" void dspr_(const char *uplo, const int *n, const double *alpha, const double *x, const int *incx,
+                      double *ap);
+#endif
+
 int mndspr(const char *uplo, unsigned int n, double alpha, const double *x, int incx, double *ap)
 {
+#ifdef MINUIT2_USE_BLAS
+   if (n >= kBlasMinSize) {
+      const int nn = n;
+      dspr_(uplo, &nn, &alpha, x, &incx, ap);
+      return 0;
+   }
+#endif
    /* System generated locals */
    int i__1, i__2;
 
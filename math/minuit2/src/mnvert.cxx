@@ -10,11 +10,39 @@
 #include "Minuit2/MnMatrix.h"
 
 #include <cmath>
+#include <vector>
 
 namespace ROOT {
 
 namespace Minuit2 {
 
+#ifdef MINUIT2_USE_BLAS
+extern "C" void dsptrf_(const char *uplo, const int *n, double *ap, int *ipiv, int *info);
+extern "C" void dsptri_(const char *uplo, const int *n, double *ap, const int *ipiv, double *work, int *info);
+
+/** Inverts a symmetric matrix with the LAPACK Bunch-Kaufman factorization,
+    which works directly on the packed upper triangle of the matrix.
+ */
+
+int mnvertLapack(MnAlgebraicSymMatrix &a)
+{
+   const int n = a.Nrow();
+   // same requirement as for the built-in inversion
+   for (int i = 0; i < n; i++) {
+      if (a(i, i) < 0.)
+         return 1;
+   }
+   std::vector<int> ipiv(n);
+   std::vector<double> work(n);
+   int info = 0;
+   dsptrf_("U", &n, a.Data(), ipiv.data(), &info);
+   if (info != 0)
+      return 1;
+   dsptri_("U", &n, a.Data(), ipiv.data(), work.data(), &info);
+   return info != 0 ? 1 : 0;
+}
+#endif
+
 /** Inverts a symmetric matrix. Matrix is first scaled to have all ones on
     the diagonal (equivalent to change of units) but no pivoting is done
     since matrix is positive-definite.
@@ -24,6 +52,10 @@ int mnvert(MnAlgebraicSymMatrix &a)
 {
 
    unsigned int nrow = a.Nrow();
+#ifdef MINUIT2_USE_BLAS
+   if (nrow >= kBlasMinSize)
+      return mnvertLapack(a);
+#endif
    MnAlgebraicVector s(nrow);
    MnAlgebraicVector q(nrow);
    MnAlgebraicVector pp(nrow);
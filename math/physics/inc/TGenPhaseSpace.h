@@ -31,6 +31,8 @@ public:
 
    Bool_t          SetDecay(TLorentzVector &P, Int_t nt, const Double_t *mass, Option_t *opt="");
    Double_t        Generate();
+   Bool_t          GenerateBatch(Long64_t nevents, ULong64_t seed, Double_t *weights,
+                                 Double_t *px, Double_t *py, Double_t *pz, Double_t *e) const;
    TLorentzVector *GetDecay(Int_t n);
 
    Int_t    GetNt()      const { return fNt;}
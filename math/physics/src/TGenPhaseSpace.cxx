@@ -17,21 +17,36 @@
 
 see example of use in PhaseSpace.C
 
+Large samples are generated with GenerateBatch(), which fills arrays of
+the four-momentum components of many events at once, using several
+threads if the implicit multi-threading is enabled.
+
 Note that Momentum, Energy units are Gev/C, GeV
 */
 
 #include "TGenPhaseSpace.h"
 #include "TRandom.h"
 #include "TMath.h"
+#include "Math/RanluxppEngine.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TSeq.hxx"
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <algorithm>
 
 const Int_t kMAXP = 18;
 
 ClassImp(TGenPhaseSpace);
 
-////////////////////////////////////////////////////////////////////////////////
-/// The PDK function.
+namespace {
 
-Double_t TGenPhaseSpace::PDK(Double_t a, Double_t b, Double_t c)
+/// Number of events generated in one go by GenerateBatch(), from a random number stream of its own
+constexpr Long64_t kBatchBlockSize = 4096;
+
+Double_t Pdk(Double_t a, Double_t b, Double_t c)
 {
    Double_t x = (a-b-c)*(a+b+c)*(a-b+c)*(a+b-c);
    x = TMath::Sqrt(x)/(2*a);
@@ -39,16 +54,107 @@ Double_t TGenPhaseSpace::PDK(Double_t a, Double_t b, Double_t c)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Special max function
+/// Boost the n four-vectors (px[i], py[i], pz[i], e[i]) with the betas
+/// (bx, by, bz), as TLorentzVector::Boost() does
+
+void BoostArrays(Long64_t n, Double_t *px, Double_t *py, Double_t *pz, Double_t *e,
+                 Double_t bx, Double_t by, Double_t bz)
+{
+   const Double_t b2 = bx*bx + by*by + bz*bz;
+   const Double_t gamma = 1.0 / TMath::Sqrt(1.0 - b2);
+   const Double_t gamma2 = b2 > 0 ? (gamma - 1.0)/b2 : 0.0;
+   for (Long64_t i = 0; i < n; i++) {
+      const Double_t bp = bx*px[i] + by*py[i] + bz*pz[i];
+      px[i] = px[i] + gamma2*bp*bx + gamma*bx*e[i];
+      py[i] = py[i] + gamma2*bp*by + gamma*by*e[i];
+      pz[i] = pz[i] + gamma2*bp*bz + gamma*bz*e[i];
+      e[i]   = gamma*(e[i] + bp);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the decay products in the rest frame of the decaying particle,
+/// drawing 3*nt-4 random numbers from rndm(). Returns the weight of the event.
 
-Int_t DoubleMax(const void *a, const void *b)
+template <typename Rndm>
+Double_t GenerateRestFrame(Int_t nt, const Double_t *mass, Double_t teCmTm, Double_t wtMax, Rndm &&rndm,
+                           Double_t *px, Double_t *py, Double_t *pz, Double_t *e)
 {
-   Double_t aa = * ((Double_t *) a);
-   Double_t bb = * ((Double_t *) b);
-   if (aa > bb) return  1;
-   if (aa < bb) return -1;
-   return 0;
+   Double_t rno[kMAXP];
+   rno[0] = 0;
+   Int_t n;
+   if (nt>2) {
+      for (n=1; n<nt-1; n++)  rno[n]=rndm();   // nt-2 random numbers
+      std::sort(rno+1, rno+nt-1);               // sort them
+   }
+   rno[nt-1] = 1;
+
+   Double_t invMas[kMAXP], sum=0;
+   for (n=0; n<nt; n++) {
+      sum      += mass[n];
+      invMas[n] = rno[n]*teCmTm + sum;
+   }
+
+   //
+   //-----> compute the weight of the current event
+   //
+   Double_t wt=wtMax;
+   Double_t pd[kMAXP];
+   for (n=0; n<nt-1; n++) {
+      pd[n] = Pdk(invMas[n+1],invMas[n],mass[n+1]);
+      wt *= pd[n];
+   }
+
+   //
+   //-----> complete specification of event (Raubold-Lynch method)
+   //
+   px[0] = 0; py[0] = pd[0]; pz[0] = 0; e[0] = TMath::Sqrt(pd[0]*pd[0]+mass[0]*mass[0]);
+
+   Int_t i=1;
+   Int_t j;
+   while (1) {
+      px[i] = 0; py[i] = -pd[i-1]; pz[i] = 0; e[i] = TMath::Sqrt(pd[i-1]*pd[i-1]+mass[i]*mass[i]);
+
+      Double_t cZ   = 2*rndm() - 1;
+      Double_t sZ   = TMath::Sqrt(1-cZ*cZ);
+      Double_t angY = 2*TMath::Pi() * rndm();
+      Double_t cY   = TMath::Cos(angY);
+      Double_t sY   = TMath::Sin(angY);
+      for (j=0; j<=i; j++) {
+         Double_t x = px[j];
+         Double_t y = py[j];
+         px[j] = cZ*x - sZ*y;
+         py[j] = sZ*x + cZ*y;   // rotation around Z
+         x = px[j];
+         Double_t z = pz[j];
+         px[j] = cY*x - sY*z;
+         pz[j] = sY*x + cY*z;   // rotation around Y
+      }
+
+      if (i == (nt-1)) break;
+
+      // boost along Y, the other components are not changed
+      Double_t beta = pd[i] / sqrt(pd[i]*pd[i] + invMas[i]*invMas[i]);
+      Double_t gamma = 1.0 / TMath::Sqrt(1.0 - beta*beta);
+      Double_t gamma2 = beta*beta > 0 ? (gamma - 1.0)/(beta*beta) : 0.0;
+      for (j=0; j<=i; j++) {
+         Double_t bp = beta*py[j];
+         py[j] = py[j] + gamma2*bp*beta + gamma*beta*e[j];
+         e[j]   = gamma*(e[j] + bp);
+      }
+      i++;
+   }
+   return wt;
+}
 
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// The PDK function.
+
+Double_t TGenPhaseSpace::PDK(Double_t a, Double_t b, Double_t c)
+{
+   return Pdk(a, b, c);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -97,74 +203,89 @@ TGenPhaseSpace& TGenPhaseSpace::operator=(const TGenPhaseSpace &gen)
 
 Double_t TGenPhaseSpace::Generate()
 {
-   Double_t rno[kMAXP];
-   rno[0] = 0;
-   Int_t n;
-   if (fNt>2) {
-      for (n=1; n<fNt-1; n++)  rno[n]=gRandom->Rndm();   // fNt-2 random numbers
-      qsort(rno+1 ,fNt-2 ,sizeof(Double_t) ,DoubleMax);  // sort them
-   }
-   rno[fNt-1] = 1;
-
-   Double_t invMas[kMAXP], sum=0;
-   for (n=0; n<fNt; n++) {
-      sum      += fMass[n];
-      invMas[n] = rno[n]*fTeCmTm + sum;
-   }
+   Double_t px[kMAXP], py[kMAXP], pz[kMAXP], e[kMAXP];
+   Double_t wt = GenerateRestFrame(fNt, fMass, fTeCmTm, fWtMax, [] { return gRandom->Rndm(); }, px, py, pz, e);
 
    //
-   //-----> compute the weight of the current event
+   //---> final boost of all particles
    //
-   Double_t wt=fWtMax;
-   Double_t pd[kMAXP];
-   for (n=0; n<fNt-1; n++) {
-      pd[n] = PDK(invMas[n+1],invMas[n],fMass[n+1]);
-      wt *= pd[n];
-   }
+   BoostArrays(fNt, px, py, pz, e, fBeta[0], fBeta[1], fBeta[2]);
+   for (Int_t n=0;n<fNt;n++) fDecPro[n].SetPxPyPzE(px[n], py[n], pz[n], e[n]);
 
    //
-   //-----> complete specification of event (Raubold-Lynch method)
+   //---> return the weight of event
    //
-   fDecPro[0].SetPxPyPzE(0, pd[0], 0 , TMath::Sqrt(pd[0]*pd[0]+fMass[0]*fMass[0]) );
-
-   Int_t i=1;
-   Int_t j;
-   while (1) {
-      fDecPro[i].SetPxPyPzE(0, -pd[i-1], 0 , TMath::Sqrt(pd[i-1]*pd[i-1]+fMass[i]*fMass[i]) );
+   return wt;
+}
 
-      Double_t cZ   = 2*gRandom->Rndm() - 1;
-      Double_t sZ   = TMath::Sqrt(1-cZ*cZ);
-      Double_t angY = 2*TMath::Pi() * gRandom->Rndm();
-      Double_t cY   = TMath::Cos(angY);
-      Double_t sY   = TMath::Sin(angY);
-      for (j=0; j<=i; j++) {
-         TLorentzVector *v = fDecPro+j;
-         Double_t x = v->Px();
-         Double_t y = v->Py();
-         v->SetPx( cZ*x - sZ*y );
-         v->SetPy( sZ*x + cZ*y );   // rotation around Z
-         x = v->Px();
-         Double_t z = v->Pz();
-         v->SetPx( cY*x - sY*z );
-         v->SetPz( sY*x + cY*z );   // rotation around Y
+////////////////////////////////////////////////////////////////////////////////
+///  Generate nevents random final states of the decay given to SetDecay().
+///
+///  The components of the four-momenta are written to the arrays px, py, pz and e,
+///  which must have GetNt()*nevents elements: the component of the decay product i
+///  in the event k is at index i*nevents+k. The weights of the events are written
+///  to the array weights of nevents elements, unless it is null. The arrays may be
+///  directly adopted by the columns of a data frame or a tree.
+///
+///  The random numbers are not drawn from gRandom but from a RANLUX++ generator
+///  initialized with seed. The events are generated in blocks of 4096, each block
+///  skipping ahead to its own position of the random number sequence. If the
+///  implicit multi-threading is enabled, the blocks are generated by several
+///  threads. The result only depends on the seed, not on the number of threads.
+///  Returns kFALSE if SetDecay() did not succeed or an array is missing.
+
+Bool_t TGenPhaseSpace::GenerateBatch(Long64_t nevents, ULong64_t seed, Double_t *weights,
+                                     Double_t *px, Double_t *py, Double_t *pz, Double_t *e) const
+{
+   if (fNt < 2 || fNt > kMAXP || fTeCmTm <= 0) {
+      Error("GenerateBatch", "no valid decay was set with SetDecay()");
+      return kFALSE;
+   }
+   if (!px || !py || !pz || !e) {
+      Error("GenerateBatch", "the arrays of the four-momenta must be allocated by the user");
+      return kFALSE;
+   }
+   if (nevents <= 0)
+      return kTRUE;
+
+   const ULong64_t nRandomPerEvent = 3*fNt - 4;
+   const Long64_t nblocks = (nevents + kBatchBlockSize - 1) / kBatchBlockSize;
+   auto generateBlock = [&](Long64_t block) {
+      ROOT::Math::RanluxppEngine2048 engine(seed);
+      engine.Skip(block * kBatchBlockSize * nRandomPerEvent);
+      auto rndm = [&engine] { return engine(); };
+
+      const Long64_t first = block * kBatchBlockSize;
+      const Long64_t last = std::min(nevents, first + kBatchBlockSize);
+      Double_t epx[kMAXP], epy[kMAXP], epz[kMAXP], ee[kMAXP];
+      for (Long64_t k = first; k < last; k++) {
+         Double_t wt = GenerateRestFrame(fNt, fMass, fTeCmTm, fWtMax, rndm, epx, epy, epz, ee);
+         if (weights)
+            weights[k] = wt;
+         for (Int_t i = 0; i < fNt; i++) {
+            px[i*nevents + k] = epx[i];
+            py[i*nevents + k] = epy[i];
+            pz[i*nevents + k] = epz[i];
+            e[i*nevents + k]  = ee[i];
+         }
       }
+      // final boost, on the contiguous components of each decay product
+      for (Int_t i = 0; i < fNt; i++) {
+         const Long64_t offset = i*nevents + first;
+         BoostArrays(last - first, px + offset, py + offset, pz + offset, e + offset, fBeta[0], fBeta[1], fBeta[2]);
+      }
+   };
 
-      if (i == (fNt-1)) break;
-
-      Double_t beta = pd[i] / sqrt(pd[i]*pd[i] + invMas[i]*invMas[i]);
-      for (j=0; j<=i; j++) fDecPro[j].Boost(0,beta,0);
-      i++;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nblocks > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(generateBlock, ROOT::TSeq<Long64_t>(nblocks));
+      return kTRUE;
    }
-
-   //
-   //---> final boost of all particles
-   //
-   for (n=0;n<fNt;n++) fDecPro[n].Boost(fBeta[0],fBeta[1],fBeta[2]);
-
-   //
-   //---> return the weight of event
-   //
-   return wt;
+#endif
+   for (Long64_t block = 0; block < nblocks; block++)
+      generateBlock(block);
+   return kTRUE;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
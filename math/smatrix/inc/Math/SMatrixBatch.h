@@ -0,0 +1,341 @@
+// @(#)root/smatrix:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_Math_SMatrixBatch
+#define ROOT_Math_SMatrixBatch
+
+#include "Math/SMatrix.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ROOT {
+
+namespace Math {
+
+//__________________________________________________________________________
+/**
+    SMatrixBatch: N independent D1 x D2 matrices stored element-interleaved
+    ("matriplex" layout): the element (i,j) of the N matrices is stored in N
+    consecutive values. The functions working on batches (Multiply,
+    Similarity, CholeskyInvert...) loop over the N matrices in their
+    innermost loop, which the compiler vectorizes, as in the Kalman filters
+    of track fits processing many small matrices at a time. N is best a
+    multiple of the SIMD width of T, e.g. 8 or 16.
+
+    The single matrices are exchanged with SMatrix, or with any SMatrix
+    expression, with Get() and Set():
+
+    @code
+    SMatrixBatch<double, 5, 5, 16> cov, jac;
+    for (unsigned int n = 0; n < 16; ++n) {
+       cov.Set(n, tracks[n].Covariance());
+       jac.Set(n, Jacobian(tracks[n]) * scale);
+    }
+    SMatrixBatch<double, 5, 5, 16> propagated = Similarity(jac, cov);
+    bool ok[16];
+    CholeskyInvert(propagated, ok);
+    SMatrix<double, 5, 5> weight0 = propagated.Get(0);
+    @endcode
+
+    @ingroup SMatrixSVector
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+class SMatrixBatch {
+
+public:
+
+   typedef T value_type;
+
+   enum {
+      /// number of rows
+      kRows = D1,
+      /// number of columns
+      kCols = D2,
+      /// number of matrices
+      kBatch = N,
+      /// number of elements of a single matrix
+      kSize = D1 * D2
+   };
+
+   /// default constructor: the elements are not initialized
+   SMatrixBatch() {}
+
+   /// batch of N copies of the matrix or expression m
+   template <class M>
+   explicit SMatrixBatch(const M &m) { SetAll(m); }
+
+   /// element (i,j) of the n-th matrix
+   T &operator()(unsigned int i, unsigned int j, unsigned int n) { return fArray[(i * D2 + j) * N + n]; }
+   const T &operator()(unsigned int i, unsigned int j, unsigned int n) const { return fArray[(i * D2 + j) * N + n]; }
+
+   /// the N values of the element (i,j) of all matrices
+   T *Lanes(unsigned int i, unsigned int j) { return fArray + (i * D2 + j) * N; }
+   const T *Lanes(unsigned int i, unsigned int j) const { return fArray + (i * D2 + j) * N; }
+
+   /// pointer to the interleaved elements
+   T *Array() { return fArray; }
+   const T *Array() const { return fArray; }
+
+   /// the n-th matrix
+   SMatrix<T, D1, D2> Get(unsigned int n) const
+   {
+      SMatrix<T, D1, D2> m(SMatrixNoInit{});
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            m(i, j) = (*this)(i, j, n);
+      return m;
+   }
+
+   /// set the n-th matrix to m, an SMatrix of any representation or an SMatrix expression
+   template <class M>
+   void Set(unsigned int n, const M &m)
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            (*this)(i, j, n) = m(i, j);
+   }
+
+   /// set all matrices to m
+   template <class M>
+   void SetAll(const M &m)
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j) {
+            const T mij = m(i, j);
+            T *lanes = Lanes(i, j);
+            for (unsigned int n = 0; n < N; ++n)
+               lanes[n] = mij;
+         }
+   }
+
+   /// element-wise operations with another batch
+   SMatrixBatch &operator+=(const SMatrixBatch &rhs)
+   {
+      for (unsigned int k = 0; k < kSize * N; ++k)
+         fArray[k] += rhs.fArray[k];
+      return *this;
+   }
+   SMatrixBatch &operator-=(const SMatrixBatch &rhs)
+   {
+      for (unsigned int k = 0; k < kSize * N; ++k)
+         fArray[k] -= rhs.fArray[k];
+      return *this;
+   }
+   SMatrixBatch &operator*=(const T &rhs)
+   {
+      for (unsigned int k = 0; k < kSize * N; ++k)
+         fArray[k] *= rhs;
+      return *this;
+   }
+
+private:
+
+   T fArray[kSize * N];
+
+};
+
+/**
+   element-wise sum and difference of two batches
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D1, D2, N> operator+(SMatrixBatch<T, D1, D2, N> lhs, const SMatrixBatch<T, D1, D2, N> &rhs)
+{
+   return lhs += rhs;
+}
+
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D1, D2, N> operator-(SMatrixBatch<T, D1, D2, N> lhs, const SMatrixBatch<T, D1, D2, N> &rhs)
+{
+   return lhs -= rhs;
+}
+
+/**
+   matrix products C(n) = A(n) * B(n) of two batches
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D, unsigned int D2, unsigned int N>
+inline void Multiply(const SMatrixBatch<T, D1, D, N> &a, const SMatrixBatch<T, D, D2, N> &b,
+                     SMatrixBatch<T, D1, D2, N> &c)
+{
+   for (unsigned int i = 0; i < D1; ++i)
+      for (unsigned int j = 0; j < D2; ++j) {
+         // local sums, which cannot alias the inputs
+         T cij[N] = {};
+         for (unsigned int k = 0; k < D; ++k) {
+            const T *aik = a.Lanes(i, k);
+            const T *bkj = b.Lanes(k, j);
+            for (unsigned int n = 0; n < N; ++n)
+               cij[n] += aik[n] * bkj[n];
+         }
+         std::copy(cij, cij + N, c.Lanes(i, j));
+      }
+}
+
+template <class T, unsigned int D1, unsigned int D, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D1, D2, N> operator*(const SMatrixBatch<T, D1, D, N> &a, const SMatrixBatch<T, D, D2, N> &b)
+{
+   SMatrixBatch<T, D1, D2, N> c;
+   Multiply(a, b, c);
+   return c;
+}
+
+/**
+   transposes of the matrices of a batch
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D2, D1, N> Transpose(const SMatrixBatch<T, D1, D2, N> &a)
+{
+   SMatrixBatch<T, D2, D1, N> t;
+   for (unsigned int i = 0; i < D1; ++i)
+      for (unsigned int j = 0; j < D2; ++j) {
+         const T *aij = a.Lanes(i, j);
+         T *tji = t.Lanes(j, i);
+         for (unsigned int n = 0; n < N; ++n)
+            tji[n] = aij[n];
+      }
+   return t;
+}
+
+/**
+   similarity transforms M(n) * S(n) * M(n)^T of a batch of symmetric
+   matrices S. The results are symmetric: the lower half is computed and
+   copied to the upper half, as for the SMatrix Similarity of a symmetric
+   matrix.
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D1, D1, N> Similarity(const SMatrixBatch<T, D1, D2, N> &m, const SMatrixBatch<T, D2, D2, N> &s)
+{
+   const SMatrixBatch<T, D1, D2, N> ms = m * s;
+   SMatrixBatch<T, D1, D1, N> r;
+   for (unsigned int i = 0; i < D1; ++i)
+      for (unsigned int j = 0; j <= i; ++j) {
+         T rij[N] = {};
+         for (unsigned int k = 0; k < D2; ++k) {
+            const T *msik = ms.Lanes(i, k);
+            const T *mjk = m.Lanes(j, k);
+            for (unsigned int n = 0; n < N; ++n)
+               rij[n] += msik[n] * mjk[n];
+         }
+         std::copy(rij, rij + N, r.Lanes(i, j));
+         std::copy(rij, rij + N, r.Lanes(j, i));
+      }
+   return r;
+}
+
+/**
+   invert in place the symmetric positive definite matrices of a batch
+   with a Cholesky decomposition, as CholeskyDecomp does for a single
+   matrix. Only the lower half of the matrices is read.
+
+   @param m the batch to invert
+   @param ok if not null, ok[n] is set to false if the n-th matrix is not
+          positive definite, in which case that matrix is left unchanged
+   @return true if all matrices were inverted
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D, unsigned int N>
+inline bool CholeskyInvert(SMatrixBatch<T, D, D, N> &m, bool *ok = nullptr)
+{
+   // L, lower triangle in packed storage with the diagonal elements
+   // pre-inverted, element L(i,j) of the n-th matrix at ((i * (i + 1)) / 2 + j) * N + n
+   T l[(D * (D + 1) / 2) * N];
+   bool pos[N];
+   for (unsigned int n = 0; n < N; ++n)
+      pos[n] = true;
+
+   // decomposition M = L L^T
+   for (unsigned int i = 0; i < D; ++i) {
+      T *li = l + ((i * (i + 1)) / 2) * N;
+      T diag[N];
+      for (unsigned int n = 0; n < N; ++n)
+         diag[n] = T(0);
+      for (unsigned int j = 0; j < i; ++j) {
+         const T *lj = l + ((j * (j + 1)) / 2) * N;
+         const T *mij = m.Lanes(i, j);
+         T *lij = li + j * N;
+         for (unsigned int n = 0; n < N; ++n)
+            lij[n] = mij[n];
+         for (unsigned int k = 0; k < j; ++k)
+            for (unsigned int n = 0; n < N; ++n)
+               lij[n] -= li[k * N + n] * lj[k * N + n];
+         for (unsigned int n = 0; n < N; ++n) {
+            lij[n] *= lj[j * N + n];
+            diag[n] += lij[n] * lij[n];
+         }
+      }
+      const T *mii = m.Lanes(i, i);
+      for (unsigned int n = 0; n < N; ++n) {
+         const T d = mii[n] - diag[n];
+         // a failed matrix continues with a harmless value and is discarded at the end
+         pos[n] = pos[n] && d > T(0);
+         li[i * N + n] = pos[n] ? T(1) / std::sqrt(d) : T(1);
+      }
+   }
+
+   // L^-1, in place
+   for (unsigned int i = 1; i < D; ++i) {
+      T *li = l + ((i * (i + 1)) / 2) * N;
+      for (unsigned int j = 0; j < i; ++j) {
+         T tmp[N];
+         for (unsigned int n = 0; n < N; ++n)
+            tmp[n] = T(0);
+         for (unsigned int k = j; k < i; ++k) {
+            const T *lkj = l + ((k * (k + 1)) / 2 + j) * N;
+            for (unsigned int n = 0; n < N; ++n)
+               tmp[n] -= li[k * N + n] * lkj[n];
+         }
+         for (unsigned int n = 0; n < N; ++n)
+            li[j * N + n] = tmp[n] * li[i * N + n];
+      }
+   }
+
+   // M^-1 = (L^-1)^T L^-1
+   bool all = true;
+   for (unsigned int n = 0; n < N; ++n) {
+      all = all && pos[n];
+      if (ok)
+         ok[n] = pos[n];
+   }
+   for (unsigned int i = 0; i < D; ++i)
+      for (unsigned int j = 0; j <= i; ++j) {
+         T inv[N];
+         for (unsigned int n = 0; n < N; ++n)
+            inv[n] = T(0);
+         for (unsigned int k = i; k < D; ++k) {
+            const T *lk = l + ((k * (k + 1)) / 2) * N;
+            for (unsigned int n = 0; n < N; ++n)
+               inv[n] += lk[i * N + n] * lk[j * N + n];
+         }
+         T *mij = m.Lanes(i, j);
+         T *mji = m.Lanes(j, i);
+         for (unsigned int n = 0; n < N; ++n) {
+            if (pos[n]) {
+               mij[n] = inv[n];
+               mji[n] = inv[n];
+            }
+         }
+      }
+   return all;
+}
+
+} // namespace Math
+
+} // namespace ROOT
+
+#endif
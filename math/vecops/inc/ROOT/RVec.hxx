@@ -32,6 +32,7 @@
    #define _VECOPS_USE_EXTERN_TEMPLATES true
 #endif
 
+#include <ROOT/RVecArena.hxx>
 #include <Rtypes.h> // R__CLING_PTRCHECK
 #include <TError.h> // R__ASSERT
 
@@ -537,6 +538,41 @@ void UninitializedValueConstruct(ForwardIt first, ForwardIt last)
 #endif
 }
 
+/// Return uninitialized memory for `n` elements of type T from the current RVec arena of this thread (see
+/// RVecArena::SetCurrent()), or nullptr if the elements should rather be allocated as usual: if no arena is current,
+/// if T is not trivially destructible (RVecs that adopt memory do not destroy their elements) or if the elements fit in
+/// the `inlineSize` elements of inline storage of the RVec that will hold them.
+template <typename T>
+T *AllocateTemporary(std::size_t n, std::size_t inlineSize = RVecInlineStorageSize<T>::value)
+{
+   if (!std::is_trivially_destructible<T>::value || n <= inlineSize)
+      return nullptr;
+   auto *arena = RVecArena::GetCurrent();
+   return arena ? static_cast<T *>(arena->Allocate(n * sizeof(T), alignof(T))) : nullptr;
+}
+
+/// Return an RVec of `n` value-initialized elements, in the current RVec arena if possible (see AllocateTemporary())
+template <typename T>
+RVec<T> MakeTemporary(std::size_t n)
+{
+   if (T *buf = AllocateTemporary<T>(n)) {
+      UninitializedValueConstruct(buf, buf + n);
+      return RVec<T>(buf, n);
+   }
+   return RVec<T>(n);
+}
+
+/// Return a copy of `v`, in the current RVec arena if possible (see AllocateTemporary())
+template <typename T>
+RVec<T> CopyToTemporary(const RVec<T> &v)
+{
+   if (T *buf = AllocateTemporary<T>(v.size())) {
+      std::uninitialized_copy(v.begin(), v.end(), buf);
+      return RVec<T>(buf, v.size());
+   }
+   return RVec<T>(v);
+}
+
 /// An unsafe function to reset the buffer for which this RVec is acting as a view.
 ///
 /// \note This is a low-level method that _must_ be called on RVecs that are already non-owning:
@@ -549,6 +585,201 @@ void ResetView(RVec<T> &v, T* addr, std::size_t sz)
    v.fSize = sz;
 }
 
+/// \name Explicitly vectorized kernels
+/// Element-wise operations on contiguous arrays of floats or doubles. They are compiled in libROOTVecOps with
+/// explicit SIMD instructions (through std::experimental::simd, if the standard library provides it), and the RVec
+/// operators and helpers dispatch to them for RVec<float> and RVec<double>. Other value types use generic loops.
+///@{
+
+/// The element-wise operations implemented by ElementWiseKernel. Operators without a kernel use kNone.
+enum class EKernelOp {
+   kNone,
+   kAdd,
+   kSub,
+   kMul,
+   kDiv,
+   kLess,
+   kGreater,
+   kEqual,
+   kNotEqual,
+   kLessEqual,
+   kGreaterEqual,
+   kSqrt,
+   kAbs,
+   kFloor,
+   kCeil,
+   kTrunc
+};
+
+#define RVEC_DECLARE_KERNELS(T)                                                                                  \
+   void ElementWiseKernel(EKernelOp op, const T *x, T *out, std::size_t n);                                      \
+   void ElementWiseKernel(EKernelOp op, const T *x, const T *y, T *out, std::size_t n);                          \
+   void ElementWiseKernel(EKernelOp op, const T *x, T y, T *out, std::size_t n);                                 \
+   void ElementWiseKernel(EKernelOp op, T x, const T *y, T *out, std::size_t n);                                 \
+   void ElementWiseKernel(EKernelOp op, const T *x, const T *y, int *out, std::size_t n);                        \
+   void ElementWiseKernel(EKernelOp op, const T *x, T y, int *out, std::size_t n);                               \
+   void ElementWiseKernel(EKernelOp op, T x, const T *y, int *out, std::size_t n);                               \
+   T SumKernel(const T *x, std::size_t n, T init);                                                               \
+   void WhereKernel(const int *c, const T *x, const T *y, T *out, std::size_t n);                                \
+   void WhereKernel(const int *c, const T *x, T y, T *out, std::size_t n);                                       \
+   void WhereKernel(const int *c, T x, const T *y, T *out, std::size_t n);                                       \
+   void WhereKernel(const int *c, T x, T y, T *out, std::size_t n);                                              \
+   void DeltaRKernel(const T *eta1, const T *eta2, const T *phi1, const T *phi2, T c, T *out, std::size_t n,     \
+                     bool squared);                                                                              \
+   void InvariantMassesKernel(const T *pt1, const T *eta1, const T *phi1, const T *mass1, const T *pt2,          \
+                              const T *eta2, const T *phi2, const T *mass2, T *out, std::size_t n);
+
+RVEC_DECLARE_KERNELS(float)
+RVEC_DECLARE_KERNELS(double)
+#undef RVEC_DECLARE_KERNELS
+
+#ifdef R__HAS_VDT
+/// The vdt functions implemented by FastMathKernel: e.g. kExp is vdt::fast_expf for floats and vdt::fast_exp for
+/// doubles.
+enum class EFastMathOp { kExp, kLog, kSin, kCos, kTan, kAsin, kAcos, kAtan };
+
+void FastMathKernel(EFastMathOp op, const float *x, float *out, std::size_t n);
+void FastMathKernel(EFastMathOp op, const double *x, double *out, std::size_t n);
+#endif
+
+template <typename T>
+using IsKernelType = std::integral_constant<bool, std::is_same<T, float>::value || std::is_same<T, double>::value>;
+
+/// Whether an operation between an RVec<T> and a scalar of type U can be computed by the kernels for T, i.e. whether
+/// the scalar is converted to T by the usual arithmetic conversions.
+template <typename T, typename U>
+using IsKernelScalar =
+   std::integral_constant<bool, IsKernelType<T>::value && std::is_arithmetic<U>::value &&
+                                   std::is_same<typename std::common_type<T, U>::type, T>::value>;
+
+/// Whether an operation between an RVec<T0> and an RVec<T1> can be computed by the kernels
+template <typename T0, typename T1>
+using AreKernelTypes = std::integral_constant<bool, IsKernelType<T0>::value && std::is_same<T0, T1>::value>;
+
+/// The RunKernel functions call the kernel of an element-wise operation and return true if the tag is
+/// std::true_type and the operation has a kernel. Otherwise they return false, and the caller runs a generic loop.
+template <typename... Args>
+bool RunKernel(std::false_type, EKernelOp, Args &&...)
+{
+   return false;
+}
+
+template <typename T, typename R>
+bool RunKernel(std::true_type, EKernelOp op, const T *x, R *out, std::size_t n)
+{
+   if (op == EKernelOp::kNone)
+      return false;
+   ElementWiseKernel(op, x, out, n);
+   return true;
+}
+
+template <typename T, typename R>
+bool RunKernel(std::true_type, EKernelOp op, const T *x, const T *y, R *out, std::size_t n)
+{
+   if (op == EKernelOp::kNone)
+      return false;
+   ElementWiseKernel(op, x, y, out, n);
+   return true;
+}
+
+template <typename T, typename U, typename R, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+bool RunKernel(std::true_type, EKernelOp op, const T *x, const U &y, R *out, std::size_t n)
+{
+   if (op == EKernelOp::kNone)
+      return false;
+   ElementWiseKernel(op, x, static_cast<T>(y), out, n);
+   return true;
+}
+
+template <typename U, typename T, typename R, typename = typename std::enable_if<std::is_arithmetic<U>::value>::type>
+bool RunKernel(std::true_type, EKernelOp op, const U &x, const T *y, R *out, std::size_t n)
+{
+   if (op == EKernelOp::kNone)
+      return false;
+   ElementWiseKernel(op, static_cast<T>(x), y, out, n);
+   return true;
+}
+
+template <typename T>
+T SumImpl(std::false_type, const RVec<T> &v, const T &zero)
+{
+   return std::accumulate(v.begin(), v.end(), zero);
+}
+
+template <typename T>
+T SumImpl(std::true_type, const RVec<T> &v, const T &zero)
+{
+   return SumKernel(v.data(), v.size(), zero);
+}
+
+/// Fill out with the result of WhereKernel if the tag is std::true_type, otherwise return false
+template <typename... Args>
+bool RunWhereKernel(std::false_type, Args &&...)
+{
+   return false;
+}
+
+template <typename X, typename Y, typename T>
+bool RunWhereKernel(std::true_type, const int *c, X x, Y y, RVec<T> &out, std::size_t n)
+{
+   out.resize(n);
+   WhereKernel(c, x, y, out.data(), n);
+   return true;
+}
+
+/// Fill out with the result of DeltaRKernel if the tag is std::true_type, otherwise return false
+template <typename... Args>
+bool RunDeltaRKernel(std::false_type, Args &&...)
+{
+   return false;
+}
+
+template <typename T>
+bool RunDeltaRKernel(std::true_type, const RVec<T> &eta1, const RVec<T> &eta2, const RVec<T> &phi1,
+                     const RVec<T> &phi2, T c, RVec<T> &out, bool squared)
+{
+   const auto size = GetVectorsSize(squared ? "DeltaR2" : "DeltaR", eta1, eta2, phi1, phi2);
+   out.resize(size);
+   DeltaRKernel(eta1.data(), eta2.data(), phi1.data(), phi2.data(), c, out.data(), size, squared);
+   return true;
+}
+
+/// Fill out with the result of InvariantMassesKernel if the tag is std::true_type, otherwise return false
+template <typename... Args>
+bool RunInvariantMassesKernel(std::false_type, Args &&...)
+{
+   return false;
+}
+
+template <typename T>
+bool RunInvariantMassesKernel(std::true_type, const RVec<T> &pt1, const RVec<T> &eta1, const RVec<T> &phi1,
+                              const RVec<T> &mass1, const RVec<T> &pt2, const RVec<T> &eta2, const RVec<T> &phi2,
+                              const RVec<T> &mass2, RVec<T> &out)
+{
+   out.resize(pt1.size());
+   InvariantMassesKernel(pt1.data(), eta1.data(), phi1.data(), mass1.data(), pt2.data(), eta2.data(), phi2.data(),
+                         mass2.data(), out.data(), pt1.size());
+   return true;
+}
+
+#ifdef R__HAS_VDT
+/// Call FastMathKernel and return true if the tag is std::true_type, otherwise return false
+template <typename... Args>
+bool RunFastMathKernel(std::false_type, Args &&...)
+{
+   return false;
+}
+
+template <typename T>
+bool RunFastMathKernel(std::true_type, EFastMathOp op, const T *x, T *out, std::size_t n)
+{
+   FastMathKernel(op, x, out, n);
+   return true;
+}
+#endif
+
+///@}
+
 } // namespace VecOps
 } // namespace Internal
 
@@ -1263,6 +1494,15 @@ public:
       for (auto c : conds)
          n_true += c; // relies on bool -> int conversion, faster than branching
 
+      if (T *buf = ROOT::Internal::VecOps::AllocateTemporary<T>(n_true, N)) {
+         size_type j = 0u;
+         for (size_type i = 0u; i < n; ++i) {
+            if (conds[i])
+               new (buf + j++) T(this->operator[](i));
+         }
+         return RVecN(buf, n_true);
+      }
+
       RVecN ret;
       ret.reserve(n_true);
       size_type j = 0u;
@@ -1359,6 +1599,7 @@ to make RVec a drop-in replacement for `std::vector`.
 - [Owning and adopting memory](\ref owningandadoptingmemory)
 - [Sorting and manipulation of indices](\ref sorting)
 - [Usage in combination with RDataFrame](\ref usagetdataframe)
+- [Lazy evaluation of expressions](\ref lazyexpressions)
 - [Reference for the RVec class](\ref RVecdoxyref)
 - [Reference for RVec helper functions](https://root.cern/doc/master/namespaceROOT_1_1VecOps.html)
 
@@ -1484,6 +1725,17 @@ auto hpt = d.Define("pt", "sqrt(pxs * pxs + pys * pys)[E>200]")
             .Histo1D("pt");
 hpt->Draw();
 ~~~
+
+\anchor lazyexpressions
+## Lazy evaluation of expressions
+Each operation in the expression above creates a new RVec. Wrapping one of the operands in Lazy() makes the operations
+return an ROOT::VecOps::RVecExpr instead, which evaluates the whole chain in a single pass over the elements, without
+intermediate RVecs, when it is converted to an RVec or indexed with a mask:
+~~~{.cpp}
+auto hpt = d.Define("pt", "sqrt(Lazy(pxs) * pxs + pys * pys)[E>200]")
+            .Histo1D("pt");
+~~~
+RDataFrame stores the values of Defines that return an RVecExpr as RVecs.
 \anchor RVecdoxyref
 **/
 // clang-format on
@@ -1599,12 +1851,17 @@ RVEC_UNARY_OPERATOR(!)
 #define ERROR_MESSAGE(OP) \
  "Cannot call operator " #OP " on vectors of different sizes."
 
-#define RVEC_BINARY_OPERATOR(OP)                                               \
+#define RVEC_BINARY_OPERATOR(OP, KIND)                                         \
 template <typename T0, typename T1>                                            \
 auto operator OP(const RVec<T0> &v, const T1 &y)                               \
   -> RVec<decltype(v[0] OP y)>                                                 \
 {                                                                              \
    RVec<decltype(v[0] OP y)> ret(v.size());                                    \
+   if (ROOT::Internal::VecOps::RunKernel(                                      \
+          ROOT::Internal::VecOps::IsKernelScalar<T0, T1>{},                    \
+          ROOT::Internal::VecOps::EKernelOp::KIND, v.data(), y, ret.data(),    \
+          v.size()))                                                           \
+      return ret;                                                              \
    auto op = [&y](const T0 &x) { return x OP y; };                             \
    std::transform(v.begin(), v.end(), ret.begin(), op);                        \
    return ret;                                                                 \
@@ -1615,6 +1872,11 @@ auto operator OP(const T0 &x, const RVec<T1> &v)                               \
   -> RVec<decltype(x OP v[0])>                                                 \
 {                                                                              \
    RVec<decltype(x OP v[0])> ret(v.size());                                    \
+   if (ROOT::Internal::VecOps::RunKernel(                                      \
+          ROOT::Internal::VecOps::IsKernelScalar<T1, T0>{},                    \
+          ROOT::Internal::VecOps::EKernelOp::KIND, x, v.data(), ret.data(),    \
+          v.size()))                                                           \
+      return ret;                                                              \
    auto op = [&x](const T1 &y) { return x OP y; };                             \
    std::transform(v.begin(), v.end(), ret.begin(), op);                        \
    return ret;                                                                 \
@@ -1628,29 +1890,39 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
       throw std::runtime_error(ERROR_MESSAGE(OP));                             \
                                                                                \
    RVec<decltype(v0[0] OP v1[0])> ret(v0.size());                              \
+   if (ROOT::Internal::VecOps::RunKernel(                                      \
+          ROOT::Internal::VecOps::AreKernelTypes<T0, T1>{},                    \
+          ROOT::Internal::VecOps::EKernelOp::KIND, v0.data(), v1.data(), ret.data(),\
+          v0.size()))                                                          \
+      return ret;                                                              \
    auto op = [](const T0 &x, const T1 &y) { return x OP y; };                  \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
 
-RVEC_BINARY_OPERATOR(+)
-RVEC_BINARY_OPERATOR(-)
-RVEC_BINARY_OPERATOR(*)
-RVEC_BINARY_OPERATOR(/)
-RVEC_BINARY_OPERATOR(%)
-RVEC_BINARY_OPERATOR(^)
-RVEC_BINARY_OPERATOR(|)
-RVEC_BINARY_OPERATOR(&)
+RVEC_BINARY_OPERATOR(+, kAdd)
+RVEC_BINARY_OPERATOR(-, kSub)
+RVEC_BINARY_OPERATOR(*, kMul)
+RVEC_BINARY_OPERATOR(/, kDiv)
+RVEC_BINARY_OPERATOR(%, kNone)
+RVEC_BINARY_OPERATOR(^, kNone)
+RVEC_BINARY_OPERATOR(|, kNone)
+RVEC_BINARY_OPERATOR(&, kNone)
 #undef RVEC_BINARY_OPERATOR
 
 ///@}
 ///@name RVec Assignment Arithmetic Operators
 ///@{
 
-#define RVEC_ASSIGNMENT_OPERATOR(OP)                                           \
+#define RVEC_ASSIGNMENT_OPERATOR(OP, KIND)                                     \
 template <typename T0, typename T1>                                            \
 RVec<T0>& operator OP(RVec<T0> &v, const T1 &y)                                \
 {                                                                              \
+   if (ROOT::Internal::VecOps::RunKernel(                                      \
+          ROOT::Internal::VecOps::IsKernelScalar<T0, T1>{},                    \
+          ROOT::Internal::VecOps::EKernelOp::KIND, v.data(), y, v.data(),      \
+          v.size()))                                                           \
+      return v;                                                                \
    auto op = [&y](T0 &x) { return x OP y; };                                   \
    std::transform(v.begin(), v.end(), v.begin(), op);                          \
    return v;                                                                   \
@@ -1662,33 +1934,43 @@ RVec<T0>& operator OP(RVec<T0> &v0, const RVec<T1> &v1)                        \
    if (v0.size() != v1.size())                                                 \
       throw std::runtime_error(ERROR_MESSAGE(OP));                             \
                                                                                \
+   if (ROOT::Internal::VecOps::RunKernel(                                      \
+          ROOT::Internal::VecOps::AreKernelTypes<T0, T1>{},                    \
+          ROOT::Internal::VecOps::EKernelOp::KIND, v0.data(), v1.data(), v0.data(),\
+          v0.size()))                                                          \
+      return v0;                                                               \
    auto op = [](T0 &x, const T1 &y) { return x OP y; };                        \
    std::transform(v0.begin(), v0.end(), v1.begin(), v0.begin(), op);           \
    return v0;                                                                  \
 }                                                                              \
 
-RVEC_ASSIGNMENT_OPERATOR(+=)
-RVEC_ASSIGNMENT_OPERATOR(-=)
-RVEC_ASSIGNMENT_OPERATOR(*=)
-RVEC_ASSIGNMENT_OPERATOR(/=)
-RVEC_ASSIGNMENT_OPERATOR(%=)
-RVEC_ASSIGNMENT_OPERATOR(^=)
-RVEC_ASSIGNMENT_OPERATOR(|=)
-RVEC_ASSIGNMENT_OPERATOR(&=)
-RVEC_ASSIGNMENT_OPERATOR(>>=)
-RVEC_ASSIGNMENT_OPERATOR(<<=)
+RVEC_ASSIGNMENT_OPERATOR(+=, kAdd)
+RVEC_ASSIGNMENT_OPERATOR(-=, kSub)
+RVEC_ASSIGNMENT_OPERATOR(*=, kMul)
+RVEC_ASSIGNMENT_OPERATOR(/=, kDiv)
+RVEC_ASSIGNMENT_OPERATOR(%=, kNone)
+RVEC_ASSIGNMENT_OPERATOR(^=, kNone)
+RVEC_ASSIGNMENT_OPERATOR(|=, kNone)
+RVEC_ASSIGNMENT_OPERATOR(&=, kNone)
+RVEC_ASSIGNMENT_OPERATOR(>>=, kNone)
+RVEC_ASSIGNMENT_OPERATOR(<<=, kNone)
 #undef RVEC_ASSIGNMENT_OPERATOR
 
 ///@}
 ///@name RVec Comparison and Logical Operators
 ///@{
 
-#define RVEC_LOGICAL_OPERATOR(OP)                                              \
+#define RVEC_LOGICAL_OPERATOR(OP, KIND)                                        \
 template <typename T0, typename T1>                                            \
 auto operator OP(const RVec<T0> &v, const T1 &y)                               \
   -> RVec<int> /* avoid std::vector<bool> */                                   \
 {                                                                              \
    RVec<int> ret(v.size());                                                    \
+   if (ROOT::Internal::VecOps::RunKernel(                                      \
+          ROOT::Internal::VecOps::IsKernelScalar<T0, T1>{},                    \
+          ROOT::Internal::VecOps::EKernelOp::KIND, v.data(), y, ret.data(),    \
+          v.size()))                                                           \
+      return ret;                                                              \
    auto op = [y](const T0 &x) -> int { return x OP y; };                       \
    std::transform(v.begin(), v.end(), ret.begin(), op);                        \
    return ret;                                                                 \
@@ -1699,6 +1981,11 @@ auto operator OP(const T0 &x, const RVec<T1> &v)                               \
   -> RVec<int> /* avoid std::vector<bool> */                                   \
 {                                                                              \
    RVec<int> ret(v.size());                                                    \
+   if (ROOT::Internal::VecOps::RunKernel(                                      \
+          ROOT::Internal::VecOps::IsKernelScalar<T1, T0>{},                    \
+          ROOT::Internal::VecOps::EKernelOp::KIND, x, v.data(), ret.data(),    \
+          v.size()))                                                           \
+      return ret;                                                              \
    auto op = [x](const T1 &y) -> int { return x OP y; };                       \
    std::transform(v.begin(), v.end(), ret.begin(), op);                        \
    return ret;                                                                 \
@@ -1712,19 +1999,24 @@ auto operator OP(const RVec<T0> &v0, const RVec<T1> &v1)                       \
       throw std::runtime_error(ERROR_MESSAGE(OP));                             \
                                                                                \
    RVec<int> ret(v0.size());                                                   \
+   if (ROOT::Internal::VecOps::RunKernel(                                      \
+          ROOT::Internal::VecOps::AreKernelTypes<T0, T1>{},                    \
+          ROOT::Internal::VecOps::EKernelOp::KIND, v0.data(), v1.data(), ret.data(),\
+          v0.size()))                                                          \
+      return ret;                                                              \
    auto op = [](const T0 &x, const T1 &y) -> int { return x OP y; };           \
    std::transform(v0.begin(), v0.end(), v1.begin(), ret.begin(), op);          \
    return ret;                                                                 \
 }                                                                              \
 
-RVEC_LOGICAL_OPERATOR(<)
-RVEC_LOGICAL_OPERATOR(>)
-RVEC_LOGICAL_OPERATOR(==)
-RVEC_LOGICAL_OPERATOR(!=)
-RVEC_LOGICAL_OPERATOR(<=)
-RVEC_LOGICAL_OPERATOR(>=)
-RVEC_LOGICAL_OPERATOR(&&)
-RVEC_LOGICAL_OPERATOR(||)
+RVEC_LOGICAL_OPERATOR(<, kLess)
+RVEC_LOGICAL_OPERATOR(>, kGreater)
+RVEC_LOGICAL_OPERATOR(==, kEqual)
+RVEC_LOGICAL_OPERATOR(!=, kNotEqual)
+RVEC_LOGICAL_OPERATOR(<=, kLessEqual)
+RVEC_LOGICAL_OPERATOR(>=, kGreaterEqual)
+RVEC_LOGICAL_OPERATOR(&&, kNone)
+RVEC_LOGICAL_OPERATOR(||, kNone)
 #undef RVEC_LOGICAL_OPERATOR
 
 ///@}
@@ -1758,6 +2050,22 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
       return ret;                                                              \
    }
 
+// A unary function that runs the kernel of KIND for RVec<float> and RVec<double>
+#define RVEC_KERNEL_UNARY_FUNCTION(NAME, FUNC, KIND)                           \
+   template <typename T>                                                       \
+   RVec<PromoteType<T>> NAME(const RVec<T> &v)                                 \
+   {                                                                           \
+      RVec<PromoteType<T>> ret(v.size());                                      \
+      if (ROOT::Internal::VecOps::RunKernel(                                   \
+             ROOT::Internal::VecOps::IsKernelType<T>{},                        \
+             ROOT::Internal::VecOps::EKernelOp::KIND, v.data(), ret.data(),    \
+             v.size()))                                                        \
+         return ret;                                                           \
+      auto f = [](const T &x) { return FUNC(x); };                             \
+      std::transform(v.begin(), v.end(), ret.begin(), f);                      \
+      return ret;                                                              \
+   }
+
 #define RVEC_BINARY_FUNCTION(NAME, FUNC)                                       \
    template <typename T0, typename T1>                                         \
    RVec<PromoteTypes<T0, T1>> NAME(const T0 &x, const RVec<T1> &v)             \
@@ -1791,8 +2099,9 @@ using PromoteTypes = decltype(PromoteType<U>() + PromoteType<V>());
 
 #define RVEC_STD_UNARY_FUNCTION(F) RVEC_UNARY_FUNCTION(F, std::F)
 #define RVEC_STD_BINARY_FUNCTION(F) RVEC_BINARY_FUNCTION(F, std::F)
+#define RVEC_STD_KERNEL_UNARY_FUNCTION(F, KIND) RVEC_KERNEL_UNARY_FUNCTION(F, std::F, KIND)
 
-RVEC_STD_UNARY_FUNCTION(abs)
+RVEC_STD_KERNEL_UNARY_FUNCTION(abs, kAbs)
 RVEC_STD_BINARY_FUNCTION(fdim)
 RVEC_STD_BINARY_FUNCTION(fmod)
 RVEC_STD_BINARY_FUNCTION(remainder)
@@ -1807,7 +2116,7 @@ RVEC_STD_UNARY_FUNCTION(log2)
 RVEC_STD_UNARY_FUNCTION(log1p)
 
 RVEC_STD_BINARY_FUNCTION(pow)
-RVEC_STD_UNARY_FUNCTION(sqrt)
+RVEC_STD_KERNEL_UNARY_FUNCTION(sqrt, kSqrt)
 RVEC_STD_UNARY_FUNCTION(cbrt)
 RVEC_STD_BINARY_FUNCTION(hypot)
 
@@ -1826,9 +2135,9 @@ RVEC_STD_UNARY_FUNCTION(asinh)
 RVEC_STD_UNARY_FUNCTION(acosh)
 RVEC_STD_UNARY_FUNCTION(atanh)
 
-RVEC_STD_UNARY_FUNCTION(floor)
-RVEC_STD_UNARY_FUNCTION(ceil)
-RVEC_STD_UNARY_FUNCTION(trunc)
+RVEC_STD_KERNEL_UNARY_FUNCTION(floor, kFloor)
+RVEC_STD_KERNEL_UNARY_FUNCTION(ceil, kCeil)
+RVEC_STD_KERNEL_UNARY_FUNCTION(trunc, kTrunc)
 RVEC_STD_UNARY_FUNCTION(round)
 RVEC_STD_UNARY_FUNCTION(lround)
 RVEC_STD_UNARY_FUNCTION(llround)
@@ -1838,31 +2147,47 @@ RVEC_STD_UNARY_FUNCTION(erfc)
 RVEC_STD_UNARY_FUNCTION(lgamma)
 RVEC_STD_UNARY_FUNCTION(tgamma)
 #undef RVEC_STD_UNARY_FUNCTION
+#undef RVEC_STD_KERNEL_UNARY_FUNCTION
+#undef RVEC_KERNEL_UNARY_FUNCTION
 
 ///@}
 ///@name RVec Fast Mathematical Functions with Vdt
 ///@{
 
 #ifdef R__HAS_VDT
-#define RVEC_VDT_UNARY_FUNCTION(F) RVEC_UNARY_FUNCTION(F, vdt::F)
-
-RVEC_VDT_UNARY_FUNCTION(fast_expf)
-RVEC_VDT_UNARY_FUNCTION(fast_logf)
-RVEC_VDT_UNARY_FUNCTION(fast_sinf)
-RVEC_VDT_UNARY_FUNCTION(fast_cosf)
-RVEC_VDT_UNARY_FUNCTION(fast_tanf)
-RVEC_VDT_UNARY_FUNCTION(fast_asinf)
-RVEC_VDT_UNARY_FUNCTION(fast_acosf)
-RVEC_VDT_UNARY_FUNCTION(fast_atanf)
-
-RVEC_VDT_UNARY_FUNCTION(fast_exp)
-RVEC_VDT_UNARY_FUNCTION(fast_log)
-RVEC_VDT_UNARY_FUNCTION(fast_sin)
-RVEC_VDT_UNARY_FUNCTION(fast_cos)
-RVEC_VDT_UNARY_FUNCTION(fast_tan)
-RVEC_VDT_UNARY_FUNCTION(fast_asin)
-RVEC_VDT_UNARY_FUNCTION(fast_acos)
-RVEC_VDT_UNARY_FUNCTION(fast_atan)
+// Run FastMathKernel for RVec<T> (float for the single-precision functions, double for the others)
+#define RVEC_VDT_UNARY_FUNCTION(F, T_KERNEL, KIND)                             \
+   template <typename T>                                                       \
+   RVec<PromoteType<T>> F(const RVec<T> &v)                                    \
+   {                                                                           \
+      RVec<PromoteType<T>> ret(v.size());                                      \
+      if (ROOT::Internal::VecOps::RunFastMathKernel(                           \
+             std::is_same<T, T_KERNEL>{},                                      \
+             ROOT::Internal::VecOps::EFastMathOp::KIND, v.data(), ret.data(),  \
+             v.size()))                                                        \
+         return ret;                                                           \
+      auto f = [](const T &x) { return vdt::F(x); };                           \
+      std::transform(v.begin(), v.end(), ret.begin(), f);                      \
+      return ret;                                                              \
+   }
+
+RVEC_VDT_UNARY_FUNCTION(fast_expf, float, kExp)
+RVEC_VDT_UNARY_FUNCTION(fast_logf, float, kLog)
+RVEC_VDT_UNARY_FUNCTION(fast_sinf, float, kSin)
+RVEC_VDT_UNARY_FUNCTION(fast_cosf, float, kCos)
+RVEC_VDT_UNARY_FUNCTION(fast_tanf, float, kTan)
+RVEC_VDT_UNARY_FUNCTION(fast_asinf, float, kAsin)
+RVEC_VDT_UNARY_FUNCTION(fast_acosf, float, kAcos)
+RVEC_VDT_UNARY_FUNCTION(fast_atanf, float, kAtan)
+
+RVEC_VDT_UNARY_FUNCTION(fast_exp, double, kExp)
+RVEC_VDT_UNARY_FUNCTION(fast_log, double, kLog)
+RVEC_VDT_UNARY_FUNCTION(fast_sin, double, kSin)
+RVEC_VDT_UNARY_FUNCTION(fast_cos, double, kCos)
+RVEC_VDT_UNARY_FUNCTION(fast_tan, double, kTan)
+RVEC_VDT_UNARY_FUNCTION(fast_asin, double, kAsin)
+RVEC_VDT_UNARY_FUNCTION(fast_acos, double, kAcos)
+RVEC_VDT_UNARY_FUNCTION(fast_atan, double, kAtan)
 #undef RVEC_VDT_UNARY_FUNCTION
 
 #endif // R__HAS_VDT
@@ -1913,10 +2238,13 @@ auto Dot(const RVec<T> &v0, const RVec<V> &v1) -> decltype(v0[0] * v1[0])
 /// v_sum_lv
 /// // (ROOT::Math::LorentzVector<ROOT::Math::PtEtaPhiM4D<double> > &) (30.8489,2.46534,2.58947,361.084)
 /// ~~~
+///
+/// \note For RVec<float> and RVec<double> the elements are summed by several SIMD lanes in parallel, so the result
+/// can differ from a sequential sum in the last bits.
 template <typename T>
 T Sum(const RVec<T> &v, const T zero = T(0))
 {
-   return std::accumulate(v.begin(), v.end(), zero);
+   return ROOT::Internal::VecOps::SumImpl(ROOT::Internal::VecOps::IsKernelType<T>{}, v, zero);
 }
 
 inline std::size_t Sum(const RVec<bool> &v, std::size_t zero = 0ul)
@@ -2145,6 +2473,14 @@ template <typename T, typename F>
 RVec<T> Filter(const RVec<T> &v, F &&f)
 {
    const auto thisSize = v.size();
+   if (T *buf = ROOT::Internal::VecOps::AllocateTemporary<T>(thisSize)) {
+      std::size_t n = 0;
+      for (auto &&val : v) {
+         if (f(val))
+            new (buf + n++) T(val);
+      }
+      return RVec<T>(buf, n);
+   }
    RVec<T> w;
    w.reserve(thisSize);
    for (auto &&val : v) {
@@ -2303,7 +2639,7 @@ RVec<T> Take(const RVec<T> &v, const RVec<typename RVec<T>::size_type> &i)
 {
    using size_type = typename RVec<T>::size_type;
    const size_type isize = i.size();
-   RVec<T> r(isize);
+   auto r = ROOT::Internal::VecOps::MakeTemporary<T>(isize);
    for (size_type k = 0; k < isize; k++)
       r[k] = v[i[k]];
    return r;
@@ -2315,7 +2651,7 @@ RVec<T> Take(const RVec<T> &v, const RVec<typename RVec<T>::size_type> &i, const
 {
    using size_type = typename RVec<T>::size_type;
    const size_type isize = i.size();
-   RVec<T> r(isize);
+   auto r = ROOT::Internal::VecOps::MakeTemporary<T>(isize);
    for (size_type k = 0; k < isize; k++)
    {
       if (k < v.size()){
@@ -2352,7 +2688,7 @@ RVec<T> Take(const RVec<T> &v, const int n)
                        std::to_string(size) + " elements.";
       throw std::runtime_error(msg);
    }
-   RVec<T> r(absn);
+   auto r = ROOT::Internal::VecOps::MakeTemporary<T>(absn);
    if (n < 0) {
       for (size_type k = 0; k < absn; k++)
          r[k] = v[size - absn + k];
@@ -2443,7 +2779,7 @@ RVec<T> Drop(const RVec<T> &v, RVec<typename RVec<T>::size_type> idxs)
 template <typename T>
 RVec<T> Reverse(const RVec<T> &v)
 {
-   RVec<T> r(v);
+   auto r = ROOT::Internal::VecOps::CopyToTemporary(v);
    std::reverse(r.begin(), r.end());
    return r;
 }
@@ -2464,7 +2800,7 @@ RVec<T> Reverse(const RVec<T> &v)
 template <typename T>
 RVec<T> Sort(const RVec<T> &v)
 {
-   RVec<T> r(v);
+   auto r = ROOT::Internal::VecOps::CopyToTemporary(v);
    std::sort(r.begin(), r.end());
    return r;
 }
@@ -2489,7 +2825,7 @@ RVec<T> Sort(const RVec<T> &v)
 template <typename T, typename Compare>
 RVec<T> Sort(const RVec<T> &v, Compare &&c)
 {
-   RVec<T> r(v);
+   auto r = ROOT::Internal::VecOps::CopyToTemporary(v);
    std::sort(r.begin(), r.end(), std::forward<Compare>(c));
    return r;
 }
@@ -2513,7 +2849,7 @@ RVec<T> Sort(const RVec<T> &v, Compare &&c)
 template <typename T>
 RVec<T> StableSort(const RVec<T> &v)
 {
-   RVec<T> r(v);
+   auto r = ROOT::Internal::VecOps::CopyToTemporary(v);
    std::stable_sort(r.begin(), r.end());
    return r;
 }
@@ -2549,7 +2885,7 @@ RVec<T> StableSort(const RVec<T> &v)
 template <typename T, typename Compare>
 RVec<T> StableSort(const RVec<T> &v, Compare &&c)
 {
-   RVec<T> r(v);
+   auto r = ROOT::Internal::VecOps::CopyToTemporary(v);
    std::stable_sort(r.begin(), r.end(), std::forward<Compare>(c));
    return r;
 }
@@ -2570,8 +2906,8 @@ inline RVec<RVec<std::size_t>> Combinations(const std::size_t size1, const std::
 {
    using size_type = std::size_t;
    RVec<RVec<size_type>> r(2);
-   r[0].resize(size1*size2);
-   r[1].resize(size1*size2);
+   r[0] = ROOT::Internal::VecOps::MakeTemporary<size_type>(size1*size2);
+   r[1] = ROOT::Internal::VecOps::MakeTemporary<size_type>(size1*size2);
    size_type c = 0;
    for(size_type i=0; i<size1; i++) {
       for(size_type j=0; j<size2; j++) {
@@ -2649,7 +2985,9 @@ RVec<RVec<typename RVec<T>::size_type>> Combinations(const RVec<T>& v, const typ
       return inners;
    }();
 
-   RVec<RVec<size_type>> c(n, RVec<size_type>(innersize));
+   RVec<RVec<size_type>> c(n);
+   for (auto &inner : c)
+      inner = ROOT::Internal::VecOps::MakeTemporary<size_type>(innersize);
    size_type inneridx = 0;
    for (size_type k = 0; k < n; k++)
       c[k][inneridx] = indices[k];
@@ -2757,6 +3095,8 @@ RVec<T> Where(const RVec<int>& c, const RVec<T>& v1, const RVec<T>& v2)
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
    RVec<T> r;
+   if (ROOT::Internal::VecOps::RunWhereKernel(ROOT::Internal::VecOps::IsKernelType<T>{}, c.data(), v1.data(), v2.data(), r, size))
+      return r;
    r.reserve(size);
    for (size_type i=0; i<size; i++) {
       r.emplace_back(c[i] != 0 ? v1[i] : v2[i]);
@@ -2785,6 +3125,8 @@ RVec<T> Where(const RVec<int> &c, const RVec<T> &v1, typename RVec<T>::value_typ
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
    RVec<T> r;
+   if (ROOT::Internal::VecOps::RunWhereKernel(ROOT::Internal::VecOps::IsKernelType<T>{}, c.data(), v1.data(), v2, r, size))
+      return r;
    r.reserve(size);
    for (size_type i=0; i<size; i++) {
       r.emplace_back(c[i] != 0 ? v1[i] : v2);
@@ -2813,6 +3155,8 @@ RVec<T> Where(const RVec<int>& c, typename RVec<T>::value_type v1, const RVec<T>
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
    RVec<T> r;
+   if (ROOT::Internal::VecOps::RunWhereKernel(ROOT::Internal::VecOps::IsKernelType<T>{}, c.data(), v1, v2.data(), r, size))
+      return r;
    r.reserve(size);
    for (size_type i=0; i<size; i++) {
       r.emplace_back(c[i] != 0 ? v1 : v2[i]);
@@ -2839,6 +3183,8 @@ RVec<T> Where(const RVec<int>& c, T v1, T v2)
    using size_type = typename RVec<T>::size_type;
    const size_type size = c.size();
    RVec<T> r;
+   if (ROOT::Internal::VecOps::RunWhereKernel(ROOT::Internal::VecOps::IsKernelType<T>{}, c.data(), v1, v2, r, size))
+      return r;
    r.reserve(size);
    for (size_type i=0; i<size; i++) {
       r.emplace_back(c[i] != 0 ? v1 : v2);
@@ -2951,6 +3297,10 @@ RVec<T> DeltaPhi(T v1, const RVec<T>& v2, const T c = M_PI)
 template <typename T>
 RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
+   RVec<T> r;
+   if (ROOT::Internal::VecOps::RunDeltaRKernel(ROOT::Internal::VecOps::IsKernelType<T>{}, eta1, eta2, phi1, phi2, c, r,
+                                               /*squared=*/true))
+      return r;
    const auto dphi = DeltaPhi(phi1, phi2, c);
    return (eta1 - eta2) * (eta1 - eta2) + dphi * dphi;
 }
@@ -2965,6 +3315,10 @@ RVec<T> DeltaR2(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, c
 template <typename T>
 RVec<T> DeltaR(const RVec<T>& eta1, const RVec<T>& eta2, const RVec<T>& phi1, const RVec<T>& phi2, const T c = M_PI)
 {
+   RVec<T> r;
+   if (ROOT::Internal::VecOps::RunDeltaRKernel(ROOT::Internal::VecOps::IsKernelType<T>{}, eta1, eta2, phi1, phi2, c, r,
+                                               /*squared=*/false))
+      return r;
    return sqrt(DeltaR2(eta1, eta2, phi1, phi2, c));
 }
 
@@ -2997,7 +3351,11 @@ RVec<T> InvariantMasses(
    R__ASSERT(eta1.size() == size && phi1.size() == size && mass1.size() == size);
    R__ASSERT(pt2.size() == size && phi2.size() == size && mass2.size() == size);
 
-   RVec<T> inv_masses(size);
+   RVec<T> inv_masses;
+   if (ROOT::Internal::VecOps::RunInvariantMassesKernel(ROOT::Internal::VecOps::IsKernelType<T>{}, pt1, eta1, phi1,
+                                                        mass1, pt2, eta2, phi2, mass2, inv_masses))
+      return inv_masses;
+   inv_masses.resize(size);
 
    for (std::size_t i = 0u; i < size; ++i) {
       // Conversion from (pt, eta, phi, mass) to (x, y, z, e) coordinate system
@@ -3358,4 +3716,6 @@ using RVecULL = ROOT::VecOps::RVec<unsigned long long int>;
 
 } // End of ROOT NS
 
+#include <ROOT/RVecExpr.hxx>
+
 #endif // ROOT_RVEC
@@ -0,0 +1,86 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVECARENA
+#define ROOT_RVECARENA
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace VecOps {
+
+/**
+\class ROOT::Internal::VecOps::RVecArena
+\brief A bump allocator for the buffers of short-lived RVecs.
+
+While an arena is the current arena of a thread (see SetCurrent()), the RVec helpers that create a new collection
+(Filter(), Take(), Sort(), StableSort(), Reverse(), Combinations() and indexing with a mask) place the elements of
+their result in it instead of allocating them on the heap, as long as the elements are trivially destructible and do
+not fit in the inline storage of the result. The result adopts the arena memory (see
+ROOT::Detail::VecOps::IsAdopting()): it is only valid until the next call to Reset(), and growing it moves its elements
+to the heap as usual.
+
+Memory is served from blocks that are kept across calls to Reset(). When a Reset() follows allocations that spanned
+more than one block, the blocks are merged into a single one, so that after a few resets all allocations are served
+without calling the heap allocator.
+
+RDataFrame gives one arena to each processing slot and resets it at every entry, see
+ROOT::Internal::RDF::EnableRVecArena().
+*/
+class RVecArena {
+   struct RBlock {
+      std::unique_ptr<char[]> fData;
+      std::size_t fSize;
+   };
+
+   std::vector<RBlock> fBlocks; ///< Never empty. Allocations are served from the last block.
+   std::uintptr_t fNext = 0; ///< Address of the first free byte of the last block
+   std::uintptr_t fEnd = 0;  ///< Address of the end of the last block
+
+   void *AllocateSlow(std::size_t size, std::size_t alignment);
+   void AddBlock(std::size_t size);
+
+public:
+   static constexpr std::size_t kDefaultBlockSize = 64 * 1024;
+
+   explicit RVecArena(std::size_t blockSize = kDefaultBlockSize);
+   RVecArena(const RVecArena &) = delete;
+   RVecArena &operator=(const RVecArena &) = delete;
+
+   /// Return `size` bytes of memory aligned to `alignment`, which must be a power of two
+   void *Allocate(std::size_t size, std::size_t alignment)
+   {
+      const auto begin = (fNext + alignment - 1) & ~(alignment - 1);
+      if (begin + size <= fEnd && begin >= fNext) {
+         fNext = begin + size;
+         return reinterpret_cast<void *>(begin);
+      }
+      return AllocateSlow(size, alignment);
+   }
+
+   /// Make all the memory of the arena available again: the memory handed out so far must not be used anymore
+   void Reset();
+
+   /// The total size of the blocks of the arena, in bytes
+   std::size_t GetCapacity() const;
+
+   /// The arena used by the RVec helpers called by this thread, nullptr if they should use the heap
+   static RVecArena *GetCurrent();
+   /// Make `arena` the arena used by the RVec helpers called by this thread (nullptr to use the heap)
+   static void SetCurrent(RVecArena *arena);
+};
+
+} // namespace VecOps
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RVECARENA
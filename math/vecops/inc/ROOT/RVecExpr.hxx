@@ -0,0 +1,626 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RVECEXPR
+#define ROOT_RVECEXPR
+
+#include <ROOT/RVec.hxx>
+
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ROOT {
+
+namespace VecOps {
+template <typename Node>
+class RVecExpr;
+}
+
+namespace Internal {
+namespace VecOps {
+
+template <typename>
+struct IsRVecExpr : std::false_type {};
+
+template <typename Node>
+struct IsRVecExpr<ROOT::VecOps::RVecExpr<Node>> : std::true_type {};
+
+/// The type of the values that RDataFrame stores for a Define whose expression returns T: RVec expressions are
+/// materialized into RVecs
+template <typename T>
+struct MaterializedType {
+   using type = T;
+};
+
+template <typename Node>
+struct MaterializedType<ROOT::VecOps::RVecExpr<Node>> {
+   using type = RVec<typename ROOT::VecOps::RVecExpr<Node>::value_type>;
+};
+
+template <typename T>
+using MaterializedType_t = typename MaterializedType<T>::type;
+
+/// An expression leaf that refers to the elements of an RVec, which must outlive the expression
+template <typename T>
+class RVecViewNode {
+   const T *fData;
+   std::size_t fSize;
+
+public:
+   using value_type = T;
+   static constexpr bool kIsSized = true;
+
+   explicit RVecViewNode(const RVec<T> &v) : fData(v.data()), fSize(v.size()) {}
+   std::size_t size() const { return fSize; }
+   const T &operator[](std::size_t i) const { return fData[i]; }
+};
+
+/// An expression leaf that owns an RVec that was a temporary when the expression was built
+template <typename T>
+class RVecValueNode {
+   RVec<T> fVec;
+
+public:
+   using value_type = T;
+   static constexpr bool kIsSized = true;
+
+   explicit RVecValueNode(RVec<T> &&v) : fVec(std::move(v)) {}
+   std::size_t size() const { return fVec.size(); }
+   const T &operator[](std::size_t i) const { return fVec[i]; }
+};
+
+/// An expression leaf that has the same value for all elements
+template <typename T>
+class RScalarNode {
+   T fValue;
+
+public:
+   using value_type = T;
+   static constexpr bool kIsSized = false;
+
+   explicit RScalarNode(const T &value) : fValue(value) {}
+   std::size_t size() const { return 0; }
+   const T &operator[](std::size_t) const { return fValue; }
+};
+
+/// An expression node that applies the function object F to the elements with the same index of its operands. All
+/// operands that are not scalars must have the same size.
+template <typename F, typename... Args>
+class RMapNode {
+   std::tuple<Args...> fArgs;
+   std::size_t fSize = 0;
+
+   template <std::size_t... Is>
+   decltype(auto) Get(std::size_t i, std::index_sequence<Is...>) const
+   {
+      return F{}(std::get<Is>(fArgs)[i]...);
+   }
+
+   template <std::size_t... Is>
+   void CheckSizes(const char *name, std::index_sequence<Is...>)
+   {
+      const bool isSized[] = {Args::kIsSized...};
+      const std::size_t sizes[] = {std::get<Is>(fArgs).size()...};
+      bool sizeIsSet = false;
+      for (std::size_t i = 0; i < sizeof...(Args); ++i) {
+         if (!isSized[i])
+            continue;
+         if (sizeIsSet && sizes[i] != fSize)
+            throw std::runtime_error(std::string("Cannot call operator ") + name + " on vectors of different sizes.");
+         fSize = sizes[i];
+         sizeIsSet = true;
+      }
+   }
+
+public:
+   using value_type = std::decay_t<decltype(F{}(std::declval<const Args &>()[0]...))>;
+   static constexpr bool kIsSized = true;
+
+   RMapNode(const char *name, Args... args) : fArgs(std::move(args)...)
+   {
+      CheckSizes(name, std::index_sequence_for<Args...>{});
+   }
+
+   std::size_t size() const { return fSize; }
+   value_type operator[](std::size_t i) const { return Get(i, std::index_sequence_for<Args...>{}); }
+};
+
+/// \name Conversion of the operands of RVec expressions to expression nodes
+///@{
+template <typename Node>
+Node ToNode(ROOT::VecOps::RVecExpr<Node> &&e)
+{
+   return std::move(e).GetNode();
+}
+
+template <typename Node>
+Node ToNode(const ROOT::VecOps::RVecExpr<Node> &e)
+{
+   return e.GetNode();
+}
+
+template <typename T>
+RVecViewNode<T> ToNode(const RVec<T> &v)
+{
+   return RVecViewNode<T>(v);
+}
+
+template <typename T>
+RVecValueNode<T> ToNode(RVec<T> &&v)
+{
+   return RVecValueNode<T>(std::move(v));
+}
+
+template <typename T>
+RScalarNode<T> ToNode(const T &x)
+{
+   return RScalarNode<T>(x);
+}
+///@}
+
+// The function objects applied by the RVecExpr operators and functions
+#define RVEC_EXPR_BINARY_FUNCTOR(OP, FUNC)                                                                            \
+   struct FUNC {                                                                                                      \
+      template <typename T0, typename T1>                                                                             \
+      auto operator()(const T0 &x, const T1 &y) const -> decltype(x OP y)                                             \
+      {                                                                                                               \
+         return x OP y;                                                                                               \
+      }                                                                                                               \
+   };
+
+// As for RVecs, comparisons and logical operators return int rather than bool
+#define RVEC_EXPR_LOGICAL_FUNCTOR(OP, FUNC)                                                                           \
+   struct FUNC {                                                                                                      \
+      template <typename T0, typename T1>                                                                             \
+      int operator()(const T0 &x, const T1 &y) const                                                                  \
+      {                                                                                                               \
+         return x OP y;                                                                                               \
+      }                                                                                                               \
+   };
+
+#define RVEC_EXPR_UNARY_FUNCTOR(OP, FUNC)                                                                             \
+   struct FUNC {                                                                                                      \
+      template <typename T>                                                                                           \
+      T operator()(const T &x) const                                                                                  \
+      {                                                                                                               \
+         return OP x;                                                                                                 \
+      }                                                                                                               \
+   };
+
+#define RVEC_EXPR_STD_UNARY_FUNCTOR(F)                                                                                \
+   struct RExpr_##F {                                                                                                 \
+      template <typename T>                                                                                           \
+      ROOT::VecOps::PromoteType<T> operator()(const T &x) const                                                       \
+      {                                                                                                               \
+         return std::F(x);                                                                                            \
+      }                                                                                                               \
+   };
+
+#define RVEC_EXPR_STD_BINARY_FUNCTOR(F)                                                                               \
+   struct RExpr_##F {                                                                                                 \
+      template <typename T0, typename T1>                                                                             \
+      ROOT::VecOps::PromoteTypes<T0, T1> operator()(const T0 &x, const T1 &y) const                                   \
+      {                                                                                                               \
+         return std::F(x, y);                                                                                         \
+      }                                                                                                               \
+   };
+
+RVEC_EXPR_BINARY_FUNCTOR(+, RExprPlus)
+RVEC_EXPR_BINARY_FUNCTOR(-, RExprMinus)
+RVEC_EXPR_BINARY_FUNCTOR(*, RExprMultiplies)
+RVEC_EXPR_BINARY_FUNCTOR(/, RExprDivides)
+RVEC_EXPR_BINARY_FUNCTOR(%, RExprModulus)
+RVEC_EXPR_BINARY_FUNCTOR(^, RExprBitXor)
+RVEC_EXPR_BINARY_FUNCTOR(|, RExprBitOr)
+RVEC_EXPR_BINARY_FUNCTOR(&, RExprBitAnd)
+
+RVEC_EXPR_LOGICAL_FUNCTOR(<, RExprLess)
+RVEC_EXPR_LOGICAL_FUNCTOR(>, RExprGreater)
+RVEC_EXPR_LOGICAL_FUNCTOR(==, RExprEqual)
+RVEC_EXPR_LOGICAL_FUNCTOR(!=, RExprNotEqual)
+RVEC_EXPR_LOGICAL_FUNCTOR(<=, RExprLessEqual)
+RVEC_EXPR_LOGICAL_FUNCTOR(>=, RExprGreaterEqual)
+RVEC_EXPR_LOGICAL_FUNCTOR(&&, RExprLogicalAnd)
+RVEC_EXPR_LOGICAL_FUNCTOR(||, RExprLogicalOr)
+
+RVEC_EXPR_UNARY_FUNCTOR(+, RExprUnaryPlus)
+RVEC_EXPR_UNARY_FUNCTOR(-, RExprNegate)
+RVEC_EXPR_UNARY_FUNCTOR(~, RExprBitNot)
+RVEC_EXPR_UNARY_FUNCTOR(!, RExprLogicalNot)
+
+RVEC_EXPR_STD_UNARY_FUNCTOR(abs)
+RVEC_EXPR_STD_BINARY_FUNCTOR(fdim)
+RVEC_EXPR_STD_BINARY_FUNCTOR(fmod)
+RVEC_EXPR_STD_BINARY_FUNCTOR(remainder)
+
+RVEC_EXPR_STD_UNARY_FUNCTOR(exp)
+RVEC_EXPR_STD_UNARY_FUNCTOR(exp2)
+RVEC_EXPR_STD_UNARY_FUNCTOR(expm1)
+
+RVEC_EXPR_STD_UNARY_FUNCTOR(log)
+RVEC_EXPR_STD_UNARY_FUNCTOR(log10)
+RVEC_EXPR_STD_UNARY_FUNCTOR(log2)
+RVEC_EXPR_STD_UNARY_FUNCTOR(log1p)
+
+RVEC_EXPR_STD_BINARY_FUNCTOR(pow)
+RVEC_EXPR_STD_UNARY_FUNCTOR(sqrt)
+RVEC_EXPR_STD_UNARY_FUNCTOR(cbrt)
+RVEC_EXPR_STD_BINARY_FUNCTOR(hypot)
+
+RVEC_EXPR_STD_UNARY_FUNCTOR(sin)
+RVEC_EXPR_STD_UNARY_FUNCTOR(cos)
+RVEC_EXPR_STD_UNARY_FUNCTOR(tan)
+RVEC_EXPR_STD_UNARY_FUNCTOR(asin)
+RVEC_EXPR_STD_UNARY_FUNCTOR(acos)
+RVEC_EXPR_STD_UNARY_FUNCTOR(atan)
+RVEC_EXPR_STD_BINARY_FUNCTOR(atan2)
+
+RVEC_EXPR_STD_UNARY_FUNCTOR(sinh)
+RVEC_EXPR_STD_UNARY_FUNCTOR(cosh)
+RVEC_EXPR_STD_UNARY_FUNCTOR(tanh)
+RVEC_EXPR_STD_UNARY_FUNCTOR(asinh)
+RVEC_EXPR_STD_UNARY_FUNCTOR(acosh)
+RVEC_EXPR_STD_UNARY_FUNCTOR(atanh)
+
+RVEC_EXPR_STD_UNARY_FUNCTOR(floor)
+RVEC_EXPR_STD_UNARY_FUNCTOR(ceil)
+RVEC_EXPR_STD_UNARY_FUNCTOR(trunc)
+RVEC_EXPR_STD_UNARY_FUNCTOR(round)
+RVEC_EXPR_STD_UNARY_FUNCTOR(lround)
+RVEC_EXPR_STD_UNARY_FUNCTOR(llround)
+
+RVEC_EXPR_STD_UNARY_FUNCTOR(erf)
+RVEC_EXPR_STD_UNARY_FUNCTOR(erfc)
+RVEC_EXPR_STD_UNARY_FUNCTOR(lgamma)
+RVEC_EXPR_STD_UNARY_FUNCTOR(tgamma)
+
+#undef RVEC_EXPR_STD_BINARY_FUNCTOR
+#undef RVEC_EXPR_STD_UNARY_FUNCTOR
+#undef RVEC_EXPR_UNARY_FUNCTOR
+#undef RVEC_EXPR_LOGICAL_FUNCTOR
+#undef RVEC_EXPR_BINARY_FUNCTOR
+
+/// Return the expression that applies F to the elements of `args`, which can be RVec expressions, RVecs and scalars
+template <typename F, typename... Args>
+auto MakeExpr(const char *name, Args &&...args)
+{
+   using Node_t = RMapNode<F, decltype(ToNode(std::forward<Args>(args)))...>;
+   return ROOT::VecOps::RVecExpr<Node_t>(Node_t(name, ToNode(std::forward<Args>(args))...));
+}
+
+} // namespace VecOps
+} // namespace Internal
+
+namespace VecOps {
+
+/**
+\class ROOT::VecOps::RVecExpr
+\brief A lazily evaluated RVec operation.
+
+Arithmetic, comparison and logical operators, as well as the mathematical functions of RVec, return an RVecExpr
+rather than an RVec when one of their operands is an RVecExpr. The whole chain of operations is evaluated in a single
+pass over the elements, without intermediate RVecs, when the expression is converted to an RVec (e.g. assigned to
+one), indexed with a mask or reduced with Sum(), Any() or All(). Lazy() starts an expression:
+~~~{.cpp}
+using namespace ROOT::VecOps;
+RVecF px{1.f, 30.f, 4.f}, py{2.f, 40.f, 3.f}, pt{10.f, 50.f, 25.f};
+RVecF r = sqrt(Lazy(px) * px + py * py)[Lazy(pt) > 20];
+// r == { 50, 5 }
+~~~
+
+An expression refers to the RVecs it is built from, which must not be modified or destroyed before it is evaluated.
+Temporary RVecs (e.g. the result of a function call) are moved into the expression. Expressions should therefore not
+be stored in `auto` variables that outlive their inputs. The values of RDataFrame Defines, jitted or not, that return
+an RVecExpr are materialized into RVecs.
+*/
+template <typename Node>
+class RVecExpr {
+   Node fNode;
+
+public:
+   using value_type = typename Node::value_type;
+
+   explicit RVecExpr(Node node) : fNode(std::move(node)) {}
+
+   std::size_t size() const { return fNode.size(); }
+   bool empty() const { return size() == 0; }
+   /// Evaluate the element at index `i` of the expression
+   value_type operator[](std::size_t i) const { return fNode[i]; }
+
+   const Node &GetNode() const & { return fNode; }
+   Node GetNode() && { return std::move(fNode); }
+
+   /// Evaluate all the elements of the expression in a single pass
+   template <typename U = value_type>
+   RVec<U> Materialize() const
+   {
+      RVec<U> ret;
+      MaterializeInto(ret);
+      return ret;
+   }
+
+   /// Evaluate all the elements of the expression into `out`, which is resized to the size of the expression and
+   /// must not be one of its operands
+   template <typename U>
+   void MaterializeInto(RVec<U> &out) const
+   {
+      const auto n = size();
+      out.resize(n);
+      U *data = out.data();
+      for (std::size_t i = 0; i < n; ++i)
+         data[i] = fNode[i];
+   }
+
+   template <typename U, typename = std::enable_if_t<std::is_convertible<value_type, U>::value>>
+   operator RVec<U>() const
+   {
+      return Materialize<U>();
+   }
+
+   /// Evaluate the elements for which `conds` is true, see RVec::operator[](const RVec<V> &)
+   template <typename V>
+   RVec<value_type> operator[](const RVec<V> &conds) const
+   {
+      return Select(ROOT::Internal::VecOps::RVecViewNode<V>(conds));
+   }
+
+   template <typename MaskNode>
+   RVec<value_type> operator[](const RVecExpr<MaskNode> &conds) const
+   {
+      return Select(conds.GetNode());
+   }
+
+private:
+   template <typename MaskNode>
+   RVec<value_type> Select(const MaskNode &conds) const
+   {
+      const auto n = size();
+      if (conds.size() != n) {
+         throw std::runtime_error("Cannot index RVecExpr of size " + std::to_string(n) +
+                                  " with condition vector of different size (" + std::to_string(conds.size()) + ").");
+      }
+
+      std::size_t nTrue = 0;
+      for (std::size_t i = 0; i < n; ++i)
+         nTrue += bool(conds[i]);
+
+      if (value_type *buf = ROOT::Internal::VecOps::AllocateTemporary<value_type>(nTrue)) {
+         std::size_t j = 0;
+         for (std::size_t i = 0; i < n; ++i) {
+            if (conds[i])
+               new (buf + j++) value_type(fNode[i]);
+         }
+         return RVec<value_type>(buf, nTrue);
+      }
+
+      RVec<value_type> ret;
+      ret.reserve(nTrue);
+      for (std::size_t i = 0; i < n; ++i) {
+         if (conds[i])
+            ret.push_back(fNode[i]);
+      }
+      return ret;
+   }
+};
+
+/// Return an expression whose elements are those of `v`, to evaluate a chain of operations on `v` lazily (see
+/// RVecExpr). `v` must outlive the expression.
+template <typename T>
+RVecExpr<ROOT::Internal::VecOps::RVecViewNode<T>> Lazy(const RVec<T> &v)
+{
+   return RVecExpr<ROOT::Internal::VecOps::RVecViewNode<T>>(ROOT::Internal::VecOps::RVecViewNode<T>(v));
+}
+
+/// Return an expression that owns `v`, to evaluate a chain of operations on `v` lazily (see RVecExpr)
+template <typename T>
+RVecExpr<ROOT::Internal::VecOps::RVecValueNode<T>> Lazy(RVec<T> &&v)
+{
+   return RVecExpr<ROOT::Internal::VecOps::RVecValueNode<T>>(ROOT::Internal::VecOps::RVecValueNode<T>(std::move(v)));
+}
+
+template <typename Node>
+RVecExpr<Node> Lazy(RVecExpr<Node> e)
+{
+   return e;
+}
+
+///@name RVecExpr operators and functions
+/// They have the same semantics as the corresponding RVec operators and functions, but return an RVecExpr.
+///@{
+
+// The overloads taking an RVecExpr by value are more specialized than the RVec ones taking a `const T &`, which lets
+// them win overload resolution when the other operand is an RVec. The expressions passed as temporaries are moved.
+#define RVEC_EXPR_BINARY_OVERLOADS(NAME, FUNC, OPNAME)                                                                \
+   template <typename Node, typename U>                                                                               \
+   auto NAME(RVecExpr<Node> e, const U &y)                                                                            \
+   {                                                                                                                  \
+      return ROOT::Internal::VecOps::MakeExpr<ROOT::Internal::VecOps::FUNC>(OPNAME, std::move(e), y);                 \
+   }                                                                                                                  \
+                                                                                                                      \
+   template <typename U, typename Node>                                                                               \
+   auto NAME(const U &x, RVecExpr<Node> e)                                                                            \
+   {                                                                                                                  \
+      return ROOT::Internal::VecOps::MakeExpr<ROOT::Internal::VecOps::FUNC>(OPNAME, x, std::move(e));                 \
+   }                                                                                                                  \
+                                                                                                                      \
+   template <typename Node0, typename Node1>                                                                          \
+   auto NAME(RVecExpr<Node0> e0, RVecExpr<Node1> e1)                                                                  \
+   {                                                                                                                  \
+      return ROOT::Internal::VecOps::MakeExpr<ROOT::Internal::VecOps::FUNC>(OPNAME, std::move(e0), std::move(e1));    \
+   }                                                                                                                  \
+                                                                                                                      \
+   template <typename Node, typename T>                                                                               \
+   auto NAME(RVecExpr<Node> e, const RVec<T> &v)                                                                      \
+   {                                                                                                                  \
+      return ROOT::Internal::VecOps::MakeExpr<ROOT::Internal::VecOps::FUNC>(OPNAME, std::move(e), v);                 \
+   }                                                                                                                  \
+                                                                                                                      \
+   template <typename Node, typename T>                                                                               \
+   auto NAME(RVecExpr<Node> e, RVec<T> &&v)                                                                           \
+   {                                                                                                                  \
+      return ROOT::Internal::VecOps::MakeExpr<ROOT::Internal::VecOps::FUNC>(OPNAME, std::move(e), std::move(v));      \
+   }                                                                                                                  \
+                                                                                                                      \
+   template <typename T, typename Node>                                                                               \
+   auto NAME(const RVec<T> &v, RVecExpr<Node> e)                                                                      \
+   {                                                                                                                  \
+      return ROOT::Internal::VecOps::MakeExpr<ROOT::Internal::VecOps::FUNC>(OPNAME, v, std::move(e));                 \
+   }                                                                                                                  \
+                                                                                                                      \
+   template <typename T, typename Node>                                                                               \
+   auto NAME(RVec<T> &&v, RVecExpr<Node> e)                                                                           \
+   {                                                                                                                  \
+      return ROOT::Internal::VecOps::MakeExpr<ROOT::Internal::VecOps::FUNC>(OPNAME, std::move(v), std::move(e));      \
+   }
+
+#define RVEC_EXPR_BINARY_OPERATOR(OP, FUNC)                                                                           \
+   RVEC_EXPR_BINARY_OVERLOADS(operator OP, FUNC, #OP)
+
+#define RVEC_EXPR_UNARY_OPERATOR(OP, FUNC)                                                                            \
+   template <typename Node>                                                                                           \
+   auto operator OP(RVecExpr<Node> e)                                                                                 \
+   {                                                                                                                  \
+      return ROOT::Internal::VecOps::MakeExpr<ROOT::Internal::VecOps::FUNC>(#OP, std::move(e));                       \
+   }
+
+#define RVEC_EXPR_STD_UNARY_FUNCTION(F)                                                                               \
+   template <typename Node>                                                                                           \
+   auto F(RVecExpr<Node> e)                                                                                           \
+   {                                                                                                                  \
+      return ROOT::Internal::VecOps::MakeExpr<ROOT::Internal::VecOps::RExpr_##F>(#F, std::move(e));                   \
+   }
+
+#define RVEC_EXPR_STD_BINARY_FUNCTION(F)                                                                              \
+   RVEC_EXPR_BINARY_OVERLOADS(F, RExpr_##F, #F)
+
+RVEC_EXPR_BINARY_OPERATOR(+, RExprPlus)
+RVEC_EXPR_BINARY_OPERATOR(-, RExprMinus)
+RVEC_EXPR_BINARY_OPERATOR(*, RExprMultiplies)
+RVEC_EXPR_BINARY_OPERATOR(/, RExprDivides)
+RVEC_EXPR_BINARY_OPERATOR(%, RExprModulus)
+RVEC_EXPR_BINARY_OPERATOR(^, RExprBitXor)
+RVEC_EXPR_BINARY_OPERATOR(|, RExprBitOr)
+RVEC_EXPR_BINARY_OPERATOR(&, RExprBitAnd)
+
+RVEC_EXPR_BINARY_OPERATOR(<, RExprLess)
+RVEC_EXPR_BINARY_OPERATOR(>, RExprGreater)
+RVEC_EXPR_BINARY_OPERATOR(==, RExprEqual)
+RVEC_EXPR_BINARY_OPERATOR(!=, RExprNotEqual)
+RVEC_EXPR_BINARY_OPERATOR(<=, RExprLessEqual)
+RVEC_EXPR_BINARY_OPERATOR(>=, RExprGreaterEqual)
+RVEC_EXPR_BINARY_OPERATOR(&&, RExprLogicalAnd)
+RVEC_EXPR_BINARY_OPERATOR(||, RExprLogicalOr)
+
+RVEC_EXPR_UNARY_OPERATOR(+, RExprUnaryPlus)
+RVEC_EXPR_UNARY_OPERATOR(-, RExprNegate)
+RVEC_EXPR_UNARY_OPERATOR(~, RExprBitNot)
+RVEC_EXPR_UNARY_OPERATOR(!, RExprLogicalNot)
+
+RVEC_EXPR_STD_UNARY_FUNCTION(abs)
+RVEC_EXPR_STD_BINARY_FUNCTION(fdim)
+RVEC_EXPR_STD_BINARY_FUNCTION(fmod)
+RVEC_EXPR_STD_BINARY_FUNCTION(remainder)
+
+RVEC_EXPR_STD_UNARY_FUNCTION(exp)
+RVEC_EXPR_STD_UNARY_FUNCTION(exp2)
+RVEC_EXPR_STD_UNARY_FUNCTION(expm1)
+
+RVEC_EXPR_STD_UNARY_FUNCTION(log)
+RVEC_EXPR_STD_UNARY_FUNCTION(log10)
+RVEC_EXPR_STD_UNARY_FUNCTION(log2)
+RVEC_EXPR_STD_UNARY_FUNCTION(log1p)
+
+RVEC_EXPR_STD_BINARY_FUNCTION(pow)
+RVEC_EXPR_STD_UNARY_FUNCTION(sqrt)
+RVEC_EXPR_STD_UNARY_FUNCTION(cbrt)
+RVEC_EXPR_STD_BINARY_FUNCTION(hypot)
+
+RVEC_EXPR_STD_UNARY_FUNCTION(sin)
+RVEC_EXPR_STD_UNARY_FUNCTION(cos)
+RVEC_EXPR_STD_UNARY_FUNCTION(tan)
+RVEC_EXPR_STD_UNARY_FUNCTION(asin)
+RVEC_EXPR_STD_UNARY_FUNCTION(acos)
+RVEC_EXPR_STD_UNARY_FUNCTION(atan)
+RVEC_EXPR_STD_BINARY_FUNCTION(atan2)
+
+RVEC_EXPR_STD_UNARY_FUNCTION(sinh)
+RVEC_EXPR_STD_UNARY_FUNCTION(cosh)
+RVEC_EXPR_STD_UNARY_FUNCTION(tanh)
+RVEC_EXPR_STD_UNARY_FUNCTION(asinh)
+RVEC_EXPR_STD_UNARY_FUNCTION(acosh)
+RVEC_EXPR_STD_UNARY_FUNCTION(atanh)
+
+RVEC_EXPR_STD_UNARY_FUNCTION(floor)
+RVEC_EXPR_STD_UNARY_FUNCTION(ceil)
+RVEC_EXPR_STD_UNARY_FUNCTION(trunc)
+RVEC_EXPR_STD_UNARY_FUNCTION(round)
+RVEC_EXPR_STD_UNARY_FUNCTION(lround)
+RVEC_EXPR_STD_UNARY_FUNCTION(llround)
+
+RVEC_EXPR_STD_UNARY_FUNCTION(erf)
+RVEC_EXPR_STD_UNARY_FUNCTION(erfc)
+RVEC_EXPR_STD_UNARY_FUNCTION(lgamma)
+RVEC_EXPR_STD_UNARY_FUNCTION(tgamma)
+
+#undef RVEC_EXPR_STD_BINARY_FUNCTION
+#undef RVEC_EXPR_STD_UNARY_FUNCTION
+#undef RVEC_EXPR_UNARY_OPERATOR
+#undef RVEC_EXPR_BINARY_OPERATOR
+#undef RVEC_EXPR_BINARY_OVERLOADS
+
+/// Sum the elements of the expression, without materializing it, see Sum(const RVec<T> &, const T)
+template <typename Node, typename T = typename RVecExpr<Node>::value_type>
+T Sum(const RVecExpr<Node> &e, const T zero = T(0))
+{
+   T sum = zero;
+   const auto n = e.size();
+   for (std::size_t i = 0; i < n; ++i)
+      sum += e[i];
+   return sum;
+}
+
+/// Return true if any of the elements of the expression is true, evaluating only the elements before the first one
+template <typename Node>
+bool Any(const RVecExpr<Node> &e)
+{
+   const auto n = e.size();
+   for (std::size_t i = 0; i < n; ++i)
+      if (e[i])
+         return true;
+   return false;
+}
+
+/// Return true if all the elements of the expression are true, evaluating only the elements before the first false
+template <typename Node>
+bool All(const RVecExpr<Node> &e)
+{
+   const auto n = e.size();
+   for (std::size_t i = 0; i < n; ++i)
+      if (!e[i])
+         return false;
+   return true;
+}
+
+///@}
+
+template <typename Node>
+std::ostream &operator<<(std::ostream &os, const RVecExpr<Node> &e)
+{
+   return os << e.Materialize();
+}
+
+} // namespace VecOps
+} // namespace ROOT
+
+#endif // ROOT_RVECEXPR
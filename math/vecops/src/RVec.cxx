@@ -11,6 +11,18 @@
  *************************************************************************/
 
 #include "ROOT/RVec.hxx"
+
+#include <algorithm>
+#include <cmath>
+
+#if __has_include(<experimental/simd>)
+#include <experimental/simd>
+#endif
+
+#ifdef __cpp_lib_experimental_parallel_simd
+#define R__RVEC_USE_SIMD
+#endif
+
 using namespace ROOT::VecOps;
 
 // Check that no bytes are wasted and everything is well-aligned.
@@ -84,6 +96,364 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    this->fCapacity = NewCapacity;
 }
 
+// Explicitly vectorized kernels, see RVec.hxx.
+// The kernels process SIMD packs of values with std::experimental::simd, if available, and the remaining elements
+// one at a time. They perform the same operations as the generic loops, in the same order, except for SumKernel which
+// adds the elements in several lanes in parallel.
+
+namespace {
+
+using ROOT::Internal::VecOps::EKernelOp;
+
+#ifdef R__RVEC_USE_SIMD
+namespace stdx = std::experimental;
+
+template <typename T>
+using Pack_t = stdx::native_simd<T>;
+
+template <typename T>
+constexpr std::size_t kPackSize = Pack_t<T>::size();
+
+template <typename T>
+Pack_t<T> LoadPack(const T *x, std::size_t i)
+{
+   return Pack_t<T>(x + i, stdx::element_aligned);
+}
+
+/// Broadcast a scalar argument to all the lanes of a pack
+template <typename T>
+Pack_t<T> LoadPack(T x, std::size_t)
+{
+   return Pack_t<T>(x);
+}
+
+template <typename T, typename Abi>
+void StorePack(const stdx::simd<T, Abi> &x, T *out)
+{
+   x.copy_to(out, stdx::element_aligned);
+}
+
+/// Store the result of a comparison as 0 or 1 per element, like the generic comparison operators do
+template <typename T, typename Abi>
+void StorePack(const stdx::simd_mask<T, Abi> &mask, int *out)
+{
+   for (std::size_t i = 0; i < mask.size(); ++i)
+      out[i] = mask[i];
+}
+#endif
+
+template <typename T>
+T Load(const T *x, std::size_t i)
+{
+   return x[i];
+}
+
+template <typename T>
+T Load(T x, std::size_t)
+{
+   return x;
+}
+
+/// Compute out[i] = f(args[i]...) for i in [0, n). The arguments are arrays of n values of type T or scalars of type
+/// T. f is called with SIMD packs of values for as many elements as possible, then with single values.
+/// out can be one of the arguments.
+template <typename T, typename R, typename F, typename... Args>
+void Transform(R *out, std::size_t n, F &&f, const Args &...args)
+{
+   std::size_t i = 0;
+#ifdef R__RVEC_USE_SIMD
+   for (; i + kPackSize<T> <= n; i += kPackSize<T>)
+      StorePack(f(LoadPack<T>(args, i)...), out + i);
+#endif
+   for (; i < n; ++i)
+      out[i] = f(Load<T>(args, i)...);
+}
+
+template <typename T, typename X, typename Y>
+void Arithmetic(EKernelOp op, const X &x, const Y &y, T *out, std::size_t n)
+{
+   switch (op) {
+   case EKernelOp::kAdd: Transform<T>(out, n, [](auto a, auto b) { return a + b; }, x, y); break;
+   case EKernelOp::kSub: Transform<T>(out, n, [](auto a, auto b) { return a - b; }, x, y); break;
+   case EKernelOp::kMul: Transform<T>(out, n, [](auto a, auto b) { return a * b; }, x, y); break;
+   case EKernelOp::kDiv: Transform<T>(out, n, [](auto a, auto b) { return a / b; }, x, y); break;
+   default: R__ASSERT(false && "Not an arithmetic operation");
+   }
+}
+
+template <typename T, typename X, typename Y>
+void Comparison(EKernelOp op, const X &x, const Y &y, int *out, std::size_t n)
+{
+   switch (op) {
+   case EKernelOp::kLess: Transform<T>(out, n, [](auto a, auto b) { return a < b; }, x, y); break;
+   case EKernelOp::kGreater: Transform<T>(out, n, [](auto a, auto b) { return a > b; }, x, y); break;
+   case EKernelOp::kEqual: Transform<T>(out, n, [](auto a, auto b) { return a == b; }, x, y); break;
+   case EKernelOp::kNotEqual: Transform<T>(out, n, [](auto a, auto b) { return a != b; }, x, y); break;
+   case EKernelOp::kLessEqual: Transform<T>(out, n, [](auto a, auto b) { return a <= b; }, x, y); break;
+   case EKernelOp::kGreaterEqual: Transform<T>(out, n, [](auto a, auto b) { return a >= b; }, x, y); break;
+   default: R__ASSERT(false && "Not a comparison");
+   }
+}
+
+// The unqualified calls find the std functions for scalars and the std::experimental ones for packs (through ADL)
+template <typename T>
+void UnaryFunction(EKernelOp op, const T *x, T *out, std::size_t n)
+{
+   using std::abs;
+   using std::ceil;
+   using std::floor;
+   using std::sqrt;
+   using std::trunc;
+   switch (op) {
+   case EKernelOp::kSqrt: Transform<T>(out, n, [](auto a) { return sqrt(a); }, x); break;
+   case EKernelOp::kAbs: Transform<T>(out, n, [](auto a) { return abs(a); }, x); break;
+   case EKernelOp::kFloor: Transform<T>(out, n, [](auto a) { return floor(a); }, x); break;
+   case EKernelOp::kCeil: Transform<T>(out, n, [](auto a) { return ceil(a); }, x); break;
+   case EKernelOp::kTrunc: Transform<T>(out, n, [](auto a) { return trunc(a); }, x); break;
+   default: R__ASSERT(false && "Not a unary function");
+   }
+}
+
+template <typename T>
+T Sum(const T *x, std::size_t n, T init)
+{
+   std::size_t i = 0;
+   T sum = init;
+#ifdef R__RVEC_USE_SIMD
+   // Four independent accumulators hide the latency of the additions
+   constexpr auto kStep = 4 * kPackSize<T>;
+   if (n >= kStep) {
+      Pack_t<T> acc[4] = {T(0), T(0), T(0), T(0)};
+      for (; i + kStep <= n; i += kStep) {
+         for (std::size_t j = 0; j < 4; ++j)
+            acc[j] += LoadPack<T>(x, i + j * kPackSize<T>);
+      }
+      sum += stdx::reduce((acc[0] + acc[1]) + (acc[2] + acc[3]));
+   }
+#endif
+   for (; i < n; ++i)
+      sum += x[i];
+   return sum;
+}
+
+template <typename T, typename X, typename Y>
+void Where(const int *c, const X &x, const Y &y, T *out, std::size_t n)
+{
+   std::size_t i = 0;
+#ifdef R__RVEC_USE_SIMD
+   using IntPack_t = stdx::rebind_simd_t<int, Pack_t<T>>;
+   for (; i + kPackSize<T> <= n; i += kPackSize<T>) {
+      const auto mask = stdx::static_simd_cast<Pack_t<T>>(IntPack_t(c + i, stdx::element_aligned)) != T(0);
+      auto result = LoadPack<T>(y, i);
+      stdx::where(mask, result) = LoadPack<T>(x, i);
+      StorePack(result, out + i);
+   }
+#endif
+   for (; i < n; ++i)
+      out[i] = c[i] != 0 ? Load<T>(x, i) : Load<T>(y, i);
+}
+
+/// DeltaPhi for a scalar or for a pack of angles
+template <typename T>
+T DeltaPhiOf(T phi1, T phi2, T c)
+{
+   return DeltaPhi(phi1, phi2, c);
+}
+
+#ifdef R__RVEC_USE_SIMD
+template <typename T, typename Abi>
+stdx::simd<T, Abi> DeltaPhiOf(const stdx::simd<T, Abi> &phi1, const stdx::simd<T, Abi> &phi2, T c)
+{
+   // DeltaPhi computes in double precision, also for floats
+   using Double_t = stdx::rebind_simd_t<double, stdx::simd<T, Abi>>;
+   const double twoC = 2.0 * c;
+   auto r = stdx::static_simd_cast<Double_t>(phi2 - phi1);
+   // std::fmod(r, 2c) returns r if |r| < 2c, which is the common case of angles in [-c, c]. Otherwise, std::fmod is
+   // called for each element.
+   if (!stdx::all_of(stdx::abs(r) < twoC))
+      return stdx::simd<T, Abi>([&](auto i) { return DeltaPhi(phi1[i], phi2[i], c); });
+   const auto isBelow = r < -double(c);
+   const auto isAbove = !isBelow && r > double(c);
+   stdx::where(isBelow, r) += twoC;
+   stdx::where(isAbove, r) -= twoC;
+   return stdx::static_simd_cast<stdx::simd<T, Abi>>(r);
+}
+#endif
+
+template <typename T>
+void DeltaR(const T *eta1, const T *eta2, const T *phi1, const T *phi2, T c, T *out, std::size_t n, bool squared)
+{
+   auto deltaR2 = [c](auto e1, auto e2, auto p1, auto p2) {
+      const auto dphi = DeltaPhiOf(p1, p2, c);
+      return (e1 - e2) * (e1 - e2) + dphi * dphi;
+   };
+   if (squared) {
+      Transform<T>(out, n, deltaR2, eta1, eta2, phi1, phi2);
+   } else {
+      using std::sqrt;
+      Transform<T>(out, n, [&](auto e1, auto e2, auto p1, auto p2) { return sqrt(deltaR2(e1, e2, p1, p2)); }, eta1,
+                   eta2, phi1, phi2);
+   }
+}
+
+template <typename T>
+void InvariantMasses(const T *pt1, const T *eta1, const T *phi1, const T *mass1, const T *pt2, const T *eta2,
+                     const T *phi2, const T *mass2, T *out, std::size_t n)
+{
+   // The standard library has no SIMD implementation of the trigonometric and hyperbolic functions: they are
+   // evaluated for a block of elements, then the rest of the computation is vectorized
+   constexpr std::size_t kBlockSize = 256;
+   T cos1[kBlockSize], sin1[kBlockSize], sinh1[kBlockSize];
+   T cos2[kBlockSize], sin2[kBlockSize], sinh2[kBlockSize];
+
+   auto invariantMass = [](auto p1, auto c1, auto s1, auto sh1, auto m1, auto p2, auto c2, auto s2, auto sh2, auto m2) {
+      using std::sqrt;
+      // Conversion from (pt, eta, phi, mass) to (x, y, z, e) coordinate system
+      const auto x1 = p1 * c1;
+      const auto y1 = p1 * s1;
+      const auto z1 = p1 * sh1;
+      const auto e1 = sqrt(x1 * x1 + y1 * y1 + z1 * z1 + m1 * m1);
+
+      const auto x2 = p2 * c2;
+      const auto y2 = p2 * s2;
+      const auto z2 = p2 * sh2;
+      const auto e2 = sqrt(x2 * x2 + y2 * y2 + z2 * z2 + m2 * m2);
+
+      // Addition of particle four-vector elements
+      const auto e = e1 + e2;
+      const auto x = x1 + x2;
+      const auto y = y1 + y2;
+      const auto z = z1 + z2;
+
+      return sqrt(e * e - x * x - y * y - z * z);
+   };
+
+   for (std::size_t begin = 0; begin < n; begin += kBlockSize) {
+      const auto size = std::min(kBlockSize, n - begin);
+      for (std::size_t i = 0; i < size; ++i) {
+         cos1[i] = std::cos(phi1[begin + i]);
+         sin1[i] = std::sin(phi1[begin + i]);
+         sinh1[i] = std::sinh(eta1[begin + i]);
+         cos2[i] = std::cos(phi2[begin + i]);
+         sin2[i] = std::sin(phi2[begin + i]);
+         sinh2[i] = std::sinh(eta2[begin + i]);
+      }
+      Transform<T>(out + begin, size, invariantMass, pt1 + begin, cos1, sin1, sinh1, mass1 + begin, pt2 + begin, cos2,
+                   sin2, sinh2, mass2 + begin);
+   }
+}
+
+#ifdef R__HAS_VDT
+template <typename T, typename F>
+void FastMath(const T *__restrict x, T *__restrict out, std::size_t n, F f)
+{
+   // the vdt functions are inlined and branch-free, so that the compiler can vectorize this loop
+   for (std::size_t i = 0; i < n; ++i)
+      out[i] = f(x[i]);
+}
+#endif
+
+} // anonymous namespace
+
+#define RVEC_DEFINE_KERNELS(T)                                                                                         \
+   void ROOT::Internal::VecOps::ElementWiseKernel(EKernelOp op, const T *x, T *out, std::size_t n)                     \
+   {                                                                                                                   \
+      UnaryFunction(op, x, out, n);                                                                                    \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::ElementWiseKernel(EKernelOp op, const T *x, const T *y, T *out, std::size_t n)         \
+   {                                                                                                                   \
+      Arithmetic(op, x, y, out, n);                                                                                    \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::ElementWiseKernel(EKernelOp op, const T *x, T y, T *out, std::size_t n)                \
+   {                                                                                                                   \
+      Arithmetic(op, x, y, out, n);                                                                                    \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::ElementWiseKernel(EKernelOp op, T x, const T *y, T *out, std::size_t n)                \
+   {                                                                                                                   \
+      Arithmetic(op, x, y, out, n);                                                                                    \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::ElementWiseKernel(EKernelOp op, const T *x, const T *y, int *out, std::size_t n)       \
+   {                                                                                                                   \
+      Comparison<T>(op, x, y, out, n);                                                                                 \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::ElementWiseKernel(EKernelOp op, const T *x, T y, int *out, std::size_t n)              \
+   {                                                                                                                   \
+      Comparison<T>(op, x, y, out, n);                                                                                 \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::ElementWiseKernel(EKernelOp op, T x, const T *y, int *out, std::size_t n)              \
+   {                                                                                                                   \
+      Comparison<T>(op, x, y, out, n);                                                                                 \
+   }                                                                                                                   \
+   T ROOT::Internal::VecOps::SumKernel(const T *x, std::size_t n, T init)                                              \
+   {                                                                                                                   \
+      return Sum(x, n, init);                                                                                          \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::WhereKernel(const int *c, const T *x, const T *y, T *out, std::size_t n)               \
+   {                                                                                                                   \
+      Where(c, x, y, out, n);                                                                                          \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::WhereKernel(const int *c, const T *x, T y, T *out, std::size_t n)                      \
+   {                                                                                                                   \
+      Where(c, x, y, out, n);                                                                                          \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::WhereKernel(const int *c, T x, const T *y, T *out, std::size_t n)                      \
+   {                                                                                                                   \
+      Where(c, x, y, out, n);                                                                                          \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::WhereKernel(const int *c, T x, T y, T *out, std::size_t n)                             \
+   {                                                                                                                   \
+      Where(c, x, y, out, n);                                                                                          \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::DeltaRKernel(const T *eta1, const T *eta2, const T *phi1, const T *phi2, T c, T *out,  \
+                                             std::size_t n, bool squared)                                              \
+   {                                                                                                                   \
+      DeltaR(eta1, eta2, phi1, phi2, c, out, n, squared);                                                              \
+   }                                                                                                                   \
+   void ROOT::Internal::VecOps::InvariantMassesKernel(const T *pt1, const T *eta1, const T *phi1, const T *mass1,      \
+                                                      const T *pt2, const T *eta2, const T *phi2, const T *mass2,      \
+                                                      T *out, std::size_t n)                                           \
+   {                                                                                                                   \
+      InvariantMasses(pt1, eta1, phi1, mass1, pt2, eta2, phi2, mass2, out, n);                                         \
+   }
+
+RVEC_DEFINE_KERNELS(float)
+RVEC_DEFINE_KERNELS(double)
+#undef RVEC_DEFINE_KERNELS
+
+#ifdef R__HAS_VDT
+#define RVEC_FAST_MATH_CASE(KIND, F) \
+   case ROOT::Internal::VecOps::EFastMathOp::KIND: FastMath(x, out, n, [](auto v) { return vdt::F(v); }); break;
+
+void ROOT::Internal::VecOps::FastMathKernel(EFastMathOp op, const float *x, float *out, std::size_t n)
+{
+   switch (op) {
+   RVEC_FAST_MATH_CASE(kExp, fast_expf)
+   RVEC_FAST_MATH_CASE(kLog, fast_logf)
+   RVEC_FAST_MATH_CASE(kSin, fast_sinf)
+   RVEC_FAST_MATH_CASE(kCos, fast_cosf)
+   RVEC_FAST_MATH_CASE(kTan, fast_tanf)
+   RVEC_FAST_MATH_CASE(kAsin, fast_asinf)
+   RVEC_FAST_MATH_CASE(kAcos, fast_acosf)
+   RVEC_FAST_MATH_CASE(kAtan, fast_atanf)
+   }
+}
+
+void ROOT::Internal::VecOps::FastMathKernel(EFastMathOp op, const double *x, double *out, std::size_t n)
+{
+   switch (op) {
+   RVEC_FAST_MATH_CASE(kExp, fast_exp)
+   RVEC_FAST_MATH_CASE(kLog, fast_log)
+   RVEC_FAST_MATH_CASE(kSin, fast_sin)
+   RVEC_FAST_MATH_CASE(kCos, fast_cos)
+   RVEC_FAST_MATH_CASE(kTan, fast_tan)
+   RVEC_FAST_MATH_CASE(kAsin, fast_asin)
+   RVEC_FAST_MATH_CASE(kAcos, fast_acos)
+   RVEC_FAST_MATH_CASE(kAtan, fast_atan)
+   }
+}
+#undef RVEC_FAST_MATH_CASE
+#endif // R__HAS_VDT
+
 #if (_VECOPS_USE_EXTERN_TEMPLATES)
 
 namespace ROOT {
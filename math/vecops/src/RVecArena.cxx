@@ -0,0 +1,72 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RVecArena.hxx"
+
+#include <algorithm>
+
+using ROOT::Internal::VecOps::RVecArena;
+
+namespace {
+RVecArena *&CurrentArena()
+{
+   thread_local RVecArena *arena = nullptr;
+   return arena;
+}
+} // anonymous namespace
+
+RVecArena::RVecArena(std::size_t blockSize)
+{
+   AddBlock(blockSize);
+}
+
+/// Add a block of `size` bytes and serve the next allocations from it
+void RVecArena::AddBlock(std::size_t size)
+{
+   // the memory is not value-initialized, as std::make_unique would do
+   fBlocks.push_back({std::unique_ptr<char[]>(new char[size]), size});
+   fNext = reinterpret_cast<std::uintptr_t>(fBlocks.back().fData.get());
+   fEnd = fNext + size;
+}
+
+/// Serve an allocation that does not fit in the last block from a new block
+void *RVecArena::AllocateSlow(std::size_t size, std::size_t alignment)
+{
+   AddBlock(std::max(2 * fBlocks.back().fSize, size + alignment - 1));
+   return Allocate(size, alignment);
+}
+
+void RVecArena::Reset()
+{
+   if (fBlocks.size() == 1) {
+      fNext = reinterpret_cast<std::uintptr_t>(fBlocks.front().fData.get());
+      return;
+   }
+   // merge all blocks into one that can serve everything that was allocated since the last reset in one go
+   const auto capacity = GetCapacity();
+   fBlocks.clear();
+   AddBlock(capacity);
+}
+
+std::size_t RVecArena::GetCapacity() const
+{
+   std::size_t capacity = 0;
+   for (const auto &block : fBlocks)
+      capacity += block.fSize;
+   return capacity;
+}
+
+RVecArena *RVecArena::GetCurrent()
+{
+   return CurrentArena();
+}
+
+void RVecArena::SetCurrent(RVecArena *arena)
+{
+   CurrentArena() = arena;
+}
@@ -0,0 +1,186 @@
+// Time the RVec operations that run explicitly vectorized kernels for RVecF and RVecD against the equivalent scalar
+// loops, for collection sizes typical of per-event objects (jets, leptons) and for larger arrays.
+// Usage: vecops_benchmarks [number of elements processed per measurement, default 1e7]
+
+#include <ROOT/RVec.hxx>
+#include <TError.h>
+#include <TStopwatch.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+using namespace ROOT::VecOps;
+
+namespace {
+
+template <typename T>
+struct Inputs {
+   RVec<T> fA, fB, fEta1, fEta2, fPhi1, fPhi2, fPt1, fPt2, fMass;
+   RVec<int> fMask;
+
+   explicit Inputs(std::size_t size)
+   {
+      std::mt19937 gen(1234);
+      std::uniform_real_distribution<T> etaDist(-2.5, 2.5), phiDist(-M_PI, M_PI), ptDist(20, 200);
+      for (std::size_t i = 0; i < size; ++i) {
+         fA.push_back(ptDist(gen));
+         fB.push_back(ptDist(gen));
+         fEta1.push_back(etaDist(gen));
+         fEta2.push_back(etaDist(gen));
+         fPhi1.push_back(phiDist(gen));
+         fPhi2.push_back(phiDist(gen));
+         fPt1.push_back(ptDist(gen));
+         fPt2.push_back(ptDist(gen));
+         fMass.push_back(0.105);
+         fMask.push_back(fA.back() > 100);
+      }
+   }
+};
+
+// The results of the operations are accumulated here, so that they cannot be optimized away
+double gChecksum = 0.;
+bool gSuccess = true;
+
+/// Return the time per element in ns of f, called on collections of the given size until nElements are processed
+template <typename F>
+double Time(F &&f, std::size_t size, std::size_t nElements)
+{
+   const auto nCalls = std::max<std::size_t>(1, nElements / size);
+   TStopwatch watch;
+   watch.Start();
+   for (std::size_t i = 0; i < nCalls; ++i)
+      gChecksum += f();
+   watch.Stop();
+   return watch.RealTime() * 1e9 / (nCalls * size);
+}
+
+template <typename T>
+void Report(const std::string &name, std::size_t size, double kernelResult, double loopResult, double tKernel,
+            double tLoop)
+{
+   if (std::abs(kernelResult - loopResult) > 1e-3 * std::abs(loopResult)) {
+      Error("vecops_benchmarks", "%s: different results for size %zu: %f (RVec) vs %f (loop)", name.c_str(), size,
+            kernelResult, loopResult);
+      gSuccess = false;
+   }
+   std::printf("%-16s %-7s %6zu %12.3f %12.3f %8.2fx\n", name.c_str(), sizeof(T) == 4 ? "float" : "double", size,
+               tKernel, tLoop, tLoop / tKernel);
+}
+
+template <typename T>
+void RunBenchmarks(std::size_t size, std::size_t nElements)
+{
+   const Inputs<T> in(size);
+   const auto &a = in.fA;
+   const auto &b = in.fB;
+
+   // Time the RVec operation and the scalar loop that computes the same values, and check that the results agree.
+   // Both functions return one element of their result.
+   auto bench = [&](const std::string &name, auto &&rvecOp, auto &&loopOp) {
+      const double kernelResult = rvecOp();
+      const double loopResult = loopOp();
+      const auto tKernel = Time(rvecOp, size, nElements);
+      const auto tLoop = Time(loopOp, size, nElements);
+      Report<T>(name, size, kernelResult, loopResult, tKernel, tLoop);
+   };
+
+   bench(
+      "a + b", [&] { return (a + b)[size - 1]; },
+      [&] {
+         RVec<T> r(size);
+         for (std::size_t i = 0; i < size; ++i)
+            r[i] = a[i] + b[i];
+         return r[size - 1];
+      });
+   bench(
+      "a * 2", [&] { return (a * 2)[size - 1]; },
+      [&] {
+         RVec<T> r(size);
+         for (std::size_t i = 0; i < size; ++i)
+            r[i] = a[i] * 2;
+         return r[size - 1];
+      });
+   bench(
+      "a > b", [&] { return (a > b)[size - 1]; },
+      [&] {
+         RVec<int> r(size);
+         for (std::size_t i = 0; i < size; ++i)
+            r[i] = a[i] > b[i];
+         return r[size - 1];
+      });
+   bench(
+      "Where", [&] { return Where(in.fMask, a, b)[size - 1]; },
+      [&] {
+         RVec<T> r(size);
+         for (std::size_t i = 0; i < size; ++i)
+            r[i] = in.fMask[i] ? a[i] : b[i];
+         return r[size - 1];
+      });
+   bench(
+      "Sum", [&] { return Sum(a); },
+      [&] {
+         T s = 0;
+         for (std::size_t i = 0; i < size; ++i)
+            s += a[i];
+         return s;
+      });
+   bench(
+      "sqrt", [&] { return sqrt(a)[size - 1]; },
+      [&] {
+         RVec<T> r(size);
+         for (std::size_t i = 0; i < size; ++i)
+            r[i] = std::sqrt(a[i]);
+         return r[size - 1];
+      });
+   bench(
+      "DeltaR", [&] { return DeltaR(in.fEta1, in.fEta2, in.fPhi1, in.fPhi2)[size - 1]; },
+      [&] {
+         RVec<T> r(size);
+         for (std::size_t i = 0; i < size; ++i)
+            r[i] = DeltaR(in.fEta1[i], in.fEta2[i], in.fPhi1[i], in.fPhi2[i]);
+         return r[size - 1];
+      });
+   bench(
+      "InvariantMasses",
+      [&] {
+         return InvariantMasses(in.fPt1, in.fEta1, in.fPhi1, in.fMass, in.fPt2, in.fEta2, in.fPhi2, in.fMass)[size - 1];
+      },
+      [&] {
+         RVec<T> r(size);
+         for (std::size_t i = 0; i < size; ++i) {
+            const RVec<T> pt{in.fPt1[i], in.fPt2[i]}, eta{in.fEta1[i], in.fEta2[i]}, phi{in.fPhi1[i], in.fPhi2[i]},
+               mass{in.fMass[i], in.fMass[i]};
+            r[i] = InvariantMass(pt, eta, phi, mass);
+         }
+         return r[size - 1];
+      });
+#ifdef R__HAS_VDT
+   bench(
+      "fast_exp", [&] { return (sizeof(T) == 4 ? fast_expf(in.fEta1) : fast_exp(in.fEta1))[size - 1]; },
+      [&] {
+         RVec<T> r(size);
+         for (std::size_t i = 0; i < size; ++i)
+            r[i] = sizeof(T) == 4 ? vdt::fast_expf(in.fEta1[i]) : vdt::fast_exp(in.fEta1[i]);
+         return r[size - 1];
+      });
+#endif
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+   const std::size_t nElements = argc > 1 ? std::atof(argv[1]) : 1e7;
+
+   std::printf("%-16s %-7s %6s %12s %12s %9s\n", "operation", "type", "size", "RVec [ns]", "loop [ns]", "speed-up");
+   for (std::size_t size : {8, 64, 1024}) {
+      RunBenchmarks<float>(size, nElements);
+      RunBenchmarks<double>(size, nElements);
+   }
+   std::printf("checksum: %g\n", gChecksum);
+
+   return gSuccess ? 0 : 1;
+}
@@ -12,6 +12,8 @@
 #include <vector>
 #include <sstream>
 #include <cmath>
+#include <limits>
+#include <numeric>
 
 // Backward compatibility for gtest version < 1.10.0
 #ifndef INSTANTIATE_TEST_SUITE_P
@@ -1273,6 +1275,136 @@ TEST(VecOps, DeltaR)
       auto dr4 = DeltaR(eta1[i], eta2[i], phi1[i], phi2[i]);
       EXPECT_NEAR(dr3, dr4, 1e-6);
    }
+
+   EXPECT_THROW(DeltaR(eta1, RVecD{0.}, phi1, phi2), std::runtime_error);
+}
+
+// The operations on RVecF and RVecD run explicitly vectorized kernels: check that they give the same results as the
+// scalar operations, also for the elements that do not fill a whole SIMD register
+template <typename T>
+void CheckKernels(std::size_t size)
+{
+   RVec<T> a(size), b(size), pt(size), mass(size, T(0.105));
+   for (std::size_t i = 0; i < size; ++i) {
+      a[i] = T(0.37) * (i % 17) - T(3.1);
+      b[i] = i % 3 == 0 ? a[i] : T(2.9) - T(0.21) * (i % 29);
+      pt[i] = T(20) + i % 10;
+   }
+
+   const auto sum = a + b, diff = a - 2, prod = T(3) * b, ratio = a / b;
+   const auto less = a < b, equal = a == b, greaterEqual = 1 >= b;
+   auto inPlace = a;
+   inPlace *= b;
+   const auto where = Where(less, a, T(1)), roots = sqrt(abs(a)), floors = floor(a);
+   const auto phi2 = a + T(1);
+   const auto dr = DeltaR(a, b, b, a), masses = InvariantMasses(pt, a, b, mass, pt, b, phi2, mass);
+   for (std::size_t i = 0; i < size; ++i) {
+      EXPECT_EQ(sum[i], a[i] + b[i]);
+      EXPECT_EQ(diff[i], a[i] - 2);
+      EXPECT_EQ(prod[i], T(3) * b[i]);
+      EXPECT_EQ(ratio[i], a[i] / b[i]);
+      EXPECT_EQ(less[i], a[i] < b[i]);
+      EXPECT_EQ(equal[i], a[i] == b[i]);
+      EXPECT_EQ(greaterEqual[i], 1 >= b[i]);
+      EXPECT_EQ(inPlace[i], a[i] * b[i]);
+      EXPECT_EQ(where[i], a[i] < b[i] ? a[i] : T(1));
+      EXPECT_EQ(roots[i], std::sqrt(std::abs(a[i])));
+      EXPECT_EQ(floors[i], std::floor(a[i]));
+      // the compiler might fuse multiplications and additions differently in the scalar and in the SIMD code, and
+      // the invariant mass computation amplifies the difference
+      const auto refDR = DeltaR(a[i], b[i], b[i], a[i]);
+      EXPECT_NEAR(dr[i], refDR, 8 * std::numeric_limits<T>::epsilon() * refDR);
+      const auto refMass =
+         InvariantMass(RVec<T>{pt[i], pt[i]}, RVec<T>{a[i], b[i]}, RVec<T>{b[i], phi2[i]}, RVec<T>{mass[i], mass[i]});
+      EXPECT_NEAR(masses[i], refMass, 1000 * std::numeric_limits<T>::epsilon() * refMass);
+   }
+   EXPECT_NEAR(Sum(a), std::accumulate(a.begin(), a.end(), 0.), 1e-4 * size);
+}
+
+TEST(VecOps, Kernels)
+{
+   for (std::size_t size : {0, 1, 3, 4, 7, 8, 17, 64, 301}) {
+      CheckKernels<float>(size);
+      CheckKernels<double>(size);
+   }
+}
+
+TEST(VecOps, Arena)
+{
+   using ROOT::Internal::VecOps::RVecArena;
+
+   RVecArena arena(256);
+   auto *p1 = static_cast<char *>(arena.Allocate(10, 1));
+   auto *p2 = static_cast<char *>(arena.Allocate(8, 8));
+   EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(p2) % 8);
+   EXPECT_GE(p2, p1 + 10);
+   arena.Allocate(1000, 16); // does not fit in the first block
+   EXPECT_GE(arena.GetCapacity(), 1256u);
+   arena.Reset();
+   // the blocks have been merged: a single block can now serve the same allocations
+   auto *p3 = static_cast<char *>(arena.Allocate(1200, 1));
+   EXPECT_EQ(static_cast<char *>(arena.Allocate(1, 1)), p3 + 1200);
+   arena.Reset();
+   EXPECT_EQ(static_cast<char *>(arena.Allocate(1, 1)), p3);
+
+   RVecD v(100);
+   std::iota(v.begin(), v.end(), 0.);
+   RVecI mask(100);
+   for (auto i : ROOT::TSeqI(100))
+      mask[i] = i % 2;
+   RVec<std::size_t> idxs(50);
+   std::iota(idxs.begin(), idxs.end(), 50u);
+   const auto isOdd = [](double x) { return int(x) % 2 == 1; };
+
+   auto check = [&](bool expectAdopting) {
+      auto filtered = Filter(v, isOdd);
+      auto masked = v[mask];
+      auto taken = Take(v, idxs);
+      auto lastTaken = Take(v, -50);
+      auto sorted = Sort(v, [](double x, double y) { return x > y; });
+      auto reversed = Reverse(v);
+      auto combs = Combinations(v, 2);
+      auto small = Filter(RVecD{1., 2., 3.}, isOdd);
+
+      for (const auto *r : {&filtered, &masked, &taken, &lastTaken, &sorted, &reversed})
+         EXPECT_EQ(expectAdopting, IsAdopting(*r));
+      EXPECT_EQ(expectAdopting, IsAdopting(combs[0]));
+      EXPECT_EQ(expectAdopting, IsAdopting(combs[1]));
+      EXPECT_TRUE(IsSmall(small));
+
+      CheckEqual(filtered, masked);
+      EXPECT_EQ(50u, filtered.size());
+      EXPECT_EQ(99., filtered.back());
+      CheckEqual(taken, lastTaken);
+      EXPECT_EQ(50., taken.front());
+      CheckEqual(sorted, reversed);
+      EXPECT_EQ(99., sorted.front());
+      EXPECT_EQ(4950u, combs[0].size());
+      EXPECT_EQ(98u, combs[0].back());
+      EXPECT_EQ(99u, combs[1].back());
+
+      // growing the result moves it to the heap
+      filtered.push_back(-1.);
+      EXPECT_FALSE(IsAdopting(filtered));
+      EXPECT_EQ(99., filtered[49]);
+   };
+
+   check(false);
+   RVecArena::SetCurrent(&arena);
+   EXPECT_EQ(&arena, RVecArena::GetCurrent());
+   check(true);
+   arena.Reset();
+   check(true);
+   RVecArena::SetCurrent(nullptr);
+   check(false);
+
+   // strings cannot live in the arena, as RVecs adopting memory do not destroy their elements
+   RVecArena::SetCurrent(&arena);
+   RVec<std::string> strings(20, "a long string that does not fit in the small string buffer");
+   const auto sortedStrings = Sort(strings);
+   RVecArena::SetCurrent(nullptr);
+   EXPECT_FALSE(IsAdopting(sortedStrings));
+   CheckEqual(strings, sortedStrings);
 }
 
 TEST(VecOps, Map)
@@ -1925,3 +2057,45 @@ TEST_P(VecOpsSwap, RegularAdoptingVectors)
 
 INSTANTIATE_TEST_SUITE_P(ROOTVecOpsswap, VecOpsSwap, ::testing::Values(true));
 INSTANTIATE_TEST_SUITE_P(stdswap, VecOpsSwap, ::testing::Values(false));
+
+TEST(VecOps, LazyExpressions)
+{
+   const RVecF px{1.f, 30.f, 4.f, -2.f}, py{2.f, 40.f, 3.f, 5.f}, pt{10.f, 50.f, 25.f, 30.f};
+
+   // a chain of operations gives the same result as with eager RVec operations
+   const RVecF lazyPt = sqrt(Lazy(px) * px + py * py);
+   CheckEqual(lazyPt, sqrt(px * px + py * py));
+   const RVecF selected = sqrt(Lazy(px) * px + py * py)[Lazy(pt) > 20.f];
+   CheckEqual(selected, sqrt(px * px + py * py)[pt > 20.f]);
+   const RVecF abovePt = Lazy(px)[pt > 20.f && px > 0.f];
+   CheckEqual(abovePt, RVecF{30.f, 4.f});
+
+   // scalars, RVecs, temporary RVecs and expressions can be mixed in any position
+   const RVecD lazyMix = 2. * Lazy(px) - RVecF(py) + pow(Lazy(pt), 2) / pt + atan2(1.f, Lazy(py));
+   CheckEqual(lazyMix, RVecD(2. * px - py + pow(pt, 2) / pt + atan2(1.f, py)));
+   const RVecI lazyCmp = !(Lazy(px) >= py) || -Lazy(pt) < -20.f;
+   EXPECT_TRUE(All(lazyCmp == (!(px >= py) || -pt < -20.f)));
+
+   // the element type follows the same promotion rules as for eager operations
+   auto expr = Lazy(RVecI{1, 2, 3}) * 2;
+   static_assert(std::is_same<decltype(expr)::value_type, int>::value, "");
+   static_assert(std::is_same<decltype(sqrt(expr))::value_type, double>::value, "");
+   static_assert(std::is_same<decltype(Lazy(px) > 1.f)::value_type, int>::value, "");
+   static_assert(std::is_same<ROOT::Internal::VecOps::MaterializedType_t<decltype(sqrt(expr))>, RVecD>::value, "");
+
+   // expressions own the temporary RVecs they are built from and can be evaluated several times
+   EXPECT_EQ(3u, expr.size());
+   EXPECT_EQ(6, expr[2]);
+   EXPECT_EQ(12, Sum(expr));
+   EXPECT_TRUE(Any(expr > 5));
+   EXPECT_FALSE(All(expr > 5));
+   EXPECT_TRUE(All(expr.Materialize() == RVecI({2, 4, 6})));
+
+   std::ostringstream os;
+   os << Lazy(px) + 1.f;
+   EXPECT_EQ(os.str(), "{ 2, 31, 5, -1 }");
+
+   const RVecF shorter{1.f};
+   EXPECT_THROW(Lazy(px) + shorter, std::runtime_error);
+   EXPECT_THROW(Lazy(px)[RVecI(2, 1)], std::runtime_error);
+}
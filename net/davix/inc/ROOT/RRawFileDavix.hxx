@@ -30,23 +30,30 @@ The RRawFileDavix class provides read-only access to remote non-ROOT files.  It
 the transport layer.  It instructs the RRawFile base class to buffer in larger chunks than the default for
 local files, assuming that remote file access has high(er) latency.
 
+Davix has no asynchronous interface; ReadVAsync() runs the vector read in a separate thread so that the caller
+can continue meanwhile. The reads of the file descriptor are serialized.
+
 */
 
 class RRawFileDavix : public RRawFile {
 private:
    std::unique_ptr<Internal::RDavixFileDes> fFileDes;
 
+   /// The vector read from the server, bypassing the block cache
+   void ReadVRemote(RIOVec *ioVec, unsigned int nReq);
+
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
    void ReadVImpl(RIOVec *ioVec, unsigned int nReq) final;
+   std::future<void> ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq) final;
    std::uint64_t GetSizeImpl() final;
 
 public:
    RRawFileDavix(std::string_view url, RRawFile::ROptions options);
    ~RRawFileDavix();
    std::unique_ptr<RRawFile> Clone() const final;
-   int GetFeatures() const final { return kFeatureHasSize; }
+   int GetFeatures() const final { return kFeatureHasSize | kFeatureHasAsyncIo; }
 };
 
 } // namespace Internal
@@ -50,6 +50,9 @@
 //Davix.S3.Region
 //Davix.S3.Token
 //
+//Davix.ParallelRanges
+//Davix.RangeGap
+//
 // Environment variables:
 // X509_USER_CERT, X509_USER_KEY, X509_USER_PROXY ... usual meaning for the X509 Grid things. gEnv vars have higher priority.
 // S3_ACCESS_KEY, S3_SECRET_KEY, S3_REGION, S3_TOKEN. gEnv vars have higher priority.
@@ -75,6 +78,8 @@ private:
     Long64_t DavixReadBuffer(Davix_fd *fd, char *buf, Int_t len);
     Long64_t DavixPReadBuffer(Davix_fd *fd, char *buf, Long64_t pos, Int_t len);
     Long64_t DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
+    Long64_t DavixReadBuffersParallel(Davix_fd *fd, char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
+    Bool_t ReadBuffersViaBlockCache(Davix_fd *fd, char *buf, const Long64_t *pos, const Int_t *len, Int_t nbuf);
     Long64_t DavixWriteBuffer(Davix_fd *fd, const char *buf, Int_t len);
     Int_t DavixStat(struct stat *st) const;
 
@@ -94,6 +99,8 @@ public:
     ///  - S3_ACCKEY=string : Amazon S3 access token
     ///  - S3_REGION=string : Amazon S3 region. Optional, if provided, davix will use v4 signatures.
     ///  - S3_TOKEN=string  : Amazon STS temporary credentials token.
+    ///  - PARALLEL_RANGES=N : read the buffers of ReadBuffers() with up to N concurrent single range requests
+    ///                        instead of one multi-range request, for servers that do not support the latter
     ///
     /// Several parameters can be used if separated with whitespace
 
@@ -107,6 +114,7 @@ public:
     virtual Bool_t ReadBuffer(char *buf, Int_t len);
     virtual Bool_t ReadBuffer(char *buf, Long64_t pos, Int_t len);
     virtual Bool_t ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf);
+    virtual Bool_t SupportsConcurrentReads() const { return kTRUE; }
     virtual Bool_t ReadBufferAsync(Long64_t offs, Int_t len);
     virtual Bool_t WriteBuffer(const char *buffer, Int_t bufferLength);
     virtual TString GetNewUrl();
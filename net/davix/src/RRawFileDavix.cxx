@@ -10,10 +10,14 @@
  *************************************************************************/
 
 #include "ROOT/RRawFileDavix.hxx"
+#include "ROOT/RBlockCache.hxx"
 
 #include <TError.h>
 
+#include <algorithm>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <vector>
 
@@ -28,14 +32,26 @@ namespace ROOT {
 namespace Internal {
 
 struct RDavixFileDes {
-   RDavixFileDes() : fd(nullptr), pos(&ctx) {}
+   RDavixFileDes() : fd(nullptr), pos(&GetContext()) {}
    RDavixFileDes(const RDavixFileDes &) = delete;
    RDavixFileDes &operator=(const RDavixFileDes &) = delete;
    ~RDavixFileDes() = default;
 
+   /// The context holds the session pool; sharing it lets the files reuse the connections to the same server
+   static Davix::Context &GetContext()
+   {
+      // never deleted, the files may outlive the static objects
+      static Davix::Context *ctx = new Davix::Context();
+      return *ctx;
+   }
+
    DAVIX_FD *fd;
-   Davix::Context ctx;
    Davix::DavPosix pos;
+   /// If set, the reads go through the local block cache
+   RBlockCache *blockCache = nullptr;
+   std::string blockCacheId;
+   std::uint64_t fileSize = 0;
+   std::mutex mutex; ///< Serializes the reads from the thread of ReadVAsync() with the other reads
 };
 
 } // namespace Internal
@@ -77,11 +93,33 @@ void ROOT::Internal::RRawFileDavix::OpenImpl()
    }
    if (fOptions.fBlockSize < 0)
       fOptions.fBlockSize = kDefaultBlockSize;
+
+   if (auto blockCache = RBlockCache::GetGlobal()) {
+      struct stat buf;
+      Davix::DavixError *statErr = nullptr;
+      if (fFileDes->pos.stat(nullptr, fUrl, &buf, &statErr) == 0) {
+         fFileDes->blockCache = blockCache;
+         fFileDes->fileSize = buf.st_size;
+         fFileDes->blockCacheId = RBlockCache::MakeFileId(fUrl, buf.st_size, buf.st_mtime);
+      } else {
+         Davix::DavixError::clearError(&statErr);
+      }
+   }
 }
 
 size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
+   if (fFileDes->blockCache) {
+      RIOVec ioVec;
+      ioVec.fBuffer = buffer;
+      ioVec.fOffset = offset;
+      ioVec.fSize = nbytes;
+      ReadVImpl(&ioVec, 1);
+      return ioVec.fOutBytes;
+   }
+
    Davix::DavixError *err = nullptr;
+   std::lock_guard<std::mutex> guard(fFileDes->mutex);
    auto retval = fFileDes->pos.pread(fFileDes->fd, buffer, nbytes, offset, &err);
    if (retval < 0) {
       throw std::runtime_error("Cannot read from '" + fUrl + "', error: " + err->getErrMsg());
@@ -90,6 +128,38 @@ size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, st
 }
 
 void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   if (fFileDes->blockCache) {
+      std::vector<RBlockCache::RRange> ranges;
+      ranges.reserve(nReq);
+      for (unsigned int i = 0; i < nReq; ++i)
+         ranges.push_back({ioVec[i].fBuffer, ioVec[i].fOffset, ioVec[i].fSize});
+      auto fetch = [this](std::vector<RBlockCache::RRange> &missing) {
+         std::vector<RIOVec> missingVec(missing.size());
+         for (std::size_t i = 0; i < missing.size(); ++i) {
+            missingVec[i].fBuffer = missing[i].fBuffer;
+            missingVec[i].fOffset = missing[i].fOffset;
+            missingVec[i].fSize = missing[i].fSize;
+         }
+         ReadVRemote(missingVec.data(), missingVec.size());
+         for (std::size_t i = 0; i < missing.size(); ++i) {
+            if (missingVec[i].fOutBytes != missing[i].fSize)
+               return false;
+         }
+         return true;
+      };
+      if (!fFileDes->blockCache->ReadV(fFileDes->blockCacheId, fFileDes->fileSize, ranges.data(), nReq, fetch))
+         throw std::runtime_error("Cannot do vector read from '" + fUrl + "' through the block cache");
+      for (unsigned int i = 0; i < nReq; ++i) {
+         const auto offset = std::min(ioVec[i].fOffset, fFileDes->fileSize);
+         ioVec[i].fOutBytes = std::min<std::uint64_t>(ioVec[i].fSize, fFileDes->fileSize - offset);
+      }
+      return;
+   }
+   ReadVRemote(ioVec, nReq);
+}
+
+void ROOT::Internal::RRawFileDavix::ReadVRemote(RIOVec *ioVec, unsigned int nReq)
 {
    Davix::DavixError *davixErr = NULL;
    std::vector<Davix::DavIOVecInput> in(nReq);
@@ -102,6 +172,7 @@ void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
       R__ASSERT(ioVec[i].fSize > 0);
    }
 
+   std::lock_guard<std::mutex> guard(fFileDes->mutex);
    auto ret = fFileDes->pos.preadVec(fFileDes->fd, in.data(), out.data(), nReq, &davixErr);
    if (ret < 0) {
       throw std::runtime_error("Cannot do vector read from '" + fUrl + "', error: " + davixErr->getErrMsg());
@@ -111,3 +182,8 @@ void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
       ioVec[i].fOutBytes = out[i].diov_size;
    }
 }
+
+std::future<void> ROOT::Internal::RRawFileDavix::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   return std::async(std::launch::async, [this, ioVec, nReq] { ReadVImpl(ioVec, nReq); });
+}
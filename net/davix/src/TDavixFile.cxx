@@ -30,6 +30,7 @@
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
+#include "ROOT/RBlockCache.hxx"
 #include "ROOT/RLogger.hxx"
 #include "TDavixFile.h"
 #include "TROOT.h"
@@ -50,6 +51,11 @@
 #include <sstream>
 #include <string>
 #include <cstring>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
 
 
 static const std::string VERSION = "0.2.0";
@@ -71,6 +77,7 @@ const char* s3_acckey_opt = "s3acckey=";
 const char* s3_region_opt = "s3region=";
 const char* s3_token_opt = "s3token=";
 const char* s3_alternate_opt = "s3alternate=";
+const char* parallel_ranges_opt = "parallel_ranges=";
 const char* open_mode_read = "READ";
 const char* open_mode_create = "CREATE";
 const char* open_mode_new = "NEW";
@@ -564,6 +571,12 @@ void TDavixFileInternal::parseConfig()
    env_var = gEnv->GetValue("Davix.GSI.GridMode", (const char *)"y");
    if (!isno(env_var))
       enableGridMode();
+
+   // Servers without multi-range support (e.g. many S3 endpoints): ranges read in parallel
+   parallelRanges = gEnv->GetValue("Davix.ParallelRanges", 0);
+   rangeGap = gEnv->GetValue("Davix.RangeGap", 256 * 1024);
+   if (gDebug > 0 && parallelRanges > 0)
+      Info("parseConfig", "Reading up to %d ranges in parallel, bridging gaps of %lld bytes", parallelRanges, rangeGap);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -610,6 +623,10 @@ void TDavixFileInternal::parseParams(Option_t *option)
       if (strncasecmp(it->c_str(), s3_alternate_opt, strlen(s3_alternate_opt)) == 0) {
          setAwsAlternate(strToBool(it->c_str() + strlen(s3_alternate_opt), false));
       }
+      // parallel single range requests instead of a multi-range request
+      if (strncasecmp(it->c_str(), parallel_ranges_opt, strlen(parallel_ranges_opt)) == 0) {
+         parallelRanges = atoi(it->c_str() + strlen(parallel_ranges_opt));
+      }
       // open mods
       oflags = configure_open_flag(*it, oflags);
    }
@@ -688,6 +705,18 @@ void TDavixFile::Init(Bool_t init)
    TFile::Init(kFALSE);
    fOffset = 0;
    fD = -2; // so TFile::IsOpen() will return true when in TFile::~TFi */
+
+   // Files opened for reading can go through the block cache configured by TFile.BlockCacheDir
+   if ((d_ptr->oflags & (O_WRONLY | O_RDWR)) == 0) {
+      if (auto blockCache = ROOT::Internal::RBlockCache::GetGlobal()) {
+         struct stat st;
+         if (d_ptr->DavixStat(fUrl.GetUrl(), &st)) {
+            d_ptr->blockCacheFileSize = st.st_size;
+            d_ptr->blockCacheId = ROOT::Internal::RBlockCache::MakeFileId(fUrl.GetUrl(), st.st_size, st.st_mtime);
+            d_ptr->blockCache = blockCache;
+         }
+      }
+   }
 }
 
 TString TDavixFile::GetNewUrl() {
@@ -740,6 +769,12 @@ Bool_t TDavixFile::ReadBuffer(char *buf, Int_t len)
    Davix_fd *fd;
    if ((fd = d_ptr->getDavixFileInstance()) == NULL)
       return kTRUE;
+   if (d_ptr->blockCache) {
+      if (ReadBuffersViaBlockCache(fd, buf, &fOffset, &len, 1))
+         return kTRUE;
+      fOffset += len;
+      return kFALSE;
+   }
    Long64_t ret = DavixReadBuffer(fd, buf, len);
    if (ret < 0)
       return kTRUE;
@@ -758,6 +793,8 @@ Bool_t TDavixFile::ReadBuffer(char *buf, Long64_t pos, Int_t len)
    Davix_fd *fd;
    if ((fd = d_ptr->getDavixFileInstance()) == NULL)
       return kTRUE;
+   if (d_ptr->blockCache)
+      return ReadBuffersViaBlockCache(fd, buf, &pos, &len, 1);
 
    Long64_t ret = DavixPReadBuffer(fd, buf, pos, len);
    if (ret < 0)
@@ -792,6 +829,8 @@ Bool_t TDavixFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
    Davix_fd *fd;
    if ((fd = d_ptr->getDavixFileInstance()) == NULL)
       return kTRUE;
+   if (d_ptr->blockCache)
+      return ReadBuffersViaBlockCache(fd, buf, pos, len, nbuf);
 
    Long64_t ret = DavixReadBuffers(fd, buf, pos, len, nbuf);
    if (ret < 0)
@@ -891,6 +930,7 @@ Double_t TDavixFile::eventStart()
 
 void TDavixFile::eventStop(Double_t t_start, Long64_t len, bool read)
 {
+  TLockGuard guard(&(d_ptr->statsLock));
   if(read) {
    fBytesRead += len;
    fReadCalls += 1;
@@ -970,6 +1010,9 @@ Long64_t TDavixFile::DavixPReadBuffer(Davix_fd *fd, char *buf, Long64_t pos, Int
 
 Long64_t TDavixFile::DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 {
+   if (d_ptr->parallelRanges > 0 && nbuf > 1)
+      return DavixReadBuffersParallel(fd, buf, pos, len, nbuf);
+
    DavixError *davixErr = NULL;
    Double_t start_time = eventStart();
    DavIOVecInput in[nbuf];
@@ -994,3 +1037,149 @@ Long64_t TDavixFile::DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, In
 
    return ret;
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the buffers with concurrent single range requests, for servers that
+/// do not support multi-range requests. Ranges closer than rangeGap are merged
+/// into one request to limit the number of round trips; up to parallelRanges
+/// requests are in flight at the same time, sharing the connection pool of the
+/// Davix context.
+
+Long64_t TDavixFile::DavixReadBuffersParallel(Davix_fd *fd, char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
+{
+   Double_t start_time = eventStart();
+
+   // A merged request covers the buffers [first, last) of the sorted order
+   struct Request_t {
+      Long64_t fOffset;
+      Long64_t fSize;
+      Int_t fFirst;
+      Int_t fLast;
+   };
+
+   std::vector<Long64_t> bufPos(nbuf);
+   Long64_t totalBytes = 0;
+   for (Int_t i = 0; i < nbuf; ++i) {
+      bufPos[i] = totalBytes;
+      totalBytes += len[i];
+   }
+   std::vector<Int_t> order(nbuf);
+   std::iota(order.begin(), order.end(), 0);
+   std::sort(order.begin(), order.end(), [pos](Int_t a, Int_t b) { return pos[a] < pos[b]; });
+
+   std::vector<Request_t> requests;
+   for (Int_t i = 0; i < nbuf; ++i) {
+      const Int_t k = order[i];
+      if (!requests.empty()) {
+         Request_t &last = requests.back();
+         const Long64_t end = last.fOffset + last.fSize;
+         if (pos[k] <= end + d_ptr->rangeGap) {
+            last.fSize = std::max(end, pos[k] + len[k]) - last.fOffset;
+            last.fLast = i + 1;
+            continue;
+         }
+      }
+      requests.push_back({pos[k], len[k], i, i + 1});
+   }
+
+   std::atomic<size_t> next(0);
+   std::mutex errorLock;
+   std::string errorMsg;
+   auto worker = [&]() {
+      std::unique_ptr<char[]> scratch;
+      Long64_t scratchSize = 0;
+      for (size_t r = next++; r < requests.size(); r = next++) {
+         const Request_t &req = requests[r];
+         const bool direct = (req.fLast - req.fFirst == 1);
+         char *target = buf + bufPos[order[req.fFirst]];
+         if (!direct) {
+            if (req.fSize > scratchSize) {
+               scratch.reset(new char[req.fSize]);
+               scratchSize = req.fSize;
+            }
+            target = scratch.get();
+         }
+
+         DavixError *davixErr = NULL;
+         Long64_t ret = d_ptr->davixPosix->pread(fd, target, req.fSize, req.fOffset, &davixErr);
+         if (ret < 0 || ret < req.fSize) {
+            std::lock_guard<std::mutex> lock(errorLock);
+            if (errorMsg.empty()) {
+               errorMsg = (ret < 0) ? davixErr->getErrMsg() : "short read";
+            }
+            DavixError::clearError(&davixErr);
+            continue;
+         }
+
+         if (!direct) {
+            for (Int_t i = req.fFirst; i < req.fLast; ++i) {
+               const Int_t k = order[i];
+               memcpy(buf + bufPos[k], target + (pos[k] - req.fOffset), len[k]);
+            }
+         }
+      }
+   };
+
+   const size_t nThreads = std::min<size_t>(d_ptr->parallelRanges, requests.size());
+   std::vector<std::thread> threads;
+   for (size_t i = 1; i < nThreads; ++i)
+      threads.emplace_back(worker);
+   worker();
+   for (auto &t : threads)
+      t.join();
+
+   if (!errorMsg.empty()) {
+      Error("DavixReadBuffersParallel", "can not read data with davix: %s", errorMsg.c_str());
+      return -1;
+   }
+
+   eventStop(start_time, totalBytes);
+   return totalBytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the buffers through the block cache, see ROOT::Internal::RBlockCache.
+/// The missing blocks are read with DavixReadBuffers(), which counts them in
+/// the read statistics of the file. Returns kTRUE in case of error.
+
+Bool_t TDavixFile::ReadBuffersViaBlockCache(Davix_fd *fd, char *buf, const Long64_t *pos, const Int_t *len, Int_t nbuf)
+{
+   using ROOT::Internal::RBlockCache;
+
+   std::vector<RBlockCache::RRange> ranges(nbuf);
+   char *cursor = buf;
+   for (Int_t i = 0; i < nbuf; ++i) {
+      if (pos[i] < 0 || pos[i] + len[i] > d_ptr->blockCacheFileSize) {
+         Error("ReadBuffersViaBlockCache", "cannot read %d bytes at %lld, beyond the end of the file", len[i], pos[i]);
+         return kTRUE;
+      }
+      ranges[i] = {cursor, static_cast<std::uint64_t>(pos[i]), static_cast<std::size_t>(len[i])};
+      cursor += len[i];
+   }
+
+   auto fetch = [this, fd](std::vector<RBlockCache::RRange> &missing) {
+      std::vector<Long64_t> missingPos(missing.size());
+      std::vector<Int_t> missingLen(missing.size());
+      Long64_t total = 0;
+      for (std::size_t i = 0; i < missing.size(); ++i) {
+         missingPos[i] = missing[i].fOffset;
+         missingLen[i] = missing[i].fSize;
+         total += missingLen[i];
+      }
+      std::unique_ptr<char[]> data(new char[total]);
+      if (DavixReadBuffers(fd, data.get(), missingPos.data(), missingLen.data(), missing.size()) != total)
+         return false;
+      const char *src = data.get();
+      for (std::size_t i = 0; i < missing.size(); ++i) {
+         memcpy(missing[i].fBuffer, src, missingLen[i]);
+         src += missingLen[i];
+      }
+      return true;
+   };
+
+   if (!d_ptr->blockCache->ReadV(d_ptr->blockCacheId, d_ptr->blockCacheFileSize, ranges.data(), nbuf, fetch)) {
+      Error("ReadBuffersViaBlockCache", "cannot read the missing blocks of %s", fUrl.GetUrl());
+      return kTRUE;
+   }
+   return kFALSE;
+}
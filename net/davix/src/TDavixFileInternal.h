@@ -48,6 +48,11 @@ namespace Davix {
    class DavFile;
 }
 struct Davix_fd;
+namespace ROOT {
+namespace Internal {
+   class RBlockCache;
+}
+}
 
 
 class TDavixFileInternal {
@@ -58,6 +63,7 @@ private:
    TDavixFileInternal(const TUrl & mUrl, Option_t* mopt) :
       positionLock(),
       openLock(),
+      statsLock(),
       davixContext(getDavixInstance()),
       davixParam(nullptr),
       davixPosix(nullptr),
@@ -65,11 +71,16 @@ private:
       fUrl(mUrl),
       opt(mopt),
       oflags(0),
+      parallelRanges(0),
+      rangeGap(256 * 1024),
+      blockCache(nullptr),
+      blockCacheFileSize(0),
       dirdVec() { }
 
    TDavixFileInternal(const char* url, Option_t* mopt) :
       positionLock(),
       openLock(),
+      statsLock(),
       davixContext(getDavixInstance()),
       davixParam(nullptr),
       davixPosix(nullptr),
@@ -77,6 +88,10 @@ private:
       fUrl(url),
       opt(mopt),
       oflags(0),
+      parallelRanges(0),
+      rangeGap(256 * 1024),
+      blockCache(nullptr),
+      blockCacheFileSize(0),
       dirdVec() { }
 
    ~TDavixFileInternal();
@@ -125,6 +140,7 @@ private:
 
    TMutex positionLock;
    TMutex openLock;
+   TMutex statsLock; // the statistics are updated by concurrent ReadBuffers()
 
    std::vector<std::string> replicas;
 
@@ -136,6 +152,14 @@ private:
    TUrl fUrl;
    Option_t* opt;
    int oflags;
+   // Number of concurrent single range requests of ReadBuffers(), 0 to send one multi-range request
+   int parallelRanges;
+   // Largest gap between two ranges that is read rather than starting a new request, in parallel mode
+   Long64_t rangeGap;
+   // If set, the reads go through this local block cache
+   ROOT::Internal::RBlockCache *blockCache;
+   std::string blockCacheId;
+   Long64_t blockCacheFileSize;
    std::vector<void*> dirdVec;
 
 public:
@@ -16,6 +16,7 @@
 #include "TList.h"
 #include "THttpCallArg.h"
 
+#include <condition_variable>
 #include <mutex>
 #include <map>
 #include <string>
@@ -27,6 +28,7 @@
 class THttpEngine;
 class THttpTimer;
 class TRootSniffer;
+class TClass;
 
 class THttpServer : public TNamed {
 
@@ -59,12 +61,46 @@ protected:
    std::mutex fWSMutex;                                      ///<! mutex to protect WS handler lists
    std::vector<std::shared_ptr<THttpWSHandler>> fWSHandlers; ///<! list of WS handlers
 
+   /// Reply on an object request, with the ETag identifying the version of the object
+   struct CachedReply_t {
+      std::string fETag;    ///<! version of the object
+      std::string fContent; ///<! JSON representation of the object
+   };
+
+   /// Conversion of a snapshot of an object to JSON, done by a worker thread
+   struct SnapshotJob_t {
+      std::shared_ptr<THttpCallArg> fArg; ///<! request to reply
+      std::unique_ptr<TObject> fSnapshot; ///<! copy of the requested object
+      std::string fKey;                   ///<! key of the reply in the cache
+      std::string fETag;                  ///<! version of the object
+   };
+
+   Bool_t fCaching{kFALSE};                     ///<! when true, replies on object requests are cached, see SetCaching()
+   std::mutex fCacheMutex;                      ///<! mutex to protect the cache
+   std::map<std::string, CachedReply_t> fCache; ///<! last reply for each object request
+
+   std::vector<std::thread> fWorkers;  ///<! threads converting snapshots of objects to JSON
+   std::mutex fJobsMutex;              ///<! mutex to protect list of jobs
+   std::condition_variable fJobsCond;  ///<! condition to wake up workers
+   std::queue<SnapshotJob_t> fJobs;    ///<! snapshots waiting for conversion
+   Bool_t fStopWorkers{kFALSE};        ///<! when true, workers exit as soon as the list of jobs is empty
+
    virtual void MissedRequest(THttpCallArg *arg);
 
    virtual void ProcessRequest(std::shared_ptr<THttpCallArg> arg);
 
    virtual void ProcessBatchHolder(std::shared_ptr<THttpCallArg> &arg);
 
+   virtual Bool_t CanSnapshot(TClass *cl) const;
+
+   Bool_t ProcessCachedRequest(std::shared_ptr<THttpCallArg> &arg);
+
+   void StoreCachedReply(const std::string &key, const std::string &etag, const std::string &content);
+
+   void SetCachedReplyHeaders(THttpCallArg &arg, const std::string &etag);
+
+   void RunWorker();
+
    void StopServerThread();
 
    std::string BuildWSEntryPage();
@@ -140,6 +176,15 @@ public:
 
    void CreateServerThread();
 
+   void SetCaching(Bool_t on = kTRUE);
+
+   /** returns kTRUE if replies on object requests are cached */
+   Bool_t IsCaching() const { return fCaching; }
+
+   void CreateWorkerThreads(Int_t nthreads = 4);
+
+   void StopWorkerThreads();
+
    /** Check if file is requested, thread safe */
    Bool_t IsFileRequested(const char *uri, TString &res) const;
 
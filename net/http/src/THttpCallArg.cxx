@@ -367,6 +367,11 @@ std::string THttpCallArg::FillHttpHeader(const char *name)
       hdr.append(" 404 Not Found\r\n"
                  "Content-Length: 0\r\n"
                  "Connection: close\r\n\r\n");
+   else if (Is304())
+      hdr.append(Form(" 304 Not Modified\r\n"
+                      "Connection: keep-alive\r\n"
+                      "%s\r\n",
+                      fHeader.Data()));
    else
       hdr.append(Form(" 200 OK\r\n"
                       "Content-Type: %s\r\n"
@@ -22,6 +22,9 @@
 #include "RConfigure.h"
 #include "TRegexp.h"
 #include "TObjArray.h"
+#include "TDirectory.h"
+#include "TDataMember.h"
+#include "TBufferJSON.h"
 
 #include "THttpEngine.h"
 #include "THttpLongPollEngine.h"
@@ -115,6 +118,8 @@ ClassImp(THttpServer);
 ///     cors           - enable CORS header with origin="*"
 ///     cors=domain    - enable CORS header with origin="domain"
 ///     basic_sniffer  - use basic sniffer without support of hist, gpad, graph classes
+///     cache          - cache replies on object requests, see SetCaching()
+///     workers=N      - convert objects to JSON in N worker threads, see CreateWorkerThreads()
 ///
 /// For example, create http server, which allows cors headers and disable scan of global lists,
 /// one should provide "http:8080;cors;noglobal" as parameter
@@ -187,6 +192,10 @@ THttpServer::THttpServer(const char *engine) : TNamed("http", "ROOT http server"
             SetCors(opt + 5);
          } else if (strcmp(opt, "cors") == 0) {
             SetCors("*");
+         } else if (strcmp(opt, "cache") == 0) {
+            SetCaching(kTRUE);
+         } else if (strncmp(opt, "workers=", 8) == 0) {
+            CreateWorkerThreads(TString(opt + 8).Atoi());
          } else
             CreateEngine(opt);
       }
@@ -204,6 +213,8 @@ THttpServer::~THttpServer()
 {
    StopServerThread();
 
+   StopWorkerThreads();
+
    if (fTerminated) {
       TIter iter(&fEngines);
       while (auto engine = dynamic_cast<THttpEngine *>(iter()))
@@ -512,6 +523,244 @@ void THttpServer::StopServerThread()
    fMainThrdId = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Enable caching of the replies on object requests
+///
+/// The JSON representation of an object, requested with `root.json` or `root.json.gz`, is kept
+/// together with a version of the object, computed from the hash of the object data like in
+/// TRootSniffer::GetItemHash(). As long as the object is not modified, further requests are
+/// replied from the cache without converting the object again. The version is also sent in the
+/// ETag header: clients which provide it in the If-None-Match header of the next request get
+/// a short "304 Not Modified" reply when the object did not change.
+///
+/// Caching makes sense when many clients poll the same objects, as for online monitoring.
+
+void THttpServer::SetCaching(Bool_t on)
+{
+   fCaching = on;
+   if (!on) {
+      std::lock_guard<std::mutex> grd(fCacheMutex);
+      fCache.clear();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create worker threads, converting objects to JSON outside the main thread
+///
+/// Requests for objects like histograms or graphs (see CanSnapshot()) still have to find the
+/// object in the main thread, where it is filled, but there only a copy of the object is made
+/// and the conversion of this snapshot to JSON is done by one of the `nthreads` workers. The
+/// main thread can then process the next requests, and several objects are converted at once.
+/// The compression of large replies is already done by the threads of the http engine.
+///
+/// Also enables caching of the replies, see SetCaching(), and thread safety of ROOT.
+
+void THttpServer::CreateWorkerThreads(Int_t nthreads)
+{
+   if (!fWorkers.empty() || (nthreads <= 0))
+      return;
+
+   ROOT::EnableThreadSafety();
+   SetCaching(kTRUE);
+
+   fStopWorkers = kFALSE;
+   for (Int_t n = 0; n < nthreads; ++n)
+      fWorkers.emplace_back([this] { RunWorker(); });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop worker threads, after all submitted snapshots are converted
+
+void THttpServer::StopWorkerThreads()
+{
+   if (fWorkers.empty())
+      return;
+
+   {
+      std::lock_guard<std::mutex> grd(fJobsMutex);
+      fStopWorkers = kTRUE;
+   }
+   fJobsCond.notify_all();
+
+   for (auto &thrd : fWorkers)
+      thrd.join();
+   fWorkers.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Loop of the worker threads: convert snapshots of objects to JSON and reply
+
+void THttpServer::RunWorker()
+{
+   while (true) {
+      SnapshotJob_t job;
+      {
+         std::unique_lock<std::mutex> lk(fJobsMutex);
+         fJobsCond.wait(lk, [this] { return fStopWorkers || !fJobs.empty(); });
+         if (fJobs.empty())
+            return;
+         job = std::move(fJobs.front());
+         fJobs.pop();
+      }
+
+      // same conversion as in TRootSniffer::ProduceJson()
+      TUrl url;
+      url.SetOptions(job.fArg->fQuery.Data());
+      url.ParseOptions();
+      Int_t compact = url.GetValueFromOptions("compact") ? url.GetIntValueFromOptions("compact") : 0;
+
+      std::string content = TBufferJSON::ConvertToJSON(job.fSnapshot.get(), job.fSnapshot->IsA(), compact).Data();
+      job.fSnapshot.reset();
+
+      if (content.empty()) {
+         job.fArg->Set404();
+      } else {
+         StoreCachedReply(job.fKey, job.fETag, content);
+         job.fArg->SetContent(std::move(content));
+         job.fArg->SetJson();
+         SetCachedReplyHeaders(*job.fArg, job.fETag);
+      }
+
+      job.fArg->NotifyCondition();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns kTRUE if objects of class `cl` can be copied in the main thread and converted to JSON
+/// in the worker threads
+///
+/// By default histograms and graphs, which are cheap to copy compared to their conversion.
+/// Objects like trees or collections are always converted in the main thread.
+
+Bool_t THttpServer::CanSnapshot(TClass *cl) const
+{
+   return cl->InheritsFrom("TH1") || cl->InheritsFrom("TGraph") || cl->InheritsFrom("TGraph2D") ||
+          cl->InheritsFrom("TEfficiency");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Store the reply on an object request in the cache
+
+void THttpServer::StoreCachedReply(const std::string &key, const std::string &etag, const std::string &content)
+{
+   // clients may request many different objects or options, do not let the cache grow without limits
+   constexpr std::size_t kMaxCachedReplies = 1000;
+
+   std::lock_guard<std::mutex> grd(fCacheMutex);
+   if ((fCache.size() >= kMaxCachedReplies) && (fCache.find(key) == fCache.end()))
+      fCache.clear();
+   auto &entry = fCache[key];
+   entry.fETag = etag;
+   entry.fContent = content;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set headers of a reply on an object request from the cache
+///
+/// Contrary to other requests, browser caching is allowed but the client has to check
+/// the version of the object with each new request
+
+void THttpServer::SetCachedReplyHeaders(THttpCallArg &arg, const std::string &etag)
+{
+   arg.AddHeader("ETag", etag.c_str());
+   arg.AddHeader("Cache-Control", "private, no-cache");
+
+   if (IsCors())
+      arg.AddHeader("Access-Control-Allow-Origin", GetCors());
+   if (IsCorsCredentials())
+      arg.AddHeader("Access-Control-Allow-Credentials", GetCorsCredentials());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Process a request for the JSON representation of an object using the cache, see SetCaching()
+///
+/// Returns kTRUE if the request is replied or submitted to the worker threads,
+/// kFALSE if it has to be processed by ProcessRequest()
+
+Bool_t THttpServer::ProcessCachedRequest(std::shared_ptr<THttpCallArg> &arg)
+{
+   if (!fCaching || IsWSOnly() || arg->IsPostMethod())
+      return kFALSE;
+
+   Bool_t iszip = arg->fFileName == "root.json.gz";
+   if (!iszip && (arg->fFileName != "root.json"))
+      return kFALSE;
+
+   const char *path = arg->fPathName.Data();
+   if (*path == '/')
+      path++;
+
+   TClass *cl = nullptr;
+   TDataMember *member = nullptr;
+   void *ptr = fSniffer->FindInHierarchy(path, &cl, &member);
+   if (!ptr || !cl || member || (cl->GetBaseClassOffset(TObject::Class()) != 0))
+      return kFALSE;
+
+   auto obj = static_cast<TObject *>(ptr);
+
+   // the address distinguishes objects registered at the same path, the hash of the data modifications of the object
+   std::string etag = TString::Format("\"%lx-%lx\"", (ULong_t)TString::Hash(&obj, sizeof(obj)),
+                                      (ULong_t)TString::Hash(obj, obj->IsA()->Size()))
+                         .Data();
+
+   if (iszip)
+      arg->SetZipping(THttpCallArg::kZipAlways);
+
+   if (arg->GetRequestHeader("If-None-Match") == etag.c_str()) {
+      arg->Set304();
+      arg->SetZipping(THttpCallArg::kNoZip);
+      SetCachedReplyHeaders(*arg, etag);
+      arg->NotifyCondition();
+      return kTRUE;
+   }
+
+   std::string key = std::string(path) + "/root.json?" + arg->fQuery.Data();
+
+   {
+      std::lock_guard<std::mutex> grd(fCacheMutex);
+      auto iter = fCache.find(key);
+      if ((iter != fCache.end()) && (iter->second.fETag == etag)) {
+         arg->SetContent(std::string(iter->second.fContent));
+         arg->SetJson();
+         SetCachedReplyHeaders(*arg, etag);
+         arg->NotifyCondition();
+         return kTRUE;
+      }
+   }
+
+   if (fWorkers.empty() || !CanSnapshot(obj->IsA())) {
+      std::string content;
+      if (!fSniffer->Produce(path, "root.json", arg->fQuery.Data(), content))
+         return kFALSE;
+      StoreCachedReply(key, etag, content);
+      arg->SetContent(std::move(content));
+      arg->SetJson();
+      SetCachedReplyHeaders(*arg, etag);
+      arg->NotifyCondition();
+      return kTRUE;
+   }
+
+   SnapshotJob_t job;
+   {
+      // the copy must not be attached to the current directory
+      TDirectory::TContext ctx(nullptr);
+      job.fSnapshot.reset(obj->Clone());
+   }
+   if (!job.fSnapshot)
+      return kFALSE;
+   job.fArg = arg;
+   job.fKey = std::move(key);
+   job.fETag = std::move(etag);
+
+   {
+      std::lock_guard<std::mutex> grd(fJobsMutex);
+      fJobs.push(std::move(job));
+   }
+   fJobsCond.notify_one();
+
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Checked that filename does not contains relative path below current directory
 ///
@@ -697,6 +946,11 @@ Int_t THttpServer::ProcessRequests()
 
       try {
          cnt++;
+         if (ProcessCachedRequest(arg)) {
+            // replied from the cache or by a worker thread
+            fSniffer->SetCurrentCallArg(nullptr);
+            continue;
+         }
          ProcessRequest(arg);
          fSniffer->SetCurrentCallArg(nullptr);
       } catch (...) {
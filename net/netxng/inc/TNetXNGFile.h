@@ -23,6 +23,9 @@
 
 #include "TFile.h"
 #include "TSemaphore.h"
+
+#include <mutex>
+#include <vector>
 #ifndef __CLING__
 #include <XrdCl/XrdClFileSystem.hh>
 #endif
@@ -31,6 +34,11 @@ namespace XrdCl {
    class File;
    class URL;
 }
+namespace ROOT {
+namespace Internal {
+   class RBlockCache;
+}
+}
 class XrdSysCondVar;
 
 #ifdef __CLING__
@@ -51,12 +59,22 @@ private:
    Int_t                   fReadvIorMax; // Max size of a single readv chunk
    Int_t                   fReadvIovMax; // Max number of readv chunks
    Int_t                   fQueryReadVParams;
+   Int_t                   fReadvMaxInFlight; // Max number of readv requests in flight, 0 for no limit
+   Int_t                   fReplicas;    // Number of data servers to spread the readv requests on
    TString                 fNewUrl;
+   std::mutex              fStatsMutex;  //! Protects the read statistics, updated by concurrent ReadBuffers()
+   std::vector<XrdCl::File *> fReplicaFiles; //! The file opened at the other data servers holding a replica
+   Long64_t                fReadvRequests;   //! Number of readv requests sent to the data servers
+   std::vector<Long64_t>   fBytesReadPerServer; //! Bytes read by ReadBuffers() from each data server
+   ROOT::Internal::RBlockCache *fBlockCache;  //! If set, the reads go through this local block cache
+   std::string             fBlockCacheId;     //! Identifier of the file in the block cache
+   Long64_t                fBlockCacheFileSize; //! Size of the file when it was opened
 
 public:
    TNetXNGFile() : TFile(),
       fFile(nullptr), fUrl(nullptr), fMode(XrdCl::OpenFlags::None), fInitCondVar(nullptr),
-      fReadvIorMax(0), fReadvIovMax(0) {}
+      fReadvIorMax(0), fReadvIovMax(0), fQueryReadVParams(1), fReadvMaxInFlight(0), fReplicas(1),
+      fReadvRequests(0), fBlockCache(nullptr), fBlockCacheFileSize(0) {}
    TNetXNGFile(const char *url, const char *lurl, Option_t *mode, const char *title,
                Int_t compress, Int_t netopt, Bool_t parallelopen);
    TNetXNGFile(const char *url, Option_t *mode = "", const char *title = "",
@@ -77,12 +95,25 @@ public:
    Bool_t   ReadBuffer(char *buffer, Long64_t position, Int_t length) override;
    Bool_t   ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
                         Int_t nbuffs) override;
+   Bool_t   SupportsConcurrentReads() const override { return kTRUE; }
    TString  GetNewUrl() override { return fNewUrl; }
 
+   /// Number of data servers the vector reads are spread on, the first one being the one the file was opened at
+   Int_t    GetNDataServers() const { return 1 + fReplicaFiles.size(); }
+   /// Number of readv requests sent to the data servers; one ReadBuffers() call can send several
+   Long64_t GetReadvRequests() const { return fReadvRequests; }
+   Long64_t GetBytesReadFromServer(Int_t i) const;
+
 private:
    virtual Bool_t IsUseable() const;
    virtual Bool_t GetVectorReadLimits();
    virtual void   SetEnv();
+   void           OpenReplicas();
+   void           CloseReplicas();
+   void           InitBlockCache();
+   Bool_t         ReadBuffersRemote(char *buffer, Long64_t *position, Int_t *length, Int_t nbuffs);
+   Bool_t         ReadBuffersViaBlockCache(char *buffer, const Long64_t *position, const Int_t *length,
+                                           Int_t nbuffs);
    Int_t ParseOpenMode(Option_t *in, TString &modestr,
                        XrdCl::OpenFlags::Flags &mode, Bool_t assumeRead);
 
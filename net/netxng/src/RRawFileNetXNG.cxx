@@ -10,9 +10,13 @@
  *************************************************************************/
 
 #include "ROOT/RRawFileNetXNG.hxx"
+#include "ROOT/RBlockCache.hxx"
 
 #include <TError.h>
 
+#include <algorithm>
+#include <exception>
+#include <future>
 #include <memory>
 #include <stdexcept>
 #include <vector>
@@ -22,6 +26,31 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k blocks for better network utilization
+/// Read the ranges with synchronous vector reads of at most 1024 chunks; used to fill the block cache
+bool FetchRanges(XrdCl::File &file, std::vector<ROOT::Internal::RBlockCache::RRange> &ranges)
+{
+   constexpr std::size_t kMaxChunks = 1024;
+   for (std::size_t first = 0; first < ranges.size(); first += kMaxChunks) {
+      const auto last = std::min(ranges.size(), first + kMaxChunks);
+      XrdCl::ChunkList chunks;
+      chunks.reserve(last - first);
+      for (auto i = first; i < last; ++i)
+         chunks.emplace_back(ranges[i].fOffset, ranges[i].fSize, ranges[i].fBuffer);
+      XrdCl::VectorReadInfo *info = nullptr;
+      auto st = file.VectorRead(chunks, nullptr, info);
+      if (!st.IsOK())
+         return false;
+      const XrdCl::ChunkList &rsp = info->GetChunks();
+      bool complete = true;
+      for (auto i = first; i < last; ++i)
+         complete = complete && (rsp[i - first].length == ranges[i].fSize);
+      delete info;
+      if (!complete)
+         return false;
+   }
+   return true;
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -34,11 +63,53 @@ struct RRawFileNetXNGImpl {
    ~RRawFileNetXNGImpl() = default;
 
    XrdCl::File file;
+   /// If set, the reads go through the local block cache
+   RBlockCache *blockCache = nullptr;
+   std::string blockCacheId;
+   std::uint64_t fileSize = 0;
 };
 
 } // namespace Internal
 } // namespace ROOT
 
+namespace {
+
+/// Fulfills the promise of an asynchronous vector read once XRootD delivers the response
+class RAsyncReadVHandler : public XrdCl::ResponseHandler {
+   ROOT::Internal::RRawFile::RIOVec *fIoVec;
+   unsigned int fNReq;
+   std::string fUrl;
+   std::promise<void> fPromise;
+
+public:
+   RAsyncReadVHandler(ROOT::Internal::RRawFile::RIOVec *ioVec, unsigned int nReq, const std::string &url)
+      : fIoVec(ioVec), fNReq(nReq), fUrl(url)
+   {
+   }
+
+   std::future<void> GetFuture() { return fPromise.get_future(); }
+
+   void HandleResponse(XrdCl::XRootDStatus *status, XrdCl::AnyObject *response) override
+   {
+      if (status->IsOK()) {
+         XrdCl::VectorReadInfo *info = nullptr;
+         response->Get(info);
+         XrdCl::ChunkList &rsp = info->GetChunks();
+         for (std::size_t i = 0; i < fNReq; ++i)
+            fIoVec[i].fOutBytes = rsp[i].length;
+         fPromise.set_value();
+      } else {
+         fPromise.set_exception(std::make_exception_ptr(std::runtime_error(
+            "Cannot do vector read from '" + fUrl + "', " + status->ToString() + "; " + status->GetErrorMessage())));
+      }
+      delete status;
+      delete response;
+      delete this;
+   }
+};
+
+} // anonymous namespace
+
 
 ROOT::Internal::RRawFileNetXNG::RRawFileNetXNG( std::string_view   url,
                                                 RRawFile::ROptions options )
@@ -74,10 +145,29 @@ void ROOT::Internal::RRawFileNetXNG::OpenImpl()
      throw std::runtime_error( "Cannot open '" + fUrl + "', " +
                                st.ToString() + "; " + st.GetErrorMessage() );
    if( fOptions.fBlockSize < 0 ) fOptions.fBlockSize = kDefaultBlockSize;
+
+   if( auto blockCache = RBlockCache::GetGlobal() ) {
+     XrdCl::StatInfo *info = nullptr;
+     if( pImpl->file.Stat( true, info ).IsOK() ) {
+       pImpl->blockCache = blockCache;
+       pImpl->fileSize = info->GetSize();
+       pImpl->blockCacheId = RBlockCache::MakeFileId( fUrl, info->GetSize(), info->GetModTime() );
+       delete info;
+     }
+   }
 }
 
 size_t ROOT::Internal::RRawFileNetXNG::ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset)
 {
+   if( pImpl->blockCache ) {
+     RIOVec ioVec;
+     ioVec.fBuffer = buffer;
+     ioVec.fOffset = offset;
+     ioVec.fSize = nbytes;
+     ReadVImpl( &ioVec, 1 );
+     return ioVec.fOutBytes;
+   }
+
    std::uint32_t btsread = 0;
    auto st = pImpl->file.Read( offset, nbytes, buffer, btsread );
    if( !st.IsOK() )
@@ -88,6 +178,21 @@ size_t ROOT::Internal::RRawFileNetXNG::ReadAtImpl(void *buffer, size_t nbytes, s
 
 void ROOT::Internal::RRawFileNetXNG::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
+   if( pImpl->blockCache ) {
+     std::vector<RBlockCache::RRange> ranges;
+     ranges.reserve( nReq );
+     for( std::size_t i = 0; i < nReq; ++i )
+       ranges.push_back( { ioVec[i].fBuffer, ioVec[i].fOffset, ioVec[i].fSize } );
+     auto fetch = [this]( std::vector<RBlockCache::RRange> &missing ) { return FetchRanges( pImpl->file, missing ); };
+     if( !pImpl->blockCache->ReadV( pImpl->blockCacheId, pImpl->fileSize, ranges.data(), nReq, fetch ) )
+       throw std::runtime_error( "Cannot do vector read from '" + fUrl + "' through the block cache" );
+     for( std::size_t i = 0; i < nReq; ++i ) {
+       const auto offset = std::min( ioVec[i].fOffset, pImpl->fileSize );
+       ioVec[i].fOutBytes = std::min<std::uint64_t>( ioVec[i].fSize, pImpl->fileSize - offset );
+     }
+     return;
+   }
+
    XrdCl::ChunkList chunks;
    chunks.reserve( nReq );
    for( std::size_t i = 0; i < nReq; ++i )
@@ -105,3 +210,25 @@ void ROOT::Internal::RRawFileNetXNG::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
    delete info;
 }
 
+std::future<void> ROOT::Internal::RRawFileNetXNG::ReadVAsyncImpl(RIOVec *ioVec, unsigned int nReq)
+{
+   // The block cache is synchronous
+   if( pImpl->blockCache )
+     return RRawFile::ReadVAsyncImpl( ioVec, nReq );
+
+   XrdCl::ChunkList chunks;
+   chunks.reserve( nReq );
+   for( std::size_t i = 0; i < nReq; ++i )
+     chunks.emplace_back( ioVec[i].fOffset, ioVec[i].fSize, ioVec[i].fBuffer );
+
+   auto handler = new RAsyncReadVHandler( ioVec, nReq, fUrl );
+   auto future = handler->GetFuture();
+   auto st = pImpl->file.VectorRead( chunks, nullptr, handler );
+   if( !st.IsOK() ) {
+     // the handler is only called for submitted requests
+     delete handler;
+     throw std::runtime_error( "Cannot do vector read from '" + fUrl + "', " +
+                               st.ToString() + "; " + st.GetErrorMessage() );
+   }
+   return future;
+}
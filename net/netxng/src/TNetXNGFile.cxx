@@ -20,6 +20,7 @@
 
 #include "TArchiveFile.h"
 #include "TNetXNGFile.h"
+#include "ROOT/RBlockCache.hxx"
 #include "TEnv.h"
 #include "TSystem.h"
 #include "TTimeStamp.h"
@@ -30,7 +31,10 @@
 #include <XrdCl/XrdClXRootDResponses.hh>
 #include <XrdCl/XrdClDefaultEnv.hh>
 #include <XrdVersion.hh>
+#include <cstring>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 //------------------------------------------------------------------------------
 // Open handler for async open requests
@@ -159,6 +163,12 @@ TNetXNGFile::TNetXNGFile(const char *url, const char *lurl, Option_t *mode, cons
    fQueryReadVParams = 1;
    fReadvIorMax = 2097136;
    fReadvIovMax = 1024;
+   fReadvMaxInFlight = 0;
+   fReplicas = 1;
+   fReadvRequests = 0;
+   fBytesReadPerServer.assign(1, 0);
+   fBlockCache = nullptr;
+   fBlockCacheFileSize = 0;
 
    if (ParseOpenMode(mode, fOption, fMode, kTRUE)<0) {
       Error("Open", "could not parse open mode %s", mode);
@@ -218,6 +228,8 @@ TNetXNGFile::TNetXNGFile(const char *url, const char *lurl, Option_t *mode, cons
 
    // Get the vector read limits
    GetVectorReadLimits();
+   OpenReplicas();
+   InitBlockCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -264,6 +276,8 @@ void TNetXNGFile::Init(Bool_t create)
 
    // Get the vector read limits
    GetVectorReadLimits();
+   OpenReplicas();
+   InitBlockCache();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -321,6 +335,7 @@ void TNetXNGFile::SetAsyncOpenStatus(EAsyncOpenStatus status)
 void TNetXNGFile::Close(const Option_t */*option*/)
 {
    TFile::Close();
+   CloseReplicas();
 
    XrdCl::XRootDStatus status = fFile->Close();
    if (!status.IsOK()) {
@@ -360,6 +375,9 @@ Int_t TNetXNGFile::ReOpen(Option_t *modestr)
       return 1;
    }
 
+   // The replicas are only used for reading
+   CloseReplicas();
+
    XRootDStatus st = fFile->Close();
    if (!st.IsOK()) {
       Error("ReOpen", "%s", st.ToStr().c_str());
@@ -367,12 +385,15 @@ Int_t TNetXNGFile::ReOpen(Option_t *modestr)
    }
    fOption = newOpt;
    fMode = mode;
+   fBlockCache = nullptr;
 
    st = fFile->Open(fUrl->GetURL(), fMode);
    if (!st.IsOK()) {
       Error("ReOpen", "%s", st.ToStr().c_str());
       return 1;
    }
+   OpenReplicas();
+   InitBlockCache();
 
    return 0;
 }
@@ -416,6 +437,15 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
       return kFALSE;
    }
 
+   if (fBlockCache) {
+      // ReadBuffersRemote() may move fOffset
+      const Long64_t offset = fOffset;
+      if (ReadBuffersViaBlockCache(buffer, &offset, &length, 1))
+         return kTRUE;
+      fOffset = offset + length;
+      return kFALSE;
+   }
+
    Double_t start = 0;
    if (gPerfStats) start = TTimeStamp();
 
@@ -467,12 +497,27 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
 Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       Int_t nbuffs)
 {
-   using namespace XrdCl;
-
    // Check the file isn't a zombie or closed
    if (!IsUseable())
       return kTRUE;
 
+   if (fBlockCache) {
+      std::vector<Long64_t> physPosition(position, position + nbuffs);
+      for (auto &pos : physPosition)
+         pos += fArchiveOffset;
+      return ReadBuffersViaBlockCache(buffer, physPosition.data(), length, nbuffs);
+   }
+   return ReadBuffersRemote(buffer, position, length, nbuffs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read scattered data chunks from the data servers, see ReadBuffers()
+
+Bool_t TNetXNGFile::ReadBuffersRemote(char *buffer, Long64_t *position, Int_t *length,
+      Int_t nbuffs)
+{
+   using namespace XrdCl;
+
    std::vector<ChunkList>      chunkLists;
    ChunkList                   chunks;
    std::vector<XRootDStatus*> *statuses;
@@ -532,62 +577,79 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    TAsyncReadvHandler *handler;
    XRootDStatus        status;
    semaphore = new TSemaphore(0);
-   statuses  = new std::vector<XRootDStatus*>(chunkLists.size());
-
-   // Read asynchronously but wait for all responses
+   statuses  = new std::vector<XRootDStatus*>(chunkLists.size(), nullptr);
+
+   // Read asynchronously, with up to fReadvMaxInFlight requests in flight,
+   // spreading the chunk lists round-robin on the data servers
+   const Int_t nServers = GetNDataServers();
+   std::vector<Long64_t> bytesPerServer(nServers, 0);
+   Int_t  nInFlight = 0;
+   Bool_t failed    = kFALSE;
    std::vector<ChunkList>::iterator it;
    for (it = chunkLists.begin(); it != chunkLists.end(); ++it)
    {
+      if (fReadvMaxInFlight > 0 && nInFlight >= fReadvMaxInFlight) {
+         semaphore->Wait();
+         --nInFlight;
+      }
+
+      const Int_t server = (it - chunkLists.begin()) % nServers;
+      File *file = (server == 0) ? fFile : fReplicaFiles[server - 1];
       handler = new TAsyncReadvHandler(statuses, it - chunkLists.begin(),
                                        semaphore);
-      status = fFile->VectorRead(*it, 0, handler);
+      status = file->VectorRead(*it, 0, handler);
 
       if (!status.IsOK()) {
+         // The handler is only called for requests that were sent
          Error("ReadBuffers", "%s", status.ToStr().c_str());
-         return kTRUE;
+         delete handler;
+         failed = kTRUE;
+         break;
       }
+      ++nInFlight;
+      for (const auto &chunk : *it)
+         bytesPerServer[server] += chunk.length;
    }
+   const Long64_t nRequests = it - chunkLists.begin();
 
-   // Wait for all responses
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
+   // Wait for all responses, the handlers use the semaphore and the statuses
+   for (; nInFlight > 0; --nInFlight) {
       semaphore->Wait();
    }
 
    // Check for errors
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      XRootDStatus *st = statuses->at(it - chunkLists.begin());
-
-      if (!st->IsOK()) {
+   for (auto st : *statuses) {
+      if (st && !st->IsOK() && !failed) {
          Error("ReadBuffers", "%s", st->ToStr().c_str());
-         for( ; it != chunkLists.end(); ++it )
-         {
-            st = statuses->at( it - chunkLists.begin() );
-            delete st;
-         }
-         delete statuses;
-         delete semaphore;
-
-         return kTRUE;
+         failed = kTRUE;
       }
       delete st;
    }
+   delete statuses;
+   delete semaphore;
+   if (failed)
+      return kTRUE;
 
    // Bump the globals
-   fBytesRead  += totalBytes;
-   fgBytesRead += totalBytes;
-   fReadCalls  ++;
-   fgReadCalls ++;
+   {
+      std::lock_guard<std::mutex> lock(fStatsMutex);
+      fBytesRead  += totalBytes;
+      fgBytesRead += totalBytes;
+      fReadCalls  ++;
+      fgReadCalls ++;
+      fReadvRequests += nRequests;
+      for (Int_t i = 0; i < nServers; ++i)
+         fBytesReadPerServer[i] += bytesPerServer[i];
+
+      if (gPerfStats) {
+         fOffset = position[0];
+         gPerfStats->FileReadEvent(this, totalBytes, start);
+      }
 
-   if (gPerfStats) {
-      fOffset = position[0];
-      gPerfStats->FileReadEvent(this, totalBytes, start);
+      if (gMonitoringWriter)
+         gMonitoringWriter->SendFileReadProgress(this);
    }
 
-   if (gMonitoringWriter)
-      gMonitoringWriter->SendFileReadProgress(this);
-
-   delete statuses;
-   delete semaphore;
    return kFALSE;
 }
 
@@ -722,6 +784,159 @@ Bool_t TNetXNGFile::IsUseable() const
    return kTRUE;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Bytes read by ReadBuffers() from the data server `i`, 0 being the server
+/// the file was opened at and 1 to GetNDataServers() - 1 the replicas
+
+Long64_t TNetXNGFile::GetBytesReadFromServer(Int_t i) const
+{
+   if (i < 0 || i >= (Int_t) fBytesReadPerServer.size())
+      return 0;
+   return fBytesReadPerServer[i];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Open the file at up to NetXNG.Replicas - 1 other data servers that hold a
+/// replica of it, as located by the redirector. ReadBuffers() then spreads its
+/// vector reads on all of them. Only done for files opened for reading.
+
+void TNetXNGFile::OpenReplicas()
+{
+   using namespace XrdCl;
+
+   if (fReplicas <= 1 || fMode != OpenFlags::Read || !IsUseable() || !fReplicaFiles.empty())
+      return;
+
+   std::string dataServerStr;
+   if (!fFile->GetProperty("DataServer", dataServerStr))
+      return;
+   URL dataServer(dataServerStr);
+
+   FileSystem    fs(*fUrl);
+   LocationInfo *locations = nullptr;
+   XRootDStatus  status = fs.DeepLocate(fUrl->GetPath(), OpenFlags::None, locations);
+   if (!status.IsOK()) {
+      if (gDebug > 0)
+         Info("OpenReplicas", "cannot locate the replicas: %s", status.ToStr().c_str());
+      return;
+   }
+
+   for (auto it = locations->Begin(); it != locations->End(); ++it) {
+      if ((Int_t) fReplicaFiles.size() + 1 >= fReplicas)
+         break;
+      URL server(it->GetAddress());
+      if (server.GetHostId() == dataServer.GetHostId())
+         continue;
+
+      URL replicaUrl(*fUrl);
+      replicaUrl.SetHostName(server.GetHostName());
+      replicaUrl.SetPort(server.GetPort());
+      File *replica = new File();
+      status = replica->Open(replicaUrl.GetURL(), fMode);
+      if (status.IsOK()) {
+         fReplicaFiles.push_back(replica);
+      } else {
+         if (gDebug > 0)
+            Info("OpenReplicas", "cannot open the replica at %s: %s", server.GetHostId().c_str(),
+                 status.ToStr().c_str());
+         delete replica;
+      }
+   }
+   delete locations;
+
+   fBytesReadPerServer.resize(GetNDataServers(), 0);
+   if (gDebug > 0)
+      Info("OpenReplicas", "reading from %d data servers", GetNDataServers());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Close the files opened at the other data servers
+
+void TNetXNGFile::CloseReplicas()
+{
+   for (auto replica : fReplicaFiles) {
+      XrdCl::XRootDStatus status = replica->Close();
+      if (!status.IsOK() && gDebug > 0)
+         Info("CloseReplicas", "%s", status.ToStr().c_str());
+      delete replica;
+   }
+   fReplicaFiles.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Use the block cache configured by TFile.BlockCacheDir, see
+/// ROOT::Internal::RBlockCache, if the file is opened for reading
+
+void TNetXNGFile::InitBlockCache()
+{
+   using namespace XrdCl;
+
+   fBlockCache = nullptr;
+   if (fMode != OpenFlags::Read || !IsUseable())
+      return;
+   auto blockCache = ROOT::Internal::RBlockCache::GetGlobal();
+   if (!blockCache)
+      return;
+
+   StatInfo *info = nullptr;
+   if (!fFile->Stat(kTRUE, info).IsOK())
+      return;
+   fBlockCacheFileSize = info->GetSize();
+   fBlockCacheId = ROOT::Internal::RBlockCache::MakeFileId(fUrl->GetURL(), info->GetSize(), info->GetModTime());
+   fBlockCache = blockCache;
+   delete info;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the chunks at the physical positions `position` through the block
+/// cache. The missing blocks are read with ReadBuffersRemote(), which counts
+/// them in the read statistics of the file.
+/// returns: kTRUE in case of failure
+
+Bool_t TNetXNGFile::ReadBuffersViaBlockCache(char *buffer, const Long64_t *position, const Int_t *length,
+                                             Int_t nbuffs)
+{
+   using ROOT::Internal::RBlockCache;
+
+   std::vector<RBlockCache::RRange> ranges(nbuffs);
+   char *cursor = buffer;
+   for (Int_t i = 0; i < nbuffs; ++i) {
+      if (position[i] < 0 || position[i] + length[i] > fBlockCacheFileSize) {
+         Error("ReadBuffersViaBlockCache", "cannot read %d bytes at %lld, beyond the end of the file", length[i],
+               position[i]);
+         return kTRUE;
+      }
+      ranges[i] = {cursor, static_cast<std::uint64_t>(position[i]), static_cast<std::size_t>(length[i])};
+      cursor += length[i];
+   }
+
+   auto fetch = [this](std::vector<RBlockCache::RRange> &missing) {
+      std::vector<Long64_t> pos(missing.size());
+      std::vector<Int_t> len(missing.size());
+      Long64_t total = 0;
+      for (std::size_t i = 0; i < missing.size(); ++i) {
+         pos[i] = missing[i].fOffset - fArchiveOffset;
+         len[i] = missing[i].fSize;
+         total += len[i];
+      }
+      std::unique_ptr<char[]> data(new char[total]);
+      if (ReadBuffersRemote(data.get(), pos.data(), len.data(), missing.size()))
+         return false;
+      const char *src = data.get();
+      for (std::size_t i = 0; i < missing.size(); ++i) {
+         memcpy(missing[i].fBuffer, src, len[i]);
+         src += len[i];
+      }
+      return true;
+   };
+
+   if (!fBlockCache->ReadV(fBlockCacheId, fBlockCacheFileSize, ranges.data(), nbuffs, fetch)) {
+      Error("ReadBuffersViaBlockCache", "cannot read the missing blocks of %s", GetName());
+      return kTRUE;
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Find the server-specific readv config params. Returns kFALSE in case of
 /// error, kTRUE otherwise.
@@ -875,6 +1090,8 @@ void TNetXNGFile::SetEnv()
       env->PutString("ClientMonitorParam", val.Data());
 
    fQueryReadVParams = gEnv->GetValue("NetXNG.QueryReadVParams", 1);
+   fReadvMaxInFlight = gEnv->GetValue("NetXNG.ReadvMaxInFlight", 0);
+   fReplicas         = gEnv->GetValue("NetXNG.Replicas", 1);
    env->PutInt( "MultiProtocol", gEnv->GetValue("TFile.CrossProtocolRedirects", 1));
 
    // Old style netrc file
@@ -22,12 +22,14 @@
 #include <RooArgSet.h>
 #include <RooDataSet.h>
 #include <RooDataHist.h>
+#include <RooVectorDataStore.h>
 #include <RooMsgService.h>
 
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDF/ActionHelpers.hxx>
 #include <TROOT.h>
 
+#include <map>
 #include <vector>
 #include <mutex>
 #include <memory>
@@ -169,40 +171,79 @@ private:
 
     const RooArgSet& argSet = *_dataset->get();
 
-    for (std::size_t i = 0; i < events.size(); i += eventSize) {
-
-      // Creating a RooDataSet from an RDataFrame should be consistent with the
-      // creation from a TTree. The construction from a TTree discards entries
-      // outside the variable definition range, so we have to do that too (see
-      // also RooTreeDataStore::loadValues).
+    if (AppendColumns(*_dataset, argSet, events, eventSize))
+      return;
 
-      bool allOK = true;
+    for (std::size_t i = 0; i < events.size(); i += eventSize) {
+      if (!InRange(argSet, &events[i], eventSize))
+        continue;
       for (std::size_t j=0; j < eventSize; ++j) {
-        auto * destArg = static_cast<RooAbsRealLValue*>(argSet[j]);
-        double sourceVal = events[i+j];
-
-        if (!destArg->inRange(sourceVal, nullptr)) {
-          _numInvalid++ ;
-          allOK = false;
-          const auto prefix = std::string(_dataset->ClassName()) + "Helper::FillDataSet(" + _dataset->GetName() + ") ";
-          if (_numInvalid < 5) {
-            // Unlike in the TreeVectorStore case, we don't log the event
-            // number here because we don't know it anyway, because of
-            // RDataFrame slots and multithreading.
-            oocoutI(nullptr, DataHandling) << prefix << "Skipping event because " << destArg->GetName()
-                << " cannot accommodate the value " << sourceVal << "\n";
-          } else if (_numInvalid == 5) {
-            oocoutI(nullptr, DataHandling) << prefix << "Skipping ...\n";
-          }
-          break ;
+        static_cast<RooAbsRealLValue*>(argSet[j])->setVal(events[i+j]);
+      }
+      _dataset->add(argSet);
+    }
+  }
+
+  /// Check that all values of an event are in the ranges of the variables.
+  ///
+  /// Creating a RooDataSet from an RDataFrame should be consistent with the
+  /// creation from a TTree. The construction from a TTree discards entries
+  /// outside the variable definition range, so we have to do that too (see
+  /// also RooTreeDataStore::loadValues).
+  bool InRange(const RooArgSet& argSet, const double* event, unsigned int eventSize) {
+    for (std::size_t j=0; j < eventSize; ++j) {
+      auto * destArg = static_cast<RooAbsRealLValue*>(argSet[j]);
+      double sourceVal = event[j];
+
+      if (!destArg->inRange(sourceVal, nullptr)) {
+        _numInvalid++ ;
+        const auto prefix = std::string(_dataset->ClassName()) + "Helper::FillDataSet(" + _dataset->GetName() + ") ";
+        if (_numInvalid < 5) {
+          // Unlike in the TreeVectorStore case, we don't log the event
+          // number here because we don't know it anyway, because of
+          // RDataFrame slots and multithreading.
+          oocoutI(nullptr, DataHandling) << prefix << "Skipping event because " << destArg->GetName()
+              << " cannot accommodate the value " << sourceVal << "\n";
+        } else if (_numInvalid == 5) {
+          oocoutI(nullptr, DataHandling) << prefix << "Skipping ...\n";
         }
-        destArg->setVal(sourceVal);
+        return false;
       }
-      if(allOK) {
-        _dataset->add(argSet);
+    }
+    return true;
+  }
+
+  /// Append the events in range directly to the columns of an unweighted RooDataSet with a RooVectorDataStore,
+  /// instead of adding them one by one.
+  /// \return false if the dataset doesn't support it, in which case nothing was done.
+  bool AppendColumns(RooDataSet& data, const RooArgSet& argSet, const std::vector<double>& events,
+                     unsigned int eventSize) {
+    auto store = dynamic_cast<RooVectorDataStore*>(data.store());
+    // a weighted dataset would get the weight 1 from RooDataSet::add(), and stores with errors or categories
+    // have more arrays than columns
+    if (!store || data.isWeighted() || store->getArrays().reals.size() != eventSize ||
+        !store->getArrays().cats.empty())
+      return false;
+
+    std::map<std::string, std::vector<double>> columns;
+    std::vector<std::vector<double>*> columnsInOrder;
+    for (std::size_t j=0; j < eventSize; ++j) {
+      columnsInOrder.push_back(&columns[argSet[j]->GetName()]);
+      columnsInOrder.back()->reserve(events.size() / eventSize);
+    }
+    for (std::size_t i = 0; i < events.size(); i += eventSize) {
+      if (!InRange(argSet, &events[i], eventSize))
+        continue;
+      for (std::size_t j=0; j < eventSize; ++j) {
+        columnsInOrder[j]->push_back(events[i+j]);
       }
     }
+    store->appendColumns(columns);
+    return true;
   }
+
+  /// Other datasets are filled event by event.
+  bool AppendColumns(RooAbsData&, const RooArgSet&, const std::vector<double>&, unsigned int) { return false; }
 };
 
 /// Helper for creating a RooDataSet inside RDataFrame. \see RooAbsDataHelper
@@ -127,3 +127,36 @@ TEST(RooAbsDataHelper, SkipEventsOutOfRange) {
   RooMsgService::instance().getStream(0).addTopic(RooFit::DataHandling);
   RooMsgService::instance().getStream(1).addTopic(RooFit::DataHandling);
 }
+
+/// The unweighted RooDataSets are filled column by column. Verify that they
+/// get the same events as the ones filled event by event.
+TEST(RooAbsDataHelper, ColumnarFill) {
+
+  RooMsgService::instance().getStream(0).removeTopic(RooFit::DataHandling);
+  RooMsgService::instance().getStream(1).removeTopic(RooFit::DataHandling);
+
+  constexpr std::size_t nEvents = 1000;
+  ROOT::RDataFrame rdf(nEvents);
+  auto dd = rdf.Define("x", [](ULong64_t entry) { return -3. + 6. * ((double)entry) / nEvents; }, {"rdfentry_"})
+               .Define("y", [](ULong64_t entry) { return 0.01 * ((double)entry); }, {"rdfentry_"});
+
+  RooRealVar x{"x", "x", -2.0, 2.0};
+  RooRealVar y{"y", "y", 0.0, 100.0};
+
+  auto dataSet = dd.Book<double, double>(RooDataSetHelper("dataSet", "dataSet", RooArgSet(x, y)), {"x", "y"});
+  auto nPassing = dd.Filter("x >= -2. && x <= 2.").Count();
+
+  ASSERT_EQ(dataSet->numEntries(), *nPassing);
+  EXPECT_DOUBLE_EQ(dataSet->sumEntries(), *nPassing);
+  for (int i = 0; i < dataSet->numEntries(); ++i) {
+    const RooArgSet *row = dataSet->get(i);
+    const double xVal = static_cast<RooRealVar const &>((*row)["x"]).getVal();
+    const double yVal = static_cast<RooRealVar const &>((*row)["y"]).getVal();
+    // the columns stay aligned
+    EXPECT_NEAR(yVal, 0.01 * (xVal + 3.) / 6. * nEvents, 1.E-9);
+    EXPECT_TRUE(x.inRange(xVal, nullptr));
+  }
+
+  RooMsgService::instance().getStream(0).addTopic(RooFit::DataHandling);
+  RooMsgService::instance().getStream(1).addTopic(RooFit::DataHandling);
+}
@@ -92,13 +92,6 @@ __rooglobal__ void computeBernstein(BatchesHandle batches)
    const double xmax = batches.extraArg(nCoef + 1);
    Batch xData = batches[0];
 
-   // apply binomial coefficient in-place so we don't have to allocate new memory
-   double binomial = 1.0;
-   for (int k = 0; k < nCoef; k++) {
-      batches.setExtraArg(k, batches.extraArg(k) * binomial);
-      binomial = (binomial * (degree - k)) / (k + 1);
-   }
-
    if (STEP == 1) {
       double X[bufferSize], _1_X[bufferSize], powX[bufferSize], pow_1_X[bufferSize];
       for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
@@ -121,14 +114,20 @@ __rooglobal__ void computeBernstein(BatchesHandle batches)
       for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
          _1_X[i] = 1 / _1_X[i];
 
-      for (int k = 0; k < nCoef; k++)
+      // the binomial coefficients are applied to the coefficients on the fly,
+      // such that the extra arguments are not modified
+      double binomial = 1.0;
+      for (int k = 0; k < nCoef; k++) {
+         const double coef = batches.extraArg(k) * binomial;
          for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
-            batches._output[i] += batches.extraArg(k) * powX[i] * pow_1_X[i];
+            batches._output[i] += coef * powX[i] * pow_1_X[i];
 
             // calculating next power for x and 1-x
             powX[i] *= X[i];
             pow_1_X[i] *= _1_X[i];
          }
+         binomial = (binomial * (degree - k)) / (k + 1);
+      }
    } else
       for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
          batches._output[i] = 0.0;
@@ -137,19 +136,14 @@ __rooglobal__ void computeBernstein(BatchesHandle batches)
          for (int k = 1; k <= degree; k++)
             pow_1_X *= 1 - X;
          const double _1_X = 1 / (1 - X);
+         double binomial = 1.0;
          for (int k = 0; k < nCoef; k++) {
-            batches._output[i] += batches.extraArg(k) * powX * pow_1_X;
+            batches._output[i] += batches.extraArg(k) * binomial * powX * pow_1_X;
             powX *= X;
             pow_1_X *= _1_X;
+            binomial = (binomial * (degree - k)) / (k + 1);
          }
       }
-
-   // reset extraArgs values so we don't mutate the Batches object
-   binomial = 1.0;
-   for (int k = 0; k < nCoef; k++) {
-      batches.setExtraArg(k, batches.extraArg(k) / binomial);
-      binomial = (binomial * (degree - k)) / (k + 1);
-   }
 }
 
 __rooglobal__ void computeBifurGauss(BatchesHandle batches)
@@ -240,23 +234,27 @@ __rooglobal__ void computeChebychev(BatchesHandle batches)
    const double xmax = batches.extraArg(nCoef + 1);
 
    if (STEP == 1) {
-      double prev[bufferSize][2], X[bufferSize];
+      // separate arrays for the two previous orders, such that the loops over
+      // the events vectorize without shuffles
+      double prev0[bufferSize], prev1[bufferSize], X[bufferSize];
 
       for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
-         // set a0-->prev[i][0] and a1-->prev[i][1]
+         // set a0-->prev0[i] and a1-->prev1[i]
          // and x tranfsformed to range[-1..1]-->X[i]
-         prev[i][0] = batches._output[i] = 1.0;
-         prev[i][1] = X[i] = 2 * (xData[i] - 0.5 * (xmax + xmin)) / (xmax - xmin);
+         prev0[i] = batches._output[i] = 1.0;
+         prev1[i] = X[i] = 2 * (xData[i] - 0.5 * (xmax + xmin)) / (xmax - xmin);
       }
-      for (int k = 0; k < nCoef; k++)
+      for (int k = 0; k < nCoef; k++) {
+         const double coef = batches.extraArg(k);
          for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
-            batches._output[i] += prev[i][1] * batches.extraArg(k);
+            batches._output[i] += prev1[i] * coef;
 
             // compute next order
-            const double next = 2 * X[i] * prev[i][1] - prev[i][0];
-            prev[i][0] = prev[i][1];
-            prev[i][1] = next;
+            const double next = 2 * X[i] * prev1[i] - prev0[i];
+            prev0[i] = prev1[i];
+            prev1[i] = next;
          }
+      }
    } else
       for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
          double prev0 = 1.0, prev1 = 2 * (xData[i] - 0.5 * (xmax + xmin)) / (xmax - xmin), X = prev1;
@@ -400,6 +398,16 @@ __rooglobal__ void computeGaussian(BatchesHandle batches)
    auto x = batches[0];
    auto mean = batches[1];
    auto sigma = batches[2];
+   if (!mean.isItVector() && !sigma.isItVector()) {
+      // The common case of scalar parameters: no division in the loop
+      const double meanVal = mean[0];
+      const double halfBySigmaSq = -0.5 / (sigma[0] * sigma[0]);
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+         const double arg = x[i] - meanVal;
+         batches._output[i] = fast_exp(arg * arg * halfBySigmaSq);
+      }
+      return;
+   }
    for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
       const double arg = x[i] - mean[i];
       const double halfBySigmaSq = -0.5 / (sigma[i] * sigma[i]);
@@ -549,6 +557,19 @@ __rooglobal__ void computeNormalizedPdf(BatchesHandle batches)
    auto rawVal = batches[0];
    auto normVal = batches[1];
 
+   if (!normVal.isItVector() && normVal[0] > 0.) {
+      // Common case of a positive scalar normalization: a branchless loop,
+      // which also checks whether some values need the treatment below.
+      const double norm = normVal[0];
+      int nInvalid = 0;
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+         batches._output[i] = rawVal[i] / norm;
+         nInvalid += !(rawVal[i] >= 0.); // negative or NaN
+      }
+      if (nInvalid == 0)
+         return;
+   }
+
    int nEvalErrorsType0 = 0;
    int nEvalErrorsType1 = 0;
    int nEvalErrorsType2 = 0;
@@ -576,9 +597,9 @@ __rooglobal__ void computeNormalizedPdf(BatchesHandle batches)
 
    if (nEvalErrorsType0 > 0)
       batches.setExtraArg(0, batches.extraArg(0) + nEvalErrorsType0);
-   if (nEvalErrorsType1 > 1)
+   if (nEvalErrorsType1 > 0)
       batches.setExtraArg(1, batches.extraArg(1) + nEvalErrorsType1);
-   if (nEvalErrorsType2 > 2)
+   if (nEvalErrorsType2 > 0)
       batches.setExtraArg(2, batches.extraArg(2) + nEvalErrorsType2);
 }
 
@@ -26,6 +26,8 @@ This file contains the code for cuda computations using the RooBatchCompute libr
 
 #include <algorithm>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
 #ifndef RF_ARCH
 #error "RF_ARCH should always be defined"
@@ -38,6 +40,46 @@ namespace RF_ARCH {
 
 constexpr int blockSize = 512;
 
+namespace {
+
+void checkCudaError(cudaError_t error, const char *func)
+{
+   if (error != cudaSuccess)
+      throw std::runtime_error(std::string(func) + "(): " + cudaGetErrorString(error));
+}
+
+/// Scratch memory for the partial sums of a reduction. It is allocated and
+/// freed in the order of the stream of the reduction: unlike cudaMalloc and
+/// cudaFree, this does not synchronize the whole device, i.e. the kernels of
+/// the other nodes running concurrently in their own streams.
+class ReductionBuffer {
+public:
+   ReductionBuffer(std::size_t n, cudaStream_t stream) : _stream{stream}
+   {
+      checkCudaError(cudaMallocAsync(&_data, n * sizeof(double), stream), "ReductionBuffer");
+   }
+   ~ReductionBuffer() { cudaFreeAsync(_data, _stream); }
+   ReductionBuffer(const ReductionBuffer &) = delete;
+   ReductionBuffer &operator=(const ReductionBuffer &) = delete;
+
+   double *data() { return _data; }
+
+   /// Copies the sum and the carry of the final reduction to the host, only
+   /// waiting for the stream of the reduction.
+   void copyResult(double *result)
+   {
+      checkCudaError(cudaMemcpyAsync(result, _data, 2 * sizeof(double), cudaMemcpyDeviceToHost, _stream),
+                     "ReductionBuffer::copyResult");
+      checkCudaError(cudaStreamSynchronize(_stream), "ReductionBuffer::copyResult");
+   }
+
+private:
+   double *_data = nullptr;
+   cudaStream_t _stream;
+};
+
+} // namespace
+
 std::vector<void (*)(Batches)> getFunctions();
 
 /// This class overrides some RooBatchComputeInterface functions, for the
@@ -165,13 +207,13 @@ double RooBatchComputeClass::reduceSum(RooBatchCompute::Config const &cfg, Input
 {
    const int gridSize = std::ceil(double(n) / blockSize);
    cudaStream_t stream = *cfg.cudaStream();
-   CudaInterface::DeviceArray<double> devOut(2 * gridSize);
+   ReductionBuffer devOut(2 * gridSize, stream);
    const int shMemSize = 2 * blockSize * sizeof(double);
    kahanSum<<<gridSize, blockSize, shMemSize, stream>>>(input, nullptr, n, devOut.data(), 0);
    kahanSum<<<1, blockSize, shMemSize, stream>>>(devOut.data(), devOut.data() + gridSize, gridSize, devOut.data(), 0);
-   double tmp = 0.0;
-   CudaInterface::copyDeviceToHost(devOut.data(), &tmp, 1);
-   return tmp;
+   double tmp[2] = {0.0, 0.0};
+   devOut.copyResult(tmp);
+   return tmp[0];
 }
 
 ReduceNLLOutput RooBatchComputeClass::reduceNLL(RooBatchCompute::Config const &cfg, RooSpan<const double> probas,
@@ -180,8 +222,8 @@ ReduceNLLOutput RooBatchComputeClass::reduceNLL(RooBatchCompute::Config const &c
 {
    ReduceNLLOutput out;
    const int gridSize = std::ceil(double(probas.size()) / blockSize);
-   CudaInterface::DeviceArray<double> devOut(2 * gridSize);
    cudaStream_t stream = *cfg.cudaStream();
+   ReductionBuffer devOut(2 * gridSize, stream);
    const int shMemSize = 2 * blockSize * sizeof(double);
 
    if (weightSpan.size() == 1) {
@@ -193,10 +235,11 @@ ReduceNLLOutput RooBatchComputeClass::reduceNLL(RooBatchCompute::Config const &c
 
    kahanSum<<<1, blockSize, shMemSize, stream>>>(devOut.data(), devOut.data() + gridSize, gridSize, devOut.data(), 0);
 
-   double tmpSum = 0.0;
-   double tmpCarry = 0.0;
-   CudaInterface::copyDeviceToHost(devOut.data(), &tmpSum, 1);
-   CudaInterface::copyDeviceToHost(devOut.data() + 1, &tmpCarry, 1);
+   // the final kernel writes the sum and the carry next to each other
+   double tmp[2] = {0.0, 0.0};
+   devOut.copyResult(tmp);
+   double tmpSum = tmp[0];
+   double tmpCarry = tmp[1];
 
    if (weightSpan.size() == 1) {
       tmpSum *= weightSpan[0];
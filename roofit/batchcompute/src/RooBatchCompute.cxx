@@ -29,6 +29,7 @@ This file contains the code for cpu computations using the RooBatchCompute libra
 #include <Math/Util.h>
 
 #include <algorithm>
+#include <numeric>
 #include <sstream>
 #include <stdexcept>
 
@@ -45,6 +46,9 @@ std::vector<void (*)(BatchesHandle)> getFunctions();
 /// purpose of providing a CPU specific implementation of the library.
 class RooBatchComputeClass : public RooBatchComputeInterface {
 private:
+   /// Minimal number of events computed by one task in multi-threaded mode
+   static constexpr std::size_t minEventsPerTask = 16 * bufferSize;
+
    const std::vector<void (*)(BatchesHandle)> _computeFunctions;
 
 public:
@@ -71,8 +75,10 @@ public:
 
    /** Compute multiple values using optimized functions.
    This method creates a Batches object and passes it to the correct compute function.
-   In case Implicit Multithreading is enabled, the events to be processed are equally
-   divided among the tasks to be generated and computed in parallel.
+   In case Implicit Multithreading is enabled, the events to be processed are divided
+   in chunks of a multiple of the buffer size, a few per thread for load balancing,
+   which are computed in parallel. The calls may come from several threads at the same
+   time, for example when the RooFitDriver evaluates independent nodes concurrently.
    \param computer An enum specifying the compute function to be used.
    \param output The array where the computation results are stored.
    \param nEvents The number of events to be processed.
@@ -81,60 +87,57 @@ public:
    void compute(Config const&, Computer computer, RestrictArr output, size_t nEvents, const VarVector &vars,
                 ArgVector &extraArgs) override
    {
-      static std::vector<double> buffer;
-      buffer.resize(vars.size() * bufferSize);
+      // Compute the events [begin, begin + n) in steps of bufferSize, with
+      // `buffer` holding the copies of the scalar inputs.
+      auto computeRange = [&](std::size_t begin, std::size_t n, double *buffer, ArgVector &args) {
+         Batches batches(output, n, vars, args, buffer);
+         batches.advance(begin);
+         std::size_t events = n;
+         batches.setNEvents(bufferSize);
+         while (events > bufferSize) {
+            _computeFunctions[computer](batches);
+            batches.advance(bufferSize);
+            events -= bufferSize;
+         }
+         batches.setNEvents(events);
+         _computeFunctions[computer](batches);
+      };
 
-      if (ROOT::IsImplicitMTEnabled()) {
+      if (ROOT::IsImplicitMTEnabled() && nEvents >= minEventsPerTask * 2) {
          ROOT::Internal::TExecutor ex;
-         std::size_t nThreads = ex.GetPoolSize();
+         const std::size_t nThreads = ex.GetPoolSize();
 
-         std::size_t nEventsPerThread = nEvents / nThreads + (nEvents % nThreads > 0);
+         // Chunks of a multiple of the buffer size, about four per thread
+         std::size_t nEventsPerTask = std::max(nEvents / (4 * nThreads), minEventsPerTask);
+         nEventsPerTask = (nEventsPerTask + bufferSize - 1) / bufferSize * bufferSize;
+         const std::size_t nTasks = (nEvents + nEventsPerTask - 1) / nEventsPerTask;
 
-         // Reset the number of threads to the number we actually need given nEventsPerThread
-         nThreads = nEvents / nEventsPerThread + (nEvents % nEventsPerThread > 0);
+         // The extra arguments may be used as output parameters, counting for
+         // example the evaluation errors: each task works on its own copy and
+         // the changes are added up at the end.
+         std::vector<ArgVector> taskArgs(nTasks, extraArgs);
 
          auto task = [&](std::size_t idx) -> int {
-            // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-            // Then advance every object but the first to split the work between threads
-            Batches batches(output, nEventsPerThread, vars, extraArgs, buffer.data());
-            batches.advance(batches.getNEvents() * idx);
-
-            // Set the number of events of the last Batches object as the remaining events
-            if (idx == nThreads - 1) {
-               batches.setNEvents(nEvents - idx * batches.getNEvents());
-            }
-
-            std::size_t events = batches.getNEvents();
-            batches.setNEvents(bufferSize);
-            while (events > bufferSize) {
-               _computeFunctions[computer](batches);
-               batches.advance(bufferSize);
-               events -= bufferSize;
-            }
-            batches.setNEvents(events);
-            _computeFunctions[computer](batches);
+            std::vector<double> buffer(vars.size() * bufferSize);
+            const std::size_t begin = idx * nEventsPerTask;
+            computeRange(begin, std::min(nEventsPerTask, nEvents - begin), buffer.data(), taskArgs[idx]);
             return 0;
          };
 
-         std::vector<std::size_t> indices(nThreads);
-         for (unsigned int i = 1; i < nThreads; i++) {
-            indices[i] = i;
-         }
+         std::vector<std::size_t> indices(nTasks);
+         std::iota(indices.begin(), indices.end(), 0);
          ex.Map(task, indices);
-      } else {
-         // Fill a std::vector<Batches> with the same object and with ~nEvents/nThreads
-         // Then advance every object but the first to split the work between threads
-         Batches batches(output, nEvents, vars, extraArgs, buffer.data());
 
-         std::size_t events = batches.getNEvents();
-         batches.setNEvents(bufferSize);
-         while (events > bufferSize) {
-            _computeFunctions[computer](batches);
-            batches.advance(bufferSize);
-            events -= bufferSize;
+         const ArgVector initialArgs = extraArgs;
+         for (ArgVector const &args : taskArgs) {
+            for (std::size_t i = 0; i < args.size(); ++i) {
+               extraArgs[i] += args[i] - initialArgs[i];
+            }
          }
-         batches.setNEvents(events);
-         _computeFunctions[computer](batches);
+      } else {
+         thread_local std::vector<double> buffer;
+         buffer.resize(vars.size() * bufferSize);
+         computeRange(0, nEvents, buffer.data(), extraArgs);
       }
    }
    /// Return the sum of an input array
@@ -172,15 +175,22 @@ double RooBatchComputeClass::reduceSum(Config const&, InputArr input, size_t n)
    return ROOT::Math::KahanSum<double, 4u>::Accumulate(input, input + n).Sum();
 }
 
-ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const&, RooSpan<const double> probas,
-                                                RooSpan<const double> weightSpan, RooSpan<const double> weights,
-                                                double weightSum, RooSpan<const double> binVolumes)
-{
-   ReduceNLLOutput out;
+namespace {
 
-   double badness = 0.0;
+/// Number of events summed by one task when the NLL is reduced in parallel.
+/// It is fixed, so that the result doesn't depend on the number of threads.
+constexpr std::size_t reduceNLLChunkSize = 1 << 16;
+
+/// Sum of the NLL terms of the events [begin, end). The badness of the events
+/// with evaluation errors is summed separately.
+void reduceNLLRange(ReduceNLLOutput &out, double &badness, std::size_t begin, std::size_t end,
+                    RooSpan<const double> probas, RooSpan<const double> weightSpan, RooSpan<const double> weights,
+                    double weightSum, RooSpan<const double> binVolumes)
+{
+   // Several independent Kahan sums, for which the compiler can use SIMD instructions
+   ROOT::Math::KahanSum<double, 4u> nllSum;
 
-   for (std::size_t i = 0; i < probas.size(); ++i) {
+   for (std::size_t i = begin; i < end; ++i) {
 
       const double eventWeight = weightSpan.size() > 1 ? weightSpan[i] : weightSpan[0];
 
@@ -197,7 +207,50 @@ ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const&, RooSpan<const dou
 
       term *= -eventWeight;
 
-      out.nllSum.Add(term);
+      nllSum.AddIndexed(term, i);
+   }
+
+   out.nllSum += nllSum;
+}
+
+} // namespace
+
+ReduceNLLOutput RooBatchComputeClass::reduceNLL(Config const&, RooSpan<const double> probas,
+                                                RooSpan<const double> weightSpan, RooSpan<const double> weights,
+                                                double weightSum, RooSpan<const double> binVolumes)
+{
+   ReduceNLLOutput out;
+
+   double badness = 0.0;
+
+   const std::size_t n = probas.size();
+   if (ROOT::IsImplicitMTEnabled() && n > reduceNLLChunkSize) {
+      // Sum the chunks in parallel, then combine the partial sums in order
+      const std::size_t nChunks = (n + reduceNLLChunkSize - 1) / reduceNLLChunkSize;
+      std::vector<ReduceNLLOutput> chunkOut(nChunks);
+      std::vector<double> chunkBadness(nChunks, 0.0);
+
+      auto task = [&](std::size_t idx) -> int {
+         const std::size_t begin = idx * reduceNLLChunkSize;
+         reduceNLLRange(chunkOut[idx], chunkBadness[idx], begin, std::min(begin + reduceNLLChunkSize, n), probas,
+                        weightSpan, weights, weightSum, binVolumes);
+         return 0;
+      };
+
+      std::vector<std::size_t> indices(nChunks);
+      std::iota(indices.begin(), indices.end(), 0);
+      ROOT::Internal::TExecutor ex;
+      ex.Map(task, indices);
+
+      for (std::size_t i = 0; i < nChunks; ++i) {
+         out.nllSum += chunkOut[i].nllSum;
+         out.nLargeValues += chunkOut[i].nLargeValues;
+         out.nNonPositiveValues += chunkOut[i].nNonPositiveValues;
+         out.nNaNValues += chunkOut[i].nNaNValues;
+         badness += chunkBadness[i];
+      }
+   } else {
+      reduceNLLRange(out, badness, 0, n, probas, weightSpan, weights, weightSum, binVolumes);
    }
 
    if (badness != 0.) {
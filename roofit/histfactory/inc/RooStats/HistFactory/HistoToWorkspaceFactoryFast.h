@@ -113,6 +113,7 @@ namespace RooStats{
       std::string fObsName;
       std::vector<std::string> fPreprocessFunctions;
       const Configuration fCfg;
+      bool fMakeChannelAsimovData = true; ///<! Generate the "asimovData" of the single-channel workspaces
 
       RooArgList createObservables(const TH1 *hist, RooWorkspace *proto) const;
 
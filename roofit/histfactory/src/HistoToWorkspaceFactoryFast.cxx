@@ -144,6 +144,14 @@ namespace HistFactory{
 
     // Set the ModelConfig's Params of Interest
     RooAbsData* expData = ws_single->data("asimovData");
+    std::unique_ptr<RooDataSet> emptyData;
+    if( !expData && ws_single->set("observables") ) {
+      // The channels that are only built to be combined have no Asimov
+      // dataset. Guessing the observables and nuisance parameters only needs
+      // the variables of a dataset, not its entries.
+      emptyData = std::make_unique<RooDataSet>("emptyData", "", *ws_single->set("observables"));
+      expData = emptyData.get();
+    }
     if( !expData ) {
       std::cout << "Error: Failed to find dataset: " << expData
       << " in workspace" << std::endl;
@@ -243,6 +251,10 @@ namespace HistFactory{
 
     // First, we create an instance of a HistFactory
     HistoToWorkspaceFactoryFast factory( measurement );
+    // The single-channel Asimov datasets are not merged into the combined
+    // workspace, which generates its own one. Generating them would cost a
+    // full evaluation of every channel model for nothing.
+    factory.fMakeChannelAsimovData = false;
 
     // Loop over the channels and create the individual workspaces
     vector<std::unique_ptr<RooWorkspace>> channel_workspaces;
@@ -1305,8 +1317,10 @@ RooArgList HistoToWorkspaceFactoryFast::createObservables(const TH1 *hist, RooWo
     if (RooMsgService::instance().isActive(static_cast<TObject*>(nullptr), RooFit::HistFactory, RooFit::INFO)) asymcalcPrintLevel = 1;
     if (RooMsgService::instance().isActive(static_cast<TObject*>(nullptr), RooFit::HistFactory, RooFit::DEBUG)) asymcalcPrintLevel = 2;
     AsymptoticCalculator::SetPrintLevel(asymcalcPrintLevel);
-    unique_ptr<RooAbsData> asimov_dataset(AsymptoticCalculator::GenerateAsimovData(*model, observables));
-    proto->import(dynamic_cast<RooDataSet&>(*asimov_dataset), Rename("asimovData"));
+    if (fMakeChannelAsimovData) {
+      unique_ptr<RooAbsData> asimov_dataset(AsymptoticCalculator::GenerateAsimovData(*model, observables));
+      proto->import(dynamic_cast<RooDataSet&>(*asimov_dataset), Rename("asimovData"));
+    }
 
     // GHL: Determine to use data if the hist isn't 'nullptr'
     if(TH1 const* mnominal = channel.GetData().GetHisto()) {
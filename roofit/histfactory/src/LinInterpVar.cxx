@@ -22,6 +22,8 @@
 #include "RooRealVar.h"
 #include "RooArgList.h"
 #include "RooMsgService.h"
+#include "RooNumber.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include "RooStats/HistFactory/LinInterpVar.h"
 
@@ -109,5 +111,20 @@ double LinInterpVar::evaluate() const
   return sum;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the piecewise linear interpolation to code, see evaluate().
 
+void LinInterpVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  std::string resName = "total_" + ctx.getTmpVarName();
+  std::string code = "double " + resName + " = " + RooNumber::toString(_nominal) + ";\n";
+  for (std::size_t i = 0; i < _paramList.size(); ++i) {
+    std::string const &param = ctx.getResult(_paramList[i]);
+    code += resName + " += " + param + " > 0 ? " + param + " * " + RooNumber::toString(_high[i] - _nominal) + " : " +
+            param + " * " + RooNumber::toString(_nominal - _low[i]) + ";\n";
+  }
+  code += resName + " = " + resName + " <= 0 ? 1E-9 : " + resName + ";\n";
 
+  ctx.addToCodeBody(this, code);
+  ctx.addResult(this, resName);
+}
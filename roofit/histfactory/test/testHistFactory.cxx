@@ -4,6 +4,7 @@
 
 #include <RooStats/HistFactory/Measurement.h>
 #include <RooStats/HistFactory/MakeModelAndMeasurementsFast.h>
+#include <RooStats/HistFactory/HistoToWorkspaceFactoryFast.h>
 #include <RooStats/HistFactory/Sample.h>
 #include <RooFit/ModelConfig.h>
 
@@ -13,6 +14,7 @@
 
 #include <RooFit/Common.h>
 #include <RooDataHist.h>
+#include <RooDataSet.h>
 #include <RooWorkspace.h>
 #include <RooArgSet.h>
 #include <RooSimultaneous.h>
@@ -408,6 +410,52 @@ TEST_P(HFFixture, ModelProperties)
    EXPECT_EQ(*mc->GetParametersOfInterest()->begin(), ws->var("SigXsecOverSM"));
 }
 
+/// The static MakeCombinedModel() skips the Asimov datasets of the single channels. Test that the combined workspace
+/// is the same as the one combined from channel workspaces that have their Asimov datasets.
+TEST_P(HFFixture, CombinedModelWithoutChannelAsimovData)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+   Measurement &meas = *_measurement;
+
+   // Reference: combine the channel workspaces as built by MakeSingleChannelModel()
+   HistoToWorkspaceFactoryFast factory(meas);
+   std::vector<std::unique_ptr<RooWorkspace>> channelWorkspaces;
+   std::vector<std::string> channelNames;
+   for (Channel &channel : meas.GetChannels()) {
+      channelNames.push_back(channel.GetName());
+      channelWorkspaces.emplace_back(factory.MakeSingleChannelModel(meas, channel));
+      ASSERT_NE(channelWorkspaces.back()->data("asimovData"), nullptr);
+   }
+   std::unique_ptr<RooWorkspace> refWs{factory.MakeCombinedModel(channelNames, channelWorkspaces)};
+   HistoToWorkspaceFactoryFast::ConfigureWorkspaceForMeasurement("simPdf", refWs.get(), meas);
+
+   std::unique_ptr<RooWorkspace> combinedWs{HistoToWorkspaceFactoryFast::MakeCombinedModel(meas)};
+
+   auto refMc = dynamic_cast<RooStats::ModelConfig *>(refWs->obj("ModelConfig"));
+   auto mc = dynamic_cast<RooStats::ModelConfig *>(combinedWs->obj("ModelConfig"));
+   ASSERT_NE(refMc, nullptr);
+   ASSERT_NE(mc, nullptr);
+   EXPECT_TRUE(mc->GetObservables()->equals(*refMc->GetObservables()))
+      << mc->GetObservables()->contentsString() << " vs. " << refMc->GetObservables()->contentsString();
+   EXPECT_TRUE(mc->GetNuisanceParameters()->equals(*refMc->GetNuisanceParameters()))
+      << mc->GetNuisanceParameters()->contentsString() << " vs. " << refMc->GetNuisanceParameters()->contentsString();
+   EXPECT_TRUE(mc->GetGlobalObservables()->equals(*refMc->GetGlobalObservables()))
+      << mc->GetGlobalObservables()->contentsString() << " vs. "
+      << refMc->GetGlobalObservables()->contentsString();
+
+   RooAbsData *refAsimov = refWs->data("asimovData");
+   RooAbsData *asimov = combinedWs->data("asimovData");
+   ASSERT_NE(refAsimov, nullptr);
+   ASSERT_NE(asimov, nullptr);
+   ASSERT_EQ(asimov->numEntries(), refAsimov->numEntries());
+   EXPECT_DOUBLE_EQ(asimov->sumEntries(), refAsimov->sumEntries());
+   for (int i = 0; i < asimov->numEntries(); ++i) {
+      asimov->get(i);
+      refAsimov->get(i);
+      EXPECT_DOUBLE_EQ(asimov->weight(), refAsimov->weight()) << "entry " << i;
+   }
+}
+
 /// Test that the values returned are as expected.
 TEST_P(HFFixture, Evaluation)
 {
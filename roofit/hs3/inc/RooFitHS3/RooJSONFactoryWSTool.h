@@ -23,6 +23,7 @@
 #include <map>
 #include <stdexcept>
 #include <set>
+#include <unordered_map>
 
 namespace RooFit {
 namespace JSONIO {
@@ -196,6 +197,8 @@ private:
    void importVariable(const RooFit::Detail::JSONNode &n);
    void importDependants(const RooFit::Detail::JSONNode &n);
 
+   RooFit::Detail::JSONNode const *findInputChild(std::string const &key, std::string const &name);
+
    void exportVariable(const RooAbsArg *v, RooFit::Detail::JSONNode &n);
    void exportVariables(const RooArgSet &allElems, RooFit::Detail::JSONNode &n);
 
@@ -218,5 +221,7 @@ private:
    // objects to represent intermediate information
    std::unique_ptr<RooFit::JSONIO::Detail::Domains> _domains;
    std::vector<RooAbsArg const *> _serversToExport;
+   // named children of the top-level nodes of the input, e.g. "distributions", indexed by name
+   std::map<std::string, std::unordered_map<std::string, RooFit::Detail::JSONNode const *>> _inputIndex;
 };
 #endif
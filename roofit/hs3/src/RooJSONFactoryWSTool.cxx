@@ -201,21 +201,6 @@ std::string genPrefix(const JSONNode &p, bool trailing_underscore)
    return prefix;
 }
 
-// helpers for serializing / deserializing binned datasets
-void genIndicesHelper(std::vector<std::vector<int>> &combinations, std::vector<int> &curr_comb,
-                      const std::vector<int> &vars_numbins, size_t curridx)
-{
-   if (curridx == vars_numbins.size()) {
-      // we have filled a combination. Copy it.
-      combinations.emplace_back(curr_comb);
-   } else {
-      for (int i = 0; i < vars_numbins[curridx]; ++i) {
-         curr_comb[curridx] = i;
-         ::genIndicesHelper(combinations, curr_comb, vars_numbins, curridx + 1);
-      }
-   }
-}
-
 void importAttributes(RooAbsArg *arg, JSONNode const &node)
 {
    if (auto seq = node.find("dict")) {
@@ -264,17 +249,16 @@ std::string generate(const RooFit::JSONIO::ImportExpression &ex, const JSONNode
    return expression.str();
 }
 
-std::vector<std::vector<int>> generateBinIndices(const RooArgList &vars)
+// helpers for serializing / deserializing binned datasets
+std::size_t totalNumBins(const RooArgList &vars)
 {
-   std::vector<std::vector<int>> combinations;
-   std::vector<int> vars_numbins;
-   vars_numbins.reserve(vars.size());
+   // RooDataHist bins are indexed in row-major order over the variables, so the bin contents can be
+   // set by their global index and there is no need to enumerate the index combinations
+   std::size_t n = 1;
    for (const auto *absv : static_range_cast<RooRealVar *>(vars)) {
-      vars_numbins.push_back(absv->getBins());
+      n *= absv->getBins();
    }
-   std::vector<int> curr_comb(vars.size());
-   ::genIndicesHelper(combinations, curr_comb, vars_numbins, 0);
-   return combinations;
+   return n;
 }
 
 template <typename... Keys_t>
@@ -669,12 +653,10 @@ RooAbsPdf *RooJSONFactoryWSTool::requestImpl<RooAbsPdf>(const std::string &objna
 {
    if (RooAbsPdf *retval = _workspace.pdf(objname))
       return retval;
-   if (auto distributionsNode = _rootnodeInput->find("distributions")) {
-      if (auto child = findNamedChild(*distributionsNode, objname)) {
-         this->importFunction(*child, true);
-         if (RooAbsPdf *retval = _workspace.pdf(objname))
-            return retval;
-      }
+   if (auto child = findInputChild("distributions", objname)) {
+      this->importFunction(*child, true);
+      if (RooAbsPdf *retval = _workspace.pdf(objname))
+         return retval;
    }
    return nullptr;
 }
@@ -690,12 +672,10 @@ RooAbsReal *RooJSONFactoryWSTool::requestImpl<RooAbsReal>(const std::string &obj
       return pdf;
    if (RooRealVar *var = requestImpl<RooRealVar>(objname))
       return var;
-   if (auto functionNode = _rootnodeInput->find("functions")) {
-      if (auto child = findNamedChild(*functionNode, objname)) {
-         this->importFunction(*child, true);
-         if (RooAbsReal *retval = _workspace.function(objname))
-            return retval;
-      }
+   if (auto child = findInputChild("functions", objname)) {
+      this->importFunction(*child, true);
+      if (RooAbsReal *retval = _workspace.function(objname))
+         return retval;
    }
    return nullptr;
 }
@@ -1211,10 +1191,10 @@ RooJSONFactoryWSTool::readBinnedData(const JSONNode &n, const std::string &name,
          RooJSONFactoryWSTool::error("errors are not in list form");
    }
 
-   auto bins = generateBinIndices(varlist);
-   if (contents.num_children() != bins.size()) {
+   const std::size_t nBins = totalNumBins(varlist);
+   if (contents.num_children() != nBins) {
       std::stringstream errMsg;
-      errMsg << "inconsistent bin numbers: contents=" << contents.num_children() << ", bins=" << bins.size();
+      errMsg << "inconsistent bin numbers: contents=" << contents.num_children() << ", bins=" << nBins;
       RooJSONFactoryWSTool::error(errMsg.str());
    }
    auto dh = std::make_unique<RooDataHist>(name.c_str(), name.c_str(), varlist);
@@ -1230,13 +1210,36 @@ RooJSONFactoryWSTool::readBinnedData(const JSONNode &n, const std::string &name,
          errorVals.push_back(err.val_double());
       }
    }
-   for (size_t ibin = 0; ibin < bins.size(); ++ibin) {
+   for (size_t ibin = 0; ibin < nBins; ++ibin) {
       const double err = errors ? errorVals[ibin] : -1;
       dh->set(ibin, contentVals[ibin], err);
    }
    return dh;
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// find a named child of a top-level node of the input
+JSONNode const *RooJSONFactoryWSTool::findInputChild(std::string const &key, std::string const &name)
+{
+   // When importing a workspace, every object requests its servers by name. Searching the list of
+   // children every time makes the import quadratic in the number of objects, so the children of a
+   // top-level node are indexed by name on the first request.
+   auto found = _inputIndex.find(key);
+   if (found == _inputIndex.end()) {
+      found = _inputIndex.emplace(key, std::unordered_map<std::string, JSONNode const *>{}).first;
+      if (auto node = _rootnodeInput->find(key)) {
+         if (node->is_map() || node->is_seq()) {
+            for (JSONNode const &child : node->children()) {
+               // the first child of a given name wins, like in findNamedChild()
+               found->second.emplace(RooJSONFactoryWSTool::name(child), &child);
+            }
+         }
+      }
+   }
+   auto child = found->second.find(name);
+   return child != found->second.end() ? child->second : nullptr;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // importing variable
 void RooJSONFactoryWSTool::importVariable(const JSONNode &p)
@@ -1593,6 +1596,7 @@ void RooJSONFactoryWSTool::importAllNodes(const JSONNode &n)
    }
 
    _rootnodeInput = nullptr;
+   _inputIndex.clear();
    _domains.reset();
 }
 
@@ -1690,6 +1694,7 @@ void RooJSONFactoryWSTool::importVariableElement(const JSONNode &elementNode)
 
    _attributesNode = nullptr;
    _rootnodeInput = nullptr;
+   _inputIndex.clear();
    _domains.reset();
 }
 
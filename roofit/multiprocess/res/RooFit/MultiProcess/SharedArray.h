@@ -0,0 +1,107 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+#ifndef ROOT_ROOFIT_MultiProcess_SharedArray
+#define ROOT_ROOFIT_MultiProcess_SharedArray
+
+#include "RooFit/MultiProcess/types.h"
+
+#include <atomic>
+#include <cstddef> // size_t
+#include <cstring> // memcpy
+#include <new>
+#include <type_traits>
+
+namespace RooFit {
+namespace MultiProcess {
+
+/// Anonymous memory mapping shared by a process and the processes it forks.
+class SharedMemoryBlock {
+public:
+   explicit SharedMemoryBlock(std::size_t n_bytes);
+   SharedMemoryBlock(const SharedMemoryBlock &other);
+   SharedMemoryBlock &operator=(const SharedMemoryBlock &) = delete;
+   ~SharedMemoryBlock();
+
+   void *data() const { return data_; }
+   std::size_t size() const { return n_bytes_; }
+
+private:
+   void *data_ = nullptr;
+   std::size_t n_bytes_ = 0;
+};
+
+/// Array written by the master and read by the workers through memory shared
+/// between the processes, instead of being sent in messages.
+///
+/// The array must be created before the workers are forked, i.e. together with
+/// the Job using it. The master writes new contents with write(), tagged with
+/// the state identifier of the Job, and then only needs to notify the workers
+/// of the new state. The writes and reads are guarded by a sequence lock: a
+/// worker reading while the master writes a newer state gets a failed read(),
+/// which it can ignore because the notification of the newer state follows.
+template <typename T>
+class SharedArray {
+   static_assert(std::is_trivially_copyable<T>::value, "SharedArray elements must be trivially copyable");
+
+   struct Header {
+      std::atomic<std::size_t> sequence; ///< odd while the master writes
+      State state;                      ///< state of the Job the contents belong to
+   };
+   static_assert(std::atomic<std::size_t>::is_always_lock_free,
+                 "SharedArray needs lock-free atomics to synchronize processes");
+
+   static constexpr std::size_t data_offset()
+   {
+      return (sizeof(Header) + alignof(T) - 1) / alignof(T) * alignof(T);
+   }
+
+   Header *header() const { return static_cast<Header *>(block_.data()); }
+   T *elements() const { return reinterpret_cast<T *>(static_cast<char *>(block_.data()) + data_offset()); }
+
+public:
+   explicit SharedArray(std::size_t size) : block_(data_offset() + size * sizeof(T)), size_(size)
+   {
+      new (block_.data()) Header{{0}, 0};
+   }
+
+   std::size_t size() const { return size_; }
+
+   /// Write the `size()` elements starting at `values`, for the Job state `state`. Call on the master only.
+   void write(const T *values, State state)
+   {
+      Header *h = header();
+      const std::size_t sequence = h->sequence.load(std::memory_order_relaxed);
+      h->sequence.store(sequence + 1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_release);
+      h->state = state;
+      std::memcpy(elements(), values, size_ * sizeof(T));
+      h->sequence.store(sequence + 2, std::memory_order_release);
+   }
+
+   /// Copy the elements to `out` if they were written for the Job state `state` and no write is in progress.
+   /// \return false if the copy failed, in which case `out` may have been partly overwritten.
+   bool read(T *out, State state) const
+   {
+      const Header *h = header();
+      const std::size_t sequence = h->sequence.load(std::memory_order_acquire);
+      if (sequence % 2 == 1 || h->state != state)
+         return false;
+      std::memcpy(out, elements(), size_ * sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      return h->sequence.load(std::memory_order_relaxed) == sequence;
+   }
+
+private:
+   SharedMemoryBlock block_;
+   std::size_t size_;
+};
+
+} // namespace MultiProcess
+} // namespace RooFit
+
+#endif // ROOT_ROOFIT_MultiProcess_SharedArray
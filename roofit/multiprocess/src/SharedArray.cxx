@@ -0,0 +1,53 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RooFit/MultiProcess/SharedArray.h"
+
+#include <sys/mman.h> // mmap, munmap
+
+#include <cerrno>
+#include <cstring> // memcpy
+#include <stdexcept>
+#include <string>
+
+namespace RooFit {
+namespace MultiProcess {
+
+/** \class SharedMemoryBlock
+ * \brief Anonymous shared memory mapping, inherited by the forked processes
+ *
+ * The mapping stays shared between a process and all the processes it
+ * forks after its creation, so that those can exchange data through it
+ * without messages. A copy of the block is a new, independent mapping.
+ */
+
+SharedMemoryBlock::SharedMemoryBlock(std::size_t n_bytes) : n_bytes_(n_bytes)
+{
+   // mmap does not accept empty mappings
+   data_ = mmap(nullptr, n_bytes_ > 0 ? n_bytes_ : 1, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+   if (data_ == MAP_FAILED) {
+      data_ = nullptr;
+      throw std::runtime_error("in SharedMemoryBlock: mmap of " + std::to_string(n_bytes_) +
+                               " bytes failed with errno " + std::to_string(errno));
+   }
+}
+
+SharedMemoryBlock::SharedMemoryBlock(const SharedMemoryBlock &other) : SharedMemoryBlock(other.n_bytes_)
+{
+   std::memcpy(data_, other.data_, n_bytes_);
+}
+
+SharedMemoryBlock::~SharedMemoryBlock()
+{
+   if (data_) {
+      munmap(data_, n_bytes_ > 0 ? n_bytes_ : 1);
+   }
+}
+
+} // namespace MultiProcess
+} // namespace RooFit
@@ -0,0 +1,63 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RooFit/MultiProcess/SharedArray.h"
+
+#include "gtest/gtest.h"
+
+#include <sys/wait.h> // waitpid
+#include <unistd.h>   // fork, _exit
+
+#include <vector>
+
+using RooFit::MultiProcess::SharedArray;
+
+TEST(TestMPSharedArray, ReadWrite)
+{
+   SharedArray<double> array(100);
+   std::vector<double> in(100, 1.);
+   std::vector<double> out(100);
+
+   array.write(in.data(), 1);
+   EXPECT_TRUE(array.read(out.data(), 1));
+   EXPECT_EQ(out, in);
+   // contents of another state
+   EXPECT_FALSE(array.read(out.data(), 2));
+
+   // a copy is an independent block
+   SharedArray<double> copy(array);
+   in.assign(100, 2.);
+   copy.write(in.data(), 2);
+   EXPECT_TRUE(array.read(out.data(), 1));
+   EXPECT_EQ(out, std::vector<double>(100, 1.));
+}
+
+TEST(TestMPSharedArray, ForkedReader)
+{
+   SharedArray<double> array(1000);
+   std::vector<double> in(1000, 1.);
+   array.write(in.data(), 1);
+
+   pid_t child = fork();
+   if (child == 0) {
+      // the child sees the state written by the parent after the fork
+      std::vector<double> out(1000);
+      int retries = 10000;
+      while (!array.read(out.data(), 2) && --retries > 0) {
+         usleep(100);
+      }
+      _exit(retries > 0 && out == std::vector<double>(1000, 2.) ? 0 : 1);
+   }
+
+   in.assign(1000, 2.);
+   array.write(in.data(), 2);
+   int status = 0;
+   ASSERT_EQ(waitpid(child, &status, 0), child);
+   ASSERT_TRUE(WIFEXITED(status));
+   EXPECT_EQ(WEXITSTATUS(status), 0);
+}
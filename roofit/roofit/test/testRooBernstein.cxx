@@ -7,6 +7,7 @@
 #include "TMath.h"
 #include "RooPlot.h"
 #include "TAxis.h"
+#include "RooDataSet.h"
 
 #include "gtest/gtest.h"
 
@@ -85,3 +86,29 @@ TEST(RooBernstein, NumInt)
 {
   IntegrationChecker(0.3, 0.7, 0.2, 0.5);
 }
+
+// The batched evaluation spans several buffers of the computation library
+// and must give the same values as the scalar one in every buffer.
+TEST(RooBernstein, BatchEvaluation)
+{
+  RooRealVar x("x", "x", 0., 10.);
+  RooRealVar c0("c0", "c0", 0.3);
+  RooRealVar c1("c1", "c1", 0.7);
+  RooRealVar c2("c2", "c2", 0.2);
+  RooRealVar c3("c3", "c3", 0.5);
+  RooBernstein bern("bern", "bernstein PDF", x, RooArgList(c0, c1, c2, c3));
+
+  RooDataSet data("data", "data", x);
+  for (int i = 0; i < 1000; ++i) {
+    x.setVal(0.01 * i);
+    data.add(x);
+  }
+
+  std::vector<double> batchValues = bern.getValues(data);
+  ASSERT_EQ(batchValues.size(), 1000u);
+  RooArgSet normSet(x);
+  for (int i = 0; i < 1000; ++i) {
+    x.setVal(0.01 * i);
+    EXPECT_NEAR(batchValues[i], bern.getVal(normSet), 1e-12) << "event " << i;
+  }
+}
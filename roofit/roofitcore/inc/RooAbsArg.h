@@ -36,6 +36,7 @@
 #include <stack>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 
 class TTree ;
@@ -750,6 +751,9 @@ private:
  private:
   void substituteServer(RooAbsArg *oldServer, RooAbsArg *newServer);
   bool callRedirectServersHook(RooAbsCollection const& newSet, bool mustReplaceAll, bool nameChange, bool isRecursionStep);
+  static void treeNodeServerListImpl(RooAbsCollection* list, const RooAbsArg* arg, bool doBranch, bool doLeaf,
+                                     bool valueOnly, bool recurseFundamental,
+                                     std::unordered_set<const RooAbsArg*> *visited);
 
   ClassDefOverride(RooAbsArg,9) // Abstract variable
 };
@@ -80,9 +80,8 @@ protected:
 
     RooArgList containedArgs(Action) override ;
 
-    std::unique_ptr<TVirtualFFT> fftr2c1;
-    std::unique_ptr<TVirtualFFT> fftr2c2;
-    std::unique_ptr<TVirtualFFT> fftc2r;
+    std::unique_ptr<TVirtualFFT> fftr2c; ///< Transform of the samplings of both p.d.f.s
+    std::unique_ptr<TVirtualFFT> fftc2r; ///< Inverse transform of the product
 
     std::unique_ptr<RooAbsPdf> pdf1Clone;
     std::unique_ptr<RooAbsPdf> pdf2Clone;
@@ -40,6 +40,9 @@ public:
 private:
    mutable bool _first = true;        ///<!
    mutable std::vector<double> _binw; ///<!
+   std::vector<double> _nObs;         ///<! Observed counts in the bins
+   std::vector<double> _lnGammaNObs;  ///<! Constant log(N!) terms of the bins
+   std::vector<double> _mu;           ///<! Expected counts in the bins
    std::unique_ptr<RooChangeTracker> paramTracker_;
    Section lastSection_ = {0, 0}; // used for cache together with the parameter tracker
    mutable ROOT::Math::KahanSum<double> cachedResult_{0.};
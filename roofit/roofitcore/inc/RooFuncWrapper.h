@@ -79,6 +79,7 @@ private:
    Func _func;
    Grad _grad;
    mutable std::vector<double> _gradientVarBuffer;
+   mutable std::vector<double> _gradientOutBuffer;
    std::vector<double> _observables;
    std::map<RooFit::Detail::DataKey, ObsInfo> _obsInfos;
    std::map<RooFit::Detail::DataKey, std::size_t> _nodeOutputSizes;
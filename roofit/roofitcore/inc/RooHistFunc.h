@@ -94,6 +94,8 @@ public:
   std::list<double>* plotSamplingHint(RooAbsRealLValue& obs, double xlo, double xhi) const override ;
   bool isBinnedDistribution(const RooArgSet&) const override { return _intOrder==0 ; }
   RooArgSet const& getHistObsList() const { return _histObsList; }
+  /// The observables mapped onto the histogram observables.
+  RooArgSet const& variables() const { return _depList; }
 
 
   Int_t getBin() const;
@@ -72,6 +72,7 @@ protected:
   double _epsAbs ;         ///< Absolute convergence tolerance
   double _epsRel ;         ///< Relative convergence tolerance
   bool _doExtrap = true;   ///< Apply conversion step?
+  bool _batchEvaluation = false; ///< Evaluate the integrand in batches if it is a RooRealBinding?
   double _xmin;            ///<! Lower integration bound
   double _xmax;            ///<! Upper integration bound
 
@@ -26,6 +26,8 @@
 #include <TMatrixDSymfwd.h>
 
 #include <fstream>
+#include <functional>
+#include <map>
 #include <memory> // shared_ptr, unique_ptr
 #include <string>
 #include <utility>
@@ -68,6 +70,11 @@ public:
       // argument is ignored when parallelize is 0
       bool enableParallelDescent = false;
 
+      // Number of processes used by profileScan() and minos() to run their independent fits in parallel. 0 means
+      // serial evaluation (default), -1 lets RooFit::MultiProcess choose the number of workers, n means n workers.
+      // Can't be combined with parallelize.
+      int parallelScan = 0;
+
       bool verbose = false;           // local config
       bool profile = false;           // local config
       bool timingAnalysis = false;    // local config
@@ -111,6 +118,8 @@ public:
    int minimize(const char *type, const char *alg = nullptr);
 
    RooFit::OwningPtr<RooFitResult> save(const char *name = nullptr, const char *title = nullptr);
+   std::vector<double> profileScan(RooArgList const &scanParams, std::vector<std::vector<double>> const &points,
+                                   std::vector<int> *status = nullptr);
    RooPlot *contour(RooRealVar &var1, RooRealVar &var2, double n1 = 1.0, double n2 = 2.0, double n3 = 0.0,
                     double n4 = 0.0, double n5 = 0.0, double n6 = 0.0, unsigned int npoints = 50);
 
@@ -169,6 +178,11 @@ private:
 
    bool fitFcn() const;
 
+   unsigned int getNScanWorkers() const;
+   std::map<unsigned int, std::pair<double, double>> minosParallel(std::vector<unsigned int> const &paramInd);
+   std::vector<std::vector<double>>
+   runIndependentFits(std::size_t nTasks, std::function<std::vector<double>(std::size_t)> const &fitTask);
+
    // constructor helper functions
    void initMinimizerFirstPart();
    void initMinimizerFcnDependentPart(double defaultErrorLevel);
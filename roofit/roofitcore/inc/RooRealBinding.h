@@ -18,6 +18,9 @@
 
 #include "RooAbsFunc.h"
 #include "RooSpan.h"
+
+#include <ROOT/RSpan.hxx>
+
 #include <vector>
 #include <memory>
 
@@ -35,6 +38,7 @@ public:
   double operator()(const double xvector[]) const override;
   virtual RooSpan<const double> getValues(std::vector<RooSpan<const double>> coordinates) const;
   RooSpan<const double> getValuesOfBoundFunction(RooBatchCompute::RunContext& evalData) const;
+  bool getValues(std::span<const double> x0, const double xvector[], std::span<double> out) const;
   double getMinLimit(UInt_t dimension) const override;
   double getMaxLimit(UInt_t dimension) const override;
 
@@ -51,6 +55,7 @@ public:
 protected:
 
   void loadValues(const double xvector[]) const;
+  bool createBatchEvaluator() const;
   const RooAbsReal *_func;
   std::vector<RooAbsRealLValue*> _vars; ///< Non-owned pointers to variables
   const RooArgSet *_nset;
@@ -64,6 +69,10 @@ protected:
   mutable double _funcSave ; ///<!
   mutable std::unique_ptr<RooBatchCompute::RunContext> _evalData; ///< Memory for batch evaluations
 
+  struct BatchEvaluator;
+  mutable std::unique_ptr<BatchEvaluator> _batchEvaluator; ///<! Clone of the function evaluated by a RooFitDriver
+  mutable bool _batchEvaluationFailed = false; ///<! The function can't be evaluated in batches
+
   ClassDefOverride(RooRealBinding,0) // Function binding to RooAbsReal object
 };
 
@@ -26,6 +26,8 @@
 #include "Rtypes.h"
 
 #include <list>
+#include <map>
+#include <string>
 #include <vector>
 #include <algorithm>
 
@@ -88,6 +90,7 @@ public:
   /// Everything in this group might change without warning.
   /// @{
   ArraysStruct getArrays() const;
+  void appendColumns(std::map<std::string, std::vector<double>> &columns);
   void recomputeSumWeight();
   /// @}
 
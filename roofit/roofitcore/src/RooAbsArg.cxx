@@ -98,6 +98,7 @@ for single nodes.
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <unordered_set>
 
 using namespace std;
 
@@ -519,15 +520,31 @@ void RooAbsArg::branchNodeServerList(RooAbsCollection* list, const RooAbsArg* ar
 
 void RooAbsArg::treeNodeServerList(RooAbsCollection* list, const RooAbsArg* arg, bool doBranch, bool doLeaf, bool valueOnly, bool recurseFundamental) const
 {
-//   if (arg==0) {
-//     cout << "treeNodeServerList(" << GetName() << ") doBranch=" << (doBranch?"T":"F") << " doLeaf = " << (doLeaf?"T":"F") << " valueOnly=" << (valueOnly?"T":"F") << endl ;
-//   }
-
   if (!arg) {
     list->reserve(10);
     arg=this ;
   }
 
+  // A RooArgSet does not take the same node twice, so the servers of a node
+  // that was already visited through another client don't need to be visited
+  // again. Without this, shared subgraphs are traversed once per path, which
+  // explodes for large models with many shared parameters.
+  std::unordered_set<const RooAbsArg*> visited;
+  treeNodeServerListImpl(list, arg, doBranch, doLeaf, valueOnly, recurseFundamental,
+                         dynamic_cast<RooArgSet*>(list) ? &visited : nullptr);
+}
+
+
+/// Private helper function for RooAbsArg::treeNodeServerList(). If `visited`
+/// is not null, nodes that are in `visited` are skipped.
+void RooAbsArg::treeNodeServerListImpl(RooAbsCollection* list, const RooAbsArg* arg, bool doBranch, bool doLeaf,
+                                       bool valueOnly, bool recurseFundamental,
+                                       std::unordered_set<const RooAbsArg*> *visited)
+{
+  if (visited && !visited->insert(arg).second) {
+    return;
+  }
+
   // Decide if to add current node
   if ((doBranch&&doLeaf) ||
       (doBranch&&arg->isDerived()) ||
@@ -546,7 +563,7 @@ void RooAbsArg::treeNodeServerList(RooAbsCollection* list, const RooAbsArg* arg,
       if (valueOnly && !isValueSrv) {
         continue ;
       }
-      treeNodeServerList(list,server,doBranch,doLeaf,valueOnly,recurseFundamental) ;
+      treeNodeServerListImpl(list,server,doBranch,doLeaf,valueOnly,recurseFundamental,visited) ;
     }
   }
 }
@@ -1231,23 +1248,22 @@ RooAbsArg *RooAbsArg::findNewServer(const RooAbsCollection &newSet, bool nameCha
     TString nameAttrib("ORIGNAME:") ;
     nameAttrib.Append(GetName()) ;
 
-    if (auto tmp = std::unique_ptr<RooAbsCollection>{newSet.selectByAttrib(nameAttrib,true)}) {
-
-      // Check if any match was found
-      if (tmp->empty()) {
-        return nullptr;
-      }
-
-      // Check if match is unique
-      if(tmp->size()>1) {
-        coutF(LinkStateMgmt) << "RooAbsArg::redirectServers(" << GetName() << "): FATAL Error, " << tmp->size() << " servers with "
-            << nameAttrib << " attribute" << endl ;
-        tmp->Print("v") ;
-        assert(0) ;
+    // Look for the attribute directly instead of going through
+    // selectByAttrib(), which creates a new collection for every server
+    std::size_t nMatches = 0;
+    for (RooAbsArg *arg : newSet) {
+      if (arg->getAttribute(nameAttrib)) {
+        if (!newServer) newServer = arg;
+        ++nMatches;
       }
+    }
 
-      // use the unique element in the set
-      newServer= tmp->first();
+    // Check if match is unique
+    if(nMatches>1) {
+      coutF(LinkStateMgmt) << "RooAbsArg::redirectServers(" << GetName() << "): FATAL Error, " << nMatches << " servers with "
+          << nameAttrib << " attribute" << endl ;
+      std::unique_ptr<RooAbsCollection>{newSet.selectByAttrib(nameAttrib,true)}->Print("v") ;
+      assert(0) ;
     }
   }
   return newServer;
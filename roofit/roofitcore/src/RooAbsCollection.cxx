@@ -49,6 +49,7 @@ implemented using the container denoted by RooAbsCollection::Storage_t.
 #include <iostream>
 #include <fstream>
 #include <memory>
+#include <unordered_set>
 
 ClassImp(RooAbsCollection);
 
@@ -673,6 +674,20 @@ bool RooAbsCollection::remove(const RooAbsCollection& list, bool /*silent*/, boo
     _list.erase(std::remove_if(_list.begin(), _list.end(), nameMatchAndMark), _list.end());
 
   }
+  else if (list.size() >= _sizeThresholdForMapSearch) {
+    // containsInstance() is a linear search for lists, which would make
+    // removing a large list quadratic
+    const std::unordered_set<const RooAbsArg*> toRemove(list._list.begin(), list._list.end());
+    auto argMatchAndMark = [&toRemove, &markedItems](const RooAbsArg* elm) {
+      if( toRemove.find(elm) != toRemove.end() ) {
+        markedItems.push_back(elm);
+        return true;
+      }
+      return false;
+    };
+
+    _list.erase(std::remove_if(_list.begin(), _list.end(), argMatchAndMark), _list.end());
+  }
   else {
     auto argMatchAndMark = [&list, &markedItems](const RooAbsArg* elm) {
       if( list.containsInstance(*elm) ) {
@@ -30,6 +30,8 @@
 #include "RooConstVar.h"
 #include "RooDataHist.h"
 #include "RooGlobalFunc.h"
+#include "RooNumber.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 bool RooBinWidthFunction::_enabled = true;
 
@@ -119,6 +121,31 @@ void RooBinWidthFunction::computeBatch(double* output, size_t, RooFit::Detail::D
   }
 }
 
+/// Declare the array of the bin volumes (or inverse volumes) in the squashed
+/// code, and look up the volume of the bin of the current observable values.
+void RooBinWidthFunction::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  if (!_enabled) {
+    ctx.addResult(this, "1.0");
+    return;
+  }
+
+  const RooDataHist &dataHist = _histFunc->dataHist();
+  std::string const &idxName = dataHist.calculateTreeIndexForCodeSquash(this, ctx, _histFunc->variables());
+
+  std::string widthsName = ctx.makeValidVarName(GetName()) + "_BinWidths";
+  std::string arrayDecl = "double " + widthsName + "[" + std::to_string(dataHist.numEntries()) + "] = {";
+  for (int i = 0; i < dataHist.numEntries(); ++i) {
+    const double volume = dataHist.binVolume(i);
+    arrayDecl += " " + RooNumber::toString(_divideByBinWidth ? 1. / volume : volume) + ",";
+  }
+  arrayDecl.back() = ' ';
+  arrayDecl += "};\n";
+  ctx.addToCodeBody(arrayDecl, true);
+
+  ctx.addResult(this, widthsName + "[" + idxName + "]");
+}
+
 
 std::unique_ptr<RooAbsArg>
 RooBinWidthFunction::compileForNormSet(RooArgSet const &normSet, RooFit::Detail::CompileContext &ctx) const
@@ -995,7 +995,7 @@ std::string RooDataHist::declWeightArrayForCodeSquash(RooAbsArg const *klass, Ro
 
    std::string arrayDecl = "double " + weightName + "[" + std::to_string(_arrSize) + "] = {";
    for (Int_t i = 0; i < _arrSize; i++) {
-      arrayDecl += " " + std::to_string(_wgt[i]) + (correctForBinSize ? " / " + std::to_string(_binv[i]) : "") + ",";
+      arrayDecl += " " + RooNumber::toString(_wgt[i]) + (correctForBinSize ? " / " + RooNumber::toString(_binv[i]) : "") + ",";
    }
    arrayDecl.back() = ' ';
    arrayDecl += "};\n";
@@ -125,7 +125,6 @@
 #include "RooUniformBinning.h"
 
 #include "TClass.h"
-#include "TComplex.h"
 #include "TVirtualFFT.h"
 
 #include <iostream>
@@ -513,36 +512,35 @@ void RooFFTConvPdf::fillCacheSlice(FFTCacheElem& aux, const RooArgSet& slicePos)
 
 
   // Retrieve previously defined FFT transformation plans
-  if (!aux.fftr2c1) {
-    aux.fftr2c1.reset(TVirtualFFT::FFT(1, &N2, "R2CK"));
-    aux.fftr2c2.reset(TVirtualFFT::FFT(1, &N2, "R2CK"));
+  if (!aux.fftr2c) {
+    aux.fftr2c.reset(TVirtualFFT::FFT(1, &N2, "R2CK"));
     aux.fftc2r.reset(TVirtualFFT::FFT(1, &N2, "C2RK"));
 
-    if (aux.fftr2c1 == nullptr || aux.fftr2c2 == nullptr || aux.fftc2r == nullptr) {
+    if (aux.fftr2c == nullptr || aux.fftc2r == nullptr) {
       coutF(Eval) << "RooFFTConvPdf::fillCacheSlice(" << GetName() << "Cannot get a handle to fftw. Maybe ROOT was built without it?" << std::endl;
       throw std::runtime_error("Cannot get a handle to fftw.");
     }
   }
 
-  // Real->Complex FFT Transform on p.d.f. 1 sampling
-  aux.fftr2c1->SetPoints(input1.data());
-  aux.fftr2c1->Transform();
-
-  // Real->Complex FFT Transform on p.d.f 2 sampling
-  aux.fftr2c2->SetPoints(input2.data());
-  aux.fftr2c2->Transform();
+  // Real->Complex FFT Transform on both p.d.f. samplings at once
+  const Int_t nout = N2/2+1 ;
+  std::vector<double> input(input1) ;
+  input.insert(input.end(), input2.begin(), input2.end()) ;
+  std::vector<double> output(4*nout) ;
+  aux.fftr2c->TransformMany(2, input.data(), output.data()) ;
 
   // Loop over first half +1 of complex output results, multiply
   // and set as input of reverse transform
-  for (Int_t i=0 ; i<N2/2+1 ; i++) {
-    double re1,re2,im1,im2 ;
-    aux.fftr2c1->GetPointComplex(i,re1,im1) ;
-    aux.fftr2c2->GetPointComplex(i,re2,im2) ;
-    double re = re1*re2 - im1*im2 ;
-    double im = re1*im2 + re2*im1 ;
-    TComplex t(re,im) ;
-    aux.fftc2r->SetPointComplex(i,t) ;
+  const double* output1 = output.data() ;
+  const double* output2 = output.data() + 2*nout ;
+  std::vector<double> product(2*nout) ;
+  for (Int_t i=0 ; i<nout ; i++) {
+    double re1 = output1[2*i], im1 = output1[2*i+1] ;
+    double re2 = output2[2*i], im2 = output2[2*i+1] ;
+    product[2*i] = re1*re2 - im1*im2 ;
+    product[2*i+1] = re1*im2 + re2*im1 ;
   }
+  aux.fftc2r->SetPoints(product.data()) ;
 
   // Reverse Complex->Real FFT transform product
   aux.fftc2r->Transform() ;
@@ -38,9 +38,18 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 #include "RooFit/BatchModeDataHelpers.h"
 #include "RooFit/BatchModeHelpers.h"
 #include <RooSimultaneous.h>
+#include <RooAddModel.h>
+#include <RooAddPdf.h>
+#include "RooNormalizedPdf.h"
 
 #include <TList.h>
+#include <TROOT.h>
 
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
+
+#include <algorithm>
 #include <iomanip>
 #include <numeric>
 #include <thread>
@@ -90,6 +99,17 @@ void logArchitectureInfo(RooFit::BatchModeOption batchMode)
    }
 }
 
+/// Whether the computeBatch() function of a node only reads its inputs from
+/// the data map and forwards them to a RooBatchCompute kernel, such that
+/// independent nodes of this kind can be computed concurrently. This is the
+/// case of the nodes that can be computed with CUDA, except the ones that
+/// update caches of their own or log evaluation errors.
+bool canComputeBatchConcurrently(RooAbsArg const &arg)
+{
+   return arg.canComputeBatchWithCuda() && !arg.isReducerNode() && !dynamic_cast<RooAddPdf const *>(&arg) &&
+          !dynamic_cast<RooAddModel const *>(&arg) && !dynamic_cast<RooNormalizedPdf const *>(&arg);
+}
+
 } // namespace
 
 /// A struct used by the RooFitDriver to store information on the RooAbsArgs in
@@ -116,6 +136,8 @@ struct NodeInfo {
    bool isVariable = false;
    bool isDirty = true;
    bool isCategory = false;
+   bool isConcurrent = false; ///< Whether the node can be computed concurrently with other nodes
+   std::size_t depth = 0;     ///< Length of the longest path from this node to a leaf of the graph
    std::size_t outputSize = 1;
    std::size_t lastSetValCount = std::numeric_limits<std::size_t>::max();
    double scalarBuffer = 0.0;
@@ -131,6 +153,12 @@ struct NodeInfo {
 ///            computation graph that we want to evaluate.
 /// \param[in] batchMode The computation mode, accepted values are
 ///            `RooBatchCompute::Cpu` and `RooBatchCompute::Cuda`.
+///
+/// In CUDA mode, the driver allocates its buffers and runs its kernels on the
+/// CUDA device that is current for the calling thread at construction, even if
+/// it is evaluated later by another thread. Independent fits, e.g. of toy
+/// datasets, can therefore use several GPUs by creating their likelihoods after
+/// `RooFit::Detail::CudaInterface::setDevice()`.
 RooFitDriver::RooFitDriver(const RooAbsReal &absReal, RooFit::BatchModeOption batchMode)
    : _topNode{const_cast<RooAbsReal &>(absReal)}, _batchMode{batchMode}
 {
@@ -182,14 +210,28 @@ RooFitDriver::RooFitDriver(const RooAbsReal &absReal, RooFit::BatchModeOption ba
             auto *serverInfo = nodeInfos.at(server);
             info.serverInfos.emplace_back(serverInfo);
             serverInfo->clientInfos.emplace_back(&info);
+            // The servers come first in the sorted graph, their depth is known
+            info.depth = std::max(info.depth, serverInfo->depth + 1);
          }
       }
    }
 
+   // Group the nodes by depth: the nodes of one group don't depend on each
+   // other and can be computed concurrently.
+   for (NodeInfo &info : _nodes) {
+      if (info.depth >= _nodeLevels.size()) {
+         _nodeLevels.resize(info.depth + 1);
+      }
+      _nodeLevels[info.depth].push_back(&info);
+   }
+
    syncDataTokens();
 
 #ifdef R__HAS_CUDA
    if (_batchMode == RooFit::BatchModeOption::Cuda) {
+      _cudaDevice = CudaInterface::getDevice();
+      oocxcoutI(static_cast<RooAbsArg *>(nullptr), Fitting)
+         << "using CUDA device " << _cudaDevice << " of " << CudaInterface::getDeviceCount() << std::endl;
       // create events and streams for every node
       for (auto &info : _nodes) {
          info.event = std::make_unique<CudaInterface::CudaEvent>(false);
@@ -262,6 +304,9 @@ void RooFitDriver::setData(DataSpansMap const &dataSpans)
 
    for (auto &info : _nodes) {
       info.outputSize = outputSizeMap.at(info.absArg);
+      // Only the nodes computing a batch of values are worth running concurrently
+      info.isConcurrent = !info.isScalar() && !info.fromDataset && !info.isVariable && !info.isCategory &&
+                          canComputeBatchConcurrently(*info.absArg);
 
       // In principle we don't need dirty flag propagation because the driver
       // takes care of deciding which node needs to be re-evaluated. However,
@@ -278,9 +323,13 @@ void RooFitDriver::setData(DataSpansMap const &dataSpans)
    if (_batchMode != RooFit::BatchModeOption::Cuda)
       return;
 
-   // copy observable data to the GPU
+   CudaInterface::setDevice(_cudaDevice);
+
+   // copy observable data to the GPU, in a single transfer from pinned memory
+   // instead of one pageable transfer per observable
    // TODO: use separate buffers here
    _cudaMemDataset = std::make_unique<CudaInterface::DeviceArray<double>>(totalSize);
+   CudaInterface::PinnedHostArray<double> stagingArea(totalSize);
    size_t idx = 0;
    for (auto &info : _nodes) {
       if (!info.fromDataset)
@@ -291,10 +340,12 @@ void RooFitDriver::setData(DataSpansMap const &dataSpans)
          _dataMapCUDA.set(info.absArg, _dataMapCPU.at(info.absArg));
       } else {
          _dataMapCUDA.set(info.absArg, {_cudaMemDataset->data() + idx, size});
-         CudaInterface::copyHostToDevice(_dataMapCPU.at(info.absArg).data(), _cudaMemDataset->data() + idx, size);
+         auto const &span = _dataMapCPU.at(info.absArg);
+         std::copy(span.begin(), span.end(), stagingArea.data() + idx);
          idx += size;
       }
    }
+   CudaInterface::copyHostToDevice(stagingArea.data(), _cudaMemDataset->data(), idx);
 
    markGPUNodes();
 #endif // R__HAS_CUDA
@@ -320,12 +371,13 @@ std::vector<double> RooFitDriver::getValues()
    return out;
 }
 
-void RooFitDriver::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
+/// Sets the output buffer of a node computed on the CPU in the data map,
+/// allocating it if needed, and returns it. The buffer manager is not thread
+/// safe, so this is always called from the thread running getVal().
+double *RooFitDriver::prepareCPUNode(const RooAbsArg *node, NodeInfo &info)
 {
    using namespace Detail;
 
-   auto nodeAbsReal = static_cast<RooAbsReal const *>(node);
-
    const std::size_t nOut = info.outputSize;
 
    double *buffer = nullptr;
@@ -358,6 +410,16 @@ void RooFitDriver::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
       buffer = info.buffer->cpuWritePtr();
    }
    _dataMapCPU.set(node, {buffer, nOut});
+   return buffer;
+}
+
+void RooFitDriver::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
+{
+   auto nodeAbsReal = static_cast<RooAbsReal const *>(node);
+
+   const std::size_t nOut = info.outputSize;
+
+   double *buffer = prepareCPUNode(node, info);
    nodeAbsReal->computeBatch(buffer, nOut, _dataMapCPU);
 #ifdef R__HAS_CUDA
    if (info.copyAfterEvaluation) {
@@ -394,6 +456,26 @@ void RooFitDriver::setClientsDirty(NodeInfo &nodeInfo)
    }
 }
 
+/// Recomputes a dirty node on the CPU and flags its clients dirty. The clients
+/// of a scalar node are only flagged if its value actually changed. Like this,
+/// the evaluation stops early in the parts of the graph that are not affected
+/// by a parameter change, e.g. the constraint terms in a numerical derivative
+/// with respect to another parameter, or nodes that clip their inputs.
+void RooFitDriver::processDirtyNode(NodeInfo &nodeInfo)
+{
+   if (nodeInfo.isScalar()) {
+      const double oldValue = nodeInfo.scalarBuffer;
+      computeCPUNode(nodeInfo.absArg, nodeInfo);
+      if (nodeInfo.scalarBuffer != oldValue) {
+         setClientsDirty(nodeInfo);
+      }
+   } else {
+      setClientsDirty(nodeInfo);
+      computeCPUNode(nodeInfo.absArg, nodeInfo);
+   }
+   nodeInfo.isDirty = false;
+}
+
 /// Returns the value of the top node in the computation graph
 double RooFitDriver::getVal()
 {
@@ -404,6 +486,11 @@ double RooFitDriver::getVal()
       return getValHeterogeneous();
    }
 #endif
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      return getValMultiThreaded();
+   }
+#endif
 
    for (auto &nodeInfo : _nodes) {
       if (!nodeInfo.fromDataset) {
@@ -411,9 +498,7 @@ double RooFitDriver::getVal()
             processVariable(nodeInfo);
          } else {
             if (nodeInfo.isDirty) {
-               setClientsDirty(nodeInfo);
-               computeCPUNode(nodeInfo.absArg, nodeInfo);
-               nodeInfo.isDirty = false;
+               processDirtyNode(nodeInfo);
             }
          }
       }
@@ -423,11 +508,65 @@ double RooFitDriver::getVal()
    return _dataMapCPU.at(&topNode())[0];
 }
 
+#ifdef R__USE_IMT
+
+/// Returns the value of the top node in the computation graph, computing
+/// independent nodes concurrently with the implicit multi-threading pool.
+/// The nodes are visited by depth in the graph: the nodes of the same depth
+/// don't depend on each other. The dirty flags, the variables and the nodes
+/// whose evaluation is not thread safe are processed in the calling thread,
+/// the other dirty nodes of a given depth are computed in parallel. Each of
+/// them can in turn split its events among the threads in RooBatchCompute.
+double RooFitDriver::getValMultiThreaded()
+{
+   std::vector<NodeInfo *> concurrentNodes;
+
+   for (auto &level : _nodeLevels) {
+      concurrentNodes.clear();
+      for (NodeInfo *nodeInfo : level) {
+         if (nodeInfo->fromDataset) {
+            continue;
+         }
+         if (nodeInfo->isVariable) {
+            processVariable(*nodeInfo);
+         } else if (nodeInfo->isDirty && nodeInfo->isConcurrent) {
+            setClientsDirty(*nodeInfo);
+            prepareCPUNode(nodeInfo->absArg, *nodeInfo);
+            concurrentNodes.push_back(nodeInfo);
+            nodeInfo->isDirty = false;
+         } else if (nodeInfo->isDirty) {
+            processDirtyNode(*nodeInfo);
+         }
+      }
+
+      auto computeNode = [this](NodeInfo *nodeInfo) {
+         const std::size_t nOut = nodeInfo->outputSize;
+         double *buffer = nodeInfo->buffer->cpuWritePtr();
+         static_cast<RooAbsReal const *>(nodeInfo->absArg)->computeBatch(buffer, nOut, _dataMapCPU);
+      };
+
+      if (concurrentNodes.size() == 1) {
+         computeNode(concurrentNodes.front());
+      } else if (concurrentNodes.size() > 1) {
+         ROOT::TThreadExecutor executor;
+         executor.Foreach(computeNode, concurrentNodes);
+      }
+   }
+
+   // return the final value
+   return _dataMapCPU.at(&topNode())[0];
+}
+
+#endif // R__USE_IMT
+
 #ifdef R__HAS_CUDA
 
 /// Returns the value of the top node in the computation graph
 double RooFitDriver::getValHeterogeneous()
 {
+   // the minimizer might call us from another thread than the one that created the driver
+   CudaInterface::setDevice(_cudaDevice);
+
    for (auto &info : _nodes) {
       info.remClients = info.clientInfos.size();
       info.remServers = info.serverInfos.size();
@@ -69,10 +69,15 @@ private:
 
    void processVariable(NodeInfo &nodeInfo);
    void setClientsDirty(NodeInfo &nodeInfo);
+   void processDirtyNode(NodeInfo &nodeInfo);
+   double *prepareCPUNode(const RooAbsArg *node, NodeInfo &info);
    void computeCPUNode(const RooAbsArg *node, NodeInfo &info);
    void setOperMode(RooAbsArg *arg, RooAbsArg::OperMode opMode);
    void syncDataTokens();
 
+#ifdef R__USE_IMT
+   double getValMultiThreaded();
+#endif
 #ifdef R__HAS_CUDA
    double getValHeterogeneous();
    void markGPUNodes();
@@ -89,6 +94,7 @@ private:
    int _getValInvocations = 0;
 #ifdef R__HAS_CUDA
    std::unique_ptr<RooFit::Detail::CudaInterface::DeviceArray<double>> _cudaMemDataset;
+   int _cudaDevice = 0; ///< The CUDA device of the calling thread when the driver was created
 #endif
 
    // used for preserving static info about the computation graph
@@ -100,6 +106,10 @@ private:
    // the ordered computation graph
    std::vector<NodeInfo> _nodes;
 
+   // the nodes grouped by depth in the computation graph, the nodes of a group
+   // being independent of each other
+   std::vector<std::vector<NodeInfo *>> _nodeLevels;
+
    // used for preserving resources
    std::stack<std::vector<double>> _vectorBuffers;
 
@@ -69,6 +69,7 @@ RooFuncWrapper::RooFuncWrapper(const RooFuncWrapper &other, const char *name)
      _func(other._func),
      _grad(other._grad),
      _gradientVarBuffer(other._gradientVarBuffer),
+     _gradientOutBuffer(other._gradientOutBuffer),
      _observables(other._observables)
 {
 }
@@ -167,12 +168,23 @@ void RooFuncWrapper::declareAndDiffFunction(std::string funcName, std::string co
    _grad = reinterpret_cast<Grad>(gInterpreter->ProcessLine((wrapperName + ";").c_str()));
 }
 
+/// Fill `out` with the derivatives with respect to the parameters that are
+/// currently not constant, in the order of the parameter list. This is what
+/// the RooMinimizer expects, also when some parameters were set constant after
+/// the code was generated, for example in a profile likelihood scan.
 void RooFuncWrapper::gradient(double *out) const
 {
    updateGradientVarBuffer();
-   std::fill(out, out + _params.size(), 0.0);
+   _gradientOutBuffer.assign(_params.size(), 0.0);
 
-   _grad(_gradientVarBuffer.data(), _observables.data(), out);
+   _grad(_gradientVarBuffer.data(), _observables.data(), _gradientOutBuffer.data());
+
+   std::size_t iOut = 0;
+   for (std::size_t i = 0; i < _params.size(); ++i) {
+      if (!_params[i].isConstant()) {
+         out[iOut++] = _gradientOutBuffer[i];
+      }
+   }
 }
 
 void RooFuncWrapper::updateGradientVarBuffer() const
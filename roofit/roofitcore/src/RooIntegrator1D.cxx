@@ -35,6 +35,13 @@ desired precision is reached.
 stopped early, not reaching the desired relative precision. The old (less accurate) integrator
 is available under the name OldIntegrator1D. If less precision is actually desired (to speed up the
 integration), a relative epsilon 5, 10 or more times higher than for the old integrator can be used.
+
+If the configuration parameter `batchEvaluation` is set to `On`, and the integrand is a RooRealBinding,
+all points of a refinement step are evaluated in one go with the vectorized RooBatchCompute
+functions, instead of one by one:
+```
+RooAbsReal::defaultIntegratorConfig()->getConfigSection("RooIntegrator1D").setCatLabel("batchEvaluation", "On");
+```
 **/
 
 
@@ -46,16 +53,34 @@ integration), a relative epsilon 5, 10 or more times higher than for the old int
 #include "RooRealVar.h"
 #include "RooNumber.h"
 #include "RooIntegratorBinding.h"
+#include "RooRealBinding.h"
 #include "RooNumIntConfig.h"
 #include "RooNumIntFactory.h"
 #include "RooMsgService.h"
 
 #include <cassert>
+#include <typeinfo>
+#include <vector>
 
 namespace {
 
 constexpr static int nPoints = 5;
 
+/// Evaluates the integrand at all points of the first span and writes the values to the second span
+using BatchFunc_t = std::function<void(std::span<const double>, std::span<double>)>;
+
+/// Sum of the integrand values at the points in `xArr`, which are evaluated in one go
+double sumBatch(BatchFunc_t const &func, std::vector<double> &xArr, std::vector<double> &yArr)
+{
+   yArr.resize(xArr.size());
+   func(xArr, yArr);
+   double sum = 0.;
+   for (double y : yArr) {
+      sum += y;
+   }
+   return sum;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Calculate the n-th stage of refinement of the Second Euler-Maclaurin
 /// summation rule which has the useful property of not evaluating the
@@ -63,13 +88,15 @@ constexpr static int nPoints = 5;
 /// evaluations than the trapezoidal rule. This rule can be used with
 /// a suitable change of variables to estimate improper integrals.
 
-double addMidpoints(std::function<double(double)> const &func, double savedResult, int n, double xmin, double xmax)
+double addMidpoints(BatchFunc_t const &func, double savedResult, int n, double xmin, double xmax,
+                    std::vector<double> &xArr, std::vector<double> &yArr)
 {
    const double range = xmax - xmin;
 
+   xArr.clear();
    if (n == 1) {
-      double xmid = 0.5 * (xmin + xmax);
-      return range * func(xmid);
+      xArr.push_back(0.5 * (xmin + xmax));
+      return range * sumBatch(func, xArr, yArr);
    }
 
    int it = 1;
@@ -80,14 +107,13 @@ double addMidpoints(std::function<double(double)> const &func, double savedResul
    double del = range / (3. * tnm);
    double ddel = del + del;
    double x = xmin + 0.5 * del;
-   double sum = 0;
    for (int j = 1; j <= it; j++) {
-      sum += func(x);
+      xArr.push_back(x);
       x += ddel;
-      sum += func(x);
+      xArr.push_back(x);
       x += del;
    }
-   return (savedResult + range * sum / tnm) / 3.;
+   return (savedResult + range * sumBatch(func, xArr, yArr) / tnm) / 3.;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -96,13 +122,17 @@ double addMidpoints(std::function<double(double)> const &func, double savedResul
 /// integrands that can be evaluated over its entire range, including the
 /// endpoints.
 
-double addTrapezoids(std::function<double(double)> const &func, double savedResult, int n, double xmin, double xmax)
+double addTrapezoids(BatchFunc_t const &func, double savedResult, int n, double xmin, double xmax,
+                     std::vector<double> &xArr, std::vector<double> &yArr)
 {
    const double range = xmax - xmin;
 
+   xArr.clear();
    if (n == 1) {
       // use a single trapezoid to cover the full range
-      return 0.5 * range * (func(xmin) + func(xmax));
+      xArr.push_back(xmin);
+      xArr.push_back(xmax);
+      return 0.5 * range * sumBatch(func, xArr, yArr);
    }
 
    // break the range down into several trapezoids using 2**(n-2)
@@ -110,14 +140,11 @@ double addTrapezoids(std::function<double(double)> const &func, double savedResu
    const int nInt = 1 << (n - 2);
    const double del = range / nInt;
 
-   double sum = 0.;
-   // TODO Replace by batch computation
    for (int j = 0; j < nInt; ++j) {
-      double x = xmin + (0.5 + j) * del;
-      sum += func(x);
+      xArr.push_back(xmin + (0.5 + j) * del);
    }
 
-   return 0.5 * (savedResult + range * sum / nInt);
+   return 0.5 * (savedResult + range * sumBatch(func, xArr, yArr) / nInt);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -160,14 +187,9 @@ std::pair<double, double> extrapolate(int n, double const *h, double const *s, d
    return {extrapValue, extrapError};
 }
 
-} // namespace
-
-namespace RooFit {
-namespace Detail {
-
-std::pair<double, int> integrate1d(std::function<double(double)> func, bool doTrapezoid, int maxSteps, int minStepsZero,
-                                   int fixSteps, double epsAbs, double epsRel, bool doExtrap, double xmin, double xmax,
-                                   std::span<double> hArr, std::span<double> sArr)
+std::pair<double, int> integrate1dImpl(BatchFunc_t const &func, bool doTrapezoid, int maxSteps, int minStepsZero,
+                                       int fixSteps, double epsAbs, double epsRel, bool doExtrap, double xmin,
+                                       double xmax, std::span<double> hArr, std::span<double> sArr)
 {
    assert(int(hArr.size()) == maxSteps + 2);
    assert(int(sArr.size()) == maxSteps + 2);
@@ -178,12 +200,16 @@ std::pair<double, int> integrate1d(std::function<double(double)> func, bool doTr
    std::array<double, nPoints + 1> cArr = {};
    std::array<double, nPoints + 1> dArr = {};
 
+   // The points of a refinement step and the integrand values at these points
+   std::vector<double> xArr;
+   std::vector<double> yArr;
+
    hArr[1] = 1.0;
    double zeroThresh = epsAbs / range;
    for (int j = 1; j <= maxSteps; ++j) {
       // refine our estimate using the appropriate summation rule
-      sArr[j] =
-         doTrapezoid ? addTrapezoids(func, sArr[j - 1], j, xmin, xmax) : addMidpoints(func, sArr[j - 1], j, xmin, xmax);
+      sArr[j] = doTrapezoid ? addTrapezoids(func, sArr[j - 1], j, xmin, xmax, xArr, yArr)
+                            : addMidpoints(func, sArr[j - 1], j, xmin, xmax, xArr, yArr);
 
       if (j >= minStepsZero) {
          bool allZero(true);
@@ -234,6 +260,24 @@ std::pair<double, int> integrate1d(std::function<double(double)> func, bool doTr
    return {sArr[maxSteps], maxSteps};
 }
 
+} // namespace
+
+namespace RooFit {
+namespace Detail {
+
+std::pair<double, int> integrate1d(std::function<double(double)> func, bool doTrapezoid, int maxSteps, int minStepsZero,
+                                   int fixSteps, double epsAbs, double epsRel, bool doExtrap, double xmin, double xmax,
+                                   std::span<double> hArr, std::span<double> sArr)
+{
+   auto batchFunc = [&func](std::span<const double> x, std::span<double> y) {
+      for (std::size_t i = 0; i < x.size(); ++i) {
+         y[i] = func(x[i]);
+      }
+   };
+   return integrate1dImpl(batchFunc, doTrapezoid, maxSteps, minStepsZero, fixSteps, epsAbs, epsRel, doExtrap, xmin,
+                          xmax, hArr, sArr);
+}
+
 } // namespace Detail
 } // namespace RooFit
 
@@ -258,6 +302,10 @@ void RooIntegrator1D::registerIntegrator(RooNumIntFactory& fact)
   RooRealVar maxSteps("maxSteps","Maximum number of steps",20) ;
   RooRealVar minSteps("minSteps","Minimum number of steps",999) ;
   RooRealVar fixSteps("fixSteps","Fixed number of steps",0) ;
+  RooCategory batchEval("batchEvaluation","Evaluate the integrand in batches") ;
+  batchEval.defineType("Off",0) ;
+  batchEval.defineType("On",1) ;
+  batchEval.setLabel("Off") ;
 
   std::string name = "RooIntegrator1D";
 
@@ -265,7 +313,7 @@ void RooIntegrator1D::registerIntegrator(RooNumIntFactory& fact)
       return std::make_unique<RooIntegrator1D>(function, config);
    };
 
-   fact.registerPlugin(name, creator, {sumRule,extrap,maxSteps,minSteps,fixSteps},
+   fact.registerPlugin(name, creator, {sumRule,extrap,maxSteps,minSteps,fixSteps,batchEval},
                      /*canIntegrate1D=*/true,
                      /*canIntegrate2D=*/false,
                      /*canIntegrateND=*/false,
@@ -327,6 +375,7 @@ RooIntegrator1D::RooIntegrator1D(const RooAbsFunc& function, const RooNumIntConf
   _minStepsZero = (int) configSet.getRealValue("minSteps",999) ;
   _fixSteps = (int) configSet.getRealValue("fixSteps",0) ;
   _doExtrap = (bool) configSet.getCatIndex("extrapolation",1) ;
+  _batchEvaluation = (bool) configSet.getCatIndex("batchEvaluation",0) ;
 
   if (_fixSteps>_maxSteps) {
     oocoutE(nullptr,Integration) << "RooIntegrator1D::ctor() ERROR: fixSteps>maxSteps, fixSteps set to maxSteps" << std::endl ;
@@ -356,6 +405,7 @@ RooIntegrator1D::RooIntegrator1D(const RooAbsFunc& function, double xmin, double
   _minStepsZero = (int) configSet.getRealValue("minSteps",999) ;
   _fixSteps = (int) configSet.getRealValue("fixSteps",0) ;
   _doExtrap = (bool) configSet.getCatIndex("extrapolation",1) ;
+  _batchEvaluation = (bool) configSet.getCatIndex("batchEvaluation",0) ;
 
   _useIntegrandLimits= false;
   _xmin= xmin;
@@ -459,9 +509,23 @@ double RooIntegrator1D::integral(const double *yvec)
    double output = 0.0;
    int steps = 0;
 
-   std::tie(output, steps) = RooFit::Detail::integrate1d(
-      [&](double x) { return integrand(xvec(x)); }, _rule == Trapezoid, _maxSteps, _minStepsZero, _fixSteps, _epsAbs,
-      _epsRel, _doExtrap, _xmin, _xmax, {hArr, nWorkingArr}, {sArr, nWorkingArr});
+   // Derived bindings like RooDataProjBinding don't evaluate the bound function only
+   auto realBinding = _batchEvaluation && typeid(*_function) == typeid(RooRealBinding)
+                         ? static_cast<const RooRealBinding *>(_function)
+                         : nullptr;
+   auto batchFunc = [&](std::span<const double> x, std::span<double> y) {
+      if (realBinding && realBinding->getValues(x, _x.data(), y)) {
+         return;
+      }
+      for (std::size_t i = 0; i < x.size(); ++i) {
+         double xi = x[i];
+         y[i] = integrand(xvec(xi));
+      }
+   };
+
+   std::tie(output, steps) =
+      integrate1dImpl(batchFunc, _rule == Trapezoid, _maxSteps, _minStepsZero, _fixSteps, _epsAbs, _epsRel, _doExtrap,
+                      _xmin, _xmax, {hArr, nWorkingArr}, {sArr, nWorkingArr});
 
    if (steps == _maxSteps) {
 
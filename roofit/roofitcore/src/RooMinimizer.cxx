@@ -59,6 +59,7 @@ automatic PDF optimization.
 #ifdef R__HAS_ROOFIT_MULTIPROCESS
 #include "RooFit/MultiProcess/Config.h"
 #include "RooFit/MultiProcess/ProcessTimer.h"
+#include "RooMinimizerScanJob.h"
 #endif
 
 #include "TClass.h"
@@ -67,8 +68,10 @@ automatic PDF optimization.
 #include "TGraph.h"
 #include "Fit/FitConfig.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <stdexcept> // logic_error
 
 using namespace std;
@@ -401,12 +404,16 @@ int RooMinimizer::hesse()
 /// and calculated errors are automatically
 /// propagated back the RooRealVars representing
 /// the floating parameters in the MINUIT operation.
+/// With Config::parallelScan, the errors of the different parameters are
+/// computed in parallel, see minos(const RooArgSet&).
 
 int RooMinimizer::minos()
 {
    if (_theFitter->GetMinimizer() == 0) {
       coutW(Minimization) << "RooMinimizer::minos: Error, run Migrad before Minos!" << endl;
       _status = -1;
+   } else if (_cfg.parallelScan != 0) {
+      return minos(RooArgSet{*_fcn->GetFloatParamList()});
    } else {
 
       _fcn->Synchronize(_theFitter->Config().ParamsSettings());
@@ -433,6 +440,12 @@ int RooMinimizer::minos()
 /// and calculated errors are automatically
 /// propagated back the RooRealVars representing
 /// the floating parameters in the MINUIT operation.
+///
+/// With Config::parallelScan, the errors of the different parameters are
+/// computed in parallel by RooFit::MultiProcess workers, each of them with its
+/// own copy of the minimizer. Unlike the serial computation, the parameter
+/// values are not moved to a new minimum found by MINOS: a warning is printed
+/// instead, and migrad() should be run again.
 
 int RooMinimizer::minos(const RooArgSet &minosParamList)
 {
@@ -441,6 +454,8 @@ int RooMinimizer::minos(const RooArgSet &minosParamList)
       _status = -1;
    } else if (!minosParamList.empty()) {
 
+      std::map<unsigned int, std::pair<double, double>> parallelErrors;
+
       _fcn->Synchronize(_theFitter->Config().ParamsSettings());
       profileStart();
       {
@@ -456,7 +471,9 @@ int RooMinimizer::minos(const RooArgSet &minosParamList)
             }
          }
 
-         if (paramInd.size()) {
+         if (paramInd.size() > 1 && _cfg.parallelScan != 0) {
+            parallelErrors = minosParallel(paramInd);
+         } else if (paramInd.size()) {
             // set the parameter indeces
             _theFitter->Config().SetMinosErrors(paramInd);
 
@@ -470,12 +487,57 @@ int RooMinimizer::minos(const RooArgSet &minosParamList)
       profileStop();
       _fcn->BackProp(_theFitter->Result());
 
+      // the errors computed by the workers are not in the result of the fitter
+      for (auto const &item : parallelErrors) {
+         auto &par = static_cast<RooRealVar &>((*_fcn->GetFloatParamList())[item.first]);
+         par.setAsymError(item.second.first, item.second.second);
+      }
+
       saveStatus("MINOS", _status);
    }
 
    return _status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the MINOS errors of the parameters with the given indices in
+/// parallel, see minos(const RooArgSet&). Sets the status of the minimizer and
+/// returns the lower and upper errors of each parameter.
+
+std::map<unsigned int, std::pair<double, double>> RooMinimizer::minosParallel(std::vector<unsigned int> const &paramInd)
+{
+   _theFitter->Config().SetMinimizer(_cfg.minimizerType.c_str());
+
+   auto minosTask = [&](std::size_t i) -> std::vector<double> {
+      _theFitter->Config().SetMinosErrors(std::vector<unsigned int>{paramInd[i]});
+      bool ret = _theFitter->CalculateMinosErrors();
+      auto const &result = _theFitter->Result();
+      return {ret ? double(result.Status()) : -1., result.LowerError(paramInd[i]), result.UpperError(paramInd[i]),
+              result.MinFcnValue()};
+   };
+   auto results = runIndependentFits(paramInd.size(), minosTask);
+
+   // same criterion as the estimated distance to the minimum in MIGRAD
+   const double minValue = _theFitter->Result().MinFcnValue();
+   auto const &options = _theFitter->Config().MinimizerOptions();
+   const double minTolerance = 0.002 * options.Tolerance() * options.ErrorDef();
+
+   std::map<unsigned int, std::pair<double, double>> errors;
+   _status = 0;
+   for (std::size_t i = 0; i < paramInd.size(); ++i) {
+      auto const &result = results[i];
+      if (_status == 0 && result[0] != 0.) {
+         _status = static_cast<int>(result[0]);
+      }
+      if (result[3] < minValue - minTolerance) {
+         coutW(Minimization) << "RooMinimizer::minos: a new minimum was found when computing the MINOS error of "
+                             << (*_fcn->GetFloatParamList())[paramInd[i]].GetName() << ", run MIGRAD again" << endl;
+      }
+      errors[paramInd[i]] = {result[1], result[2]};
+   }
+   return errors;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute SEEK. Changes in parameter values
 /// and calculated errors are automatically
@@ -743,6 +805,161 @@ RooPlot *RooMinimizer::contour(RooRealVar &var1, RooRealVar &var2, double n1, do
    return frame;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Profile the function at the given points of the parameters in `scanParams`:
+/// at each point, these parameters are fixed to the values of the point and
+/// the function is minimized with respect to the other floating parameters.
+///
+/// The points are split in contiguous chunks. The fit of the first point of
+/// each chunk starts from the current parameter values, which should be those
+/// of the global minimum, and each following fit starts from the result of the
+/// previous point, so the points should be ordered such that neighbours in the
+/// list are close in parameter space, like the rows of a grid. A failed fit
+/// restarts the next one from the current values. With Config::parallelScan,
+/// the chunks are fitted in parallel by RooFit::MultiProcess workers, each of
+/// them with its own copy of the minimizer and of the function.
+///
+/// \param[in] scanParams Floating parameters of the function to be scanned
+/// \param[in] points Values of the scanned parameters at each point, in the order of `scanParams`
+/// \param[out] status If not null, filled with the status of MIGRAD for each point
+/// \return The minimum of the function at each point, or an empty vector if the input is invalid.
+///
+/// The parameter values are restored at the end of the scan, but the state
+/// of the minimizer is left undefined: run migrad() again before hesse() or
+/// minos().
+
+std::vector<double> RooMinimizer::profileScan(RooArgList const &scanParams,
+                                              std::vector<std::vector<double>> const &points, std::vector<int> *status)
+{
+   RooArgList *params = _fcn->GetFloatParamList();
+
+   std::vector<RooRealVar *> scanVars;
+   std::vector<bool> scanVarsConstant;
+   for (RooAbsArg *arg : scanParams) {
+      auto *var = dynamic_cast<RooRealVar *>(params->find(arg->GetName()));
+      if (!var) {
+         coutE(Minimization) << "RooMinimizer::profileScan(" << GetName() << ") ERROR: " << arg->GetName()
+                             << " is not a floating parameter of " << _fcn->getFunctionName() << endl;
+         return {};
+      }
+      scanVars.push_back(var);
+      scanVarsConstant.push_back(var->isConstant());
+   }
+   for (auto const &point : points) {
+      if (point.size() != scanVars.size()) {
+         coutE(Minimization) << "RooMinimizer::profileScan(" << GetName() << ") ERROR: the scan points must have "
+                             << scanVars.size() << " coordinates" << endl;
+         return {};
+      }
+   }
+
+   RooArgList paramSave;
+   params->snapshot(paramSave);
+
+   // a single chunk in serial mode, twice as many chunks as workers otherwise to balance the load
+   const std::size_t nWorkers = getNScanWorkers();
+   const std::size_t nChunks = std::min(points.size(), nWorkers > 0 ? 2 * nWorkers : 1);
+
+   auto fitChunk = [&](std::size_t chunk) -> std::vector<double> {
+      const std::size_t begin = points.size() * chunk / nChunks;
+      const std::size_t end = points.size() * (chunk + 1) / nChunks;
+      params->assign(paramSave);
+
+      std::vector<double> result;
+      for (std::size_t i = begin; i < end; ++i) {
+         for (std::size_t j = 0; j < scanVars.size(); ++j) {
+            scanVars[j]->setVal(points[i][j]);
+            scanVars[j]->setConstant(true);
+         }
+         const int fitStatus = migrad();
+         result.push_back(fitStatus >= 0 ? _theFitter->Result().MinFcnValue() - _fcn->getOffset()
+                                         : std::numeric_limits<double>::quiet_NaN());
+         result.push_back(fitStatus);
+         if (fitStatus != 0) {
+            params->assign(paramSave);
+         }
+      }
+      return result;
+   };
+   auto chunkResults = runIndependentFits(nChunks, fitChunk);
+
+   params->assign(paramSave);
+   for (std::size_t j = 0; j < scanVars.size(); ++j) {
+      scanVars[j]->setConstant(scanVarsConstant[j]);
+   }
+
+   std::vector<double> values;
+   values.reserve(points.size());
+   if (status) {
+      status->clear();
+      status->reserve(points.size());
+   }
+   for (auto const &chunkResult : chunkResults) {
+      for (std::size_t i = 0; i + 1 < chunkResult.size(); i += 2) {
+         values.push_back(chunkResult[i]);
+         if (status) {
+            status->push_back(static_cast<int>(chunkResult[i + 1]));
+         }
+      }
+   }
+   return values;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of worker processes used for profileScan() and minos(), 0 in serial mode.
+
+unsigned int RooMinimizer::getNScanWorkers() const
+{
+   if (_cfg.parallelScan == 0) {
+      return 0;
+   }
+#ifdef R__HAS_ROOFIT_MULTIPROCESS
+   return _cfg.parallelScan > 0 ? _cfg.parallelScan : RooFit::MultiProcess::Config::getDefaultNWorkers();
+#else
+   throw std::logic_error("Parallel scan requested, but ROOT was not compiled with multiprocessing enabled, "
+                          "please recompile with -Droofit_multiprocess=ON for parallel evaluation");
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run `nTasks` independent fits and return their results in order. The fits
+/// are run in parallel by RooFit::MultiProcess workers, forked for this call,
+/// if Config::parallelScan is set. `fitTask(i)` runs the fit `i` on the copy of
+/// this minimizer in the worker, so it can freely change its state and the
+/// parameter values.
+
+std::vector<std::vector<double>>
+RooMinimizer::runIndependentFits(std::size_t nTasks, std::function<std::vector<double>(std::size_t)> const &fitTask)
+{
+   const unsigned int nWorkers = getNScanWorkers();
+   if (nWorkers == 0 || nTasks < 2) {
+      std::vector<std::vector<double>> results;
+      results.reserve(nTasks);
+      for (std::size_t i = 0; i < nTasks; ++i) {
+         results.push_back(fitTask(i));
+      }
+      return results;
+   }
+
+#ifdef R__HAS_ROOFIT_MULTIPROCESS
+   if (_cfg.parallelize != 0) {
+      throw std::logic_error("In RooMinimizer::runIndependentFits: parallel scans can't be combined with the "
+                             "parallelization of the likelihood, set either parallelScan or parallelize.");
+   }
+   RooFit::MultiProcess::Config::setDefaultNWorkers(nWorkers);
+
+   // Evaluate the function before forking, so that all workers share the
+   // likelihood offset if offsetting is enabled.
+   std::vector<double> values = _fcn->getParameterValues();
+   (*_fcn->getMultiGenFcn())(values.data());
+
+   RooMinimizerScanJob job(nTasks, fitTask);
+   return job.run();
+#else
+   return {};
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add parameters in metadata field to process timer
 
@@ -0,0 +1,87 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "RooMinimizerScanJob.h"
+
+#include "RooFit/MultiProcess/JobManager.h"
+#include "RooFit/MultiProcess/Messenger.h"
+#include "RooFit/MultiProcess/ProcessManager.h"
+#include "RooFit/MultiProcess/Queue.h"
+#include "RooFit/MultiProcess/types.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace {
+
+// The result messages start with the job id, as required by the JobManager,
+// followed by the task index and the values returned by the task.
+struct ResultHeader {
+   std::size_t jobId;
+   std::size_t task;
+};
+
+} // namespace
+
+RooMinimizerScanJob::RooMinimizerScanJob(std::size_t nTasks, TaskFunc evaluateTask)
+   : _evaluateTask{std::move(evaluateTask)}, _results(nTasks)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distribute all the tasks over the workers and wait for their results,
+/// which are returned in the order of the tasks.
+/// \warning Forks the worker processes if they don't exist yet.
+
+std::vector<std::vector<double>> const &RooMinimizerScanJob::run()
+{
+   // starts the workers, which never return from this call
+   auto *manager = get_manager();
+   assert(manager->process_manager().is_master());
+
+   for (std::size_t ix = 0; ix < _results.size(); ++ix) {
+      manager->queue()->add({id_, state_id_, ix});
+   }
+   _nTasksAtWorkers = _results.size();
+   if (_nTasksAtWorkers > 0) {
+      gather_worker_results();
+   }
+   return _results;
+}
+
+void RooMinimizerScanJob::evaluate_task(std::size_t task)
+{
+   assert(get_manager()->process_manager().is_worker());
+   _taskResult = _evaluateTask(task);
+}
+
+void RooMinimizerScanJob::send_back_task_result_from_worker(std::size_t task)
+{
+   ResultHeader header{id_, task};
+   const std::size_t nBytes = _taskResult.size() * sizeof(double);
+   zmq::message_t message(sizeof(ResultHeader) + nBytes);
+   auto data = static_cast<char *>(message.data());
+   std::memcpy(data, &header, sizeof(ResultHeader));
+   std::memcpy(data + sizeof(ResultHeader), _taskResult.data(), nBytes);
+   get_manager()->messenger().send_from_worker_to_master(std::move(message));
+}
+
+bool RooMinimizerScanJob::receive_task_result_on_master(const zmq::message_t &message)
+{
+   auto data = static_cast<const char *>(message.data());
+   ResultHeader header;
+   std::memcpy(&header, data, sizeof(ResultHeader));
+   const std::size_t nValues = (message.size() - sizeof(ResultHeader)) / sizeof(double);
+
+   std::vector<double> &result = _results[header.task];
+   result.resize(nValues);
+   std::memcpy(result.data(), data + sizeof(ResultHeader), nValues * sizeof(double));
+
+   --_nTasksAtWorkers;
+   return _nTasksAtWorkers == 0;
+}
@@ -0,0 +1,46 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef RooFit_RooMinimizerScanJob_h
+#define RooFit_RooMinimizerScanJob_h
+
+#include "RooFit/MultiProcess/Job.h"
+
+#include <functional>
+#include <vector>
+
+/// RooFit::MultiProcess job that runs independent fits of a RooMinimizer, like
+/// the points of a profile likelihood scan or the MINOS errors of different
+/// parameters, in the worker processes.
+///
+/// The workers are forked when run() is called for the first time, so each of
+/// them owns a copy of the minimizer and of the function in the state they had
+/// at that moment. The job must therefore be the only RooFit::MultiProcess job
+/// alive: the workers are terminated when it is destroyed.
+class RooMinimizerScanJob : public RooFit::MultiProcess::Job {
+public:
+   /// Fits task `i` on the worker and returns its results
+   using TaskFunc = std::function<std::vector<double>(std::size_t)>;
+
+   RooMinimizerScanJob(std::size_t nTasks, TaskFunc evaluateTask);
+
+   std::vector<std::vector<double>> const &run();
+
+   // Job overrides:
+   void evaluate_task(std::size_t task) override;
+   void send_back_task_result_from_worker(std::size_t task) override;
+   bool receive_task_result_on_master(const zmq::message_t &message) override;
+
+private:
+   TaskFunc _evaluateTask;
+   std::vector<double> _taskResult;                ///< Result of the last task evaluated by the worker
+   std::vector<std::vector<double>> _results;      ///< Results of all the tasks, on the master
+   std::size_t _nTasksAtWorkers = 0;
+};
+
+#endif
@@ -24,17 +24,29 @@ Class RooNumber implements numeric constants used by RooFit
 
 #include <RooNumber.h>
 
-/// @brief  Returns an std::to_string compatible number (i.e. rounds infinities back to the nearest representable
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+/// @brief  Returns a floating point literal for a number (rounding infinities back to the nearest representable
 /// value). This function is primarily used in the code-squashing for AD and as such encodes infinities to double's
 /// maximum value. We do this because 1, std::to_string cannot handle infinities correctly on some platforms
 /// (e.g. 32 bit debian) and 2, Clad (the AD tool) cannot handle differentiating std::numeric_limits::infinity directly.
+/// All the significant digits are written, such that the generated code uses exactly the same values as the
+/// original model, also for very small or very large numbers.
 std::string RooNumber::toString(double x)
 {
    int sign = isInfinite(x);
    double out = x;
    if (sign)
-      out = sign == 1 ? std::numeric_limits<double>::max() : std::numeric_limits<double>::min();
-   return std::to_string(out);
+      out = sign == 1 ? std::numeric_limits<double>::max() : std::numeric_limits<double>::lowest();
+   std::stringstream ss;
+   ss << std::setprecision(std::numeric_limits<double>::max_digits10) << out;
+   std::string str = ss.str();
+   // Make sure that the literal is not interpreted as an integer
+   if (str.find_first_of(".e") == std::string::npos)
+      str += ".0";
+   return str;
 }
 
 double &RooNumber::staticRangeEpsRel()
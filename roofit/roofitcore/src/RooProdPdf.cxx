@@ -60,6 +60,7 @@ have to appear in any specific place in the list.
 #include "RooRealIntegral.h"
 #include "RooTrace.h"
 #include "RooHelpers.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 #include "RooBatchCompute.h"
 #include "strtok.h"
 
@@ -2349,6 +2350,25 @@ public:
       _prodPdf->calculateBatch(this, *_cache, output, nEvents, dataMap);
    }
 
+   void translate(RooFit::Detail::CodeSquashContext &ctx) const override
+   {
+      if (_cache->_isRearranged) {
+         ctx.addResult(this, "(" + ctx.getResult(*_cache->_rearrangedNum) + " / " +
+                                ctx.getResult(*_cache->_rearrangedDen) + ")");
+         return;
+      }
+      // Build a (factor1 * factor2 * ...) like expression, as in RooProduct.
+      std::string result = "(";
+      for (const RooAbsArg *item : _cache->_partList) {
+         result += ctx.getResult(*item) + "*";
+      }
+      if (result.size() == 1) {
+         result += "1.0*";
+      }
+      result.back() = ')';
+      ctx.addResult(this, result);
+   }
+
    ExtendMode extendMode() const override { return _prodPdf->extendMode(); }
    double expectedEvents(const RooArgSet * /*nset*/) const override { return _prodPdf->expectedEvents(&_normSet); }
    std::unique_ptr<RooAbsReal> createExpectedEventsFunc(const RooArgSet * /*nset*/) const override
@@ -31,8 +31,14 @@ of its servers and present it as a simple array oriented interface.
 #include "RooNameReg.h"
 #include "RooMsgService.h"
 #include "RunContext.h"
+#include "RooFitDriver.h"
+#include "RooRealVar.h"
+#include "RooAbsCategoryLValue.h"
+
+#include <RooFit/Detail/NormalizationHelpers.h>
 
 #include <cassert>
+#include <stdexcept>
 
 
 
@@ -41,6 +47,21 @@ using namespace std;
 ClassImp(RooRealBinding);
 ;
 
+/// Deep clone of the bound function, which is evaluated in batches by its own
+/// RooFitDriver. The driver is not run on the original function, because it
+/// would assign its data tokens to the parameters of the original, which may
+/// be in use by another driver, e.g. the one evaluating a likelihood.
+struct RooRealBinding::BatchEvaluator {
+  RooArgSet cloneSet; ///< Owns the deep clone; declared first so that it is deleted last
+  std::unique_ptr<RooAbsReal> compiled;
+  std::unique_ptr<ROOT::Experimental::RooFitDriver> driver;
+  /// The variables and categories of the original function and their counterparts in the compiled clone
+  std::vector<std::pair<RooRealVar const *, RooRealVar *>> realVars;
+  std::vector<std::pair<RooAbsCategory const *, RooAbsCategoryLValue *>> categories;
+  /// The counterparts of the bound variables in the compiled clone, null if the clone doesn't depend on them
+  std::vector<RooRealVar *> boundVars;
+};
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Construct a lightweight function binding of RooAbsReal func to
@@ -95,6 +116,126 @@ RooRealBinding::RooRealBinding(const RooRealBinding& other, const RooArgSet* nse
 RooRealBinding::~RooRealBinding() = default;
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Create the clone of the function for batch evaluations. Returns false if
+/// the function can't be evaluated in batches.
+
+bool RooRealBinding::createBatchEvaluator() const
+{
+  for (RooAbsRealLValue *var : _vars) {
+    if (!dynamic_cast<RooRealVar *>(var)) {
+      return false;
+    }
+  }
+
+  auto evaluator = std::make_unique<BatchEvaluator>();
+  try {
+    if (RooArgSet(*_func).snapshot(evaluator->cloneSet, true)) {
+      return false;
+    }
+    auto cloneFunc = static_cast<RooAbsReal *>(evaluator->cloneSet.find(*_func));
+    evaluator->compiled = RooFit::Detail::compileForNormSet<RooAbsReal>(*cloneFunc, _nset ? *_nset : RooArgSet{});
+    evaluator->driver = std::make_unique<ROOT::Experimental::RooFitDriver>(*evaluator->compiled);
+  } catch (std::exception const &e) {
+    oocoutW(nullptr, Integration) << "RooRealBinding: cannot evaluate " << _func->GetName()
+                                  << " in batches, falling back to single evaluations: " << e.what() << endl;
+    return false;
+  }
+
+  RooArgSet origLeaves;
+  RooArgSet cloneLeaves;
+  _func->leafNodeServerList(&origLeaves);
+  evaluator->compiled->leafNodeServerList(&cloneLeaves);
+  for (RooAbsArg *cloneLeaf : cloneLeaves) {
+    RooAbsArg *origLeaf = origLeaves.find(*cloneLeaf);
+    if (!origLeaf) {
+      continue;
+    }
+    auto origVar = dynamic_cast<RooRealVar const *>(origLeaf);
+    auto cloneVar = dynamic_cast<RooRealVar *>(cloneLeaf);
+    auto origCat = dynamic_cast<RooAbsCategory const *>(origLeaf);
+    auto cloneCat = dynamic_cast<RooAbsCategoryLValue *>(cloneLeaf);
+    if (origVar && cloneVar) {
+      evaluator->realVars.emplace_back(origVar, cloneVar);
+    } else if (origCat && cloneCat) {
+      evaluator->categories.emplace_back(origCat, cloneCat);
+    }
+  }
+  for (RooAbsRealLValue *var : _vars) {
+    evaluator->boundVars.push_back(static_cast<RooRealVar *>(cloneLeaves.find(*var)));
+  }
+
+  _batchEvaluator = std::move(evaluator);
+  return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the bound function at all values `x0` of the first variable, with
+/// the other variables set to `xvector[1]`, `xvector[2]`, ... in one go, and
+/// write the results to `out`. This is used by the numeric integrators to
+/// evaluate all the points of a refinement step with RooBatchCompute instead
+/// of calling operator() for every point.
+///
+/// The function is evaluated on a clone, whose parameters are synchronized
+/// with the ones of the original function at every call. Hence, the values
+/// of the original function and of its variables are not modified.
+/// \return False if the function can't be evaluated in batches. In this case,
+/// the caller should use operator().
+
+bool RooRealBinding::getValues(std::span<const double> x0, const double xvector[], std::span<double> out) const
+{
+  assert(isValid());
+  assert(out.size() == x0.size());
+
+  if (_batchEvaluationFailed) {
+    return false;
+  }
+  if (!_batchEvaluator && !createBatchEvaluator()) {
+    _batchEvaluationFailed = true;
+    return false;
+  }
+  _ncall += x0.size();
+
+  // Parameters of the function that are invalid give a zero function everywhere
+  for (UInt_t index = 1; index < _dimension; index++) {
+    if (_clipInvalid && !_vars[index]->isValidReal(xvector[index])) {
+      std::fill(out.begin(), out.end(), 0.);
+      return true;
+    }
+  }
+
+  BatchEvaluator &evaluator = *_batchEvaluator;
+  for (auto &item : evaluator.realVars) {
+    item.second->setVal(item.first->getVal());
+  }
+  for (auto &item : evaluator.categories) {
+    item.second->setIndex(item.first->getCurrentIndex(), false);
+  }
+  for (UInt_t index = 1; index < _dimension; index++) {
+    if (evaluator.boundVars[index]) {
+      evaluator.boundVars[index]->setVal(xvector[index]);
+    }
+  }
+
+  ROOT::Experimental::RooFitDriver::DataSpansMap dataSpans;
+  if (evaluator.boundVars[0]) {
+    dataSpans[evaluator.boundVars[0]] = RooSpan<const double>{x0.data(), x0.size()};
+  }
+  evaluator.driver->setData(dataSpans);
+  const std::vector<double> results = evaluator.driver->getValues();
+
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    // A function that doesn't depend on the first variable gives a single value
+    out[i] = results.size() == 1 ? results[0] : results[i];
+    if (_clipInvalid && !_vars[0]->isValidReal(x0[i])) {
+      out[i] = 0.;
+    }
+  }
+  return true;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Save value of all variables
 
@@ -88,15 +88,9 @@ void RooRealVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
    if(!isConstant()) {
       ctx.addResult(this, GetName());
    }
-   // Just return a stringy-fied version of the const value.
-   // Formats to the maximum precision.
-   constexpr auto max_precision{std::numeric_limits<double>::digits10 + 1};
-   std::stringstream ss;
-   ss.precision(max_precision);
-   // Just use toString to make sure we do not ouput 'inf'.
-   // This is really ugly for large numbers...
-   ss << std::fixed << RooNumber::toString(_value);
-   ctx.addResult(this, ss.str());
+   // Just return a stringy-fied version of the const value, with the maximum
+   // precision. The toString function makes sure we do not ouput 'inf'.
+   ctx.addResult(this, RooNumber::toString(_value));
 }
 
 /// Return a dummy object to use when properties are not initialised.
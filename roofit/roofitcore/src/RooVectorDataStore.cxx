@@ -1359,6 +1359,61 @@ void RooVectorDataStore::recomputeSumWeight() {
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Append entries to the store, given as one vector of values per variable,
+/// keyed by the variable names. This avoids filling the entries one by one
+/// with fill(), and if the store is empty the vectors are moved into it
+/// without copying their contents. The vectors in `columns` are left empty.
+///
+/// Only stores of real-valued variables without errors are supported, a
+/// std::invalid_argument is thrown otherwise or if the columns don't match
+/// the variables of the store.
+
+void RooVectorDataStore::appendColumns(std::map<std::string, std::vector<double>> &columns)
+{
+  const std::string prefix = std::string("RooVectorDataStore::appendColumns(") + GetName() + "): ";
+  if (!_realfStoreList.empty() || !_catStoreList.empty()) {
+    throw std::invalid_argument(prefix + "only stores of real-valued variables without errors are supported");
+  }
+  if (columns.size() != _realStoreList.size()) {
+    throw std::invalid_argument(prefix + "expected " + std::to_string(_realStoreList.size()) + " columns, got " +
+                                std::to_string(columns.size()));
+  }
+  const std::size_t nNew = columns.empty() ? 0 : columns.begin()->second.size();
+  for (auto const *realVec : _realStoreList) {
+    auto found = columns.find(realVec->_nativeReal->GetName());
+    if (found == columns.end()) {
+      throw std::invalid_argument(prefix + "missing column " + realVec->_nativeReal->GetName());
+    }
+    if (found->second.size() != nNew) {
+      throw std::invalid_argument(prefix + "the columns have different sizes");
+    }
+  }
+
+  ROOT::Math::KahanSum<double> sumWeight{_sumWeight, _sumWeightCarry};
+  if (_wgtVar) {
+    for (double wgt : columns[_wgtVar->GetName()]) {
+      sumWeight += wgt;
+    }
+  } else {
+    sumWeight += static_cast<double>(nNew);
+  }
+  _sumWeight = sumWeight.Sum();
+  _sumWeightCarry = sumWeight.Carry();
+
+  const bool isEmpty = size() == 0;
+  for (auto *realVec : _realStoreList) {
+    std::vector<double> &column = columns[realVec->_nativeReal->GetName()];
+    if (isEmpty) {
+      realVec->_vec = std::move(column);
+    } else {
+      realVec->_vec.insert(realVec->_vec.end(), column.begin(), column.end());
+    }
+    column.clear();
+  }
+}
+
+
 /// Exports all arrays in this RooVectorDataStore into a simple datastructure
 /// to be used by RooFit internal export functions.
 RooVectorDataStore::ArraysStruct  RooVectorDataStore::getArrays() const {
@@ -28,7 +28,8 @@ namespace TestStatistics {
 LikelihoodGradientJob::LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood,
                                              std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean,
                                              std::size_t N_dim, RooMinimizer *minimizer)
-   : LikelihoodGradientWrapper(std::move(likelihood), std::move(calculation_is_clean), N_dim, minimizer), grad_(N_dim)
+   : LikelihoodGradientWrapper(std::move(likelihood), std::move(calculation_is_clean), N_dim, minimizer), grad_(N_dim),
+     shared_grad_(N_dim), shared_minuit_internal_x_(N_dim)
 {
    // Note to future maintainers: take care when storing the minimizer_fcn pointer. The
    // RooAbsMinimizerFcn subclasses may get cloned inside MINUIT, which means the pointer
@@ -39,7 +40,8 @@ LikelihoodGradientJob::LikelihoodGradientJob(std::shared_ptr<RooAbsL> likelihood
 
 LikelihoodGradientJob::LikelihoodGradientJob(const LikelihoodGradientJob &other)
    : MultiProcess::Job(other), LikelihoodGradientWrapper(other), grad_(other.grad_), gradf_(other.gradf_),
-     N_tasks_(other.N_tasks_), minuit_internal_x_(other.minuit_internal_x_)
+     N_tasks_(other.N_tasks_), minuit_internal_x_(other.minuit_internal_x_), shared_grad_(other.shared_grad_),
+     shared_minuit_internal_x_(other.shared_minuit_internal_x_)
 {
 }
 
@@ -127,20 +129,22 @@ bool LikelihoodGradientJob::receive_task_result_on_master(const zmq::message_t &
 
 // SYNCHRONIZATION FROM MASTER TO WORKERS (STATE)
 
+/// Write the gradient state to the memory shared with the workers and notify
+/// them of the new state, which costs the same whatever the number of
+/// parameters.
 void LikelihoodGradientJob::update_workers_state()
 {
-   // TODO optimization: only send changed parameters (now sending all)
-   zmq::message_t gradient_message(grad_.begin(), grad_.end());
-   zmq::message_t minuit_internal_x_message(minuit_internal_x_.begin(), minuit_internal_x_.end());
    ++state_id_;
-   get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, std::move(gradient_message),
-                                                             std::move(minuit_internal_x_message));
+   minuit_internal_x_.resize(shared_minuit_internal_x_.size());
+   shared_grad_.write(grad_.data(), state_id_);
+   shared_minuit_internal_x_.write(minuit_internal_x_.data(), state_id_);
+   get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, true);
 }
 
 void LikelihoodGradientJob::update_workers_state_isCalculating()
 {
    ++state_id_;
-   get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_);
+   get_manager()->messenger().publish_from_master_to_workers(id_, state_id_, isCalculating_, false);
 }
 
 void LikelihoodGradientJob::update_state()
@@ -148,26 +152,21 @@ void LikelihoodGradientJob::update_state()
    bool more;
 
    state_id_ = get_manager()->messenger().receive_from_master_on_worker<MultiProcess::State>(&more);
-
+   assert(more);
    isCalculating_ = get_manager()->messenger().receive_from_master_on_worker<bool>(&more);
-
-   if (more) {
-      auto gradient_message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>(&more);
-      assert(more);
-      auto gradient_message_begin = gradient_message.data<ROOT::Minuit2::DerivatorElement>();
-      auto gradient_message_end =
-         gradient_message_begin + gradient_message.size() / sizeof(ROOT::Minuit2::DerivatorElement);
-      std::copy(gradient_message_begin, gradient_message_end, grad_.begin());
-
-      auto minuit_internal_x_message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>(&more);
-      assert(!more);
-      auto minuit_internal_x_message_begin = minuit_internal_x_message.data<double>();
-      auto minuit_internal_x_message_end =
-         minuit_internal_x_message_begin + minuit_internal_x_message.size() / sizeof(double);
-      std::copy(minuit_internal_x_message_begin, minuit_internal_x_message_end, minuit_internal_x_.begin());
-
-      gradf_.SetupDifferentiate(minimizer_->getMultiGenFcn(), minuit_internal_x_.data(),
-                                minimizer_->fitter()->Config().ParamsSettings());
+   assert(more);
+   bool shared_state_updated = get_manager()->messenger().receive_from_master_on_worker<bool>(&more);
+   assert(!more);
+
+   if (shared_state_updated) {
+      minuit_internal_x_.resize(shared_minuit_internal_x_.size());
+      // If a read fails, the master has already written a newer state. The
+      // worker gets no task for this one and will be notified of the newer one.
+      if (shared_grad_.read(grad_.data(), state_id_) &&
+          shared_minuit_internal_x_.read(minuit_internal_x_.data(), state_id_)) {
+         gradf_.SetupDifferentiate(minimizer_->getMultiGenFcn(), minuit_internal_x_.data(),
+                                   minimizer_->fitter()->Config().ParamsSettings());
+      }
    }
 }
 
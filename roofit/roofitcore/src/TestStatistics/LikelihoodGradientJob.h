@@ -14,6 +14,7 @@
 #define ROOT_ROOFIT_TESTSTATISTICS_LikelihoodGradientJob
 
 #include "RooFit/MultiProcess/Job.h"
+#include "RooFit/MultiProcess/SharedArray.h"
 #include "RooFit/TestStatistics/LikelihoodGradientWrapper.h"
 
 #include "Math/MinimizerOptions.h"
@@ -86,6 +87,10 @@ private:
    std::size_t N_tasks_at_workers_ = 0;
    std::vector<double> minuit_internal_x_;
 
+   // the state of the gradient calculation is passed to the workers through shared memory
+   MultiProcess::SharedArray<ROOT::Minuit2::DerivatorElement> shared_grad_;
+   MultiProcess::SharedArray<double> shared_minuit_internal_x_;
+
    mutable bool isCalculating_ = false;
 };
 
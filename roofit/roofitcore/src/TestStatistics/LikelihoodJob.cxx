@@ -28,10 +28,21 @@
 namespace RooFit {
 namespace TestStatistics {
 
+namespace {
+
+std::size_t numberOfParameters(RooAbsL &likelihood)
+{
+   std::unique_ptr<RooArgSet> vars{likelihood.getParameters()};
+   return vars->size();
+}
+
+} // namespace
+
 LikelihoodJob::LikelihoodJob(
    std::shared_ptr<RooAbsL> likelihood,
    std::shared_ptr<WrapperCalculationCleanFlags> calculation_is_clean)
    : LikelihoodWrapper(std::move(likelihood), std::move(calculation_is_clean)),
+     shared_vars_(numberOfParameters(*likelihood_)),
      n_event_tasks_(MultiProcess::Config::LikelihoodJob::defaultNEventTasks),
      n_component_tasks_(MultiProcess::Config::LikelihoodJob::defaultNComponentTasks)
 {
@@ -88,12 +99,17 @@ void LikelihoodJob::update_state()
       switch (mode) {
       case update_state_mode::parameters: {
          state_id_ = get_manager()->messenger().receive_from_master_on_worker<RooFit::MultiProcess::State>();
-         auto message = get_manager()->messenger().receive_from_master_on_worker<zmq::message_t>();
-         auto message_begin = message.data<update_state_t>();
-         auto message_end = message_begin + message.size() / sizeof(update_state_t);
-         std::vector<update_state_t> to_update(message_begin, message_end);
+         std::vector<update_state_t> to_update(shared_vars_.size());
+         // If the read fails, the master has already written a newer state. The
+         // worker gets no task for this one and will be notified of the newer one.
+         if (!shared_vars_.read(to_update.data(), state_id_)) {
+            break;
+         }
          for (auto const &item : to_update) {
-            RooRealVar *rvar = (RooRealVar *)vars_.at(item.var_index);
+            auto *rvar = dynamic_cast<RooRealVar *>(vars_.at(item.var_index));
+            if (!rvar) {
+               continue;
+            }
             rvar->setVal(static_cast<double>(item.value));
             if (rvar->isConstant() != item.is_constant) {
                rvar->setConstant(static_cast<bool>(item.is_constant));
@@ -140,7 +156,9 @@ void LikelihoodJob::updateWorkersParameters()
    if (get_manager()->process_manager().is_master()) {
       bool valChanged = false;
       bool constChanged = false;
+      bool anyChanged = false;
       std::vector<update_state_t> to_update;
+      to_update.reserve(vars_.size());
       for (std::size_t ix = 0u; ix < static_cast<std::size_t>(vars_.getSize()); ++ix) {
          valChanged = !vars_[ix].isIdentical(save_vars_[ix], true);
          constChanged = (vars_[ix].isConstant() != save_vars_[ix].isConstant());
@@ -153,22 +171,26 @@ void LikelihoodJob::updateWorkersParameters()
             // copyCache is protected (so must be friend). Moved setting value to if-block below.
             //          _saveVars[ix].copyCache(&_vars[ix]);
 
-            // send message to queue (which will relay to workers)
             RooAbsReal *rar_val = dynamic_cast<RooAbsReal *>(&vars_[ix]);
             if (rar_val) {
-               double val = rar_val->getVal();
-               dynamic_cast<RooRealVar *>(&save_vars_[ix])->setVal(val);
-               bool isC = vars_[ix].isConstant();
-               to_update.push_back(update_state_t{ix, val, isC});
+               dynamic_cast<RooRealVar *>(&save_vars_[ix])->setVal(rar_val->getVal());
+               anyChanged = true;
             }
          }
+         // the workers get all values, the unchanged ones are ignored by RooRealVar::setVal
+         auto *save_val = dynamic_cast<RooAbsReal *>(&save_vars_[ix]);
+         to_update.push_back(update_state_t{ix, save_val ? save_val->getVal() : 0., save_vars_[ix].isConstant()});
       }
-      if (!to_update.empty()) {
+      if (anyChanged) {
+         if (to_update.size() != shared_vars_.size()) {
+            throw std::logic_error("in LikelihoodJob::updateWorkersParameters: the number of parameters changed!");
+         }
          ++state_id_;
-         zmq::message_t message(to_update.begin(), to_update.end());
+         // the values go through shared memory, the workers are only notified of the new state;
          // always send Job id first! This is used in worker_loop to route the
          // update_state call to the correct Job.
-         get_manager()->messenger().publish_from_master_to_workers(id_, update_state_mode::parameters, state_id_, std::move(message));
+         shared_vars_.write(to_update.data(), state_id_);
+         get_manager()->messenger().publish_from_master_to_workers(id_, update_state_mode::parameters, state_id_);
       }
    }
 }
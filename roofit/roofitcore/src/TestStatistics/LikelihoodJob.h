@@ -14,6 +14,7 @@
 #define ROOT_ROOFIT_TESTSTATISTICS_LikelihoodJob
 
 #include "RooFit/MultiProcess/Job.h"
+#include "RooFit/MultiProcess/SharedArray.h"
 #include "RooFit/MultiProcess/types.h"
 #include "RooFit/TestStatistics/LikelihoodWrapper.h"
 #include "RooArgList.h"
@@ -68,6 +69,7 @@ private:
 
    RooArgList vars_;      // Variables
    RooArgList save_vars_; // Copy of variables
+   MultiProcess::SharedArray<update_state_t> shared_vars_; // Variables as seen by the workers
 
    LikelihoodType likelihood_type_;
    std::size_t n_tasks_at_workers_ = 0;
@@ -74,6 +74,17 @@ RooBinnedL::RooBinnedL(RooAbsPdf *pdf, RooAbsData *data)
          ++biter;
       }
    }
+
+   // The observed counts don't change, so the constant log(N!) terms of the
+   // Poisson probabilities are computed once here.
+   _nObs.resize(N_events_);
+   _lnGammaNObs.resize(N_events_);
+   for (std::size_t i = 0; i < N_events_; ++i) {
+      data_->get(i);
+      _nObs[i] = data_->weight();
+      _lnGammaNObs[i] = TMath::LnGamma(_nObs[i] + 1);
+   }
+   _mu.resize(N_events_);
 }
 
 RooBinnedL::~RooBinnedL() = default;
@@ -102,15 +113,21 @@ RooBinnedL::evaluatePartition(Section bins, std::size_t /*components_begin*/, st
 
    ROOT::Math::KahanSum<double> sumWeight;
 
-   for (std::size_t i = bins.begin(N_events_); i < bins.end(N_events_); ++i) {
+   const std::size_t begin = bins.begin(N_events_);
+   const std::size_t end = bins.end(N_events_);
 
+   // First get the expected counts of all the bins, such that the Poisson
+   // terms can then be computed in a tight loop over contiguous arrays.
+   for (std::size_t i = begin; i < end; ++i) {
       data_->get(i);
+      _mu[i] = pdf_->getVal() * _binw[i];
+   }
 
-      double eventWeight = data_->weight();
+   for (std::size_t i = begin; i < end; ++i) {
 
       // Calculate log(Poisson(N|mu) for this bin
-      double N = eventWeight;
-      double mu = pdf_->getVal() * _binw[i];
+      const double N = _nObs[i];
+      const double mu = _mu[i];
 
       if (mu <= 0 && N > 0) {
 
@@ -127,9 +144,9 @@ RooBinnedL::evaluatePartition(Section bins, std::size_t /*components_begin*/, st
 
       } else {
 
-         double term = -1 * (-mu + N * log(mu) - TMath::LnGamma(N + 1));
+         double term = -1 * (-mu + N * std::log(mu) - _lnGammaNObs[i]);
 
-         sumWeight += eventWeight;
+         sumWeight += N;
          result += term;
       }
    }
@@ -1,5 +1,6 @@
 // Tests for the RooAbsCollection and derived classes
 // Authors: Stephan Hageboeck, CERN  05/2020
+#include "RooAddition.h"
 #include "RooArgSet.h"
 #include "RooRealVar.h"
 #include "RooHelpers.h"
@@ -142,3 +143,63 @@ TEST(RooArgSet, HashAssistedFind) {
   EXPECT_EQ(list.find("a"), nullptr);
   EXPECT_EQ(list.find("a'"), & list[0]);
 }
+
+TEST(RooArgList, RemoveLargeList) {
+  RooArgList list;
+  RooArgList toRemove;
+  for (unsigned int i = 0; i < 500; ++i) {
+    const std::string name = "x" + std::to_string(i);
+    auto var = std::make_unique<RooRealVar>(name.c_str(), name.c_str(), 0.);
+    if (i % 2 == 0)
+      toRemove.add(*var);
+    list.addOwned(std::move(var));
+  }
+  // Same name, different instance: must not be removed if not matching by name
+  RooRealVar otherX1{"x1", "x1", 0.};
+  toRemove.add(otherX1);
+
+  RooArgList copy{list};
+  EXPECT_TRUE(copy.remove(toRemove));
+  EXPECT_EQ(copy.size(), 250u);
+  for (RooAbsArg *arg : copy) {
+    EXPECT_FALSE(toRemove.containsInstance(*arg));
+  }
+
+  EXPECT_TRUE(copy.remove(toRemove, false, /*matchByNameOnly=*/true));
+  EXPECT_EQ(copy.size(), 249u);
+  EXPECT_EQ(copy.find("x1"), nullptr);
+}
+
+/// The servers of nodes that are shared by many clients should be listed
+/// without visiting the shared subgraphs once per path.
+TEST(RooArgSet, TreeNodeServerListOfSharedGraph) {
+  RooRealVar x{"x", "x", 1.};
+  RooRealVar y{"y", "y", 2.};
+
+  // Every layer has two nodes which both depend on both nodes of the previous
+  // layer, so the number of paths doubles with every layer.
+  constexpr int nLayers = 64;
+  std::vector<std::unique_ptr<RooAddition>> nodes;
+  RooAbsReal *a = &x;
+  RooAbsReal *b = &y;
+  for (int i = 0; i < nLayers; ++i) {
+    const std::string nameA = "a" + std::to_string(i);
+    const std::string nameB = "b" + std::to_string(i);
+    nodes.emplace_back(std::make_unique<RooAddition>(nameA.c_str(), nameA.c_str(), RooArgList{*a, *b}));
+    nodes.emplace_back(std::make_unique<RooAddition>(nameB.c_str(), nameB.c_str(), RooArgList{*a, *b}));
+    a = nodes[nodes.size() - 2].get();
+    b = nodes.back().get();
+  }
+
+  RooArgSet leaves;
+  a->leafNodeServerList(&leaves);
+  EXPECT_EQ(leaves.size(), 2u);
+
+  RooArgSet branches;
+  a->branchNodeServerList(&branches);
+  EXPECT_EQ(branches.size(), 2u * nLayers - 1);
+
+  RooArgSet all;
+  a->treeNodeServerList(&all);
+  EXPECT_EQ(all.size(), 2u * nLayers + 1);
+}
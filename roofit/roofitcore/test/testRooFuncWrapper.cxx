@@ -554,9 +554,23 @@ FactoryTestParams param10{"PoissonNoRounding",
                           1e-4,
                           /*randomizeParameters=*/true};
 
+/// Product of pdfs with a shared parameter, translated via RooFixedProdPdf.
+FactoryTestParams param11{"ProdPdf",
+                          [](RooWorkspace &ws) {
+                             ws.factory("Gaussian::gx(x[0, -10, 10], mu[0, -5, 5], sx[2, 0.1, 10])");
+                             ws.factory("Gaussian::gy(y[0, -10, 10], mu, sy[3, 0.1, 10])");
+                             ws.factory("PROD::model(gx, gy)");
+                             ws.defineSet("observables", "x,y");
+                          },
+                          [](RooAbsPdf &pdf, RooAbsData &data, RooWorkspace &, std::string const &backend) {
+                             return std::unique_ptr<RooAbsReal>{pdf.createNLL(data, RooFit::BatchMode(backend))};
+                          },
+                          1e-4,
+                          /*randomizeParameters=*/true};
+
 INSTANTIATE_TEST_SUITE_P(RooFuncWrapper, FactoryTest,
                          testing::Values(param1, param2, param3, param4, param5, param6, param7, param8, param9,
-                                         param10),
+                                         param10, param11),
                          [](testing::TestParamInfo<FactoryTest::ParamType> const &paramInfo) {
                             return paramInfo.param._name;
                          });
@@ -4,6 +4,7 @@
 #include "RooRealBinding.h"
 #include "RooRealVar.h"
 #include "RooFormulaVar.h"
+#include "RooGaussian.h"
 #include "RooIntegrator1D.h"
 #include "RooNumIntConfig.h"
 #include "RooHelpers.h"
@@ -363,3 +364,40 @@ TEST(Roo1DIntegrator, RunErf_Midpoint)
       }
    }
 }
+
+/// The batch evaluation of the integrand must give the same integrals as the
+/// evaluation point by point, and follow the changes of the parameters.
+TEST(Roo1DIntegrator, BatchEvaluation)
+{
+   RooRealVar x("x", "x", -5, 5);
+   RooRealVar mean("mean", "mean", 0.5, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 1.2, 0.1, 10);
+   RooGaussian gauss("gauss", "gauss", x, mean, sigma);
+   RooArgSet normSet{x};
+
+   RooNumIntConfig config(*RooAbsReal::defaultIntegratorConfig());
+   RooNumIntConfig configBatch(config);
+   configBatch.getConfigSection("RooIntegrator1D").setCatLabel("batchEvaluation", "On");
+
+   for (const char *rule : {"Trapezoid", "Midpoint"}) {
+      config.getConfigSection("RooIntegrator1D").setCatLabel("sumRule", rule);
+      configBatch.getConfigSection("RooIntegrator1D").setCatLabel("sumRule", rule);
+
+      RooRealBinding binding(gauss, x);
+      RooRealBinding bindingNorm(gauss, x, &normSet);
+      RooIntegrator1D integrator(binding, config);
+      RooIntegrator1D integratorBatch(binding, configBatch);
+      RooIntegrator1D integratorBatchNorm(bindingNorm, configBatch);
+
+      for (double meanVal : {0.5, -1., 2.}) {
+         mean.setVal(meanVal);
+         const double expected = std::sqrt(2. * TMath::Pi()) * sigma.getVal() *
+                                 (ROOT::Math::gaussian_cdf(x.getMax(), sigma.getVal(), meanVal) -
+                                  ROOT::Math::gaussian_cdf(x.getMin(), sigma.getVal(), meanVal));
+         const double integral = integrator.integral();
+         EXPECT_NEAR(integratorBatch.integral(), integral, 1.E-10 * integral) << rule << " for mean " << meanVal;
+         EXPECT_NEAR(integratorBatch.integral(), expected, 1.E-6 * expected) << rule << " for mean " << meanVal;
+         EXPECT_NEAR(integratorBatchNorm.integral(), 1., 1.E-6) << rule << " for mean " << meanVal;
+      }
+   }
+}
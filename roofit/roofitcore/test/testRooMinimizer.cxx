@@ -0,0 +1,131 @@
+// Tests for the profile scans and the MINOS errors of the RooMinimizer
+
+#include <RConfigure.h>
+#include <RooDataSet.h>
+#include <RooFitResult.h>
+#include <RooGaussian.h>
+#include <RooHelpers.h>
+#include <RooMinimizer.h>
+#include <RooRandom.h>
+#include <RooRealVar.h>
+
+#include "gtest_wrapper.h"
+
+#include <memory>
+#include <vector>
+
+namespace {
+
+class RooMinimizerScanTest : public testing::Test {
+protected:
+   void SetUp() override
+   {
+      RooRandom::randomGenerator()->SetSeed(1337);
+      _data.reset(_gauss.generate(_x, 1000));
+      _nll.reset(_gauss.createNLL(*_data));
+   }
+
+   double fitWithFixedMean(double mean)
+   {
+      _mean.setVal(mean);
+      _mean.setConstant(true);
+      RooMinimizer minimizer(*_nll);
+      minimizer.setPrintLevel(-1);
+      minimizer.migrad();
+      std::unique_ptr<RooFitResult> result{minimizer.save()};
+      _mean.setConstant(false);
+      return result->minNll();
+   }
+
+   RooHelpers::LocalChangeMsgLevel _changeMsgLvl{RooFit::WARNING};
+   RooRealVar _x{"x", "x", -10, 10};
+   RooRealVar _mean{"mean", "mean", 1, -5, 5};
+   RooRealVar _sigma{"sigma", "sigma", 2, 0.1, 10};
+   RooGaussian _gauss{"gauss", "gauss", _x, _mean, _sigma};
+   std::unique_ptr<RooDataSet> _data;
+   std::unique_ptr<RooAbsReal> _nll;
+   std::vector<std::vector<double>> _points{{0.6}, {0.8}, {1.0}, {1.2}, {1.4}};
+};
+
+} // namespace
+
+TEST_F(RooMinimizerScanTest, ProfileScan)
+{
+   std::vector<double> reference;
+   for (auto const &point : _points) {
+      reference.push_back(fitWithFixedMean(point[0]));
+   }
+
+   _mean.setVal(1.);
+   _sigma.setVal(2.);
+   RooMinimizer minimizer(*_nll);
+   minimizer.setPrintLevel(-1);
+   minimizer.migrad();
+   const double bestMean = _mean.getVal();
+
+   std::vector<int> status;
+   std::vector<double> values = minimizer.profileScan(RooArgList{_mean}, _points, &status);
+   ASSERT_EQ(values.size(), _points.size());
+   ASSERT_EQ(status.size(), _points.size());
+   for (std::size_t i = 0; i < _points.size(); ++i) {
+      EXPECT_EQ(status[i], 0);
+      EXPECT_NEAR(values[i], reference[i], 1e-4) << "point " << i;
+   }
+
+   // the parameters are restored after the scan
+   EXPECT_DOUBLE_EQ(_mean.getVal(), bestMean);
+   EXPECT_FALSE(_mean.isConstant());
+
+   // invalid input
+   RooHelpers::HijackMessageStream hijack(RooFit::ERROR, RooFit::Minimization);
+   EXPECT_TRUE(minimizer.profileScan(RooArgList{_mean}, {{1., 2.}}).empty());
+   EXPECT_TRUE(minimizer.profileScan(RooArgList{_x}, {{1.}}).empty());
+}
+
+#ifdef R__HAS_ROOFIT_MULTIPROCESS
+TEST_F(RooMinimizerScanTest, ProfileScanParallel)
+{
+   RooMinimizer serialMinimizer(*_nll);
+   serialMinimizer.setPrintLevel(-1);
+   serialMinimizer.migrad();
+   std::vector<double> reference = serialMinimizer.profileScan(RooArgList{_mean}, _points);
+
+   RooMinimizer::Config cfg;
+   cfg.parallelScan = 2;
+   RooMinimizer minimizer(*_nll, cfg);
+   minimizer.setPrintLevel(-1);
+   minimizer.migrad();
+
+   std::vector<int> status;
+   std::vector<double> values = minimizer.profileScan(RooArgList{_mean}, _points, &status);
+   ASSERT_EQ(values.size(), _points.size());
+   for (std::size_t i = 0; i < _points.size(); ++i) {
+      EXPECT_EQ(status[i], 0);
+      EXPECT_NEAR(values[i], reference[i], 1e-4) << "point " << i;
+   }
+}
+
+TEST_F(RooMinimizerScanTest, MinosParallel)
+{
+   RooMinimizer serialMinimizer(*_nll);
+   serialMinimizer.setPrintLevel(-1);
+   serialMinimizer.migrad();
+   serialMinimizer.minos();
+   const double meanLo = _mean.getAsymErrorLo();
+   const double meanHi = _mean.getAsymErrorHi();
+   const double sigmaLo = _sigma.getAsymErrorLo();
+   const double sigmaHi = _sigma.getAsymErrorHi();
+
+   RooMinimizer::Config cfg;
+   cfg.parallelScan = 2;
+   RooMinimizer minimizer(*_nll, cfg);
+   minimizer.setPrintLevel(-1);
+   minimizer.migrad();
+   EXPECT_EQ(minimizer.minos(), 0);
+
+   EXPECT_NEAR(_mean.getAsymErrorLo(), meanLo, 1e-3);
+   EXPECT_NEAR(_mean.getAsymErrorHi(), meanHi, 1e-3);
+   EXPECT_NEAR(_sigma.getAsymErrorLo(), sigmaLo, 1e-3);
+   EXPECT_NEAR(_sigma.getAsymErrorHi(), sigmaHi, 1e-3);
+}
+#endif
@@ -20,6 +20,8 @@
 #include <RooRealVar.h>
 #include <RooWorkspace.h>
 
+#include <TROOT.h>
+
 #include "gtest_wrapper.h"
 
 #include <memory>
@@ -535,6 +537,46 @@ TEST_P(TestStatisticTest, BinnedLikelihood)
    EXPECT_DOUBLE_EQ(prodNllVal, simNllVal);
 }
 
+#ifdef R__USE_IMT
+// Check that the multi-threaded evaluation of the computation graph in the
+// BatchMode gives the same likelihood as the single-threaded one, also after
+// changing the parameters.
+TEST(RooNLLVar, BatchModeMultiThreaded)
+{
+   using namespace RooFit;
+
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooWorkspace ws;
+   ws.factory("Gaussian::gaussA(x[-10, 10], muA[0, -5, 5], sigmaA[2.0, 0.1, 10])");
+   ws.factory("Exponential::expoA(x, cA[-0.1, -1, 0])");
+   ws.factory("SUM::modelA(fA[0.5, 0, 1] * gaussA, expoA)");
+   ws.factory("Gaussian::modelB(x, muB[1, -5, 5], sigmaB[1.5, 0.1, 10])");
+   ws.factory("SIMUL::simPdf(cat[A=0,B=1], A=modelA, B=modelB)");
+
+   auto &x = *ws.var("x");
+   auto &cat = *ws.cat("cat");
+   auto &simPdf = *ws.pdf("simPdf");
+
+   std::unique_ptr<RooDataSet> data{simPdf.generate({x, cat}, 200000)};
+
+   std::unique_ptr<RooAbsReal> nllRef{simPdf.createNLL(*data, BatchMode("cpu"))};
+   const double refVal = nllRef->getVal();
+
+   ROOT::EnableImplicitMT(4);
+   std::unique_ptr<RooAbsReal> nll{simPdf.createNLL(*data, BatchMode("cpu"))};
+   const double val = nll->getVal();
+   ws.var("muA")->setVal(0.5);
+   ws.var("sigmaB")->setVal(1.2);
+   const double valChanged = nll->getVal();
+   ROOT::DisableImplicitMT();
+
+   EXPECT_NEAR(val, refVal, 1e-10 * std::abs(refVal));
+   EXPECT_NEAR(valChanged, nllRef->getVal(), 1e-10 * std::abs(refVal));
+   EXPECT_NE(valChanged, val);
+}
+#endif
+
 INSTANTIATE_TEST_SUITE_P(RooNLLVar, TestStatisticTest, testing::Values("Off", "Cpu"),
                          [](testing::TestParamInfo<TestStatisticTest::ParamType> const &paramInfo) {
                             std::stringstream ss;
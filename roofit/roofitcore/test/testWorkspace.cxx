@@ -13,6 +13,7 @@
 
 #include "ROOT/StringUtils.hxx"
 #include "TFile.h"
+#include "TMemFile.h"
 #include "TSystem.h"
 
 #include "gtest/gtest.h"
@@ -265,3 +266,28 @@ TEST(RooWorkspace, Issue_7809)
    ASSERT_EQ(static_cast<RooProdPdf*>(ws.pdf("p3"))->pdfList().size(), 2);
    ASSERT_EQ(static_cast<RooProduct*>(ws.function("p4"))->components().size(), 2);
 }
+
+/// Clients of workspace nodes which are not in the workspace must not be
+/// written with the workspace, and must be reconnected after writing.
+TEST(RooWorkspace, ExternalClientsOnWrite)
+{
+   RooWorkspace ws{"ws"};
+   ws.factory("Gaussian::gauss(x[-10,10], mean[0], sigma[1, 0.1, 10])");
+   RooRealVar &x = *ws.var("x");
+   RooProduct external{"external", "external", RooArgList{x, *ws.var("mean")}};
+   ASSERT_TRUE(x.clients().containsByPointer(&external));
+
+   TMemFile file{"ExternalClientsOnWrite.root", "RECREATE"};
+   ASSERT_EQ(file.WriteObject(&ws, "ws"), true) << "cannot write the workspace";
+   EXPECT_TRUE(x.clients().containsByPointer(&external));
+   EXPECT_TRUE(x.valueClients().containsByPointer(&external));
+
+   std::unique_ptr<RooWorkspace> wsRead{file.Get<RooWorkspace>("ws")};
+   ASSERT_NE(wsRead, nullptr);
+   RooRealVar *xRead = wsRead->var("x");
+   ASSERT_NE(xRead, nullptr);
+   for (const RooAbsArg *client : xRead->clients()) {
+      EXPECT_STRNE(client->GetName(), "external");
+   }
+   EXPECT_NE(wsRead->pdf("gauss"), nullptr);
+}
@@ -61,6 +61,7 @@ public:
 
    bool isActive();
    void waitForEvent(CudaEvent &);
+   void synchronize();
 
 // When compiling with NVCC, we allow setting and getting the actual CUDA objects from the wrapper.
 #ifdef __CUDACC__
@@ -74,6 +75,10 @@ private:
 void cudaEventRecord(CudaEvent &, CudaStream &);
 float cudaEventElapsedTime(CudaEvent &, CudaEvent &);
 
+int getDeviceCount();
+int getDevice();
+void setDevice(int device);
+
 /// \cond ROOFIT_INTERNAL
 void copyHostToDeviceImpl(const void *src, void *dest, std::size_t n, CudaStream * = nullptr);
 void copyDeviceToHostImpl(const void *src, void *dest, std::size_t n, CudaStream * = nullptr);
@@ -88,9 +93,9 @@ void copyDeviceToHostImpl(const void *src, void *dest, std::size_t n, CudaStream
  * @param[in] stream          CudaStream for asynchronous memory transfer (optional).
  */
 template <class T>
-void copyHostToDevice(const T *src, T *dest, std::size_t n, CudaStream * = nullptr)
+void copyHostToDevice(const T *src, T *dest, std::size_t n, CudaStream *stream = nullptr)
 {
-   copyHostToDeviceImpl(src, dest, sizeof(T) * n);
+   copyHostToDeviceImpl(src, dest, sizeof(T) * n, stream);
 }
 
 /**
@@ -102,9 +107,9 @@ void copyHostToDevice(const T *src, T *dest, std::size_t n, CudaStream * = nullp
  * @param[in] stream          CudaStream for asynchronous memory transfer (optional).
  */
 template <class T>
-void copyDeviceToHost(const T *src, T *dest, std::size_t n, CudaStream * = nullptr)
+void copyDeviceToHost(const T *src, T *dest, std::size_t n, CudaStream *stream = nullptr)
 {
-   copyDeviceToHostImpl(src, dest, sizeof(T) * n);
+   copyDeviceToHostImpl(src, dest, sizeof(T) * n, stream);
 }
 
 /// \cond ROOFIT_INTERNAL
@@ -102,12 +102,16 @@ void cudaEventRecord(CudaEvent &event, CudaStream &stream)
 /**
  * Creates a new CUDA stream.
  *
+ * The stream does not synchronize with the legacy default stream, such that
+ * the work of different streams is not serialized by the synchronous CUDA
+ * calls issued in the meantime, e.g. by other libraries.
+ *
  * @return                    CudaStream object representing the new stream.
  */
 CudaStream::CudaStream()
 {
    auto stream = new cudaStream_t;
-   ERRCHECK(cudaStreamCreate(stream));
+   ERRCHECK(cudaStreamCreateWithFlags(stream, cudaStreamNonBlocking));
    _ptr.reset(stream);
 }
 
@@ -137,6 +141,44 @@ void CudaStream::waitForEvent(CudaEvent &event)
    ERRCHECK(::cudaStreamWaitEvent(*this, event, 0));
 }
 
+/**
+ * Blocks the calling host thread until all the work of this CUDA stream has completed.
+ */
+void CudaStream::synchronize()
+{
+   ERRCHECK(::cudaStreamSynchronize(*this));
+}
+
+/**
+ * Returns the number of CUDA devices.
+ */
+int getDeviceCount()
+{
+   int ret = 0;
+   ERRCHECK(::cudaGetDeviceCount(&ret));
+   return ret;
+}
+
+/**
+ * Returns the CUDA device used by the calling host thread.
+ */
+int getDevice()
+{
+   int ret = 0;
+   ERRCHECK(::cudaGetDevice(&ret));
+   return ret;
+}
+
+/**
+ * Sets the CUDA device used by the calling host thread.
+ *
+ * @param[in] device          Index of the device, between 0 and `getDeviceCount() - 1`.
+ */
+void setDevice(int device)
+{
+   ERRCHECK(::cudaSetDevice(device));
+}
+
 /**
  * Calculates the elapsed time between two CUDA events.
  *
@@ -22,6 +22,7 @@ class TGraphErrors;
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace RooStats {
 
@@ -149,6 +150,11 @@ public:
    /// set flag to close proof for every new run
    static void SetCloseProof(bool flag);
 
+   /// Evaluate the points of a fixed scan in `nWorkers` forked processes. With
+   /// one worker (the default), the points are evaluated in the calling process.
+   void SetNWorkers(unsigned int nWorkers) { fNWorkers = nWorkers; }
+   unsigned int GetNWorkers() const { return fNWorkers; }
+
 
 protected:
 
@@ -163,6 +169,15 @@ protected:
    /// run the hybrid at a single point
    HypoTestResult * Eval( HypoTestCalculatorGeneric &hc, bool adaptive , double clsTarget) const;
 
+   /// run the given points of the scan in forked processes
+   bool RunPointsMultiProcess(const std::vector<double> &xValues) const;
+
+   /// set the scanned variable and the snapshot of the null model to the given value
+   double SetScanPoint(double rVal) const;
+
+   /// add the result of a point to the HypoTestInverterResult
+   bool AddPointResult(double rVal, std::unique_ptr<HypoTestResult> result) const;
+
    /// helper functions
    static RooRealVar * GetVariableToScan(const HypoTestCalculatorGeneric &hc);
    static void CheckInputModels(const HypoTestCalculatorGeneric &hc, const RooRealVar & scanVar);
@@ -199,6 +214,7 @@ private:
    double fXmin;
    double fXmax;
    double fNumErr;
+   unsigned int fNWorkers = 1;  ///<! number of processes evaluating the points of a fixed scan
 
 protected:
 
@@ -30,6 +30,13 @@ optimally the curve. It will stop when the desired precision is obtained.
 ### CLs presciption
 The class can scan the CLs+b values or alternatively CLs. For the latter,
 call HypoTestInverter::UseCLs().
+
+### Parallel scans
+The points of a fixed scan are independent of each other. With
+HypoTestInverter::SetNWorkers(), they are evaluated in forked processes using
+ROOT::TProcessExecutor, each point with its own random seed drawn from RooRandom.
+The results are added in the order of the scan, as in a serial run. The automatic
+scan is a bisection, and it runs always in the calling process.
 */
 
 #include "RooStats/HypoTestInverter.h"
@@ -64,9 +71,15 @@ call HypoTestInverter::UseCLs().
 
 #include "RooStats/ProofConfig.h"
 
+#ifndef _MSC_VER
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <memory>
+#include <vector>
 
 ClassImp(RooStats::HypoTestInverter);
 
@@ -405,6 +418,7 @@ HypoTestInverter & HypoTestInverter::operator= (const HypoTestInverter & rhs) {
    fXmin = rhs.fXmin;
    fXmax = rhs.fXmax;
    fNumErr = rhs.fNumErr;
+   fNWorkers = rhs.fNWorkers;
 
    return *this;
 }
@@ -642,15 +656,18 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
      return false;
    }
 
-   double thisX = xMin;
-   for (int i=0; i<nBins; i++) {
+   std::vector<double> xValues(nBins, xMin);
+   for (int i=1; i<nBins; i++) { // avoids case of nBins = 1
+      if (scanLog)
+         xValues[i] = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
+      else
+         xValues[i] = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
+   }
 
-      if (i > 0) { // avoids case of nBins = 1
-         if (scanLog)
-            thisX = exp(  log(xMin) +  i*(log(xMax)-log(xMin))/(nBins-1)  );  // scan in log x
-         else
-            thisX = xMin + i*(xMax-xMin)/(nBins-1);          // linear scan in x
-      }
+   if (fNWorkers > 1 && nBins > 1)
+      return RunPointsMultiProcess(xValues);
+
+   for (double thisX : xValues) {
 
       const bool status = RunOnePoint(thisX);
 
@@ -663,6 +680,73 @@ bool HypoTestInverter::RunFixedScan( int nBins, double xMin, double xMax, bool s
    return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluates the given points of the POI in fNWorkers forked processes and
+/// adds the results in the order of the points. Every point is generated with
+/// its own random seed, drawn from the generator of the calling process. It is
+/// called from RunFixedScan() when more than one worker is set. Falls back to
+/// a serial run on platforms without ROOT::TProcessExecutor.
+
+bool HypoTestInverter::RunPointsMultiProcess(const std::vector<double> &xValues) const
+{
+#ifdef _MSC_VER
+   oocoutW(nullptr, InputArguments)
+      << "HypoTestInverter: parallel scans with forked processes are not supported on this platform, running serially."
+      << endl;
+   for (double thisX : xValues) {
+      if (!RunOnePoint(thisX))
+         oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << thisX << " failed. Skipping." << std::endl;
+   }
+   return true;
+#else
+   CreateResults();
+
+   const unsigned int nPoints = xValues.size();
+   const unsigned int nWorkers = std::max(1u, std::min(fNWorkers, nPoints));
+
+   std::vector<UInt_t> seeds(nPoints);
+   for (unsigned int i = 0; i < nPoints; ++i)
+      seeds[i] = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+
+   const double oldValue = fScannedVariable->getVal();
+
+   // runs in the forked worker processes, so changing the POI, the snapshot
+   // and the random seed doesn't affect the calling process
+   auto runPoint = [&](unsigned int i) {
+      RooRandom::randomGenerator()->SetSeed(seeds[i]);
+      SetScanPoint(xValues[i]);
+      if (fVerbose > 0)
+         oocoutP(nullptr,Eval) << "Running for " << fScannedVariable->GetName() << " = " << fScannedVariable->getVal() << endl;
+      return Eval(*fCalculator0, false, -1);
+   };
+
+   ROOT::TProcessExecutor executor(nWorkers);
+   std::vector<HypoTestResult *> results = executor.Map(runPoint, ROOT::TSeqU(nPoints));
+
+   for (unsigned int i = 0; i < nPoints; ++i) {
+      std::unique_ptr<HypoTestResult> result(results[i]);
+      // same clamping of the value as in the worker
+      const double rVal = std::max(fScannedVariable->getMin(), std::min(xValues[i], fScannedVariable->getMax()));
+      if (!result) {
+         oocoutE(nullptr,Eval) << "HypoTestInverter - Error running point " << fScannedVariable->GetName() << " = " << rVal << endl;
+      }
+      else {
+         // the toys were counted in the worker processes
+         if ((fCalcType == kFrequentist || fCalcType == kHybrid) && result->GetNullDistribution() && result->GetAltDistribution())
+            fTotalToysRun += (result->GetAltDistribution()->GetSize() + result->GetNullDistribution()->GetSize());
+         fScannedVariable->setVal(rVal);
+         if (AddPointResult(rVal, std::move(result)))
+            continue;
+      }
+      oocoutW(nullptr,Eval) << "HypoTestInverter::RunFixedScan - The hypo test for point " << xValues[i] << " failed. Skipping." << std::endl;
+   }
+
+   fScannedVariable->setVal(oldValue);
+
+   return true;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// run only one point at the given POI value
 
@@ -671,6 +755,37 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
 
    CreateResults();
 
+   // save old value
+   double oldValue = fScannedVariable->getVal();
+
+   // evaluate hybrid calculator at a single point
+   rVal = SetScanPoint(rVal);
+
+   if (fVerbose > 0)
+      oocoutP(nullptr,Eval) << "Running for " << fScannedVariable->GetName() << " = " << fScannedVariable->getVal() << endl;
+
+   // compute the results
+   std::unique_ptr<HypoTestResult> result( Eval(*fCalculator0,adaptive,clTarget) );
+   if (!result) {
+      oocoutE(nullptr,Eval) << "HypoTestInverter - Error running point " << fScannedVariable->GetName() << " = " <<
+   fScannedVariable->getVal() << endl;
+      return false;
+   }
+   if (!AddPointResult(rVal, std::move(result)))
+      return false;
+
+   fScannedVariable->setVal(oldValue);
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the scanned variable and the snapshot of the null model to the given
+/// value, after bringing it into the range of the scanned variable.
+/// Returns the value which has been set.
+
+double HypoTestInverter::SetScanPoint(double rVal) const
+{
    // check if rVal is in the range specified for fScannedVariable
    if ( rVal < fScannedVariable->getMin() ) {
       oocoutE(nullptr,InputArguments) << "HypoTestInverter::RunOnePoint - Out of range: using the lower bound "
@@ -687,10 +802,6 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
      rVal = fScannedVariable->getMax();
    }
 
-   // save old value
-   double oldValue = fScannedVariable->getVal();
-
-   // evaluate hybrid calculator at a single point
    fScannedVariable->setVal(rVal);
    // need to set value of rval in hybridcalculator
    // assume null model is S+B and alternate is B only
@@ -700,16 +811,16 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
    poi.assign(RooArgSet(*fScannedVariable));
    const_cast<ModelConfig*>(sbModel)->SetSnapshot(poi);
 
-   if (fVerbose > 0)
-      oocoutP(nullptr,Eval) << "Running for " << fScannedVariable->GetName() << " = " << fScannedVariable->getVal() << endl;
+   return rVal;
+}
 
-   // compute the results
-   std::unique_ptr<HypoTestResult> result( Eval(*fCalculator0,adaptive,clTarget) );
-   if (!result) {
-      oocoutE(nullptr,Eval) << "HypoTestInverter - Error running point " << fScannedVariable->GetName() << " = " <<
-   fScannedVariable->getVal() << endl;
-      return false;
-   }
+////////////////////////////////////////////////////////////////////////////////
+/// Check the result of the hypothesis test at the value rVal of the scanned
+/// variable and add it to the HypoTestInverterResult, merging it with the last
+/// result if it was obtained at the same value. Returns false for invalid results.
+
+bool HypoTestInverter::AddPointResult(double rVal, std::unique_ptr<HypoTestResult> result) const
+{
    // in case of a dummy result
    const double nullPV = result->NullPValue();
    const double altPV = result->AlternatePValue();
@@ -749,8 +860,6 @@ bool HypoTestInverter::RunOnePoint( double rVal, bool adaptive, double clTarget)
 
    }
 
-   fScannedVariable->setVal(oldValue);
-
    return true;
 }
 
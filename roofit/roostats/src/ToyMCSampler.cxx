@@ -27,6 +27,11 @@ TestStatistic.
 For parallel runs, ToyMCSampler can be given an instance of ProofConfig
 and then run in parallel using proof or proof-lite. Internally, it uses
 ToyMCStudy with the RooStudyManager.
+
+Without PROOF, the toys can be generated and evaluated in forked processes
+with ROOT::TProcessExecutor by setting the number of workers with
+SetNWorkers(). Each worker gets its own random seed and the sampling
+distributions of the workers are merged in the end.
 */
 
 #include "RooStats/ToyMCSampler.h"
@@ -50,6 +55,10 @@ ToyMCStudy with the RooStudyManager.
 
 #include "TMath.h"
 
+#ifndef _MSC_VER
+#include "ROOT/TProcessExecutor.hxx"
+#endif
+
 
 using namespace RooFit;
 using namespace std;
@@ -307,6 +316,8 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
 
    // ======= S I N G L E   R U N ? =======
+   if(!fProofConfig && fNWorkers > 1)
+      return GetSamplingDistributionsMultiProcess(paramPointIn);
    if(!fProofConfig)
       return GetSamplingDistributionsSingleWorker(paramPointIn);
 
@@ -350,6 +361,77 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generates the toys in fNWorkers forked processes, each running
+/// GetSamplingDistributionsSingleWorker() on its share of the toys with its
+/// own random seed, and merges their outputs. It is called automatically from
+/// inside GetSamplingDistributions when more than one worker is set and no
+/// ProofConfig is given. Falls back to a serial run on platforms without
+/// ROOT::TProcessExecutor.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsMultiProcess(RooArgSet& paramPointIn)
+{
+#ifdef _MSC_VER
+   oocoutW(nullptr, InputArguments)
+      << "ToyMCSampler: parallel generation with forked processes is not supported on this platform, running serially."
+      << endl;
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   if (!CheckConfig()){
+      oocoutE(nullptr, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << endl;
+      return nullptr;
+   }
+
+   // turn adaptive sampling off if given
+   if(fToysInTails) {
+      fToysInTails = 0;
+      oocoutW(nullptr, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+   const unsigned int nWorkers = std::max(1u, std::min(fNWorkers, static_cast<unsigned int>(std::max(fNToys, 1))));
+
+   // share the toys such that the total number stays the same, and draw the
+   // seeds of the workers from the generator of this process
+   const Int_t nWorkersInt = nWorkers;
+   std::vector<Int_t> nToys(nWorkers, fNToys / nWorkersInt);
+   std::vector<UInt_t> seeds(nWorkers);
+   for (unsigned int i = 0; i < nWorkers; ++i) {
+      if (static_cast<Int_t>(i) < fNToys % nWorkersInt) ++nToys[i];
+      seeds[i] = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+   }
+
+   // runs in the forked worker processes, so changing the state doesn't
+   // affect the calling process
+   auto generateToys = [&](unsigned int iWorker) {
+      RooRandom::randomGenerator()->SetSeed(seeds[iWorker]);
+      fNToys = nToys[iWorker];
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   };
+
+   ROOT::TProcessExecutor executor(nWorkers);
+   std::vector<RooDataSet*> outputs = executor.Map(generateToys, ROOT::TSeqU(nWorkers));
+
+   RooDataSet* output = nullptr;
+   for (RooDataSet* workerOutput : outputs) {
+      if (!workerOutput) {
+         oocoutW(nullptr, Generation) << "ToyMCSampler: a worker process returned no sampling distribution" << endl;
+         continue;
+      }
+      if (!output) {
+         output = workerOutput;
+      } else {
+         output->append(*workerOutput);
+         delete workerOutput;
+      }
+   }
+   return output;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
@@ -0,0 +1,71 @@
+// Tests for the RooStats::HypoTestInverter
+
+#include <RooStats/AsymptoticCalculator.h>
+#include <RooStats/HypoTestInverter.h>
+#include <RooStats/HypoTestInverterResult.h>
+#include <RooStats/ModelConfig.h>
+
+#include <RooDataSet.h>
+#include <RooGaussian.h>
+#include <RooHelpers.h>
+#include <RooRandom.h>
+#include <RooRealVar.h>
+#include <RooWorkspace.h>
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+#ifndef _MSC_VER
+// The points of a fixed scan evaluated in forked processes give the same
+// results, in the same order, as the serial scan.
+TEST(HypoTestInverter, MultiProcessFixedScan)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl{RooFit::WARNING};
+   RooRandom::randomGenerator()->SetSeed(1337);
+
+   RooWorkspace ws("ws");
+   ws.factory("Gaussian::gauss(x[-10, 10], mu[0, -1, 5], sigma[1])");
+   RooRealVar &x = *ws.var("x");
+   RooRealVar &mu = *ws.var("mu");
+
+   std::unique_ptr<RooDataSet> data{ws.pdf("gauss")->generate(x, 50)};
+
+   RooStats::ModelConfig sbModel("sbModel", &ws);
+   sbModel.SetPdf("gauss");
+   sbModel.SetObservables(x);
+   sbModel.SetParametersOfInterest(mu);
+   mu.setVal(1.);
+   sbModel.SetSnapshot(mu);
+
+   RooStats::ModelConfig bModel("bModel", &ws);
+   bModel.SetPdf("gauss");
+   bModel.SetObservables(x);
+   bModel.SetParametersOfInterest(mu);
+   mu.setVal(0.);
+   bModel.SetSnapshot(mu);
+
+   auto runScan = [&](unsigned int nWorkers) {
+      RooStats::AsymptoticCalculator calc(*data, bModel, sbModel);
+      calc.SetOneSided(true);
+      RooStats::HypoTestInverter inverter(calc);
+      inverter.SetConfidenceLevel(0.95);
+      inverter.UseCLs(true);
+      inverter.SetNWorkers(nWorkers);
+      inverter.SetFixedScan(5, 0., 2.);
+      return std::unique_ptr<RooStats::HypoTestInverterResult>{inverter.GetInterval()};
+   };
+
+   auto serial = runScan(1);
+   auto parallel = runScan(3);
+   ASSERT_NE(serial, nullptr);
+   ASSERT_NE(parallel, nullptr);
+   ASSERT_EQ(serial->ArraySize(), 5);
+   ASSERT_EQ(parallel->ArraySize(), serial->ArraySize());
+   for (int i = 0; i < serial->ArraySize(); ++i) {
+      EXPECT_DOUBLE_EQ(parallel->GetXValue(i), serial->GetXValue(i));
+      EXPECT_NEAR(parallel->CLs(i), serial->CLs(i), 1e-6);
+   }
+   EXPECT_NEAR(parallel->UpperLimit(), serial->UpperLimit(), 1e-6);
+}
+#endif
@@ -0,0 +1,54 @@
+// Tests for the RooStats::ToyMCSampler
+
+#include <RooStats/MaxLikelihoodEstimateTestStat.h>
+#include <RooStats/ToyMCSampler.h>
+
+#include <RooDataSet.h>
+#include <RooGaussian.h>
+#include <RooHelpers.h>
+#include <RooRandom.h>
+#include <RooRealVar.h>
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <set>
+
+#ifndef _MSC_VER
+// The toys generated in forked processes are merged into one sampling
+// distribution, and each process uses its own random numbers.
+TEST(ToyMCSampler, MultiProcess)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl{RooFit::WARNING};
+   RooRandom::randomGenerator()->SetSeed(1337);
+
+   RooRealVar x("x", "x", -10, 10);
+   RooRealVar mean("mean", "mean", 0., -5, 5);
+   RooRealVar sigma("sigma", "sigma", 1.);
+   RooGaussian gauss("gauss", "gauss", x, mean, sigma);
+
+   RooStats::MaxLikelihoodEstimateTestStat testStat(gauss, mean);
+   constexpr int nToys = 101;
+   RooStats::ToyMCSampler sampler(testStat, nToys);
+   sampler.SetPdf(gauss);
+   sampler.SetObservables(RooArgSet{x});
+   sampler.SetNEventsPerToy(20);
+   sampler.SetParametersForTestStat(RooArgSet{mean});
+   sampler.SetNWorkers(3);
+
+   RooArgSet paramPoint{mean};
+   std::unique_ptr<RooDataSet> result{sampler.GetSamplingDistributions(paramPoint)};
+   ASSERT_NE(result, nullptr);
+   ASSERT_EQ(result->numEntries(), nToys);
+
+   // the workers generated different toys
+   std::set<double> values;
+   for (int i = 0; i < result->numEntries(); ++i) {
+      values.insert(result->get(i)->getRealValue(result->get(i)->first()->GetName()));
+   }
+   EXPECT_EQ(values.size(), static_cast<std::size_t>(nToys));
+
+   // the parameters of the calling process are untouched
+   EXPECT_EQ(mean.getVal(), 0.);
+}
+#endif
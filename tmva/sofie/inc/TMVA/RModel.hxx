@@ -24,7 +24,11 @@ enum class Options {
    kDefault = 0x0,
    kNoSession = 0x1,
    kNoWeightFile = 0x2,
-   kRootBinaryWeightFile = 0x4
+   kRootBinaryWeightFile = 0x4,
+   kNoMemoryPool = 0x8,
+   kNoOperatorFusion = 0x10,
+   kCuBLAS = 0x20,
+   kInt8Weights = 0x40
 };
 
 std::underlying_type_t<Options> operator|(Options opA, Options opB);
@@ -59,6 +63,12 @@ private:
    std::unordered_set<std::string> fCustomOpHeaders;
    bool fUseWeightFile = true;
    bool fUseSession = true;
+   bool fInt8Weights = false; //! multi-dimensional weights stored as int8 in the ROOT binary weight file
+
+   bool FuseOperators(const std::vector<std::string> &operatorCode, const std::string &sessionCode);
+   std::string GenerateIntermediateTensors(bool useMemoryPool, const std::vector<std::string> &operatorCode,
+                                           const std::string &sessionCode);
+   bool IsInt8Weight(const InitializedTensor &tensor) const;
 
 public:
 
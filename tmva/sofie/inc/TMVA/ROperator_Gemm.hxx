@@ -39,6 +39,7 @@ namespace SOFIE{
       std::vector<size_t> fShapeY;
 
       std::string fType;
+      EActivationType fActivation = EActivationType::UNDEFINED; // fused activation applied to the output
 
    public:
 
@@ -65,6 +66,14 @@ namespace SOFIE{
          }
       }
 
+      const std::string &GetOutputName() const { return fNY; }
+
+      /// Apply the activation to the output, which is renamed to the output of the fused activation operator
+      void FuseActivation(EActivationType activation, std::string nameY) {
+         fActivation = activation;
+         fNY = UTILITY::Clean_name(nameY);
+      }
+
       std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
          ETensorType out = input[0];
          return {out};
@@ -223,6 +232,13 @@ namespace SOFIE{
              << OpName << "_n);\n";
           }
 
+         if (fActivation == EActivationType::RELU) {
+            size_t length = ConvertShapeToLength(fShapeY);
+            out << SP << "for (int id = 0; id < " << length << " ; id++){\n";
+            out << SP << SP << "tensor_" << fNY << "[id] = ((tensor_" << fNY << "[id] > 0 )? tensor_" << fNY << "[id] : 0);\n";
+            out << SP << "}\n";
+         }
+
           return out.str();
 
          }
@@ -26,6 +26,9 @@ public:
    ROperator_Relu(std::string nameX, std::string nameY):
       fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){}
 
+   const std::string &GetInputName() const { return fNX; }
+   const std::string &GetOutputName() const { return fNY; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
    }
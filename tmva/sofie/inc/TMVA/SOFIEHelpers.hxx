@@ -2,6 +2,7 @@
 #define TMVA_SOFIE_SOFIE_HELPERS
 
 
+#include <algorithm>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -63,6 +64,59 @@ auto SofieFunctor(unsigned int nslots = 0, const std::string & weightsFile = "")
    return SofieFunctorHelper<std::make_index_sequence<N>, Session_t, float>(nslots, weightsFile);
 }
 
+/// SofieBatchEvaluator : evaluates a model generated by SOFIE for a batch
+/// size larger than one, i.e. with `RModel::Generate(options, batchSize)`, on
+/// the inputs of many events. The events are passed to the generated
+/// `infer` function in batches of `batchSize`, such that the operators like
+/// Gemm work on matrices instead of single vectors. Incomplete batches are
+/// padded with zeros, and only the outputs of the real events are returned.
+///
+/// Since RDataFrame evaluates the defined columns event by event, the
+/// SofieFunctor can't batch events. The SofieBatchEvaluator is meant for the
+/// inputs collected from a dataframe, for example with `Take` or `AsNumpy`,
+/// or for any other buffer of inputs. Like for the SofieFunctor, one
+/// evaluator is needed per thread.
+template <typename Session_t, typename T = float>
+class SofieBatchEvaluator {
+   Session_t fSession;
+   std::size_t fBatchSize;
+   std::size_t fNInputs;
+   std::vector<T> fBatch;
+
+public:
+   /// \param batchSize Batch size the model was generated for.
+   /// \param nInputs Number of input values of a single event.
+   /// \param filename Weight file of the session.
+   SofieBatchEvaluator(std::size_t batchSize, std::size_t nInputs, const std::string &filename = "")
+      : fSession(filename), fBatchSize(batchSize), fNInputs(nInputs), fBatch(batchSize * nInputs)
+   {
+   }
+
+   /// Evaluate the model on `nEvents` events, whose inputs are stored
+   /// contiguously in `input`, and return the outputs of all the events after
+   /// each other.
+   std::vector<T> Compute(const T *input, std::size_t nEvents)
+   {
+      std::vector<T> output;
+      for (std::size_t first = 0; first < nEvents; first += fBatchSize) {
+         const std::size_t n = std::min(fBatchSize, nEvents - first);
+         const T *batch = input + first * fNInputs;
+         if (n < fBatchSize) {
+            std::copy(batch, batch + n * fNInputs, fBatch.begin());
+            std::fill(fBatch.begin() + n * fNInputs, fBatch.end(), T(0));
+            batch = fBatch.data();
+         }
+         // the generated infer function doesn't modify its input
+         auto y = fSession.infer(const_cast<T *>(batch));
+         const std::size_t nOutputs = y.size() / fBatchSize;
+         output.insert(output.end(), y.begin(), y.begin() + n * nOutputs);
+      }
+      return output;
+   }
+
+   std::vector<T> Compute(const std::vector<T> &input) { return Compute(input.data(), input.size() / fNInputs); }
+};
+
 }//Experimental
 }//TMVA
 
@@ -26,6 +26,11 @@ enum class ETensorType{
     FLOAT16 = 10, DOUBLE = 11, UINT32 = 12, UINT64 = 13, COMPLEX64 = 14, COMPLEX28 = 15, BFLOAT16 = 16
 };
 
+/// Activation functions that an operator can apply to its output
+enum class EActivationType{
+   UNDEFINED = 0, RELU = 1
+};
+
 typedef std::int64_t int_t;
 
 std::string ConvertTypeToString(ETensorType type);
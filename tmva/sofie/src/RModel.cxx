@@ -1,10 +1,13 @@
 #include <limits>
+#include <cmath>
 #include <algorithm>
 #include <cctype>
 #include <memory>
 
 #include "TMVA/RModel.hxx"
 #include "TMVA/SOFIE_common.hxx"
+#include "TMVA/ROperator_Gemm.hxx"
+#include "TMVA/ROperator_Relu.hxx"
 #include "TFile.h"
 
 namespace TMVA{
@@ -18,6 +21,83 @@ namespace SOFIE{
       return opA | static_cast<std::underlying_type_t<Options>>(opB);
    }
 
+   namespace {
+
+   bool IsIdentifierChar(char c) {
+      return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+   }
+
+   // Whether the generated code uses the variable `name`, i.e. contains it
+   // not as part of a longer identifier.
+   bool UsesVariable(const std::string &code, const std::string &name) {
+      for (auto pos = code.find(name); pos != std::string::npos; pos = code.find(name, pos + 1)) {
+         const std::size_t end = pos + name.size();
+         if ((pos == 0 || !IsIdentifierChar(code[pos - 1])) && (end == code.size() || !IsIdentifierChar(code[end])))
+            return true;
+      }
+      return false;
+   }
+
+   // Code of a BLAS::sgemm_ replacement that runs the multiplication on a
+   // CUDA device with cuBLAS. The operands are copied to device buffers that
+   // grow as needed and are kept by a per-thread context, so no allocation
+   // happens in the inference calls once the largest Gemm has been run.
+   std::string CuBLASGemmCode() {
+      return
+         "\tinline void CheckCuda(bool ok, const char * what) {\n"
+         "\t   if (!ok) throw std::runtime_error(std::string(\"TMVA-SOFIE: CUDA call failed: \") + what);\n"
+         "\t}\n"
+         "\tstruct CuBLASContext {\n"
+         "\t   cublasHandle_t handle = nullptr;\n"
+         "\t   float * buffers[3] = {nullptr, nullptr, nullptr};\n"
+         "\t   size_t sizes[3] = {0, 0, 0};\n"
+         "\t   CuBLASContext() { CheckCuda(cublasCreate(&handle) == CUBLAS_STATUS_SUCCESS, \"cublasCreate\"); }\n"
+         "\t   ~CuBLASContext() {\n"
+         "\t      for (auto * b : buffers) cudaFree(b);\n"
+         "\t      cublasDestroy(handle);\n"
+         "\t   }\n"
+         "\t   CuBLASContext(const CuBLASContext &) = delete;\n"
+         "\t   CuBLASContext & operator=(const CuBLASContext &) = delete;\n"
+         "\t   float * Buffer(int i, size_t n) {\n"
+         "\t      if (sizes[i] < n) {\n"
+         "\t         cudaFree(buffers[i]);\n"
+         "\t         buffers[i] = nullptr;\n"
+         "\t         CheckCuda(cudaMalloc(&buffers[i], n * sizeof(float)) == cudaSuccess, \"cudaMalloc\");\n"
+         "\t         sizes[i] = n;\n"
+         "\t      }\n"
+         "\t      return buffers[i];\n"
+         "\t   }\n"
+         "\t};\n"
+         "\tinline CuBLASContext & GetCuBLASContext() {\n"
+         "\t   thread_local CuBLASContext context;\n"
+         "\t   return context;\n"
+         "\t}\n"
+         "\tinline void sgemm_(const char * transa, const char * transb, const int * m, const int * n, const int * k,\n"
+         "\t                   const float * alpha, const float * A, const int * lda, const float * B, const int * ldb,\n"
+         "\t                   const float * beta, float * C, const int * ldc) {\n"
+         "\t   CuBLASContext & context = GetCuBLASContext();\n"
+         "\t   const bool tA = (*transa == 't' || *transa == 'T');\n"
+         "\t   const bool tB = (*transb == 't' || *transb == 'T');\n"
+         "\t   const size_t sizeA = size_t(*lda) * (tA ? *m : *k);\n"
+         "\t   const size_t sizeB = size_t(*ldb) * (tB ? *k : *n);\n"
+         "\t   const size_t sizeC = size_t(*ldc) * *n;\n"
+         "\t   float * dA = context.Buffer(0, sizeA);\n"
+         "\t   float * dB = context.Buffer(1, sizeB);\n"
+         "\t   float * dC = context.Buffer(2, sizeC);\n"
+         "\t   CheckCuda(cudaMemcpy(dA, A, sizeA * sizeof(float), cudaMemcpyHostToDevice) == cudaSuccess, \"cudaMemcpy\");\n"
+         "\t   CheckCuda(cudaMemcpy(dB, B, sizeB * sizeof(float), cudaMemcpyHostToDevice) == cudaSuccess, \"cudaMemcpy\");\n"
+         "\t   // C is only read when beta is not zero\n"
+         "\t   if (*beta != 0)\n"
+         "\t      CheckCuda(cudaMemcpy(dC, C, sizeC * sizeof(float), cudaMemcpyHostToDevice) == cudaSuccess, \"cudaMemcpy\");\n"
+         "\t   CheckCuda(cublasSgemm(context.handle, tA ? CUBLAS_OP_T : CUBLAS_OP_N, tB ? CUBLAS_OP_T : CUBLAS_OP_N,\n"
+         "\t                         *m, *n, *k, alpha, dA, *lda, dB, *ldb, beta, dC, *ldc) == CUBLAS_STATUS_SUCCESS,\n"
+         "\t             \"cublasSgemm\");\n"
+         "\t   CheckCuda(cudaMemcpy(C, dC, sizeC * sizeof(float), cudaMemcpyDeviceToHost) == cudaSuccess, \"cudaMemcpy\");\n"
+         "\t}\n";
+   }
+
+   } // namespace
+
    RModel::RModel(RModel&& other){
       fInputTensorInfos = std::move(other.fInputTensorInfos);
       fReadyInputTensorInfos = std::move(other.fReadyInputTensorInfos);
@@ -250,6 +330,13 @@ namespace SOFIE{
          fUseWeightFile = true;
          fWeightFile = WeightFileType::RootBinary;
       }
+      const bool useCuBLAS = static_cast<std::underlying_type_t<Options>>(Options::kCuBLAS) & options;
+      // weight-only quantization, the inference still runs in float
+      fInt8Weights = static_cast<std::underlying_type_t<Options>>(Options::kInt8Weights) & options;
+      if (fInt8Weights && fWeightFile != WeightFileType::RootBinary) {
+         throw
+            std::runtime_error("TMVA-SOFIE: RModel::Generate: int8 weights are only supported with a ROOT binary weight file");
+      }
       if (fUseWeightFile && !fUseSession) {
          throw
             std::runtime_error("TMVA-SOFIE: RModel::Generate: cannot use a separate weight file without generating a Session class");
@@ -277,12 +364,21 @@ namespace SOFIE{
       // Include TFile when saving the weights in a binary ROOT file
       if (fWeightFile == WeightFileType::RootBinary)
          fGC += "#include \"TFile.h\"\n";
+      // the generated code must then be compiled with the CUDA headers and
+      // linked against the cudart and cublas libraries
+      if (useCuBLAS && fNeededBlasRoutines.count("Gemm")) {
+         fGC += "#include <cuda_runtime.h>\n";
+         fGC += "#include <cublas_v2.h>\n";
+         fGC += "#include <stdexcept>\n";
+      }
 
       fGC += "\nnamespace TMVA_SOFIE_" + fName + "{\n";
       if (!fNeededBlasRoutines.empty()) {
          fGC += ("namespace BLAS{\n");
          for (auto &routine : fNeededBlasRoutines) {
-            if (routine == "Gemm") {
+            if (routine == "Gemm" && useCuBLAS) {
+               fGC += CuBLASGemmCode();
+            } else if (routine == "Gemm") {
                fGC += ("\textern \"C\" void sgemm_(const char * transa, const char * transb, const int * m, const int * n, const int * k,\n"
                        "\t                       const float * alpha, const float * A, const int * lda, const float * B, const int * ldb,\n"
                        "\t                       const float * beta, float * C, const int * ldc);\n");
@@ -325,28 +421,42 @@ namespace SOFIE{
 
          }
       }
-      for (auto&i: fIntermediateTensorInfos){
-         size_t length = ConvertShapeToLength(i.second.shape);
-         if (i.second.type == ETensorType::FLOAT){
-            fGC += "std::vector<float> fTensor_" + i.first  + " = std::vector<float>(" + std::to_string(length) + ");\n";
-            fGC += "float * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
-         }
-         if (i.second.type == ETensorType::DOUBLE){
-            fGC += "std::vector<double> fTensor_" + i.first  + " = std::vector<double>(" + std::to_string(length) + ");\n";
-            fGC += "double * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+      // generate the code of the operators first, it tells which operators
+      // use which intermediate tensors
+      std::string sessionMembersCode;
+      std::string initCode;
+      std::vector<std::string> operatorCode;
+      auto generateOperatorCode = [&]() {
+         sessionMembersCode.clear();
+         initCode.clear();
+         operatorCode.clear();
+         if (fUseSession) {
+            // add here specific operator code that needs to define session data members
+            for (size_t id = 0; id < fOperators.size(); id++) {
+               std::string opName = std::to_string(id);
+               sessionMembersCode += fOperators[id]->GenerateSessionMembersCode(opName);
+            }
+            for (size_t id = 0; id < fOperators.size() ; id++){
+               initCode += fOperators[id]->GenerateInitCode();
+            }
          }
-         if (i.second.type == ETensorType::INT64){
-            fGC += "std::vector<int64_t> fTensor_" + i.first  + " = std::vector<int64_t>(" + std::to_string(length) + ");\n";
-            fGC += "int64_t * tensor_" + i.first + " = fTensor_" + i.first  + ".data();\n";
+         for (size_t id = 0; id < fOperators.size() ; id++){
+            operatorCode.push_back(fOperators[id]->Generate(std::to_string(id)));
          }
+      };
+      generateOperatorCode();
+      // the operator names depend on their position, so the code of all
+      // operators is generated again after a fusion
+      if (!(static_cast<std::underlying_type_t<Options>>(Options::kNoOperatorFusion) & options) &&
+          FuseOperators(operatorCode, sessionMembersCode + initCode)) {
+         generateOperatorCode();
       }
+
+      const bool useMemoryPool = !(static_cast<std::underlying_type_t<Options>>(Options::kNoMemoryPool) & options);
+      fGC += GenerateIntermediateTensors(useMemoryPool, operatorCode, sessionMembersCode + initCode);
       if (fUseSession) {
-         // add here specific operator code that needs to define session data members
          fGC += "\n";
-         for (size_t id = 0; id < fOperators.size(); id++) {
-            std::string opName = std::to_string(id);
-            fGC += fOperators[id]->GenerateSessionMembersCode(opName);
-         }
+         fGC += sessionMembersCode;
          fGC += "\n";
          // here add initialization and reading of weight tensors
          if (fUseWeightFile) {
@@ -366,9 +476,7 @@ namespace SOFIE{
             fGC += "Session(std::string = \"\") {\n";
          }
          // add here initialization code
-         for (size_t id = 0; id < fOperators.size() ; id++){
-            fGC += fOperators[id]->GenerateInitCode();
-         }
+         fGC += initCode;
          fGC += "}\n\n";
       }
 
@@ -433,8 +541,8 @@ namespace SOFIE{
 
       const std::string SP = "   ";
 
-      for (size_t id = 0; id < fOperators.size() ; id++){
-         fGC+= (fOperators[id]->Generate(std::to_string(id)));
+      for (auto const &code : operatorCode) {
+         fGC += code;
       }
       if (outputSize == 1) {
          size_t outputLength = ConvertShapeToLength(GetTensorShape(fOutputTensorNames[0]));
@@ -474,6 +582,145 @@ namespace SOFIE{
       fGC += "\n#endif  // " + hgname + "\n";
    }
 
+   /// Fuse the operators of the model, using the generated code to know
+   /// which operators use which tensors. For now, an activation that directly
+   /// follows a Gemm is applied in the Gemm operator itself when nothing else
+   /// uses the output of the Gemm. This saves a loop over the output and its
+   /// intermediate tensor. The fused operators are removed from the model.
+   /// \return true if operators were fused.
+   bool RModel::FuseOperators(const std::vector<std::string> &operatorCode, const std::string &sessionCode) {
+      std::vector<size_t> fusedOperators;
+      for (size_t id = 0; id + 1 < fOperators.size(); id++) {
+         auto gemm = dynamic_cast<ROperator_Gemm<float> *>(fOperators[id].get());
+         auto relu = dynamic_cast<ROperator_Relu<float> *>(fOperators[id + 1].get());
+         if (!gemm || !relu || gemm->GetOutputName() != relu->GetInputName())
+            continue;
+         const std::string name = gemm->GetOutputName();
+         bool usedElsewhere = std::find(fOutputTensorNames.begin(), fOutputTensorNames.end(), name) != fOutputTensorNames.end() ||
+                              UsesVariable(sessionCode, "tensor_" + name) || UsesVariable(sessionCode, "fTensor_" + name);
+         for (size_t other = 0; other < operatorCode.size() && !usedElsewhere; other++) {
+            if (other == id || other == id + 1) continue;
+            usedElsewhere = UsesVariable(operatorCode[other], "tensor_" + name) || UsesVariable(operatorCode[other], "fTensor_" + name);
+         }
+         if (usedElsewhere)
+            continue;
+         gemm->FuseActivation(EActivationType::RELU, relu->GetOutputName());
+         fIntermediateTensorInfos.erase(name);
+         fusedOperators.push_back(id + 1);
+         id++; // the Relu can't be fused with the next operator
+      }
+      for (auto it = fusedOperators.rbegin(); it != fusedOperators.rend(); ++it) {
+         fOperators.erase(fOperators.begin() + *it);
+      }
+      return !fusedOperators.empty();
+   }
+
+   /// Generate the declarations of the intermediate tensors. With the memory
+   /// pool, the tensors of each type are placed in one buffer, and tensors
+   /// that are not alive at the same time share memory. A tensor is alive from
+   /// the first to the last operator whose code uses it, and the output tensors
+   /// until the end of the inference. The tensors used by the session members
+   /// or the initialization code, or through their vectors, keep their own
+   /// vectors.
+   std::string RModel::GenerateIntermediateTensors(bool useMemoryPool, const std::vector<std::string> &operatorCode,
+                                                   const std::string &sessionCode) {
+      struct PlannedTensor {
+         std::string name;
+         size_t length;
+         size_t first;
+         size_t last;
+         size_t offset;
+      };
+      // align the tensors in the pool on 64 bytes
+      auto alignedLength = [](size_t length, size_t typeSize) {
+         const size_t alignment = std::max<size_t>(1, 64 / typeSize);
+         return (length + alignment - 1) / alignment * alignment;
+      };
+
+      std::string code;
+      for (ETensorType type : {ETensorType::FLOAT, ETensorType::DOUBLE, ETensorType::INT64}) {
+         const std::string typeName = ConvertTypeToString(type);
+         const size_t typeSize = type == ETensorType::FLOAT ? sizeof(float) : sizeof(double);
+
+         std::vector<PlannedTensor> planned;
+         std::vector<std::string> ownVectors;
+         for (auto &i : fIntermediateTensorInfos) {
+            if (i.second.type != type) continue;
+            const std::string var = "tensor_" + i.first;
+            if (!useMemoryPool || UsesVariable(sessionCode, var) || UsesVariable(sessionCode, "fTensor_" + i.first)) {
+               ownVectors.push_back(i.first);
+               continue;
+            }
+            PlannedTensor tensor{i.first, ConvertShapeToLength(i.second.shape), operatorCode.size(), 0, 0};
+            bool usesVector = false;
+            for (size_t id = 0; id < operatorCode.size(); id++) {
+               usesVector |= UsesVariable(operatorCode[id], "fTensor_" + i.first);
+               if (UsesVariable(operatorCode[id], var)) {
+                  tensor.first = std::min(tensor.first, id);
+                  tensor.last = id;
+               }
+            }
+            if (usesVector) {
+               ownVectors.push_back(i.first);
+               continue;
+            }
+            const bool isOutput = std::find(fOutputTensorNames.begin(), fOutputTensorNames.end(), i.first) != fOutputTensorNames.end();
+            if (isOutput || tensor.first > tensor.last) {
+               // alive until the result is copied, or unused: don't share
+               tensor.first = std::min(tensor.first, tensor.last);
+               tensor.last = operatorCode.size();
+            }
+            planned.push_back(tensor);
+         }
+
+         // place the largest tensors first, each one at the lowest offset
+         // that is not used by a tensor with an overlapping lifetime
+         std::sort(planned.begin(), planned.end(), [](const PlannedTensor &a, const PlannedTensor &b) {
+            return a.length != b.length ? a.length > b.length : a.name < b.name;
+         });
+         size_t poolSize = 0;
+         for (size_t i = 0; i < planned.size(); i++) {
+            PlannedTensor &tensor = planned[i];
+            std::vector<std::pair<size_t, size_t>> occupied;
+            for (size_t j = 0; j < i; j++) {
+               if (planned[j].first <= tensor.last && tensor.first <= planned[j].last)
+                  occupied.emplace_back(planned[j].offset, planned[j].offset + alignedLength(planned[j].length, typeSize));
+            }
+            std::sort(occupied.begin(), occupied.end());
+            size_t offset = 0;
+            for (auto const &range : occupied) {
+               if (offset + tensor.length <= range.first) break;
+               offset = std::max(offset, range.second);
+            }
+            tensor.offset = offset;
+            poolSize = std::max(poolSize, offset + alignedLength(tensor.length, typeSize));
+         }
+
+         std::sort(ownVectors.begin(), ownVectors.end());
+         for (auto const &name : ownVectors) {
+            size_t length = ConvertShapeToLength(fIntermediateTensorInfos[name].shape);
+            code += "std::vector<" + typeName + "> fTensor_" + name + " = std::vector<" + typeName + ">(" + std::to_string(length) + ");\n";
+            code += typeName + " * tensor_" + name + " = fTensor_" + name + ".data();\n";
+         }
+         if (!planned.empty()) {
+            const std::string poolName = "fIntermediateMemoryPool_" + typeName;
+            code += "std::vector<" + typeName + "> " + poolName + " = std::vector<" + typeName + ">(" + std::to_string(poolSize) + ");\n";
+            std::sort(planned.begin(), planned.end(), [](const PlannedTensor &a, const PlannedTensor &b) { return a.name < b.name; });
+            for (auto const &tensor : planned) {
+               code += typeName + " * tensor_" + tensor.name + " = " + poolName + ".data() + " + std::to_string(tensor.offset) + ";\n";
+            }
+         }
+      }
+      return code;
+   }
+
+   // Whether the float tensor is stored as int8 in the weight file. Only the
+   // multi-dimensional tensors (the Gemm and Conv weights) are quantized, the
+   // biases keep their full precision.
+   bool RModel::IsInt8Weight(const InitializedTensor &tensor) const {
+      return fInt8Weights && tensor.fShape.size() > 1 && ConvertShapeToLength(tensor.fShape) > 0;
+   }
+
    void RModel::ReadInitializedTensorsFromFile() {
       // generate the code to read initialized tensors from a text data file
       if (fWeightFile == WeightFileType::Text) {
@@ -523,7 +770,17 @@ namespace SOFIE{
       for (auto &i : fInitializedTensors) {
          fGC += "  {\n";
          std::string tensor_name = "tensor_" + i.first;
-         if (i.second.fType == ETensorType::FLOAT) {
+         if (i.second.fType == ETensorType::FLOAT && IsInt8Weight(i.second)) {
+            // dequantize the int8 values with the scale of their slice along the first dimension
+            fGC += "   std::unique_ptr<std::vector<char>> q(rootFile->Get<std::vector<char>>(\"" + tensor_name + "_int8\"));\n";
+            fGC += "   std::unique_ptr<std::vector<float>> scales(rootFile->Get<std::vector<float>>(\"" + tensor_name + "_scales\"));\n";
+            fGC += "   if (!q || !scales) {\n";
+            fGC += "      throw std::runtime_error(\"tmva-sofie failed to read the int8 weights " + tensor_name + "\");\n";
+            fGC += "   }\n";
+            fGC += "   const size_t sliceSize = q->size() / scales->size();\n";
+            fGC += "   for (size_t i = 0; i < q->size(); ++i)\n";
+            fGC += "      fTensor_" + i.first + "[i] = (*scales)[i / sliceSize] * static_cast<signed char>((*q)[i]);\n";
+         } else if (i.second.fType == ETensorType::FLOAT) {
             fGC += "fTensor_" + i.first + " = *reinterpret_cast<std::vector<float>*>(rootFile->Get(";
             fGC += "\"" + tensor_name + "\"));\n";
          } else if (i.second.fType == ETensorType::DOUBLE) {
@@ -567,7 +824,26 @@ void RModel::WriteInitializedTensorsToFile(std::string filename) {
       std::string tensorName = "tensor_" + item.first;
       size_t length = 1;
       length = ConvertShapeToLength(item.second.fShape);
-      if(item.second.fType == ETensorType::FLOAT){
+      if (item.second.fType == ETensorType::FLOAT && IsInt8Weight(item.second)) {
+         const float *data = (std::static_pointer_cast<float>(item.second.fData)).get();
+         // one scale per slice along the first dimension, i.e. per output channel of the Conv weights
+         const std::size_t nSlices = item.second.fShape[0];
+         const std::size_t sliceSize = length / nSlices;
+         std::vector<float> scales(nSlices);
+         std::vector<char> quantized(length);
+         for (std::size_t islice = 0; islice < nSlices; ++islice) {
+            const float *slice = data + islice * sliceSize;
+            float maxAbs = 0;
+            for (std::size_t j = 0; j < sliceSize; ++j)
+               maxAbs = std::max(maxAbs, std::abs(slice[j]));
+            scales[islice] = maxAbs > 0 ? maxAbs / 127.f : 1.f;
+            for (std::size_t j = 0; j < sliceSize; ++j)
+               quantized[islice * sliceSize + j] = static_cast<char>(std::lround(slice[j] / scales[islice]));
+         }
+         outputFile->WriteObjectAny(&quantized, "std::vector<char>", (tensorName + "_int8").c_str());
+         outputFile->WriteObjectAny(&scales, "std::vector<float>", (tensorName + "_scales").c_str());
+      }
+      else if(item.second.fType == ETensorType::FLOAT){
          const std::shared_ptr<void> ptr = item.second.fData; // shared_ptr<void> instance
          const float* data = (std::static_pointer_cast<float>(item.second.fData)).get();
          std::vector<float> tensorDataVector(data , data + length);
@@ -33,6 +33,8 @@ private:
    std::queue<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fTrainingBatchQueue;
    std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fValidationBatches;
    std::unique_ptr<TMVA::Experimental::RTensor<float>> fCurrentBatch;
+   // batches already handed out and replaced, reused to avoid an allocation per batch
+   std::vector<std::unique_ptr<TMVA::Experimental::RTensor<float>>> fFreeBatches;
 
    std::size_t fValidationIdx = 0;
 
@@ -48,13 +50,18 @@ public:
 
 public:
    /// \brief Return a batch of data as a unique pointer.
-   /// After the batch has been processed, it should be distroyed.
+   /// The batch stays valid until the next call, after which its memory is
+   /// reused for the following batches.
    /// \return Training batch
    const TMVA::Experimental::RTensor<float> &GetTrainBatch()
    {
       std::unique_lock<std::mutex> lock(fBatchLock);
       fBatchCondition.wait(lock, [this]() { return !fTrainingBatchQueue.empty() || !fIsActive; });
 
+      if (fCurrentBatch && fCurrentBatch->GetSize() == fBatchSize * fNumColumns) {
+         fFreeBatches.emplace_back(std::move(fCurrentBatch));
+      }
+
       if (fTrainingBatchQueue.empty()) {
          fCurrentBatch = std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>({0}));
          return *fCurrentBatch;
@@ -128,10 +135,20 @@ public:
    /// \param idx
    /// \return
    std::unique_ptr<TMVA::Experimental::RTensor<float>>
-   CreateBatch(const TMVA::Experimental::RTensor<float> &chunkTensor, const std::vector<std::size_t> idx)
+   CreateBatch(const TMVA::Experimental::RTensor<float> &chunkTensor, const std::size_t *idx)
    {
-      auto batch =
-         std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>({fBatchSize, fNumColumns}));
+      std::unique_ptr<TMVA::Experimental::RTensor<float>> batch;
+      {
+         std::unique_lock<std::mutex> lock(fBatchLock);
+         if (!fFreeBatches.empty()) {
+            batch = std::move(fFreeBatches.back());
+            fFreeBatches.pop_back();
+         }
+      }
+      if (!batch) {
+         batch =
+            std::make_unique<TMVA::Experimental::RTensor<float>>(std::vector<std::size_t>({fBatchSize, fNumColumns}));
+      }
 
       for (std::size_t i = 0; i < fBatchSize; i++) {
          std::copy(chunkTensor.GetData() + (idx[i] * fNumColumns), chunkTensor.GetData() + ((idx[i] + 1) * fNumColumns),
@@ -166,15 +183,8 @@ public:
 
       // Create tasks of fBatchSize untill all idx are used
       for (std::size_t start = 0; (start + fBatchSize) <= eventIndices.size(); start += fBatchSize) {
-
-         // Grab the first fBatchSize indices from the
-         std::vector<std::size_t> idx;
-         for (std::size_t i = start; i < (start + fBatchSize); i++) {
-            idx.push_back(eventIndices[i]);
-         }
-
-         // Fill a batch
-         batches.emplace_back(CreateBatch(chunkTensor, idx));
+         // Fill a batch with the next fBatchSize indices
+         batches.emplace_back(CreateBatch(chunkTensor, eventIndices.data() + start));
       }
 
       {
@@ -192,20 +202,14 @@ public:
    /// \param chunkTensor
    /// \param eventIndices
    void CreateValidationBatches(const TMVA::Experimental::RTensor<float> &chunkTensor,
-                                const std::vector<std::size_t> eventIndices)
+                                const std::vector<std::size_t> &eventIndices)
    {
       // Create tasks of fBatchSize untill all idx are used
       for (std::size_t start = 0; (start + fBatchSize) <= eventIndices.size(); start += fBatchSize) {
-
-         std::vector<std::size_t> idx;
-
-         for (std::size_t i = start; i < (start + fBatchSize); i++) {
-            idx.push_back(eventIndices[i]);
-         }
-
+         auto batch = CreateBatch(chunkTensor, eventIndices.data() + start);
          {
             std::unique_lock<std::mutex> lock(fBatchLock);
-            fValidationBatches.emplace_back(CreateBatch(chunkTensor, idx));
+            fValidationBatches.emplace_back(std::move(batch));
          }
       }
    }
@@ -48,6 +48,7 @@
 #include "TMVA/DataSetInfo.h"
 #include "TMVA/DataInputHandler.h"
 #include "TMVA/DataSetManager.h"
+#include "TMVA/RTensor.hxx"
 
 #include <vector>
 #include <map>
@@ -92,6 +93,9 @@ namespace TMVA {
       Double_t EvaluateMVA( const std::vector<Double_t>&, const TString& methodTag, Double_t aux = 0 );
       Double_t EvaluateMVA( MethodBase* method,           Double_t aux = 0 );
       Double_t EvaluateMVA( const TString& methodTag,     Double_t aux = 0 );
+      // returns the MVA responses of several methods for a batch of events
+      TMVA::Experimental::RTensor<Double_t> EvaluateMVA( const TMVA::Experimental::RTensor<Float_t> &events,
+                                                         const std::vector<TString> &methodTags, Double_t aux = 0 );
 
       // returns error on MVA response for given event
       // NOTE: must be called AFTER "EvaluateMVA(...)" call !
@@ -65,6 +65,8 @@ struct BranchlessTree {
    std::vector<int> fInputs;   ///< Cut variables / inputs
 
    inline T Inference(const T *input, const int stride);
+   inline void InferenceBlock(const T *inputs, const int rows, const int strideBatch, const int strideTree,
+                              int *indices, T *predictions);
    inline void FillSparse();
    inline std::string GetInferenceCode(const std::string& funcName, const std::string& typeName);
 };
@@ -83,6 +85,36 @@ inline T BranchlessTree<T>::Inference(const T *input, const int stride)
    return fThresholds[index];
 }
 
+/// Perform inference on a block of input vectors and add the scores to the predictions
+///
+/// The block is traversed level by level for all events at once, such that
+/// the loop over the events has no dependencies between iterations and can be
+/// vectorized by the compiler.
+///
+/// \param[in] inputs Pointer to data containing the input values of the first event
+/// \param[in] rows Number of events in the block
+/// \param[in] strideBatch Stride to go from one event to the next one
+/// \param[in] strideTree Stride to go from one input variable to the next one
+/// \param[in] indices Buffer of `rows` node indices used for the traversal
+/// \param[in,out] predictions Predictions of the events, to which the tree scores are added
+template <typename T>
+inline void BranchlessTree<T>::InferenceBlock(const T *inputs, const int rows, const int strideBatch,
+                                              const int strideTree, int *indices, T *predictions)
+{
+   const int *treeInputs = fInputs.data();
+   const T *thresholds = fThresholds.data();
+   std::fill(indices, indices + rows, 0);
+   for (int level = 0; level < fTreeDepth; ++level) {
+      for (int i = 0; i < rows; ++i) {
+         const int index = indices[i];
+         indices[i] = 2 * index + 1 + (inputs[i * strideBatch + treeInputs[index] * strideTree] > thresholds[index]);
+      }
+   }
+   for (int i = 0; i < rows; ++i) {
+      predictions[i] += thresholds[indices[i]];
+   }
+}
+
 /// Fill nodes of a sparse tree forming a full tree
 ///
 /// Sparse parts of the tree are marked with -1 values in the feature vector. The
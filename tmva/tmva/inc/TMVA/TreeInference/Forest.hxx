@@ -79,16 +79,26 @@ struct ForestBase {
 /// \param[in] rows Number of events in inputs vector
 /// \param[in] layout Row major (true) or column major (false) memory layout
 /// \param[in] predictions Pointer to the buffer to be filled with the predictions
+///
+/// The events are processed in blocks, which go through each tree level by
+/// level. Like this, the thresholds and cut variables of a tree are reused for
+/// all events of a block while they are in cache, and the comparisons of the
+/// events are independent of each other.
 template <typename T, typename ForestType>
 inline void ForestBase<T, ForestType>::Inference(const T *inputs, const int rows, bool layout, T *predictions)
 {
+   constexpr int blockSize = 64;
    const auto strideTree = layout ? 1 : rows;
    const auto strideBatch = layout ? fNumInputs : 1;
-   for (int i = 0; i < rows; i++) {
-      predictions[i] = 0.0;
+   int indices[blockSize];
+   std::fill(predictions, predictions + rows, T(0));
+   for (int first = 0; first < rows; first += blockSize) {
+      const int n = std::min(blockSize, rows - first);
       for (auto &tree : fTrees) {
-         predictions[i] += tree.Inference(inputs + i * strideBatch, strideTree);
+         tree.InferenceBlock(inputs + first * strideBatch, n, strideBatch, strideTree, indices, predictions + first);
       }
+   }
+   for (int i = 0; i < rows; i++) {
       predictions[i] = fObjectiveFunc(predictions[i]);
    }
 }
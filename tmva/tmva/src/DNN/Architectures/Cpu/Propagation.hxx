@@ -363,16 +363,15 @@ void TCpu<AFloat>::ConvLayerForward(TCpuTensor<AFloat> & output,
        MultiplyTranspose(output_m, weights, inputTr);
        AddConvBiases(output_m, biases);
 
+       // need to save output of convolution (input to activation function), this and
+       // the activation are done per sample while its output is still in cache
+       Matrix_t inputActivationFunc_m = inputActivationFunc.At(i).GetMatrix();
+       Copy(inputActivationFunc_m, output_m);
+       Tensor_t output_t = output.At(i);
+       ActivationFunctionForward(output_t, activFunc, ActivationDescriptor_t());
    };
 
    TCpuMatrix<AFloat>::GetThreadExecutor().Foreach(f, ROOT::TSeqI(input.GetFirstSize()));
-
-   //evaluateDerivative<TCpu<AFloat>>(derivatives, activFunc, output);
-   // need to save output of convolution (input to activation function)
-   Copy(inputActivationFunc, output);
-
-   //evaluate<TCpu<AFloat>>(output, activFunc);
-   ActivationFunctionForward(output, activFunc, ActivationDescriptor_t());
 }
 
 //____________________________________________________________________________
@@ -537,7 +536,6 @@ void TCpu<AFloat>::CalculateConvWeightGradients(TCpuMatrix<AFloat> &weightGradie
 
       //TMVA_DNN_PrintTCpuMatrix(df[i],"df-i");
       TCpuMatrix<AFloat> xTr(nLocalViews, nLocalViewPixels);
-      TCpuMatrix<AFloat> res(depth, nLocalViewPixels);
 
       //computing t he gradient is equivalent of doing a convolution of the input using as conv kernel the delta's (the df[] values)
       //N.B. only stride values=1 are now supported
@@ -1324,39 +1324,44 @@ struct TrainNodeInfo{
    std::vector< std::vector<Double_t> > target;
    std::vector< std::vector<Double_t> > target2;
 
-   // Define the addition operator for TrainNodeInfo
+   // Define the addition operators for TrainNodeInfo
    // Make sure both TrainNodeInfos have the same nvars if we add them
-   TrainNodeInfo operator+(const TrainNodeInfo& other)
-   {           
-       TrainNodeInfo ret(cNvars, nBins);
-        
+   TrainNodeInfo& operator+=(const TrainNodeInfo& other)
+   {
        // check that the two are compatible to add
-       if(cNvars != other.cNvars) 
+       if(cNvars != other.cNvars)
        {
           std::cout << "!!! ERROR TrainNodeInfo1+TrainNodeInfo2 failure. cNvars1 != cNvars2." << std::endl;
-          return ret;
+          return *this;
        }
 
        // add the signal, background, and target sums
        for (Int_t ivar=0; ivar<cNvars; ivar++) {
           for (UInt_t ibin=0; ibin<nBins[ivar]; ibin++) {
-             ret.nSelS[ivar][ibin] = nSelS[ivar][ibin] + other.nSelS[ivar][ibin];
-             ret.nSelB[ivar][ibin] = nSelB[ivar][ibin] + other.nSelB[ivar][ibin];
-             ret.nSelS_unWeighted[ivar][ibin] = nSelS_unWeighted[ivar][ibin] + other.nSelS_unWeighted[ivar][ibin];
-             ret.nSelB_unWeighted[ivar][ibin] = nSelB_unWeighted[ivar][ibin] + other.nSelB_unWeighted[ivar][ibin];
-             ret.target[ivar][ibin] = target[ivar][ibin] + other.target[ivar][ibin];
-             ret.target2[ivar][ibin] = target2[ivar][ibin] + other.target2[ivar][ibin];
+             nSelS[ivar][ibin] += other.nSelS[ivar][ibin];
+             nSelB[ivar][ibin] += other.nSelB[ivar][ibin];
+             nSelS_unWeighted[ivar][ibin] += other.nSelS_unWeighted[ivar][ibin];
+             nSelB_unWeighted[ivar][ibin] += other.nSelB_unWeighted[ivar][ibin];
+             target[ivar][ibin] += other.target[ivar][ibin];
+             target2[ivar][ibin] += other.target2[ivar][ibin];
           }
        }
 
-       ret.nTotS = nTotS + other.nTotS;
-       ret.nTotS_unWeighted = nTotS_unWeighted + other.nTotS_unWeighted;
-       ret.nTotB = nTotB + other.nTotB;
-       ret.nTotB_unWeighted = nTotB_unWeighted + other.nTotB_unWeighted;
+       nTotS += other.nTotS;
+       nTotS_unWeighted += other.nTotS_unWeighted;
+       nTotB += other.nTotB;
+       nTotB_unWeighted += other.nTotB_unWeighted;
 
+       return *this;
+   };
+
+   TrainNodeInfo operator+(const TrainNodeInfo& other)
+   {
+       TrainNodeInfo ret(*this);
+       ret += other;
        return ret;
    };
- 
+
 };
 //===========================================================================
 // Done with TrainNodeInfo declaration
@@ -1599,14 +1604,23 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
 
          for(UInt_t iev=start; iev<end; iev++) {
 
-            Double_t eventWeight =  eventSample[iev]->GetWeight();
-            if (eventSample[iev]->GetClass() == fSigClass) {
+            const TMVA::Event* evt = eventSample[iev];
+            const Double_t eventWeight = evt->GetWeight();
+            // the class and the target are the same for all the variables,
+            // so the histograms to fill are chosen once per event
+            const Bool_t isSignal = (evt->GetClass() == fSigClass);
+            std::vector< std::vector<Double_t> > &nSel = isSignal ? nodeInfof.nSelS : nodeInfof.nSelB;
+            std::vector< std::vector<Double_t> > &nSelUnWeighted = isSignal ? nodeInfof.nSelS_unWeighted : nodeInfof.nSelB_unWeighted;
+            if (isSignal) {
                nodeInfof.nTotS+=eventWeight;
                nodeInfof.nTotS_unWeighted++;    }
             else {
                nodeInfof.nTotB+=eventWeight;
                nodeInfof.nTotB_unWeighted++;
             }
+            const Bool_t doRegression = DoRegression();
+            const Double_t weightedTarget = doRegression ? eventWeight*evt->GetTarget(0) : 0.;
+            const Double_t weightedTarget2 = doRegression ? weightedTarget*evt->GetTarget(0) : 0.;
 
             // #### Count the number in each bin
             Int_t iBin=-1;
@@ -1615,27 +1629,21 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
                // the best separationGain at the current stage.
                if ( useVariable[ivar] ) {
                   Double_t eventData;
-                  if (ivar < fNvars) eventData = eventSample[iev]->GetValueFast(ivar);
+                  if (ivar < fNvars) eventData = evt->GetValueFast(ivar);
                   else { // the fisher variable
                      eventData = fisherCoeff[fNvars];
                      for (UInt_t jvar=0; jvar<fNvars; jvar++)
-                        eventData += fisherCoeff[jvar]*(eventSample[iev])->GetValueFast(jvar);
+                        eventData += fisherCoeff[jvar]*evt->GetValueFast(jvar);
 
                   }
                   // #### figure out which bin it belongs in ...
                   // "maximum" is nbins-1 (the "-1" because we start counting from 0 !!
                   iBin = TMath::Min(Int_t(nBins[ivar]-1),TMath::Max(0,int (invBinWidth[ivar]*(eventData-xmin[ivar]) ) ));
-                  if (eventSample[iev]->GetClass() == fSigClass) {
-                     nodeInfof.nSelS[ivar][iBin]+=eventWeight;
-                     nodeInfof.nSelS_unWeighted[ivar][iBin]++;
-                  }
-                  else {
-                     nodeInfof.nSelB[ivar][iBin]+=eventWeight;
-                     nodeInfof.nSelB_unWeighted[ivar][iBin]++;
-                  }
-                  if (DoRegression()) {
-                     nodeInfof.target[ivar][iBin] +=eventWeight*eventSample[iev]->GetTarget(0);
-                     nodeInfof.target2[ivar][iBin]+=eventWeight*eventSample[iev]->GetTarget(0)*eventSample[iev]->GetTarget(0);
+                  nSel[ivar][iBin]+=eventWeight;
+                  nSelUnWeighted[ivar][iBin]++;
+                  if (doRegression) {
+                     nodeInfof.target[ivar][iBin] +=weightedTarget;
+                     nodeInfof.target2[ivar][iBin]+=weightedTarget2;
                   }
                }
             }
@@ -1643,11 +1651,13 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
          return nodeInfof;
       };
 
-      // #### Need an intial struct to pass to std::accumulate
-      TrainNodeInfo nodeInfoInit(cNvars, nBins);
-
-      // #### Run the threads in parallel then merge the results
-      auto redfunc = [nodeInfoInit](std::vector<TrainNodeInfo> v) -> TrainNodeInfo { return std::accumulate(v.begin(), v.end(), nodeInfoInit); };
+      // #### Run the threads in parallel then merge the results in place,
+      // #### without copying the partial histograms
+      auto redfunc = [](const std::vector<TrainNodeInfo> &v) -> TrainNodeInfo {
+         TrainNodeInfo sum = v.front();
+         for (std::size_t i = 1; i < v.size(); ++i) sum += v[i];
+         return sum;
+      };
       nodeInfo = TMVA::Config::Instance().GetThreadExecutor().MapReduce(f, seeds, redfunc);
    }
  
@@ -111,6 +111,7 @@
 #include "TXMLEngine.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <cstdlib>
 
 #include <string>
@@ -559,6 +560,81 @@ Double_t TMVA::Reader::EvaluateMVA( MethodBase* method, Double_t aux )
                                (fCalculateError?&fMvaEventErrorUpper:0) );
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the methods booked with the tags `methodTags` for a batch of events.
+///
+/// The events are given as a tensor of shape {nEvents, nVariables}. The returned
+/// tensor has the shape {nEvents, nMethods}: column j holds the responses of the
+/// method `methodTags[j]`. The parameter aux is the signal efficiency for the
+/// cuts methods. Events with a NaN variable get the response -999.
+///
+/// The methods keep the state of the event they evaluate, so each of them is
+/// evaluated for all the events by a single task, and the different methods run
+/// in parallel on the TMVA thread pool. No MVA errors are computed.
+
+TMVA::Experimental::RTensor<Double_t> TMVA::Reader::EvaluateMVA( const TMVA::Experimental::RTensor<Float_t> &events,
+                                                                 const std::vector<TString> &methodTags, Double_t aux )
+{
+   const auto &shape = events.GetShape();
+   const UInt_t nVariables = DataInfo().GetNVariables();
+   if (shape.size() != 2 || shape[1] != nVariables) {
+      Log() << kFATAL << "<EvaluateMVA> the events must be given as a tensor of shape {nEvents, " << nVariables << "}"
+            << Endl;
+   }
+   const std::size_t nEvents = shape[0];
+
+   std::vector<MethodBase *> methods;
+   for (const auto &methodTag : methodTags) {
+      MethodBase *meth = dynamic_cast<TMVA::MethodBase *>(FindMVA(methodTag));
+      if (meth == nullptr)
+         Log() << kFATAL << methodTag << " is not a method" << Endl;
+      if (meth->GetMethodType() == TMVA::Types::kCuts) {
+         TMVA::MethodCuts *mc = dynamic_cast<TMVA::MethodCuts *>(meth);
+         if (mc)
+            mc->SetTestSignalEfficiency(aux);
+      }
+      methods.push_back(meth);
+   }
+
+   TMVA::Experimental::RTensor<Double_t> result({nEvents, methods.size()});
+   std::vector<Bool_t> isNaN(nEvents, kFALSE);
+   for (std::size_t iev = 0; iev < nEvents; ++iev) {
+      for (UInt_t ivar = 0; ivar < nVariables; ++ivar) {
+         if (TMath::IsNaN(events(iev, ivar))) {
+            Log() << kERROR << ivar << "-th variable of event " << iev
+                  << " is NaN --> return MVA value -999, \n that's all I can do, please fix or remove this event." << Endl;
+            isNaN[iev] = kTRUE;
+            break;
+         }
+      }
+   }
+
+   auto evaluateMethod = [&](UInt_t imeth) {
+      Event event(std::vector<Float_t>(nVariables), 0);
+      std::vector<Float_t> &values = event.GetValues();
+      for (std::size_t iev = 0; iev < nEvents; ++iev) {
+         if (isNaN[iev]) {
+            result(iev, imeth) = -999;
+            continue;
+         }
+         for (UInt_t ivar = 0; ivar < nVariables; ++ivar)
+            values[ivar] = events(iev, ivar);
+         result(iev, imeth) = methods[imeth]->GetMvaValue(&event);
+      }
+   };
+
+   // a method booked under several of the tags can't be evaluated concurrently
+   std::vector<MethodBase *> uniqueMethods(methods);
+   std::sort(uniqueMethods.begin(), uniqueMethods.end());
+   if (std::unique(uniqueMethods.begin(), uniqueMethods.end()) == uniqueMethods.end()) {
+      TMVA::Config::Instance().GetThreadExecutor().Foreach(evaluateMethod, ROOT::TSeqU(methods.size()));
+   } else {
+      for (UInt_t imeth = 0; imeth < methods.size(); ++imeth)
+         evaluateMethod(imeth);
+   }
+   return result;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// evaluates MVA for given set of input variables
 
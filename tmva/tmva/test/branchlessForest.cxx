@@ -81,6 +81,30 @@ TEST(BranchlessTree, InferenceSparseTreeDepth2)
    EXPECT_FLOAT_EQ(tree.Inference(input3, 1), 6.0);
 }
 
+TEST(BranchlessTree, InferenceBlock)
+{
+   BranchlessTree<float> tree;
+   tree.fTreeDepth = 2;
+   tree.fThresholds = {0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+   tree.fInputs = {0, 1, 2};
+   // Four events with three variables each, stored row-major
+   float inputs[12] = {-1.0, 0.0, -999.0, -1.0, 2.0, -999.0, 1.0, -999.0, 1.0, 1.0, -999.0, 3.0};
+   int indices[4];
+   float predictions[4] = {0.0, 0.0, 0.0, 0.0};
+   tree.InferenceBlock(inputs, 4, 3, 1, indices, predictions);
+   for (int i = 0; i < 4; i++)
+      EXPECT_FLOAT_EQ(predictions[i], tree.Inference(inputs + 3 * i, 1));
+
+   // Same events stored column-major, predictions are accumulated
+   float inputsT[12];
+   for (int i = 0; i < 4; i++)
+      for (int j = 0; j < 3; j++)
+         inputsT[j * 4 + i] = inputs[i * 3 + j];
+   tree.InferenceBlock(inputsT, 4, 1, 4, indices, predictions);
+   for (int i = 0; i < 4; i++)
+      EXPECT_FLOAT_EQ(predictions[i], 2 * tree.Inference(inputs + 3 * i, 1));
+}
+
 TEST(BranchlessJittedTree, InferenceFullTreeDepth0)
 {
    BranchlessTree<float> tree;
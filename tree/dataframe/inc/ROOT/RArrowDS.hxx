@@ -15,44 +15,55 @@
 #include <memory>
 
 namespace arrow {
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
 class Table;
 }
 
 namespace ROOT {
-namespace Internal {
-namespace RDF {
-class TValueGetter;
-} // namespace RDF
-} // namespace Internal
-
 namespace RDF {
 
 class RArrowDS final : public RDataSource {
 private:
+   /// The table the data comes from, if the data source was constructed from a table
    std::shared_ptr<arrow::Table> fTable;
-   std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
+   /// The stream of record batches the data comes from: either the stream passed by the user or a reader of fTable
+   std::shared_ptr<arrow::RecordBatchReader> fBatchReader;
+   std::shared_ptr<arrow::Schema> fSchema;
+   /// The record batches read so far. They are kept (without copying their data) so that further event loops can
+   /// replay them, and they are never modified while an event loop processes them.
+   std::vector<std::shared_ptr<arrow::RecordBatch>> fBatches;
+   /// The first entry of each batch in fBatches, followed by the total number of entries in fBatches
+   std::vector<ULong64_t> fBatchFirstEntries{0};
+   /// Index of the next batch of fBatches to be handed out by GetEntryRanges()
+   std::size_t fNextBatch = 0;
+   bool fBatchReaderIsExhausted = false;
    std::vector<std::string> fColumnNames;
    size_t fNSlots = 0U;
 
-   std::vector<std::pair<size_t, size_t>> fGetterIndex; // (columnId, visitorId)
-   std::vector<std::unique_ptr<ROOT::Internal::RDF::TValueGetter>> fValueGetters; // Visitors to be used to track and get entries. One per column.
+   RArrowDS(std::shared_ptr<arrow::Schema> schema, std::vector<std::string> const &columns);
+   bool ReadNextBatch();
    std::vector<void *> GetColumnReadersImpl(std::string_view name, const std::type_info &type) final;
 
 public:
    RArrowDS(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columns);
+   RArrowDS(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &columns);
    ~RArrowDS();
    const std::vector<std::string> &GetColumnNames() const final;
    std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
    std::string GetTypeName(std::string_view colName) const final;
    bool HasColumn(std::string_view colName) const final;
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
-   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
    void SetNSlots(unsigned int nSlots) final;
    void Initialize() final;
    std::string GetLabel() final;
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+   GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info &) final;
 };
 
 RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::string> const &columnNames);
+RDataFrame FromArrow(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &columnNames);
 
 } // namespace RDF
 
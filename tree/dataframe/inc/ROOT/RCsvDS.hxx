@@ -16,7 +16,6 @@
 
 #include <cstdint>
 #include <deque>
-#include <list>
 #include <unordered_map>
 #include <set>
 #include <memory>
@@ -48,32 +47,36 @@ private:
    std::unique_ptr<ROOT::Internal::RRawFile> fCsvFile;
    const char fDelimiter;
    const Long64_t fLinesChunkSize;
-   ULong64_t fEntryRangesRequested = 0ULL;
    ULong64_t fProcessedLines = 0ULL; // marks the progress of the consumption of the csv lines
    std::vector<std::string> fHeaders; // the column names
    std::unordered_map<std::string, ColType_t> fColTypes;
    std::set<std::string> fColContainingEmpty; // store columns which had empty entry
-   std::list<ColType_t> fColTypesList; // column types, order is the same as fHeaders, values the same as fColTypes
-   std::vector<std::vector<void *>> fColAddresses;         // fColAddresses[column][slot] (same ordering as fHeaders)
-   std::vector<Record_t> fRecords;                         // fRecords[entry][column] (same ordering as fHeaders)
-   std::vector<std::vector<double>> fDoubleEvtValues;      // one per column per slot
-   std::vector<std::vector<Long64_t>> fLong64EvtValues;    // one per column per slot
-   std::vector<std::vector<std::string>> fStringEvtValues; // one per column per slot
+   std::vector<ColType_t> fColTypesList; // column types, order is the same as fHeaders, values the same as fColTypes
+   /// Entry number of the first record of the chunk of lines in memory
+   ULong64_t fChunkFirstEntry = 0ULL;
+   // The values of the chunk of lines in memory, fXColumns[column][record] (same ordering as fHeaders). Only the
+   // vector of the type of the column is filled. The outer vectors are never resized after construction, because the
+   // column readers refer to their elements.
+   std::vector<std::vector<double>> fDoubleColumns;
+   std::vector<std::vector<Long64_t>> fLong64Columns;
+   std::vector<std::vector<std::string>> fStringColumns;
    // This must be a deque to avoid the specialisation vector<bool>. This would not
    // work given that the pointer to the boolean in that case cannot be taken
-   std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
+   std::vector<std::deque<bool>> fBoolColumns;
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   void FillRecord(const std::string &, std::size_t recordIdx, std::vector<char> &colContainsEmpty);
+   void FillRecords(const std::vector<std::string> &lines, std::size_t firstRecordIdx);
+   void ResizeColumns(std::size_t nRecords);
    void GenerateHeaders(size_t);
+   void CheckColumnType(std::string_view colName, const std::type_info &ti) const;
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &) final;
    void ValidateColTypes(std::vector<std::string> &) const;
    void InferColTypes(std::vector<std::string> &);
    void InferType(const std::string &, unsigned int);
-   std::vector<std::string> ParseColumns(const std::string &);
-   size_t ParseValue(const std::string &, std::vector<std::string> &, size_t);
+   std::vector<std::string> ParseColumns(const std::string &) const;
+   size_t ParseValue(const std::string &, std::vector<std::string> &, size_t) const;
    ColType_t GetType(std::string_view colName) const;
-   void FreeRecords();
 
 protected:
    std::string AsString() final;
@@ -90,6 +93,9 @@ public:
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
    void SetNSlots(unsigned int nSlots) final;
    std::string GetLabel() final;
+   using RDataSource::GetColumnReaders;
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+   GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info &) final;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -20,6 +20,7 @@
 #define ROOT_RDFOPERATIONS
 
 #include "Compression.h"
+#include "RConfigure.h"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RVec.hxx"
 #include "ROOT/TBufferMerger.hxx" // for SnapshotHelper
@@ -28,6 +29,11 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
 #include "ROOT/TypeTraits.hxx"
+// R__HAS_ROOT7 is defined by CMake for the root7 builds of ROOTDataFrame, its dictionary and its users
+#ifdef R__HAS_ROOT7
+#include "ROOT/RNTuple.hxx" // for SnapshotRNTupleHelper
+#include "ROOT/RNTupleModel.hxx"
+#endif
 #include "ROOT/RDF/RDisplay.hxx"
 #include "RtypesCore.h"
 #include "TBranch.h"
@@ -44,6 +50,7 @@
 #include "TTree.h"
 #include "TTreeReader.h" // for SnapshotHelper
 #include "TStatistic.h"
+#include "TConcurrentFiller.h"
 #include "ROOT/RDF/RActionImpl.hxx"
 #include "ROOT/RDF/RMergeableValue.hxx"
 
@@ -557,6 +564,54 @@ public:
    }
 };
 
+/// Fill a TProfile or a TProfile2D from all the slots through one concurrent filler (see
+/// ROOT::TProfileConcurrentFiller), which needs one set of atomic sums instead of one copy of the profile per slot.
+/// Used by Profile1D and Profile2D if the `RDataFrame.ConcurrentProfileFill` rootrc/gEnv setting is enabled.
+template <typename PROFILE, typename FILLER>
+class R__CLING_PTRCHECK(off) ConcurrentProfileFillHelper
+   : public RActionImpl<ConcurrentProfileFillHelper<PROFILE, FILLER>> {
+   std::shared_ptr<PROFILE> fProfile;
+   std::unique_ptr<FILLER> fFiller;
+
+public:
+   ConcurrentProfileFillHelper(ConcurrentProfileFillHelper &&) = default;
+   ConcurrentProfileFillHelper(const ConcurrentProfileFillHelper &) = delete;
+
+   ConcurrentProfileFillHelper(const std::shared_ptr<PROFILE> &h, const unsigned int /*nSlots*/)
+      : fProfile(h), fFiller(std::make_unique<FILLER>(*h))
+   {
+   }
+
+   void InitTask(TTreeReader *, unsigned int) {}
+   void Initialize() {}
+
+   template <typename... ValTypes>
+   void Exec(unsigned int, const ValTypes &...x)
+   {
+      fFiller->Fill(x...);
+   }
+
+   void Finalize() { fFiller->Flush(); }
+
+   std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
+   {
+      return std::make_unique<RMergeableFill<PROFILE>>(*fProfile);
+   }
+
+   std::string GetActionName()
+   {
+      return std::string(fProfile->IsA()->GetName()) + "\\n" + std::string(fProfile->GetName());
+   }
+
+   ConcurrentProfileFillHelper MakeNew(void *newResult)
+   {
+      auto &result = *static_cast<std::shared_ptr<PROFILE> *>(newResult);
+      result->Reset();
+      result->SetDirectory(nullptr);
+      return ConcurrentProfileFillHelper(result, 1);
+   }
+};
+
 class R__CLING_PTRCHECK(off) FillTGraphHelper : public ROOT::Detail::RDF::RActionImpl<FillTGraphHelper> {
 public:
    using Result_t = ::TGraph;
@@ -1509,6 +1564,9 @@ void SetBranchesHelper(TTree *inputTree, TTree &outputTree, const std::string &i
 
 void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &treeName, const std::string &fileName);
 
+/// Return the name of the output file written by the given slot if RSnapshotOptions::fOutputPerSlot is set
+std::string SnapshotFileNameForSlot(const std::string &fileName, unsigned int slot);
+
 /// Helper object for a single-thread Snapshot action
 template <typename... ColTypes>
 class R__CLING_PTRCHECK(off) SnapshotHelper : public RActionImpl<SnapshotHelper<ColTypes...>> {
@@ -1663,7 +1721,8 @@ template <typename... ColTypes>
 class R__CLING_PTRCHECK(off) SnapshotHelperMT : public RActionImpl<SnapshotHelperMT<ColTypes...>> {
    unsigned int fNSlots;
    std::unique_ptr<ROOT::TBufferMerger> fMerger; // must use a ptr because TBufferMerger is not movable
-   std::vector<std::shared_ptr<ROOT::TBufferMergerFile>> fOutputFiles;
+   // TBufferMerger files, or with fOptions.fOutputPerSlot one file per slot that is not merged with the others
+   std::vector<std::shared_ptr<TFile>> fOutputFiles;
    std::vector<std::unique_ptr<TTree>> fOutputTrees;
    std::vector<int> fBranchAddressesNeedReset; // vector<bool> does not allow concurrent writing of different elements
    std::string fFileName;           // name of the output file name
@@ -1679,20 +1738,25 @@ class R__CLING_PTRCHECK(off) SnapshotHelperMT : public RActionImpl<SnapshotHelpe
    std::vector<std::vector<void *>> fBranchAddresses;
    std::vector<RBranchSet> fOutputBranches;
    std::vector<bool> fIsDefine;
+   // With fOptions.fOutputPerSlot, called with the files that have actually been written, which are known only at
+   // the end of the event loop. It sets up the dataframe returned by Snapshot.
+   std::function<void(const std::vector<std::string> &)> fOutputCallback;
 
 public:
    using ColumnTypes_t = TypeList<ColTypes...>;
    SnapshotHelperMT(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
                     std::string_view treename, const ColumnNames_t &vbnames, const ColumnNames_t &bnames,
-                    const RSnapshotOptions &options, std::vector<bool> &&isDefine)
+                    const RSnapshotOptions &options, std::vector<bool> &&isDefine,
+                    std::function<void(const std::vector<std::string> &)> outputCallback = {})
       : fNSlots(nSlots), fOutputFiles(fNSlots), fOutputTrees(fNSlots), fBranchAddressesNeedReset(fNSlots, 1),
         fFileName(filename), fDirName(dirname), fTreeName(treename), fOptions(options), fInputBranchNames(vbnames),
         fOutputBranchNames(ReplaceDotWithUnderscore(bnames)), fInputTrees(fNSlots),
         fBranches(fNSlots, std::vector<TBranch *>(vbnames.size(), nullptr)),
         fBranchAddresses(fNSlots, std::vector<void *>(vbnames.size(), nullptr)), fOutputBranches(fNSlots),
-        fIsDefine(std::move(isDefine))
+        fIsDefine(std::move(isDefine)), fOutputCallback(std::move(outputCallback))
    {
-      ValidateSnapshotOutput(fOptions, fTreeName, fFileName);
+      if (!fOptions.fOutputPerSlot)
+         ValidateSnapshotOutput(fOptions, fTreeName, fFileName);
    }
    SnapshotHelperMT(const SnapshotHelperMT &) = delete;
    SnapshotHelperMT(SnapshotHelperMT &&) = default;
@@ -1706,9 +1770,29 @@ public:
    void InitTask(TTreeReader *r, unsigned int slot)
    {
       ::TDirectory::TContext c; // do not let tasks change the thread-local gDirectory
+      if (r) {
+         // not an empty-source RDF
+         fInputTrees[slot] = r->GetTree();
+      }
+      fBranchAddressesNeedReset[slot] = 1; // reset first event flag for this slot
+      if (fOptions.fOutputPerSlot && fOutputTrees[slot]) {
+         // the output tree of this slot lives for the entire event loop, its branches get new addresses in Exec
+         return;
+      }
+
       if (!fOutputFiles[slot]) {
          // first time this thread executes something, let's create a TBufferMerger output directory
-         fOutputFiles[slot] = fMerger->GetFile();
+         // or the output file of this slot
+         if (fMerger) {
+            fOutputFiles[slot] = fMerger->GetFile();
+         } else {
+            const auto fileName = SnapshotFileNameForSlot(fFileName, slot);
+            ValidateSnapshotOutput(fOptions, fTreeName, fileName);
+            const auto cs = ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel);
+            fOutputFiles[slot].reset(TFile::Open(fileName.c_str(), fOptions.fMode.c_str(), fileName.c_str(), cs));
+            if (!fOutputFiles[slot])
+               throw std::runtime_error("Snapshot: could not create output file " + fileName);
+         }
       }
       TDirectory *treeDirectory = fOutputFiles[slot].get();
       if (!fDirName.empty()) {
@@ -1724,15 +1808,13 @@ public:
       fOutputTrees[slot]->SetImplicitMT(false);
       if (fOptions.fAutoFlush)
          fOutputTrees[slot]->SetAutoFlush(fOptions.fAutoFlush);
-      if (r) {
-         // not an empty-source RDF
-         fInputTrees[slot] = r->GetTree();
-      }
-      fBranchAddressesNeedReset[slot] = 1; // reset first event flag for this slot
    }
 
    void FinalizeTask(unsigned int slot)
    {
+      // per-slot output trees are written at the end of the event loop
+      if (fOptions.fOutputPerSlot)
+         return;
       if (fOutputTrees[slot]->GetEntries() > 0)
          fOutputFiles[slot]->Write();
       // clear now to avoid concurrent destruction of output trees and input tree (which has them listed as fClones)
@@ -1752,7 +1834,8 @@ public:
       fOutputTrees[slot]->Fill();
       auto entries = fOutputTrees[slot]->GetEntries();
       auto autoFlush = fOutputTrees[slot]->GetAutoFlush();
-      if ((autoFlush > 0) && (entries % autoFlush == 0))
+      // a per-slot output tree flushes its baskets to its own file by itself
+      if (fMerger && (autoFlush > 0) && (entries % autoFlush == 0))
          fOutputFiles[slot]->Write();
    }
 
@@ -1787,6 +1870,8 @@ public:
 
    void Initialize()
    {
+      if (fOptions.fOutputPerSlot)
+         return; // the output files are created by the slots on demand
       const auto cs = ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel);
       auto out_file = TFile::Open(fFileName.c_str(), fOptions.fMode.c_str(), /*ftitle=*/fFileName.c_str(), cs);
       if(!out_file)
@@ -1799,13 +1884,26 @@ public:
       assert(std::any_of(fOutputFiles.begin(), fOutputFiles.end(), [](const auto &ptr) { return ptr != nullptr; }));
 
       auto fileWritten = false;
-      for (auto &file : fOutputFiles) {
-         if (file) {
+      std::vector<std::string> perSlotFileNames;
+      for (unsigned int slot = 0; slot < fNSlots; ++slot) {
+         auto &file = fOutputFiles[slot];
+         if (!file)
+            continue;
+         if (fOptions.fOutputPerSlot) {
+            // use AutoSave to flush TTree contents because TTree::Write writes in gDirectory, not in fDirectory
+            fOutputTrees[slot]->AutoSave("flushbaskets");
+            // must destroy the TTree first, otherwise TFile will delete it too leading to a double delete
+            fOutputTrees[slot].reset();
+            fOutputBranches[slot].Clear();
+            perSlotFileNames.emplace_back(SnapshotFileNameForSlot(fFileName, slot));
+         } else {
             file->Write();
-            file->Close();
-            fileWritten = true;
          }
+         file->Close();
+         fileWritten = true;
       }
+      if (fOutputCallback)
+         fOutputCallback(perSlotFileNames);
 
       if (!fileWritten) {
          Warning("Snapshot",
@@ -1839,9 +1937,129 @@ public:
    {
       const std::string finalName = *reinterpret_cast<const std::string *>(newName);
       return SnapshotHelperMT{fNSlots,           finalName,          fDirName, fTreeName,
-                              fInputBranchNames, fOutputBranchNames, fOptions, std::vector<bool>(fIsDefine)};
+                              fInputBranchNames, fOutputBranchNames, fOptions, std::vector<bool>(fIsDefine),
+                              fOutputCallback};
+   }
+};
+
+#ifdef R__HAS_ROOT7
+/// Helper object for a Snapshot action that writes an RNTuple, see RSnapshotOptions::fOutputFormat.
+/// The slots fill their entries concurrently through the fill contexts of a parallel writer, so that pages are
+/// compressed and written by every slot individually instead of being merged at the end. With
+/// RSnapshotOptions::fOutputPerSlot, every slot writes its own file instead.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   unsigned int fNSlots;
+   std::string fFileName;
+   std::string fNTupleName;
+   RSnapshotOptions fOptions;
+   ColumnNames_t fOutputFieldNames;
+   // One writer, or one writer per slot with fOptions.fOutputPerSlot. Declared before the fill contexts because
+   // the contexts must be destructed before their writer.
+   std::vector<std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>> fWriters;
+   std::vector<std::shared_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts;
+   // Per slot, an entry without own memory which is bound to the values passed to Exec
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
+   // Called with the written files at the end of the event loop, sets up the dataframe returned by Snapshot
+   std::function<void(const std::vector<std::string> &)> fOutputCallback;
+
+   template <std::size_t... S>
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> MakeModel(std::index_sequence<S...> /*dummy*/) const
+   {
+      auto model = ROOT::Experimental::RNTupleModel::CreateBare();
+      int expander[] = {
+         (model->AddField(std::make_unique<ROOT::Experimental::RField<ColTypes>>(fOutputFieldNames[S])), 0)..., 0};
+      (void)expander;
+      return model;
+   }
+
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> MakeWriter(const std::string &fileName) const
+   {
+      ROOT::Experimental::RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(ROOT::CompressionSettings(fOptions.fCompressionAlgorithm, fOptions.fCompressionLevel));
+      return ROOT::Experimental::RNTupleParallelWriter::Recreate(MakeModel(std::index_sequence_for<ColTypes...>{}), fNTupleName, fileName, writeOptions);
+   }
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(const unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options,
+                         std::function<void(const std::vector<std::string> &)> outputCallback = {})
+      : fNSlots(nSlots), fFileName(filename), fNTupleName(ntuplename), fOptions(options),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames)), fFillContexts(fNSlots), fEntries(fNSlots),
+        fOutputCallback(std::move(outputCallback))
+   {
+      if (!dirname.empty())
+         throw std::invalid_argument("Snapshot: RNTuple output cannot be written to a TFile subdirectory");
+      TString fileMode = fOptions.fMode;
+      fileMode.ToLower();
+      if (fileMode != "recreate")
+         throw std::invalid_argument("Snapshot: RNTuple output requires the RECREATE file mode");
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+   ~SnapshotRNTupleHelper()
+   {
+      if (!fNTupleName.empty() /*not moved from*/ && fOptions.fLazy && fWriters.empty() /* never run */)
+         Warning("Snapshot", "A lazy Snapshot action was booked but never triggered.");
+   }
+
+   void Initialize()
+   {
+      if (fOptions.fOutputPerSlot) {
+         // the slots create their writers on demand
+         fWriters.resize(fNSlots);
+      } else {
+         fWriters.emplace_back(MakeWriter(fFileName));
+      }
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot)
+   {
+      if (fFillContexts[slot])
+         return;
+      auto &writer = fOptions.fOutputPerSlot ? fWriters[slot] : fWriters[0];
+      if (!writer)
+         writer = MakeWriter(SnapshotFileNameForSlot(fFileName, slot));
+      fFillContexts[slot] = writer->CreateFillContext();
+      fEntries[slot] = fFillContexts[slot]->GetModel()->CreateBareEntry();
+   }
+
+   void Exec(unsigned int slot, ColTypes &...values)
+   {
+      auto &entry = *fEntries[slot];
+      auto itValue = entry.begin();
+      // bind the top-level fields to the current values, in the order in which the fields were added to the model
+      int expander[] = {(*itValue = itValue->GetField()->BindValue(&values), ++itValue, 0)..., 0};
+      (void)expander;
+      fFillContexts[slot]->Fill(entry);
+   }
+
+   void Finalize()
+   {
+      // the contexts flush their last clusters on destruction, the writers then commit the ntuple
+      fEntries.clear();
+      fFillContexts.clear();
+      std::vector<std::string> fileNames;
+      for (unsigned int i = 0; i < fWriters.size(); ++i) {
+         if (!fWriters[i])
+            continue;
+         fWriters[i].reset();
+         fileNames.emplace_back(fOptions.fOutputPerSlot ? SnapshotFileNameForSlot(fFileName, i) : fFileName);
+      }
+      if (fOutputCallback)
+         fOutputCallback(fileNames);
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+
+   SnapshotRNTupleHelper MakeNew(void *newName)
+   {
+      const std::string finalName = *reinterpret_cast<const std::string *>(newName);
+      return SnapshotRNTupleHelper{fNSlots, finalName, "", fNTupleName, fOutputFieldNames, fOptions, fOutputCallback};
    }
 };
+#endif // R__HAS_ROOT7
 
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
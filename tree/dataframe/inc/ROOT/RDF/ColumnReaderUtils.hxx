@@ -42,11 +42,15 @@ namespace RDFDetail = ROOT::Detail::RDF;
 
 template <typename T>
 RDFDetail::RColumnReaderBase *GetColumnReader(unsigned int slot, RColumnReaderBase *defineOrVariationReader,
-                                              RLoopManager &lm, TTreeReader *r, const std::string &colName)
+                                              RLoopManager &lm, TTreeReader *r, const std::string &colName,
+                                              bool isBehindFilter = false)
 {
    if (defineOrVariationReader != nullptr)
       return defineOrVariationReader;
 
+   if (r != nullptr)
+      lm.AddTreeColumnUsage(slot, colName, isBehindFilter);
+
    // Check if we already inserted a reader for this column in the dataset column readers (RDataSource or Tree/TChain
    // readers)
    auto *datasetColReader = lm.GetDatasetColumnReader(slot, colName, typeid(T));
@@ -69,6 +73,8 @@ struct RColumnReadersInfo {
    RColumnRegister &fColRegister;
    const bool *fIsDefine;
    RLoopManager &fLoopManager;
+   /// Whether the columns are read by a node that only sees the entries that pass some filter
+   bool fIsBehindFilter = false;
 };
 
 /// Create a group of column readers, one per type in the parameter pack.
@@ -85,7 +91,7 @@ GetColumnReaders(unsigned int slot, TTreeReader *r, TypeList<ColTypes...>, const
    int i = -1;
    std::array<RDFDetail::RColumnReaderBase *, sizeof...(ColTypes)> ret{
       (++i, GetColumnReader<ColTypes>(slot, colRegister.GetReader(slot, colNames[i], variationName, typeid(ColTypes)),
-                                      lm, r, colNames[i]))...};
+                                      lm, r, colNames[i], colInfo.fIsBehindFilter))...};
    return ret;
 }
 
@@ -21,6 +21,8 @@
 namespace ROOT {
 namespace Internal {
 namespace RDF {
+class RNodeProfile;
+
 namespace GraphDrawing {
 
 enum class ENodeType {
@@ -51,6 +53,11 @@ class GraphNode {
 
    std::string fName, fColor, fShape;
 
+   ENodeType fType;
+
+   /// Profile of the corresponding node of the computation graph, null if its last event loop was not profiled
+   const RNodeProfile *fProfile = nullptr;
+
    /// Columns defined up to this node. By checking the defined columns between two consecutive
    /// nodes, it is possible to know if there was some Define in between.
    std::vector<std::string> fDefinedColumns;
@@ -113,7 +120,7 @@ class GraphNode {
 public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node with a name
-   GraphNode(std::string_view name, unsigned int id, ENodeType t) : fID(id), fName(name)
+   GraphNode(std::string_view name, unsigned int id, ENodeType t) : fID(id), fName(name), fType(t)
    {
       switch (t) {
       case ENodeType::kAction: SetAction(/*hasRun=*/false); break;
@@ -133,11 +140,15 @@ public:
    /// \brief Adds the column defined up to the node
    void AddDefinedColumns(const std::vector<std::string> &columns) { fDefinedColumns = columns; }
 
+   void SetProfile(const RNodeProfile *profile) { fProfile = profile; }
+
    std::string GetColor() const { return fColor; }
    unsigned int GetID() const { return fID; }
    std::string GetName() const { return fName; }
    std::string GetShape() const { return fShape; }
    GraphNode *GetPrevNode() const { return fPrevNode.get(); }
+   ENodeType GetType() const { return fType; }
+   const RNodeProfile *GetProfile() const { return fProfile; }
 
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Gets the column defined up to the node
@@ -100,6 +100,21 @@ public:
       auto actionPtr = resultPtr.fActionPtr;
       return FromGraphLeafToDot(*actionPtr->GetGraph(fVisitedMap));
    }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Prints the profile of the last event loop of the entire graph as JSON, see EnableProfiling()
+   std::string RepresentProfile(RLoopManager *rLoopManager);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Prints the profile of the last event loop of the graph the node belongs to as JSON
+   template <typename Proxied, typename DataSource>
+   std::string RepresentProfile(RInterface<Proxied, DataSource> &rInterface)
+   {
+      auto loopManager = rInterface.GetLoopManager();
+      loopManager->Jit();
+
+      return RepresentProfile(loopManager);
+   }
 };
 
 } // namespace GraphDrawing
@@ -29,6 +29,8 @@
 #include <ROOT/TypeTraits.hxx>
 #include <TError.h> // gErrorIgnoreLevel
 #include <TH1.h>
+#include <TProfile.h>
+#include <TProfile2D.h>
 #include <TROOT.h> // IsImplicitMTEnabled
 
 #include <deque>
@@ -44,6 +46,7 @@
 class TObjArray;
 class TTree;
 namespace ROOT {
+class RDataFrame;
 namespace Detail {
 namespace RDF {
 class RNodeBase;
@@ -155,6 +158,56 @@ BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TH1D> &h, const uns
    }
 }
 
+/// Whether Profile1D and Profile2D fill one profile from all the slots (`RDataFrame.ConcurrentProfileFill` setting)
+bool IsConcurrentProfileFillEnabled();
+
+// Profile1D and Profile2D filling with scalar columns: through a filler shared by all the slots if enabled
+template <typename FILLER, typename... ColTypes, typename PROFILE, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildProfileAction(const ColumnNames_t &bl, const std::shared_ptr<PROFILE> &h, const unsigned int nSlots,
+                   std::shared_ptr<PrevNodeType> prevNode, const RColumnRegister &colRegister,
+                   std::false_type /*hasContainerColumns*/)
+{
+   if (nSlots > 1 && IsConcurrentProfileFillEnabled()) {
+      using Helper_t = ConcurrentProfileFillHelper<PROFILE, FILLER>;
+      using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+      return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+   }
+   return BuildProfileAction<FILLER, ColTypes...>(bl, h, nSlots, std::move(prevNode), colRegister, std::true_type{});
+}
+
+// Profile1D and Profile2D filling with at least one container column: per-slot copies of the profile
+template <typename FILLER, typename... ColTypes, typename PROFILE, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildProfileAction(const ColumnNames_t &bl, const std::shared_ptr<PROFILE> &h, const unsigned int nSlots,
+                   std::shared_ptr<PrevNodeType> prevNode, const RColumnRegister &colRegister,
+                   std::true_type /*hasContainerColumns*/)
+{
+   using Helper_t = FillHelper<PROFILE>;
+   using Action_t = RAction<Helper_t, PrevNodeType, TTraits::TypeList<ColTypes...>>;
+   return std::make_unique<Action_t>(Helper_t(h, nSlots), bl, std::move(prevNode), colRegister);
+}
+
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TProfile> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Profile1D, const RColumnRegister &colRegister)
+{
+   using HasContainers_t = std::integral_constant<bool, Disjunction<IsDataContainer<ColTypes>...>::value>;
+   return BuildProfileAction<ROOT::TProfileConcurrentFiller, ColTypes...>(bl, h, nSlots, std::move(prevNode),
+                                                                          colRegister, HasContainers_t{});
+}
+
+template <typename... ColTypes, typename PrevNodeType>
+std::unique_ptr<RActionBase>
+BuildAction(const ColumnNames_t &bl, const std::shared_ptr<::TProfile2D> &h, const unsigned int nSlots,
+            std::shared_ptr<PrevNodeType> prevNode, ActionTags::Profile2D, const RColumnRegister &colRegister)
+{
+   using HasContainers_t = std::integral_constant<bool, Disjunction<IsDataContainer<ColTypes>...>::value>;
+   return BuildProfileAction<ROOT::TProfile2DConcurrentFiller, ColTypes...>(bl, h, nSlots, std::move(prevNode),
+                                                                            colRegister, HasContainers_t{});
+}
+
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
 BuildAction(const ColumnNames_t &bl, const std::shared_ptr<TGraph> &g, const unsigned int nSlots,
@@ -250,8 +303,19 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// Called at the end of the event loop with the names of the files that have been written, if these are known
+   /// only then (see IsSnapshotOutputDeferred())
+   std::function<void(const std::vector<std::string> &)> fOutputCallback;
 };
 
+/// Whether the dataframe returned by Snapshot can only be set up once the event loop has written the output,
+/// because its data source or its list of files are not known before
+inline bool IsSnapshotOutputDeferred(const ROOT::RDF::RSnapshotOptions &options)
+{
+   return options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple ||
+          (options.fOutputPerSlot && ROOT::IsImplicitMTEnabled());
+}
+
 // Snapshot action
 template <typename... ColTypes, typename PrevNodeType>
 std::unique_ptr<RActionBase>
@@ -275,7 +339,20 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    std::vector<bool> isDefine = makeIsDefine();
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+#ifdef R__HAS_ROOT7
+      // the same helper serves the single- and the multi-thread case
+      auto ntupleOptions = options;
+      ntupleOptions.fOutputPerSlot = ntupleOptions.fOutputPerSlot && ROOT::IsImplicitMTEnabled();
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(Helper_t(nSlots, filename, dirname, treename, outputColNames, ntupleOptions,
+                                            snapHelperArgs->fOutputCallback),
+                                   colNames, prevNode, colRegister));
+#else
+      throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7");
+#endif
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -287,7 +364,8 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
       using Helper_t = SnapshotHelperMT<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
       actionPtr.reset(new Action_t(
-         Helper_t(nSlots, filename, dirname, treename, colNames, outputColNames, options, std::move(isDefine)),
+         Helper_t(nSlots, filename, dirname, treename, colNames, outputColNames, options, std::move(isDefine),
+                  snapHelperArgs->fOutputCallback),
          colNames, prevNode, colRegister));
    }
    return actionPtr;
@@ -400,6 +478,8 @@ void AddDSColumnsHelper(const std::string &colName, RLoopManager &lm, RDataSourc
    if (!valuePtrs.empty()) { // we are using the old GetColumnReaders mechanism in this RDataSource
       for (auto *ptr : valuePtrs)
          colReaders.emplace_back(new RDSColumnReader<T>(ptr));
+      // these readers only expose the value of the entry that was loaded last
+      lm.SetHasValuePtrColumnReaders();
 
    } else { // using the new GetColumnReaders mechanism
       // TODO consider changing the interface so we return all of these for all slots in one go
@@ -762,6 +842,9 @@ struct IsDeque_t<std::deque<T>> : std::true_type {};
 
 void CheckForDuplicateSnapshotColumns(const ColumnNames_t &cols);
 
+std::shared_ptr<ROOT::RDataFrame> MakeSnapshotDataFrame(SnapshotHelperArgs &args, std::string_view fullTreeName,
+                                                        const ColumnNames_t &defaultColumns);
+
 template <typename T>
 struct InnerValueType {
    using type = T; // fallback for when T is not a nested RVec
@@ -13,9 +13,14 @@
 
 #include "ROOT/RDataFrame.hxx"
 
-#include <vector>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace ROOT {
 namespace Internal {
@@ -69,6 +74,131 @@ ROOT::RDF::RResultPtr<std::vector<T>> RDataFrameTake(ROOT::RDF::RNode df, std::s
    return df.Take<T>(column);
 }
 
+/// Take the column into an RVec: its memory is adopted by numpy through the array interface, without copy of the
+/// collected values
+template <typename T>
+ROOT::RDF::RResultPtr<ROOT::RVec<T>> RDataFrameTakeRVec(ROOT::RDF::RNode df, std::string_view column)
+{
+   return df.Take<T, ROOT::RVec<T>>(column);
+}
+
+// RDataFrame batch callbacks
+
+/// Invoked with batches of column values: `columns[i]` points to `nEntries` values of the i-th column, with the
+/// buffer protocol format `formats[i]`. Returns false in case of error, which stops the event loop.
+using BatchCallback_t = bool (*)(void *userData, unsigned int slot, std::size_t nEntries, std::size_t nColumns,
+                                 void *const *columns, const char *const *formats);
+
+/// Values of type T are buffered as BatchStorage_t<T>, which is contiguous also for bool
+template <typename T>
+using BatchStorage_t = std::conditional_t<std::is_same<T, bool>::value, unsigned char, T>;
+
+/// Buffer protocol format of the values of type T
+template <typename T>
+const char *GetBatchFormat()
+{
+   static_assert(std::is_arithmetic<T>::value, "Only columns of arithmetic types can be processed in batches");
+   if (std::is_same<T, bool>::value)
+      return "?";
+   if (std::is_floating_point<T>::value)
+      return sizeof(T) == sizeof(float) ? "f" : "d";
+   switch (sizeof(T)) {
+   case 1: return std::is_signed<T>::value ? "b" : "B";
+   case 2: return std::is_signed<T>::value ? "h" : "H";
+   case 4: return std::is_signed<T>::value ? "i" : "I";
+   default: return std::is_signed<T>::value ? "q" : "Q";
+   }
+}
+
+/// Action helper which collects the values of the columns per processing slot and passes them to the callback
+/// in batches of fBatchSize entries. With a Python callback, this crosses the language boundary and takes the GIL
+/// once per batch instead of once per entry. The result is the number of entries passed to the callback.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) RBatchCallbackHelper
+   : public ROOT::Detail::RDF::RActionImpl<RBatchCallbackHelper<ColTypes...>> {
+   using Buffers_t = std::tuple<std::vector<BatchStorage_t<ColTypes>>...>;
+
+   BatchCallback_t fCallback;
+   void *fUserData;
+   std::size_t fBatchSize;
+   std::vector<Buffers_t> fBuffers; ///< One set of column buffers per slot
+   std::vector<ULong64_t> fNEntries; ///< Entries passed to the callback per slot
+   std::shared_ptr<ULong64_t> fResult;
+
+   template <std::size_t... Idx>
+   void Flush(unsigned int slot, std::index_sequence<Idx...>)
+   {
+      auto &buffers = fBuffers[slot];
+      const auto nEntries = std::get<0>(buffers).size();
+      if (nEntries == 0)
+         return;
+      void *columns[] = {std::get<Idx>(buffers).data()...};
+      const char *formats[] = {GetBatchFormat<ColTypes>()...};
+      if (!fCallback(fUserData, slot, nEntries, sizeof...(ColTypes), columns, formats))
+         throw std::runtime_error("RDataFrame batch callback: the callback failed");
+      fNEntries[slot] += nEntries;
+      int expander[] = {(std::get<Idx>(buffers).clear(), 0)...};
+      (void)expander;
+   }
+
+   template <std::size_t... Idx>
+   void Push(unsigned int slot, std::index_sequence<Idx...>, const ColTypes &...values)
+   {
+      auto &buffers = fBuffers[slot];
+      int expander[] = {(std::get<Idx>(buffers).push_back(values), 0)...};
+      (void)expander;
+   }
+
+public:
+   using Result_t = ULong64_t;
+
+   RBatchCallbackHelper(BatchCallback_t callback, void *userData, std::size_t batchSize, unsigned int nSlots)
+      : fCallback(callback),
+        fUserData(userData),
+        fBatchSize(std::max<std::size_t>(1, batchSize)),
+        fBuffers(nSlots),
+        fNEntries(nSlots, 0),
+        fResult(std::make_shared<ULong64_t>(0))
+   {
+      static_assert(sizeof...(ColTypes) > 0, "At least one column is required");
+   }
+   RBatchCallbackHelper(RBatchCallbackHelper &&) = default;
+   RBatchCallbackHelper(const RBatchCallbackHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+
+   void Initialize() {}
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, const ColTypes &...values)
+   {
+      Push(slot, std::index_sequence_for<ColTypes...>(), values...);
+      if (std::get<0>(fBuffers[slot]).size() >= fBatchSize)
+         Flush(slot, std::index_sequence_for<ColTypes...>());
+   }
+
+   void Finalize()
+   {
+      for (unsigned int slot = 0; slot < fBuffers.size(); ++slot)
+         Flush(slot, std::index_sequence_for<ColTypes...>());
+      *fResult = std::accumulate(fNEntries.begin(), fNEntries.end(), ULong64_t(0));
+   }
+
+   std::string GetActionName() { return "BatchCallback"; }
+};
+
+/// Book an action passing the values of the columns to the callback at address `callback` in batches of `batchSize`
+/// entries, see RBatchCallbackHelper. Used by PyROOT to apply vectorized Python functions to numpy arrays.
+template <typename... ColTypes>
+ROOT::RDF::RResultPtr<ULong64_t> BookBatchCallback(ROOT::RDF::RNode df, const std::vector<std::string> &columns,
+                                                      ULong64_t callback, ULong64_t userData, std::size_t batchSize)
+{
+   RBatchCallbackHelper<ColTypes...> helper(reinterpret_cast<BatchCallback_t>(callback),
+                                            reinterpret_cast<void *>(userData), batchSize, df.GetNSlots());
+   return df.Book<ColTypes...>(std::move(helper), columns);
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
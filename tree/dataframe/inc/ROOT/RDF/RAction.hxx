@@ -19,6 +19,7 @@
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RVariedAction.hxx"
 
+#include <algorithm> // std::count
 #include <array>
 #include <cstddef> // std::size_t
 #include <memory>
@@ -62,10 +63,14 @@ class R__CLING_PTRCHECK(off) RAction : public RActionBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// Per slot, the filter results of the current block of entries in a bulk event loop
+   std::vector<RBulkMask> fBulkMasks;
+
 public:
    RAction(Helper &&h, const ColumnNames_t &columns, std::shared_ptr<PrevNode> pd, const RColumnRegister &colRegister)
       : RActionBase(pd->GetLoopManagerUnchecked(), columns, colRegister, pd->GetVariations()),
-        fHelper(std::forward<Helper>(h)), fPrevNodePtr(std::move(pd)), fPrevNode(*fPrevNodePtr), fValues(GetNSlots())
+        fHelper(std::forward<Helper>(h)), fPrevNodePtr(std::move(pd)), fPrevNode(*fPrevNodePtr), fValues(GetNSlots()),
+        fBulkMasks(GetNSlots())
    {
       fLoopManager->Register(this);
 
@@ -94,8 +99,12 @@ public:
    {
       RColumnReadersInfo info{RActionBase::GetColumnNames(), RActionBase::GetColRegister(), fIsDefine.data(),
                               *fLoopManager};
+      std::vector<std::string> upstreamFilters;
+      fPrevNode.AddFilterName(upstreamFilters);
+      info.fIsBehindFilter = !upstreamFilters.empty();
       fValues[slot] = GetColumnReaders(slot, r, ColumnTypes_t{}, info);
       fHelper.InitTask(r, slot);
+      fBulkMasks[slot].Reset(fLoopManager->GetBulkSize());
    }
 
    template <typename... ColTypes, std::size_t... S>
@@ -108,8 +117,23 @@ public:
    void Run(unsigned int slot, Long64_t entry) final
    {
       // check if entry passes all filters
-      if (fPrevNode.CheckFilters(slot, entry))
+      if (fPrevNode.CheckFilters(slot, entry)) {
+         RNodeTimer timer(fProfile.get(), slot);
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      }
+   }
+
+   void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries) final
+   {
+      auto mask = fBulkMasks[slot].fMask.get();
+      fPrevNode.CheckFiltersBulk(slot, firstEntry, nEntries, mask);
+      RNodeTimer timer(fProfile.get(), slot);
+      if (fProfile)
+         timer.SetNCalls(std::count(mask, mask + nEntries, true));
+      for (std::size_t i = 0; i < nEntries; ++i) {
+         if (mask[i])
+            CallExec(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+      }
    }
 
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
@@ -139,6 +163,7 @@ public:
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
       auto thisNode =
          std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName(), visitedMap.size(), nodeType);
+      thisNode->SetProfile(GetProfile());
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
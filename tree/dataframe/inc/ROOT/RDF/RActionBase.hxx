@@ -12,10 +12,12 @@
 #define ROOT_RACTIONBASE
 
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -42,6 +44,8 @@ protected:
    /// A raw pointer to the RLoopManager at the root of this functional graph.
    /// Never null: children nodes have shared ownership of parent nodes in the graph.
    RLoopManager *fLoopManager;
+   /// Filled during the event loop if profiling is enabled, null otherwise
+   std::unique_ptr<RNodeProfile> fProfile;
 
 private:
    const unsigned int fNSlots; ///< Number of thread slots used by this node.
@@ -64,6 +68,13 @@ public:
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Process the block of entries [firstEntry, firstEntry + nEntries) in a bulk event loop.
+   /// By default, the entries are processed one by one.
+   virtual void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries)
+   {
+      for (std::size_t i = 0; i < nEntries; ++i)
+         Run(slot, firstEntry + i);
+   }
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -92,6 +103,9 @@ public:
 
    virtual std::unique_ptr<RActionBase> MakeVariedAction(std::vector<void *> &&results) = 0;
    virtual std::unique_ptr<RActionBase> CloneAction(void *newResult) = 0;
+
+   void SetProfile(std::unique_ptr<RNodeProfile> profile) { fProfile = std::move(profile); }
+   const RNodeProfile *GetProfile() const { return fProfile.get(); }
 };
 } // namespace RDF
 } // namespace Internal
@@ -0,0 +1,353 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RCACHEDS
+#define ROOT_RDF_RCACHEDS
+
+#include "Compression.h"
+#include "ROOT/RDataSource.hxx"
+#include "ROOT/RDF/RActionImpl.hxx"
+#include "ROOT/RDF/Utils.hxx" // TypeID2TypeName
+#include "ROOT/RResultPtr.hxx"
+#include "ROOT/RVec.hxx"
+#include "RtypesCore.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace RDF {
+
+/// Options of RInterface::Cache to store the cached columns in compressed pages
+struct RCacheOptions {
+   /// Compression settings of the pages of columns of trivially copyable types, 0 to store them uncompressed.
+   /// The columns of other types are kept as they are.
+   int fCompressionSettings = ROOT::RCompressionSetting::EDefaults::kUseAnalysis;
+   /// Number of entries of a cluster. A cluster is filled by one processing slot and read by one processing slot.
+   ULong64_t fClusterSize = 10000;
+   /// Bytes of pages kept in memory, 0 for no limit. Beyond, the pages are spilled to a temporary file.
+   std::size_t fMaxMemory = 0;
+   /// Directory of the temporary file, the system temporary directory if empty
+   std::string fSpillDirectory;
+};
+
+} // namespace RDF
+
+namespace Internal {
+namespace RDF {
+
+/// Stores the pages of the cached columns, compressed and kept in memory or written to a temporary file.
+/// Pages can be stored and loaded from several threads concurrently.
+class RCachePageStore {
+public:
+   using PageId_t = std::size_t;
+
+private:
+   struct RPage {
+      std::unique_ptr<unsigned char[]> fData; ///< Null if the page is spilled to the file
+      std::size_t fStoredSize = 0;
+      Long64_t fFileOffset = -1;
+      bool fCompressed = false;
+   };
+
+   ROOT::RDF::RCacheOptions fOptions;
+   std::mutex fMutex;
+   std::deque<RPage> fPages;
+   std::size_t fMemorySize = 0;
+   std::size_t fSpilledSize = 0;
+   std::FILE *fSpillFile = nullptr;
+   std::string fSpillPath;
+
+   bool OpenSpillFile();
+
+public:
+   explicit RCachePageStore(const ROOT::RDF::RCacheOptions &options);
+   RCachePageStore(const RCachePageStore &) = delete;
+   RCachePageStore &operator=(const RCachePageStore &) = delete;
+   ~RCachePageStore();
+
+   /// Store the `size` bytes of `raw` as a new page
+   PageId_t Store(const void *raw, std::size_t size);
+   /// Copy the page back into `raw`, which has room for the `size` bytes it was stored with
+   void Load(PageId_t id, void *raw, std::size_t size);
+
+   std::size_t GetMemorySize() const { return fMemorySize; }
+   std::size_t GetSpilledSize() const { return fSpilledSize; }
+};
+
+/// The values of a column in a cluster: a page of the store for trivially copyable types, the values otherwise
+template <typename T, bool = std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value>
+class RCacheColumnPage {
+   RCachePageStore::PageId_t fPage = 0;
+
+public:
+   void Fill(RCachePageStore &store, ROOT::RVec<T> &values)
+   {
+      fPage = store.Store(values.data(), values.size() * sizeof(T));
+      values.clear();
+   }
+   /// Returns the values of the cluster, decoded into `buffer`
+   const T *Load(RCachePageStore &store, std::size_t nEntries, ROOT::RVec<T> &buffer)
+   {
+      buffer.resize(nEntries);
+      store.Load(fPage, buffer.data(), nEntries * sizeof(T));
+      return buffer.data();
+   }
+};
+
+template <typename T>
+class RCacheColumnPage<T, false> {
+   std::shared_ptr<const ROOT::RVec<T>> fValues;
+
+public:
+   void Fill(RCachePageStore &, ROOT::RVec<T> &values)
+   {
+      fValues = std::make_shared<const ROOT::RVec<T>>(std::move(values));
+      values = ROOT::RVec<T>();
+   }
+   const T *Load(RCachePageStore &, std::size_t, ROOT::RVec<T> &) { return fValues->data(); }
+};
+
+/// The cached dataset: the clusters of entries filled by the processing slots
+template <typename... ColTypes>
+struct RCacheData {
+   struct RCluster {
+      std::size_t fNEntries = 0;
+      std::tuple<RCacheColumnPage<ColTypes>...> fColumns;
+   };
+
+   std::unique_ptr<RCachePageStore> fStore;
+   std::vector<RCluster> fClusters;
+   std::mutex fMutex; ///< Protects fClusters while filling
+
+   explicit RCacheData(const ROOT::RDF::RCacheOptions &options) : fStore(new RCachePageStore(options)) {}
+};
+
+/// Action helper filling an RCacheData, with one set of column buffers per slot
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) RCacheFillHelper : public ROOT::Detail::RDF::RActionImpl<RCacheFillHelper<ColTypes...>> {
+   using Buffers_t = std::tuple<ROOT::RVec<ColTypes>...>;
+   using Cluster_t = typename RCacheData<ColTypes...>::RCluster;
+
+   std::shared_ptr<RCacheData<ColTypes...>> fData;
+   std::vector<Buffers_t> fBuffers;
+   std::size_t fClusterSize;
+
+   template <std::size_t... S>
+   void Commit(unsigned int slot, std::index_sequence<S...>)
+   {
+      auto &buffers = fBuffers[slot];
+      Cluster_t cluster;
+      cluster.fNEntries = std::get<0>(buffers).size();
+      if (cluster.fNEntries == 0)
+         return;
+      // the compression runs in the thread of the slot, only the list of clusters is shared
+      int expander[] = {(std::get<S>(cluster.fColumns).Fill(*fData->fStore, std::get<S>(buffers)), 0)...};
+      (void)expander;
+      std::lock_guard<std::mutex> lock(fData->fMutex);
+      fData->fClusters.emplace_back(std::move(cluster));
+   }
+
+   template <std::size_t... S>
+   void Push(unsigned int slot, std::index_sequence<S...>, const ColTypes &...values)
+   {
+      auto &buffers = fBuffers[slot];
+      int expander[] = {(std::get<S>(buffers).push_back(values), 0)...};
+      (void)expander;
+   }
+
+public:
+   using Result_t = RCacheData<ColTypes...>;
+
+   RCacheFillHelper(const ROOT::RDF::RCacheOptions &options, unsigned int nSlots)
+      : fData(std::make_shared<Result_t>(options)),
+        fBuffers(nSlots),
+        fClusterSize(std::max<ULong64_t>(1, options.fClusterSize))
+   {
+   }
+   RCacheFillHelper(RCacheFillHelper &&) = default;
+   RCacheFillHelper(const RCacheFillHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fData; }
+
+   void Initialize() {}
+
+   void InitTask(TTreeReader *, unsigned int) {}
+
+   void Exec(unsigned int slot, const ColTypes &...values)
+   {
+      Push(slot, std::index_sequence_for<ColTypes...>(), values...);
+      if (std::get<0>(fBuffers[slot]).size() >= fClusterSize)
+         Commit(slot, std::index_sequence_for<ColTypes...>());
+   }
+
+   void Finalize()
+   {
+      for (unsigned int slot = 0; slot < fBuffers.size(); ++slot)
+         Commit(slot, std::index_sequence_for<ColTypes...>());
+      fBuffers.clear();
+   }
+
+   std::string GetActionName() { return "Cache"; }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief A RDataSource reading the columns cached by RInterface::Cache with RCacheOptions
+///
+/// The clusters of the cache are the entry ranges of the event loop. A slot decodes all the
+/// columns of a cluster when it reaches its first entry; the values are then used in place.
+/// The cache is filled when the event loop of this data source runs for the first time.
+template <typename... ColTypes>
+class RCacheDS final : public ROOT::RDF::RDataSource {
+   static constexpr std::size_t kNColumns = sizeof...(ColTypes);
+
+   struct RSlot {
+      std::size_t fCluster = static_cast<std::size_t>(-1);
+      ULong64_t fFirstEntry = 0;
+      std::size_t fNEntries = 0;
+      std::tuple<ROOT::RVec<ColTypes>...> fBuffers;
+      std::array<const void *, kNColumns> fClusterValues{};
+      std::array<const void *, kNColumns> fValues{}; ///< Pointers to the values of the current entry
+   };
+
+   ROOT::RDF::RResultPtr<RCacheData<ColTypes...>> fData;
+   const std::vector<std::string> fColNames;
+   const std::map<std::string, std::string> fColTypesMap;
+   std::vector<ULong64_t> fClusterStarts; ///< First entry of each cluster
+   std::vector<RSlot> fSlots;
+   std::vector<std::pair<ULong64_t, ULong64_t>> fEntryRanges;
+
+   template <std::size_t... S>
+   void LoadCluster(RSlot &slot, std::size_t cluster, std::index_sequence<S...>)
+   {
+      auto &data = *fData;
+      auto &c = data.fClusters[cluster];
+      int expander[] = {(slot.fClusterValues[S] = std::get<S>(c.fColumns).Load(*data.fStore, c.fNEntries,
+                                                                              std::get<S>(slot.fBuffers)),
+                         0)...};
+      (void)expander;
+      slot.fCluster = cluster;
+      slot.fFirstEntry = fClusterStarts[cluster];
+      slot.fNEntries = c.fNEntries;
+   }
+
+   template <std::size_t... S>
+   void SetValues(RSlot &slot, std::size_t index, std::index_sequence<S...>)
+   {
+      int expander[] = {(slot.fValues[S] = static_cast<const ColTypes *>(slot.fClusterValues[S]) + index, 0)...};
+      (void)expander;
+   }
+
+   Record_t GetColumnReadersImpl(std::string_view colName, const std::type_info &id) final
+   {
+      const auto colNameStr = std::string(colName);
+      auto it = fColTypesMap.find(colNameStr);
+      if (it == fColTypesMap.end())
+         throw std::runtime_error("The specified column name, \"" + colNameStr + "\" is not known to the data source.");
+      const auto idName = ROOT::Internal::RDF::TypeID2TypeName(id);
+      if (it->second != idName)
+         throw std::runtime_error("Column " + colNameStr + " has type " + it->second +
+                                  " while the id specified is associated to type " + idName);
+
+      const auto index = std::distance(fColNames.begin(), std::find(fColNames.begin(), fColNames.end(), colNameStr));
+      Record_t ret(fSlots.size());
+      for (std::size_t slot = 0; slot < fSlots.size(); ++slot)
+         ret[slot] = &fSlots[slot].fValues[index];
+      return ret;
+   }
+
+protected:
+   std::string AsString() final { return "compressed cache data source"; }
+
+public:
+   RCacheDS(ROOT::RDF::RResultPtr<RCacheData<ColTypes...>> data, const std::vector<std::string> &colNames)
+      : fData(std::move(data)),
+        fColNames(colNames),
+        fColTypesMap(MakeColTypesMap(colNames, std::index_sequence_for<ColTypes...>()))
+   {
+   }
+
+   template <std::size_t... S>
+   static std::map<std::string, std::string>
+   MakeColTypesMap(const std::vector<std::string> &colNames, std::index_sequence<S...>)
+   {
+      return {{colNames[S], ROOT::Internal::RDF::TypeID2TypeName(typeid(ColTypes))}...};
+   }
+
+   const std::vector<std::string> &GetColumnNames() const final { return fColNames; }
+
+   std::string GetTypeName(std::string_view colName) const final { return fColTypesMap.at(std::string(colName)); }
+
+   bool HasColumn(std::string_view colName) const final
+   {
+      return fColTypesMap.find(std::string(colName)) != fColTypesMap.end();
+   }
+
+   void SetNSlots(unsigned int nSlots) final { fSlots.resize(nSlots); }
+
+   void Initialize() final
+   {
+      // runs the event loop filling the cache the first time
+      const auto &clusters = fData->fClusters;
+      fClusterStarts.resize(clusters.size());
+      fEntryRanges.clear();
+      ULong64_t start = 0;
+      for (std::size_t i = 0; i < clusters.size(); ++i) {
+         fClusterStarts[i] = start;
+         fEntryRanges.emplace_back(start, start + clusters[i].fNEntries);
+         start += clusters[i].fNEntries;
+      }
+   }
+
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final
+   {
+      auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+      return entryRanges;
+   }
+
+   bool SetEntry(unsigned int slotIndex, ULong64_t entry) final
+   {
+      auto &slot = fSlots[slotIndex];
+      if (slot.fCluster == static_cast<std::size_t>(-1) || entry < slot.fFirstEntry ||
+          entry >= slot.fFirstEntry + slot.fNEntries) {
+         const auto cluster =
+            std::upper_bound(fClusterStarts.begin(), fClusterStarts.end(), entry) - fClusterStarts.begin() - 1;
+         LoadCluster(slot, cluster, std::index_sequence_for<ColTypes...>());
+      }
+      SetValues(slot, entry - slot.fFirstEntry, std::index_sequence_for<ColTypes...>());
+      return true;
+   }
+
+   void Finalize() final
+   {
+      // the decoded clusters are not kept between event loops
+      for (auto &slot : fSlots)
+         slot = RSlot();
+   }
+
+   std::string GetLabel() final { return "CacheDS"; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
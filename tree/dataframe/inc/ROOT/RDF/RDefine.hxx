@@ -55,7 +55,8 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    using ColumnTypes_t =
       RDFInternal::RemoveFirstTwoParametersIf_t<std::is_same<ExtraArgsTag, SlotAndEntryTag>::value, ColumnTypesTmp_t>;
    using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
-   using ret_type = typename CallableTraits<F>::ret_type;
+   // expressions that return lazy RVec expressions define columns of materialized RVecs
+   using ret_type = ROOT::Internal::VecOps::MaterializedType_t<typename CallableTraits<F>::ret_type>;
    // Avoid instantiating vector<bool> as `operator[]` returns temporaries in that case. Use std::deque instead.
    using ValuesPerSlot_t =
       std::conditional_t<std::is_same<ret_type, bool>::value, std::deque<ret_type>, std::vector<ret_type>>;
@@ -73,16 +74,16 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    template <typename... ColTypes, std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      RDFInternal::AssignCachedValue(fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()],
+                                     fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...));
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
    void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      RDFInternal::AssignCachedValue(fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()],
+                                     fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...));
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
@@ -90,8 +91,8 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    void
    UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      RDFInternal::AssignCachedValue(fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()],
+                                     fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...));
    }
 
 public:
@@ -126,6 +127,7 @@ public:
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          // evaluate this define expression, cache the result
+         RDFInternal::RNodeTimer timer(fProfile.get(), slot);
          UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
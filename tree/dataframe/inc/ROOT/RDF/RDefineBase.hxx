@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/GraphNode.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
@@ -48,6 +49,8 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   /// Filled during the event loop if profiling is enabled, null otherwise
+   std::unique_ptr<RDFInternal::RNodeProfile> fProfile;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -76,6 +79,10 @@ public:
 
    /// Return a clone of this Define that works with values in the variationName "universe".
    virtual RDefineBase &GetVariedDefine(const std::string &variationName) = 0;
+
+   void SetProfile(std::unique_ptr<RDFInternal::RNodeProfile> profile) { fProfile = std::move(profile); }
+   // overridden by RJittedDefine
+   virtual const RDFInternal::RNodeProfile *GetProfile() const { return fProfile.get(); }
 };
 
 } // ns RDF
@@ -90,13 +90,28 @@ public:
 
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
+      if (fLoopManager->GetBulkSize() > 0) {
+         // bulk event loop: evaluate the filter for the entire block of entries that contains this entry
+         const auto &bulkResults = fBulkResults[slot];
+         if (!bulkResults.Contains(entry)) {
+            const auto &block = fLoopManager->GetBulkBlock(slot);
+            assert(block.Contains(entry));
+            EvalBulk(slot, block.fFirstEntry, block.fNEntries);
+         }
+         return bulkResults.fMask[entry - bulkResults.fFirstEntry];
+      }
+
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          if (!fPrevNode.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
             // evaluate this filter, cache the result
-            auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+            bool passed;
+            {
+               RDFInternal::RNodeTimer timer(fProfile.get(), slot);
+               passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+            }
             passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
                    : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = passed;
@@ -106,6 +121,39 @@ public:
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries, bool *mask) final
+   {
+      const auto &bulkResults = fBulkResults[slot];
+      if (!bulkResults.Holds(firstEntry, nEntries))
+         EvalBulk(slot, firstEntry, nEntries);
+      std::copy(bulkResults.fMask.get(), bulkResults.fMask.get() + nEntries, mask);
+   }
+
+   /// Evaluate the filter for the block of entries [firstEntry, firstEntry + nEntries) and cache the results
+   void EvalBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries)
+   {
+      auto &bulkResults = fBulkResults[slot];
+      assert(nEntries <= bulkResults.fCapacity);
+      auto results = bulkResults.fMask.get();
+      fPrevNode.CheckFiltersBulk(slot, firstEntry, nEntries, results);
+      ULong64_t nAccepted = 0;
+      ULong64_t nRejected = 0;
+      {
+         RDFInternal::RNodeTimer timer(fProfile.get(), slot);
+         for (std::size_t i = 0; i < nEntries; ++i) {
+            if (!results[i])
+               continue;
+            results[i] = CheckFilterHelper(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+            results[i] ? ++nAccepted : ++nRejected;
+         }
+         timer.SetNCalls(nAccepted + nRejected);
+      }
+      fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+      fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nRejected;
+      bulkResults.fFirstEntry = firstEntry;
+      bulkResults.fNEntries = nEntries;
+   }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
@@ -118,8 +166,12 @@ public:
    void InitSlot(TTreeReader *r, unsigned int slot) final
    {
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
+      std::vector<std::string> upstreamFilters;
+      fPrevNode.AddFilterName(upstreamFilters);
+      info.fIsBehindFilter = !upstreamFilters.empty();
       fValues[slot] = RDFInternal::GetColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkResults[slot].Reset(fLoopManager->GetBulkSize());
    }
 
    // recursive chain of `Report`s
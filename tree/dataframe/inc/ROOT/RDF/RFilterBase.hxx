@@ -13,6 +13,7 @@
 
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "ROOT/RVec.hxx"
 #include "RtypesCore.h"
@@ -41,6 +42,8 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   /// Per slot, the results for the last block of entries checked in bulk, see CheckFiltersBulk()
+   std::vector<RDFInternal::RBulkMask> fBulkResults;
    const std::string fName;
    const ROOT::RDF::ColumnNames_t fColumnNames;
    RDFInternal::RColumnRegister fColRegister;
@@ -48,6 +51,8 @@ protected:
    ROOT::RVecB fIsDefine;
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
+   /// Filled during the event loop if profiling is enabled, null otherwise
+   std::unique_ptr<RDFInternal::RNodeProfile> fProfile;
 
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
@@ -72,6 +77,8 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+   void SetProfile(std::unique_ptr<RDFInternal::RNodeProfile> profile) { fProfile = std::move(profile); }
+   const RDFInternal::RNodeProfile *GetProfile() const { return fProfile.get(); }
 };
 
 } // ns RDF
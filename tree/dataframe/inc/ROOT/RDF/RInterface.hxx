@@ -13,6 +13,7 @@
 
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/ActionHelpers.hxx"
+#include "ROOT/RDF/RCacheDS.hxx"
 #include "ROOT/RDF/HistoModels.hxx"
 #include "ROOT/RDF/InterfaceUtils.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
@@ -88,6 +89,9 @@ namespace RDF {
 class GraphCreatorHelper;
 void ChangeEmptyEntryRange(const ROOT::RDF::RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
 void ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+void SetBulkSize(const ROOT::RDF::RNode &node, unsigned int bulkSize);
+void EnableProfiling(const ROOT::RDF::RNode &node, bool enable = true);
+void EnableRVecArena(const ROOT::RDF::RNode &node, bool enable = true);
 void TriggerRun(ROOT::RDF::RNode node);
 } // namespace RDF
 } // namespace Internal
@@ -121,6 +125,9 @@ class RInterface : public RInterfaceBase {
    friend void RDFInternal::TriggerRun(RNode node);
    friend void RDFInternal::ChangeEmptyEntryRange(const RNode &node, std::pair<ULong64_t, ULong64_t> &&newRange);
    friend void RDFInternal::ChangeSpec(const RNode &node, ROOT::RDF::Experimental::RDatasetSpec &&spec);
+   friend void RDFInternal::SetBulkSize(const RNode &node, unsigned int bulkSize);
+   friend void RDFInternal::EnableProfiling(const RNode &node, bool enable);
+   friend void RDFInternal::EnableRVecArena(const RNode &node, bool enable);
 
    std::shared_ptr<Proxied> fProxiedPtr; ///< Smart pointer to the graph node encapsulated by this RInterface.
 
@@ -1022,7 +1029,8 @@ public:
                                          colListWithAliasesAndSizeBranches, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      auto newRDF =
+         RDFInternal::MakeSnapshotDataFrame(*snapHelperArgs, fullTreeName, colListNoAliasesWithSizeBranches);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, fProxiedPtr,
@@ -1129,6 +1137,13 @@ public:
    /// ~~~{.cpp}
    /// auto cache_all_cols_df = df.Cache(myRegexp);
    /// ~~~
+   ///
+   /// **Compressed cache, spilled to a temporary file beyond 2 GB:**
+   /// ~~~{.cpp}
+   /// ROOT::RDF::RCacheOptions opts;
+   /// opts.fMaxMemory = 2ull * 1024 * 1024 * 1024;
+   /// auto cache_compressed_df = df.Cache({"col0", "col1"}, opts);
+   /// ~~~
    template <typename... ColumnTypes>
    RInterface<RLoopManager> Cache(const ColumnNames_t &columnList)
    {
@@ -1136,52 +1151,45 @@ public:
       return CacheImpl<ColumnTypes...>(columnList, staticSeq);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in memory, in compressed pages.
+   /// \tparam ColumnTypes variadic list of branch/column types.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options compression, cluster size and spilling of the cache.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// The columns of trivially copyable types are stored in compressed pages of
+   /// `options.fClusterSize` entries, which are filled by each processing slot in
+   /// parallel and are decompressed again cluster by cluster by the event loops of
+   /// the returned data frame. Once the pages use more than `options.fMaxMemory`
+   /// bytes, the next ones are written to a temporary file in `options.fSpillDirectory`,
+   /// which is removed with the cache. The columns of other types are kept in memory
+   /// as they are. In contrast to the other overloads, the order of the entries is
+   /// not preserved when the cache is filled with implicit multi-threading.
+   template <typename... ColumnTypes>
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      return CacheCompressedImpl<ColumnTypes...>(columnList, options);
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Save selected columns in memory.
    /// \param[in] columnList columns to be cached in memory
    /// \return a `RDataFrame` that wraps the cached dataset.
    ///
    /// See the previous overloads for more information.
-   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList)
-   {
-      // Early return: if the list of columns is empty, just return an empty RDF
-      // If we proceed, the jitted call will not compile!
-      if (columnList.empty()) {
-         auto nEntries = *this->Count();
-         RInterface<RLoopManager> emptyRDF(std::make_shared<RLoopManager>(nEntries));
-         return emptyRDF;
-      }
-
-      std::stringstream cacheCall;
-      auto upcastNode = RDFInternal::UpcastNode(fProxiedPtr);
-      RInterface<TTraits::TakeFirstParameter_t<decltype(upcastNode)>> upcastInterface(fProxiedPtr, *fLoopManager,
-                                                                                      fColRegister);
-      // build a string equivalent to
-      // "(RInterface<nodetype*>*)(this)->Cache<Ts...>(*(ColumnNames_t*)(&columnList))"
-      RInterface<RLoopManager> resRDF(std::make_shared<ROOT::Detail::RDF::RLoopManager>(0));
-      cacheCall << "*reinterpret_cast<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>*>("
-                << RDFInternal::PrettyPrintAddr(&resRDF)
-                << ") = reinterpret_cast<ROOT::RDF::RInterface<ROOT::Detail::RDF::RNodeBase>*>("
-                << RDFInternal::PrettyPrintAddr(&upcastInterface) << ")->Cache<";
-
-      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "Cache");
-
-      const auto validColumnNames =
-         GetValidatedColumnNames(columnListWithoutSizeColumns.size(), columnListWithoutSizeColumns);
-      const auto colTypes = GetValidatedArgTypes(validColumnNames, fColRegister, fLoopManager->GetTree(), fDataSource,
-                                                 "Cache", /*vector2rvec=*/false);
-      for (const auto &colType : colTypes)
-         cacheCall << colType << ", ";
-      if (!columnListWithoutSizeColumns.empty())
-         cacheCall.seekp(-2, cacheCall.cur);                         // remove the last ",
-      cacheCall << ">(*reinterpret_cast<std::vector<std::string>*>(" // vector<string> should be ColumnNames_t
-                << RDFInternal::PrettyPrintAddr(&columnListWithoutSizeColumns) << "));";
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList) { return JittedCacheImpl(columnList, nullptr); }
 
-      // book the code to jit with the RLoopManager and trigger the event loop
-      fLoopManager->ToJitExec(cacheCall.str());
-      fLoopManager->Jit();
-
-      return resRDF;
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in memory, in compressed pages.
+   /// \param[in] columnList columns to be cached
+   /// \param[in] options compression, cluster size and spilling of the cache.
+   /// \return a `RDataFrame` that wraps the cached dataset.
+   ///
+   /// See the previous overloads for more information.
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      return JittedCacheImpl(columnList, &options);
    }
 
    ////////////////////////////////////////////////////////////////////////////
@@ -1991,6 +1999,11 @@ public:
    /// auto myProf2 = myDf.Graph<int, float>({"profName", "profTitle", 64u, -4., 4.}, "xValues", "yValues");
    /// ~~~
    ///
+   /// With implicit multi-threading, each processing slot fills by default its own copy of the profile. If the
+   /// `RDataFrame.ConcurrentProfileFill` rootrc/gEnv setting is enabled and no column is a collection, all the slots
+   /// fill the same profile through a ROOT::TProfileConcurrentFiller instead, which saves memory when many profiles
+   /// are booked. The same holds for Profile2D(). Results filled this way do not support OnPartialResult().
+   ///
    /// \note Differently from other ROOT interfaces, the returned profile is not associated to gDirectory
    /// and the caller is responsible for its lifetime (in particular, a typical source of confusion is that
    /// if result histograms go out of scope before the end of the program, ROOT might display a blank canvas).
@@ -2769,7 +2782,9 @@ public:
    }
 
 private:
-   template <typename F, typename DefineType, typename RetType = typename TTraits::CallableTraits<F>::ret_type>
+   template <typename F, typename DefineType,
+             typename RetType =
+                ROOT::Internal::VecOps::MaterializedType_t<typename TTraits::CallableTraits<F>::ret_type>>
    std::enable_if_t<std::is_default_constructible<RetType>::value, RInterface<Proxied, DS_t>>
    DefineImpl(std::string_view name, F &&expression, const ColumnNames_t &columns, const std::string &where)
    {
@@ -2818,13 +2833,15 @@ private:
    // This overload is chosen when the callable passed to Define or DefineSlot returns void.
    // It simply fires a compile-time error. This is preferable to a static_assert in the main `Define` overload because
    // this way compilation of `Define` has no way to continue after throwing the error.
-   template <typename F, typename DefineType, typename RetType = typename TTraits::CallableTraits<F>::ret_type,
+   template <typename F, typename DefineType,
+             typename RetType =
+                ROOT::Internal::VecOps::MaterializedType_t<typename TTraits::CallableTraits<F>::ret_type>,
              bool IsFStringConv = std::is_convertible<F, std::string>::value,
              bool IsRetTypeDefConstr = std::is_default_constructible<RetType>::value>
    std::enable_if_t<!IsFStringConv && !IsRetTypeDefConstr, RInterface<Proxied, DS_t>>
    DefineImpl(std::string_view, F, const ColumnNames_t &, const std::string &)
    {
-      static_assert(std::is_default_constructible<typename TTraits::CallableTraits<F>::ret_type>::value,
+      static_assert(std::is_default_constructible<RetType>::value,
                     "Error in `Define`: type returned by expression is not default-constructible");
       return *this; // never reached
    }
@@ -2849,8 +2866,8 @@ private:
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF =
-         std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, /*defaultColumns=*/columnListWithoutSizeColumns);
+      auto newRDF = RDFInternal::MakeSnapshotDataFrame(*snapHelperArgs, fullTreeName,
+                                                       /*defaultColumns=*/columnListWithoutSizeColumns);
 
       // The Snapshot helper will use validCols (with aliases resolved) as input columns, and
       // columnListWithoutSizeColumns (still with aliases in it, passed through snapHelperArgs) as output column names.
@@ -2885,6 +2902,76 @@ private:
       return cachedRDF;
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Implementation of the compressed cache.
+   template <typename... ColTypes>
+   RInterface<RLoopManager> CacheCompressedImpl(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "Cache");
+
+      constexpr bool areCopyConstructible =
+         RDFInternal::TEvalAnd<std::is_copy_constructible<ColTypes>::value...>::value;
+      static_assert(areCopyConstructible, "Columns of a type which is not copy constructible cannot be cached yet.");
+
+      RDFInternal::CheckTypesAndPars(sizeof...(ColTypes), columnListWithoutSizeColumns.size());
+
+      auto data = Book<ColTypes...>(RDFInternal::RCacheFillHelper<ColTypes...>(options, fLoopManager->GetNSlots()),
+                                    columnListWithoutSizeColumns);
+      auto ds = std::make_unique<RDFInternal::RCacheDS<ColTypes...>>(std::move(data), columnListWithoutSizeColumns);
+
+      RInterface<RLoopManager> cachedRDF(std::make_shared<RLoopManager>(std::move(ds), columnListWithoutSizeColumns));
+
+      return cachedRDF;
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Implementation of the jitted cache, with the options of the compressed cache if not null.
+   RInterface<RLoopManager> JittedCacheImpl(const ColumnNames_t &columnList, const RCacheOptions *options)
+   {
+      // Early return: if the list of columns is empty, just return an empty RDF
+      // If we proceed, the jitted call will not compile!
+      if (columnList.empty()) {
+         auto nEntries = *this->Count();
+         RInterface<RLoopManager> emptyRDF(std::make_shared<RLoopManager>(nEntries));
+         return emptyRDF;
+      }
+
+      std::stringstream cacheCall;
+      auto upcastNode = RDFInternal::UpcastNode(fProxiedPtr);
+      RInterface<TTraits::TakeFirstParameter_t<decltype(upcastNode)>> upcastInterface(fProxiedPtr, *fLoopManager,
+                                                                                      fColRegister);
+      // build a string equivalent to
+      // "(RInterface<nodetype*>*)(this)->Cache<Ts...>(*(ColumnNames_t*)(&columnList)[, *(RCacheOptions*)(&options)])"
+      RInterface<RLoopManager> resRDF(std::make_shared<ROOT::Detail::RDF::RLoopManager>(0));
+      cacheCall << "*reinterpret_cast<ROOT::RDF::RInterface<ROOT::Detail::RDF::RLoopManager>*>("
+                << RDFInternal::PrettyPrintAddr(&resRDF)
+                << ") = reinterpret_cast<ROOT::RDF::RInterface<ROOT::Detail::RDF::RNodeBase>*>("
+                << RDFInternal::PrettyPrintAddr(&upcastInterface) << ")->Cache<";
+
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "Cache");
+
+      const auto validColumnNames =
+         GetValidatedColumnNames(columnListWithoutSizeColumns.size(), columnListWithoutSizeColumns);
+      const auto colTypes = GetValidatedArgTypes(validColumnNames, fColRegister, fLoopManager->GetTree(), fDataSource,
+                                                 "Cache", /*vector2rvec=*/false);
+      for (const auto &colType : colTypes)
+         cacheCall << colType << ", ";
+      if (!columnListWithoutSizeColumns.empty())
+         cacheCall.seekp(-2, cacheCall.cur);                         // remove the last ",
+      cacheCall << ">(*reinterpret_cast<std::vector<std::string>*>(" // vector<string> should be ColumnNames_t
+                << RDFInternal::PrettyPrintAddr(&columnListWithoutSizeColumns) << ")";
+      if (options)
+         cacheCall << ", *reinterpret_cast<const ROOT::RDF::RCacheOptions*>(" << RDFInternal::PrettyPrintAddr(options)
+                   << ")";
+      cacheCall << ");";
+
+      // book the code to jit with the RLoopManager and trigger the event loop
+      fLoopManager->ToJitExec(cacheCall.str());
+      fLoopManager->Jit();
+
+      return resRDF;
+   }
+
    template <bool IsSingleColumn, typename F>
    RInterface<Proxied, DS_t>
    VaryImpl(const std::vector<std::string> &colNames, F &&expression, const ColumnNames_t &inputColumns,
@@ -16,12 +16,15 @@
 #include "ROOT/RDF/RDatasetSpec.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
+#include "ROOT/RVecArena.hxx"
 
 #include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -101,6 +104,7 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RFilterBase;
 class RRangeBase;
 class RDefineBase;
+class RJittedDefine;
 using ROOT::RDF::RDataSource;
 
 /// The head node of a RDF computation graph.
@@ -157,6 +161,60 @@ class RLoopManager : public RNodeBase {
 
    ROOT::Internal::TreeUtils::RNoCleanupNotifier fNoCleanupNotifier;
 
+   /// Requested number of entries per block in the bulk event loop, see SetBulkSize(). 0 and 1 disable bulk processing.
+   unsigned int fBulkSize{0};
+   /// The block size of the running event loop: fBulkSize if this event loop processes entries in bulk, 0 otherwise
+   unsigned int fActiveBulkSize{0};
+   /// Set if some data source columns are read through readers that only expose the value of the last entry passed
+   /// to RDataSource::SetEntry(), which rules out the bulk event loop
+   bool fHasValuePtrColumnReaders{false};
+   /// Per slot, the block of entries currently processed by the bulk event loop; the mask stores the return values
+   /// of RDataSource::SetEntry() (all true for empty sources)
+   std::vector<RDFInternal::RBulkMask> fBulkBlocks;
+   /// Per slot, scratch space for the results of the named filters in the bulk event loop
+   std::vector<RDFInternal::RBulkMask> fBulkScratch;
+
+   /// If set, the branches read only by nodes behind some filter are not prefetched by the TTreeCache, see
+   /// AddTreeColumnUsage(). Enabled through the `RDataFrame.SparseColumnReading` rootrc/gEnv setting.
+   bool fSparseColumnReading{false};
+   /// Per slot, the TTree columns requested by the nodes while they initialize, and whether all of them are behind
+   /// a filter. Cleared once the TTreeReader of the task has been informed.
+   std::vector<std::unordered_map<std::string, bool>> fTreeColumnIsSparse;
+
+   /// If set, the parallel event loops over TTrees and data sources let idle slots split the ranges of busy slots,
+   /// see ROOT::Internal::RRangeScheduler. Enabled through the `RDataFrame.DynamicScheduling` rootrc/gEnv setting.
+   bool fDynamicScheduling{false};
+
+   /// Jitted Defines booked so far, keyed by column name, jitted function and identity of the input columns.
+   /// Lets identical jitted Defines booked on different branches of the computation graph share one node; only used
+   /// if the opt-in `RDataFrame.ShareJittedDefines` setting is on, since it is only correct for pure expressions.
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> fJittedDefines;
+
+   /// If set, the nodes of the computation graph and the dataset column readers record how many entries they
+   /// processed and how much time they took, see ROOT::Internal::RDF::EnableProfiling()
+   bool fProfiling{false};
+   /// Per slot, the entries processed by the last profiled event loop, and the wall and thread CPU time of its tasks
+   std::unique_ptr<RDFInternal::RNodeProfile> fLoopProfile;
+   /// Per slot, the wall and thread CPU time at which the running task started, in ns
+   std::vector<std::pair<ULong64_t, ULong64_t>> fTaskStartTimes;
+   /// Bytes read from ROOT files during the last profiled event loop, see TFile::GetFileBytesRead()
+   Long64_t fProfiledBytesRead{0};
+   /// Per dataset column, the profile of its readers. Entries are reset but never removed: data source column readers
+   /// outlive the event loop and keep pointing to them.
+   std::map<std::string, std::unique_ptr<RDFInternal::RNodeProfile>> fColumnReaderProfiles;
+   /// Protects fColumnReaderProfiles, as TTree column readers are created concurrently by the tasks
+   std::mutex fColumnReaderProfilesMutex;
+
+   /// If set, the RVec helpers called while an entry is processed place their results in a per-slot arena that is
+   /// reset at every entry, see ROOT::Internal::RDF::EnableRVecArena()
+   bool fUseRVecArena{false};
+   /// Per slot, the RVec arena of the event loops, empty if fUseRVecArena is not set. Kept across event loops.
+   std::vector<std::unique_ptr<ROOT::Internal::VecOps::RVecArena>> fRVecArenas;
+
+   /// Non-owning pointers to the loop managers whose computation graphs are run by the event loop of this one, which
+   /// reads the shared dataset once for all of them. Only set for the duration of RunShared().
+   std::vector<RLoopManager *> fSharedLoops;
+
    void RunEmptySourceMT();
    void RunEmptySource();
    void RunTreeProcessorMT();
@@ -164,7 +222,13 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunTreeEntry(unsigned int slot, Long64_t entry, TTreeReader &r);
+   void RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries, std::size_t nSelected);
+   void RunBulk(unsigned int slot, ULong64_t begin, ULong64_t end);
+   bool CanRunBulk() const;
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
+   void PrepareRun();
+   void FinishRun();
    void InitNodes();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
@@ -172,6 +236,8 @@ class RLoopManager : public RNodeBase {
    void SetupSampleCallbacks(TTreeReader *r, unsigned int slot);
    void UpdateSampleInfo(unsigned int slot, const std::pair<ULong64_t, ULong64_t> &range);
    void UpdateSampleInfo(unsigned int slot, TTreeReader &r);
+   void InitProfiles();
+   RDFInternal::RNodeProfile &GetColumnReaderProfile(const std::string &col);
 
 public:
    RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches);
@@ -185,6 +251,8 @@ public:
    void Jit();
    RLoopManager *GetLoopManagerUnchecked() final { return this; }
    void Run(bool jit = true);
+   void RunShared(const std::vector<RLoopManager *> &others, bool jit = true);
+   bool CanShareEventLoop(const RLoopManager &other) const;
    const ColumnNames_t &GetDefaultColumnNames() const;
    TTree *GetTree() const;
    ::TDirectory *GetDirectory() const;
@@ -201,6 +269,7 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries, bool *mask) final;
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -217,6 +286,9 @@ public:
    RColumnReaderBase *AddTreeColumnReader(unsigned int slot, const std::string &col,
                                           std::unique_ptr<RColumnReaderBase> &&reader, const std::type_info &ti);
    RColumnReaderBase *GetDatasetColumnReader(unsigned int slot, const std::string &col, const std::type_info &ti) const;
+   void AddTreeColumnUsage(unsigned int slot, const std::string &col, bool isBehindFilter);
+   std::shared_ptr<RJittedDefine> GetJittedDefine(const std::string &key);
+   void AddJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define);
 
    /// End of recursive chain of calls, does nothing
    void AddFilterName(std::vector<std::string> &) final {}
@@ -239,6 +311,25 @@ public:
 
    void SetEmptyEntryRange(std::pair<ULong64_t, ULong64_t> &&newRange);
    void ChangeSpec(ROOT::RDF::Experimental::RDatasetSpec &&spec);
+
+   void SetBulkSize(unsigned int bulkSize) { fBulkSize = bulkSize; }
+   /// Return the number of entries per block of the running event loop, 0 if entries are processed one by one
+   unsigned int GetBulkSize() const { return fActiveBulkSize; }
+   /// Return the block of entries that the bulk event loop currently processes in the given slot
+   const RDFInternal::RBulkMask &GetBulkBlock(unsigned int slot) const { return fBulkBlocks[slot]; }
+   void SetHasValuePtrColumnReaders() { fHasValuePtrColumnReaders = true; }
+
+   void SetProfiling(bool enable) { fProfiling = enable; }
+   void SetRVecArena(bool enable) { fUseRVecArena = enable; }
+   /// Return the per-slot entries and task times of the last event loop, or nullptr if it was not profiled
+   const RDFInternal::RNodeProfile *GetLoopProfile() const { return fLoopProfile.get(); }
+   /// Return the number of bytes read from ROOT files by the last event loop, if it was profiled
+   Long64_t GetProfiledBytesRead() const { return fProfiledBytesRead; }
+   const std::map<std::string, std::unique_ptr<RDFInternal::RNodeProfile>> &GetColumnReaderProfiles() const
+   {
+      return fColumnReaderProfiles;
+   }
+   const std::vector<RDFInternal::RVariationBase *> &GetBookedVariations() const { return fBookedVariations; }
 };
 
 } // ns RDF
@@ -14,6 +14,7 @@
 #include "RtypesCore.h"
 #include "TError.h" // R__ASSERT
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -29,8 +30,37 @@ namespace RDF {
 namespace GraphDrawing {
 class GraphNode;
 }
-}
-}
+
+/// The filter results of a block of consecutive entries, used by the bulk event loop.
+/// fMask[i] refers to entry fFirstEntry + i.
+struct RBulkMask {
+   std::unique_ptr<bool[]> fMask;
+   std::size_t fCapacity = 0;
+   /// The first entry of the block, -1 if the mask does not currently hold the results of any block
+   Long64_t fFirstEntry = -1;
+   std::size_t fNEntries = 0;
+
+   /// Make room for blocks of up to `capacity` entries and invalidate the stored results
+   void Reset(std::size_t capacity)
+   {
+      if (capacity > fCapacity) {
+         fMask = std::make_unique<bool[]>(capacity);
+         fCapacity = capacity;
+      }
+      fFirstEntry = -1;
+      fNEntries = 0;
+   }
+   bool Contains(Long64_t entry) const
+   {
+      return entry >= fFirstEntry && entry < fFirstEntry + static_cast<Long64_t>(fNEntries);
+   }
+   bool Holds(Long64_t firstEntry, std::size_t nEntries) const
+   {
+      return firstEntry == fFirstEntry && nEntries == fNEntries;
+   }
+};
+} // namespace RDF
+} // namespace Internal
 
 namespace Detail {
 namespace RDF {
@@ -54,6 +84,13 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Bulk version of CheckFilters(): set mask[i] to the result of the filters up to this node for entry
+   /// `firstEntry + i`, for the `nEntries` consecutive entries of a block. By default, entries are checked one by one.
+   virtual void CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries, bool *mask)
+   {
+      for (std::size_t i = 0; i < nEntries; ++i)
+         mask[i] = CheckFilters(slot, firstEntry + i);
+   }
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
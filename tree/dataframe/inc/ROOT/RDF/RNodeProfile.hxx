@@ -0,0 +1,150 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNODEPROFILE
+#define ROOT_RDF_RNODEPROFILE
+
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/Utils.hxx" // CacheLineStep
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Per-slot counters of the calls to a node of the computation graph and of the time spent in it, filled during the
+/// event loop if profiling is enabled (see ROOT::Internal::RDF::EnableProfiling()).
+/// Every slot only writes its own counters, so no synchronization is needed while the event loop runs.
+class RNodeProfile {
+public:
+   struct RSlotData {
+      /// Number of entries processed (for column readers: number of values read)
+      ULong64_t fNCalls = 0;
+      /// Wall time spent in the node itself, i.e. excluding the time spent in the upstream nodes it triggered
+      ULong64_t fWallTimeNs = 0;
+      /// CPU time of the processing thread, only measured for the whole event loop (see RLoopManager)
+      ULong64_t fCpuTimeNs = 0;
+   };
+
+private:
+   unsigned int fNSlots;
+   /// Padded to avoid false sharing between slots, see CacheLineStep()
+   std::vector<RSlotData> fSlotData;
+
+public:
+   explicit RNodeProfile(unsigned int nSlots) : fNSlots(nSlots), fSlotData(nSlots * CacheLineStep<RSlotData>()) {}
+
+   void Add(unsigned int slot, ULong64_t nCalls, ULong64_t wallTimeNs, ULong64_t cpuTimeNs = 0)
+   {
+      auto &data = fSlotData[slot * CacheLineStep<RSlotData>()];
+      data.fNCalls += nCalls;
+      data.fWallTimeNs += wallTimeNs;
+      data.fCpuTimeNs += cpuTimeNs;
+   }
+
+   unsigned int GetNSlots() const { return fNSlots; }
+   const RSlotData &GetSlotData(unsigned int slot) const { return fSlotData[slot * CacheLineStep<RSlotData>()]; }
+
+   /// Return the sum of the counters of all slots
+   RSlotData GetTotal() const
+   {
+      RSlotData total;
+      for (auto slot = 0u; slot < fNSlots; ++slot) {
+         const auto &data = GetSlotData(slot);
+         total.fNCalls += data.fNCalls;
+         total.fWallTimeNs += data.fWallTimeNs;
+         total.fCpuTimeNs += data.fCpuTimeNs;
+      }
+      return total;
+   }
+};
+
+class RNodeTimer;
+/// The innermost RNodeTimer that is running in this thread, if any
+RNodeTimer *&CurrentNodeTimer();
+
+/// Measure the wall time spent in a node of the computation graph from construction to destruction, and add it to
+/// the node's profile. Does nothing if the profile is null, i.e. if profiling is disabled.
+///
+/// Nodes trigger the evaluation of their upstream nodes (e.g. a Filter reads a Define'd column, which runs the
+/// Define): the time measured by a timer that runs while the timer of an upstream node is alive is subtracted from
+/// the outer timer, so that each node is only charged for its own work.
+class RNodeTimer {
+   using Clock_t = std::chrono::steady_clock;
+
+   RNodeProfile *fProfile;
+   unsigned int fSlot;
+   ULong64_t fNCalls;
+   Clock_t::time_point fStart;
+   RNodeTimer *fOuter = nullptr;
+   /// Time spent in the timers that ran while this one was the innermost one
+   ULong64_t fNestedNs = 0;
+
+public:
+   RNodeTimer(RNodeProfile *profile, unsigned int slot, ULong64_t nCalls = 1)
+      : fProfile(profile), fSlot(slot), fNCalls(nCalls)
+   {
+      if (fProfile == nullptr)
+         return;
+      auto &current = CurrentNodeTimer();
+      fOuter = current;
+      current = this;
+      fStart = Clock_t::now();
+   }
+   RNodeTimer(const RNodeTimer &) = delete;
+   RNodeTimer &operator=(const RNodeTimer &) = delete;
+
+   /// Change the number of calls that is recorded when the timer stops
+   void SetNCalls(ULong64_t nCalls) { fNCalls = nCalls; }
+
+   ~RNodeTimer()
+   {
+      if (fProfile == nullptr)
+         return;
+      const ULong64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock_t::now() - fStart).count();
+      fProfile->Add(fSlot, fNCalls, elapsed > fNestedNs ? elapsed - fNestedNs : 0);
+      if (fOuter != nullptr)
+         fOuter->fNestedNs += elapsed;
+      CurrentNodeTimer() = fOuter;
+   }
+};
+
+/// A column reader that forwards to another one and times its calls, used for the dataset columns if profiling is
+/// enabled.
+class R__CLING_PTRCHECK(off) RProfiledColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> fReader;
+   RNodeProfile *fProfile;
+   unsigned int fSlot;
+
+   void *GetImpl(Long64_t entry) final
+   {
+      RNodeTimer timer(fProfile, fSlot);
+      // the address of the value, whatever its actual type
+      return &fReader->template Get<char>(entry);
+   }
+
+public:
+   RProfiledColumnReader(std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> reader, RNodeProfile &profile,
+                         unsigned int slot)
+      : fReader(std::move(reader)), fProfile(&profile), fSlot(slot)
+   {
+   }
+
+   /// Give back the wrapped reader, after which this object must not be used anymore
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> ReleaseReader() { return std::move(fReader); }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif // ROOT_RDF_RNODEPROFILE
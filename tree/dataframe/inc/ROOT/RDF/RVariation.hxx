@@ -73,7 +73,7 @@ void AssignResults(ROOT::RVec<T> &resStorage, ROOT::RVec<T> &&tmpResults)
    const auto nVariations = resStorage.size(); // we have already checked that tmpResults has the same size
 
    for (auto i = 0u; i < nVariations; ++i)
-      resStorage[i] = std::move(tmpResults[i]);
+      AssignCachedValue(resStorage[i], std::move(tmpResults[i]));
 }
 
 template <typename T>
@@ -115,7 +115,7 @@ void AssignResults(std::vector<ROOT::RVec<T>> &resStorage, ROOT::RVec<ROOT::RVec
    const auto nVariations = resStorage[0].size();
    for (auto colIdx = 0u; colIdx < nCols; ++colIdx)
       for (auto varIdx = 0u; varIdx < nVariations; ++varIdx)
-         resStorage[colIdx][varIdx] = std::move(tmpResults[colIdx][varIdx]);
+         AssignCachedValue(resStorage[colIdx][varIdx], std::move(tmpResults[colIdx][varIdx]));
 }
 
 template <typename T>
@@ -222,6 +222,7 @@ public:
    {
       if (entry != fLastCheckedEntry[slot * CacheLineStep<Long64_t>()]) {
          // evaluate this filter, cache the result
+         RNodeTimer timer(fProfile.get(), slot);
          UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
          fLastCheckedEntry[slot * CacheLineStep<Long64_t>()] = entry;
       }
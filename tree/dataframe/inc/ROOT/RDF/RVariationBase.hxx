@@ -12,6 +12,7 @@
 #define ROOT_RVARIATIONBASE
 
 #include <ROOT/RDF/RColumnRegister.hxx>
+#include <ROOT/RDF/RNodeProfile.hxx>
 #include <ROOT/RDF/Utils.hxx> // ColumnNames_t
 #include <ROOT/RVec.hxx>
 
@@ -47,6 +48,8 @@ protected:
    ColumnNames_t fInputColumns;
    /// The nth flag signals whether the nth input column is a custom column or not.
    ROOT::RVecB fIsDefine;
+   /// Filled during the event loop if profiling is enabled, null otherwise
+   std::unique_ptr<RNodeProfile> fProfile;
 
 public:
    RVariationBase(const std::vector<std::string> &colNames, std::string_view variationName,
@@ -71,6 +74,9 @@ public:
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
+
+   void SetProfile(std::unique_ptr<RNodeProfile> profile) { fProfile = std::move(profile); }
+   const RNodeProfile *GetProfile() const { return fProfile.get(); }
 };
 
 } // namespace RDF
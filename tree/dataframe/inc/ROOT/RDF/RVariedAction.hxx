@@ -53,6 +53,12 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
    /// The nth flag signals whether the nth input column is a custom column or not.
    std::array<bool, ColumnTypes_t::list_size> fIsDefine;
 
+   /// For each variation, the index of the first variation with the same upstream node. Variations that do not change
+   /// the upstream filters share the nominal node, whose result is then checked once per entry.
+   std::vector<unsigned int> fFirstWithPrevNode;
+   /// Per-slot results of the filter checks of the current entry, one per variation.
+   std::vector<std::vector<char>> fPassed;
+
    /// \brief Creates new filter nodes, one per variation, from the upstream nominal one.
    /// \param nominal The nominal filter
    /// \return The varied filters
@@ -89,6 +95,13 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
 
       fLoopManager->Register(this);
 
+      fFirstWithPrevNode.resize(fPrevNodes.size());
+      for (auto varIdx = 0u; varIdx < fPrevNodes.size(); ++varIdx) {
+         const auto first = std::find(fPrevNodes.begin(), fPrevNodes.begin() + varIdx, fPrevNodes[varIdx]);
+         fFirstWithPrevNode[varIdx] = std::distance(fPrevNodes.begin(), first);
+      }
+      fPassed.resize(GetNSlots(), std::vector<char>(fPrevNodes.size(), 0));
+
       for (auto i = 0u; i < columnNames.size(); ++i) {
          auto *define = colRegister.GetDefine(columnNames[i]);
          fIsDefine[i] = define != nullptr;
@@ -150,8 +163,21 @@ public:
 
    void Run(unsigned int slot, Long64_t entry) final
    {
-      for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
+      auto &passed = fPassed[slot];
+      const auto nVariations = passed.size();
+      ULong64_t nExec = 0;
+      for (auto varIdx = 0u; varIdx < nVariations; ++varIdx) {
+         const auto first = fFirstWithPrevNode[varIdx];
+         passed[varIdx] = first == varIdx ? fPrevNodes[varIdx]->CheckFilters(slot, entry) : passed[first];
+         nExec += passed[varIdx];
+      }
+      if (nExec == 0)
+         return;
+
+      // the upstream nodes are evaluated above, outside of the timer of this node
+      RNodeTimer timer(fProfile.get(), slot, nExec);
+      for (auto varIdx = 0u; varIdx < nVariations; ++varIdx) {
+         if (passed[varIdx])
             CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
       }
    }
@@ -208,6 +234,7 @@ public:
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
       auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>("Varied " + fHelpers[0].GetActionName(),
                                                                    visitedMap.size(), nodeType);
+      thisNode->SetProfile(GetProfile());
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
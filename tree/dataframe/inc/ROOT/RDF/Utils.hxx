@@ -189,14 +189,49 @@ void Erase(const T &that, std::vector<T> &v)
    v.erase(std::remove(v.begin(), v.end(), that), v.end());
 }
 
+/// Overwrite the value that a node caches for its processing slot with the value for the current entry
+template <typename T, typename U>
+void AssignCachedValue(T &cache, U &&value)
+{
+   cache = std::forward<U>(value);
+}
+
+/// A cached RVec may still adopt memory of the RVec arena of the slot, which has been reset and reused since (see
+/// ROOT::Internal::RDF::EnableRVecArena()): it gives that memory up rather than writing the new value into it.
+template <typename T, typename U>
+void AssignCachedValue(ROOT::RVec<T> &cache, U &&value)
+{
+   if (ROOT::Detail::VecOps::IsAdopting(cache))
+      cache.clear();
+   cache = std::forward<U>(value);
+}
+
+/// Lazy RVec expressions are evaluated directly into the cached RVec, reusing its buffer
+template <typename T, typename Node>
+void AssignCachedValue(ROOT::RVec<T> &cache, ROOT::VecOps::RVecExpr<Node> &&value)
+{
+   if (ROOT::Detail::VecOps::IsAdopting(cache))
+      cache.clear();
+   value.MaterializeInto(cache);
+}
+
 /// Declare code in the interpreter via the TInterpreter::Declare method, throw in case of errors
 void InterpreterDeclare(const std::string &code);
 
 /// Jit code in the interpreter with TInterpreter::Calc, throw in case of errors.
+/// The code is passed to Calc in slices of RDataFrame.JitChunkLines lines (1000 by default, see .rootrc).
 /// The optional `context` parameter, if present, is mentioned in the error message.
 /// The pointer returned by the call to TInterpreter::Calc is returned in case of success.
 Long64_t InterpreterCalc(const std::string &code, const std::string &context = "");
 
+/// Execute code equivalent to InterpreterCalc(code) from a shared library in the jit cache directory, which is set by
+/// the RDataFrame.JitCacheDir resource (e.g. in .rootrc). On a cache miss, the library is built with ACLiC out of the
+/// code declared so far through InterpreterDeclare() and of `code`, with all the process-specific addresses turned
+/// into function arguments. The library is built under a temporary name and renamed into place, and a failed build
+/// is recorded with a `.failed` marker next to it so that it is not retried. Return false if the cache is disabled or
+/// if the library cannot be built or loaded, in which case the caller should fall back to InterpreterCalc().
+bool InterpreterCalcCached(const std::string &code);
+
 /// Whether custom column with name colName is an "internal" column such as rdfentry_ or rdfslot_
 bool IsInternalColumn(std::string_view colName);
 
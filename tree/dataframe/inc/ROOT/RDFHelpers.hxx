@@ -171,6 +171,12 @@ RNode AsRNode(NodeType node)
 /// computation of all results is generally more efficient.
 /// It should be noted that user-defined operations (e.g., Filters and Defines) of the different RDataFrame graphs are assumed to be safe to call concurrently.
 ///
+/// Computation graphs booked on different RDataFrames that read the same trees from the same files (and have
+/// neither friends, entry lists, Range() nodes nor profiling) are run together in a single event loop, so that the
+/// dataset is read and decompressed once and every branch used by several graphs is read only once.
+/// The returned value still counts these graphs separately. Setting `RDataFrame.RunGraphsSharedReading: 0`
+/// in the rootrc file or in gEnv runs each graph in its own event loop.
+///
 /// ~~~{.cpp}
 /// ROOT::RDataFrame df1("tree1", "file1.root");
 /// auto r1 = df1.Histo1D("var1");
@@ -259,6 +265,9 @@ SnapshotPtr_t VariationsFor(SnapshotPtr_t resPtr);
 void AddProgressbar(ROOT::RDF::RNode df);
 void AddProgressbar(ROOT::RDataFrame df);
 
+std::string SaveProfile(ROOT::RDF::RNode node);
+void SaveProfile(ROOT::RDF::RNode node, const std::string &outputFile);
+
 } // namespace Experimental
 
 /// RDF progress helper.
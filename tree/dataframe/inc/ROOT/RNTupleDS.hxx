@@ -23,7 +23,9 @@
 #include <ROOT/RStringView.hxx>
 
 #include <cstdint>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -44,7 +46,7 @@ class RNTupleColumnReader;
 }
 
 class RNTupleDS final : public ROOT::RDF::RDataSource {
-   /// Clones of the first source, one for each slot
+   /// Clones of the source of the current file, one for each slot
    std::vector<std::unique_ptr<ROOT::Experimental::Detail::RPageSource>> fSources;
 
    /// We prepare a column reader prototype for every column. If a column reader is actually requested
@@ -56,8 +58,35 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    std::vector<size_t> fActiveColumns;
 
    unsigned fNSlots = 0;
+   /// Set once the entry ranges of the current file have been handed out
    bool fHasSeenAllRanges = false;
 
+   /// For a chain of files, the ntuple name and the list of files; empty if the data source was constructed
+   /// from a single page source
+   std::string fNTupleName;
+   std::vector<std::string> fFileNames;
+   /// Index into fFileNames of the file that backs fSources
+   std::size_t fCurrentFileIndex = 0;
+   /// The global entry number of the first entry of the current file
+   ULong64_t fCurrentFileEntryOffset = 0;
+   /// The next file in the chain, opened in the background while the current file is processed
+   std::future<std::unique_ptr<RNTupleDS>> fStagedFile;
+   /// Upper limit of the number of compressed bytes of the first cluster of the staged file that can be prefetched
+   std::size_t fPrefetchMemoryBudget = kDefaultPrefetchMemoryBudget;
+   /// Names of the RDF columns for which column readers have been requested; used to prefetch the staged file
+   std::vector<std::string> fRequestedColumns;
+   /// A column reader handed out to RDataFrame by GetColumnReaders() for a chain of files
+   struct RActiveColumnReader {
+      unsigned int fSlot;
+      std::size_t fColumnIndex; ///< Index into fColumnNames and fColumnReaderPrototypes
+      Internal::RNTupleColumnReader *fReader;
+   };
+   /// The column readers owned by RDataFrame, which are reconnected to the page sources of the next file when the
+   /// chain moves on
+   std::vector<RActiveColumnReader> fActiveColumnReaders;
+   /// Protects fRequestedColumns and fActiveColumnReaders
+   std::mutex fRequestedColumnsLock;
+
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
    /// of fieldId. For instance, if fieldId refers to an `std::vector<Jet>`, with
@@ -71,9 +100,29 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
                  DescriptorId_t fieldId,
                  std::vector<DescriptorId_t> skeinIDs);
 
+   /// Opens the given file of the chain and prepares its page sources for all slots. If the columns of the
+   /// current file that are in use fit into the prefetch memory budget, the first cluster of the file is loaded
+   /// for slot 0. Runs in a background thread, so it must not touch the state of this data source.
+   static std::unique_ptr<RNTupleDS> StageFile(std::string ntupleName, std::string fileName, unsigned int nSlots,
+                                               std::vector<std::string> columns, std::size_t prefetchMemoryBudget);
+   /// Starts StageFile() for the file following the current one, if there is any
+   void StageNextFile();
+   /// Replaces the page sources and the column reader prototypes by the ones of the given file and reconnects the
+   /// column readers in use to it. fCurrentFileEntryOffset must already refer to the given file.
+   void SwitchToFile(std::unique_ptr<RNTupleDS> file, std::size_t fileIndex);
+
 public:
+   static constexpr std::size_t kDefaultPrefetchMemoryBudget = 256 * 1024 * 1024;
+
    explicit RNTupleDS(std::unique_ptr<ROOT::Experimental::Detail::RPageSource> pageSource);
+   /// Processes the given files one after another. While a file is processed, the next one is opened in the
+   /// background. All files must provide the same columns.
+   RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames);
    ~RNTupleDS();
+
+   /// Sets the memory budget for prefetching the first cluster of the next file of a chain. A budget of zero
+   /// restricts the lookahead to opening the next file, i.e. reading its header and footer.
+   void SetPrefetchMemoryBudget(std::size_t budget) { fPrefetchMemoryBudget = budget; }
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final { return fColumnNames; }
    bool HasColumn(std::string_view colName) const final;
@@ -98,6 +147,7 @@ protected:
 namespace RDF {
 namespace Experimental {
 RDataFrame FromRNTuple(std::string_view ntupleName, std::string_view fileName);
+RDataFrame FromRNTuple(std::string_view ntupleName, const std::vector<std::string> &fileNames);
 RDataFrame FromRNTuple(ROOT::Experimental::RNTuple *ntuple);
 } // namespace Experimental
 } // namespace RDF
@@ -0,0 +1,101 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RPARQUETDS
+#define ROOT_RPARQUETDS
+
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDataSource.hxx"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arrow {
+class Schema;
+}
+
+namespace parquet {
+class FileMetaData;
+}
+
+namespace ROOT {
+
+namespace Internal {
+class RRawFile;
+
+namespace RDF {
+/// A comparison between a column and a number, e.g. `pt > 20`, see RParquetDS
+struct RParquetPredicate {
+   enum class EOp { kEq, kNe, kLt, kLe, kGt, kGe };
+   std::string fColumnName;
+   EOp fOp;
+   double fValue;
+};
+} // namespace RDF
+} // namespace Internal
+
+namespace RDF {
+
+class RParquetDS final : public RDataSource {
+private:
+   struct RSlotData;
+
+   std::string fFileName;
+   /// The file is cloned for every processing slot, so that slots read row groups independently
+   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   std::shared_ptr<parquet::FileMetaData> fMetaData;
+   std::shared_ptr<arrow::Schema> fSchema;
+   /// The indices of the Parquet leaf columns of each field of fSchema
+   std::vector<std::vector<int>> fFieldLeaves;
+   std::vector<std::string> fColumnNames;
+   /// The first entry of each row group, followed by the number of entries in the file
+   std::vector<ULong64_t> fRowGroupFirstEntries;
+   /// The row groups whose statistics do not exclude that they contain entries passing fPredicates
+   std::vector<int> fSelectedRowGroups;
+   /// The columns read from the file: the ones for which column readers were requested, and the ones of fPredicates
+   std::vector<std::string> fReadColumns;
+   /// The indices of the Parquet leaf columns of fReadColumns
+   std::vector<int> fReadLeaves;
+   std::vector<ROOT::Internal::RDF::RParquetPredicate> fPredicates;
+   std::vector<std::unique_ptr<RSlotData>> fSlotData;
+   bool fEntryRangesRequested = false;
+   unsigned int fNSlots = 0U;
+
+   void AddReadColumn(const std::string &colName);
+   bool IsRowGroupSelected(int rowGroup) const;
+   std::vector<void *> GetColumnReadersImpl(std::string_view name, const std::type_info &type) final;
+
+public:
+   RParquetDS(std::string_view fileName, const std::vector<std::string> &columns = {}, std::string_view filter = "");
+   ~RParquetDS();
+   const std::vector<std::string> &GetColumnNames() const final;
+   std::vector<std::pair<ULong64_t, ULong64_t>> GetEntryRanges() final;
+   std::string GetTypeName(std::string_view colName) const final;
+   bool HasColumn(std::string_view colName) const final;
+   bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   void InitSlot(unsigned int slot, ULong64_t firstEntry) final;
+   void SetNSlots(unsigned int nSlots) final;
+   void Initialize() final;
+   std::string GetLabel() final;
+   std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+   GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info &) final;
+
+   std::size_t GetNRowGroups() const { return fRowGroupFirstEntries.size() - 1; }
+   /// Return the number of row groups that are read, i.e. the ones that are not excluded by the filter
+   std::size_t GetNSelectedRowGroups() const { return fSelectedRowGroups.size(); }
+};
+
+RDataFrame FromParquet(std::string_view fileName, const std::vector<std::string> &columns = {},
+                       std::string_view filter = "");
+
+} // namespace RDF
+
+} // namespace ROOT
+
+#endif
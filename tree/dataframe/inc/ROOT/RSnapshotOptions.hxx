@@ -18,6 +18,12 @@
 namespace ROOT {
 
 namespace RDF {
+/// The format of the dataset written by Snapshot
+enum class ESnapshotOutputFormat {
+   kTTree,  ///< A TTree (default)
+   kRNTuple ///< An RNTuple; requires ROOT to be built with root7
+};
+
 /// A collection of options to steer the creation of the dataset on file
 struct RSnapshotOptions {
    using ECAlgo = ROOT::ECompressionAlgorithm;
@@ -37,6 +43,11 @@ struct RSnapshotOptions {
    int fSplitLevel = 99;                       ///< Split level of output tree
    bool fLazy = false;                         ///< Do not start the event loop when Snapshot is called
    bool fOverwriteIfExists = false; ///< If fMode is "UPDATE", overwrite object in output file if it already exists
+   ESnapshotOutputFormat fOutputFormat = ESnapshotOutputFormat::kTTree; ///< Format of the output dataset
+   /// With implicit multi-threading, every slot writes its entries to its own file instead of merging them into a
+   /// single file. The files are named after the output file with the slot number appended, e.g. "out_0.root",
+   /// "out_1.root" for "out.root". The order of the entries across and within the files is not deterministic.
+   bool fOutputPerSlot = false;
 };
 } // ns RDF
 } // ns ROOT
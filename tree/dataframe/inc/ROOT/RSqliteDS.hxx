@@ -19,6 +19,8 @@
 #include <string>
 #include <vector>
 
+struct sqlite3_stmt;
+
 namespace ROOT {
 
 namespace RDF {
@@ -47,6 +49,12 @@ is used:
   - For expressions ("SELECT 1+1 FROM table"), the type of the first row of the result set determines the column type.
     That can result in a column to be of thought of type NULL where subsequent rows actually have meaningful values.
     The provided SELECT query can be used to avoid such ambiguities.
+
+The rows of an arbitrary query can only be read one after the other. A whole table, optionally restricted by an SQL
+condition, can instead be read in parallel: with implicit multi-threading, each slot reads chunks of rowids with its
+own connection. Only the columns used by the RDataFrame are read, and the condition is evaluated by sqlite:
+
+    auto rdf = ROOT::RDF::FromSqliteTable("/path/to/file.sqlite", "table", "run >= 1000");
 */
 class RSqliteDS final : public ROOT::RDF::RDataSource {
 private:
@@ -76,6 +84,8 @@ private:
    };
 
    void SqliteError(int errcode);
+   static void ReadValue(Value_t &value, sqlite3_stmt *stmt, int column);
+   bool SetTableEntry(unsigned int slot, ULong64_t entry);
 
    std::unique_ptr<Internal::RSqliteDSDataSet> fDataSet;
    unsigned int fNSlots;
@@ -84,6 +94,8 @@ private:
    std::vector<ETypes> fColumnTypes;
    /// The data source is inherently single-threaded and returns only one row at a time. This vector holds the results.
    std::vector<Value_t> fValues;
+   /// When a table is read in chunks, the results of each slot
+   std::vector<std::vector<Value_t>> fSlotValues;
 
    // clang-format off
    /// Corresponds to the types defined in ETypes.
@@ -98,6 +110,7 @@ private:
 
 public:
    RSqliteDS(const std::string &fileName, const std::string &query);
+   RSqliteDS(const std::string &fileName, const std::string &table, const std::string &where);
    ~RSqliteDS();
    void SetNSlots(unsigned int nSlots) final;
    const std::vector<std::string> &GetColumnNames() const final;
@@ -113,6 +126,7 @@ protected:
 };
 
 RDataFrame FromSqlite(std::string_view fileName, std::string_view query);
+RDataFrame FromSqliteTable(std::string_view fileName, std::string_view table, std::string_view where = "");
 
 } // namespace RDF
 
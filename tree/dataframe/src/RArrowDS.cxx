@@ -14,371 +14,109 @@
     \brief RDataFrame data source class to interface with Apache Arrow.
 
 The RArrowDS implements a proxy RDataSource to be able to use Apache Arrow
-tables with RDataFrame.
+tables and streams of record batches with RDataFrame.
 
-A RDataFrame that adapts an arrow::Table class can be constructed using the factory method
-ROOT::RDF::FromArrow, which accepts one parameter:
-1. An arrow::Table smart pointer.
+A RDataFrame that adapts Arrow data can be constructed using the factory method
+ROOT::RDF::FromArrow, which accepts as first parameter either:
+1. An arrow::Table smart pointer, or
+2. An arrow::RecordBatchReader smart pointer, e.g. an arrow::ipc::RecordBatchStreamReader reading an Arrow IPC
+   stream, or the record batch reader of an Arrow Flight stream.
 
 The types of the columns are derived from the types in the associated
 arrow::Schema.
 
+The data is processed one record batch per task, in parallel if implicit multi-threading is enabled. Tables are
+sliced in one batch per processing slot (or more, if the table is chunked), without copying their data. Column values
+are read directly from the Arrow buffers: numeric values are not copied, and list columns are exposed as RVecs that
+view the memory of the list arrays.
+Record batches read from a stream are kept in memory, so that more than one event loop can run on them.
+
 */
 // clang-format on
 
 #include <ROOT/RDF/Utils.hxx>
-#include <ROOT/TSeq.hxx>
 #include <ROOT/RArrowDS.hxx>
-#include <snprintf.h>
+
+#include "RArrowUtils.hxx"
 
 #include <algorithm>
+#include <cassert>
 #include <memory>
 #include <sstream>
 #include <string>
 
-#if defined(__GNUC__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wshadow"
-#pragma GCC diagnostic ignored "-Wunused-parameter"
-#endif
-#include <arrow/table.h>
-#include <arrow/stl.h>
-#if defined(__GNUC__)
-#pragma GCC diagnostic pop
-#endif
-
 namespace ROOT {
 namespace Internal {
 namespace RDF {
 
-// This is needed by Arrow 0.12.0 which dropped
-//
-//      using ArrowType = ArrowType_;
-//
-// from ARROW_STL_CONVERSION
-template <typename T>
-struct RootConversionTraits {};
-
-#define ROOT_ARROW_STL_CONVERSION(c_type, ArrowType_)  \
-   template <>                                         \
-   struct RootConversionTraits<c_type> {               \
-   using ArrowType = ::arrow::ArrowType_;              \
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> MakeArrowColumnReader(const arrow::DataType &type,
+                                                                            const RecordBatches_t &batches,
+                                                                            const std::vector<ULong64_t> &firstEntries,
+                                                                            const std::string &columnName)
+{
+   auto make = [&](auto getter) -> std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> {
+      return std::make_unique<RArrowColumnReader<decltype(getter)>>(batches, firstEntries, columnName);
    };
 
-ROOT_ARROW_STL_CONVERSION(bool, BooleanType)
-ROOT_ARROW_STL_CONVERSION(int8_t, Int8Type)
-ROOT_ARROW_STL_CONVERSION(int16_t, Int16Type)
-ROOT_ARROW_STL_CONVERSION(int32_t, Int32Type)
-ROOT_ARROW_STL_CONVERSION(Long64_t, Int64Type)
-ROOT_ARROW_STL_CONVERSION(uint8_t, UInt8Type)
-ROOT_ARROW_STL_CONVERSION(uint16_t, UInt16Type)
-ROOT_ARROW_STL_CONVERSION(uint32_t, UInt32Type)
-ROOT_ARROW_STL_CONVERSION(ULong64_t, UInt64Type)
-ROOT_ARROW_STL_CONVERSION(float, FloatType)
-ROOT_ARROW_STL_CONVERSION(double, DoubleType)
-ROOT_ARROW_STL_CONVERSION(std::string, StringType)
-
-// Per slot visitor of an Array.
-class ArrayPtrVisitor : public ::arrow::ArrayVisitor {
-private:
-   /// The pointer to update.
-   void **fResult;
-   bool fCachedBool{false}; // Booleans need to be unpacked, so we use a cached entry.
-   // FIXME: I should really use a variant here
-   RVec<float> fCachedRVecFloat;
-   RVec<double> fCachedRVecDouble;
-   RVec<ULong64_t> fCachedRVecULong64;
-   RVec<UInt_t> fCachedRVecUInt;
-   RVec<Long64_t> fCachedRVecLong64;
-   RVec<Int_t> fCachedRVecInt;
-   std::string fCachedString;
-   /// The entry in the array which should be looked up.
-   ULong64_t fCurrentEntry;
-
-   template <typename T>
-   void *getTypeErasedPtrFrom(arrow::ListArray const &array, int32_t entry, RVec<T> &cache)
-   {
-      using ArrowType = typename RootConversionTraits<T>::ArrowType;
-      using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
-      auto values = reinterpret_cast<ArrayType *>(array.values().get());
-      auto offset = array.value_offset(entry);
-      // Here the cast to void* is a worksround while we figure out the
-      // issues we have with long long types, signed and unsigned.
-      RVec<T> tmp(reinterpret_cast<T *>((void *)values->raw_values()) + offset, array.value_length(entry));
-      std::swap(cache, tmp);
-      return (void *)(&cache);
-   }
-
-public:
-   ArrayPtrVisitor(void **result) : fResult{result}, fCurrentEntry{0} {}
-
-   void SetEntry(ULong64_t entry) { fCurrentEntry = entry; }
-
-   /// Check if we are asking the same entry as before.
-   virtual arrow::Status Visit(arrow::Int32Array const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::Int64Array const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   /// Check if we are asking the same entry as before.
-   virtual arrow::Status Visit(arrow::UInt32Array const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::UInt64Array const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::FloatArray const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::DoubleArray const &array) final
-   {
-      *fResult = (void *)(array.raw_values() + fCurrentEntry);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::BooleanArray const &array) final
-   {
-      fCachedBool = array.Value(fCurrentEntry);
-      *fResult = reinterpret_cast<void *>(&fCachedBool);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::StringArray const &array) final
-   {
-      fCachedString = array.GetString(fCurrentEntry);
-      *fResult = reinterpret_cast<void *>(&fCachedString);
-      return arrow::Status::OK();
-   }
-
-   virtual arrow::Status Visit(arrow::ListArray const &array) final
-   {
-      switch (array.value_type()->id()) {
-      case arrow::Type::FLOAT: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecFloat);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::DOUBLE: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecDouble);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::UINT32: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecUInt);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::UINT64: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecULong64);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::INT32: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecInt);
-         return arrow::Status::OK();
-      }
-      case arrow::Type::INT64: {
-         *fResult = getTypeErasedPtrFrom(array, fCurrentEntry, fCachedRVecLong64);
-         return arrow::Status::OK();
-      }
-      default: return arrow::Status::TypeError("Type not supported");
+   switch (type.id()) {
+   case arrow::Type::INT32: return make(RArrowNumericGetter<arrow::Int32Array>{});
+   case arrow::Type::INT64: return make(RArrowNumericGetter<arrow::Int64Array>{});
+   case arrow::Type::UINT32: return make(RArrowNumericGetter<arrow::UInt32Array>{});
+   case arrow::Type::UINT64: return make(RArrowNumericGetter<arrow::UInt64Array>{});
+   case arrow::Type::FLOAT: return make(RArrowNumericGetter<arrow::FloatArray>{});
+   case arrow::Type::DOUBLE: return make(RArrowNumericGetter<arrow::DoubleArray>{});
+   case arrow::Type::BOOL: return make(RArrowBooleanGetter{});
+   case arrow::Type::STRING: return make(RArrowStringGetter{});
+   case arrow::Type::LIST: {
+      switch (static_cast<const arrow::ListType &>(type).value_type()->id()) {
+      case arrow::Type::FLOAT: return make(RArrowListGetter<float, arrow::FloatArray>{});
+      case arrow::Type::DOUBLE: return make(RArrowListGetter<double, arrow::DoubleArray>{});
+      case arrow::Type::UINT32: return make(RArrowListGetter<UInt_t, arrow::UInt32Array>{});
+      case arrow::Type::UINT64: return make(RArrowListGetter<ULong64_t, arrow::UInt64Array>{});
+      case arrow::Type::INT32: return make(RArrowListGetter<Int_t, arrow::Int32Array>{});
+      case arrow::Type::INT64: return make(RArrowListGetter<Long64_t, arrow::Int64Array>{});
+      default: break;
       }
+      break;
    }
-
-   using ::arrow::ArrayVisitor::Visit;
-};
-
-/// Helper class which keeps track for each slot where to get the entry.
-class TValueGetter {
-private:
-   std::vector<void *> fValuesPtrPerSlot;
-   std::vector<ULong64_t> fLastEntryPerSlot;
-   std::vector<ULong64_t> fLastChunkPerSlot;
-   std::vector<ULong64_t> fFirstEntryPerChunk;
-   std::vector<ArrayPtrVisitor> fArrayVisitorPerSlot;
-   /// Since data can be chunked in different arrays we need to construct an
-   /// index which contains the first element of each chunk, so that we can
-   /// quickly move to the correct chunk.
-   std::vector<ULong64_t> fChunkIndex;
-   arrow::ArrayVector fChunks;
-
-public:
-   TValueGetter(size_t slots, arrow::ArrayVector chunks)
-      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0), fChunks{chunks}
-   {
-      fChunkIndex.reserve(fChunks.size());
-      size_t next = 0;
-      for (auto &chunk : chunks) {
-         fFirstEntryPerChunk.push_back(next);
-         next += chunk->length();
-         fChunkIndex.push_back(next);
-      }
-      for (size_t si = 0, se = fValuesPtrPerSlot.size(); si != se; ++si) {
-         fArrayVisitorPerSlot.push_back(ArrayPtrVisitor{fValuesPtrPerSlot.data() + si});
-      }
+   default: break;
    }
-
-   /// This returns the ptr to the ptr to actual data.
-   std::vector<void *> SlotPtrs()
-   {
-      std::vector<void *> result;
-      for (size_t i = 0; i < fValuesPtrPerSlot.size(); ++i) {
-         result.push_back(fValuesPtrPerSlot.data() + i);
-      }
-      return result;
-   }
-
-   // Convenience method to avoid code duplication between
-   // SetEntry and InitSlot
-   void UncachedSlotLookup(unsigned int slot, ULong64_t entry)
-   {
-      // If entry is greater than the previous one,
-      // we can skip all the chunks before the last one we
-      // queried.
-      size_t ci = 0;
-      assert(slot < fLastChunkPerSlot.size());
-      if (fLastEntryPerSlot[slot] < entry) {
-         ci = fLastChunkPerSlot.at(slot);
-      }
-
-      for (size_t ce = fChunkIndex.size(); ci != ce; ++ci) {
-         if (entry < fChunkIndex[ci]) {
-            assert(slot < fLastChunkPerSlot.size());
-            fLastChunkPerSlot[slot] = ci;
-            break;
-         }
-      }
-
-      // Update the pointer to the requested entry.
-      // Notice that we need to find the entry
-      auto chunk = fChunks.at(fLastChunkPerSlot[slot]);
-      assert(slot < fArrayVisitorPerSlot.size());
-      fArrayVisitorPerSlot[slot].SetEntry(entry - fFirstEntryPerChunk[fLastChunkPerSlot[slot]]);
-      fLastEntryPerSlot[slot] = entry;
-      auto status = chunk->Accept(fArrayVisitorPerSlot.data() + slot);
-      if (!status.ok()) {
-         std::string msg = "Could not get pointer for slot ";
-         msg += std::to_string(slot) + " looking at entry " + std::to_string(entry);
-         throw std::runtime_error(msg);
-      }
-   }
-
-   /// Set the current entry to be retrieved
-   void SetEntry(unsigned int slot, ULong64_t entry)
-   {
-      // Same entry as before
-      if (fLastEntryPerSlot[slot] == entry) {
-         return;
-      }
-      UncachedSlotLookup(slot, entry);
-   }
-};
-
+   throw std::runtime_error("Reading Arrow columns of type " + type.ToString() + " is not supported");
+}
 } // namespace RDF
 } // namespace Internal
 
 namespace RDF {
 
-/// Helper to get the contents of a given column
-
-/// Helper to get the human readable name of type
-class RDFTypeNameGetter : public ::arrow::TypeVisitor {
-private:
-   std::vector<std::string> fTypeName;
-
-public:
-   arrow::Status Visit(const arrow::Int64Type &) override
-   {
-      fTypeName.push_back("Long64_t");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::Int32Type &) override
-   {
-      fTypeName.push_back("Int_t");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::UInt64Type &) override
-   {
-      fTypeName.push_back("ULong64_t");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::UInt32Type &) override
-   {
-      fTypeName.push_back("UInt_t");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::FloatType &) override
-   {
-      fTypeName.push_back("float");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::DoubleType &) override
-   {
-      fTypeName.push_back("double");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::StringType &) override
-   {
-      fTypeName.push_back("string");
-      return arrow::Status::OK();
-   }
-   arrow::Status Visit(const arrow::BooleanType &) override
-   {
-      fTypeName.push_back("bool");
-      return arrow::Status::OK();
+////////////////////////////////////////////////////////////////////////
+/// Collect and verify the columns to use, common to all constructors.
+/// In case columns is empty, we use all the columns found in the schema
+RArrowDS::RArrowDS(std::shared_ptr<arrow::Schema> schema, std::vector<std::string> const &columns)
+   : fSchema{std::move(schema)}, fColumnNames{columns}
+{
+   // We want to allow people to specify which columns they
+   // need so that we can think of upfront IO optimizations.
+   if (fColumnNames.empty()) {
+      for (auto &field : fSchema->fields()) {
+         fColumnNames.push_back(field->name());
+      }
    }
-   arrow::Status Visit(const arrow::ListType &l) override
-   {
-      /// Recursively visit List types and map them to
-      /// an RVec. We accumulate the result of the recursion on
-      /// fTypeName so that we can create the actual type
-      /// when the recursion is done.
-      fTypeName.push_back("ROOT::VecOps::RVec<%s>");
-      return l.value_type()->Accept(this);
+   if (fColumnNames.empty()) {
+      throw std::runtime_error("At least one column required");
    }
-   std::string result()
-   {
-      // This recursively builds a nested type.
-      std::string result = "%s";
-      char buffer[8192];
-      for (size_t i = 0; i < fTypeName.size(); ++i) {
-         snprintf(buffer, 8192, result.c_str(), fTypeName[i].c_str());
-         result = buffer;
+
+   /// For the moment we support only a few native types.
+   for (auto &columnName : fColumnNames) {
+      auto field = fSchema->GetFieldByName(columnName);
+      if (!field) {
+         throw std::runtime_error("The dataset does not have column " + columnName);
+      }
+      ROOT::Internal::RDF::VerifyValidColumnType verifyType;
+      if (field->type()->Accept(&verifyType).ok() == false) {
+         throw std::runtime_error("Column " + columnName + " contains an unsupported type.");
       }
-      return result;
    }
-
-   using ::arrow::TypeVisitor::Visit;
-};
-
-/// Helper to determine if a given Column is a supported type.
-class VerifyValidColumnType : public ::arrow::TypeVisitor {
-private:
-public:
-   virtual arrow::Status Visit(const arrow::Int64Type &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::UInt64Type &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::Int32Type &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::UInt32Type &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::FloatType &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::DoubleType &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::StringType &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::BooleanType &) override { return arrow::Status::OK(); }
-   virtual arrow::Status Visit(const arrow::ListType &) override { return arrow::Status::OK(); }
-
-   using ::arrow::TypeVisitor::Visit;
-};
+}
 
 ////////////////////////////////////////////////////////////////////////
 /// Constructor to create an Arrow RDataSource for RDataFrame.
@@ -386,75 +124,30 @@ public:
 /// \param[in] inColumns the name of the columns to use
 /// In case columns is empty, we use all the columns found in the table
 RArrowDS::RArrowDS(std::shared_ptr<arrow::Table> inTable, std::vector<std::string> const &inColumns)
-   : fTable{inTable}, fColumnNames{inColumns}
+   : RArrowDS(inTable->schema(), inColumns)
 {
-   auto &columnNames = fColumnNames;
-   auto &table = fTable;
-   auto &index = fGetterIndex;
-   // We want to allow people to specify which columns they
-   // need so that we can think of upfront IO optimizations.
-   auto filterWantedColumns = [&columnNames, &table]() {
-      if (columnNames.empty()) {
-         for (auto &field : table->schema()->fields()) {
-            columnNames.push_back(field->name());
-         }
-      }
-   };
-
-   // To support both arrow 0.14.0 and 0.16.0
-   using ColumnType = decltype(fTable->column(0));
-
-   auto getRecordsFirstColumn = [&columnNames, &table]() {
-      if (columnNames.empty()) {
-         throw std::runtime_error("At least one column required");
-      }
-      const auto name = columnNames.front();
-      const auto columnIdx = table->schema()->GetFieldIndex(name);
-      return table->column(columnIdx)->length();
-   };
-
+   fTable = std::move(inTable);
    // All columns are supposed to have the same number of entries.
-   auto verifyColumnSize = [&table](ColumnType column, int columnIdx, int nRecords) {
-      if (column->length() != nRecords) {
-         std::string msg = "Column ";
-         msg += table->schema()->field(columnIdx)->name() + " has a different number of entries.";
-         throw std::runtime_error(msg);
-      }
-   };
-
-   /// For the moment we support only a few native types.
-   auto verifyColumnType = [&table](ColumnType column, int columnIdx) {
-      auto verifyType = std::make_unique<VerifyValidColumnType>();
-      auto result = column->type()->Accept(verifyType.get());
-      if (result.ok() == false) {
-         std::string msg = "Column ";
-         msg += table->schema()->field(columnIdx)->name() + " contains an unsupported type.";
-         throw std::runtime_error(msg);
-      }
-   };
-
-   /// This is used to create an index between the columnId
-   /// and the associated getter.
-   auto addColumnToGetterIndex = [&index](int columnId) { index.push_back(std::make_pair(columnId, index.size())); };
-
-   /// Assuming we can get called more than once, we need to
-   /// reset the getter index each time.
-   auto resetGetterIndex = [&index]() { index.clear(); };
-
-   /// This is what initialization actually does
-   filterWantedColumns();
-   resetGetterIndex();
-   auto nRecords = getRecordsFirstColumn();
+   const auto nRecords = fTable->num_rows();
    for (auto &columnName : fColumnNames) {
-      auto columnIdx = fTable->schema()->GetFieldIndex(columnName);
-      addColumnToGetterIndex(columnIdx);
-
-      auto column = fTable->column(columnIdx);
-      verifyColumnSize(column, columnIdx, nRecords);
-      verifyColumnType(column, columnIdx);
+      if (fTable->column(fSchema->GetFieldIndex(columnName))->length() != nRecords) {
+         throw std::runtime_error("Column " + columnName + " has a different number of entries.");
+      }
    }
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create an Arrow RDataSource for RDataFrame from a stream of record batches, e.g. an Arrow IPC
+/// stream or an Arrow Flight stream.
+/// \param[in] batchReader the stream of record batches to read. Batches are read as the event loop needs them.
+/// \param[in] columns the name of the columns to use
+/// In case columns is empty, we use all the columns found in the schema of the stream
+RArrowDS::RArrowDS(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &columns)
+   : RArrowDS(batchReader->schema(), columns)
+{
+   fBatchReader = std::move(batchReader);
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
 RArrowDS::~RArrowDS()
@@ -466,21 +159,47 @@ const std::vector<std::string> &RArrowDS::GetColumnNames() const
    return fColumnNames;
 }
 
+/// Read the next non-empty batch of the stream and append it to fBatches.
+/// Return false if the stream is exhausted.
+bool RArrowDS::ReadNextBatch()
+{
+   while (!fBatchReaderIsExhausted) {
+      std::shared_ptr<arrow::RecordBatch> batch;
+      auto status = fBatchReader->ReadNext(&batch);
+      if (status.ok() == false) {
+         throw std::runtime_error("RArrowDS: could not read a record batch: " + status.ToString());
+      }
+      if (!batch) {
+         fBatchReaderIsExhausted = true;
+      } else if (batch->num_rows() > 0) {
+         fBatchFirstEntries.push_back(fBatchFirstEntries.back() + batch->num_rows());
+         fBatches.emplace_back(std::move(batch));
+         return true;
+      }
+   }
+   return false;
+}
+
+/// Hand out up to one batch per slot. Batches read by previous event loops are replayed before new ones are read.
 std::vector<std::pair<ULong64_t, ULong64_t>> RArrowDS::GetEntryRanges()
 {
-   auto entryRanges(std::move(fEntryRanges)); // empty fEntryRanges
+   std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+   while (entryRanges.size() < fNSlots && (fNextBatch < fBatches.size() || ReadNextBatch())) {
+      entryRanges.emplace_back(fBatchFirstEntries[fNextBatch], fBatchFirstEntries[fNextBatch + 1]);
+      ++fNextBatch;
+   }
    return entryRanges;
 }
 
 std::string RArrowDS::GetTypeName(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       std::string msg = "The dataset does not have column ";
       msg += colName;
       throw std::runtime_error(msg);
    }
-   RDFTypeNameGetter typeGetter;
+   ROOT::Internal::RDF::RDFTypeNameGetter typeGetter;
    auto status = field->type()->Accept(&typeGetter);
    if (status.ok() == false) {
       std::string msg = "RArrowDS does not support a column of type ";
@@ -492,104 +211,51 @@ std::string RArrowDS::GetTypeName(std::string_view colName) const
 
 bool RArrowDS::HasColumn(std::string_view colName) const
 {
-   auto field = fTable->schema()->GetFieldByName(std::string(colName));
+   auto field = fSchema->GetFieldByName(std::string(colName));
    if (!field) {
       return false;
    }
    return true;
 }
 
-bool RArrowDS::SetEntry(unsigned int slot, ULong64_t entry)
+bool RArrowDS::SetEntry(unsigned int, ULong64_t)
 {
-   for (auto link : fGetterIndex) {
-      auto &getter = fValueGetters[link.second];
-      getter->SetEntry(slot, entry);
-   }
+   // the column readers address the batches directly, there is nothing to do here
    return true;
 }
 
-void RArrowDS::InitSlot(unsigned int slot, ULong64_t entry)
-{
-   for (auto link : fGetterIndex) {
-      auto &getter = fValueGetters[link.second];
-      getter->UncachedSlotLookup(slot, entry);
-   }
-}
-
-void splitInEqualRanges(std::vector<std::pair<ULong64_t, ULong64_t>> &ranges, int nRecords, unsigned int nSlots)
-{
-   ranges.clear();
-   const auto chunkSize = nRecords / nSlots;
-   const auto remainder = 1U == nSlots ? 0 : nRecords % nSlots;
-   auto start = 0UL;
-   auto end = 0UL;
-   for (auto i : ROOT::TSeqU(nSlots)) {
-      start = end;
-      end += chunkSize;
-      ranges.emplace_back(start, end);
-      (void)i;
-   }
-   ranges.back().second += remainder;
-}
-
-int getNRecords(std::shared_ptr<arrow::Table> &table, std::vector<std::string> &columnNames)
-{
-   auto index = table->schema()->GetFieldIndex(columnNames.front());
-   return table->column(index)->length();
-};
-
-template <typename T>
-std::shared_ptr<arrow::ChunkedArray> getData(T p)
-{
-   return p->data();
-}
-
-template <>
-std::shared_ptr<arrow::ChunkedArray>
-getData<std::shared_ptr<arrow::ChunkedArray>>(std::shared_ptr<arrow::ChunkedArray> p)
-{
-   return p;
-}
-
 void RArrowDS::SetNSlots(unsigned int nSlots)
 {
    assert(0U == fNSlots && "Setting the number of slots even if the number of slots is different from zero.");
    fNSlots = nSlots;
-   // We dump all the previous getters structures and we rebuild it.
-   auto nColumns = fGetterIndex.size();
-
-   fValueGetters.clear();
-   for (size_t ci = 0; ci != nColumns; ++ci) {
-      auto chunkedArray = getData(fTable->column(fGetterIndex[ci].first));
-      fValueGetters.emplace_back(std::make_unique<ROOT::Internal::RDF::TValueGetter>(nSlots, chunkedArray->chunks()));
+   if (fTable) {
+      // Slice the table in (at least) one batch per slot. This does not copy the data.
+      auto tableReader = std::make_shared<arrow::TableBatchReader>(*fTable);
+      tableReader->set_chunksize(std::max<int64_t>(1, (fTable->num_rows() + nSlots - 1) / nSlots));
+      fBatchReader = std::move(tableReader);
    }
 }
 
-/// This needs to return a pointer to the pointer each value getter
-/// will point to.
-std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view colName, const std::type_info &)
+std::vector<void *> RArrowDS::GetColumnReadersImpl(std::string_view, const std::type_info &)
 {
-   auto &index = fGetterIndex;
-   auto findGetterIndex = [&index](unsigned int column) {
-      for (auto &entry : index) {
-         if (entry.first == column) {
-            return entry.second;
-         }
-      }
-      throw std::runtime_error("No column found at index " + std::to_string(column));
-   };
+   // all columns are read through GetColumnReaders(unsigned int, std::string_view, const std::type_info &)
+   return {};
+}
 
-   const int columnIdx = fTable->schema()->GetFieldIndex(std::string(colName));
-   const int getterIdx = findGetterIndex(columnIdx);
-   assert(getterIdx != -1);
-   assert((unsigned int)getterIdx < fValueGetters.size());
-   return fValueGetters[getterIdx]->SlotPtrs();
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+RArrowDS::GetColumnReaders(unsigned int, std::string_view name, const std::type_info &)
+{
+   const auto columnIdx = fSchema->GetFieldIndex(std::string(name));
+   if (columnIdx < 0) {
+      throw std::runtime_error("The dataset does not have column " + std::string(name));
+   }
+   return ROOT::Internal::RDF::MakeArrowColumnReader(*fSchema->field(columnIdx)->type(), fBatches,
+                                                     fBatchFirstEntries, std::string(name));
 }
 
 void RArrowDS::Initialize()
 {
-   auto nRecords = getNRecords(fTable, fColumnNames);
-   splitInEqualRanges(fEntryRanges, nRecords, fNSlots);
+   fNextBatch = 0;
 }
 
 std::string RArrowDS::GetLabel()
@@ -609,6 +275,18 @@ RDataFrame FromArrow(std::shared_ptr<arrow::Table> table, std::vector<std::strin
    return tdf;
 }
 
+/// \brief Factory method to create a Apache Arrow RDataFrame.
+///
+/// Creates a RDataFrame using a stream of arrow::RecordBatch as input, e.g. an arrow::ipc::RecordBatchStreamReader.
+/// \param[in] batchReader the stream of record batches to read.
+/// \param[in] columnNames the name of the columns to use
+/// In case columnNames is empty, we use all the columns found in the schema of the stream
+RDataFrame FromArrow(std::shared_ptr<arrow::RecordBatchReader> batchReader, std::vector<std::string> const &columnNames)
+{
+   ROOT::RDataFrame tdf(std::make_unique<RArrowDS>(std::move(batchReader), columnNames));
+   return tdf;
+}
+
 } // namespace RDF
 
 } // namespace ROOT
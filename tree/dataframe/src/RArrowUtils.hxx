@@ -0,0 +1,242 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Helpers shared by the data sources that read Apache Arrow data: RArrowDS and RParquetDS.
+// This header is private to the dataframe library.
+
+#ifndef ROOT_RDF_RARROWUTILS
+#define ROOT_RDF_RARROWUTILS
+
+#include <ROOT/RDF/RColumnReaderBase.hxx>
+#include <ROOT/RVec.hxx>
+#include <RtypesCore.h>
+#include <snprintf.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include <arrow/record_batch.h>
+#include <arrow/table.h>
+#include <arrow/stl.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// Helper to get the human readable name of type
+class RDFTypeNameGetter : public ::arrow::TypeVisitor {
+private:
+   std::vector<std::string> fTypeName;
+
+public:
+   arrow::Status Visit(const arrow::Int64Type &) override
+   {
+      fTypeName.push_back("Long64_t");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::Int32Type &) override
+   {
+      fTypeName.push_back("Int_t");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::UInt64Type &) override
+   {
+      fTypeName.push_back("ULong64_t");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::UInt32Type &) override
+   {
+      fTypeName.push_back("UInt_t");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::FloatType &) override
+   {
+      fTypeName.push_back("float");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::DoubleType &) override
+   {
+      fTypeName.push_back("double");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::StringType &) override
+   {
+      fTypeName.push_back("string");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::BooleanType &) override
+   {
+      fTypeName.push_back("bool");
+      return arrow::Status::OK();
+   }
+   arrow::Status Visit(const arrow::ListType &l) override
+   {
+      /// Recursively visit List types and map them to
+      /// an RVec. We accumulate the result of the recursion on
+      /// fTypeName so that we can create the actual type
+      /// when the recursion is done.
+      fTypeName.push_back("ROOT::VecOps::RVec<%s>");
+      return l.value_type()->Accept(this);
+   }
+   std::string result()
+   {
+      // This recursively builds a nested type.
+      std::string result = "%s";
+      char buffer[8192];
+      for (size_t i = 0; i < fTypeName.size(); ++i) {
+         snprintf(buffer, 8192, result.c_str(), fTypeName[i].c_str());
+         result = buffer;
+      }
+      return result;
+   }
+
+   using ::arrow::TypeVisitor::Visit;
+};
+
+/// Helper to determine if a given Column is a supported type.
+class VerifyValidColumnType : public ::arrow::TypeVisitor {
+private:
+public:
+   virtual arrow::Status Visit(const arrow::Int64Type &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::UInt64Type &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::Int32Type &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::UInt32Type &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::FloatType &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::DoubleType &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::StringType &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::BooleanType &) override { return arrow::Status::OK(); }
+   virtual arrow::Status Visit(const arrow::ListType &) override { return arrow::Status::OK(); }
+
+   using ::arrow::TypeVisitor::Visit;
+};
+
+using RecordBatches_t = std::vector<std::shared_ptr<arrow::RecordBatch>>;
+
+/// Gives access to the values of a numeric array, without copying them
+template <typename ArrayType>
+class RArrowNumericGetter {
+   const typename ArrayType::value_type *fValues = nullptr;
+
+public:
+   void SetArray(const arrow::Array &array) { fValues = static_cast<const ArrayType &>(array).raw_values(); }
+   void *Get(int64_t idx) { return (void *)(fValues + idx); }
+};
+
+/// Booleans are packed in bits in Arrow: the value of the last entry read is unpacked
+class RArrowBooleanGetter {
+   const arrow::BooleanArray *fArray = nullptr;
+   bool fValue = false;
+
+public:
+   void SetArray(const arrow::Array &array) { fArray = &static_cast<const arrow::BooleanArray &>(array); }
+   void *Get(int64_t idx)
+   {
+      fValue = fArray->Value(idx);
+      return &fValue;
+   }
+};
+
+class RArrowStringGetter {
+   const arrow::StringArray *fArray = nullptr;
+   std::string fValue;
+
+public:
+   void SetArray(const arrow::Array &array) { fArray = &static_cast<const arrow::StringArray &>(array); }
+   void *Get(int64_t idx)
+   {
+      fValue = fArray->GetString(idx);
+      return &fValue;
+   }
+};
+
+/// Gives access to the elements of a list array through a RVec that views the memory of the list values
+template <typename T, typename ValuesArrayType>
+class RArrowListGetter {
+   const arrow::ListArray *fArray = nullptr;
+   T *fValues = nullptr;
+   ROOT::VecOps::RVec<T> fValue;
+
+public:
+   void SetArray(const arrow::Array &array)
+   {
+      fArray = &static_cast<const arrow::ListArray &>(array);
+      // Here the cast to void* is a workaround while we figure out the
+      // issues we have with long long types, signed and unsigned.
+      fValues = reinterpret_cast<T *>((void *)static_cast<const ValuesArrayType &>(*fArray->values()).raw_values());
+   }
+   void *Get(int64_t idx)
+   {
+      ROOT::VecOps::RVec<T> view(fValues + fArray->value_offset(idx), fArray->value_length(idx));
+      std::swap(fValue, view);
+      return &fValue;
+   }
+};
+
+/// A column reader of the Arrow-based data sources, which can read any entry of a sequence of record batches.
+/// `batchFirstEntries` holds the first entry of each batch, followed by the entry after the last batch. The Getter
+/// policy extracts the values from the array of the batch that contains the entry.
+template <typename Getter>
+class R__CLING_PTRCHECK(off) RArrowColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   const RecordBatches_t &fBatches;
+   const std::vector<ULong64_t> &fBatchFirstEntries;
+   const std::string fColumnName;
+   /// The array of this column in the batch that contains the entries [fBegin, fEnd)
+   std::shared_ptr<arrow::Array> fArray;
+   ULong64_t fBegin = 0;
+   ULong64_t fEnd = 0;
+   Getter fGetter;
+
+   void LoadBatch(ULong64_t entry)
+   {
+      const auto it = std::upper_bound(fBatchFirstEntries.begin(), fBatchFirstEntries.end(), entry);
+      if (it == fBatchFirstEntries.begin() || it == fBatchFirstEntries.end())
+         throw std::runtime_error("RArrowDS: entry " + std::to_string(entry) + " is not in any record batch read so far");
+      // the column is looked up by name, the batches might contain a different selection of columns
+      fArray = fBatches[std::distance(fBatchFirstEntries.begin(), it) - 1]->GetColumnByName(fColumnName);
+      fBegin = *(it - 1);
+      fEnd = *it;
+      fGetter.SetArray(*fArray);
+   }
+
+   void *GetImpl(Long64_t entry) final
+   {
+      if (ULong64_t(entry) < fBegin || ULong64_t(entry) >= fEnd)
+         LoadBatch(entry);
+      return fGetter.Get(entry - fBegin);
+   }
+
+public:
+   RArrowColumnReader(const RecordBatches_t &batches, const std::vector<ULong64_t> &batchFirstEntries,
+                      const std::string &columnName)
+      : fBatches(batches), fBatchFirstEntries(batchFirstEntries), fColumnName(columnName)
+   {
+   }
+};
+
+/// Create a reader for a column of the given type. Throw if the type is not supported.
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase> MakeArrowColumnReader(const arrow::DataType &type,
+                                                                            const RecordBatches_t &batches,
+                                                                            const std::vector<ULong64_t> &firstEntries,
+                                                                            const std::string &columnName);
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
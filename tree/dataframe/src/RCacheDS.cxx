@@ -0,0 +1,119 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RDF/RCacheDS.hxx"
+
+#include "RZip.h"
+#include "TError.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <cstring>
+#include <limits>
+
+ROOT::Internal::RDF::RCachePageStore::RCachePageStore(const ROOT::RDF::RCacheOptions &options) : fOptions(options) {}
+
+ROOT::Internal::RDF::RCachePageStore::~RCachePageStore()
+{
+   if (fSpillFile) {
+      fclose(fSpillFile);
+      gSystem->Unlink(fSpillPath.c_str());
+   }
+}
+
+bool ROOT::Internal::RDF::RCachePageStore::OpenSpillFile()
+{
+   if (fSpillFile)
+      return true;
+   TString base = "rdfcache";
+   const char *dir = fOptions.fSpillDirectory.empty() ? nullptr : fOptions.fSpillDirectory.c_str();
+   fSpillFile = gSystem->TempFileName(base, dir);
+   if (!fSpillFile) {
+      ::Error("RDataFrame::Cache", "cannot create a temporary file to spill the cache, keeping it in memory");
+      // do not try again for every page
+      fOptions.fMaxMemory = 0;
+      return false;
+   }
+   fSpillPath = base.Data();
+   return true;
+}
+
+ROOT::Internal::RDF::RCachePageStore::PageId_t
+ROOT::Internal::RDF::RCachePageStore::Store(const void *raw, std::size_t size)
+{
+   RPage page;
+   page.fData.reset(new unsigned char[size]);
+
+   // small pages and the pages which do not compress are stored as they are
+   const int settings = fOptions.fCompressionSettings;
+   if (settings > 0 && size >= 256 && size <= static_cast<std::size_t>(std::numeric_limits<int>::max())) {
+      const auto algorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(settings / 100);
+      const int n = R__zipBlocks(settings % 100, size, static_cast<char *>(const_cast<void *>(raw)), size,
+                                 reinterpret_cast<char *>(page.fData.get()), algorithm, 0, 1);
+      if (n > 0) {
+         page.fStoredSize = n;
+         page.fCompressed = true;
+      }
+   }
+   if (!page.fCompressed) {
+      memcpy(page.fData.get(), raw, size);
+      page.fStoredSize = size;
+   }
+
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (fOptions.fMaxMemory > 0 && fMemorySize + page.fStoredSize > fOptions.fMaxMemory && OpenSpillFile()) {
+      fseek(fSpillFile, 0, SEEK_END);
+      page.fFileOffset = ftell(fSpillFile);
+      if (fwrite(page.fData.get(), 1, page.fStoredSize, fSpillFile) == page.fStoredSize) {
+         page.fData.reset();
+         fSpilledSize += page.fStoredSize;
+      } else {
+         ::Error("RDataFrame::Cache", "cannot write to the temporary file %s, keeping the cache in memory",
+                 fSpillPath.c_str());
+         page.fFileOffset = -1;
+         fOptions.fMaxMemory = 0;
+      }
+   }
+   if (page.fData)
+      fMemorySize += page.fStoredSize;
+   fPages.emplace_back(std::move(page));
+   return fPages.size() - 1;
+}
+
+void ROOT::Internal::RDF::RCachePageStore::Load(PageId_t id, void *raw, std::size_t size)
+{
+   std::unique_ptr<unsigned char[]> spilled;
+   const unsigned char *src = nullptr;
+   std::size_t storedSize = 0;
+   bool compressed = false;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      const auto &page = fPages[id];
+      storedSize = page.fStoredSize;
+      compressed = page.fCompressed;
+      if (page.fData) {
+         src = page.fData.get();
+      } else {
+         spilled.reset(new unsigned char[storedSize]);
+         fseek(fSpillFile, page.fFileOffset, SEEK_SET);
+         if (fread(spilled.get(), 1, storedSize, fSpillFile) != storedSize)
+            throw std::runtime_error("RDataFrame::Cache: cannot read back the temporary file " + fSpillPath);
+         src = spilled.get();
+      }
+   }
+
+   if (!compressed) {
+      if (size != storedSize)
+         throw std::runtime_error("RDataFrame::Cache: page of unexpected size");
+      memcpy(raw, src, size);
+      return;
+   }
+   const int n = R__unzipBlocks(storedSize, const_cast<unsigned char *>(src), size, static_cast<unsigned char *>(raw), 1);
+   if (static_cast<std::size_t>(n) != size)
+      throw std::runtime_error("RDataFrame::Cache: cannot decompress a page of the cache");
+}
@@ -68,9 +68,15 @@ double-quote characters must be represented by a pair of double-quote characters
     2000,Mercury,Cougar
 ~~~
 
-The current implementation of RCsvDS reads the entire CSV file content into memory before
-RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
-important to check both how much memory is available and the size of the CSV file.
+By default, RCsvDS reads the entire CSV file content into memory before RDataFrame starts
+processing it. Therefore, before creating a CSV RDataFrame, it is important to check both how
+much memory is available and the size of the CSV file. To process large files, specify a chunk
+size: the file is then read and processed chunk by chunk, and only one chunk is in memory at a time.
+Values are stored column by column with their actual types, which takes roughly as much memory as
+the text they come from. If implicit multi-threading is enabled, the lines of a chunk are parsed in parallel.
+
+The types of the columns are inferred from the first line of data. For columns that are empty in the
+first line, up to ten more lines are inspected; if they are also empty, the column is of type double.
 
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
@@ -80,14 +86,45 @@ Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored
 
 #include <ROOT/TSeq.hxx>
 #include <ROOT/RCsvDS.hxx>
+#include <ROOT/RDF/RColumnReaderBase.hxx>
 #include <ROOT/RRawFile.hxx>
 #include <TError.h>
+#include <TROOT.h> // IsImplicitMTEnabled
+
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
 
+namespace {
+
+/// The lines of a chunk are read and parsed in batches of this many lines, which bounds the memory taken by the text
+constexpr std::size_t kLinesPerParsingBatch = 64 * 1024;
+/// Parsing of a batch of lines is split in tasks of at least this many lines
+constexpr std::size_t kMinLinesPerParsingTask = 1024;
+
+/// Reads the values of a column of the chunk of lines in memory
+template <typename Column_t>
+class R__CLING_PTRCHECK(off) RCsvColumnReader final : public ROOT::Detail::RDF::RColumnReaderBase {
+   Column_t &fValues;
+   const ULong64_t &fChunkFirstEntry;
+
+   void *GetImpl(Long64_t entry) final { return &fValues[entry - fChunkFirstEntry]; }
+
+public:
+   RCsvColumnReader(Column_t &values, const ULong64_t &chunkFirstEntry)
+      : fValues(values), fChunkFirstEntry(chunkFirstEntry)
+   {
+   }
+};
+
+} // anonymous namespace
+
 namespace ROOT {
 
 namespace RDF {
@@ -117,46 +154,91 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+/// Parse a line and store its values in the columns, at position recordIdx. Missing values are treated as empty.
+/// colContainsEmpty is set for the columns of type Long64_t or bool that have an empty value.
+void RCsvDS::FillRecord(const std::string &line, std::size_t recordIdx, std::vector<char> &colContainsEmpty)
 {
-   auto i = 0U;
-
    auto columns = ParseColumns(line);
+   columns.resize(fHeaders.size(), "nan");
 
-   for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
-
-      switch (colType) {
+   for (auto i = 0U; i < fHeaders.size(); ++i) {
+      auto &col = columns[i];
+      switch (fColTypesList[i]) {
       case 'D': {
-         record.emplace_back(new double((col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN()));
+         fDoubleColumns[i][recordIdx] = (col != "nan") ? std::stod(col) : std::numeric_limits<double>::quiet_NaN();
          break;
       }
       case 'L': {
          if (col != "nan") {
-            record.emplace_back(new Long64_t(std::stoll(col)));
+            fLong64Columns[i][recordIdx] = std::stoll(col);
          } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            record.emplace_back(new Long64_t(0));
+            colContainsEmpty[i] = true;
+            fLong64Columns[i][recordIdx] = 0;
          }
          break;
       }
       case 'O': {
-         auto b = new bool();
-         record.emplace_back(b);
-         if (col != "nan") {
-            std::istringstream(col) >> std::boolalpha >> *b;
-         } else {
-            fColContainingEmpty.insert(fHeaders[i]);
-            *b = false;
-         }
+         if (col == "nan")
+            colContainsEmpty[i] = true;
+         // as if read with std::boolalpha: anything but "true" is false
+         fBoolColumns[i][recordIdx] = col == "true";
          break;
       }
       case 'T': {
-         record.emplace_back(new std::string(col));
+         fStringColumns[i][recordIdx] = std::move(col);
          break;
       }
       }
-      ++i;
+   }
+}
+
+/// Parse the lines and store their values in the columns, starting at position firstRecordIdx. The columns must
+/// already have the right size. With implicit multi-threading, the lines are parsed in parallel.
+void RCsvDS::FillRecords(const std::vector<std::string> &lines, std::size_t firstRecordIdx)
+{
+   const auto nLines = lines.size();
+   std::size_t nTasks = 1;
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TThreadExecutor> pool;
+   if (ROOT::IsImplicitMTEnabled() && nLines >= 2 * kMinLinesPerParsingTask) {
+      pool = std::make_unique<ROOT::TThreadExecutor>();
+      nTasks = std::min<std::size_t>(nLines / kMinLinesPerParsingTask, 4 * pool->GetPoolSize());
+   }
+#endif
+
+   // one flag per column per task, merged at the end, so that tasks do not need to synchronize
+   std::vector<std::vector<char>> colContainsEmpty(nTasks, std::vector<char>(fHeaders.size(), false));
+   auto parseLines = [&](unsigned int task) {
+      const auto begin = task * nLines / nTasks;
+      const auto end = (task + 1) * nLines / nTasks;
+      for (auto i = begin; i < end; ++i)
+         FillRecord(lines[i], firstRecordIdx + i, colContainsEmpty[task]);
+   };
+
+#ifdef R__USE_IMT
+   if (nTasks > 1)
+      pool->Foreach(parseLines, ROOT::TSeqU(nTasks));
+   else
+#endif
+      parseLines(0);
+
+   for (const auto &taskFlags : colContainsEmpty) {
+      for (auto i = 0U; i < fHeaders.size(); ++i) {
+         if (taskFlags[i])
+            fColContainingEmpty.insert(fHeaders[i]);
+      }
+   }
+}
+
+void RCsvDS::ResizeColumns(std::size_t nRecords)
+{
+   for (auto i = 0U; i < fHeaders.size(); ++i) {
+      switch (fColTypesList[i]) {
+      case 'D': fDoubleColumns[i].resize(nRecords); break;
+      case 'L': fLong64Columns[i].resize(nRecords); break;
+      case 'O': fBoolColumns[i].resize(nRecords); break;
+      case 'T': fStringColumns[i].resize(nRecords); break;
+      }
    }
 }
 
@@ -168,7 +250,7 @@ void RCsvDS::GenerateHeaders(size_t size)
    }
 }
 
-std::vector<void *> RCsvDS::GetColumnReadersImpl(std::string_view colName, const std::type_info &ti)
+void RCsvDS::CheckColumnType(std::string_view colName, const std::type_info &ti) const
 {
    const auto colType = GetType(colName);
 
@@ -180,24 +262,30 @@ std::vector<void *> RCsvDS::GetColumnReadersImpl(std::string_view colName, const
       err += fgColTypeMap.at(colType);
       throw std::runtime_error(err);
    }
+}
 
-   const auto &colNames = GetColumnNames();
-   const auto index = std::distance(colNames.begin(), std::find(colNames.begin(), colNames.end(), colName));
-   std::vector<void *> ret(fNSlots);
-   for (auto slot : ROOT::TSeqU(fNSlots)) {
-      auto &val = fColAddresses[index][slot];
-      if (ti == typeid(double)) {
-         val = &fDoubleEvtValues[index][slot];
-      } else if (ti == typeid(Long64_t)) {
-         val = &fLong64EvtValues[index][slot];
-      } else if (ti == typeid(std::string)) {
-         val = &fStringEvtValues[index][slot];
-      } else {
-         val = &fBoolEvtValues[index][slot];
-      }
-      ret[slot] = &val;
+std::vector<void *> RCsvDS::GetColumnReadersImpl(std::string_view colName, const std::type_info &ti)
+{
+   // the values are read through GetColumnReaders(unsigned int, std::string_view, const std::type_info &), we only
+   // validate the type here
+   CheckColumnType(colName, ti);
+   return {};
+}
+
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+RCsvDS::GetColumnReaders(unsigned int /*slot*/, std::string_view colName, const std::type_info &ti)
+{
+   CheckColumnType(colName, ti);
+
+   const auto index = std::distance(fHeaders.begin(), std::find(fHeaders.begin(), fHeaders.end(), colName));
+   switch (fColTypesList[index]) {
+   case 'D': return std::make_unique<RCsvColumnReader<std::vector<double>>>(fDoubleColumns[index], fChunkFirstEntry);
+   case 'L':
+      return std::make_unique<RCsvColumnReader<std::vector<Long64_t>>>(fLong64Columns[index], fChunkFirstEntry);
+   case 'O': return std::make_unique<RCsvColumnReader<std::deque<bool>>>(fBoolColumns[index], fChunkFirstEntry);
+   default:
+      return std::make_unique<RCsvColumnReader<std::vector<std::string>>>(fStringColumns[index], fChunkFirstEntry);
    }
-   return ret;
 }
 
 void RCsvDS::ValidateColTypes(std::vector<std::string> &columns) const
@@ -273,7 +361,7 @@ void RCsvDS::InferType(const std::string &col, unsigned int idxCol)
    fColTypesList.push_back(type);
 }
 
-std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
+std::vector<std::string> RCsvDS::ParseColumns(const std::string &line) const
 {
    std::vector<std::string> columns;
 
@@ -284,7 +372,7 @@ std::vector<std::string> RCsvDS::ParseColumns(const std::string &line)
    return columns;
 }
 
-size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i)
+size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &columns, size_t i) const
 {
    std::string val;
    bool quoted = false;
@@ -365,6 +453,12 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
       // Infer types of columns with first record
       InferColTypes(columns);
 
+      const auto nColumns = fHeaders.size();
+      fDoubleColumns.resize(nColumns);
+      fLong64Columns.resize(nColumns);
+      fStringColumns.resize(nColumns);
+      fBoolColumns.resize(nColumns);
+
       // rewind
       fCsvFile->Seek(fDataPos);
    } else {
@@ -374,48 +468,16 @@ RCsvDS::RCsvDS(std::string_view fileName, bool readHeaders, char delimiter, Long
    }
 }
 
-void RCsvDS::FreeRecords()
-{
-   for (auto &record : fRecords) {
-      for (size_t i = 0; i < record.size(); ++i) {
-         void *p = record[i];
-         const auto colType = fColTypes[fHeaders[i]];
-         switch (colType) {
-         case 'D': {
-            delete static_cast<double *>(p);
-            break;
-         }
-         case 'L': {
-            delete static_cast<Long64_t *>(p);
-            break;
-         }
-         case 'O': {
-            delete static_cast<bool *>(p);
-            break;
-         }
-         case 'T': {
-            delete static_cast<std::string *>(p);
-            break;
-         }
-         }
-      }
-   }
-   fRecords.clear();
-}
-
 ////////////////////////////////////////////////////////////////////////
 /// Destructor.
-RCsvDS::~RCsvDS()
-{
-   FreeRecords();
-}
+RCsvDS::~RCsvDS() {}
 
 void RCsvDS::Finalize()
 {
    fCsvFile->Seek(fDataPos);
    fProcessedLines = 0ULL;
-   fEntryRangesRequested = 0ULL;
-   FreeRecords();
+   fChunkFirstEntry = 0ULL;
+   ResizeColumns(0);
 }
 
 const std::vector<std::string> &RCsvDS::GetColumnNames() const
@@ -425,16 +487,30 @@ const std::vector<std::string> &RCsvDS::GetColumnNames() const
 
 std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 {
-   // Read records and store them in memory
+   // Read records and store them in memory. The text of the lines is read and parsed in batches, so that only one
+   // batch of lines is in memory at a time besides the parsed values.
    auto linesToRead = fLinesChunkSize;
-   FreeRecords();
+   std::size_t nRecords = 0;
+   ResizeColumns(0);
 
+   std::vector<std::string> lines;
    std::string line;
-   while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
-      if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
-      --linesToRead;
+   bool eof = false;
+   while (!eof && (-1LL == fLinesChunkSize || 0 != linesToRead)) {
+      lines.clear();
+      while (lines.size() < kLinesPerParsingBatch && (-1LL == fLinesChunkSize || 0 != linesToRead)) {
+         if (!fCsvFile->Readln(line)) {
+            eof = true;
+            break;
+         }
+         if (line.empty())
+            continue; // skip empty lines
+         lines.emplace_back(std::move(line));
+         --linesToRead;
+      }
+      ResizeColumns(nRecords + lines.size());
+      FillRecords(lines, nRecords);
+      nRecords += lines.size();
    }
 
    if (!fColContainingEmpty.empty()) {
@@ -451,14 +527,13 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
 
    if (gDebug > 0) {
       if (fLinesChunkSize == -1LL) {
-         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", fRecords.size());
+         Info("GetEntryRanges", "Attempted to read entire CSV file into memory, %zu lines read", nRecords);
       } else {
-         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, fRecords.size());
+         Info("GetEntryRanges", "Attempted to read chunk of %lld lines of CSV file into memory, %zu lines read", fLinesChunkSize, nRecords);
       }
    }
 
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   const auto nRecords = fRecords.size();
    if (0 == nRecords)
       return entryRanges;
 
@@ -475,8 +550,8 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
    }
    entryRanges.back().second += remainder;
 
+   fChunkFirstEntry = fProcessedLines;
    fProcessedLines += nRecords;
-   fEntryRangesRequested++;
 
    return entryRanges;
 }
@@ -502,34 +577,9 @@ bool RCsvDS::HasColumn(std::string_view colName) const
    return fHeaders.end() != std::find(fHeaders.begin(), fHeaders.end(), colName);
 }
 
-bool RCsvDS::SetEntry(unsigned int slot, ULong64_t entry)
+bool RCsvDS::SetEntry(unsigned int, ULong64_t)
 {
-   // Here we need to normalise the entry to the number of lines we already processed.
-   const auto offset = (fEntryRangesRequested - 1) * fLinesChunkSize;
-   const auto recordPos = entry - offset;
-   int colIndex = 0;
-   for (auto &colType : fColTypesList) {
-      auto dataPtr = fRecords[recordPos][colIndex];
-      switch (colType) {
-      case 'D': {
-         fDoubleEvtValues[colIndex][slot] = *static_cast<double *>(dataPtr);
-         break;
-      }
-      case 'L': {
-         fLong64EvtValues[colIndex][slot] = *static_cast<Long64_t *>(dataPtr);
-         break;
-      }
-      case 'O': {
-         fBoolEvtValues[colIndex][slot] = *static_cast<bool *>(dataPtr);
-         break;
-      }
-      case 'T': {
-         fStringEvtValues[colIndex][slot] = *static_cast<std::string *>(dataPtr);
-         break;
-      }
-      }
-      colIndex++;
-   }
+   // the column readers address the values of the chunk in memory directly
    return true;
 }
 
@@ -538,16 +588,6 @@ void RCsvDS::SetNSlots(unsigned int nSlots)
    assert(0U == fNSlots && "Setting the number of slots even if the number of slots is different from zero.");
 
    fNSlots = nSlots;
-
-   const auto nColumns = fHeaders.size();
-   // Initialize the entire set of addresses
-   fColAddresses.resize(nColumns, std::vector<void *>(fNSlots, nullptr));
-
-   // Initialize the per event data holders
-   fDoubleEvtValues.resize(nColumns, std::vector<double>(fNSlots));
-   fLong64EvtValues.resize(nColumns, std::vector<Long64_t>(fNSlots));
-   fStringEvtValues.resize(nColumns, std::vector<std::string>(fNSlots));
-   fBoolEvtValues.resize(nColumns, std::deque<bool>(fNSlots));
 }
 
 std::string RCsvDS::GetLabel()
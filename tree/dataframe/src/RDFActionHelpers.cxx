@@ -254,6 +254,17 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+std::string SnapshotFileNameForSlot(const std::string &fileName, unsigned int slot)
+{
+   // insert the slot number before the extension, "out.root" -> "out_3.root"
+   const auto slotSuffix = "_" + std::to_string(slot);
+   const auto dotPos = fileName.rfind('.');
+   const auto slashPos = fileName.rfind('/');
+   if (dotPos == std::string::npos || (slashPos != std::string::npos && dotPos < slashPos))
+      return fileName + slotSuffix;
+   return fileName.substr(0, dotPos) + slotSuffix + fileName.substr(dotPos);
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
@@ -10,8 +10,13 @@
 
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/GraphUtils.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
+#include "ROOT/RDF/RVariationBase.hxx"
 
 #include <algorithm> // std::find
+#include <iomanip>   // std::setprecision
+#include <map>
+#include <sstream>
 
 namespace ROOT {
 namespace Internal {
@@ -28,6 +33,7 @@ GraphDrawing::CreateDefineNode(const std::string &columnName, const ROOT::Detail
       return duplicateDefineIt->second;
 
    auto node = std::make_shared<GraphNode>("Define\\n" + columnName, visitedMap.size(), ENodeType::kDefine);
+   node->SetProfile(columnPtr->GetProfile());
    visitedMap[(void *)columnPtr] = node;
    return node;
 }
@@ -45,6 +51,7 @@ GraphDrawing::CreateFilterNode(const ROOT::Detail::RDF::RFilterBase *filterPtr,
 
    auto node = std::make_shared<GraphNode>((filterPtr->HasName() ? filterPtr->GetName() : "Filter"), visitedMap.size(),
                                            ENodeType::kFilter);
+   node->SetProfile(filterPtr->GetProfile());
    visitedMap[(void *)filterPtr] = node;
    return node;
 }
@@ -93,6 +100,75 @@ GraphDrawing::AddDefinesToGraph(std::shared_ptr<GraphNode> node, const RColumnRe
 
 namespace GraphDrawing {
 
+namespace {
+/// The summary of the node's profile appended to its label in the dot representation, empty if it was not profiled
+std::string ProfileLabel(const GraphNode &node)
+{
+   const auto *profile = node.GetProfile();
+   if (profile == nullptr)
+      return "";
+   const auto total = profile->GetTotal();
+   std::stringstream label;
+   label << std::fixed << std::setprecision(3) << "\\n" << total.fNCalls << " entries, " << total.fWallTimeNs * 1e-6
+         << " ms";
+   if (total.fCpuTimeNs > 0)
+      label << " (" << total.fCpuTimeNs * 1e-6 << " ms CPU)";
+   return label.str();
+}
+
+std::string NodeTypeName(ENodeType type)
+{
+   switch (type) {
+   case ENodeType::kAction:
+   case ENodeType::kUsedAction: return "action";
+   case ENodeType::kDefine: return "define";
+   case ENodeType::kFilter: return "filter";
+   case ENodeType::kRange: return "range";
+   case ENodeType::kRoot: return "root";
+   }
+   return "";
+}
+
+/// Quote a string for JSON. The line breaks of the dot labels ("\\n") are replaced by spaces.
+std::string JsonString(const std::string &str)
+{
+   std::string out = "\"";
+   for (std::size_t i = 0; i < str.size(); ++i) {
+      const char c = str[i];
+      if (c == '\\' && i + 1 < str.size() && str[i + 1] == 'n') {
+         out += ' ';
+         ++i;
+      } else if (c == '\\' || c == '"') {
+         out += '\\';
+         out += c;
+      } else if (c == '\n') {
+         out += "\\n";
+      } else {
+         out += c;
+      }
+   }
+   return out + '"';
+}
+
+/// Print the per-slot counters of a profile as JSON members, e.g. `"entries": [10, 12], "wallTimeNs": [...]`
+void PrintSlotData(std::ostream &os, const RNodeProfile &profile, bool withCpuTime)
+{
+   auto printArray = [&](const char *name, ULong64_t RNodeProfile::RSlotData::*member) {
+      os << '"' << name << "\": [";
+      for (auto slot = 0u; slot < profile.GetNSlots(); ++slot)
+         os << (slot > 0 ? ", " : "") << profile.GetSlotData(slot).*member;
+      os << ']';
+   };
+   printArray("entries", &RNodeProfile::RSlotData::fNCalls);
+   os << ", ";
+   printArray("wallTimeNs", &RNodeProfile::RSlotData::fWallTimeNs);
+   if (withCpuTime) {
+      os << ", ";
+      printArray("cpuTimeNs", &RNodeProfile::RSlotData::fCpuTimeNs);
+   }
+}
+} // anonymous namespace
+
 std::string GraphCreatorHelper::FromGraphLeafToDot(const GraphNode &start) const
 {
    // Only the mapping between node id and node label (i.e. name)
@@ -103,7 +179,7 @@ std::string GraphCreatorHelper::FromGraphLeafToDot(const GraphNode &start) const
    // Explore the graph bottom-up and store its dot representation.
    const GraphNode *leaf = &start;
    while (leaf) {
-      dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << leaf->GetName()
+      dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << leaf->GetName() << ProfileLabel(*leaf)
                       << "\", style=\"filled\", fillcolor=\"" << leaf->GetColor() << "\", shape=\"" << leaf->GetShape()
                       << "\"];\n";
       if (leaf->GetPrevNode()) {
@@ -125,7 +201,7 @@ std::string GraphCreatorHelper::FromGraphActionsToDot(std::vector<std::shared_pt
    for (auto leafShPtr : leaves) {
       GraphNode *leaf = leafShPtr.get();
       while (leaf && !leaf->IsExplored()) {
-         dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << leaf->GetName()
+         dotStringLabels << "\t" << leaf->GetID() << " [label=\"" << leaf->GetName() << ProfileLabel(*leaf)
                          << "\", style=\"filled\", fillcolor=\"" << leaf->GetColor() << "\", shape=\""
                          << leaf->GetShape() << "\"];\n";
          if (leaf->GetPrevNode()) {
@@ -164,6 +240,84 @@ std::string GraphCreatorHelper::RepresentGraph(RLoopManager *loopManager)
    return FromGraphActionsToDot(std::move(nodes));
 }
 
+std::string GraphCreatorHelper::RepresentProfile(RLoopManager *loopManager)
+{
+   const auto actions = loopManager->GetAllActions();
+   const auto edges = loopManager->GetGraphEdges();
+
+   // collect all nodes of the graph, ordered by id
+   std::map<unsigned int, const GraphNode *> nodes;
+   std::vector<std::shared_ptr<GraphNode>> leaves;
+   for (auto *action : actions)
+      leaves.emplace_back(action->GetGraph(fVisitedMap));
+   for (auto *edge : edges)
+      leaves.emplace_back(edge->GetGraph(fVisitedMap));
+   for (const auto &leaf : leaves) {
+      for (const GraphNode *node = leaf.get(); node != nullptr; node = node->GetPrevNode())
+         nodes.emplace(node->GetID(), node);
+   }
+
+   std::stringstream json;
+   json << "{\n  \"nSlots\": " << loopManager->GetNSlots() << ",\n  \"loop\": ";
+   const auto *loopProfile = loopManager->GetLoopProfile();
+   if (loopProfile != nullptr) {
+      json << "{";
+      PrintSlotData(json, *loopProfile, /*withCpuTime=*/true);
+      json << ", \"bytesRead\": " << loopManager->GetProfiledBytesRead() << "}";
+   } else {
+      json << "null";
+   }
+
+   json << ",\n  \"nodes\": [";
+   bool first = true;
+   for (const auto &idAndNode : nodes) {
+      const auto &node = *idAndNode.second;
+      json << (first ? "\n" : ",\n") << "    {\"id\": " << node.GetID() << ", \"type\": \"" << NodeTypeName(node.GetType())
+           << "\", \"name\": " << JsonString(node.GetName());
+      if (node.GetPrevNode() != nullptr)
+         json << ", \"prevId\": " << node.GetPrevNode()->GetID();
+      // the root node is described by "loop"
+      if (node.GetProfile() != nullptr && node.GetType() != ENodeType::kRoot) {
+         json << ", ";
+         PrintSlotData(json, *node.GetProfile(), /*withCpuTime=*/false);
+      }
+      json << "}";
+      first = false;
+   }
+
+   json << "\n  ],\n  \"variations\": [";
+   first = true;
+   for (const auto *variation : loopManager->GetBookedVariations()) {
+      if (variation->GetProfile() == nullptr)
+         continue;
+      json << (first ? "\n" : ",\n") << "    {\"columns\": [";
+      const auto &columns = variation->GetColumnNames();
+      for (std::size_t i = 0; i < columns.size(); ++i)
+         json << (i > 0 ? ", " : "") << JsonString(columns[i]);
+      json << "], \"variations\": [";
+      const auto &variationNames = variation->GetVariationNames();
+      for (std::size_t i = 0; i < variationNames.size(); ++i)
+         json << (i > 0 ? ", " : "") << JsonString(variationNames[i]);
+      json << "], ";
+      PrintSlotData(json, *variation->GetProfile(), /*withCpuTime=*/false);
+      json << "}";
+      first = false;
+   }
+
+   json << "\n  ],\n  \"columnReaders\": [";
+   first = true;
+   if (loopProfile != nullptr) {
+      for (const auto &colAndProfile : loopManager->GetColumnReaderProfiles()) {
+         json << (first ? "\n" : ",\n") << "    {\"column\": " << JsonString(colAndProfile.first) << ", ";
+         PrintSlotData(json, *colAndProfile.second, /*withCpuTime=*/false);
+         json << "}";
+         first = false;
+      }
+   }
+   json << "\n  ]\n}\n";
+   return json.str();
+}
+
 } // namespace GraphDrawing
 } // namespace RDF
 } // namespace Internal
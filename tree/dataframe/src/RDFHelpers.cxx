@@ -11,6 +11,7 @@
 #include "ROOT/RDFHelpers.hxx"
 #include "TROOT.h"      // IsImplicitMTEnabled
 #include "TError.h"     // Warning
+#include "TEnv.h"
 #include "TStopwatch.h"
 #include "RConfigure.h" // R__USE_IMT
 #include "ROOT/RLogger.hxx"
@@ -109,26 +110,49 @@ unsigned int ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
       << " unique computation graphs) completed"
       << (sw.RealTime() > 1e-3 ? " in " + std::to_string(sw.RealTime()) + " seconds." : " in less than 1ms.");
 
+   // Group the graphs over the same dataset: the first graph of each group runs the event loop for all of them
+   using ROOT::Detail::RDF::RLoopManager;
+   const bool sharedReading = gEnv->GetValue("RDataFrame.RunGraphsSharedReading", 1) != 0;
+   std::vector<std::vector<RLoopManager *>> groups;
+   for (auto &h : uniqueLoops) {
+      if (!h.fLoopManager)
+         continue;
+      auto group = std::find_if(groups.begin(), groups.end(), [&](const std::vector<RLoopManager *> &g) {
+         return sharedReading && g.front()->CanShareEventLoop(*h.fLoopManager);
+      });
+      if (group != groups.end())
+         group->emplace_back(h.fLoopManager);
+      else
+         groups.push_back({h.fLoopManager});
+   }
+   if (groups.size() < uniqueLoops.size()) {
+      R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
+         << "RunGraphs runs " << uniqueLoops.size() << " computation graphs in " << groups.size()
+         << " event loops, graphs over the same dataset share one event loop.";
+   }
+
    // Trigger the unique event loops
-   auto run = [](RResultHandle &h) {
-      if (h.fLoopManager)
-         h.fLoopManager->Run(/*jit=*/false);
+   auto run = [](std::vector<RLoopManager *> &g) {
+      if (g.size() == 1)
+         g.front()->Run(/*jit=*/false);
+      else
+         g.front()->RunShared({g.begin() + 1, g.end()}, /*jit=*/false);
    };
 
    sw.Start();
 #ifdef R__USE_IMT
    if (ROOT::IsImplicitMTEnabled()) {
-      ROOT::TThreadExecutor{}.Foreach(run, uniqueLoops);
+      ROOT::TThreadExecutor{}.Foreach(run, groups);
    } else {
 #endif
-      std::for_each(uniqueLoops.begin(), uniqueLoops.end(), run);
+      std::for_each(groups.begin(), groups.end(), run);
 #ifdef R__USE_IMT
    }
 #endif
    sw.Stop();
    R__LOG_INFO(ROOT::Detail::RDF::RDFLogChannel())
-      << "Finished RunGraphs run (" << uniqueLoops.size() << " unique computation graphs, " << sw.CpuTime() << "s CPU, "
-      << sw.RealTime() << "s elapsed).";
+      << "Finished RunGraphs run (" << uniqueLoops.size() << " unique computation graphs, " << groups.size()
+      << " event loops, " << sw.CpuTime() << "s CPU, " << sw.RealTime() << "s elapsed).";
 
    return uniqueLoops.size();
 }
@@ -335,6 +359,32 @@ void AddProgressbar(ROOT::RDataFrame dataframe)
    auto node = ROOT::RDF::AsRNode(dataframe);
    ROOT::RDF::Experimental::AddProgressbar(node);
 }
+
+/// \brief Return the profile of the last event loop of the computation graph as a JSON string.
+/// \param[in] node Any node of the graph: the profile always covers the entire graph.
+///
+/// Profiling must have been enabled with ROOT::Internal::RDF::EnableProfiling() before the event loop ran. For each
+/// processing slot, the JSON object lists how many entries were processed and how much wall time (in ns) was spent
+/// by every node of the graph (as numbered by SaveGraph()), every Vary and the reader of every dataset column, as
+/// well as the wall and thread CPU time of the event loop tasks and the bytes read from ROOT files.
+std::string SaveProfile(ROOT::RDF::RNode node)
+{
+   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper helper;
+   return helper.RepresentProfile(node);
+}
+
+/// \brief Write the profile of the last event loop of the computation graph to the specified file as JSON.
+/// \param[in] node Any node of the graph: the profile always covers the entire graph.
+/// \param[in] outputFile File where to save the profile.
+///
+/// See SaveProfile(ROOT::RDF::RNode) for the content of the profile.
+void SaveProfile(ROOT::RDF::RNode node, const std::string &outputFile)
+{
+   std::ofstream out(outputFile);
+   if (!out.is_open())
+      throw std::runtime_error("Could not open output file \"" + outputFile + "\" for writing");
+   out << SaveProfile(std::move(node));
+}
 } // namespace Experimental
 } // namespace RDF
 } // namespace ROOT
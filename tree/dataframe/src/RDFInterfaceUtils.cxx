@@ -8,6 +8,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDataSource.hxx>
 #include <ROOT/RDF/InterfaceUtils.hxx>
 #include <ROOT/RDF/RColumnRegister.hxx>
@@ -20,10 +21,15 @@
 #include <ROOT/RDF/RNodeBase.hxx>
 #include <ROOT/RDF/Utils.hxx>
 #include <ROOT/RStringView.hxx>
+#include <RConfigure.h>
+#ifdef R__HAS_ROOT7 // defined by CMake for root7 builds
+#include <ROOT/RNTupleDS.hxx>
+#endif
 #include <TBranch.h>
 #include <TClass.h>
 #include <TClassEdit.h>
 #include <TDataType.h>
+#include <TEnv.h>
 #include <TError.h>
 #include <TLeaf.h>
 #include <TObjArray.h>
@@ -319,8 +325,9 @@ static std::string DeclareFunction(const std::string &expr, const ColumnNames_t
    const auto funcFullName = "R_rdf::" + funcBaseName;
 
    const auto toDeclare = "namespace R_rdf {\nauto " + funcBaseName + funcCode + "\nusing " + funcBaseName +
-                          "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" + funcBaseName +
-                          ")>::ret_type;\n}";
+                          "_ret_t = ROOT::Internal::VecOps::MaterializedType_t<typename "
+                          "ROOT::TypeTraits::CallableTraits<decltype(" +
+                          funcBaseName + ")>::ret_type>;\n}";
    ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
 
    // InterpreterDeclare could throw. If it doesn't, mark the function as already jitted
@@ -688,6 +695,39 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    return jittedFilter;
 }
 
+/// Whether Profile1D and Profile2D fill the profile from all the slots through one ROOT::TProfileConcurrentFiller,
+/// instead of filling one copy of the profile per slot and merging the copies at the end. Enabled through the
+/// `RDataFrame.ConcurrentProfileFill` rootrc/gEnv setting; the columns must not be collections.
+bool IsConcurrentProfileFillEnabled()
+{
+   return gEnv->GetValue("RDataFrame.ConcurrentProfileFill", 0) != 0;
+}
+
+namespace {
+/// Return the key under which a jitted Define can be shared by other branches of the computation graph, or an empty
+/// string if it should not be shared. Two Defines get the same key if they define the same column with the same jitted
+/// function and their inputs resolve to the same Define nodes or dataset columns.
+/// Sharing is opt-in, with the `RDataFrame.ShareJittedDefines` rootrc/gEnv setting: it is only correct for pure
+/// expressions, whose value only depends on their inputs. With sharing, an impure expression such as
+/// `gRandom->Gaus(x, 1)` booked in two branches returns the same value in both instead of independent draws.
+/// Expressions that read no column and expressions that depend on systematic variations are never shared.
+std::string JittedDefineCacheKey(std::string_view name, const std::string &funcName, const ColumnNames_t &usedCols,
+                                 const RColumnRegister &colRegister)
+{
+   if (usedCols.empty() || gEnv->GetValue("RDataFrame.ShareJittedDefines", 0) == 0 ||
+       !colRegister.GetVariationDeps(usedCols).empty())
+      return "";
+
+   std::string key = std::string(name) + ';' + funcName;
+   for (const auto &col : usedCols) {
+      const auto resolvedCol = colRegister.ResolveAlias(col);
+      auto *define = colRegister.GetDefine(resolvedCol);
+      key += ';' + (define ? PrettyPrintAddr(define) : resolvedCol);
+   }
+   return key;
+}
+} // anonymous namespace
+
 /// Book the jitting of a Define call
 std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_view expression, RLoopManager &lm,
                                              RDataSource *ds, const RColumnRegister &colRegister,
@@ -703,9 +743,21 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    const auto funcName = DeclareFunction(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfFunc(funcName);
 
+   // An identical Define on another branch of the computation graph is shared instead of being jitted and evaluated
+   // again: the node caches its value per entry, so all its users then see a single evaluation.
+   const auto cacheKey = JittedDefineCacheKey(name, funcName, parsedExpr.fUsedCols, colRegister);
+   if (!cacheKey.empty()) {
+      if (auto cachedDefine = lm.GetJittedDefine(cacheKey)) {
+         delete upcastNodeOnHeap; // nothing will be jitted that could take ownership
+         return cachedDefine;
+      }
+   }
+
    auto definesCopy = new RColumnRegister(colRegister);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, colRegister, parsedExpr.fUsedCols);
+   if (!cacheKey.empty())
+      lm.AddJittedDefine(cacheKey, jittedDefine);
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper<ROOT::Internal::RDF::DefineTypes::RDefineTag>(" << funcName
@@ -1006,6 +1058,37 @@ AddSizeBranches(const std::vector<std::string> &branches, TTree *tree, std::vect
    return {std::move(colsWithoutAliases), std::move(colsWithAliases)};
 }
 
+/// Create the dataframe returned by Snapshot, which reads the output dataset.
+/// If the output files or their format are known only after the event loop (see IsSnapshotOutputDeferred()), the
+/// returned dataframe is a placeholder without entries that args.fOutputCallback replaces once the output is written.
+std::shared_ptr<ROOT::RDataFrame>
+MakeSnapshotDataFrame(SnapshotHelperArgs &args, std::string_view fullTreeName, const ColumnNames_t &defaultColumns)
+{
+   if (!IsSnapshotOutputDeferred(args.fOptions))
+      return std::make_shared<ROOT::RDataFrame>(fullTreeName, args.fFileName, defaultColumns);
+
+   auto df = std::make_shared<ROOT::RDataFrame>(fullTreeName, std::vector<std::string>{}, defaultColumns);
+   std::weak_ptr<ROOT::RDataFrame> weakDF = df;
+   const auto isRNTuple = args.fOptions.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   args.fOutputCallback = [weakDF, treePath = std::string(fullTreeName), ntupleName = args.fTreeName, defaultColumns,
+                           isRNTuple](const std::vector<std::string> &fileNames) {
+      auto outputDF = weakDF.lock();
+      if (!outputDF || fileNames.empty())
+         return; // the result of Snapshot has been discarded or nothing was written
+      if (isRNTuple) {
+#ifdef R__HAS_ROOT7
+         *outputDF = ROOT::RDataFrame(std::make_unique<ROOT::Experimental::RNTupleDS>(ntupleName, fileNames),
+                                      defaultColumns);
+#else
+         (void)ntupleName;
+#endif
+      } else {
+         *outputDF = ROOT::RDataFrame(treePath, fileNames, defaultColumns);
+      }
+   };
+   return df;
+}
+
 void RemoveDuplicates(ColumnNames_t &columnNames)
 {
    std::set<std::string> uniqueCols;
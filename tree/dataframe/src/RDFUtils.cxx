@@ -12,6 +12,7 @@
 #include "ROOT/RDataSource.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RLogger.hxx"
 #include "RtypesCore.h"
@@ -20,12 +21,18 @@
 #include "TClass.h"
 #include "TClassEdit.h"
 #include "TClassRef.h"
+#include "TEnv.h"
 #include "TError.h" // Info
 #include "TInterpreter.h"
 #include "TLeaf.h"
+#include "TMD5.h"
 #include "TROOT.h" // IsImplicitMTEnabled, GetThreadPoolSize
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <cctype>
+#include <cstdio> // std::rename
+#include <fstream>
 #include <stdexcept>
 #include <string>
 #include <cstring>
@@ -312,6 +319,66 @@ std::vector<std::string> ReplaceDotWithUnderscore(const std::vector<std::string>
    return newColNames;
 }
 
+namespace {
+/// All the code declared to the interpreter by RDataFrame so far, which the jitted code may depend upon.
+/// Used to reproduce the jitted code in the libraries of the jit cache.
+std::string &GetDeclaredCode()
+{
+   static std::string code;
+   return code;
+}
+
+/// Replace the addresses that are passed to the jitted helpers, i.e. exactly the `reinterpret_cast<T*>(0x1234)`
+/// expressions written by the RDFInterfaceUtils code generators, by `reinterpret_cast<T*>(addresses[i])` and collect
+/// them in `addresses`. Anything else, e.g. a hexadecimal literal in a user expression or a string literal, is left
+/// untouched and therefore becomes part of the cache key.
+std::string ExtractAddresses(const std::string &code, std::vector<void *> &addresses)
+{
+   static const std::string castBegin = "reinterpret_cast<";
+   std::string result;
+   result.reserve(code.size());
+   bool inString = false;
+   std::size_t pos = 0;
+   while (pos < code.size()) {
+      const char c = code[pos];
+      if (c == '"' && (pos == 0 || code[pos - 1] != '\\'))
+         inString = !inString;
+      if (inString || code.compare(pos, castBegin.size(), castBegin) != 0) {
+         result += c;
+         ++pos;
+         continue;
+      }
+      // find the end of the template argument, which can contain nested angle brackets
+      auto argBegin = pos + castBegin.size();
+      int depth = 1;
+      while (argBegin < code.size() && depth > 0) {
+         if (code[argBegin] == '<')
+            ++depth;
+         else if (code[argBegin] == '>')
+            --depth;
+         ++argBegin;
+      }
+      // argBegin now points past the closing '>': we only accept "(0x<hex digits>)"
+      auto end = argBegin + 3;
+      while (end < code.size() && std::isxdigit(static_cast<unsigned char>(code[end])))
+         ++end;
+      const bool isAddress = depth == 0 && code.compare(argBegin, 3, "(0x") == 0 && end > argBegin + 3 &&
+                             end < code.size() && code[end] == ')';
+      if (!isAddress) {
+         result.append(code, pos, argBegin - pos);
+         pos = argBegin;
+         continue;
+      }
+      const auto addr = std::stoull(code.substr(argBegin + 3, end - argBegin - 3), nullptr, 16);
+      addresses.push_back(reinterpret_cast<void *>(static_cast<std::size_t>(addr)));
+      result.append(code, pos, argBegin - pos);
+      result += "(addresses[" + std::to_string(addresses.size() - 1) + "]";
+      pos = end;
+   }
+   return result;
+}
+} // anonymous namespace
+
 void InterpreterDeclare(const std::string &code)
 {
    R__LOG_DEBUG(10, RDFLogChannel()) << "Declaring the following code to cling:\n\n" << code << '\n';
@@ -322,6 +389,7 @@ void InterpreterDeclare(const std::string &code)
          "the crash\n All RDF objects that have not run an event loop yet should be considered in an invalid state.\n";
       throw std::runtime_error(msg);
    }
+   GetDeclaredCode().append(code).append("\n");
 }
 
 Long64_t InterpreterCalc(const std::string &code, const std::string &context)
@@ -345,10 +413,17 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context)
 
    // Call Calc every 1000 newlines in order to avoid jitting a very large function body, which is slow:
    // see https://github.com/root-project/root/issues/9312 and https://github.com/root-project/root/issues/7604
+   // The optimizer passes are superlinear in the size of the function, the number of lines per call can be tuned
+   // with the RDataFrame.JitChunkLines resource. A value of 0 or less jits everything with a single call.
+   const int chunkLines = gEnv->GetValue("RDataFrame.JitChunkLines", 1000);
+   if (chunkLines <= 0) {
+      callCalc(code);
+      return 0;
+   }
    std::size_t substr_start = 0;
    std::size_t substr_end = 0;
    while (substr_end != std::string::npos && substr_start != code.size() - 1) {
-      for (std::size_t i = 0u; i < 1000u && substr_end != std::string::npos; ++i) {
+      for (int i = 0; i < chunkLines && substr_end != std::string::npos; ++i) {
          substr_end = code.find('\n', substr_end + 1);
       }
       const std::string subs = code.substr(substr_start, substr_end - substr_start);
@@ -360,6 +435,91 @@ Long64_t InterpreterCalc(const std::string &code, const std::string &context)
    return 0; // we used to forward the return value of Calc, but that's not possible anymore.
 }
 
+bool InterpreterCalcCached(const std::string &code)
+{
+   TString cacheDirName = gEnv->GetValue("RDataFrame.JitCacheDir", "");
+   if (cacheDirName.IsNull())
+      return false;
+   gSystem->ExpandPathName(cacheDirName);
+   const std::string cacheDir = cacheDirName.Data();
+
+   std::vector<void *> addresses;
+   const auto body = ExtractAddresses(code, addresses);
+   const auto &declarations = GetDeclaredCode();
+
+   // The key covers everything that the compiled code depends on, except for the headers of the ROOT installation
+   const std::string key = std::string(gROOT->GetVersion()) + ' ' + gROOT->GetGitCommit() + '\n' + declarations + body;
+   TMD5 md5;
+   md5.Update(reinterpret_cast<const UChar_t *>(key.data()), key.size());
+   md5.Final();
+   const std::string funcName = std::string("R_rdf_jitcache_") + md5.AsString();
+   const std::string libBase = cacheDir + "/" + funcName;
+   const std::string libPath = libBase + "." + gSystem->GetSoExt();
+
+   // a failed build leaves a marker behind, so that it is not attempted again by every job using the same code
+   const std::string failedPath = libBase + ".failed";
+
+   // AccessPathName() returns false if the file exists
+   if (gSystem->AccessPathName(libPath.c_str())) {
+      if (!gSystem->AccessPathName(failedPath.c_str())) {
+         R__LOG_DEBUG(10, RDFLogChannel()) << "A previous attempt to build " << libPath
+                                           << " failed, falling back to the interpreter";
+         return false;
+      }
+      R__LOG_INFO(RDFLogChannel()) << "Jit cache miss, building " << libPath;
+      gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true);
+      // concurrent jobs can populate the cache at the same time: each one builds under its own name and then
+      // atomically renames the library into place, so that no job ever loads a partially written library
+      const std::string tmpBase = libBase + "_" + std::to_string(gSystem->GetPid());
+      const std::string tmpLibPath = tmpBase + "." + gSystem->GetSoExt();
+      const std::string srcPath = tmpBase + ".cxx";
+      {
+         std::ofstream src(srcPath);
+         // The dictionary generated by ACLiC must stay empty: the interpreter already knows the declarations
+         src << "// Generated by RDataFrame for its jit cache, do not edit\n"
+             << "#ifndef __CLING__\n"
+             << "#include \"ROOT/RDataFrame.hxx\"\n"
+             << "#include \"ROOT/RVec.hxx\"\n"
+             << "#include \"TMath.h\"\n"
+             << "#include <cmath>\n"
+             << "using namespace std;\n"
+             // internal linkage, so that the symbols do not clash with the ones jitted by the interpreter
+             << "namespace {\n"
+             << declarations << "} // anonymous namespace\n"
+             << "extern \"C\" void " << funcName << "(void **addresses)\n{\n"
+             << body << "\n(void)addresses;\n}\n"
+             << "#endif\n";
+         if (!src)
+            return false;
+      }
+      const bool isBuilt = gSystem->CompileMacro(srcPath.c_str(), "kOcs", tmpBase.c_str()) == 1;
+      gSystem->Unlink(srcPath.c_str());
+      if (!isBuilt) {
+         R__LOG_INFO(RDFLogChannel()) << "Could not build the jit cache library " << libPath
+                                      << ", falling back to the interpreter";
+         gSystem->Unlink(tmpLibPath.c_str());
+         std::ofstream(failedPath) << code;
+         return false;
+      }
+      // the dictionary pcm keeps its temporary name, which is the one the library refers to
+      if (std::rename(tmpLibPath.c_str(), libPath.c_str()) != 0) {
+         gSystem->Unlink(tmpLibPath.c_str());
+         if (gSystem->AccessPathName(libPath.c_str()))
+            return false;
+      }
+   }
+
+   if (gSystem->Load(libPath.c_str()) < 0)
+      return false;
+   auto func = reinterpret_cast<void (*)(void **)>(gSystem->DynFindSymbol(libPath.c_str(), funcName.c_str()));
+   if (!func)
+      return false;
+   R__LOG_DEBUG(10, RDFLogChannel()) << "Executing the following code from the jit cache library " << libPath
+                                     << ":\n\n" << body << '\n';
+   func(addresses.data());
+   return true;
+}
+
 bool IsInternalColumn(std::string_view colName)
 {
    const auto str = colName.data();
@@ -419,6 +579,12 @@ bool IsStrInVec(const std::string &str, const std::vector<std::string> &vec)
    return std::find(vec.cbegin(), vec.cend(), str) != vec.cend();
 }
 
+RNodeTimer *&CurrentNodeTimer()
+{
+   thread_local RNodeTimer *timer = nullptr;
+   return timer;
+}
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
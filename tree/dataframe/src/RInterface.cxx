@@ -28,6 +28,63 @@ void ROOT::Internal::RDF::ChangeSpec(const ROOT::RDF::RNode &node, ROOT::RDF::Ex
    node.GetLoopManager()->ChangeSpec(std::move(spec));
 }
 
+/**
+ * \brief Process the entries of the following event loops in blocks of consecutive entries.
+ *
+ * \param node Any node of the computation graph.
+ * \param bulkSize The number of entries per block; 0 or 1 restore the entry-by-entry processing.
+ *
+ * In a bulk event loop, all the filters of the computation graph are evaluated for a block of entries before the
+ * actions are executed on the selected entries of the block, which reduces the per-entry overhead of walking the
+ * computation graph. Defined columns are still evaluated lazily, entry by entry; a Define that is used both upstream
+ * and downstream of a filter can therefore be evaluated more than once per entry and must be free of side effects.
+ * Event loops over TTrees, over data sources that expose their values through value pointers, and computation graphs
+ * containing a Range fall back to the entry-by-entry processing.
+ */
+void ROOT::Internal::RDF::SetBulkSize(const ROOT::RDF::RNode &node, unsigned int bulkSize)
+{
+   node.GetLoopManager()->SetBulkSize(bulkSize);
+}
+
+/**
+ * \brief Record the time spent in each node of the computation graph by the following event loops.
+ *
+ * \param node Any node of the computation graph.
+ * \param enable Whether the following event loops should be profiled.
+ *
+ * For every processing slot, filters, defines, variations, actions and the readers of the dataset columns count the
+ * entries they process and measure the wall time they take, excluding the time spent in the upstream nodes they
+ * trigger. The thread CPU time of the tasks and the bytes read from ROOT files are measured for the event loop as a
+ * whole. The results of the last event loop annotate the graph written by ROOT::RDF::SaveGraph() and can be exported
+ * with ROOT::RDF::Experimental::SaveProfile(). Profiling adds two clock readings per node evaluation.
+ */
+void ROOT::Internal::RDF::EnableProfiling(const ROOT::RDF::RNode &node, bool enable)
+{
+   node.GetLoopManager()->SetProfiling(enable);
+}
+
+/**
+ * \brief Let the following event loops place the RVecs created while processing an entry in a per-slot arena.
+ *
+ * \param node Any node of the computation graph.
+ * \param enable Whether the following event loops should use the arena.
+ *
+ * Every processing slot gets a ROOT::Internal::VecOps::RVecArena, which is reset before each entry (or block of
+ * entries, see SetBulkSize()) is processed. While filters, defines, variations and actions run, the RVec helpers that
+ * create a new collection (Filter(), Take(), Sort(), Combinations(), indexing with a mask...) place the elements of
+ * their result in the arena rather than allocating them on the heap, unless they fit in the inline storage of the RVec.
+ * After a few entries the arenas are large enough for every entry and these helpers do not allocate memory anymore.
+ *
+ * The results of these helpers are only valid until the end of the entry: code that keeps an RVec across entries,
+ * e.g. the accumulator of an Aggregate() or a Reduce(), or a container filled by a Foreach(), must store a copy of it
+ * rather than the RVec itself or a moved-from result. The values of Defines and the data-block callbacks (e.g.
+ * DefinePerSample()) are handled correctly.
+ */
+void ROOT::Internal::RDF::EnableRVecArena(const ROOT::RDF::RNode &node, bool enable)
+{
+   node.GetLoopManager()->SetRVecArena(enable);
+}
+
 /**
  * \brief Trigger the execution of an RDataFrame computation graph.
  * \param[in] node A node of the computation graph (not a result).
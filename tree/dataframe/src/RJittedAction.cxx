@@ -73,6 +73,12 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, firstEntry, nEntries);
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
@@ -59,6 +59,12 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+void RJittedFilter::CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries, bool *mask)
+{
+   assert(fConcreteFilter != nullptr);
+   fConcreteFilter->CheckFiltersBulk(slot, firstEntry, nEntries, mask);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
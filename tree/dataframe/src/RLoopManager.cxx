@@ -14,22 +14,27 @@
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/RNodeProfile.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RVariationBase.hxx"
 #include "ROOT/RLogger.hxx"
+#include "ROOT/RTrace.hxx"
 #include "RtypesCore.h" // Long64_t
 #include "TStopwatch.h"
 #include "TBranchElement.h"
 #include "TBranchObject.h"
 #include "TChain.h"
 #include "TEntryList.h"
+#include "TEnv.h"
 #include "TFile.h"
 #include "TFriendElement.h"
+#include "TInterpreter.h" // gInterpreter
 #include "TROOT.h" // IsImplicitMTEnabled
 #include "TTreeReader.h"
 #include "TTree.h" // For MaxTreeSizeRAII. Revert when #6640 will be solved.
 
 #ifdef R__USE_IMT
+#include "ROOT/RRangeScheduler.hxx"
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 #include "ROOT/RSlotStack.hxx"
@@ -37,6 +42,8 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <ctime> // clock_gettime
 #include <cassert>
 #include <functional>
 #include <iostream>
@@ -54,6 +61,12 @@ using namespace ROOT::Detail::RDF;
 using namespace ROOT::Internal::RDF;
 
 namespace {
+/// With dynamic scheduling, data source ranges with fewer entries are never split between slots
+constexpr std::uint64_t kDynamicSchedulingMinSplitSize = 64;
+/// With dynamic scheduling, the number of chunks per data source range, i.e. how often a slot checks whether the
+/// remaining part of its range was handed to another slot
+constexpr ULong64_t kDynamicSchedulingChunksPerRange = 16;
+
 /// A helper function that returns all RDF code that is currently scheduled for just-in-time compilation.
 /// This allows different RLoopManager instances to share these data.
 /// We want RLoopManagers to be able to add their code to a global "code to execute via cling",
@@ -307,6 +320,50 @@ static auto MakeDatasetColReadersKey(const std::string &colName, const std::type
    //    df.Sum<RVecI>("stdVectorBranch");
    return colName + ':' + ti.name();
 }
+
+ULong64_t WallTimeNs()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+/// The CPU time consumed by the calling thread, used to profile the tasks of the event loop. Not measured on Windows.
+ULong64_t ThreadCpuTimeNs()
+{
+#ifdef _WIN32
+   return 0;
+#else
+   timespec ts;
+   if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+      return 0;
+   return ULong64_t(ts.tv_sec) * 1000000000ull + ts.tv_nsec;
+#endif
+}
+
+/// While an entry (or a block of entries) is processed, make the RVec arena of the slot, if any, the current arena of
+/// the thread, after resetting it: the RVecs placed in the arena while processing the previous entry are gone.
+/// The previous current arena is restored at the end, as a task of another slot can run nested in this one.
+class RVecArenaScope {
+   ROOT::Internal::VecOps::RVecArena *fArena;
+   ROOT::Internal::VecOps::RVecArena *fPrevious = nullptr;
+
+public:
+   explicit RVecArenaScope(ROOT::Internal::VecOps::RVecArena *arena) : fArena(arena)
+   {
+      if (fArena) {
+         fArena->Reset();
+         fPrevious = ROOT::Internal::VecOps::RVecArena::GetCurrent();
+         ROOT::Internal::VecOps::RVecArena::SetCurrent(fArena);
+      }
+   }
+   ~RVecArenaScope()
+   {
+      if (fArena)
+         ROOT::Internal::VecOps::RVecArena::SetCurrent(fPrevious);
+   }
+   RVecArenaScope(const RVecArenaScope &) = delete;
+   RVecArenaScope &operator=(const RVecArenaScope &) = delete;
+};
 } // anonymous namespace
 
 namespace ROOT {
@@ -458,10 +515,15 @@ void RLoopManager::RunEmptySourceMT()
       RCallCleanUpTask cleanup(*this, slot);
       InitNodeSlots(nullptr, slot);
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
+      R__TRACE_SPAN("rdf", "RLoopManager::ProcessRange");
       try {
          UpdateSampleInfo(slot, range);
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+         if (fActiveBulkSize > 0) {
+            RunBulk(slot, range.first, range.second);
+         } else {
+            for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+               RunAndCheckFilters(slot, currEntry);
+            }
          }
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
@@ -483,11 +545,16 @@ void RLoopManager::RunEmptySource()
    R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(
       {"an empty source", fEmptyEntryRange.first, fEmptyEntryRange.second, 0u});
    RCallCleanUpTask cleanup(*this);
+   R__TRACE_SPAN("rdf", "RLoopManager::ProcessRange");
    try {
       UpdateSampleInfo(/*slot*/ 0, fEmptyEntryRange);
-      for (ULong64_t currEntry = fEmptyEntryRange.first;
-           currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+      if (fActiveBulkSize > 0) {
+         RunBulk(0, fEmptyEntryRange.first, fEmptyEntryRange.second);
+      } else {
+         for (ULong64_t currEntry = fEmptyEntryRange.first;
+              currEntry < fEmptyEntryRange.second && fNStopsReceived < fNChildren; ++currEntry) {
+            RunAndCheckFilters(0, currEntry);
+         }
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -507,6 +574,8 @@ void RLoopManager::RunTreeProcessorMT()
                 ? std::make_unique<ROOT::TTreeProcessorMT>(*fTree, fNSlots, std::make_pair(fBeginEntry, fEndEntry))
                 : std::make_unique<ROOT::TTreeProcessorMT>(*fTree, entryList, fNSlots);
 
+   tp->SetDynamicScheduling(fDynamicScheduling);
+
    std::atomic<ULong64_t> entryCount(0ull);
 
    tp->Process([this, &slotStack, &entryCount](TTreeReader &r) -> void {
@@ -518,14 +587,11 @@ void RLoopManager::RunTreeProcessorMT()
       const auto entryRange = r.GetEntriesRange(); // we trust TTreeProcessorMT to call SetEntriesRange
       const auto nEntries = entryRange.second - entryRange.first;
       auto count = entryCount.fetch_add(nEntries);
+      R__TRACE_SPAN("rdf", "RLoopManager::ProcessRange");
       try {
          // recursive call to check filters and conditionally execute actions
-         while (r.Next()) {
-            if (fNewSampleNotifier.CheckFlag(slot)) {
-               UpdateSampleInfo(slot, r);
-            }
-            RunAndCheckFilters(slot, count++);
-         }
+         while (r.Next())
+            RunTreeEntry(slot, count++, r);
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
@@ -541,6 +607,19 @@ void RLoopManager::RunTreeProcessorMT()
 #endif // no-op otherwise (will not be called)
 }
 
+/// Process the current entry of the TTreeReader of a task, for this loop manager and the ones sharing its event loop.
+void RLoopManager::RunTreeEntry(unsigned int slot, Long64_t entry, TTreeReader &r)
+{
+   if (fNewSampleNotifier.CheckFlag(slot))
+      UpdateSampleInfo(slot, r);
+   RunAndCheckFilters(slot, entry);
+   for (auto *lm : fSharedLoops) {
+      if (lm->fNewSampleNotifier.CheckFlag(slot))
+         lm->UpdateSampleInfo(slot, r);
+      lm->RunAndCheckFilters(slot, entry);
+   }
+}
+
 /// Run event loop over one or multiple ROOT files, in sequence.
 void RLoopManager::RunTreeReader()
 {
@@ -557,16 +636,13 @@ void RLoopManager::RunTreeReader()
    RCallCleanUpTask cleanup(*this, 0u, &r);
    InitNodeSlots(&r, 0);
    R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing(TreeDatasetLogInfo(r, 0u));
+   R__TRACE_SPAN("rdf", "RLoopManager::ProcessRange");
 
    // recursive call to check filters and conditionally execute actions
    // in the non-MT case processing can be stopped early by ranges, hence the check on fNStopsReceived
    try {
-      while (r.Next() && fNStopsReceived < fNChildren) {
-         if (fNewSampleNotifier.CheckFlag(0)) {
-            UpdateSampleInfo(/*slot*/0, r);
-         }
-         RunAndCheckFilters(0, r.GetCurrentEntry());
-      }
+      while (r.Next() && fNStopsReceived < fNChildren)
+         RunTreeEntry(0u, r.GetCurrentEntry(), r);
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
       throw;
@@ -593,6 +669,11 @@ void RLoopManager::RunDataSource()
             const auto start = range.first;
             const auto end = range.second;
             R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
+            R__TRACE_SPAN("rdf", "RLoopManager::ProcessRange");
+            if (fActiveBulkSize > 0) {
+               RunBulk(0u, start, end);
+               continue;
+            }
             for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
                if (fDataSource->SetEntry(0u, entry)) {
                   RunAndCheckFilters(0u, entry);
@@ -617,33 +698,69 @@ void RLoopManager::RunDataSourceMT()
    ROOT::Internal::RSlotStack slotStack(fNSlots);
    ROOT::TThreadExecutor pool;
 
-   // Each task works on a subrange of entries
-   auto runOnRange = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
-      ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
-      const auto slot = slotRAII.fSlot;
-      InitNodeSlots(nullptr, slot);
-      RCallCleanUpTask cleanup(*this, slot);
-      fDataSource->InitSlot(slot, range.first);
-      const auto start = range.first;
-      const auto end = range.second;
+   auto processEntries = [this](unsigned int slot, ULong64_t start, ULong64_t end) {
       R__LOG_DEBUG(0, RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
+      R__TRACE_SPAN("rdf", "RLoopManager::ProcessRange");
       try {
-         for (auto entry = start; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+         if (fActiveBulkSize > 0) {
+            RunBulk(slot, start, end);
+         } else {
+            for (auto entry = start; entry < end; ++entry) {
+               if (fDataSource->SetEntry(slot, entry)) {
+                  RunAndCheckFilters(slot, entry);
+               }
             }
          }
       } catch (...) {
          std::cerr << "RDataFrame::Run: event loop was interrupted\n";
          throw;
       }
+   };
+
+   // Each task works on a subrange of entries
+   auto runOnRange = [this, &slotStack, &processEntries](const std::pair<ULong64_t, ULong64_t> &range) {
+      ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
+      const auto slot = slotRAII.fSlot;
+      InitNodeSlots(nullptr, slot);
+      RCallCleanUpTask cleanup(*this, slot);
+      fDataSource->InitSlot(slot, range.first);
+      processEntries(slot, range.first, range.second);
       fDataSource->FinalizeSlot(slot);
    };
 
+   // With dynamic scheduling, there is one task per slot that processes ranges chunk by chunk until the scheduler
+   // runs out of work, splitting the ranges of the other slots if no range is pending anymore.
+   std::unique_ptr<ROOT::Internal::RRangeScheduler> scheduler;
+   auto runScheduledRanges = [this, &slotStack, &processEntries, &scheduler]() {
+      ROOT::Internal::RSlotStackRAII slotRAII(slotStack);
+      const auto slot = slotRAII.fSlot;
+      std::size_t tag = 0;
+      std::uint64_t begin = 0;
+      ROOT::Internal::RRangeScheduler::Range_t chunk;
+      while (scheduler->AcquireRange(slot, tag, begin)) {
+         InitNodeSlots(nullptr, slot);
+         RCallCleanUpTask cleanup(*this, slot);
+         fDataSource->InitSlot(slot, begin);
+         while (scheduler->GetNextChunk(slot, chunk))
+            processEntries(slot, chunk.first, chunk.second);
+         fDataSource->FinalizeSlot(slot);
+      }
+   };
+
    fDataSource->Initialize();
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty()) {
-      pool.Foreach(runOnRange, ranges);
+      if (fDynamicScheduling) {
+         scheduler = std::make_unique<ROOT::Internal::RRangeScheduler>(fNSlots, kDynamicSchedulingMinSplitSize);
+         for (const auto &range : ranges) {
+            const auto chunkSize =
+               std::max<ULong64_t>((range.second - range.first) / kDynamicSchedulingChunksPerRange, 1);
+            scheduler->AddTask({{range.first, range.second}, {}, chunkSize, 0});
+         }
+         pool.Foreach(runScheduledRanges, fNSlots);
+      } else {
+         pool.Foreach(runOnRange, ranges);
+      }
       ranges = fDataSource->GetEntryRanges();
    }
    fDataSource->Finalize();
@@ -654,6 +771,9 @@ void RLoopManager::RunDataSourceMT()
 /// Named filters must be called even if the analysis logic would not require it, lest they report confusing results.
 void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
 {
+   if (fLoopProfile)
+      fLoopProfile->Add(slot, 1, 0);
+
    // data-block callbacks run before the rest of the graph
    if (fNewSampleNotifier.CheckFlag(slot)) {
       for (auto &callback : fSampleCallbacks)
@@ -661,6 +781,9 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       fNewSampleNotifier.UnsetFlag(slot);
    }
 
+   // the values computed by the data-block callbacks above (e.g. by DefinePerSample) outlive the entry: only the rest
+   // of the graph uses the RVec arena
+   RVecArenaScope arenaScope(fRVecArenas.empty() ? nullptr : fRVecArenas[slot].get());
    for (auto *actionPtr : fBookedActions)
       actionPtr->Run(slot, entry);
    for (auto *namedFilterPtr : fBookedNamedFilters)
@@ -669,12 +792,80 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Process the entries [begin, end) in blocks of fActiveBulkSize entries.
+/// For data sources, RDataSource::SetEntry() is called for all the entries of a block before the block is processed,
+/// which requires column readers that can address any entry (see RDataSource::GetColumnReaders()).
+void RLoopManager::RunBulk(unsigned int slot, ULong64_t begin, ULong64_t end)
+{
+   auto &block = fBulkBlocks[slot];
+   for (auto firstEntry = begin; firstEntry < end; firstEntry += fActiveBulkSize) {
+      const std::size_t nEntries = std::min<ULong64_t>(fActiveBulkSize, end - firstEntry);
+      std::size_t nSelected = 0;
+      for (std::size_t i = 0; i < nEntries; ++i) {
+         block.fMask[i] = fDataSource ? fDataSource->SetEntry(slot, firstEntry + i) : true;
+         nSelected += block.fMask[i];
+      }
+      block.fFirstEntry = firstEntry;
+      block.fNEntries = nEntries;
+      if (nSelected > 0)
+         RunAndCheckFiltersBulk(slot, firstEntry, nEntries, nSelected);
+   }
+   block.fFirstEntry = -1;
+   block.fNEntries = 0;
+}
+
+/// Bulk version of RunAndCheckFilters(): execute actions and named filters for a block of `nEntries` entries,
+/// `nSelected` of which have been accepted by the data source.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries,
+                                          std::size_t nSelected)
+{
+   if (fLoopProfile)
+      fLoopProfile->Add(slot, nSelected, 0);
+
+   // data-block callbacks run before the rest of the graph
+   if (fNewSampleNotifier.CheckFlag(slot)) {
+      for (auto &callback : fSampleCallbacks)
+         callback.second(slot, fSampleInfos[slot]);
+      fNewSampleNotifier.UnsetFlag(slot);
+   }
+
+   RVecArenaScope arenaScope(fRVecArenas.empty() ? nullptr : fRVecArenas[slot].get());
+   for (auto *actionPtr : fBookedActions)
+      actionPtr->RunBulk(slot, firstEntry, nEntries);
+   if (!fBookedNamedFilters.empty()) {
+      auto scratch = fBulkScratch[slot].fMask.get();
+      for (auto *namedFilterPtr : fBookedNamedFilters)
+         namedFilterPtr->CheckFiltersBulk(slot, firstEntry, nEntries, scratch);
+   }
+   for (std::size_t i = 0; i < nSelected; ++i) {
+      for (auto &callback : fCallbacks)
+         callback(slot);
+   }
+}
+
+/// Whether the next event loop can process entries in blocks of fBulkSize entries.
+/// Ranges need to see the entries one by one in order to stop the event loop early, and TTree-based loops as well as
+/// value-pointer data source readers only expose the values of the entry that was loaded last.
+bool RLoopManager::CanRunBulk() const
+{
+   if (fBulkSize < 2 || !fBookedRanges.empty() || fHasValuePtrColumnReaders)
+      return false;
+   return fLoopType == ELoopType::kNoFiles || fLoopType == ELoopType::kNoFilesMT ||
+          fLoopType == ELoopType::kDataSource || fLoopType == ELoopType::kDataSourceMT;
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
 void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 {
+   if (fLoopProfile)
+      fTaskStartTimes[slot] = {WallTimeNs(), ThreadCpuTimeNs()};
    SetupSampleCallbacks(r, slot);
+   if (fActiveBulkSize > 0) {
+      fBulkBlocks[slot].Reset(fActiveBulkSize);
+      fBulkScratch[slot].Reset(fActiveBulkSize);
+   }
    for (auto *ptr : fBookedActions)
       ptr->InitSlot(r, slot);
    for (auto *ptr : fBookedFilters)
@@ -686,6 +877,19 @@ void RLoopManager::InitNodeSlots(TTreeReader *r, unsigned int slot)
 
    for (auto &callback : fCallbacksOnce)
       callback(slot);
+
+   if (r != nullptr && fSparseColumnReading) {
+      // the nodes have created their column readers: tell the TTreeReader which branches it should not prefetch
+      for (const auto &colAndIsSparse : fTreeColumnIsSparse[slot]) {
+         if (colAndIsSparse.second)
+            r->AddSparseBranch(colAndIsSparse.first);
+      }
+      fTreeColumnIsSparse[slot].clear();
+   }
+
+   // the nodes of the graphs sharing the event loop create their column readers on the same TTreeReader
+   for (auto *lm : fSharedLoops)
+      lm->InitNodeSlots(r, slot);
 }
 
 void RLoopManager::SetupSampleCallbacks(TTreeReader *r, unsigned int slot) {
@@ -782,6 +986,64 @@ void RLoopManager::CleanUpTask(TTreeReader *r, unsigned int slot)
       for (auto &v : fDatasetColumnReaders[slot])
          v.second.reset();
    }
+
+   if (fLoopProfile) {
+      const auto &start = fTaskStartTimes[slot];
+      fLoopProfile->Add(slot, 0, WallTimeNs() - start.first, ThreadCpuTimeNs() - start.second);
+   }
+
+   for (auto *lm : fSharedLoops)
+      lm->CleanUpTask(r, slot);
+}
+
+/// Give a fresh profile to all the nodes that take part in the next event loop if profiling is enabled, or remove
+/// their profiles otherwise, so that profiles always describe the last event loop a node took part in.
+/// Data source column readers outlive the event loop: they are wrapped in (or unwrapped from) a
+/// RProfiledColumnReader here, while TTree column readers are wrapped as they are created by the tasks.
+void RLoopManager::InitProfiles()
+{
+   auto makeProfile = [this] { return fProfiling ? std::make_unique<RDFInternal::RNodeProfile>(fNSlots) : nullptr; };
+   for (auto *ptr : fBookedActions)
+      ptr->SetProfile(makeProfile());
+   for (auto *ptr : fBookedFilters)
+      ptr->SetProfile(makeProfile());
+   for (auto *ptr : fBookedDefines)
+      ptr->SetProfile(makeProfile());
+   for (auto *ptr : fBookedVariations)
+      ptr->SetProfile(makeProfile());
+
+   fLoopProfile = makeProfile();
+   fTaskStartTimes.assign(fProfiling ? fNSlots : 0u, {0ull, 0ull});
+   fProfiledBytesRead = 0;
+   for (auto &colAndProfile : fColumnReaderProfiles)
+      *colAndProfile.second = RDFInternal::RNodeProfile(fNSlots);
+
+   if (!fDataSource)
+      return;
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      for (auto &keyAndReader : fDatasetColumnReaders[slot]) {
+         auto &reader = keyAndReader.second;
+         auto *profiledReader = dynamic_cast<RDFInternal::RProfiledColumnReader *>(reader.get());
+         if (fProfiling && profiledReader == nullptr) {
+            const auto &key = keyAndReader.first;
+            auto &profile = GetColumnReaderProfile(key.substr(0, key.rfind(':')));
+            reader = std::make_unique<RDFInternal::RProfiledColumnReader>(std::move(reader), profile, slot);
+         } else if (!fProfiling && profiledReader != nullptr) {
+            reader = profiledReader->ReleaseReader();
+         }
+      }
+   }
+}
+
+/// Return the profile shared by all the readers of the given dataset column, creating it if needed.
+/// Can be called from multiple threads concurrently.
+RDFInternal::RNodeProfile &RLoopManager::GetColumnReaderProfile(const std::string &col)
+{
+   std::lock_guard<std::mutex> lock(fColumnReaderProfilesMutex);
+   auto &profile = fColumnReaderProfiles[col];
+   if (!profile)
+      profile = std::make_unique<RDFInternal::RNodeProfile>(fNSlots);
+   return *profile;
 }
 
 /// Add RDF nodes that require just-in-time compilation to the computation graph.
@@ -797,9 +1059,13 @@ void RLoopManager::Jit()
       return;
    }
 
+   R__TRACE_SPAN("rdf", "RLoopManager::Jit");
    TStopwatch s;
    s.Start();
-   RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   if (!RDFInternal::InterpreterCalcCached(code))
+      RDFInternal::InterpreterCalc(code, "RLoopManager::Run");
+   // the memory used temporarily by the compilation is not needed during the event loop
+   gInterpreter->ReleaseMemory();
    s.Stop();
    R__LOG_INFO(RDFLogChannel()) << "Just-in-time compilation phase completed"
                                 << (s.RealTime() > 1e-3 ? " in " + std::to_string(s.RealTime()) + " seconds."
@@ -835,10 +1101,13 @@ void RLoopManager::Run(bool jit)
    if (jit)
       Jit();
 
-   InitNodes();
+   PrepareRun();
+   for (auto *lm : fSharedLoops)
+      lm->PrepareRun();
 
    TStopwatch s;
    s.Start();
+   const auto bytesReadBefore = TFile::GetFileBytesRead();
    switch (fLoopType) {
    case ELoopType::kNoFilesMT: RunEmptySourceMT(); break;
    case ELoopType::kROOTFilesMT: RunTreeProcessorMT(); break;
@@ -848,15 +1117,112 @@ void RLoopManager::Run(bool jit)
    case ELoopType::kDataSource: RunDataSource(); break;
    }
    s.Stop();
+   if (fLoopProfile)
+      fProfiledBytesRead = TFile::GetFileBytesRead() - bytesReadBefore;
 
-   CleanUpNodes();
-
-   fNRuns++;
+   FinishRun();
+   for (auto *lm : fSharedLoops)
+      lm->FinishRun();
 
    R__LOG_INFO(RDFLogChannel()) << "Finished event loop number " << fNRuns - 1 << " (" << s.CpuTime() << "s CPU, "
                                 << s.RealTime() << "s elapsed).";
 }
 
+/// Run the event loop of this loop manager, which also runs the computation graphs of the given loop managers.
+/// The dataset is read once for all the graphs: the nodes of all of them get their column readers from the
+/// TTreeReader of each task, which shares the branch proxies of the columns requested by several graphs.
+/// All the loop managers must be able to share the event loop of this one, see CanShareEventLoop().
+void RLoopManager::RunShared(const std::vector<RLoopManager *> &others, bool jit)
+{
+   for (auto *lm : others) {
+      if (!CanShareEventLoop(*lm))
+         throw std::logic_error("RLoopManager::RunShared: the computation graphs cannot share the event loop.");
+   }
+   R__LOG_INFO(RDFLogChannel()) << "Running " << others.size()
+                                << " other computation graphs in the event loop number " << fNRuns << '.';
+
+   struct RestoreSharedLoops {
+      std::vector<RLoopManager *> &fLoops;
+      ~RestoreSharedLoops() { fLoops.clear(); }
+   } restore{fSharedLoops};
+   fSharedLoops = others;
+   Run(jit);
+}
+
+/// Return whether the computation graph of `other` can be run by the event loop of this loop manager, see RunShared().
+/// This is the case if both loop managers read the same trees from the same files, in the same entry range and
+/// without friends, entry lists or samples, and if none of them is profiled or has ranges, which can stop the
+/// event loop early. Sparse column reading is not supported either, as it is decided per loop manager.
+bool RLoopManager::CanShareEventLoop(const RLoopManager &other) const
+{
+   if (&other == this || other.fLoopType != fLoopType || other.fNSlots != fNSlots)
+      return false;
+   if (fLoopType != ELoopType::kROOTFiles && fLoopType != ELoopType::kROOTFilesMT)
+      return false;
+   // without any booked action the serial event loop would stop immediately
+   if (fBookedActions.empty() || other.fBookedActions.empty())
+      return false;
+   if (!fBookedRanges.empty() || !other.fBookedRanges.empty() || fProfiling || other.fProfiling)
+      return false;
+   if (gEnv->GetValue("RDataFrame.SparseColumnReading", 0) != 0)
+      return false;
+   if (fBeginEntry != other.fBeginEntry || fEndEntry != other.fEndEntry)
+      return false;
+   if (!fSampleMap.empty() || !other.fSampleMap.empty())
+      return false;
+
+   auto hasFriendsOrEntryList = [](TTree &t) {
+      return t.GetEntryList() != nullptr || (t.GetListOfFriends() && t.GetListOfFriends()->GetEntries() > 0);
+   };
+   if (!fTree || !other.fTree || hasFriendsOrEntryList(*fTree) || hasFriendsOrEntryList(*other.fTree))
+      return false;
+   if (fTree == other.fTree)
+      return true;
+   try {
+      return ROOT::Internal::TreeUtils::GetTreeFullPaths(*fTree) ==
+                ROOT::Internal::TreeUtils::GetTreeFullPaths(*other.fTree) &&
+             ROOT::Internal::TreeUtils::GetFileNamesFromTree(*fTree) ==
+                ROOT::Internal::TreeUtils::GetFileNamesFromTree(*other.fTree);
+   } catch (const std::runtime_error &) {
+      // e.g. in-memory trees, which are only shared if they are the same object
+      return false;
+   }
+}
+
+/// Set up the nodes and the per-slot state of the loop manager before an event loop in which its graph takes part.
+void RLoopManager::PrepareRun()
+{
+   InitProfiles();
+
+   fActiveBulkSize = CanRunBulk() ? fBulkSize : 0;
+   if (fActiveBulkSize > 0) {
+      fBulkBlocks.resize(fNSlots);
+      fBulkScratch.resize(fNSlots);
+   }
+   fSparseColumnReading = gEnv->GetValue("RDataFrame.SparseColumnReading", 0) != 0 && !fBookedFilters.empty();
+   if (fSparseColumnReading)
+      fTreeColumnIsSparse.resize(fNSlots);
+   fDynamicScheduling = gEnv->GetValue("RDataFrame.DynamicScheduling", 0) != 0;
+   if (!fUseRVecArena) {
+      fRVecArenas.clear();
+   } else if (fRVecArenas.size() != fNSlots) {
+      fRVecArenas.resize(fNSlots);
+      for (auto &arena : fRVecArenas)
+         arena = std::make_unique<ROOT::Internal::VecOps::RVecArena>();
+   }
+
+   InitNodes();
+}
+
+/// Clean up the nodes of the loop manager after an event loop in which its graph took part.
+void RLoopManager::FinishRun()
+{
+   CleanUpNodes();
+   fActiveBulkSize = 0;
+
+   fNRuns++;
+}
+
 /// Return the list of default columns -- empty if none was provided when constructing the RDataFrame
 const ColumnNames_t &RLoopManager::GetDefaultColumnNames() const
 {
@@ -933,6 +1299,14 @@ bool RLoopManager::CheckFilters(unsigned int, Long64_t)
    return true;
 }
 
+// end of recursive chain of calls: the entries of the block that were accepted by the data source pass
+void RLoopManager::CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t nEntries, bool *mask)
+{
+   const auto &block = fBulkBlocks[slot];
+   R__ASSERT(block.Holds(firstEntry, nEntries));
+   std::copy(block.fMask.get(), block.fMask.get() + nEntries, mask);
+}
+
 /// Call `FillReport` on all booked filters
 void RLoopManager::Report(ROOT::RDF::RCutFlowReport &rep) const
 {
@@ -1007,6 +1381,7 @@ std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RLoopManager::GetG
    }
    auto thisNode = std::make_shared<ROOT::Internal::RDF::GraphDrawing::GraphNode>(
       name, visitedMap.size(), ROOT::Internal::RDF::GraphDrawing::ENodeType::kRoot);
+   thisNode->SetProfile(fLoopProfile.get());
    visitedMap[(void *)this] = thisNode;
    return thisNode;
 }
@@ -1056,6 +1431,8 @@ RColumnReaderBase *RLoopManager::AddTreeColumnReader(unsigned int slot, const st
    const auto key = MakeDatasetColReadersKey(col, ti);
    // if a reader for this column and this slot was already there, we are doing something wrong
    assert(readers.find(key) == readers.end() || readers[key] == nullptr);
+   if (fLoopProfile)
+      reader = std::make_unique<RDFInternal::RProfiledColumnReader>(std::move(reader), GetColumnReaderProfile(col), slot);
    auto *rptr = reader.get();
    readers[key] = std::move(reader);
    return rptr;
@@ -1072,6 +1449,35 @@ RLoopManager::GetDatasetColumnReader(unsigned int slot, const std::string &col,
       return nullptr;
 }
 
+/// Record that a node reads the TTree column `col` in the given slot. If all the nodes that read a column are behind
+/// some filter, the column is expected to be read only for a fraction of the entries: the corresponding branch is
+/// then excluded from the TTreeCache prefetching and read on demand (see TTreeReader::AddSparseBranch()).
+void RLoopManager::AddTreeColumnUsage(unsigned int slot, const std::string &col, bool isBehindFilter)
+{
+   if (!fSparseColumnReading)
+      return;
+   auto it = fTreeColumnIsSparse[slot].emplace(col, isBehindFilter).first;
+   it->second = it->second && isBehindFilter;
+}
+
+/// \brief Return the jitted Define booked with the given key, or nullptr if there is none or its node was destroyed.
+/// See BookDefineJit() for how the key is built.
+std::shared_ptr<RJittedDefine> RLoopManager::GetJittedDefine(const std::string &key)
+{
+   auto it = fJittedDefines.find(key);
+   if (it == fJittedDefines.end())
+      return nullptr;
+   auto define = it->second.lock();
+   if (!define)
+      fJittedDefines.erase(it);
+   return define;
+}
+
+void RLoopManager::AddJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define)
+{
+   fJittedDefines[key] = define;
+}
+
 void RLoopManager::AddSampleCallback(void *nodePtr, SampleCallback_t &&callback)
 {
    if (callback)
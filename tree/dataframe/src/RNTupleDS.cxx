@@ -25,6 +25,9 @@
 
 #include <TError.h>
 
+#include <algorithm>
+#include <future>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <typeinfo>
@@ -117,6 +120,8 @@ class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<RFieldBase> fField; ///< The field backing the RDF column
    RFieldBase::RValue fValue;          ///< The memory location used to read from fField
    Long64_t fLastEntry;                ///< Last entry number that was read
+   /// For chains, the global entry number of the first entry of the connected page source
+   Long64_t fEntryOffset = 0;
 
 public:
    RNTupleColumnReader(std::unique_ptr<RFieldBase> f)
@@ -131,18 +136,31 @@ public:
       return std::make_unique<RNTupleColumnReader>(fField->Clone(fField->GetName()));
    }
 
-   /// Connect the field and its subfields to the page source
-   void Connect(RPageSource &source)
+   /// Connect the field and its subfields to the page source. The entry numbers passed to GetImpl() are shifted
+   /// by entryOffset.
+   void Connect(RPageSource &source, Long64_t entryOffset = 0)
    {
+      fEntryOffset = entryOffset;
       fField->ConnectPageSource(source);
       for (auto &f : *fField)
          f.ConnectPageSource(source);
    }
 
+   /// For chains, replace the field by a clone of the field of the prototype, which belongs to another file, and
+   /// connect it to the page source of that file. The page source of the previous field must still be alive.
+   void Reconnect(const RNTupleColumnReader &prototype, RPageSource &source, Long64_t entryOffset)
+   {
+      auto field = prototype.fField->Clone(prototype.fField->GetName());
+      fValue = field->GenerateValue();
+      fField = std::move(field);
+      fLastEntry = -1;
+      Connect(source, entryOffset);
+   }
+
    void *GetImpl(Long64_t entry) final
    {
       if (entry != fLastEntry) {
-         fValue.Read(entry);
+         fValue.Read(entry - fEntryOffset);
          fLastEntry = entry;
       }
       return fValue.GetRawPtr();
@@ -276,6 +294,82 @@ RNTupleDS::RNTupleDS(std::unique_ptr<Detail::RPageSource> pageSource)
    AddField(descriptorGuard.GetRef(), "", descriptorGuard->GetFieldZeroId(), std::vector<DescriptorId_t>());
 }
 
+RNTupleDS::RNTupleDS(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+   : RNTupleDS(Detail::RPageSource::Create(ntupleName, fileNames.empty() ? std::string_view() : fileNames[0]))
+{
+   fNTupleName = std::string(ntupleName);
+   fFileNames = fileNames;
+}
+
+std::unique_ptr<RNTupleDS> RNTupleDS::StageFile(std::string ntupleName, std::string fileName, unsigned int nSlots,
+                                                std::vector<std::string> columns, std::size_t prefetchMemoryBudget)
+{
+   auto file = std::make_unique<RNTupleDS>(Detail::RPageSource::Create(ntupleName, fileName));
+   file->SetNSlots(nSlots);
+
+   std::uint64_t firstClusterSize = 0;
+   {
+      auto descriptorGuard = file->fSources[0]->GetSharedDescriptorGuard();
+      for (const auto &cluster : descriptorGuard->GetClusterIterable()) {
+         if (cluster.GetFirstEntryIndex() == 0 && cluster.GetNEntries() > 0) {
+            firstClusterSize = cluster.GetBytesOnStorage();
+            break;
+         }
+      }
+   }
+   // The size of the entire cluster serves as an upper bound for the size of the columns in use
+   if (columns.empty() || firstClusterSize == 0 || firstClusterSize > prefetchMemoryBudget)
+      return file;
+
+   // Connect all the column readers before reading the first entry, so that the cluster pool of slot 0 loads the
+   // pages of all the columns in use with the first request. The loaded cluster remains in the pool after the
+   // column readers are destructed.
+   std::vector<std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>> columnReaders;
+   for (const auto &name : columns) {
+      if (file->HasColumn(name))
+         columnReaders.emplace_back(file->GetColumnReaders(0, name, typeid(void)));
+   }
+   for (auto &reader : columnReaders)
+      static_cast<Internal::RNTupleColumnReader &>(*reader).GetImpl(0);
+   return file;
+}
+
+void RNTupleDS::StageNextFile()
+{
+   const auto nextFileIndex = fCurrentFileIndex + 1;
+   if (nextFileIndex >= fFileNames.size() || fStagedFile.valid())
+      return;
+
+   std::vector<std::string> columns;
+   {
+      std::lock_guard<std::mutex> guard(fRequestedColumnsLock);
+      columns = fRequestedColumns;
+   }
+   fStagedFile = std::async(std::launch::async, StageFile, fNTupleName, fFileNames[nextFileIndex], fNSlots,
+                            std::move(columns), fPrefetchMemoryBudget);
+}
+
+void RNTupleDS::SwitchToFile(std::unique_ptr<RNTupleDS> file, std::size_t fileIndex)
+{
+   if (file->fColumnNames != fColumnNames || file->fColumnTypes != fColumnTypes) {
+      throw RException(R__FAIL("RNTuple '" + fNTupleName + "' in file " + fFileNames[fileIndex] +
+                               " does not provide the same columns as the first file of the chain"));
+   }
+   // RDataFrame keeps the column readers that it received at booking time for all its event loops, so they have
+   // to be moved over to the new file. The old page sources are only released after the readers are reconnected.
+   auto sources = std::move(file->fSources);
+   {
+      std::lock_guard<std::mutex> guard(fRequestedColumnsLock);
+      for (const auto &active : fActiveColumnReaders) {
+         active.fReader->Reconnect(*file->fColumnReaderPrototypes[active.fColumnIndex], *sources[active.fSlot],
+                                   fCurrentFileEntryOffset);
+      }
+   }
+   fSources = std::move(sources);
+   fColumnReaderPrototypes = std::move(file->fColumnReaderPrototypes);
+   fCurrentFileIndex = fileIndex;
+}
+
 RDF::RDataSource::Record_t RNTupleDS::GetColumnReadersImpl(std::string_view /* name */, const std::type_info & /* ti */)
 {
    // This datasource uses the GetColumnReaders2 API instead (better name in the works)
@@ -289,7 +383,13 @@ RNTupleDS::GetColumnReaders(unsigned int slot, std::string_view name, const std:
    // TODO(jblomer): check incoming type
    const auto index = std::distance(fColumnNames.begin(), std::find(fColumnNames.begin(), fColumnNames.end(), name));
    auto clone = fColumnReaderPrototypes[index]->Clone();
-   clone->Connect(*fSources[slot]);
+   clone->Connect(*fSources[slot], fCurrentFileEntryOffset);
+   if (!fFileNames.empty()) {
+      std::lock_guard<std::mutex> guard(fRequestedColumnsLock);
+      fActiveColumnReaders.push_back({slot, static_cast<std::size_t>(index), clone.get()});
+      if (std::find(fRequestedColumns.begin(), fRequestedColumns.end(), name) == fRequestedColumns.end())
+         fRequestedColumns.emplace_back(name);
+   }
    return clone;
 }
 
@@ -302,14 +402,31 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
    // TODO(jblomer): use cluster boundaries for the entry ranges
    std::vector<std::pair<ULong64_t, ULong64_t>> ranges;
-   if (fHasSeenAllRanges)
-      return ranges;
+   ULong64_t nEntries = 0;
+   while (nEntries == 0) {
+      if (fHasSeenAllRanges) {
+         // For chains, move on to the next file. All the tasks of the previous file are done, so the column readers
+         // can be reconnected to the page sources of the next file (see SwitchToFile()).
+         if (fCurrentFileIndex + 1 >= fFileNames.size())
+            return ranges;
+         fCurrentFileEntryOffset += fSources[0]->GetNEntries();
+         StageNextFile();
+         SwitchToFile(fStagedFile.get(), fCurrentFileIndex + 1);
+         fHasSeenAllRanges = false;
+      }
+
+      nEntries = fSources[0]->GetNEntries();
+      fHasSeenAllRanges = true;
+      // Open the next file while the current one is processed
+      StageNextFile();
+      if (nEntries == 0 && fFileNames.empty())
+         break;
+   }
 
-   auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
-   auto start = 0UL;
-   auto end = 0UL;
+   auto start = fCurrentFileEntryOffset;
+   auto end = fCurrentFileEntryOffset;
    for (auto i : ROOT::TSeqU(fNSlots)) {
       start = end;
       end += chunkSize;
@@ -317,7 +434,6 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
       (void)i;
    }
    ranges.back().second += reminder;
-   fHasSeenAllRanges = true;
    return ranges;
 }
 
@@ -335,6 +451,13 @@ bool RNTupleDS::HasColumn(std::string_view colName) const
 void RNTupleDS::Initialize()
 {
    fHasSeenAllRanges = false;
+   fCurrentFileEntryOffset = 0;
+   if (fCurrentFileIndex != 0) {
+      // A previous event loop processed the chain; start again from the first file
+      if (fStagedFile.valid())
+         fStagedFile.get();
+      SwitchToFile(StageFile(fNTupleName, fFileNames[0], fNSlots, {}, 0), 0);
+   }
 }
 
 void RNTupleDS::Finalize() {}
@@ -361,6 +484,13 @@ ROOT::RDataFrame ROOT::RDF::Experimental::FromRNTuple(std::string_view ntupleNam
    return rdf;
 }
 
+ROOT::RDataFrame
+ROOT::RDF::Experimental::FromRNTuple(std::string_view ntupleName, const std::vector<std::string> &fileNames)
+{
+   ROOT::RDataFrame rdf(std::make_unique<ROOT::Experimental::RNTupleDS>(ntupleName, fileNames));
+   return rdf;
+}
+
 ROOT::RDataFrame ROOT::RDF::Experimental::FromRNTuple(ROOT::Experimental::RNTuple *ntuple)
 {
    ROOT::RDataFrame rdf(std::make_unique<ROOT::Experimental::RNTupleDS>(ntuple->MakePageSource()));
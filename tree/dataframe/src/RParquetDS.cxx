@@ -0,0 +1,525 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// clang-format off
+/** \class ROOT::RDF::RParquetDS
+    \ingroup dataframe
+    \brief RDataFrame data source class for reading Apache Parquet files.
+
+The RParquetDS reads Parquet files through the Arrow C++ library. A RDataFrame that reads a Parquet file can be
+constructed using the factory method ROOT::RDF::FromParquet, which accepts three parameters:
+1. The path or URL of the file. Any protocol supported by ROOT::Internal::RRawFile can be used, e.g. local files,
+   `http(s)://` or `root(s)://`.
+2. The names of the columns to expose (optional, default is all the columns of the file).
+3. A filter expression (optional), see below.
+
+The supported column types are the ones of RArrowDS: 32 and 64 bit (un)signed integers, float, double, bool,
+strings and lists of numbers, which are exposed as RVecs.
+
+Every row group of the file is processed by one task, in parallel if implicit multi-threading is enabled. Only the
+columns that are used in the computation graph are read and decompressed.
+
+The filter expression is a conjunction (`&&`) of comparisons between a column and a number, e.g.
+`"pt > 20 && abs_eta <= 2.4"`. Only the entries that satisfy it are processed. The minimum and maximum values of the
+columns recorded in the row group statistics are used to skip the row groups in which no entry can satisfy it: such
+row groups are not read at all.
+*/
+// clang-format on
+
+#include <ROOT/RDF/Utils.hxx>
+#include <ROOT/RParquetDS.hxx>
+#include <ROOT/RRawFile.hxx>
+
+#include "RArrowUtils.hxx"
+
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <regex>
+#include <string>
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include <arrow/buffer.h>
+#include <arrow/io/interfaces.h>
+#include <arrow/memory_pool.h>
+#include <parquet/arrow/reader.h>
+#include <parquet/arrow/schema.h>
+#include <parquet/file_reader.h>
+#include <parquet/metadata.h>
+#include <parquet/statistics.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace {
+
+using ROOT::Internal::RDF::RParquetPredicate;
+
+void ThrowIfError(const arrow::Status &status, const std::string &what)
+{
+   if (status.ok() == false)
+      throw std::runtime_error("RParquetDS: " + what + ": " + status.ToString());
+}
+
+/// Expose a RRawFile as an Arrow file, so that Parquet files can be read with any of the protocols of RRawFile.
+class RRawFileArrowAdapter final : public arrow::io::RandomAccessFile {
+   std::unique_ptr<ROOT::Internal::RRawFile> fFile;
+   bool fClosed = false;
+
+   template <typename F>
+   static auto Guard(F &&f) -> decltype(f())
+   {
+      // RRawFile reports errors with exceptions, the Parquet reader expects statuses
+      try {
+         return f();
+      } catch (const std::exception &e) {
+         return arrow::Status::IOError(e.what());
+      }
+   }
+
+public:
+   explicit RRawFileArrowAdapter(std::unique_ptr<ROOT::Internal::RRawFile> file) : fFile(std::move(file)) {}
+
+   arrow::Status Close() override
+   {
+      fClosed = true;
+      return arrow::Status::OK();
+   }
+   bool closed() const override { return fClosed; }
+   arrow::Result<int64_t> Tell() const override { return static_cast<int64_t>(fFile->GetFilePos()); }
+   arrow::Status Seek(int64_t position) override
+   {
+      fFile->Seek(position);
+      return arrow::Status::OK();
+   }
+   arrow::Result<int64_t> GetSize() override
+   {
+      return Guard([this]() -> arrow::Result<int64_t> { return static_cast<int64_t>(fFile->GetSize()); });
+   }
+   arrow::Result<int64_t> Read(int64_t nbytes, void *out) override
+   {
+      return Guard([&]() -> arrow::Result<int64_t> { return static_cast<int64_t>(fFile->Read(out, nbytes)); });
+   }
+   arrow::Result<std::shared_ptr<arrow::Buffer>> Read(int64_t nbytes) override
+   {
+      auto result = ReadAt(static_cast<int64_t>(fFile->GetFilePos()), nbytes);
+      if (result.ok())
+         fFile->Seek(fFile->GetFilePos() + (*result)->size());
+      return result;
+   }
+   arrow::Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void *out) override
+   {
+      return Guard(
+         [&]() -> arrow::Result<int64_t> { return static_cast<int64_t>(fFile->ReadAt(out, nbytes, position)); });
+   }
+   arrow::Result<std::shared_ptr<arrow::Buffer>> ReadAt(int64_t position, int64_t nbytes) override
+   {
+      return Guard([&]() -> arrow::Result<std::shared_ptr<arrow::Buffer>> {
+         ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateResizableBuffer(nbytes));
+         const auto nread = fFile->ReadAt(buffer->mutable_data(), nbytes, position);
+         ARROW_RETURN_NOT_OK(buffer->Resize(nread));
+         return std::shared_ptr<arrow::Buffer>(std::move(buffer));
+      });
+   }
+};
+
+std::unique_ptr<parquet::arrow::FileReader>
+OpenFile(const ROOT::Internal::RRawFile &file, std::shared_ptr<parquet::FileMetaData> metaData)
+{
+   auto arrowFile = std::make_shared<RRawFileArrowAdapter>(file.Clone());
+   auto parquetReader =
+      parquet::ParquetFileReader::Open(std::move(arrowFile), parquet::default_reader_properties(), std::move(metaData));
+   std::unique_ptr<parquet::arrow::FileReader> reader;
+   ThrowIfError(parquet::arrow::FileReader::Make(arrow::default_memory_pool(), std::move(parquetReader), &reader),
+                "cannot open " + file.GetUrl());
+   return reader;
+}
+
+void CollectLeaves(const parquet::arrow::SchemaField &field, std::vector<int> &leaves)
+{
+   if (field.is_leaf())
+      leaves.push_back(field.column_index);
+   for (const auto &child : field.children)
+      CollectLeaves(child, leaves);
+}
+
+bool IsNumeric(arrow::Type::type type)
+{
+   switch (type) {
+   case arrow::Type::INT32:
+   case arrow::Type::INT64:
+   case arrow::Type::UINT32:
+   case arrow::Type::UINT64:
+   case arrow::Type::FLOAT:
+   case arrow::Type::DOUBLE: return true;
+   default: return false;
+   }
+}
+
+double ValueAsDouble(const void *value, arrow::Type::type type)
+{
+   switch (type) {
+   case arrow::Type::INT32: return *static_cast<const int32_t *>(value);
+   case arrow::Type::INT64: return *static_cast<const int64_t *>(value);
+   case arrow::Type::UINT32: return *static_cast<const uint32_t *>(value);
+   case arrow::Type::UINT64: return *static_cast<const uint64_t *>(value);
+   case arrow::Type::FLOAT: return *static_cast<const float *>(value);
+   case arrow::Type::DOUBLE: return *static_cast<const double *>(value);
+   default: assert(false && "Unexpected column type in the filter of RParquetDS."); return 0.;
+   }
+}
+
+bool Passes(const RParquetPredicate &predicate, double value)
+{
+   using EOp = RParquetPredicate::EOp;
+   switch (predicate.fOp) {
+   case EOp::kEq: return value == predicate.fValue;
+   case EOp::kNe: return value != predicate.fValue;
+   case EOp::kLt: return value < predicate.fValue;
+   case EOp::kLe: return value <= predicate.fValue;
+   case EOp::kGt: return value > predicate.fValue;
+   case EOp::kGe: return value >= predicate.fValue;
+   }
+   return true;
+}
+
+/// Return true if some value in [min, max] can satisfy the predicate
+bool MayPass(const RParquetPredicate &predicate, double min, double max)
+{
+   using EOp = RParquetPredicate::EOp;
+   switch (predicate.fOp) {
+   case EOp::kEq: return min <= predicate.fValue && predicate.fValue <= max;
+   case EOp::kNe: return !(min == predicate.fValue && max == predicate.fValue);
+   case EOp::kLt: return min < predicate.fValue;
+   case EOp::kLe: return min <= predicate.fValue;
+   case EOp::kGt: return max > predicate.fValue;
+   case EOp::kGe: return max >= predicate.fValue;
+   }
+   return true;
+}
+
+/// Retrieve the minimum and maximum values of a column chunk, if they are known
+bool GetMinMax(const parquet::Statistics &stats, double &min, double &max)
+{
+   if (!stats.HasMinMax())
+      return false;
+   switch (stats.physical_type()) {
+   case parquet::Type::INT32: {
+      const auto &s = static_cast<const parquet::Int32Statistics &>(stats);
+      min = s.min();
+      max = s.max();
+      return true;
+   }
+   case parquet::Type::INT64: {
+      const auto &s = static_cast<const parquet::Int64Statistics &>(stats);
+      min = s.min();
+      max = s.max();
+      return true;
+   }
+   case parquet::Type::FLOAT: {
+      const auto &s = static_cast<const parquet::FloatStatistics &>(stats);
+      min = s.min();
+      max = s.max();
+      return true;
+   }
+   case parquet::Type::DOUBLE: {
+      const auto &s = static_cast<const parquet::DoubleStatistics &>(stats);
+      min = s.min();
+      max = s.max();
+      return true;
+   }
+   default: return false;
+   }
+}
+
+std::vector<RParquetPredicate> ParseFilter(const std::string &filter)
+{
+   std::vector<RParquetPredicate> predicates;
+   if (filter.find_first_not_of(" \t\n") == std::string::npos)
+      return predicates;
+
+   static const std::regex comparisonRegex(
+      R"(^\s*([A-Za-z_]\w*)\s*(==|!=|<=|>=|<|>)\s*([-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?)\s*$)");
+   std::size_t begin = 0;
+   while (begin <= filter.size()) {
+      auto end = filter.find("&&", begin);
+      if (end == std::string::npos)
+         end = filter.size();
+      const auto comparison = filter.substr(begin, end - begin);
+      std::smatch match;
+      if (!std::regex_match(comparison, match, comparisonRegex)) {
+         throw std::runtime_error("RParquetDS: cannot interpret \"" + comparison +
+                                  "\" in the filter. Only comparisons between a column and a number, combined with "
+                                  "&&, are supported.");
+      }
+      using EOp = RParquetPredicate::EOp;
+      const auto op = match[2].str();
+      const auto eop = op == "==" ? EOp::kEq
+                       : op == "!=" ? EOp::kNe
+                       : op == "<"  ? EOp::kLt
+                       : op == "<=" ? EOp::kLe
+                       : op == ">"  ? EOp::kGt
+                                    : EOp::kGe;
+      predicates.push_back({match[1].str(), eop, std::stod(match[3].str())});
+      begin = end + 2;
+   }
+   return predicates;
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+
+namespace RDF {
+
+/// The state of a processing slot: its own reader of the file, and the batches of the row group it processes
+struct RParquetDS::RSlotData {
+   std::unique_ptr<parquet::arrow::FileReader> fReader;
+   std::vector<std::shared_ptr<arrow::RecordBatch>> fBatches;
+   /// The first entry of each batch in fBatches, followed by the entry after the last one
+   std::vector<ULong64_t> fBatchFirstEntries;
+   int fRowGroup = -1;
+   /// One reader and one column type per predicate of the filter
+   std::vector<std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>> fPredicateReaders;
+   std::vector<arrow::Type::type> fPredicateTypes;
+};
+
+////////////////////////////////////////////////////////////////////////
+/// Constructor to create a Parquet RDataSource for RDataFrame.
+/// \param[in] fileName the path or URL of the file
+/// \param[in] columns the names of the columns to expose. In case columns is empty, we use all the columns of the file
+/// \param[in] filter the conjunction of comparisons that entries must satisfy, see the class documentation
+RParquetDS::RParquetDS(std::string_view fileName, const std::vector<std::string> &columns, std::string_view filter)
+   : fFileName(fileName), fFile(ROOT::Internal::RRawFile::Create(fileName)), fColumnNames(columns),
+     fPredicates(ParseFilter(std::string(filter)))
+{
+   auto reader = OpenFile(*fFile, nullptr);
+   fMetaData = reader->parquet_reader()->metadata();
+   ThrowIfError(reader->GetSchema(&fSchema), "cannot read the schema of " + fFileName);
+   for (const auto &field : reader->manifest().schema_fields) {
+      fFieldLeaves.emplace_back();
+      CollectLeaves(field, fFieldLeaves.back());
+   }
+
+   if (fColumnNames.empty()) {
+      for (auto &field : fSchema->fields())
+         fColumnNames.push_back(field->name());
+   }
+   for (auto &columnName : fColumnNames) {
+      auto field = fSchema->GetFieldByName(columnName);
+      if (!field)
+         throw std::runtime_error("RParquetDS: the file does not have column " + columnName);
+      ROOT::Internal::RDF::VerifyValidColumnType verifyType;
+      if (field->type()->Accept(&verifyType).ok() == false)
+         throw std::runtime_error("RParquetDS: column " + columnName + " contains an unsupported type.");
+   }
+
+   for (const auto &predicate : fPredicates) {
+      auto field = fSchema->GetFieldByName(predicate.fColumnName);
+      if (!field || !IsNumeric(field->type()->id()))
+         throw std::runtime_error("RParquetDS: the filter uses " + predicate.fColumnName +
+                                  ", which is not a numeric column of the file.");
+      AddReadColumn(predicate.fColumnName);
+   }
+
+   fRowGroupFirstEntries.push_back(0);
+   for (int i = 0; i < fMetaData->num_row_groups(); ++i) {
+      fRowGroupFirstEntries.push_back(fRowGroupFirstEntries.back() + fMetaData->RowGroup(i)->num_rows());
+      if (fRowGroupFirstEntries[i + 1] > fRowGroupFirstEntries[i] && IsRowGroupSelected(i))
+         fSelectedRowGroups.push_back(i);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Destructor.
+RParquetDS::~RParquetDS()
+{
+}
+
+/// Return false if the statistics of the row group show that none of its entries can satisfy the filter.
+bool RParquetDS::IsRowGroupSelected(int rowGroup) const
+{
+   const auto rowGroupMetaData = fMetaData->RowGroup(rowGroup);
+   for (const auto &predicate : fPredicates) {
+      const auto &field = *fSchema->GetFieldByName(predicate.fColumnName);
+      // the statistics of unsigned columns are stored as signed integers, which have a different ordering
+      if (field.type()->id() == arrow::Type::UINT32 || field.type()->id() == arrow::Type::UINT64)
+         continue;
+      const auto leaf = fFieldLeaves[fSchema->GetFieldIndex(predicate.fColumnName)].front();
+      const auto columnChunk = rowGroupMetaData->ColumnChunk(leaf);
+      const auto stats = columnChunk->is_stats_set() ? columnChunk->statistics() : nullptr;
+      double min, max;
+      if (stats && GetMinMax(*stats, min, max) && !MayPass(predicate, min, max))
+         return false;
+   }
+   return true;
+}
+
+void RParquetDS::AddReadColumn(const std::string &colName)
+{
+   if (std::find(fReadColumns.begin(), fReadColumns.end(), colName) == fReadColumns.end())
+      fReadColumns.push_back(colName);
+}
+
+const std::vector<std::string> &RParquetDS::GetColumnNames() const
+{
+   return fColumnNames;
+}
+
+/// One range per row group that is not excluded by the filter
+std::vector<std::pair<ULong64_t, ULong64_t>> RParquetDS::GetEntryRanges()
+{
+   std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+   if (fEntryRangesRequested)
+      return entryRanges;
+   fEntryRangesRequested = true;
+   for (auto rowGroup : fSelectedRowGroups)
+      entryRanges.emplace_back(fRowGroupFirstEntries[rowGroup], fRowGroupFirstEntries[rowGroup + 1]);
+   return entryRanges;
+}
+
+std::string RParquetDS::GetTypeName(std::string_view colName) const
+{
+   auto field = fSchema->GetFieldByName(std::string(colName));
+   if (!field) {
+      std::string msg = "The dataset does not have column ";
+      msg += colName;
+      throw std::runtime_error(msg);
+   }
+   ROOT::Internal::RDF::RDFTypeNameGetter typeGetter;
+   auto status = field->type()->Accept(&typeGetter);
+   if (status.ok() == false) {
+      std::string msg = "RParquetDS does not support a column of type ";
+      msg += field->type()->name();
+      throw std::runtime_error(msg);
+   }
+   return typeGetter.result();
+}
+
+bool RParquetDS::HasColumn(std::string_view colName) const
+{
+   return std::find(fColumnNames.begin(), fColumnNames.end(), colName) != fColumnNames.end();
+}
+
+bool RParquetDS::SetEntry(unsigned int slot, ULong64_t entry)
+{
+   auto &slotData = *fSlotData[slot];
+   for (std::size_t i = 0; i < fPredicates.size(); ++i) {
+      const auto *value = &slotData.fPredicateReaders[i]->Get<char>(entry);
+      if (!Passes(fPredicates[i], ValueAsDouble(value, slotData.fPredicateTypes[i])))
+         return false;
+   }
+   return true;
+}
+
+/// Read the columns used in the event loop for the row group that contains firstEntry
+void RParquetDS::InitSlot(unsigned int slot, ULong64_t firstEntry)
+{
+   auto &slotData = *fSlotData[slot];
+   const auto it = std::upper_bound(fRowGroupFirstEntries.begin(), fRowGroupFirstEntries.end(), firstEntry);
+   assert(it != fRowGroupFirstEntries.begin() && it != fRowGroupFirstEntries.end());
+   const int rowGroup = std::distance(fRowGroupFirstEntries.begin(), it) - 1;
+   if (rowGroup == slotData.fRowGroup)
+      return;
+
+   slotData.fBatches.clear();
+   slotData.fBatchFirstEntries = {fRowGroupFirstEntries[rowGroup]};
+   slotData.fRowGroup = rowGroup;
+   if (fReadLeaves.empty())
+      return;
+
+   std::shared_ptr<arrow::Table> table;
+   ThrowIfError(slotData.fReader->ReadRowGroup(rowGroup, fReadLeaves, &table),
+                "cannot read row group " + std::to_string(rowGroup) + " of " + fFileName);
+   // Decompressed row groups might be split in several chunks: the batches slice them without copying
+   arrow::TableBatchReader batchReader(*table);
+   std::shared_ptr<arrow::RecordBatch> batch;
+   while (true) {
+      ThrowIfError(batchReader.ReadNext(&batch), "cannot read row group " + std::to_string(rowGroup));
+      if (!batch)
+         break;
+      if (batch->num_rows() == 0)
+         continue;
+      slotData.fBatchFirstEntries.push_back(slotData.fBatchFirstEntries.back() + batch->num_rows());
+      slotData.fBatches.emplace_back(std::move(batch));
+   }
+}
+
+void RParquetDS::SetNSlots(unsigned int nSlots)
+{
+   assert(0U == fNSlots && "Setting the number of slots even if the number of slots is different from zero.");
+   fNSlots = nSlots;
+   for (auto slot = 0u; slot < fNSlots; ++slot) {
+      fSlotData.emplace_back(std::make_unique<RSlotData>());
+      auto &slotData = *fSlotData.back();
+      slotData.fReader = OpenFile(*fFile, fMetaData);
+      for (const auto &predicate : fPredicates) {
+         const auto &type = *fSchema->GetFieldByName(predicate.fColumnName)->type();
+         slotData.fPredicateReaders.emplace_back(ROOT::Internal::RDF::MakeArrowColumnReader(
+            type, slotData.fBatches, slotData.fBatchFirstEntries, predicate.fColumnName));
+         slotData.fPredicateTypes.push_back(type.id());
+      }
+   }
+}
+
+std::vector<void *> RParquetDS::GetColumnReadersImpl(std::string_view, const std::type_info &)
+{
+   // all columns are read through GetColumnReaders(unsigned int, std::string_view, const std::type_info &)
+   return {};
+}
+
+/// Column readers can only be requested before the event loop starts. The columns for which readers are requested
+/// are the only ones that are read from the file, together with the columns of the filter.
+std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>
+RParquetDS::GetColumnReaders(unsigned int slot, std::string_view name, const std::type_info &)
+{
+   const auto colName = std::string(name);
+   if (!HasColumn(colName))
+      throw std::runtime_error("The dataset does not have column " + colName);
+   AddReadColumn(colName);
+   auto &slotData = *fSlotData[slot];
+   return ROOT::Internal::RDF::MakeArrowColumnReader(*fSchema->GetFieldByName(colName)->type(), slotData.fBatches,
+                                                     slotData.fBatchFirstEntries, colName);
+}
+
+void RParquetDS::Initialize()
+{
+   fEntryRangesRequested = false;
+   fReadLeaves.clear();
+   for (const auto &colName : fReadColumns) {
+      const auto &leaves = fFieldLeaves[fSchema->GetFieldIndex(colName)];
+      fReadLeaves.insert(fReadLeaves.end(), leaves.begin(), leaves.end());
+   }
+   std::sort(fReadLeaves.begin(), fReadLeaves.end());
+   // the columns to read might have changed since the previous event loop
+   for (auto &slotData : fSlotData)
+      slotData->fRowGroup = -1;
+}
+
+std::string RParquetDS::GetLabel()
+{
+   return "ParquetDS";
+}
+
+/// \brief Factory method to create a RDataFrame that reads a Parquet file.
+/// \param[in] fileName the path or URL of the file
+/// \param[in] columns the names of the columns to expose. In case columns is empty, we use all the columns of the file
+/// \param[in] filter the conjunction of comparisons that entries must satisfy, see RParquetDS
+RDataFrame FromParquet(std::string_view fileName, const std::vector<std::string> &columns, std::string_view filter)
+{
+   ROOT::RDataFrame rdf(std::make_unique<RParquetDS>(fileName, columns, filter));
+   return rdf;
+}
+
+} // namespace RDF
+
+} // namespace ROOT
@@ -318,6 +318,42 @@ static bool RegisterSqliteVfs()
    return (retval == SQLITE_OK);
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// Opens a read-only connection to the given database through the custom VFS module, returns the sqlite error code
+int OpenReadOnly(const std::string &fileName, sqlite3 **db)
+{
+   int retval = sqlite3_open_v2(fileName.c_str(), db, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, gSQliteVfsName);
+   if (retval != SQLITE_OK)
+      return retval;
+
+   // Certain complex queries trigger creation of temporary tables. Depending on the build options of sqlite,
+   // sqlite may try to store such temporary tables on disk, using our custom VFS module to do so.
+   // Creation of new database files, however, is not supported by the custom VFS module.  Thus we set the behavior
+   // of the database connection to "temp_store=2", meaning that temporary tables should always be maintained
+   // in memory.
+   return sqlite3_exec(*db, "PRAGMA temp_store=2;", nullptr, nullptr, nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Quotes a table or column name for its use in an SQL statement
+std::string QuoteIdentifier(const std::string &name)
+{
+   std::string quoted = "\"";
+   for (auto c : name) {
+      if (c == '"')
+         quoted += '"';
+      quoted += c;
+   }
+   return quoted + '"';
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Returns the WHERE clause of a table query for the given user condition, empty if there is no condition
+std::string WhereClause(const std::string &where)
+{
+   return where.empty() ? std::string() : " WHERE (" + where + ")";
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -325,11 +361,44 @@ namespace ROOT {
 namespace RDF {
 
 namespace Internal {
+////////////////////////////////////////////////////////////////////////////
+/// The connection and the SELECT statement of a processing slot when a table is read in chunks of rowids.
+/// The statement returns the rows of the table from the entry fBegin (included) to fEnd (excluded).
+struct RSqliteDSSlot {
+   sqlite3 *fDb = nullptr;
+   sqlite3_stmt *fQuery = nullptr;
+   ULong64_t fBegin = 0;
+   ULong64_t fEnd = 0;
+   ULong64_t fNext = 0;    ///< The statement can serve the entries from fNext to fEnd without being reset
+   ULong64_t fEntry = 0;   ///< The entry of the current row of fQuery, if fHasRow
+   bool fHasRow = false;
+};
+
 ////////////////////////////////////////////////////////////////////////////
 /// The state of an open dataset in terms of the sqlite3 C library.
 struct RSqliteDSDataSet {
    sqlite3 *fDb = nullptr;
    sqlite3_stmt *fQuery = nullptr;
+
+   // Only used if a table is read in chunks of rowids, see RSqliteDS(fileName, table, where)
+   std::string fFileName;
+   std::string fTable;          ///<  Name of the table, empty if the data set is given by a query
+   std::string fWhere;          ///<  SQL condition on the rows of the table
+   std::string fRowQuery;       ///<  SELECT statement of the rows of a chunk, with the active columns only
+   std::vector<int> fRowColumns; ///< Index in fValues of the columns of fRowQuery, after the rowid
+   Long64_t fFirstRowId = 0;     ///< Entries are numbered by their rowid minus fFirstRowId
+   ULong64_t fNEntries = 0;      ///< Span of the rowids of the selected rows
+   std::vector<ULong64_t> fChunkBounds; ///< The chunks of entries are [fChunkBounds[i], fChunkBounds[i + 1])
+   bool fRangesDone = false;
+   std::vector<RSqliteDSSlot> fSlots;
+
+   ~RSqliteDSDataSet()
+   {
+      for (auto &slot : fSlots) {
+         sqlite3_finalize(slot.fQuery);
+         sqlite3_close(slot.fDb);
+      }
+   }
 };
 }
 
@@ -363,17 +432,8 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
 
    int retval;
 
-   retval = sqlite3_open_v2(fileName.c_str(), &fDataSet->fDb, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX,
-                            gSQliteVfsName);
-   if (retval != SQLITE_OK)
-      SqliteError(retval);
-
-   // Certain complex queries trigger creation of temporary tables. Depending on the build options of sqlite,
-   // sqlite may try to store such temporary tables on disk, using our custom VFS module to do so.
-   // Creation of new database files, however, is not supported by the custom VFS module.  Thus we set the behavior
-   // of the database connection to "temp_store=2", meaning that temporary tables should always be maintained
-   // in memory.
-   retval = sqlite3_exec(fDataSet->fDb, "PRAGMA temp_store=2;", nullptr, nullptr, nullptr);
+   fDataSet->fFileName = fileName;
+   retval = OpenReadOnly(fileName, &fDataSet->fDb);
    if (retval != SQLITE_OK)
       SqliteError(retval);
 
@@ -438,6 +498,41 @@ RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Build the dataframe from a table, read in parallel
+/// \param[in] fileName The path to an sqlite3 file, will be opened read-only
+/// \param[in] table The name of the table of the data set; it must be a rowid table
+/// \param[in] where An SQL condition on the rows of the table, all the rows are taken if it is empty
+///
+/// Contrary to an arbitrary query, the rows of a table can be read in independent chunks of rowids: with
+/// implicit multi-threading, each processing slot reads its chunks with its own connection to the database.
+/// The SELECT statement of the chunks only asks for the columns used by the RDataFrame, and applies the `where`
+/// condition in sqlite, e.g. `FromSqliteTable(fileName, "conditions", "run >= 1000 AND valid = 1")`.
+///
+/// The entry numbers of the RDataFrame are the rowids of the rows, minus the smallest one. The entries of the rowids
+/// that do not exist or that do not satisfy the `where` condition are skipped.
+RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &table, const std::string &where)
+   : RSqliteDS(fileName, "SELECT * FROM " + QuoteIdentifier(table) + WhereClause(where))
+{
+   fDataSet->fTable = table;
+   fDataSet->fWhere = where;
+
+   sqlite3_stmt *stmt = nullptr;
+   const std::string query =
+      "SELECT min(rowid), max(rowid) FROM " + QuoteIdentifier(table) + WhereClause(where);
+   int retval = sqlite3_prepare_v2(fDataSet->fDb, query.c_str(), -1, &stmt, nullptr);
+   if (retval != SQLITE_OK)
+      SqliteError(retval);
+   retval = sqlite3_step(stmt);
+   if (retval == SQLITE_ROW && sqlite3_column_type(stmt, 0) != SQLITE_NULL) {
+      fDataSet->fFirstRowId = sqlite3_column_int64(stmt, 0);
+      fDataSet->fNEntries = sqlite3_column_int64(stmt, 1) - fDataSet->fFirstRowId + 1;
+   }
+   sqlite3_finalize(stmt);
+   if ((retval != SQLITE_ROW) && (retval != SQLITE_DONE))
+      SqliteError(retval);
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// Frees the sqlite resources and closes the file.
 RSqliteDS::~RSqliteDS()
@@ -477,15 +572,34 @@ RDataSource::Record_t RSqliteDS::GetColumnReadersImpl(std::string_view name, con
    }
 
    fValues[index].fIsActive = true;
-   return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+   if (fSlotValues.empty())
+      return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+
+   std::vector<void *> readers;
+   for (auto &values : fSlotValues) {
+      values[index].fIsActive = true;
+      readers.emplace_back(&values[index].fPtr);
+   }
+   return readers;
 }
 
 ////////////////////////////////////////////////////////////////////////////
 /// Returns a range of size 1 as long as more rows are available in the SQL result set.
 /// This inherently serialized the RDF independent of the number of slots.
+/// A table is instead split in a few chunks of rowids per slot, all returned at once.
 std::vector<std::pair<ULong64_t, ULong64_t>> RSqliteDS::GetEntryRanges()
 {
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
+   if (!fDataSet->fTable.empty()) {
+      if (fDataSet->fRangesDone)
+         return entryRanges;
+      fDataSet->fRangesDone = true;
+      const auto &bounds = fDataSet->fChunkBounds;
+      for (std::size_t i = 0; i + 1 < bounds.size(); ++i)
+         entryRanges.emplace_back(bounds[i], bounds[i + 1]);
+      return entryRanges;
+   }
+
    int retval = sqlite3_step(fDataSet->fQuery);
    switch (retval) {
    case SQLITE_DONE: return entryRanges;
@@ -523,8 +637,42 @@ bool RSqliteDS::HasColumn(std::string_view colName) const
 
 ////////////////////////////////////////////////////////////////////////////
 /// Resets the SQlite query engine at the beginning of the event loop.
+/// For a table, prepares the SELECT statement of the chunks from the columns in use and splits the rowids in chunks.
 void RSqliteDS::Initialize()
 {
+   // Number of chunks per slot: allows for balancing the load when the selected rows are unevenly distributed
+   constexpr ULong64_t kChunksPerSlot = 4;
+
+   if (!fDataSet->fTable.empty()) {
+      auto &ds = *fDataSet;
+      ds.fRangesDone = false;
+      ds.fRowColumns.clear();
+      ds.fRowQuery = "SELECT rowid";
+      for (unsigned i = 0; i < fValues.size(); ++i) {
+         if (!fValues[i].fIsActive)
+            continue;
+         ds.fRowColumns.emplace_back(i);
+         ds.fRowQuery += ", " + QuoteIdentifier(fColumnNames[i]);
+      }
+      ds.fRowQuery += " FROM " + QuoteIdentifier(ds.fTable) + " WHERE rowid >= ?1 AND rowid < ?2";
+      if (!ds.fWhere.empty())
+         ds.fRowQuery += " AND (" + ds.fWhere + ")";
+      ds.fRowQuery += " ORDER BY rowid";
+
+      for (auto &slot : ds.fSlots) {
+         sqlite3_finalize(slot.fQuery);
+         slot.fQuery = nullptr;
+         slot.fBegin = slot.fEnd = slot.fNext = 0;
+         slot.fHasRow = false;
+      }
+
+      ds.fChunkBounds.clear();
+      const ULong64_t nChunks = std::min<ULong64_t>(ds.fNEntries, std::max(1u, fNSlots) * kChunksPerSlot);
+      for (ULong64_t i = 0; nChunks > 0 && i <= nChunks; ++i)
+         ds.fChunkBounds.emplace_back(ds.fNEntries / nChunks * i + std::min(i, ds.fNEntries % nChunks));
+      return;
+   }
+
    fNRow = 0;
    int retval = sqlite3_reset(fDataSet->fQuery);
    if (retval != SQLITE_OK)
@@ -546,47 +694,137 @@ RDataFrame FromSqlite(std::string_view fileName, std::string_view query)
    return rdf;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////
+/// \brief Factory method to create a SQlite RDataFrame from a table, read in parallel with implicit multi-threading.
+/// \param[in] fileName Path of the sqlite file.
+/// \param[in] table Name of the table that defines the data set.
+/// \param[in] where SQL condition on the rows of the table, evaluated by sqlite; all the rows if empty.
+///
+/// See RSqliteDS::RSqliteDS(const std::string &, const std::string &, const std::string &).
+RDataFrame FromSqliteTable(std::string_view fileName, std::string_view table, std::string_view where)
+{
+   ROOT::RDataFrame rdf(
+      std::make_unique<RSqliteDS>(std::string(fileName), std::string(table), std::string(where)));
+   return rdf;
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Stores the given column of the current row of a statement as a C++ value.
+void RSqliteDS::ReadValue(Value_t &value, sqlite3_stmt *stmt, int column)
+{
+   int nbytes;
+   switch (value.fType) {
+   case ETypes::kInteger: value.fInteger = sqlite3_column_int64(stmt, column); break;
+   case ETypes::kReal: value.fReal = sqlite3_column_double(stmt, column); break;
+   case ETypes::kText:
+      nbytes = sqlite3_column_bytes(stmt, column);
+      if (nbytes == 0) {
+         value.fText = "";
+      } else {
+         value.fText = reinterpret_cast<const char *>(sqlite3_column_text(stmt, column));
+      }
+      break;
+   case ETypes::kBlob:
+      nbytes = sqlite3_column_bytes(stmt, column);
+      value.fBlob.resize(nbytes);
+      if (nbytes > 0) {
+         std::memcpy(value.fBlob.data(), sqlite3_column_blob(stmt, column), nbytes);
+      }
+      break;
+   case ETypes::kNull: break;
+   default: throw std::runtime_error("Unhandled column type");
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////
 /// Stores the result of the current active sqlite query row as a C++ value.
-bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
+bool RSqliteDS::SetEntry(unsigned int slot, ULong64_t entry)
 {
+   if (!fDataSet->fTable.empty())
+      return SetTableEntry(slot, entry);
+
    assert(entry + 1 == fNRow);
    (void)entry;
    unsigned N = fValues.size();
    for (unsigned i = 0; i < N; ++i) {
       if (!fValues[i].fIsActive)
          continue;
+      ReadValue(fValues[i], fDataSet->fQuery, i);
+   }
+   return true;
+}
 
-      int nbytes;
-      switch (fValues[i].fType) {
-      case ETypes::kInteger: fValues[i].fInteger = sqlite3_column_int64(fDataSet->fQuery, i); break;
-      case ETypes::kReal: fValues[i].fReal = sqlite3_column_double(fDataSet->fQuery, i); break;
-      case ETypes::kText:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         if (nbytes == 0) {
-            fValues[i].fText = "";
-         } else {
-            fValues[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
-         }
-         break;
-      case ETypes::kBlob:
-         nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         fValues[i].fBlob.resize(nbytes);
-         if (nbytes > 0) {
-            std::memcpy(fValues[i].fBlob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
-         }
-         break;
-      case ETypes::kNull: break;
-      default: throw std::runtime_error("Unhandled column type");
-      }
+////////////////////////////////////////////////////////////////////////////
+/// Moves the statement of the slot to the row of the given entry of the table and stores its values. Returns false
+/// if the table has no such row, or if the row does not satisfy the condition of the data set.
+/// Within a chunk, the entries are expected in increasing order; otherwise, the statement is restarted.
+bool RSqliteDS::SetTableEntry(unsigned int slot, ULong64_t entry)
+{
+   auto &ds = *fDataSet;
+   auto &s = ds.fSlots[slot];
+
+   int retval;
+   if (!s.fDb) {
+      retval = OpenReadOnly(ds.fFileName, &s.fDb);
+      if (retval != SQLITE_OK)
+         SqliteError(retval);
+   }
+   if (!s.fQuery) {
+      retval = sqlite3_prepare_v2(s.fDb, ds.fRowQuery.c_str(), -1, &s.fQuery, nullptr);
+      if (retval != SQLITE_OK)
+         SqliteError(retval);
    }
+
+   auto step = [&]() {
+      const int status = sqlite3_step(s.fQuery);
+      if ((status != SQLITE_ROW) && (status != SQLITE_DONE))
+         SqliteError(status);
+      s.fHasRow = (status == SQLITE_ROW);
+      if (s.fHasRow)
+         s.fEntry = sqlite3_column_int64(s.fQuery, 0) - ds.fFirstRowId;
+   };
+
+   if (entry < s.fNext || entry >= s.fEnd) {
+      // Restart the statement from this entry to the end of its chunk
+      const auto chunkEnd = std::upper_bound(ds.fChunkBounds.begin(), ds.fChunkBounds.end(), entry);
+      s.fBegin = entry;
+      s.fEnd = (chunkEnd == ds.fChunkBounds.end()) ? ds.fNEntries : *chunkEnd;
+      sqlite3_reset(s.fQuery);
+      sqlite3_bind_int64(s.fQuery, 1, ds.fFirstRowId + s.fBegin);
+      sqlite3_bind_int64(s.fQuery, 2, ds.fFirstRowId + s.fEnd);
+      step();
+   }
+   while (s.fHasRow && s.fEntry < entry)
+      step();
+   s.fNext = entry + 1;
+   if (!s.fHasRow || s.fEntry != entry)
+      return false;
+
+   auto &values = fSlotValues[slot];
+   for (std::size_t i = 0; i < ds.fRowColumns.size(); ++i)
+      ReadValue(values[ds.fRowColumns[i]], s.fQuery, i + 1);
    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
-/// Almost a no-op, many slots can in fact reduce the performance due to thread synchronization.
+/// When reading a table, sets up a connection and the values for each of the slots. Otherwise almost a no-op,
+/// many slots can in fact reduce the performance due to thread synchronization.
 void RSqliteDS::SetNSlots(unsigned int nSlots)
 {
+   if (!fDataSet->fTable.empty()) {
+      fNSlots = nSlots;
+      fDataSet->fSlots.resize(nSlots);
+      // Value_t points into itself: construct the values in place
+      fSlotValues.clear();
+      fSlotValues.resize(nSlots);
+      for (auto &values : fSlotValues) {
+         values.reserve(fColumnTypes.size());
+         for (auto type : fColumnTypes)
+            values.emplace_back(type);
+      }
+      return;
+   }
+
    if (nSlots > 1) {
       ::Warning("SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
                              "Consider turning off IMT.");
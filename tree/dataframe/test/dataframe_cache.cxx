@@ -336,3 +336,29 @@ TEST(Cache, Alias)
    auto df4 = df3.Cache({"y"});
    EXPECT_EQ(df4.Sum("y").GetValue(), 3u);
 }
+
+TEST(Cache, Compressed)
+{
+   ROOT::RDataFrame df(1000);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+               .Define("v", [](ULong64_t e) { return ROOT::RVecI(e % 3, int(e)); }, {"rdfentry_"});
+
+   // small clusters and no memory, so that all the pages are spilled to a file
+   ROOT::RDF::RCacheOptions opts;
+   opts.fClusterSize = 64;
+   opts.fMaxMemory = 1;
+   auto cached = d.Cache<double, ROOT::RVecI>({"x", "v"}, opts);
+   EXPECT_EQ(1000u, *cached.Count());
+   EXPECT_DOUBLE_EQ(999. * 1000. / 2., *cached.Sum<double>("x"));
+   auto check = [](double x, const ROOT::RVecI &v) {
+      EXPECT_EQ(std::size_t(ULong64_t(x) % 3), v.size());
+      for (auto i : v)
+         EXPECT_EQ(int(x), i);
+   };
+   cached.Foreach(check, {"x", "v"});
+
+   // the jitted overload, run twice on the cached data
+   auto cachedj = d.Cache({"x"}, opts);
+   EXPECT_DOUBLE_EQ(999. * 1000. / 2., *cachedj.Sum<double>("x"));
+   EXPECT_DOUBLE_EQ(999., *cachedj.Max<double>("x"));
+}
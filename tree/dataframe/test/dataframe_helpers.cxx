@@ -4,11 +4,14 @@
 #include <ROOT/RVec.hxx>
 #include <ROOT/RDFHelpers.hxx>
 #include <ROOT/RResultHandle.hxx>
+#include <ROOT/RDF/PyROOTHelpers.hxx>
 #include <TSystem.h>
 #include <RConfigure.h>
 
 #include <algorithm>
 #include <deque>
+#include <mutex>
+#include <numeric>
 #include <vector>
 #include <string>
 
@@ -430,6 +433,85 @@ TEST(RDFHelpers, SaveGraphSharedDefines)
    EXPECT_EQ(graph, expected);
 }
 
+TEST(RDFHelpers, SaveGraphAndProfile)
+{
+   ROOT::RDataFrame df(100);
+   ROOT::Internal::RDF::EnableProfiling(df);
+   auto c = df.Define("x", [](ULong64_t e) { return e; }, {"rdfentry_"})
+               .Filter([](ULong64_t x) { return x % 2 == 0; }, {"x"})
+               .Count();
+   EXPECT_EQ(*c, 50u);
+
+   // every node is annotated with the number of entries it processed
+   const auto graph = ROOT::RDF::SaveGraph(df);
+   EXPECT_NE(graph.find("Entries: 100\\n100 entries, "), std::string::npos) << graph;
+   EXPECT_NE(graph.find("Define\\nx\\n100 entries, "), std::string::npos) << graph;
+   EXPECT_NE(graph.find("Filter\\n100 entries, "), std::string::npos) << graph;
+   EXPECT_NE(graph.find("(already run)\\n50 entries, "), std::string::npos) << graph;
+
+   const auto profile = ROOT::RDF::Experimental::SaveProfile(df);
+   EXPECT_NE(profile.find("\"nSlots\": 1,"), std::string::npos) << profile;
+   EXPECT_NE(profile.find("\"loop\": {\"entries\": [100], "), std::string::npos) << profile;
+   EXPECT_NE(profile.find("\"type\": \"filter\", \"name\": \"Filter\", \"prevId\": "), std::string::npos) << profile;
+   EXPECT_NE(profile.find("\"type\": \"define\", \"name\": \"Define x\", \"prevId\": 0, \"entries\": [100]"),
+             std::string::npos)
+      << profile;
+
+   // nodes that took part in an event loop that was not profiled are not annotated anymore
+   ROOT::Internal::RDF::EnableProfiling(df, false);
+   auto c2 = df.Filter([](ULong64_t e) { return e < 10; }, {"rdfentry_"}).Count();
+   EXPECT_EQ(*c2, 10u);
+   const auto graph2 = ROOT::RDF::SaveGraph(df);
+   EXPECT_NE(graph2.find("Entries: 100\","), std::string::npos) << graph2;
+   EXPECT_NE(graph2.find("Define\\nx\","), std::string::npos) << graph2;
+   EXPECT_NE(ROOT::RDF::Experimental::SaveProfile(df).find("\"loop\": null"), std::string::npos);
+}
+
+TEST(RDFHelpers, RVecArena)
+{
+   using ROOT::Detail::VecOps::IsAdopting;
+
+   ROOT::RDataFrame df(100);
+   ROOT::Internal::RDF::EnableRVecArena(df);
+   // "filtered" always lives in the arena, "selected" only for even entries. For odd entries, the value "selected"
+   // cached for the previous entry still adopts arena memory that now belongs to "filtered", and must not be written
+   // into.
+   auto dd = df.Define("v",
+                       [](ULong64_t e) {
+                          ROOT::RVecD v(10 + 20 * (e % 2));
+                          std::iota(v.begin(), v.end(), double(e));
+                          return v;
+                       },
+                       {"rdfentry_"})
+                .Define("filtered", [](const ROOT::RVecD &v) { return Filter(v, [](double x) { return x >= 0.; }); },
+                        {"v"})
+                .Define("selected", [](const ROOT::RVecD &f, ULong64_t e) { return f[f < e + (e % 2 ? 2 : 10)]; },
+                        {"filtered", "rdfentry_"});
+   unsigned int nAdopting = 0;
+   dd.Foreach([&nAdopting](const ROOT::RVecD &f) { nAdopting += IsAdopting(f); }, {"filtered"});
+   auto filtered = dd.Take<ROOT::RVecD>("filtered");
+   auto selected = dd.Take<ROOT::RVecD>("selected");
+
+   ASSERT_EQ(100u, filtered->size());
+   ASSERT_EQ(100u, selected->size());
+   for (ULong64_t e = 0u; e < 100u; ++e) {
+      const auto &f = (*filtered)[e];
+      // the values taken are copies on the heap
+      EXPECT_FALSE(IsAdopting(f));
+      ASSERT_EQ(10 + 20 * (e % 2), f.size());
+      for (std::size_t k = 0u; k < f.size(); ++k)
+         EXPECT_EQ(double(e + k), f[k]) << "entry " << e;
+      EXPECT_EQ(e % 2 ? 2u : 10u, (*selected)[e].size());
+   }
+   // "filtered" has more elements than fit in the inline storage of an RVec
+   EXPECT_EQ(100u, nAdopting);
+
+   ROOT::Internal::RDF::EnableRVecArena(df, false);
+   nAdopting = 0;
+   dd.Foreach([&nAdopting](const ROOT::RVecD &f) { nAdopting += IsAdopting(f); }, {"filtered"});
+   EXPECT_EQ(0u, nAdopting);
+}
+
 TEST(RDFHelpers, GraphContainers)
 {
    const std::vector<double> xx = {-0.22, 0.05, 0.25, 0.35, 0.5, 0.61, 0.7, 0.85, 0.89, 0.95};
@@ -683,6 +765,46 @@ TEST(RunGraphs, AlreadyRun)
                        "Got 4 handles from which 2 link to results which are already ready.");
 }
 
+TEST(RunGraphs, SharedDataset)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif // R__USE_IMT
+
+   const auto fname = "dataframe_helpers_rungraphs_shared.root";
+   ROOT::RDataFrame(100).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"}).Snapshot("t", fname);
+
+   ROOT::RDataFrame df1("t", fname);
+   auto r1 = df1.Sum<double>("x");
+   auto r2 = df1.Filter([](double x) { return x < 10; }, {"x"}).Count();
+   ROOT::RDataFrame df2("t", fname);
+   auto r3 = df2.Define("y", [](double x) { return 2 * x; }, {"x"}).Max<double>("y");
+   // a graph over another dataset runs in its own event loop
+   ROOT::RDataFrame df3(5);
+   auto r4 = df3.Count();
+
+   EXPECT_EQ(ROOT::RDF::RunGraphs({r1, r2, r3, r4}), 3u);
+
+   EXPECT_EQ(df1.GetNRuns(), 1u);
+   EXPECT_EQ(df2.GetNRuns(), 1u);
+   EXPECT_EQ(df3.GetNRuns(), 1u);
+   EXPECT_DOUBLE_EQ(*r1, 4950.);
+   EXPECT_EQ(*r2, 10u);
+   EXPECT_DOUBLE_EQ(*r3, 198.);
+   EXPECT_EQ(*r4, 5u);
+
+   // the loop managers can share an event loop again after the first one
+   auto r5 = df1.Count();
+   auto r6 = df2.Sum<double>("x");
+   ROOT::RDF::RunGraphs({r5, r6});
+   EXPECT_EQ(*r5, 100u);
+   EXPECT_DOUBLE_EQ(*r6, 4950.);
+   EXPECT_EQ(df1.GetNRuns(), 2u);
+   EXPECT_EQ(df2.GetNRuns(), 2u);
+
+   gSystem->Unlink(fname);
+}
+
 TEST(RDFHelpers, ProgressHelper_Existence_ST)
 {
    // Redirect cout.
@@ -700,6 +822,48 @@ TEST(RDFHelpers, ProgressHelper_Existence_ST)
    EXPECT_FALSE(strCout.str().empty());
 }
 
+namespace {
+struct BatchSums {
+   std::mutex fMutex;
+   std::vector<std::size_t> fBatchSizes;
+   double fSumX = 0.;
+   int fNTrue = 0;
+};
+
+bool SumBatch(void *userData, unsigned int, std::size_t nEntries, std::size_t nColumns, void *const *columns,
+              const char *const *formats)
+{
+   auto sums = static_cast<BatchSums *>(userData);
+   std::lock_guard<std::mutex> lock(sums->fMutex);
+   if (nColumns != 2 || std::string(formats[0]) != "d" || std::string(formats[1]) != "?")
+      return false;
+   sums->fBatchSizes.push_back(nEntries);
+   auto x = static_cast<const double *>(columns[0]);
+   auto b = static_cast<const bool *>(columns[1]);
+   for (std::size_t i = 0; i < nEntries; ++i) {
+      sums->fSumX += x[i];
+      sums->fNTrue += b[i];
+   }
+   return true;
+}
+} // namespace
+
+TEST(RDFHelpers, BatchCallback)
+{
+   BatchSums sums;
+   ROOT::RDF::RNode df = ROOT::RDataFrame(25).Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                            .Define("b", [](ULong64_t e) { return e % 3 == 0; }, {"rdfentry_"});
+   auto n = ROOT::Internal::RDF::BookBatchCallback<double, bool>(
+      df, {"x", "b"}, reinterpret_cast<ULong64_t>(&SumBatch), reinterpret_cast<ULong64_t>(&sums), 10);
+   EXPECT_EQ(*n, 25u);
+   // with implicit MT enabled by the previous tests, each slot passes its own batches
+   EXPECT_EQ(std::accumulate(sums.fBatchSizes.begin(), sums.fBatchSizes.end(), std::size_t(0)), 25u);
+   for (auto size : sums.fBatchSizes)
+      EXPECT_LE(size, 10u);
+   EXPECT_DOUBLE_EQ(sums.fSumX, 300.);
+   EXPECT_EQ(sums.fNTrue, 9);
+}
+
 // The code below is a unit test for a function called `ProgressHelper_Existence_MT` in the `RDFHelpers` class.
 
 #ifdef R__USE_IMT
@@ -5,12 +5,14 @@
 #include "ROOT/RDataFrame.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RTrivialDS.hxx"
+#include "TEnv.h"
 #include "TMemFile.h"
 #include "TSystem.h"
 #include "TTree.h"
 
 #include "gtest/gtest.h"
 
+#include <filesystem>
 #include <thread>
 
 using namespace ROOT;
@@ -877,3 +879,69 @@ TEST(RDataFrameUtils, RegexWithFriendsInJittedFilters)
    EXPECT_EQ(df.Filter("fr.x < 0 && x > 0").Count().GetValue(), 1);
    EXPECT_EQ(df.Filter("x > 0 && fr.x < 0").Count().GetValue(), 1);
 }
+
+TEST(RDataFrameInterface, JitCache)
+{
+   const auto cacheDir =
+      std::filesystem::temp_directory_path() / ("dataframe_interface_jitcache_" + std::to_string(gSystem->GetPid()));
+   std::filesystem::remove_all(cacheDir);
+   gEnv->SetValue("RDataFrame.JitCacheDir", cacheDir.c_str());
+   auto countLibs = [&cacheDir]() {
+      if (!std::filesystem::is_directory(cacheDir))
+         return 0;
+      int nLibs = 0;
+      for (const auto &entry : std::filesystem::directory_iterator(cacheDir)) {
+         if (entry.path().extension() == std::string(".") + gSystem->GetSoExt())
+            ++nLibs;
+      }
+      return nLibs;
+   };
+
+   auto runGraph = []() {
+      ROOT::RDataFrame df(10);
+      auto sum = df.Define("x", "int(rdfentry_) * 2").Filter("x > 4").Sum<int>("x");
+      return *sum;
+   };
+   EXPECT_EQ(84, runGraph());
+   // only the renamed library is left behind, not the temporary one it was built as
+   const auto nLibs = countLibs();
+   EXPECT_EQ(1, nLibs);
+   // the second graph only differs in the addresses of its nodes and is served from the cache
+   EXPECT_EQ(84, runGraph());
+   EXPECT_EQ(nLibs, countLibs());
+
+   gEnv->SetValue("RDataFrame.JitCacheDir", "");
+   std::filesystem::remove_all(cacheDir);
+}
+
+TEST(RDataFrameInterface, SharedJittedDefines)
+{
+   gInterpreter->Declare("int rdf_shared_define_calls = 0; int RdfSharedDefine(ULong64_t e) { "
+                         "++rdf_shared_define_calls; return e * 2; }");
+   {
+      // sharing is opt-in: by default each branch evaluates its own Define
+      ROOT::RDataFrame df(10);
+      auto sumEven = df.Filter("rdfentry_ % 2 == 0").Define("x", "RdfSharedDefine(rdfentry_)").Sum<int>("x");
+      auto sumSmall = df.Filter("rdfentry_ < 5").Define("x", "RdfSharedDefine(rdfentry_)").Sum<int>("x");
+      EXPECT_EQ(40, *sumEven);
+      EXPECT_EQ(20, *sumSmall);
+      EXPECT_EQ(10, gInterpreter->ProcessLine("rdf_shared_define_calls;"));
+      gInterpreter->ProcessLine("rdf_shared_define_calls = 0;");
+   }
+
+   gEnv->SetValue("RDataFrame.ShareJittedDefines", 1);
+   ROOT::RDataFrame df(10);
+   auto even = df.Filter("rdfentry_ % 2 == 0").Define("x", "RdfSharedDefine(rdfentry_)");
+   auto small = df.Filter("rdfentry_ < 5").Define("x", "RdfSharedDefine(rdfentry_)");
+   // a differently named column with the same expression is a different node
+   auto other = df.Define("y", "RdfSharedDefine(rdfentry_)");
+   auto sumEven = even.Sum<int>("x");
+   auto sumSmall = small.Sum<int>("x");
+   auto sumOther = other.Sum<int>("y");
+   EXPECT_EQ(40, *sumEven);
+   EXPECT_EQ(20, *sumSmall);
+   EXPECT_EQ(90, *sumOther);
+   // entries 0, 1, 2, 3, 4, 6, 8 evaluate the shared "x" once each, "y" is evaluated for all 10 entries
+   EXPECT_EQ(17, gInterpreter->ProcessLine("rdf_shared_define_calls;"));
+   gEnv->SetValue("RDataFrame.ShareJittedDefines", 0);
+}
@@ -103,3 +103,36 @@ TEST(RDataFrameNodes, InheritanceOfDefines)
    ROOT::RDataFrame(1).Define("x", createStat).Snapshot<TStatistic>("t", ofileName, {"x"})->Foreach(checkStat, {"x"});
    gSystem->Unlink(ofileName);
 }
+
+TEST(RDataFrameNodes, BulkEventLoop)
+{
+   auto runGraph = [](unsigned int bulkSize) {
+      ROOT::RDataFrame df(100);
+      ROOT::Internal::RDF::SetBulkSize(df, bulkSize);
+      auto nAll = df.Count();
+      auto nCallbacks = std::make_shared<ULong64_t>(0);
+      nAll.OnPartialResult(1, [nCallbacks](ULong64_t) { ++(*nCallbacks); });
+      auto dfx = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+      auto even = dfx.Filter([](int x) { return x % 2 == 0; }, {"x"}, "even");
+      auto large = even.Filter("x > 10", "large");
+      auto sum = large.Sum<int>("x");
+      auto nLarge = large.Count();
+      auto odd = dfx.Filter([](int x) { return x % 2 == 1; }, {"x"}, "odd");
+      auto report = df.Report();
+      std::vector<ULong64_t> result{*nAll, static_cast<ULong64_t>(*sum), *nLarge};
+      for (const auto &cut : *report)
+         result.push_back(cut.GetPass());
+      result.push_back(*nCallbacks);
+      EXPECT_EQ(1u, df.GetNRuns());
+      return result;
+   };
+
+   const auto reference = runGraph(0);
+   EXPECT_EQ(100u, reference[0]);
+   EXPECT_EQ(2420u, reference[1]);
+   EXPECT_EQ(44u, reference[2]);
+   EXPECT_EQ(reference, runGraph(1));
+   EXPECT_EQ(reference, runGraph(7));
+   EXPECT_EQ(reference, runGraph(100));
+   EXPECT_EQ(reference, runGraph(1000));
+}
@@ -10,6 +10,7 @@
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/TSeq.hxx>
 #include <TChain.h>
+#include <TEnv.h>
 #include <TFile.h>
 #include <TGraph.h>
 #include <TInterpreter.h>
@@ -1031,6 +1032,53 @@ TEST_P(RDFSimpleTests, FillWithCustomClassJitted)
    EXPECT_EQ(h.GetEntries(), 10);
 }
 
+TEST_P(RDFSimpleTests, SparseColumnReading)
+{
+   auto filename = "dataframe_simple_sparse.root";
+   auto treename = "t";
+   // create input file (at most once per execution of the parametrized gtest)
+   static bool hasFile = false;
+   if (!hasFile) {
+      FillTree(filename, treename, 100);
+      hasFile = true;
+   }
+   gEnv->SetValue("RDataFrame.SparseColumnReading", 1);
+   RDataFrame df(treename, filename);
+   // b1 is read for every entry, b2 and b3 only for the entries that pass the filter
+   auto sel = df.Filter([](double b1) { return int(b1) % 10 == 0; }, {"b1"});
+   auto sumB2 = sel.Sum<int>("b2");
+   auto maxB3 = sel.Max<RVecD>("b3");
+   auto meanB1 = df.Mean<double>("b1");
+   EXPECT_EQ(*sumB2, 28500);
+   EXPECT_DOUBLE_EQ(*maxB3, 90.);
+   EXPECT_DOUBLE_EQ(*meanB1, 49.5);
+   gEnv->SetValue("RDataFrame.SparseColumnReading", 0);
+}
+
+TEST_P(RDFSimpleTests, ConcurrentProfileFill)
+{
+   RDataFrame df(1000);
+   auto d = df.Define("x", [](ULong64_t e) { return (e % 100) / 10.; }, {"rdfentry_"})
+               .Define("y", [](double x) { return 2. * x; }, {"x"})
+               .Define("w", [](double x) { return 1. + x; }, {"x"});
+   auto ref = d.Profile1D<double, double, double>({"ref", "ref", 10, 0., 10.}, "x", "y", "w");
+   auto ref2 = d.Profile2D<double, double, double>({"ref2", "ref2", 10, 0., 10., 5, 0., 20.}, "x", "y", "x");
+   *ref;
+   gEnv->SetValue("RDataFrame.ConcurrentProfileFill", 1);
+   auto prof = d.Profile1D<double, double, double>({"prof", "prof", 10, 0., 10.}, "x", "y", "w");
+   auto prof2 = d.Profile2D<double, double, double>({"prof2", "prof2", 10, 0., 10., 5, 0., 20.}, "x", "y", "x");
+   gEnv->SetValue("RDataFrame.ConcurrentProfileFill", 0);
+   EXPECT_EQ(prof->GetEntries(), 1000);
+   EXPECT_EQ(prof2->GetEntries(), 1000);
+   for (int bin = 0; bin < prof->GetNcells(); ++bin) {
+      EXPECT_NEAR(prof->GetBinContent(bin), ref->GetBinContent(bin), 1e-9);
+      EXPECT_NEAR(prof->GetBinError(bin), ref->GetBinError(bin), 1e-9);
+   }
+   for (int bin = 0; bin < prof2->GetNcells(); ++bin)
+      EXPECT_NEAR(prof2->GetBinContent(bin), ref2->GetBinContent(bin), 1e-9);
+   EXPECT_NEAR(prof->GetMean(2), ref->GetMean(2), 1e-9);
+}
+
 // run single-thread tests
 INSTANTIATE_TEST_SUITE_P(Seq, RDFSimpleTests, ::testing::Values(false));
 
@@ -1354,5 +1354,29 @@ TEST(RDFSnapshotMore, ZeroOutputEntriesMT)
    gSystem->Unlink(fname);
 }
 
+TEST(RDFSnapshotMore, OutputPerSlotMT)
+{
+   const auto fname = "snapshot_outputperslotmt.root";
+   const unsigned int nslots = std::min(4U, std::thread::hardware_concurrency());
+   ROOT::EnableImplicitMT(nslots);
+
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputPerSlot = true;
+   auto out = ROOT::RDataFrame(100)
+                 .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                 .Snapshot<int>("t", fname, {"x"}, opts);
+   // no merged output file, one file per slot
+   EXPECT_NE(gSystem->AccessPathName(fname), 0);
+   EXPECT_EQ(gSystem->AccessPathName("snapshot_outputperslotmt_0.root"), 0);
+
+   // the returned dataframe reads all per-slot files
+   EXPECT_EQ(*out->Count(), 100u);
+   EXPECT_EQ(*out->Sum<int>("x"), 4950);
+
+   ROOT::DisableImplicitMT();
+   for (unsigned int slot = 0; slot < nslots; ++slot)
+      gSystem->Unlink(("snapshot_outputperslotmt_" + std::to_string(slot) + ".root").c_str());
+}
+
 #endif // R__USE_IMT
 
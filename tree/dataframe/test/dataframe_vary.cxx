@@ -804,6 +804,29 @@ TEST_P(RDFVary, FilterChainDependingOnVariations)
    EXPECT_EQ(sums["y:1"], 30);
 }
 
+// the variations of y do not change the filter, they share the nominal one
+TEST_P(RDFVary, FilterSharedByVariations)
+{
+   auto sum = ROOT::RDataFrame(10)
+                 .Define("e", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                 .Vary("e", [](int e) { return ROOT::RVecI{e - 5, e + 5}; }, {"e"}, 2)
+                 .Define("y", [] { return 1; })
+                 .Vary("y", [] { return ROOT::RVecI{2, 3, 4}; }, {}, 3)
+                 .Filter([](int e) { return e % 2 == 0; }, {"e"})
+                 .Define("z", [](int e, int y) { return e * y; }, {"e", "y"})
+                 .Sum<int>("z");
+   EXPECT_EQ(*sum, 20);
+
+   auto sums = VariationsFor(sum);
+
+   EXPECT_EQ(sums["nominal"], 20);
+   EXPECT_EQ(sums["e:0"], -4 - 2 + 0 + 2 + 4);
+   EXPECT_EQ(sums["e:1"], 6 + 8 + 10 + 12 + 14);
+   EXPECT_EQ(sums["y:0"], 40);
+   EXPECT_EQ(sums["y:1"], 60);
+   EXPECT_EQ(sums["y:2"], 80);
+}
+
 TEST_P(RDFVary, JittedAction)
 {
    auto df = ROOT::RDataFrame(10).Define("x", [] { return 1; });
@@ -5,6 +5,7 @@
 #include <TTree.h>
 #include <TSystem.h> // Unlink
 #include <gtest/gtest.h>
+#include <cmath>
 #include <vector>
 
 using namespace ROOT::VecOps;
@@ -43,6 +44,31 @@ TEST(RDFAndVecOps, DefineRVec)
    EXPECT_DOUBLE_EQ(max, 3.);
 }
 
+TEST(RDFAndVecOps, DefineLazyExpression)
+{
+   auto df = RDataFrame(4)
+                .Define("px", [](ULong64_t e) { return RVecF(e + 1, float(e)); }, {"rdfentry_"})
+                .Define("pt", [](const RVecF &px) { return sqrt(Lazy(px) * px + 1.f)[Lazy(px) > 1.f]; }, {"px"})
+                .Define("ptJit", "sqrt(Lazy(px) * px + 1.f)[Lazy(px) > 1.f]")
+                .Define("twice", [](const RVecF &px) { return Lazy(px) * 2.f; }, {"px"})
+                .Define("twiceJit", "Lazy(px) * 2.f");
+
+   // the expressions are materialized into RVecs
+   EXPECT_EQ(df.GetColumnType("pt"), "ROOT::VecOps::RVec<float>");
+   EXPECT_EQ(df.GetColumnType("ptJit"), "ROOT::VecOps::RVec<float>");
+   EXPECT_EQ(df.GetColumnType("twiceJit"), "ROOT::VecOps::RVec<float>");
+
+   auto sumPt = df.Sum<RVecF>("pt");
+   auto sumPtJit = df.Sum<RVecF>("ptJit");
+   auto sumTwice = df.Sum<RVecF>("twice");
+   auto sumTwiceJit = df.Sum("twiceJit");
+   // entries 2 and 3 have 3 and 4 elements equal to 2 and 3 respectively
+   EXPECT_FLOAT_EQ(*sumPt, 3 * std::sqrt(5.f) + 4 * std::sqrt(10.f));
+   EXPECT_FLOAT_EQ(*sumPtJit, *sumPt);
+   EXPECT_FLOAT_EQ(*sumTwice, 2 * (0 + 2 + 3 * 2 + 4 * 3));
+   EXPECT_FLOAT_EQ(*sumTwiceJit, *sumTwice);
+}
+
 TEST(RDFAndVecOps, SnapshotRVec)
 {
    // write RVec to file
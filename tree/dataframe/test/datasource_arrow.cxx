@@ -119,23 +119,19 @@ TEST(RArrowDS, ColumnReaders)
 
    const auto nSlots = 3U;
    tds.SetNSlots(nSlots);
-   auto valsAge = tds.GetColumnReaders<Long64_t>("Age");
-   auto valsBabies = tds.GetColumnReaders<unsigned int>("Babies");
-
    tds.Initialize();
    auto ranges = tds.GetEntryRanges();
+   ASSERT_EQ(nSlots, ranges.size());
    auto slot = 0U;
    std::vector<Long64_t> RefsAge = {64, 50, 40, 30, 2, 0};
    std::vector<unsigned int> RefsBabies = {1, 0, 2, 3, 4, 21};
    for (auto &&range : ranges) {
-      tds.InitSlot(slot, range.first);
-      ASSERT_LT(slot, valsAge.size());
+      auto valsAge = tds.GetColumnReaders(slot, "Age", typeid(Long64_t));
+      auto valsBabies = tds.GetColumnReaders(slot, "Babies", typeid(unsigned int));
       for (auto i : ROOT::TSeq<int>(range.first, range.second)) {
          tds.SetEntry(slot, i);
-         auto valAge = **valsAge[slot];
-         EXPECT_EQ(RefsAge[i], valAge);
-         auto valBabies = **valsBabies[slot];
-         EXPECT_EQ(RefsBabies[i], valBabies);
+         EXPECT_EQ(RefsAge[i], valsAge->Get<Long64_t>(i));
+         EXPECT_EQ(RefsBabies[i], valsBabies->Get<unsigned int>(i));
       }
       slot++;
    }
@@ -147,24 +143,33 @@ TEST(RArrowDS, ColumnReadersString)
 
    const auto nSlots = 3U;
    tds.SetNSlots(nSlots);
-   auto vals = tds.GetColumnReaders<std::string>("Name");
    tds.Initialize();
    auto ranges = tds.GetEntryRanges();
    auto slot = 0U;
    std::vector<std::string> names = {"Harry", "Bob,Bob", "\"Joe\"", "Tom", " John  ", " Mary Ann "};
    for (auto &&range : ranges) {
-      tds.InitSlot(slot, range.first);
-      ASSERT_LT(slot, vals.size());
+      auto vals = tds.GetColumnReaders(slot, "Name", typeid(std::string));
       for (auto i : ROOT::TSeqU(range.first, range.second)) {
          tds.SetEntry(slot, i);
-         auto val = *((std::string *)*vals[slot]);
          ASSERT_LT(i, names.size());
-         EXPECT_EQ(names[i], val);
+         EXPECT_EQ(names[i], vals->Get<std::string>(i));
       }
       slot++;
    }
 }
 
+TEST(RArrowDS, RecordBatchReader)
+{
+   auto table = createTestTable();
+   auto reader = std::make_shared<arrow::TableBatchReader>(*table);
+   reader->set_chunksize(4);
+   auto rdf = ROOT::RDF::FromArrow(reader, {"Age", "Name"});
+   EXPECT_EQ(6U, *rdf.Count());
+   // the batches read by the first event loop are replayed by the second one
+   EXPECT_EQ(186, *rdf.Sum<Long64_t>("Age"));
+   EXPECT_EQ(2U, *rdf.Filter([](const std::string &n) { return n == "Tom" || n == "Harry"; }, {"Name"}).Count());
+}
+
 #ifndef NDEBUG
 
 TEST(RArrowDS, SetNSlotsTwice)
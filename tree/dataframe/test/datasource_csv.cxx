@@ -3,9 +3,12 @@
 #include <ROOT/TSeq.hxx>
 #include <ROOT/TestSupport.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+
 using namespace ROOT::RDF;
 
 auto fileName0 = "RCsvDS_test_headers.csv";
@@ -85,17 +88,16 @@ TEST(RCsvDS, ColumnReaders)
    RCsvDS tds(fileName0);
    const auto nSlots = 3U;
    tds.SetNSlots(nSlots);
-   auto vals = tds.GetColumnReaders<Long64_t>("Age");
    tds.Initialize();
    auto ranges = tds.GetEntryRanges();
    auto slot = 0U;
    std::vector<Long64_t> ages = {60, 50, 40, 30, 1, -1};
    for (auto &&range : ranges) {
+      auto vals = tds.GetColumnReaders(slot, "Age", typeid(Long64_t));
       tds.InitSlot(slot, range.first);
       for (auto i : ROOT::TSeq<int>(range.first, range.second)) {
          tds.SetEntry(slot, i);
-         auto val = **vals[slot];
-         EXPECT_EQ(ages[i], val);
+         EXPECT_EQ(ages[i], vals->Get<Long64_t>(i));
       }
       slot++;
    }
@@ -133,17 +135,16 @@ TEST(RCsvDS, ColumnReadersString)
    RCsvDS tds(fileName0);
    const auto nSlots = 3U;
    tds.SetNSlots(nSlots);
-   auto vals = tds.GetColumnReaders<std::string>("Name");
    tds.Initialize();
    auto ranges = tds.GetEntryRanges();
    auto slot = 0U;
    std::vector<std::string> names = {"Harry", "Bob,Bob", "\"Joe\"", "Tom", " John  ", " Mary Ann "};
    for (auto &&range : ranges) {
+      auto vals = tds.GetColumnReaders(slot, "Name", typeid(std::string));
       tds.InitSlot(slot, range.first);
       for (auto i : ROOT::TSeq<int>(range.first, range.second)) {
          tds.SetEntry(slot, i);
-         auto val = *((std::string *)*vals[slot]);
-         EXPECT_EQ(names[i], val);
+         EXPECT_EQ(names[i], vals->Get<std::string>(i));
       }
       slot++;
    }
@@ -155,7 +156,9 @@ TEST(RCsvDS, ProgressiveReadingEntryRanges)
    RCsvDS tds(fileName0, true, ',', chunkSize);
    const auto nSlots = 3U;
    tds.SetNSlots(nSlots);
-   auto vals = tds.GetColumnReaders<std::string>("Name");
+   std::vector<std::unique_ptr<ROOT::Detail::RDF::RColumnReaderBase>> vals;
+   for (auto slot = 0U; slot < nSlots; ++slot)
+      vals.emplace_back(tds.GetColumnReaders(slot, "Name", typeid(std::string)));
    tds.Initialize();
 
    std::vector<std::string> names = {"Harry", "Bob,Bob", "\"Joe\"", "Tom", " John  ", " Mary Ann "};
@@ -169,8 +172,7 @@ TEST(RCsvDS, ProgressiveReadingEntryRanges)
          tds.InitSlot(slot, range.first);
          for (auto i : ROOT::TSeq<int>(range.first, range.second)) {
             tds.SetEntry(slot, i);
-            auto val = *((std::string *)*vals[slot]);
-            EXPECT_EQ(names[i], val);
+            EXPECT_EQ(names[i], vals[slot]->Get<std::string>(i));
          }
          slot++;
       }
@@ -320,6 +322,34 @@ TEST(RCsvDS, ProgressiveReadingRDFMT)
    EXPECT_EQ(6U, *c2);
 }
 
+TEST(RCsvDS, ParallelParsingMT)
+{
+   // enough lines to be parsed by several tasks, in several batches, and in chunks that do not align with them
+   const auto fileName = "RCsvDS_test_parallel.csv";
+   const auto nLines = 100000;
+   {
+      std::ofstream out(fileName);
+      out << "i,x,even,label\n";
+      for (auto i = 0; i < nLines; ++i)
+         out << i << "," << 0.5 * i << "," << (i % 2 == 0 ? "true" : "false") << ",\"l" << i << "\"\n";
+   }
+
+   for (auto chunkSize : {-1LL, 30000LL}) {
+      auto df = ROOT::RDF::FromCSV(fileName, true, ',', chunkSize);
+      auto sumI = df.Sum<Long64_t>("i");
+      auto sumX = df.Sum<double>("x");
+      auto nEven = df.Filter([](bool e) { return e; }, {"even"}).Count();
+      auto nMismatches =
+         df.Filter([](Long64_t i, const std::string &l) { return l != "l" + std::to_string(i); }, {"i", "label"})
+            .Count();
+      EXPECT_EQ(nLines * (nLines - 1LL) / 2, *sumI);
+      EXPECT_DOUBLE_EQ(0.5 * nLines * (nLines - 1.) / 2, *sumX);
+      EXPECT_EQ(nLines / 2u, *nEven);
+      EXPECT_EQ(0u, *nMismatches);
+   }
+   gSystem->Unlink(fileName);
+}
+
 TEST(RCsvDS, SpecifyColumnTypes)
 {
    RCsvDS tds0(fileName0, true, ',', -1LL, {{"Age", 'D'}, {"Name", 'T'}}); // with headers
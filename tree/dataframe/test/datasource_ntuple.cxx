@@ -10,6 +10,12 @@
 
 #include <gtest/gtest.h>
 
+// This test is only built for root7 builds, which define R__HAS_ROOT7: fail loudly instead of testing a Snapshot
+// whose RNTuple output compiled away
+#ifndef R__HAS_ROOT7
+#error "R__HAS_ROOT7 must be defined by the root7 build of ROOTDataFrame"
+#endif
+
 using ROOT::Experimental::RNTupleDS;
 using ROOT::Experimental::RNTupleWriter;
 using ROOT::Experimental::RNTupleModel;
@@ -160,3 +166,171 @@ TEST_F(RNTupleDSTest, ReadMT)
    ReadTest(fNtplName, fFileName);
 }
 #endif
+
+class RNTupleDSChainTest : public ::testing::Test {
+protected:
+   std::string fNtplName = "ntuple";
+   std::vector<std::string> fFileNames{"RNTupleDS_chain_1.root", "RNTupleDS_chain_2.root", "RNTupleDS_chain_3.root",
+                                       "RNTupleDS_chain_4.root"};
+
+   void SetUp() override
+   {
+      // The third file is empty
+      const std::vector<int> nEntries{3, 5, 0, 4};
+      int value = 0;
+      for (std::size_t i = 0; i < fFileNames.size(); ++i) {
+         auto model = RNTupleModel::Create();
+         auto fldPt = model->MakeField<float>("pt");
+         auto fldJets = model->MakeField<std::vector<float>>("jets");
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), fNtplName, fFileNames[i]);
+         for (int j = 0; j < nEntries[i]; ++j) {
+            *fldPt = value;
+            *fldJets = std::vector<float>(value % 3, value);
+            ntuple->Fill();
+            value++;
+         }
+      }
+   }
+
+   void TearDown() override
+   {
+      for (const auto &f : fFileNames)
+         std::remove(f.c_str());
+   }
+};
+
+void ReadChainTest(const std::string &name, const std::vector<std::string> &fileNames)
+{
+   auto df = ROOT::RDF::Experimental::FromRNTuple(name, fileNames);
+
+   auto count = df.Count();
+   auto pts = df.Take<float>("pt");
+   auto entries = df.Take<ULong64_t>("rdfentry_");
+   auto njets = df.Take<std::size_t>("R_rdf_sizeof_jets");
+   auto sumjets = df.Sum<ROOT::RVec<float>>("jets");
+
+   EXPECT_EQ(12ull, count.GetValue());
+   auto sortedPts = *pts;
+   std::sort(sortedPts.begin(), sortedPts.end());
+   auto sortedEntries = *entries;
+   std::sort(sortedEntries.begin(), sortedEntries.end());
+   float expectedSumJets = 0;
+   for (int i = 0; i < 12; ++i) {
+      EXPECT_FLOAT_EQ(i, sortedPts[i]);
+      EXPECT_EQ(static_cast<ULong64_t>(i), sortedEntries[i]);
+      expectedSumJets += (i % 3) * i;
+   }
+   for (std::size_t i = 0; i < pts->size(); ++i) {
+      EXPECT_EQ(static_cast<std::size_t>(static_cast<int>(pts->at(i)) % 3), njets->at(i));
+   }
+   EXPECT_FLOAT_EQ(expectedSumJets, sumjets.GetValue());
+}
+
+TEST_F(RNTupleDSChainTest, Read)
+{
+   ReadChainTest(fNtplName, fFileNames);
+}
+
+/// The values of every entry must come from the file that contains it, also in a second event loop and for columns
+/// that are booked after the chain has been processed once. Entry i of the chain has pt == i.
+void ReadLaterFilesTest(const std::string &name, const std::vector<std::string> &fileNames)
+{
+   auto df = ROOT::RDF::Experimental::FromRNTuple(name, fileNames);
+   auto checkPt = [](ULong64_t entry, float pt) { return static_cast<float>(entry) == pt; };
+   auto checkJets = [](ULong64_t entry, const ROOT::RVec<float> &jets) {
+      return jets.size() == entry % 3 && ROOT::VecOps::All(jets == static_cast<float>(entry));
+   };
+
+   // Entries 0-2 are in the first file, the others come from the second and the fourth file
+   auto laterFiles = df.Filter([](ULong64_t entry) { return entry >= 3; }, {"rdfentry_"});
+   auto nGoodPt = laterFiles.Filter(checkPt, {"rdfentry_", "pt"}).Count();
+   auto sumPt = laterFiles.Sum<float>("pt");
+   EXPECT_EQ(9ull, *nGoodPt);
+   EXPECT_FLOAT_EQ(63.f, *sumPt);
+
+   // The second event loop switches back to the first file with the column readers that are already booked
+   auto nGoodJets = laterFiles.Filter(checkJets, {"rdfentry_", "jets"}).Count();
+   auto nGoodPtRerun = laterFiles.Filter(checkPt, {"rdfentry_", "pt"}).Count();
+   EXPECT_EQ(9ull, *nGoodJets);
+   EXPECT_EQ(9ull, *nGoodPtRerun);
+   EXPECT_EQ(12ull, *df.Filter(checkPt, {"rdfentry_", "pt"}).Count());
+}
+
+TEST_F(RNTupleDSChainTest, ReadLaterFiles)
+{
+   ReadLaterFilesTest(fNtplName, fFileNames);
+}
+
+TEST_F(RNTupleDSChainTest, Rerun)
+{
+   auto ds = std::make_unique<RNTupleDS>(fNtplName, fFileNames);
+   ds->SetPrefetchMemoryBudget(0);
+   ROOT::RDataFrame df(std::move(ds));
+   EXPECT_EQ(12ull, *df.Count());
+   // The second event loop has to start over from the first file
+   EXPECT_FLOAT_EQ(66.f, *df.Sum<float>("pt"));
+}
+
+TEST_F(RNTupleDSChainTest, SchemaMismatch)
+{
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<int>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), fNtplName, fFileNames[1]);
+      ntuple->Fill();
+   }
+   auto df = ROOT::RDF::Experimental::FromRNTuple(fNtplName, fFileNames);
+   EXPECT_THROW(*df.Count(), ROOT::Experimental::RException);
+}
+
+#ifdef R__USE_IMT
+TEST_F(RNTupleDSChainTest, ReadMT)
+{
+   IMTRAII _;
+
+   ReadChainTest(fNtplName, fFileNames);
+}
+
+TEST_F(RNTupleDSChainTest, ReadLaterFilesMT)
+{
+   IMTRAII _;
+
+   ReadLaterFilesTest(fNtplName, fFileNames);
+}
+#endif
+
+TEST(RNTupleDSSnapshot, Snapshot)
+{
+   const auto fname = "RNTupleDS_snapshot.root";
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto out = ROOT::RDataFrame(10)
+                 .Define("x", [](ULong64_t e) { return float(e); }, {"rdfentry_"})
+                 .Define("v", [](ULong64_t e) { return ROOT::RVecI(e, 1); }, {"rdfentry_"})
+                 .Snapshot<float, ROOT::RVecI>("ntpl", fname, {"x", "v"}, opts);
+
+   EXPECT_EQ(*out->Count(), 10u);
+   EXPECT_FLOAT_EQ(*out->Sum<float>("x"), 45.f);
+   EXPECT_EQ(*out->Define("n", [](const ROOT::RVecI &v) { return int(v.size()); }, {"v"}).Sum<int>("n"), 45);
+
+   auto reader = ROOT::Experimental::RNTupleReader::Open("ntpl", fname);
+   EXPECT_EQ(reader->GetNEntries(), 10u);
+   std::remove(fname);
+}
+
+#ifdef R__USE_IMT
+TEST(RNTupleDSSnapshot, SnapshotMT)
+{
+   IMTRAII _;
+
+   const auto fname = "RNTupleDS_snapshot_mt.root";
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   auto out = ROOT::RDataFrame(1000)
+                 .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                 .Snapshot<int>("ntpl", fname, {"x"}, opts);
+   EXPECT_EQ(*out->Count(), 1000u);
+   EXPECT_EQ(*out->Sum<int>("x"), 499500);
+   std::remove(fname);
+}
+#endif
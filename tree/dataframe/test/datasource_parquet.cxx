@@ -0,0 +1,103 @@
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RParquetDS.hxx>
+#include <TSystem.h>
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wshadow"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#endif
+#include <arrow/io/file.h>
+#include <arrow/memory_pool.h>
+#include <arrow/table.h>
+#include <arrow/testing/builder.h>
+#include <parquet/arrow/writer.h>
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace ROOT::RDF;
+
+// Write a file with 10 row groups of 10 entries: "x" goes from 0 to 99, "y" is 2 * x, "name" is "n" + x
+class RParquetDSTest : public ::testing::Test {
+protected:
+   static constexpr const char *fFileName = "RParquetDS_test.parquet";
+
+   static void SetUpTestCase()
+   {
+      std::vector<int64_t> x(100);
+      std::iota(x.begin(), x.end(), 0);
+      std::vector<double> y;
+      std::vector<std::string> names;
+      for (auto v : x) {
+         y.push_back(2. * v);
+         names.push_back("n" + std::to_string(v));
+      }
+      std::shared_ptr<arrow::Array> arrays[3];
+      arrow::ArrayFromVector<arrow::Int64Type, int64_t>(x, &arrays[0]);
+      arrow::ArrayFromVector<arrow::DoubleType, double>(y, &arrays[1]);
+      arrow::ArrayFromVector<arrow::StringType, std::string>(names, &arrays[2]);
+      auto schema = arrow::schema(
+         {arrow::field("x", arrow::int64()), arrow::field("y", arrow::float64()), arrow::field("name", arrow::utf8())});
+      auto table = arrow::Table::Make(schema, {arrays[0], arrays[1], arrays[2]});
+
+      auto outFile = arrow::io::FileOutputStream::Open(fFileName).ValueOrDie();
+      ASSERT_TRUE(parquet::arrow::WriteTable(*table, arrow::default_memory_pool(), outFile, 10).ok());
+      ASSERT_TRUE(outFile->Close().ok());
+   }
+
+   static void TearDownTestCase() { gSystem->Unlink(fFileName); }
+};
+
+TEST_F(RParquetDSTest, ColumnNamesAndTypes)
+{
+   RParquetDS ds(fFileName);
+   ASSERT_EQ(3u, ds.GetColumnNames().size());
+   EXPECT_EQ("Long64_t", ds.GetTypeName("x"));
+   EXPECT_EQ("double", ds.GetTypeName("y"));
+   EXPECT_EQ("string", ds.GetTypeName("name"));
+   EXPECT_EQ(10u, ds.GetNRowGroups());
+   EXPECT_EQ(10u, ds.GetNSelectedRowGroups());
+
+   RParquetDS projected(fFileName, {"y"});
+   EXPECT_TRUE(projected.HasColumn("y"));
+   EXPECT_FALSE(projected.HasColumn("x"));
+}
+
+TEST_F(RParquetDSTest, Read)
+{
+   auto df = FromParquet(fFileName);
+   EXPECT_EQ(100u, *df.Count());
+   EXPECT_EQ(4950, *df.Sum<Long64_t>("x"));
+   EXPECT_DOUBLE_EQ(9900., *df.Sum<double>("y"));
+   EXPECT_EQ("n42", df.Filter("x == 42").Take<std::string>("name")->front());
+}
+
+TEST_F(RParquetDSTest, Filter)
+{
+   auto ds = std::make_unique<RParquetDS>(fFileName, std::vector<std::string>{}, "x >= 25 && y < 100");
+   // the row groups with x in [0, 20) and [50, 100) cannot contain entries that pass the filter
+   EXPECT_EQ(3u, ds->GetNSelectedRowGroups());
+   ROOT::RDataFrame df(std::move(ds));
+   EXPECT_EQ(25u, *df.Count());
+   EXPECT_EQ(25, *df.Min<Long64_t>("x"));
+   EXPECT_EQ(49, *df.Max<Long64_t>("x"));
+
+   EXPECT_THROW(RParquetDS(fFileName, {}, "x > y"), std::runtime_error);
+   EXPECT_THROW(RParquetDS(fFileName, {}, "name > 3"), std::runtime_error);
+}
+
+#ifdef R__USE_IMT
+TEST_F(RParquetDSTest, ReadMT)
+{
+   ROOT::EnableImplicitMT(4);
+   auto df = FromParquet(fFileName, {"x", "y"}, "x < 95");
+   EXPECT_EQ(95u, *df.Count());
+   EXPECT_EQ(4465, *df.Sum<Long64_t>("x"));
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -194,8 +194,71 @@ TEST(RSqliteDS, SetEntry)
    EXPECT_EQ(nullptr, **vnull[0]);
 }
 
+TEST(RSqliteDS, Table)
+{
+   RSqliteDS rds(fileName0, "test", "");
+   rds.SetNSlots(2);
+   auto colNames = rds.GetColumnNames();
+   EXPECT_EQ(5U, colNames.size());
+   EXPECT_EQ("Long64_t", rds.GetTypeName("fint"));
+   EXPECT_EQ("std::string", rds.GetTypeName("ftext"));
+
+   auto vint = rds.GetColumnReaders<Long64_t>("fint");
+   auto vtext = rds.GetColumnReaders<std::string>("ftext");
+   rds.Initialize();
+   auto ranges = rds.GetEntryRanges();
+   ASSERT_EQ(2U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(ranges[0].second, ranges[1].first);
+   EXPECT_EQ(2U, ranges[1].second);
+   EXPECT_TRUE(rds.GetEntryRanges().empty());
+
+   // Each slot reads with its own statement, in any order
+   EXPECT_TRUE(rds.SetEntry(1, 1));
+   EXPECT_TRUE(rds.SetEntry(0, 0));
+   EXPECT_EQ(1, **vint[0]);
+   EXPECT_EQ("1", **vtext[0]);
+   EXPECT_EQ(2, **vint[1]);
+   EXPECT_EQ("2", **vtext[1]);
+   EXPECT_TRUE(rds.SetEntry(0, 1));
+   EXPECT_EQ(2, **vint[0]);
+   EXPECT_TRUE(rds.SetEntry(0, 0));
+   EXPECT_EQ(1, **vint[0]);
+
+   EXPECT_THROW(RSqliteDS(fileName0, "nosuchtable", ""), std::runtime_error);
+}
+
+TEST(RSqliteDS, TableWhere)
+{
+   RSqliteDS rds(fileName0, "test", "fint > 1");
+   rds.SetNSlots(1);
+   auto vreal = rds.GetColumnReaders<double>("freal");
+   rds.Initialize();
+   auto ranges = rds.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   EXPECT_EQ(0U, ranges[0].first);
+   EXPECT_EQ(1U, ranges[0].second);
+   EXPECT_TRUE(rds.SetEntry(0, 0));
+   EXPECT_NEAR(2.0, **vreal[0], epsilon);
+
+   auto rdf = ROOT::RDF::FromSqliteTable(fileName0, "test", "ftext = '1'");
+   EXPECT_EQ(1U, *rdf.Count());
+   EXPECT_EQ(1, *rdf.Sum<Long64_t>("fint"));
+   EXPECT_EQ(0U, *ROOT::RDF::FromSqliteTable(fileName0, "test", "fint > 2").Count());
+}
+
 #ifdef R__USE_IMT
 
+TEST(RSqliteDS, IMTTable)
+{
+   ROOT::EnableImplicitMT(4);
+   auto rdf = ROOT::RDF::FromSqliteTable(fileName0, "test");
+   EXPECT_EQ(2U, *rdf.Count());
+   EXPECT_EQ(3, *rdf.Sum<Long64_t>("fint"));
+   EXPECT_NEAR(3.0, *rdf.Sum<double>("freal"), epsilon);
+   ROOT::DisableImplicitMT();
+}
+
 TEST(RSqliteDS, IMT)
 {
    using Blob_t = std::vector<unsigned char>;
@@ -2,9 +2,13 @@
 #include <ROOT/RDataFrame.hxx>
 #include <ROOT/RDataSource.hxx>
 #include <ROOT/TSeq.hxx>
+#include <TEnv.h>
 #include <TROOT.h>
 #include <TSystem.h>
 
+#include <chrono>
+#include <thread>
+
 #include "gtest/gtest.h"
 
 using namespace ROOT;
@@ -242,4 +246,26 @@ TEST(RTrivialDS, SkipEntriesMT)
    EXPECT_EQ(*tdfAll.Count(), 80ULL);
 }
 
+TEST(RTrivialDS, DynamicSchedulingMT)
+{
+   ROOT::EnableImplicitMT(4);
+   gEnv->SetValue("RDataFrame.DynamicScheduling", 1);
+   const ULong64_t nEntries = 100000;
+   RDataFrame df(std::make_unique<RTrivialDS>(nEntries));
+   // the first entries are much more expensive than the others, other slots have to split their range
+   auto sum = df.Define("x",
+                        [](ULong64_t e) {
+                           if (e < 1000)
+                              std::this_thread::sleep_for(std::chrono::microseconds(10));
+                           return e;
+                        },
+                        {"col0"})
+                 .Sum<ULong64_t>("x");
+   auto count = df.Count();
+   EXPECT_EQ(nEntries * (nEntries - 1) / 2, *sum);
+   EXPECT_EQ(nEntries, *count);
+   gEnv->SetValue("RDataFrame.DynamicScheduling", 0);
+   ROOT::DisableImplicitMT();
+}
+
 #endif // R__USE_IMT
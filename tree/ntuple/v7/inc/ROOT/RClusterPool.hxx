@@ -19,7 +19,9 @@
 #include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <atomic>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -50,6 +52,15 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+Alternatively, with RNTupleReadOptions::SetUseBackgroundUnzip(), the pages are uncompressed sequentially by the unzip
+thread, i.e. in the background of the thread that reads the ntuple.
+
+If the maximum cluster bunch size is larger than the minimum one, the bunch size is adaptive: the I/O thread
+fits the wall time of its reads as a linear function of the number of bytes read, which separates the per-request
+latency from the bandwidth of the storage.  The bunch size then grows until the latency is amortized over a
+sufficiently large read, which favors large bunches on high-latency links and small bunches on local storage.
+The estimated break-even gap, i.e. the number of bytes that can be transferred in the time of one request latency,
+is available to the page source in order to coalesce requests of neighboring clusters.
 */
 // clang-format on
 class RClusterPool {
@@ -94,12 +105,40 @@ private:
    /// The number of clusters before the currently active cluster that should stay in the pool if present
    /// Reserved for later use.
    unsigned int fWindowPre = 0;
-   /// The number of clusters that are being read in a single vector read.
-   unsigned int fClusterBunchSize;
+   /// Exponentially decaying least-squares fit of the wall time t of RPageSource::LoadClusters() calls
+   /// as a linear function of the number of bytes b read by the call, t = latency + b / bandwidth
+   struct RReadStatistics {
+      /// Weight of the previous observations with every new observation
+      static constexpr double kDecay = 0.9;
+      double fWeight = 0.;
+      double fSumBytes = 0.;
+      double fSumBytes2 = 0.;
+      double fSumTime = 0.;
+      double fSumBytesTime = 0.;
+      double fSumClusters = 0.;
+
+      void Add(double bytes, double seconds, std::size_t nClusters);
+      /// Returns false if the observed read sizes do not vary sufficiently to distinguish latency from bandwidth
+      bool Estimate(double &latency, double &secondsPerByte) const;
+   };
+
+   /// The number of clusters that are being read in a single vector read. Adjusted by the I/O thread within
+   /// [fMinClusterBunchSize, fMaxClusterBunchSize] in adaptive mode.
+   std::atomic<unsigned int> fClusterBunchSize;
+   unsigned int fMinClusterBunchSize;
+   unsigned int fMaxClusterBunchSize;
+   /// The number of bunches that are preloaded after the bunch of the currently active cluster. The I/O thread
+   /// combines up to this number of bunches into a single call to RPageSource::LoadClusters().
+   unsigned int fBunchQueueDepth;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
    std::vector<std::unique_ptr<RCluster>> fPool;
+   /// Only used by the I/O thread in adaptive mode
+   RReadStatistics fReadStatistics;
+   /// The largest gap in bytes between the requests of neighboring clusters that should be bridged by reading the
+   /// superfluous bytes instead of issuing a separate request. Zero unless the bunch size is adaptive.
+   std::atomic<std::uint64_t> fReadCoalesceGap{0};
 
    /// Protects the shared state between the main thread and the pipeline threads, namely the read and unzip
    /// work queues and the in-flight clusters vector
@@ -140,10 +179,27 @@ private:
    /// Executed at the end of GetCluster when all missing data pieces have been sent to the load queue.
    /// Ideally, the function returns without blocking if the cluster is already in the pool.
    RCluster *WaitFor(DescriptorId_t clusterId, const RCluster::ColumnSet_t &physicalColumns);
+   /// Called by the I/O thread in adaptive mode after every RPageSource::LoadClusters() call in order to update
+   /// the latency and bandwidth estimate, the cluster bunch size and the read coalesce gap
+   void AdaptClusterBunchSize(std::uint64_t bytes, double seconds, std::size_t nClusters);
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
-   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
+   static constexpr unsigned int kDefaultBunchQueueDepth = 1;
+   /// Fraction of the read time that the adaptive mode tolerates to be spent waiting for the request latency
+   static constexpr double kMaxLatencyFraction = 0.1;
+   /// If maxClusterBunchSize is larger than clusterBunchSize, the bunch size adapts to the measured read latency
+   /// and bandwidth, starting with clusterBunchSize
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize, unsigned int bunchQueueDepth,
+                unsigned int maxClusterBunchSize);
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize, unsigned int bunchQueueDepth)
+      : RClusterPool(pageSource, clusterBunchSize, bunchQueueDepth, clusterBunchSize)
+   {
+   }
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+      : RClusterPool(pageSource, clusterBunchSize, kDefaultBunchQueueDepth)
+   {
+   }
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
@@ -151,7 +207,7 @@ public:
 
    /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
    /// the cluster in the pool, blocks until done, and then returns it.  Triggers along the way the background loading
-   /// of the following fWindowPost number of clusters.  The returned cluster has at least all the pages of
+   /// of the following fBunchQueueDepth bunches of clusters.  The returned cluster has at least all the pages of
    /// `physicalColumns` and possibly pages of other columns, too.  If implicit multi-threading is turned on, the
    /// uncompressed pages of the returned cluster are already pushed into the page pool associated with the page source
    /// upon return. The cluster remains valid until the next call to GetCluster().
@@ -159,6 +215,11 @@ public:
 
    /// Used by the unit tests to drain the queue of clusters to be preloaded
    void WaitForInFlightClusters();
+
+   unsigned int GetClusterBunchSize() const { return fClusterBunchSize; }
+   bool IsAdaptive() const { return fMaxClusterBunchSize > fMinClusterBunchSize; }
+   /// Used by the page source in LoadClusters() to coalesce the read requests of neighboring clusters
+   std::uint64_t GetReadCoalesceGap() const { return fReadCoalesceGap; }
 }; // class RClusterPool
 
 } // namespace Detail
@@ -25,6 +25,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <cstring> // for memcpy
 #include <memory>
 #include <utility>
@@ -104,7 +105,7 @@ public:
    static std::unique_ptr<RColumn> Create(const RColumnModel &model, std::uint32_t index)
    {
       auto column = std::unique_ptr<RColumn>(new RColumn(model, index));
-      column->fElement = RColumnElementBase::Generate<CppT>(model.GetType());
+      column->fElement = RColumnElementBase::Generate<CppT>(model);
       return column;
    }
 
@@ -134,33 +135,31 @@ public:
 
    void AppendV(const void *from, std::size_t count)
    {
-      // We might not have enough space in the current page. In this case, fall back to one by one filling.
-      if (fWritePage[fWritePageIdx].GetNElements() + count > fApproxNElementsPerPage) {
-         // TODO(jblomer): use (fewer) calls to AppendV to write the data page-by-page
-         for (unsigned i = 0; i < count; ++i) {
-            Append(static_cast<const unsigned char *>(from) + fElement->GetSize() * i);
+      auto src = static_cast<const unsigned char *>(from);
+      const auto elemSize = fElement->GetSize();
+      // Fill the current write page up to the target size, then continue with the next one
+      while (count > 0) {
+         const auto nInPage = fWritePage[fWritePageIdx].GetNElements();
+         const std::size_t n = std::min<std::size_t>(count, fApproxNElementsPerPage - nInPage);
+
+         // The check for flushing the shadow page is more complicated than for the Append() case
+         // because we don't necessarily fill up to exactly fApproxNElementsPerPage / 2 elements;
+         // we might instead jump over the 50% fill level.
+         // This check should be done before calling `RPage::GrowUnchecked()` as the latter affects the return value
+         // of `RPage::GetNElements()`.
+         if ((nInPage < fApproxNElementsPerPage / 2) && (nInPage + n >= fApproxNElementsPerPage / 2)) {
+            FlushShadowWritePage();
          }
-         return;
-      }
 
-      // The check for flushing the shadow page is more complicated than for the Append() case
-      // because we don't necessarily fill up to exactly fApproxNElementsPerPage / 2 elements;
-      // we might instead jump over the 50% fill level.
-      // This check should be done before calling `RPage::GrowUnchecked()` as the latter affects the return value of
-      // `RPage::GetNElements()`.
-      if ((fWritePage[fWritePageIdx].GetNElements() < fApproxNElementsPerPage / 2) &&
-          (fWritePage[fWritePageIdx].GetNElements() + count >= fApproxNElementsPerPage / 2))
-      {
-         FlushShadowWritePage();
-      }
+         void *dst = fWritePage[fWritePageIdx].GrowUnchecked(n);
+         std::memcpy(dst, src, elemSize * n);
+         fNElements += n;
+         src += elemSize * n;
+         count -= n;
 
-      void *dst = fWritePage[fWritePageIdx].GrowUnchecked(count);
-
-      std::memcpy(dst, from, fElement->GetSize() * count);
-      fNElements += count;
-
-      // Note that by the very first check in AppendV, we cannot have filled more than fApproxNElementsPerPage elements
-      SwapWritePagesIfFull();
+         // By construction of n, we cannot have filled more than fApproxNElementsPerPage elements
+         SwapWritePagesIfFull();
+      }
    }
 
    void Read(const NTupleSize_t globalIndex, void *to)
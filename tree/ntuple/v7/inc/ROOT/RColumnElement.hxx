@@ -24,12 +24,14 @@
 #include <Byteswap.h>
 #include <TError.h>
 
+#include <algorithm>
 #include <cstring> // for memcpy
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <utility>
 
 #ifndef R__LITTLE_ENDIAN
 #ifdef R__BYTESWAP
@@ -40,6 +42,36 @@
 #endif
 #endif /* R__LITTLE_ENDIAN */
 
+namespace ROOT {
+namespace Experimental {
+namespace Internal {
+
+/// \brief Distribute the bytes of `n` elements of size `elementSize` to the byte streams of a split array
+///
+/// Byte `b` of the ith element in `source` is stored at `splitArray[b * count + offset + i]`, where `count` is the
+/// total number of elements of the split array.  Uses SIMD instructions for the common element sizes where available.
+void SplitBytes(void *splitArray, const void *source, std::size_t count, std::size_t offset, std::size_t n,
+                std::size_t elementSize);
+
+/// \brief Collect `n` elements of size `elementSize` starting at element `offset` from a split array of `count` elements
+///
+/// Byte `b` of the ith element written to `destination` is read from `splitArray[b * count + offset + i]`.  Uses
+/// SIMD instructions for the common element sizes (2, 4, 8 bytes) where available.
+void UnsplitBytes(void *destination, const void *splitArray, std::size_t count, std::size_t offset, std::size_t n,
+                  std::size_t elementSize);
+
+/// \brief Pack the lower `nBits` bits of `count` values into a little-endian bit stream of `(count * nBits + 7) / 8` bytes
+///
+/// `nBits` must be between 1 and 32.  The packing does not depend on the byte order of the machine.
+void PackBits(void *destination, const std::uint32_t *source, std::size_t count, std::size_t nBits);
+
+/// \brief Reverse operation of PackBits(): read `count` values of `nBits` bits each from the bit stream in `source`
+void UnpackBits(std::uint32_t *destination, const void *source, std::size_t count, std::size_t nBits);
+
+} // namespace Internal
+} // namespace Experimental
+} // namespace ROOT
+
 namespace {
 
 // In this namespace, common routines are defined for element packing and unpacking of ints and floats.
@@ -125,6 +157,27 @@ static void CastUnpack(void *destination, const void *source, std::size_t count)
    }
 }
 
+/// Number of elements that are (un)split together.  The on-disk values of a block are staged in a small buffer on the
+/// stack, such that the conversions (cast, byteswap, delta, zigzag) and the byte (un)shuffling are separate loops.
+/// The (un)shuffling of a block is implemented by the SIMD kernels SplitBytes() and UnsplitBytes().
+static constexpr std::size_t kSplitBlockSize = 64;
+
+/// \brief Split the bytes of `n` elements of size `N` to the byte streams of a split array of `count` elements
+///
+/// Byte `b` of the ith element in `src` is stored at `splitArray[b * count + offset + i]`.
+template <std::size_t N>
+static void SplitBlock(char *splitArray, const void *src, std::size_t count, std::size_t offset, std::size_t n)
+{
+   ROOT::Experimental::Internal::SplitBytes(splitArray, src, count, offset, n, N);
+}
+
+/// \brief Reverse operation of SplitBlock(): collect `n` elements of size `N` starting at element `offset`
+template <std::size_t N>
+static void UnsplitBlock(void *dst, const char *splitArray, std::size_t count, std::size_t offset, std::size_t n)
+{
+   ROOT::Experimental::Internal::UnsplitBytes(dst, splitArray, count, offset, n, N);
+}
+
 /// \brief Split encoding of elements, possibly into narrower column
 ///
 /// Used to first cast and then split-encode in-memory values to the on-disk column. Swap bytes if necessary.
@@ -134,12 +187,19 @@ static void CastSplitPack(void *destination, const void *source, std::size_t cou
    constexpr std::size_t N = sizeof(DestT);
    auto splitArray = reinterpret_cast<char *>(destination);
    auto src = reinterpret_cast<const SourceT *>(source);
-   for (std::size_t i = 0; i < count; ++i) {
-      DestT val = src[i];
-      ByteSwapIfNecessary(val);
-      for (std::size_t b = 0; b < N; ++b) {
-         splitArray[b * count + i] = reinterpret_cast<const char *>(&val)[b];
+   if constexpr (std::is_same_v<DestT, SourceT> && R__LITTLE_ENDIAN) {
+      // No conversion necessary: split directly from the source
+      SplitBlock<N>(splitArray, src, count, 0, count);
+      return;
+   }
+   DestT block[kSplitBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+      const std::size_t n = std::min(kSplitBlockSize, count - offset);
+      for (std::size_t i = 0; i < n; ++i) {
+         block[i] = src[offset + i];
+         ByteSwapIfNecessary(block[i]);
       }
+      SplitBlock<N>(splitArray, block, count, offset, n);
    }
 }
 
@@ -152,13 +212,19 @@ static void CastSplitUnpack(void *destination, const void *source, std::size_t c
    constexpr std::size_t N = sizeof(SourceT);
    auto dst = reinterpret_cast<DestT *>(destination);
    auto splitArray = reinterpret_cast<const char *>(source);
-   for (std::size_t i = 0; i < count; ++i) {
-      SourceT val = 0;
-      for (std::size_t b = 0; b < N; ++b) {
-         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
+   if constexpr (std::is_same_v<DestT, SourceT> && R__LITTLE_ENDIAN) {
+      // No conversion necessary: unsplit directly into the destination
+      UnsplitBlock<N>(dst, splitArray, count, 0, count);
+      return;
+   }
+   SourceT block[kSplitBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+      const std::size_t n = std::min(kSplitBlockSize, count - offset);
+      UnsplitBlock<N>(block, splitArray, count, offset, n);
+      for (std::size_t i = 0; i < n; ++i) {
+         ByteSwapIfNecessary(block[i]);
+         dst[offset + i] = block[i];
       }
-      ByteSwapIfNecessary(val);
-      dst[i] = val;
    }
 }
 
@@ -171,12 +237,15 @@ static void CastDeltaSplitPack(void *destination, const void *source, std::size_
    constexpr std::size_t N = sizeof(DestT);
    auto src = reinterpret_cast<const SourceT *>(source);
    auto splitArray = reinterpret_cast<char *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
-      DestT val = (i == 0) ? src[0] : src[i] - src[i - 1];
-      ByteSwapIfNecessary(val);
-      for (std::size_t b = 0; b < N; ++b) {
-         splitArray[b * count + i] = reinterpret_cast<char *>(&val)[b];
+   DestT block[kSplitBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+      const std::size_t n = std::min(kSplitBlockSize, count - offset);
+      for (std::size_t i = 0; i < n; ++i) {
+         const auto idx = offset + i;
+         block[i] = (idx == 0) ? src[0] : src[idx] - src[idx - 1];
+         ByteSwapIfNecessary(block[i]);
       }
+      SplitBlock<N>(splitArray, block, count, offset, n);
    }
 }
 
@@ -189,13 +258,16 @@ static void CastDeltaSplitUnpack(void *destination, const void *source, std::siz
    constexpr std::size_t N = sizeof(SourceT);
    auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
-      SourceT val = 0;
-      for (std::size_t b = 0; b < N; ++b) {
-         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
+   SourceT block[kSplitBlockSize];
+   DestT prev = 0;
+   for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+      const std::size_t n = std::min(kSplitBlockSize, count - offset);
+      UnsplitBlock<N>(block, splitArray, count, offset, n);
+      for (std::size_t i = 0; i < n; ++i) {
+         ByteSwapIfNecessary(block[i]);
+         prev = prev + block[i];
+         dst[offset + i] = prev;
       }
-      ByteSwapIfNecessary(val);
-      dst[i] = (i == 0) ? val : dst[i - 1] + val;
    }
 }
 
@@ -210,12 +282,15 @@ static void CastZigzagSplitPack(void *destination, const void *source, std::size
    constexpr std::size_t N = sizeof(DestT);
    auto src = reinterpret_cast<const SourceT *>(source);
    auto splitArray = reinterpret_cast<char *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
-      UDestT val = (static_cast<DestT>(src[i]) << 1) ^ (static_cast<DestT>(src[i]) >> (kNBitsDestT - 1));
-      ByteSwapIfNecessary(val);
-      for (std::size_t b = 0; b < N; ++b) {
-         splitArray[b * count + i] = reinterpret_cast<char *>(&val)[b];
+   UDestT block[kSplitBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+      const std::size_t n = std::min(kSplitBlockSize, count - offset);
+      for (std::size_t i = 0; i < n; ++i) {
+         const auto val = static_cast<DestT>(src[offset + i]);
+         block[i] = (val << 1) ^ (val >> (kNBitsDestT - 1));
+         ByteSwapIfNecessary(block[i]);
       }
+      SplitBlock<N>(splitArray, block, count, offset, n);
    }
 }
 
@@ -229,13 +304,15 @@ static void CastZigzagSplitUnpack(void *destination, const void *source, std::si
    constexpr std::size_t N = sizeof(SourceT);
    auto splitArray = reinterpret_cast<const char *>(source);
    auto dst = reinterpret_cast<DestT *>(destination);
-   for (std::size_t i = 0; i < count; ++i) {
-      USourceT val = 0;
-      for (std::size_t b = 0; b < N; ++b) {
-         reinterpret_cast<char *>(&val)[b] = splitArray[b * count + i];
+   USourceT block[kSplitBlockSize];
+   for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+      const std::size_t n = std::min(kSplitBlockSize, count - offset);
+      UnsplitBlock<N>(block, splitArray, count, offset, n);
+      for (std::size_t i = 0; i < n; ++i) {
+         USourceT val = block[i];
+         ByteSwapIfNecessary(val);
+         dst[offset + i] = static_cast<SourceT>((val >> 1) ^ -(static_cast<SourceT>(val) & 1));
       }
-      ByteSwapIfNecessary(val);
-      dst[i] = static_cast<SourceT>((val >> 1) ^ -(static_cast<SourceT>(val) & 1));
    }
 }
 
@@ -277,12 +354,32 @@ public:
    /// If CppT == void, use the default C++ type for the given column type
    template <typename CppT = void>
    static std::unique_ptr<RColumnElementBase> Generate(EColumnType type);
+   /// Like Generate(EColumnType) but also applies the bit width and the value range of the column model, which are
+   /// needed for the column types with a configurable width such as kReal32Trunc and kReal32Quant
+   template <typename CppT = void>
+   static std::unique_ptr<RColumnElementBase> Generate(const RColumnModel &model);
+   /// The default number of bits per element of the column type
    static std::size_t GetBitsOnStorage(EColumnType type);
+   /// The number of bits per element of the column model, i.e. its bit width if set or the default of its type
+   static std::size_t GetBitsOnStorage(const RColumnModel &model);
+   /// The smallest and the largest valid number of bits per element of the column type, equal for fixed width types
+   static std::pair<std::size_t, std::size_t> GetValidBitRange(EColumnType type);
    static std::string GetTypeName(EColumnType type);
 
    /// Derived, typed classes tell whether the on-storage layout is bitwise identical to the memory layout
    virtual bool IsMappable() const { R__ASSERT(false); return false; }
    virtual std::size_t GetBitsOnStorage() const { R__ASSERT(false); return 0; }
+   /// Only column types with a configurable width accept a number of bits different from their default
+   virtual void SetBitsOnStorage(std::size_t bitsOnStorage)
+   {
+      if (bitsOnStorage != GetBitsOnStorage())
+         throw RException(R__FAIL("invalid number of bits on storage: " + std::to_string(bitsOnStorage)));
+   }
+   /// Only quantized column types have a value range
+   virtual void SetValueRange(double /* min */, double /* max */)
+   {
+      throw RException(R__FAIL("the column type does not support a value range"));
+   }
 
    /// If the on-storage layout and the in-memory layout differ, packing creates an on-disk page from an in-memory page
    virtual void Pack(void *destination, void *source, std::size_t count) const
@@ -409,6 +506,147 @@ public:
    }
 }; // class RColumnElementZigzagSplitLE
 
+/**
+ * Base class for floating point columns whose elements are stored as 32 bit floats with a truncated mantissa.
+ * The upper `fBitsOnStorage` bits of the float, i.e. the sign, the exponent and the most significant bits of the
+ * mantissa, are rounded to nearest and bit-packed.  Infinities and NaNs are preserved, except for the NaN payload.
+ */
+template <typename CppT>
+class RColumnElementTruncReal32 : public RColumnElementBase {
+protected:
+   std::size_t fBitsOnStorage = kMaxBits;
+
+   explicit RColumnElementTruncReal32(std::size_t size) : RColumnElementBase(size) {}
+
+public:
+   /// Sign, exponent and at least one bit of mantissa
+   static constexpr std::size_t kMinBits = 10;
+   static constexpr std::size_t kMaxBits = 31;
+   static constexpr bool kIsMappable = false;
+
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final
+   {
+      if (bitsOnStorage < kMinBits || bitsOnStorage > kMaxBits)
+         throw RException(R__FAIL("invalid number of bits for a truncated float: " + std::to_string(bitsOnStorage)));
+      fBitsOnStorage = bitsOnStorage;
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      const auto shift = 32 - fBitsOnStorage;
+      auto srcArray = reinterpret_cast<const CppT *>(src);
+      auto dstBytes = reinterpret_cast<unsigned char *>(dst);
+      // blocks of a multiple of 8 elements start at a byte boundary of the bit stream
+      std::uint32_t block[kSplitBlockSize];
+      for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+         const std::size_t n = std::min(kSplitBlockSize, count - offset);
+         for (std::size_t i = 0; i < n; ++i) {
+            const float value = srcArray[offset + i];
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            // round to nearest, unless the exponent is all ones (inf, NaN)
+            if ((bits & 0x7f800000) != 0x7f800000) {
+               const std::uint32_t rounded = bits + (std::uint32_t(1) << (shift - 1));
+               // do not round into the inf/NaN exponent
+               if ((rounded & 0x7f800000) != 0x7f800000)
+                  bits = rounded;
+            }
+            block[i] = bits >> shift;
+         }
+         ROOT::Experimental::Internal::PackBits(dstBytes + offset * fBitsOnStorage / 8, block, n, fBitsOnStorage);
+      }
+   }
+
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      const auto shift = 32 - fBitsOnStorage;
+      auto dstArray = reinterpret_cast<CppT *>(dst);
+      auto srcBytes = reinterpret_cast<const unsigned char *>(src);
+      std::uint32_t block[kSplitBlockSize];
+      for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+         const std::size_t n = std::min(kSplitBlockSize, count - offset);
+         ROOT::Experimental::Internal::UnpackBits(block, srcBytes + offset * fBitsOnStorage / 8, n, fBitsOnStorage);
+         for (std::size_t i = 0; i < n; ++i) {
+            const std::uint32_t bits = block[i] << shift;
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            dstArray[offset + i] = value;
+         }
+      }
+   }
+}; // class RColumnElementTruncReal32
+
+/**
+ * Base class for floating point columns whose values are quantized to `fBitsOnStorage` bits integers: the value range
+ * [min, max] is divided in 2^fBitsOnStorage - 1 equal steps, values outside the range are clamped to its limits and
+ * NaNs are stored as min.  The integers are bit-packed.
+ */
+template <typename CppT>
+class RColumnElementQuantReal32 : public RColumnElementBase {
+protected:
+   std::size_t fBitsOnStorage = kMaxBits;
+   double fMin = 0.;
+   double fMax = 1.;
+
+   explicit RColumnElementQuantReal32(std::size_t size) : RColumnElementBase(size) {}
+
+public:
+   static constexpr std::size_t kMinBits = 1;
+   static constexpr std::size_t kMaxBits = 32;
+   static constexpr bool kIsMappable = false;
+
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::size_t bitsOnStorage) final
+   {
+      if (bitsOnStorage < kMinBits || bitsOnStorage > kMaxBits)
+         throw RException(R__FAIL("invalid number of bits for a quantized float: " + std::to_string(bitsOnStorage)));
+      fBitsOnStorage = bitsOnStorage;
+   }
+   void SetValueRange(double min, double max) final
+   {
+      if (!(min < max))
+         throw RException(R__FAIL("invalid value range of a quantized float"));
+      fMin = min;
+      fMax = max;
+   }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      const double nSteps = static_cast<double>((std::uint64_t(1) << fBitsOnStorage) - 1);
+      const double scale = nSteps / (fMax - fMin);
+      auto srcArray = reinterpret_cast<const CppT *>(src);
+      auto dstBytes = reinterpret_cast<unsigned char *>(dst);
+      std::uint32_t block[kSplitBlockSize];
+      for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+         const std::size_t n = std::min(kSplitBlockSize, count - offset);
+         for (std::size_t i = 0; i < n; ++i) {
+            const double value = srcArray[offset + i];
+            // the negated comparison maps NaN to min
+            const double step = !(value > fMin) ? 0. : (value >= fMax ? nSteps : (value - fMin) * scale + 0.5);
+            block[i] = static_cast<std::uint32_t>(std::min(step, nSteps));
+         }
+         ROOT::Experimental::Internal::PackBits(dstBytes + offset * fBitsOnStorage / 8, block, n, fBitsOnStorage);
+      }
+   }
+
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      const double stepSize = (fMax - fMin) / static_cast<double>((std::uint64_t(1) << fBitsOnStorage) - 1);
+      auto dstArray = reinterpret_cast<CppT *>(dst);
+      auto srcBytes = reinterpret_cast<const unsigned char *>(src);
+      std::uint32_t block[kSplitBlockSize];
+      for (std::size_t offset = 0; offset < count; offset += kSplitBlockSize) {
+         const std::size_t n = std::min(kSplitBlockSize, count - offset);
+         ROOT::Experimental::Internal::UnpackBits(block, srcBytes + offset * fBitsOnStorage / 8, n, fBitsOnStorage);
+         for (std::size_t i = 0; i < n; ++i)
+            dstArray[offset + i] = static_cast<CppT>(fMin + block[i] * stepSize);
+      }
+   }
+}; // class RColumnElementQuantReal32
+
 ////////////////////////////////////////////////////////////////////////////////
 // Pairs of C++ type and column type, like float and EColumnType::kReal32
 ////////////////////////////////////////////////////////////////////////////////
@@ -683,6 +921,20 @@ DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal64, 64, RColumnElemen
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kReal32, 32, RColumnElementCastLE, <double, float>);
 DECLARE_RCOLUMNELEMENT_SPEC(double, EColumnType::kSplitReal32, 32, RColumnElementSplitLE, <double, float>);
 
+/// The truncated and quantized float column types have a configurable bit width, see RColumnModel::SetBitsOnStorage()
+#define DECLARE_RCOLUMNELEMENT_SPEC_VARWIDTH(CppT, ColumnT, BaseT) \
+   template <>                                                     \
+   class RColumnElement<CppT, ColumnT> : public BaseT<CppT> {      \
+   public:                                                         \
+      static constexpr std::size_t kSize = sizeof(CppT);           \
+      RColumnElement() : BaseT<CppT>(kSize) {}                     \
+   }
+
+DECLARE_RCOLUMNELEMENT_SPEC_VARWIDTH(float, EColumnType::kReal32Trunc, RColumnElementTruncReal32);
+DECLARE_RCOLUMNELEMENT_SPEC_VARWIDTH(float, EColumnType::kReal32Quant, RColumnElementQuantReal32);
+DECLARE_RCOLUMNELEMENT_SPEC_VARWIDTH(double, EColumnType::kReal32Trunc, RColumnElementTruncReal32);
+DECLARE_RCOLUMNELEMENT_SPEC_VARWIDTH(double, EColumnType::kReal32Quant, RColumnElementQuantReal32);
+
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex64, 64, RColumnElementLE, <std::uint64_t>);
 DECLARE_RCOLUMNELEMENT_SPEC(ClusterSize_t, EColumnType::kIndex32, 32, RColumnElementCastLE,
                             <std::uint64_t, std::uint32_t>);
@@ -721,6 +973,8 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<CppT, EColumnType::kSplitUInt16>>();
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Trunc>>();
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<CppT, EColumnType::kReal32Quant>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -730,6 +984,17 @@ std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(EColumnType typ
 template <>
 std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate<void>(EColumnType type);
 
+template <typename CppT>
+std::unique_ptr<RColumnElementBase> RColumnElementBase::Generate(const RColumnModel &model)
+{
+   auto element = Generate<CppT>(model.GetType());
+   if (model.GetBitsOnStorage() > 0)
+      element->SetBitsOnStorage(model.GetBitsOnStorage());
+   if (model.GetType() == EColumnType::kReal32Quant)
+      element->SetValueRange(model.GetValueRange().first, model.GetValueRange().second);
+   return element;
+}
+
 } // namespace Detail
 } // namespace Experimental
 } // namespace ROOT
@@ -18,7 +18,9 @@
 
 #include <ROOT/RStringView.hxx>
 
+#include <cstdint>
 #include <string>
+#include <utility>
 
 namespace ROOT {
 namespace Experimental {
@@ -72,6 +74,10 @@ enum class EColumnType {
    kSplitUInt32,
    kSplitInt16,
    kSplitUInt16,
+   // 32 bit floating point with a truncated mantissa, packed with a configurable number of bits per element
+   kReal32Trunc,
+   // floating point values of a given range, quantized to unsigned integers of a configurable number of bits
+   kReal32Quant,
    kMax,
 };
 
@@ -86,6 +92,11 @@ class RColumnModel {
 private:
    EColumnType fType;
    bool fIsSorted;
+   /// Number of bits per element on storage for the column types with a configurable width, such as kReal32Trunc.
+   /// Zero means the default width of the column type.
+   std::uint16_t fBitsOnStorage = 0;
+   /// The [min, max] range of the values of quantized column types (kReal32Quant)
+   std::pair<double, double> fValueRange{0., 0.};
 
 public:
    RColumnModel() : fType(EColumnType::kUnknown), fIsSorted(false) {}
@@ -97,9 +108,14 @@ public:
 
    EColumnType GetType() const { return fType; }
    bool GetIsSorted() const { return fIsSorted; }
+   std::uint16_t GetBitsOnStorage() const { return fBitsOnStorage; }
+   void SetBitsOnStorage(std::uint16_t bitsOnStorage) { fBitsOnStorage = bitsOnStorage; }
+   const std::pair<double, double> &GetValueRange() const { return fValueRange; }
+   void SetValueRange(double min, double max) { fValueRange = {min, max}; }
 
    bool operator ==(const RColumnModel &other) const {
-      return (fType == other.fType) && (fIsSorted == other.fIsSorted);
+      return (fType == other.fType) && (fIsSorted == other.fIsSorted) && (fBitsOnStorage == other.fBitsOnStorage) &&
+             (fValueRange == other.fValueRange);
    }
    bool operator!=(const RColumnModel &other) const { return !(other == *this); }
 };
@@ -238,6 +238,9 @@ private:
    std::string fContainerLabel{};
    std::shared_ptr<RDaosPool> fPool;
    ObjClassId_t fDefaultObjectClass{OC_SX};
+   /// The maximum number of fetch/update operations of a vector read/write that are in flight at the same time;
+   /// zero means that all the operations are launched at once
+   unsigned int fMaxInFlightOps = 0;
 
    /**
      \brief Perform a vector read/write operation on different objects.
@@ -255,6 +258,11 @@ public:
 
    ObjClassId_t GetDefaultObjectClass() const { return fDefaultObjectClass; }
    void SetDefaultObjectClass(const ObjClassId_t cid) { fDefaultObjectClass = cid; }
+   unsigned int GetMaxInFlightOps() const { return fMaxInFlightOps; }
+   /// Limit the number of operations of `ReadV()` and `WriteV()` that are queued in the event queue of the pool
+   /// at the same time.  The operations are launched in windows of `val` operations, each of which is waited for
+   /// before the next one is launched.  Zero (the default) launches all the operations at once.
+   void SetMaxInFlightOps(unsigned int val) { fMaxInFlightOps = val; }
 
    /**
      \brief Read data from a single object attribute key to the given buffer.
@@ -58,6 +58,7 @@ class RCollectionField;
 class RCollectionNTupleWriter;
 class REntry;
 class RNTupleModel;
+class RNTupleWriter;
 
 namespace Internal {
 struct RFieldCallbackInjector;
@@ -83,6 +84,7 @@ The field knows based on its type and the field name the type(s) and name(s) of
 class RFieldBase {
    friend class ROOT::Experimental::RCollectionField; // to move the fields from the collection model
    friend struct ROOT::Experimental::Internal::RFieldCallbackInjector; // used for unit tests
+   friend class ROOT::Experimental::RNTupleWriter; // for AppendBulk() and AppendCollectionBulk()
    using ReadCallback_t = std::function<void(void *)>;
 
 public:
@@ -388,6 +390,30 @@ protected:
       return fPrincipalColumn->GetElement()->GetPackedSize();
    }
 
+   /// General implementation of bulk append: appends the values one by one. See AppendBulk().
+   virtual std::size_t AppendBulkImpl(const void *from, std::size_t count);
+   /// Write `count` consecutive values of the field's type, e.g. from an array of floats for a float field.
+   /// The values of mappable fields are copied page-wise into the principal column.
+   /// Returns the number of uncompressed bytes written.
+   std::size_t AppendBulk(const void *from, std::size_t count)
+   {
+      if (~fTraits & kTraitMappable)
+         return AppendBulkImpl(from, count);
+
+      fPrincipalColumn->AppendV(from, count);
+      return count * fPrincipalColumn->GetElement()->GetPackedSize();
+   }
+   /// Only implemented by collection fields, throws otherwise. See AppendCollectionBulk().
+   virtual std::size_t AppendCollectionBulkImpl(const void *items, const std::uint64_t *offsets, std::size_t count);
+   /// Write `count` collections given in columnar form: `items` is the flat array of the items of all the
+   /// collections, of the item field's type, and `offsets` are `count + 1` increasing positions into `items`,
+   /// the collection `i` spanning from item `offsets[i] - offsets[0]` to item `offsets[i + 1] - offsets[0]`.
+   /// This corresponds to the layout of Arrow list arrays. Returns the number of uncompressed bytes written.
+   std::size_t AppendCollectionBulk(const void *items, const std::uint64_t *offsets, std::size_t count)
+   {
+      return AppendCollectionBulkImpl(items, offsets, count);
+   }
+
    /// Populate a single value with data from the field. The memory location pointed to by to needs to be of the
    /// fitting type. The fast path is conditioned by the field qualifying as simple, i.e. maps as-is
    /// to a single column and has no read callback.
@@ -439,6 +465,10 @@ protected:
 
    /// Allow derived classes to call Append and Read on other (sub) fields.
    static std::size_t CallAppendOn(RFieldBase &other, const void *from) { return other.Append(from); }
+   static std::size_t CallAppendBulkOn(RFieldBase &other, const void *from, std::size_t count)
+   {
+      return other.AppendBulk(from, count);
+   }
    static void CallReadOn(RFieldBase &other, const RClusterIndex &clusterIndex, void *to)
    {
       other.Read(clusterIndex, to);
@@ -931,6 +961,7 @@ protected:
    void GenerateValue(void *where) const override { new (where) std::vector<char>(); }
 
    std::size_t AppendImpl(const void *from) final;
+   std::size_t AppendCollectionBulkImpl(const void *items, const std::uint64_t *offsets, std::size_t count) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, void *to) final;
 
 public:
@@ -974,6 +1005,7 @@ protected:
    void DestroyValue(void *objPtr, bool dtorOnly = false) const override;
 
    std::size_t AppendImpl(const void *from) override;
+   std::size_t AppendCollectionBulkImpl(const void *items, const std::uint64_t *offsets, std::size_t count) final;
    void ReadGlobalImpl(NTupleSize_t globalIndex, void *to) override;
    std::size_t ReadBulkImpl(const RBulkSpec &bulkSpec) final;
 
@@ -1576,9 +1608,15 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+   /// Bit width and value range of the truncated or quantized column representations, see SetTruncated()
+   RColumnModel fLossyModel;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      auto clone = std::make_unique<RField>(newName);
+      clone->fLossyModel = fLossyModel;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1614,14 +1652,26 @@ public:
    size_t GetValueSize() const final { return sizeof(float); }
    size_t GetAlignment() const final { return alignof(float); }
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Store the values with a mantissa truncated to `nBits - 9` bits, packed with `nBits` bits per value (10 to 31),
+   /// like Float16_t in TTree.  Must be called before the field is connected to a page sink.
+   void SetTruncated(std::size_t nBits);
+   /// Store the values clamped to [min, max] and quantized to `nBits` bits per value (1 to 32)
+   void SetQuantized(double min, double max, std::size_t nBits);
 };
 
 
 template <>
 class RField<double> : public Detail::RFieldBase {
+   /// Bit width and value range of the truncated or quantized column representations, see SetTruncated()
+   RColumnModel fLossyModel;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final
+   {
+      auto clone = std::make_unique<RField>(newName);
+      clone->fLossyModel = fLossyModel;
+      return clone;
    }
 
    const RColumnRepresentations &GetColumnRepresentations() const final;
@@ -1660,6 +1710,11 @@ public:
 
    // Set the column representation to 32 bit floating point and the type alias to Double32_t
    void SetDouble32();
+   /// Store the values as floats with a mantissa truncated to `nBits - 9` bits, packed with `nBits` bits per value
+   /// (10 to 31).  Must be called before the field is connected to a page sink.
+   void SetTruncated(std::size_t nBits);
+   /// Store the values clamped to [min, max] and quantized to `nBits` bits per value (1 to 32)
+   void SetQuantized(double min, double max, std::size_t nBits);
 };
 
 template <>
@@ -32,8 +32,10 @@
 
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -60,6 +62,7 @@ enum class ENTupleInfo {
    kSummary,  // The ntuple name, description, number of entries
    kStorageDetails, // size on storage, page sizes, compression factor, etc.
    kMetrics, // internals performance counters, requires that EnableMetrics() was called
+   kIOStats, // I/O cost by column and cluster, requires that RNTupleReadOptions::SetEnableIOStats() was set
 };
 
 #ifdef R__USE_IMT
@@ -421,6 +424,20 @@ public:
          CommitCluster();
       return bytesWritten;
    }
+   /// The columnar data of a top-level field for FillBulk().  Usually, `fValues` is an array of values of the
+   /// field's type.  For std::vector and RVec fields, `fValues` can alternatively be the flat array
+   /// of the items of all the entries if `fOffsets` gives the `nEntries + 1` offsets of the collections into it,
+   /// as in Arrow list arrays; see RFieldBase::AppendCollectionBulk().
+   struct RBulkFieldData {
+      std::string fFieldName;
+      const void *fValues = nullptr;
+      const std::uint64_t *fOffsets = nullptr;
+   };
+   /// Appends `nEntries` entries from columnar buffers, given for each of the top-level fields of the model,
+   /// without going through an entry.  The values of simple fields are copied page by page into their columns.
+   /// Clusters are committed as with Fill(), at entry boundaries.
+   /// \return The number of uncompressed bytes written.
+   std::size_t FillBulk(std::size_t nEntries, const std::vector<RBulkFieldData> &data);
    /// Ensure that the data from the so far seen Fill calls has been written to storage
    void CommitCluster(bool commitClusterGroup = false);
 
@@ -456,6 +473,128 @@ public:
    }
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleFillContext
+\ingroup NTuple
+\brief A per-thread context to fill entries into an RNTupleParallelWriter
+
+A fill context owns a clone of the parallel writer's model and a page sink that keeps the sealed pages of the
+currently open cluster in memory. Filling and compression thus happen without synchronization. Only when a cluster
+is committed, its sealed pages are handed over to the shared page sink of the parallel writer, under a lock.
+A fill context must only be used by one thread at a time and it must be destructed before the parallel writer.
+*/
+// clang-format on
+class RNTupleFillContext {
+   friend class RNTupleParallelWriter;
+
+private:
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   NTupleSize_t fLastCommitted = 0;
+   NTupleSize_t fNEntries = 0;
+   /// Keeps track of the number of bytes written into the current cluster
+   std::size_t fUnzippedClusterSize = 0;
+   /// The total number of bytes written to storage (i.e., after compression)
+   std::uint64_t fNBytesCommitted = 0;
+   /// The total number of bytes filled into all the so far committed clusters,
+   /// i.e. the uncompressed size of the written clusters
+   std::uint64_t fNBytesFilled = 0;
+   /// Limit for committing cluster no matter the other tunables
+   std::size_t fMaxUnzippedClusterSize;
+   /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
+   NTupleSize_t fUnzippedClusterSizeEst;
+
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   ~RNTupleFillContext();
+
+   /// Fill the default entry of the context's model.
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill() { return Fill(*fModel->GetDefaultEntry()); }
+   /// Fill an entry that has been created from this context, i.e. by CreateEntry().
+   /// \return The number of uncompressed bytes written.
+   std::size_t Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      std::size_t bytesWritten = 0;
+      for (auto &value : entry) {
+         bytesWritten += value.Append();
+      }
+      fUnzippedClusterSize += bytesWritten;
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+      return bytesWritten;
+   }
+   /// Hand over the entries filled so far as a new cluster to the parallel writer
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+   /// The number of entries filled through this context
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple writer that can be filled concurrently from several threads
+
+Every thread obtains its own RNTupleFillContext by CreateFillContext() and fills entries through it. The fill contexts
+serialize and compress their clusters independently; the parallel writer only serializes the writing of the sealed
+pages and of the cluster meta-data into its page sink. Entries from different fill contexts are thus interleaved at
+cluster granularity. On destruction, the parallel writer commits the cluster group and the ntuple footer.
+
+~~~ {.cpp}
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "myNTuple", "some/file.root");
+// in every thread:
+auto fillContext = writer->CreateFillContext();
+auto entry = fillContext->CreateEntry();
+// ... set the values of entry
+fillContext->Fill(*entry);
+~~~
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// Protects the page sink, the list of fill contexts and fNEntries
+   std::mutex fMutex;
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// Needs to be destructed before fSink. Serves as the prototype for the models of the fill contexts.
+   std::unique_ptr<RNTupleModel> fModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// The number of entries committed to fSink, summed over all fill contexts
+   NTupleSize_t fNEntries = 0;
+   std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
+
+public:
+   /// Throws an exception if the model is null.
+   static std::unique_ptr<RNTupleParallelWriter> Recreate(std::unique_ptr<RNTupleModel> model,
+                                                          std::string_view ntupleName, std::string_view storage,
+                                                          const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model or the sink is null. The sink must not be shared with other writers.
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Create a new fill context. Thread-safe. The returned context must be destructed before the writer.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::RCollectionNTuple
@@ -245,9 +245,12 @@ public:
          std::uint32_t fNElements = std::uint32_t(-1);
          /// The meaning of fLocator depends on the storage backend.
          RNTupleLocator fLocator;
+         /// If true, the 8 bytes following the sealed page on storage are the XXH3 checksum of the page;
+         /// they are included in the size of the locator
+         bool fHasChecksum = false;
 
          bool operator==(const RPageInfo &other) const {
-            return fNElements == other.fNElements && fLocator == other.fLocator;
+            return fNElements == other.fNElements && fLocator == other.fLocator && fHasChecksum == other.fHasChecksum;
          }
       };
       struct RPageInfoExtended : RPageInfo {
@@ -950,6 +953,9 @@ public:
 
    RResult<void> CommitColumnRange(DescriptorId_t physicalId, std::uint64_t firstElementIndex,
                                    std::uint32_t compressionSettings, const RClusterDescriptor::RPageRange &pageRange);
+   /// Like the overload above but takes over the page infos instead of copying them
+   RResult<void> CommitColumnRange(DescriptorId_t physicalId, std::uint64_t firstElementIndex,
+                                   std::uint32_t compressionSettings, RClusterDescriptor::RPageRange &&pageRange);
 
    /// Add column and page ranges for deferred columns missing in this cluster.  The locator type for the synthesized
    /// page ranges is `kTypePageZero`.  All the page sources must be able to populate the 'zero' page from such locator.
@@ -0,0 +1,91 @@
+/// \file ROOT/RNTupleIOStats.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RNTupleIOStats
+#define ROOT7_RNTupleIOStats
+
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace ROOT {
+namespace Experimental {
+
+class RNTupleDescriptor;
+
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RNTupleIOStats
+\ingroup NTuple
+\brief Break down of the read and decompression cost of a page source by physical column and cluster
+
+Whereas the RNTupleMetrics counters of a page source are summed over all the columns, this class keeps the
+bytes read, the number of unzipped pages, the unzipped volume, the decompression wall time and the page pool hits
+of every (physical column, cluster) pair.  It is filled by the page source if
+RNTupleReadOptions::SetEnableIOStats() is set.  The methods are thread-safe.
+*/
+// clang-format on
+class RNTupleIOStats {
+public:
+   /// The counters of a single (physical column, cluster) pair, or their sum over several pairs
+   struct RCounts {
+      std::uint64_t fSzRead = 0;
+      std::uint64_t fNPageUnzipped = 0;
+      std::uint64_t fSzUnzip = 0;
+      /// Wall clock time in nanoseconds
+      std::uint64_t fTimeWallUnzip = 0;
+      std::uint64_t fNPagePoolHit = 0;
+
+      RCounts &operator+=(const RCounts &other);
+   };
+   /// The pair (physical column ID, cluster ID)
+   using Key_t = std::pair<DescriptorId_t, DescriptorId_t>;
+
+private:
+   mutable std::mutex fLock;
+   std::map<Key_t, RCounts> fCounts;
+
+public:
+   void AddRead(DescriptorId_t physicalColumnId, DescriptorId_t clusterId, std::uint64_t nBytes);
+   void AddUnzip(DescriptorId_t physicalColumnId, DescriptorId_t clusterId, std::uint64_t nBytes,
+                 std::uint64_t timeWallNs);
+   void AddPagePoolHit(DescriptorId_t physicalColumnId, DescriptorId_t clusterId);
+   void Reset();
+
+   /// A copy of the per (physical column, cluster) counters
+   std::map<Key_t, RCounts> GetCounts() const;
+   /// Counters of the given physical column summed over all clusters
+   RCounts GetColumnCounts(DescriptorId_t physicalColumnId) const;
+   /// Counters of the given cluster summed over all physical columns
+   RCounts GetClusterCounts(DescriptorId_t clusterId) const;
+
+   /// Prints one line per physical column, with the name of its field, ordered by decreasing volume read. If
+   /// `perCluster` is set, the lines of the individual clusters follow the line of every column.
+   void PrintTable(std::ostream &output, const RNTupleDescriptor &desc, bool perCluster = false) const;
+   /// The complete break down as JSON: a list of columns, each with its field and its list of clusters
+   std::string ToJSON(const RNTupleDescriptor &desc) const;
+};
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
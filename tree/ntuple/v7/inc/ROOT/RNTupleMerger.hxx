@@ -19,6 +19,12 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RPageStorage.hxx>
+#include <ROOT/RSpan.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -38,6 +44,46 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates the entries of several page sources into a page sink
+
+All sources need to have the same on-disk schema, i.e. the same fields with the same column types. The destination
+schema is generated from the first source. The merger copies the data cluster by cluster as sealed pages, without
+unpacking them.  If the compression settings of a column range in the source match the compression settings of the
+destination, the sealed pages are copied as raw bytes and only the page locations and the meta-data are rewritten.
+Otherwise, the pages are decompressed and recompressed with the compression settings of the destination.
+*/
+// clang-format on
+class RNTupleMerger {
+private:
+   /// Pairs a physical column of a source with the corresponding physical column of the destination
+   struct RColumnInfo {
+      DescriptorId_t fSourceId = kInvalidDescriptorId;
+      DescriptorId_t fDestinationId = kInvalidDescriptorId;
+      std::size_t fBitsOnStorage = 0;
+   };
+
+   /// The number of pages of the last call to Merge() that were copied verbatim
+   std::uint64_t fNPagesCopied = 0;
+   /// The number of pages of the last call to Merge() that were decompressed and recompressed
+   std::uint64_t fNPagesRecompressed = 0;
+
+   /// Matches the columns by the qualified name of their field and their column index.  Throws an exception
+   /// if the source lacks a column of the destination or if the column types differ.
+   static std::vector<RColumnInfo> CollectColumns(const RNTupleDescriptor &source, const RNTupleDescriptor &destination);
+
+public:
+   /// Attaches the sources and writes their entries in the given order to the destination, which must not have been
+   /// created yet.  Commits the dataset on the destination.
+   void Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+
+   std::uint64_t GetNPagesCopied() const { return fNPagesCopied; }
+   std::uint64_t GetNPagesRecompressed() const { return fNPagesRecompressed; }
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
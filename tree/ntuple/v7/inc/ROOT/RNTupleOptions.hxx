@@ -19,6 +19,7 @@
 #include <Compression.h>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstddef>
 #include <memory>
 
 namespace ROOT {
@@ -47,6 +48,14 @@ All page sink classes need to support the common options.
 */
 // clang-format on
 class RNTupleWriteOptions {
+public:
+   /// Controls whether a buffered page sink hands over filled pages to the IMT task arena for asynchronous
+   /// compression. With kDefault, asynchronous compression is used if implicit multi-threading is enabled.
+   enum class EImplicitMT {
+      kOff,
+      kDefault,
+   };
+
 protected:
    int fCompression{RCompressionSetting::EDefaults::kUseAnalysis};
    ENTupleContainerFormat fContainerFormat{ENTupleContainerFormat::kTFile};
@@ -61,9 +70,13 @@ protected:
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
    bool fUseBufferedWrite = true;
+   EImplicitMT fUseImplicitMT = EImplicitMT::kDefault;
    /// If set, 64bit index columns are replaced by 32bit index columns. This limits the cluster size to 512MB
    /// but it can result in smaller file sizes for data sets with many collections and lz4 or no compression.
    bool fHasSmallClusters = false;
+   /// If set, every sealed page is followed on storage by its 64bit XXH3 checksum, which the page source verifies
+   /// when it unseals the page. This detects silent corruption of the data at the cost of 8 bytes per page.
+   bool fEnablePageChecksums = false;
 
 public:
    /// A maximum size of 512MB still allows for a vector of bool to be stored in a small cluster.  This is the
@@ -95,8 +108,13 @@ public:
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
 
+   EImplicitMT GetUseImplicitMT() const { return fUseImplicitMT; }
+   void SetUseImplicitMT(EImplicitMT val) { fUseImplicitMT = val; }
+
    bool GetHasSmallClusters() const { return fHasSmallClusters; }
    void SetHasSmallClusters(bool val) { fHasSmallClusters = val; }
+   bool GetEnablePageChecksums() const { return fEnablePageChecksums; }
+   void SetEnablePageChecksums(bool val) { fEnablePageChecksums = val; }
 };
 
 // clang-format off
@@ -112,6 +130,9 @@ class RNTupleWriteOptionsDaos : public RNTupleWriteOptions {
    /// cage size yields acceptable results in throughput and page granularity for most use cases. A `fMaxCageSize` of 0
    /// disables the caging mechanism.
    uint32_t fMaxCageSize = 16 * RNTupleWriteOptions::fApproxUnzippedPageSize;
+   /// The maximum number of object store updates that are in flight at the same time when a cluster is committed.
+   /// Zero means no limit.
+   unsigned int fMaxInFlightOps = 0;
 
 public:
    ~RNTupleWriteOptionsDaos() override = default;
@@ -129,6 +150,11 @@ public:
    /// that cage size will be no smaller than the approximate uncompressed page size.
    /// To disable page concatenation, set this value to 0.
    void SetMaxCageSize(uint32_t cageSz) { fMaxCageSize = cageSz; }
+
+   unsigned int GetMaxInFlightOps() const { return fMaxInFlightOps; }
+   /// Limit the number of concurrent update operations queued in the DAOS event queue, see
+   /// RDaosContainer::SetMaxInFlightOps(). Zero, the default, launches all the operations at once.
+   void SetMaxInFlightOps(unsigned int val) { fMaxInFlightOps = val; }
 };
 
 // clang-format off
@@ -151,12 +177,61 @@ public:
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// If larger than fClusterBunchSize, the cluster pool adapts the bunch size between fClusterBunchSize and this
+   /// value according to the measured read latency and bandwidth. In this adaptive mode, the page source also
+   /// coalesces the read requests of neighboring clusters if they are separated by only a small gap. Useful for
+   /// remote reads over high-latency links; for local reads, the bunch size stays small to limit memory usage.
+   unsigned int fMaxClusterBunchSize = 0;
+   /// The number of cluster bunches that are read ahead of the current bunch. The I/O thread of the cluster pool
+   /// submits the reads of up to this number of bunches at once, so that on storage with deep queues (e.g., NVMe
+   /// devices read through io_uring) several bunches are in flight concurrently.
+   unsigned int fClusterBunchQueueDepth = 1;
+   /// If set, the unzip thread of the cluster pool decompresses the pages of preloaded clusters even if no task
+   /// scheduler is available, i.e. if implicit multi-threading is off. This moves the decompression off the
+   /// reading thread. With implicit multi-threading, pages are always unzipped in parallel tasks.
+   bool fUseBackgroundUnzip = false;
+   /// If set and supported by the storage backend, the file is mapped into memory. Uncompressed pages whose on-disk
+   /// layout matches the in-memory layout are then read directly from the mapping, without a copy.
+   bool fUseMmap = false;
+   /// If set, the page source breaks down the bytes read, the decompression and the page pool hits by
+   /// physical column and cluster, see RPageSource::GetIOStats(). Off by default because every page update takes
+   /// a lock.
+   bool fEnableIOStats = false;
+   /// The size in bytes up to which the page pool keeps decompressed pages after they have been released, so that
+   /// going back to recently used entries does not read and unzip the pages again. Clones of a page source share
+   /// its page pool (unless the file is memory mapped), so that several readers of the same ntuple, e.g. one per
+   /// thread, also share the kept pages. Zero, the default, releases the pages immediately.
+   std::size_t fPagePoolMaxUnusedSize = 0;
+   /// If set, the checksums of the pages written with RNTupleWriteOptions::SetEnablePageChecksums() are verified when
+   /// the pages are unsealed. As unsealed pages are kept in the page pool, a page is only verified the first time
+   /// it is read and not when it is served again from the pool. Pages without checksum are never verified.
+   bool fVerifyPageChecksums = true;
+   /// The maximum number of read operations that the page source keeps in flight when it loads a set of clusters.
+   /// Zero means no limit. Used by the DAOS page source, which issues one fetch per object and distribution key
+   /// through the event queue of the pool.
+   unsigned int fMaxInFlightReads = 0;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   unsigned int GetMaxClusterBunchSize() const { return fMaxClusterBunchSize; }
+   void SetMaxClusterBunchSize(unsigned int val) { fMaxClusterBunchSize = val; }
+   unsigned int GetClusterBunchQueueDepth() const { return fClusterBunchQueueDepth; }
+   void SetClusterBunchQueueDepth(unsigned int val) { fClusterBunchQueueDepth = val; }
+   bool GetUseBackgroundUnzip() const { return fUseBackgroundUnzip; }
+   void SetUseBackgroundUnzip(bool val) { fUseBackgroundUnzip = val; }
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
+   bool GetEnableIOStats() const { return fEnableIOStats; }
+   void SetEnableIOStats(bool val) { fEnableIOStats = val; }
+   std::size_t GetPagePoolMaxUnusedSize() const { return fPagePoolMaxUnusedSize; }
+   void SetPagePoolMaxUnusedSize(std::size_t val) { fPagePoolMaxUnusedSize = val; }
+   bool GetVerifyPageChecksums() const { return fVerifyPageChecksums; }
+   void SetVerifyPageChecksums(bool val) { fVerifyPageChecksums = val; }
+   unsigned int GetMaxInFlightReads() const { return fMaxInFlightReads; }
+   void SetMaxInFlightReads(unsigned int val) { fMaxInFlightReads = val; }
 };
 
 } // namespace Experimental
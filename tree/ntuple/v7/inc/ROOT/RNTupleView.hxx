@@ -20,6 +20,8 @@
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
+#include <cstddef>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -148,6 +150,11 @@ private:
    FieldT fField;
    /// Used as a Read() destination for fields that are not mappable
    Detail::RFieldBase::RValue fValue;
+   /// Created on the first call to ReadBulk(); owns the array of values returned by ReadBulk()
+   std::unique_ptr<Detail::RFieldBase::RBulk> fBulk;
+   /// An all-true request mask for ReadBulk() of at least fBulkMaskSize elements
+   std::unique_ptr<bool[]> fBulkMask;
+   std::size_t fBulkMaskSize = 0;
 
 public:
    using FieldTypeT = T;
@@ -196,6 +203,23 @@ public:
       }
    }
 
+   /// Reads `size` consecutive values starting at `firstIndex` in one go and returns a pointer to the contiguous
+   /// array of values. The range must not cross a cluster boundary. The array is owned by the view and remains valid
+   /// until the next call to ReadBulk() with a range that is not contained in the previous one. Simple types are
+   /// copied page-wise from the principal column; RVecs of simple types point into one flat array of item values,
+   /// so that they can be used as offsets plus values without further copies.
+   const T *ReadBulk(const RClusterIndex &firstIndex, std::size_t size)
+   {
+      if (!fBulk)
+         fBulk = std::make_unique<Detail::RFieldBase::RBulk>(fField.GenerateBulk());
+      if (size > fBulkMaskSize) {
+         fBulkMask = std::make_unique<bool[]>(size);
+         std::fill(fBulkMask.get(), fBulkMask.get() + size, true);
+         fBulkMaskSize = size;
+      }
+      return static_cast<const T *>(fBulk->ReadBulk(firstIndex, fBulkMask.get(), size));
+   }
+
    // TODO(bgruber): turn enable_if into requires clause with C++20
    template <typename C = T, std::enable_if_t<Internal::isMappable<FieldT>, C*> = nullptr>
    const C *MapV(NTupleSize_t globalIndex, NTupleSize_t &nItems)
@@ -16,6 +16,7 @@
 #ifndef ROOT7_RNTupleZip
 #define ROOT7_RNTupleZip
 
+#include <ROOT/RTrace.hxx>
 #include <RZip.h>
 #include <TError.h>
 
@@ -195,6 +196,7 @@ public:
          return;
       }
       R__ASSERT(dataLen > nbytes);
+      R__TRACE_SPAN("io", "RNTupleDecompressor::Unzip");
 
       unsigned char *source = const_cast<unsigned char *>(static_cast<const unsigned char *>(from));
       unsigned char *target = static_cast<unsigned char *>(to);
@@ -21,6 +21,7 @@
 #include <ROOT/RNTupleUtil.hxx>
 
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <vector>
 
@@ -40,6 +41,10 @@ pages is thread-safe. The page pool does not allocate the memory -- allocation a
 page storage, which might do it in a way optimized to the backing store (e.g., mmap()).
 Multiple page caches can coexist.
 
+By default, a page is deleted as soon as its reference counter drops to zero. With SetMaxUnusedSize(), the pool
+keeps returned pages up to the given total size and evicts the least recently returned ones first. A page pool can
+be shared by several page sources of the same ntuple, e.g. by a source and its clones.
+
 TODO(jblomer): it should be possible to register pages and to find them by column and index; this would
 facilitate pre-filling a cache, e.g. by read-ahead.
 */
@@ -54,13 +59,28 @@ private:
    std::vector<RPage> fPages;
    std::vector<std::int32_t> fReferences;
    std::vector<RPageDeleter> fDeleters;
+   /// For the pages that are kept after their reference counter dropped to zero, the value of fNReturned when they
+   /// were returned; zero for the other pages
+   std::vector<std::uint64_t> fReturnedAt;
+   std::uint64_t fNReturned = 0;
+   /// The total size of the returned pages that are kept
+   std::size_t fUnusedSize = 0;
+   std::size_t fMaxUnusedSize = 0;
    std::mutex fLock;
 
+   /// Calls the deleter of the page at the given position and removes it from the pool
+   void ErasePage(std::size_t idx);
+   /// Marks the page at the given position as used if it was kept after being returned
+   void MarkUsed(std::size_t idx);
+   /// Deletes the least recently returned pages until the kept pages fit in fMaxUnusedSize
+   void EvictUnused();
+
 public:
    RPagePool() = default;
    RPagePool(const RPagePool&) = delete;
    RPagePool& operator =(const RPagePool&) = delete;
-   ~RPagePool() = default;
+   /// Deletes the pages that are not referenced
+   ~RPagePool();
 
    /// Adds a new page to the pool together with the function to free its space. Upon registration,
    /// the page pool takes ownership of the page's memory. The new page has its reference counter set to 1.
@@ -75,6 +95,10 @@ public:
    /// this page. If the reference counter drops to zero, the page pool might decide to call the deleter given in
    /// during registration.
    void ReturnPage(const RPage &page);
+   /// Sets the size in bytes up to which pages are kept after their reference counter dropped to zero. Zero,
+   /// the default, deletes the pages immediately.
+   void SetMaxUnusedSize(std::size_t maxUnusedSize);
+   std::size_t GetMaxUnusedSize() const { return fMaxUnusedSize; }
 };
 
 } // namespace Detail
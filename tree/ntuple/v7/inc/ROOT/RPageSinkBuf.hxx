@@ -54,7 +54,10 @@ private:
          explicit RPageZipItem(RPage page)
             : fPage(page), fBuf(nullptr) {}
          bool IsSealed() const { return fSealedPage != nullptr; }
-         void AllocateSealedPageBuf() { fBuf = std::unique_ptr<unsigned char[]>(new unsigned char[fPage.GetNBytes()]); }
+         void AllocateSealedPageBuf()
+         {
+            fBuf = std::unique_ptr<unsigned char[]>(new unsigned char[fPage.GetNBytes() + kNBytesPageChecksum]);
+         }
       };
    public:
       RColumnBuf() = default;
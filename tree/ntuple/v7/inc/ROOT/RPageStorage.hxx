@@ -18,6 +18,7 @@
 
 #include <ROOT/RCluster.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleIOStats.hxx>
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
@@ -68,6 +69,9 @@ an ntuple.  Concrete implementations can use a TFile, a raw file, an object stor
 // clang-format on
 class RPageStorage {
 public:
+   /// Size of the optional XXH3 checksum that follows the bytes of a sealed page
+   static constexpr std::size_t kNBytesPageChecksum = sizeof(std::uint64_t);
+
    /// The interface of a task scheduler to schedule page (de)compression tasks
    class RTaskScheduler {
    public:
@@ -84,17 +88,30 @@ public:
    /// as an input to UnsealPages() as well as to transfer pages between different storage media.
    /// RSealedPage does _not_ own the buffer it is pointing to in order to not interfere with the memory management
    /// of concrete page sink and page source implementations.
+   /// If fHasChecksum is set, the last kNBytesPageChecksum bytes of the buffer (included in fSize) are the
+   /// little-endian XXH3 checksum of the preceding bytes.
    struct RSealedPage {
       const void *fBuffer = nullptr;
       std::uint32_t fSize = 0;
       std::uint32_t fNElements = 0;
+      bool fHasChecksum = false;
 
       RSealedPage() = default;
-      RSealedPage(const void *b, std::uint32_t s, std::uint32_t n) : fBuffer(b), fSize(s), fNElements(n) {}
+      RSealedPage(const void *b, std::uint32_t s, std::uint32_t n, bool c = false)
+         : fBuffer(b), fSize(s), fNElements(n), fHasChecksum(c)
+      {
+      }
       RSealedPage(const RSealedPage &other) = delete;
       RSealedPage& operator =(const RSealedPage &other) = delete;
       RSealedPage(RSealedPage &&other) = default;
       RSealedPage& operator =(RSealedPage &&other) = default;
+
+      /// The size of the packed and compressed page data, i.e. without the checksum
+      std::uint32_t GetDataSize() const { return fHasChecksum ? fSize - kNBytesPageChecksum : fSize; }
+      /// Returns false if the page has a checksum that does not match its data
+      bool VerifyChecksum() const;
+      /// The XXH3 checksum of the given sealed page data
+      static std::uint64_t ComputeChecksum(const void *buffer, std::size_t nbytes);
    };
 
    using SealedPageSequence_t = std::deque<RSealedPage>;
@@ -230,14 +247,15 @@ protected:
 
    /// Helper for streaming a page. This is commonly used in derived, concrete page sinks. Note that if
    /// compressionSetting is 0 (uncompressed) and the page is mappable, the returned sealed page will
-   /// point directly to the input page buffer.  Otherwise, the sealed page references an internal buffer
+   /// point directly to the input page buffer, unless page checksums are enabled.  Otherwise, the sealed page references an internal buffer
    /// of fCompressor.  Thus, the buffer pointed to by the RSealedPage should never be freed.
    /// Usage of this method requires construction of fCompressor.
    RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting);
 
-   /// Seal a page using the provided buffer.
-   static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element,
-      int compressionSetting, void *buf);
+   /// Seal a page using the provided buffer.  If `writeChecksum` is set, the checksum is appended to the sealed
+   /// page, so that the buffer needs to provide kNBytesPageChecksum bytes in addition to the page size.
+   static RSealedPage SealPage(const RPage &page, const RColumnElementBase &element, int compressionSetting, void *buf,
+                               bool writeChecksum = false);
 
    /// Enables the default set of metrics provided by RPageSink. `prefix` will be used as the prefix for
    /// the counters registered in the internal RNTupleMetrics object.
@@ -265,6 +283,8 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return *fOptions; }
+   /// Returns the descriptor of the data written so far. Valid after Create().
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -359,6 +379,9 @@ public:
 private:
    RNTupleDescriptor fDescriptor;
    mutable std::shared_mutex fDescriptorLock;
+   /// Executes the unzip tasks sequentially in the calling thread (the cluster pool's unzip thread). Used as the
+   /// default task scheduler if RNTupleReadOptions::GetUseBackgroundUnzip() is set.
+   std::unique_ptr<RTaskScheduler> fBackgroundUnzipTasks;
 
 protected:
    /// Default I/O performance counters that get registered in fMetrics
@@ -398,6 +421,8 @@ protected:
    std::unique_ptr<RCounters> fCounters;
    /// Wraps the I/O counters and is observed by the RNTupleReader metrics
    RNTupleMetrics fMetrics;
+   /// Break down of the I/O by physical column and cluster; only created if RNTupleReadOptions::GetEnableIOStats()
+   std::unique_ptr<RNTupleIOStats> fIOStats;
 
    RNTupleReadOptions fOptions;
    /// The active columns are implicitly defined by the model fields or views
@@ -409,7 +434,7 @@ protected:
    std::unique_ptr<RNTupleDecompressor> fDecompressor;
 
    virtual RNTupleDescriptor AttachImpl() = 0;
-   // Only called if a task scheduler is set. No-op be default.
+   // Only called if a task scheduler is set or if background unzipping is enabled. No-op be default.
    virtual void UnzipClusterImpl(RCluster * /* cluster */)
       { }
 
@@ -418,6 +443,8 @@ protected:
    /// The optimization of directly mapping pages is left to the concrete page source implementations.
    /// Usage of this method requires construction of fDecompressor. Memory is allocated via
    /// `RPageAllocatorHeap`; use `RPageAllocatorHeap::DeletePage()` to deallocate returned pages.
+   /// The checksum of the sealed page, if any, is verified unless disabled in the read options; a corrupted page
+   /// throws an RException.
    RPage UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element, DescriptorId_t physicalColumnId);
 
    /// Prepare a page range read for the column set in `clusterKey`.  Specifically, pages referencing the
@@ -506,6 +533,9 @@ public:
 
    /// Returns the default metrics object.  Subclasses might alternatively override the method and provide their own metrics object.
    RNTupleMetrics &GetMetrics() override { return fMetrics; };
+   /// The per column and cluster break down of the I/O, nullptr unless enabled in the read options. Only filled
+   /// by page sources that read from storage, not by virtual ones such as the friends page source.
+   const RNTupleIOStats *GetIOStats() const { return fIOStats.get(); }
 };
 
 } // namespace Detail
@@ -202,6 +202,15 @@ private:
       std::uint64_t fColumnOffset = 0;
    };
 
+   /// The cage that was read last if the cluster cache is turned off.  The following pages of the same cage are
+   /// served from this buffer without another fetch.
+   struct RCageBuffer {
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      DescriptorId_t fColumnId = kInvalidDescriptorId;
+      std::uint32_t fPosition = 0;
+      std::unique_ptr<unsigned char[]> fBuffer;
+   };
+
    ntuple_index_t fNTupleIndex{0};
 
    /// Populated pages might be shared; the page pool might, at some point, be used by multiple page sources
@@ -216,6 +225,8 @@ private:
    std::unique_ptr<RClusterPool> fClusterPool;
 
    RNTupleDescriptorBuilder fDescriptorBuilder;
+   /// Only used if the cluster cache is turned off
+   RCageBuffer fCurrentCage;
 
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
@@ -125,6 +125,10 @@ private:
    RNTupleDescriptorBuilder fDescriptorBuilder;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// Read-only mapping of the entire file, set on attaching if RNTupleReadOptions::GetUseMmap() is set and
+   /// fFile supports memory mapping
+   unsigned char *fMappedFile = nullptr;
+   std::uint64_t fMappedFileSize = 0;
 
    /// Deserialized header and footer into a minimal descriptor held by fDescriptorBuilder
    void InitDescriptor(const Internal::RFileNTupleAnchor &anchor);
@@ -135,6 +139,10 @@ private:
                                                             std::string_view path, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Returns the address of the page in the file mapping if the page is stored uncompressed and in the in-memory
+   /// layout of the given element type, i.e. if the page can be used without unsealing.  Returns nullptr otherwise.
+   unsigned char *GetMappedPage(const RColumnElementBase &element,
+                                const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) const;
 
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
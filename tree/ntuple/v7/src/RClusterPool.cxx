@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <future>
 #include <iostream>
 #include <iterator>
@@ -48,14 +49,47 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
    return fClusterKey.fClusterId < other.fClusterKey.fClusterId;
 }
 
-ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
-   : fPageSource(pageSource)
-   , fClusterBunchSize(clusterBunchSize)
-   , fPool(2 * clusterBunchSize)
-   , fThreadIo(&RClusterPool::ExecReadClusters, this)
-   , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
+void ROOT::Experimental::Detail::RClusterPool::RReadStatistics::Add(double bytes, double seconds, std::size_t nClusters)
+{
+   fWeight = kDecay * fWeight + 1.;
+   fSumBytes = kDecay * fSumBytes + bytes;
+   fSumBytes2 = kDecay * fSumBytes2 + bytes * bytes;
+   fSumTime = kDecay * fSumTime + seconds;
+   fSumBytesTime = kDecay * fSumBytesTime + bytes * seconds;
+   fSumClusters = kDecay * fSumClusters + nClusters;
+}
+
+bool ROOT::Experimental::Detail::RClusterPool::RReadStatistics::Estimate(double &latency, double &secondsPerByte) const
+{
+   if (fWeight == 0.)
+      return false;
+   const double meanBytes = fSumBytes / fWeight;
+   const double meanTime = fSumTime / fWeight;
+   const double varBytes = fSumBytes2 / fWeight - meanBytes * meanBytes;
+   // Require a coefficient of variation of at least 10% of the read sizes for a meaningful fit
+   if (varBytes <= 0.01 * meanBytes * meanBytes)
+      return false;
+   const double covBytesTime = fSumBytesTime / fWeight - meanBytes * meanTime;
+   secondsPerByte = covBytesTime / varBytes;
+   if (secondsPerByte <= 0.)
+      return false;
+   latency = std::max(0., meanTime - secondsPerByte * meanBytes);
+   return true;
+}
+
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize,
+                                                       unsigned int bunchQueueDepth, unsigned int maxClusterBunchSize)
+   : fPageSource(pageSource),
+     fClusterBunchSize(clusterBunchSize),
+     fMinClusterBunchSize(clusterBunchSize),
+     fMaxClusterBunchSize(std::max(clusterBunchSize, maxClusterBunchSize)),
+     fBunchQueueDepth(bunchQueueDepth),
+     fPool((1 + bunchQueueDepth) * fMaxClusterBunchSize),
+     fThreadIo(&RClusterPool::ExecReadClusters, this),
+     fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(clusterBunchSize > 0);
+   R__ASSERT(bunchQueueDepth > 0);
 }
 
 ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
@@ -115,8 +149,11 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
       }
 
       while (!readItems.empty()) {
+         // Collect the read items of up to fBunchQueueDepth bunches. The page source issues them as a single
+         // vector read, such that the storage layer can keep the requests of several bunches in flight at once.
          std::vector<RCluster::RKey> clusterKeys;
          std::int64_t bunchId = -1;
+         unsigned int nBunches = 0;
          for (unsigned i = 0; i < readItems.size(); ++i) {
             const auto &item = readItems[i];
             // `kInvalidDescriptorId` is used as a marker for thread cancellation. Such item causes the
@@ -125,13 +162,35 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
                R__ASSERT(i == (readItems.size() - 1));
                return;
             }
-            if ((bunchId >= 0) && (item.fBunchId != bunchId))
-               break;
+            if (item.fBunchId != bunchId) {
+               if (nBunches == fBunchQueueDepth)
+                  break;
+               nBunches++;
+            }
             bunchId = item.fBunchId;
             clusterKeys.emplace_back(item.fClusterKey);
          }
 
+         std::uint64_t nBytes = 0;
+         if (IsAdaptive()) {
+            auto descriptorGuard = fPageSource.GetSharedDescriptorGuard();
+            for (const auto &key : clusterKeys) {
+               const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(key.fClusterId);
+               for (auto physicalColumnId : key.fPhysicalColumnSet) {
+                  if (!clusterDesc.ContainsColumn(physicalColumnId))
+                     continue;
+                  for (const auto &pi : clusterDesc.GetPageRange(physicalColumnId).fPageInfos)
+                     nBytes += pi.fLocator.fBytesOnStorage;
+               }
+            }
+         }
+
+         const auto tsStart = std::chrono::steady_clock::now();
          auto clusters = fPageSource.LoadClusters(clusterKeys);
+         if (IsAdaptive()) {
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - tsStart;
+            AdaptClusterBunchSize(nBytes, elapsed.count(), clusters.size());
+         }
          bool unzipQueueDirty = false;
          for (std::size_t i = 0; i < clusters.size(); ++i) {
             // Meanwhile, the user might have requested clusters outside the look-ahead window, so that we don't
@@ -161,6 +220,36 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
    } // while (true)
 }
 
+void ROOT::Experimental::Detail::RClusterPool::AdaptClusterBunchSize(std::uint64_t bytes, double seconds,
+                                                                     std::size_t nClusters)
+{
+   fReadStatistics.Add(bytes, seconds, nClusters);
+
+   const unsigned int bunchSize = fClusterBunchSize;
+   double latency;
+   double secondsPerByte;
+   if (!fReadStatistics.Estimate(latency, secondsPerByte)) {
+      // Without variation in the read sizes, latency and bandwidth cannot be told apart.  Probe with a larger
+      // bunch, which either confirms that larger reads pay off or provides the data points to shrink again.
+      fClusterBunchSize = std::min(2 * bunchSize, fMaxClusterBunchSize);
+      return;
+   }
+
+   // The number of bytes that can be transferred in the time it takes to issue a request
+   const double breakEvenBytes = latency / secondsPerByte;
+   const double bytesPerCluster = (fReadStatistics.fSumClusters > 0.)
+                                     ? std::max(1., fReadStatistics.fSumBytes / fReadStatistics.fSumClusters)
+                                     : 1.;
+   // Bridging a gap larger than a cluster would lead to excessive memory overhead
+   fReadCoalesceGap = static_cast<std::uint64_t>(std::min(breakEvenBytes, bytesPerCluster));
+
+   // Choose the bunch size such that the latency amounts to at most kMaxLatencyFraction of the read time
+   const double targetBytes = breakEvenBytes * (1. - kMaxLatencyFraction) / kMaxLatencyFraction;
+   const double targetBunchSize = std::ceil(targetBytes / bytesPerCluster);
+   fClusterBunchSize = static_cast<unsigned int>(std::clamp(
+      targetBunchSize, static_cast<double>(fMinClusterBunchSize), static_cast<double>(fMaxClusterBunchSize)));
+}
+
 ROOT::Experimental::Detail::RCluster *
 ROOT::Experimental::Detail::RClusterPool::FindInPool(DescriptorId_t clusterId) const
 {
@@ -242,6 +331,8 @@ ROOT::Experimental::Detail::RCluster *
 ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
                                                      const RCluster::ColumnSet_t &physicalColumns)
 {
+   // In adaptive mode, the I/O thread may concurrently change the bunch size
+   const unsigned int clusterBunchSize = fClusterBunchSize;
    std::set<DescriptorId_t> keep;
    RProvides provide;
    {
@@ -261,8 +352,8 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
       provideInfo.fPhysicalColumnSet = physicalColumns;
       provideInfo.fBunchId = fBunchId;
       provideInfo.fFlags = RProvides::kFlagRequired;
-      for (DescriptorId_t i = 0, next = clusterId; i < 2 * fClusterBunchSize; ++i) {
-         if (i == fClusterBunchSize)
+      for (DescriptorId_t i = 0, next = clusterId; i < (1 + fBunchQueueDepth) * clusterBunchSize; ++i) {
+         if ((i > 0) && (i % clusterBunchSize == 0))
             provideInfo.fBunchId = ++fBunchId;
 
          auto cid = next;
@@ -338,7 +429,7 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(DescriptorId_t clusterId,
 
       // Figure out if enough work accumulated to justify I/O calls
       bool skipPrefetch = false;
-      if (provide.GetSize() < fClusterBunchSize) {
+      if (provide.GetSize() < clusterBunchSize) {
          skipPrefetch = true;
          for (const auto &kv : provide) {
             if ((kv.second.fFlags & (RProvides::kFlagRequired | RProvides::kFlagLast)) == 0)
@@ -23,6 +23,227 @@
 #include <memory>
 #include <utility>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+/// Generic implementation of SplitBytes(), also used for the tail elements of the SIMD kernels
+void SplitBytesScalar(unsigned char *splitArray, const unsigned char *src, std::size_t count, std::size_t offset,
+                      std::size_t n, std::size_t elementSize)
+{
+   for (std::size_t b = 0; b < elementSize; ++b) {
+      unsigned char *stream = splitArray + b * count + offset;
+      for (std::size_t i = 0; i < n; ++i) {
+         stream[i] = src[i * elementSize + b];
+      }
+   }
+}
+
+/// Generic implementation of UnsplitBytes(), also used for the tail elements of the SIMD kernels
+void UnsplitBytesScalar(unsigned char *dst, const unsigned char *splitArray, std::size_t count, std::size_t offset,
+                        std::size_t n, std::size_t elementSize)
+{
+   for (std::size_t b = 0; b < elementSize; ++b) {
+      const unsigned char *stream = splitArray + b * count + offset;
+      for (std::size_t i = 0; i < n; ++i) {
+         dst[i * elementSize + b] = stream[i];
+      }
+   }
+}
+
+#if defined(__SSE2__)
+/// Deinterleaves the bytes of 16 elements at a time. For every byte position, the byte is isolated in its element
+/// lane by shift and mask.  The saturating pack instructions then narrow the lanes (values are <= 255) until a
+/// vector holds the 16 bytes of the stream.  Returns the number of processed elements.
+std::size_t SplitBytesSSE2(unsigned char *splitArray, const unsigned char *src, std::size_t count,
+                           std::size_t offset, std::size_t n, std::size_t elementSize)
+{
+   unsigned char *s = splitArray + offset;
+   std::size_t i = 0;
+   switch (elementSize) {
+   case 2: {
+      const __m128i mask = _mm_set1_epi16(0xff);
+      for (; i + 16 <= n; i += 16) {
+         const __m128i v0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2 * i));
+         const __m128i v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 2 * i + 16));
+         _mm_storeu_si128(reinterpret_cast<__m128i *>(s + i),
+                          _mm_packus_epi16(_mm_and_si128(v0, mask), _mm_and_si128(v1, mask)));
+         _mm_storeu_si128(reinterpret_cast<__m128i *>(s + count + i),
+                          _mm_packus_epi16(_mm_srli_epi16(v0, 8), _mm_srli_epi16(v1, 8)));
+      }
+      break;
+   }
+   case 4: {
+      const __m128i mask = _mm_set1_epi32(0xff);
+      for (; i + 16 <= n; i += 16) {
+         __m128i v[4];
+         for (int k = 0; k < 4; ++k)
+            v[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 4 * i + 16 * k));
+         for (int b = 0; b < 4; ++b) {
+            __m128i t[4];
+            for (int k = 0; k < 4; ++k)
+               t[k] = _mm_and_si128(_mm_srl_epi32(v[k], _mm_cvtsi32_si128(8 * b)), mask);
+            const __m128i w01 = _mm_packs_epi32(t[0], t[1]);
+            const __m128i w23 = _mm_packs_epi32(t[2], t[3]);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(s + b * count + i), _mm_packus_epi16(w01, w23));
+         }
+      }
+      break;
+   }
+   case 8: {
+      const __m128i mask = _mm_set1_epi64x(0xff);
+      for (; i + 16 <= n; i += 16) {
+         __m128i v[8];
+         for (int k = 0; k < 8; ++k)
+            v[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 8 * i + 16 * k));
+         for (int b = 0; b < 8; ++b) {
+            // After masking, the upper 32 bits of every 64 bit lane are zero, so that the first pack yields the
+            // bytes in 32 bit lanes
+            __m128i u[4];
+            for (int k = 0; k < 4; ++k) {
+               const __m128i t0 = _mm_and_si128(_mm_srl_epi64(v[2 * k], _mm_cvtsi32_si128(8 * b)), mask);
+               const __m128i t1 = _mm_and_si128(_mm_srl_epi64(v[2 * k + 1], _mm_cvtsi32_si128(8 * b)), mask);
+               u[k] = _mm_packs_epi32(t0, t1);
+            }
+            const __m128i w01 = _mm_packs_epi32(u[0], u[1]);
+            const __m128i w23 = _mm_packs_epi32(u[2], u[3]);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(s + b * count + i), _mm_packus_epi16(w01, w23));
+         }
+      }
+      break;
+   }
+   }
+   return i;
+}
+
+/// Interleaves the byte streams of 16 elements at a time. The unpack instructions implement one step of a byte
+/// transposition each: interleaving two streams of bytes yields a stream of 2-byte pairs, interleaving two streams of
+/// 2-byte pairs yields a stream of 4-byte groups, and so on.  Returns the number of processed elements.
+std::size_t UnsplitBytesSSE2(unsigned char *dst, const unsigned char *splitArray, std::size_t count,
+                             std::size_t offset, std::size_t n, std::size_t elementSize)
+{
+   const unsigned char *s = splitArray + offset;
+   std::size_t i = 0;
+   switch (elementSize) {
+   case 2:
+      for (; i + 16 <= n; i += 16) {
+         const __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+         const __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + count + i));
+         _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * i), _mm_unpacklo_epi8(s0, s1));
+         _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 2 * i + 16), _mm_unpackhi_epi8(s0, s1));
+      }
+      break;
+   case 4:
+      for (; i + 16 <= n; i += 16) {
+         const __m128i s0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+         const __m128i s1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + count + i));
+         const __m128i s2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 2 * count + i));
+         const __m128i s3 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 3 * count + i));
+         const __m128i p01lo = _mm_unpacklo_epi8(s0, s1);
+         const __m128i p01hi = _mm_unpackhi_epi8(s0, s1);
+         const __m128i p23lo = _mm_unpacklo_epi8(s2, s3);
+         const __m128i p23hi = _mm_unpackhi_epi8(s2, s3);
+         auto d = reinterpret_cast<__m128i *>(dst + 4 * i);
+         _mm_storeu_si128(d, _mm_unpacklo_epi16(p01lo, p23lo));
+         _mm_storeu_si128(d + 1, _mm_unpackhi_epi16(p01lo, p23lo));
+         _mm_storeu_si128(d + 2, _mm_unpacklo_epi16(p01hi, p23hi));
+         _mm_storeu_si128(d + 3, _mm_unpackhi_epi16(p01hi, p23hi));
+      }
+      break;
+   case 8:
+      for (; i + 16 <= n; i += 16) {
+         __m128i p[8]; // 2-byte pairs of the elements 0-7 (even indexes) and 8-15 (odd indexes)
+         for (int k = 0; k < 4; ++k) {
+            const __m128i sa = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 2 * k * count + i));
+            const __m128i sb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + (2 * k + 1) * count + i));
+            p[2 * k] = _mm_unpacklo_epi8(sa, sb);
+            p[2 * k + 1] = _mm_unpackhi_epi8(sa, sb);
+         }
+         __m128i q[8]; // 4-byte groups of the elements 0-3, 4-7, 8-11, 12-15 for the lower and upper half of bytes
+         for (int h = 0; h < 2; ++h) {
+            q[4 * h] = _mm_unpacklo_epi16(p[4 * h], p[4 * h + 2]);
+            q[4 * h + 1] = _mm_unpackhi_epi16(p[4 * h], p[4 * h + 2]);
+            q[4 * h + 2] = _mm_unpacklo_epi16(p[4 * h + 1], p[4 * h + 3]);
+            q[4 * h + 3] = _mm_unpackhi_epi16(p[4 * h + 1], p[4 * h + 3]);
+         }
+         auto d = reinterpret_cast<__m128i *>(dst + 8 * i);
+         for (int k = 0; k < 4; ++k) {
+            _mm_storeu_si128(d + 2 * k, _mm_unpacklo_epi32(q[k], q[4 + k]));
+            _mm_storeu_si128(d + 2 * k + 1, _mm_unpackhi_epi32(q[k], q[4 + k]));
+         }
+      }
+      break;
+   }
+   return i;
+}
+#endif
+
+} // anonymous namespace
+
+void ROOT::Experimental::Internal::SplitBytes(void *splitArray, const void *source, std::size_t count,
+                                              std::size_t offset, std::size_t n, std::size_t elementSize)
+{
+   auto dst = reinterpret_cast<unsigned char *>(splitArray);
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   std::size_t nDone = 0;
+#if defined(__SSE2__)
+   nDone = SplitBytesSSE2(dst, src, count, offset, n, elementSize);
+#endif
+   SplitBytesScalar(dst, src + nDone * elementSize, count, offset + nDone, n - nDone, elementSize);
+}
+
+void ROOT::Experimental::Internal::UnsplitBytes(void *destination, const void *splitArray, std::size_t count,
+                                                std::size_t offset, std::size_t n, std::size_t elementSize)
+{
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   auto src = reinterpret_cast<const unsigned char *>(splitArray);
+   std::size_t nDone = 0;
+#if defined(__SSE2__)
+   nDone = UnsplitBytesSSE2(dst, src, count, offset, n, elementSize);
+#endif
+   UnsplitBytesScalar(dst + nDone * elementSize, src, count, offset + nDone, n - nDone, elementSize);
+}
+
+void ROOT::Experimental::Internal::PackBits(void *destination, const std::uint32_t *source, std::size_t count,
+                                           std::size_t nBits)
+{
+   const std::uint64_t mask = (std::uint64_t(1) << nBits) - 1;
+   auto dst = reinterpret_cast<unsigned char *>(destination);
+   std::uint64_t accumulator = 0;
+   std::size_t nAccumulated = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      accumulator |= (source[i] & mask) << nAccumulated;
+      nAccumulated += nBits;
+      while (nAccumulated >= 8) {
+         *dst++ = accumulator & 0xff;
+         accumulator >>= 8;
+         nAccumulated -= 8;
+      }
+   }
+   if (nAccumulated > 0)
+      *dst = accumulator & 0xff;
+}
+
+void ROOT::Experimental::Internal::UnpackBits(std::uint32_t *destination, const void *source, std::size_t count,
+                                             std::size_t nBits)
+{
+   const std::uint64_t mask = (std::uint64_t(1) << nBits) - 1;
+   auto src = reinterpret_cast<const unsigned char *>(source);
+   std::uint64_t accumulator = 0;
+   std::size_t nAccumulated = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      while (nAccumulated < nBits) {
+         accumulator |= std::uint64_t(*src++) << nAccumulated;
+         nAccumulated += 8;
+      }
+      destination[i] = accumulator & mask;
+      accumulator >>= nBits;
+      nAccumulated -= nBits;
+   }
+}
+
 template <>
 std::unique_ptr<ROOT::Experimental::Detail::RColumnElementBase>
 ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
@@ -56,6 +277,8 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate<void>(EColumnType type)
    case EColumnType::kSplitUInt32: return std::make_unique<RColumnElement<std::uint32_t, EColumnType::kSplitUInt32>>();
    case EColumnType::kSplitInt16: return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>();
    case EColumnType::kSplitUInt16: return std::make_unique<RColumnElement<std::uint16_t, EColumnType::kSplitUInt16>>();
+   case EColumnType::kReal32Trunc: return std::make_unique<RColumnElement<float, EColumnType::kReal32Trunc>>();
+   case EColumnType::kReal32Quant: return std::make_unique<RColumnElement<float, EColumnType::kReal32Quant>>();
    default: R__ASSERT(false);
    }
    // never here
@@ -90,12 +313,30 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
    case EColumnType::kSplitUInt32: return 32;
    case EColumnType::kSplitInt16: return 16;
    case EColumnType::kSplitUInt16: return 16;
+   case EColumnType::kReal32Trunc: return RColumnElementTruncReal32<float>::kMaxBits;
+   case EColumnType::kReal32Quant: return RColumnElementQuantReal32<float>::kMaxBits;
    default: R__ASSERT(false);
    }
    // never here
    return 0;
 }
 
+std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(const RColumnModel &model)
+{
+   return model.GetBitsOnStorage() > 0 ? model.GetBitsOnStorage() : GetBitsOnStorage(model.GetType());
+}
+
+std::pair<std::size_t, std::size_t> ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(EColumnType type)
+{
+   switch (type) {
+   case EColumnType::kReal32Trunc:
+      return {RColumnElementTruncReal32<float>::kMinBits, RColumnElementTruncReal32<float>::kMaxBits};
+   case EColumnType::kReal32Quant:
+      return {RColumnElementQuantReal32<float>::kMinBits, RColumnElementQuantReal32<float>::kMaxBits};
+   default: return {GetBitsOnStorage(type), GetBitsOnStorage(type)};
+   }
+}
+
 std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnType type) {
    switch (type) {
    case EColumnType::kIndex64: return "Index64";
@@ -124,6 +365,8 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
    case EColumnType::kSplitUInt32: return "SplitUInt32";
    case EColumnType::kSplitInt16: return "SplitInt16";
    case EColumnType::kSplitUInt16: return "SplitUInt16";
+   case EColumnType::kReal32Trunc: return "Real32Trunc";
+   case EColumnType::kReal32Quant: return "Real32Quant";
    default: return "UNKNOWN";
    }
 }
@@ -242,7 +242,21 @@ int ROOT::Experimental::Detail::RDaosContainer::VectorReadWrite(MultiObjectRWOpe
    if ((ret = fPool->fEventQueue->InitializeEvent(&parent_event)) < 0)
       return ret;
 
+   // Number of children of `parent_event` that have been launched
+   unsigned int nInFlight = 0;
    for (auto &[key, batch] : map) {
+      // With a limited number of in-flight operations, wait for the current window and start a new one
+      if (fMaxInFlightOps > 0 && nInFlight == fMaxInFlightOps) {
+         if ((ret = fPool->fEventQueue->WaitOnParentBarrier(&parent_event)) < 0)
+            return ret;
+         if ((ret = fPool->fEventQueue->FinalizeEvent(&parent_event)) < 0)
+            return ret;
+         parent_event = daos_event_t{};
+         if ((ret = fPool->fEventQueue->InitializeEvent(&parent_event)) < 0)
+            return ret;
+         nInFlight = 0;
+      }
+
       requests.emplace_back(
          std::make_unique<RDaosObject>(*this, batch.fOid, cid.fCid),
          RDaosObject::FetchUpdateArgs{batch.fDistributionKey, batch.fDataRequests, /*is_async=*/true});
@@ -254,6 +268,7 @@ int ROOT::Experimental::Detail::RDaosContainer::VectorReadWrite(MultiObjectRWOpe
       // Launch operation
       if ((ret = (std::get<0>(requests.back()).get()->*fn)(std::get<1>(requests.back()))) < 0)
          return ret;
+      ++nInFlight;
    }
 
    // Sets parent barrier and waits for all children launched before it.
@@ -526,6 +526,23 @@ std::size_t ROOT::Experimental::Detail::RFieldBase::AppendImpl(const void * /* f
    return 0;
 }
 
+std::size_t ROOT::Experimental::Detail::RFieldBase::AppendBulkImpl(const void *from, std::size_t count)
+{
+   const auto valueSize = GetValueSize();
+   std::size_t nbytes = 0;
+   for (std::size_t i = 0; i < count; ++i) {
+      nbytes += Append(static_cast<const unsigned char *>(from) + i * valueSize);
+   }
+   return nbytes;
+}
+
+std::size_t ROOT::Experimental::Detail::RFieldBase::AppendCollectionBulkImpl(const void * /* items */,
+                                                                             const std::uint64_t * /* offsets */,
+                                                                             std::size_t /* count */)
+{
+   throw RException(R__FAIL("field '" + GetName() + "' of type '" + GetType() + "' is not a collection"));
+}
+
 void ROOT::Experimental::Detail::RFieldBase::ReadGlobalImpl(ROOT::Experimental::NTupleSize_t /*index*/, void * /* to */)
 {
    R__ASSERT(false);
@@ -932,22 +949,72 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 
 //------------------------------------------------------------------------------
 
+namespace {
+
+/// The column model of a float or double field that writes the given column type.  The truncated and quantized
+/// column types take their bit width and value range from the model set by SetTruncated() or SetQuantized().
+ROOT::Experimental::RColumnModel
+MakeRealColumnModel(ROOT::Experimental::EColumnType type, const ROOT::Experimental::RColumnModel &lossyModel)
+{
+   using ROOT::Experimental::EColumnType;
+   if (type != EColumnType::kReal32Trunc && type != EColumnType::kReal32Quant)
+      return ROOT::Experimental::RColumnModel(type);
+   if (lossyModel.GetType() != type) {
+      throw ROOT::Experimental::RException(
+         R__FAIL("the truncated and quantized column representations are set by SetTruncated() and SetQuantized()"));
+   }
+   return lossyModel;
+}
+
+ROOT::Experimental::RColumnModel MakeTruncatedColumnModel(std::size_t nBits)
+{
+   using ROOT::Experimental::EColumnType;
+   const auto validBits = ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(EColumnType::kReal32Trunc);
+   if (nBits < validBits.first || nBits > validBits.second)
+      throw ROOT::Experimental::RException(R__FAIL("invalid number of bits for a truncated float: " +
+                                                   std::to_string(nBits)));
+   ROOT::Experimental::RColumnModel model(EColumnType::kReal32Trunc, false);
+   model.SetBitsOnStorage(nBits);
+   return model;
+}
+
+ROOT::Experimental::RColumnModel MakeQuantizedColumnModel(double min, double max, std::size_t nBits)
+{
+   using ROOT::Experimental::EColumnType;
+   const auto validBits = ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(EColumnType::kReal32Quant);
+   if (nBits < validBits.first || nBits > validBits.second)
+      throw ROOT::Experimental::RException(R__FAIL("invalid number of bits for a quantized float: " +
+                                                   std::to_string(nBits)));
+   if (!(min < max))
+      throw ROOT::Experimental::RException(R__FAIL("invalid value range of a quantized float"));
+   ROOT::Experimental::RColumnModel model(EColumnType::kReal32Quant, false);
+   model.SetBitsOnStorage(nBits);
+   model.SetValueRange(min, max);
+   return model;
+}
+
+} // anonymous namespace
+
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<float>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations({{EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {});
+   static RColumnRepresentations representations(
+      {{EColumnType::kSplitReal32}, {EColumnType::kReal32}, {EColumnType::kReal32Trunc}, {EColumnType::kReal32Quant}},
+      {});
    return representations;
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   fColumns.emplace_back(
+      Detail::RColumn::Create<float>(MakeRealColumnModel(GetColumnRepresentative()[0], fLossyModel), 0));
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<float>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   const auto &columnDesc = desc.GetColumnDescriptor(desc.FindPhysicalColumnId(GetOnDiskId(), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<float>(columnDesc.GetModel(), 0));
 }
 
 void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -955,26 +1022,47 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
    visitor.VisitFloatField(*this);
 }
 
+void ROOT::Experimental::RField<float>::SetTruncated(std::size_t nBits)
+{
+   auto model = MakeTruncatedColumnModel(nBits);
+   SetColumnRepresentative({EColumnType::kReal32Trunc});
+   fLossyModel = model;
+}
+
+void ROOT::Experimental::RField<float>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   auto model = MakeQuantizedColumnModel(min, max, nBits);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fLossyModel = model;
+}
+
 
 //------------------------------------------------------------------------------
 
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
 ROOT::Experimental::RField<double>::GetColumnRepresentations() const
 {
-   static RColumnRepresentations representations(
-      {{EColumnType::kSplitReal64}, {EColumnType::kReal64}, {EColumnType::kSplitReal32}, {EColumnType::kReal32}}, {});
+   static RColumnRepresentations representations({{EColumnType::kSplitReal64},
+                                                  {EColumnType::kReal64},
+                                                  {EColumnType::kSplitReal32},
+                                                  {EColumnType::kReal32},
+                                                  {EColumnType::kReal32Trunc},
+                                                  {EColumnType::kReal32Quant}},
+                                                 {});
    return representations;
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(GetColumnRepresentative()[0]), 0));
+   fColumns.emplace_back(
+      Detail::RColumn::Create<double>(MakeRealColumnModel(GetColumnRepresentative()[0], fLossyModel), 0));
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto onDiskTypes = EnsureCompatibleColumnTypes(desc);
-   fColumns.emplace_back(Detail::RColumn::Create<double>(RColumnModel(onDiskTypes[0]), 0));
+   EnsureCompatibleColumnTypes(desc);
+   const auto &columnDesc = desc.GetColumnDescriptor(desc.FindPhysicalColumnId(GetOnDiskId(), 0));
+   fColumns.emplace_back(Detail::RColumn::Create<double>(columnDesc.GetModel(), 0));
 }
 
 void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -987,6 +1075,20 @@ void ROOT::Experimental::RField<double>::SetDouble32()
    fTypeAlias = "Double32_t";
 }
 
+void ROOT::Experimental::RField<double>::SetTruncated(std::size_t nBits)
+{
+   auto model = MakeTruncatedColumnModel(nBits);
+   SetColumnRepresentative({EColumnType::kReal32Trunc});
+   fLossyModel = model;
+}
+
+void ROOT::Experimental::RField<double>::SetQuantized(double min, double max, std::size_t nBits)
+{
+   auto model = MakeQuantizedColumnModel(min, max, nBits);
+   SetColumnRepresentative({EColumnType::kReal32Quant});
+   fLossyModel = model;
+}
+
 //------------------------------------------------------------------------------
 
 const ROOT::Experimental::Detail::RFieldBase::RColumnRepresentations &
@@ -1801,6 +1903,21 @@ std::size_t ROOT::Experimental::RVectorField::AppendImpl(const void *from)
    return nbytes + fColumns[0]->GetElement()->GetPackedSize();
 }
 
+std::size_t ROOT::Experimental::RVectorField::AppendCollectionBulkImpl(const void *items, const std::uint64_t *offsets,
+                                                                       std::size_t count)
+{
+   if (count == 0)
+      return 0;
+   std::size_t nbytes = CallAppendBulkOn(*fSubFields[0], items, offsets[count] - offsets[0]);
+   std::vector<ClusterSize_t> collectionOffsets(count);
+   for (std::size_t i = 0; i < count; ++i) {
+      fNWritten += offsets[i + 1] - offsets[i];
+      collectionOffsets[i] = fNWritten;
+   }
+   fColumns[0]->AppendV(collectionOffsets.data(), count);
+   return nbytes + count * fColumns[0]->GetElement()->GetPackedSize();
+}
+
 void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex, void *to)
 {
    auto typedValue = static_cast<std::vector<char> *>(to);
@@ -1927,6 +2044,21 @@ std::size_t ROOT::Experimental::RRVecField::AppendImpl(const void *from)
    return nbytes + fColumns[0]->GetElement()->GetPackedSize();
 }
 
+std::size_t ROOT::Experimental::RRVecField::AppendCollectionBulkImpl(const void *items, const std::uint64_t *offsets,
+                                                                     std::size_t count)
+{
+   if (count == 0)
+      return 0;
+   std::size_t nbytes = CallAppendBulkOn(*fSubFields[0], items, offsets[count] - offsets[0]);
+   std::vector<ClusterSize_t> collectionOffsets(count);
+   for (std::size_t i = 0; i < count; ++i) {
+      fNWritten += offsets[i + 1] - offsets[i];
+      collectionOffsets[i] = fNWritten;
+   }
+   fColumns[0]->AppendV(collectionOffsets.data(), count);
+   return nbytes + count * fColumns[0]->GetElement()->GetPackedSize();
+}
+
 void ROOT::Experimental::RRVecField::ReadGlobalImpl(NTupleSize_t globalIndex, void *to)
 {
    // TODO as a performance optimization, we could assign values to elements of the inline buffer:
@@ -17,6 +17,7 @@
 
 #include <ROOT/RFieldVisitor.hxx>
 #include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RPageAllocator.hxx>
 #include <ROOT/RPageSourceFriends.hxx>
 #include <ROOT/RPageStorage.hxx>
 #include <ROOT/RPageSinkBuf.hxx>
@@ -31,10 +32,12 @@
 #include <TROOT.h> // for IsImplicitMTEnabled()
 
 #include <algorithm>
+#include <cstring>
 #include <exception>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -217,6 +220,13 @@ void ROOT::Experimental::RNTupleReader::PrintInfo(const ENTupleInfo what, std::o
    }
    case ENTupleInfo::kStorageDetails: fSource->GetSharedDescriptorGuard()->PrintInfo(output); break;
    case ENTupleInfo::kMetrics: fMetrics.Print(output); break;
+   case ENTupleInfo::kIOStats:
+      if (auto ioStats = fSource->GetIOStats()) {
+         ioStats->PrintTable(output, fSource->GetSharedDescriptorGuard().GetRef());
+      } else {
+         output << "I/O statistics are not available, see RNTupleReadOptions::SetEnableIOStats()" << std::endl;
+      }
+      break;
    default:
       // Unhandled case, internal error
       R__ASSERT(false);
@@ -274,7 +284,8 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(std::unique_ptr<ROOT::Experimen
    }
    fModel->Freeze();
 #ifdef R__USE_IMT
-   if (IsImplicitMTEnabled()) {
+   if (IsImplicitMTEnabled() &&
+       fSink->GetWriteOptions().GetUseImplicitMT() == RNTupleWriteOptions::EImplicitMT::kDefault) {
       fZipTasks = std::make_unique<RNTupleImtTaskScheduler>();
       fSink->SetTaskScheduler(fZipTasks.get());
    }
@@ -318,6 +329,62 @@ ROOT::Experimental::RNTupleWriter::Append(std::unique_ptr<RNTupleModel> model, s
    return std::make_unique<RNTupleWriter>(std::move(model), std::move(sink));
 }
 
+std::size_t ROOT::Experimental::RNTupleWriter::FillBulk(std::size_t nEntries, const std::vector<RBulkFieldData> &data)
+{
+   // Match the buffers to the top-level fields before writing anything
+   const auto fields = fModel->GetFieldZero()->GetSubFields();
+   std::vector<const RBulkFieldData *> fieldData(fields.size(), nullptr);
+   for (const auto &d : data) {
+      auto itr = std::find_if(fields.begin(), fields.end(),
+                              [&d](const Detail::RFieldBase *f) { return f->GetName() == d.fFieldName; });
+      if (itr == fields.end())
+         throw RException(R__FAIL("invalid bulk data for unknown field '" + d.fFieldName + "'"));
+      auto &slot = fieldData[std::distance(fields.begin(), itr)];
+      if (slot)
+         throw RException(R__FAIL("duplicate bulk data for field '" + d.fFieldName + "'"));
+      if (!d.fValues && (nEntries > 0))
+         throw RException(R__FAIL("missing values in bulk data for field '" + d.fFieldName + "'"));
+      if (d.fOffsets && !dynamic_cast<const RVectorField *>(*itr) && !dynamic_cast<const RRVecField *>(*itr))
+         throw RException(R__FAIL("invalid bulk offsets for field '" + d.fFieldName + "', which is not a vector"));
+      slot = &d;
+   }
+   for (std::size_t i = 0; i < fields.size(); ++i) {
+      if (!fieldData[i])
+         throw RException(R__FAIL("missing bulk data for field '" + fields[i]->GetName() + "'"));
+   }
+
+   // Write in chunks that roughly fill the current cluster, so that the clusters can be committed in between
+   std::size_t bytesWritten = 0;
+   std::size_t chunkSize = std::min<std::size_t>(nEntries, 1024);
+   for (std::size_t first = 0; first < nEntries;) {
+      const auto n = std::min(chunkSize, nEntries - first);
+      std::size_t bytesChunk = 0;
+      for (std::size_t i = 0; i < fields.size(); ++i) {
+         const auto d = fieldData[i];
+         if (d->fOffsets) {
+            const auto items = static_cast<const unsigned char *>(d->fValues) +
+                               (d->fOffsets[first] - d->fOffsets[0]) * fields[i]->GetSubFields()[0]->GetValueSize();
+            bytesChunk += fields[i]->AppendCollectionBulk(items, d->fOffsets + first, n);
+         } else {
+            bytesChunk += fields[i]->AppendBulk(
+               static_cast<const unsigned char *>(d->fValues) + first * fields[i]->GetValueSize(), n);
+         }
+      }
+      fUnzippedClusterSize += bytesChunk;
+      fNEntries += n;
+      bytesWritten += bytesChunk;
+      first += n;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+
+      const std::size_t bytesPerEntry = std::max<std::size_t>(1, bytesChunk / n);
+      const std::size_t clusterSizeLeft =
+         std::min<std::size_t>(fMaxUnzippedClusterSize, fUnzippedClusterSizeEst) - fUnzippedClusterSize;
+      chunkSize = std::max<std::size_t>(1, clusterSizeLeft / bytesPerEntry);
+   }
+   return bytesWritten;
+}
+
 void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
 {
    if (fNEntries == fLastCommittedClusterGroup)
@@ -360,6 +427,235 @@ void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
 
 //------------------------------------------------------------------------------
 
+namespace {
+
+// clang-format off
+/**
+\class RPageSinkFillContext
+\ingroup NTuple
+\brief The page sink of an RNTupleFillContext
+
+Pages are sealed in the filling thread and kept in memory until the cluster is committed. On CommitCluster(), the
+sealed pages of all columns are written in one go through the page sink of the parallel writer, holding its lock.
+The fill context's model is a clone of the parallel writer's model, so the physical column IDs issued by this sink
+match the ones of the parallel writer's sink.
+*/
+// clang-format on
+class RPageSinkFillContext final : public ROOT::Experimental::Detail::RPageSink {
+   using NTupleSize_t = ROOT::Experimental::NTupleSize_t;
+   using RNTupleLocator = ROOT::Experimental::RNTupleLocator;
+   using RPage = ROOT::Experimental::Detail::RPage;
+
+   /// The page sink of the parallel writer; only accessed with fMutex locked
+   RPageSink &fMainSink;
+   std::mutex &fMutex;
+   /// The number of entries committed to fMainSink by all fill contexts; only accessed with fMutex locked
+   NTupleSize_t &fMainNEntries;
+   /// The sealed pages of the currently open cluster, indexed by physical column id
+   std::vector<SealedPageSequence_t> fSealedPages;
+   /// Memory of the sealed pages in fSealedPages
+   std::vector<std::unique_ptr<unsigned char[]>> fSealedPageBuffers;
+
+   void AddSealedPage(ROOT::Experimental::DescriptorId_t physicalColumnId, RSealedPage sealedPage,
+                      std::unique_ptr<unsigned char[]> buffer)
+   {
+      if (sealedPage.fBuffer != buffer.get()) {
+         memcpy(buffer.get(), sealedPage.fBuffer, sealedPage.fSize);
+         sealedPage.fBuffer = buffer.get();
+      }
+      fSealedPages.at(physicalColumnId).emplace_back(std::move(sealedPage));
+      fSealedPageBuffers.emplace_back(std::move(buffer));
+   }
+
+protected:
+   void CreateImpl(const ROOT::Experimental::RNTupleModel & /* model */, unsigned char * /* serializedHeader */,
+                   std::uint32_t /* length */) final
+   {
+      // The header is written by the main sink
+      fSealedPages.resize(fDescriptorBuilder.GetDescriptor().GetNPhysicalColumns());
+   }
+
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final
+   {
+      auto buffer = std::make_unique<unsigned char[]>(page.GetNBytes() + kNBytesPageChecksum);
+      auto sealedPage = SealPage(page, *columnHandle.fColumn->GetElement(), GetWriteOptions().GetCompression(),
+                                 buffer.get(), GetWriteOptions().GetEnablePageChecksums());
+      AddSealedPage(columnHandle.fPhysicalId, std::move(sealedPage), std::move(buffer));
+      // The locators of this sink are never serialized
+      return RNTupleLocator{};
+   }
+
+   RNTupleLocator
+   CommitSealedPageImpl(ROOT::Experimental::DescriptorId_t physicalColumnId, const RSealedPage &sealedPage) final
+   {
+      auto buffer = std::make_unique<unsigned char[]>(sealedPage.fSize);
+      AddSealedPage(physicalColumnId, RSealedPage(sealedPage.fBuffer, sealedPage.fSize, sealedPage.fNElements,
+                                                            sealedPage.fHasChecksum),
+                    std::move(buffer));
+      return RNTupleLocator{};
+   }
+
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      std::vector<RSealedPageGroup> toCommit;
+      toCommit.reserve(fSealedPages.size());
+      for (std::size_t i = 0; i < fSealedPages.size(); ++i)
+         toCommit.emplace_back(i, fSealedPages[i].cbegin(), fSealedPages[i].cend());
+
+      std::uint64_t nbytes;
+      {
+         std::lock_guard<std::mutex> guard(fMutex);
+         fMainSink.CommitSealedPageV(toCommit);
+         fMainNEntries += nEntries - fPrevClusterNEntries;
+         nbytes = fMainSink.CommitCluster(fMainNEntries);
+      }
+
+      for (auto &sealedPages : fSealedPages)
+         sealedPages.clear();
+      fSealedPageBuffers.clear();
+      return nbytes;
+   }
+
+   RNTupleLocator CommitClusterGroupImpl(unsigned char * /* serializedPageList */, std::uint32_t /* length */) final
+   {
+      // Cluster groups are committed by the main sink
+      return RNTupleLocator{};
+   }
+
+   void CommitDatasetImpl(unsigned char * /* serializedFooter */, std::uint32_t /* length */) final {}
+
+public:
+   RPageSinkFillContext(RPageSink &mainSink, std::mutex &mutex, NTupleSize_t &mainNEntries)
+      : RPageSink(mainSink.GetNTupleName(), mainSink.GetWriteOptions()),
+        fMainSink(mainSink),
+        fMutex(mutex),
+        fMainNEntries(mainNEntries)
+   {
+   }
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      if (nElements == 0)
+         throw ROOT::Experimental::RException(R__FAIL("invalid call: request empty page"));
+      auto elementSize = columnHandle.fColumn->GetElement()->GetSize();
+      return ROOT::Experimental::Detail::RPageAllocatorHeap::NewPage(columnHandle.fPhysicalId, elementSize, nElements);
+   }
+
+   void ReleasePage(RPage &page) final { ROOT::Experimental::Detail::RPageAllocatorHeap::DeletePage(page); }
+};
+
+} // anonymous namespace
+
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(std::unique_ptr<RNTupleModel> model,
+                                                           std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model))
+{
+   fModel->Freeze();
+   fSink->Create(*fModel.get());
+
+   const auto &writeOpts = fSink->GetWriteOptions();
+   fMaxUnzippedClusterSize = writeOpts.GetMaxUnzippedClusterSize();
+   // First estimate is a factor 2 compression if compression is used at all
+   const int scale = writeOpts.GetCompression() ? 2 : 1;
+   fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
+}
+
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   try {
+      CommitCluster();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing cluster: " << err.GetError().GetReport();
+   }
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted)
+      return;
+   if (fSink->GetWriteOptions().GetHasSmallClusters() &&
+       (fUnzippedClusterSize > RNTupleWriteOptions::kMaxSmallClusterSize)) {
+      throw RException(R__FAIL("invalid attempt to write a cluster > 512MiB with 'small clusters' option enabled"));
+   }
+   for (auto &field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fNBytesCommitted += fSink->CommitCluster(fNEntries);
+   fNBytesFilled += fUnzippedClusterSize;
+
+   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+   const float compressionFactor =
+      std::min(1000.f, static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   fUnzippedClusterSizeEst =
+      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+//------------------------------------------------------------------------------
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
+   }
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
+   }
+   fModel->Freeze();
+   fSink->Create(*fModel.get());
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
+}
+
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   for (const auto &context : fFillContexts) {
+      if (!context.expired()) {
+         R__LOG_ERROR(NTupleLog()) << "RNTupleFillContext has not been destructed";
+         return;
+      }
+   }
+
+   try {
+      if (fNEntries > 0)
+         fSink->CommitClusterGroup();
+      fSink->CommitDataset();
+   } catch (const RException &err) {
+      R__LOG_ERROR(NTupleLog()) << "failure committing ntuple: " << err.GetError().GetReport();
+   }
+}
+
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   // The fill contexts already hand over sealed pages for entire clusters; there is nothing left to buffer
+   auto sinkOptions = options.Clone();
+   sinkOptions->SetUseBufferedWrite(false);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, *sinkOptions));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+
+   auto model = fModel->Clone();
+   // Give the cloned model a new id so that entries cannot be filled into the wrong context
+   model->Unfreeze();
+   model->Freeze();
+   auto sink = std::make_unique<RPageSinkFillContext>(*fSink, fMutex, fNEntries);
+   std::shared_ptr<RNTupleFillContext> context(new RNTupleFillContext(std::move(model), std::move(sink)));
+   fFillContexts.emplace_back(context);
+   return context;
+}
+
+//------------------------------------------------------------------------------
+
 ROOT::Experimental::RCollectionNTupleWriter::RCollectionNTupleWriter(std::unique_ptr<REntry> defaultEntry)
    : fOffset(0), fDefaultEntry(std::move(defaultEntry))
 {
@@ -495,6 +495,15 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(DescriptorId_t
                                                                  std::uint64_t firstElementIndex,
                                                                  std::uint32_t compressionSettings,
                                                                  const RClusterDescriptor::RPageRange &pageRange)
+{
+   return CommitColumnRange(physicalId, firstElementIndex, compressionSettings, pageRange.Clone());
+}
+
+ROOT::Experimental::RResult<void>
+ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(DescriptorId_t physicalId,
+                                                                 std::uint64_t firstElementIndex,
+                                                                 std::uint32_t compressionSettings,
+                                                                 RClusterDescriptor::RPageRange &&pageRange)
 {
    if (physicalId != pageRange.fPhysicalColumnId)
       return R__FAIL("column ID mismatch");
@@ -505,7 +514,7 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(DescriptorId_t
    for (const auto &pi : pageRange.fPageInfos) {
       columnRange.fNElements += pi.fNElements;
    }
-   fCluster.fPageRanges[physicalId] = pageRange.Clone();
+   fCluster.fPageRanges[physicalId] = std::move(pageRange);
    fCluster.fColumnRanges[physicalId] = columnRange;
    return RResult<void>::Success();
 }
@@ -553,7 +562,7 @@ ROOT::Experimental::RClusterDescriptorBuilder::AddDeferredColumnRanges(const RNT
                if (c.IsDeferredColumn()) {
                   columnRange.fFirstElementIndex = fCluster.GetFirstEntryIndex() * nRepetitions;
                   columnRange.fNElements = fCluster.GetNEntries() * nRepetitions;
-                  const auto element = Detail::RColumnElementBase::Generate<void>(c.GetModel().GetType());
+                  const auto element = Detail::RColumnElementBase::Generate<void>(c.GetModel());
                   pageRange.ExtendToFitColumnRange(columnRange, *element, Detail::RPage::kPageZeroSize);
                }
             }
@@ -0,0 +1,208 @@
+/// \file RNTupleIOStats.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2026-10-14
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RNTupleIOStats.hxx>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+using RCounts = ROOT::Experimental::Detail::RNTupleIOStats::RCounts;
+
+/// The qualified field name of the column with the index of the column within its field, e.g. `jets.pt[0]`
+std::string GetColumnName(const ROOT::Experimental::RNTupleDescriptor &desc,
+                          ROOT::Experimental::DescriptorId_t physicalColumnId)
+{
+   const auto &columnDesc = desc.GetColumnDescriptor(physicalColumnId);
+   return desc.GetQualifiedFieldName(columnDesc.GetFieldId()) + "[" + std::to_string(columnDesc.GetIndex()) + "]";
+}
+
+std::string GetColumnType(const ROOT::Experimental::RNTupleDescriptor &desc,
+                          ROOT::Experimental::DescriptorId_t physicalColumnId)
+{
+   return ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(
+      desc.GetColumnDescriptor(physicalColumnId).GetModel().GetType());
+}
+
+std::string EscapeJSON(const std::string &str)
+{
+   std::string result;
+   for (auto c : str) {
+      if (c == '"' || c == '\\')
+         result += '\\';
+      result += c;
+   }
+   return result;
+}
+
+void PrintCountsJSON(std::ostream &output, const RCounts &counts)
+{
+   output << "\"szRead\": " << counts.fSzRead << ", \"nPageUnzipped\": " << counts.fNPageUnzipped
+          << ", \"szUnzip\": " << counts.fSzUnzip << ", \"timeWallUnzip\": " << counts.fTimeWallUnzip
+          << ", \"nPagePoolHit\": " << counts.fNPagePoolHit;
+}
+
+void PrintCountsRow(std::ostream &output, const std::string &label, const RCounts &counts)
+{
+   output << std::left << std::setw(40) << label << std::right << std::setw(14) << counts.fSzRead << std::setw(10)
+          << counts.fNPageUnzipped << std::setw(14) << counts.fSzUnzip << std::setw(12)
+          << counts.fTimeWallUnzip / 1000 << std::setw(10) << counts.fNPagePoolHit << std::endl;
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::Detail::RNTupleIOStats::RCounts &
+ROOT::Experimental::Detail::RNTupleIOStats::RCounts::operator+=(const RCounts &other)
+{
+   fSzRead += other.fSzRead;
+   fNPageUnzipped += other.fNPageUnzipped;
+   fSzUnzip += other.fSzUnzip;
+   fTimeWallUnzip += other.fTimeWallUnzip;
+   fNPagePoolHit += other.fNPagePoolHit;
+   return *this;
+}
+
+void ROOT::Experimental::Detail::RNTupleIOStats::AddRead(DescriptorId_t physicalColumnId, DescriptorId_t clusterId,
+                                                         std::uint64_t nBytes)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fCounts[{physicalColumnId, clusterId}].fSzRead += nBytes;
+}
+
+void ROOT::Experimental::Detail::RNTupleIOStats::AddUnzip(DescriptorId_t physicalColumnId, DescriptorId_t clusterId,
+                                                          std::uint64_t nBytes, std::uint64_t timeWallNs)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   auto &counts = fCounts[{physicalColumnId, clusterId}];
+   counts.fNPageUnzipped++;
+   counts.fSzUnzip += nBytes;
+   counts.fTimeWallUnzip += timeWallNs;
+}
+
+void ROOT::Experimental::Detail::RNTupleIOStats::AddPagePoolHit(DescriptorId_t physicalColumnId,
+                                                                DescriptorId_t clusterId)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fCounts[{physicalColumnId, clusterId}].fNPagePoolHit++;
+}
+
+void ROOT::Experimental::Detail::RNTupleIOStats::Reset()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fCounts.clear();
+}
+
+std::map<ROOT::Experimental::Detail::RNTupleIOStats::Key_t, ROOT::Experimental::Detail::RNTupleIOStats::RCounts>
+ROOT::Experimental::Detail::RNTupleIOStats::GetCounts() const
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fCounts;
+}
+
+ROOT::Experimental::Detail::RNTupleIOStats::RCounts
+ROOT::Experimental::Detail::RNTupleIOStats::GetColumnCounts(DescriptorId_t physicalColumnId) const
+{
+   RCounts result;
+   std::lock_guard<std::mutex> guard(fLock);
+   // The map is ordered by column first
+   for (auto itr = fCounts.lower_bound({physicalColumnId, 0});
+        (itr != fCounts.end()) && (itr->first.first == physicalColumnId); ++itr) {
+      result += itr->second;
+   }
+   return result;
+}
+
+ROOT::Experimental::Detail::RNTupleIOStats::RCounts
+ROOT::Experimental::Detail::RNTupleIOStats::GetClusterCounts(DescriptorId_t clusterId) const
+{
+   RCounts result;
+   std::lock_guard<std::mutex> guard(fLock);
+   for (const auto &c : fCounts) {
+      if (c.first.second == clusterId)
+         result += c.second;
+   }
+   return result;
+}
+
+void ROOT::Experimental::Detail::RNTupleIOStats::PrintTable(std::ostream &output, const RNTupleDescriptor &desc,
+                                                            bool perCluster) const
+{
+   const auto counts = GetCounts();
+
+   std::vector<std::pair<DescriptorId_t, RCounts>> columns;
+   for (const auto &c : counts) {
+      if (columns.empty() || columns.back().first != c.first.first)
+         columns.emplace_back(c.first.first, RCounts());
+      columns.back().second += c.second;
+   }
+   std::stable_sort(columns.begin(), columns.end(),
+                    [](const std::pair<DescriptorId_t, RCounts> &a, const std::pair<DescriptorId_t, RCounts> &b) {
+                       return a.second.fSzRead > b.second.fSzRead;
+                    });
+
+   output << std::left << std::setw(40) << "Column" << std::right << std::setw(14) << "Read [B]" << std::setw(10)
+          << "Unzipped" << std::setw(14) << "Unzip [B]" << std::setw(12) << "Unzip [us]" << std::setw(10)
+          << "Pool hits" << std::endl;
+   output << std::string(100, '-') << std::endl;
+   RCounts total;
+   for (const auto &col : columns) {
+      PrintCountsRow(output, GetColumnName(desc, col.first), col.second);
+      total += col.second;
+      if (!perCluster)
+         continue;
+      for (auto itr = counts.lower_bound({col.first, 0}); (itr != counts.end()) && (itr->first.first == col.first);
+           ++itr) {
+         PrintCountsRow(output, "  cluster " + std::to_string(itr->first.second), itr->second);
+      }
+   }
+   output << std::string(100, '-') << std::endl;
+   PrintCountsRow(output, "Total", total);
+}
+
+std::string ROOT::Experimental::Detail::RNTupleIOStats::ToJSON(const RNTupleDescriptor &desc) const
+{
+   const auto counts = GetCounts();
+
+   std::ostringstream output;
+   output << "{\"columns\": [";
+   for (auto itr = counts.begin(); itr != counts.end();) {
+      const auto physicalColumnId = itr->first.first;
+      if (itr != counts.begin())
+         output << ", ";
+      const auto &columnDesc = desc.GetColumnDescriptor(physicalColumnId);
+      output << "{\"physicalColumnId\": " << physicalColumnId << ", \"field\": \""
+             << EscapeJSON(desc.GetQualifiedFieldName(columnDesc.GetFieldId())) << "\", \"index\": "
+             << columnDesc.GetIndex() << ", \"type\": \"" << GetColumnType(desc, physicalColumnId)
+             << "\", \"clusters\": [";
+      RCounts columnTotal;
+      for (bool first = true; (itr != counts.end()) && (itr->first.first == physicalColumnId); ++itr, first = false) {
+         if (!first)
+            output << ", ";
+         output << "{\"clusterId\": " << itr->first.second << ", ";
+         PrintCountsJSON(output, itr->second);
+         output << "}";
+         columnTotal += itr->second;
+      }
+      output << "], ";
+      PrintCountsJSON(output, columnTotal);
+      output << "}";
+   }
+   output << "]}";
+   return output.str();
+}
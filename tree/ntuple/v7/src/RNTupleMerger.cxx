@@ -13,11 +13,42 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleSerialize.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/// Returns the field id of the field with the given qualified name, e.g. `jets._0.pt`, or kInvalidDescriptorId
+ROOT::Experimental::DescriptorId_t
+FindQualifiedFieldId(const ROOT::Experimental::RNTupleDescriptor &desc, const std::string &qualifiedName)
+{
+   auto fieldId = desc.GetFieldZeroId();
+   std::string::size_type start = 0;
+   while (fieldId != ROOT::Experimental::kInvalidDescriptorId) {
+      const auto end = qualifiedName.find('.', start);
+      fieldId = desc.FindFieldId(qualifiedName.substr(start, end - start), fieldId);
+      if (end == std::string::npos)
+         break;
+      start = end + 1;
+   }
+   return fieldId;
+}
+
+} // anonymous namespace
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
    if (inputs == nullptr || mergeInfo == nullptr) {
@@ -36,3 +67,154 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+std::vector<ROOT::Experimental::RNTupleMerger::RColumnInfo>
+ROOT::Experimental::RNTupleMerger::CollectColumns(const RNTupleDescriptor &source, const RNTupleDescriptor &destination)
+{
+   if (source.GetNPhysicalColumns() != destination.GetNPhysicalColumns()) {
+      throw RException(R__FAIL("cannot merge ntuple '" + source.GetName() + "': " +
+                               std::to_string(source.GetNPhysicalColumns()) + " columns, expected " +
+                               std::to_string(destination.GetNPhysicalColumns())));
+   }
+
+   std::vector<RColumnInfo> columns;
+   for (const auto &columnDesc : destination.GetColumnIterable()) {
+      if (columnDesc.IsAliasColumn())
+         continue;
+
+      const auto qualifiedName = destination.GetQualifiedFieldName(columnDesc.GetFieldId());
+      const auto sourceFieldId = FindQualifiedFieldId(source, qualifiedName);
+      const auto sourceColumnId = (sourceFieldId == kInvalidDescriptorId)
+                                     ? kInvalidDescriptorId
+                                     : source.FindPhysicalColumnId(sourceFieldId, columnDesc.GetIndex());
+      if (sourceColumnId == kInvalidDescriptorId) {
+         throw RException(R__FAIL("cannot merge ntuple '" + source.GetName() + "': missing column " +
+                                  std::to_string(columnDesc.GetIndex()) + " of field " + qualifiedName));
+      }
+      if (!(source.GetColumnDescriptor(sourceColumnId).GetModel() == columnDesc.GetModel())) {
+         throw RException(R__FAIL("cannot merge ntuple '" + source.GetName() + "': column " +
+                                  std::to_string(columnDesc.GetIndex()) + " of field " + qualifiedName +
+                                  " has a different column type"));
+      }
+
+      RColumnInfo info;
+      info.fSourceId = sourceColumnId;
+      info.fDestinationId = columnDesc.GetPhysicalId();
+      info.fBitsOnStorage = Detail::RColumnElementBase::GetBitsOnStorage(columnDesc.GetModel());
+      columns.emplace_back(info);
+   }
+   return columns;
+}
+
+void ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination)
+{
+   fNPagesCopied = 0;
+   fNPagesRecompressed = 0;
+   if (sources.empty())
+      throw RException(R__FAIL("no ntuples to merge"));
+
+   for (auto source : sources)
+      source->Attach();
+
+   std::unique_ptr<RNTupleModel> model;
+   {
+      auto descriptorGuard = sources[0]->GetSharedDescriptorGuard();
+      model = descriptorGuard->GenerateModel();
+   }
+   model->Freeze();
+   destination.Create(*model);
+   const auto compression = destination.GetWriteOptions().GetCompression();
+
+   // Only needed if pages need to be recompressed
+   std::unique_ptr<Detail::RNTupleDecompressor> decompressor;
+   NTupleSize_t nEntries = 0;
+   for (auto source : sources) {
+      const auto columns = CollectColumns(source->GetSharedDescriptorGuard().GetRef(), destination.GetDescriptor());
+
+      std::vector<DescriptorId_t> clusterIds;
+      {
+         auto descriptorGuard = source->GetSharedDescriptorGuard();
+         for (const auto &clusterDesc : descriptorGuard->GetClusterIterable())
+            clusterIds.emplace_back(clusterDesc.GetId());
+      }
+
+      for (auto clusterId : clusterIds) {
+         // The sealed pages of all the columns of the cluster are committed in a single vector write
+         std::deque<Detail::RPageStorage::RSealedPage> sealedPages;
+         std::vector<Detail::RPageStorage::RSealedPageGroup> sealedPageGroups;
+         std::vector<std::unique_ptr<unsigned char[]>> buffers;
+         // The sealed page groups point into sealedPages, which must not change anymore; we therefore remember
+         // the page ranges as indexes first
+         std::vector<std::pair<std::size_t, std::size_t>> pageRanges;
+
+         const auto clusterDesc = source->GetSharedDescriptorGuard()->GetClusterDescriptor(clusterId).Clone();
+
+         for (const auto &column : columns) {
+            pageRanges.emplace_back(sealedPages.size(), sealedPages.size());
+            if (!clusterDesc.ContainsColumn(column.fSourceId))
+               continue;
+
+            const bool isCopyable = clusterDesc.GetColumnRange(column.fSourceId).fCompressionSettings == compression;
+            const auto &pageRange = clusterDesc.GetPageRange(column.fSourceId);
+            NTupleSize_t firstElementInPage = 0;
+            for (const auto &pageInfo : pageRange.fPageInfos) {
+               Detail::RPageStorage::RSealedPage sealedPage;
+               buffers.emplace_back(std::make_unique<unsigned char[]>(pageInfo.fLocator.fBytesOnStorage));
+               sealedPage.fBuffer = buffers.back().get();
+               source->LoadSealedPage(column.fSourceId, RClusterIndex(clusterId, firstElementInPage), sealedPage);
+               firstElementInPage += pageInfo.fNElements;
+
+               const auto packedSize = (sealedPage.fNElements * column.fBitsOnStorage + 7) / 8;
+               if (isCopyable || (sealedPage.GetDataSize() == packedSize && compression % 100 == 0)) {
+                  sealedPages.emplace_back(std::move(sealedPage));
+                  fNPagesCopied++;
+                  continue;
+               }
+
+               // Copied pages keep their checksum; recompressed pages are verified before their checksum is
+               // replaced (or dropped) according to the write options of the destination
+               if (!sealedPage.VerifyChecksum()) {
+                  throw RException(R__FAIL("cannot merge ntuple '" + source->GetNTupleName() +
+                                           "': page checksum verification failed"));
+               }
+               auto packedBuffer = std::make_unique<unsigned char[]>(packedSize);
+               if (!decompressor)
+                  decompressor = std::make_unique<Detail::RNTupleDecompressor>();
+               decompressor->Unzip(sealedPage.fBuffer, sealedPage.GetDataSize(), packedSize, packedBuffer.get());
+               // The compressed data is never larger than the input; incompressible data is stored as is
+               auto zipBuffer =
+                  std::make_unique<unsigned char[]>(packedSize + Detail::RPageStorage::kNBytesPageChecksum);
+               sealedPage.fSize =
+                  Detail::RNTupleCompressor::Zip(packedBuffer.get(), packedSize, compression, zipBuffer.get());
+               sealedPage.fHasChecksum = destination.GetWriteOptions().GetEnablePageChecksums();
+               if (sealedPage.fHasChecksum) {
+                  Internal::RNTupleSerializer::SerializeUInt64(
+                     Detail::RPageStorage::RSealedPage::ComputeChecksum(zipBuffer.get(), sealedPage.fSize),
+                     zipBuffer.get() + sealedPage.fSize);
+                  sealedPage.fSize += Detail::RPageStorage::kNBytesPageChecksum;
+               }
+               sealedPage.fBuffer = zipBuffer.get();
+               buffers.back() = std::move(zipBuffer);
+               sealedPages.emplace_back(std::move(sealedPage));
+               fNPagesRecompressed++;
+            }
+            pageRanges.back().second = sealedPages.size();
+         }
+
+         for (std::size_t i = 0; i < columns.size(); ++i) {
+            if (pageRanges[i].first == pageRanges[i].second)
+               continue;
+            sealedPageGroups.emplace_back(columns[i].fDestinationId, sealedPages.cbegin() + pageRanges[i].first,
+                                          sealedPages.cbegin() + pageRanges[i].second);
+         }
+         destination.CommitSealedPageV(sealedPageGroups);
+         nEntries += clusterDesc.GetNEntries();
+         destination.CommitCluster(nEntries);
+      }
+      destination.CommitClusterGroup();
+   }
+   destination.CommitDataset();
+}
@@ -187,7 +187,7 @@ std::uint32_t SerializeColumnListV1(const ROOT::Experimental::RNTupleDescriptor
 
          auto type = c.GetModel().GetType();
          pos += RNTupleSerializer::SerializeColumnType(type, *where);
-         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(type), *where);
+         pos += RNTupleSerializer::SerializeUInt16(RColumnElementBase::GetBitsOnStorage(c.GetModel()), *where);
          pos += RNTupleSerializer::SerializeUInt32(context.GetOnDiskFieldId(c.GetFieldId()), *where);
          std::uint32_t flags = 0;
          // TODO(jblomer): add support for descending columns in the column model
@@ -199,9 +199,19 @@ std::uint32_t SerializeColumnListV1(const ROOT::Experimental::RNTupleDescriptor
          const std::uint64_t firstElementIdx = c.GetFirstElementIndex();
          if (firstElementIdx > 0)
             flags |= RNTupleSerializer::kFlagDeferredColumn;
+         if (type == ROOT::Experimental::EColumnType::kReal32Quant)
+            flags |= RNTupleSerializer::kFlagHasValueRange;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
          if (flags & RNTupleSerializer::kFlagDeferredColumn)
             pos += RNTupleSerializer::SerializeUInt64(firstElementIdx, *where);
+         if (flags & RNTupleSerializer::kFlagHasValueRange) {
+            // the limits are stored as the bit patterns of IEEE 754 doubles
+            std::uint64_t min, max;
+            std::memcpy(&min, &c.GetModel().GetValueRange().first, sizeof(min));
+            std::memcpy(&max, &c.GetModel().GetValueRange().second, sizeof(max));
+            pos += RNTupleSerializer::SerializeUInt64(min, *where);
+            pos += RNTupleSerializer::SerializeUInt64(max, *where);
+         }
 
          pos += RNTupleSerializer::SerializeFramePostscript(buffer ? frame : nullptr, pos - frame);
       }
@@ -249,12 +259,32 @@ RResult<std::uint32_t> DeserializeColumnV1(
          return R__FAIL("column record frame too short");
       bytes += RNTupleSerializer::DeserializeUInt64(bytes, firstElementIdx);
    }
+   std::pair<double, double> valueRange{0., 0.};
+   if (flags & RNTupleSerializer::kFlagHasValueRange) {
+      if (fnFrameSizeLeft() < 2 * sizeof(std::uint64_t))
+         return R__FAIL("column record frame too short");
+      std::uint64_t min, max;
+      bytes += RNTupleSerializer::DeserializeUInt64(bytes, min);
+      bytes += RNTupleSerializer::DeserializeUInt64(bytes, max);
+      std::memcpy(&valueRange.first, &min, sizeof(min));
+      std::memcpy(&valueRange.second, &max, sizeof(max));
+      if (!(valueRange.first < valueRange.second))
+         return R__FAIL("invalid value range of quantized column");
+   } else if (type == EColumnType::kReal32Quant) {
+      return R__FAIL("missing value range of quantized column");
+   }
 
-   if (ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(type) != bitsOnStorage)
+   const auto validBits = ROOT::Experimental::Detail::RColumnElementBase::GetValidBitRange(type);
+   if (bitsOnStorage < validBits.first || bitsOnStorage > validBits.second)
       return R__FAIL("column element size mismatch");
 
    const bool isSorted = (flags & (RNTupleSerializer::kFlagSortAscColumn | RNTupleSerializer::kFlagSortDesColumn));
-   columnDesc.FieldId(fieldId).Model({type, isSorted}).FirstElementIndex(firstElementIdx);
+   ROOT::Experimental::RColumnModel model{type, isSorted};
+   if (validBits.first != validBits.second) {
+      model.SetBitsOnStorage(bitsOnStorage);
+      model.SetValueRange(valueRange.first, valueRange.second);
+   }
+   columnDesc.FieldId(fieldId).Model(model).FirstElementIndex(firstElementIdx);
 
    return frameSize;
 }
@@ -533,6 +563,8 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
    case EColumnType::kSplitUInt32: return SerializeUInt16(0x14, buffer);
    case EColumnType::kSplitInt16: return SerializeUInt16(0x1C, buffer);
    case EColumnType::kSplitUInt16: return SerializeUInt16(0x15, buffer);
+   case EColumnType::kReal32Trunc: return SerializeUInt16(0x1D, buffer);
+   case EColumnType::kReal32Quant: return SerializeUInt16(0x1E, buffer);
    default: throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
 }
@@ -572,6 +604,8 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
    case 0x14: type = EColumnType::kSplitUInt32; break;
    case 0x1C: type = EColumnType::kSplitInt16; break;
    case 0x15: type = EColumnType::kSplitUInt16; break;
+   case 0x1D: type = EColumnType::kReal32Trunc; break;
+   case 0x1E: type = EColumnType::kReal32Quant; break;
    default: return R__FAIL("unexpected on-disk column type");
    }
    return result;
@@ -1280,7 +1314,10 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          pos += SerializeListFramePreamble(pageRange.fPageInfos.size(), *where);
 
          for (const auto &pi : pageRange.fPageInfos) {
-            pos += SerializeUInt32(pi.fNElements, *where);
+            // A negative number of elements marks a page followed by its checksum
+            const std::int32_t nElements =
+               pi.fHasChecksum ? -static_cast<std::int32_t>(pi.fNElements) : static_cast<std::int32_t>(pi.fNElements);
+            pos += SerializeInt32(nElements, *where);
             pos += SerializeLocator(pi.fLocator, *where);
          }
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
@@ -1588,16 +1625,23 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
 
          RClusterDescriptor::RPageRange pageRange;
          pageRange.fPhysicalColumnId = j;
+         // a corrupted count must not trigger a huge allocation, each page takes at least 8 bytes
+         if (static_cast<std::int64_t>(nPages) * 8 <= fnInnerFrameSizeLeft())
+            pageRange.fPageInfos.reserve(nPages);
          for (std::uint32_t k = 0; k < nPages; ++k) {
             if (fnInnerFrameSizeLeft() < static_cast<int>(sizeof(std::uint32_t)))
                return R__FAIL("inner frame too short");
-            std::uint32_t nElements;
+            std::int32_t nElements;
             RNTupleLocator locator;
-            bytes += DeserializeUInt32(bytes, nElements);
+            bytes += DeserializeInt32(bytes, nElements);
             result = DeserializeLocator(bytes, fnInnerFrameSizeLeft(), locator);
             if (!result)
                return R__FORWARD_ERROR(result);
-            pageRange.fPageInfos.push_back({nElements, locator});
+            RClusterDescriptor::RPageRange::RPageInfo pageInfo;
+            pageInfo.fNElements = (nElements < 0) ? -nElements : nElements;
+            pageInfo.fLocator = locator;
+            pageInfo.fHasChecksum = nElements < 0;
+            pageRange.fPageInfos.push_back(pageInfo);
             bytes += result.Unwrap();
          }
 
@@ -1608,7 +1652,7 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          std::uint32_t compressionSettings;
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
-         clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
+         clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, std::move(pageRange));
          bytes = innerFrame + innerFrameSize;
       }
 
@@ -20,12 +20,43 @@
 
 #include <cstdlib>
 
+ROOT::Experimental::Detail::RPagePool::~RPagePool()
+{
+   for (std::size_t i = 0; i < fPages.size(); ++i) {
+      if (fReferences[i] == 0)
+         fDeleters[i](fPages[i]);
+   }
+}
+
+void ROOT::Experimental::Detail::RPagePool::ErasePage(std::size_t idx)
+{
+   fDeleters[idx](fPages[idx]);
+   const auto N = fPages.size();
+   fPages[idx] = fPages[N - 1];
+   fReferences[idx] = fReferences[N - 1];
+   fDeleters[idx] = fDeleters[N - 1];
+   fReturnedAt[idx] = fReturnedAt[N - 1];
+   fPages.resize(N - 1);
+   fReferences.resize(N - 1);
+   fDeleters.resize(N - 1);
+   fReturnedAt.resize(N - 1);
+}
+
+void ROOT::Experimental::Detail::RPagePool::MarkUsed(std::size_t idx)
+{
+   if (fReturnedAt[idx] == 0)
+      return;
+   fReturnedAt[idx] = 0;
+   fUnusedSize -= fPages[idx].GetNBytes();
+}
+
 void ROOT::Experimental::Detail::RPagePool::RegisterPage(const RPage &page, const RPageDeleter &deleter)
 {
    std::lock_guard<std::mutex> lockGuard(fLock);
    fPages.emplace_back(page);
    fReferences.emplace_back(1);
    fDeleters.emplace_back(deleter);
+   fReturnedAt.emplace_back(0);
 }
 
 void ROOT::Experimental::Detail::RPagePool::PreloadPage(const RPage &page, const RPageDeleter &deleter)
@@ -34,6 +65,28 @@ void ROOT::Experimental::Detail::RPagePool::PreloadPage(const RPage &page, const
    fPages.emplace_back(page);
    fReferences.emplace_back(0);
    fDeleters.emplace_back(deleter);
+   fReturnedAt.emplace_back(0);
+}
+
+void ROOT::Experimental::Detail::RPagePool::SetMaxUnusedSize(std::size_t maxUnusedSize)
+{
+   std::lock_guard<std::mutex> lockGuard(fLock);
+   fMaxUnusedSize = maxUnusedSize;
+   EvictUnused();
+}
+
+void ROOT::Experimental::Detail::RPagePool::EvictUnused()
+{
+   while (fUnusedSize > fMaxUnusedSize) {
+      std::size_t oldest = fPages.size();
+      for (std::size_t i = 0; i < fPages.size(); ++i) {
+         if (fReturnedAt[i] && ((oldest == fPages.size()) || (fReturnedAt[i] < fReturnedAt[oldest])))
+            oldest = i;
+      }
+      R__ASSERT(oldest < fPages.size());
+      fUnusedSize -= fPages[oldest].GetNBytes();
+      ErasePage(oldest);
+   }
 }
 
 void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
@@ -46,13 +99,14 @@ void ROOT::Experimental::Detail::RPagePool::ReturnPage(const RPage& page)
       if (fPages[i] != page) continue;
 
       if (--fReferences[i] == 0) {
-         fDeleters[i](fPages[i]);
-         fPages[i] = fPages[N-1];
-         fReferences[i] = fReferences[N-1];
-         fDeleters[i] = fDeleters[N-1];
-         fPages.resize(N-1);
-         fReferences.resize(N-1);
-         fDeleters.resize(N-1);
+         const std::size_t nBytes = fPages[i].GetNBytes();
+         if ((fMaxUnusedSize == 0) || (nBytes > fMaxUnusedSize)) {
+            ErasePage(i);
+            return;
+         }
+         fReturnedAt[i] = ++fNReturned;
+         fUnusedSize += nBytes;
+         EvictUnused();
       }
       return;
    }
@@ -68,6 +122,7 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage
       if (fReferences[i] < 0) continue;
       if (fPages[i].GetColumnId() != columnId) continue;
       if (!fPages[i].Contains(globalIndex)) continue;
+      MarkUsed(i);
       fReferences[i]++;
       return fPages[i];
    }
@@ -83,6 +138,7 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPagePool::GetPage
       if (fReferences[i] < 0) continue;
       if (fPages[i].GetColumnId() != columnId) continue;
       if (!fPages[i].Contains(clusterIndex)) continue;
+      MarkUsed(i);
       fReferences[i]++;
       return fPages[i];
    }
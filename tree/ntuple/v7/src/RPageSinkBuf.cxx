@@ -119,12 +119,18 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
    fCounters->fParallelZip.SetValue(1);
    // Thread safety: Each thread works on a distinct zipItem which owns its
    // compression buffer.
-   zipItem.AllocateSealedPageBuf();
-   R__ASSERT(zipItem.fBuf);
+   // Uncompressed pages of mappable columns are sealed in place and do not need a scratch buffer.
+   const auto &element = *columnHandle.fColumn->GetElement();
+   if ((GetWriteOptions().GetCompression() != 0) || !element.IsMappable() ||
+       GetWriteOptions().GetEnablePageChecksums()) {
+      zipItem.AllocateSealedPageBuf();
+      R__ASSERT(zipItem.fBuf);
+   }
    auto &sealedPage = fBufferedColumns.at(columnHandle.fPhysicalId).RegisterSealedPage();
    fTaskScheduler->AddTask([this, &zipItem, &sealedPage, colId = columnHandle.fPhysicalId] {
       sealedPage = SealPage(zipItem.fPage, *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
-                            GetWriteOptions().GetCompression(), zipItem.fBuf.get());
+                            GetWriteOptions().GetCompression(), zipItem.fBuf.get(),
+                            GetWriteOptions().GetEnablePageChecksums());
       zipItem.fSealedPage = &sealedPage;
    });
 
@@ -102,7 +102,8 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFri
             auto firstElementIndex = c.GetColumnRange(originColumnId).fFirstElementIndex;
             auto compressionSettings = c.GetColumnRange(originColumnId).fCompressionSettings;
 
-            clusterBuilder.CommitColumnRange(virtualColumnId, firstElementIndex, compressionSettings, pageRange);
+            clusterBuilder.CommitColumnRange(virtualColumnId, firstElementIndex, compressionSettings,
+                                             std::move(pageRange));
          }
          fBuilder.AddClusterWithDetails(clusterBuilder.MoveDescriptor().Unwrap());
          fIdBiMap.Insert({i, c.GetId()}, fNextId);
@@ -31,6 +31,8 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <xxhash.h>
+
 #include <utility>
 
 
@@ -76,9 +78,29 @@ ROOT::Experimental::Detail::RPageSource::RActivePhysicalColumns::ToColumnSet() c
    return result;
 }
 
+namespace {
+
+/// Runs every task right away in the thread that adds it.  Unzip tasks executed this way still run asynchronously
+/// to the reading thread because UnzipCluster() is called from the cluster pool's unzip thread.
+class RTaskSchedulerSequential : public ROOT::Experimental::Detail::RPageStorage::RTaskScheduler {
+public:
+   void Reset() final {}
+   void AddTask(const std::function<void(void)> &taskFunc) final { taskFunc(); }
+   void Wait() final {}
+};
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RPageSource::RPageSource(std::string_view name, const RNTupleReadOptions &options)
    : RPageStorage(name), fMetrics(""), fOptions(options)
 {
+   if (fOptions.GetUseBackgroundUnzip()) {
+      // May be replaced by a parallel task scheduler later on, e.g. by the RNTupleReader if IMT is on
+      fBackgroundUnzipTasks = std::make_unique<RTaskSchedulerSequential>();
+      fTaskScheduler = fBackgroundUnzipTasks.get();
+   }
+   if (fOptions.GetEnableIOStats())
+      fIOStats = std::make_unique<RNTupleIOStats>();
 }
 
 ROOT::Experimental::Detail::RPageSource::~RPageSource()
@@ -129,6 +151,24 @@ ROOT::Experimental::NTupleSize_t ROOT::Experimental::Detail::RPageSource::GetNEl
    return GetSharedDescriptorGuard()->GetNElements(columnHandle.fPhysicalId);
 }
 
+std::uint64_t ROOT::Experimental::Detail::RPageStorage::RSealedPage::ComputeChecksum(const void *buffer,
+                                                                                     std::size_t nbytes)
+{
+   return XXH3_64bits(buffer, nbytes);
+}
+
+bool ROOT::Experimental::Detail::RPageStorage::RSealedPage::VerifyChecksum() const
+{
+   if (!fHasChecksum)
+      return true;
+   if (fSize < kNBytesPageChecksum)
+      return false;
+   std::uint64_t checksum;
+   Internal::RNTupleSerializer::DeserializeUInt64(static_cast<const unsigned char *>(fBuffer) + GetDataSize(),
+                                                  checksum);
+   return checksum == ComputeChecksum(fBuffer, GetDataSize());
+}
+
 ROOT::Experimental::ColumnId_t ROOT::Experimental::Detail::RPageSource::GetColumnId(ColumnHandle_t columnHandle)
 {
    // TODO(jblomer) distinguish trees
@@ -153,11 +193,15 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSource::Unsea
       return page;
    }
 
+   if (fOptions.GetVerifyPageChecksums() && !sealedPage.VerifyChecksum())
+      throw RException(R__FAIL("page checksum verification failed, data corruption detected"));
+
    const auto bytesPacked = element.GetPackedSize(sealedPage.fNElements);
+   const auto bytesOnStorage = sealedPage.GetDataSize();
    using Allocator_t = RPageAllocatorHeap;
    auto page = Allocator_t::NewPage(physicalColumnId, element.GetSize(), sealedPage.fNElements);
-   if (sealedPage.fSize != bytesPacked) {
-      fDecompressor->Unzip(sealedPage.fBuffer, sealedPage.fSize, bytesPacked, page.GetBuffer());
+   if (bytesOnStorage != bytesPacked) {
+      fDecompressor->Unzip(sealedPage.fBuffer, bytesOnStorage, bytesPacked, page.GetBuffer());
    } else {
       // We cannot simply map the sealed page as we don't know its life time. Specialized page sources
       // may decide to implement to not use UnsealPage but to custom mapping / decompression code.
@@ -427,6 +471,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
+   pageInfo.fHasChecksum = GetWriteOptions().GetEnablePageChecksums();
    fOpenPageRanges.at(columnHandle.fPhysicalId).fPageInfos.emplace_back(pageInfo);
 }
 
@@ -439,6 +484,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPage(
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = sealedPage.fNElements;
    pageInfo.fLocator = CommitSealedPageImpl(physicalColumnId, sealedPage);
+   pageInfo.fHasChecksum = sealedPage.fHasChecksum;
    fOpenPageRanges.at(physicalColumnId).fPageInfos.emplace_back(pageInfo);
 }
 
@@ -465,6 +511,7 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
          RClusterDescriptor::RPageRange::RPageInfo pageInfo;
          pageInfo.fNElements = sealedPageIt->fNElements;
          pageInfo.fLocator = locators[i++];
+         pageInfo.fHasChecksum = sealedPageIt->fHasChecksum;
          fOpenPageRanges.at(range.fPhysicalColumnId).fPageInfos.emplace_back(pageInfo);
       }
    }
@@ -483,7 +530,7 @@ std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experim
       fullRange.fPhysicalColumnId = i;
       std::swap(fullRange, fOpenPageRanges[i]);
       clusterBuilder.CommitColumnRange(i, fOpenColumnRanges[i].fFirstElementIndex,
-                                       fOpenColumnRanges[i].fCompressionSettings, fullRange);
+                                       fOpenColumnRanges[i].fCompressionSettings, std::move(fullRange));
       fOpenColumnRanges[i].fFirstElementIndex += fOpenColumnRanges[i].fNElements;
       fOpenColumnRanges[i].fNElements = 0;
    }
@@ -533,8 +580,8 @@ void ROOT::Experimental::Detail::RPageSink::CommitDataset()
 }
 
 ROOT::Experimental::Detail::RPageStorage::RSealedPage
-ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page,
-   const RColumnElementBase &element, int compressionSetting, void *buf)
+ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page, const RColumnElementBase &element,
+                                                int compressionSetting, void *buf, bool writeChecksum)
 {
    unsigned char *pageBuf = reinterpret_cast<unsigned char *>(page.GetBuffer());
    bool isAdoptedBuffer = true;
@@ -558,7 +605,17 @@ ROOT::Experimental::Detail::RPageSink::SealPage(const RPage &page,
 
    R__ASSERT(isAdoptedBuffer);
 
-   return RSealedPage{pageBuf, static_cast<std::uint32_t>(zippedBytes), page.GetNElements()};
+   if (!writeChecksum)
+      return RSealedPage{pageBuf, static_cast<std::uint32_t>(zippedBytes), page.GetNElements()};
+
+   // The checksum cannot be appended to the page buffer itself
+   if (pageBuf != buf) {
+      memcpy(buf, pageBuf, zippedBytes);
+      pageBuf = reinterpret_cast<unsigned char *>(buf);
+   }
+   Internal::RNTupleSerializer::SerializeUInt64(RSealedPage::ComputeChecksum(pageBuf, zippedBytes), pageBuf + zippedBytes);
+   return RSealedPage{pageBuf, static_cast<std::uint32_t>(zippedBytes + kNBytesPageChecksum), page.GetNElements(),
+                      true};
 }
 
 ROOT::Experimental::Detail::RPageStorage::RSealedPage
@@ -566,7 +623,8 @@ ROOT::Experimental::Detail::RPageSink::SealPage(
    const RPage &page, const RColumnElementBase &element, int compressionSetting)
 {
    R__ASSERT(fCompressor);
-   return SealPage(page, element, compressionSetting, fCompressor->GetZipBuffer());
+   return SealPage(page, element, compressionSetting, fCompressor->GetZipBuffer(),
+                   GetWriteOptions().GetEnablePageChecksums());
 }
 
 void ROOT::Experimental::Detail::RPageSink::EnableDefaultMetrics(const std::string &prefix)
@@ -255,6 +255,7 @@ void ROOT::Experimental::Detail::RPageSinkDaos::CreateImpl(const RNTupleModel &
 
    fDaosContainer = std::make_unique<RDaosContainer>(pool, args.fContainerLabel, /*create =*/true);
    fDaosContainer->SetDefaultObjectClass(oclass);
+   fDaosContainer->SetMaxInFlightOps(opts ? opts->GetMaxInFlightOps() : RNTupleWriteOptionsDaos().GetMaxInFlightOps());
 
    RNTupleDecompressor decompressor;
    auto [locator, _] = RDaosContainerNTupleLocator::LocateNTuple(*fDaosContainer, fNTupleName, decompressor);
@@ -459,7 +460,9 @@ ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view nt
    : RPageSource(ntupleName, options),
      fPagePool(std::make_shared<RPagePool>()),
      fURI(uri),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(
+        std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(), options.GetClusterBunchQueueDepth(),
+                                       options.GetMaxClusterBunchSize()))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceDaos");
@@ -467,6 +470,7 @@ ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view nt
    auto args = ParseDaosURI(uri);
    auto pool = std::make_shared<RDaosPool>(args.fPoolLabel);
    fDaosContainer = std::make_unique<RDaosContainer>(pool, args.fContainerLabel);
+   fDaosContainer->SetMaxInFlightOps(options.GetMaxInFlightReads());
 }
 
 ROOT::Experimental::Detail::RPageSourceDaos::~RPageSourceDaos() = default;
@@ -537,6 +541,7 @@ void ROOT::Experimental::Detail::RPageSourceDaos::LoadSealedPage(DescriptorId_t
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fHasChecksum = pageInfo.fHasChecksum;
    if (!sealedPage.fBuffer)
       return;
    if (pageInfo.fLocator.fType != RNTupleLocator::kTypePageZero) {
@@ -576,19 +581,49 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
 
    if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
       if (pageInfo.fLocator.fReserved & Internal::EDaosLocatorFlags::kCagedPage) {
-         throw ROOT::Experimental::RException(
-            R__FAIL("accessing caged pages is only supported in conjunction with cluster cache"));
+         // A cage is a single value in the object store; it is read as a whole and kept for its next pages
+         std::uint32_t position, offset;
+         std::tie(position, offset) = DecodeDaosPagePosition(pageInfo.fLocator.GetPosition<RNTupleLocatorObject64>());
+         if (!fCurrentCage.fBuffer || (fCurrentCage.fClusterId != clusterId) || (fCurrentCage.fColumnId != columnId) ||
+             (fCurrentCage.fPosition != position)) {
+            // The cage holds the pages of the column with the same position, one after the other
+            std::uint64_t cageSz = 0;
+            {
+               auto descriptorGuard = GetSharedDescriptorGuard();
+               const auto &pageRange = descriptorGuard->GetClusterDescriptor(clusterId).GetPageRange(columnId);
+               for (const auto &pi : pageRange.fPageInfos) {
+                  if ((pi.fLocator.fType != RNTupleLocator::kTypePageZero) &&
+                      (DecodeDaosPagePosition(pi.fLocator.GetPosition<RNTupleLocatorObject64>()).first == position)) {
+                     cageSz += pi.fLocator.fBytesOnStorage;
+                  }
+               }
+            }
+            fCurrentCage.fBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[cageSz]);
+            fCurrentCage.fClusterId = kInvalidDescriptorId;
+            RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(fNTupleIndex, clusterId, columnId, position);
+            if (int err = fDaosContainer->ReadSingleAkey(fCurrentCage.fBuffer.get(), cageSz, daosKey.fOid,
+                                                         daosKey.fDkey, daosKey.fAkey)) {
+               throw ROOT::Experimental::RException(R__FAIL("ReadSingleAkey: error" + std::string(d_errstr(err))));
+            }
+            fCurrentCage.fClusterId = clusterId;
+            fCurrentCage.fColumnId = columnId;
+            fCurrentCage.fPosition = position;
+            fCounters->fNRead.Inc();
+            fCounters->fSzReadPayload.Add(cageSz);
+         }
+         fCounters->fNPageLoaded.Inc();
+         sealedPageBuffer = fCurrentCage.fBuffer.get() + offset;
+      } else {
+         directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
+         RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(
+            fNTupleIndex, clusterId, columnId, pageInfo.fLocator.GetPosition<RNTupleLocatorObject64>().fLocation);
+         fDaosContainer->ReadSingleAkey(directReadBuffer.get(), bytesOnStorage, daosKey.fOid, daosKey.fDkey,
+                                        daosKey.fAkey);
+         fCounters->fNPageLoaded.Inc();
+         fCounters->fNRead.Inc();
+         fCounters->fSzReadPayload.Add(bytesOnStorage);
+         sealedPageBuffer = directReadBuffer.get();
       }
-
-      directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
-      RDaosKey daosKey = GetPageDaosKey<kDefaultDaosMapping>(
-         fNTupleIndex, clusterId, columnId, pageInfo.fLocator.GetPosition<RNTupleLocatorObject64>().fLocation);
-      fDaosContainer->ReadSingleAkey(directReadBuffer.get(), bytesOnStorage, daosKey.fOid, daosKey.fDkey,
-                                     daosKey.fAkey);
-      fCounters->fNPageLoaded.Inc();
-      fCounters->fNRead.Inc();
-      fCounters->fSzReadPayload.Add(bytesOnStorage);
-      sealedPageBuffer = directReadBuffer.get();
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
          fCurrentCluster = fClusterPool->GetCluster(clusterId, fActivePhysicalColumns.ToColumnSet());
@@ -607,7 +642,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
    RPage newPage;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId);
+      newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements, pageInfo.fHasChecksum}, *element,
+                           columnId);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
    }
 
@@ -793,7 +829,7 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
@@ -804,9 +840,10 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
          R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
 
          auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
-                          nElements = pi.fNElements,
+                          nElements = pi.fNElements, hasChecksum = pi.fHasChecksum,
                           indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
-            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
+            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements, hasChecksum},
+                                      *element, columnId);
             fCounters->fSzUnzip.Add(element->GetSize() * nElements);
 
             newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
@@ -31,15 +31,19 @@
 #include <TError.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <stdexcept>
 #include <utility>
 
 #include <atomic>
 #include <condition_variable>
+#include <exception>
 #include <functional>
+#include <future>
 #include <mutex>
 #include <thread>
 #include <queue>
@@ -103,7 +107,9 @@ ROOT::Experimental::Detail::RPageSinkFile::WriteSealedPage(
    std::uint64_t offsetData;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallWrite, fCounters->fTimeCpuWrite);
-      offsetData = fWriter->WriteBlob(sealedPage.fBuffer, sealedPage.fSize, bytesPacked);
+      // The checksum is stored uncompressed after the page data
+      offsetData = fWriter->WriteBlob(sealedPage.fBuffer, sealedPage.fSize,
+                                      bytesPacked + (sealedPage.fSize - sealedPage.GetDataSize()));
    }
 
    RNTupleLocator result;
@@ -135,7 +141,7 @@ ROOT::Experimental::Detail::RPageSinkFile::CommitSealedPageImpl(DescriptorId_t p
                                                                 const RPageStorage::RSealedPage &sealedPage)
 {
    const auto bitsOnStorage = RColumnElementBase::GetBitsOnStorage(
-      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel().GetType());
+      fDescriptorBuilder.GetDescriptor().GetColumnDescriptor(physicalColumnId).GetModel());
    const auto bytesPacked = (bitsOnStorage * sealedPage.fNElements + 7) / 8;
 
    return WriteSealedPage(sealedPage, bytesPacked);
@@ -194,8 +200,11 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
                                                              const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options),
      fPagePool(std::make_shared<RPagePool>()),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(
+        std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(), options.GetClusterBunchQueueDepth(),
+                                       options.GetMaxClusterBunchSize()))
 {
+   fPagePool->SetMaxUnusedSize(options.GetPagePoolMaxUnusedSize());
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
 }
@@ -237,7 +246,11 @@ ROOT::Experimental::Detail::RPageSourceFile::CreateFromAnchor(const Internal::RF
    return pageSource;
 }
 
-ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile() = default;
+ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile()
+{
+   if (fMappedFile)
+      fFile->Unmap(fMappedFile, fMappedFileSize);
+}
 
 
 ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFile::AttachImpl()
@@ -251,24 +264,104 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
 
    auto ntplDesc = fDescriptorBuilder.MoveDescriptor();
 
+   // The page lists are read one after the other from the file.  With a task scheduler, they are decompressed
+   // and deserialized in parallel while the page lists of the next cluster groups are read.
+   const auto nClusterGroups = ntplDesc.GetNClusterGroups();
+   std::vector<std::unique_ptr<unsigned char[]>> zipBuffers(nClusterGroups);
+   std::vector<std::vector<RClusterDescriptorBuilder>> clusters(nClusterGroups);
+   std::vector<RResult<void>> results;
+   results.reserve(nClusterGroups);
+   std::vector<DescriptorId_t> clusterGroupIds;
+   clusterGroupIds.reserve(nClusterGroups);
    for (const auto &cgDesc : ntplDesc.GetClusterGroupIterable()) {
+      clusterGroupIds.emplace_back(cgDesc.GetId());
+      results.emplace_back(RResult<void>::Success());
+   }
+
+   auto fnDeserializePageList = [&](std::size_t i, RNTupleDecompressor &decompressor) {
+      const auto &cgDesc = ntplDesc.GetClusterGroupDescriptor(clusterGroupIds[i]);
       auto buffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLength());
-      auto zipBuffer = std::make_unique<unsigned char[]>(cgDesc.GetPageListLocator().fBytesOnStorage);
-      fReader.ReadBuffer(zipBuffer.get(), cgDesc.GetPageListLocator().fBytesOnStorage,
+      decompressor.Unzip(zipBuffers[i].get(), cgDesc.GetPageListLocator().fBytesOnStorage,
+                         cgDesc.GetPageListLength(), buffer.get());
+      zipBuffers[i].reset();
+
+      clusters[i] = RClusterGroupDescriptorBuilder::GetClusterSummaries(ntplDesc, cgDesc.GetId());
+      results[i] =
+         Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters[i]);
+   };
+
+   const bool isParallel = fTaskScheduler && (nClusterGroups > 1);
+   for (std::size_t i = 0; i < nClusterGroups; ++i) {
+      const auto &cgDesc = ntplDesc.GetClusterGroupDescriptor(clusterGroupIds[i]);
+      zipBuffers[i] = std::make_unique<unsigned char[]>(cgDesc.GetPageListLocator().fBytesOnStorage);
+      fReader.ReadBuffer(zipBuffers[i].get(), cgDesc.GetPageListLocator().fBytesOnStorage,
                          cgDesc.GetPageListLocator().GetPosition<std::uint64_t>());
-      fDecompressor->Unzip(zipBuffer.get(), cgDesc.GetPageListLocator().fBytesOnStorage, cgDesc.GetPageListLength(),
-                           buffer.get());
+      if (isParallel) {
+         fTaskScheduler->AddTask([&fnDeserializePageList, i]() {
+            RNTupleDecompressor decompressor;
+            fnDeserializePageList(i, decompressor);
+         });
+      } else {
+         fnDeserializePageList(i, *fDecompressor);
+      }
+   }
+   if (isParallel)
+      WaitForAllTasks();
+
+   // Check all the results before throwing so that no unchecked error is left behind
+   RResult<void> *failure = nullptr;
+   for (auto &res : results) {
+      if (!res && !failure)
+         failure = &res;
+   }
+   if (failure)
+      failure->Throw();
+
+   for (std::size_t i = 0; i < nClusterGroups; ++i) {
+      for (auto &clusterBuilder : clusters[i]) {
+         ntplDesc.AddClusterDetails(clusterBuilder.AddDeferredColumnRanges(ntplDesc).MoveDescriptor().Unwrap());
+      }
+      clusters[i].clear();
+   }
 
-      auto clusters = RClusterGroupDescriptorBuilder::GetClusterSummaries(ntplDesc, cgDesc.GetId());
-      Internal::RNTupleSerializer::DeserializePageListV1(buffer.get(), cgDesc.GetPageListLength(), clusters);
-      for (std::size_t i = 0; i < clusters.size(); ++i) {
-         ntplDesc.AddClusterDetails(clusters[i].AddDeferredColumnRanges(ntplDesc).MoveDescriptor().Unwrap());
+   if (fOptions.GetUseMmap() && (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap)) {
+      try {
+         std::uint64_t mapdOffset;
+         const auto fileSize = fFile->GetSize();
+         fMappedFile = static_cast<unsigned char *>(fFile->Map(fileSize, 0, mapdOffset));
+         fMappedFileSize = fileSize;
+         R__ASSERT(mapdOffset == 0);
+      } catch (const std::runtime_error &) {
+         // Not fatal, we simply copy all the pages
+         fMappedFile = nullptr;
       }
    }
 
    return ntplDesc;
 }
 
+unsigned char *
+ROOT::Experimental::Detail::RPageSourceFile::GetMappedPage(const RColumnElementBase &element,
+                                                           const RClusterDescriptor::RPageRange::RPageInfo &pageInfo) const
+{
+   if (!fMappedFile || (pageInfo.fLocator.fType != RNTupleLocator::kTypeFile) || !element.IsMappable())
+      return nullptr;
+   // Pages with checksum take the unseal path, which verifies them
+   if (pageInfo.fHasChecksum)
+      return nullptr;
+   // Compressed pages are always smaller than their uncompressed size
+   const std::uint64_t nBytes = element.GetSize() * pageInfo.fNElements;
+   if (pageInfo.fLocator.fBytesOnStorage != nBytes)
+      return nullptr;
+   const auto offset = pageInfo.fLocator.GetPosition<std::uint64_t>();
+   if (offset + nBytes > fMappedFileSize)
+      return nullptr;
+   auto address = fMappedFile + offset;
+   if (reinterpret_cast<std::uintptr_t>(address) % element.GetSize() != 0)
+      return nullptr;
+   return address;
+}
+
 void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(DescriptorId_t physicalColumnId,
                                                                  const RClusterIndex &clusterIndex,
                                                                  RSealedPage &sealedPage)
@@ -285,6 +378,7 @@ void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(DescriptorId_t
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
+   sealedPage.fHasChecksum = pageInfo.fHasChecksum;
    if (!sealedPage.fBuffer)
       return;
    if (pageInfo.fLocator.fType != RNTupleLocator::kTypePageZero) {
@@ -320,12 +414,25 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       return pageZero;
    }
 
+   if (auto mappedBuffer = GetMappedPage(*element, pageInfo)) {
+      // The page lives in the file mapping, which is owned by the page source; there is nothing to delete
+      RPage mappedPage(columnId, mappedBuffer, elementSize, pageInfo.fNElements);
+      mappedPage.GrowUnchecked(pageInfo.fNElements);
+      mappedPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                           RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+      fPagePool->RegisterPage(mappedPage, RPageDeleter([](const RPage &, void *) {}, nullptr));
+      fCounters->fNPagePopulated.Inc();
+      return mappedPage;
+   }
+
    if (fOptions.GetClusterCache() == RNTupleReadOptions::EClusterCache::kOff) {
       directReadBuffer = std::unique_ptr<unsigned char[]>(new unsigned char[bytesOnStorage]);
       fReader.ReadBuffer(directReadBuffer.get(), bytesOnStorage, pageInfo.fLocator.GetPosition<std::uint64_t>());
       fCounters->fNPageLoaded.Inc();
       fCounters->fNRead.Inc();
       fCounters->fSzReadPayload.Add(bytesOnStorage);
+      if (fIOStats)
+         fIOStats->AddRead(columnId, clusterId, bytesOnStorage);
       sealedPageBuffer = directReadBuffer.get();
    } else {
       if (!fCurrentCluster || (fCurrentCluster->GetId() != clusterId) || !fCurrentCluster->ContainsColumn(columnId))
@@ -333,8 +440,11 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
       R__ASSERT(fCurrentCluster->ContainsColumn(columnId));
 
       auto cachedPage = fPagePool->GetPage(columnId, RClusterIndex(clusterId, idxInCluster));
-      if (!cachedPage.IsNull())
+      if (!cachedPage.IsNull()) {
+         if (fIOStats)
+            fIOStats->AddPagePoolHit(columnId, clusterId);
          return cachedPage;
+      }
 
       ROnDiskPage::Key key(columnId, pageInfo.fPageNo);
       auto onDiskPage = fCurrentCluster->GetOnDiskPage(key);
@@ -345,8 +455,15 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
    RPage newPage;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId);
+      const auto start = fIOStats ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+      newPage = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements, pageInfo.fHasChecksum}, *element,
+                           columnId);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
+      if (fIOStats) {
+         const auto elapsed = std::chrono::steady_clock::now() - start;
+         fIOStats->AddUnzip(columnId, clusterId, elementSize * pageInfo.fNElements,
+                            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+      }
    }
 
    newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
@@ -364,8 +481,11 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
 {
    const auto columnId = columnHandle.fPhysicalId;
    auto cachedPage = fPagePool->GetPage(columnId, globalIndex);
-   if (!cachedPage.IsNull())
+   if (!cachedPage.IsNull()) {
+      if (fIOStats)
+         fIOStats->AddPagePoolHit(columnId, cachedPage.GetClusterInfo().GetId());
       return cachedPage;
+   }
 
    std::uint64_t idxInCluster;
    RClusterInfo clusterInfo;
@@ -392,8 +512,11 @@ ROOT::Experimental::Detail::RPage ROOT::Experimental::Detail::RPageSourceFile::P
    const auto idxInCluster = clusterIndex.GetIndex();
    const auto columnId = columnHandle.fPhysicalId;
    auto cachedPage = fPagePool->GetPage(columnId, clusterIndex);
-   if (!cachedPage.IsNull())
+   if (!cachedPage.IsNull()) {
+      if (fIOStats)
+         fIOStats->AddPagePoolHit(columnId, clusterId);
       return cachedPage;
+   }
 
    R__ASSERT(clusterId != kInvalidDescriptorId);
    RClusterInfo clusterInfo;
@@ -418,6 +541,10 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    auto clone = new RPageSourceFile(fNTupleName, fOptions);
    clone->fFile = fFile->Clone();
    clone->fReader = Internal::RMiniFileReader(clone->fFile.get());
+   // Clones read the same ntuple, so they can share the pages.  Pages served from a file mapping, however, must not
+   // outlive the page source that owns the mapping.
+   if (!fOptions.GetUseMmap())
+      clone->fPagePool = fPagePool;
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
@@ -518,6 +645,8 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    for (const auto &s : onDiskPages) {
       ROnDiskPage::Key key(s.fColumnId, s.fPageNo);
       pageMap->Register(key, ROnDiskPage(buffer + s.fBufPos, s.fSize));
+      if (fIOStats)
+         fIOStats->AddRead(s.fColumnId, clusterKey.fClusterId, s.fSize);
    }
    fCounters->fNPageLoaded.Add(onDiskPages.size());
    for (auto i = currentReadRequestIdx; i < readRequests.size(); ++i) {
@@ -544,14 +673,99 @@ ROOT::Experimental::Detail::RPageSourceFile::LoadClusters(std::span<RCluster::RK
       clusters.emplace_back(PrepareSingleCluster(key, readRequests));
    }
 
+   // In adaptive mode, the cluster pool provides the largest gap that is worth bridging between the requests of
+   // neighboring clusters.  Every cluster owns its memory buffer, so coalesced requests are read into a scratch
+   // buffer and afterwards copied into the cluster buffers.
+   const auto maxGap = fClusterPool->GetReadCoalesceGap();
+   std::vector<ROOT::Internal::RRawFile::RIOVec> coalescedRequests;
+   // For every coalesced request, the range [first, last) of the sorted original requests it covers
+   std::vector<std::pair<std::size_t, std::size_t>> coalescedRanges;
+   std::vector<std::unique_ptr<unsigned char[]>> scratchBuffers;
+   if ((maxGap > 0) && (clusterKeys.size() > 1)) {
+      std::sort(readRequests.begin(), readRequests.end(),
+                [](const ROOT::Internal::RRawFile::RIOVec &a, const ROOT::Internal::RRawFile::RIOVec &b) {
+                   return a.fOffset < b.fOffset;
+                });
+      std::size_t szOverhead = 0;
+      for (std::size_t first = 0; first < readRequests.size();) {
+         auto last = first + 1;
+         auto readUpTo = readRequests[first].fOffset + readRequests[first].fSize;
+         while ((last < readRequests.size()) && (readRequests[last].fOffset >= readUpTo) &&
+                (readRequests[last].fOffset - readUpTo <= maxGap)) {
+            szOverhead += readRequests[last].fOffset - readUpTo;
+            readUpTo = readRequests[last].fOffset + readRequests[last].fSize;
+            last++;
+         }
+         if (last - first == 1) {
+            coalescedRequests.emplace_back(readRequests[first]);
+         } else {
+            ROOT::Internal::RRawFile::RIOVec req;
+            req.fOffset = readRequests[first].fOffset;
+            req.fSize = readUpTo - req.fOffset;
+            scratchBuffers.emplace_back(std::make_unique<unsigned char[]>(req.fSize));
+            req.fBuffer = scratchBuffers.back().get();
+            coalescedRequests.emplace_back(req);
+            coalescedRanges.emplace_back(first, last);
+         }
+         first = last;
+      }
+      fCounters->fSzReadOverhead.Add(szOverhead);
+      std::swap(readRequests, coalescedRequests);
+   }
+
    auto nReqs = readRequests.size();
-   {
-      RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
-      fFile->ReadV(&readRequests[0], nReqs);
+   if (fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasAsyncIo) {
+      // Submit the requests in batches that a remote server accepts as a single vector read (XRootD limits a readv
+      // to 1024 chunks) and keep all batches in flight at the same time, instead of waiting for each round trip
+      constexpr std::size_t kMaxReqsPerBatch = 1024;
+      constexpr std::uint64_t kMaxBytesPerBatch = 32 * 1024 * 1024;
+      std::vector<std::future<void>> inFlight;
+      {
+         RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+         for (std::size_t first = 0; first < nReqs;) {
+            auto last = first;
+            std::uint64_t szBatch = 0;
+            while ((last < nReqs) && (last - first < kMaxReqsPerBatch) &&
+                   ((last == first) || (szBatch + readRequests[last].fSize <= kMaxBytesPerBatch))) {
+               szBatch += readRequests[last].fSize;
+               last++;
+            }
+            inFlight.emplace_back(fFile->ReadVAsync(&readRequests[first], last - first));
+            first = last;
+         }
+         // Wait for all batches before reporting an error: the buffers must outlive the requests in flight
+         std::exception_ptr error;
+         for (auto &f : inFlight) {
+            try {
+               f.get();
+            } catch (...) {
+               if (!error)
+                  error = std::current_exception();
+            }
+         }
+         if (error)
+            std::rethrow_exception(error);
+      }
+      fCounters->fNReadV.Add(inFlight.size());
+   } else {
+      {
+         RNTupleAtomicTimer timer(fCounters->fTimeWallRead, fCounters->fTimeCpuRead);
+         fFile->ReadV(&readRequests[0], nReqs);
+      }
+      fCounters->fNReadV.Inc();
    }
-   fCounters->fNReadV.Inc();
    fCounters->fNRead.Add(nReqs);
 
+   // Scatter the coalesced requests into the cluster buffers; coalescedRequests holds the original requests now
+   for (std::size_t i = 0; i < coalescedRanges.size(); ++i) {
+      const auto scratch = scratchBuffers[i].get();
+      const auto base = coalescedRequests[coalescedRanges[i].first].fOffset;
+      for (auto j = coalescedRanges[i].first; j < coalescedRanges[i].second; ++j) {
+         const auto &req = coalescedRequests[j];
+         memcpy(req.fBuffer, scratch + (req.fOffset - base), req.fSize);
+      }
+   }
+
    return clusters;
 }
 
@@ -571,21 +785,35 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
    for (const auto columnId : columnsInCluster) {
       const auto &columnDesc = descriptorGuard->GetColumnDescriptor(columnId);
 
-      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel().GetType()));
+      allElements.emplace_back(RColumnElementBase::Generate(columnDesc.GetModel()));
 
       const auto &pageRange = clusterDescriptor.GetPageRange(columnId);
       std::uint64_t pageNo = 0;
       std::uint64_t firstInPage = 0;
       for (const auto &pi : pageRange.fPageInfos) {
+         if (GetMappedPage(*allElements.back(), pi)) {
+            // Served from the file mapping on demand, no need to unseal
+            firstInPage += pi.fNElements;
+            pageNo++;
+            continue;
+         }
+
          ROnDiskPage::Key key(columnId, pageNo);
          auto onDiskPage = cluster->GetOnDiskPage(key);
          R__ASSERT(onDiskPage && (onDiskPage->GetSize() == pi.fLocator.fBytesOnStorage));
 
          auto taskFunc = [this, columnId, clusterId, firstInPage, onDiskPage, element = allElements.back().get(),
-                          nElements = pi.fNElements,
+                          nElements = pi.fNElements, hasChecksum = pi.fHasChecksum,
                           indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex]() {
-            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element, columnId);
+            const auto start = fIOStats ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+            auto newPage = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements, hasChecksum},
+                                      *element, columnId);
             fCounters->fSzUnzip.Add(element->GetSize() * nElements);
+            if (fIOStats) {
+               const auto elapsed = std::chrono::steady_clock::now() - start;
+               fIOStats->AddUnzip(columnId, clusterId, element->GetSize() * nElements,
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            }
 
             newPage.SetWindow(indexOffset + firstInPage, RPage::RClusterInfo(clusterId, indexOffset));
             fPagePool->PreloadPage(
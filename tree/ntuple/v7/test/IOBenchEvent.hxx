@@ -0,0 +1,40 @@
+#ifndef ROOT7_RNTuple_Test_IOBenchEvent
+#define ROOT7_RNTuple_Test_IOBenchEvent
+
+#include <vector>
+
+/**
+ * The objects of the AOD-like event model of ntuple_iobench: collections of objects with nested collections, written
+ * as split or unsplit branches of a TTree and as class fields of an RNTuple.
+ */
+
+struct IOBenchTrack {
+   float pt = 0.0;
+   float eta = 0.0;
+   float phi = 0.0;
+   float d0 = 0.0;
+   float z0 = 0.0;
+   float chi2 = 0.0;
+   int charge = 0;
+   int nHits = 0;
+   std::vector<float> hitResiduals;
+};
+
+struct IOBenchJet {
+   float pt = 0.0;
+   float eta = 0.0;
+   float phi = 0.0;
+   float mass = 0.0;
+   float emFraction = 0.0;
+   std::vector<int> constituents;
+};
+
+struct IOBenchVertex {
+   float x = 0.0;
+   float y = 0.0;
+   float z = 0.0;
+   float chi2 = 0.0;
+   int nTracks = 0;
+};
+
+#endif
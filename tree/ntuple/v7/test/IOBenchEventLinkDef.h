@@ -0,0 +1,14 @@
+#ifdef __CINT__
+
+#pragma link off all globals;
+#pragma link off all classes;
+#pragma link off all functions;
+
+#pragma link C++ class IOBenchTrack+;
+#pragma link C++ class IOBenchJet+;
+#pragma link C++ class IOBenchVertex+;
+#pragma link C++ class std::vector<IOBenchTrack>+;
+#pragma link C++ class std::vector<IOBenchJet>+;
+#pragma link C++ class std::vector<IOBenchVertex>+;
+
+#endif
@@ -199,3 +199,123 @@ TEST(RNTupleBulk, RVec)
       }
    }
 }
+
+TEST(RNTupleBulk, View)
+{
+   FileRaii fileGuard("test_ntuple_bulk_view.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fldInt = model->MakeField<int>("int");
+      auto fldVecF = model->MakeField<ROOT::RVecF>("vfloat");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 10; ++i) {
+         *fldInt = i;
+         fldVecF->resize(i);
+         for (int j = 0; j < i; ++j)
+            fldVecF->at(j) = j;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   auto viewInt = reader->GetView<int>("int");
+   auto viewVecF = reader->GetView<ROOT::RVecF>("vfloat");
+   auto viewCollection = reader->GetViewCollection("vfloat");
+
+   auto intArr = viewInt.ReadBulk(RClusterIndex(0, 0), 10);
+   for (int i = 0; i < 10; ++i) {
+      EXPECT_EQ(i, intArr[i]);
+   }
+   EXPECT_EQ(intArr + 2, viewInt.ReadBulk(RClusterIndex(0, 2), 3));
+
+   auto offsets = viewCollection.ReadBulk(RClusterIndex(0, 0), 10);
+   auto vecArr = viewVecF.ReadBulk(RClusterIndex(0, 0), 10);
+   const float *values = vecArr[0].data();
+   for (int i = 0; i < 10; ++i) {
+      EXPECT_EQ(static_cast<std::size_t>(i * (i + 1) / 2), offsets[i]);
+      ASSERT_EQ(static_cast<std::size_t>(i), vecArr[i].size());
+      for (int j = 0; j < i; ++j) {
+         EXPECT_FLOAT_EQ(j, vecArr[i][j]);
+         EXPECT_FLOAT_EQ(j, values[offsets[i] - i + j]);
+      }
+   }
+}
+
+TEST(RNTupleBulk, Fill)
+{
+   FileRaii fileGuard("test_ntuple_bulk_fill.root");
+   constexpr std::size_t kNEntries = 100000;
+   std::vector<float> pt(kNEntries);
+   std::vector<std::string> names(kNEntries);
+   std::vector<std::uint64_t> offsets(kNEntries + 1);
+   std::vector<std::int32_t> items;
+   for (std::size_t i = 0; i < kNEntries; ++i) {
+      pt[i] = i;
+      names[i] = "e" + std::to_string(i);
+      offsets[i] = items.size();
+      for (std::size_t j = 0; j < i % 3; ++j)
+         items.emplace_back(i + j);
+   }
+   offsets[kNEntries] = items.size();
+
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      model->MakeField<std::string>("name");
+      model->MakeField<std::vector<std::int32_t>>("tags");
+      model->MakeField<ROOT::RVec<std::int32_t>>("rtags");
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(64 * 1024);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+
+      try {
+         writer->FillBulk(1, {{"pt", pt.data()}});
+         FAIL() << "missing bulk data should throw";
+      } catch (const RException &err) {
+         EXPECT_THAT(err.what(), testing::HasSubstr("missing bulk data"));
+      }
+      try {
+         writer->FillBulk(1, {{"pt", pt.data(), offsets.data()}, {"name", names.data()}, {"tags", items.data()},
+                              {"rtags", items.data(), offsets.data()}});
+         FAIL() << "offsets for a non-collection field should throw";
+      } catch (const RException &err) {
+         EXPECT_THAT(err.what(), testing::HasSubstr("not a vector"));
+      }
+
+      // Write the first entries one by one, the remaining ones in two bulks
+      auto entry = writer->GetModel()->GetDefaultEntry();
+      for (std::size_t i = 0; i < 10; ++i) {
+         *entry->Get<float>("pt") = pt[i];
+         *entry->Get<std::string>("name") = names[i];
+         *entry->Get<std::vector<std::int32_t>>("tags") =
+            std::vector<std::int32_t>(items.begin() + offsets[i], items.begin() + offsets[i + 1]);
+         *entry->Get<ROOT::RVec<std::int32_t>>("rtags") =
+            ROOT::RVec<std::int32_t>(items.begin() + offsets[i], items.begin() + offsets[i + 1]);
+         writer->Fill();
+      }
+      for (std::size_t first : {std::size_t(10), kNEntries / 2}) {
+         const auto n = (first == 10) ? kNEntries / 2 - 10 : kNEntries / 2;
+         writer->FillBulk(n, {{"pt", &pt[first]},
+                              {"name", &names[first]},
+                              {"tags", &items[offsets[first]], &offsets[first]},
+                              {"rtags", &items[offsets[first]], &offsets[first]}});
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(kNEntries, reader->GetNEntries());
+   EXPECT_LT(1U, reader->GetDescriptor()->GetNClusters());
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewName = reader->GetView<std::string>("name");
+   auto viewTags = reader->GetView<std::vector<std::int32_t>>("tags");
+   auto viewRTags = reader->GetView<ROOT::RVec<std::int32_t>>("rtags");
+   for (auto i : reader->GetEntryRange()) {
+      ASSERT_FLOAT_EQ(pt[i], viewPt(i));
+      ASSERT_EQ(names[i], viewName(i));
+      const std::vector<std::int32_t> expected(items.begin() + offsets[i], items.begin() + offsets[i + 1]);
+      ASSERT_EQ(expected, viewTags(i));
+      ASSERT_EQ(expected.size(), viewRTags(i).size());
+      for (std::size_t j = 0; j < expected.size(); ++j)
+         ASSERT_EQ(expected[j], viewRTags(i)[j]);
+   }
+}
@@ -55,6 +55,8 @@ public:
    /// Records the cluster IDs requests by LoadClusters() calls
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RCluster::ColumnSet_t> fReqsColumns;
+   /// The number of LoadClusters() calls, i.e. the number of vector reads issued by the cluster pool
+   unsigned int fNLoadClusters = 0;
 
    RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
@@ -78,6 +80,7 @@ public:
    std::vector<std::unique_ptr<RCluster>> LoadClusters(std::span<RCluster::RKey> clusterKeys) final
    {
       std::vector<std::unique_ptr<RCluster>> result;
+      fNLoadClusters++;
       for (auto key : clusterKeys) {
          fReqsClusterIds.emplace_back(key.fClusterId);
          fReqsColumns.emplace_back(key.fPhysicalColumnSet);
@@ -263,6 +266,67 @@ TEST(ClusterPool, GetClusterBasics)
 }
 
 
+TEST(ClusterPool, BunchQueueDepth)
+{
+   RPageSourceMock p1;
+   {
+      RClusterPool c1(p1, 1, 3);
+      c1.GetCluster(0, {0});
+      c1.WaitForInFlightClusters();
+   }
+   // The current bunch plus three bunches look-ahead, read in two batches of at most three bunches
+   ASSERT_EQ(4U, p1.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 4; ++i)
+      EXPECT_EQ(i, p1.fReqsClusterIds[i]);
+   EXPECT_EQ(2U, p1.fNLoadClusters);
+
+   RPageSourceMock p2;
+   {
+      RClusterPool c2(p2, 2, 2);
+      c2.GetCluster(0, {0});
+      c2.WaitForInFlightClusters();
+   }
+   // The mock page source has only six clusters
+   ASSERT_EQ(6U, p2.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(i, p2.fReqsClusterIds[i]);
+   EXPECT_EQ(2U, p2.fNLoadClusters);
+}
+
+
+TEST(ClusterPool, AdaptiveBunchSize)
+{
+   RPageSourceMock p1;
+   {
+      RClusterPool c1(p1, 1, 1);
+      EXPECT_FALSE(c1.IsAdaptive());
+      for (unsigned i = 0; i < 6; ++i) {
+         c1.GetCluster(i, {0});
+         c1.WaitForInFlightClusters();
+      }
+      EXPECT_EQ(1U, c1.GetClusterBunchSize());
+      EXPECT_EQ(0U, c1.GetReadCoalesceGap());
+   }
+
+   RPageSourceMock p2;
+   {
+      RClusterPool c2(p2, 1, 1, 4);
+      EXPECT_TRUE(c2.IsAdaptive());
+      for (unsigned i = 0; i < 6; ++i) {
+         c2.GetCluster(i, {0});
+         c2.WaitForInFlightClusters();
+      }
+      // The mock clusters have no pages, so latency and bandwidth cannot be estimated and the pool probes
+      // larger bunches up to the maximum bunch size
+      EXPECT_EQ(4U, c2.GetClusterBunchSize());
+   }
+   ASSERT_EQ(6U, p2.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(i, p2.fReqsClusterIds[i]);
+   EXPECT_LT(p2.fNLoadClusters, p1.fNLoadClusters);
+}
+
+
 TEST(ClusterPool, GetClusterIncrementally)
 {
    RPageSourceMock p1;
@@ -0,0 +1,603 @@
+// Measure the write and read throughput of TTree and RNTuple for synthetic event models, to choose the storage
+// settings from data: a flat, NanoAOD-like model of scalars and collections of numbers, and an AOD-like model of
+// collections of objects with nested collections (see IOBenchEvent.hxx). The TTrees are written with the AOD-like
+// objects unsplit and split, the RNTuples with several page and cluster sizes, each for the given compression
+// settings and numbers of implicit MT threads. For every configuration, the time to generate and write the events and
+// the time to read them all back are reported as MB/s of the file on storage, events/s and the peak resident memory.
+//
+// The files are read back from the output directory, or with --read-url from a remote location (e.g. an XRootD
+// directory root://host//path) to which the files of a previous run with --keep were copied.
+//
+// Usage: ntuple_iobench [--events n] [--schema nanoaod|aod|all] [--format ttree|rntuple|all]
+//                       [--compression c1,c2...] [--threads n1,n2...] [--page-sizes bytes1,bytes2...]
+//                       [--cluster-sizes bytes1,bytes2...] [--dir path] [--read-url url] [--read-only] [--keep]
+//                       [--csv]
+
+#include "IOBenchEvent.hxx"
+
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+#include <TError.h>
+#include <TFile.h>
+#include <TROOT.h>
+#include <TStopwatch.h>
+#include <TSystem.h>
+#include <TTree.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RNTupleReader;
+using ROOT::Experimental::RNTupleReadOptions;
+using ROOT::Experimental::RNTupleWriteOptions;
+using ROOT::Experimental::RNTupleWriter;
+
+namespace {
+
+struct RConfig {
+   std::size_t fNEvents = 20000;
+   std::vector<std::string> fSchemas{"nanoaod", "aod"};
+   std::vector<std::string> fFormats{"ttree", "rntuple"};
+   std::vector<int> fCompressions{0, 101, 404, 505};
+   std::vector<int> fThreads{1};
+   std::vector<std::size_t> fPageSizes{64 * 1024, 1024 * 1024};
+   std::vector<std::size_t> fClusterSizes{50 * 1000 * 1000};
+   std::string fDirectory = ".";
+   std::string fReadUrl;
+   bool fReadOnly = false;
+   bool fKeep = false;
+   bool fCSV = false;
+};
+
+/// A collection of the NanoAOD-like model, stored as one array per member
+struct RCollectionSpec {
+   const char *fName;
+   double fMeanSize;
+   std::vector<const char *> fFloats;
+   std::vector<const char *> fInts;
+};
+
+const std::vector<const char *> kNanoScalars{"MET_pt",      "MET_phi", "MET_sumEt", "PuppiMET_pt", "PuppiMET_phi",
+                                             "fixedGridRho", "Pileup_nTrueInt", "genWeight"};
+const std::vector<RCollectionSpec> kNanoCollections{
+   {"Jet", 6,
+    {"pt", "eta", "phi", "mass", "btagDeepFlavB", "chEmEF", "chHEF", "neEmEF", "neHEF", "qgl", "rawFactor", "area"},
+    {"jetId", "puId", "nConstituents", "hadronFlavour"}},
+   {"Muon", 1.5, {"pt", "eta", "phi", "mass", "dxy", "dz", "pfRelIso04_all", "sip3d", "tkRelIso"},
+    {"charge", "tightId", "nStations"}},
+   {"Electron", 1.5, {"pt", "eta", "phi", "mass", "dxy", "dz", "pfRelIso03_all", "r9", "sieie", "hoe"},
+    {"charge", "cutBased"}},
+   {"Photon", 1, {"pt", "eta", "phi", "r9", "sieie", "hoe"}, {"cutBased"}},
+   {"Tau", 1, {"pt", "eta", "phi", "mass", "dxy", "dz"}, {"charge", "decayMode"}},
+   {"GenPart", 40, {"pt", "eta", "phi", "mass"}, {"pdgId", "status", "statusFlags", "genPartIdxMother"}}};
+/// Upper bound of the size of the collections, for the fixed-size buffers of the TTree leaf arrays
+constexpr std::size_t kMaxCollectionSize = 256;
+
+/// Draws the values of the events; the same seed gives the same events for all configurations
+class RGenerator {
+   std::mt19937 fGen{42};
+   std::exponential_distribution<float> fPt{1.f / 30.f};
+   std::uniform_real_distribution<float> fUniform{-1.f, 1.f};
+   std::uniform_int_distribution<int> fSmallInt{0, 7};
+
+public:
+   std::size_t Size(double mean)
+   {
+      return std::min(kMaxCollectionSize, static_cast<std::size_t>(std::poisson_distribution<int>(mean)(fGen)));
+   }
+   float Pt() { return fPt(fGen); }
+   float Eta() { return 2.5f * fUniform(fGen); }
+   float Phi() { return 3.14159f * fUniform(fGen); }
+   float Uniform() { return fUniform(fGen); }
+   int SmallInt() { return fSmallInt(fGen); }
+};
+
+/// The values of one event of the NanoAOD-like model. The storage is owned by the writer: the TTree branches or the
+/// RNTuple entry.
+struct RNanoEvent {
+   std::uint32_t *fRun = nullptr;
+   std::uint64_t *fEvent = nullptr;
+   std::vector<float *> fScalars;
+   /// Per collection: the size (TTree only), the float and int members
+   std::vector<std::uint32_t *> fCounts;
+   std::vector<std::vector<std::vector<float> *>> fFloats;
+   std::vector<std::vector<std::vector<int> *>> fInts;
+
+   void Generate(RGenerator &gen, std::uint64_t index)
+   {
+      *fRun = 1;
+      *fEvent = index;
+      for (auto *s : fScalars)
+         *s = gen.Pt();
+      for (std::size_t c = 0; c < kNanoCollections.size(); ++c) {
+         const auto size = gen.Size(kNanoCollections[c].fMeanSize);
+         if (fCounts[c])
+            *fCounts[c] = size;
+         for (std::size_t m = 0; m < fFloats[c].size(); ++m) {
+            auto &v = *fFloats[c][m];
+            v.resize(size);
+            for (auto &x : v)
+               x = m == 0 ? gen.Pt() : (m == 1 ? gen.Eta() : (m == 2 ? gen.Phi() : gen.Uniform()));
+         }
+         for (auto *v : fInts[c]) {
+            v->resize(size);
+            for (auto &x : *v)
+               x = gen.SmallInt();
+         }
+      }
+   }
+};
+
+/// The values of one event of the AOD-like model, owned by the writer
+struct RAODEvent {
+   std::uint32_t *fRun = nullptr;
+   std::uint64_t *fEvent = nullptr;
+   std::vector<IOBenchTrack> *fTracks = nullptr;
+   std::vector<IOBenchJet> *fJets = nullptr;
+   std::vector<IOBenchVertex> *fVertices = nullptr;
+
+   void Generate(RGenerator &gen, std::uint64_t index)
+   {
+      *fRun = 1;
+      *fEvent = index;
+      fTracks->resize(gen.Size(60));
+      for (auto &t : *fTracks) {
+         t.pt = gen.Pt();
+         t.eta = gen.Eta();
+         t.phi = gen.Phi();
+         t.d0 = 0.1f * gen.Uniform();
+         t.z0 = 10.f * gen.Uniform();
+         t.chi2 = gen.Pt() / 30.f;
+         t.charge = gen.Uniform() > 0 ? 1 : -1;
+         t.nHits = gen.Size(12);
+         t.hitResiduals.resize(t.nHits);
+         for (auto &r : t.hitResiduals)
+            r = 0.01f * gen.Uniform();
+      }
+      fJets->resize(gen.Size(8));
+      for (auto &j : *fJets) {
+         j.pt = gen.Pt();
+         j.eta = gen.Eta();
+         j.phi = gen.Phi();
+         j.mass = 0.1f * j.pt;
+         j.emFraction = 0.5f + 0.5f * gen.Uniform();
+         j.constituents.resize(gen.Size(15));
+         for (auto &c : j.constituents)
+            c = gen.Size(fTracks->size());
+      }
+      fVertices->resize(gen.Size(30));
+      for (auto &v : *fVertices) {
+         v.x = 0.01f * gen.Uniform();
+         v.y = 0.01f * gen.Uniform();
+         v.z = 10.f * gen.Uniform();
+         v.chi2 = gen.Pt() / 30.f;
+         v.nTracks = gen.Size(10);
+      }
+   }
+};
+
+/// Keeps the maximum of the resident memory sampled during a phase of the benchmark
+class RRSSMonitor {
+   Long_t fPeakKB = 0;
+
+public:
+   RRSSMonitor() { Sample(); }
+   void Sample()
+   {
+      ProcInfo_t info;
+      if (gSystem->GetProcInfo(&info) == 0)
+         fPeakKB = std::max(fPeakKB, info.fMemResident);
+   }
+   double GetPeakMB()
+   {
+      Sample();
+      return fPeakKB / 1024.;
+   }
+};
+
+/// One configuration of the storage layout
+struct RLayout {
+   std::string fSchema;
+   std::string fFormat;
+   int fSplitLevel = 99;         ///< TTree only
+   std::size_t fPageSize = 0;    ///< RNTuple only
+   std::size_t fClusterSize = 0; ///< RNTuple only
+   int fCompression = 0;
+
+   std::string GetName() const
+   {
+      std::ostringstream name;
+      if (fFormat == "ttree")
+         name << "split" << fSplitLevel;
+      else
+         name << "page" << fPageSize / 1024 << "k_cluster" << fClusterSize / 1000000 << "M";
+      return name.str();
+   }
+   std::string GetFileName() const
+   {
+      return "iobench_" + fSchema + "_" + fFormat + "_" + GetName() + "_c" + std::to_string(fCompression) + ".root";
+   }
+};
+
+struct RMeasurement {
+   double fRealTime = 0.;
+   double fCpuTime = 0.;
+   double fPeakRSSMB = 0.;
+};
+
+/// Add the branches of the NanoAOD-like model as in NanoAOD: a count branch per collection and leaf arrays
+void MakeNanoBranches(TTree &tree, RNanoEvent &event, std::uint32_t &run, std::uint64_t &eventNumber,
+                      std::vector<float> &scalars, std::vector<std::uint32_t> &counts,
+                      std::vector<std::vector<std::vector<float>>> &floats,
+                      std::vector<std::vector<std::vector<int>>> &ints)
+{
+   tree.Branch("run", &run, "run/i");
+   tree.Branch("event", &eventNumber, "event/l");
+   event.fRun = &run;
+   event.fEvent = &eventNumber;
+   scalars.resize(kNanoScalars.size());
+   for (std::size_t i = 0; i < kNanoScalars.size(); ++i) {
+      tree.Branch(kNanoScalars[i], &scalars[i], (std::string(kNanoScalars[i]) + "/F").c_str());
+      event.fScalars.push_back(&scalars[i]);
+   }
+   counts.resize(kNanoCollections.size());
+   floats.resize(kNanoCollections.size());
+   ints.resize(kNanoCollections.size());
+   event.fFloats.resize(kNanoCollections.size());
+   event.fInts.resize(kNanoCollections.size());
+   for (std::size_t c = 0; c < kNanoCollections.size(); ++c) {
+      const auto &spec = kNanoCollections[c];
+      const std::string count = std::string("n") + spec.fName;
+      tree.Branch(count.c_str(), &counts[c], (count + "/i").c_str());
+      event.fCounts.push_back(&counts[c]);
+      // The leaf arrays point into the vectors: their capacity keeps them in place when they are resized
+      floats[c].resize(spec.fFloats.size());
+      for (std::size_t m = 0; m < spec.fFloats.size(); ++m) {
+         const std::string name = std::string(spec.fName) + "_" + spec.fFloats[m];
+         floats[c][m].reserve(kMaxCollectionSize);
+         tree.Branch(name.c_str(), floats[c][m].data(), (name + "[" + count + "]/F").c_str());
+         event.fFloats[c].push_back(&floats[c][m]);
+      }
+      ints[c].resize(spec.fInts.size());
+      for (std::size_t m = 0; m < spec.fInts.size(); ++m) {
+         const std::string name = std::string(spec.fName) + "_" + spec.fInts[m];
+         ints[c][m].reserve(kMaxCollectionSize);
+         tree.Branch(name.c_str(), ints[c][m].data(), (name + "[" + count + "]/I").c_str());
+         event.fInts[c].push_back(&ints[c][m]);
+      }
+   }
+}
+
+/// Add the fields of the NanoAOD-like model, a vector field per member of the collections
+void MakeNanoFields(RNTupleModel &model, RNanoEvent &event)
+{
+   event.fRun = model.MakeField<std::uint32_t>("run").get();
+   event.fEvent = model.MakeField<std::uint64_t>("event").get();
+   for (const auto *name : kNanoScalars)
+      event.fScalars.push_back(model.MakeField<float>(name).get());
+   event.fCounts.assign(kNanoCollections.size(), nullptr);
+   event.fFloats.resize(kNanoCollections.size());
+   event.fInts.resize(kNanoCollections.size());
+   for (std::size_t c = 0; c < kNanoCollections.size(); ++c) {
+      const auto &spec = kNanoCollections[c];
+      for (const auto *m : spec.fFloats) {
+         const std::string name = std::string(spec.fName) + "_" + m;
+         event.fFloats[c].push_back(model.MakeField<std::vector<float>>(name.c_str()).get());
+      }
+      for (const auto *m : spec.fInts) {
+         const std::string name = std::string(spec.fName) + "_" + m;
+         event.fInts[c].push_back(model.MakeField<std::vector<int>>(name.c_str()).get());
+      }
+   }
+}
+
+RMeasurement WriteTTree(const RLayout &layout, const std::string &path, std::size_t nEvents)
+{
+   RRSSMonitor rss;
+   TStopwatch sw;
+   sw.Start();
+   std::unique_ptr<TFile> file(TFile::Open(path.c_str(), "RECREATE", "", layout.fCompression));
+   if (!file || file->IsZombie())
+      throw std::runtime_error("cannot create " + path);
+   TTree tree("Events", "Events");
+   RGenerator gen;
+
+   if (layout.fSchema == "nanoaod") {
+      RNanoEvent event;
+      std::uint32_t run;
+      std::uint64_t eventNumber;
+      std::vector<float> scalars;
+      std::vector<std::uint32_t> counts;
+      std::vector<std::vector<std::vector<float>>> floats;
+      std::vector<std::vector<std::vector<int>>> ints;
+      MakeNanoBranches(tree, event, run, eventNumber, scalars, counts, floats, ints);
+      for (std::size_t i = 0; i < nEvents; ++i) {
+         event.Generate(gen, i);
+         tree.Fill();
+         if (i % 64 == 0)
+            rss.Sample();
+      }
+   } else {
+      std::uint32_t run;
+      std::uint64_t eventNumber;
+      auto tracks = std::make_unique<std::vector<IOBenchTrack>>();
+      auto jets = std::make_unique<std::vector<IOBenchJet>>();
+      auto vertices = std::make_unique<std::vector<IOBenchVertex>>();
+      auto *tracksPtr = tracks.get();
+      auto *jetsPtr = jets.get();
+      auto *verticesPtr = vertices.get();
+      tree.Branch("run", &run, "run/i");
+      tree.Branch("event", &eventNumber, "event/l");
+      tree.Branch("Tracks", &tracksPtr, 32000, layout.fSplitLevel);
+      tree.Branch("Jets", &jetsPtr, 32000, layout.fSplitLevel);
+      tree.Branch("Vertices", &verticesPtr, 32000, layout.fSplitLevel);
+      RAODEvent event{&run, &eventNumber, tracksPtr, jetsPtr, verticesPtr};
+      for (std::size_t i = 0; i < nEvents; ++i) {
+         event.Generate(gen, i);
+         tree.Fill();
+         if (i % 64 == 0)
+            rss.Sample();
+      }
+   }
+
+   tree.Write();
+   tree.SetDirectory(nullptr);
+   file->Close();
+   sw.Stop();
+   return {sw.RealTime(), sw.CpuTime(), rss.GetPeakMB()};
+}
+
+RMeasurement WriteRNTuple(const RLayout &layout, const std::string &path, std::size_t nEvents)
+{
+   RRSSMonitor rss;
+   TStopwatch sw;
+   sw.Start();
+   auto model = RNTupleModel::Create();
+   RNanoEvent nanoEvent;
+   RAODEvent aodEvent;
+   if (layout.fSchema == "nanoaod") {
+      MakeNanoFields(*model, nanoEvent);
+   } else {
+      aodEvent.fRun = model->MakeField<std::uint32_t>("run").get();
+      aodEvent.fEvent = model->MakeField<std::uint64_t>("event").get();
+      aodEvent.fTracks = model->MakeField<std::vector<IOBenchTrack>>("Tracks").get();
+      aodEvent.fJets = model->MakeField<std::vector<IOBenchJet>>("Jets").get();
+      aodEvent.fVertices = model->MakeField<std::vector<IOBenchVertex>>("Vertices").get();
+   }
+
+   RNTupleWriteOptions options;
+   options.SetCompression(layout.fCompression);
+   options.SetApproxUnzippedPageSize(layout.fPageSize);
+   options.SetApproxZippedClusterSize(layout.fClusterSize);
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "Events", path, options);
+      RGenerator gen;
+      for (std::size_t i = 0; i < nEvents; ++i) {
+         if (layout.fSchema == "nanoaod")
+            nanoEvent.Generate(gen, i);
+         else
+            aodEvent.Generate(gen, i);
+         writer->Fill();
+         if (i % 64 == 0)
+            rss.Sample();
+      }
+   }
+   sw.Stop();
+   return {sw.RealTime(), sw.CpuTime(), rss.GetPeakMB()};
+}
+
+RMeasurement ReadTTree(const std::string &url, std::size_t &nEvents)
+{
+   RRSSMonitor rss;
+   TStopwatch sw;
+   sw.Start();
+   std::unique_ptr<TFile> file(TFile::Open(url.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+   if (!file || file->IsZombie())
+      throw std::runtime_error("cannot open " + url);
+   auto tree = file->Get<TTree>("Events");
+   if (!tree)
+      throw std::runtime_error("no tree 'Events' in " + url);
+   nEvents = tree->GetEntries();
+   for (Long64_t i = 0; i < tree->GetEntries(); ++i) {
+      tree->GetEntry(i);
+      if (i % 64 == 0)
+         rss.Sample();
+   }
+   sw.Stop();
+   return {sw.RealTime(), sw.CpuTime(), rss.GetPeakMB()};
+}
+
+RMeasurement ReadRNTuple(const std::string &url, std::size_t &nEvents)
+{
+   RRSSMonitor rss;
+   TStopwatch sw;
+   sw.Start();
+   auto reader = RNTupleReader::Open("Events", url);
+   nEvents = reader->GetNEntries();
+   for (std::size_t i = 0; i < nEvents; ++i) {
+      reader->LoadEntry(i);
+      if (i % 64 == 0)
+         rss.Sample();
+   }
+   sw.Stop();
+   return {sw.RealTime(), sw.CpuTime(), rss.GetPeakMB()};
+}
+
+Long64_t GetFileSize(const std::string &url)
+{
+   std::unique_ptr<TFile> file(TFile::Open(url.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+   if (!file || file->IsZombie())
+      throw std::runtime_error("cannot open " + url);
+   return file->GetSize();
+}
+
+void Report(const RConfig &config, const RLayout &layout, int nThreads, const char *phase, std::size_t nEvents,
+            Long64_t fileSize, const RMeasurement &m)
+{
+   const double mbPerSec = fileSize / m.fRealTime / 1024 / 1024;
+   const double eventsPerSec = nEvents / m.fRealTime;
+   if (config.fCSV) {
+      std::printf("%s,%s,%s,%d,%d,%s,%zu,%lld,%g,%g,%g,%g,%g\n", layout.fSchema.c_str(), layout.fFormat.c_str(),
+                  layout.GetName().c_str(), layout.fCompression, nThreads, phase, nEvents, fileSize, m.fRealTime,
+                  m.fCpuTime, mbPerSec, eventsPerSec, m.fPeakRSSMB);
+   } else {
+      std::printf("%-8s %-8s %-22s %5d %4d %-6s %8.1f %10.1f %12.0f %10.1f\n", layout.fSchema.c_str(),
+                  layout.fFormat.c_str(), layout.GetName().c_str(), layout.fCompression, nThreads, phase,
+                  fileSize / 1024. / 1024., mbPerSec, eventsPerSec, m.fPeakRSSMB);
+   }
+   std::fflush(stdout);
+}
+
+void RunLayout(const RConfig &config, const RLayout &layout, int nThreads)
+{
+   const std::string path = config.fDirectory + "/" + layout.GetFileName();
+   const std::string url = config.fReadUrl.empty() ? path : config.fReadUrl + "/" + layout.GetFileName();
+   const bool isTTree = layout.fFormat == "ttree";
+
+   if (!config.fReadOnly) {
+      const auto m = isTTree ? WriteTTree(layout, path, config.fNEvents) : WriteRNTuple(layout, path, config.fNEvents);
+      Report(config, layout, nThreads, "write", config.fNEvents, GetFileSize(path), m);
+   }
+
+   std::size_t nEvents = 0;
+   const auto m = isTTree ? ReadTTree(url, nEvents) : ReadRNTuple(url, nEvents);
+   Report(config, layout, nThreads, "read", nEvents, GetFileSize(url), m);
+
+   if (!config.fReadOnly && !config.fKeep)
+      gSystem->Unlink(path.c_str());
+}
+
+template <typename T>
+std::vector<T> ParseList(const std::string &arg)
+{
+   std::vector<T> values;
+   std::istringstream is(arg);
+   std::string item;
+   while (std::getline(is, item, ',')) {
+      std::istringstream itemStream(item);
+      T value;
+      if (!(itemStream >> value))
+         throw std::runtime_error("invalid list '" + arg + "'");
+      values.push_back(value);
+   }
+   return values;
+}
+
+RConfig ParseArgs(int argc, char **argv)
+{
+   RConfig config;
+   for (int i = 1; i < argc; ++i) {
+      const std::string arg = argv[i];
+      auto next = [&]() -> std::string {
+         if (i + 1 >= argc)
+            throw std::runtime_error("missing value for " + arg);
+         return argv[++i];
+      };
+      auto all = [](const std::string &value, std::vector<std::string> choices) {
+         return value == "all" ? choices : std::vector<std::string>{value};
+      };
+      if (arg == "--events")
+         config.fNEvents = std::atof(next().c_str());
+      else if (arg == "--schema")
+         config.fSchemas = all(next(), {"nanoaod", "aod"});
+      else if (arg == "--format")
+         config.fFormats = all(next(), {"ttree", "rntuple"});
+      else if (arg == "--compression")
+         config.fCompressions = ParseList<int>(next());
+      else if (arg == "--threads")
+         config.fThreads = ParseList<int>(next());
+      else if (arg == "--page-sizes")
+         config.fPageSizes = ParseList<std::size_t>(next());
+      else if (arg == "--cluster-sizes")
+         config.fClusterSizes = ParseList<std::size_t>(next());
+      else if (arg == "--dir")
+         config.fDirectory = next();
+      else if (arg == "--read-url")
+         config.fReadUrl = next();
+      else if (arg == "--read-only")
+         config.fReadOnly = true;
+      else if (arg == "--keep")
+         config.fKeep = true;
+      else if (arg == "--csv")
+         config.fCSV = true;
+      else
+         throw std::runtime_error("unknown option " + arg);
+   }
+   if (config.fReadOnly && config.fReadUrl.empty())
+      config.fReadUrl = config.fDirectory;
+   return config;
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+   RConfig config;
+   try {
+      config = ParseArgs(argc, argv);
+   } catch (const std::exception &e) {
+      Error("ntuple_iobench", "%s", e.what());
+      return 1;
+   }
+
+   if (config.fCSV) {
+      std::printf("schema,format,layout,compression,threads,phase,events,file_bytes,real_s,cpu_s,mb_per_s,"
+                  "events_per_s,peak_rss_mb\n");
+   } else {
+      std::printf("%-8s %-8s %-22s %5s %4s %-6s %8s %10s %12s %10s\n", "schema", "format", "layout", "comp", "thr",
+                  "phase", "size[MB]", "MB/s", "events/s", "RSS[MB]");
+   }
+
+   bool success = true;
+   for (const auto nThreads : config.fThreads) {
+#ifdef R__USE_IMT
+      if (nThreads > 1)
+         ROOT::EnableImplicitMT(nThreads);
+      else
+         ROOT::DisableImplicitMT();
+#else
+      if (nThreads > 1)
+         Warning("ntuple_iobench", "ROOT was built without implicit multi-threading, running single-threaded");
+#endif
+      for (const auto &schema : config.fSchemas) {
+         for (const auto &format : config.fFormats) {
+            for (const auto compression : config.fCompressions) {
+               std::vector<RLayout> layouts;
+               if (format == "ttree") {
+                  // The split level only makes a difference for the objects of the AOD-like model
+                  for (const int splitLevel : {0, 99}) {
+                     if (schema == "nanoaod" && splitLevel == 0)
+                        continue;
+                     layouts.push_back({schema, format, splitLevel, 0, 0, compression});
+                  }
+               } else {
+                  for (const auto pageSize : config.fPageSizes)
+                     for (const auto clusterSize : config.fClusterSizes)
+                        layouts.push_back({schema, format, 0, pageSize, clusterSize, compression});
+               }
+               for (const auto &layout : layouts) {
+                  try {
+                     RunLayout(config, layout, nThreads);
+                  } catch (const std::exception &e) {
+                     Error("ntuple_iobench", "%s: %s", layout.GetFileName().c_str(), e.what());
+                     success = false;
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   return success ? 0 : 1;
+}
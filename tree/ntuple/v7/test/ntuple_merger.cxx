@@ -79,3 +79,96 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+namespace {
+
+void WriteMergerInput(const std::string &path, int firstValue, int compression)
+{
+   auto model = RNTupleModel::Create();
+   auto fldPt = model->MakeField<float>("pt");
+   auto fldVec = model->MakeField<std::vector<std::int32_t>>("vec");
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", path, options);
+   for (int i = firstValue; i < firstValue + 10; ++i) {
+      *fldPt = i;
+      *fldVec = {i, 2 * i};
+      writer->Fill();
+      if (i % 4 == 0)
+         writer->CommitCluster();
+   }
+}
+
+} // anonymous namespace
+
+TEST(RNTupleMerger, Merge)
+{
+   FileRaii fileGuard1("test_ntuple_merger_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_in2.root");
+   FileRaii fileGuard3("test_ntuple_merger_out_fast.root");
+   FileRaii fileGuard4("test_ntuple_merger_out_recompressed.root");
+   WriteMergerInput(fileGuard1.GetPath(), 0, 505);
+   WriteMergerInput(fileGuard2.GetPath(), 10, 505);
+
+   for (auto compression : {505, 0}) {
+      const auto &outPath = (compression == 505) ? fileGuard3.GetPath() : fileGuard4.GetPath();
+      {
+         std::vector<std::unique_ptr<RPageSource>> sources;
+         sources.emplace_back(RPageSource::Create("ntpl", fileGuard1.GetPath()));
+         sources.emplace_back(RPageSource::Create("ntpl", fileGuard2.GetPath()));
+         std::vector<RPageSource *> sourcePtrs;
+         for (const auto &s : sources)
+            sourcePtrs.emplace_back(s.get());
+
+         RNTupleWriteOptions options;
+         options.SetCompression(compression);
+         auto destination = std::make_unique<RPageSinkFile>("ntpl", outPath, options);
+         RNTupleMerger merger;
+         merger.Merge(sourcePtrs, *destination);
+         if (compression == 505) {
+            EXPECT_GT(merger.GetNPagesCopied(), 0U);
+            EXPECT_EQ(0U, merger.GetNPagesRecompressed());
+         } else {
+            EXPECT_GT(merger.GetNPagesRecompressed(), 0U);
+         }
+      }
+
+      auto reader = RNTupleReader::Open("ntpl", outPath);
+      ASSERT_EQ(20U, reader->GetNEntries());
+      EXPECT_EQ(7U, reader->GetDescriptor()->GetNClusters());
+      auto viewPt = reader->GetView<float>("pt");
+      auto viewVec = reader->GetView<std::vector<std::int32_t>>("vec");
+      for (auto i : reader->GetEntryRange()) {
+         EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+         EXPECT_EQ(std::vector<std::int32_t>({static_cast<std::int32_t>(i), static_cast<std::int32_t>(2 * i)}),
+                   viewVec(i));
+      }
+   }
+}
+
+TEST(RNTupleMerger, SchemaMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_merger_mismatch_in1.root");
+   FileRaii fileGuard2("test_ntuple_merger_mismatch_in2.root");
+   FileRaii fileGuard3("test_ntuple_merger_mismatch_out.root");
+   WriteMergerInput(fileGuard1.GetPath(), 0, 505);
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<double>("pt");
+      model->MakeField<std::vector<std::int32_t>>("vec");
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard2.GetPath());
+      writer->Fill();
+   }
+
+   auto source1 = RPageSource::Create("ntpl", fileGuard1.GetPath());
+   auto source2 = RPageSource::Create("ntpl", fileGuard2.GetPath());
+   std::vector<RPageSource *> sources{source1.get(), source2.get()};
+   auto destination = std::make_unique<RPageSinkFile>("ntpl", fileGuard3.GetPath(), RNTupleWriteOptions());
+   RNTupleMerger merger;
+   try {
+      merger.Merge(sources, *destination);
+      FAIL() << "merging ntuples with different column types should fail";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("different column type"));
+   }
+}
@@ -112,3 +112,57 @@ TEST(Metrics, RNTupleWriter)
    // one page for the int field, one for the float field
    EXPECT_EQ(2, page_counter->GetValueAsInt());
 }
+
+TEST(Metrics, IOStats)
+{
+   FileRaii fileGuard("test_ntuple_iostats.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTags = model->MakeField<std::vector<std::int32_t>>("tags");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 100; i++) {
+         *wrPt = static_cast<float>(i);
+         *wrTags = std::vector<std::int32_t>(i % 4, i);
+         ntuple->Fill();
+         if (i == 49)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RNTupleReadOptions options;
+   auto reader = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+   std::ostringstream osDisabled;
+   reader->PrintInfo(ROOT::Experimental::ENTupleInfo::kIOStats, osDisabled);
+   EXPECT_THAT(osDisabled.str(), testing::HasSubstr("not available"));
+
+   options.SetEnableIOStats(true);
+   auto source = std::make_unique<RPageSourceFile>("ntpl", fileGuard.GetPath(), options);
+   auto sourcePtr = source.get();
+   reader = std::make_unique<RNTupleReader>(std::move(source));
+   auto ioStats = sourcePtr->GetIOStats();
+   ASSERT_NE(nullptr, ioStats);
+   EXPECT_TRUE(ioStats->GetCounts().empty());
+
+   auto viewPt = reader->GetView<float>("pt");
+   for (auto i : reader->GetEntryRange())
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+
+   const auto &desc = *reader->GetDescriptor();
+   const auto ptColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("pt"), 0);
+   const auto tagsColumnId = desc.FindPhysicalColumnId(desc.FindFieldId("tags"), 0);
+   // One page of the pt column per cluster, the columns of the tags field are not read
+   const auto ptCounts = ioStats->GetColumnCounts(ptColumnId);
+   EXPECT_EQ(100 * sizeof(float), ptCounts.fSzUnzip);
+   EXPECT_EQ(2U, ptCounts.fNPageUnzipped);
+   EXPECT_LT(0U, ptCounts.fSzRead);
+   EXPECT_EQ(0U, ioStats->GetColumnCounts(tagsColumnId).fSzRead);
+   EXPECT_EQ(2U, ioStats->GetCounts().size());
+   EXPECT_EQ(50 * sizeof(float), ioStats->GetClusterCounts(desc.FindClusterId(ptColumnId, 0)).fSzUnzip);
+
+   std::ostringstream os;
+   reader->PrintInfo(ROOT::Experimental::ENTupleInfo::kIOStats, os);
+   EXPECT_THAT(os.str(), testing::HasSubstr("pt[0]"));
+   EXPECT_THAT(os.str(), testing::HasSubstr("Total"));
+   EXPECT_THAT(ioStats->ToJSON(desc), testing::HasSubstr("\"field\": \"pt\""));
+}
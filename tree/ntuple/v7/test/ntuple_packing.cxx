@@ -174,6 +174,52 @@ TYPED_TEST(PackingIndex, SplitIndex)
    EXPECT_EQ(mem, cmp);
 }
 
+TEST(Packing, SplitBytes)
+{
+   // Covers the SIMD kernels (blocks of 16 elements) and their scalar remainder
+   constexpr std::size_t kCount = 1000;
+   for (std::size_t elementSize : {1, 2, 4, 8}) {
+      std::vector<unsigned char> mem(kCount * elementSize);
+      for (std::size_t i = 0; i < mem.size(); ++i)
+         mem[i] = static_cast<unsigned char>(i * 7 + i / 13);
+
+      std::vector<unsigned char> split(mem.size());
+      ROOT::Experimental::Internal::SplitBytes(split.data(), mem.data(), kCount, 0, kCount, elementSize);
+      for (std::size_t i = 0; i < kCount; ++i) {
+         for (std::size_t b = 0; b < elementSize; ++b)
+            EXPECT_EQ(mem[i * elementSize + b], split[b * kCount + i]);
+      }
+
+      std::vector<unsigned char> cmp(mem.size());
+      ROOT::Experimental::Internal::UnsplitBytes(cmp.data(), split.data(), kCount, 0, kCount, elementSize);
+      EXPECT_EQ(mem, cmp);
+
+      // Unsplit a range of elements that does not start at a multiple of the SIMD vector width
+      std::vector<unsigned char> part(100 * elementSize);
+      ROOT::Experimental::Internal::UnsplitBytes(part.data(), split.data(), kCount, 37, 100, elementSize);
+      EXPECT_EQ(0, memcmp(part.data(), mem.data() + 37 * elementSize, part.size()));
+   }
+}
+
+TYPED_TEST(PackingInt, SplitIntLarge)
+{
+   using Pod_t = typename TestFixture::Helper_t::Pod_t;
+
+   ROOT::Experimental::Detail::RColumnElement<Pod_t, TestFixture::Helper_t::kColumnType> element;
+
+   // More than one block of elements, not a multiple of the block size
+   std::vector<Pod_t> mem(1000);
+   for (std::size_t i = 0; i < mem.size(); ++i)
+      mem[i] = static_cast<Pod_t>((i % 2) ? i : -i);
+   std::vector<Pod_t> packed(mem.size());
+   std::vector<Pod_t> cmp(mem.size());
+
+   element.Pack(packed.data(), mem.data(), mem.size());
+   element.Unpack(cmp.data(), packed.data(), mem.size());
+
+   EXPECT_EQ(mem, cmp);
+}
+
 namespace {
 
 template <typename PodT, ROOT::Experimental::EColumnType ColumnT>
@@ -303,3 +349,135 @@ TEST(Packing, OnDiskEncoding)
    EXPECT_EQ(std::string("abc"), viewStr(0));
    EXPECT_EQ(std::string("de"), viewStr(1));
 }
+
+TEST(Packing, Bits)
+{
+   for (std::size_t nBits = 1; nBits <= 32; ++nBits) {
+      const std::uint64_t mask = (std::uint64_t(1) << nBits) - 1;
+      std::uint32_t values[67];
+      for (std::size_t i = 0; i < 67; ++i)
+         values[i] = static_cast<std::uint32_t>((i * 0x9E3779B97F4A7C15ull) & mask);
+      unsigned char packed[67 * 4] = {0};
+      ROOT::Experimental::Internal::PackBits(packed, values, 67, nBits);
+      std::uint32_t unpacked[67];
+      ROOT::Experimental::Internal::UnpackBits(unpacked, packed, 67, nBits);
+      for (std::size_t i = 0; i < 67; ++i)
+         EXPECT_EQ(values[i], unpacked[i]) << "nBits " << nBits << ", element " << i;
+   }
+
+   // little-endian bit order: the first value occupies the lowest bits of the first byte
+   std::uint32_t values[] = {0x5, 0x3, 0x1};
+   unsigned char packed[2] = {0, 0};
+   ROOT::Experimental::Internal::PackBits(packed, values, 3, 3);
+   EXPECT_EQ(0x5d, packed[0]); // 01 011 101
+   EXPECT_EQ(0x00, packed[1]);
+}
+
+TEST(Packing, Real32Trunc)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, EColumnType::kReal32Trunc> element;
+   EXPECT_THROW(element.SetBitsOnStorage(9), RException);
+   EXPECT_THROW(element.SetBitsOnStorage(32), RException);
+   element.SetBitsOnStorage(16);
+   EXPECT_EQ(16u, element.GetBitsOnStorage());
+   EXPECT_EQ(200u, element.GetPackedSize(100));
+
+   std::vector<float> values;
+   for (int i = 0; i < 100; ++i)
+      values.push_back(std::pow(-1.1f, i) * (i + 0.1234f));
+   values.push_back(std::numeric_limits<float>::infinity());
+   values.push_back(std::numeric_limits<float>::max());
+   values.push_back(0.f);
+   std::vector<unsigned char> packed(element.GetPackedSize(values.size()));
+   element.Pack(packed.data(), values.data(), values.size());
+   std::vector<float> unpacked(values.size());
+   element.Unpack(unpacked.data(), packed.data(), values.size());
+   // 7 bits of mantissa are kept
+   for (std::size_t i = 0; i < values.size() - 3; ++i)
+      EXPECT_NEAR(values[i], unpacked[i], std::abs(values[i]) / 256.f);
+   EXPECT_TRUE(std::isinf(unpacked[100]));
+   EXPECT_TRUE(std::isfinite(unpacked[101]));
+   EXPECT_EQ(0.f, unpacked[102]);
+
+   ROOT::Experimental::Detail::RColumnElement<double, EColumnType::kReal32Trunc> elementDouble;
+   elementDouble.SetBitsOnStorage(31);
+   double d = 1. / 3.;
+   std::uint32_t packedDouble = 0;
+   elementDouble.Pack(&packedDouble, &d, 1);
+   double e = 0.;
+   elementDouble.Unpack(&e, &packedDouble, 1);
+   EXPECT_NEAR(d, e, 1e-6);
+}
+
+TEST(Packing, Real32Quant)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, EColumnType::kReal32Quant> element;
+   EXPECT_THROW(element.SetBitsOnStorage(0), RException);
+   EXPECT_THROW(element.SetValueRange(1., 1.), RException);
+   element.SetBitsOnStorage(12);
+   element.SetValueRange(-1., 3.);
+
+   std::vector<float> values{-1.f, 3.f, -5.f, 7.f, std::numeric_limits<float>::quiet_NaN()};
+   for (int i = 0; i < 100; ++i)
+      values.push_back(-1.f + 0.04f * i);
+   std::vector<unsigned char> packed(element.GetPackedSize(values.size()));
+   element.Pack(packed.data(), values.data(), values.size());
+   std::vector<float> unpacked(values.size());
+   element.Unpack(unpacked.data(), packed.data(), values.size());
+   EXPECT_FLOAT_EQ(-1.f, unpacked[0]);
+   EXPECT_FLOAT_EQ(3.f, unpacked[1]);
+   EXPECT_FLOAT_EQ(-1.f, unpacked[2]);
+   EXPECT_FLOAT_EQ(3.f, unpacked[3]);
+   EXPECT_FLOAT_EQ(-1.f, unpacked[4]);
+   // half a quantization step
+   const float tolerance = 0.5f * 4.f / 4095.f + 1e-6f;
+   for (std::size_t i = 5; i < values.size(); ++i)
+      EXPECT_NEAR(values[i], unpacked[i], tolerance);
+}
+
+TEST(Packing, LossyFields)
+{
+   FileRaii fileGuard("test_ntuple_packing_lossyfields.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      auto fldTrunc = std::make_unique<RField<float>>("trunc");
+      fldTrunc->SetTruncated(14);
+      model->AddField(std::move(fldTrunc));
+      auto fldQuant = std::make_unique<RField<double>>("quant");
+      fldQuant->SetQuantized(0., 100., 16);
+      model->AddField(std::move(fldQuant));
+      auto fldInvalid = std::make_unique<RField<float>>("invalid");
+      EXPECT_THROW(fldInvalid->SetTruncated(8), RException);
+      EXPECT_THROW(fldInvalid->SetQuantized(1., 0., 8), RException);
+
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto e = writer->CreateEntry();
+      for (int i = 0; i < 1000; ++i) {
+         *e->Get<float>("trunc") = 0.5f + i;
+         *e->Get<double>("quant") = 0.1 * i;
+         writer->Fill(*e);
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto desc = reader->GetDescriptor();
+   const auto &truncModel =
+      desc->GetColumnDescriptor(desc->FindPhysicalColumnId(desc->FindFieldId("trunc"), 0)).GetModel();
+   EXPECT_EQ(EColumnType::kReal32Trunc, truncModel.GetType());
+   EXPECT_EQ(14u, truncModel.GetBitsOnStorage());
+   const auto &quantModel =
+      desc->GetColumnDescriptor(desc->FindPhysicalColumnId(desc->FindFieldId("quant"), 0)).GetModel();
+   EXPECT_EQ(EColumnType::kReal32Quant, quantModel.GetType());
+   EXPECT_EQ(16u, quantModel.GetBitsOnStorage());
+   EXPECT_EQ(0., quantModel.GetValueRange().first);
+   EXPECT_EQ(100., quantModel.GetValueRange().second);
+
+   auto viewTrunc = reader->GetView<float>("trunc");
+   auto viewQuant = reader->GetView<double>("quant");
+   for (int i = 0; i < 1000; ++i) {
+      // 5 bits of mantissa are kept
+      EXPECT_NEAR(0.5f + i, viewTrunc(i), (0.5f + i) / 64.f);
+      EXPECT_NEAR(0.1 * i, viewQuant(i), 0.5 * 100. / 65535. + 1e-9);
+   }
+}
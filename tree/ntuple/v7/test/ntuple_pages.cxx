@@ -56,3 +56,79 @@ TEST(Pages, Pool)
    page = pool.GetPage(1, 55);
    EXPECT_TRUE(page.IsNull());
 }
+
+TEST(Pages, PoolMaxUnusedSize)
+{
+   RPagePool pool;
+   // Room for two of the 40 bytes pages
+   pool.SetMaxUnusedSize(100);
+
+   std::vector<int> buffer(30);
+   unsigned int nCallDeleter = 0;
+   RPageDeleter deleter([&nCallDeleter](const RPage & /*page*/, void * /*userData*/) { nCallDeleter++; });
+   for (unsigned int i = 0; i < 3; ++i) {
+      RPage page(1, &buffer[10 * i], 4, 10);
+      page.GrowUnchecked(10);
+      page.SetWindow(10 * i, RPage::RClusterInfo(0, 0));
+      pool.RegisterPage(page, deleter);
+      pool.ReturnPage(page);
+   }
+   // The first page was evicted when the third one was returned
+   EXPECT_EQ(1U, nCallDeleter);
+   EXPECT_TRUE(pool.GetPage(1, 5).IsNull());
+
+   // A kept page is found again and does not count as unused while in use
+   auto page = pool.GetPage(1, 15);
+   EXPECT_FALSE(page.IsNull());
+   RPage other(1, &buffer[0], 4, 10);
+   other.GrowUnchecked(10);
+   other.SetWindow(0, RPage::RClusterInfo(0, 0));
+   pool.RegisterPage(other, deleter);
+   pool.ReturnPage(other);
+   EXPECT_EQ(1U, nCallDeleter);
+   pool.ReturnPage(page);
+   // Now the page [20, 30) is the least recently returned one
+   EXPECT_EQ(2U, nCallDeleter);
+   EXPECT_TRUE(pool.GetPage(1, 25).IsNull());
+
+   pool.SetMaxUnusedSize(0);
+   EXPECT_EQ(4U, nCallDeleter);
+}
+
+TEST(Pages, SharedPoolOfClones)
+{
+   FileRaii fileGuard("test_ntuple_shared_page_pool.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 100; i++) {
+         *wrPt = static_cast<float>(i);
+         ntuple->Fill();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetPagePoolMaxUnusedSize(1024 * 1024);
+   options.SetEnableIOStats(true);
+   auto source = std::make_unique<RPageSourceFile>("ntpl", fileGuard.GetPath(), options);
+   auto clone = source->Clone();
+   auto clonePtr = clone.get();
+   auto reader = std::make_unique<RNTupleReader>(std::move(source));
+   {
+      auto viewPt = reader->GetView<float>("pt");
+      for (auto i : reader->GetEntryRange())
+         EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+   }
+
+   // The clone finds the page unzipped by the first reader in the shared pool
+   auto readerClone = std::make_unique<RNTupleReader>(std::move(clone));
+   auto viewPt = readerClone->GetView<float>("pt");
+   for (auto i : readerClone->GetEntryRange())
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+   const auto ptColumnId = readerClone->GetDescriptor()->FindPhysicalColumnId(
+      readerClone->GetDescriptor()->FindFieldId("pt"), 0);
+   const auto counts = clonePtr->GetIOStats()->GetColumnCounts(ptColumnId);
+   EXPECT_EQ(0U, counts.fNPageUnzipped);
+   EXPECT_LE(1U, counts.fNPagePoolHit);
+}
@@ -0,0 +1,98 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_basics.root");
+
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      model->MakeField<std::vector<std::int32_t>>("tags");
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      auto context = writer->CreateFillContext();
+      auto entry = context->CreateEntry();
+      *entry->Get<float>("pt") = 1.0;
+      *entry->Get<std::vector<std::int32_t>>("tags") = {1, 2};
+      context->Fill(*entry);
+      context->CommitCluster();
+      *entry->Get<float>("pt") = 2.0;
+      *entry->Get<std::vector<std::int32_t>>("tags") = {3};
+      context->Fill(*entry);
+      EXPECT_EQ(2U, context->GetNEntries());
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(2U, ntuple->GetNEntries());
+   EXPECT_EQ(2U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewTags = ntuple->GetView<std::vector<std::int32_t>>("tags");
+   EXPECT_FLOAT_EQ(1.0, viewPt(0));
+   EXPECT_FLOAT_EQ(2.0, viewPt(1));
+   EXPECT_EQ(std::vector<std::int32_t>({1, 2}), viewTags(0));
+   EXPECT_EQ(std::vector<std::int32_t>({3}), viewTags(1));
+}
+
+TEST(RNTupleParallelWriter, WrongContext)
+{
+   FileRaii fileGuard("test_ntuple_parallel_wrong_context.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+   auto context1 = writer->CreateFillContext();
+   auto context2 = writer->CreateFillContext();
+   auto entry = context1->CreateEntry();
+   EXPECT_THROW(context2->Fill(*entry), RException);
+}
+
+TEST(RNTupleParallelWriter, Threads)
+{
+   FileRaii fileGuard("test_ntuple_parallel_threads.root");
+
+   constexpr int kNThreads = 4;
+   constexpr int kNEntriesPerThread = 10000;
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<std::int32_t>("thread");
+      model->MakeField<std::int32_t>("i");
+      model->MakeField<std::vector<float>>("v");
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(2000);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t]() {
+            auto context = writer->CreateFillContext();
+            auto entry = context->CreateEntry();
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *entry->Get<std::int32_t>("thread") = t;
+               *entry->Get<std::int32_t>("i") = i;
+               *entry->Get<std::vector<float>>("v") = std::vector<float>(i % 4, i);
+               context->Fill(*entry);
+            }
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(static_cast<NTupleSize_t>(kNThreads * kNEntriesPerThread), ntuple->GetNEntries());
+   EXPECT_LT(kNThreads, ntuple->GetDescriptor()->GetNClusters());
+   auto viewThread = ntuple->GetView<std::int32_t>("thread");
+   auto viewI = ntuple->GetView<std::int32_t>("i");
+   auto viewV = ntuple->GetView<std::vector<float>>("v");
+   // Within a thread, entries are written in order
+   std::vector<int> next(kNThreads, 0);
+   for (auto i : ntuple->GetEntryRange()) {
+      auto t = viewThread(i);
+      ASSERT_LE(0, t);
+      ASSERT_GT(kNThreads, t);
+      EXPECT_EQ(next[t], viewI(i));
+      EXPECT_EQ(std::vector<float>(next[t] % 4, next[t]), viewV(i));
+      next[t]++;
+   }
+   for (int t = 0; t < kNThreads; ++t)
+      EXPECT_EQ(kNEntriesPerThread, next[t]);
+}
@@ -424,6 +424,202 @@ TEST(RPageSinkBuf, ParallelZip) {
    }
 }
 
+TEST(RPageSinkBuf, ParallelZipOff)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif
+
+   FileRaii fileGuard("test_ntuple_sinkbuf_pzip_off.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto floatField = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetUseImplicitMT(RNTupleWriteOptions::EImplicitMT::kOff);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "buf_pzip_off", fileGuard.GetPath(), options);
+      ntuple->EnableMetrics();
+      for (int i = 0; i < 20000; i++) {
+         *floatField = static_cast<float>(i);
+         ntuple->Fill();
+      }
+      ntuple->CommitCluster();
+      auto *parallel_zip = ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.ParallelZip");
+      ASSERT_FALSE(parallel_zip == nullptr);
+      EXPECT_EQ(0, parallel_zip->GetValueAsInt());
+   }
+
+   auto ntuple = RNTupleReader::Open("buf_pzip_off", fileGuard.GetPath());
+   EXPECT_EQ(20000, ntuple->GetNEntries());
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+   }
+}
+
+TEST(RPageSourceFile, BackgroundUnzip)
+{
+   FileRaii fileGuard("test_ntuple_background_unzip.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetCompression(505);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; i++) {
+         *wrPt = static_cast<float>(i);
+         ntuple->Fill();
+         if (i % 100 == 99)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetUseBackgroundUnzip(true);
+   options.SetClusterBunchSize(2);
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+   EXPECT_EQ(10U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+   }
+}
+
+TEST(RPageSourceFile, ParallelPageLists)
+{
+#ifdef R__USE_IMT
+   ROOT::EnableImplicitMT();
+#endif
+
+   FileRaii fileGuard("test_ntuple_parallel_page_lists.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::vector<std::int32_t>>("tag");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath());
+      for (int i = 0; i < 1000; i++) {
+         *wrPt = static_cast<float>(i);
+         *wrTag = std::vector<std::int32_t>(i % 3, i);
+         ntuple->Fill();
+         if (i % 50 == 49)
+            ntuple->CommitCluster(i % 200 == 199 /* commitClusterGroup */);
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   EXPECT_EQ(5U, ntuple->GetDescriptor()->GetNClusterGroups());
+   EXPECT_EQ(20U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewTag = ntuple->GetView<std::vector<std::int32_t>>("tag");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(std::vector<std::int32_t>(i % 3, i), viewTag(i));
+   }
+}
+
+TEST(RPageSourceFile, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrE = model->MakeField<double>("E");
+      auto wrTag = model->MakeField<std::vector<std::int32_t>>("tag");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; i++) {
+         *wrPt = static_cast<float>(i);
+         *wrE = 2.0 * i;
+         *wrTag = std::vector<std::int32_t>(i % 3, i);
+         ntuple->Fill();
+         if (i % 400 == 399)
+            ntuple->CommitCluster();
+      }
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetUseMmap(true);
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewE = ntuple->GetView<double>("E");
+      auto viewTag = ntuple->GetView<std::vector<std::int32_t>>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+         EXPECT_DOUBLE_EQ(2.0 * i, viewE(i));
+         EXPECT_EQ(std::vector<std::int32_t>(i % 3, i), viewTag(i));
+      }
+   }
+}
+
+TEST(RPageSourceFile, PageChecksums)
+{
+   FileRaii fileGuard("test_ntuple_page_checksums.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrTag = model->MakeField<std::vector<std::int32_t>>("tag");
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      options.SetEnablePageChecksums(true);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; i++) {
+         *wrPt = static_cast<float>(i);
+         *wrTag = std::vector<std::int32_t>(i % 3, i);
+         ntuple->Fill();
+         if (i % 400 == 399)
+            ntuple->CommitCluster();
+      }
+   }
+
+   std::uint64_t ptPosition = 0;
+   {
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+      const auto desc = ntuple->GetDescriptor();
+      const auto columnId = desc->FindPhysicalColumnId(desc->FindFieldId("pt"), 0);
+      const auto &pageInfo =
+         desc->GetClusterDescriptor(desc->FindClusterId(columnId, 0)).GetPageRange(columnId).fPageInfos[0];
+      EXPECT_TRUE(pageInfo.fHasChecksum);
+      EXPECT_EQ(pageInfo.fNElements * sizeof(float) + RPageStorage::kNBytesPageChecksum,
+                pageInfo.fLocator.fBytesOnStorage);
+      ptPosition = pageInfo.fLocator.GetPosition<std::uint64_t>();
+
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewTag = ntuple->GetView<std::vector<std::int32_t>>("tag");
+      for (auto i : ntuple->GetEntryRange()) {
+         EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+         EXPECT_EQ(std::vector<std::int32_t>(i % 3, i), viewTag(i));
+      }
+   }
+
+   // Corrupt the first value of the first page of "pt"
+   {
+      FILE *f = fopen(fileGuard.GetPath().c_str(), "r+b");
+      ASSERT_NE(nullptr, f);
+      const float corrupted = 42.f;
+      ASSERT_EQ(0, fseek(f, ptPosition, SEEK_SET));
+      ASSERT_EQ(1u, fwrite(&corrupted, sizeof(corrupted), 1, f));
+      fclose(f);
+   }
+
+   for (auto clusterCache : {RNTupleReadOptions::EClusterCache::kOn, RNTupleReadOptions::EClusterCache::kOff}) {
+      RNTupleReadOptions options;
+      options.SetClusterCache(clusterCache);
+      auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      auto viewPt = ntuple->GetView<float>("pt");
+      auto viewTag = ntuple->GetView<std::vector<std::int32_t>>("tag");
+      EXPECT_EQ(std::vector<std::int32_t>(1, 1), viewTag(1));
+      EXPECT_THROW(viewPt(0), RException);
+
+      options.SetVerifyPageChecksums(false);
+      ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath(), options);
+      auto viewUnverified = ntuple->GetView<float>("pt");
+      EXPECT_FLOAT_EQ(42.f, viewUnverified(0));
+      EXPECT_FLOAT_EQ(1.f, viewUnverified(1));
+   }
+}
+
 TEST(RPageSinkBuf, CommitSealedPageV)
 {
    RNTupleWriteOptions options;
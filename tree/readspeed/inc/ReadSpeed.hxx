@@ -28,6 +28,23 @@ struct Data {
    std::vector<std::string> fBranchNames;
    /// If the branch names should use regex matching.
    bool fUseRegex = false;
+   /// If the datasets are RNTuples rather than TTrees: fTreeNames are then RNTuple names and fBranchNames the names
+   /// of top-level fields.
+   bool fUseRNTuple = false;
+   /// If the time spent reading each branch or field should be measured, see Result::fBranches.
+   bool fBreakdown = false;
+};
+
+/// Results for one branch of the TTrees or one top-level field of the RNTuples.
+struct BranchResult {
+   std::string fName;
+   /// Number of uncompressed bytes read.
+   ULong64_t fUncompressedBytesRead = 0;
+   /// Number of compressed bytes of the data read: exact for RNTuple fields, estimated from the compression ratio of
+   /// the branch for TTree branches.
+   ULong64_t fCompressedBytesRead = 0;
+   /// Real time spent reading the values (I/O, decompression and deserialization), in seconds, summed over threads.
+   double fRealTime = 0.;
 };
 
 struct Result {
@@ -45,6 +62,17 @@ struct Result {
    ULong64_t fCompressedBytesRead;
    /// Size of ROOT's thread pool for the run (0 indicates a single-thread run with no thread pool present).
    unsigned int fThreadPoolSize;
+   /// Real time spent waiting for reads from storage, in seconds, summed over threads.
+   double fIOTime = 0.;
+   /// Real time spent decompressing, in seconds, summed over threads.
+   double fUnzipTime = 0.;
+   /// Real time spent reading the values, in seconds, summed over threads. The deserialization time is the part not
+   /// spent in I/O or decompression.
+   double fReadTime = 0.;
+   /// Number of tasks of a multi-thread run.
+   std::size_t fNTasks = 0;
+   /// Per-branch or per-field results, if Data::fBreakdown was set.
+   std::vector<BranchResult> fBranches;
 };
 
 struct EntryRange {
@@ -55,6 +83,10 @@ struct EntryRange {
 struct ByteData {
    ULong64_t fUncompressedBytesRead;
    ULong64_t fCompressedBytesRead;
+   double fIOTime = 0.;
+   double fUnzipTime = 0.;
+   double fReadTime = 0.;
+   std::vector<BranchResult> fBranches;
 };
 
 struct ReadSpeedRegex {
@@ -64,12 +96,19 @@ struct ReadSpeedRegex {
    bool operator<(const ReadSpeedRegex &other) const { return text < other.text; }
 };
 
+// With isNTuple, treeName is the name of an RNTuple and the names of its top-level fields are matched.
 std::vector<std::string> GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
-                                                const std::vector<ReadSpeedRegex> &regexes);
+                                                const std::vector<ReadSpeedRegex> &regexes, bool isNTuple = false);
 
 // Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
+// With breakdown, also measure the time spent in each branch.
 ByteData ReadTree(TFile *file, const std::string &treeName, const std::vector<std::string> &branchNames,
-                  EntryRange range = {-1, -1});
+                  EntryRange range = {-1, -1}, bool breakdown = false);
+
+// Read the top-level fields listed in fieldNames of RNTuple ntupleName in file fileName through an RPageSource.
+// Throws if ROOT was built without RNTuple support.
+ByteData ReadNTuple(const std::string &fileName, const std::string &ntupleName,
+                    const std::vector<std::string> &fieldNames, EntryRange range = {-1, -1}, bool breakdown = false);
 
 Result EvalThroughputST(const Data &d);
 
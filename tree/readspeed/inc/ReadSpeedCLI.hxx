@@ -16,17 +16,21 @@
 
 #include "ReadSpeed.hxx"
 
+#include <ostream>
 #include <vector>
 
 namespace ReadSpeed {
 
 void PrintThroughput(const Result &r);
+// Print the result as a JSON object, for the comparison of runs by scripts.
+void PrintThroughputJSON(const Result &r, std::ostream &os);
 
 struct Args {
    Data fData;
    unsigned int fNThreads = 0;
    bool fAllBranches = false;
    bool fShouldRun = false;
+   bool fJSON = false;
 };
 
 Args ParseArgs(const std::vector<std::string> &args);
@@ -10,6 +10,7 @@
 
 #include "ReadSpeed.hxx"
 
+#include <RConfigure.h> // for R__USE_IMT; R__HAS_ROOT7 is defined by CMake for root7 builds
 #include <ROOT/TSeq.hxx>
 
 #ifdef R__USE_IMT
@@ -18,13 +19,23 @@
 #include <ROOT/RSlotStack.hxx>
 #endif
 
+#ifdef R__HAS_ROOT7
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RField.hxx>
+#include <ROOT/RNTupleDescriptor.hxx>
+#include <ROOT/RPageStorage.hxx>
+#endif
+
 #include <ROOT/InternalTreeUtils.hxx> // for ROOT::Internal::TreeUtils::GetTopLevelBranchNames
 #include <TBranch.h>
 #include <TStopwatch.h>
+#include <TTimeStamp.h>
 #include <TTree.h>
+#include <TVirtualPerfStats.h>
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cmath> // std::ceil
 #include <memory>
 #include <numeric> // std::accumulate
@@ -34,17 +45,225 @@
 
 using namespace ReadSpeed;
 
+namespace {
+
+using Clock_t = std::chrono::steady_clock;
+
+double SecondsSince(Clock_t::time_point start)
+{
+   return std::chrono::duration<double>(Clock_t::now() - start).count();
+}
+
+// Collects the time spent reading from the file and decompressing the baskets of the tree it is attached to.
+// TBasket makes it the perf stats of the reading thread while it reads and unzips a basket.
+class ReadSpeedPerfStats : public TVirtualPerfStats {
+   double fIOTime = 0.;
+   double fUnzipTime = 0.;
+
+   void SetFile(TFile *) final {}
+
+public:
+   double GetIOTime() const { return fIOTime; }
+   double GetUnzipTime() const { return fUnzipTime; }
+
+   void FileReadEvent(TFile *, Int_t, Double_t start) final { fIOTime += TTimeStamp().AsDouble() - start; }
+   void UnzipEvent(TObject *, Long64_t, Double_t start, Int_t, Int_t) final
+   {
+      fUnzipTime += TTimeStamp().AsDouble() - start;
+   }
+
+   void SimpleEvent(EEventType) final {}
+   void PacketEvent(const char *, const char *, const char *, Long64_t, Double_t, Double_t, Double_t, Long64_t) final
+   {
+   }
+   void FileEvent(const char *, const char *, const char *, const char *, Bool_t) final {}
+   void FileOpenEvent(TFile *, const char *, Double_t) final {}
+   void RateEvent(Double_t, Double_t, Long64_t, Long64_t) final {}
+   void SetBytesRead(Long64_t) final {}
+   Long64_t GetBytesRead() const final { return 0; }
+   void SetNumEvents(Long64_t) final {}
+   Long64_t GetNumEvents() const final { return 0; }
+   void PrintBasketInfo(Option_t *) const final {}
+   void SetLoaded(TBranch *, size_t) final {}
+   void SetLoaded(size_t, size_t) final {}
+   void SetLoadedMiss(TBranch *, size_t) final {}
+   void SetLoadedMiss(size_t, size_t) final {}
+   void SetMissed(TBranch *, size_t) final {}
+   void SetMissed(size_t, size_t) final {}
+   void SetUsed(TBranch *, size_t) final {}
+   void SetUsed(size_t, size_t) final {}
+   void UpdateBranchIndices(TObjArray *) final {}
+};
+
+// Add the per-branch results of `from` to the ones of `into`, matching them by name.
+void MergeBranchResults(std::vector<BranchResult> &into, const std::vector<BranchResult> &from)
+{
+   for (const auto &b : from) {
+      auto it = std::find_if(into.begin(), into.end(), [&b](const BranchResult &o) { return o.fName == b.fName; });
+      if (it == into.end()) {
+         into.push_back(b);
+         continue;
+      }
+      it->fUncompressedBytesRead += b.fUncompressedBytesRead;
+      it->fCompressedBytesRead += b.fCompressedBytesRead;
+      it->fRealTime += b.fRealTime;
+   }
+}
+
+#ifdef R__HAS_ROOT7
+using ROOT::Experimental::Detail::RPageSource;
+
+std::unique_ptr<RPageSource> OpenPageSource(const std::string &fileName, const std::string &ntupleName)
+{
+   auto source = RPageSource::Create(ntupleName, fileName);
+   source->GetMetrics().Enable();
+   try {
+      source->Attach();
+   } catch (const std::exception &e) {
+      throw std::runtime_error("Could not retrieve RNTuple '" + ntupleName + "' from file '" + fileName +
+                               "': " + e.what());
+   }
+   return source;
+}
+
+std::vector<std::string> GetTopLevelFieldNames(const std::string &fileName, const std::string &ntupleName)
+{
+   const auto source = OpenPageSource(fileName, ntupleName);
+   const auto descGuard = source->GetSharedDescriptorGuard();
+   std::vector<std::string> fieldNames;
+   for (const auto &f : descGuard->GetTopLevelFields())
+      fieldNames.emplace_back(f.GetFieldName());
+   return fieldNames;
+}
+
+// Value of the counter of the default RPageSource metrics, 0 if the page source does not have it
+std::int64_t GetCounterValue(RPageSource &source, const std::string &name)
+{
+   const auto counter = source.GetMetrics().GetLocalCounter(name);
+   return counter ? counter->GetValueAsInt() : 0;
+}
+
+// Read the top-level fields fieldNames of the entries of range from the RNTuple of source.
+ByteData ReadNTupleFields(RPageSource &source, const std::vector<std::string> &fieldNames, EntryRange range,
+                          bool breakdown)
+{
+   using namespace ROOT::Experimental;
+
+   std::vector<std::unique_ptr<Detail::RFieldBase>> fields;
+   std::vector<BranchResult> fieldResults;
+   {
+      const auto descGuard = source.GetSharedDescriptorGuard();
+      const RNTupleDescriptor &desc = descGuard.GetRef();
+
+      const auto nEntries = static_cast<Long64_t>(desc.GetNEntries());
+      if (range.fStart == -1ll)
+         range = EntryRange{0ll, nEntries};
+      else if (range.fEnd > nEntries)
+         throw std::runtime_error("Range end (" + std::to_string(range.fEnd) + ") is beyond the end of RNTuple '" +
+                                  desc.GetName() + "' with " + std::to_string(nEntries) + " entries.");
+
+      for (const auto &fName : fieldNames) {
+         const auto fieldId = desc.FindFieldId(fName);
+         if (fieldId == kInvalidDescriptorId)
+            throw std::runtime_error("Could not retrieve field '" + fName + "' from RNTuple '" + desc.GetName() +
+                                     '\'');
+         fields.emplace_back(desc.GetFieldDescriptor(fieldId).CreateField(desc));
+
+         // The bytes of the pages of the field and its sub fields in the clusters of the range
+         std::vector<DescriptorId_t> columnIds;
+         std::vector<DescriptorId_t> fieldIds{fieldId};
+         while (!fieldIds.empty()) {
+            const auto id = fieldIds.back();
+            fieldIds.pop_back();
+            for (const auto &c : desc.GetColumnIterable(id))
+               columnIds.emplace_back(c.GetPhysicalId());
+            for (const auto &f : desc.GetFieldIterable(id))
+               fieldIds.emplace_back(f.GetId());
+         }
+         BranchResult fieldResult;
+         fieldResult.fName = fName;
+         for (const auto &cluster : desc.GetClusterIterable()) {
+            const auto first = static_cast<Long64_t>(cluster.GetFirstEntryIndex());
+            if (first >= range.fEnd || first + static_cast<Long64_t>(cluster.GetNEntries()) <= range.fStart)
+               continue;
+            for (const auto columnId : columnIds) {
+               if (!cluster.ContainsColumn(columnId))
+                  continue;
+               const auto elementSize =
+                  Detail::RColumnElementBase::Generate(desc.GetColumnDescriptor(columnId).GetModel().GetType())
+                     ->GetSize();
+               for (const auto &pageInfo : cluster.GetPageRange(columnId).fPageInfos) {
+                  fieldResult.fCompressedBytesRead += pageInfo.fLocator.fBytesOnStorage;
+                  fieldResult.fUncompressedBytesRead += elementSize * pageInfo.fNElements;
+               }
+            }
+         }
+         fieldResults.emplace_back(std::move(fieldResult));
+      }
+   }
+
+   // The descriptor lock must not be held while the fields are connected
+   std::vector<Detail::RFieldBase::RValue> values;
+   for (auto &field : fields) {
+      field->ConnectPageSource(source);
+      values.emplace_back(field->GenerateValue());
+   }
+
+   const auto ioTimeStart = GetCounterValue(source, "timeWallRead");
+   const auto unzipTimeStart = GetCounterValue(source, "timeWallUnzip");
+   const auto bytesStart = GetCounterValue(source, "szReadPayload") + GetCounterValue(source, "szReadOverhead");
+
+   const auto start = Clock_t::now();
+   if (breakdown) {
+      for (auto e = range.fStart; e < range.fEnd; ++e) {
+         for (std::size_t i = 0; i < values.size(); ++i) {
+            const auto readStart = Clock_t::now();
+            values[i].Read(e);
+            fieldResults[i].fRealTime += SecondsSince(readStart);
+         }
+      }
+   } else {
+      for (auto e = range.fStart; e < range.fEnd; ++e)
+         for (auto &value : values)
+            value.Read(e);
+   }
+   const double readTime = SecondsSince(start);
+
+   ByteData result{0, static_cast<ULong64_t>(GetCounterValue(source, "szReadPayload") +
+                                             GetCounterValue(source, "szReadOverhead") - bytesStart)};
+   for (const auto &f : fieldResults)
+      result.fUncompressedBytesRead += f.fUncompressedBytesRead;
+   result.fIOTime = (GetCounterValue(source, "timeWallRead") - ioTimeStart) * 1e-9;
+   result.fUnzipTime = (GetCounterValue(source, "timeWallUnzip") - unzipTimeStart) * 1e-9;
+   result.fReadTime = readTime;
+   if (breakdown)
+      result.fBranches = std::move(fieldResults);
+   return result;
+}
+#endif // R__HAS_ROOT7
+
+} // anonymous namespace
+
 std::vector<std::string> ReadSpeed::GetMatchingBranchNames(const std::string &fileName, const std::string &treeName,
-                                                           const std::vector<ReadSpeedRegex> &regexes)
+                                                           const std::vector<ReadSpeedRegex> &regexes, bool isNTuple)
 {
-   const auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
-   if (f == nullptr || f->IsZombie())
-      throw std::runtime_error("Could not open file '" + fileName + '\'');
-   std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
-   if (t == nullptr)
-      throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
+   std::vector<std::string> unfilteredBranchNames;
+   if (isNTuple) {
+#ifdef R__HAS_ROOT7
+      unfilteredBranchNames = GetTopLevelFieldNames(fileName, treeName);
+#else
+      throw std::runtime_error("ROOT was built without RNTuple support (root7).");
+#endif
+   } else {
+      const auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+      if (f == nullptr || f->IsZombie())
+         throw std::runtime_error("Could not open file '" + fileName + '\'');
+      std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
+      if (t == nullptr)
+         throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + fileName + '\'');
 
-   const auto unfilteredBranchNames = ROOT::Internal::TreeUtils::GetTopLevelBranchNames(*t);
+      unfilteredBranchNames = ROOT::Internal::TreeUtils::GetTopLevelBranchNames(*t);
+   }
    std::set<ReadSpeedRegex> usedRegexes;
    std::vector<std::string> branchNames;
 
@@ -102,7 +321,7 @@ std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d)
    for (const auto &fName : d.fFileNames) {
       std::vector<std::string> branchNames;
       if (d.fUseRegex)
-         branchNames = GetMatchingBranchNames(fName, d.fTreeNames[treeIdx], regexes);
+         branchNames = GetMatchingBranchNames(fName, d.fTreeNames[treeIdx], regexes, d.fUseRNTuple);
       else
          branchNames = d.fBranchNames;
 
@@ -116,20 +335,24 @@ std::vector<std::vector<std::string>> GetPerFileBranchNames(const Data &d)
 }
 
 ByteData SumBytes(const std::vector<ByteData> &bytesData) {
-   const auto uncompressedBytes =
-      std::accumulate(bytesData.begin(), bytesData.end(), 0ull,
-                        [](ULong64_t sum, const ByteData &o) { return sum + o.fUncompressedBytesRead; });
-   const auto compressedBytes =
-      std::accumulate(bytesData.begin(), bytesData.end(), 0ull,
-                        [](ULong64_t sum, const ByteData &o) { return sum + o.fCompressedBytesRead; });
-
-   return {uncompressedBytes, compressedBytes};
+   ByteData sum{0, 0};
+   for (const auto &o : bytesData) {
+      sum.fUncompressedBytesRead += o.fUncompressedBytesRead;
+      sum.fCompressedBytesRead += o.fCompressedBytesRead;
+      sum.fIOTime += o.fIOTime;
+      sum.fUnzipTime += o.fUnzipTime;
+      sum.fReadTime += o.fReadTime;
+      MergeBranchResults(sum.fBranches, o.fBranches);
+   }
+
+   return sum;
 };
 
 // Read branches listed in branchNames in tree treeName in file fileName, return number of uncompressed bytes read.
 ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::vector<std::string> &branchNames,
-                             EntryRange range)
+                             EntryRange range, bool breakdown)
 {
+   ReadSpeedPerfStats perfStats; // must outlive the tree
    std::unique_ptr<TTree> t(f->Get<TTree>(treeName.c_str()));
    if (t == nullptr)
       throw std::runtime_error("Could not retrieve tree '" + treeName + "' from file '" + f->GetName() + '\'');
@@ -155,36 +378,86 @@ ByteData ReadSpeed::ReadTree(TFile *f, const std::string &treeName, const std::v
                                t->GetName() + "' in file '" + t->GetCurrentFile()->GetName() + "' with " +
                                std::to_string(nEntries) + " entries.");
 
+   t->SetPerfStats(&perfStats);
+
    ULong64_t bytesRead = 0;
+   std::vector<BranchResult> branchResults(breakdown ? branches.size() : 0);
    const ULong64_t fileStartBytes = f->GetBytesRead();
-   for (auto e = range.fStart; e < range.fEnd; ++e)
-      for (auto *b : branches)
-         bytesRead += b->GetEntry(e);
+   const auto start = Clock_t::now();
+   if (breakdown) {
+      for (auto e = range.fStart; e < range.fEnd; ++e) {
+         for (std::size_t i = 0; i < branches.size(); ++i) {
+            const auto readStart = Clock_t::now();
+            const auto nBytes = branches[i]->GetEntry(e);
+            branchResults[i].fRealTime += SecondsSince(readStart);
+            branchResults[i].fUncompressedBytesRead += nBytes;
+            bytesRead += nBytes;
+         }
+      }
+   } else {
+      for (auto e = range.fStart; e < range.fEnd; ++e)
+         for (auto *b : branches)
+            bytesRead += b->GetEntry(e);
+   }
+   const double readTime = SecondsSince(start);
+   t->SetPerfStats(nullptr);
 
    const ULong64_t fileBytesRead = f->GetBytesRead() - fileStartBytes;
-   return {bytesRead, fileBytesRead};
+   ByteData result{bytesRead, fileBytesRead};
+   result.fIOTime = perfStats.GetIOTime();
+   result.fUnzipTime = perfStats.GetUnzipTime();
+   result.fReadTime = readTime;
+   for (std::size_t i = 0; i < branchResults.size(); ++i) {
+      // The compressed size of the values read, assuming the compression ratio of the whole branch
+      const auto totBytes = branches[i]->GetTotBytes("*");
+      const auto zipBytes = branches[i]->GetZipBytes("*");
+      branchResults[i].fName = branchNames[i];
+      branchResults[i].fCompressedBytesRead =
+         totBytes > 0 ? ULong64_t(double(branchResults[i].fUncompressedBytesRead) * zipBytes / totBytes) : 0;
+   }
+   result.fBranches = std::move(branchResults);
+   return result;
+}
+
+ByteData ReadSpeed::ReadNTuple(const std::string &fileName, const std::string &ntupleName,
+                               const std::vector<std::string> &fieldNames, EntryRange range, bool breakdown)
+{
+#ifdef R__HAS_ROOT7
+   const auto source = OpenPageSource(fileName, ntupleName);
+   return ReadNTupleFields(*source, fieldNames, range, breakdown);
+#else
+   (void)fileName;
+   (void)ntupleName;
+   (void)fieldNames;
+   (void)range;
+   (void)breakdown;
+   throw std::runtime_error("ROOT was built without RNTuple support (root7).");
+#endif
 }
 
 Result ReadSpeed::EvalThroughputST(const Data &d)
 {
    auto treeIdx = 0;
    auto fileIdx = 0;
-   ULong64_t uncompressedBytesRead = 0;
-   ULong64_t compressedBytesRead = 0;
+   std::vector<ByteData> fileByteData;
 
    TStopwatch sw;
    const auto fileBranchNames = GetPerFileBranchNames(d);
 
    for (const auto &fileName : d.fFileNames) {
-      auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
-      if (f == nullptr || f->IsZombie())
-         throw std::runtime_error("Could not open file '" + fileName + '\'');
-
-      sw.Start(kFALSE);
+      if (d.fUseRNTuple) {
+         sw.Start(kFALSE);
+         fileByteData.emplace_back(
+            ReadNTuple(fileName, d.fTreeNames[treeIdx], fileBranchNames[fileIdx], {-1, -1}, d.fBreakdown));
+      } else {
+         auto f = std::unique_ptr<TFile>(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
+         if (f == nullptr || f->IsZombie())
+            throw std::runtime_error("Could not open file '" + fileName + '\'');
 
-      const auto byteData = ReadTree(f.get(), d.fTreeNames[treeIdx], fileBranchNames[fileIdx]);
-      uncompressedBytesRead += byteData.fUncompressedBytesRead;
-      compressedBytesRead += byteData.fCompressedBytesRead;
+         sw.Start(kFALSE);
+         fileByteData.emplace_back(
+            ReadTree(f.get(), d.fTreeNames[treeIdx], fileBranchNames[fileIdx], {-1, -1}, d.fBreakdown));
+      }
 
       if (d.fTreeNames.size() > 1)
          ++treeIdx;
@@ -193,7 +466,19 @@ Result ReadSpeed::EvalThroughputST(const Data &d)
       sw.Stop();
    }
 
-   return {sw.RealTime(), sw.CpuTime(), 0., 0., uncompressedBytesRead, compressedBytesRead, 0};
+   auto byteData = SumBytes(fileByteData);
+   Result result{sw.RealTime(),
+                 sw.CpuTime(),
+                 0.,
+                 0.,
+                 byteData.fUncompressedBytesRead,
+                 byteData.fCompressedBytesRead,
+                 0};
+   result.fIOTime = byteData.fIOTime;
+   result.fUnzipTime = byteData.fUnzipTime;
+   result.fReadTime = byteData.fReadTime;
+   result.fBranches = std::move(byteData.fBranches);
+   return result;
 }
 
 // Return a vector of EntryRanges per file, i.e. a vector of vectors of EntryRanges with outer size equal to
@@ -204,6 +489,24 @@ std::vector<std::vector<EntryRange>> ReadSpeed::GetClusters(const Data &d)
    std::vector<std::vector<EntryRange>> ranges(nFiles);
    for (auto fileIdx = 0u; fileIdx < nFiles; ++fileIdx) {
       const auto &fileName = d.fFileNames[fileIdx];
+      if (d.fUseRNTuple) {
+#ifdef R__HAS_ROOT7
+         const auto &ntupleName = d.fTreeNames.size() > 1 ? d.fTreeNames[fileIdx] : d.fTreeNames[0];
+         const auto source = OpenPageSource(fileName, ntupleName);
+         const auto descGuard = source->GetSharedDescriptorGuard();
+         std::vector<EntryRange> rangesInFile;
+         for (const auto &cluster : descGuard->GetClusterIterable()) {
+            const auto start = static_cast<Long64_t>(cluster.GetFirstEntryIndex());
+            rangesInFile.emplace_back(EntryRange{start, start + static_cast<Long64_t>(cluster.GetNEntries())});
+         }
+         std::sort(rangesInFile.begin(), rangesInFile.end(),
+                   [](const EntryRange &a, const EntryRange &b) { return a.fStart < b.fStart; });
+         ranges[fileIdx] = std::move(rangesInFile);
+         continue;
+#else
+         throw std::runtime_error("ROOT was built without RNTuple support (root7).");
+#endif
+      }
       std::unique_ptr<TFile> f(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
       if (f == nullptr || f->IsZombie())
          throw std::runtime_error("There was a problem opening file '" + fileName + '\'');
@@ -284,13 +587,15 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
 
    const size_t nranges =
       std::accumulate(rangesPerFile.begin(), rangesPerFile.end(), 0u, [](size_t s, auto &r) { return s + r.size(); });
-   std::cout << "Total number of tasks: " << nranges << '\n';
 
    const auto fileBranchNames = GetPerFileBranchNames(d);
 
    ROOT::Internal::RSlotStack slotStack(actualThreads);
    std::vector<int> lastFileIdxs(actualThreads, -1);
    std::vector<std::unique_ptr<TFile>> lastTFiles(actualThreads);
+#ifdef R__HAS_ROOT7
+   std::vector<std::unique_ptr<RPageSource>> lastSources(actualThreads);
+#endif
 
    auto processFile = [&](int fileIdx) {
       const auto &fileName = d.fFileNames[fileIdx];
@@ -303,6 +608,17 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
          auto &file = lastTFiles[slotIndex];
          auto &lastIndex = lastFileIdxs[slotIndex];
 
+#ifdef R__HAS_ROOT7
+         if (d.fUseRNTuple) {
+            auto &source = lastSources[slotIndex];
+            if (lastIndex != fileIdx) {
+               source = OpenPageSource(fileName, treeName);
+               lastIndex = fileIdx;
+            }
+            return ReadNTupleFields(*source, branchNames, range, d.fBreakdown);
+         }
+#endif
+
          if (lastIndex != fileIdx) {
             file.reset(TFile::Open(fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION"));
             lastIndex = fileIdx;
@@ -311,7 +627,7 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
          if (file == nullptr || file->IsZombie())
             throw std::runtime_error("Could not open file '" + fileName + '\'');
 
-         auto result = ReadTree(file.get(), treeName, branchNames, range);
+         auto result = ReadTree(file.get(), treeName, branchNames, range, d.fBreakdown);
 
          return result;
       };
@@ -323,16 +639,22 @@ Result ReadSpeed::EvalThroughputMT(const Data &d, unsigned nThreads)
 
    TStopwatch sw;
    sw.Start();
-   const auto totalByteData = pool.MapReduce(processFile, ROOT::TSeqUL(d.fFileNames.size()), SumBytes);
+   auto totalByteData = pool.MapReduce(processFile, ROOT::TSeqUL(d.fFileNames.size()), SumBytes);
    sw.Stop();
 
-   return {sw.RealTime(),
-           sw.CpuTime(),
-           clsw.RealTime(),
-           clsw.CpuTime(),
-           totalByteData.fUncompressedBytesRead,
-           totalByteData.fCompressedBytesRead,
-           actualThreads};
+   Result result{sw.RealTime(),
+                 sw.CpuTime(),
+                 clsw.RealTime(),
+                 clsw.CpuTime(),
+                 totalByteData.fUncompressedBytesRead,
+                 totalByteData.fCompressedBytesRead,
+                 actualThreads};
+   result.fIOTime = totalByteData.fIOTime;
+   result.fUnzipTime = totalByteData.fUnzipTime;
+   result.fReadTime = totalByteData.fReadTime;
+   result.fNTasks = nranges;
+   result.fBranches = std::move(totalByteData.fBranches);
+   return result;
 #else
    (void)d;
    (void)nThreads;
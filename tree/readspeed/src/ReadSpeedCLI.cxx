@@ -14,18 +14,22 @@
 #include <ROOT/TTreeProcessorMT.hxx> // for TTreeProcessorMT::SetTasksPerWorkerHint
 #endif
 
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 #include <cstring>
+#include <limits>
 
 using namespace ReadSpeed;
 
 const auto usageText = "Usage:\n"
                        " rootreadspeed --files fname1 [fname2 ...]\n"
-                       "               --trees tname1 [tname2 ...]\n"
+                       "               (--trees tname1 [tname2 ...] | --ntuples nname1 [nname2 ...])\n"
                        "               (--all-branches | --branches bname1 [bname2 ...] | --branches-regex bregex1 "
                        "[bregex2 ...])\n"
                        "               [--threads nthreads]\n"
                        "               [--tasks-per-worker ntasks]\n"
+                       "               [--breakdown] [--json]\n"
                        " rootreadspeed (--help|-h)\n"
                        " \n"
                        " Use -h for usage help, --help for detailed information.\n";
@@ -42,6 +46,11 @@ const auto argUsageText =
    "    respective file."
    "\n"
    "\n"
+   "   --ntuples nname1 [nname2...]\n"
+   "    The list of RNTuples to read from the files, instead of trees. The same rules as for --trees apply,"
+   "    and the branch options select the top-level fields of the RNTuples."
+   "\n"
+   "\n"
    " Specifying branches:\n"
    "  Branches can be specified using one of the following flags. Currently only one can be used"
    "  at a time.\n"
@@ -62,7 +71,15 @@ const auto argUsageText =
    "    available threads on the machine."
    "\n"
    "   --tasks-per-worker ntasks\n"
-   "    The number of tasks to generate for each worker thread when using multithreading.";
+   "    The number of tasks to generate for each worker thread when using multithreading."
+   "\n"
+   "\n"
+   " Output arguments:\n"
+   "   --breakdown\n"
+   "    Measure and print the data read and the time spent for each branch or field."
+   "\n"
+   "   --json\n"
+   "    Print the results as a JSON object instead of text.";
 
 const auto fullUsageText =
    "Description:\n"
@@ -83,6 +100,14 @@ const auto fullUsageText =
    " decompression time) in the uncompressed and compressed cases."
    "\n"
    "\n"
+   "Time breakdown:\n"
+   " The time spent reading the values is split into the time spent waiting for reads from storage"
+   " ('I/O time'), the time spent decompressing ('Unzip time') and the rest, mostly spent deserializing"
+   " the values ('Deserialization time'). These times are summed over all threads, so they are comparable"
+   " to the 'CPU Time' rather than to the 'Real Time'. With --breakdown the data read and the time spent"
+   " are also given per branch, pointing to the branches that dominate the reading."
+   "\n"
+   "\n"
    "Interpreting results:\n"
    " \n"
    " There are three possible scenarios when using rootreadspeed, namely:"
@@ -149,6 +174,8 @@ const auto fullUsageText =
 void ReadSpeed::PrintThroughput(const Result &r)
 {
    std::cout << "Thread pool size:\t\t" << r.fThreadPoolSize << '\n';
+   if (r.fNTasks > 0)
+      std::cout << "Total number of tasks:\t\t" << r.fNTasks << '\n';
 
    if (r.fMTSetupRealTime > 0.) {
       std::cout << "Real time to setup MT run:\t" << r.fMTSetupRealTime << " s\n";
@@ -170,6 +197,21 @@ void ReadSpeed::PrintThroughput(const Result &r)
    std::cout << "\t\t\t\t" << r.fCompressedBytesRead / r.fRealTime / 1024 / 1024 / effectiveThreads
              << " MB/s/thread for " << effectiveThreads << " threads\n\n";
 
+   if (r.fReadTime > 0.) {
+      std::cout << "I/O time:\t\t\t" << r.fIOTime << " s\n";
+      std::cout << "Unzip time:\t\t\t" << r.fUnzipTime << " s\n";
+      std::cout << "Deserialization time:\t\t" << std::max(0., r.fReadTime - r.fIOTime - r.fUnzipTime) << " s\n\n";
+   }
+
+   if (!r.fBranches.empty()) {
+      std::cout << "Branch\tUncompressed bytes\tCompressed bytes\tTime (s)\n";
+      for (const auto &b : r.fBranches) {
+         std::cout << b.fName << '\t' << b.fUncompressedBytesRead << '\t' << b.fCompressedBytesRead << '\t'
+                   << b.fRealTime << '\n';
+      }
+      std::cout << '\n';
+   }
+
    const float cpuEfficiency = (r.fCpuTime / effectiveThreads) / r.fRealTime;
 
    std::cout << "CPU Efficiency: \t\t" << (cpuEfficiency * 100) << "%\n";
@@ -184,6 +226,56 @@ void ReadSpeed::PrintThroughput(const Result &r)
    std::cout << "For details run with the --help command.\n";
 }
 
+namespace {
+std::string JSONString(const std::string &s)
+{
+   std::string escaped = "\"";
+   for (const char c : s) {
+      switch (c) {
+      case '"': escaped += "\\\""; break;
+      case '\\': escaped += "\\\\"; break;
+      case '\n': escaped += "\\n"; break;
+      case '\t': escaped += "\\t"; break;
+      default:
+         if (static_cast<unsigned char>(c) < 0x20) {
+            char buf[7];
+            snprintf(buf, sizeof(buf), "\\u%04x", c);
+            escaped += buf;
+         } else {
+            escaped += c;
+         }
+      }
+   }
+   return escaped + '"';
+}
+} // anonymous namespace
+
+void ReadSpeed::PrintThroughputJSON(const Result &r, std::ostream &os)
+{
+   const auto precision = os.precision(std::numeric_limits<double>::max_digits10);
+   os << "{\n"
+      << "  \"threadPoolSize\": " << r.fThreadPoolSize << ",\n"
+      << "  \"nTasks\": " << r.fNTasks << ",\n"
+      << "  \"realTime\": " << r.fRealTime << ",\n"
+      << "  \"cpuTime\": " << r.fCpuTime << ",\n"
+      << "  \"mtSetupRealTime\": " << r.fMTSetupRealTime << ",\n"
+      << "  \"mtSetupCpuTime\": " << r.fMTSetupCpuTime << ",\n"
+      << "  \"uncompressedBytesRead\": " << r.fUncompressedBytesRead << ",\n"
+      << "  \"compressedBytesRead\": " << r.fCompressedBytesRead << ",\n"
+      << "  \"ioTime\": " << r.fIOTime << ",\n"
+      << "  \"unzipTime\": " << r.fUnzipTime << ",\n"
+      << "  \"readTime\": " << r.fReadTime << ",\n"
+      << "  \"branches\": [";
+   for (std::size_t i = 0; i < r.fBranches.size(); ++i) {
+      const auto &b = r.fBranches[i];
+      os << (i == 0 ? "\n" : ",\n") << "    {\"name\": " << JSONString(b.fName)
+         << ", \"uncompressedBytesRead\": " << b.fUncompressedBytesRead
+         << ", \"compressedBytesRead\": " << b.fCompressedBytesRead << ", \"realTime\": " << b.fRealTime << "}";
+   }
+   os << (r.fBranches.empty() ? "]\n" : "\n  ]\n") << "}\n";
+   os.precision(precision);
+}
+
 Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 {
    // Print help message and exit if "--help"
@@ -204,17 +296,39 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
 
    Data d;
    unsigned int nThreads = 0;
+   bool json = false;
+   bool treesUsed = false;
 
    enum class EArgState { kNone, kTrees, kFiles, kBranches, kThreads, kTasksPerWorkerHint } argState = EArgState::kNone;
    enum class EBranchState { kNone, kRegular, kRegex, kAll } branchState = EBranchState::kNone;
    const auto branchOptionsErrMsg =
       "Options --all-branches, --branches, and --branches-regex are mutually exclusive. You can use only one.\n";
 
+   const auto datasetOptionsErrMsg = "Options --trees and --ntuples are mutually exclusive. You can use only one.\n";
+
    for (size_t i = 1; i < args.size(); ++i) {
       const auto &arg = args[i];
 
       if (arg == "--trees") {
          argState = EArgState::kTrees;
+         if (d.fUseRNTuple) {
+            std::cerr << datasetOptionsErrMsg;
+            return {};
+         }
+         treesUsed = true;
+      } else if (arg == "--ntuples") {
+         argState = EArgState::kTrees;
+         if (treesUsed) {
+            std::cerr << datasetOptionsErrMsg;
+            return {};
+         }
+         d.fUseRNTuple = true;
+      } else if (arg == "--breakdown") {
+         argState = EArgState::kNone;
+         d.fBreakdown = true;
+      } else if (arg == "--json") {
+         argState = EArgState::kNone;
+         json = true;
       } else if (arg == "--files") {
          argState = EArgState::kFiles;
       } else if (arg == "--all-branches") {
@@ -271,7 +385,7 @@ Args ReadSpeed::ParseArgs(const std::vector<std::string> &args)
       }
    }
 
-   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true};
+   return Args{std::move(d), nThreads, branchState == EBranchState::kAll, /*fShouldRun=*/true, json};
 }
 
 Args ReadSpeed::ParseArgs(int argc, char **argv)
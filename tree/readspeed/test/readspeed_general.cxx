@@ -9,7 +9,12 @@
 #include "ReadSpeed.hxx"
 #include "ReadSpeedCLI.hxx"
 
+#include <RConfigure.h> // for R__USE_IMT; R__HAS_ROOT7 is defined by CMake for root7 builds
 #include <ROOT/TestSupport.hxx>
+#ifdef R__HAS_ROOT7
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTuple.hxx>
+#endif
 #ifdef R__USE_IMT
 #include "ROOT/TTreeProcessorMT.hxx" // for TTreeProcessorMT::GetTasksPerWorkerHint
 #endif
@@ -18,6 +23,8 @@
 #include "TSystem.h"
 #include "TTree.h"
 
+#include <sstream>
+
 using namespace ReadSpeed;
 
 // Helper function to generate a .root file with some dummy data in it.
@@ -86,6 +93,64 @@ TEST_F(ReadSpeedIntegration, MultiThread)
 }
 #endif
 
+TEST_F(ReadSpeedIntegration, Breakdown)
+{
+   Data d{{"t"}, {"readspeedinput1.root", "readspeedinput2.root"}, {"x"}};
+   d.fBreakdown = true;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fUncompressedBytesRead, 80000000) << "Wrong number of uncompressed bytes read";
+   ASSERT_EQ(result.fBranches.size(), 1u) << "Wrong number of per-branch results";
+   EXPECT_EQ(result.fBranches[0].fName, "x");
+   EXPECT_EQ(result.fBranches[0].fUncompressedBytesRead, 80000000) << "Wrong number of uncompressed bytes for x";
+   EXPECT_GT(result.fBranches[0].fCompressedBytesRead, 0u);
+   EXPECT_LT(result.fBranches[0].fCompressedBytesRead, result.fBranches[0].fUncompressedBytesRead);
+   EXPECT_GT(result.fReadTime, 0.);
+   EXPECT_GT(result.fUnzipTime, 0.);
+   EXPECT_LE(result.fIOTime + result.fUnzipTime, result.fReadTime);
+}
+
+#ifdef R__HAS_ROOT7
+TEST(ReadSpeedNTuple, SingleThread)
+{
+   const auto fileName = "readspeedinput_ntuple.root";
+   {
+      auto model = ROOT::Experimental::RNTupleModel::Create();
+      auto x = model->MakeField<int>("x", 42);
+      model->MakeField<float>("y", 1.f);
+      auto writer = ROOT::Experimental::RNTupleWriter::Recreate(std::move(model), "ntuple", fileName);
+      for (int i = 0; i < 1000000; ++i)
+         writer->Fill();
+   }
+
+   Data d{{"ntuple"}, {fileName}, {"x"}};
+   d.fUseRNTuple = true;
+   d.fBreakdown = true;
+   const auto result = EvalThroughput(d, 0);
+
+   EXPECT_EQ(result.fUncompressedBytesRead, 4000000) << "Wrong number of uncompressed bytes read";
+   EXPECT_GT(result.fCompressedBytesRead, 0u);
+   ASSERT_EQ(result.fBranches.size(), 1u) << "Wrong number of per-field results";
+   EXPECT_EQ(result.fBranches[0].fName, "x");
+
+   d.fBranchNames = {".*"};
+   d.fUseRegex = true;
+   EXPECT_EQ(EvalThroughput(d, 0).fUncompressedBytesRead, 8000000) << "Wrong number of uncompressed bytes read";
+
+#ifdef R__USE_IMT
+   d.fBranchNames = {"x"};
+   d.fUseRegex = false;
+   EXPECT_EQ(EvalThroughput(d, 2).fUncompressedBytesRead, 4000000) << "Wrong number of uncompressed bytes read";
+#endif
+
+   d.fBranchNames = {"z"};
+   d.fUseRegex = false;
+   EXPECT_THROW(EvalThroughput(d, 0), std::runtime_error) << "Should throw for non-existent field";
+
+   gSystem->Unlink(fileName);
+}
+#endif
+
 TEST_F(ReadSpeedIntegration, NonExistentFile)
 {
    ROOT::TestSupport::CheckDiagsRAII diag;
@@ -144,6 +209,19 @@ TEST_F(ReadSpeedIntegration, AllBranches)
    EXPECT_EQ(result.fCompressedBytesRead, 1316837) << "Wrong number of compressed bytes read";
 }
 
+TEST(ReadSpeedCLI, JSON)
+{
+   Result r{1., 2., 0., 0., 100, 10, 0};
+   r.fBranches.push_back({"x\"y", 100, 10, 0.5});
+   std::stringstream os;
+   PrintThroughputJSON(r, os);
+   const auto json = os.str();
+
+   EXPECT_NE(json.find("\"realTime\": 1,"), std::string::npos) << json;
+   EXPECT_NE(json.find("\"uncompressedBytesRead\": 100,"), std::string::npos) << json;
+   EXPECT_NE(json.find("{\"name\": \"x\\\"y\""), std::string::npos) << json;
+}
+
 TEST(ReadSpeedCLI, CheckFilenames)
 {
    const std::vector<std::string> baseArgs{"root-readspeed", "--trees", "t", "--branches", "x", "--files"};
@@ -272,6 +350,26 @@ TEST(ReadSpeedCLI, MultipleThreads)
    EXPECT_EQ(parsedArgs.fNThreads, threads) << "Program not using the correct amount of threads";
 }
 
+TEST(ReadSpeedCLI, NTuplesAndOutput)
+{
+   const std::vector<std::string> allArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--ntuples", "n", "--branches", "x", "--breakdown", "--json",
+   };
+
+   const auto parsedArgs = ParseArgs(allArgs);
+
+   EXPECT_TRUE(parsedArgs.fShouldRun) << "Program not running when given valid arguments";
+   EXPECT_TRUE(parsedArgs.fData.fUseRNTuple) << "Program not reading RNTuples when it should";
+   EXPECT_EQ(parsedArgs.fData.fTreeNames, std::vector<std::string>{"n"}) << "List of parsed RNTuples is wrong";
+   EXPECT_TRUE(parsedArgs.fData.fBreakdown) << "Program not measuring per-branch times when it should";
+   EXPECT_TRUE(parsedArgs.fJSON) << "Program not printing JSON when it should";
+
+   const std::vector<std::string> bothArgs{
+      "root-readspeed", "--files", "doesnotexist.root", "--ntuples", "n", "--trees", "t", "--branches", "x",
+   };
+   EXPECT_TRUE(!ParseArgs(bothArgs).fShouldRun) << "Program running with both --trees and --ntuples";
+}
+
 #ifdef R__USE_IMT
 TEST(ReadSpeedCLI, WorkerThreadsHint)
 {
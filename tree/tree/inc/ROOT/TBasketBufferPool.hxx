@@ -0,0 +1,73 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TBasketBufferPool
+#define ROOT_TBasketBufferPool
+
+#include "Rtypes.h"
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+class TBuffer;
+
+namespace ROOT {
+namespace Internal {
+
+/**
+\class ROOT::Internal::TBasketBufferPool
+\ingroup tree
+\brief A per-thread pool of the buffers of the baskets, reused instead of reallocated.
+
+The buffers of the baskets dropped or deleted while reading, and the transient buffers of the deleted branches and
+trees, are given back to the pool of the thread. The next basket, branch or tree which needs a buffer takes the
+smallest pooled buffer large enough, or expands the largest one, instead of allocating a new buffer. As the buffers are
+only expanded, the pool converges to the sizes of the largest baskets of the clusters read by the thread. This avoids
+the allocations of every basket read when the trees are created per task, e.g. by TTreeProcessorMT, or when the
+baskets of several clusters are retained. The pool of a thread holds at most kMaxBuffers buffers and GetMaxSize()
+bytes; the pool is disabled if the maximum size is 0.
+*/
+class TBasketBufferPool {
+   std::vector<TBuffer *> fBuffers; ///< The pooled buffers
+   Long64_t fSize = 0;              ///< Total size of the pooled buffers in bytes
+   Long64_t fNReused = 0;           ///< Number of buffers taken from the pool
+
+   static std::atomic<Long64_t> fgMaxSize; ///< Maximum total size of the pool of each thread in bytes
+
+   TBasketBufferPool() = default;
+   /// The pool of the calling thread, nullptr once it is destroyed
+   static TBasketBufferPool *ThreadLocal();
+
+public:
+   static constexpr std::size_t kMaxBuffers = 32;
+
+   TBasketBufferPool(const TBasketBufferPool &) = delete;
+   TBasketBufferPool &operator=(const TBasketBufferPool &) = delete;
+   ~TBasketBufferPool();
+
+   /// A pooled buffer of at least `size` bytes, or the largest pooled buffer if none is large enough, or nullptr if
+   /// the pool of the thread is empty. The buffer belongs to the caller, its size is not adjusted.
+   static TBuffer *Acquire(Int_t size);
+   /// Give a buffer to the pool of the thread; it is deleted if it cannot be pooled.
+   static void Release(TBuffer *buffer);
+   /// Delete the buffers of the pool of the thread
+   static void Clear();
+
+   static void SetMaxSize(Long64_t maxSize) { fgMaxSize = maxSize; }
+   static Long64_t GetMaxSize() { return fgMaxSize; }
+   /// Total size in bytes of the pool of the thread
+   static Long64_t GetSize();
+   /// Number of buffers taken from the pool of the thread so far
+   static Long64_t GetNReused();
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,104 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TDecompressedBasketCache
+#define ROOT_TDecompressedBasketCache
+
+#include "Rtypes.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+class TFile;
+
+namespace ROOT {
+namespace Experimental {
+
+/**
+\class ROOT::Experimental::TDecompressedBasketCache
+\ingroup tree
+\brief A process-wide cache of decompressed baskets, shared by all the trees reading the same files.
+
+When enabled, the decompressed content of every basket read from a file opened read-only is kept in memory, keyed by
+the UUID of the file and the position of the basket in it. Reading the same basket again, from any tree, reader or
+RDataFrame of the process, copies it from the cache instead of reading and decompressing it. The least recently used
+baskets are evicted when the cache exceeds its maximum size.
+
+This is useful when the same dataset is read several times in a process, e.g. when an analysis is iterated in a
+notebook:
+~~~{.cpp}
+ROOT::Experimental::TDecompressedBasketCache::Enable(2000000000); // up to 2 GB of decompressed baskets
+ROOT::RDataFrame df("Events", "file.root");
+df.Histo1D("pt"); // the first event loop reads and decompresses the baskets of "pt"
+df.Filter("pt > 10").Count(); // this one finds them in the cache
+~~~
+The cache is disabled by default.
+*/
+class TDecompressedBasketCache {
+   struct RKey {
+      std::array<UChar_t, 16> fUUID;
+      Long64_t fSeek;
+      bool operator==(const RKey &other) const { return fSeek == other.fSeek && fUUID == other.fUUID; }
+   };
+   struct RKeyHash {
+      std::size_t operator()(const RKey &key) const;
+   };
+   struct REntry {
+      RKey fKey;
+      std::shared_ptr<const char> fBuffer;
+      Int_t fSize;
+   };
+
+   std::atomic<Long64_t> fMaxSize{0}; ///< Maximum total size of the cached baskets in bytes, 0 if disabled
+   Long64_t fSize = 0;                ///< Total size of the cached baskets in bytes
+   std::atomic<Long64_t> fNHits{0};   ///< Number of baskets found in the cache
+   std::atomic<Long64_t> fNMisses{0}; ///< Number of baskets looked up and not found in the cache
+   std::list<REntry> fEntries;        ///< The cached baskets, the most recently used first
+   std::unordered_map<RKey, std::list<REntry>::iterator, RKeyHash> fIndex; ///< Where each basket is in fEntries
+   std::mutex fMutex;                 ///< Protects fSize, fEntries and fIndex
+
+   TDecompressedBasketCache() = default;
+   static TDecompressedBasketCache &Instance();
+   static bool MakeKey(TFile &file, Long64_t seek, RKey &key);
+   void EvictUntil(Long64_t size);
+
+public:
+   TDecompressedBasketCache(const TDecompressedBasketCache &) = delete;
+   TDecompressedBasketCache &operator=(const TDecompressedBasketCache &) = delete;
+
+   /// Enable the cache, with a maximum size in bytes
+   static void Enable(Long64_t maxSize = 512 * 1024 * 1024);
+   /// Disable the cache and free its content
+   static void Disable() { Enable(0); }
+   static bool IsEnabled() { return Instance().fMaxSize.load(std::memory_order_relaxed) > 0; }
+   /// The cache, if it is enabled, nullptr otherwise
+   static TDecompressedBasketCache *Get() { return IsEnabled() ? &Instance() : nullptr; }
+
+   /// Return a copy of the decompressed basket at position `seek` of `file` in a buffer allocated with new[],
+   /// or nullptr if it is not in the cache; `size` is set to the size of the buffer.
+   char *Find(TFile &file, Long64_t seek, Int_t &size);
+   /// Add a copy of the `size` bytes of the decompressed basket at position `seek` of `file` to the cache
+   void Insert(TFile &file, Long64_t seek, const char *buffer, Int_t size);
+   /// Remove all the baskets from the cache and reset its statistics
+   void Clear();
+
+   Long64_t GetMaxSize() const { return fMaxSize.load(std::memory_order_relaxed); }
+   Long64_t GetSize();
+   Long64_t GetNHits() const { return fNHits.load(std::memory_order_relaxed); }
+   Long64_t GetNMisses() const { return fNMisses.load(std::memory_order_relaxed); }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
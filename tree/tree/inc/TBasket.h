@@ -58,6 +58,10 @@ private:
    void   DisownBuffer();
    void   AdoptBuffer(TBuffer *user_buffer);
 
+   // The two steps of WriteBuffer(); TBranch runs them separately to compress the basket in another thread.
+   Int_t  CompressBuffer(TFile *file, Int_t cycle, Bool_t &compressed);
+   Int_t  WriteCompressedBuffer(TFile *file, Int_t nout, Bool_t compressed);
+
 protected:
    Int_t       fBufferSize{0};                    ///< fBuffer length in bytes
    Int_t       fNevBufSize{0};                    ///< Length in Int_t of fEntryOffset OR fixed length of each entry if fEntryOffset is null!
@@ -31,6 +31,9 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <atomic>
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -50,6 +53,7 @@ class TBulkBranchRead;
 }
 namespace Internal {
 class TBranchIMTHelper; ///< A helper class for managing IMT work during TTree:Fill operations.
+class TAsyncBasketWriter; ///< Compresses the baskets filled by TTree::Fill asynchronously.
 }
 }
 
@@ -76,8 +80,12 @@ public:
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    /// See TBranch::GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
+   /// See TBranch::GetBulkCollectionEntries(Long64_t evt, TBuffer &user_buf, TBuffer &offset_buf);
+   Int_t GetBulkCollectionEntries(Long64_t evt, TBuffer &user_buf, TBuffer &offset_buf);
    /// Return true if the branch can be read through the bulk interfaces.
    Bool_t SupportsBulkRead() const;
+   /// Return true if the branch can be read through GetBulkCollectionEntries().
+   Bool_t SupportsBulkCollectionRead();
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -94,11 +102,13 @@ class TBranch : public TNamed, public TAttFill {
    using TIOFeatures = ROOT::TIOFeatures;
 
 protected:
+   friend class TBasket;
    friend class TTreeCache;
    friend class TTreeCloner;
    friend class TTree;
    friend class TBranchElement;
    friend class ROOT::Experimental::Internal::TBulkBranchRead;
+   friend class ROOT::Internal::TAsyncBasketWriter;
 
    /// TBranch status bits
    enum EStatusBits {
@@ -157,6 +167,13 @@ protected:
    using CacheInfo_t = ROOT::Internal::TBranchCacheInfo;
    CacheInfo_t fCacheInfo;        ///<! Hold info about which basket are in the cache and if they have been retrieved from the cache.
 
+   struct RDictionaryTrainer;
+   std::vector<char> fCompressionDictionary;          ///<  ZSTD dictionary the baskets are compressed with, empty if none
+   std::atomic<UInt_t> fCompressionDictionaryID{0};   ///<! ID of fCompressionDictionary in the registry of RZip, 0 if none
+   RDictionaryTrainer *fDictionaryTrainer{nullptr};   ///<! Collects the baskets to train fCompressionDictionary from
+   struct RCompressionTuner;
+   RCompressionTuner *fCompressionTuner{nullptr};     ///<! Collects the baskets to select the compression settings from
+
    typedef void (TBranch::*ReadLeaves_t)(TBuffer &b);
    ReadLeaves_t fReadLeaves;      ///<! Pointer to the ReadLeaves implementation to use.
    typedef void (TBranch::*FillLeaves_t)(TBuffer &b);
@@ -175,8 +192,12 @@ protected:
    Int_t    WriteBasket(TBasket* basket, Int_t where) { return WriteBasketImpl(basket, where, nullptr); }
 
    TString  GetRealFileName() const;
+   UInt_t   GetBasketCompressionDictionary(const char *buffer, Int_t size);
+   Int_t    GetBasketCompressionSettings(const char *buffer, Int_t size);
+   void     RegisterCompressionDictionary();
 
    virtual void SetAddressImpl(void *addr, Bool_t /* implied */) { SetAddress(addr); }
+   virtual Bool_t GetBulkCollectionLayout(EDataType &type, Bool_t &hasHeader);
 
 private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
@@ -184,8 +205,12 @@ private:
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
+   Int_t    GetBulkCollectionEntries(Long64_t, TBuffer&, TBuffer&);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   Int_t    WriteBasketAsync(TBasket* basket, Int_t where, ROOT::Internal::TAsyncBasketWriter &writer);
+   Int_t    WriteCompressedBasket(TBasket* basket, Int_t where, Int_t nout, Bool_t compressed);
+   Int_t    FinishBasketWrite(TBasket* basket, Int_t where, Int_t nout);
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
 
@@ -201,6 +226,8 @@ public:
            void      Browse(TBrowser *b) override;
    virtual void      DeleteBaskets(Option_t* option="");
    virtual void      DropBaskets(Option_t *option = "");
+           void      EnableCompressionDictionary(Int_t nbaskets = ROOT::RCompressionSetting::EDictionary::kDefaultTrainingBaskets);
+           void      EnableCompressionTuning(Double_t minReadSpeed = 0, Int_t nbaskets = ROOT::RCompressionSetting::ETuning::kDefaultTrialBaskets);
            void      ExpandBasketArrays();
            Int_t     Fill() { return FillImpl(nullptr); }
    virtual Int_t     FillImpl(ROOT::Internal::TBranchIMTHelper *);
@@ -221,6 +248,7 @@ public:
            Int_t     GetCompressionAlgorithm() const;
            Int_t     GetCompressionLevel() const;
            Int_t     GetCompressionSettings() const;
+   const std::vector<char> &GetCompressionDictionary() const { return fCompressionDictionary; }
    TDirectory       *GetDirectory() const {return fDirectory;}
    virtual Int_t     GetEntry(Long64_t entry=0, Int_t getall = 0);
    virtual Int_t     GetEntryExport(Long64_t entry, Int_t getall, TClonesArray *list, Int_t n);
@@ -287,12 +315,13 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree; }
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           Bool_t    SupportsBulkCollectionRead();
    virtual void      UpdateAddress() {}
    virtual void      UpdateFile();
 
    static  void      ResetCount();
 
-   ClassDefOverride(TBranch, 13); // Branch descriptor
+   ClassDefOverride(TBranch, 14); // Branch descriptor
 };
 
 //______________________________________________________________________________
@@ -320,7 +349,9 @@ namespace Internal {
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
+inline Int_t  TBulkBranchRead::GetBulkCollectionEntries(Long64_t evt, TBuffer& user_buf, TBuffer& offset_buf) { return fParent.GetBulkCollectionEntries(evt, user_buf, offset_buf); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsBulkCollectionRead() { return fParent.SupportsBulkCollectionRead(); }
 
 }  // Internal
 }  // Experimental
@@ -146,6 +146,7 @@ protected:
    void SetReadActionSequence();
    void SetupAddressesImpl();
    void SetAddressImpl(void *addr, Bool_t implied) override;
+   Bool_t GetBulkCollectionLayout(EDataType &type, Bool_t &hasHeader) override;
 
    void FillLeavesImpl(TBuffer& b);
    void FillLeavesMakeClass(TBuffer& b);
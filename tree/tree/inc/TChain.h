@@ -52,6 +52,7 @@ private:
    ParseTreeFilename(const char *name, TString &filename, TString &treename, TString &query, TString &suffix) const;
 
 protected:
+   void FetchNumberOfEntries();
    void InvalidateCurrentTree();
    void ReleaseChainProof();
 
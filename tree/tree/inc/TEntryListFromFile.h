@@ -62,6 +62,8 @@ public:
    ~TEntryListFromFile() override;
    void        Add(const TEntryList * /* elist */) override {};
    Int_t       Contains(Long64_t /* entry */, TTree * /* tree = 0 */) override { return 0; };
+   /// The sub-lists are only loaded when iterating, so any range may contain entries
+   Bool_t      ContainsRange(Long64_t /* first */, Long64_t /* last */) override { return kTRUE; }
    Bool_t      Enter(Long64_t /* entry */, TTree * /* tree = 0 */) override { return kFALSE; };
    Bool_t      Enter(Long64_t /* entry */, const char * /* treename */, const char * /* filename */) override { return kFALSE; };
    TEntryList *GetCurrentList() const override { return fCurrent; };
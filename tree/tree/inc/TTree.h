@@ -159,10 +159,19 @@ private:
    mutable Bool_t fIMTFlush{false};               ///<! True if we are doing a multithreaded flush.
    mutable std::atomic<Long64_t> fIMTTotBytes;    ///<! Total bytes for the IMT flush baskets
    mutable std::atomic<Long64_t> fIMTZipBytes;    ///<! Zip bytes for the IMT flush baskets.
+   Long64_t fAsyncCompressionBudget{0};           ///<! Memory budget of the baskets compressed after Fill() returns, see SetAsyncCompression()
+   ROOT::Internal::TAsyncBasketWriter *fAsyncBasketWriter{nullptr}; ///<! Owned, created by the first Fill() with IMT and a budget
+   Int_t fAdaptiveBasketZipBytes{0};              ///<! Target compressed size of the baskets, see SetAdaptiveBasketSizes()
+   Long64_t fAdaptiveClusterZipBytes{0};          ///<! Target compressed size of the clusters, see SetAdaptiveBasketSizes()
+   Long64_t fAdaptiveEntries{0};                  ///<! Number of entries at the last AdaptBasketSizes()
+   Long64_t fAdaptiveZipBytes{0};                 ///<! Compressed bytes at the last AdaptBasketSizes()
+   std::vector<std::array<Long64_t, 3>> fAdaptiveLeafBytes; ///<! Entries, total and compressed bytes of the branch of each leaf at the last AdaptBasketSizes()
 
    void             InitializeBranchLists(bool checkLeafCount);
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
+   Int_t            FinishAsyncBasketWrites() const;
+   void             AdaptBasketSizes();
    void             MarkEventCluster();
    Long64_t         GetMedianClusterSize();
 
@@ -434,6 +443,8 @@ public:
    virtual void            DropBaskets();
    virtual void            DropBuffers(Int_t nbytes);
            Bool_t          EnableCache();
+           void            EnableCompressionDictionary(Int_t nbaskets = ROOT::RCompressionSetting::EDictionary::kDefaultTrainingBaskets);
+           void            EnableCompressionTuning(Double_t minReadSpeed = 0, Int_t nbaskets = ROOT::RCompressionSetting::ETuning::kDefaultTrialBaskets);
    virtual Int_t           Fill();
    virtual TBranch        *FindBranch(const char* name);
    virtual TLeaf          *FindLeaf(const char* name);
@@ -444,6 +455,7 @@ public:
 #ifdef R__TRACK_BASKET_ALLOC_TIME
            ULong64_t       GetAllocationTime() const { return fAllocationTime; }
 #endif
+           Long64_t        GetAsyncCompression() const { return fAsyncCompressionBudget; }
    virtual Long64_t        GetAutoFlush() const {return fAutoFlush;}
    virtual Long64_t        GetAutoSave()  const {return fAutoSave;}
    virtual TBranch        *GetBranch(const char* name);
@@ -543,6 +555,7 @@ public:
    virtual Double_t       *GetW()    { return GetPlayer()->GetW(); }
    virtual Double_t        GetWeight() const   { return fWeight; }
    virtual Long64_t        GetZipBytes() const { return fZipBytes; }
+           Long64_t        ImportBaskets(TTree *fromtree, Long64_t seekOffset);
    virtual void            IncrementTotalBuffers(Int_t nbytes) { fTotalBuffers += nbytes; }
            Bool_t          IsFolder() const override { return kTRUE; }
    virtual Bool_t          InPlaceClone(TDirectory *newdirectory, const char *options = "");
@@ -579,6 +592,8 @@ public:
    virtual void            ResetBranchAddresses();
    virtual Long64_t        Scan(const char* varexp = "", const char* selection = "", Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0); // *MENU*
    virtual Bool_t          SetAlias(const char* aliasName, const char* aliasFormula);
+           void            SetAdaptiveBasketSizes(Int_t basketZipBytes = 100000, Long64_t clusterZipBytes = 30000000);
+           void            SetAsyncCompression(Long64_t maxPendingBytes = 64000000);
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
    virtual void            SetBasketSize(const char* bname, Int_t buffsize = 16000);
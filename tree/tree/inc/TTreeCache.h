@@ -27,6 +27,7 @@
 
 class TTree;
 class TBranch;
+class TEntryList;
 class TObjArray;
 
 class TTreeCache : public TFileCacheRead {
@@ -51,6 +52,7 @@ protected:
    TObjArray   *fBranches{nullptr};   ///<! List of branches to be stored in the cache
    TList       *fBrNames{nullptr};    ///<! list of branch names in the cache
    TTree       *fTree{nullptr};       ///<! pointer to the current Tree
+   TEntryList  *fEntryList{nullptr};  ///<! entries to be read if not the ones of the TEntryList of fTree, see SetEntryList()
    Bool_t       fIsLearning{kTRUE};   ///<! true if cache is in learning mode
    Bool_t       fIsManual{kFALSE};    ///<! true if cache is StopLearningPhase was used
    Bool_t       fFirstBuffer{kTRUE};  ///<! true if first buffer is used for prefetching
@@ -163,6 +165,7 @@ public:
    void                 ResetMissCache(); // Reset the miss cache.
    void                 SetAutoCreated(Bool_t val) {fAutoCreated = val;}
    Int_t                SetBufferSize(Int_t buffersize) override;
+   void                 SetEntryList(TEntryList *elist);
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
    void                 SetFile(TFile *file, TFile::ECacheAction action=TFile::kDisconnect) override;
    virtual void         SetLearnPrefill(EPrefillType type = kNoPrefill);
@@ -17,6 +17,7 @@
 #include "TTreeCache.h"
 #include <atomic>
 #include <memory>
+#include <utility>
 #include <vector>
 
 class TBasket;
@@ -24,13 +25,16 @@ class TBranch;
 class TMutex;
 class TTree;
 
-#ifdef R__USE_IMT
 namespace ROOT {
+namespace Internal {
+class RRawFile;
+}
+#ifdef R__USE_IMT
 namespace Experimental {
 class TTaskGroup;
 }
-}
 #endif
+}
 
 class TTreeCacheUnzip : public TTreeCache {
 
@@ -83,7 +87,7 @@ protected:
    Int_t       fCycle;
    Bool_t      fParallel; ///< Indicate if we want to activate the parallelism (for this instance)
 
-   std::unique_ptr<TMutex> fIOMutex;
+   std::unique_ptr<TMutex> fIOMutex; ///< Serializes the reads from the file, when the blocks are not read from the cache buffer
 
    static TTreeCacheUnzip::EParUnzipMode fgParallel;  ///< Indicate if we want to activate the parallelism
 
@@ -91,6 +95,22 @@ protected:
 #ifdef R__USE_IMT
    std::unique_ptr<ROOT::Experimental::TTaskGroup> fUnzipTaskGroup;
 #endif
+   Int_t       fTasksCycle;       ///<! Value of fCycle when the unzipping tasks were created
+
+   // Read ahead of the next cluster
+   struct ReadAheadState;
+   std::unique_ptr<ReadAheadState> fReadAhead;      ///<! Baskets of the next cluster, read and unzipped by a background task
+   std::unique_ptr<ReadAheadState> fReadAheadDone;  ///<! Baskets of the current cluster which were read ahead
+   std::unique_ptr<ROOT::Internal::RRawFile> fReadAheadFile; ///<! Independent reader of a local file for the read ahead
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::Experimental::TTaskGroup> fReadAheadTaskGroup;
+#endif
+   Long64_t    fReadAheadSize;    ///<!  Max memory for the compressed and unzipped baskets read ahead (0 disables it)
+
+   // Predicted order of access to the blocks of the cache
+   std::vector<std::pair<Long64_t, Long64_t>> fBlockEntries; ///<! Position on file and first entry of the baskets registered by FillBuffer()
+   std::vector<Int_t> fUnzipOrder; ///<! Indices of the (sorted) blocks in the order in which they will be read
+   std::vector<Int_t> fUnzipRank;  ///<! Position of each block in fUnzipOrder
 
    // Unzipping related members
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
@@ -103,7 +123,8 @@ protected:
    Int_t       fNFound;           ///<! number of blocks that were found in the cache
    Int_t       fNMissed;          ///<! number of blocks that were not found in the cache and were unzipped
    Int_t       fNStalls;          ///<! number of hits which caused a stall
-   Int_t       fNUnzip;           ///<! number of blocks that were unzipped
+   std::atomic<Int_t> fNUnzip;    ///<! number of blocks that were unzipped
+   Int_t       fNReadAhead;       ///<! number of blocks that were read ahead with their cluster
 
 private:
    TTreeCacheUnzip(const TTreeCacheUnzip &) = delete;
@@ -114,6 +135,13 @@ private:
 
    // Private methods
    void  Init();
+   void  ComputeUnzipOrder();
+   void  WaitForUnzipTasks();
+   void  AdoptReadAhead(Long64_t entry);
+   Int_t GetReadAheadBuffer(char **buf, Long64_t pos, Int_t len, Bool_t *free);
+   void  ReadAheadCluster(ReadAheadState &state);
+   void  StartReadAhead();
+   void  StopReadAhead();
 
 public:
    TTreeCacheUnzip();
@@ -125,6 +153,7 @@ public:
    Bool_t              FillBuffer() override;
    Int_t               ReadBufferExt(char *buf, Long64_t pos, Int_t len, Int_t &loc) override;
    void                SetEntryRange(Long64_t emin,   Long64_t emax) override;
+   void                SetFile(TFile *file, TFile::ECacheAction action = TFile::kDisconnect) override;
    void                StopLearningPhase() override;
    void                UpdateBranches(TTree *tree) override;
 
@@ -140,8 +169,10 @@ public:
    Int_t          GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes, Int_t &objlen, Int_t &keylen);
    Int_t          GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_t *free) override;
    Int_t          GetUnzipGroupSize() { return fUnzipGroupSize; }
+   Long64_t       GetReadAheadSize() const { return fReadAheadSize; }
    void           ResetCache() override;
    Int_t          SetBufferSize(Int_t buffersize) override;
+   void           SetReadAheadSize(Long64_t size);
    void           SetUnzipBufferSize(Long64_t bufferSize);
    void           SetUnzipGroupSize(Int_t groupSize) { fUnzipGroupSize = groupSize; }
    static void    SetUnzipRelBufferSize(Float_t relbufferSize);
@@ -149,9 +180,10 @@ public:
    Int_t          UnzipCache(Int_t index);
 
    // Methods to get stats
-   Int_t  GetNUnzip() { return fNUnzip; }
+   Int_t  GetNUnzip() { return fNUnzip.load(); }
    Int_t  GetNMissed(){ return fNMissed; }
    Int_t  GetNFound() { return fNFound; }
+   Int_t  GetNReadAhead() { return fNReadAhead; }
 
    void Print(Option_t* option = "") const override;
 
@@ -24,6 +24,8 @@
 
 #include "TNamed.h"
 
+#include <vector>
+
 class TTree;
 class TTreeFormula;
 
@@ -39,6 +41,8 @@ public:
    virtual Long64_t       GetEntryNumberFriend(const TTree * /*parent*/) = 0;
    virtual Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const = 0;
    virtual Long64_t       GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const = 0;
+   virtual Long64_t       GetEntryNumbersWithIndexRange(Long64_t majorLow, Long64_t minorLow, Long64_t majorHigh,
+                                                        Long64_t minorHigh, std::vector<Long64_t> &entries) const;
    virtual const char    *GetMajorName()    const = 0;
    virtual const char    *GetMinorName()    const = 0;
    virtual Bool_t         IsValidFor(const TTree *parent) = 0;
@@ -23,7 +23,10 @@
 #include "TVirtualMutex.h"
 #include "TVirtualPerfStats.h"
 #include "TTimeStamp.h"
+#include "ROOT/TBasketBufferPool.hxx"
+#include "ROOT/TDecompressedBasketCache.hxx"
 #include "ROOT/TIOFeatures.hxx"
+#include "ROOT/RTrace.hxx"
 #include "RZip.h"
 
 #include <bitset>
@@ -33,6 +36,26 @@ const UInt_t kDisplacementMask = 0xFF000000;  // In the streamer the two highest
 
 ClassImp(TBasket);
 
+using ROOT::Internal::TBasketBufferPool;
+
+////////////////////////////////////////////////////////////////////////////////
+/// A buffer of at least len bytes, taken from the pool of the thread if possible.
+
+static inline TBuffer *R__AcquireBasketBuffer(TBuffer::EMode mode, Int_t len)
+{
+   TBuffer *buffer = TBasketBufferPool::Acquire(len);
+   if (!buffer)
+      return new TBufferFile(mode, len);
+   if (mode == TBuffer::kRead)
+      buffer->SetReadMode();
+   else
+      buffer->SetWriteMode();
+   if (buffer->BufferSize() < len)
+      buffer->Expand(len, kFALSE);
+   buffer->Reset();
+   return buffer;
+}
+
 /** \class TBasket
 \ingroup tree
 
@@ -66,7 +89,7 @@ TBasket::TBasket(const char *name, const char *title, TBranch *branch)
    SetTitle(title);
    fClassName   = "TBasket";
    fBuffer = nullptr;
-   fBufferRef   = new TBufferFile(TBuffer::kWrite, fBufferSize);
+   fBufferRef   = R__AcquireBasketBuffer(TBuffer::kWrite, fBufferSize);
    fVersion    += 1000;
    if (branch->GetDirectory()) {
       TFile *file = branch->GetFile();
@@ -105,13 +128,13 @@ TBasket::~TBasket()
 {
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
-   if (fBufferRef) delete fBufferRef;
+   TBasketBufferPool::Release(fBufferRef);
    fBufferRef = 0;
    fBuffer = 0;
    fDisplacement= 0;
    // Note we only delete the compressed buffer if we own it
    if (fCompressedBufferRef && fOwnsCompressedBuffer) {
-      delete fCompressedBufferRef;
+      TBasketBufferPool::Release(fCompressedBufferRef);
       fCompressedBufferRef = 0;
    }
    // TKey::~TKey will use fMotherDir to attempt to remove they key
@@ -176,8 +199,8 @@ Int_t TBasket::DropBuffers()
 
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
-   if (fBufferRef)    delete fBufferRef;
-   if (fCompressedBufferRef && fOwnsCompressedBuffer) delete fCompressedBufferRef;
+   TBasketBufferPool::Release(fBufferRef);
+   if (fCompressedBufferRef && fOwnsCompressedBuffer) TBasketBufferPool::Release(fCompressedBufferRef);
    fBufferRef   = 0;
    fCompressedBufferRef = 0;
    fBuffer      = 0;
@@ -410,6 +433,8 @@ Int_t TBasket::ReadBasketBuffersUnzip(char* buffer, Int_t size, Bool_t mustFree,
 static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t len, TFile* file)
 {
    TBuffer* result;
+   if (!bufferRef)
+      bufferRef = TBasketBufferPool::Acquire(len);
    if (R__likely(bufferRef)) {
       bufferRef->SetReadMode();
       Int_t curBufferSize = bufferRef->BufferSize();
@@ -471,8 +496,23 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    char *rawUncompressedBuffer, *rawCompressedBuffer;
    Int_t uncompressedBufferLen;
 
-   // See if the cache has already unzipped the buffer for us.
    TFileCacheRead *pf = nullptr;
+
+   // See if the process-wide cache of decompressed baskets has this basket.
+   auto sharedCache = file ? ROOT::Experimental::TDecompressedBasketCache::Get() : nullptr;
+   if (sharedCache) {
+      Int_t size = 0;
+      if (char *buffer = sharedCache->Find(*file, pos, size)) {
+         fBranch->GetTree()->IncrementTotalBuffers(-fBufferSize);
+         len = ReadBasketBuffersUnzip(buffer, size, kTRUE, file);
+         if (len <= 0) return -len;
+         // already in the shared cache, do not insert it again
+         sharedCache = nullptr;
+         goto AfterBuffer;
+      }
+   }
+
+   // See if the cache has already unzipped the buffer for us.
    {
       R__LOCKGUARD_IMT(gROOTMutex); // Lock for parallel TTree I/O
       pf = fBranch->GetTree()->GetReadCache(file);
@@ -598,6 +638,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       if (R__unlikely(gPerfStats)) {
          start = TTimeStamp();
       }
+      R__TRACE_SPAN("io", "TBasket::Unzip");
 
       memcpy(rawUncompressedBuffer, rawCompressedBuffer, fKeylen);
       char *rawUncompressedObjectBuffer = rawUncompressedBuffer+fKeylen;
@@ -649,6 +690,9 @@ AfterBuffer:
 
    fBranch->GetTree()->IncrementTotalBuffers(fBufferSize);
 
+   if (sharedCache)
+      sharedCache->Insert(*file, pos, fBufferRef->Buffer(), fKeylen + fObjlen);
+
    // Read offsets table if needed.
    // If there's no EntryOffsetLen in the branch -- or the fEntryOffset is marked to be calculated-on-demand --
    // then we skip reading out.
@@ -720,7 +764,7 @@ void TBasket::DisownBuffer()
 /// Adopt a buffer from an external entity
 void TBasket::AdoptBuffer(TBuffer *user_buffer)
 {
-   delete fBufferRef;
+   TBasketBufferPool::Release(fBufferRef);
    fBufferRef = user_buffer;
 }
 
@@ -1139,16 +1183,13 @@ Int_t TBasket::WriteBuffer()
    }
    fMotherDir = file; // fBranch->GetDirectory();
 
-   // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
-   // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
-   //
-   // The only parallelism we'd like to exploit (right now!) is the compression
-   // step - everything else should be serialized at the TFile level.
+   if (R__unlikely(fBufferRef->TestBit(TBufferFile::kNotDecompressed))) {
+      // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
+      // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
 #ifdef R__USE_IMT
-   std::unique_lock<std::mutex> sentry(file->fWriteMutex);
+      std::lock_guard<std::mutex> sentry(file->fWriteMutex);
 #endif  // R__USE_IMT
 
-   if (R__unlikely(fBufferRef->TestBit(TBufferFile::kNotDecompressed))) {
       // Read the basket information that was saved inside the buffer.
       Bool_t writing = fBufferRef->IsWriting();
       fBufferRef->SetReadMode();
@@ -1170,6 +1211,22 @@ Int_t TBasket::WriteBuffer()
       return nBytes>0 ? fKeylen+nout : -1;
    }
 
+   Bool_t compressed = kFALSE;
+   Int_t nout = CompressBuffer(file, fBranch->GetWriteBasket(), compressed);
+   if (nout < 0)
+      return -1;
+   return WriteCompressedBuffer(file, nout, compressed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// First step of WriteBuffer(): finalize the content of the basket and compress it, without touching the file.
+///
+/// Returns the size of the payload to write, which is compressed if `compressed` is set to true, or -1 on error.
+/// Several baskets can be compressed at once by different threads, as long as they do not share their compressed
+/// buffer, see fCompressedBufferRef.
+
+Int_t TBasket::CompressBuffer(TFile *file, Int_t cycle, Bool_t &compressed)
+{
    // Transfer fEntryOffset table at the end of fBuffer.
    fLast = fBufferRef->Length();
    Int_t *entryOffset = GetEntryOffset();
@@ -1209,69 +1266,81 @@ Int_t TBasket::WriteBuffer()
    fObjlen = fBufferRef->Length() - fKeylen;
 
    fHeaderOnly = kTRUE;
-   fCycle = fBranch->GetWriteBasket();
+   fCycle = cycle;
+   compressed = kFALSE;
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
    ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(fBranch->GetCompressionAlgorithm());
    if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kInherit)
       cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(file->GetCompressionAlgorithm());
-   if (cxlevel > 0) {
-      Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
-      Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
-      InitializeCompressedBuffer(buflen, file);
-      if (!fCompressedBufferRef) {
-         Warning("WriteBuffer", "Unable to allocate the compressed buffer");
-         return -1;
+   if (cxlevel <= 0)
+      return fObjlen;
+   char *objbuf = fBufferRef->Buffer() + fKeylen;
+   Int_t cxtuned = fBranch->GetBasketCompressionSettings(objbuf, fObjlen);
+   if (cxtuned > 0) {
+      cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(cxtuned / 100);
+      cxlevel = cxtuned % 100;
+   }
+
+   Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
+   Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
+   InitializeCompressedBuffer(buflen, file);
+   if (!fCompressedBufferRef) {
+      Warning("WriteBuffer", "Unable to allocate the compressed buffer");
+      return -1;
+   }
+   fCompressedBufferRef->SetWriteMode();
+   char *bufcur = &fCompressedBufferRef->Buffer()[fKeylen];
+   UInt_t dictid = 0;
+   if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD)
+      dictid = fBranch->GetBasketCompressionDictionary(objbuf, fObjlen);
+   noutot = 0;
+   nzip   = 0;
+   for (Int_t i = 0; i < nbuffers; ++i) {
+      if (i == nbuffers - 1) bufmax = fObjlen - nzip;
+      else bufmax = kMAXZIPBUF;
+      // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
+      // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
+      // (see fCompressedBufferRef in constructor).
+      R__zipDictionary(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm, dictid);
+
+      // test if buffer has really been compressed. In case of small buffers
+      // when the buffer contains random data, it may happen that the compressed
+      // buffer is larger than the input. In this case, we write the original uncompressed buffer
+      if (nout == 0 || nout >= fObjlen) {
+         return fObjlen;
       }
-      fCompressedBufferRef->SetWriteMode();
-      fBuffer = fCompressedBufferRef->Buffer();
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else bufmax = kMAXZIPBUF;
-         // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
-         // for a given TFile: that's because the compression buffer when we use IMT is no longer
-         // shared amongst several threads.
-#ifdef R__USE_IMT
-         sentry.unlock();
-#endif  // R__USE_IMT
-         // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
-         // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
-         // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+      bufcur += nout;
+      noutot += nout;
+      objbuf += kMAXZIPBUF;
+      nzip   += kMAXZIPBUF;
+   }
+   compressed = kTRUE;
+   return noutot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Second step of WriteBuffer(): write the payload prepared by CompressBuffer() to `file`.
+///
+/// The function returns the number of bytes committed to the memory, -1 if a write error occurs.
+
+Int_t TBasket::WriteCompressedBuffer(TFile *file, Int_t nout, Bool_t compressed)
+{
+   // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
+   // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
+   //
+   // The only parallelism we'd like to exploit (right now!) is the compression
+   // step - everything else should be serialized at the TFile level.
 #ifdef R__USE_IMT
-         sentry.lock();
+   std::lock_guard<std::mutex> sentry(file->fWriteMutex);
 #endif  // R__USE_IMT
 
-         // test if buffer has really been compressed. In case of small buffers
-         // when the buffer contains random data, it may happen that the compressed
-         // buffer is larger than the input. In this case, we write the original uncompressed buffer
-         if (nout == 0 || nout >= fObjlen) {
-            nout = fObjlen;
-            // We used to delete fBuffer here, we no longer want to since
-            // the buffer (held by fCompressedBufferRef) might be re-used later.
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen,file);
-            fBufferRef->SetBufferOffset(0);
-
-            Streamer(*fBufferRef);         //write key itself again
-            if ((nout+fKeylen)>buflen) {
-               Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fNbytes=%d, fObjLen=%d, fKeylen=%d",
-                  (nout+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
-            }
-            goto WriteFile;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
-      }
-      nout = noutot;
-      Create(noutot,file);
+   if (compressed) {
+      // We used to delete fBuffer when the data could not be compressed, we no longer want to since
+      // the buffer (held by fCompressedBufferRef) might be re-used later.
+      fBuffer = fCompressedBufferRef->Buffer();
+      Create(nout,file);
       fBufferRef->SetBufferOffset(0);
 
       Streamer(*fBufferRef);         //write key itself again
@@ -1282,10 +1351,8 @@ Int_t TBasket::WriteBuffer()
       fBufferRef->SetBufferOffset(0);
 
       Streamer(*fBufferRef);         //write key itself again
-      nout = fObjlen;
    }
 
-WriteFile:
    Int_t nBytes = WriteFileKeepBuffer();
    fHeaderOnly = kFALSE;
    return nBytes>0 ? fKeylen+nout : -1;
@@ -0,0 +1,125 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/TBasketBufferPool.hxx"
+#include "TBufferFile.h"
+
+#include <algorithm>
+
+using ROOT::Internal::TBasketBufferPool;
+
+std::atomic<Long64_t> TBasketBufferPool::fgMaxSize{32 * 1024 * 1024};
+
+namespace {
+// Trivially destructible, hence still valid while the objects outliving the pool of the thread, e.g. the trees
+// deleted at the end of the process, are destructed
+thread_local bool gPoolDestroyed = false;
+} // anonymous namespace
+
+TBasketBufferPool *TBasketBufferPool::ThreadLocal()
+{
+   if (gPoolDestroyed)
+      return nullptr;
+   thread_local TBasketBufferPool pool;
+   return &pool;
+}
+
+TBasketBufferPool::~TBasketBufferPool()
+{
+   gPoolDestroyed = true;
+   for (auto buffer : fBuffers)
+      delete buffer;
+}
+
+TBuffer *TBasketBufferPool::Acquire(Int_t size)
+{
+   auto pool = ThreadLocal();
+   if (!pool || pool->fBuffers.empty())
+      return nullptr;
+
+   // The smallest buffer large enough, otherwise the largest one
+   auto best = pool->fBuffers.end();
+   auto largest = pool->fBuffers.begin();
+   for (auto itr = pool->fBuffers.begin(); itr != pool->fBuffers.end(); ++itr) {
+      const auto bufsize = (*itr)->BufferSize();
+      if (bufsize >= size && (best == pool->fBuffers.end() || bufsize < (*best)->BufferSize()))
+         best = itr;
+      if (bufsize > (*largest)->BufferSize())
+         largest = itr;
+   }
+   if (best == pool->fBuffers.end())
+      best = largest;
+
+   TBuffer *buffer = *best;
+   *best = pool->fBuffers.back();
+   pool->fBuffers.pop_back();
+   pool->fSize -= buffer->BufferSize();
+   ++pool->fNReused;
+   return buffer;
+}
+
+void TBasketBufferPool::Release(TBuffer *buffer)
+{
+   if (!buffer)
+      return;
+   const Long64_t maxSize = fgMaxSize;
+   const Long64_t size = buffer->BufferSize();
+   // Only the plain buffers owning their memory can be reused by any basket
+   if (size > maxSize || buffer->IsA() != TBufferFile::Class() || !buffer->TestBit(TBufferIO::kIsOwner)) {
+      delete buffer;
+      return;
+   }
+
+   auto pool = ThreadLocal();
+   if (!pool) {
+      delete buffer;
+      return;
+   }
+   // Make room by dropping the smallest buffers, the large ones are the most expensive to reallocate
+   while (!pool->fBuffers.empty() && (pool->fBuffers.size() >= kMaxBuffers || pool->fSize + size > maxSize)) {
+      auto smallest = std::min_element(pool->fBuffers.begin(), pool->fBuffers.end(),
+                                       [](TBuffer *a, TBuffer *b) { return a->BufferSize() < b->BufferSize(); });
+      if ((*smallest)->BufferSize() >= size) {
+         delete buffer;
+         return;
+      }
+      pool->fSize -= (*smallest)->BufferSize();
+      delete *smallest;
+      *smallest = pool->fBuffers.back();
+      pool->fBuffers.pop_back();
+   }
+
+   // The buffer must not keep references to the file or to the objects it was used for
+   buffer->SetParent(nullptr);
+   buffer->ResetMap();
+   pool->fBuffers.push_back(buffer);
+   pool->fSize += size;
+}
+
+void TBasketBufferPool::Clear()
+{
+   auto pool = ThreadLocal();
+   if (!pool)
+      return;
+   for (auto buffer : pool->fBuffers)
+      delete buffer;
+   pool->fBuffers.clear();
+   pool->fSize = 0;
+}
+
+Long64_t TBasketBufferPool::GetSize()
+{
+   auto pool = ThreadLocal();
+   return pool ? pool->fSize : 0;
+}
+
+Long64_t TBasketBufferPool::GetNReused()
+{
+   auto pool = ThreadLocal();
+   return pool ? pool->fNReused : 0;
+}
@@ -46,17 +46,23 @@
 #include "TVirtualMutex.h"
 #include "TVirtualPad.h"
 #include "TVirtualPerfStats.h"
+#include "RZip.h"
 #include "strlcpy.h"
 #include "snprintf.h"
 
 #include "TBranchIMTHelper.h"
 
+#include "ROOT/TBasketBufferPool.hxx"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstring>
 #include <cstdio>
+#include <iterator>
+#include <mutex>
+#include <string>
 
 
 Int_t TBranch::fgCount = 0;
@@ -79,6 +85,26 @@ See also specialized branches:
 
 ClassImp(TBranch);
 
+/// The baskets collected to train the compression dictionary of a branch from, see
+/// TBranch::EnableCompressionDictionary(). Several baskets of the branch can be compressed at once.
+struct TBranch::RDictionaryTrainer {
+   std::mutex fMutex;
+   Int_t fNBaskets = 0;            ///< Number of baskets to train the dictionary from
+   bool fDone = false;             ///< Whether the training was attempted
+   std::string fSamples;           ///< The content of the collected baskets
+   std::vector<int> fSampleSizes;  ///< The size of each of the collected baskets in fSamples
+};
+
+/// The baskets collected to select the compression settings of a branch from, see
+/// TBranch::EnableCompressionTuning(). Several baskets of the branch can be compressed at once.
+struct TBranch::RCompressionTuner {
+   std::mutex fMutex;
+   Int_t fNBaskets = 0;              ///< Number of baskets to select the settings from
+   Double_t fMinReadSpeed = 0;       ///< Decompression speed in MB/s the selected settings must reach
+   std::atomic<Int_t> fSettings{-1}; ///< The selected settings, -1 until they are selected
+   std::string fSamples;             ///< The content of the collected baskets
+   std::vector<int> fSampleSizes;    ///< The size of each of the collected baskets in fSamples
+};
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -452,6 +478,13 @@ TBranch::~TBranch()
    delete fBrowsables;
    fBrowsables = 0;
 
+   delete fDictionaryTrainer;
+   fDictionaryTrainer = nullptr;
+   delete fCompressionTuner;
+   fCompressionTuner = nullptr;
+   if (fCompressionDictionaryID)
+      R__unregisterZipDictionary(fCompressionDictionaryID);
+
    // Note: We do *not* have ownership of the buffer.
    fEntryBuffer = 0;
 
@@ -512,7 +545,7 @@ TBranch::~TBranch()
    fDirectory = 0;
 
    if (fTransientBuffer) {
-      delete fTransientBuffer;
+      ROOT::Internal::TBasketBufferPool::Release(fTransientBuffer);
       fTransientBuffer = 0;
    }
 }
@@ -528,6 +561,13 @@ TBuffer* TBranch::GetTransientBuffer(Int_t size)
       }
       return fTransientBuffer;
    }
+   fTransientBuffer = ROOT::Internal::TBasketBufferPool::Acquire(size);
+   if (fTransientBuffer) {
+      fTransientBuffer->SetReadMode();
+      if (fTransientBuffer->BufferSize() < size)
+         fTransientBuffer->Expand(size);
+      return fTransientBuffer;
+   }
    fTransientBuffer = new TBufferFile(TBuffer::kRead, size);
    return fTransientBuffer;
 }
@@ -1434,7 +1474,68 @@ Bool_t TBranch::SupportsBulkRead() const {
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// \brief Read a basket of events into the given buffer with byte swapping.
+/// Describe how the entries of this branch are laid out in its baskets, if
+/// each of them is a variable-size collection of values of a fundamental type.
+/// `type` is set to the type of the values and `hasHeader` to whether each
+/// entry starts with the byte count, version and size written by the streamer
+/// of an STL collection; otherwise the values of an entry are stored back to
+/// back, without a header.
+///
+/// Returns false if the branch does not hold such collections.
+///
+/// TBranch supports leaves holding variable-size arrays, with a leaf count (for
+/// example "x[n]/F").
+
+Bool_t TBranch::GetBulkCollectionLayout(EDataType &type, Bool_t &hasHeader)
+{
+   if (fNleaves != 1)
+      return kFALSE;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   if (!leaf->GetLeafCount() || leaf->GetDeserializeType() == TLeaf::DeserializeType::kExternal)
+      return kFALSE;
+   TClass *cl = nullptr;
+   if (GetExpectedType(cl, type) || cl)
+      return kFALSE;
+   hasHeader = kFALSE;
+   return kTRUE;
+}
+
+namespace {
+/// The size of the values of the given type in the bulk collection reads, 0 if they are not supported
+Int_t GetBulkValueSize(EDataType type)
+{
+   switch (type) {
+   case kChar_t:
+   case kUChar_t:
+   case kBool_t: return 1;
+   case kShort_t:
+   case kUShort_t: return 2;
+   case kInt_t:
+   case kUInt_t:
+   case kFloat_t: return 4;
+   case kDouble_t:
+   case kLong64_t:
+   case kULong64_t: return 8;
+   default: return 0;
+   }
+}
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch can be read with GetBulkCollectionEntries().
+///
+/// This is the case for branches whose entries are variable-size collections
+/// of a fundamental type: leaves with a leaf count (e.g. "x[n]/F"), branches
+/// of `std::vector` of a fundamental type, and the split data members of
+/// fundamental type of the elements of a TClonesArray or of an STL collection.
+
+Bool_t TBranch::SupportsBulkCollectionRead()
+{
+   EDataType type = kOther_t;
+   Bool_t hasHeader = kFALSE;
+   return GetBulkCollectionLayout(type, hasHeader) && GetBulkValueSize(type);
+}
+
 ///
 /// \return On success, the number of events of the type held by this branch
 ///         that have been read into the buffer. -1 on failure.
@@ -1685,7 +1786,163 @@ Int_t TBranch::GetEntriesSerialized(Long64_t entry, TBuffer &user_buf, TBuffer *
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Read all leaves of entry and return total number of bytes read.
+/// \brief Read a basket of entries holding variable-size collections into a
+/// flat buffer of values and an array of offsets.
+///
+/// \return On success, the number of entries that have been read. -1 on failure,
+///         in particular if SupportsBulkCollectionRead() is false.
+///
+/// On success, the values of all the entries are stored back to back and byte
+/// swapped in `user_buf`, and `offset_buf` holds one more offset than there are
+/// entries: the values of entry `first + i` are the ones in the range
+/// [offsets[i], offsets[i + 1]) of
+///
+/// ~~~{.cpp}
+/// auto values = reinterpret_cast<T *>(user_buf.GetCurrent());
+/// auto offsets = reinterpret_cast<Int_t *>(offset_buf.GetCurrent());
+/// ~~~
+///
+/// where T is the type of the values held by this branch. Note that the values
+/// are not necessarily aligned to the size of T.
+///
+/// As for GetBulkEntries(), `entry` must be the first entry of a basket, and the
+/// contents of `user_buf` are only valid until the next bulk read into it.
+///
+/// \note This interface is not meant to be exposed to end users, but rather it should
+///       be wrapped by higher-level interfaces.
+
+Int_t TBranch::GetBulkCollectionEntries(Long64_t entry, TBuffer &user_buf, TBuffer &offset_buf)
+{
+   EDataType type = kOther_t;
+   Bool_t hasHeader = kFALSE;
+   if (R__unlikely(!GetBulkCollectionLayout(type, hasHeader))) return -1;
+   const Int_t valueSize = GetBulkValueSize(type);
+   if (R__unlikely(!valueSize)) return -1;
+
+   // Remember which entry we are reading.
+   fReadEntry = entry;
+
+   Bool_t enabled = !TestBit(kDoNotProcess);
+   if (R__unlikely(!enabled)) return -1;
+   TBasket *basket = nullptr;
+   Long64_t first;
+   Int_t result = GetBasketAndFirst(basket, first, &user_buf);
+   if (R__unlikely(result < 0)) return -1;
+   // Only support reading from full clusters.
+   if (R__unlikely(entry != first)) {
+      Error("GetBulkCollectionEntries", "Failed to read from full cluster; first entry is %lld; requested entry is %lld.\n", first, entry);
+      return -1;
+   }
+
+   basket->PrepareBasket(entry);
+   TBuffer* buf = basket->GetBufferRef();
+
+   // Test for very old ROOT files.
+   if (R__unlikely(!buf)) {
+      Error("GetBulkCollectionEntries", "Failed to get a new buffer.\n");
+      return -1;
+   }
+   // Test for displacements, which aren't supported in fast mode.
+   if (R__unlikely(basket->GetDisplacement())) {
+      Error("GetBulkCollectionEntries", "Basket has displacement.\n");
+      return -1;
+   }
+   Int_t *entryOffset = basket->GetEntryOffset();
+   if (R__unlikely(!entryOffset)) {
+      Error("GetBulkCollectionEntries", "Basket has no entry offsets.\n");
+      return -1;
+   }
+
+   // The end of the data of the last entry: a basket read from the file records it, an
+   // in-memory basket is still being filled.
+   Int_t last = basket->GetLast();
+   if (&user_buf != buf) {
+      // The basket was already in memory and might (and might not) be backed by persistent
+      // storage.
+      R__ASSERT(result == fReadBasket);
+      if (fBasketSeek[fReadBasket]) {
+         // It is backed, so we can be destructive
+         user_buf.SetBuffer(buf->Buffer(), buf->BufferSize());
+         buf->ResetBit(TBufferIO::kIsOwner);
+         fCurrentBasket = nullptr;
+         fBaskets[fReadBasket] = nullptr;
+      } else {
+         // This is the only copy, we can't return it as is to the user, just make a copy.
+         last = buf->Length();
+         if (user_buf.BufferSize() < buf->BufferSize()) {
+            user_buf.AutoExpand(buf->BufferSize());
+         }
+         memcpy(user_buf.Buffer(), buf->Buffer(), buf->BufferSize());
+      }
+   }
+
+   // The entry offsets belong to the basket, which is kept as extra basket until the next bulk read.
+   if (fCurrentBasket == nullptr) {
+      R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
+      fExtraBasket = basket;
+      basket->DisownBuffer();
+   }
+
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+
+   if (offset_buf.BufferSize() < Int_t((N + 1) * sizeof(Int_t))) {
+      offset_buf.AutoExpand((N + 1) * sizeof(Int_t));
+   }
+   offset_buf.SetBufferOffset(0);
+   Int_t *offsets = reinterpret_cast<Int_t*>(offset_buf.Buffer());
+
+   // Move the values of each entry right after the ones of the previous entry, dropping the
+   // headers: the values only move towards the beginning of the buffer.
+   const UInt_t kByteCountMask = 0x40000000;
+   char *data = user_buf.Buffer();
+   Int_t bufbegin = basket->GetKeylen();
+   Int_t dest = bufbegin;
+   Int_t nvalues = 0;
+   for (Int_t i = 0; i < N; ++i) {
+      Int_t begin = entryOffset[i];
+      const Int_t end = (i + 1 < N) ? entryOffset[i + 1] : last;
+      if (hasHeader) {
+         // Byte count, version and number of elements of the collection.
+         UInt_t byteCount = 0;
+         Version_t version = 0;
+         Int_t size = -1;
+         char *header = data + begin;
+         if (end - begin >= 10) {
+            frombuf(header, &byteCount);
+            frombuf(header, &version);
+            frombuf(header, &size);
+         }
+         begin += 10;
+         if (R__unlikely(!(byteCount & kByteCountMask) || Int_t(byteCount & ~kByteCountMask) != end - begin + 6 ||
+                         version <= 1 || (version & TBufferFile::kStreamedMemberWise) || size < 0 ||
+                         Long64_t(size) * valueSize != end - begin)) {
+            Error("GetBulkCollectionEntries", "Unexpected layout of entry %lld.\n", first + i);
+            return -1;
+         }
+      }
+      const Int_t nbytes = end - begin;
+      if (R__unlikely(nbytes < 0 || nbytes % valueSize)) {
+         Error("GetBulkCollectionEntries", "Unexpected size of entry %lld.\n", first + i);
+         return -1;
+      }
+      if (dest != begin)
+         memmove(data + dest, data + begin, nbytes);
+      dest += nbytes;
+      offsets[i] = nvalues;
+      nvalues += nbytes / valueSize;
+   }
+   offsets[N] = nvalues;
+
+   user_buf.SetBufferOffset(bufbegin);
+   if (valueSize > 1 && R__unlikely(!user_buf.ByteSwapBuffer(nvalues, type))) {
+      Error("GetBulkCollectionEntries", "Failed to byte swap the values.\n");
+      return -1;
+   }
+   user_buf.SetBufferOffset(bufbegin);
+
+   return N;
+}
+
 ///
 /// The input argument "entry" is the entry number in the current tree.
 /// In case of a TChain, the entry number in the current Tree must be found
@@ -2813,6 +3070,175 @@ void TBranch::SetCompressionSettings(Int_t settings)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Train a ZSTD compression dictionary from the first `nbaskets` baskets of
+/// this branch and its sub-branches, and compress all the following baskets
+/// with it.
+///
+/// Small baskets compress poorly on their own: most of what ZSTD could learn
+/// from their content is lost at the end of each basket. A dictionary trained
+/// from baskets of the same branch gives this knowledge back, which improves
+/// both the compression ratio and the decompression speed of the small ones.
+/// The dictionary is stored once, with the branch in the TTree header, and
+/// registered when the TTree is read back, so that the baskets decompress as
+/// usual. Files that use a dictionary cannot be read by older ROOT versions.
+///
+/// This only affects the branches compressed with ZSTD, and the baskets that
+/// are filled after this call. Nothing happens if the samples are not enough
+/// to train a dictionary, and the branch is compressed as usual.
+
+void TBranch::EnableCompressionDictionary(Int_t nbaskets)
+{
+   if (nbaskets > 0 && fCompressionDictionary.empty() && !fDictionaryTrainer) {
+      fDictionaryTrainer = new RDictionaryTrainer;
+      fDictionaryTrainer->fNBaskets = nbaskets;
+   }
+
+   Int_t nb = fBranches.GetEntriesFast();
+   for (Int_t i=0;i<nb;i++) {
+      TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+      branch->EnableCompressionDictionary(nbaskets);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the ID of the compression dictionary to compress the `size` bytes
+/// of a basket at `buffer` with, 0 if there is none. If the dictionary is
+/// still to be trained, the basket is kept as one of the training samples,
+/// and the dictionary is trained once enough of them are collected.
+
+UInt_t TBranch::GetBasketCompressionDictionary(const char *buffer, Int_t size)
+{
+   // Baskets larger than this are truncated: ZSTD only learns from the start of long samples anyway
+   constexpr Int_t kMaxSampleSize = 128 * 1024;
+
+   UInt_t dictid = fCompressionDictionaryID.load(std::memory_order_acquire);
+   if (dictid || !fDictionaryTrainer)
+      return dictid;
+
+   std::lock_guard<std::mutex> lock(fDictionaryTrainer->fMutex);
+   if (fDictionaryTrainer->fDone)
+      return fCompressionDictionaryID.load(std::memory_order_relaxed);
+
+   size = std::min(size, kMaxSampleSize);
+   fDictionaryTrainer->fSamples.append(buffer, size);
+   fDictionaryTrainer->fSampleSizes.push_back(size);
+   if ((Int_t)fDictionaryTrainer->fSampleSizes.size() < fDictionaryTrainer->fNBaskets)
+      return 0;
+
+   fDictionaryTrainer->fDone = true;
+   const Int_t capacity = std::min<Int_t>(ROOT::RCompressionSetting::EDictionary::kDefaultMaxSize,
+                                          fDictionaryTrainer->fSamples.size() / 8);
+   std::vector<char> dict(std::max(capacity, 0));
+   Int_t dictsize = R__trainZipDictionary(fDictionaryTrainer->fSampleSizes.size(), fDictionaryTrainer->fSamples.data(),
+                                          fDictionaryTrainer->fSampleSizes.data(), capacity, dict.data());
+   std::string().swap(fDictionaryTrainer->fSamples);
+   std::vector<int>().swap(fDictionaryTrainer->fSampleSizes);
+   if (dictsize > 0) {
+      dict.resize(dictsize);
+      fCompressionDictionary = std::move(dict);
+      RegisterCompressionDictionary();
+   }
+   return fCompressionDictionaryID.load(std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Select the compression algorithm and level of this branch and its
+/// sub-branches from trial compressions of their first `nbaskets` baskets.
+///
+/// A single compression setting rarely fits all the branches of a tree: the
+/// best trade-off between size and read speed depends on the content of each
+/// of them. With this option, the first `nbaskets` baskets of the branch are
+/// compressed as usual, and also kept as samples. Once enough of them are
+/// collected, they are compressed and decompressed with a few candidate
+/// settings (LZ4, ZLIB and ZSTD at several levels). Among the candidates that
+/// decompress the samples at `minReadSpeed` MB/s or more, the one giving the
+/// smallest baskets is used for all the following baskets; if none is fast
+/// enough, the fastest one is used. A `minReadSpeed` of 0 always selects the
+/// smallest output. The selected settings are stored as the compression
+/// settings of the branch when the TTree is written.
+///
+/// Uncompressed branches are not affected. The selection depends on timings,
+/// so different runs can select different settings unless `minReadSpeed` is 0.
+
+void TBranch::EnableCompressionTuning(Double_t minReadSpeed, Int_t nbaskets)
+{
+   if (nbaskets > 0 && !fCompressionTuner) {
+      fCompressionTuner = new RCompressionTuner;
+      fCompressionTuner->fNBaskets = nbaskets;
+      fCompressionTuner->fMinReadSpeed = minReadSpeed;
+   }
+
+   Int_t nb = fBranches.GetEntriesFast();
+   for (Int_t i=0;i<nb;i++) {
+      TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+      branch->EnableCompressionTuning(minReadSpeed, nbaskets);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the compression settings selected by EnableCompressionTuning() to
+/// compress the `size` bytes of a basket at `buffer` with, -1 if there are
+/// none (yet). If the settings are still to be selected, the basket is kept as
+/// one of the samples, and the settings are selected once enough of them are
+/// collected.
+
+Int_t TBranch::GetBasketCompressionSettings(const char *buffer, Int_t size)
+{
+   // Baskets larger than this are truncated: enough to rank the candidates while keeping the trials cheap
+   constexpr Int_t kMaxSampleSize = 256 * 1024;
+   // LZ4, ZLIB and ZSTD, from the fastest to read to the smallest output; LZMA is too slow to read to be considered
+   static constexpr Int_t kCandidates[] = {
+      ROOT::RCompressionSetting::EDefaults::kUseAnalysis,
+      ROOT::RCompressionSetting::EAlgorithm::kZSTD * 100 + 1,
+      ROOT::RCompressionSetting::EDefaults::kUseGeneralPurpose,
+      ROOT::RCompressionSetting::EAlgorithm::kZSTD * 100 + 9,
+      ROOT::RCompressionSetting::EAlgorithm::kZLIB * 100 + 1,
+      ROOT::RCompressionSetting::EAlgorithm::kZLIB * 100 + 6,
+   };
+
+   if (!fCompressionTuner)
+      return -1;
+   Int_t settings = fCompressionTuner->fSettings.load(std::memory_order_acquire);
+   if (settings >= 0)
+      return settings;
+
+   std::lock_guard<std::mutex> lock(fCompressionTuner->fMutex);
+   settings = fCompressionTuner->fSettings.load(std::memory_order_relaxed);
+   if (settings >= 0)
+      return settings;
+
+   size = std::min(size, kMaxSampleSize);
+   fCompressionTuner->fSamples.append(buffer, size);
+   fCompressionTuner->fSampleSizes.push_back(size);
+   if ((Int_t)fCompressionTuner->fSampleSizes.size() < fCompressionTuner->fNBaskets)
+      return -1;
+
+   settings = R__selectZipSettings(fCompressionTuner->fSampleSizes.size(), fCompressionTuner->fSamples.data(),
+                                   fCompressionTuner->fSampleSizes.data(), std::size(kCandidates), kCandidates,
+                                   fCompressionTuner->fMinReadSpeed);
+   std::string().swap(fCompressionTuner->fSamples);
+   std::vector<int>().swap(fCompressionTuner->fSampleSizes);
+   fCompressionTuner->fSettings.store(settings, std::memory_order_release);
+   return settings;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register fCompressionDictionary in the registry of RZip, so that the
+/// baskets compressed with it can be decompressed.
+
+void TBranch::RegisterCompressionDictionary()
+{
+   if (fCompressionDictionaryID)
+      R__unregisterZipDictionary(fCompressionDictionaryID.exchange(0));
+   if (fCompressionDictionary.empty())
+      return;
+   UInt_t dictid = R__registerZipDictionary(fCompressionDictionary.size(), fCompressionDictionary.data());
+   if (!dictid)
+      Error("RegisterCompressionDictionary", "The compression dictionary of the branch %s is invalid.", GetName());
+   fCompressionDictionaryID.store(dictid, std::memory_order_release);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Update the default value for the branch's fEntryOffsetLen if and only if
 /// it was already non zero (and the new value is not zero)
@@ -2970,6 +3396,7 @@ void TBranch::Streamer(TBuffer& b)
       Version_t v = b.ReadVersion(&R__s, &R__c);
       if (v > 9) {
          b.ReadClassBuffer(TBranch::Class(), this, v, R__s, R__c);
+         RegisterCompressionDictionary();
 
          if (fWriteBasket>=fBaskets.GetSize()) {
             fBaskets.Expand(fWriteBasket+1);
@@ -3167,6 +3594,9 @@ void TBranch::Streamer(TBuffer& b)
          }
       }
    } else {
+      // No basket is being compressed while the branch is written: record the tuned settings.
+      if (fCompressionTuner && fCompressionTuner->fSettings >= 0)
+         fCompress = fCompressionTuner->fSettings;
       Int_t maxBaskets = fMaxBaskets;
       fMaxBaskets = fWriteBasket+1;
       Int_t lastBasket = fMaxBaskets;
@@ -3210,6 +3640,11 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
    }
 
+#ifdef R__USE_IMT
+   if (imtHelper && imtHelper->GetAsyncWriter() && where == fWriteBasket)
+      return WriteBasketAsync(basket, where, *imtHelper->GetAsyncWriter());
+#endif
+
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
    // itself might be modified after `WriteBasketImpl` exits.
@@ -3217,61 +3652,143 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       Int_t nout  = basket->WriteBuffer();    //  Write buffer
       if (nout < 0)
          Error("WriteBasketImpl", "basket's WriteBuffer failed.");
-      fBasketBytes[where]  = basket->GetNbytes();
-      fBasketSeek[where]   = basket->GetSeekKey();
-      Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
-      TBasket *reusebasket = 0;
-      if (nout>0) {
-         // The Basket was written so we can now safely reuse it.
-         fBaskets[where] = 0;
-
-         reusebasket = basket;
-         reusebasket->WriteReset();
-
-         fZipBytes += nout;
-         fTotBytes += addbytes;
-         fTree->AddTotBytes(addbytes);
-         fTree->AddZipBytes(nout);
+      return FinishBasketWrite(basket, where, nout);
+   };
+   if (imtHelper) {
+      imtHelper->Run(doUpdates);
+      return 0;
+   } else {
+      return doUpdates();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Update the branch after its basket number `where` was written; `nout` is
+/// the value returned by TBasket::WriteBuffer().
+///
+/// A written basket is reset and reused as the write basket if there is none,
+/// otherwise it is deleted.
+
+Int_t TBranch::FinishBasketWrite(TBasket* basket, Int_t where, Int_t nout)
+{
+   fBasketBytes[where]  = basket->GetNbytes();
+   fBasketSeek[where]   = basket->GetSeekKey();
+   Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+   TBasket *reusebasket = 0;
+   if (nout>0) {
+      // The Basket was written so we can now safely reuse it.
+      fBaskets[where] = 0;
+
+      reusebasket = basket;
+      reusebasket->WriteReset();
+
+      fZipBytes += nout;
+      fTotBytes += addbytes;
+      fTree->AddTotBytes(addbytes);
+      fTree->AddZipBytes(nout);
 #ifdef R__TRACK_BASKET_ALLOC_TIME
-         fTree->AddAllocationTime(reusebasket->GetResetAllocationTime());
+      fTree->AddAllocationTime(reusebasket->GetResetAllocationTime());
 #endif
-         fTree->AddAllocationCount(reusebasket->GetResetAllocationCount());
-      }
+      fTree->AddAllocationCount(reusebasket->GetResetAllocationCount());
+   }
 
-      if (where==fWriteBasket) {
-         ++fWriteBasket;
-         if (fWriteBasket >= fMaxBaskets) {
-            ExpandBasketArrays();
-         }
-         if (reusebasket && reusebasket == fCurrentBasket) {
-            // The 'current' basket has Reset, so if we need it we will need
-            // to reload it.
-            fCurrentBasket    = 0;
-            fFirstBasketEntry = -1;
-            fNextBasketEntry  = -1;
-         }
-         fBaskets.AddAtAndExpand(reusebasket,fWriteBasket);
-         fBasketEntry[fWriteBasket] = fEntryNumber;
+   if (where==fWriteBasket) {
+      ++fWriteBasket;
+      if (fWriteBasket >= fMaxBaskets) {
+         ExpandBasketArrays();
+      }
+      if (reusebasket && reusebasket == fCurrentBasket) {
+         // The 'current' basket has Reset, so if we need it we will need
+         // to reload it.
+         fCurrentBasket    = 0;
+         fFirstBasketEntry = -1;
+         fNextBasketEntry  = -1;
+      }
+      fBaskets.AddAtAndExpand(reusebasket,fWriteBasket);
+      fBasketEntry[fWriteBasket] = fEntryNumber;
+   } else {
+      fBaskets[where] = 0;
+      if (basket == fCurrentBasket) {
+         fCurrentBasket    = 0;
+         fFirstBasketEntry = -1;
+         fNextBasketEntry  = -1;
+      }
+      if (reusebasket && !fBaskets.UncheckedAt(fWriteBasket)) {
+         // e.g. the basket was compressed asynchronously, while the baskets after it were filled
+         fBaskets.AddAtAndExpand(reusebasket, fWriteBasket);
       } else {
          --fNBaskets;
-         fBaskets[where] = 0;
          basket->DropBuffers();
-         if (basket == fCurrentBasket) {
-            fCurrentBasket    = 0;
-            fFirstBasketEntry = -1;
-            fNextBasketEntry  = -1;
-         }
          delete basket;
       }
-      return nout;
-   };
-   if (imtHelper) {
-      imtHelper->Run(doUpdates);
-      return 0;
-   } else {
-      return doUpdates();
    }
+   return nout;
+}
+
+#ifdef R__USE_IMT
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the current basket over to `writer`, which compresses it in a task,
+/// and continue filling a new basket right away. The basket is written to the
+/// file, and FinishBasketWrite() called, once it is compressed (see
+/// ROOT::Internal::TAsyncBasketWriter).
+///
+/// Returns 0, or -1 if pending writes had to be finished and failed.
+
+Int_t TBranch::WriteBasketAsync(TBasket* basket, Int_t where, ROOT::Internal::TAsyncBasketWriter &writer)
+{
+   constexpr Int_t kWrite = 1;
+   TFile *file = GetFile(kWrite);
+   if (!file || !file->IsWritable() || basket->GetBufferRef()->TestBit(TBufferFile::kNotDecompressed))
+      return WriteBasketImpl(basket, where, nullptr);
+
+   // The compressed buffer of the basket is shared by all the baskets of the branch, and several of them can be
+   // compressed at once: the basket compresses into a buffer of its own, which it keeps when it is reused.
+   if (!basket->fOwnsCompressedBuffer)
+      basket->fCompressedBufferRef = nullptr;
+   basket->fMotherDir = file;
+
+   auto write = std::make_unique<ROOT::Internal::TAsyncBasketWriter::RPendingWrite>();
+   write->fBranch = this;
+   write->fBasket = basket;
+   write->fWhere = where;
+   write->fBytes = basket->GetBufferRef()->BufferSize();
+
+   // Detach the basket: the next entries of the branch go to a new basket.
+   fBaskets[where] = 0;
+   if (basket == fCurrentBasket) {
+      fCurrentBasket    = 0;
+      fFirstBasketEntry = -1;
+      fNextBasketEntry  = -1;
+   }
+   ++fWriteBasket;
+   if (fWriteBasket >= fMaxBaskets) {
+      ExpandBasketArrays();
+   }
+   fBaskets.AddAtAndExpand(0, fWriteBasket);
+   fBasketEntry[fWriteBasket] = fEntryNumber;
+
+   const Int_t nerrors = writer.Submit(std::move(write), [file](ROOT::Internal::TAsyncBasketWriter::RPendingWrite &w) {
+      w.fNout = w.fBasket->CompressBuffer(file, w.fWhere, w.fCompressed);
+   });
+   return nerrors ? -1 : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write a basket compressed by WriteBasketAsync() to the file and update the
+/// branch. `nout` and `compressed` are the results of TBasket::CompressBuffer().
+
+Int_t TBranch::WriteCompressedBasket(TBasket* basket, Int_t where, Int_t nout, Bool_t compressed)
+{
+   constexpr Int_t kWrite = 1;
+   if (nout >= 0) {
+      TFile *file = GetFile(kWrite);
+      nout = file ? basket->WriteCompressedBuffer(file, nout, compressed) : -1;
+   }
+   if (nout < 0)
+      Error("WriteBasketImpl", "basket's WriteBuffer failed.");
+   return FinishBasketWrite(basket, where, nout);
 }
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 ///set the first entry number (case of TBranchSTL)
@@ -3322,3 +3839,49 @@ void TBranch::UpdateFile()
       branch->UpdateFile();
    }
 }
+
+#ifdef R__USE_IMT
+ROOT::Internal::TAsyncBasketWriter::~TAsyncBasketWriter()
+{
+   // the tree finishes the writes it wants to keep before it destroys the writer
+   Discard();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write a compressed basket to the file of its branch and update the branch.
+
+Int_t ROOT::Internal::TAsyncBasketWriter::Finish(RPendingWrite &write)
+{
+   fBytes -= write.fBytes;
+   return write.fBranch->WriteCompressedBasket(write.fBasket, write.fWhere, write.fNout, write.fCompressed) < 0;
+}
+
+Int_t ROOT::Internal::TAsyncBasketWriter::FinishCompleted()
+{
+   Int_t nerrors = 0;
+   while (!fPending.empty() && fPending.front()->fDone.load(std::memory_order_acquire)) {
+      nerrors += Finish(*fPending.front());
+      fPending.pop_front();
+   }
+   return nerrors;
+}
+
+Int_t ROOT::Internal::TAsyncBasketWriter::FinishAll()
+{
+   if (fPending.empty())
+      return 0;
+   fGroup.Wait();
+   return FinishCompleted();
+}
+
+void ROOT::Internal::TAsyncBasketWriter::Discard()
+{
+   fGroup.Wait();
+   for (auto &write : fPending) {
+      --write->fBranch->fNBaskets;
+      delete write->fBasket;
+   }
+   fPending.clear();
+   fBytes = 0;
+}
+#endif
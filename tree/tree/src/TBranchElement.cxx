@@ -2118,6 +2118,10 @@ static void GatherArtificialElements(const TObjArray &branches, TStreamerInfoAct
 
 void TBranchElement::SetupInfo()
 {
+   // The streamer infos of the file may be built on first use
+   if (TFile *file = GetFile())
+      file->LoadStreamerInfo(fClassName);
+
    // We did not already have streamer info, so now we must find it.
    TClass* cl = fBranchClass.GetClass();
 
@@ -2835,6 +2839,42 @@ Int_t TBranchElement::GetExpectedType(TClass *&expectedClass,EDataType &expected
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// See TBranch::GetBulkCollectionLayout().
+///
+/// Supports the split data members of fundamental type of the elements of a
+/// TClonesArray or STL collection, whose values are stored back to back, and
+/// `std::vector`s of a fundamental type that are not split, stored with their
+/// streamer header.
+
+Bool_t TBranchElement::GetBulkCollectionLayout(EDataType &type, Bool_t &hasHeader)
+{
+   if (fNleaves != 1 || fBranches.GetEntriesFast())
+      return kFALSE;
+   TClass *cl = nullptr;
+   if (GetExpectedType(cl, type))
+      return kFALSE;
+   if (fType == 31 || fType == 41) {
+      auto leaf = static_cast<TLeaf *>(fLeaves.UncheckedAt(0));
+      if (cl || leaf->GetDeserializeType() == TLeaf::DeserializeType::kExternal)
+         return kFALSE;
+      hasHeader = kFALSE;
+      return kTRUE;
+   }
+   if (fType == 0 && cl && cl->GetCollectionProxy()) {
+      TVirtualCollectionProxy *proxy = cl->GetCollectionProxy();
+      if (proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass() || proxy->HasPointers())
+         return kFALSE;
+      type = proxy->GetType();
+      // the streamer of std::vector<bool> is special-cased, do not rely on its layout
+      if (type == kBool_t)
+         return kFALSE;
+      hasHeader = kTRUE;
+      return kTRUE;
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the 'full' name of the branch.  In particular prefix  the mother's name
 /// when it does not end in a trailing dot and thus is not part of the branch name
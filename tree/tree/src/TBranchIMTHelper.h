@@ -16,15 +16,24 @@
 
 #ifdef R__USE_IMT
 #include "ROOT/TTaskGroup.hxx"
+
+#include <atomic>
+#include <deque>
+#include <memory>
 #endif
 
-/** \class ROOT::Internal::TBranchIMTHelper
- A helper class for managing IMT work during TTree:Fill operations.
-*/
+class TBasket;
+class TBranch;
 
 namespace ROOT {
 namespace Internal {
 
+class TAsyncBasketWriter;
+
+/** \class ROOT::Internal::TBranchIMTHelper
+ A helper class for managing IMT work during TTree:Fill operations.
+*/
+
 class TBranchIMTHelper {
 
 #ifdef R__USE_IMT
@@ -32,6 +41,12 @@ using TaskGroup_t = ROOT::Experimental::TTaskGroup;
 #endif
 
 public:
+   TBranchIMTHelper() = default;
+   explicit TBranchIMTHelper(TAsyncBasketWriter *asyncWriter) : fAsyncWriter(asyncWriter) {}
+
+   /// The writer the full baskets are handed to when their compression does not have to finish within TTree::Fill
+   TAsyncBasketWriter *GetAsyncWriter() const { return fAsyncWriter; }
+
    template<typename FN> void Run(const FN &lambda) {
 #ifdef R__USE_IMT
       if (!fGroup) { fGroup.reset(new TaskGroup_t()); }
@@ -60,11 +75,82 @@ public:
 private:
    std::atomic<Long64_t> fBytes{0};   ///< Total number of bytes written by this helper.
    std::atomic<Int_t>    fNerrors{0}; ///< Total error count of all tasks done by this helper.
+   TAsyncBasketWriter   *fAsyncWriter = nullptr; ///< Not owned, nullptr if baskets are written within TTree::Fill
 #ifdef R__USE_IMT
    std::unique_ptr<TaskGroup_t> fGroup;
 #endif
 };
 
+#ifdef R__USE_IMT
+/** \class ROOT::Internal::TAsyncBasketWriter
+ Compresses the baskets that fill up during TTree::Fill in tasks that can outlive the call, see
+ TTree::SetAsyncCompression().
+
+ The tasks only compress the baskets. Writing them to the file and updating their branch happens in the filling
+ thread, in submission order, when FinishCompleted() or FinishAll() is called: the file and the branches are never
+ modified concurrently with the filling thread. The baskets that are being compressed or wait to be written hold at
+ most the memory budget given at construction (or one basket, if it is larger): when a new basket would exceed it,
+ Submit() first waits for all pending baskets and writes them.
+*/
+class TAsyncBasketWriter {
+public:
+   /// A basket detached from its branch, which is compressed by a task and then written by the filling thread
+   struct RPendingWrite {
+      TBranch *fBranch = nullptr;
+      TBasket *fBasket = nullptr;
+      Int_t fWhere = 0;               ///< Index of the basket in its branch
+      Long64_t fBytes = 0;            ///< Size of the uncompressed buffer of the basket
+      Int_t fNout = 0;                ///< Size of the payload to write, -1 if compression failed
+      Bool_t fCompressed = kFALSE;    ///< Whether the payload is compressed
+      std::atomic<bool> fDone{false}; ///< Set by the task once the basket is compressed
+   };
+
+private:
+   using TaskGroup_t = ROOT::Experimental::TTaskGroup;
+
+   Long64_t fMaxBytes;                                 ///< Budget for the buffers of the pending baskets, in bytes
+   Long64_t fBytes = 0;                                ///< Size of the buffers of the pending baskets, in bytes
+   std::deque<std::unique_ptr<RPendingWrite>> fPending; ///< In submission order
+   TaskGroup_t fGroup;
+
+   Int_t Finish(RPendingWrite &write);
+
+public:
+   explicit TAsyncBasketWriter(Long64_t maxBytes) : fMaxBytes(maxBytes) {}
+   TAsyncBasketWriter(const TAsyncBasketWriter &) = delete;
+   TAsyncBasketWriter &operator=(const TAsyncBasketWriter &) = delete;
+   ~TAsyncBasketWriter();
+
+   Long64_t GetMaxBytes() const { return fMaxBytes; }
+   Long64_t GetPendingBytes() const { return fBytes; }
+
+   /// Run `compress(write)` in a task. Returns the number of errors of the pending writes that had to be finished to
+   /// stay within the memory budget.
+   template <typename F>
+   Int_t Submit(std::unique_ptr<RPendingWrite> write, const F &compress)
+   {
+      Int_t nerrors = 0;
+      if (!fPending.empty() && fBytes + write->fBytes > fMaxBytes)
+         nerrors = FinishAll();
+      fBytes += write->fBytes;
+      RPendingWrite *w = write.get();
+      fPending.push_back(std::move(write));
+      fGroup.Run([w, compress]() {
+         compress(*w);
+         w->fDone.store(true, std::memory_order_release);
+      });
+      return nerrors;
+   }
+
+   /// Write the baskets that are compressed, up to the first one that is not. Returns the number of errors.
+   Int_t FinishCompleted();
+   /// Wait for all the pending baskets to be compressed and write them. Returns the number of errors.
+   Int_t FinishAll();
+   /// Wait for all the pending baskets to be compressed and delete them without writing them.
+   void Discard();
+};
+#endif
+
 } // Internal
 } // ROOT
 
@@ -64,6 +64,11 @@ the trees in the chain.
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include <vector>
+#endif
+
 ClassImp(TChain);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -956,12 +961,69 @@ Long64_t TChain::GetEntries() const
                                " run TChain::SetProof(kTRUE, kTRUE) first");
       return fProofChain->GetEntries();
    }
+   if (fEntries == TTree::kMaxEntries) {
+      const_cast<TChain*>(this)->FetchNumberOfEntries();
+   }
    if (fEntries == TTree::kMaxEntries) {
       const_cast<TChain*>(this)->LoadTree(TTree::kMaxEntries-1);
    }
    return fEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the number of entries of the trees of the chain which are not known yet,
+/// with the files opened concurrently, and update the offsets of the trees.
+///
+/// This is only done if implicit multi-threading is enabled, otherwise the
+/// files are opened one after the other by LoadTree(). The files which cannot be
+/// opened, or miss the tree, are left to LoadTree() which reports the error.
+
+void TChain::FetchNumberOfEntries()
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || fProofChain)
+      return;
+
+   // the number of entries known from the elements or from the offsets
+   std::vector<Long64_t> entries(fNtrees, TTree::kMaxEntries);
+   std::vector<Int_t> unknown;
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      auto element = static_cast<TChainElement *>(fFiles->UncheckedAt(i));
+      if (element->GetEntries() != TTree::kMaxEntries)
+         entries[i] = element->GetEntries();
+      else if (fTreeOffset[i] != TTree::kMaxEntries && fTreeOffset[i + 1] != TTree::kMaxEntries)
+         entries[i] = fTreeOffset[i + 1] - fTreeOffset[i];
+      else
+         unknown.push_back(i);
+   }
+   if (unknown.size() < 2)
+      return;
+
+   auto fetch = [&](Int_t i) {
+      auto element = static_cast<TChainElement *>(fFiles->UncheckedAt(i));
+      // the files are closed right away, there is no need to register them
+      TDirectory::TContext ctxt;
+      std::unique_ptr<TFile> file(TFile::Open(element->GetTitle(), "READ_WITHOUT_GLOBALREGISTRATION"));
+      if (!file || file->IsZombie())
+         return;
+      if (auto tree = dynamic_cast<TTree *>(file->Get(element->GetName())))
+         entries[i] = tree->GetEntries();
+   };
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(fetch, unknown);
+
+   for (Int_t i = 0; i < fNtrees; ++i) {
+      if (entries[i] != TTree::kMaxEntries)
+         static_cast<TChainElement *>(fFiles->UncheckedAt(i))->SetNumberEntries(entries[i]);
+      if (fTreeOffset[i] == TTree::kMaxEntries || entries[i] == TTree::kMaxEntries)
+         fTreeOffset[i + 1] = TTree::kMaxEntries;
+      else
+         fTreeOffset[i + 1] = fTreeOffset[i] + entries[i];
+   }
+   fEntries = fTreeOffset[fNtrees];
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get entry from the file to memory.
 ///
@@ -0,0 +1,123 @@
+/*************************************************************************
+ * Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/TDecompressedBasketCache.hxx"
+#include "TFile.h"
+#include "TUUID.h"
+
+#include <cstring>
+#include <functional>
+
+using ROOT::Experimental::TDecompressedBasketCache;
+
+std::size_t TDecompressedBasketCache::RKeyHash::operator()(const RKey &key) const
+{
+   std::size_t hash = std::hash<Long64_t>()(key.fSeek);
+   for (auto byte : key.fUUID)
+      hash = hash * 31 + byte;
+   return hash;
+}
+
+TDecompressedBasketCache &TDecompressedBasketCache::Instance()
+{
+   static TDecompressedBasketCache cache;
+   return cache;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the key of the basket at position `seek` of `file`. Returns false if
+/// the baskets of the file must not be cached: a file that is written to can
+/// reuse the space of deleted baskets.
+
+bool TDecompressedBasketCache::MakeKey(TFile &file, Long64_t seek, RKey &key)
+{
+   if (file.IsWritable())
+      return false;
+   file.GetUUID().GetUUID(key.fUUID.data());
+   key.fSeek = seek;
+   return true;
+}
+
+void TDecompressedBasketCache::Enable(Long64_t maxSize)
+{
+   auto &cache = Instance();
+   std::lock_guard<std::mutex> lock(cache.fMutex);
+   cache.fMaxSize = maxSize > 0 ? maxSize : 0;
+   cache.EvictUntil(cache.fMaxSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the least recently used baskets until the cache holds at most `size`
+/// bytes. Must be called with fMutex locked.
+
+void TDecompressedBasketCache::EvictUntil(Long64_t size)
+{
+   while (fSize > size && !fEntries.empty()) {
+      fSize -= fEntries.back().fSize;
+      fIndex.erase(fEntries.back().fKey);
+      fEntries.pop_back();
+   }
+}
+
+char *TDecompressedBasketCache::Find(TFile &file, Long64_t seek, Int_t &size)
+{
+   RKey key;
+   if (!MakeKey(file, seek, key))
+      return nullptr;
+
+   std::shared_ptr<const char> buffer;
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto it = fIndex.find(key);
+      if (it == fIndex.end()) {
+         ++fNMisses;
+         return nullptr;
+      }
+      fEntries.splice(fEntries.begin(), fEntries, it->second);
+      buffer = it->second->fBuffer;
+      size = it->second->fSize;
+   }
+   ++fNHits;
+
+   // copy outside of the lock: the entry might be evicted meanwhile, but we share the ownership of its buffer
+   char *copy = new char[size];
+   std::memcpy(copy, buffer.get(), size);
+   return copy;
+}
+
+void TDecompressedBasketCache::Insert(TFile &file, Long64_t seek, const char *buffer, Int_t size)
+{
+   RKey key;
+   if (size <= 0 || size > GetMaxSize() || !MakeKey(file, seek, key))
+      return;
+
+   std::shared_ptr<char> copy(new char[size], std::default_delete<char[]>());
+   std::memcpy(copy.get(), buffer, size);
+
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (fIndex.count(key))
+      return; // another thread read the same basket meanwhile
+   fEntries.push_front({key, std::move(copy), size});
+   fIndex.emplace(key, fEntries.begin());
+   fSize += size;
+   EvictUntil(GetMaxSize());
+}
+
+void TDecompressedBasketCache::Clear()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   EvictUntil(0);
+   fNHits = 0;
+   fNMisses = 0;
+}
+
+Long64_t TDecompressedBasketCache::GetSize()
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   return fSize;
+}
@@ -609,6 +609,35 @@ Int_t TEntryList::Contains(Long64_t entry, TTree *tree)
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if at least one of the entries from \#first to \#last (included)
+/// is in the list. As for Contains() without a tree, the current sub-list is
+/// used if the list has sub-lists.
+///
+/// It is used by TTreeCache to prefetch only the baskets holding entries of
+/// the list.
+
+Bool_t TEntryList::ContainsRange(Long64_t first, Long64_t last)
+{
+   if (fLists) {
+      if (!fCurrent) fCurrent = (TEntryList*)fLists->First();
+      return fCurrent->ContainsRange(first, last);
+   }
+   if (!fBlocks) return kFALSE;
+   if (first < 0) first = 0;
+   while (first <= last) {
+      const Long64_t nblock = first/kBlockSize;
+      if (nblock >= fNBlocks) return kFALSE;
+      const Long64_t blockStart = nblock*kBlockSize;
+      const Long64_t blockLast = TMath::Min(last, blockStart + kBlockSize - 1);
+      TEntryListBlock *block = (TEntryListBlock*)fBlocks->UncheckedAt(nblock);
+      if (block->ContainsRange(first - blockStart, blockLast - blockStart))
+         return kTRUE;
+      first = blockLast + 1;
+   }
+   return kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by TKey and others to automatically add us to a directory when we are read from a file.
 
@@ -1335,13 +1364,19 @@ void TEntryList::Subtract(const TEntryList *elist)
          //second list is also only for 1 tree
          if (!strcmp(elist->fTreeName.Data(),fTreeName.Data()) &&
              !strcmp(elist->fFileName.Data(),fFileName.Data())){
-            //same tree
-            Long64_t n2 = elist->GetN();
-            Long64_t entry;
-            for (Int_t i=0; i<n2; i++){
-               entry = (const_cast<TEntryList*>(elist))->GetEntry(i);
-               Remove(entry);
+            //same tree, subtract block by block
+            if (!elist->fBlocks) return;
+            Int_t nmin = TMath::Min(fNBlocks, elist->fNBlocks);
+            Long64_t nnew, nold;
+            for (Int_t i=0; i<nmin; i++){
+               TEntryListBlock *block1 = (TEntryListBlock*)fBlocks->UncheckedAt(i);
+               TEntryListBlock *block2 = (TEntryListBlock*)elist->fBlocks->UncheckedAt(i);
+               nold = block1->GetNPassed();
+               nnew = block1->Subtract(block2);
+               fN = fN - nold + nnew;
             }
+            fLastIndexQueried = -1;
+            fLastIndexReturned = 0;
          } else {
             //different trees
             return;
@@ -38,6 +38,9 @@ End_Macro
  - __Merge__() - adds all entries from one block to the other. If the first block
              uses array representation, it's changed to bits representation only
              if the total number of passing entries is still less than kBlockSize
+ - __Subtract__() - removes all entries of the other block from this one.
+                In bits representation both Merge() and Subtract() work on whole
+                words rather than on single entries.
  - __GetEntry(n)__ - returns n-th non-zero entry.
  - __Next__()      - return next non-zero entry. In case of representation 1), Next()
                  is faster than GetEntry()
@@ -46,8 +49,57 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+
 ClassImp(TEntryListBlock);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of bits set in `word`.
+
+inline Int_t CountBits(UInt_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_popcount(word);
+#else
+   Int_t n = 0;
+   for (; word; word &= word - 1)
+      ++n;
+   return n;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Number of bits set in the `n` words starting at `words`.
+
+Int_t CountBits(const UShort_t *words, Int_t n)
+{
+   Int_t count = 0;
+   for (Int_t i = 0; i < n; ++i)
+      count += CountBits(words[i]);
+   return count;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Index of the lowest bit set in `word`, which must not be 0.
+
+inline Int_t LowestBit(UInt_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+   return __builtin_ctz(word);
+#else
+   Int_t i = 0;
+   while (!(word & 1)) {
+      word >>= 1;
+      ++i;
+   }
+   return i;
+#endif
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default c-tor
 
@@ -206,34 +258,59 @@ Int_t TEntryListBlock::Contains(Int_t entry)
       Bool_t result = (fIndices[i] & (1<<j))!=0;
       return result;
    }
-   //list
-   if (entry < fCurrent) fCurrent = 0;
-   if (fPassing && fIndices){
-      for (Int_t i = fCurrent; i<fNPassed; i++){
-         if (fIndices[i]==entry){
-            fCurrent = i;
-            return kTRUE;
-         }
-      }
-   } else {
-      if (!fIndices || fNPassed==0){
-         //all entries pass
-         return kTRUE;
-      }
-      if (entry > fIndices[fNPassed-1])
-         return kTRUE;
-      for (Int_t i= fCurrent; i<fNPassed; i++){
-         if (fIndices[i]==entry){
-            fCurrent = i;
-            return kFALSE;
-         }
-         if (fIndices[i]>entry){
-            fCurrent = i;
+   //list, sorted: binary search, starting from the last position found if
+   //the entries are queried in increasing order
+   if (!fPassing && (!fIndices || fNPassed==0)){
+      //all entries pass
+      return kTRUE;
+   }
+   UShort_t *begin = fIndices;
+   if (fCurrent < fNPassed && fIndices[fCurrent] <= entry)
+      begin += fCurrent;
+   UShort_t *found = std::lower_bound(begin, fIndices + fNPassed, entry);
+   if (found != fIndices + fNPassed)
+      fCurrent = found - fIndices;
+   const Bool_t listed = found != fIndices + fNPassed && *found == entry;
+   return fPassing ? listed : !listed;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// True if the block contains at least one of the entries from \#first to \#last
+/// (included). Unlike calling Contains() for each entry, this does not depend on
+/// the number of entries of the block in list mode.
+
+Bool_t TEntryListBlock::ContainsRange(Int_t first, Int_t last)
+{
+   if (first < 0)
+      first = 0;
+   if (last >= kBlockSize*16)
+      last = kBlockSize*16 - 1;
+   if (first > last)
+      return kFALSE;
+   if (!fIndices)
+      return !fPassing;
+   if (fType==0) {
+      //bits, one word at a time
+      const Int_t ifirst = first>>4;
+      const Int_t ilast = last>>4;
+      for (Int_t i = ifirst; i <= ilast; ++i) {
+         UInt_t word = fIndices[i];
+         if (i == ifirst)
+            word &= 0xFFFFu << (first & 15);
+         if (i == ilast)
+            word &= 0xFFFFu >> (15 - (last & 15));
+         if (word)
             return kTRUE;
-         }
       }
+      return kFALSE;
    }
-   return 0;
+   //list, sorted
+   UShort_t *begin = std::lower_bound(fIndices, fIndices + fNPassed, first);
+   UShort_t *end = std::upper_bound(begin, fIndices + fNPassed, last);
+   if (fPassing)
+      return begin != end;
+   // fIndices holds the entries that are not in the list
+   return (end - begin) < (last - first + 1);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -246,6 +323,8 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    if (block->GetNPassed() == 0) return GetNPassed();
    if (GetNPassed() == 0){
       //this block is empty
+      if (fIndices)
+         delete [] fIndices;
       fN = block->fN;
       fIndices = new UShort_t[fN];
       for (i=0; i<fN; i++)
@@ -260,34 +339,23 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    }
    if (fType==0){
       //stored as bits
-      if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
+      if (block->fType == 1 && block->fPassing){
+         //the other block stores entries that pass
+         for (i=0; i<block->fNPassed; i++){
+            Enter(block->fIndices[i]);
          }
       } else {
-         if (block->fPassing){
-            //the other block stores entries that pass
-            for (i=0; i<block->fNPassed; i++){
-               Enter(block->fIndices[i]);
-            }
-         } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
-               }
-            }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
+         //union of the words
+         UShort_t *bits = block->fIndices;
+         if (block->fType != 0) {
+            bits = new UShort_t[kBlockSize];
+            block->FillBits(bits);
          }
+         for (i=0; i<kBlockSize; i++)
+            fIndices[i] |= bits[i];
+         if (bits != block->fIndices)
+            delete [] bits;
+         fNPassed = CountBits(fIndices, kBlockSize);
       }
    } else {
       //stored as a list
@@ -313,7 +381,7 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
                   newpos++;
                   elpos++;
                }
-               if (fIndices[i] == elst[elpos]) elpos++;
+               if (elpos < en && fIndices[i] == elst[elpos]) elpos++;
                newlist[newpos] = fIndices[i];
                newpos++;
             }
@@ -334,16 +402,18 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
             UShort_t *newlist = new UShort_t[newsize];
             Int_t newpos, current;
             newpos = current = 0;
-            for (i=0; i<kBlockSize*16; i++){
-               if (!block->Contains(i)) continue;
-               while(current < fNPassed && fIndices[current]<i){
-                  newlist[newpos] = fIndices[current];
-                  current++;
+            for (i=0; i<kBlockSize; i++){
+               for (UInt_t word = block->fIndices[i]; word; word &= word - 1){
+                  j = i*16 + LowestBit(word);
+                  while(current < fNPassed && fIndices[current]<j){
+                     newlist[newpos] = fIndices[current];
+                     current++;
+                     newpos++;
+                  }
+                  if (current < fNPassed && fIndices[current]==j) current++;
+                  newlist[newpos] = j;
                   newpos++;
                }
-               if (fIndices[current]==i) current++;
-               newlist[newpos] = i;
-               newpos++;
             }
             while(current<fNPassed){
                newlist[newpos] = fIndices[current];
@@ -363,6 +433,68 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    return GetNPassed();
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Remove from this block all the entries of the other block
+/// Returns the resulting number of entries in the block
+
+Int_t TEntryListBlock::Subtract(TEntryListBlock *block)
+{
+   if (block->GetNPassed() == 0 || GetNPassed() == 0) return GetNPassed();
+   if (fType != 0){
+      //change to bits
+      UShort_t *bits = new UShort_t[kBlockSize];
+      Transform(1, bits);
+   }
+   if (block->fType == 1 && block->fPassing){
+      //the other block stores entries that pass
+      for (Int_t i=0; i<block->fNPassed; i++){
+         const Int_t entry = block->fIndices[i];
+         fIndices[entry>>4] &= ~(1<<(entry & 15));
+      }
+   } else {
+      UShort_t *bits = block->fIndices;
+      if (block->fType != 0) {
+         bits = new UShort_t[kBlockSize];
+         block->FillBits(bits);
+      }
+      for (Int_t i=0; i<kBlockSize; i++)
+         fIndices[i] &= ~bits[i];
+      if (bits != block->fIndices)
+         delete [] bits;
+   }
+   fNPassed = CountBits(fIndices, kBlockSize);
+   fLastIndexQueried = -1;
+   fLastIndexReturned = -1;
+   OptimizeStorage();
+   return GetNPassed();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill `bits` (kBlockSize words) with the bits representation of this block
+
+void TEntryListBlock::FillBits(UShort_t *bits) const
+{
+   Int_t i;
+   if (fType==0 && fIndices){
+      std::copy(fIndices, fIndices + kBlockSize, bits);
+      return;
+   }
+   if (fType!=1 || !fIndices){
+      //no storage: either empty or all entries pass
+      std::fill(bits, bits + kBlockSize, fPassing ? 0 : 0xFFFF);
+      return;
+   }
+   if (fPassing){
+      std::fill(bits, bits + kBlockSize, 0);
+      for (i=0; i<fNPassed; i++)
+         bits[fIndices[i]>>4] |= 1<<(fIndices[i] & 15);
+   } else {
+      std::fill(bits, bits + kBlockSize, 0xFFFF);
+      for (i=0; i<fNPassed; i++)
+         bits[fIndices[i]>>4] &= ~(1<<(fIndices[i] & 15));
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the number of entries, passing the selection.
 /// In case, when the block stores entries that pass (fPassing=1) returns fNPassed
@@ -382,21 +514,21 @@ Int_t TEntryListBlock::GetNPassed()
 Int_t TEntryListBlock::GetEntry(Int_t entry)
 {
    if (entry > kBlockSize*16) return -1;
-   if (entry > GetNPassed()) return -1;
+   if (entry >= GetNPassed()) return -1;
    if (entry == fLastIndexQueried+1) return Next();
    else {
-      Int_t i=0; Int_t j=0; Int_t entries_found=0;
+      Int_t i=0; Int_t entries_found=0;
       if (fType==0){
-         if ((fIndices[i] & (1<<j))!=0)
-            entries_found++;
-         while (entries_found<entry+1){
-            if (j==15){i++; j=0;}
-            else j++;
-            if ((fIndices[i] & (1<<j))!=0)
-               entries_found++;
+         //skip the whole words before the one holding the entry
+         while (entries_found + CountBits(fIndices[i]) <= entry){
+            entries_found += CountBits(fIndices[i]);
+            i++;
          }
+         UInt_t word = fIndices[i];
+         for (; entries_found<entry; entries_found++)
+            word &= word - 1;
          fLastIndexQueried = entry;
-         fLastIndexReturned = i*16+j;
+         fLastIndexReturned = i*16+LowestBit(word);
          return fLastIndexReturned;
       }
       if (fType==1){
@@ -411,29 +543,12 @@ Int_t TEntryListBlock::GetEntry(Int_t entry)
                fLastIndexReturned = entry;
                return fLastIndexReturned;
             }
-            for (i=0; i<fIndices[0]; i++){
-               entries_found++;
-               if (entries_found==entry+1){
-                  fLastIndexReturned = i;
-                  return fLastIndexReturned;
-               }
-            }
-            for (i=0; i<fNPassed-1; i++){
-               for (j=fIndices[i]+1; j<fIndices[i+1]; j++){
-                  entries_found++;
-                  if (entries_found==entry+1){
-                     fLastIndexReturned = j;
-                     return fLastIndexReturned;
-                  }
-               }
-            }
-            for (j=fIndices[fNPassed-1]+1; j<kBlockSize*16; j++){
-               entries_found++;
-               if (entries_found==entry+1){
-                  fLastIndexReturned = j;
-                  return fLastIndexReturned;
-               }
-            }
+            //fIndices holds the sorted entries that don't pass: each of them
+            //below the result shifts it by one
+            while (i < fNPassed && fIndices[i] <= entry + i)
+               i++;
+            fLastIndexReturned = entry + i;
+            return fLastIndexReturned;
          }
       }
       return -1;
@@ -453,19 +568,13 @@ Int_t TEntryListBlock::Next()
    }
 
    if (fType==0) {
-      //bits
-      Int_t i=0;
-      Int_t j=0;
-      fLastIndexReturned++;
-      i = fLastIndexReturned>>4;
-      j = fLastIndexReturned & 15;
-      Bool_t result=(fIndices[i] & (1<<j))!=0;
-      while (!result) {
-         if (j==15) {j=0; i++;}
-         else j++;
-         result = (fIndices[i] & (1<<j)) != 0;
-      }
-      fLastIndexReturned = i*16+j;
+      //bits, skipping the empty words
+      const Int_t first = fLastIndexReturned + 1;
+      Int_t i = first>>4;
+      UInt_t word = fIndices[i] & (0xFFFFu << (first & 15));
+      while (!word)
+         word = fIndices[++i];
+      fLastIndexReturned = i*16+LowestBit(word);
       fLastIndexQueried++;
       return fLastIndexReturned;
 
@@ -567,18 +676,11 @@ void TEntryListBlock::Transform(Bool_t dir, UShort_t *indexnew)
    Int_t ilist = 0;
    Int_t ibite, ibit;
    if (!dir) {
-         for (i=0; i<kBlockSize*16; i++){
-            ibite = i >> 4;
-            ibit = i & 15;
-            Bool_t result = (fIndices[ibite] & (1<<ibit))!=0;
-            if (result && fPassing){
-               //fill with the entries that pass
-               indexnew[ilist] = i;
-               ilist++;
-            }
-            else if (!result && !fPassing){
-               //fill with the entries that don't pass
-               indexnew[ilist] = i;
+         for (ibite=0; ibite<kBlockSize; ibite++){
+            //fill with the entries that pass, or with the ones that don't
+            UInt_t word = fPassing ? fIndices[ibite] : (~fIndices[ibite] & 0xFFFFu);
+            for (; word; word &= word - 1){
+               indexnew[ilist] = ibite*16 + LowestBit(word);
                ilist++;
             }
          }
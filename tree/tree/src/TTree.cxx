@@ -367,6 +367,7 @@ End_Macro
 #include <ROOT/RConfig.hxx>
 #include "TTree.h"
 
+#include "ROOT/TBasketBufferPool.hxx"
 #include "ROOT/TIOFeatures.hxx"
 #include "TArrayC.h"
 #include "TBufferFile.h"
@@ -441,6 +442,7 @@ End_Macro
 #include <cstdio>
 #include <climits>
 #include <algorithm>
+#include <functional>
 #include <set>
 
 #ifdef R__USE_IMT
@@ -920,6 +922,11 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 
 TTree::~TTree()
 {
+#ifdef R__USE_IMT
+   // the baskets that are still being compressed are dropped, as are the ones still attached to the branches
+   delete fAsyncBasketWriter;
+   fAsyncBasketWriter = nullptr;
+#endif
    if (auto link = dynamic_cast<TNotifyLinkBase*>(fNotify)) {
       link->Clear();
    }
@@ -1027,7 +1034,7 @@ TTree::~TTree()
    fClusterSize = 0;
 
    if (fTransientBuffer) {
-      delete fTransientBuffer;
+      ROOT::Internal::TBasketBufferPool::Release(fTransientBuffer);
       fTransientBuffer = 0;
    }
 }
@@ -1043,6 +1050,13 @@ TBuffer* TTree::GetTransientBuffer(Int_t size)
       }
       return fTransientBuffer;
    }
+   fTransientBuffer = ROOT::Internal::TBasketBufferPool::Acquire(size);
+   if (fTransientBuffer) {
+      fTransientBuffer->SetReadMode();
+      if (fTransientBuffer->BufferSize() < size)
+         fTransientBuffer->Expand(size);
+      return fTransientBuffer;
+   }
    fTransientBuffer = new TBufferFile(TBuffer::kRead, size);
    return fTransientBuffer;
 }
@@ -2697,6 +2711,40 @@ Bool_t TTree::EnableCache()
    return (0 == SetCacheSizeAux(kTRUE, -1));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Train a ZSTD compression dictionary for each of the branches of the tree
+/// from their first `nbaskets` baskets, and compress their following baskets
+/// with it. This mostly helps trees with many small baskets.
+/// Only the branches that already exist are affected, see
+/// TBranch::EnableCompressionDictionary().
+
+void TTree::EnableCompressionDictionary(Int_t nbaskets)
+{
+   Int_t nb = fBranches.GetEntriesFast();
+   for (Int_t i = 0; i < nb; ++i) {
+      TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+      branch->EnableCompressionDictionary(nbaskets);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Select the compression algorithm and level of each of the branches of the
+/// tree from trial compressions of their first `nbaskets` baskets: the
+/// smallest output among the candidates that decompress at `minReadSpeed`
+/// MB/s or more is kept. A tree with both tiny integer and large floating
+/// point branches thus gets fitting settings for both.
+/// Only the branches that already exist are affected, see
+/// TBranch::EnableCompressionTuning().
+
+void TTree::EnableCompressionTuning(Double_t minReadSpeed, Int_t nbaskets)
+{
+   Int_t nb = fBranches.GetEntriesFast();
+   for (Int_t i = 0; i < nb; ++i) {
+      TBranch *branch = (TBranch*)fBranches.UncheckedAt(i);
+      branch->EnableCompressionTuning(minReadSpeed, nbaskets);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Called by TTree::Fill() when file has reached its maximum fgMaxTreeSize.
 /// Create a new file. If the original file is named "myfile.root",
@@ -3941,6 +3989,11 @@ Long64_t TTree::Draw(const char* varexp, const TCut& selection, Option_t* option
 ///    - if expression has more than four fields the option "PARA"or "CANDLE"
 ///      can be used.
 ///    - If option contains the string "goff", no graphics is generated.
+///    - If option contains the string "mt" and implicit multi-threading is
+///      enabled (ROOT::EnableImplicitMT()), the clusters of the tree are
+///      processed in parallel. This requires a 1D or 2D histogram with fixed
+///      axes, i.e. `"x>>h(100,0,10)"` or an existing histogram `"x>>h"`, and a
+///      tree read from files. Otherwise the entries are processed sequentially.
 /// \endparblock
 /// \param [in] nentries The number of entries to process (default is all)
 /// \param [in] firstentry The first entry to process (default is 0)
@@ -4515,6 +4568,7 @@ Long64_t TTree::Draw(const char* varexp, const char* selection, Option_t* option
 
 void TTree::DropBaskets()
 {
+   FinishAsyncBasketWrites();
    TBranch* branch = 0;
    Int_t nb = fBranches.GetEntriesFast();
    for (Int_t i = 0; i < nb; ++i) {
@@ -4615,12 +4669,17 @@ Int_t TTree::Fill()
 
 #ifdef R__USE_IMT
    const auto useIMT = ROOT::IsImplicitMTEnabled() && fIMTEnabled;
-   ROOT::Internal::TBranchIMTHelper imtHelper;
+   if (useIMT && fAsyncCompressionBudget > 0 && !fAsyncBasketWriter)
+      fAsyncBasketWriter = new ROOT::Internal::TAsyncBasketWriter(fAsyncCompressionBudget);
+   ROOT::Internal::TBranchIMTHelper imtHelper(useIMT ? fAsyncBasketWriter : nullptr);
    if (useIMT) {
       fIMTFlush = true;
       fIMTZipBytes.store(0);
       fIMTTotBytes.store(0);
    }
+   // write the baskets that were compressed since the last entry
+   if (fAsyncBasketWriter)
+      nerror += fAsyncBasketWriter->FinishCompleted();
 #endif
 
    for (Int_t i = 0; i < nbranches; ++i) {
@@ -4706,7 +4765,7 @@ Int_t TTree::Fill()
             // When we are in one-basket-per-cluster mode, there is no need to optimize basket:
             // they will automatically grow to the size needed for an event cluster (with the basket
             // shrinking preventing them from growing too much larger than the actually-used space).
-            if (!TestBit(TTree::kOnlyFlushAtCluster)) {
+            if (!TestBit(TTree::kOnlyFlushAtCluster) && fAdaptiveBasketZipBytes == 0) {
                OptimizeBaskets(GetTotBytes(), 1, "");
                if (gDebug > 0)
                   Info("TTree::Fill", "OptimizeBaskets called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n",
@@ -4714,6 +4773,8 @@ Int_t TTree::Fill()
             }
             fFlushedBytes = GetZipBytes();
             fAutoFlush = fEntries; // Use test on entries rather than bytes
+            if (fAdaptiveBasketZipBytes || fAdaptiveClusterZipBytes)
+               AdaptBasketSizes();
 
             // subsequently in run
             if (fAutoSave < 0) {
@@ -4750,8 +4811,12 @@ Int_t TTree::Fill()
                autoFlush = (fEntries - (fClusterRangeEnd[fNClusterRange - 1] + 1)) % fAutoFlush == 0;
          }
          // Check if we need to auto save
-         if (fAutoSave)
-            autoSave = fEntries % fAutoSave == 0;
+         if (fAutoSave) {
+            if (fAdaptiveClusterZipBytes == 0)
+               autoSave = fEntries % fAutoSave == 0;
+            else // the clusters do not start at multiples of fAutoFlush: save at the end of the cluster instead
+               autoSave = autoFlush && fEntries / fAutoSave != (fEntries - fAutoFlush) / fAutoSave;
+         }
       }
    }
 
@@ -4761,6 +4826,8 @@ Int_t TTree::Fill()
          Info("TTree::Fill", "FlushBaskets() called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n", fEntries,
               GetZipBytes(), fFlushedBytes);
       fFlushedBytes = GetZipBytes();
+      if (fAdaptiveBasketZipBytes || fAdaptiveClusterZipBytes)
+         AdaptBasketSizes();
    }
 
    if (autoSave) {
@@ -5145,7 +5212,7 @@ Int_t TTree::FlushBasketsImpl() const
 {
    if (!fDirectory) return 0;
    Int_t nbytes = 0;
-   Int_t nerror = 0;
+   Int_t nerror = FinishAsyncBasketWrites();
    TObjArray *lb = const_cast<TTree*>(this)->GetListOfBranches();
    Int_t nb = lb->GetEntriesFast();
 
@@ -5197,7 +5264,7 @@ Int_t TTree::FlushBasketsImpl() const
       const_cast<TTree*>(this)->AddTotBytes(fIMTTotBytes);
       const_cast<TTree*>(this)->AddZipBytes(fIMTZipBytes);
 
-      return nerrpar ? -1 : nbpar.load();
+      return (nerror || nerrpar) ? -1 : nbpar.load();
    }
 #endif
    for (Int_t j = 0; j < nb; j++) {
@@ -5218,6 +5285,19 @@ Int_t TTree::FlushBasketsImpl() const
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the baskets that are compressed asynchronously (see
+/// SetAsyncCompression()) and write them. Returns the number of errors.
+
+Int_t TTree::FinishAsyncBasketWrites() const
+{
+#ifdef R__USE_IMT
+   if (fAsyncBasketWriter)
+      return fAsyncBasketWriter->FinishAll();
+#endif
+   return 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns the expanded value of the alias.  Search in the friends if any.
 
@@ -6997,6 +7077,86 @@ void TTree::MoveReadCache(TFile *src, TDirectory *dir)
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Append the entries of `fromtree` to this tree by referencing its baskets
+/// instead of copying them.
+///
+/// The baskets of `fromtree` must already be stored in the file of this tree,
+/// at their position in the file of `fromtree` shifted by `seekOffset`. This is
+/// the case if the records of the file of `fromtree` were copied as a block into
+/// the file of this tree, e.g. by the workers of a TMPIFile in direct write mode.
+/// Both trees must have the same branch structure and all the entries of
+/// `fromtree` must be in flushed baskets.
+///
+/// \return the number of imported entries, or -1 (and the tree is unchanged)
+///         if the trees do not match.
+
+Long64_t TTree::ImportBaskets(TTree *fromtree, Long64_t seekOffset)
+{
+   if (!fromtree)
+      return -1;
+
+   // Check the whole structure first, so that nothing is modified if the trees do not match
+   std::function<Bool_t(TObjArray *, TObjArray *)> fnCanImport = [&](TObjArray *to, TObjArray *from) -> Bool_t {
+      if (to->GetEntriesFast() != from->GetEntriesFast())
+         return kFALSE;
+      for (Int_t i = 0; i < to->GetEntriesFast(); ++i) {
+         TBranch *tobranch = static_cast<TBranch *>(to->UncheckedAt(i));
+         TBranch *frombranch = static_cast<TBranch *>(from->UncheckedAt(i));
+         if (strcmp(tobranch->GetName(), frombranch->GetName()) != 0)
+            return kFALSE;
+         for (TBranch *b : {tobranch, frombranch}) {
+            TBasket *basket = static_cast<TBasket *>(b->fBaskets.At(b->fWriteBasket));
+            if (basket && basket->GetNevBuf() > 0)
+               return kFALSE;
+         }
+         if (!fnCanImport(tobranch->GetListOfBranches(), frombranch->GetListOfBranches()))
+            return kFALSE;
+      }
+      return kTRUE;
+   };
+   if (!fnCanImport(GetListOfBranches(), fromtree->GetListOfBranches())) {
+      Error("ImportBaskets", "The branches of %s do not match or have entries in memory", fromtree->GetName());
+      return -1;
+   }
+
+   const Long64_t startEntry = fEntries;
+   std::function<void(TObjArray *, TObjArray *)> fnImport = [&](TObjArray *to, TObjArray *from) {
+      for (Int_t i = 0; i < to->GetEntriesFast(); ++i) {
+         TBranch *tobranch = static_cast<TBranch *>(to->UncheckedAt(i));
+         TBranch *frombranch = static_cast<TBranch *>(from->UncheckedAt(i));
+         // The empty write basket is replaced, as in TBranch::AddBasket
+         delete tobranch->fBaskets.At(tobranch->fWriteBasket);
+         tobranch->fBaskets.AddAt(nullptr, tobranch->fWriteBasket);
+         for (Int_t j = 0; j < frombranch->fWriteBasket; ++j) {
+            if (tobranch->fWriteBasket >= tobranch->fMaxBaskets)
+               tobranch->ExpandBasketArrays();
+            const Int_t where = tobranch->fWriteBasket;
+            tobranch->fBasketBytes[where] = frombranch->fBasketBytes[j];
+            tobranch->fBasketEntry[where] = startEntry + frombranch->fBasketEntry[j];
+            tobranch->fBasketSeek[where] = frombranch->fBasketSeek[j] + seekOffset;
+            tobranch->fBaskets.AddAtAndExpand(nullptr, where);
+            ++tobranch->fWriteBasket;
+         }
+         if (tobranch->fWriteBasket >= tobranch->fMaxBaskets)
+            tobranch->ExpandBasketArrays();
+         tobranch->fBasketEntry[tobranch->fWriteBasket] = startEntry + frombranch->fEntries;
+         tobranch->fEntries += frombranch->fEntries;
+         tobranch->fEntryNumber += frombranch->fEntries;
+         tobranch->fTotBytes += frombranch->fTotBytes;
+         tobranch->fZipBytes += frombranch->fZipBytes;
+         AddTotBytes(frombranch->fTotBytes);
+         AddZipBytes(frombranch->fZipBytes);
+         fnImport(tobranch->GetListOfBranches(), frombranch->GetListOfBranches());
+      }
+   };
+
+   ImportClusterRanges(fromtree);
+   fnImport(GetListOfBranches(), fromtree->GetListOfBranches());
+   fEntries += fromtree->GetEntries();
+   return fromtree->GetEntries();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy the content to a new new file, update this TTree with the new
 /// location information and attach this TTree to the new directory.
@@ -7168,6 +7328,84 @@ void TTree::OptimizeBaskets(ULong64_t maxMemory, Float_t minComp, Option_t *opti
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Adapt the basket sizes of the branches and the cluster size to the entries
+/// written since the previous call, see SetAdaptiveBasketSizes(). Called by
+/// Fill() after the baskets of a cluster have been flushed.
+
+void TTree::AdaptBasketSizes()
+{
+   const Long64_t nEntries = fEntries - fAdaptiveEntries;
+   const Long64_t zipBytes = GetZipBytes() - fAdaptiveZipBytes;
+   if (nEntries <= 0)
+      return;
+
+   // Changes smaller than this fraction of the current size are ignored, to
+   // avoid creating a new cluster range or reallocating the baskets for noise.
+   const Double_t kTolerance = 0.1;
+
+   if (fAdaptiveClusterZipBytes > 0 && fAutoFlush > 0 && zipBytes > 0) {
+      const Long64_t clusterSize =
+         TMath::Max(Long64_t(1), Long64_t(Double_t(fAdaptiveClusterZipBytes) * nEntries / zipBytes));
+      if (TMath::Abs(clusterSize - fAutoFlush) > kTolerance * fAutoFlush) {
+         if (fPerfStats)
+            fPerfStats->ClusterSizeEvent(this, fEntries, fAutoFlush, clusterSize);
+         if (gDebug > 0)
+            Info("AdaptBasketSizes", "Changing cluster size from %lld to %lld entries at entry %lld", fAutoFlush,
+                 clusterSize, fEntries);
+         SetAutoFlush(clusterSize);
+      }
+   }
+
+   // With one basket per cluster, the baskets already grow to the size of the cluster.
+   if (fAdaptiveBasketZipBytes > 0 && !TestBit(kOnlyFlushAtCluster)) {
+      const Long64_t clusterSize = fAutoFlush > 0 ? fAutoFlush : nEntries;
+      const Int_t nleaves = fLeaves.GetEntriesFast();
+      fAdaptiveLeafBytes.resize(nleaves, {{0, 0, 0}});
+      TBranch *previous = nullptr;
+      for (Int_t i = 0; i < nleaves; ++i) {
+         TBranch *branch = static_cast<TLeaf *>(fLeaves.UncheckedAt(i))->GetBranch();
+         auto &last = fAdaptiveLeafBytes[i];
+         const Long64_t branchEntries = branch->GetEntries() - last[0];
+         const Double_t totBytes = branch->GetTotBytes() - last[1];
+         const Double_t branchZipBytes = branch->GetZipBytes() - last[2];
+         last = {{branch->GetEntries(), branch->GetTotBytes(), branch->GetZipBytes()}};
+         // the leaves of a leaf list share their branch; the baskets of a parent branch only hold its
+         // own data members, which OptimizeBaskets() does not resize either
+         if (branch == previous || branch->GetListOfBranches()->GetEntriesFast() > 0 || branchEntries <= 0 ||
+             totBytes <= 0)
+            continue;
+         previous = branch;
+
+         // Keep all the entries of the cluster in one basket, unless this makes the compressed basket larger
+         // than the target: small branches are then read with one request per cluster, large ones in
+         // requests of about fAdaptiveBasketZipBytes.
+         const Double_t entrySize = totBytes / branchEntries;
+         const Double_t compression = branchZipBytes > 0 ? totBytes / branchZipBytes : 1;
+         Double_t bsize = TMath::Min(entrySize * clusterSize, fAdaptiveBasketZipBytes * compression);
+         // room for the entries that do not fill the basket exactly, rounded up like in OptimizeBaskets()
+         bsize = bsize * fTargetMemoryRatio + entrySize;
+         static const Double_t hardmax = 1 * 1024 * 1024 * 1024;
+         bsize = TMath::Min(TMath::Max(bsize, 512.), hardmax);
+         Int_t newBsize = Int_t(bsize);
+         newBsize = newBsize - newBsize % 512 + 512;
+
+         const Int_t oldBsize = branch->GetBasketSize();
+         if (TMath::Abs(newBsize - oldBsize) <= kTolerance * oldBsize)
+            continue;
+         if (fPerfStats)
+            fPerfStats->BasketSizeEvent(branch, fEntries, oldBsize, newBsize);
+         if (gDebug > 0)
+            Info("AdaptBasketSizes", "Changing buffer size from %6d to %6d bytes for %s at entry %lld", oldBsize,
+                 newBsize, branch->GetName(), fEntries);
+         branch->SetBasketSize(newBsize);
+      }
+   }
+
+   fAdaptiveEntries = fEntries;
+   fAdaptiveZipBytes = GetZipBytes();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interface to the Principal Components Analysis class.
 ///
@@ -8000,6 +8238,10 @@ void TTree::RemoveFriend(TTree* oldFriend)
 
 void TTree::Reset(Option_t* option)
 {
+#ifdef R__USE_IMT
+   if (fAsyncBasketWriter)
+      fAsyncBasketWriter->Discard();
+#endif
    fNotify        = 0;
    fEntries       = 0;
    fNClusterRange = 0;
@@ -8008,6 +8250,9 @@ void TTree::Reset(Option_t* option)
    fFlushedBytes  = 0;
    fSavedBytes    = 0;
    fTotalBuffers  = 0;
+   fAdaptiveEntries = 0;
+   fAdaptiveZipBytes = 0;
+   fAdaptiveLeafBytes.clear();
    fChainOffset   = 0;
    fReadEntry     = -1;
 
@@ -8038,6 +8283,9 @@ void TTree::ResetAfterMerge(TFileMergeInfo *info)
    fSavedBytes    = 0;
    fFlushedBytes  = 0;
    fTotalBuffers  = 0;
+   fAdaptiveEntries = 0;
+   fAdaptiveZipBytes = 0;
+   fAdaptiveLeafBytes.clear();
    fChainOffset   = 0;
    fReadEntry     = -1;
 
@@ -8317,6 +8565,72 @@ Long64_t TTree::GetMedianClusterSize()
    return medianClusterSize;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Adapt the basket sizes and the cluster size continuously while the tree is
+/// filled, from the entry sizes and compression factors observed per branch.
+///
+/// By default, OptimizeBaskets() is called once at the first automatic flush
+/// (see SetAutoFlush()), and then the basket sizes and the number of entries
+/// per cluster stay fixed. With this option, they are recomputed at the end of
+/// every cluster from the entries written in it:
+///   - the basket size of each branch is chosen such that one basket holds all
+///     the entries of the branch in a cluster if its compressed size is less
+///     than `basketZipBytes`, and such that its compressed size is about
+///     `basketZipBytes` otherwise. Branches of small entries (e.g. flags) are
+///     then read with one request per cluster, and branches of large entries
+///     (e.g. arrays) with requests of a size independent of the cluster size.
+///   - the number of entries per cluster is chosen such that a cluster has
+///     about `clusterZipBytes` compressed bytes. This requires the clusters to
+///     be defined by a number of entries (the default, with a negative value of
+///     SetAutoFlush()). Then, the automatic saves (see SetAutoSave()) happen at
+///     the end of the cluster during which the multiple of fAutoSave entries is
+///     reached.
+///
+/// Changes of less than 10% are ignored. The changes are reported to the
+/// TTreePerfStats of the tree (see SetPerfStats() and TTreePerfStats::Print()
+/// with option "sizes"), if any.
+///
+/// A value of 0 disables the corresponding adaptation; both 0 (the default)
+/// restore the OptimizeBaskets() behaviour.
+
+void TTree::SetAdaptiveBasketSizes(Int_t basketZipBytes /* = 100000 */, Long64_t clusterZipBytes /* = 30000000 */)
+{
+   fAdaptiveBasketZipBytes = basketZipBytes > 0 ? basketZipBytes : 0;
+   fAdaptiveClusterZipBytes = clusterZipBytes > 0 ? clusterZipBytes : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the baskets that fill up during Fill() in the background, without
+/// waiting for them within Fill().
+///
+/// With implicit multi-threading enabled (see ROOT::EnableImplicitMT() and
+/// SetImplicitMT()), Fill() compresses the baskets that are full in parallel
+/// tasks, but it waits for these tasks before returning. With a non-zero
+/// `maxPendingBytes`, these tasks continue to run while the next entries are
+/// filled. The compressed baskets are written to the file by the following
+/// calls to Fill() and at the latest by FlushBaskets() (and therefore Write(),
+/// AutoSave() and the automatic flushes): in between, the baskets being
+/// compressed are not attached to their branch and its entries cannot be read.
+///
+/// `maxPendingBytes` bounds the size of the baskets that are being compressed
+/// or are waiting to be written: when a basket would exceed it, Fill() waits
+/// for all the pending baskets and writes them. 0 disables asynchronous
+/// compression, which is the default for new trees.
+///
+/// Since the compressed size of the pending baskets is not known yet, the
+/// automatic flushes and saves based on compressed bytes (see SetAutoFlush()
+/// and SetAutoSave() with negative values) may happen a few baskets later.
+
+void TTree::SetAsyncCompression(Long64_t maxPendingBytes)
+{
+   FinishAsyncBasketWrites();
+#ifdef R__USE_IMT
+   delete fAsyncBasketWriter;
+   fAsyncBasketWriter = nullptr;
+#endif
+   fAsyncCompressionBudget = maxPendingBytes > 0 ? maxPendingBytes : 0;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// In case of a program crash, it will be possible to recover the data in the
 /// tree up to the last AutoSave point.
@@ -8956,6 +9270,8 @@ void TTree::SetDirectory(TDirectory* dir)
    if (fDirectory == dir) {
       return;
    }
+   // the pending baskets go to the file of the current directory
+   FinishAsyncBasketWrites();
    if (fDirectory) {
       fDirectory->Remove(this);
 
@@ -290,6 +290,7 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TBranch.h"
 #include "TBranchElement.h"
 #include "TEventList.h"
+#include "TEntryList.h"
 #include "TObjArray.h"
 #include "TObjString.h"
 #include "TRegexp.h"
@@ -1296,12 +1297,30 @@ Bool_t TTreeCache::FillBuffer()
    // Special case reading only the baskets containing entries in the
    // list.
    TEventList *elist = fTree->GetEventList();
+   // The same for a TEntryList. The sub-list of a TChain for its current tree
+   // holds local entry numbers.
+   TEntryList *entryList = elist ? nullptr : (fEntryList ? fEntryList : fTree->GetEntryList());
    Long64_t chainOffset = 0;
-   if (elist) {
+   if (elist || entryList) {
       if (fTree->IsA() ==TChain::Class()) {
          TChain *chain = (TChain*)fTree;
          Int_t t = chain->GetTreeNumber();
          chainOffset = chain->GetTreeOffset()[t];
+         if (entryList && entryList->GetLists()) {
+            TEntryList *subList = nullptr;
+            TIter nextList(entryList->GetLists());
+            while (auto l = static_cast<TEntryList *>(nextList())) {
+               if (l->GetTreeNumber() == t) {
+                  subList = l;
+                  break;
+               }
+            }
+            // without a sub-list for this tree (e.g. lists not associated to the chain) we cannot tell
+            entryList = subList;
+            chainOffset = 0;
+         }
+      } else if (entryList && entryList->GetLists()) {
+         entryList = nullptr;
       }
    }
 
@@ -1366,7 +1385,7 @@ Bool_t TTreeCache::FillBuffer()
          kRewind = 3
       };
 
-      auto CollectBaskets = [this, elist, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
+      auto CollectBaskets = [this, elist, entryList, chainOffset, entry, clusterIterations, resetBranchInfo, perfStats,
        &cursor, &lowestMaxEntry, &maxReadEntry, &minEntry,
        &reachedEnd, &skippedFirst, &oncePerBranch, &nDistinctLoad, &progress,
        &ranges, &memRanges, &reqRanges,
@@ -1497,6 +1516,13 @@ Bool_t TTreeCache::FillBuffer()
                      emax = entries[j + 1] - 1;
                   if (!elist->ContainsRange(entries[j]+chainOffset,emax+chainOffset))
                      continue;
+               } else if (entryList) {
+                  // do not read the baskets that only hold entries that will be skipped
+                  Long64_t emax = fEntryMax;
+                  if (j<nb-1)
+                     emax = entries[j + 1] - 1;
+                  if (!entryList->ContainsRange(entries[j]+chainOffset,emax+chainOffset))
+                     continue;
                }
 
                if (b->fCacheInfo.HasBeenUsed(j) || b->fCacheInfo.IsInCache(j) || b->fCacheInfo.IsVetoed(j)) {
@@ -2095,6 +2121,20 @@ Int_t TTreeCache::SetBufferSize(Int_t buffersize)
    return 1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the list of the entries to be processed, if it is not the TEntryList of
+/// the tree (see TTree::SetEntryList()), e.g. the one given to a TTreeReader.
+/// Only the baskets holding entries of the list are then prefetched.
+///
+/// As for the tree, the list either has global entry numbers or, when reading
+/// a TChain, sub-lists for its trees with local entry numbers. The list is not
+/// owned by the cache.
+
+void TTreeCache::SetEntryList(TEntryList *elist)
+{
+   fEntryList = elist;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set the minimum and maximum entry number to be processed
 /// this information helps to optimize the number of baskets to read
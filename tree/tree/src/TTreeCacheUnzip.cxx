@@ -16,6 +16,25 @@
 
 A TTreeCache which exploits parallelized decompression of its own content.
 
+When implicit multi-threading is enabled, the baskets of the cluster held by the cache are
+decompressed ahead of their use by tasks of the ROOT task arena, as soon as the cache buffer
+has been read. The baskets are grouped and scheduled in the order in which they are predicted
+to be read, i.e. by increasing first entry, and the tasks decompress them straight from the
+cache buffer: the state of each basket is an atomic, and no lock is taken unless the file is
+read asynchronously. The thread reading the tree picks up decompressed baskets, decompresses
+not yet started baskets itself while the one it needs is in progress, and waits for the tasks
+only before the cache buffer is refilled.
+
+With SetReadAheadSize() (or the rootrc variable `TTreeCacheUnzip.ReadAheadSize`, in bytes),
+the baskets of the next cluster are read and unzipped by a background task while the current
+cluster is processed, such that a single threaded event loop finds them ready when it reaches
+the next cluster. The size bounds the memory used by the compressed and unzipped baskets read
+ahead: half of it for the compressed baskets, which are read with a single vector read, and the
+baskets which do not fit are read and unzipped as usual. Local files are read ahead through
+their own file descriptor, remote files only if they support concurrent reads (see
+TFile::SupportsConcurrentReads()). The read ahead is disabled by default and requires implicit
+multi-threading to be enabled.
+
 */
 
 #include "TTreeCacheUnzip.h"
@@ -27,13 +46,20 @@ A TTreeCache which exploits parallelized decompression of its own content.
 #include "TMath.h"
 #include "TROOT.h"
 #include "TMutex.h"
+#include "ROOT/RRawFile.hxx"
 
 #ifdef R__USE_IMT
-#include "ROOT/TThreadExecutor.hxx"
 #include "ROOT/TTaskGroup.hxx"
+#include "ROOT/TThreadExecutor.hxx"
 #endif
 
+#include <algorithm>
+#include <exception>
+#include <limits>
 #include <memory>
+#include <numeric>
+#include <thread>
+#include <tuple>
 
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
@@ -154,19 +180,51 @@ Bool_t TTreeCacheUnzip::UnzipState::TryUnzipping(Int_t index) {
    return fUnzipStatus[index].compare_exchange_weak(oldValue, newValue, std::memory_order_release, std::memory_order_relaxed);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// The baskets of a cluster read ahead of its use. The background task reading
+/// and unzipping them is the only one to access the state until the main thread
+/// waits for it.
+
+struct TTreeCacheUnzip::ReadAheadState {
+   TFile                  *fFile = nullptr;  ///< File of the baskets
+   Long64_t                fEntryFirst = 0;  ///< First entry of the cluster
+   Long64_t                fEntryNext = 0;   ///< First entry after the cluster
+   Long64_t                fBudget = 0;      ///< Max memory for the compressed and unzipped baskets
+   std::vector<Long64_t>   fPos;             ///< Sorted positions of the baskets on file
+   std::vector<Int_t>      fLen;             ///< Lengths of the baskets on file
+   std::vector<Long64_t>   fOffset;          ///< Positions of the baskets in fCompressed
+   std::vector<Int_t>      fOrder;           ///< Indices of the baskets by increasing first entry
+   std::unique_ptr<char[]> fCompressed;      ///< The baskets as read from the file
+   std::vector<std::unique_ptr<char[]>> fUnzipChunks; ///< The baskets unzipped within the budget
+   std::vector<Int_t>      fUnzipLen;        ///< Lengths of the unzipped baskets
+   std::atomic<Long64_t>   fSize{0};         ///< Memory used by the compressed and unzipped baskets
+   std::atomic<Bool_t>     fCancel{kFALSE};  ///< Stops the unzipping of the baskets
+   Bool_t                  fRead = kFALSE;   ///< Whether the baskets were read successfully
+
+   /// Index of the basket at position pos on file, -1 if it was not read ahead
+   Int_t Find(Long64_t pos) const
+   {
+      auto it = std::lower_bound(fPos.begin(), fPos.end(), pos);
+      return (it != fPos.end() && *it == pos) ? Int_t(it - fPos.begin()) : -1;
+   }
+};
+
 ////////////////////////////////////////////////////////////////////////////////
 
 TTreeCacheUnzip::TTreeCacheUnzip() : TTreeCache(),
    fAsyncReading(kFALSE),
    fEmpty(kTRUE),
    fCycle(0),
+   fTasksCycle(-1),
+   fReadAheadSize(0),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fNReadAhead(0)
 {
    // Default Constructor.
    Init();
@@ -179,13 +237,16 @@ TTreeCacheUnzip::TTreeCacheUnzip(TTree *tree, Int_t buffersize) : TTreeCache(tre
    fAsyncReading(kFALSE),
    fEmpty(kTRUE),
    fCycle(0),
+   fTasksCycle(-1),
+   fReadAheadSize(0),
    fNseekMax(0),
    fUnzipGroupSize(0),
    fUnzipBufferSize(0),
    fNFound(0),
    fNMissed(0),
    fNStalls(0),
-   fNUnzip(0)
+   fNUnzip(0),
+   fNReadAhead(0)
 {
    Init();
 }
@@ -204,6 +265,7 @@ void TTreeCacheUnzip::Init()
    fCompBufferSize = 16384;
 
    fUnzipGroupSize = 102400; // Each task unzips at least 100 KB
+   fReadAheadSize = gEnv->GetValue("TTreeCacheUnzip.ReadAheadSize", 0);
 
    if (fgParallel == kDisable) {
       fParallel = kFALSE;
@@ -234,6 +296,7 @@ void TTreeCacheUnzip::Init()
 
 TTreeCacheUnzip::~TTreeCacheUnzip()
 {
+   StopReadAhead();
    ResetCache();
    fUnzipState.Clear(fNseekMax);
 }
@@ -281,9 +344,16 @@ Bool_t TTreeCacheUnzip::FillBuffer()
    // the end of the training phase).
    if (fEntryCurrent <= entry  && entry < fEntryNext) return kFALSE;
 
+   // The unzipping tasks read from the cache buffer, which is about to be refilled.
+   WaitForUnzipTasks();
+   fBlockEntries.clear();
+
    // Triggered by the user, not the learning phase
    if (entry == -1)  entry = 0;
 
+   // The baskets of the new cluster may have been read ahead while the previous one was processed.
+   AdoptReadAhead(entry);
+
    TTree::TClusterIterator clusterIter = tree->GetClusterIterator(entry);
    fEntryCurrent = clusterIter();
    fEntryNext = clusterIter.GetNextEntry();
@@ -335,13 +405,19 @@ Bool_t TTreeCacheUnzip::FillBuffer()
             if (j < nb - 1) emax = entries[j+1] - 1;
             if (!elist->ContainsRange(entries[j] + chainOffset, emax + chainOffset)) continue;
          }
+         // Already read ahead, GetUnzipBuffer() takes it from there
+         if (fReadAheadDone && fReadAheadDone->Find(pos) >= 0) continue;
          fNReadPref++;
 
+         fBlockEntries.emplace_back(pos, entries[j]);
          TFileCacheRead::Prefetch(pos, len);
       }
       if (gDebug > 0) printf("Entry: %lld, registering baskets branch %s, fEntryNext=%lld, fNseek=%d, fNtot=%d\n", entry, ((TBranch*)fBranches->UncheckedAt(i))->GetName(), fEntryNext, fNseek, fNtot);
    }
 
+   // Read the next cluster while this one is processed
+   StartReadAhead();
+
    // Now fix the size of the status arrays
    ResetCache();
    fIsLearning = kFALSE;
@@ -374,9 +450,21 @@ Int_t TTreeCacheUnzip::SetBufferSize(Int_t buffersize)
 
 void TTreeCacheUnzip::SetEntryRange(Long64_t emin, Long64_t emax)
 {
+   StopReadAhead();
    TTreeCache::SetEntryRange(emin, emax);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Change the file from which the baskets are read; the read ahead of the
+/// previous file is dropped.
+
+void TTreeCacheUnzip::SetFile(TFile *file, TFile::ECacheAction action)
+{
+   StopReadAhead();
+   fReadAheadFile.reset();
+   TTreeCache::SetFile(file, action);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// It's the same as TTreeCache::StopLearningPhase but we guarantee that
 /// we start the unzipping just after getting the buffers
@@ -391,6 +479,7 @@ void TTreeCacheUnzip::StopLearningPhase()
 
 void TTreeCacheUnzip::UpdateBranches(TTree *tree)
 {
+   StopReadAhead();
    TTreeCache::UpdateBranches(tree);
 }
 
@@ -500,6 +589,8 @@ Int_t TTreeCacheUnzip::GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes,
 
 void TTreeCacheUnzip::ResetCache()
 {
+   WaitForUnzipTasks();
+
    // Reset all the lists and wipe all the chunks
    fCycle++;
    fUnzipState.Clear(fNseekMax);
@@ -517,6 +608,7 @@ void TTreeCacheUnzip::ResetCache()
 ////////////////////////////////////////////////////////////////////////////////
 /// This inflates a basket in the cache.. passing the data to a new
 /// buffer that will only wait there to be read...
+/// `index` is the index of the block in the sorted list of blocks of the cache.
 /// This function is responsible to update corresponding elements in
 /// fUnzipStatus, fUnzipChunks and fUnzipLen. Since we use atomic variables
 /// in fUnzipStatus to exclusively unzip the basket, we must update
@@ -525,22 +617,14 @@ void TTreeCacheUnzip::ResetCache()
 
 Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
 {
-   Int_t myCycle;
    const Int_t hlen = 128;
    Int_t objlen = 0, keylen = 0;
    Int_t nbytes = 0;
-   Int_t readbuf = 0;
-
-   Long64_t rdoffs = 0;
-   Int_t rdlen = 0;
 
    // To synchronize with the 'paging'
-   myCycle = fCycle;
-   rdoffs = fSeek[index];
-   rdlen = fSeekLen[index];
+   Int_t myCycle = fCycle;
 
-   Int_t loc = -1;
-   if (!fNseek || fIsLearning) {
+   if (!fNseek || fIsLearning || index >= fNseek) {
       return 1;
    }
 
@@ -549,25 +633,26 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       return 1;
    }
 
-   // Prepare a memory buffer of adequate size
-   char* locbuff = 0;
-   if (rdlen > 16384) {
-      locbuff = new char[rdlen];
-   } else if (rdlen * 3 < 16384) {
-      locbuff = new char[rdlen * 2];
+   // The cache buffer is not modified while the block can be unzipped (FillBuffer() waits for the
+   // unzipping tasks): read the compressed block in place, without copying it nor taking a lock.
+   // When the file is read asynchronously, the blocks are not in the cache buffer: read them through
+   // the cache, which reads from the file.
+   std::unique_ptr<char[]> locbuff;
+   char *src = nullptr;
+   if (fBuffer && !fAsyncReading && !fEnablePrefetching) {
+      src = fBuffer + fSeekPos[index];
    } else {
-      locbuff = new char[16384];
-   }
-
-   readbuf = ReadBufferExt(locbuff, rdoffs, rdlen, loc);
-
-   if (readbuf <= 0) {
-      fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-      if (locbuff) delete [] locbuff;
-      return -1;
+      const Int_t rdlen = fSeekSortLen[index];
+      locbuff.reset(new char[std::max(rdlen, hlen)]);
+      Int_t loc = index;
+      if (ReadBufferExt(locbuff.get(), fSeekSort[index], rdlen, loc) <= 0) {
+         fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
+         return -1;
+      }
+      src = locbuff.get();
    }
 
-   GetRecordHeader(locbuff, hlen, nbytes, objlen, keylen);
+   GetRecordHeader(src, hlen, nbytes, objlen, keylen);
 
    Int_t len = (objlen > nbytes - keylen) ? keylen + objlen : nbytes;
    // If the single unzipped chunk is really too big, reset it to not processable
@@ -575,21 +660,19 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
    // This block will be unzipped synchronously in the main thread
    // TODO: ROOT internally breaks zipped buffers into 16MB blocks, we can probably still unzip in parallel.
    if (len > 4 * fUnzipBufferSize) {
-           if (gDebug > 0)
-                   Info("UnzipCache", "Block %d is too big, skipping.", index);
+      if (gDebug > 0)
+         Info("UnzipCache", "Block %d is too big, skipping.", index);
 
-           fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-           if (locbuff) delete [] locbuff;
-           return 0;
+      fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
+      return 0;
    }
 
    // Unzip it into a new blk
    char *ptr = nullptr;
-   Int_t loclen = UnzipBuffer(&ptr, locbuff);
+   Int_t loclen = UnzipBuffer(&ptr, src);
    if ((loclen > 0) && (loclen == objlen + keylen)) {
       if ((myCycle != fCycle) || !fIsTransferred) {
          fUnzipState.SetFinished(index); // Set it as not done, main thread will take charge
-         if (locbuff) delete [] locbuff;
          delete [] ptr;
          return 1;
       }
@@ -600,61 +683,339 @@ Int_t TTreeCacheUnzip::UnzipCache(Int_t index)
       delete [] ptr;
    }
 
-   if (locbuff) delete [] locbuff;
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the order in which the blocks of the cache are expected to be read:
+/// by increasing first entry of their basket, i.e. the order in which
+/// TTree::GetEntry() requests them, and in file order for equal first entries.
+
+void TTreeCacheUnzip::ComputeUnzipOrder()
+{
+   std::sort(fBlockEntries.begin(), fBlockEntries.end());
+
+   std::vector<Long64_t> firstEntry(fNseek, std::numeric_limits<Long64_t>::max());
+   for (Int_t i = 0; i < fNseek; ++i) {
+      auto it = std::lower_bound(fBlockEntries.begin(), fBlockEntries.end(),
+                                 std::make_pair(fSeekSort[i], std::numeric_limits<Long64_t>::min()));
+      if (it != fBlockEntries.end() && it->first == fSeekSort[i])
+         firstEntry[i] = it->second;
+   }
+
+   fUnzipOrder.resize(fNseek);
+   std::iota(fUnzipOrder.begin(), fUnzipOrder.end(), 0);
+   std::stable_sort(fUnzipOrder.begin(), fUnzipOrder.end(),
+                    [&firstEntry](Int_t a, Int_t b) { return firstEntry[a] < firstEntry[b]; });
+   fUnzipRank.resize(fNseek);
+   for (Int_t rank = 0; rank < fNseek; ++rank)
+      fUnzipRank[fUnzipOrder[rank]] = rank;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Cancel the unzipping tasks that did not start yet and wait for the running
+/// ones. Must be called before the cache buffer or the unzipping states change.
+
+void TTreeCacheUnzip::WaitForUnzipTasks()
+{
+#ifdef R__USE_IMT
+   if (fUnzipTaskGroup) {
+      fUnzipTaskGroup->Cancel();
+      fUnzipTaskGroup.reset(); // waits for the running tasks
+   }
+#endif
+}
+
 #ifdef R__USE_IMT
 ////////////////////////////////////////////////////////////////////////////////
-/// We create a TTaskGroup and asynchronously maps each group of baskets(> 100 kB in total)
-/// to a task. In TTaskGroup, we use TThreadExecutor to do the actually work of unzipping
-/// a group of basket. The purpose of creating TTaskGroup is to avoid competing with main thread.
+/// Schedule the decompression of the blocks of the cache in the task arena.
+/// The blocks are taken in predicted order of access (see ComputeUnzipOrder())
+/// and grouped in tasks unzipping at least fUnzipGroupSize bytes each, which are
+/// submitted in that order.
 
 Int_t TTreeCacheUnzip::CreateTasks()
 {
-   auto mapFunction = [&]() {
-      auto unzipFunction = [&](const std::vector<Int_t> &indices) {
-         // If cache is invalidated and we should return immediately.
-         if (!fIsTransferred) return nullptr;
+   WaitForUnzipTasks();
+   ComputeUnzipOrder();
+   fTasksCycle = fCycle;
+   if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
 
+   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
+   auto submit = [this](const std::vector<Int_t> &indices) {
+      fUnzipTaskGroup->Run([this, indices]() {
          for (auto ii : indices) {
-            if(fUnzipState.TryUnzipping(ii)) {
+            // If cache is invalidated and we should return immediately.
+            if (!fIsTransferred) return;
+            if (fUnzipState.TryUnzipping(ii)) {
                Int_t res = UnzipCache(ii);
-               if(res)
+               if (res)
                   if (gDebug > 0)
                      Info("UnzipCache", "Unzipping failed or cache is in learning state");
             }
          }
-         return nullptr;
-      };
-
-      Int_t accusz = 0;
-      std::vector<std::vector<Int_t>> basketIndices;
-      std::vector<Int_t> indices;
-      if (fUnzipGroupSize <= 0) fUnzipGroupSize = 102400;
-      for (Int_t i = 0; i < fNseek; i++) {
-         while (accusz < fUnzipGroupSize) {
-            accusz += fSeekLen[i];
-            indices.push_back(i);
-            i++;
-            if (i >= fNseek) break;
-         }
-         if (i < fNseek) i--;
-         basketIndices.push_back(indices);
+      });
+   };
+
+   Int_t accusz = 0;
+   std::vector<Int_t> indices;
+   for (auto ii : fUnzipOrder) {
+      indices.push_back(ii);
+      accusz += fSeekSortLen[ii];
+      if (accusz >= fUnzipGroupSize) {
+         submit(indices);
          indices.clear();
          accusz = 0;
       }
-      ROOT::TThreadExecutor pool;
-      pool.Foreach(unzipFunction, basketIndices);
-   };
-
-   fUnzipTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
-   fUnzipTaskGroup->Run(mapFunction);
+   }
+   if (!indices.empty())
+      submit(indices);
 
    return 0;
 }
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+/// Cancel the read ahead and wait for its task; drop the baskets read ahead.
+
+void TTreeCacheUnzip::StopReadAhead()
+{
+   if (fReadAhead)
+      fReadAhead->fCancel = kTRUE;
+#ifdef R__USE_IMT
+   fReadAheadTaskGroup.reset(); // waits for the running task
+#endif
+   fReadAhead.reset();
+   fReadAheadDone.reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by FillBuffer() for the cluster containing entry: wait for the read
+/// ahead and keep its baskets if they belong to this cluster.
+
+void TTreeCacheUnzip::AdoptReadAhead(Long64_t entry)
+{
+   fReadAheadDone.reset();
+   if (!fReadAhead)
+      return;
+
+   const Bool_t useful =
+      fReadAhead->fFile == fFile && fReadAhead->fEntryFirst <= entry && entry < fReadAhead->fEntryNext;
+   if (!useful)
+      fReadAhead->fCancel = kTRUE;
+#ifdef R__USE_IMT
+   fReadAheadTaskGroup.reset(); // waits for the running task
+#endif
+   if (useful && fReadAhead->fRead)
+      fReadAheadDone = std::move(fReadAhead);
+   fReadAhead.reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start the read ahead of the cluster following the one just registered by
+/// FillBuffer(): the baskets starting in that cluster are taken by increasing
+/// first entry, as long as they fit in half of fReadAheadSize, and a background
+/// task reads and unzips them.
+
+void TTreeCacheUnzip::StartReadAhead()
+{
+#ifdef R__USE_IMT
+   if (!fParallel || fReadAheadSize <= 0 || !fFile || !ROOT::IsImplicitMTEnabled())
+      return;
+   if (fEntryNext >= fEntryMax || fTree->GetEventList())
+      return;
+
+   // The files which do not support concurrent reads are read ahead with their own reader, if they are local
+   if (!fFile->SupportsConcurrentReads()) {
+      if (fFile->IsA() != TFile::Class() || fFile->IsWritable())
+         return;
+      if (!fReadAheadFile) {
+         try {
+            fReadAheadFile = ROOT::Internal::RRawFile::Create(fFile->GetName());
+         } catch (const std::exception &e) {
+            Warning("StartReadAhead", "cannot read ahead from %s: %s", fFile->GetName(), e.what());
+            fReadAheadSize = 0;
+            return;
+         }
+      }
+   }
+
+   TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
+   TTree::TClusterIterator clusterIter = tree->GetClusterIterator(fEntryNext);
+   auto state = std::make_unique<ReadAheadState>();
+   state->fFile = fFile;
+   state->fEntryFirst = clusterIter();
+   state->fEntryNext = std::min(clusterIter.GetNextEntry(), fEntryMax);
+   state->fBudget = fReadAheadSize;
+
+   // First entry, position and length of the baskets starting in the next cluster
+   std::vector<std::tuple<Long64_t, Long64_t, Int_t>> baskets;
+   for (Int_t i = 0; i < fNbranches; i++) {
+      TBranch *b = (TBranch*)fBranches->UncheckedAt(i);
+      if (b->GetDirectory() == 0) continue;
+      if (b->GetDirectory()->GetFile() != fFile) continue;
+      Int_t nb = b->GetMaxBaskets();
+      Int_t *lbaskets   = b->GetBasketBytes();
+      Long64_t *entries = b->GetBasketEntry();
+      if (!lbaskets || !entries) continue;
+      Int_t blistsize = b->GetListOfBaskets()->GetSize();
+      for (Int_t j = 0; j < nb; j++) {
+         if (j < blistsize && b->GetListOfBaskets()->UncheckedAt(j)) continue;
+         Long64_t pos = b->GetBasketSeek(j);
+         Int_t len = lbaskets[j];
+         if (pos <= 0 || len <= 0) continue;
+         if (entries[j] < state->fEntryFirst || entries[j] >= state->fEntryNext) continue;
+         baskets.emplace_back(entries[j], pos, len);
+      }
+   }
+   std::sort(baskets.begin(), baskets.end());
+
+   Long64_t compressedSize = 0;
+   std::size_t n = 0;
+   while (n < baskets.size() && compressedSize + std::get<2>(baskets[n]) <= fReadAheadSize / 2)
+      compressedSize += std::get<2>(baskets[n++]);
+   if (n == 0)
+      return;
+
+   // The baskets are read in file order, and unzipped in order of first entry
+   std::vector<Int_t> byPos(n);
+   std::iota(byPos.begin(), byPos.end(), 0);
+   std::sort(byPos.begin(), byPos.end(),
+             [&baskets](Int_t a, Int_t b) { return std::get<1>(baskets[a]) < std::get<1>(baskets[b]); });
+   state->fPos.resize(n);
+   state->fLen.resize(n);
+   state->fOffset.resize(n);
+   state->fOrder.resize(n);
+   Long64_t offset = 0;
+   for (std::size_t i = 0; i < n; ++i) {
+      state->fPos[i] = std::get<1>(baskets[byPos[i]]);
+      state->fLen[i] = std::get<2>(baskets[byPos[i]]);
+      state->fOffset[i] = offset;
+      state->fOrder[byPos[i]] = i;
+      offset += state->fLen[i];
+   }
+   state->fCompressed.reset(new char[compressedSize]);
+   state->fUnzipChunks.resize(n);
+   state->fUnzipLen.assign(n, 0);
+   state->fSize = compressedSize;
+
+   fReadAhead = std::move(state);
+   fReadAheadTaskGroup.reset(new ROOT::Experimental::TTaskGroup());
+   ReadAheadState *readAhead = fReadAhead.get();
+   fReadAheadTaskGroup->Run([this, readAhead]() { ReadAheadCluster(*readAhead); });
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Body of the read ahead task: read the baskets with a single vector read and
+/// unzip them in parallel, in order of first entry, while they fit in the budget.
+/// A basket which does not fit is left compressed and unzipped when it is used.
+
+void TTreeCacheUnzip::ReadAheadCluster(ReadAheadState &state)
+{
+   const Int_t n = state.fPos.size();
+   if (state.fFile->SupportsConcurrentReads()) {
+      // ReadBuffers() returns kTRUE in case of failure
+      if (state.fFile->ReadBuffers(state.fCompressed.get(), state.fPos.data(), state.fLen.data(), n))
+         return;
+   } else {
+      std::vector<ROOT::Internal::RRawFile::RIOVec> ioVec(n);
+      for (Int_t i = 0; i < n; ++i) {
+         ioVec[i].fBuffer = state.fCompressed.get() + state.fOffset[i];
+         ioVec[i].fOffset = state.fPos[i];
+         ioVec[i].fSize = state.fLen[i];
+      }
+      try {
+         fReadAheadFile->ReadV(ioVec.data(), n);
+      } catch (const std::exception &e) {
+         Warning("ReadAheadCluster", "cannot read ahead from %s: %s", state.fFile->GetName(), e.what());
+         return;
+      }
+      for (const auto &v : ioVec) {
+         if (v.fOutBytes != v.fSize)
+            return;
+      }
+   }
+   state.fRead = kTRUE;
+
+#ifdef R__USE_IMT
+   std::vector<std::vector<Int_t>> groups(1);
+   Int_t accusz = 0;
+   for (auto i : state.fOrder) {
+      groups.back().push_back(i);
+      accusz += state.fLen[i];
+      if (accusz >= fUnzipGroupSize) {
+         groups.emplace_back();
+         accusz = 0;
+      }
+   }
+   if (groups.back().empty())
+      groups.pop_back();
+
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(
+      [this, &state](const std::vector<Int_t> &indices) {
+         for (auto i : indices) {
+            if (state.fCancel)
+               return;
+            char *src = state.fCompressed.get() + state.fOffset[i];
+            Int_t nbytes = 0, objlen = 0, keylen = 0;
+            GetRecordHeader(src, state.fLen[i], nbytes, objlen, keylen);
+            const Int_t len = keylen + objlen;
+            if (objlen <= 0)
+               continue;
+            if (state.fSize.fetch_add(len) + len > state.fBudget) {
+               state.fSize -= len;
+               continue;
+            }
+            char *ptr = nullptr;
+            Int_t loclen = UnzipBuffer(&ptr, src);
+            if (loclen > 0 && loclen == len) {
+               state.fUnzipChunks[i].reset(ptr);
+               state.fUnzipLen[i] = loclen;
+            } else {
+               delete [] ptr;
+               state.fSize -= len;
+            }
+         }
+      },
+      groups);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the basket at position pos on file from the baskets read ahead for the
+/// current cluster, see GetUnzipBuffer(). Returns 0 if it was not read ahead.
+
+Int_t TTreeCacheUnzip::GetReadAheadBuffer(char **buf, Long64_t pos, Int_t len, Bool_t *free)
+{
+   if (!fReadAheadDone)
+      return 0;
+   ReadAheadState &state = *fReadAheadDone;
+   const Int_t index = state.Find(pos);
+   if (index < 0 || state.fLen[index] != len)
+      return 0;
+
+   Int_t res = 0;
+   if (state.fUnzipChunks[index]) {
+      res = state.fUnzipLen[index];
+      if (!(*buf)) {
+         *buf = state.fUnzipChunks[index].release();
+         *free = kTRUE;
+      } else {
+         memcpy(*buf, state.fUnzipChunks[index].get(), res);
+         state.fUnzipChunks[index].reset();
+         *free = kFALSE;
+      }
+   } else {
+      res = UnzipBuffer(buf, state.fCompressed.get() + state.fOffset[index]);
+      if (res <= 0)
+         return 0;
+      *free = kTRUE;
+   }
+   fNReadAhead++;
+   return res;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// We try to read a buffer that has already been unzipped
 /// Returns -1 in case of read failure, 0 in case it's not in the
@@ -672,7 +1033,7 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
 
    // We go straight to TTreeCache/TfileCacheRead, in order to get the info we need
    //  pointer to the original zipped chunk
-   //  its index in the original unsorted offsets lists
+   //  its index in the sorted offsets lists, which is also the index of its unzipping state
    //
    // Actually there are situations in which copying the buffer is not
    // useful. But the choice is among doing once more a small memcpy or a binary search in a large array. I prefer the former.
@@ -681,22 +1042,28 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
 
    Int_t myCycle = fCycle;
 
+   res = GetReadAheadBuffer(buf, pos, len, free);
+   if (res > 0)
+      return res;
+
    if (fParallel && !fIsLearning) {
 
       if(fNseekMax < fNseek){
          if (gDebug > 0)
             Info("GetUnzipBuffer", "Changing fNseekMax from:%d to:%d", fNseekMax, fNseek);
 
+         WaitForUnzipTasks();
          fUnzipState.Reset(fNseekMax, fNseek);
          fNseekMax = fNseek;
       }
 
-      loc = (Int_t)TMath::BinarySearch(fNseek, fSeekSort, pos);
-      if ((fCycle == myCycle) && (loc >= 0) && (loc < fNseek) && (pos == fSeekSort[loc])) {
+      if (fIsTransferred)
+         loc = (Int_t)TMath::BinarySearch(fNseek, fSeekSort, pos);
+      if (fIsTransferred && (fCycle == myCycle) && (loc >= 0) && (loc < fNseek) && (pos == fSeekSort[loc])) {
 
-         // The buffer is, at minimum, in the file cache. We must know its index in the requests list
-         // In order to get its info
-         Int_t seekidx = fSeekIndex[loc];
+         Int_t seekidx = loc;
+         // The predicted order of access is known if the unzipping tasks run for this content of the cache.
+         const Bool_t haveOrder = (fTasksCycle == fCycle) && (fUnzipRank.size() == (size_t)fNseek);
 
          do {
 
@@ -718,13 +1085,15 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
                return fUnzipState.fUnzipLen[seekidx];
             }
 
-            // If the requested basket is being unzipped by a background task, we try to steal a blk to unzip.
+            // If the requested basket is being unzipped by a background task, we try to steal a blk to unzip:
+            // the first one not started yet after the requested one in the order of access.
             Int_t reqi = -1;
 
             if (fUnzipState.IsProgress(seekidx)) {
-               if (fEmpty) {
-                  for (Int_t ii = 0; ii < fNseek; ++ii) {
-                     Int_t idx = (seekidx + 1 + ii) % fNseek;
+               if (fEmpty && haveOrder) {
+                  const Int_t rank = fUnzipRank[seekidx];
+                  for (Int_t ii = 1; ii < fNseek; ++ii) {
+                     Int_t idx = fUnzipOrder[(rank + ii) % fNseek];
                      if (fUnzipState.IsUntouched(idx)) {
                         if(fUnzipState.TryUnzipping(idx)) {
                            reqi = idx;
@@ -738,6 +1107,10 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
                      UnzipCache(reqi);
                   }
                }
+               if (reqi < 0) {
+                  // Nothing left to do but waiting for the task unzipping the requested basket.
+                  std::this_thread::yield();
+               }
 
                if ( myCycle != fCycle ) {
                   if (gDebug > 0)
@@ -765,14 +1138,13 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
 
             fNStalls++;
             return fUnzipState.fUnzipLen[seekidx];
-         } else {
+         } else if (seekidx >= 0 && fUnzipState.TryUnzipping(seekidx)) {
             // This is a complete miss. We want to avoid the background tasks
             // to try unzipping this block in the future.
             fUnzipState.SetMissed(seekidx);
          }
       } else {
          loc = -1;
-         fIsTransferred = kFALSE;
       }
    }
 
@@ -789,26 +1161,26 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
    }
 
    res = 0;
+   Int_t readAheadLen = 0;
    if (!ReadBufferExt(fCompBuffer, pos, len, loc)) {
-      // Cache is invalidated and we need to wait for all unzipping tasks to be finished before fill new baskets in cache.
-#ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled() && fUnzipTaskGroup) {
-         fUnzipTaskGroup->Cancel();
-         fUnzipTaskGroup.reset();
-      }
-#endif
-      {
-         // Fill new baskets into cache.
+      // The cache may just have been filled with the cluster of the block, which was read ahead.
+      readAheadLen = GetReadAheadBuffer(buf, pos, len, free);
+      if (readAheadLen <= 0) {
+         // The block is not in the cache: read it from the file. The unzipping tasks keep working on the
+         // content of the cache, which is still valid.
          R__LOCKGUARD(fIOMutex.get());
-	      fFile->Seek(pos);
-	      res = fFile->ReadBuffer(fCompBuffer, len);
-      } // end of lock scope
-#ifdef R__USE_IMT
-      if(ROOT::IsImplicitMTEnabled()) {
-         CreateTasks();
+         fFile->Seek(pos);
+         res = fFile->ReadBuffer(fCompBuffer, len);
       }
-#endif
    }
+#ifdef R__USE_IMT
+   // The first read after FillBuffer() transfers the content of the cache: start unzipping it ahead.
+   if (fParallel && !fIsLearning && fIsTransferred && fTasksCycle != fCycle && ROOT::IsImplicitMTEnabled()) {
+      CreateTasks();
+   }
+#endif
+   if (readAheadLen > 0)
+      return readAheadLen;
 
    if (res) res = -1;
 
@@ -832,6 +1204,17 @@ void TTreeCacheUnzip::SetUnzipRelBufferSize(Float_t relbufferSize)
    fgRelBuffSize = relbufferSize;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Set the memory budget, in bytes, for the baskets of the next cluster which
+/// are read and unzipped in the background while the current cluster is
+/// processed. 0 disables the read ahead. It takes effect at the next refill of
+/// the cache.
+
+void TTreeCacheUnzip::SetReadAheadSize(Long64_t size)
+{
+   fReadAheadSize = size;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Sets the size for the unzipping cache... by default it should be
 /// two times the size of the prefetching cache
@@ -948,10 +1331,12 @@ void  TTreeCacheUnzip::Print(Option_t* option) const {
 
    printf("******TreeCacheUnzip statistics for file: %s ******\n",fFile->GetName());
    printf("Max allowed mem for pending buffers: %lld\n", fUnzipBufferSize);
-   printf("Number of blocks unzipped by threads: %d\n", fNUnzip);
+   printf("Number of blocks unzipped by threads: %d\n", fNUnzip.load());
    printf("Number of hits: %d\n", fNFound);
    printf("Number of stalls: %d\n", fNStalls);
    printf("Number of misses: %d\n", fNMissed);
+   printf("Max allowed mem for the baskets read ahead: %lld\n", fReadAheadSize);
+   printf("Number of blocks read ahead: %d\n", fNReadAhead);
 
    TTreeCache::Print(option);
 }
@@ -345,6 +345,23 @@ UInt_t TTreeCloner::CollectBranches(TBranch *from, TBranch *to) {
 
    }
 
+   if (!from->fCompressionDictionary.empty() && from->fCompressionDictionary != to->fCompressionDictionary) {
+      if (to->fCompressionDictionary.empty()) {
+         // None of the baskets of the output branch uses a dictionary yet: it can take the one of the copied baskets.
+         to->fCompressionDictionary = from->fCompressionDictionary;
+         to->RegisterCompressionDictionary();
+      } else {
+         fWarningMsg.Form("The export branch and the import branch (%s) are compressed with different dictionaries.",
+                          from->GetName());
+         if (!(fOptions & kNoWarnings)) {
+            Warning("TTreeCloner::CollectBranches", "%s", fWarningMsg.Data());
+         }
+         fIsValid = kFALSE;
+         fNeedConversion = kTRUE;
+         return 0;
+      }
+   }
+
    fFromBranches.AddLast(from);
    if (!from->TestBit(TBranch::kDoNotUseBufferMap)) {
       // Make sure that we reset the Buffer's map if needed.
@@ -32,3 +32,17 @@ TVirtualIndex::TVirtualIndex(): TNamed()
 TVirtualIndex::~TVirtualIndex()
 {
 }
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append to `entries` the entry numbers of all the index values from
+/// (majorLow, minorLow) to (majorHigh, minorHigh), both included, in the order
+/// of the index values. Return the number of entries appended, or -1 if the
+/// index does not support range queries.
+
+Long64_t TVirtualIndex::GetEntryNumbersWithIndexRange(Long64_t /*majorLow*/, Long64_t /*minorLow*/,
+                                                      Long64_t /*majorHigh*/, Long64_t /*minorHigh*/,
+                                                      std::vector<Long64_t> & /*entries*/) const
+{
+   Error("GetEntryNumbersWithIndexRange", "Range queries are not supported by %s", ClassName());
+   return -1;
+}
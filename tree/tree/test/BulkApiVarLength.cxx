@@ -1,4 +1,5 @@
 #include <stdio.h>
+#include <vector>
 
 #include "Bytes.h"
 #include "TBranch.h"
@@ -236,3 +237,112 @@ TEST_F(BulkApiVariableTest, serializedRead)
    printf("Bulk Serialized API: Successful read of all events.\n");
    printf("Bulk Serialized API: Total elapsed time (seconds) for API: %.2f\n", sw.RealTime());
 }
+
+TEST_F(BulkApiVariableTest, collectionRead)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   auto tree = dynamic_cast<TTree*>(hfile->Get("T"));
+   ASSERT_TRUE(tree);
+   auto branchFloat = tree->GetBranch("f");
+   ASSERT_TRUE(branchFloat);
+   auto branchDouble = tree->GetBranch("d");
+   ASSERT_TRUE(branchDouble);
+   EXPECT_TRUE(branchFloat->GetBulkRead().SupportsBulkCollectionRead());
+   EXPECT_FALSE(tree->GetBranch("myLen")->GetBulkRead().SupportsBulkCollectionRead());
+
+   float idx_f = 0;
+   double idx_d = 2;
+   Long64_t evt_idx = 0;
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile floatOffsets(TBuffer::kWrite, 32*1024);
+   TBufferFile doubleOffsets(TBuffer::kWrite, 32*1024);
+
+   while (evt_idx < fEventCount) {
+      auto count = branchFloat->GetBulkRead().GetBulkCollectionEntries(evt_idx, floatBuf, floatOffsets);
+      ASSERT_GT(count, 0);
+      ASSERT_EQ(branchDouble->GetBulkRead().GetBulkCollectionEntries(evt_idx, doubleBuf, doubleOffsets), count);
+
+      auto f = reinterpret_cast<float*>(floatBuf.GetCurrent());
+      auto d = reinterpret_cast<double*>(doubleBuf.GetCurrent());
+      auto fOffsets = reinterpret_cast<Int_t*>(floatOffsets.GetCurrent());
+      auto dOffsets = reinterpret_cast<Int_t*>(doubleOffsets.GetCurrent());
+      ASSERT_EQ(fOffsets[0], 0);
+      for (Int_t idx = 0; idx < count; idx++) {
+         const Long64_t ev = evt_idx + idx + 1;
+         ASSERT_EQ(fOffsets[idx + 1] - fOffsets[idx], ev % 10);
+         ASSERT_EQ(dOffsets[idx + 1], fOffsets[idx + 1]);
+         for (Int_t entry_idx = fOffsets[idx]; entry_idx < fOffsets[idx + 1]; entry_idx++) {
+            ASSERT_EQ(f[entry_idx], idx_f++);
+            ASSERT_EQ(d[entry_idx], idx_d++);
+         }
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, fEventCount);
+   delete hfile;
+}
+
+TEST(BulkApiCollection, vectorRead)
+{
+   const auto fileName = "BulkApiTestVector.root";
+   const Long64_t nEntries = 1000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("T", "A tree of std::vector branches");
+      std::vector<float> vf;
+      std::vector<Long64_t> vl;
+      t.Branch("vf", &vf);
+      t.Branch("vl", &vl);
+      for (Long64_t ev = 0; ev < nEntries; ev++) {
+         vf.assign(ev % 5, ev * 0.5f);
+         vl.assign(ev % 3, -ev);
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fileName);
+   auto t = f.Get<TTree>("T");
+   ASSERT_TRUE(t);
+   auto branchFloat = t->GetBranch("vf");
+   auto branchLong = t->GetBranch("vl");
+   ASSERT_TRUE(branchFloat->GetBulkRead().SupportsBulkCollectionRead());
+   ASSERT_TRUE(branchLong->GetBulkRead().SupportsBulkCollectionRead());
+
+   TBufferFile floatBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile longBuf(TBuffer::kWrite, 32*1024);
+   TBufferFile floatOffsets(TBuffer::kWrite, 32*1024);
+   TBufferFile longOffsets(TBuffer::kWrite, 32*1024);
+   Long64_t evt_idx = 0;
+   while (evt_idx < nEntries) {
+      auto count = branchFloat->GetBulkRead().GetBulkCollectionEntries(evt_idx, floatBuf, floatOffsets);
+      ASSERT_GT(count, 0);
+      auto fValues = reinterpret_cast<float*>(floatBuf.GetCurrent());
+      auto fOffsets = reinterpret_cast<Int_t*>(floatOffsets.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         const Long64_t ev = evt_idx + idx;
+         ASSERT_EQ(fOffsets[idx + 1] - fOffsets[idx], ev % 5);
+         for (Int_t i = fOffsets[idx]; i < fOffsets[idx + 1]; i++)
+            ASSERT_EQ(fValues[i], ev * 0.5f);
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, nEntries);
+
+   evt_idx = 0;
+   while (evt_idx < nEntries) {
+      auto count = branchLong->GetBulkRead().GetBulkCollectionEntries(evt_idx, longBuf, longOffsets);
+      ASSERT_GT(count, 0);
+      auto lValues = reinterpret_cast<Long64_t*>(longBuf.GetCurrent());
+      auto lOffsets = reinterpret_cast<Int_t*>(longOffsets.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         const Long64_t ev = evt_idx + idx;
+         ASSERT_EQ(lOffsets[idx + 1] - lOffsets[idx], ev % 3);
+         for (Int_t i = lOffsets[idx]; i < lOffsets[idx + 1]; i++)
+            ASSERT_EQ(lValues[i], -ev);
+      }
+      evt_idx += count;
+   }
+   ASSERT_EQ(evt_idx, nEntries);
+}
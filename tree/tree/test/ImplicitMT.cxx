@@ -1,10 +1,14 @@
+#include "TChain.h"
 #include "TFile.h"
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TTree.h"
+#include "TTreeCacheUnzip.h"
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 #ifdef R__USE_IMT
 
 // ROOT-9668
@@ -28,4 +32,204 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, asyncCompression)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "asyncCompressionMT.root";
+   const int nEntries = 100000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      // a small budget, so that Fill has to wait for pending baskets
+      t.SetAsyncCompression(64000);
+      EXPECT_EQ(t.GetAsyncCompression(), 64000);
+      int i = 0;
+      double x = 0.;
+      std::vector<float> v;
+      t.Branch("i", &i, 4000);
+      t.Branch("x", &x, 4000);
+      t.Branch("v", &v, 4000);
+      for (; i < nEntries; ++i) {
+         x = i * 0.5;
+         v.assign(i % 7, i);
+         ASSERT_GT(t.Fill(), 0);
+      }
+      t.Write();
+   }
+
+   TFile f(ofileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(t, nullptr);
+   ASSERT_EQ(t->GetEntries(), nEntries);
+   EXPECT_GT(t->GetBranch("i")->GetWriteBasket(), 1);
+   int i = -1;
+   double x = -1.;
+   std::vector<float> *v = nullptr;
+   t->SetBranchAddress("i", &i);
+   t->SetBranchAddress("x", &x);
+   t->SetBranchAddress("v", &v);
+   for (int entry = 0; entry < nEntries; ++entry) {
+      ASSERT_GT(t->GetEntry(entry), 0);
+      ASSERT_EQ(i, entry);
+      ASSERT_EQ(x, entry * 0.5);
+      ASSERT_EQ(v->size(), std::size_t(entry % 7));
+      for (auto e : *v)
+         ASSERT_EQ(e, entry);
+   }
+   t->ResetBranchAddresses();
+   delete v;
+   f.Close();
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, parallelUnzip)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "parallelUnzipMT.root";
+   const int nEntries = 200000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(20000);
+      int i = 0;
+      double x = 0.;
+      std::vector<float> v;
+      t.Branch("i", &i, 4000);
+      t.Branch("x", &x, 4000);
+      t.Branch("v", &v, 4000);
+      for (; i < nEntries; ++i) {
+         x = i * 0.5;
+         v.assign(i % 7, i);
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   const auto oldMode = TTreeCacheUnzip::GetParallelUnzip();
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      t->SetCacheSize(10000000);
+      t->AddBranchToCache("*", kTRUE);
+      t->StopCacheLearningPhase();
+      auto cache = dynamic_cast<TTreeCacheUnzip *>(t->GetReadCache(&f));
+      ASSERT_NE(cache, nullptr);
+      int i = -1;
+      double x = -1.;
+      std::vector<float> *v = nullptr;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("x", &x);
+      t->SetBranchAddress("v", &v);
+      for (int entry = 0; entry < nEntries; ++entry) {
+         ASSERT_GT(t->GetEntry(entry), 0);
+         ASSERT_EQ(i, entry);
+         ASSERT_EQ(x, entry * 0.5);
+         ASSERT_EQ(v->size(), std::size_t(entry % 7));
+      }
+      EXPECT_GT(cache->GetNUnzip() + cache->GetNFound() + cache->GetNMissed(), 0);
+      t->ResetBranchAddresses();
+      delete v;
+   }
+   TTreeCacheUnzip::SetParallelUnzip(oldMode);
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, parallelUnzipReadAhead)
+{
+   ROOT::EnableImplicitMT();
+   const auto ofileName = "parallelUnzipReadAheadMT.root";
+   const int nEntries = 200000;
+   {
+      TFile f(ofileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(20000);
+      int i = 0;
+      double x = 0.;
+      std::vector<float> v;
+      t.Branch("i", &i, 4000);
+      t.Branch("x", &x, 4000);
+      t.Branch("v", &v, 4000);
+      for (; i < nEntries; ++i) {
+         x = i * 0.5;
+         v.assign(i % 7, i);
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   const auto oldMode = TTreeCacheUnzip::GetParallelUnzip();
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kEnable);
+   for (Long64_t readAheadSize : {Long64_t(10000000), Long64_t(100000)}) {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      t->SetCacheSize(10000000);
+      t->AddBranchToCache("*", kTRUE);
+      t->StopCacheLearningPhase();
+      auto cache = dynamic_cast<TTreeCacheUnzip *>(t->GetReadCache(&f));
+      ASSERT_NE(cache, nullptr);
+      // A small budget leaves part of the baskets to the cache
+      cache->SetReadAheadSize(readAheadSize);
+      int i = -1;
+      double x = -1.;
+      std::vector<float> *v = nullptr;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("x", &x);
+      t->SetBranchAddress("v", &v);
+      for (int entry = 0; entry < nEntries; ++entry) {
+         ASSERT_GT(t->GetEntry(entry), 0);
+         ASSERT_EQ(i, entry);
+         ASSERT_EQ(x, entry * 0.5);
+         ASSERT_EQ(v->size(), std::size_t(entry % 7));
+      }
+      EXPECT_GT(cache->GetNReadAhead(), 0);
+      t->ResetBranchAddresses();
+      delete v;
+   }
+   TTreeCacheUnzip::SetParallelUnzip(oldMode);
+   gSystem->Unlink(ofileName);
+}
+
+TEST(TTreeImplicitMT, chainEntries)
+{
+   // files of different sizes, one of them empty, and one missing
+   std::vector<std::string> fileNames;
+   for (int i = 0; i < 5; ++i) {
+      fileNames.emplace_back("chainEntriesMT" + std::to_string(i) + ".root");
+      TFile f(fileNames.back().c_str(), "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      t.Branch("x", &x);
+      for (x = 0; x < 10 * (i % 3); ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::EnableImplicitMT(4);
+   TChain c("t");
+   for (const auto &f : fileNames)
+      c.Add(f.c_str());
+   EXPECT_EQ(c.GetEntries(), 0 + 10 + 20 + 0 + 10);
+   // the offsets of the trees are the ones LoadTree would compute
+   EXPECT_EQ(c.GetEntryNumber(25), 25);
+   EXPECT_EQ(c.LoadTree(35), 5);
+   EXPECT_EQ(c.GetTreeNumber(), 4);
+   int x = -1;
+   c.SetBranchAddress("x", &x);
+   c.GetEntry(12);
+   EXPECT_EQ(x, 2);
+
+   TChain missing("t");
+   missing.Add(fileNames[1].c_str());
+   missing.Add("chainEntriesMT_missing.root");
+   missing.Add(fileNames[2].c_str());
+   EXPECT_EQ(missing.GetEntries(), 10 + 20);
+   ROOT::DisableImplicitMT();
+
+   for (const auto &f : fileNames)
+      gSystem->Unlink(f.c_str());
+}
+
 #endif // R__USE_IMT
@@ -1,10 +1,14 @@
 
+#include "ROOT/TBasketBufferPool.hxx"
+#include "ROOT/TDecompressedBasketCache.hxx"
 #include "ROOT/TIOFeatures.hxx"
 #include "TBasket.h"
 #include "TBranch.h"
 #include "TEnum.h"
 #include "TEnumConstant.h"
+#include "TFile.h"
 #include "TMemFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 
 #include "ROOT/TestSupport.hxx"
@@ -411,3 +415,107 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<Bool_t *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, kTRUE);
 }
+
+TEST(TBasket, DecompressedBasketCache)
+{
+   using ROOT::Experimental::TDecompressedBasketCache;
+   const auto fileName = "tbasket_decompressedcache.root";
+   const Int_t nEntries = 10000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      Int_t i = 0;
+      t.Branch("i", &i, 1000);
+      for (; i < nEntries; ++i)
+         t.Fill();
+      t.Write();
+   }
+
+   auto readAll = [&]() {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      Int_t i = -1;
+      t->SetBranchAddress("i", &i);
+      for (Int_t entry = 0; entry < nEntries; ++entry) {
+         ASSERT_GT(t->GetEntry(entry), 0);
+         ASSERT_EQ(i, entry);
+      }
+      t->ResetBranchAddresses();
+   };
+
+   EXPECT_EQ(TDecompressedBasketCache::Get(), nullptr);
+   TDecompressedBasketCache::Enable(100000000);
+   auto cache = TDecompressedBasketCache::Get();
+   ASSERT_NE(cache, nullptr);
+   cache->Clear();
+
+   readAll();
+   const auto nBaskets = cache->GetNMisses();
+   EXPECT_GT(nBaskets, 1);
+   EXPECT_EQ(cache->GetNHits(), 0);
+   EXPECT_GT(cache->GetSize(), 0);
+
+   // the second reader, with another TFile, is served by the cache
+   readAll();
+   EXPECT_EQ(cache->GetNMisses(), nBaskets);
+   EXPECT_EQ(cache->GetNHits(), nBaskets);
+
+   // shrinking the cache evicts baskets, which are then read again
+   const auto size = cache->GetSize();
+   TDecompressedBasketCache::Enable(size / 2);
+   EXPECT_LE(cache->GetSize(), size / 2);
+   readAll();
+   EXPECT_GT(cache->GetNMisses(), nBaskets);
+
+   TDecompressedBasketCache::Disable();
+   EXPECT_EQ(TDecompressedBasketCache::Get(), nullptr);
+   EXPECT_EQ(cache->GetSize(), 0);
+   gSystem->Unlink(fileName);
+}
+
+TEST(TBasket, BufferPool)
+{
+   using ROOT::Internal::TBasketBufferPool;
+   const auto fileName = "tbasket_bufferpool.root";
+   const Int_t nEntries = 10000;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      Int_t i = 0;
+      t.Branch("i", &i, 1000);
+      for (; i < nEntries; ++i)
+         t.Fill();
+      t.Write();
+   }
+
+   auto readAll = [&]() {
+      TFile f(fileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      Int_t i = -1;
+      t->SetBranchAddress("i", &i);
+      for (Int_t entry = 0; entry < nEntries; ++entry) {
+         ASSERT_GT(t->GetEntry(entry), 0);
+         ASSERT_EQ(i, entry);
+      }
+      delete t;
+   };
+
+   TBasketBufferPool::Clear();
+   readAll();
+   // the buffers of the deleted tree are pooled and reused by the next one
+   EXPECT_GT(TBasketBufferPool::GetSize(), 0);
+   const auto nReused = TBasketBufferPool::GetNReused();
+   readAll();
+   EXPECT_GT(TBasketBufferPool::GetNReused(), nReused);
+
+   // a pool of size 0 keeps nothing
+   const auto maxSize = TBasketBufferPool::GetMaxSize();
+   TBasketBufferPool::SetMaxSize(0);
+   TBasketBufferPool::Clear();
+   readAll();
+   EXPECT_EQ(TBasketBufferPool::GetSize(), 0);
+   TBasketBufferPool::SetMaxSize(maxSize);
+   gSystem->Unlink(fileName);
+}
@@ -2,9 +2,15 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TSystem.h"
 
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iterator>
+
 class TBranchTest : public ::testing::Test {
 protected:
    void SetUp() override
@@ -229,4 +235,101 @@ TEST_F(TBranchTest, branchInheritsCompression)
 {
    for(int mode = 4; mode >= 0; --mode)
       ASSERT_TRUE(nocomp(mode)) << "Failed for mode: " << mode;
-}
\ No newline at end of file
+}
+// Fill a tree of small baskets of text compressed with ZSTD, with a compression dictionary trained from the first
+// 50 baskets if `dictionary`, and return its compressed size.
+static Long64_t FillSmallBaskets(const char *filename, bool dictionary)
+{
+   TFile f(filename, "RECREATE", "", ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kZSTD, 5));
+   TTree t("t", "t");
+   char text[64];
+   t.Branch("text", text, "text/C", 2000);
+   if (dictionary)
+      t.EnableCompressionDictionary(50);
+   for (int i = 0; i < 20000; ++i) {
+      snprintf(text, sizeof(text), "run %d lumi %d event %d", 1000 + i / 5000, i / 100, i * 7 % 10007);
+      t.Fill();
+   }
+   t.Write();
+   EXPECT_EQ(t.GetBranch("text")->GetCompressionDictionary().empty(), !dictionary);
+   return t.GetZipBytes();
+}
+
+TEST(TBranch, CompressionDictionary)
+{
+   const auto filename = "TBranchCompressionDictionary.root";
+   const auto plainSize = FillSmallBaskets(filename, false);
+   const auto dictionarySize = FillSmallBaskets(filename, true);
+   EXPECT_LT(dictionarySize, plainSize);
+
+   const auto cloneFilename = "TBranchCompressionDictionaryClone.root";
+   {
+      TFile f(filename);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      EXPECT_FALSE(t->GetBranch("text")->GetCompressionDictionary().empty());
+
+      // the baskets are copied as they are: the copy needs the dictionary as well
+      TFile out(cloneFilename, "RECREATE");
+      t->CloneTree(-1, "fast")->Write();
+   }
+
+   for (auto name : {filename, cloneFilename}) {
+      TFile f(name);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      char text[64];
+      char expected[64];
+      t->SetBranchAddress("text", text);
+      ASSERT_EQ(t->GetEntries(), 20000);
+      for (int i = 0; i < 20000; ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         snprintf(expected, sizeof(expected), "run %d lumi %d event %d", 1000 + i / 5000, i / 100, i * 7 % 10007);
+         ASSERT_STREQ(text, expected);
+      }
+   }
+   gSystem->Unlink(filename);
+   gSystem->Unlink(cloneFilename);
+}
+
+TEST(TBranch, CompressionTuning)
+{
+   const auto filename = "TBranchCompressionTuning.root";
+   const int candidates[] = {404, 501, 505, 509, 101, 106};
+   {
+      TFile f(filename, "RECREATE", "", ROOT::CompressionSettings(ROOT::RCompressionSetting::EAlgorithm::kZLIB, 1));
+      TTree t("t", "t");
+      int slow = 0;
+      double noisy = 0;
+      t.Branch("slow", &slow, "slow/I", 4000);
+      t.Branch("noisy", &noisy, "noisy/D", 4000);
+      t.EnableCompressionTuning(0, 2);
+      for (int i = 0; i < 20000; ++i) {
+         slow = i / 1000;
+         noisy = std::sin(i) * 1e3;
+         t.Fill();
+      }
+      t.Write();
+      for (auto name : {"slow", "noisy"}) {
+         const auto settings = t.GetBranch(name)->GetCompressionSettings();
+         EXPECT_NE(std::find(std::begin(candidates), std::end(candidates), settings), std::end(candidates))
+            << name << " has the settings " << settings;
+      }
+   }
+   {
+      TFile f(filename);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(t, nullptr);
+      int slow = -1;
+      double noisy = 0;
+      t->SetBranchAddress("slow", &slow);
+      t->SetBranchAddress("noisy", &noisy);
+      ASSERT_EQ(t->GetEntries(), 20000);
+      for (int i = 0; i < 20000; ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         ASSERT_EQ(slow, i / 1000);
+         ASSERT_DOUBLE_EQ(noisy, std::sin(i) * 1e3);
+      }
+   }
+   gSystem->Unlink(filename);
+}
@@ -2,6 +2,7 @@
 #include "TTree.h"
 #include "TBranch.h"
 #include "TRandom.h"
+#include "TTreePerfStats.h"
 
 #include "gtest/gtest.h"
 
@@ -53,3 +54,58 @@ TEST_F(TTreeClusterTest, countBaskets)
 
    delete file;
 }
+
+TEST(TTreeClusterTest, adaptiveBasketSizes)
+{
+   TRandom random(836);
+   TFile file("TTreeClusterTestAdaptive.root", "RECREATE");
+   TTree tree("tree", "A tree mixing small and large branches");
+   tree.SetAutoFlush(50);
+   // clusters of about 400 kB (~100 entries), baskets of about 8 kB compressed
+   tree.SetAdaptiveBasketSizes(8000, 400000);
+   TTreePerfStats ps("ps", &tree);
+
+   Char_t flag = 0;
+   Float_t array[1000];
+   auto flagBranch = tree.Branch("flag", &flag, "flag/B");
+   auto arrayBranch = tree.Branch("array", array, "array[1000]/F");
+   const Int_t nEntries = 1000;
+   for (Int_t ev = 0; ev < nEntries; ++ev) {
+      flag = ev % 2;
+      for (auto &value : array)
+         value = random.Gaus(100, 7);
+      tree.Fill();
+   }
+   tree.FlushBaskets();
+   tree.SetPerfStats(nullptr);
+
+   EXPECT_GT(tree.GetAutoFlush(), 60);
+   EXPECT_LT(tree.GetAutoFlush(), 200);
+   EXPECT_LT(flagBranch->GetBasketSize(), 2048);
+   EXPECT_GT(arrayBranch->GetBasketSize(), 8000);
+   EXPECT_LT(arrayBranch->GetBasketSize(), 20000);
+
+   // the flags of a cluster fit in one basket
+   Int_t nClusters = 0;
+   auto clusters = tree.GetClusterIterator(0);
+   for (Long64_t start = clusters(); start < nEntries; start = clusters())
+      ++nClusters;
+   EXPECT_LE(flagBranch->GetWriteBasket(), nClusters);
+
+   bool clusterDecision = false;
+   bool flagDecision = false;
+   bool arrayDecision = false;
+   for (const auto &decision : ps.GetSizeDecisions()) {
+      clusterDecision |= decision.fBranch == nullptr;
+      flagDecision |= decision.fBranch == flagBranch;
+      arrayDecision |= decision.fBranch == arrayBranch;
+   }
+   EXPECT_TRUE(clusterDecision);
+   EXPECT_TRUE(flagDecision);
+   EXPECT_TRUE(arrayDecision);
+
+   for (Int_t ev = 0; ev < nEntries; ++ev) {
+      tree.GetEntry(ev);
+      ASSERT_EQ(flag, ev % 2);
+   }
+}
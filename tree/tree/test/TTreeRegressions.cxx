@@ -1,7 +1,11 @@
+#include "TFile.h"
+#include "TFree.h"
 #include "TMemFile.h"
+#include "TBranch.h"
 #include "TLeaf.h"
 #include "TTree.h"
 #include "TInterpreter.h"
+#include "TList.h"
 #include "TSystem.h"
 
 #include "gtest/gtest.h"
@@ -115,3 +119,54 @@ TEST(TTreeRegressions, GetLeafAndFriends)
    EXPECT_EQ(t.GetLeaf("asdklj", "x"), nullptr);
    EXPECT_EQ(t.GetLeaf("asdklj", "vec"), nullptr);
 }
+
+TEST(TTreeRegressions, ImportBaskets)
+{
+   // the records of the source file follow its header of 100 bytes
+   const Long64_t kBegin = 100;
+   TMemFile src("tree_importbaskets_src.root", "RECREATE");
+   TTree t("t", "t");
+   t.SetAutoFlush(0);
+   int x = 0;
+   t.Branch("x", &x, 1000);
+   for (x = 0; x < 1000; ++x)
+      t.Fill();
+   src.Write();
+   ASSERT_GT(t.GetBranch("x")->GetWriteBasket(), 1);
+
+   const Long64_t nbytes = src.GetEND() - kBegin;
+   std::vector<char> image(src.GetEND());
+   src.CopyTo(image.data(), image.size());
+
+   {
+      TFile out("tree_importbaskets.root", "RECREATE");
+      // reserve a region at the end of the file and copy the records of the source file there
+      const Long64_t offset = out.GetEND();
+      auto lastfree = static_cast<TFree *>(out.GetListOfFree()->Last());
+      ASSERT_EQ(lastfree->GetFirst(), offset);
+      lastfree->SetFirst(offset + nbytes);
+      out.SetEND(offset + nbytes);
+      out.Seek(offset);
+      ASSERT_FALSE(out.WriteBuffer(image.data() + kBegin, nbytes));
+
+      auto imported = t.CloneTree(0);
+      imported->SetDirectory(&out);
+      EXPECT_EQ(imported->ImportBaskets(&t, offset - kBegin), 1000);
+      EXPECT_EQ(imported->ImportBaskets(&t, offset - kBegin), 1000);
+      EXPECT_EQ(imported->GetEntries(), 2000);
+      out.Write();
+   }
+
+   TFile in("tree_importbaskets.root");
+   auto imported = in.Get<TTree>("t");
+   ASSERT_NE(imported, nullptr);
+   EXPECT_EQ(imported->GetEntries(), 2000);
+   int y = -1;
+   imported->SetBranchAddress("x", &y);
+   for (Long64_t i = 0; i < imported->GetEntries(); ++i) {
+      imported->GetEntry(i);
+      EXPECT_EQ(y, i % 1000);
+   }
+   in.Close();
+   gSystem->Unlink("tree_importbaskets.root");
+}
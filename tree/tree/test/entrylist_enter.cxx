@@ -93,3 +93,36 @@ TEST(TEntryList, EnterByTreeName) {
    for (int i = 0; i < 3; ++i)
       EXPECT_EQ(t2e->GetEntry(i), i * 2 + 6);
 }
+
+TEST(TEntryList, ContainsRange) {
+   TEntryList e;
+   e.Enter(10);
+   e.Enter(70000); // in the second block
+   e.Enter(70001);
+
+   auto check = [&e]() {
+      EXPECT_FALSE(e.ContainsRange(0, 9));
+      EXPECT_TRUE(e.ContainsRange(0, 10));
+      EXPECT_TRUE(e.ContainsRange(10, 10));
+      EXPECT_FALSE(e.ContainsRange(11, 69999));
+      EXPECT_TRUE(e.ContainsRange(11, 70000));
+      EXPECT_TRUE(e.ContainsRange(70001, 1000000));
+      EXPECT_FALSE(e.ContainsRange(70002, 1000000));
+      EXPECT_FALSE(e.ContainsRange(20, 10));
+   };
+   check();
+   // the blocks now store the entries as a list instead of bits
+   e.OptimizeStorage();
+   check();
+
+   // a block storing the entries that are not in the list
+   TEntryList dense;
+   for (int i = 0; i < 64000; ++i)
+      if (i != 500)
+         dense.Enter(i);
+   dense.OptimizeStorage();
+   EXPECT_TRUE(dense.ContainsRange(0, 63999));
+   EXPECT_FALSE(dense.ContainsRange(500, 500));
+   EXPECT_TRUE(dense.ContainsRange(500, 501));
+   EXPECT_FALSE(dense.ContainsRange(64000, 70000));
+}
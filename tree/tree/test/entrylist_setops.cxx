@@ -0,0 +1,70 @@
+#include "TEntryList.h"
+
+#include "gtest/gtest.h"
+
+#include <set>
+#include <vector>
+
+namespace {
+
+// Fill blocks of 64000 entries with different densities, so that after optimization the
+// blocks are stored as lists of passing entries, as bits and as lists of non-passing entries
+void FillList(TEntryList &elist, std::set<Long64_t> &entries, const std::vector<int> &strides, Long64_t offset)
+{
+   for (std::size_t block = 0; block < strides.size(); ++block) {
+      for (Long64_t i = 0; i < 64000; ++i) {
+         const bool pass = strides[block] > 0 ? (i + offset) % strides[block] == 0 : (i + offset) % -strides[block] != 0;
+         if (pass) {
+            const auto entry = Long64_t(block) * 64000 + i;
+            elist.Enter(entry);
+            entries.insert(entry);
+         }
+      }
+   }
+   elist.OptimizeStorage();
+}
+
+void ExpectSameEntries(TEntryList &elist, const std::set<Long64_t> &entries)
+{
+   ASSERT_EQ(elist.GetN(), Long64_t(entries.size()));
+   Long64_t index = 0;
+   for (auto entry : entries) {
+      ASSERT_EQ(elist.GetEntry(index), entry) << "at index " << index;
+      ++index;
+   }
+   for (Long64_t entry = 0; entry < 4 * 64000; entry += 11)
+      ASSERT_EQ(elist.Contains(entry) != 0, entries.count(entry) != 0) << "for entry " << entry;
+}
+
+} // namespace
+
+TEST(TEntryList, AddBlocks)
+{
+   const std::vector<int> strides1{100, 3, -200, 2};
+   const std::vector<int> strides2{7, -300, 5, 1000};
+   for (Long64_t offset : {0, 1}) {
+      TEntryList e1, e2;
+      std::set<Long64_t> s1, s2;
+      FillList(e1, s1, strides1, 0);
+      FillList(e2, s2, strides2, offset);
+      e1.Add(&e2);
+      s1.insert(s2.begin(), s2.end());
+      ExpectSameEntries(e1, s1);
+   }
+}
+
+TEST(TEntryList, SubtractBlocks)
+{
+   const std::vector<int> strides1{100, 3, -200, 2};
+   const std::vector<int> strides2{7, -300, 5, 1000};
+   for (Long64_t offset : {0, 1}) {
+      TEntryList e1, e2;
+      std::set<Long64_t> s1, s2;
+      FillList(e1, s1, strides1, 0);
+      FillList(e2, s2, strides2, offset);
+      e1.Subtract(&e2);
+      for (auto entry : s2)
+         s1.erase(entry);
+      ExpectSameEntries(e1, s1);
+   }
+}
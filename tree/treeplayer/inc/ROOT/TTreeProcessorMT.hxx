@@ -94,6 +94,9 @@ private:
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
 
+   /// If set, Process() hands out the entries through a ROOT::Internal::RRangeScheduler, see SetDynamicScheduling()
+   bool fDynamicScheduling = false;
+
 public:
    TTreeProcessorMT(std::string_view filename, std::string_view treename = "", UInt_t nThreads = 0u,
                     const std::pair<Long64_t, Long64_t> &globalRange = {0, std::numeric_limits<Long64_t>::max()});
@@ -109,6 +112,10 @@ public:
 
    void Process(std::function<void(TTreeReader &)> func);
 
+   /// Let idle workers split the ranges of busy workers instead of fixing all the tasks up front, see Process()
+   void SetDynamicScheduling(bool dynamicScheduling) { fDynamicScheduling = dynamicScheduling; }
+   bool GetDynamicScheduling() const { return fDynamicScheduling; }
+
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
 };
@@ -69,6 +69,7 @@ protected:
    std::vector<TChainIndexEntry> fEntries; // descriptions of indices of trees in the chain.
 
    std::pair<TVirtualIndex*, Int_t> GetSubTreeIndex(Long64_t major, Long64_t minor) const;
+   TVirtualIndex *LoadSubTreeIndex(Int_t treeNo) const;
    void ReleaseSubTreeIndex(TVirtualIndex* index, Int_t treeNo) const;
    void DeleteIndices();
 
@@ -83,6 +84,8 @@ public:
    Long64_t       GetEntryNumberFriend(const TTree *parent) override;
    Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const override;
    Long64_t       GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const override;
+   Long64_t       GetEntryNumbersWithIndexRange(Long64_t majorLow, Long64_t minorLow, Long64_t majorHigh,
+                                                Long64_t minorHigh, std::vector<Long64_t> &entries) const override;
    const char    *GetMajorName()    const override {return fMajorName.Data();}
    const char    *GetMinorName()    const override {return fMinorName.Data();}
    Long64_t       GetN()            const override {return fEntries.size();}
@@ -24,6 +24,8 @@
 
 #include "TVirtualIndex.h"
 
+#include <vector>
+
 class TTreeFormula;
 
 class TTreeIndex : public TVirtualIndex {
@@ -39,9 +41,15 @@ protected:
    TTreeFormula  *fMinorFormula;        ///<! Pointer to minor TreeFormula
    TTreeFormula  *fMajorFormulaParent;  ///<! Pointer to major TreeFormula in Parent tree (if any)
    TTreeFormula  *fMinorFormulaParent;  ///<! Pointer to minor TreeFormula in Parent tree (if any)
+   const TTree   *fFriendCacheTree = nullptr;  ///<! Tree of the parent whose entries are mapped in fFriendCache
+   Int_t          fFriendCacheTreeNumber = -1; ///<! Tree number of the parent when fFriendCache was filled
+   Long64_t       fFriendCacheFirst = 0;       ///<! First entry of fFriendCacheTree mapped in fFriendCache
+   std::vector<Long64_t> fFriendCache;         ///<! Entry numbers in this tree of the parent entries from fFriendCacheFirst
 
+   Bool_t         FindFriendEntryInCache(const TTree *parent, Long64_t &entry);
    TTreeFormula  *GetMajorFormulaParent(const TTree *parent);
    TTreeFormula  *GetMinorFormulaParent(const TTree *parent);
+   Bool_t         ReadIndexColumns(Long64_t *major, Long64_t *minor);
 
 private:
    TTreeIndex(const TTreeIndex&) = delete;            // Not implemented.
@@ -57,6 +65,8 @@ public:
    Long64_t       GetEntryNumberFriend(const TTree *parent) override;
    Long64_t       GetEntryNumberWithIndex(Long64_t major, Long64_t minor) const override;
    Long64_t       GetEntryNumberWithBestIndex(Long64_t major, Long64_t minor) const override;
+   Long64_t       GetEntryNumbersWithIndexRange(Long64_t majorLow, Long64_t minorLow, Long64_t majorHigh,
+                                                Long64_t minorHigh, std::vector<Long64_t> &entries) const override;
    virtual Long64_t      *GetIndex()        const {return fIndex;}
    virtual Long64_t      *GetIndexValues()  const {return fIndexValues;}
    virtual Long64_t      *GetIndexValuesMinor()  const;
@@ -70,7 +80,7 @@ public:
    void           UpdateFormulaLeaves(const TTree *parent) override;
    void           SetTree(TTree *T) override;
 
-   ClassDefOverride(TTreeIndex,2);  //A Tree Index with majorname and minorname.
+   ClassDefOverride(TTreeIndex,3);  //A Tree Index with majorname and minorname.
 };
 
 #endif
@@ -45,6 +45,14 @@ public:
       UInt_t fMissed = {0};      ///<  Number of times the basket was read directly from the file.
    };
 
+   /// A change of the basket size of a branch or of the cluster size decided while the tree was written
+   struct SizeDecision {
+      TBranch *fBranch = nullptr; ///<  The branch whose basket size changed, nullptr for the cluster size
+      Long64_t fEntry = 0;        ///<  Number of entries written when the size changed
+      Long64_t fOldSize = 0;      ///<  Previous basket size in bytes or cluster size in entries
+      Long64_t fNewSize = 0;      ///<  New basket size in bytes or cluster size in entries
+   };
+
    using BasketList_t = std::vector<std::pair<TBranch*, std::vector<size_t>>>;
 
 protected:
@@ -75,6 +83,7 @@ protected:
 
    std::unordered_map<TBranch*, size_t>  fBranchIndexCache; // Cache the index of the branch in the cache's array.
    std::vector<std::vector<BasketInfo> > fBasketsInfo;      // Details on which baskets was used, cached, 'miss-cached' or read uncached.Browse
+   std::vector<SizeDecision> fSizeDecisions;                //! Basket and cluster size changes of the tree while it was written
 
    BasketInfo &GetBasketInfo(TBranch *b, size_t basketNumber);
    BasketInfo &GetBasketInfo(size_t bi, size_t basketNumber);
@@ -151,6 +160,15 @@ public:
    void     SetUsed(TBranch *b, size_t basketNumber) override { ++GetBasketInfo(b, basketNumber).fUsed; }
    void     SetUsed(size_t bi, size_t basketNumber) override { ++GetBasketInfo(bi, basketNumber).fUsed; }
    void     UpdateBranchIndices(TObjArray *branchNames) override;
+   void     BasketSizeEvent(TBranch *branch, Long64_t entry, Int_t oldSize, Int_t newSize) override
+   {
+      fSizeDecisions.push_back({branch, entry, oldSize, newSize});
+   }
+   void     ClusterSizeEvent(TObject *, Long64_t entry, Long64_t oldSize, Long64_t newSize) override
+   {
+      fSizeDecisions.push_back({nullptr, entry, oldSize, newSize});
+   }
+   const std::vector<SizeDecision> &GetSizeDecisions() const { return fSizeDecisions; }
 
    BasketList_t     GetDuplicateBasketCache() const;
 
@@ -28,6 +28,7 @@
 
 #include <deque>
 #include <iterator>
+#include <set>
 #include <unordered_map>
 #include <string>
 
@@ -218,6 +219,13 @@ public:
    /// Restart a Next() loop from entry 0 (of TEntryList index 0 of fEntryList is set).
    void Restart();
 
+   /// Declare that the branch read by the TTreeReaderValue or TTreeReaderArray of the given name is accessed only
+   /// for a small fraction of the entries, e.g. because it is read behind a selective cut. Such a branch is not
+   /// added to the TTreeCache, so that its baskets are not prefetched for all the entries. Instead, the cache
+   /// fetches the baskets of all sparse branches needed by an entry together (see TTreeCache::SetOptimizeMisses()).
+   /// Must be called before the first entry is read.
+   void AddSparseBranch(const std::string &branchName) { fSparseBranches.insert(branchName); }
+
    ///\}
 
    EEntryStatus GetEntryStatus() const { return fEntryStatus; }
@@ -307,6 +315,7 @@ private:
    Long64_t fBeginEntry = 0LL; ///< This allows us to propagate the range to the TTreeCache
    Bool_t fProxiesSet = kFALSE; ///< True if the proxies have been set, false otherwise
    Bool_t fSetEntryBaseCallingLoadTree = kFALSE; ///< True if during the LoadTree execution triggered by SetEntryBase.
+   std::set<std::string> fSparseBranches; ///< Branches that are not added to the TTreeCache, see AddSparseBranch()
 
    friend class ROOT::Internal::TTreeReaderValueBase;
    friend class ROOT::Internal::TTreeReaderArrayBase;
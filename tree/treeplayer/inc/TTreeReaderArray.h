@@ -17,6 +17,7 @@
 
 #include "TTreeReaderValue.h"
 #include "TTreeReaderUtils.h"
+#include <ROOT/RSpan.hxx>
 #include <type_traits>
 
 namespace ROOT {
@@ -34,6 +35,8 @@ Base class of TTreeReaderArray.
 
       std::size_t GetSize() const { return fImpl->GetSize(GetProxy()); }
       Bool_t IsEmpty() const { return !GetSize(); }
+      /// Whether the elements of the collection are stored contiguously, i.e. whether GetSpan() can be used.
+      bool IsContiguous() const { return fImpl && fImpl->IsContiguous(GetProxy()); }
 
       EReadStatus GetReadStatus() const override { return fImpl ? fImpl->fReadStatus : kReadError; }
 
@@ -207,6 +210,22 @@ public:
    T &operator[](std::size_t idx) { return At(idx); }
    const T &operator[](std::size_t idx) const { return At(idx); }
 
+   /// A view of the elements of the current entry, whose element access is inlined instead of going through At().
+   /// The span is empty if the collection is empty or if its elements are not stored contiguously, e.g. for the
+   /// data members of the objects of a collection; see IsContiguous(). It is invalidated by the next entry read.
+   std::span<T> GetSpan()
+   {
+      const auto size = GetSize();
+      if (size == 0 || !IsContiguous())
+         return std::span<T>();
+      return std::span<T>(&At(0), size);
+   }
+   std::span<const T> GetSpan() const
+   {
+      auto span = const_cast<TTreeReaderArray *>(this)->GetSpan();
+      return std::span<const T>(span.data(), span.size());
+   }
+
    iterator begin() { return iterator(0u, this); }
    iterator end() { return iterator(GetSize(), this); }
    const_iterator begin() const { return cbegin(); }
@@ -76,6 +76,9 @@ namespace Internal {
       virtual ~TVirtualCollectionReader();
       virtual size_t GetSize(Detail::TBranchProxy*) = 0;
       virtual void* At(Detail::TBranchProxy*, size_t /*idx*/) = 0;
+      /// Whether the element idx is always at `At(0) + idx * <size of the element>`, e.g. for C arrays and
+      /// std::vector of objects, so that the elements can be accessed without going through At().
+      virtual bool IsContiguous(Detail::TBranchProxy*) { return false; }
    };
 
 }
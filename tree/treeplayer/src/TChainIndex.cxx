@@ -221,24 +221,30 @@ std::pair<TVirtualIndex*, Int_t> TChainIndex::GetSubTreeIndex(Long64_t major, Lo
    if( indexValue > fEntries[treeNo].GetMaxIndexValPair() ) {
       return make_pair(static_cast<TVirtualIndex*>(0), 0);
    }
+   TVirtualIndex* index = LoadSubTreeIndex(treeNo);
+   return make_pair(index, index ? treeNo : 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load the tree number treeNo of the chain and return its index, or 0 if it
+/// has none. The tree index should be later released using ReleaseSubTreeIndex();
+
+TVirtualIndex *TChainIndex::LoadSubTreeIndex(Int_t treeNo) const
+{
    TChain* chain = dynamic_cast<TChain*> (fTree);
    R__ASSERT(chain);
    chain->LoadTree(chain->GetTreeOffset()[treeNo]);
    TVirtualIndex* index =  fTree->GetTree()->GetTreeIndex();
    if (index)
-      return make_pair(static_cast<TVirtualIndex*>(index), treeNo);
-   else {
-      index = fEntries[treeNo].fTreeIndex;
-      if (!index) {
-         Warning("GetSubTreeIndex", "The tree has no index and the chain index"
-                  " doesn't store an index for that tree");
-         return make_pair(static_cast<TVirtualIndex*>(0), 0);
-      }
-      else {
-         fTree->GetTree()->SetTreeIndex(index);
-         return make_pair(static_cast<TVirtualIndex*>(index), treeNo);
-      }
+      return index;
+   index = fEntries[treeNo].fTreeIndex;
+   if (!index) {
+      Warning("GetSubTreeIndex", "The tree has no index and the chain index"
+               " doesn't store an index for that tree");
+      return nullptr;
    }
+   fTree->GetTree()->SetTreeIndex(index);
+   return index;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +335,38 @@ Long64_t TChainIndex::GetEntryNumberWithIndex(Long64_t major, Long64_t minor) co
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Append to `entries` the entry numbers of the chain of all the index values
+/// from (majorLow, minorLow) to (majorHigh, minorHigh), both included.
+/// Only the trees whose range of index values overlaps with the requested one
+/// are queried. See TTreeIndex::GetEntryNumbersWithIndexRange for details.
+
+Long64_t TChainIndex::GetEntryNumbersWithIndexRange(Long64_t majorLow, Long64_t minorLow, Long64_t majorHigh,
+                                                    Long64_t minorHigh, std::vector<Long64_t> &entries) const
+{
+   const TChainIndexEntry::IndexValPair_t low(majorLow, minorLow), high(majorHigh, minorHigh);
+   TChain* chain = dynamic_cast<TChain*> (fTree);
+   R__ASSERT(chain);
+   Long64_t n = 0;
+   for (unsigned int i = 0; i < fEntries.size(); i++) {
+      if (fEntries[i].GetMaxIndexValPair() < low || high < fEntries[i].GetMinIndexValPair())
+         continue;
+      TVirtualIndex *index = LoadSubTreeIndex(i);
+      if (!index)
+         return -1;
+      const auto first = entries.size();
+      const Long64_t rv = index->GetEntryNumbersWithIndexRange(majorLow, minorLow, majorHigh, minorHigh, entries);
+      ReleaseSubTreeIndex(index, i);
+      if (rv < 0)
+         return -1;
+      const Long64_t offset = chain->GetTreeOffset()[i];
+      for (auto e = first; e < entries.size(); ++e)
+         entries[e] += offset;
+      n += rv;
+   }
+   return n;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return a pointer to the TreeFormula corresponding to the majorname in parent tree T.
 
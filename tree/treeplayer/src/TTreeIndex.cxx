@@ -17,8 +17,22 @@ A Tree Index with majorname and minorname.
 
 #include "TTreeFormula.h"
 #include "TTree.h"
+#include "TBranch.h"
 #include "TBuffer.h"
+#include "TBufferFile.h"
+#include "TLeaf.h"
+#include "TLeafElement.h"
+#include "TLeafObject.h"
 #include "TMath.h"
+#include "ROOT/RConfig.hxx"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
+#include <algorithm>
+#include <numeric>
 
 ClassImp(TTreeIndex);
 
@@ -30,7 +44,7 @@ struct IndexSortComparator {
   {}
 
    template<typename Index>
-   bool operator()(Index i1, Index i2) {
+   bool operator()(Index i1, Index i2) const {
       if( *(fValMajor + i1) == *(fValMajor + i2) )
          return *(fValMinor + i1) < *(fValMinor + i2);
       else
@@ -42,6 +56,98 @@ struct IndexSortComparator {
   Long64_t *fValMajor, *fValMinor;
 };
 
+namespace {
+
+// Flags of the compact representation written by TTreeIndex::Streamer (version 3)
+enum EStreamerFlags : UChar_t {
+   kIdentityIndex = BIT(0), ///< fIndex[i] == i, it is not written
+   kRunLengthMajor = BIT(1) ///< the major values are written as (value, number of repetitions) pairs
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the `n` first values of the integer `branch` of type T into `values`,
+/// one basket at a time with the bulk API. Return false if this failed.
+
+template <typename T>
+Bool_t ReadBulkValues(TBranch &branch, Long64_t *values, Long64_t n)
+{
+   TBufferFile buf(TBuffer::kWrite, 32 * 1024);
+   Long64_t entry = 0;
+   while (entry < n) {
+      const Int_t count = branch.GetBulkRead().GetBulkEntries(entry, buf);
+      if (count <= 0)
+         return kFALSE;
+      const T *data = reinterpret_cast<const T *>(buf.GetCurrent());
+      const Long64_t last = std::min(entry + count, n);
+      for (Long64_t i = entry; i < last; ++i)
+         values[i] = static_cast<Long64_t>(data[i - entry]);
+      entry = last;
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the values of the index expression `name` directly from its branch if
+/// it is the name of a branch holding one integer per entry (or "0"), without
+/// evaluating a TTreeFormula for each entry. Return false if this is not
+/// possible, the caller then falls back to the TTreeFormula.
+
+Bool_t ReadIntegerColumn(TTree &tree, const TString &name, Long64_t *values, Long64_t n)
+{
+   if (name == "0") {
+      std::fill(values, values + n, 0);
+      return kTRUE;
+   }
+   if (tree.GetAlias(name))
+      return kFALSE;
+   TBranch *branch = tree.GetBranch(name);
+   if (!branch || branch->GetListOfBranches()->GetEntriesFast() > 0 || !branch->GetBulkRead().SupportsBulkRead())
+      return kFALSE;
+   TLeaf *leaf = static_cast<TLeaf *>(branch->GetListOfLeaves()->UncheckedAt(0));
+   if (leaf->GetLeafCount() || leaf->GetLenStatic() != 1)
+      return kFALSE;
+
+   const TString type = leaf->GetTypeName();
+   if (type == "Char_t")
+      return ReadBulkValues<Char_t>(*branch, values, n);
+   if (type == "UChar_t" || type == "Bool_t")
+      return ReadBulkValues<UChar_t>(*branch, values, n);
+   if (type == "Short_t")
+      return ReadBulkValues<Short_t>(*branch, values, n);
+   if (type == "UShort_t")
+      return ReadBulkValues<UShort_t>(*branch, values, n);
+   if (type == "Int_t")
+      return ReadBulkValues<Int_t>(*branch, values, n);
+   if (type == "UInt_t")
+      return ReadBulkValues<UInt_t>(*branch, values, n);
+   if (type == "Long64_t")
+      return ReadBulkValues<Long64_t>(*branch, values, n);
+   if (type == "ULong64_t")
+      return ReadBulkValues<ULong64_t>(*branch, values, n);
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sort the `n` entry numbers of `index` according to `comparator`. With
+/// implicit multi-threading enabled, large indices are sorted in parallel
+/// with TThreadExecutor::Sort.
+
+void SortIndex(Long64_t *index, Long64_t n, const IndexSortComparator &comparator)
+{
+#ifdef R__USE_IMT
+   // below this size the overhead of the tasks is not worth it
+   const Long64_t kMinParallelSize = 100000;
+   if (ROOT::IsImplicitMTEnabled() && n >= kMinParallelSize) {
+      ROOT::TThreadExecutor pool;
+      pool.Sort(index, index + n, comparator, std::min<Long64_t>(pool.GetPoolSize(), n / kMinParallelSize));
+      return;
+   }
+#endif
+   std::sort(index, index + n, comparator);
+}
+
+} // anonymous namespace
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor for TTreeIndex
@@ -169,7 +275,8 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    Long64_t i;
    Long64_t oldEntry = fTree->GetReadEntry();
    Int_t current = -1;
-   for (i=0;i<fN;i++) {
+   const Bool_t columnsRead = ReadIndexColumns(tmp_major, tmp_minor);
+   for (i=0;i<fN && !columnsRead;i++) {
       Long64_t centry = fTree->LoadTree(i);
       if (centry < 0) break;
       if (fTree->GetTreeNumber() != current) {
@@ -200,19 +307,40 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
       tmp_minor[i] = GetAndRangeCheck(false, i);
    }
    fIndex = new Long64_t[fN];
-   for(i = 0; i < fN; i++) { fIndex[i] = i; }
-   std::sort(fIndex, fIndex + fN, IndexSortComparator(tmp_major, tmp_minor) );
-   //TMath::Sort(fN,w,fIndex,0);
-   fIndexValues = new Long64_t[fN];
-   fIndexValuesMinor = new Long64_t[fN];
-   for (i=0;i<fN;i++) {
-      fIndexValues[i] = tmp_major[fIndex[i]];
-      fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
+   std::iota(fIndex, fIndex + fN, 0);
+   IndexSortComparator comparator(tmp_major, tmp_minor);
+   // the values are often already in order, e.g. the events of the runs written one after the other
+   if (!std::is_sorted(fIndex, fIndex + fN, comparator)) {
+      SortIndex(fIndex, fN, comparator);
+      fIndexValues = new Long64_t[fN];
+      fIndexValuesMinor = new Long64_t[fN];
+      for (i=0;i<fN;i++) {
+         fIndexValues[i] = tmp_major[fIndex[i]];
+         fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
+      }
+      delete [] tmp_major;
+      delete [] tmp_minor;
+   } else {
+      fIndexValues = tmp_major;
+      fIndexValuesMinor = tmp_minor;
    }
 
-   delete [] tmp_major;
-   delete [] tmp_minor;
-   fTree->LoadTree(oldEntry);
+   if (!columnsRead)
+      fTree->LoadTree(oldEntry);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the major and minor values of all the entries of fTree directly from
+/// their branches with the bulk I/O API, if the major and minor names are names
+/// of branches holding one integer per entry (or "0"). This is much faster
+/// than evaluating the TTreeFormula for each entry. Return false if this is not
+/// possible (e.g. for expressions or a TChain).
+
+Bool_t TTreeIndex::ReadIndexColumns(Long64_t *major, Long64_t *minor)
+{
+   if (fTree->GetTree() != fTree)
+      return kFALSE;
+   return ReadIntegerColumn(*fTree, fMajorName, major, fN) && ReadIntegerColumn(*fTree, fMinorName, minor, fN);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -238,6 +366,8 @@ TTreeIndex::~TTreeIndex()
 void TTreeIndex::Append(const TVirtualIndex *add, Bool_t delaySort )
 {
 
+   fFriendCacheTree = nullptr;
+   fFriendCache.clear();
    if (add && add->GetN()) {
       // Create new buffer (if needed)
 
@@ -358,6 +488,12 @@ Long64_t TTreeIndex::GetEntryNumberFriend(const TTree *parent)
       return pentry;
    }
 
+   // the entries of the parent are mapped cluster by cluster, if the
+   // majorname and minorname are simple leaves of the parent Tree
+   Long64_t entry = -1;
+   if (FindFriendEntryInCache(parent, entry))
+      return entry;
+
    // majorname, minorname exist in the parent Tree
    // we find the current values pair majorv,minorv in the parent Tree
    Double_t majord = fMajorFormulaParent->EvalInstance();
@@ -371,6 +507,96 @@ Long64_t TTreeIndex::GetEntryNumberFriend(const TTree *parent)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find in fFriendCache the entry of this tree matching the current entry of the
+/// parent tree. Return false if the entries of the parent cannot be mapped in
+/// advance, e.g. because majorname or minorname are expressions.
+///
+/// The cache is filled from the current entry to the end of its cluster at once:
+/// only the branches of majorname and minorname are read for these entries, and
+/// the lookups of consecutive values in the sorted table start at the previous
+/// position instead of the full binary search. The branches are read back at the
+/// current entry before returning.
+
+Bool_t TTreeIndex::FindFriendEntryInCache(const TTree *parent, Long64_t &entry)
+{
+   TTree *ptree = parent->GetTree();
+   if (!ptree)
+      return kFALSE;
+   const Long64_t pentry = ptree->GetReadEntry();
+   if (pentry < 0)
+      return kFALSE;
+   if (ptree == fFriendCacheTree && parent->GetTreeNumber() == fFriendCacheTreeNumber) {
+      // an empty cache of the right parent means that it cannot be filled
+      if (fFriendCache.empty())
+         return kFALSE;
+      if (pentry >= fFriendCacheFirst && pentry < fFriendCacheFirst + (Long64_t)fFriendCache.size()) {
+         entry = fFriendCache[pentry - fFriendCacheFirst];
+         return kTRUE;
+      }
+   }
+   fFriendCacheTree = ptree;
+   fFriendCacheTreeNumber = parent->GetTreeNumber();
+   fFriendCache.clear();
+
+   // only the leaves holding one number can be read entry by entry
+   auto simpleLeaf = [parent, ptree](const TString &name) -> TLeaf * {
+      if (parent->GetAlias(name) || ptree->GetAlias(name))
+         return nullptr;
+      TLeaf *leaf = ptree->GetLeaf(name);
+      if (!leaf || leaf->GetBranch()->GetTree() != ptree || leaf->GetLeafCount() || leaf->GetLen() != 1 ||
+          leaf->InheritsFrom(TLeafElement::Class()) || leaf->InheritsFrom(TLeafObject::Class()))
+         return nullptr;
+      return leaf;
+   };
+   TLeaf *majorLeaf = simpleLeaf(fMajorName);
+   TLeaf *minorLeaf = simpleLeaf(fMinorName);
+   if (!majorLeaf || !minorLeaf || fN == 0)
+      return kFALSE;
+   TBranch *majorBranch = majorLeaf->GetBranch();
+   TBranch *minorBranch = minorLeaf->GetBranch();
+
+   const Long64_t kMaxCacheSize = 100000;
+   auto clusters = ptree->GetClusterIterator(pentry);
+   clusters();
+   const Long64_t last = std::min({clusters.GetNextEntry(), ptree->GetEntries(), pentry + kMaxCacheSize});
+   if (last <= pentry)
+      return kFALSE;
+
+   fFriendCacheFirst = pentry;
+   fFriendCache.resize(last - pentry);
+   Long64_t pos = 0;
+   for (Long64_t e = pentry; e < last; ++e) {
+      if (majorBranch->GetEntry(e, 1) < 0 || (minorBranch != majorBranch && minorBranch->GetEntry(e, 1) < 0)) {
+         fFriendCache.clear();
+         break;
+      }
+      // same conversion as for the values of the formulas in GetEntryNumberFriend
+      const Long64_t majorv = (Long64_t)majorLeaf->GetValue();
+      const Long64_t minorv = (Long64_t)minorLeaf->GetValue();
+      // the values of consecutive entries are often next to each other in the table
+      // and the hint must be the first position of the values, as found by FindValues
+      const Bool_t hint = pos < fN && fIndexValues[pos] == majorv && fIndexValuesMinor[pos] == minorv &&
+                          (pos == 0 || fIndexValues[pos - 1] != majorv || fIndexValuesMinor[pos - 1] != minorv);
+      if (!hint)
+         pos = FindValues(majorv, minorv);
+      if (pos < fN && fIndexValues[pos] == majorv && fIndexValuesMinor[pos] == minorv) {
+         fFriendCache[e - pentry] = fIndex[pos];
+         ++pos;
+      } else {
+         fFriendCache[e - pentry] = -1;
+      }
+   }
+   majorBranch->GetEntry(pentry, 1);
+   if (minorBranch != majorBranch)
+      minorBranch->GetEntry(pentry, 1);
+
+   if (fFriendCache.empty())
+      return kFALSE;
+   entry = fFriendCache[0];
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// find position where major|minor values are in the IndexValues tables
 /// this is the index in IndexValues table, not entry# !
@@ -446,6 +672,34 @@ Long64_t TTreeIndex::GetEntryNumberWithIndex(Long64_t major, Long64_t minor) con
    return -1;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Append to `entries` the entry numbers of all the index values from
+/// (majorLow, minorLow) to (majorHigh, minorHigh), both included, ordered by
+/// index value. The range is found with two binary searches in the sorted
+/// table of values. Return the number of entries appended.
+///
+/// For example, to get all the entries of run 5:
+/// ~~~{.cpp}
+/// std::vector<Long64_t> entries;
+/// tree->GetTreeIndex()->GetEntryNumbersWithIndexRange(5, LLONG_MIN, 5, LLONG_MAX, entries);
+/// ~~~
+
+Long64_t TTreeIndex::GetEntryNumbersWithIndexRange(Long64_t majorLow, Long64_t minorLow, Long64_t majorHigh,
+                                                   Long64_t minorHigh, std::vector<Long64_t> &entries) const
+{
+   if (fN == 0)
+      return 0;
+
+   const Long64_t begin = FindValues(majorLow, minorLow);
+   Long64_t end = FindValues(majorHigh, minorHigh);
+   while (end < fN && fIndexValues[end] == majorHigh && fIndexValuesMinor[end] == minorHigh)
+      ++end;
+   if (end <= begin)
+      return 0;
+   entries.insert(entries.end(), fIndex + begin, fIndex + end);
+   return end - begin;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -587,8 +841,23 @@ void TTreeIndex::Streamer(TBuffer &R__b)
       fMajorName.Streamer(R__b);
       fMinorName.Streamer(R__b);
       R__b >> fN;
+      UChar_t flags = 0;
+      if (R__v > 2)
+         R__b >> flags;
       fIndexValues = new Long64_t[fN];
-      R__b.ReadFastArray(fIndexValues,fN);
+      if (flags & kRunLengthMajor) {
+         // (value, number of repetitions) pairs
+         Long64_t nRuns, pos = 0;
+         R__b >> nRuns;
+         for (Long64_t r = 0; r < nRuns; ++r) {
+            Long64_t value, length;
+            R__b >> value >> length;
+            std::fill(fIndexValues + pos, fIndexValues + pos + length, value);
+            pos += length;
+         }
+      } else {
+         R__b.ReadFastArray(fIndexValues,fN);
+      }
       if( R__v > 1 ) {
          fIndexValuesMinor = new Long64_t[fN];
          R__b.ReadFastArray(fIndexValuesMinor,fN);
@@ -596,17 +865,48 @@ void TTreeIndex::Streamer(TBuffer &R__b)
          ConvertOldToNew();
       }
       fIndex      = new Long64_t[fN];
-      R__b.ReadFastArray(fIndex,fN);
+      if (flags & kIdentityIndex)
+         std::iota(fIndex, fIndex + fN, 0);
+      else
+         R__b.ReadFastArray(fIndex,fN);
       R__b.CheckByteCount(R__s, R__c, TTreeIndex::IsA());
    } else {
+      // The major values are sorted, hence typically made of long runs of the same value (e.g. the run number),
+      // and the index is often the identity (the entries were written in order): both are written compactly.
+      Long64_t nRuns = fN > 0 ? 1 : 0;
+      for (Long64_t i = 1; i < fN; ++i)
+         if (fIndexValues[i] != fIndexValues[i - 1])
+            ++nRuns;
+      Bool_t identity = kTRUE;
+      for (Long64_t i = 0; i < fN && identity; ++i)
+         identity = fIndex[i] == i;
+      UChar_t flags = 0;
+      if (identity)
+         flags |= kIdentityIndex;
+      if (nRuns <= fN / 4)
+         flags |= kRunLengthMajor;
+
       R__c = R__b.WriteVersion(TTreeIndex::IsA(), kTRUE);
       TVirtualIndex::Streamer(R__b);
       fMajorName.Streamer(R__b);
       fMinorName.Streamer(R__b);
       R__b << fN;
-      R__b.WriteFastArray(fIndexValues, fN);
+      R__b << flags;
+      if (flags & kRunLengthMajor) {
+         R__b << nRuns;
+         for (Long64_t i = 0; i < fN;) {
+            Long64_t length = 1;
+            while (i + length < fN && fIndexValues[i + length] == fIndexValues[i])
+               ++length;
+            R__b << fIndexValues[i] << length;
+            i += length;
+         }
+      } else {
+         R__b.WriteFastArray(fIndexValues, fN);
+      }
       R__b.WriteFastArray(fIndexValuesMinor, fN);
-      R__b.WriteFastArray(fIndex, fN);
+      if (!identity)
+         R__b.WriteFastArray(fIndex, fN);
       R__b.SetByteCount(R__c, kTRUE);
    }
 }
@@ -616,6 +916,8 @@ void TTreeIndex::Streamer(TBuffer &R__b)
 
 void TTreeIndex::UpdateFormulaLeaves(const TTree *parent)
 {
+   fFriendCacheTree = nullptr;
+   fFriendCache.clear();
    if (fMajorFormula)       { fMajorFormula->UpdateFormulaLeaves();}
    if (fMinorFormula)       { fMinorFormula->UpdateFormulaLeaves();}
    if (fMajorFormulaParent) {
@@ -636,5 +938,7 @@ void TTreeIndex::UpdateFormulaLeaves(const TTree *parent)
 void TTreeIndex::SetTree(TTree *T)
 {
    fTree = T;
+   fFriendCacheTree = nullptr;
+   fFriendCache.clear();
 }
 
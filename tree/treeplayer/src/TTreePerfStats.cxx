@@ -536,6 +536,10 @@ void TTreePerfStats::Paint(Option_t *option)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Print the TTree I/O perf stats.
+///
+/// With option "basket", print the TTree basket information (see PrintBasketInfo()).
+/// With option "sizes", print the changes of the basket and cluster sizes
+/// decided while the tree was written (see TTree::SetAdaptiveBasketSizes()).
 
 void TTreePerfStats::Print(Option_t * option) const
 {
@@ -543,6 +547,7 @@ void TTreePerfStats::Print(Option_t * option) const
    opts.ToLower();
    Bool_t unzip = opts.Contains("unzip");
    Bool_t basket = opts.Contains("basket");
+   Bool_t sizes = opts.Contains("sizes");
    TTreePerfStats *ps = (TTreePerfStats*)this;
    ps->Finish();
 
@@ -573,6 +578,16 @@ void TTreePerfStats::Print(Option_t * option) const
    }
    if (basket)
       PrintBasketInfo(option);
+   if (sizes) {
+      for (const auto &decision : fSizeDecisions) {
+         if (decision.fBranch)
+            printf("  entry %lld: basket size of %s %lld -> %lld bytes\n", decision.fEntry,
+                   decision.fBranch->GetName(), decision.fOldSize, decision.fNewSize);
+         else
+            printf("  entry %lld: cluster size %lld -> %lld entries\n", decision.fEntry, decision.fOldSize,
+                   decision.fNewSize);
+      }
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
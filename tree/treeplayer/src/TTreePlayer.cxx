@@ -77,6 +77,8 @@ extra libraries (Histogram, display, etc).
 #include "TVirtualMonitoring.h"
 #include "TTreeCache.h"
 #include "TVirtualMutex.h"
+#include "TTreeDrawArgsParser.h"
+#include "TH2.h"
 #include "ThreadLocalStorage.h"
 #include "strlcpy.h"
 #include "snprintf.h"
@@ -86,6 +88,14 @@ extra libraries (Histogram, display, etc).
 #include "Fit/UnBinData.h"
 #include "Math/MinimizerOptions.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TTreeProcessorMT.hxx"
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+#endif
+
 
 R__EXTERN Foption_t Foption;
 
@@ -400,7 +410,9 @@ Long64_t TTreePlayer::DrawSelect(const char *varexp0, const char *selection, Opt
    Bool_t optcandle = kFALSE;
    Bool_t optgl5d   = kFALSE;
    Bool_t optnorm   = kFALSE;
+   Bool_t optmt     = kFALSE;
    if (opt.Contains("norm")) {optnorm = kTRUE; opt.ReplaceAll("norm",""); opt.ReplaceAll(" ","");}
+   if (opt.Contains("mt")) {optmt = kTRUE; opt.ReplaceAll("mt",""); opt.ReplaceAll(" ","");}
    if (opt.Contains("para")) optpara = kTRUE;
    if (opt.Contains("candle")) optcandle = kTRUE;
    if (opt.Contains("gl5d")) optgl5d = kTRUE;
@@ -416,6 +428,17 @@ Long64_t TTreePlayer::DrawSelect(const char *varexp0, const char *selection, Opt
    // Do not process more than fMaxEntryLoop entries
    if (nentries > fTree->GetMaxEntryLoop()) nentries = fTree->GetMaxEntryLoop();
 
+   // fill the histogram in parallel, if the expression allows it
+   if (optmt && !optpara && !optcandle && !optgl5d && !evlist && !elist &&
+       DrawSelectMT(varexp0, selection, opt, nentries, firstentry)) {
+      if (optnorm) {
+         Double_t sumh= fHistogram->GetSumOfWeights();
+         if (sumh != 0) fHistogram->Scale(1./sumh);
+      }
+      if (!opt.Contains("goff")) fHistogram->Draw(opt.Data());
+      return fSelectedRows;
+   }
+
    // invoke the selector
    Long64_t nrows = Process(fSelector,option,nentries,firstentry);
    fSelectedRows = nrows;
@@ -536,6 +559,258 @@ Long64_t TTreePlayer::DrawSelect(const char *varexp0, const char *selection, Opt
    return fSelectedRows;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the histogram of TTree::Draw with the clusters of the tree processed in parallel.
+/// Returns kFALSE, without processing any entry, if the expression cannot be
+/// drawn in parallel, in which case the caller falls back to TSelectorDraw.
+///
+/// Only 1D and 2D histograms with fixed axes are supported, i.e. either an
+/// existing histogram `varexp>>hname` or a new one with the full binning
+/// `varexp>>hname(nx,xmin,xmax[,ny,ymin,ymax])`. Each task of TTreeProcessorMT
+/// evaluates its own TTreeFormula on its own view of the tree, fills a private
+/// copy of the histogram which is added to the result at the end. The
+/// expressions returning objects or strings, using entry numbers, as well as
+/// in-memory trees, are left to the sequential processing.
+
+Bool_t TTreePlayer::DrawSelectMT(const char *varexp, const char *selection, const TString &opt, Long64_t nentries,
+                                 Long64_t firstentry)
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || !fTree->GetCurrentFile())
+      return kFALSE;
+   if (opt.Contains("prof") || opt.Contains("entrylist"))
+      return kFALSE;
+
+   TTreeDrawArgsParser parser;
+   if (!parser.Parse(varexp, selection, opt.Data()))
+      return kFALSE;
+   const Int_t dim = parser.GetDimension();
+   if (dim < 1 || dim > 2 || parser.GetObjectName().IsNull())
+      return kFALSE;
+   std::vector<TString> vars;
+   for (Int_t i = 0; i < dim; ++i)
+      vars.emplace_back(parser.GetVarExp(i));
+   const TString sel = parser.GetSelection();
+   for (const TString &e : {parser.GetVarExp(), sel}) {
+      if (e.Contains("Entry$") || e.Contains("Entries$") || e.Contains("Iteration$"))
+         return kFALSE;
+   }
+
+   // the histogram must be given, or be fully specified
+   TH1 *hist = nullptr;
+   TObject *old = gDirectory ? gDirectory->Get(parser.GetObjectName()) : nullptr;
+   if (old) {
+      hist = dynamic_cast<TH1 *>(old);
+      if (!hist || hist->GetDimension() != dim || hist->InheritsFrom(TProfile::Class()) ||
+          hist->InheritsFrom(TProfile2D::Class()) || parser.GetNoParameters() > 0 || hist->CanExtendAllAxes())
+         return kFALSE;
+   } else {
+      for (Int_t i = 0; i < 3 * dim; ++i) {
+         if (!parser.IsSpecified(i))
+            return kFALSE;
+      }
+      if (parser.GetParameter(0) < 1 || parser.GetParameter(1) >= parser.GetParameter(2))
+         return kFALSE;
+      if (dim == 2 && (parser.GetParameter(3) < 1 || parser.GetParameter(4) >= parser.GetParameter(5)))
+         return kFALSE;
+   }
+
+   // check the expressions on the tree itself, e.g. whether they compile
+   // and return numbers, before starting any task
+   fTree->LoadTree(firstentry);
+   {
+      std::vector<std::unique_ptr<TTreeFormula>> formulas;
+      if (!sel.IsNull())
+         formulas.emplace_back(new TTreeFormula("Selection", sel.Data(), fTree));
+      for (Int_t i = 0; i < dim; ++i)
+         formulas.emplace_back(new TTreeFormula(TString::Format("Var%i", i + 1), vars[i].Data(), fTree));
+      for (auto &f : formulas) {
+         if (!f->GetNdim() || f->IsString() || f->EvalClass())
+            return kFALSE;
+      }
+      // the manager is deleted with the last of its formulas
+      auto manager = new TTreeFormulaManager;
+      for (auto &f : formulas)
+         manager->Add(f.get());
+      manager->Sync();
+      if (manager->GetMultiplicity() == -1)
+         return kFALSE;
+   }
+
+   if (hist) {
+      if (!parser.GetAdd())
+         hist->Reset();
+   } else {
+      const TString htitle = parser.GetObjectTitle();
+      const TString precision = gEnv->GetValue(dim == 1 ? "Hist.Precision.1D" : "Hist.Precision.2D", "float");
+      // the first variable goes on the y axis of 2D histograms
+      const Int_t nx = (Int_t)parser.GetParameter(0), ny = dim == 2 ? (Int_t)parser.GetParameter(3) : 0;
+      const Double_t xmin = parser.GetParameter(1), xmax = parser.GetParameter(2);
+      const Double_t ymin = dim == 2 ? parser.GetParameter(4) : 0., ymax = dim == 2 ? parser.GetParameter(5) : 0.;
+      if (dim == 1 && precision.Contains("float"))
+         hist = new TH1F(parser.GetObjectName(), htitle, nx, xmin, xmax);
+      else if (dim == 1)
+         hist = new TH1D(parser.GetObjectName(), htitle, nx, xmin, xmax);
+      else if (precision.Contains("float"))
+         hist = new TH2F(parser.GetObjectName(), htitle, nx, xmin, xmax, ny, ymin, ymax);
+      else
+         hist = new TH2D(parser.GetObjectName(), htitle, nx, xmin, xmax, ny, ymin, ymax);
+      hist->SetLineColor(fTree->GetLineColor());
+      hist->SetLineWidth(fTree->GetLineWidth());
+      hist->SetLineStyle(fTree->GetLineStyle());
+      hist->SetFillColor(fTree->GetFillColor());
+      hist->SetFillStyle(fTree->GetFillStyle());
+      hist->SetMarkerStyle(fTree->GetMarkerStyle());
+      hist->SetMarkerColor(fTree->GetMarkerColor());
+      hist->SetMarkerSize(fTree->GetMarkerSize());
+      if (opt.Contains("e")) hist->Sumw2();
+   }
+
+   // the copies of the histogram filled by the tasks, reused by the next tasks
+   std::mutex mutex;
+   std::vector<std::unique_ptr<TH1>> allHists;
+   std::vector<TH1 *> freeHists;
+   Long64_t nselected = 0;
+   TList *aliases = fTree->GetListOfAliases();
+
+   auto processRange = [&](TTreeReader &reader) {
+      TH1 *h = nullptr;
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         if (freeHists.empty()) {
+            TDirectory::TContext ctxt(nullptr);
+            allHists.emplace_back(static_cast<TH1 *>(hist->Clone()));
+            allHists.back()->Reset();
+            allHists.back()->SetDirectory(nullptr);
+            h = allHists.back().get();
+         } else {
+            h = freeHists.back();
+            freeHists.pop_back();
+         }
+      }
+
+      // owned by the formulas, like the manager of TSelectorDraw
+      TTreeFormulaManager *manager = nullptr;
+      std::unique_ptr<TTreeFormula> select;
+      std::vector<std::unique_ptr<TTreeFormula>> var(dim);
+      Int_t treeNumber = -1;
+      Double_t weight = 1.;
+      Long64_t nfill = 0;
+      Double_t val[2] = {0., 0.};
+
+      while (reader.Next()) {
+         TTree *tree = reader.GetTree();
+         if (!manager) {
+            // the formulas are created once the tree of the range is loaded
+            R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+            if (aliases)
+               for (auto alias : *aliases)
+                  tree->SetAlias(alias->GetName(), alias->GetTitle());
+            manager = new TTreeFormulaManager;
+            if (!sel.IsNull()) {
+               select.reset(new TTreeFormula("Selection", sel.Data(), tree));
+               select->SetQuickLoad(kTRUE);
+               manager->Add(select.get());
+            }
+            for (Int_t i = 0; i < dim; ++i) {
+               var[i].reset(new TTreeFormula(TString::Format("Var%i", i + 1), vars[i].Data(), tree));
+               var[i]->SetQuickLoad(kTRUE);
+               manager->Add(var[i].get());
+            }
+            manager->Sync();
+            treeNumber = tree->GetTreeNumber();
+            weight = tree->GetWeight();
+         } else if (tree->GetTreeNumber() != treeNumber) {
+            treeNumber = tree->GetTreeNumber();
+            weight = tree->GetWeight();
+            if (select)
+               select->UpdateFormulaLeaves();
+            for (auto &v : var)
+               v->UpdateFormulaLeaves();
+         }
+
+         // same handling of the instances of arrays as TSelectorDraw::ProcessFillMultiple
+         const Int_t ndata = manager->GetNdata();
+         if (!ndata)
+            continue;
+         const Bool_t selectMultiple = select && select->GetMultiplicity();
+         Double_t w = select ? weight * select->EvalInstance(0) : weight;
+         if (!w && !selectMultiple)
+            continue;
+         Double_t val0[2] = {0., 0.};
+         if (w) {
+            for (Int_t k = 0; k < dim; ++k)
+               val[k] = val0[k] = var[k]->EvalInstance(0);
+            if (dim == 1)
+               h->Fill(val[0], w);
+            else
+               static_cast<TH2 *>(h)->Fill(val[1], val[0], w);
+            ++nfill;
+         } else {
+            for (auto &v : var)
+               v->ResetLoading();
+         }
+         Bool_t haveVal0 = w != 0.;
+         for (Int_t i = 1; i < ndata; ++i) {
+            if (selectMultiple) {
+               w = weight * select->EvalInstance(i);
+               if (w == 0)
+                  continue;
+               if (!haveVal0) {
+                  for (Int_t k = 0; k < dim; ++k)
+                     if (!var[k]->GetMultiplicity())
+                        val0[k] = var[k]->EvalInstance(0);
+                  haveVal0 = kTRUE;
+               }
+            }
+            for (Int_t k = 0; k < dim; ++k)
+               val[k] = var[k]->GetMultiplicity() ? var[k]->EvalInstance(i) : val0[k];
+            if (dim == 1)
+               h->Fill(val[0], w);
+            else
+               static_cast<TH2 *>(h)->Fill(val[1], val[0], w);
+            ++nfill;
+         }
+      }
+
+      {
+         R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+         select.reset();
+         var.clear();
+      }
+      std::lock_guard<std::mutex> lock(mutex);
+      nselected += nfill;
+      freeHists.emplace_back(h);
+   };
+
+   const Long64_t maxEntries = std::numeric_limits<Long64_t>::max();
+   const Long64_t lastentry = nentries > maxEntries - firstentry ? maxEntries : firstentry + nentries;
+   try {
+      ROOT::TTreeProcessorMT processor(*fTree, 0u, {firstentry, lastentry});
+      processor.Process(processRange);
+   } catch (const std::exception &e) {
+      Error("DrawSelect", "parallel processing failed: %s", e.what());
+      return kFALSE;
+   }
+
+   for (auto &h : allHists)
+      hist->Add(h.get());
+
+   fHistogram = hist;
+   fDimension = dim;
+   fSelectedRows = nselected;
+   fHistogram->SetCanExtend(TH1::kNoAxis);
+   return kTRUE;
+#else
+   (void)varexp;
+   (void)selection;
+   (void)opt;
+   (void)nentries;
+   (void)firstentry;
+   return kFALSE;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Fit  a projected item(s) from a Tree.
 /// Returns -1 in case of error or number of selected events in case of success.
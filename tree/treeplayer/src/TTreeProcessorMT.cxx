@@ -25,6 +25,8 @@ objects.
 */
 
 #include "TROOT.h"
+#include "ROOT/RRangeScheduler.hxx"
+#include "ROOT/RSlotStack.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 
 using namespace ROOT;
@@ -119,6 +121,38 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
    return elistClusters;
 }
 
+/// Fuse the TEntryList-local clusters of each file, as returned by ConvertToElistClusters, into about
+/// maxTasksPerFile ranges with similar numbers of selected entries.
+///
+/// Fusing the clusters before applying the entry list, as MakeClusters does, balances the tasks by the number of
+/// entries of the tree instead: with a sparse TEntryList, a few tasks would then process most of the selected entries
+/// while the others have next to nothing to do.
+static std::vector<std::vector<EntryRange>>
+FuseElistClusters(std::vector<std::vector<EntryRange>> &&clusters, unsigned int maxTasksPerFile)
+{
+   std::vector<std::vector<EntryRange>> eventRangesPerFile(clusters.size());
+   for (auto fileN = 0u; fileN < clusters.size(); ++fileN) {
+      auto &clustersInThisFile = clusters[fileN];
+      if (clustersInThisFile.size() <= maxTasksPerFile) {
+         eventRangesPerFile[fileN] = std::move(clustersInThisFile);
+         continue;
+      }
+      Long64_t nEntries = 0ll;
+      for (const auto &c : clustersInThisFile)
+         nEntries += c.second - c.first;
+      const Long64_t entriesPerTask = (nEntries + maxTasksPerFile - 1) / maxTasksPerFile;
+      auto &eventRanges = eventRangesPerFile[fileN];
+      // the clusters are contiguous in TEntryList entry numbers, see ConvertToElistClusters
+      for (const auto &c : clustersInThisFile) {
+         if (eventRanges.empty() || eventRanges.back().second - eventRanges.back().first >= entriesPerTask)
+            eventRanges.emplace_back(c);
+         else
+            eventRanges.back().second = c.second;
+      }
+   }
+   return eventRangesPerFile;
+}
+
 // EntryRanges and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::vector<Long64_t>>;
 
@@ -242,6 +276,29 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
    return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Turn the clusters of a file into tasks for the RRangeScheduler. Every run of contiguous clusters becomes one task
+/// that can only be split at the cluster boundaries. Chunks are large enough to yield about maxTasksPerFile of them
+/// per file, like the fused clusters of MakeClusters.
+static std::vector<ROOT::Internal::RRangeScheduler::RTask>
+MakeSchedulerTasks(const std::vector<EntryRange> &clusters, std::size_t fileIdx, unsigned int maxTasksPerFile)
+{
+   std::vector<ROOT::Internal::RRangeScheduler::RTask> tasks;
+   Long64_t nEntries = 0;
+   for (const auto &c : clusters) {
+      nEntries += c.second - c.first;
+      if (tasks.empty() || static_cast<Long64_t>(tasks.back().fRange.second) != c.first)
+         tasks.push_back({{c.first, c.second}, {}, 1, fileIdx});
+      // the start of the first cluster is never used as split point, but it makes the list non-empty
+      tasks.back().fSplitPoints.push_back(c.first);
+      tasks.back().fRange.second = c.second;
+   }
+   const Long64_t chunkSize = (nEntries + maxTasksPerFile - 1) / std::max(maxTasksPerFile, 1u);
+   for (auto &t : tasks)
+      t.fChunkSize = chunkSize;
+   return tasks;
+}
+
 } // anonymous namespace
 
 namespace ROOT {
@@ -448,6 +505,10 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRang
 /// be processed in parallel. This means that the code of the user function
 /// should be thread safe.
 ///
+/// With SetDynamicScheduling(true), clusters are not fused up front and the subranges are handed out by a scheduler
+/// that lets idle workers split the remaining ranges of busy ones at cluster boundaries. This keeps all workers busy
+/// until the end of the processing even if files or clusters have very different sizes.
+///
 /// \param[in] func User-defined function that processes a subrange of entries
 void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
 {
@@ -460,6 +521,7 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    // Otherwise we can do it later, concurrently for each file, and clusters will contain local entry numbers.
    // TODO: in practice we could also find clusters per-file in the case of no friends and a TEntryList with
    // sub-entrylists.
+   const auto noFusion = std::numeric_limits<unsigned int>::max();
    const bool hasFriends = !fFriendInfo.fFriendNames.empty();
    const bool hasEntryList = fEntryList.GetN() > 0;
    const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || fGlobalRange.first > 0 ||
@@ -468,9 +530,17 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    auto &allClusters = allClusterAndEntries.first;
    const auto &allEntries = allClusterAndEntries.second;
    if (shouldRetrieveAllClusters) {
-      allClusterAndEntries = MakeClusters(fTreeNames, fFileNames, maxTasksPerFile, fGlobalRange);
-      if (hasEntryList)
+      // With dynamic scheduling, clusters are not fused: their boundaries are needed as split points.
+      // With an entry list, clusters are fused after the entry list is applied, according to the number of
+      // entries of the list they hold.
+      const auto fuseClusters = !fDynamicScheduling && !hasEntryList;
+      allClusterAndEntries =
+         MakeClusters(fTreeNames, fFileNames, fuseClusters ? maxTasksPerFile : noFusion, fGlobalRange);
+      if (hasEntryList) {
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
+         if (!fDynamicScheduling)
+            allClusters = FuseElistClusters(std::move(allClusters), maxTasksPerFile);
+      }
    }
 
    // Per-file processing in case we retrieved all cluster info upfront
@@ -506,10 +576,55 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
    std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
 
-   if (shouldRetrieveAllClusters)
+   if (fDynamicScheduling) {
+      // The clusters of each file are handed to the scheduler as soon as they are known. The task of the file then
+      // keeps processing chunks, of this or any other file, until no work is left: a worker that would idle at the
+      // tail of the event loop splits off half of the remaining range of a busy one.
+      const auto nWorkers = fPool.GetPoolSize();
+      ROOT::Internal::RRangeScheduler scheduler(nWorkers, /*minSplitSize=*/2);
+      ROOT::Internal::RSlotStack workerSlots(nWorkers);
+      std::vector<Long64_t> localEntries(fFileNames.size());
+
+      auto processChunk = [&](std::size_t fileIdx, const EntryRange &c) {
+         std::unique_ptr<TTreeReader> r;
+         if (shouldRetrieveAllClusters) {
+            r = fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList,
+                                         allEntries);
+         } else {
+            r = fTreeView->GetTreeReader(c.first, c.second, {fTreeNames[fileIdx]}, {fFileNames[fileIdx]},
+                                         fFriendInfo, fEntryList, {localEntries[fileIdx]});
+         }
+         func(*r);
+      };
+
+      auto processFileDynamic = [&](std::size_t fileIdx) {
+         std::vector<ROOT::Internal::RRangeScheduler::RTask> tasks;
+         if (shouldRetrieveAllClusters) {
+            tasks = MakeSchedulerTasks(allClusters[fileIdx], fileIdx, maxTasksPerFile);
+         } else {
+            const auto clustersAndEntries = MakeClusters({fTreeNames[fileIdx]}, {fFileNames[fileIdx]}, noFusion);
+            // written before the tasks are added: the scheduler's lock publishes it to the other workers
+            localEntries[fileIdx] = clustersAndEntries.second[0];
+            tasks = MakeSchedulerTasks(clustersAndEntries.first[0], fileIdx, maxTasksPerFile);
+         }
+         for (auto &t : tasks)
+            scheduler.AddTask(std::move(t));
+
+         ROOT::Internal::RSlotStackRAII slotRAII(workerSlots);
+         std::size_t taskFileIdx = 0;
+         std::uint64_t begin = 0;
+         ROOT::Internal::RRangeScheduler::Range_t chunk;
+         while (scheduler.AcquireRange(slotRAII.fSlot, taskFileIdx, begin)) {
+            while (scheduler.GetNextChunk(slotRAII.fSlot, chunk))
+               processChunk(taskFileIdx, EntryRange(chunk.first, chunk.second));
+         }
+      };
+      fPool.Foreach(processFileDynamic, fileIdxs);
+   } else if (shouldRetrieveAllClusters) {
       fPool.Foreach(processFileUsingGlobalClusters, fileIdxs);
-   else
+   } else {
       fPool.Foreach(processFileRetrievingClusters, fileIdxs);
+   }
 
    // make sure TChains and TFiles are cleaned up since they are not globally tracked
    for (unsigned int islot = 0; islot < fTreeView.GetNSlots(); ++islot) {
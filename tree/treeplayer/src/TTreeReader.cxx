@@ -366,21 +366,32 @@ Bool_t TTreeReader::SetProxies() {
    // Now we need to properly set the TTreeCache. We do this in steps:
    // 1. We set the entry range according to the entry range of the TTreeReader
    // 2. We add to the cache the branches identifying them by the name the user provided
-   //    upon creation of the TTreeReader{Value, Array}s
+   //    upon creation of the TTreeReader{Value, Array}s, except for the sparse branches
    // 3. We stop the learning phase.
+   // 4. If there are sparse branches, we let the cache optimize its misses to read them together.
+   // The cache also knows our TEntryList, if any, to only prefetch the baskets holding entries we will read.
    // Operations 1, 2 and 3 need to happen in this order. See: https://sft.its.cern.ch/jira/browse/ROOT-9773?focusedCommentId=87837
    if (fProxiesSet) {
       const auto curFile = fTree->GetCurrentFile();
-      if (curFile && fTree->GetTree()->GetReadCache(curFile, true)) {
+      auto *tc = curFile ? fTree->GetTree()->GetReadCache(curFile, true) : nullptr;
+      if (tc) {
+         tc->SetEntryList(fEntryList);
          if (!(-1LL == fEndEntry && 0ULL == fBeginEntry)) {
             // We need to avoid to pass -1 as end entry to the SetCacheEntryRange method
             const auto lastEntry = (-1LL == fEndEntry) ? fTree->GetEntriesFast() : fEndEntry;
             fTree->SetCacheEntryRange(fBeginEntry, lastEntry);
          }
+         bool hasSparseBranches = false;
          for (auto value: fValues) {
+            if (fSparseBranches.count(value->GetBranchName()) > 0) {
+               hasSparseBranches = true;
+               continue;
+            }
             fTree->AddBranchToCache(value->GetProxy()->GetBranchName(), true);
          }
          fTree->StopCacheLearningPhase();
+         if (hasSparseBranches)
+            tc->SetOptimizeMisses(true);
       }
    }
 
@@ -67,6 +67,13 @@ namespace {
       }
    };
 
+   /// Whether the collection is a std::vector of values; std::vector<bool> does not store its elements as bools.
+   bool IsContiguousCollection(TVirtualCollectionProxy &collectionProxy)
+   {
+      return collectionProxy.GetCollectionType() == ROOT::kSTLvector && !collectionProxy.HasPointers() &&
+             collectionProxy.GetType() != kBool_t;
+   }
+
    // Reader interface for STL
    class TSTLReader final: public TVirtualCollectionReader {
    public:
@@ -101,6 +108,11 @@ namespace {
             return myCollectionProxy->At(idx);
          }
       }
+
+      bool IsContiguous(ROOT::Detail::TBranchProxy* proxy) override {
+         TVirtualCollectionProxy *myCollectionProxy = GetCP(proxy);
+         return myCollectionProxy && IsContiguousCollection(*myCollectionProxy);
+      }
    };
 
    class TCollectionLessSTLReader final: public TVirtualCollectionReader {
@@ -147,6 +159,10 @@ namespace {
             return myCollectionProxy->At(idx);
          }
       }
+
+      bool IsContiguous(ROOT::Detail::TBranchProxy* /*proxy*/) override {
+         return IsContiguousCollection(*fLocalCollection);
+      }
    };
 
 
@@ -192,6 +208,8 @@ namespace {
          return (void*)((Byte_t*)array + (objectSize * idx));
       }
 
+      bool IsContiguous(ROOT::Detail::TBranchProxy* /*proxy*/) override { return true; }
+
       void SetBasicTypeSize(Int_t size){
          fBasicTypeSize = size;
       }
@@ -369,6 +387,8 @@ namespace {
          return (Byte_t*)address + (fElementSize * idx);
       }
 
+      bool IsContiguous(ROOT::Detail::TBranchProxy* /*proxy*/) override { return true; }
+
    protected:
       void ProxyRead(){
          fValueReader->ProxyRead();
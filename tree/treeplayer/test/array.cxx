@@ -29,6 +29,47 @@ TEST(TTreeReaderArray, Vector)
    EXPECT_FLOAT_EQ(17.f, vec[0]);
 }
 
+TEST(TTreeReaderArray, Span)
+{
+   TTree tree("TTreeReaderArrayTree", "In-memory test tree");
+   std::vector<float> vecf{17.f, 18.f, 19.f};
+   double arr[4] = {1., 2., 3., 4.};
+   std::vector<bool> vecb{true, false};
+   tree.Branch("vec", &vecf);
+   tree.Branch("arr", arr, "arr[4]/D");
+   tree.Branch("vecb", &vecb);
+   tree.Fill();
+   vecf.clear();
+   tree.Fill();
+   tree.ResetBranchAddresses();
+
+   TTreeReader tr(&tree);
+   TTreeReaderArray<float> rvec(tr, "vec");
+   TTreeReaderArray<double> rarr(tr, "arr");
+   TTreeReaderArray<bool> rvecb(tr, "vecb");
+
+   tr.SetEntry(0);
+   EXPECT_TRUE(rvec.IsContiguous());
+   auto span = rvec.GetSpan();
+   ASSERT_EQ(3u, span.size());
+   EXPECT_EQ(&rvec[0], span.data());
+   EXPECT_FLOAT_EQ(19.f, span[2]);
+
+   EXPECT_TRUE(rarr.IsContiguous());
+   const auto &crarr = rarr;
+   auto arrSpan = crarr.GetSpan();
+   ASSERT_EQ(4u, arrSpan.size());
+   EXPECT_DOUBLE_EQ(4., arrSpan[3]);
+
+   // the elements of a std::vector<bool> are not bools
+   EXPECT_FALSE(rvecb.IsContiguous());
+   EXPECT_TRUE(rvecb.GetSpan().empty());
+   EXPECT_TRUE(rvecb[0]);
+
+   tr.SetEntry(1);
+   EXPECT_TRUE(rvec.GetSpan().empty());
+}
+
 TEST(TTreeReaderArray, MultiReaders)
 {
    // See https://root.cern.ch/phpBB3/viewtopic.php?f=3&t=22790
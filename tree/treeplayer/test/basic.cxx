@@ -5,6 +5,7 @@
 #include "TLeaf.h"
 #include "TROOT.h"
 #include "TTree.h"
+#include "TTreeCache.h"
 #include "TTreeReader.h"
 #include "TTreeReaderValue.h"
 #include "TTreeReaderArray.h"
@@ -509,3 +510,79 @@ TEST(TTreeReaderBasic, DisappearingBranch)
    gSystem->Unlink("DisappearingBranch0.root");
    gSystem->Unlink("DisappearingBranch1.root");
 }
+
+TEST(TTreeReaderBasic, SparseBranch)
+{
+   const auto fileName = "TTreeReaderSparseBranch.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int x = 0;
+      int y = 0;
+      t.Branch("x", &x);
+      t.Branch("y", &y);
+      for (x = 0; x < 1000; ++x) {
+         y = 2 * x;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fileName);
+   auto t = f.Get<TTree>("t");
+   TTreeReader r(t);
+   r.AddSparseBranch("y");
+   TTreeReaderValue<int> x(r, "x");
+   TTreeReaderValue<int> y(r, "y");
+   int sum = 0;
+   while (r.Next()) {
+      if (*x % 100 == 0)
+         sum += *y;
+   }
+   EXPECT_EQ(sum, 9000);
+
+   // only the dense branch is prefetched, misses of the sparse one are optimized
+   auto tc = t->GetReadCache(&f);
+   ASSERT_NE(tc, nullptr);
+   EXPECT_TRUE(tc->GetOptimizeMisses());
+   EXPECT_NE(tc->GetCachedBranches()->FindObject("x"), nullptr);
+   EXPECT_EQ(tc->GetCachedBranches()->FindObject("y"), nullptr);
+
+   gSystem->Unlink(fileName);
+}
+
+TEST(TTreeReaderBasic, EntryListPrefetch)
+{
+   const auto fileName = "TTreeReaderEntryListPrefetch.root";
+   const int nEntries = 100000;
+   auto value = [](int i) { return int(i * 2654435761u); };
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(0); // a single cluster, of about 400 baskets
+      int x = 0;
+      t.Branch("x", &x, 1000);
+      for (int i = 0; i < nEntries; ++i) {
+         x = value(i);
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fileName);
+   auto t = f.Get<TTree>("t");
+   TEntryList selected;
+   selected.Enter(10);
+   selected.Enter(nEntries / 2);
+   TTreeReader r(t, &selected);
+   TTreeReaderValue<int> x(r, "x");
+   std::vector<int> values;
+   while (r.Next())
+      values.push_back(*x);
+   EXPECT_EQ(values, std::vector<int>({value(10), value(nEntries / 2)}));
+
+   // only the baskets holding selected entries are read, not the whole cluster
+   EXPECT_LT(f.GetBytesRead(), f.GetSize() / 4);
+
+   gSystem->Unlink(fileName);
+}
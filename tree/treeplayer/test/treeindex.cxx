@@ -0,0 +1,190 @@
+#include "TChain.h"
+#include "TChainIndex.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeIndex.h"
+
+#include "gtest/gtest.h"
+
+#include <climits>
+#include <memory>
+#include <vector>
+
+namespace {
+
+// Fill `tree` with `n` entries, with runs of 100 events starting at `firstRun`; the entries are in reverse order if
+// `reverse`
+void FillRunEvent(TTree &tree, int n, bool reverse, int firstRun = 0)
+{
+   Int_t run;
+   Long64_t event;
+   tree.Branch("run", &run);
+   tree.Branch("event", &event);
+   for (int i = 0; i < n; ++i) {
+      const int j = reverse ? n - 1 - i : i;
+      run = firstRun + j / 100;
+      event = j % 100;
+      tree.Fill();
+   }
+}
+
+} // anonymous namespace
+
+TEST(TTreeIndex, SortedColumns)
+{
+   TTree tree("t", "t");
+   tree.SetAutoFlush(1000);
+   FillRunEvent(tree, 10000, false);
+   ASSERT_GT(tree.BuildIndex("run", "event"), 0);
+
+   auto index = static_cast<TTreeIndex *>(tree.GetTreeIndex());
+   ASSERT_EQ(index->GetN(), 10000);
+   for (Long64_t i = 0; i < index->GetN(); ++i)
+      EXPECT_EQ(index->GetIndex()[i], i);
+   EXPECT_EQ(tree.GetEntryNumberWithIndex(42, 17), 4217);
+   EXPECT_EQ(tree.GetEntryNumberWithIndex(42, 100), -1);
+}
+
+TEST(TTreeIndex, UnsortedColumns)
+{
+   TTree tree("t", "t");
+   tree.SetAutoFlush(1000);
+   FillRunEvent(tree, 10000, true);
+
+   // expressions are evaluated with a TTreeFormula, branches are read directly: both must give the same index
+   TTreeIndex fromFormula(&tree, "run*1", "event*1");
+   TTreeIndex fromColumns(&tree, "run", "event");
+   ASSERT_EQ(fromColumns.GetN(), 10000);
+   for (Long64_t i = 0; i < fromColumns.GetN(); ++i) {
+      EXPECT_EQ(fromColumns.GetIndex()[i], fromFormula.GetIndex()[i]);
+      EXPECT_EQ(fromColumns.GetIndexValues()[i], fromFormula.GetIndexValues()[i]);
+      EXPECT_EQ(fromColumns.GetIndexValuesMinor()[i], fromFormula.GetIndexValuesMinor()[i]);
+   }
+   EXPECT_EQ(fromColumns.GetEntryNumberWithIndex(42, 17), 9999 - 4217);
+}
+
+TEST(TTreeIndex, RangeQuery)
+{
+   const auto fname1 = "treeindex_rangequery1.root";
+   const auto fname2 = "treeindex_rangequery2.root";
+   {
+      TFile f(fname1, "RECREATE");
+      TTree tree("t", "t");
+      FillRunEvent(tree, 1000, false);
+      tree.Write();
+   }
+   {
+      // the runs of the second file follow those of the first one
+      TFile f(fname2, "RECREATE");
+      TTree tree("t", "t");
+      FillRunEvent(tree, 1000, true, 10);
+      tree.Write();
+   }
+
+   {
+      TFile f(fname2);
+      auto tree = f.Get<TTree>("t");
+      tree->BuildIndex("run", "event");
+      std::vector<Long64_t> entries;
+      EXPECT_EQ(tree->GetTreeIndex()->GetEntryNumbersWithIndexRange(15, LLONG_MIN, 15, LLONG_MAX, entries), 100);
+      ASSERT_EQ(entries.size(), 100u);
+      for (int i = 0; i < 100; ++i)
+         EXPECT_EQ(entries[i], 999 - 500 - i);
+      entries.clear();
+      EXPECT_EQ(tree->GetTreeIndex()->GetEntryNumbersWithIndexRange(15, 98, 16, 1, entries), 4);
+      EXPECT_EQ(entries, (std::vector<Long64_t>{999 - 598, 999 - 599, 999 - 600, 999 - 601}));
+      entries.clear();
+      EXPECT_EQ(tree->GetTreeIndex()->GetEntryNumbersWithIndexRange(30, 0, 40, 0, entries), 0);
+      EXPECT_TRUE(entries.empty());
+   }
+
+   TChain chain("t");
+   chain.Add(fname1);
+   chain.Add(fname2);
+   chain.BuildIndex("run", "event");
+   ASSERT_TRUE(dynamic_cast<TChainIndex *>(chain.GetTreeIndex()));
+   std::vector<Long64_t> entries;
+   EXPECT_EQ(chain.GetTreeIndex()->GetEntryNumbersWithIndexRange(9, 98, 10, 1, entries), 4);
+   EXPECT_EQ(entries, (std::vector<Long64_t>{998, 999, 1000 + 999, 1000 + 998}));
+
+   gSystem->Unlink(fname1);
+   gSystem->Unlink(fname2);
+}
+
+TEST(TTreeIndex, CompactStreaming)
+{
+   const auto fname = "treeindex_compactstreaming.root";
+   for (bool reverse : {false, true}) {
+      Long64_t indexBytes;
+      {
+         TFile f(fname, "RECREATE");
+         f.SetCompressionLevel(0);
+         TTree tree("t", "t");
+         FillRunEvent(tree, 10000, reverse);
+         tree.BuildIndex("run", "event");
+         indexBytes = f.WriteObjectAny(tree.GetTreeIndex(), TTreeIndex::Class(), "index");
+         tree.Write();
+      }
+      // sorted: the run numbers are written as 100 runs and the index is not written at all
+      if (!reverse)
+         EXPECT_LT(indexBytes, 10000 * 8 + 1000);
+
+      TFile f(fname);
+      auto tree = f.Get<TTree>("t");
+      auto index = static_cast<TTreeIndex *>(tree->GetTreeIndex());
+      ASSERT_NE(index, nullptr);
+      ASSERT_EQ(index->GetN(), 10000);
+      TTreeIndex expected(tree, "run", "event");
+      for (Long64_t i = 0; i < index->GetN(); ++i) {
+         EXPECT_EQ(index->GetIndex()[i], expected.GetIndex()[i]);
+         EXPECT_EQ(index->GetIndexValues()[i], expected.GetIndexValues()[i]);
+         EXPECT_EQ(index->GetIndexValuesMinor()[i], expected.GetIndexValuesMinor()[i]);
+      }
+      EXPECT_EQ(tree->GetEntryNumberWithIndex(42, 17), reverse ? 9999 - 4217 : 4217);
+   }
+   gSystem->Unlink(fname);
+}
+
+TEST(TTreeIndex, IndexedFriend)
+{
+   // the friend holds the entries in reverse order, y is the entry number in the main tree
+   TTree main("main", "main");
+   main.SetAutoFlush(1000);
+   FillRunEvent(main, 10000, false);
+   TTree byColumns("byColumns", "byColumns");
+   TTree byFormula("byFormula", "byFormula");
+   for (auto t : {&byColumns, &byFormula}) {
+      t->SetAutoFlush(1000);
+      Int_t run;
+      Long64_t event, y;
+      t->Branch("run", &run);
+      t->Branch("event", &event);
+      t->Branch("y", &y);
+      for (y = 10000 - 1; y >= 0; --y) {
+         run = y / 100;
+         event = y % 100;
+         t->Fill();
+      }
+      t->ResetBranchAddresses();
+   }
+   ASSERT_GT(byColumns.BuildIndex("run", "event"), 0);
+   // the expressions cannot be read directly from the main tree
+   ASSERT_GT(byFormula.BuildIndex("run*1", "event*1"), 0);
+   main.AddFriend(&byColumns);
+   main.AddFriend(&byFormula);
+
+   Long64_t yColumns = -1, yFormula = -1;
+   main.SetBranchAddress("byColumns.y", &yColumns);
+   main.SetBranchAddress("byFormula.y", &yFormula);
+   // forward, then jumping back and across clusters
+   std::vector<Long64_t> entries(10000);
+   for (Long64_t i = 0; i < 10000; ++i)
+      entries[i] = i;
+   entries.insert(entries.end(), {5, 4, 9999, 0, 3000, 2999, 7001});
+   for (auto e : entries) {
+      ASSERT_GT(main.GetEntry(e), 0);
+      EXPECT_EQ(e, yColumns);
+      EXPECT_EQ(e, yFormula);
+   }
+}
@@ -7,6 +7,8 @@
 #include <utility>
 
 #include <TFile.h>
+#include <TH1.h>
+#include <TH2.h>
 #include <TTree.h>
 #include <TSystem.h>
 #include <TTreeReader.h>
@@ -518,3 +520,81 @@ TEST(TreeProcessorMT, TreesInSameFile)
    gSystem->Unlink(fname.c_str());
    ROOT::DisableImplicitMT();
 }
+
+TEST(TreeProcessorMT, DynamicScheduling)
+{
+   const std::vector<std::string> smallFiles = {"treeprocmt_dynamic0.root", "treeprocmt_dynamic1.root"};
+   const auto largeFile = "treeprocmt_dynamic_large.root";
+   const auto nLargeEntries = 400;
+   WriteFiles({"t", "t"}, smallFiles);
+   WriteFileManyClusters(nLargeEntries, "t", largeFile);
+
+   TChain c("t");
+   c.Add(largeFile);
+   for (const auto &f : smallFiles)
+      c.Add(f.c_str());
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> largeFileRanges;
+   std::atomic<int> nEntries{0};
+   auto f = [&](TTreeReader &r) {
+      const auto range = r.GetEntriesRange();
+      while (r.Next())
+         ++nEntries;
+      if (std::string(r.GetTree()->GetCurrentFile()->GetName()) == largeFile) {
+         std::lock_guard<std::mutex> l(m);
+         largeFileRanges.emplace_back(range);
+      }
+   };
+
+   for (auto nThreads : {1u, 4u}) {
+      ROOT::EnableImplicitMT(nThreads);
+      ROOT::TTreeProcessorMT tp(c);
+      tp.SetDynamicScheduling(true);
+      tp.Process(f);
+      EXPECT_EQ(nLargeEntries + 20, nEntries);
+      CheckClusters(largeFileRanges, nLargeEntries);
+      nEntries = 0;
+      largeFileRanges.clear();
+      ROOT::DisableImplicitMT();
+   }
+
+   DeleteFiles(smallFiles);
+   gSystem->Unlink(largeFile);
+}
+
+TEST(TreeProcessorMT, DrawMT)
+{
+   const std::vector<std::string> files = {"treeprocmt_draw0.root", "treeprocmt_draw1.root"};
+   WriteFiles({"t", "t"}, files);
+   TChain c("t");
+   for (const auto &f : files)
+      c.Add(f.c_str());
+
+   auto draw = [&c](const char *varexp, const char *selection, const char *option) {
+      EXPECT_EQ(15, c.Draw(varexp, selection, option));
+      std::unique_ptr<TH1> h(static_cast<TH1 *>(c.GetHistogram()->Clone("copy")));
+      h->SetDirectory(nullptr);
+      return h;
+   };
+   auto hseq = draw("v>>hseq(20,0.5,20.5)", "v>5", "goff");
+   auto h2seq = draw("2*v:v>>h2seq(20,0.5,20.5,40,0,41)", "v>5", "goff");
+
+   ROOT::EnableImplicitMT(4);
+   auto hmt = draw("v>>hmt(20,0.5,20.5)", "v>5", "goff mt");
+   auto h2mt = draw("2*v:v>>h2mt(20,0.5,20.5,40,0,41)", "v>5", "goff mt");
+   // an existing histogram is reset and refilled
+   auto hmt2 = draw("v>>hmt", "v>5", "goff mt");
+   ROOT::DisableImplicitMT();
+
+   for (auto h : {hmt.get(), hmt2.get()}) {
+      EXPECT_EQ(hseq->GetEntries(), h->GetEntries());
+      for (int i = 0; i <= hseq->GetNbinsX() + 1; ++i)
+         EXPECT_EQ(hseq->GetBinContent(i), h->GetBinContent(i));
+   }
+   EXPECT_EQ(h2seq->GetEntries(), h2mt->GetEntries());
+   EXPECT_DOUBLE_EQ(h2seq->GetMean(1), h2mt->GetMean(1));
+   EXPECT_DOUBLE_EQ(h2seq->GetMean(2), h2mt->GetMean(2));
+
+   DeleteFiles(files);
+}